@@ -0,0 +1,54 @@
+#===============================================================================
+# Copyright 2021 Intel Corporation
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#===============================================================================
+
+# Locates the ITT API (ittnotify.h and the static libittnotify) for the
+# primitive execution task annotations
+#===============================================================================
+
+if(itt_cmake_included)
+    return()
+endif()
+set(itt_cmake_included true)
+include("cmake/options.cmake")
+
+if(NOT DNNL_ENABLE_ITT_TASKS)
+    return()
+endif()
+
+set(ITT_HINTS ${ITT_ROOT} $ENV{ITT_ROOT} $ENV{VTUNE_PROFILER_DIR}
+    $ENV{VTUNE_PROFILER_2021_DIR} $ENV{VTUNE_AMPLIFIER_DIR})
+
+find_path(ITT_INCLUDE_DIR ittnotify.h
+    HINTS ${ITT_HINTS} PATH_SUFFIXES include sdk/include)
+find_library(ITT_LIBRARY
+    NAMES libittnotify${CMAKE_STATIC_LIBRARY_SUFFIX} ittnotify
+    HINTS ${ITT_HINTS} PATH_SUFFIXES lib64 lib sdk/lib64 sdk/lib)
+
+if(NOT ITT_INCLUDE_DIR OR NOT ITT_LIBRARY)
+    message(FATAL_ERROR "DNNL_ENABLE_ITT_TASKS requires the ITT API, "
+        "set ITT_ROOT to the directory with include/ittnotify.h and "
+        "lib64/libittnotify${CMAKE_STATIC_LIBRARY_SUFFIX}")
+endif()
+
+include_directories(${ITT_INCLUDE_DIR})
+list(APPEND EXTRA_STATIC_LIBS ${ITT_LIBRARY})
+if(UNIX)
+    # The ITT API loads the collector at run-time
+    list(APPEND EXTRA_SHARED_LIBS "${CMAKE_DL_LIBS}")
+endif()
+add_definitions(-DDNNL_ENABLE_ITT_TASKS)
+
+message(STATUS "ITT API: ${ITT_LIBRARY}")
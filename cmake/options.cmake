@@ -114,6 +114,13 @@ option(DNNL_ENABLE_JIT_PROFILING
     the kernels as `outside any known module`."
     ON)
 
+option(DNNL_ENABLE_ITT_TASKS
+    "Enable annotation of primitive executions as ITT tasks for VTune Profiler
+    and other ITT-aware tracers (off by default). Requires the ITT API, which
+    is searched in ITT_ROOT and in the VTune Profiler installation. The
+    annotations can be disabled at run-time with DNNL_ITT_TASKS=0."
+    OFF)
+
 # ===================
 # Engine capabilities
 # ===================
@@ -0,0 +1,217 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+/// @example cpu_batch_sliced_inference.cpp
+/// @copybrief cpu_batch_sliced_inference_cpp
+/// > Annotated version: @ref cpu_batch_sliced_inference_cpp
+
+/// @page cpu_batch_sliced_inference_cpp Batch-Sliced Inference Example
+/// This C++ API example demonstrates how to run a chain of memory-bound
+/// layers on slices of a large batch, so that the intermediate activations
+/// stay in the caches between layers.
+///
+/// > Example code: @ref cpu_batch_sliced_inference.cpp
+///
+/// When a layer is executed on the whole batch, its output usually does not
+/// fit the last level cache and the next layer reads it back from DRAM. If
+/// the primitives of the chain are instead created for a slice of the batch
+/// and executed slice by slice, only the inputs and outputs of the whole
+/// chain travel through memory, while each intermediate tensor is a single
+/// slice-sized buffer reused for all slices.
+///
+/// The slices of the full-batch tensors are described by memory objects
+/// created for the slice and moved over the full-batch buffers with
+/// dnnl::memory::set_data_handle(). This requires the batch to be the
+/// outermost dimension of their memory format, so that a slice is
+/// contiguous in memory.
+///
+/// The slice size is a trade-off: the intermediate tensors of a slice should
+/// fit the last level cache, while a slice should still give enough work to
+/// all the threads that execute a primitive.
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+
+#include "example_utils.hpp"
+#include "oneapi/dnnl/dnnl.hpp"
+
+using namespace dnnl;
+
+using tag = memory::format_tag;
+using dt = memory::data_type;
+
+/// A sequence of primitives created for a batch slice and executed slice by
+/// slice over tensors that hold the whole batch.
+class batch_sliced_chain_t {
+public:
+    batch_sliced_chain_t(const engine &eng) : eng_(eng) {}
+
+    /// Returns a memory object for the first slice of the full-batch tensor
+    /// @p full. The chain moves it to the next slice on every iteration.
+    memory slice(const memory &full, const memory::desc &slice_md) {
+        memory m(slice_md, eng_, full.get_data_handle());
+        slices_.push_back({m, static_cast<char *>(full.get_data_handle()),
+                slice_md.get_size()});
+        return m;
+    }
+
+    void append(
+            const primitive &p, const std::unordered_map<int, memory> &args) {
+        steps_.push_back({p, args});
+    }
+
+    void execute(stream &s, memory::dim n_slices) {
+        for (memory::dim i = 0; i < n_slices; ++i) {
+            // The handles may only be changed once the previous slice is
+            // done with them.
+            s.wait();
+            for (auto &sl : slices_)
+                sl.mem.set_data_handle(sl.base + i * sl.size);
+            for (auto &st : steps_)
+                st.prim.execute(s, st.args);
+        }
+        s.wait();
+    }
+
+private:
+    struct slice_t {
+        memory mem;
+        char *base;
+        size_t size;
+    };
+    struct step_t {
+        primitive prim;
+        std::unordered_map<int, memory> args;
+    };
+
+    engine eng_;
+    std::vector<slice_t> slices_;
+    std::vector<step_t> steps_;
+};
+
+/// Creates convolution + ReLU, 1x1 convolution + ReLU for batch @p mb and
+/// appends them to @p chain, together with the reorders from and to the
+/// user @p src and @p dst. The weights are shared by all chains.
+void build_chain(batch_sliced_chain_t &chain, const engine &eng, stream &s,
+        memory::dim mb, const memory &src, const memory &dst,
+        const memory &user_w1, const memory &user_w2, const memory &b1,
+        const memory &b2) {
+    const memory::dim C = 64, C2 = 128, H = 28, W = 28;
+    const memory::dims src_dims = {mb, C, H, W};
+    const memory::dims dst_dims = {mb, C2, H, W};
+
+    post_ops relu;
+    relu.append_eltwise(1.f, algorithm::eltwise_relu, 0.f, 0.f);
+    primitive_attr attr;
+    attr.set_post_ops(relu);
+
+    auto conv1_pd = convolution_forward::primitive_desc(
+            {prop_kind::forward_inference, algorithm::convolution_direct,
+                    {src_dims, dt::f32, tag::any}, user_w1.get_desc(),
+                    b1.get_desc(), {src_dims, dt::f32, tag::any}, {1, 1},
+                    {1, 1}, {1, 1}},
+            attr, eng);
+    auto conv2_pd = convolution_forward::primitive_desc(
+            {prop_kind::forward_inference, algorithm::convolution_direct,
+                    conv1_pd.dst_desc(), user_w2.get_desc(), b2.get_desc(),
+                    {dst_dims, dt::f32, tag::any}, {1, 1}, {0, 0}, {0, 0}},
+            attr, eng);
+
+    // The full-batch user tensors are moved over, the intermediate tensors
+    // are slice-sized buffers reused by every slice.
+    auto src_slice = chain.slice(src, {src_dims, dt::f32, tag::nchw});
+    auto dst_slice = chain.slice(dst, {dst_dims, dt::f32, tag::nchw});
+    auto conv1_src = memory(conv1_pd.src_desc(), eng);
+    auto conv1_dst = memory(conv1_pd.dst_desc(), eng);
+    auto conv2_dst = memory(conv2_pd.dst_desc(), eng);
+
+    // The weights do not depend on the batch and are reordered once.
+    auto w1 = memory(conv1_pd.weights_desc(), eng);
+    auto w2 = memory(conv2_pd.weights_desc(), eng);
+    reorder(user_w1, w1).execute(
+            s, {{DNNL_ARG_FROM, user_w1}, {DNNL_ARG_TO, w1}});
+    reorder(user_w2, w2).execute(
+            s, {{DNNL_ARG_FROM, user_w2}, {DNNL_ARG_TO, w2}});
+    s.wait();
+
+    chain.append(reorder(src_slice, conv1_src),
+            {{DNNL_ARG_FROM, src_slice}, {DNNL_ARG_TO, conv1_src}});
+    chain.append(convolution_forward(conv1_pd),
+            {{DNNL_ARG_SRC, conv1_src}, {DNNL_ARG_WEIGHTS, w1},
+                    {DNNL_ARG_BIAS, b1}, {DNNL_ARG_DST, conv1_dst}});
+    chain.append(convolution_forward(conv2_pd),
+            {{DNNL_ARG_SRC, conv1_dst}, {DNNL_ARG_WEIGHTS, w2},
+                    {DNNL_ARG_BIAS, b2}, {DNNL_ARG_DST, conv2_dst}});
+    chain.append(reorder(conv2_dst, dst_slice),
+            {{DNNL_ARG_FROM, conv2_dst}, {DNNL_ARG_TO, dst_slice}});
+}
+
+void batch_sliced_inference() {
+    engine eng(engine::kind::cpu, 0);
+    stream s(eng);
+
+    const memory::dim N = 64, C = 64, C2 = 128, H = 28, W = 28;
+    const memory::dim slice_mb = 4;
+    if (N % slice_mb != 0)
+        throw std::logic_error("The batch must be a multiple of the slice.");
+
+    auto src = memory({{N, C, H, W}, dt::f32, tag::nchw}, eng);
+    auto dst = memory({{N, C2, H, W}, dt::f32, tag::nchw}, eng);
+    auto ref_dst = memory({{N, C2, H, W}, dt::f32, tag::nchw}, eng);
+    auto w1 = memory({{C, C, 3, 3}, dt::f32, tag::oihw}, eng);
+    auto w2 = memory({{C2, C, 1, 1}, dt::f32, tag::oihw}, eng);
+    auto b1 = memory({{C}, dt::f32, tag::x}, eng);
+    auto b2 = memory({{C2}, dt::f32, tag::x}, eng);
+
+    auto fill = [](memory m, float freq) {
+        std::vector<float> data(m.get_desc().get_size() / sizeof(float));
+        for (size_t i = 0; i < data.size(); ++i)
+            data[i] = std::sin(i * freq);
+        write_to_dnnl_memory(data.data(), m);
+    };
+    fill(src, 0.1f);
+    fill(w1, 0.7f);
+    fill(w2, 1.3f);
+    fill(b1, 0.5f);
+    fill(b2, 0.3f);
+
+    // Reference: the same chain created for the whole batch, executed once.
+    batch_sliced_chain_t full_chain(eng);
+    build_chain(full_chain, eng, s, N, src, ref_dst, w1, w2, b1, b2);
+    full_chain.execute(s, 1);
+
+    batch_sliced_chain_t sliced_chain(eng);
+    build_chain(sliced_chain, eng, s, slice_mb, src, dst, w1, w2, b1, b2);
+    sliced_chain.execute(s, N / slice_mb);
+
+    std::vector<float> dst_data(N * C2 * H * W), ref_dst_data(N * C2 * H * W);
+    read_from_dnnl_memory(dst_data.data(), dst);
+    read_from_dnnl_memory(ref_dst_data.data(), ref_dst);
+    for (size_t i = 0; i < dst_data.size(); ++i) {
+        const float diff = std::fabs(dst_data[i] - ref_dst_data[i]);
+        if (diff > 1e-4f * std::max(1.f, std::fabs(ref_dst_data[i])))
+            throw std::logic_error("Batch-sliced result mismatch.");
+    }
+}
+
+int main(int argc, char **argv) {
+    return handle_example_errors({engine::kind::cpu}, batch_sliced_inference);
+}
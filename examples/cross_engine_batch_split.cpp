@@ -0,0 +1,247 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+/// @example cross_engine_batch_split.cpp
+/// @copybrief cross_engine_batch_split_cpp
+/// > Annotated version: @ref cross_engine_batch_split_cpp
+
+/// @page cross_engine_batch_split_cpp Batch Split between CPU and GPU Engines
+/// This C++ API example demonstrates how to split the minibatch of a single
+/// layer between the CPU and the GPU engines and run both parts
+/// concurrently.
+///
+/// > Example code: @ref cross_engine_batch_split.cpp
+///
+/// On a host with an integrated GPU both devices can work on the same
+/// layer. The same convolution is created for each engine with its part of
+/// the minibatch, and the split is sized by the throughput of each engine
+/// measured on a calibration run.
+///
+/// The user tensors live in host memory. The CPU part works on them in place
+/// through memory objects that point to its slice of the batch, while the
+/// GPU part moves its slice with cross-engine reorders. All the GPU work is
+/// submitted first, so that it runs while the CPU computes its own part.
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+#include "example_utils.hpp"
+#include "oneapi/dnnl/dnnl.hpp"
+
+using namespace dnnl;
+
+using tag = memory::format_tag;
+using dt = memory::data_type;
+
+const memory::dim N = 32, IC = 32, OC = 64, H = 28, W = 28;
+
+/// The convolution of one engine and its part of the minibatch.
+struct engine_part_t {
+    engine eng;
+    stream strm;
+    memory::dim mb = 0, mb_offset = 0;
+
+    convolution_forward conv;
+    memory weights, bias;
+    // GPU only: device copies of the slice and the reorders moving them
+    memory src, dst;
+    reorder to_device, from_device;
+};
+
+/// Convolution + ReLU with the minibatch split between the CPU and the GPU.
+class split_conv_t {
+public:
+    split_conv_t(const engine &cpu_eng, const engine &gpu_eng,
+            const memory &user_weights, const memory &user_bias)
+        : user_weights_(user_weights), user_bias_(user_bias) {
+        cpu_.eng = cpu_eng;
+        cpu_.strm = stream(cpu_eng);
+        gpu_.eng = gpu_eng;
+        gpu_.strm = stream(gpu_eng);
+    }
+
+    /// Gives the first @p mb_gpu images of the batch to the GPU and the
+    /// rest to the CPU.
+    void set_split(memory::dim mb_gpu) {
+        init_part(gpu_, mb_gpu, 0);
+        init_part(cpu_, N - mb_gpu, mb_gpu);
+    }
+
+    /// Splits the batch in proportion to the throughput of the engines,
+    /// measured with half of the batch on each.
+    void calibrate(const memory &src, const memory &dst) {
+        set_split(N / 2);
+        // the first execution includes the kernel compilation
+        execute(src, dst);
+        const double gpu_time = time_part(gpu_, src, dst);
+        const double cpu_time = time_part(cpu_, src, dst);
+
+        const double gpu_share = cpu_time / (cpu_time + gpu_time);
+        set_split(std::min(N, (memory::dim)std::round(N * gpu_share)));
+    }
+
+    void execute(const memory &src, const memory &dst) {
+        submit(gpu_, src, dst);
+        submit(cpu_, src, dst);
+        cpu_.strm.wait();
+        gpu_.strm.wait();
+    }
+
+    memory::dim mb_gpu() const { return gpu_.mb; }
+
+private:
+    static memory::dims src_dims(memory::dim mb) { return {mb, IC, H, W}; }
+    static memory::dims dst_dims(memory::dim mb) { return {mb, OC, H, W}; }
+
+    void init_part(engine_part_t &part, memory::dim mb, memory::dim offset) {
+        part.mb = mb;
+        part.mb_offset = offset;
+        if (mb == 0) return;
+
+        post_ops relu;
+        relu.append_eltwise(1.f, algorithm::eltwise_relu, 0.f, 0.f);
+        primitive_attr attr;
+        attr.set_post_ops(relu);
+
+        const memory::desc src_md(src_dims(mb), dt::f32, tag::nchw);
+        const memory::desc dst_md(dst_dims(mb), dt::f32, tag::nchw);
+        auto conv_pd = convolution_forward::primitive_desc(
+                {prop_kind::forward_inference, algorithm::convolution_direct,
+                        src_md, {{OC, IC, 3, 3}, dt::f32, tag::any},
+                        user_bias_.get_desc(), dst_md, {1, 1}, {1, 1},
+                        {1, 1}},
+                attr, part.eng);
+        part.conv = convolution_forward(conv_pd);
+
+        // The weights are reordered to the engine and its format once.
+        part.weights = memory(conv_pd.weights_desc(), part.eng);
+        part.bias = memory(conv_pd.bias_desc(), part.eng);
+        reorder(user_weights_, part.weights)
+                .execute(part.strm,
+                        {{DNNL_ARG_FROM, user_weights_},
+                                {DNNL_ARG_TO, part.weights}});
+        reorder(user_bias_, part.bias)
+                .execute(part.strm,
+                        {{DNNL_ARG_FROM, user_bias_},
+                                {DNNL_ARG_TO, part.bias}});
+        part.strm.wait();
+
+        if (part.eng.get_kind() == engine::kind::gpu) {
+            part.src = memory(src_md, part.eng);
+            part.dst = memory(dst_md, part.eng);
+            part.to_device = reorder(reorder::primitive_desc(
+                    cpu_.eng, src_md, part.eng, src_md));
+            part.from_device = reorder(reorder::primitive_desc(
+                    part.eng, dst_md, cpu_.eng, dst_md));
+        }
+    }
+
+    /// Memory object for the slice of the host tensor @p full of @p part.
+    memory host_slice(const memory &full, const engine_part_t &part,
+            const memory::dims &dims) {
+        const memory::desc md(dims, dt::f32, tag::nchw);
+        const size_t image_size = md.get_size() / part.mb;
+        char *base = static_cast<char *>(full.get_data_handle());
+        return memory(md, cpu_.eng, base + part.mb_offset * image_size);
+    }
+
+    void submit(engine_part_t &part, const memory &src, const memory &dst) {
+        if (part.mb == 0) return;
+        auto src_slice = host_slice(src, part, src_dims(part.mb));
+        auto dst_slice = host_slice(dst, part, dst_dims(part.mb));
+        const bool on_gpu = part.eng.get_kind() == engine::kind::gpu;
+
+        if (on_gpu)
+            part.to_device.execute(part.strm,
+                    {{DNNL_ARG_FROM, src_slice}, {DNNL_ARG_TO, part.src}});
+        part.conv.execute(part.strm,
+                {{DNNL_ARG_SRC, on_gpu ? part.src : src_slice},
+                        {DNNL_ARG_WEIGHTS, part.weights},
+                        {DNNL_ARG_BIAS, part.bias},
+                        {DNNL_ARG_DST, on_gpu ? part.dst : dst_slice}});
+        if (on_gpu)
+            part.from_device.execute(part.strm,
+                    {{DNNL_ARG_FROM, part.dst}, {DNNL_ARG_TO, dst_slice}});
+    }
+
+    double time_part(
+            engine_part_t &part, const memory &src, const memory &dst) {
+        const auto start = std::chrono::steady_clock::now();
+        submit(part, src, dst);
+        part.strm.wait();
+        const std::chrono::duration<double> time
+                = std::chrono::steady_clock::now() - start;
+        return time.count();
+    }
+
+    memory user_weights_, user_bias_;
+    engine_part_t cpu_, gpu_;
+};
+
+void cross_engine_batch_split() {
+    if (engine::get_count(engine::kind::gpu) == 0)
+        throw example_allows_unimplemented(
+                "No GPU engine found, the example is skipped.");
+
+    engine cpu_eng(engine::kind::cpu, 0);
+    engine gpu_eng(engine::kind::gpu, 0);
+    stream cpu_strm(cpu_eng);
+
+    auto src = memory({{N, IC, H, W}, dt::f32, tag::nchw}, cpu_eng);
+    auto dst = memory({{N, OC, H, W}, dt::f32, tag::nchw}, cpu_eng);
+    auto ref_dst = memory({{N, OC, H, W}, dt::f32, tag::nchw}, cpu_eng);
+    auto weights = memory({{OC, IC, 3, 3}, dt::f32, tag::oihw}, cpu_eng);
+    auto bias = memory({{OC}, dt::f32, tag::x}, cpu_eng);
+
+    auto fill = [](memory m, float freq) {
+        std::vector<float> data(m.get_desc().get_size() / sizeof(float));
+        for (size_t i = 0; i < data.size(); ++i)
+            data[i] = std::sin(i * freq);
+        write_to_dnnl_memory(data.data(), m);
+    };
+    fill(src, 0.1f);
+    fill(weights, 0.7f);
+    fill(bias, 0.5f);
+
+    split_conv_t conv(cpu_eng, gpu_eng, weights, bias);
+    conv.calibrate(src, dst);
+    std::cout << "GPU share of the batch: " << conv.mb_gpu() << "/" << N
+              << std::endl;
+    conv.execute(src, dst);
+
+    // Reference: the whole batch on the CPU engine.
+    conv.set_split(0);
+    conv.execute(src, ref_dst);
+
+    std::vector<float> dst_data(N * OC * H * W), ref_dst_data(N * OC * H * W);
+    read_from_dnnl_memory(dst_data.data(), dst);
+    read_from_dnnl_memory(ref_dst_data.data(), ref_dst);
+    for (size_t i = 0; i < dst_data.size(); ++i) {
+        const float diff = std::fabs(dst_data[i] - ref_dst_data[i]);
+        if (diff > 1e-4f * std::max(1.f, std::fabs(ref_dst_data[i])))
+            throw std::logic_error("Batch split result mismatch.");
+    }
+}
+
+int main(int argc, char **argv) {
+    return handle_example_errors(
+            {engine::kind::cpu, engine::kind::gpu}, cross_engine_batch_split);
+}
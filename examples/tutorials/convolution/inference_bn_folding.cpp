@@ -0,0 +1,208 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/// @example inference_bn_folding.cpp
+/// > Annotated version: @ref inference_bn_folding_cpp
+///
+/// @page inference_bn_folding_cpp_short
+/// C++ API example demonstrating how to fold an inference
+/// [Batch Normalization](@ref dev_guide_batch_normalization) into the weights
+/// and bias of the preceding [Convolution](@ref dev_guide_convolution).
+///
+/// Concepts:
+/// - Weights pre-packing: use #dnnl::memory::format_tag::any
+/// - Folding per-channel scales with a reorder:
+///   dnnl::primitive_attr::set_output_scales()
+/// - Accumulating into the destination of a reorder:
+///   dnnl::post_ops::append_sum()
+///
+/// @page inference_bn_folding_cpp Convolution Tutorial: Batch Normalization
+/// Folding
+/// @copydetails inference_bn_folding_cpp_short
+///
+/// With the statistics known in advance, batch normalization is a
+/// per-channel affine transformation of the convolution output:
+/// \f[
+///     \dst(n, oc, oh, ow) = \alpha(oc) \cdot conv(n, oc, oh, ow)
+///         + \gamma(oc),
+/// \f]
+/// where \f$\alpha(oc) = \frac{scale(oc)}{\sqrt{\sigma^2(oc) + \varepsilon}}\f$
+/// and \f$\gamma(oc) = shift(oc) - \mu(oc) \alpha(oc)\f$. Hence the
+/// convolution with the weights scaled by \f$\alpha\f$ and the bias
+/// \f$\alpha \cdot bias + \gamma\f$ computes the same result in a single
+/// pass.
+///
+/// Both tensors are folded with reorders that are executed once, before the
+/// inference loop. The weights reorder writes directly to the memory format
+/// chosen by the convolution, so the folding does not cost an additional pass
+/// over the weights and the folded weights can be cached as any other
+/// pre-packed weights.
+///
+/// @include inference_bn_folding.cpp
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+#include "example_utils.hpp"
+#include "oneapi/dnnl/dnnl.hpp"
+
+using namespace dnnl;
+
+using tag = memory::format_tag;
+using dt = memory::data_type;
+
+void inference_bn_folding(engine::kind engine_kind) {
+    engine eng(engine_kind, 0);
+    stream s(eng);
+
+    const memory::dim N = 2, IC = 32, OC = 64, IH = 14, IW = 14, KH = 3,
+                      KW = 3, OH = IH, OW = IW;
+    const float eps = 1e-5f;
+
+    memory::dims src_dims = {N, IC, IH, IW};
+    memory::dims weights_dims = {OC, IC, KH, KW};
+    memory::dims bias_dims = {OC};
+    memory::dims dst_dims = {N, OC, OH, OW};
+    memory::dims strides = {1, 1};
+    memory::dims padding = {1, 1};
+
+    // Initialize the user data: convolution src, weights and bias, and the
+    // batch normalization statistics, scale, and shift.
+    std::vector<float> src_data(product(src_dims));
+    std::vector<float> weights_data(product(weights_dims));
+    std::vector<float> bias_data(OC), mean_data(OC), var_data(OC);
+    std::vector<float> scale_shift_data(2 * OC);
+    for (size_t i = 0; i < src_data.size(); ++i)
+        src_data[i] = std::cos(i / 10.f);
+    for (size_t i = 0; i < weights_data.size(); ++i)
+        weights_data[i] = std::sin(i * 2.f) / (IC * KH * KW);
+    for (memory::dim oc = 0; oc < OC; ++oc) {
+        bias_data[oc] = std::tanh((float)oc);
+        mean_data[oc] = 0.1f * std::sin((float)oc);
+        var_data[oc] = 1.f + 0.5f * std::cos((float)oc);
+        scale_shift_data[oc] = 1.f + 0.25f * std::sin(oc * 3.f);
+        scale_shift_data[OC + oc] = 0.1f * std::cos(oc * 5.f);
+    }
+
+    auto user_src_mem = memory({src_dims, dt::f32, tag::nchw}, eng);
+    auto user_weights_mem = memory({weights_dims, dt::f32, tag::oihw}, eng);
+    auto user_bias_mem = memory({bias_dims, dt::f32, tag::x}, eng);
+    write_to_dnnl_memory(src_data.data(), user_src_mem);
+    write_to_dnnl_memory(weights_data.data(), user_weights_mem);
+    write_to_dnnl_memory(bias_data.data(), user_bias_mem);
+
+    auto conv_d = convolution_forward::desc(prop_kind::forward_inference,
+            algorithm::convolution_direct, {src_dims, dt::f32, tag::any},
+            {weights_dims, dt::f32, tag::any}, {bias_dims, dt::f32, tag::x},
+            {dst_dims, dt::f32, tag::nchw}, strides, padding, padding);
+    auto conv_pd = convolution_forward::primitive_desc(conv_d, eng);
+
+    auto conv_src_mem = user_src_mem;
+    if (conv_pd.src_desc() != user_src_mem.get_desc()) {
+        conv_src_mem = memory(conv_pd.src_desc(), eng);
+        reorder(user_src_mem, conv_src_mem)
+                .execute(s, user_src_mem, conv_src_mem);
+    }
+
+    // Reference: convolution followed by a separate batch normalization.
+    auto conv_weights_mem = memory(conv_pd.weights_desc(), eng);
+    reorder(user_weights_mem, conv_weights_mem)
+            .execute(s, user_weights_mem, conv_weights_mem);
+
+    auto conv_dst_mem = memory(conv_pd.dst_desc(), eng);
+    convolution_forward(conv_pd).execute(s,
+            {{DNNL_ARG_SRC, conv_src_mem}, {DNNL_ARG_WEIGHTS, conv_weights_mem},
+                    {DNNL_ARG_BIAS, user_bias_mem},
+                    {DNNL_ARG_DST, conv_dst_mem}});
+
+    auto bnorm_d = batch_normalization_forward::desc(
+            prop_kind::forward_inference, conv_pd.dst_desc(), eps,
+            normalization_flags::use_global_stats
+                    | normalization_flags::use_scale_shift);
+    auto bnorm_pd = batch_normalization_forward::primitive_desc(bnorm_d, eng);
+
+    auto mean_mem = memory(bnorm_pd.mean_desc(), eng);
+    auto var_mem = memory(bnorm_pd.variance_desc(), eng);
+    auto scale_shift_mem = memory(bnorm_pd.weights_desc(), eng);
+    write_to_dnnl_memory(mean_data.data(), mean_mem);
+    write_to_dnnl_memory(var_data.data(), var_mem);
+    write_to_dnnl_memory(scale_shift_data.data(), scale_shift_mem);
+
+    auto ref_dst_mem = memory(bnorm_pd.dst_desc(), eng);
+    batch_normalization_forward(bnorm_pd).execute(s,
+            {{DNNL_ARG_SRC, conv_dst_mem}, {DNNL_ARG_MEAN, mean_mem},
+                    {DNNL_ARG_VARIANCE, var_mem},
+                    {DNNL_ARG_SCALE_SHIFT, scale_shift_mem},
+                    {DNNL_ARG_DST, ref_dst_mem}});
+
+    // Folding. The per-channel factors are computed once on the host.
+    std::vector<float> alpha(OC), gamma(OC);
+    for (memory::dim oc = 0; oc < OC; ++oc) {
+        alpha[oc] = scale_shift_data[oc] / std::sqrt(var_data[oc] + eps);
+        gamma[oc] = scale_shift_data[OC + oc] - mean_data[oc] * alpha[oc];
+    }
+
+    // The weights are scaled along the output channels (dimension 0 of the
+    // oihw weights, hence the mask of 1) while being reordered to the memory
+    // format of the convolution.
+    primitive_attr weights_attr;
+    weights_attr.set_output_scales(1 << 0, alpha);
+    auto folded_weights_mem = memory(conv_pd.weights_desc(), eng);
+    reorder(reorder::primitive_desc(
+                    user_weights_mem, folded_weights_mem, weights_attr))
+            .execute(s, user_weights_mem, folded_weights_mem);
+
+    // The bias is computed as alpha * bias + gamma: the destination of the
+    // reorder is initialized with gamma and the scaled bias is added to it
+    // with the sum post-op.
+    primitive_attr bias_attr;
+    bias_attr.set_output_scales(1 << 0, alpha);
+    post_ops bias_ops;
+    bias_ops.append_sum(1.f);
+    bias_attr.set_post_ops(bias_ops);
+    auto folded_bias_mem = memory(user_bias_mem.get_desc(), eng);
+    write_to_dnnl_memory(gamma.data(), folded_bias_mem);
+    reorder(reorder::primitive_desc(
+                    user_bias_mem, folded_bias_mem, bias_attr))
+            .execute(s, user_bias_mem, folded_bias_mem);
+
+    // Inference: a single convolution with the folded weights and bias.
+    auto dst_mem = memory(conv_pd.dst_desc(), eng);
+    convolution_forward(conv_pd).execute(s,
+            {{DNNL_ARG_SRC, conv_src_mem},
+                    {DNNL_ARG_WEIGHTS, folded_weights_mem},
+                    {DNNL_ARG_BIAS, folded_bias_mem},
+                    {DNNL_ARG_DST, dst_mem}});
+    s.wait();
+
+    std::vector<float> dst_data(product(dst_dims));
+    std::vector<float> ref_dst_data(product(dst_dims));
+    read_from_dnnl_memory(dst_data.data(), dst_mem);
+    read_from_dnnl_memory(ref_dst_data.data(), ref_dst_mem);
+    for (size_t i = 0; i < dst_data.size(); ++i) {
+        const float diff = std::fabs(dst_data[i] - ref_dst_data[i]);
+        if (diff > 1e-4f * std::max(1.f, std::fabs(ref_dst_data[i])))
+            throw std::logic_error("Folded result mismatch.");
+    }
+}
+
+int main(int argc, char **argv) {
+    engine::kind engine_kind = parse_engine_kind(argc, argv);
+    return handle_example_errors(inference_bn_folding, engine_kind);
+}
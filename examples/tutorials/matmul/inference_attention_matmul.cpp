@@ -0,0 +1,221 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/// @example inference_attention_matmul.cpp
+/// > Annotated version: @ref inference_attention_matmul_cpp
+///
+/// @page inference_attention_matmul_cpp_short
+/// C++ API example demonstrating how one can build the scaled dot-product
+/// attention block of a transformer out of [MatMul](@ref dev_guide_matmul),
+/// [Binary](@ref dev_guide_binary) and [Softmax](@ref dev_guide_softmax)
+/// primitives with a minimal number of passes over the scores tensor.
+///
+/// Concepts:
+/// - Batched MatMul with 4D tensors
+/// - Transposition via strides: no explicit transpose of the keys
+/// - Scaling folded into MatMul: dnnl::primitive_attr::set_output_scales()
+/// - In-place Binary with broadcast and in-place Softmax
+///
+/// @page inference_attention_matmul_cpp MatMul Tutorial: Attention Inference
+/// @copydetails inference_attention_matmul_cpp_short
+///
+/// The attention block computes
+/// \f[
+///     O = \operatorname{softmax}\left(\frac{Q K^T}{\sqrt{d}} + M\right) V,
+/// \f]
+/// where \f$Q\f$, \f$K\f$ and \f$V\f$ are \f$[batch, heads, seq, d]\f$ tensors
+/// and \f$M\f$ is an additive \f$[batch, 1, 1, seq]\f$ mask, which is zero for
+/// valid tokens and a large negative number for the padding ones.
+///
+/// Done naively, this takes five primitives (matmul, scale, mask, softmax,
+/// matmul) each reading and writing the \f$[batch, heads, seq, seq]\f$ scores
+/// tensor. Here the keys are passed to the first MatMul with transposed
+/// strides, the scale is applied by the MatMul itself via output scales, and
+/// both the Binary and the Softmax primitives work in place:
+/// 1. Scores = MatMul(Q, K^T) with output scale \f$1 / \sqrt{d}\f$.
+/// 2. Scores += M (Binary add, in place, mask broadcast over heads and rows).
+/// 3. Scores = softmax(Scores) along the last axis (in place).
+/// 4. O = MatMul(Scores, V).
+///
+/// @include inference_attention_matmul.cpp
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+#include "example_utils.hpp"
+
+using namespace dnnl;
+
+namespace {
+
+void init_vector(std::vector<float> &v) {
+    std::mt19937 gen;
+    std::uniform_real_distribution<float> u(-1, 1);
+
+    for (auto &e : v)
+        e = u(gen);
+}
+
+} // namespace
+
+int number_of_runs = 1;
+
+const memory::dim batch = 2, heads = 4, seq = 32, head_size = 16;
+const memory::dim valid_tokens[batch] = {seq, seq / 2 + 3};
+const float mask_value = -10000.f;
+
+// Straightforward implementation used to check the result
+void ref_attention(const std::vector<float> &Q, const std::vector<float> &K,
+        const std::vector<float> &V, const std::vector<float> &mask,
+        std::vector<float> &O) {
+    const float scale = 1.f / std::sqrt((float)head_size);
+    std::vector<float> s(seq);
+
+    for (memory::dim b = 0; b < batch; ++b)
+        for (memory::dim h = 0; h < heads; ++h) {
+            const memory::dim bh_off = (b * heads + h) * seq * head_size;
+            for (memory::dim i = 0; i < seq; ++i) {
+                float max_s = -INFINITY;
+                for (memory::dim j = 0; j < seq; ++j) {
+                    float acc = 0.f;
+                    for (memory::dim k = 0; k < head_size; ++k)
+                        acc += Q[bh_off + i * head_size + k]
+                                * K[bh_off + j * head_size + k];
+                    s[j] = acc * scale + mask[b * seq + j];
+                    max_s = std::max(max_s, s[j]);
+                }
+
+                float sum = 0.f;
+                for (memory::dim j = 0; j < seq; ++j) {
+                    s[j] = std::exp(s[j] - max_s);
+                    sum += s[j];
+                }
+
+                for (memory::dim k = 0; k < head_size; ++k) {
+                    float acc = 0.f;
+                    for (memory::dim j = 0; j < seq; ++j)
+                        acc += s[j] / sum * V[bh_off + j * head_size + k];
+                    O[bh_off + i * head_size + k] = acc;
+                }
+            }
+        }
+}
+
+void inference_attention_matmul(engine::kind engine_kind) {
+    engine eng(engine_kind, 0);
+    stream s(eng);
+
+    using dt = memory::data_type;
+    using tag = memory::format_tag;
+
+    const memory::dims qkv_dims = {batch, heads, seq, head_size};
+    const memory::dims scores_dims = {batch, heads, seq, seq};
+    const memory::dims mask_dims = {batch, 1, 1, seq};
+
+    // Keys are stored as [batch, heads, seq, head_size] and are viewed as
+    // [batch, heads, head_size, seq] by swapping the two innermost strides.
+    const memory::dims kt_dims = {batch, heads, head_size, seq};
+    const memory::dims kt_strides
+            = {heads * seq * head_size, seq * head_size, 1, head_size};
+
+    memory::desc qkv_md(qkv_dims, dt::f32, tag::abcd);
+    memory::desc kt_md(kt_dims, dt::f32, kt_strides);
+    memory::desc scores_md(scores_dims, dt::f32, tag::abcd);
+    memory::desc mask_md(mask_dims, dt::f32, tag::abcd);
+
+    // 1. Scores = Q * K^T / sqrt(head_size)
+    primitive_attr qk_attr;
+    qk_attr.set_output_scales(0, {1.f / std::sqrt((float)head_size)});
+    matmul::primitive_desc qk_pd(
+            matmul::desc(qkv_md, kt_md, scores_md), qk_attr, eng);
+
+    // 2. Scores += mask, in place
+    binary::primitive_desc mask_pd(
+            binary::desc(algorithm::binary_add, scores_md, mask_md, scores_md),
+            eng);
+
+    // 3. Scores = softmax(Scores), in place
+    softmax_forward::primitive_desc softmax_pd(
+            softmax_forward::desc(prop_kind::forward_inference, scores_md, 3),
+            eng);
+
+    // 4. O = Scores * V
+    matmul::primitive_desc sv_pd(matmul::desc(scores_md, qkv_md, qkv_md), eng);
+
+    matmul qk_p(qk_pd), sv_p(sv_pd);
+    binary mask_p(mask_pd);
+    softmax_forward softmax_p(softmax_pd);
+
+    // Prepare the inputs
+    std::vector<float> Q(batch * heads * seq * head_size);
+    std::vector<float> K(Q.size()), V(Q.size()), O(Q.size());
+    init_vector(Q);
+    init_vector(K);
+    init_vector(V);
+
+    std::vector<float> mask(batch * seq);
+    for (memory::dim b = 0; b < batch; ++b)
+        for (memory::dim j = 0; j < seq; ++j)
+            mask[b * seq + j] = j < valid_tokens[b] ? 0.f : mask_value;
+
+    memory Q_mem(qkv_md, eng), K_mem(kt_md, eng), V_mem(qkv_md, eng);
+    memory mask_mem(mask_md, eng), O_mem(qkv_md, eng);
+    write_to_dnnl_memory(Q.data(), Q_mem);
+    write_to_dnnl_memory(K.data(), K_mem);
+    write_to_dnnl_memory(V.data(), V_mem);
+    write_to_dnnl_memory(mask.data(), mask_mem);
+
+    // The only intermediate tensor
+    memory scores_mem(scores_md, eng);
+
+    for (int run = 0; run < number_of_runs; ++run) {
+        qk_p.execute(s,
+                {{DNNL_ARG_SRC, Q_mem}, {DNNL_ARG_WEIGHTS, K_mem},
+                        {DNNL_ARG_DST, scores_mem}});
+        mask_p.execute(s,
+                {{DNNL_ARG_SRC_0, scores_mem}, {DNNL_ARG_SRC_1, mask_mem},
+                        {DNNL_ARG_DST, scores_mem}});
+        softmax_p.execute(
+                s, {{DNNL_ARG_SRC, scores_mem}, {DNNL_ARG_DST, scores_mem}});
+        sv_p.execute(s,
+                {{DNNL_ARG_SRC, scores_mem}, {DNNL_ARG_WEIGHTS, V_mem},
+                        {DNNL_ARG_DST, O_mem}});
+    }
+    s.wait();
+
+    read_from_dnnl_memory(O.data(), O_mem);
+
+    std::vector<float> O_ref(O.size());
+    ref_attention(Q, K, V, mask, O_ref);
+
+    for (size_t i = 0; i < O.size(); ++i) {
+        const float diff = std::fabs(O[i] - O_ref[i]);
+        if (diff > 1e-4f * std::max(1.f, std::fabs(O_ref[i])))
+            throw std::logic_error("Accuracy check failed.");
+    }
+}
+
+int main(int argc, char **argv) {
+    engine::kind engine_kind = parse_engine_kind(argc, argv);
+    return handle_example_errors(inference_attention_matmul, engine_kind);
+}
@@ -226,6 +226,48 @@ int DNNL_API dnnl_primitive_desc_query_s32(
 dnnl_status_t DNNL_API dnnl_primitive_create(dnnl_primitive_t *primitive,
         const_dnnl_primitive_desc_t primitive_desc);
 
+/// Creates a primitive from a cache blob.
+///
+/// The program binaries of the primitive are taken from @p cache_blob
+/// instead of being compiled, which makes the creation much faster. The
+/// binaries that are missing from @p cache_blob, for example because it was
+/// obtained on another device or with another driver, are compiled as
+/// usual, so the result is always the same as that of
+/// dnnl_primitive_create(). Only GPU engines are supported.
+///
+/// @param primitive Output primitive.
+/// @param primitive_desc Primitive descriptor used to create the primitive.
+///     It should be the same as the one of the primitive @p cache_blob was
+///     obtained from.
+/// @param size Size of the cache blob in bytes.
+/// @param cache_blob Cache blob obtained with dnnl_primitive_get_cache_blob()
+///     from a primitive created by the same version of the library.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+/// @returns #dnnl_unimplemented if the engine is not a GPU engine.
+dnnl_status_t DNNL_API dnnl_primitive_create_from_cache_blob(
+        dnnl_primitive_t *primitive, const_dnnl_primitive_desc_t primitive_desc,
+        size_t size, const uint8_t *cache_blob);
+
+/// Creates a batch of primitives.
+///
+/// The primitives are created concurrently on up to as many host threads as
+/// there are cores, so that the expensive parts of the creation, such as
+/// OpenCL program builds or JIT code generation, of independent primitives
+/// overlap. The result is the same as that of calling
+/// dnnl_primitive_create() for every primitive descriptor in order.
+///
+/// @param primitives Output array of @p count primitives.
+/// @param count Number of primitives to create.
+/// @param primitive_descs Array of @p count primitive descriptors used
+///     to create the primitives.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise. On failure no primitive is created and all the
+///     @p primitives are set to NULL.
+dnnl_status_t DNNL_API dnnl_primitive_create_batch(
+        dnnl_primitive_t *primitives, int count,
+        const const_dnnl_primitive_desc_t *primitive_descs);
+
 /// Executes a primitive.
 ///
 /// @param primitive Primitive to execute.
@@ -242,6 +284,67 @@ dnnl_status_t DNNL_API dnnl_primitive_create(dnnl_primitive_t *primitive,
 dnnl_status_t DNNL_API dnnl_primitive_execute(const_dnnl_primitive_t primitive,
         dnnl_stream_t stream, int nargs, const dnnl_exec_arg_t *args);
 
+/// Executes a primitive over a batch of independent argument sets.
+///
+/// On a CPU engine with a native runtime the items are distributed across
+/// the threads, and each item is computed by a single thread with a private
+/// slice of a scratchpad allocated once for the whole batch. This scales the
+/// throughput of many small requests of the same shape without gathering
+/// them into a single tensor with a bigger minibatch. On other engines the
+/// items are executed one after another.
+///
+/// If the primitive was created with the user scratchpad mode, every item
+/// has to provide its own #DNNL_ARG_SCRATCHPAD argument.
+///
+/// @param primitive Primitive to execute.
+/// @param stream Stream to use.
+/// @param batch Number of argument sets.
+/// @param nargs Array of @p batch numbers of arguments.
+/// @param args Array of @p batch arrays of arguments, each of them the same
+///     as for dnnl_primitive_execute().
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_execute_batch(
+        const_dnnl_primitive_t primitive, dnnl_stream_t stream, int batch,
+        const int *nargs, const dnnl_exec_arg_t *const *args);
+
+/// Binds execution arguments to a primitive.
+///
+/// The arguments are validated and converted once, so that executing the
+/// primitive with dnnl_primitive_execute_bound() skips this work on every
+/// call. The memory objects are bound by reference: their data handles may
+/// be changed with dnnl_memory_set_data_handle() between executions, and
+/// they must not be destroyed before @p bound_args.
+///
+/// @param bound_args Output bound execution arguments.
+/// @param primitive Primitive to bind the arguments to.
+/// @param nargs Number of arguments.
+/// @param args Array of arguments, the same as for dnnl_primitive_execute().
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_bound_args_create(dnnl_bound_args_t *bound_args,
+        const_dnnl_primitive_t primitive, int nargs,
+        const dnnl_exec_arg_t *args);
+
+/// Executes a primitive with execution arguments bound to it in advance.
+///
+/// @param primitive Primitive to execute.
+/// @param stream Stream to use.
+/// @param bound_args Execution arguments created for @p primitive with
+///     dnnl_bound_args_create().
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_execute_bound(
+        const_dnnl_primitive_t primitive, dnnl_stream_t stream,
+        const_dnnl_bound_args_t bound_args);
+
+/// Destroys bound execution arguments.
+///
+/// @param bound_args Bound execution arguments to destroy.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_bound_args_destroy(dnnl_bound_args_t bound_args);
+
 /// Retrieves a constant reference to the primitive descriptor of a given
 /// primitive.
 ///
@@ -258,6 +361,38 @@ dnnl_status_t DNNL_API dnnl_primitive_get_primitive_desc(
         const_dnnl_primitive_t primitive,
         const_dnnl_primitive_desc_t *primitive_desc);
 
+/// Retrieves a cache blob of a primitive.
+///
+/// The cache blob holds the program binaries of the primitive and can be
+/// stored together with a model, so that a primitive created from it with
+/// dnnl_primitive_create_from_cache_blob() in another process skips the
+/// compilation. The code generated for CPU primitives embeds addresses of
+/// data owned by the primitive and cannot be serialized.
+///
+/// @param primitive Primitive to query for the cache blob.
+/// @param size Size of the cache blob in bytes. If @p cache_blob is NULL,
+///     the size of the cache blob is returned, otherwise it should be equal
+///     to that size.
+/// @param cache_blob Output cache blob, or NULL to query the size.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+/// @returns #dnnl_unimplemented if the primitive was not created on a GPU
+///     engine.
+dnnl_status_t DNNL_API dnnl_primitive_get_cache_blob(
+        const_dnnl_primitive_t primitive, size_t *size, uint8_t *cache_blob);
+
+/// Returns the memory held by a primitive.
+///
+/// The memory passed to the primitive execution (including a user-provided
+/// scratchpad) is not included.
+///
+/// @param primitive Primitive to query.
+/// @param footprint Output memory footprint.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_get_memory_footprint(
+        const_dnnl_primitive_t primitive, dnnl_memory_footprint_t *footprint);
+
 /// Destroys a primitive.
 ///
 /// @param primitive The primitive to destroy.
@@ -316,6 +451,30 @@ dnnl_status_t DNNL_API dnnl_primitive_attr_get_scratchpad_mode(
 dnnl_status_t DNNL_API dnnl_primitive_attr_set_scratchpad_mode(
         dnnl_primitive_attr_t attr, dnnl_scratchpad_mode_t mode);
 
+/// Returns the floating-point math mode primitive attribute.
+///
+/// @param attr Primitive attributes.
+/// @param mode Output floating-point math mode.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_get_fpmath_mode(
+        const_dnnl_primitive_attr_t attr, dnnl_fpmath_mode_t *mode);
+
+/// Sets the floating-point math mode primitive attributes.
+///
+/// A mode other than #dnnl_fpmath_mode_strict allows an implementation to
+/// compute with the accuracy of the corresponding lower precision data type,
+/// for example to use faster approximations of the eltwise functions.
+///
+/// @param attr Primitive attributes.
+/// @param mode Floating-point math mode. The possible values are:
+///     #dnnl_fpmath_mode_strict (default), #dnnl_fpmath_mode_bf16,
+///     #dnnl_fpmath_mode_f16 and #dnnl_fpmath_mode_any.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_set_fpmath_mode(
+        dnnl_primitive_attr_t attr, dnnl_fpmath_mode_t mode);
+
 /// Returns primitive attributes output scaling factors correspondence mask
 /// and values.
 ///
@@ -535,6 +694,77 @@ dnnl_status_t DNNL_API dnnl_primitive_attr_get_post_ops(
 dnnl_status_t DNNL_API dnnl_primitive_attr_set_post_ops(
         dnnl_primitive_attr_t attr, const_dnnl_post_ops_t post_ops);
 
+/// Returns the channels of the sources that are read as a single source
+/// concatenated along the channels dimension.
+///
+/// @warning
+///     The output @p channels points to the internal @p attr field, so it is
+///     an error to modify or destroy it. The lifetime of @p channels is the
+///     same as that of the @p attr it belongs to.
+///
+/// @param attr Primitive attributes.
+/// @param nsrcs Output number of sources, 0 if the source is not split.
+/// @param channels Output pointer to the array of the channels of the
+///     sources.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_get_src_concat(
+        const_dnnl_primitive_attr_t attr, int *nsrcs,
+        const dnnl_dim_t **channels);
+
+/// Sets the source of a primitive to be read from several memory objects
+/// that are logically concatenated along the channels dimension, so that
+/// the concatenation is never materialized.
+///
+/// The source memory descriptor of the primitive describes the concatenated
+/// tensor. Source @p i has the same format with @p channels[i] channels and
+/// is passed at execution time as an argument with index
+/// (#DNNL_ARG_MULTIPLE_SRC + @p i) instead of #DNNL_ARG_SRC. The channels
+/// must add up to the channels of the source.
+///
+/// @note
+///     Only the forward convolution supports this attribute.
+///
+/// @param attr Primitive attributes.
+/// @param nsrcs Number of sources. 0 resets the attribute.
+/// @param channels Array of @p nsrcs channel counts.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_set_src_concat(
+        dnnl_primitive_attr_t attr, int nsrcs, const dnnl_dim_t *channels);
+
+/// Returns the dropout primitive attribute.
+///
+/// @param attr Primitive attributes.
+/// @param enabled Output flag, non-zero if the dropout is applied.
+/// @param with_mask Output flag, non-zero if the mask of the kept elements
+///     is stored.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_get_dropout(
+        const_dnnl_primitive_attr_t attr, int *enabled, int *with_mask);
+
+/// Sets the dropout primitive attribute.
+///
+/// Each element of the destination is zeroed with the probability passed as
+/// #DNNL_ARG_ATTR_DROPOUT_PROBABILITY at execution time, and the kept
+/// elements are scaled by 1 / (1 - probability). The elements to drop are
+/// chosen by a hash of their offset and of the seed passed as
+/// #DNNL_ARG_ATTR_DROPOUT_SEED, so the same seed drops the same elements.
+///
+/// @note
+///     Only the eltwise and the binary primitives support this attribute.
+///
+/// @param attr Primitive attributes.
+/// @param enabled Non-zero to apply the dropout, zero to reset the
+///     attribute.
+/// @param with_mask Non-zero to store a bitmask of the kept elements to the
+///     #DNNL_ARG_ATTR_DROPOUT_MASK argument. Forward propagation only.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_set_dropout(
+        dnnl_primitive_attr_t attr, int enabled, int with_mask);
+
 /// Creates empty post-ops sequence.
 ///
 /// @param post_ops Output post-ops.
@@ -840,6 +1070,42 @@ dnnl_status_t DNNL_API dnnl_post_ops_get_params_binary(
         const_dnnl_post_ops_t post_ops, int index, dnnl_alg_kind_t *alg_kind,
         const dnnl_memory_desc_t **src1_desc);
 
+/// Appends a pooling post-op with a 2x2 window, stride 2 and no padding.
+///
+/// The kind of this post operation is #dnnl_pooling.
+///
+/// The post-op reduces the spatial dimensions of the destination of the
+/// preceding computations:
+///
+///     dst[n, c, oh, ow] <- pool_op (dst[n, c, 2*oh:2*oh+2, 2*ow:2*ow+2])
+///
+/// The post-op is supported by convolution only and must be the last one in
+/// the chain. The destination of the primitive has the spatial dimensions
+/// of the convolution destination divided by 2 and rounded down, and it can
+/// be queried from the primitive descriptor.
+///
+/// @param post_ops Post-ops.
+/// @param alg_kind Pooling algorithm kind: #dnnl_pooling_max,
+///     #dnnl_pooling_avg_include_padding, or
+///     #dnnl_pooling_avg_exclude_padding (the averaging algorithms are
+///     equivalent as the window never overlaps padding).
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_post_ops_append_pooling_k2s2(
+        dnnl_post_ops_t post_ops, dnnl_alg_kind_t alg_kind);
+
+/// Returns the parameters of a pooling post-op.
+///
+/// @param post_ops Post-ops.
+/// @param index Index of the pooling post-op.
+/// @param alg_kind Output pooling algorithm kind.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+/// @returns #dnnl_invalid_arguments if @p index does not refer to a pooling
+///     post-op.
+dnnl_status_t DNNL_API dnnl_post_ops_get_params_pooling_k2s2(
+        const_dnnl_post_ops_t post_ops, int index, dnnl_alg_kind_t *alg_kind);
+
 /// @} dnnl_api_attributes
 
 /// @} dnnl_api_primitives
@@ -888,6 +1154,26 @@ dnnl_status_t DNNL_API dnnl_memory_desc_init_by_tag(
         dnnl_memory_desc_t *memory_desc, int ndims, const dnnl_dims_t dims,
         dnnl_data_type_t data_type, dnnl_format_tag_t tag);
 
+/// Initializes a memory descriptor of a two-dimensional tensor in the block
+/// compressed sparse row format (see #dnnl_format_kind_sparse).
+///
+/// The dimensions are padded to multiples of the block dimensions. The
+/// memory is sized to hold @p nnz_blocks blocks, which is the maximum number
+/// of non-zero blocks a reorder to this memory descriptor can store.
+///
+/// @param memory_desc Output memory descriptor.
+/// @param ndims Number of dimensions. Must be 2.
+/// @param dims Array of dimensions.
+/// @param data_type Elements data type.
+/// @param block_dims Array of block dimensions.
+/// @param nnz_blocks Number of blocks the memory can hold.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_memory_desc_init_by_sparse_blocks(
+        dnnl_memory_desc_t *memory_desc, int ndims, const dnnl_dims_t dims,
+        dnnl_data_type_t data_type, const dnnl_dims_t block_dims,
+        dnnl_dim_t nnz_blocks);
+
 /// Initializes a memory descriptor for a region inside an area
 /// described by an existing memory descriptor.
 ///
@@ -3092,6 +3378,50 @@ dnnl_status_t DNNL_API dnnl_gru_backward_desc_init(dnnl_rnn_desc_t *rnn_desc,
         const dnnl_memory_desc_t *diff_dst_layer_desc,
         const dnnl_memory_desc_t *diff_dst_iter_desc, unsigned flags);
 
+/// Initializes a descriptor for AUGRU forward propagation primitive.
+///
+/// The following arguments may either be @c NULL or point to a zero memory
+/// descriptor:
+/// - @p src_iter_desc,
+/// - @p bias_desc,
+/// - @p dst_iter_desc.
+///
+/// This would then indicate that the AUGRU forward propagation primitive
+/// should not use them and should default to zero values instead.
+///
+/// The attention vector is passed at execution time as
+/// #DNNL_ARG_AUGRU_ATTENTION. It is an f32 tensor of dimensions
+/// (time, batch, 1) in the #dnnl_tnc format.
+///
+/// @param rnn_desc Output descriptor for AUGRU primitive.
+/// @param prop_kind Propagation kind. Possible values are
+///     #dnnl_forward_training and #dnnl_forward_inference.
+/// @param direction RNN direction. See @ref dnnl_rnn_direction_t for more
+///     info.
+/// @param src_layer_desc Memory descriptor for the input vector.
+/// @param src_iter_desc Memory descriptor for the input recurrent hidden
+///     state vector.
+/// @param weights_layer_desc Memory descriptor for the weights applied to the
+///     layer input.
+/// @param weights_iter_desc Memory descriptor for the weights applied to the
+///     recurrent input.
+/// @param bias_desc Bias memory descriptor.
+/// @param dst_layer_desc Memory descriptor for the output vector.
+/// @param dst_iter_desc Memory descriptor for the output recurrent hidden
+///     state vector.
+/// @param flags Unused.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_augru_forward_desc_init(dnnl_rnn_desc_t *rnn_desc,
+        dnnl_prop_kind_t prop_kind, dnnl_rnn_direction_t direction,
+        const dnnl_memory_desc_t *src_layer_desc,
+        const dnnl_memory_desc_t *src_iter_desc,
+        const dnnl_memory_desc_t *weights_layer_desc,
+        const dnnl_memory_desc_t *weights_iter_desc,
+        const dnnl_memory_desc_t *bias_desc,
+        const dnnl_memory_desc_t *dst_layer_desc,
+        const dnnl_memory_desc_t *dst_iter_desc, unsigned flags);
+
 /// Initializes a descriptor for LBR GRU forward propagation primitive.
 ///
 /// The following arguments may either be @c NULL or point to a zero memory
@@ -3291,6 +3621,122 @@ dnnl_status_t DNNL_API dnnl_reduction_desc_init(dnnl_reduction_desc_t *desc,
 
 /// @} dnnl_api_reduction
 
+/// @addtogroup dnnl_api_embedding_bag Embedding bag
+/// @{
+
+/// Initializes a descriptor for an embedding bag forward propagation
+/// primitive.
+///
+/// Bag @c b pools the rows of the table selected by the indices from
+/// @c offsets[b] up to @c offsets[b + 1] (or up to the number of indices for
+/// the last bag). Empty bags produce zeros.
+///
+/// @note
+///     Destination memory descriptor is allowed to be initialized with
+///     #dnnl_format_tag_any or with format_kind set to #dnnl_format_kind_any.
+///
+/// @param desc Output descriptor for an embedding bag primitive.
+/// @param prop_kind Propagation kind. Possible values:
+///     #dnnl_forward_training and #dnnl_forward_inference.
+/// @param alg_kind Bag pooling algorithm kind. Possible values:
+///     #dnnl_reduction_sum and #dnnl_reduction_mean.
+/// @param indices_desc Indices memory descriptor: a 1D #dnnl_s32 tensor.
+/// @param offsets_desc Offsets memory descriptor: a 1D #dnnl_s32 tensor
+///     with one element per bag.
+/// @param table_desc Table memory descriptor: a 2D tensor of rows.
+/// @param scale_shift_desc Per-row scale and shift memory descriptor: a
+///     2D #dnnl_f32 tensor with dimensions {rows, 2}. Required for #dnnl_s8
+///     and #dnnl_u8 tables, where a row element is dequantized as
+///     @c scale * @c value + @c shift, and must be NULL or zero memory
+///     descriptor otherwise.
+/// @param dst_desc Destination memory descriptor: a 2D tensor with one row
+///     per bag.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_embedding_bag_forward_desc_init(
+        dnnl_embedding_bag_desc_t *desc, dnnl_prop_kind_t prop_kind,
+        dnnl_alg_kind_t alg_kind, const dnnl_memory_desc_t *indices_desc,
+        const dnnl_memory_desc_t *offsets_desc,
+        const dnnl_memory_desc_t *table_desc,
+        const dnnl_memory_desc_t *scale_shift_desc,
+        const dnnl_memory_desc_t *dst_desc);
+
+/// @} dnnl_api_embedding_bag
+
+/// @addtogroup dnnl_api_group_normalization Group Normalization
+/// @{
+
+/// Initializes a descriptor for group normalization forward propagation
+/// primitive.
+///
+/// The channels (the second logical dimension of the data) are split into
+/// @p groups groups of consecutive channels, and every group of every
+/// image is normalized with its own mean and variance.
+///
+/// @note
+///     In-place operation is supported: the dst can refer to the same memory
+///     as the src.
+///
+/// @param gnorm_desc Output descriptor for group normalization primitive.
+/// @param prop_kind Propagation kind. Possible values are
+///     #dnnl_forward_training and #dnnl_forward_inference.
+/// @param data_desc Source and destination memory descriptor.
+/// @param groups Number of groups. Must divide the number of channels.
+/// @param epsilon Group normalization epsilon parameter.
+/// @param flags Group normalization flags (@ref dnnl_normalization_flags_t).
+///     Possible values are #dnnl_use_global_stats and #dnnl_use_scaleshift.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_group_normalization_forward_desc_init(
+        dnnl_group_normalization_desc_t *gnorm_desc,
+        dnnl_prop_kind_t prop_kind, const dnnl_memory_desc_t *data_desc,
+        dnnl_dim_t groups, float epsilon, unsigned flags);
+
+/// @} dnnl_api_group_normalization
+
+/// @addtogroup dnnl_api_optimizer Optimizer
+/// @{
+
+/// Initializes a descriptor for an optimizer step primitive.
+///
+/// The primitive updates the master weights and the optimizer states in
+/// place using the gradients, and optionally writes a copy of the updated
+/// weights in another data type in the same pass over memory.
+///
+/// The learning rate, the step number, and the gradients scale are passed at
+/// execution time as a #dnnl_f32 tensor of 3 elements
+/// (#DNNL_ARG_HYPERPARAMETERS), so that the same primitive serves every
+/// step of a training run.
+///
+/// @param desc Output descriptor for an optimizer primitive.
+/// @param alg_kind Optimizer algorithm kind. Possible values are
+///     #dnnl_optimizer_sgd and #dnnl_optimizer_adam.
+/// @param weights_desc Master weights memory descriptor. Must be #dnnl_f32.
+///     The optimizer states share this memory descriptor.
+/// @param diff_weights_desc Gradients memory descriptor: #dnnl_f32 or
+///     #dnnl_bf16 with the dimensions of the weights.
+/// @param dst_desc Memory descriptor of the copy of the updated weights:
+///     #dnnl_f32 or #dnnl_bf16 with the dimensions of the weights. May be
+///     NULL or zero memory descriptor if the copy is not needed.
+/// @param momentum Momentum for #dnnl_optimizer_sgd (0 disables it), or the
+///     decay rate of the first moment for #dnnl_optimizer_adam.
+/// @param beta2 Decay rate of the second moment for #dnnl_optimizer_adam.
+///     Ignored for #dnnl_optimizer_sgd.
+/// @param epsilon Epsilon for #dnnl_optimizer_adam. Ignored for
+///     #dnnl_optimizer_sgd.
+/// @param weight_decay Weight decay.
+/// @param max_grad_norm Maximal L2 norm of the gradients of the tensor.
+///     Non-positive values disable the clipping.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_optimizer_desc_init(dnnl_optimizer_desc_t *desc,
+        dnnl_alg_kind_t alg_kind, const dnnl_memory_desc_t *weights_desc,
+        const dnnl_memory_desc_t *diff_weights_desc,
+        const dnnl_memory_desc_t *dst_desc, float momentum, float beta2,
+        float epsilon, float weight_decay, float max_grad_norm);
+
+/// @} dnnl_api_optimizer
+
 /// @} dnnl_api_primitives
 
 /// @addtogroup dnnl_api_engine
@@ -3360,6 +3806,129 @@ dnnl_status_t DNNL_API dnnl_stream_get_engine(
 ///     otherwise.
 dnnl_status_t DNNL_API dnnl_stream_wait(dnnl_stream_t stream);
 
+/// Attaches a scratchpad memory to an execution stream. The memory is used as
+/// a scratchpad by all primitives created with #dnnl_scratchpad_mode_user
+/// and executed on the stream without an explicit #DNNL_ARG_SCRATCHPAD
+/// argument. The memory must be at least as big as the largest scratchpad
+/// required by these primitives.
+///
+/// @note
+///     Primitives executed on the stream share the scratchpad memory, hence
+///     they must not run concurrently: use an in-order stream and do not
+///     execute primitives on the stream from several threads at a time.
+///
+/// @param stream Execution stream.
+/// @param memory Scratchpad memory to attach, or NULL to detach a
+///     previously attached one. The memory must be created on the same
+///     engine as the stream and must outlive its usage by the stream.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_stream_set_scratchpad(
+        dnnl_stream_t stream, dnnl_memory_t memory);
+
+/// Resets the profiling data collected by an execution stream created with
+/// the #dnnl_stream_profiling flag.
+///
+/// @param stream Execution stream.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_stream_reset_profiling(dnnl_stream_t stream);
+
+/// Queries the profiling data collected by an execution stream created with
+/// the #dnnl_stream_profiling flag since its creation or the last
+/// dnnl_stream_reset_profiling() call. Every entry corresponds to one
+/// primitive execution, in the order of the executions. The function waits
+/// for the completion of the executed primitives.
+///
+/// @param stream Execution stream.
+/// @param data_kind Profiling data kind to query.
+/// @param num_entries Number of entries. On input, the capacity of @p data
+///     unless @p data is NULL. On output, the number of entries available.
+/// @param data Output array of profiling data, or NULL to query the number
+///     of entries only.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_stream_get_profiling_data(dnnl_stream_t stream,
+        dnnl_profiling_data_kind_t data_kind, int *num_entries,
+        uint64_t *data);
+
+/// Restricts the threads executing the primitives on a CPU execution stream
+/// to the given logical CPUs. The stream uses one thread per CPU: thread i
+/// of a parallel region is pinned to @p cpus[i], so that several streams of
+/// a process can work on disjoint sets of cores without oversubscription.
+/// The affinity of the submitting thread is restored after every execution.
+///
+/// Supported with the OpenMP, TBB, and sequential CPU runtimes on Linux.
+/// With the threadpool runtime the threads are owned by the user and the
+/// call returns #dnnl_unimplemented.
+///
+/// @param stream Execution stream.
+/// @param ncpus Number of CPUs, 0 to remove the restriction.
+/// @param cpus Array of @p ncpus logical CPU indices.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_stream_set_cpu_affinity(
+        dnnl_stream_t stream, int ncpus, const int *cpus);
+
+/// Starts recording the device commands of the primitives executed on an
+/// execution stream. The primitives are still executed as usual. A
+/// previous recording of the stream is discarded.
+///
+/// Supported only by the OpenCL GPU runtime.
+///
+/// @param stream Execution stream.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_stream_begin_capture(dnnl_stream_t stream);
+
+/// Stops recording the device commands of an execution stream.
+///
+/// @param stream Execution stream.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise, e.g. #dnnl_unimplemented if a recorded primitive
+///     executed a command that cannot be replayed, such as a copy from or
+///     to the host memory. The recording is discarded on failure.
+dnnl_status_t DNNL_API dnnl_stream_end_capture(dnnl_stream_t stream);
+
+/// Enqueues the device commands recorded between the
+/// dnnl_stream_begin_capture() and dnnl_stream_end_capture() calls again,
+/// with the same kernel arguments. This skips the host part of the
+/// primitive executions, such as the arguments validation and binding.
+///
+/// The primitives and the memory objects used during the capture must
+/// remain alive. The contents of the memory objects may be changed between
+/// the replays.
+///
+/// @param stream Execution stream.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_stream_replay(dnnl_stream_t stream);
+
+/// Starts a group of independent primitive executions on an execution
+/// stream, such as the branches of an inception block. The primitives
+/// executed on the stream until the dnnl_stream_join() call must not depend
+/// on each other; they may depend on the primitives executed before the
+/// call. Their executions are deferred, so the memory objects passed to them
+/// must stay alive until the join.
+///
+/// Supported only by CPU streams. With the OpenMP and TBB runtimes the
+/// branches are executed concurrently on disjoint teams of threads, with
+/// the other runtimes they are executed one after another.
+///
+/// @param stream Execution stream.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise, e.g. #dnnl_invalid_arguments if the stream has already
+///     been forked.
+dnnl_status_t DNNL_API dnnl_stream_fork(dnnl_stream_t stream);
+
+/// Executes the primitives submitted to an execution stream since the
+/// dnnl_stream_fork() call and blocks until they are completed.
+///
+/// @param stream Execution stream.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise, e.g. the status of the first failed primitive.
+dnnl_status_t DNNL_API dnnl_stream_join(dnnl_stream_t stream);
+
 /// Destroys an execution stream.
 ///
 /// @param stream Execution stream to destroy.
@@ -3395,6 +3964,64 @@ dnnl_status_t DNNL_API dnnl_get_primitive_cache_capacity(int *capacity);
 ///     success.
 dnnl_status_t DNNL_API dnnl_set_primitive_cache_capacity(int capacity);
 
+/// Returns the limit of the memory held by the primitives of the primitive
+/// cache, in megabytes.
+///
+/// @param capacity_mb Memory limit to query. 0 means that the number of
+/// primitives is the only limit.
+/// @returns #dnnl_invalid_arguments/#dnnl::status::invalid_arguments if the
+///     @p capacity_mb value is invalid, and
+///     #dnnl_success/#dnnl::status::success on success.
+dnnl_status_t DNNL_API dnnl_get_primitive_cache_capacity_mb(int *capacity_mb);
+
+/// Sets the limit of the memory held by the primitives of the primitive
+/// cache, in megabytes, in addition to the limit of the number of primitives.
+///
+/// When the limit is set, the entries are not evicted in the least recently
+/// used order, but weighed by the memory the primitives hold (see
+/// dnnl_primitive_get_memory_footprint()) and by the time their creation
+/// took, so that the primitives that are small and expensive to create are
+/// evicted last.
+///
+/// @param capacity_mb Memory limit to set. If the cached primitives hold
+/// more memory than the new limit then the excess entries are evicted.
+/// Setting @p capacity_mb to 0 removes the limit. Concurrently modifying
+/// @p capacity_mb is safe.
+/// @returns #dnnl_invalid_arguments/#dnnl::status::invalid_arguments if the
+///     @p capacity_mb value is invalid, and
+///     #dnnl_success/#dnnl::status::success on success.
+dnnl_status_t DNNL_API dnnl_set_primitive_cache_capacity_mb(int capacity_mb);
+
+/// Returns the primitive cache statistics.
+///
+/// @param stats Primitive cache statistics to query. Concurrently
+/// accessing @p stats is safe.
+/// @returns #dnnl_invalid_arguments/#dnnl::status::invalid_arguments if the
+///     @p stats value is invalid, and #dnnl_success/#dnnl::status::success on
+///     success.
+dnnl_status_t DNNL_API dnnl_get_primitive_cache_stats(
+        dnnl_primitive_cache_stats_t *stats);
+
+/// Resets all the primitive cache statistics counters to zero. The content
+/// of the primitive cache is not affected.
+///
+/// @returns #dnnl_success/#dnnl::status::success on success.
+dnnl_status_t DNNL_API dnnl_reset_primitive_cache_stats(void);
+
+/// Returns the memory held by all the primitives of the primitive cache.
+///
+/// The cache holds the primitive implementations, which are shared by all
+/// the primitive objects created with the same primitive descriptor. The
+/// scratchpads belong to the primitive objects and are therefore not
+/// included.
+///
+/// @param footprint Output memory footprint.
+/// @returns #dnnl_invalid_arguments/#dnnl::status::invalid_arguments if the
+///     @p footprint value is invalid, and #dnnl_success/#dnnl::status::success
+///     on success.
+dnnl_status_t DNNL_API dnnl_get_primitive_cache_memory_footprint(
+        dnnl_memory_footprint_t *footprint);
+
 /// @} dnnl_api_primitive_cache
 
 /// @addtogroup dnnl_api_service
@@ -3409,12 +4036,38 @@ dnnl_status_t DNNL_API dnnl_set_primitive_cache_capacity(int capacity);
 /// @param level Verbosity level:
 ///  - 0: no verbose output (default),
 ///  - 1: primitive information at execution,
-///  - 2: primitive information at creation and execution.
+///  - 2: primitive information at creation and execution,
+///  - 3: same as 2 plus the size and generation time of every JIT kernel
+///    and their per-kernel totals at exit.
 /// @returns #dnnl_invalid_arguments/#dnnl::status::invalid_arguments if the
 ///     @p level value is invalid, and #dnnl_success/#dnnl::status::success on
 ///     success.
 dnnl_status_t DNNL_API dnnl_set_verbose(int level);
 
+/// Redirects the verbose output to a callback.
+///
+/// @note
+///     The callback is called with the lines of all threads, one line at a
+///     time. This setting overrides the DNNL_VERBOSE_OUTPUT environment
+///     variable.
+///
+/// @param callback Function that receives the verbose lines, or NULL to
+///     print them to the default output.
+/// @param user_data Pointer passed to every call of the @p callback.
+/// @returns #dnnl_success/#dnnl::status::success on success.
+dnnl_status_t DNNL_API dnnl_set_verbose_callback(
+        dnnl_verbose_callback_t callback, void *user_data);
+
+/// Prints the execution time statistics collected in the sampled verbose
+/// mode (DNNL_VERBOSE_SAMPLE environment variable) and resets them.
+///
+/// @note
+///     The samples still buffered by threads other than the calling one are
+///     printed with a later call or at exit.
+///
+/// @returns #dnnl_success/#dnnl::status::success on success.
+dnnl_status_t DNNL_API dnnl_dump_verbose_samples(void);
+
 /// Configures dumping of JIT-generated code.
 ///
 /// @note
@@ -3528,6 +4181,41 @@ dnnl_status_t DNNL_API dnnl_set_max_cpu_isa(dnnl_cpu_isa_t isa);
 ///     dispatch to.
 dnnl_cpu_isa_t DNNL_API dnnl_get_effective_cpu_isa(void);
 
+/// Sets the functions the library uses to allocate and free host memory:
+/// memory objects allocated by the library, scratchpads, and other internal
+/// buffers. The allocator can only be changed before the library allocates
+/// any memory.
+///
+/// @note
+///     Memory debug mode (see @ref dev_guide_build_options) takes precedence
+///     over a user-provided allocator.
+///
+/// @param malloc_fn Allocation function. Pass NULL together with a NULL
+///     @p free_fn to restore the default allocator.
+/// @param free_fn Deallocation function.
+/// @returns #dnnl_success/#dnnl::status::success on success and a
+///     #dnnl_invalid_arguments/#dnnl::status::invalid_arguments if only one
+///     of the functions is NULL or the allocator cannot be changed at this
+///     time.
+dnnl_status_t DNNL_API dnnl_set_memory_allocator(
+        dnnl_malloc_fn_t malloc_fn, dnnl_free_fn_t free_fn);
+
+/// Sets the size starting from which the default allocator backs host
+/// allocations with transparent huge pages. Such allocations are aligned to
+/// the huge page size and advised with `madvise(MADV_HUGEPAGE)`.
+///
+/// @note
+///     This setting overrides the DNNL_HUGEPAGE_THRESHOLD environment
+///     variable. It has no effect with a user-provided allocator and on
+///     operating systems other than Linux.
+///
+/// @param threshold Size of the allocation in bytes. Pass 0 to disable huge
+///     pages (default).
+/// @returns #dnnl_success/#dnnl::status::success on success and
+///     #dnnl_unimplemented/#dnnl::status::unimplemented if huge pages are not
+///     supported on the system.
+dnnl_status_t DNNL_API dnnl_set_hugepage_threshold(size_t threshold);
+
 /// @} dnnl_api_service
 
 /// @addtogroup dnnl_api_blas
@@ -3713,6 +4401,579 @@ dnnl_status_t DNNL_API dnnl_gemm_s8s8s32(char transa, char transb, char offsetc,
         dnnl_dim_t lda, int8_t ao, const int8_t *B, dnnl_dim_t ldb, int8_t bo,
         float beta, int32_t *C, dnnl_dim_t ldc, const int32_t *co);
 
+/// Performs a group of independent single-precision floating-point
+/// matrix-matrix multiplies, which may all have different sizes.
+///
+/// For every group index `g` in `[0, group_count)` the operation is defined
+/// as for dnnl_sgemm():
+///
+/// `C[g] := alpha[g] * op( A[g] ) * op( B[g] ) + beta[g] * C[g]`
+///
+/// with `op( A[g] )` being an `M[g]xK[g]` matrix, `op( B[g] )` a `K[g]xN[g]`
+/// matrix and `C[g]` an `M[g]xN[g]` matrix. The matrices are assumed to be
+/// stored in row-major order. The typical use case is a batch of
+/// variable-length sequences that would otherwise be padded to the longest
+/// one.
+///
+/// The work of all the groups is distributed among the threads at once, so
+/// that groups of very different sizes are computed efficiently.
+///
+/// @note
+///     The output matrices of different groups must not overlap.
+///
+/// @param group_count The number of groups.
+/// @param transa An array of transposition flags for matrices A.
+/// @param transb An array of transposition flags for matrices B.
+/// @param M An array of the M dimensions.
+/// @param N An array of the N dimensions.
+/// @param K An array of the K dimensions.
+/// @param alpha An array of the alpha parameters.
+/// @param A An array of pointers to the A matrices data.
+/// @param lda An array of the leading dimensions for the matrices A.
+/// @param B An array of pointers to the B matrices data.
+/// @param ldb An array of the leading dimensions for the matrices B.
+/// @param beta An array of the beta parameters.
+/// @param C An array of pointers to the C matrices data.
+/// @param ldc An array of the leading dimensions for the matrices C.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_sgemm_grouped(dnnl_dim_t group_count,
+        const char *transa, const char *transb, const dnnl_dim_t *M,
+        const dnnl_dim_t *N, const dnnl_dim_t *K, const float *alpha,
+        const float *const *A, const dnnl_dim_t *lda, const float *const *B,
+        const dnnl_dim_t *ldb, const float *beta, float *const *C,
+        const dnnl_dim_t *ldc);
+
+/// Performs a batch of single-precision floating-point matrix-matrix
+/// multiplies of the same sizes, with the matrices of every problem given by
+/// arrays of pointers.
+///
+/// For every batch index `i` in `[0, batch)` the operation is defined as for
+/// dnnl_sgemm():
+///
+/// `C[i] := alpha * op( A[i] ) * op( B[i] ) + beta * C[i]`
+///
+/// The problems of the batch are distributed among the threads, so that a
+/// batch of small problems does not pay the threading overhead of a gemm
+/// call for every problem. If one of the matrices is shared by all the
+/// problems (all the pointers are equal) and the other matrices are evenly
+/// spaced so that the batch forms a single larger problem, the shared matrix
+/// is only packed once.
+///
+/// @note
+///     The output matrices of different problems must not overlap.
+///
+/// @param transa Transposition flag for matrices A: 'N' or 'n' means A is not
+///     transposed, and 'T' or 't' means that A is transposed.
+/// @param transb Transposition flag for matrices B: 'N' or 'n' means B is not
+///     transposed, and 'T' or 't' means that B is transposed.
+/// @param batch The number of problems.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param alpha The alpha parameter that is used to scale the products of
+///     matrices A and B.
+/// @param A An array of @p batch pointers to the A matrices data.
+/// @param lda The leading dimension for the matrices A.
+/// @param B An array of @p batch pointers to the B matrices data.
+/// @param ldb The leading dimension for the matrices B.
+/// @param beta The beta parameter that is used to scale the matrices C.
+/// @param C An array of @p batch pointers to the C matrices data.
+/// @param ldc The leading dimension for the matrices C.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_sgemm_batch(char transa, char transb,
+        dnnl_dim_t batch, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K,
+        float alpha, const float *const *A, dnnl_dim_t lda,
+        const float *const *B, dnnl_dim_t ldb, float beta, float *const *C,
+        dnnl_dim_t ldc);
+
+/// Performs a batch of single-precision floating-point matrix-matrix
+/// multiplies of the same sizes, with the matrices of consecutive problems
+/// located at a constant distance from each other.
+///
+/// The same as dnnl_sgemm_batch() with `A[i] = A + i * stride_a`,
+/// `B[i] = B + i * stride_b`, and `C[i] = C + i * stride_c`. A zero stride
+/// means that the matrix is shared by all the problems of the batch.
+///
+/// @param transa Transposition flag for matrices A: 'N' or 'n' means A is not
+///     transposed, and 'T' or 't' means that A is transposed.
+/// @param transb Transposition flag for matrices B: 'N' or 'n' means B is not
+///     transposed, and 'T' or 't' means that B is transposed.
+/// @param batch The number of problems.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param alpha The alpha parameter that is used to scale the products of
+///     matrices A and B.
+/// @param A A pointer to the A matrix of the first problem.
+/// @param lda The leading dimension for the matrices A.
+/// @param stride_a The distance in elements between consecutive matrices A.
+/// @param B A pointer to the B matrix of the first problem.
+/// @param ldb The leading dimension for the matrices B.
+/// @param stride_b The distance in elements between consecutive matrices B.
+/// @param beta The beta parameter that is used to scale the matrices C.
+/// @param C A pointer to the C matrix of the first problem.
+/// @param ldc The leading dimension for the matrices C.
+/// @param stride_c The distance in elements between consecutive matrices C.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_sgemm_batch_strided(char transa, char transb,
+        dnnl_dim_t batch, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K,
+        float alpha, const float *A, dnnl_dim_t lda, dnnl_dim_t stride_a,
+        const float *B, dnnl_dim_t ldb, dnnl_dim_t stride_b, float beta,
+        float *C, dnnl_dim_t ldc, dnnl_dim_t stride_c);
+
+/// Performs a batch of dnnl_gemm_u8s8s32() matrix-matrix multiplies of the
+/// same sizes, with the matrices of every problem given by arrays of
+/// pointers.
+///
+/// All the problems share the same offsets, including the @p co array. The
+/// threading and the handling of shared matrices are the same as for
+/// dnnl_sgemm_batch().
+///
+/// @param transa Transposition flag for matrices A.
+/// @param transb Transposition flag for matrices B.
+/// @param offsetc Flag specifying how offsets should be applied to matrices
+///     C, as for dnnl_gemm_u8s8s32().
+/// @param batch The number of problems.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param alpha The alpha parameter that is used to scale the products of
+///     matrices A and B.
+/// @param A An array of @p batch pointers to the A matrices data.
+/// @param lda The leading dimension for the matrices A.
+/// @param ao The offset value for the matrices A.
+/// @param B An array of @p batch pointers to the B matrices data.
+/// @param ldb The leading dimension for the matrices B.
+/// @param bo The offset value for the matrices B.
+/// @param beta The beta parameter that is used to scale the matrices C.
+/// @param C An array of @p batch pointers to the C matrices data.
+/// @param ldc The leading dimension for the matrices C.
+/// @param co An array of offset values for the matrices C.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_gemm_u8s8s32_batch(char transa, char transb,
+        char offsetc, dnnl_dim_t batch, dnnl_dim_t M, dnnl_dim_t N,
+        dnnl_dim_t K, float alpha, const uint8_t *const *A, dnnl_dim_t lda,
+        uint8_t ao, const int8_t *const *B, dnnl_dim_t ldb, int8_t bo,
+        float beta, int32_t *const *C, dnnl_dim_t ldc, const int32_t *co);
+
+/// Performs a batch of dnnl_gemm_u8s8s32() matrix-matrix multiplies of the
+/// same sizes, with the matrices of consecutive problems located at a
+/// constant distance from each other.
+///
+/// The same as dnnl_gemm_u8s8s32_batch() with `A[i] = A + i * stride_a`,
+/// `B[i] = B + i * stride_b`, and `C[i] = C + i * stride_c`.
+///
+/// @param transa Transposition flag for matrices A.
+/// @param transb Transposition flag for matrices B.
+/// @param offsetc Flag specifying how offsets should be applied to matrices
+///     C, as for dnnl_gemm_u8s8s32().
+/// @param batch The number of problems.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param alpha The alpha parameter that is used to scale the products of
+///     matrices A and B.
+/// @param A A pointer to the A matrix of the first problem.
+/// @param lda The leading dimension for the matrices A.
+/// @param stride_a The distance in elements between consecutive matrices A.
+/// @param ao The offset value for the matrices A.
+/// @param B A pointer to the B matrix of the first problem.
+/// @param ldb The leading dimension for the matrices B.
+/// @param stride_b The distance in elements between consecutive matrices B.
+/// @param bo The offset value for the matrices B.
+/// @param beta The beta parameter that is used to scale the matrices C.
+/// @param C A pointer to the C matrix of the first problem.
+/// @param ldc The leading dimension for the matrices C.
+/// @param stride_c The distance in elements between consecutive matrices C.
+/// @param co An array of offset values for the matrices C.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_gemm_u8s8s32_batch_strided(char transa,
+        char transb, char offsetc, dnnl_dim_t batch, dnnl_dim_t M,
+        dnnl_dim_t N, dnnl_dim_t K, float alpha, const uint8_t *A,
+        dnnl_dim_t lda, dnnl_dim_t stride_a, uint8_t ao, const int8_t *B,
+        dnnl_dim_t ldb, dnnl_dim_t stride_b, int8_t bo, float beta,
+        int32_t *C, dnnl_dim_t ldc, dnnl_dim_t stride_c, const int32_t *co);
+
+/// Performs a batch of dnnl_gemm_s8s8s32() matrix-matrix multiplies of the
+/// same sizes, with the matrices of every problem given by arrays of
+/// pointers.
+///
+/// All the problems share the same offsets, including the @p co array. The
+/// threading and the handling of shared matrices are the same as for
+/// dnnl_sgemm_batch().
+///
+/// @param transa Transposition flag for matrices A.
+/// @param transb Transposition flag for matrices B.
+/// @param offsetc Flag specifying how offsets should be applied to matrices
+///     C, as for dnnl_gemm_s8s8s32().
+/// @param batch The number of problems.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param alpha The alpha parameter that is used to scale the products of
+///     matrices A and B.
+/// @param A An array of @p batch pointers to the A matrices data.
+/// @param lda The leading dimension for the matrices A.
+/// @param ao The offset value for the matrices A.
+/// @param B An array of @p batch pointers to the B matrices data.
+/// @param ldb The leading dimension for the matrices B.
+/// @param bo The offset value for the matrices B.
+/// @param beta The beta parameter that is used to scale the matrices C.
+/// @param C An array of @p batch pointers to the C matrices data.
+/// @param ldc The leading dimension for the matrices C.
+/// @param co An array of offset values for the matrices C.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_gemm_s8s8s32_batch(char transa, char transb,
+        char offsetc, dnnl_dim_t batch, dnnl_dim_t M, dnnl_dim_t N,
+        dnnl_dim_t K, float alpha, const int8_t *const *A, dnnl_dim_t lda,
+        int8_t ao, const int8_t *const *B, dnnl_dim_t ldb, int8_t bo,
+        float beta, int32_t *const *C, dnnl_dim_t ldc, const int32_t *co);
+
+/// Performs a batch of dnnl_gemm_s8s8s32() matrix-matrix multiplies of the
+/// same sizes, with the matrices of consecutive problems located at a
+/// constant distance from each other.
+///
+/// The same as dnnl_gemm_s8s8s32_batch() with `A[i] = A + i * stride_a`,
+/// `B[i] = B + i * stride_b`, and `C[i] = C + i * stride_c`.
+///
+/// @param transa Transposition flag for matrices A.
+/// @param transb Transposition flag for matrices B.
+/// @param offsetc Flag specifying how offsets should be applied to matrices
+///     C, as for dnnl_gemm_s8s8s32().
+/// @param batch The number of problems.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param alpha The alpha parameter that is used to scale the products of
+///     matrices A and B.
+/// @param A A pointer to the A matrix of the first problem.
+/// @param lda The leading dimension for the matrices A.
+/// @param stride_a The distance in elements between consecutive matrices A.
+/// @param ao The offset value for the matrices A.
+/// @param B A pointer to the B matrix of the first problem.
+/// @param ldb The leading dimension for the matrices B.
+/// @param stride_b The distance in elements between consecutive matrices B.
+/// @param bo The offset value for the matrices B.
+/// @param beta The beta parameter that is used to scale the matrices C.
+/// @param C A pointer to the C matrix of the first problem.
+/// @param ldc The leading dimension for the matrices C.
+/// @param stride_c The distance in elements between consecutive matrices C.
+/// @param co An array of offset values for the matrices C.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_gemm_s8s8s32_batch_strided(char transa,
+        char transb, char offsetc, dnnl_dim_t batch, dnnl_dim_t M,
+        dnnl_dim_t N, dnnl_dim_t K, float alpha, const int8_t *A,
+        dnnl_dim_t lda, dnnl_dim_t stride_a, int8_t ao, const int8_t *B,
+        dnnl_dim_t ldb, dnnl_dim_t stride_b, int8_t bo, float beta,
+        int32_t *C, dnnl_dim_t ldc, dnnl_dim_t stride_c, const int32_t *co);
+
+/// Queries the size of the buffer required to hold a packed matrix for
+/// dnnl_sgemm_compute().
+///
+/// Packing a matrix that is reused by many multiplies, such as a weights
+/// matrix, once up front saves the packing cost on every multiply.
+///
+/// @param identifier The matrix to pack: 'A' or 'a' for matrix A, and 'B'
+///     or 'b' for matrix B.
+/// @param transa Transposition flag for matrix A: 'N' or 'n' means A is not
+///     transposed, and 'T' or 't' means that A is transposed.
+/// @param transb Transposition flag for matrix B: 'N' or 'n' means B is not
+///     transposed, and 'T' or 't' means that B is transposed.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param lda The leading dimension for matrix A.
+/// @param ldb The leading dimension for matrix B.
+/// @param size Output size of the packed buffer, in bytes.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise. #dnnl_unimplemented means that
+///     packing is not supported on the current machine.
+dnnl_status_t DNNL_API dnnl_sgemm_pack_get_size(char identifier, char transa,
+        char transb, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, dnnl_dim_t lda,
+        dnnl_dim_t ldb, size_t *size);
+
+/// Packs matrix A or B for dnnl_sgemm_compute().
+///
+/// All the parameters except @p src and @p dst must be the same as for the
+/// dnnl_sgemm_pack_get_size() call used to allocate @p dst.
+///
+/// @note
+///     The packed layout depends on the maximum number of threads at the
+///     time of the call. dnnl_sgemm_compute() must be called with the same
+///     maximum number of threads and outside of parallel regions.
+///
+/// @param identifier The matrix to pack: 'A' or 'a' for matrix A, and 'B'
+///     or 'b' for matrix B.
+/// @param transa Transposition flag for matrix A.
+/// @param transb Transposition flag for matrix B.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param lda The leading dimension for matrix A.
+/// @param ldb The leading dimension for matrix B.
+/// @param src The matrix to pack.
+/// @param dst The packed buffer.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_sgemm_pack(char identifier, char transa,
+        char transb, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, dnnl_dim_t lda,
+        dnnl_dim_t ldb, const float *src, float *dst);
+
+/// Performs single-precision matrix-matrix multiply with one or both of the
+/// matrices packed by dnnl_sgemm_pack().
+///
+/// The operation is defined as:
+///
+/// `C := op( A )*op( B ) + beta*C`
+///
+/// The sizes and the transposition flags of the packed matrices must be the
+/// same as the ones passed to dnnl_sgemm_pack(). The alpha parameter is not
+/// supported and is implicitly 1.
+///
+/// @param transa Transposition flag for matrix A: 'N' or 'n' means A is not
+///     transposed, 'T' or 't' means that A is transposed, and 'P' or 'p'
+///     means that A is packed.
+/// @param transb Transposition flag for matrix B: 'N' or 'n' means B is not
+///     transposed, 'T' or 't' means that B is transposed, and 'P' or 'p'
+///     means that B is packed.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param A A pointer to the matrix A data or to the packed buffer.
+/// @param lda The leading dimension for matrix A. Ignored if A is packed.
+/// @param B A pointer to the matrix B data or to the packed buffer.
+/// @param ldb The leading dimension for matrix B. Ignored if B is packed.
+/// @param beta The beta parameter that is used to scale the matrix C.
+/// @param C A pointer to the matrix C data.
+/// @param ldc The leading dimension for matrix C.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_sgemm_compute(char transa, char transb,
+        dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, const float *A,
+        dnnl_dim_t lda, const float *B, dnnl_dim_t ldb, float beta, float *C,
+        dnnl_dim_t ldc);
+
+/// Queries the size of the buffer required to hold a packed matrix for
+/// dnnl_gemm_bf16bf16f32_compute().
+///
+/// The parameters are the same as for dnnl_sgemm_pack_get_size().
+///
+/// @param identifier The matrix to pack: 'A' or 'a', or 'B' or 'b'.
+/// @param transa Transposition flag for matrix A.
+/// @param transb Transposition flag for matrix B.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param lda The leading dimension for matrix A.
+/// @param ldb The leading dimension for matrix B.
+/// @param size Output size of the packed buffer, in bytes.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_gemm_bf16bf16f32_pack_get_size(char identifier,
+        char transa, char transb, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K,
+        dnnl_dim_t lda, dnnl_dim_t ldb, size_t *size);
+
+/// Packs bf16 matrix A or B for dnnl_gemm_bf16bf16f32_compute().
+///
+/// The bf16 data is passed as raw 16-bit values. The parameters and the
+/// restrictions are the same as for dnnl_sgemm_pack().
+///
+/// @param identifier The matrix to pack: 'A' or 'a', or 'B' or 'b'.
+/// @param transa Transposition flag for matrix A.
+/// @param transb Transposition flag for matrix B.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param lda The leading dimension for matrix A.
+/// @param ldb The leading dimension for matrix B.
+/// @param src The matrix to pack.
+/// @param dst The packed buffer.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_gemm_bf16bf16f32_pack(char identifier,
+        char transa, char transb, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K,
+        dnnl_dim_t lda, dnnl_dim_t ldb, const uint16_t *src, uint16_t *dst);
+
+/// Performs bf16 matrix-matrix multiply with f32 accumulation and one or
+/// both of the matrices packed by dnnl_gemm_bf16bf16f32_pack().
+///
+/// The parameters and the restrictions are the same as for
+/// dnnl_sgemm_compute().
+///
+/// @param transa Transposition flag for matrix A: 'N', 'T', or 'P'.
+/// @param transb Transposition flag for matrix B: 'N', 'T', or 'P'.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param A A pointer to the matrix A data or to the packed buffer.
+/// @param lda The leading dimension for matrix A.
+/// @param B A pointer to the matrix B data or to the packed buffer.
+/// @param ldb The leading dimension for matrix B.
+/// @param beta The beta parameter that is used to scale the matrix C.
+/// @param C A pointer to the matrix C data.
+/// @param ldc The leading dimension for matrix C.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_gemm_bf16bf16f32_compute(char transa,
+        char transb, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K,
+        const uint16_t *A, dnnl_dim_t lda, const uint16_t *B, dnnl_dim_t ldb,
+        float beta, float *C, dnnl_dim_t ldc);
+
+/// Queries the size of the buffer required to hold a packed matrix for
+/// dnnl_gemm_u8s8s32_compute().
+///
+/// The parameters are the same as for dnnl_sgemm_pack_get_size().
+///
+/// @param identifier The matrix to pack: 'A' or 'a', or 'B' or 'b'.
+/// @param transa Transposition flag for matrix A.
+/// @param transb Transposition flag for matrix B.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param lda The leading dimension for matrix A.
+/// @param ldb The leading dimension for matrix B.
+/// @param size Output size of the packed buffer, in bytes.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_gemm_u8s8s32_pack_get_size(char identifier,
+        char transa, char transb, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K,
+        dnnl_dim_t lda, dnnl_dim_t ldb, size_t *size);
+
+/// Packs matrix A (uint8_t) or B (int8_t) for dnnl_gemm_u8s8s32_compute().
+///
+/// The parameters and the restrictions are the same as for
+/// dnnl_sgemm_pack().
+///
+/// @param identifier The matrix to pack: 'A' or 'a', or 'B' or 'b'.
+/// @param transa Transposition flag for matrix A.
+/// @param transb Transposition flag for matrix B.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param lda The leading dimension for matrix A.
+/// @param ldb The leading dimension for matrix B.
+/// @param src The matrix to pack.
+/// @param dst The packed buffer.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_gemm_u8s8s32_pack(char identifier, char transa,
+        char transb, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, dnnl_dim_t lda,
+        dnnl_dim_t ldb, const void *src, void *dst);
+
+/// Performs dnnl_gemm_u8s8s32() matrix-matrix multiply with one or both of
+/// the matrices packed by dnnl_gemm_u8s8s32_pack().
+///
+/// The operation is defined as:
+///
+/// `C := op(A) * op(B) + beta * C + co`
+///
+/// The offsets of matrices A and B are not supported and are implicitly 0,
+/// and the alpha parameter is implicitly 1. The other restrictions are the
+/// same as for dnnl_sgemm_compute().
+///
+/// @param transa Transposition flag for matrix A: 'N', 'T', or 'P'.
+/// @param transb Transposition flag for matrix B: 'N', 'T', or 'P'.
+/// @param offsetc Flag specifying how offsets should be applied to matrix
+///     C, as for dnnl_gemm_u8s8s32().
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param A A pointer to the matrix A data or to the packed buffer.
+/// @param lda The leading dimension for matrix A.
+/// @param B A pointer to the matrix B data or to the packed buffer.
+/// @param ldb The leading dimension for matrix B.
+/// @param beta The beta parameter that is used to scale the matrix C.
+/// @param C A pointer to the matrix C data.
+/// @param ldc The leading dimension for matrix C.
+/// @param co An array of offset values for the matrix C.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_gemm_u8s8s32_compute(char transa, char transb,
+        char offsetc, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K,
+        const void *A, dnnl_dim_t lda, const void *B, dnnl_dim_t ldb,
+        float beta, int32_t *C, dnnl_dim_t ldc, const int32_t *co);
+
+/// Queries the size of the buffer required to hold a packed matrix for
+/// dnnl_gemm_s8s8s32_compute().
+///
+/// The parameters are the same as for dnnl_sgemm_pack_get_size().
+///
+/// @param identifier The matrix to pack: 'A' or 'a', or 'B' or 'b'.
+/// @param transa Transposition flag for matrix A.
+/// @param transb Transposition flag for matrix B.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param lda The leading dimension for matrix A.
+/// @param ldb The leading dimension for matrix B.
+/// @param size Output size of the packed buffer, in bytes.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_gemm_s8s8s32_pack_get_size(char identifier,
+        char transa, char transb, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K,
+        dnnl_dim_t lda, dnnl_dim_t ldb, size_t *size);
+
+/// Packs matrix A (int8_t) or B (int8_t) for dnnl_gemm_s8s8s32_compute().
+///
+/// The parameters and the restrictions are the same as for
+/// dnnl_sgemm_pack().
+///
+/// @param identifier The matrix to pack: 'A' or 'a', or 'B' or 'b'.
+/// @param transa Transposition flag for matrix A.
+/// @param transb Transposition flag for matrix B.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param lda The leading dimension for matrix A.
+/// @param ldb The leading dimension for matrix B.
+/// @param src The matrix to pack.
+/// @param dst The packed buffer.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_gemm_s8s8s32_pack(char identifier, char transa,
+        char transb, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, dnnl_dim_t lda,
+        dnnl_dim_t ldb, const void *src, void *dst);
+
+/// Performs dnnl_gemm_s8s8s32() matrix-matrix multiply with one or both of
+/// the matrices packed by dnnl_gemm_s8s8s32_pack().
+///
+/// The operation is defined as:
+///
+/// `C := op(A) * op(B) + beta * C + co`
+///
+/// The offsets of matrices A and B are not supported and are implicitly 0,
+/// and the alpha parameter is implicitly 1. The other restrictions are the
+/// same as for dnnl_sgemm_compute().
+///
+/// @param transa Transposition flag for matrix A: 'N', 'T', or 'P'.
+/// @param transb Transposition flag for matrix B: 'N', 'T', or 'P'.
+/// @param offsetc Flag specifying how offsets should be applied to matrix
+///     C, as for dnnl_gemm_s8s8s32().
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param A A pointer to the matrix A data or to the packed buffer.
+/// @param lda The leading dimension for matrix A.
+/// @param B A pointer to the matrix B data or to the packed buffer.
+/// @param ldb The leading dimension for matrix B.
+/// @param beta The beta parameter that is used to scale the matrix C.
+/// @param C A pointer to the matrix C data.
+/// @param ldc The leading dimension for matrix C.
+/// @param co An array of offset values for the matrix C.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_gemm_s8s8s32_compute(char transa, char transb,
+        char offsetc, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K,
+        const void *A, dnnl_dim_t lda, const void *B, dnnl_dim_t ldb,
+        float beta, int32_t *C, dnnl_dim_t ldc, const int32_t *co);
+
 /// @} dnnl_api_blas
 
 /// @} dnnl_api
@@ -248,6 +248,13 @@ struct handle_traits<dnnl_primitive_desc_iterator_t> {
         return dnnl_primitive_desc_iterator_destroy(p);
     }
 };
+
+template <>
+struct handle_traits<dnnl_bound_args_t> {
+    static dnnl_status_t destructor(dnnl_bound_args_t p) {
+        return dnnl_bound_args_destroy(p);
+    }
+};
 /// @endcond
 
 /// @} dnnl_api_utils
@@ -255,6 +262,7 @@ struct handle_traits<dnnl_primitive_desc_iterator_t> {
 struct stream;
 struct memory;
 struct primitive_desc;
+struct bound_args;
 
 /// @addtogroup dnnl_api_primitives Primitives
 /// Compute primitives
@@ -265,6 +273,9 @@ struct primitive_desc;
 /// Common operations to create, destroy and inspect primitives
 /// @{
 
+/// @copydoc dnnl_memory_footprint_t
+using memory_footprint_t = dnnl_memory_footprint_t;
+
 /// Base class for all computational primitives.
 struct primitive : public handle<dnnl_primitive_t> {
     /// Kinds of primitives supported by the library.
@@ -313,6 +324,12 @@ struct primitive : public handle<dnnl_primitive_t> {
         reduction = dnnl_reduction,
         /// A PReLU primitive.
         prelu = dnnl_prelu,
+        /// An embedding bag primitive.
+        embedding_bag = dnnl_embedding_bag,
+        /// A group normalization primitive.
+        group_normalization = dnnl_group_normalization,
+        /// An optimizer primitive.
+        optimizer = dnnl_optimizer,
     };
 
     using handle::handle;
@@ -330,6 +347,27 @@ struct primitive : public handle<dnnl_primitive_t> {
     /// @param pd Primitive descriptor.
     primitive(const primitive_desc &pd);
 
+    /// Constructs a primitive from a primitive descriptor and a cache blob.
+    ///
+    /// The program binaries of the primitive are taken from the cache blob
+    /// instead of being compiled. See
+    /// dnnl_primitive_create_from_cache_blob() for details.
+    ///
+    /// @param pd Primitive descriptor.
+    /// @param cache_blob Cache blob obtained with get_cache_blob().
+    primitive(const primitive_desc &pd, const std::vector<uint8_t> &cache_blob);
+
+    /// Creates primitives from a batch of primitive descriptors.
+    ///
+    /// The primitives are created concurrently on host threads, which
+    /// shortens the creation of a whole model, especially on the GPU where
+    /// every primitive builds its own OpenCL programs.
+    ///
+    /// @param pds Primitive descriptors.
+    /// @returns Primitives in the order of @p pds.
+    static std::vector<primitive> create_batch(
+            const std::vector<primitive_desc> &pds);
+
     /// Returns the C API primitive descriptor of the underlying C API
     /// primitive.
     ///
@@ -341,6 +379,17 @@ struct primitive : public handle<dnnl_primitive_t> {
     /// @returns The primitive kind.
     inline kind get_kind() const;
 
+    /// Returns a cache blob of the primitive, which holds its program
+    /// binaries. GPU engines only.
+    ///
+    /// @returns The cache blob.
+    std::vector<uint8_t> get_cache_blob() const;
+
+    /// Returns the memory held by the primitive.
+    ///
+    /// @returns The memory footprint.
+    memory_footprint_t get_memory_footprint() const;
+
     /// Executes computations specified by the primitive in a specified stream.
     ///
     /// Arguments are passed via an arguments map containing <index,
@@ -355,6 +404,26 @@ struct primitive : public handle<dnnl_primitive_t> {
     /// @param args Arguments map.
     void execute(const stream &astream,
             const std::unordered_map<int, memory> &args) const;
+
+    /// Executes computations specified by the primitive in a specified stream
+    /// with arguments bound to the primitive in advance.
+    ///
+    /// @param astream Stream object. The stream must belong to the same engine
+    ///     as the primitive.
+    /// @param args Arguments bound to this primitive.
+    void execute(const stream &astream, const bound_args &args) const;
+
+    /// Executes computations specified by the primitive over a batch of
+    /// independent argument sets.
+    ///
+    /// On CPU the items are computed in parallel, each by a single thread.
+    /// See dnnl_primitive_execute_batch() for details.
+    ///
+    /// @param astream Stream object. The stream must belong to the same engine
+    ///     as the primitive.
+    /// @param batch Arguments maps, one per item.
+    void execute_batch(const stream &astream,
+            const std::vector<std::unordered_map<int, memory>> &batch) const;
 };
 
 /// Converts primitive kind enum value from C++ API to C API type.
@@ -431,6 +500,26 @@ inline dnnl_scratchpad_mode_t convert_to_c(scratchpad_mode mode) {
     return static_cast<dnnl_scratchpad_mode_t>(mode);
 }
 
+/// Floating-point math mode
+enum class fpmath_mode {
+    /// Default behavior, no down-conversions allowed
+    strict = dnnl_fpmath_mode_strict,
+    /// Implicit f32->bf16 conversions allowed
+    bf16 = dnnl_fpmath_mode_bf16,
+    /// Implicit f32->f16 conversions allowed
+    f16 = dnnl_fpmath_mode_f16,
+    /// Implicit f32->f16 or f32->bf16 conversions allowed
+    any = dnnl_fpmath_mode_any,
+};
+
+/// Converts an fpmath mode enum value from C++ API to C API type.
+///
+/// @param mode C++ API fpmath mode enum value.
+/// @returns Corresponding C API fpmath mode enum value.
+inline dnnl_fpmath_mode_t convert_to_c(fpmath_mode mode) {
+    return static_cast<dnnl_fpmath_mode_t>(mode);
+}
+
 /// Propagation kind.
 enum class prop_kind {
     /// Undefined propagation kind.
@@ -524,6 +613,14 @@ enum class algorithm {
     eltwise_pow = dnnl_eltwise_pow,
     /// Elementwise: round
     eltwise_round = dnnl_eltwise_round,
+    /// Elementwise: hardswish (\f$x \cdot hardsigmoid(x)\f$)
+    eltwise_hardswish = dnnl_eltwise_hardswish,
+    /// Elementwise: hardsigmoid (\f$\max(0, \min(1, a \cdot x + b))\f$)
+    eltwise_hardsigmoid = dnnl_eltwise_hardsigmoid,
+    /// Elementwise: mish (\f$x \cdot tanh(soft\_relu(x))\f$)
+    eltwise_mish = dnnl_eltwise_mish,
+    /// Elementwise: scaled exponential linear unit (SELU)
+    eltwise_selu = dnnl_eltwise_selu,
     /// Elementwise: rectified linar unit (ReLU) (dst for backward)
     eltwise_relu_use_dst_for_bwd = dnnl_eltwise_relu_use_dst_for_bwd,
     /// Elementwise: hyperbolic tangent non-linearity (tanh) (dst for backward)
@@ -563,6 +660,10 @@ enum class algorithm {
     /// LRB GRU expects 4 bias tensors on input:
     /// \f$[b_{u}, b_{r}, b_{c_x}, b_{c_h}]\f$
     lbr_gru = dnnl_lbr_gru,
+    /// GRU cell with attentional update gate. Differs from the vanilla GRU
+    /// in that the update gate is scaled by the attention score of the
+    /// iteration: \f$\tilde{u}_t = (1 - a_t) * u_t\f$
+    vanilla_augru = dnnl_vanilla_augru,
     /// Binary add
     binary_add = dnnl_binary_add,
     /// Binary mul
@@ -597,6 +698,10 @@ enum class algorithm {
     reduction_norm_lp_power_p_max = dnnl_reduction_norm_lp_power_p_max,
     /// Reduction using norm_lp_power_p_sum operation
     reduction_norm_lp_power_p_sum = dnnl_reduction_norm_lp_power_p_sum,
+    /// Stochastic gradient descent, optionally with momentum
+    optimizer_sgd = dnnl_optimizer_sgd,
+    /// Adam with decoupled weight decay (AdamW)
+    optimizer_adam = dnnl_optimizer_adam,
 };
 
 /// Converts algorithm kind enum value from C++ API to C API type.
@@ -639,7 +744,14 @@ enum class normalization_flags : unsigned {
     /// the workspace to implement backward propagation. On inference, the
     /// workspace is not required and behavior is the same as when normalization
     /// is fused with ReLU using the post-ops API.
-    fuse_norm_relu = dnnl_fuse_norm_relu
+    fuse_norm_relu = dnnl_fuse_norm_relu,
+
+    /// Fuse normalization with a residual addition. Supported by layer
+    /// normalization on forward propagation only. If specified, the library
+    /// normalizes the sum of the #DNNL_ARG_SRC and #DNNL_ARG_SRC_1 inputs
+    /// and, if the #DNNL_ARG_DST_1 argument is passed, also writes the sum
+    /// to it.
+    fuse_residual_add = dnnl_fuse_residual_add
 };
 
 /// Converts normalization flags enum value from C++ API to C API type.
@@ -657,7 +769,13 @@ inline dnnl_normalization_flags_t convert_to_c(normalization_flags flags) {
 /// RNN cell flags.
 enum class rnn_flags : unsigned {
     /// Undefined RNN flags
-    undef = dnnl_rnn_flags_undef
+    undef = dnnl_rnn_flags_undef,
+    /// Variable sequence lengths passed at execution time as
+    /// #DNNL_ARG_SEQ_LENGTHS
+    seq_lengths = dnnl_rnn_flags_seq_lengths,
+    /// Gates recomputed during the backward propagation instead of being
+    /// kept in the workspace
+    recompute_gates = dnnl_rnn_flags_recompute_gates,
 };
 
 /// Converts RNN cell flags enum value from C++ API to C API type.
@@ -779,6 +897,11 @@ enum class query {
     /// propagation kind
     prop_kind = dnnl_query_prop_kind,
 
+    /// estimated number of operations of an execution, 0 if not estimated
+    flops_f64 = dnnl_query_flops_f64,
+    /// size of all the inputs and outputs memory (bytes)
+    bytes_moved_s64 = dnnl_query_bytes_moved_s64,
+
     /// operation descriptor
     op_d = dnnl_query_op_d,
     /// convolution descriptor
@@ -813,6 +936,12 @@ enum class query {
     resampling_d = dnnl_query_resampling_d,
     /// reduction descriptor
     reduction_d = dnnl_query_reduction_d,
+    /// embedding bag descriptor
+    embedding_bag_d = dnnl_query_embedding_bag_d,
+    /// group normalization descriptor
+    group_normalization_d = dnnl_query_group_normalization_d,
+    /// optimizer descriptor
+    optimizer_d = dnnl_query_optimizer_d,
 
     /// source memory desc
     src_md = dnnl_query_src_md,
@@ -993,6 +1122,19 @@ struct stream : public handle<dnnl_stream_t> {
         out_of_order = dnnl_stream_out_of_order,
         /// Default stream configuration.
         default_flags = dnnl_stream_default_flags,
+        /// Collects the device time of the kernels executed on the stream.
+        profiling = dnnl_stream_profiling,
+    };
+
+    /// Kinds of the profiling data collected by a stream.
+    enum class profiling_data_kind {
+        /// Undefined profiling data kind.
+        undef = dnnl_profiling_data_kind_undef,
+        /// Device execution time of a primitive in nanoseconds.
+        time = dnnl_profiling_data_kind_time,
+        /// Queueing, submission and inter-kernel overhead of a primitive
+        /// execution in nanoseconds.
+        overhead_time = dnnl_profiling_data_kind_overhead_time,
     };
 
     /// Constructs an empty stream. An empty stream cannot be used in any
@@ -1027,6 +1169,127 @@ struct stream : public handle<dnnl_stream_t> {
                 dnnl_stream_wait(get()), "could not wait on a stream");
         return *this;
     }
+
+    /// Attaches a scratchpad memory shared by all primitives created with
+    /// #dnnl::scratchpad_mode::user and executed on the stream without an
+    /// explicit #DNNL_ARG_SCRATCHPAD argument.
+    ///
+    /// @sa dnnl_stream_set_scratchpad
+    ///
+    /// @param scratchpad Scratchpad memory. The memory must be at least as big
+    ///     as the largest scratchpad required by the primitives.
+    /// @returns The stream itself.
+    stream &set_scratchpad(const memory &scratchpad);
+
+    /// Detaches a previously attached scratchpad memory.
+    /// @returns The stream itself.
+    stream &reset_scratchpad() {
+        error::wrap_c_api(dnnl_stream_set_scratchpad(get(), nullptr),
+                "could not reset a stream scratchpad");
+        return *this;
+    }
+
+    /// Resets the collected profiling data.
+    ///
+    /// @sa dnnl_stream_reset_profiling
+    ///
+    /// @returns The stream itself.
+    stream &reset_profiling() {
+        error::wrap_c_api(dnnl_stream_reset_profiling(get()),
+                "could not reset stream profiling data");
+        return *this;
+    }
+
+    /// Returns the profiling data collected since the stream creation or the
+    /// last reset_profiling() call, one entry per primitive execution.
+    ///
+    /// @sa dnnl_stream_get_profiling_data
+    ///
+    /// @param data_kind Profiling data kind.
+    /// @returns The profiling data.
+    std::vector<uint64_t> get_profiling_data(
+            profiling_data_kind data_kind) const {
+        const auto c_kind
+                = static_cast<dnnl_profiling_data_kind_t>(data_kind);
+        int num_entries = 0;
+        error::wrap_c_api(dnnl_stream_get_profiling_data(
+                                  get(), c_kind, &num_entries, nullptr),
+                "could not get the number of profiling data entries");
+        std::vector<uint64_t> data(num_entries);
+        if (num_entries == 0) return data;
+        error::wrap_c_api(dnnl_stream_get_profiling_data(
+                                  get(), c_kind, &num_entries, data.data()),
+                "could not get profiling data");
+        return data;
+    }
+
+    /// Restricts the threads executing the primitives to the given logical
+    /// CPUs, one thread per CPU.
+    ///
+    /// @sa dnnl_stream_set_cpu_affinity
+    ///
+    /// @param cpus Logical CPU indices, empty to remove the restriction.
+    /// @returns The stream itself.
+    stream &set_cpu_affinity(const std::vector<int> &cpus) {
+        error::wrap_c_api(dnnl_stream_set_cpu_affinity(
+                                  get(), (int)cpus.size(), cpus.data()),
+                "could not set a stream cpu affinity");
+        return *this;
+    }
+
+    /// Starts recording the device commands of the executed primitives.
+    ///
+    /// @sa dnnl_stream_begin_capture
+    ///
+    /// @returns The stream itself.
+    stream &begin_capture() {
+        error::wrap_c_api(dnnl_stream_begin_capture(get()),
+                "could not begin a stream capture");
+        return *this;
+    }
+
+    /// Stops recording the device commands of the executed primitives.
+    ///
+    /// @sa dnnl_stream_end_capture
+    ///
+    /// @returns The stream itself.
+    stream &end_capture() {
+        error::wrap_c_api(dnnl_stream_end_capture(get()),
+                "could not end a stream capture");
+        return *this;
+    }
+
+    /// Enqueues the recorded device commands again.
+    ///
+    /// @sa dnnl_stream_replay
+    ///
+    /// @returns The stream itself.
+    stream &replay() {
+        error::wrap_c_api(
+                dnnl_stream_replay(get()), "could not replay a stream capture");
+        return *this;
+    }
+
+    /// Starts a group of independent primitive executions.
+    ///
+    /// @sa dnnl_stream_fork
+    ///
+    /// @returns The stream itself.
+    stream &fork() {
+        error::wrap_c_api(dnnl_stream_fork(get()), "could not fork a stream");
+        return *this;
+    }
+
+    /// Executes the independent primitive executions submitted since the
+    /// fork() call and waits for their completion.
+    ///
+    /// @sa dnnl_stream_join
+    ///
+    /// @returns The stream itself.
+    stream &join() {
+        error::wrap_c_api(dnnl_stream_join(get()), "could not join a stream");
+        return *this;
+    }
 };
 
 DNNL_DEFINE_BITMASK_OPS(stream::flags)
@@ -1160,6 +1423,9 @@ struct memory : public handle<dnnl_memory_t> {
         wino = dnnl_format_kind_wino,
         /// Packed weights format used in RNN.
         packed = dnnl_format_kind_rnn_packed,
+        /// A two-dimensional tensor in the block compressed sparse row
+        /// format. See @ref dnnl_sparse_desc_t for more information.
+        sparse = dnnl_format_kind_sparse,
     };
 
     /// Memory format tag specification.
@@ -1610,6 +1876,13 @@ struct memory : public handle<dnnl_memory_t> {
         abdEc32e = dnnl_abdEc32e,
         abdEC32e2c = dnnl_abdEC32e2c,
         abdEC32e4c = dnnl_abdEC32e4c,
+        BA16a64b = dnnl_BA16a64b,
+        BA8a64b2a = dnnl_BA8a64b2a,
+        BA4a64b4a = dnnl_BA4a64b4a,
+        aCB16b64c = dnnl_aCB16b64c,
+        aCB8b64c2b = dnnl_aCB8b64c2b,
+        aCB4b64c4b = dnnl_aCB4b64c4b,
+        ABcde16b16a2b = dnnl_ABcde16b16a2b,
 
         format_tag_last = dnnl_format_tag_last,
 
@@ -1710,6 +1983,7 @@ struct memory : public handle<dnnl_memory_t> {
         OIdhw8i64o2i = dnnl_OIdhw8i64o2i,
         OIdhw4i16o4i = dnnl_OIdhw4i16o4i,
         OIdhw16i16o4i = dnnl_OIdhw16i16o4i,
+        OIdhw16i16o2i = dnnl_OIdhw16i16o2i,
         OIdhw4i32o4i = dnnl_OIdhw4i32o4i,
         OIdhw4i64o4i = dnnl_OIdhw4i64o4i,
         OIdhw2i8o4i = dnnl_OIdhw2i8o4i,
@@ -1877,6 +2151,35 @@ struct memory : public handle<dnnl_memory_t> {
         /// @param data A C API ::dnnl_memory_desc_t structure.
         desc(const dnnl_memory_desc_t &data) : data(data) {}
 
+        /// Constructs a memory descriptor of a two-dimensional tensor in the
+        /// block compressed sparse row format.
+        ///
+        /// @param adims Tensor dimensions.
+        /// @param adata_type Data precision/type.
+        /// @param block_dims Block dimensions.
+        /// @param nnz_blocks Number of blocks the memory can hold, which is
+        ///     the maximum number of non-zero blocks of the tensor.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case a
+        ///     zero memory descriptor will be returned. This flag is optional
+        ///     and defaults to false.
+        /// @returns A memory descriptor in the sparse format.
+        static desc sparse_blocks(const dims &adims, data_type adata_type,
+                const dims &block_dims, dim nnz_blocks,
+                bool allow_empty = false) {
+            validate_dims(adims);
+            validate_dims(block_dims, (int)adims.size());
+            dnnl_memory_desc_t md = dnnl_memory_desc_t();
+            dnnl_status_t status = dnnl_memory_desc_init_by_sparse_blocks(&md,
+                    (int)adims.size(), adims.data(), convert_to_c(adata_type),
+                    block_dims.data(), nnz_blocks);
+            if (!allow_empty)
+                error::wrap_c_api(status,
+                        "could not construct a memory descriptor in the "
+                        "sparse format");
+            return desc(md);
+        }
+
         /// Constructs a memory descriptor for a region inside an area
         /// described by this memory descriptor.
         //
@@ -2594,6 +2897,41 @@ struct post_ops : public handle<dnnl_post_ops_t> {
         aalgorithm = static_cast<dnnl::algorithm>(c_alg);
         src1_desc.data = *data;
     }
+
+    /// Appends a pooling post-op with a 2x2 window, stride 2 and no padding.
+    ///
+    /// The kind of this post operation is #dnnl_pooling.
+    ///
+    /// The post-op reduces the spatial dimensions of the destination of the
+    /// preceding computations:
+    ///
+    ///     dst[n, c, oh, ow] <- pool_op (dst[n, c, 2*oh:2*oh+2, 2*ow:2*ow+2])
+    ///
+    /// The post-op is supported by convolution only and must be the last
+    /// one in the chain. The destination of the primitive has the spatial
+    /// dimensions of the convolution destination divided by 2 and rounded
+    /// down, and it can be queried from the primitive descriptor.
+    ///
+    /// @param aalgorithm Pooling algorithm kind: #dnnl::algorithm::pooling_max
+    ///     or one of the averaging algorithms, which are equivalent as the
+    ///     window never overlaps padding.
+    void append_pooling_k2s2(algorithm aalgorithm) {
+        error::wrap_c_api(dnnl_post_ops_append_pooling_k2s2(
+                                  get(), convert_to_c(aalgorithm)),
+                "could not append a pooling post-op");
+    }
+
+    /// Returns the parameters of a pooling post-op.
+    ///
+    /// @param index Index of the pooling post-op.
+    /// @param aalgorithm Output pooling algorithm kind.
+    void get_params_pooling_k2s2(int index, algorithm &aalgorithm) const {
+        dnnl_alg_kind_t c_alg;
+        error::wrap_c_api(
+                dnnl_post_ops_get_params_pooling_k2s2(get(), index, &c_alg),
+                "could not get parameters of a pooling post-op");
+        aalgorithm = static_cast<dnnl::algorithm>(c_alg);
+    }
 };
 
 /// @cond DO_NOT_DOCUMENT_THIS
@@ -2645,6 +2983,23 @@ struct primitive_attr : public handle<dnnl_primitive_attr_t> {
                 "could not set scratchpad mode primitive attribute");
     }
 
+    /// Returns the fpmath mode.
+    fpmath_mode get_fpmath_mode() const {
+        dnnl_fpmath_mode_t result;
+        error::wrap_c_api(dnnl_primitive_attr_get_fpmath_mode(get(), &result),
+                "could not get fpmath mode primitive attribute");
+        return fpmath_mode(result);
+    }
+
+    /// Sets fpmath mode.
+    ///
+    /// @param mode Specified fpmath mode.
+    void set_fpmath_mode(fpmath_mode mode) {
+        error::wrap_c_api(dnnl_primitive_attr_set_fpmath_mode(
+                                  get(), dnnl::convert_to_c(mode)),
+                "could not set fpmath mode primitive attribute");
+    }
+
     /// Returns output scaling factors correspondence mask and values.
     ///
     /// @param mask Scaling factors correspondence mask that defines the
@@ -2843,6 +3198,77 @@ struct primitive_attr : public handle<dnnl_primitive_attr_t> {
                 "could not set post-ops primitive attribute");
     }
 
+    /// Returns the channels of the sources that are read as a single source
+    /// concatenated along the channels dimension.
+    ///
+    /// @param channels Output vector of the channels of the sources. Empty if
+    ///     the source is not split.
+    void get_src_concat(std::vector<memory::dim> &channels) const {
+        int nsrcs;
+        const dnnl_dim_t *c_channels;
+        error::wrap_c_api(dnnl_primitive_attr_get_src_concat(
+                                  get(), &nsrcs, &c_channels),
+                "could not get src concat primitive attribute");
+        channels.assign(c_channels, c_channels + nsrcs);
+    }
+
+    /// Sets the source to be read from several memory objects that are
+    /// logically concatenated along the channels dimension, so that the
+    /// concatenation is never materialized.
+    ///
+    /// The source memory descriptor of the primitive describes the
+    /// concatenated tensor. Source `i` has the same format with
+    /// `channels[i]` channels and is passed at execution time as an argument
+    /// with index (#DNNL_ARG_MULTIPLE_SRC + `i`) instead of #DNNL_ARG_SRC.
+    ///
+    /// @note
+    ///     Only the forward convolution supports this attribute.
+    ///
+    /// @param channels Channels of the sources. They must add up to the
+    ///     channels of the source. An empty vector resets the attribute.
+    void set_src_concat(const std::vector<memory::dim> &channels) {
+        error::wrap_c_api(dnnl_primitive_attr_set_src_concat(get(),
+                                  (int)channels.size(), channels.data()),
+                "could not set src concat primitive attribute");
+    }
+
+    /// Returns the dropout primitive attribute.
+    ///
+    /// @param enabled Output flag, true if the dropout is applied.
+    /// @param with_mask Output flag, true if the mask of the kept elements
+    ///     is stored.
+    void get_dropout(bool &enabled, bool &with_mask) const {
+        int c_enabled, c_with_mask;
+        error::wrap_c_api(dnnl_primitive_attr_get_dropout(
+                                  get(), &c_enabled, &c_with_mask),
+                "could not get dropout primitive attribute");
+        enabled = c_enabled;
+        with_mask = c_with_mask;
+    }
+
+    /// Sets the dropout primitive attribute.
+    ///
+    /// Each element of the destination is zeroed with the probability
+    /// passed as #DNNL_ARG_ATTR_DROPOUT_PROBABILITY at execution time, and
+    /// the kept elements are scaled by 1 / (1 - probability). The elements
+    /// to drop are chosen by a hash of their offset and of the seed passed
+    /// as #DNNL_ARG_ATTR_DROPOUT_SEED, so the same seed drops the same
+    /// elements.
+    ///
+    /// @note
+    ///     Only the eltwise and the binary primitives support this
+    ///     attribute.
+    ///
+    /// @param enabled True to apply the dropout, false to reset the
+    ///     attribute.
+    /// @param with_mask True to store a bitmask of the kept elements to the
+    ///     #DNNL_ARG_ATTR_DROPOUT_MASK argument. Forward propagation only.
+    void set_dropout(bool enabled, bool with_mask = false) {
+        error::wrap_c_api(
+                dnnl_primitive_attr_set_dropout(get(), enabled, with_mask),
+                "could not set dropout primitive attribute");
+    }
+
     /// Sets quantization scale and shift parameters for RNN data tensors.
     ///
     /// For performance reasons, the low-precision configuration of the RNN
@@ -3078,6 +3504,16 @@ struct primitive_desc_base : public handle<dnnl_primitive_desc_t> {
         return status == dnnl_success ? res : 0;
     }
 
+    /// Returns a double value.
+    /// @param what The value to query.
+    /// @returns The result of the query.
+    double query_f64(query what) const {
+        double res;
+        dnnl_status_t status = dnnl_primitive_desc_query(
+                get(), dnnl::convert_to_c(what), 0, &res);
+        return status == dnnl_success ? res : 0;
+    }
+
     /// Returns a memory descriptor.
     ///
     /// @note
@@ -3357,6 +3793,42 @@ protected:
     using base = primitive_desc_base;
 };
 
+/// Execution arguments bound to a primitive in advance.
+///
+/// Executing a primitive with bound arguments skips the conversion and the
+/// validation of the arguments map on every call, which is noticeable for
+/// small primitives executed over and over. The memory objects are kept
+/// alive by the bound arguments, and their data handles may be changed
+/// between executions with memory::set_data_handle().
+struct bound_args : public handle<dnnl_bound_args_t> {
+    using handle::handle;
+
+    /// Default constructor. Produces an empty object.
+    bound_args() = default;
+
+    /// Binds execution arguments to a primitive.
+    ///
+    /// @param aprimitive Primitive to bind the arguments to.
+    /// @param args Arguments map, the same as for primitive::execute().
+    bound_args(const primitive &aprimitive,
+            const std::unordered_map<int, memory> &args)
+        : args_(args) {
+        std::vector<dnnl_exec_arg_t> c_args;
+        c_args.reserve(args.size());
+        for (const auto &a : args)
+            c_args.push_back({a.first, a.second.get(true)});
+
+        dnnl_bound_args_t result;
+        error::wrap_c_api(dnnl_bound_args_create(&result, aprimitive.get(),
+                                  (int)c_args.size(), c_args.data()),
+                "could not bind execution arguments");
+        reset(result);
+    }
+
+private:
+    std::unordered_map<int, memory> args_;
+};
+
 /// @} dnnl_api_primitives_common
 
 /// @addtogroup dnnl_api_reorder Reorder
@@ -8820,29 +9292,31 @@ struct gru_forward : public primitive {
     gru_forward(const primitive_desc &pd) : primitive(pd) {}
 };
 
-/// GRU backward propagation primitive.
-struct gru_backward : public primitive {
-    /// Descriptor for a GRU backward propagation primitive.
+/// AUGRU forward propagation primitive.
+struct augru_forward : public primitive {
+    /// Descriptor for an AUGRU forward propagation primitive.
     struct desc {
         dnnl_rnn_desc_t data;
 
-        /// Constructs a descriptor for a GRU backward propagation primitive.
+        /// Constructs a descriptor for an AUGRU forward propagation primitive.
         ///
         /// The following arguments may point to a zero memory descriptor:
-        /// - @p src_iter_desc together with @p diff_src_iter_desc,
-        /// - @p bias_desc together with @p diff_bias_desc,
-        /// - @p dst_iter_desc together with @p diff_dst_iter_desc.
+        /// - @p src_iter_desc,
+        /// - @p bias_desc,
+        /// - @p dst_iter_desc.
         ///
-        /// This would then indicate that the GRU backward propagation
+        /// This would then indicate that the AUGRU forward propagation
         /// primitive should not use them and should default to zero values
         /// instead.
         ///
         /// @note
-        ///     All memory descriptors may be initialized with
-        ///     #dnnl::memory::format_tag::any value of @p format_tag.
+        ///     All memory descriptors except @p src_iter_desc may be
+        ///     initialized with an #dnnl::memory::format_tag::any value of @p
+        ///     format_tag.
         ///
-        /// @param aprop_kind Propagation kind. Must be
-        ///     #dnnl::prop_kind::backward.
+        /// @param aprop_kind Propagation kind. Possible values are
+        ///     #dnnl::prop_kind::forward_training, and
+        ///     #dnnl::prop_kind::forward_inference.
         /// @param direction RNN direction. See @ref dnnl::rnn_direction for
         ///     more info.
         /// @param src_layer_desc Memory descriptor for the input vector.
@@ -8856,20 +9330,10 @@ struct gru_backward : public primitive {
         /// @param dst_layer_desc Memory descriptor for the output vector.
         /// @param dst_iter_desc Memory descriptor for the output recurrent
         ///     hidden state vector.
-        /// @param diff_src_layer_desc Memory descriptor for the diff of input
-        ///     vector.
-        /// @param diff_src_iter_desc Memory descriptor for the diff of input
-        ///     recurrent hidden state vector.
-        /// @param diff_weights_layer_desc Memory descriptor for the diff of
-        ///     weights applied to the layer input.
-        /// @param diff_weights_iter_desc Memory descriptor for the diff of
-        ///     weights applied to the recurrent input.
-        /// @param diff_bias_desc Diff bias memory descriptor.
-        /// @param diff_dst_layer_desc Memory descriptor for the diff of
-        ///     output vector.
-        /// @param diff_dst_iter_desc Memory descriptor for the diff of output
-        ///     recurrent hidden state vector.
         /// @param flags Unused.
+        ///
+        /// The attention vector is passed at execution time as
+        /// #DNNL_ARG_AUGRU_ATTENTION.
         desc(prop_kind aprop_kind, rnn_direction direction,
                 const memory::desc &src_layer_desc,
                 const memory::desc &src_iter_desc,
@@ -8878,83 +9342,64 @@ struct gru_backward : public primitive {
                 const memory::desc &bias_desc,
                 const memory::desc &dst_layer_desc,
                 const memory::desc &dst_iter_desc,
-                const memory::desc &diff_src_layer_desc,
-                const memory::desc &diff_src_iter_desc,
-                const memory::desc &diff_weights_layer_desc,
-                const memory::desc &diff_weights_iter_desc,
-                const memory::desc &diff_bias_desc,
-                const memory::desc &diff_dst_layer_desc,
-                const memory::desc &diff_dst_iter_desc,
                 rnn_flags flags = rnn_flags::undef) {
             error::wrap_c_api(
-                    dnnl_gru_backward_desc_init(&data,
+                    dnnl_augru_forward_desc_init(&data,
                             dnnl::convert_to_c(aprop_kind),
                             dnnl::convert_to_c(direction), &src_layer_desc.data,
                             &src_iter_desc.data, &weights_layer_desc.data,
                             &weights_iter_desc.data, &bias_desc.data,
                             &dst_layer_desc.data, &dst_iter_desc.data,
-                            &diff_src_layer_desc.data, &diff_src_iter_desc.data,
-                            &diff_weights_layer_desc.data,
-                            &diff_weights_iter_desc.data, &diff_bias_desc.data,
-                            &diff_dst_layer_desc.data, &diff_dst_iter_desc.data,
                             dnnl::convert_to_c(flags)),
-                    "could not create a descriptor for a GRU backward "
+                    "could not create a descriptor for an AUGRU forward "
                     "propagation primitive");
         }
     };
 
-    /// Primitive descriptor for a GRU backward propagation primitive.
+    /// Primitive descriptor for an AUGRU forward propagation primitive.
     struct primitive_desc : public rnn_primitive_desc_base {
         /// Default constructor. Produces an empty object.
         primitive_desc() = default;
 
-        /// Constructs a primitive descriptor for a GRU backward propagation
+        /// Constructs a primitive descriptor for an AUGRU forward propagation
         /// primitive.
         ///
-        /// @param adesc Descriptor for a GRU backward propagation primitive.
+        /// @param adesc Descriptor for an AUGRU forward propagation primitive.
         /// @param aengine Engine to use.
-        /// @param hint_fwd_pd Primitive descriptor for a GRU
-        ///     forward propagation primitive. It is used as a hint for
-        ///     deciding which memory format to use.
         /// @param allow_empty A flag signifying whether construction is
         ///     allowed to fail without throwing an exception. In this case an
         ///     empty object will be produced. This flag is optional and
         ///     defaults to false.
         primitive_desc(const desc &adesc, const engine &aengine,
-                const gru_forward::primitive_desc &hint_fwd_pd,
                 bool allow_empty = false)
-            : rnn_primitive_desc_base(&adesc.data, nullptr, aengine,
-                    hint_fwd_pd.get(), allow_empty) {}
+            : rnn_primitive_desc_base(
+                    &adesc.data, nullptr, aengine, nullptr, allow_empty) {}
 
-        /// Constructs a primitive descriptor for a GRU backward propagation
+        /// Constructs a primitive descriptor for an AUGRU forward propagation
         /// primitive.
         ///
-        /// @param adesc Descriptor for a GRU backward propagation primitive.
+        /// @param adesc Descriptor for an AUGRU forward propagation primitive.
         /// @param attr Primitive attributes to use.
         /// @param aengine Engine to use.
-        /// @param hint_fwd_pd Primitive descriptor for a GRU
-        ///     forward propagation primitive. It is used as a hint for
-        ///     deciding which memory format to use.
         /// @param allow_empty A flag signifying whether construction is
         ///     allowed to fail without throwing an exception. In this case an
         ///     empty object will be produced. This flag is optional and
         ///     defaults to false.
         primitive_desc(const desc &adesc, const primitive_attr &attr,
-                const engine &aengine,
-                const gru_forward::primitive_desc &hint_fwd_pd,
-                bool allow_empty = false)
-            : rnn_primitive_desc_base(&adesc.data, &attr, aengine,
-                    hint_fwd_pd.get(), allow_empty) {}
+                const engine &aengine, bool allow_empty = false)
+            : rnn_primitive_desc_base(
+                    &adesc.data, &attr, aengine, nullptr, allow_empty) {}
 
-        /// Constructs a primitive descriptor for a GRU backward propagation
+        /// Constructs a primitive descriptor for an AUGRU forward propagation
         /// primitive from a C API primitive descriptor that must have a
         /// matching kind.
         ///
-        /// @param pd C API primitive descriptor for a GRU backward
+        /// @param pd C API primitive descriptor for an AUGRU forward
         ///     propagation primitive.
         primitive_desc(dnnl_primitive_desc_t pd)
-            : rnn_primitive_desc_base(pd, dnnl::prop_kind::backward,
-                    dnnl::algorithm::vanilla_gru) {}
+            : rnn_primitive_desc_base(pd, dnnl::prop_kind::forward_training,
+                    dnnl::prop_kind::forward_inference,
+                    dnnl::algorithm::vanilla_augru) {}
 
         /// @copydoc dnnl::rnn_primitive_desc_base::src_layer_desc()const
         memory::desc src_layer_desc() const {
@@ -8990,29 +9435,216 @@ struct gru_backward : public primitive {
             return rnn_base::workspace_desc();
         }
 
-        /// @copydoc dnnl::rnn_primitive_desc_base::diff_src_layer_desc()const
-        memory::desc diff_src_layer_desc() const {
-            return rnn_base::diff_src_layer_desc();
+        /// Returns the attention memory descriptor.
+        /// @returns Attention memory descriptor.
+        memory::desc attention_desc() const {
+            return base::query_md(
+                    query::exec_arg_md, DNNL_ARG_AUGRU_ATTENTION);
         }
+    };
 
-        /// @copydoc dnnl::rnn_primitive_desc_base::diff_src_iter_desc()const
-        memory::desc diff_src_iter_desc() const {
-            return rnn_base::diff_src_iter_desc();
-        }
+    /// Default constructor. Produces an empty object.
+    augru_forward() = default;
 
-        /// @copydoc dnnl::rnn_primitive_desc_base::diff_weights_layer_desc()const
-        memory::desc diff_weights_layer_desc() const {
-            return rnn_base::diff_weights_layer_desc();
-        }
+    /// Constructs an AUGRU forward propagation primitive.
+    /// @param pd Primitive descriptor for an AUGRU forward propagation
+    ///     primitive.
+    augru_forward(const primitive_desc &pd) : primitive(pd) {}
+};
 
-        /// @copydoc dnnl::rnn_primitive_desc_base::diff_weights_iter_desc()const
-        memory::desc diff_weights_iter_desc() const {
-            return rnn_base::diff_weights_iter_desc();
-        }
+/// GRU backward propagation primitive.
+struct gru_backward : public primitive {
+    /// Descriptor for a GRU backward propagation primitive.
+    struct desc {
+        dnnl_rnn_desc_t data;
 
-        /// @copydoc dnnl::rnn_primitive_desc_base::diff_bias_desc()const
-        memory::desc diff_bias_desc() const {
-            return rnn_base::diff_bias_desc();
+        /// Constructs a descriptor for a GRU backward propagation primitive.
+        ///
+        /// The following arguments may point to a zero memory descriptor:
+        /// - @p src_iter_desc together with @p diff_src_iter_desc,
+        /// - @p bias_desc together with @p diff_bias_desc,
+        /// - @p dst_iter_desc together with @p diff_dst_iter_desc.
+        ///
+        /// This would then indicate that the GRU backward propagation
+        /// primitive should not use them and should default to zero values
+        /// instead.
+        ///
+        /// @note
+        ///     All memory descriptors may be initialized with
+        ///     #dnnl::memory::format_tag::any value of @p format_tag.
+        ///
+        /// @param aprop_kind Propagation kind. Must be
+        ///     #dnnl::prop_kind::backward.
+        /// @param direction RNN direction. See @ref dnnl::rnn_direction for
+        ///     more info.
+        /// @param src_layer_desc Memory descriptor for the input vector.
+        /// @param src_iter_desc Memory descriptor for the input recurrent
+        ///     hidden state vector.
+        /// @param weights_layer_desc Memory descriptor for the weights
+        ///     applied to the layer input.
+        /// @param weights_iter_desc Memory descriptor for the weights applied
+        ///     to the recurrent input.
+        /// @param bias_desc Bias memory descriptor.
+        /// @param dst_layer_desc Memory descriptor for the output vector.
+        /// @param dst_iter_desc Memory descriptor for the output recurrent
+        ///     hidden state vector.
+        /// @param diff_src_layer_desc Memory descriptor for the diff of input
+        ///     vector.
+        /// @param diff_src_iter_desc Memory descriptor for the diff of input
+        ///     recurrent hidden state vector.
+        /// @param diff_weights_layer_desc Memory descriptor for the diff of
+        ///     weights applied to the layer input.
+        /// @param diff_weights_iter_desc Memory descriptor for the diff of
+        ///     weights applied to the recurrent input.
+        /// @param diff_bias_desc Diff bias memory descriptor.
+        /// @param diff_dst_layer_desc Memory descriptor for the diff of
+        ///     output vector.
+        /// @param diff_dst_iter_desc Memory descriptor for the diff of output
+        ///     recurrent hidden state vector.
+        /// @param flags Unused.
+        desc(prop_kind aprop_kind, rnn_direction direction,
+                const memory::desc &src_layer_desc,
+                const memory::desc &src_iter_desc,
+                const memory::desc &weights_layer_desc,
+                const memory::desc &weights_iter_desc,
+                const memory::desc &bias_desc,
+                const memory::desc &dst_layer_desc,
+                const memory::desc &dst_iter_desc,
+                const memory::desc &diff_src_layer_desc,
+                const memory::desc &diff_src_iter_desc,
+                const memory::desc &diff_weights_layer_desc,
+                const memory::desc &diff_weights_iter_desc,
+                const memory::desc &diff_bias_desc,
+                const memory::desc &diff_dst_layer_desc,
+                const memory::desc &diff_dst_iter_desc,
+                rnn_flags flags = rnn_flags::undef) {
+            error::wrap_c_api(
+                    dnnl_gru_backward_desc_init(&data,
+                            dnnl::convert_to_c(aprop_kind),
+                            dnnl::convert_to_c(direction), &src_layer_desc.data,
+                            &src_iter_desc.data, &weights_layer_desc.data,
+                            &weights_iter_desc.data, &bias_desc.data,
+                            &dst_layer_desc.data, &dst_iter_desc.data,
+                            &diff_src_layer_desc.data, &diff_src_iter_desc.data,
+                            &diff_weights_layer_desc.data,
+                            &diff_weights_iter_desc.data, &diff_bias_desc.data,
+                            &diff_dst_layer_desc.data, &diff_dst_iter_desc.data,
+                            dnnl::convert_to_c(flags)),
+                    "could not create a descriptor for a GRU backward "
+                    "propagation primitive");
+        }
+    };
+
+    /// Primitive descriptor for a GRU backward propagation primitive.
+    struct primitive_desc : public rnn_primitive_desc_base {
+        /// Default constructor. Produces an empty object.
+        primitive_desc() = default;
+
+        /// Constructs a primitive descriptor for a GRU backward propagation
+        /// primitive.
+        ///
+        /// @param adesc Descriptor for a GRU backward propagation primitive.
+        /// @param aengine Engine to use.
+        /// @param hint_fwd_pd Primitive descriptor for a GRU
+        ///     forward propagation primitive. It is used as a hint for
+        ///     deciding which memory format to use.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case an
+        ///     empty object will be produced. This flag is optional and
+        ///     defaults to false.
+        primitive_desc(const desc &adesc, const engine &aengine,
+                const gru_forward::primitive_desc &hint_fwd_pd,
+                bool allow_empty = false)
+            : rnn_primitive_desc_base(&adesc.data, nullptr, aengine,
+                    hint_fwd_pd.get(), allow_empty) {}
+
+        /// Constructs a primitive descriptor for a GRU backward propagation
+        /// primitive.
+        ///
+        /// @param adesc Descriptor for a GRU backward propagation primitive.
+        /// @param attr Primitive attributes to use.
+        /// @param aengine Engine to use.
+        /// @param hint_fwd_pd Primitive descriptor for a GRU
+        ///     forward propagation primitive. It is used as a hint for
+        ///     deciding which memory format to use.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case an
+        ///     empty object will be produced. This flag is optional and
+        ///     defaults to false.
+        primitive_desc(const desc &adesc, const primitive_attr &attr,
+                const engine &aengine,
+                const gru_forward::primitive_desc &hint_fwd_pd,
+                bool allow_empty = false)
+            : rnn_primitive_desc_base(&adesc.data, &attr, aengine,
+                    hint_fwd_pd.get(), allow_empty) {}
+
+        /// Constructs a primitive descriptor for a GRU backward propagation
+        /// primitive from a C API primitive descriptor that must have a
+        /// matching kind.
+        ///
+        /// @param pd C API primitive descriptor for a GRU backward
+        ///     propagation primitive.
+        primitive_desc(dnnl_primitive_desc_t pd)
+            : rnn_primitive_desc_base(pd, dnnl::prop_kind::backward,
+                    dnnl::algorithm::vanilla_gru) {}
+
+        /// @copydoc dnnl::rnn_primitive_desc_base::src_layer_desc()const
+        memory::desc src_layer_desc() const {
+            return rnn_base::src_layer_desc();
+        }
+
+        /// @copydoc dnnl::rnn_primitive_desc_base::src_iter_desc()const
+        memory::desc src_iter_desc() const { return rnn_base::src_iter_desc(); }
+
+        /// @copydoc dnnl::rnn_primitive_desc_base::weights_layer_desc()const
+        memory::desc weights_layer_desc() const {
+            return rnn_base::weights_layer_desc();
+        }
+
+        /// @copydoc dnnl::rnn_primitive_desc_base::weights_iter_desc()const
+        memory::desc weights_iter_desc() const {
+            return rnn_base::weights_iter_desc();
+        }
+
+        /// @copydoc dnnl::rnn_primitive_desc_base::bias_desc()const
+        memory::desc bias_desc() const { return rnn_base::bias_desc(); }
+
+        /// @copydoc dnnl::rnn_primitive_desc_base::dst_layer_desc()const
+        memory::desc dst_layer_desc() const {
+            return rnn_base::dst_layer_desc();
+        }
+
+        /// @copydoc dnnl::rnn_primitive_desc_base::dst_iter_desc()const
+        memory::desc dst_iter_desc() const { return rnn_base::dst_iter_desc(); }
+
+        /// @copydoc dnnl::rnn_primitive_desc_base::workspace_desc()const
+        memory::desc workspace_desc() const {
+            return rnn_base::workspace_desc();
+        }
+
+        /// @copydoc dnnl::rnn_primitive_desc_base::diff_src_layer_desc()const
+        memory::desc diff_src_layer_desc() const {
+            return rnn_base::diff_src_layer_desc();
+        }
+
+        /// @copydoc dnnl::rnn_primitive_desc_base::diff_src_iter_desc()const
+        memory::desc diff_src_iter_desc() const {
+            return rnn_base::diff_src_iter_desc();
+        }
+
+        /// @copydoc dnnl::rnn_primitive_desc_base::diff_weights_layer_desc()const
+        memory::desc diff_weights_layer_desc() const {
+            return rnn_base::diff_weights_layer_desc();
+        }
+
+        /// @copydoc dnnl::rnn_primitive_desc_base::diff_weights_iter_desc()const
+        memory::desc diff_weights_iter_desc() const {
+            return rnn_base::diff_weights_iter_desc();
+        }
+
+        /// @copydoc dnnl::rnn_primitive_desc_base::diff_bias_desc()const
+        memory::desc diff_bias_desc() const {
+            return rnn_base::diff_bias_desc();
         }
 
         /// @copydoc dnnl::rnn_primitive_desc_base::diff_dst_layer_desc()const
@@ -10601,48 +11233,494 @@ struct reduction : public primitive {
 
 /// @} dnnl_api_reduction
 
-/// @} dnnl_api_primitives
-
-/// @addtogroup dnnl_api_service Service
+/// @addtogroup dnnl_api_embedding_bag Embedding bag
 ///
-/// A set of functions that aid in oneDNN debugging and profiling.
+/// A primitive to gather rows of a table and to pool them by bags using
+/// sum or mean operations.
+///
+/// @sa @ref dev_guide_embedding_bag in developer guide
 ///
 /// @{
 
-/// @copydoc dnnl_version_t
-using version_t = dnnl_version_t;
+/// Embedding bag forward propagation primitive.
+struct embedding_bag_forward : public primitive {
+    /// Descriptor for an embedding bag forward propagation primitive.
+    struct desc {
+        dnnl_embedding_bag_desc_t data;
 
-/// Status values returned by the library functions.
-enum class status {
-    /// @copydoc dnnl_success
-    success = dnnl_success,
-    /// @copydoc dnnl_out_of_memory
-    out_of_memory = dnnl_out_of_memory,
-    /// @copydoc dnnl_invalid_arguments
-    invalid_arguments = dnnl_invalid_arguments,
-    /// @copydoc dnnl_unimplemented
-    unimplemented = dnnl_unimplemented,
-    /// @copydoc dnnl_iterator_ends
-    iterator_ends = dnnl_iterator_ends,
-    /// @copydoc dnnl_runtime_error
-    runtime_error = dnnl_runtime_error,
-    /// @copydoc dnnl_not_required
-    not_required = dnnl_not_required,
-};
+        /// Default constructor. Produces an empty object.
+        desc() = default;
 
-/// @copydoc dnnl_set_verbose()
-inline status set_verbose(int level) {
-    return static_cast<status>(dnnl_set_verbose(level));
-}
+        /// Constructs a descriptor for an embedding bag forward propagation
+        /// primitive with a floating-point table.
+        ///
+        /// @note
+        ///     Destination memory descriptor may be initialized with
+        ///     #dnnl::memory::format_tag::any value of @p format_tag.
+        ///
+        /// @param aprop_kind Propagation kind. Possible values are
+        ///     #dnnl::prop_kind::forward_training, and
+        ///     #dnnl::prop_kind::forward_inference.
+        /// @param aalgorithm Bag pooling algorithm kind. Possible values:
+        ///     #dnnl::algorithm::reduction_sum and
+        ///     #dnnl::algorithm::reduction_mean.
+        /// @param indices_desc Indices memory descriptor.
+        /// @param offsets_desc Offsets memory descriptor.
+        /// @param table_desc Table memory descriptor.
+        /// @param dst_desc Destination memory descriptor.
+        desc(prop_kind aprop_kind, algorithm aalgorithm,
+                const memory::desc &indices_desc,
+                const memory::desc &offsets_desc,
+                const memory::desc &table_desc, const memory::desc &dst_desc) {
+            error::wrap_c_api(
+                    dnnl_embedding_bag_forward_desc_init(&data,
+                            dnnl::convert_to_c(aprop_kind),
+                            dnnl::convert_to_c(aalgorithm), &indices_desc.data,
+                            &offsets_desc.data, &table_desc.data, nullptr,
+                            &dst_desc.data),
+                    "could not create a descriptor for an embedding bag "
+                    "forward propagation primitive");
+        }
 
-/// @copydoc dnnl_version()
-inline const version_t *version() {
-    return dnnl_version();
-}
+        /// Constructs a descriptor for an embedding bag forward propagation
+        /// primitive with a quantized table.
+        ///
+        /// @note
+        ///     Destination memory descriptor may be initialized with
+        ///     #dnnl::memory::format_tag::any value of @p format_tag.
+        ///
+        /// @param aprop_kind Propagation kind. Possible values are
+        ///     #dnnl::prop_kind::forward_training, and
+        ///     #dnnl::prop_kind::forward_inference.
+        /// @param aalgorithm Bag pooling algorithm kind. Possible values:
+        ///     #dnnl::algorithm::reduction_sum and
+        ///     #dnnl::algorithm::reduction_mean.
+        /// @param indices_desc Indices memory descriptor.
+        /// @param offsets_desc Offsets memory descriptor.
+        /// @param table_desc Table memory descriptor.
+        /// @param scale_shift_desc Per-row scale and shift memory
+        ///     descriptor.
+        /// @param dst_desc Destination memory descriptor.
+        desc(prop_kind aprop_kind, algorithm aalgorithm,
+                const memory::desc &indices_desc,
+                const memory::desc &offsets_desc,
+                const memory::desc &table_desc,
+                const memory::desc &scale_shift_desc,
+                const memory::desc &dst_desc) {
+            error::wrap_c_api(
+                    dnnl_embedding_bag_forward_desc_init(&data,
+                            dnnl::convert_to_c(aprop_kind),
+                            dnnl::convert_to_c(aalgorithm), &indices_desc.data,
+                            &offsets_desc.data, &table_desc.data,
+                            &scale_shift_desc.data, &dst_desc.data),
+                    "could not create a descriptor for an embedding bag "
+                    "forward propagation primitive");
+        }
+    };
 
-/// @copydoc dnnl_set_jit_dump()
-inline status set_jit_dump(int enable) {
-    return static_cast<status>(dnnl_set_jit_dump(enable));
+    /// Primitive descriptor for an embedding bag forward propagation
+    /// primitive.
+    struct primitive_desc : public dnnl::primitive_desc {
+        /// Default constructor. Produces an empty object.
+        primitive_desc() = default;
+
+        /// Constructs a primitive descriptor for an embedding bag forward
+        /// propagation primitive.
+        ///
+        /// @param adesc Descriptor for an embedding bag forward propagation
+        ///     primitive.
+        /// @param aengine Engine to use.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case an
+        ///     empty object will be produced. This flag is optional and
+        ///     defaults to false.
+        primitive_desc(const desc &adesc, const engine &aengine,
+                bool allow_empty = false)
+            : dnnl::primitive_desc(
+                    &adesc.data, nullptr, aengine, nullptr, allow_empty) {}
+
+        /// Constructs a primitive descriptor for an embedding bag forward
+        /// propagation primitive.
+        ///
+        /// @param adesc Descriptor for an embedding bag forward propagation
+        ///     primitive.
+        /// @param aengine Engine to use.
+        /// @param attr Primitive attributes to use.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case an
+        ///     empty object will be produced. This flag is optional and
+        ///     defaults to false.
+        primitive_desc(const desc &adesc, const primitive_attr &attr,
+                const engine &aengine, bool allow_empty = false)
+            : dnnl::primitive_desc(
+                    &adesc.data, &attr, aengine, nullptr, allow_empty) {}
+
+        /// Constructs a primitive descriptor for an embedding bag forward
+        /// propagation primitive from a C API primitive descriptor that must
+        /// have a matching kind.
+        ///
+        /// @param pd C API primitive descriptor for an embedding bag forward
+        ///     propagation primitive.
+        primitive_desc(dnnl_primitive_desc_t pd)
+            : dnnl::primitive_desc(pd, dnnl::primitive::kind::embedding_bag,
+                    dnnl::prop_kind::forward_training,
+                    dnnl::prop_kind::forward_inference) {}
+
+        /// Returns an indices memory descriptor.
+        /// @returns Indices memory descriptor.
+        memory::desc indices_desc() const { return base::src_desc(0); }
+
+        /// Returns an offsets memory descriptor.
+        /// @returns Offsets memory descriptor.
+        memory::desc offsets_desc() const { return base::src_desc(1); }
+
+        /// Returns a table memory descriptor.
+        /// @returns Table memory descriptor.
+        memory::desc table_desc() const { return base::weights_desc(0); }
+
+        /// Returns a per-row scale and shift memory descriptor.
+        /// @returns Scale and shift memory descriptor, or a zero memory
+        ///     descriptor if the table is not quantized.
+        memory::desc scale_shift_desc() const { return base::weights_desc(1); }
+
+        /// @copydoc dnnl::primitive_desc_base::dst_desc()const
+        memory::desc dst_desc() const { return base::dst_desc(0); }
+    };
+
+    /// Default constructor. Produces an empty object.
+    embedding_bag_forward() = default;
+
+    /// Constructs an embedding bag forward propagation primitive.
+    /// @param pd Primitive descriptor for an embedding bag forward
+    ///     propagation primitive.
+    embedding_bag_forward(const primitive_desc &pd) : primitive(pd) {}
+};
+
+/// @} dnnl_api_embedding_bag
+
+/// @addtogroup dnnl_api_group_normalization Group Normalization
+///
+/// A primitive to perform group normalization. The channels are split into
+/// groups of consecutive channels, and every group of every image is
+/// normalized with its own mean and variance. The primitive can optionally
+/// scale and shift the result with gamma and beta parameters, and apply an
+/// eltwise post-op, e.g. SiLU (#dnnl::algorithm::eltwise_swish).
+///
+/// @sa @ref dev_guide_group_normalization in developer guide
+///
+/// @{
+
+/// Group normalization forward propagation primitive.
+struct group_normalization_forward : public primitive {
+    /// Descriptor for a group normalization forward propagation primitive.
+    struct desc {
+        dnnl_group_normalization_desc_t data;
+
+        /// Default constructor. Produces an empty object.
+        desc() = default;
+
+        /// Constructs a descriptor for group normalization forward
+        /// propagation primitive.
+        ///
+        /// @param aprop_kind Propagation kind. Possible values are
+        ///     #dnnl::prop_kind::forward_training, and
+        ///     #dnnl::prop_kind::forward_inference.
+        /// @param data_desc Source and destination memory descriptor.
+        /// @param groups Number of groups. Must divide the number of
+        ///     channels.
+        /// @param epsilon Group normalization epsilon parameter.
+        /// @param flags Group normalization flags (@ref
+        ///     dnnl::normalization_flags).
+        desc(prop_kind aprop_kind, const memory::desc &data_desc,
+                memory::dim groups, float epsilon, normalization_flags flags) {
+            error::wrap_c_api(
+                    dnnl_group_normalization_forward_desc_init(&data,
+                            dnnl::convert_to_c(aprop_kind), &data_desc.data,
+                            groups, epsilon, convert_to_c(flags)),
+                    "could not create a descriptor for a group normalization "
+                    "forward propagation primitive");
+        }
+    };
+
+    /// Primitive descriptor for a group normalization forward propagation
+    /// primitive.
+    struct primitive_desc : public dnnl::primitive_desc {
+        /// Default constructor. Produces an empty object.
+        primitive_desc() = default;
+
+        /// Constructs a primitive descriptor for a group normalization
+        /// forward propagation primitive.
+        ///
+        /// @param adesc Descriptor for a group normalization forward
+        ///     propagation primitive.
+        /// @param aengine Engine to use.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case an
+        ///     empty object will be produced. This flag is optional and
+        ///     defaults to false.
+        primitive_desc(const desc &adesc, const engine &aengine,
+                bool allow_empty = false)
+            : dnnl::primitive_desc(
+                    &adesc.data, nullptr, aengine, nullptr, allow_empty) {}
+
+        /// Constructs a primitive descriptor for a group normalization
+        /// forward propagation primitive.
+        ///
+        /// @param adesc Descriptor for a group normalization forward
+        ///     propagation primitive.
+        /// @param attr Primitive attributes to use.
+        /// @param aengine Engine to use.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case an
+        ///     empty object will be produced. This flag is optional and
+        ///     defaults to false.
+        primitive_desc(const desc &adesc, const primitive_attr &attr,
+                const engine &aengine, bool allow_empty = false)
+            : dnnl::primitive_desc(
+                    &adesc.data, &attr, aengine, nullptr, allow_empty) {}
+
+        /// Constructs a primitive descriptor for a group normalization
+        /// forward propagation primitive from a C API primitive descriptor
+        /// that must have a matching kind.
+        ///
+        /// @param pd C API primitive descriptor for a group normalization
+        ///     forward propagation primitive.
+        primitive_desc(dnnl_primitive_desc_t pd)
+            : dnnl::primitive_desc(pd,
+                    dnnl::primitive::kind::group_normalization,
+                    dnnl::prop_kind::forward_training,
+                    dnnl::prop_kind::forward_inference) {}
+
+        /// @copydoc dnnl::primitive_desc_base::src_desc()const
+        memory::desc src_desc() const { return base::src_desc(0); }
+
+        /// @copydoc dnnl::primitive_desc_base::dst_desc()const
+        memory::desc dst_desc() const { return base::dst_desc(0); }
+
+        /// @copydoc dnnl::primitive_desc_base::weights_desc()const
+        memory::desc weights_desc() const { return base::weights_desc(0); }
+
+        /// @copydoc dnnl::batch_normalization_forward::primitive_desc::mean_desc()const
+        memory::desc mean_desc() const { return stat_desc(mean); }
+
+        /// @copydoc dnnl::batch_normalization_forward::primitive_desc::variance_desc()const
+        memory::desc variance_desc() const { return stat_desc(var); }
+
+    private:
+        enum {
+            mean = 1,
+            var = 2,
+        };
+        memory::desc stat_desc(int kind) const {
+            dnnl_group_normalization_desc_t *p;
+            error::wrap_c_api(
+                    dnnl_primitive_desc_query(get(),
+                            dnnl::convert_to_c(query::group_normalization_d),
+                            0, &p),
+                    "could not retrieve a descriptor from a primitive "
+                    "descriptor for group normalization forward propagation "
+                    "primitive");
+            return query_md(p->flags & dnnl_use_global_stats ? query::src_md
+                                                             : query::dst_md,
+                    kind);
+        }
+    };
+
+    /// Default constructor. Produces an empty object.
+    group_normalization_forward() = default;
+
+    /// Constructs a group normalization forward propagation primitive.
+    /// @param pd Primitive descriptor for a group normalization forward
+    ///     propagation primitive.
+    group_normalization_forward(const primitive_desc &pd) : primitive(pd) {}
+};
+
+/// @} dnnl_api_group_normalization
+
+/// @addtogroup dnnl_api_optimizer Optimizer
+///
+/// A primitive to perform an optimizer step. The master weights and the
+/// optimizer states are updated in place, and an optional copy of the
+/// updated weights (e.g. in bf16) is written in the same pass over memory.
+///
+/// @sa @ref dev_guide_optimizer in developer guide
+///
+/// @{
+
+/// Optimizer step primitive.
+struct optimizer : public primitive {
+    /// Descriptor for an optimizer step primitive.
+    struct desc {
+        dnnl_optimizer_desc_t data;
+
+        /// Default constructor. Produces an empty object.
+        desc() = default;
+
+        /// Constructs a descriptor for an optimizer step primitive.
+        ///
+        /// @param aalgorithm Optimizer algorithm kind. Possible values:
+        ///     #dnnl::algorithm::optimizer_sgd and
+        ///     #dnnl::algorithm::optimizer_adam.
+        /// @param weights_desc Master weights memory descriptor. The
+        ///     optimizer states share this memory descriptor.
+        /// @param diff_weights_desc Gradients memory descriptor.
+        /// @param dst_desc Memory descriptor of the copy of the updated
+        ///     weights. May be a zero memory descriptor.
+        /// @param momentum Momentum for SGD, or the decay rate of the first
+        ///     moment for Adam.
+        /// @param beta2 Decay rate of the second moment for Adam.
+        /// @param epsilon Epsilon for Adam.
+        /// @param weight_decay Weight decay.
+        /// @param max_grad_norm Maximal L2 norm of the gradients of the
+        ///     tensor. Non-positive values disable the clipping.
+        desc(algorithm aalgorithm, const memory::desc &weights_desc,
+                const memory::desc &diff_weights_desc,
+                const memory::desc &dst_desc, float momentum, float beta2,
+                float epsilon, float weight_decay, float max_grad_norm = 0.f) {
+            error::wrap_c_api(
+                    dnnl_optimizer_desc_init(&data,
+                            dnnl::convert_to_c(aalgorithm), &weights_desc.data,
+                            &diff_weights_desc.data, &dst_desc.data, momentum,
+                            beta2, epsilon, weight_decay, max_grad_norm),
+                    "could not create a descriptor for an optimizer "
+                    "primitive");
+        }
+    };
+
+    /// Primitive descriptor for an optimizer step primitive.
+    struct primitive_desc : public dnnl::primitive_desc {
+        /// Default constructor. Produces an empty object.
+        primitive_desc() = default;
+
+        /// Constructs a primitive descriptor for an optimizer step
+        /// primitive.
+        ///
+        /// @param adesc Descriptor for an optimizer step primitive.
+        /// @param aengine Engine to use.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case an
+        ///     empty object will be produced. This flag is optional and
+        ///     defaults to false.
+        primitive_desc(const desc &adesc, const engine &aengine,
+                bool allow_empty = false)
+            : dnnl::primitive_desc(
+                    &adesc.data, nullptr, aengine, nullptr, allow_empty) {}
+
+        /// Constructs a primitive descriptor for an optimizer step
+        /// primitive.
+        ///
+        /// @param adesc Descriptor for an optimizer step primitive.
+        /// @param attr Primitive attributes to use.
+        /// @param aengine Engine to use.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case an
+        ///     empty object will be produced. This flag is optional and
+        ///     defaults to false.
+        primitive_desc(const desc &adesc, const primitive_attr &attr,
+                const engine &aengine, bool allow_empty = false)
+            : dnnl::primitive_desc(
+                    &adesc.data, &attr, aengine, nullptr, allow_empty) {}
+
+        /// Constructs a primitive descriptor for an optimizer step primitive
+        /// from a C API primitive descriptor that must have a matching kind.
+        ///
+        /// @param pd C API primitive descriptor for an optimizer step
+        ///     primitive.
+        primitive_desc(dnnl_primitive_desc_t pd)
+            : dnnl::primitive_desc(pd, dnnl::primitive::kind::optimizer) {}
+
+        /// Returns a hyperparameters memory descriptor.
+        /// @returns Memory descriptor of the runtime learning rate, step
+        ///     number, and gradients scale.
+        memory::desc hyperparameters_desc() const {
+            return base::src_desc(0);
+        }
+
+        /// @copydoc dnnl::primitive_desc_base::weights_desc()const
+        memory::desc weights_desc() const { return base::weights_desc(0); }
+
+        /// Returns a memory descriptor of the first optimizer state.
+        /// @returns Momentum (first moment) memory descriptor, or a zero
+        ///     memory descriptor if the algorithm does not use it.
+        memory::desc moment_1_desc() const { return base::weights_desc(1); }
+
+        /// Returns a memory descriptor of the second optimizer state.
+        /// @returns Second moment memory descriptor, or a zero memory
+        ///     descriptor if the algorithm does not use it.
+        memory::desc moment_2_desc() const { return base::weights_desc(2); }
+
+        /// @copydoc dnnl::primitive_desc_base::diff_weights_desc()const
+        memory::desc diff_weights_desc() const {
+            return base::diff_weights_desc(0);
+        }
+
+        /// @copydoc dnnl::primitive_desc_base::dst_desc()const
+        memory::desc dst_desc() const { return base::dst_desc(0); }
+    };
+
+    /// Default constructor. Produces an empty object.
+    optimizer() = default;
+
+    /// Constructs an optimizer step primitive.
+    /// @param pd Primitive descriptor for an optimizer step primitive.
+    optimizer(const primitive_desc &pd) : primitive(pd) {}
+};
+
+/// @} dnnl_api_optimizer
+
+/// @} dnnl_api_primitives
+
+/// @addtogroup dnnl_api_service Service
+///
+/// A set of functions that aid in oneDNN debugging and profiling.
+///
+/// @{
+
+/// @copydoc dnnl_version_t
+using version_t = dnnl_version_t;
+
+/// Status values returned by the library functions.
+enum class status {
+    /// @copydoc dnnl_success
+    success = dnnl_success,
+    /// @copydoc dnnl_out_of_memory
+    out_of_memory = dnnl_out_of_memory,
+    /// @copydoc dnnl_invalid_arguments
+    invalid_arguments = dnnl_invalid_arguments,
+    /// @copydoc dnnl_unimplemented
+    unimplemented = dnnl_unimplemented,
+    /// @copydoc dnnl_iterator_ends
+    iterator_ends = dnnl_iterator_ends,
+    /// @copydoc dnnl_runtime_error
+    runtime_error = dnnl_runtime_error,
+    /// @copydoc dnnl_not_required
+    not_required = dnnl_not_required,
+};
+
+/// @copydoc dnnl_set_verbose()
+inline status set_verbose(int level) {
+    return static_cast<status>(dnnl_set_verbose(level));
+}
+
+/// @copydoc dnnl_set_verbose_callback()
+inline status set_verbose_callback(
+        dnnl_verbose_callback_t callback, void *user_data = nullptr) {
+    return static_cast<status>(dnnl_set_verbose_callback(callback, user_data));
+}
+
+/// @copydoc dnnl_dump_verbose_samples()
+inline status dump_verbose_samples() {
+    return static_cast<status>(dnnl_dump_verbose_samples());
+}
+
+/// @copydoc dnnl_version()
+inline const version_t *version() {
+    return dnnl_version();
+}
+
+/// @copydoc dnnl_set_jit_dump()
+inline status set_jit_dump(int enable) {
+    return static_cast<status>(dnnl_set_jit_dump(enable));
 }
 
 /// @copydoc dnnl_set_jit_profiling_flags()
@@ -10692,6 +11770,17 @@ inline cpu_isa get_effective_cpu_isa() {
     return static_cast<cpu_isa>(dnnl_get_effective_cpu_isa());
 }
 
+/// @copydoc dnnl_set_memory_allocator()
+inline status set_memory_allocator(
+        dnnl_malloc_fn_t malloc_fn, dnnl_free_fn_t free_fn) {
+    return static_cast<status>(dnnl_set_memory_allocator(malloc_fn, free_fn));
+}
+
+/// @copydoc dnnl_set_hugepage_threshold()
+inline status set_hugepage_threshold(size_t threshold) {
+    return static_cast<status>(dnnl_set_hugepage_threshold(threshold));
+}
+
 /// @} dnnl_api_service
 
 /// @addtogroup dnnl_api_primitive_cache Primitive Cache
@@ -10715,6 +11804,46 @@ inline void set_primitive_cache_capacity(int capacity) {
             "could not set primitive cache capacity");
 }
 
+/// Returns the limit of the memory held by the primitives of the primitive
+/// cache, in megabytes.
+inline int get_primitive_cache_capacity_mb() {
+    int result = 0;
+    error::wrap_c_api(dnnl_get_primitive_cache_capacity_mb(&result),
+            "could not get primitive cache memory capacity");
+    return result;
+}
+
+/// @copydoc dnnl_set_primitive_cache_capacity_mb(int capacity_mb)
+inline void set_primitive_cache_capacity_mb(int capacity_mb) {
+    error::wrap_c_api(dnnl_set_primitive_cache_capacity_mb(capacity_mb),
+            "could not set primitive cache memory capacity");
+}
+
+/// @copydoc dnnl_primitive_cache_stats_t
+using primitive_cache_stats_t = dnnl_primitive_cache_stats_t;
+
+/// Returns the primitive cache statistics.
+inline primitive_cache_stats_t get_primitive_cache_stats() {
+    primitive_cache_stats_t result;
+    error::wrap_c_api(dnnl_get_primitive_cache_stats(&result),
+            "could not get primitive cache statistics");
+    return result;
+}
+
+/// @copydoc dnnl_reset_primitive_cache_stats()
+inline void reset_primitive_cache_stats() {
+    error::wrap_c_api(dnnl_reset_primitive_cache_stats(),
+            "could not reset primitive cache statistics");
+}
+
+/// Returns the memory held by all the primitives of the primitive cache.
+inline memory_footprint_t get_primitive_cache_memory_footprint() {
+    memory_footprint_t result;
+    error::wrap_c_api(dnnl_get_primitive_cache_memory_footprint(&result),
+            "could not get primitive cache memory footprint");
+    return result;
+}
+
 /// @} dnnl_api_primitive_cache
 
 /// @addtogroup dnnl_api_blas BLAS functions
@@ -10750,6 +11879,179 @@ inline status gemm_s8s8s32(char transa, char transb, char offsetc, dnnl_dim_t M,
             K, alpha, A, lda, ao, B, ldb, bo, beta, C, ldc, co));
 }
 
+/// @copydoc dnnl_sgemm_grouped()
+inline status sgemm_grouped(dnnl_dim_t group_count, const char *transa,
+        const char *transb, const dnnl_dim_t *M, const dnnl_dim_t *N,
+        const dnnl_dim_t *K, const float *alpha, const float *const *A,
+        const dnnl_dim_t *lda, const float *const *B, const dnnl_dim_t *ldb,
+        const float *beta, float *const *C, const dnnl_dim_t *ldc) {
+    return static_cast<status>(dnnl_sgemm_grouped(group_count, transa, transb,
+            M, N, K, alpha, A, lda, B, ldb, beta, C, ldc));
+}
+
+/// @copydoc dnnl_sgemm_batch()
+inline status sgemm_batch(char transa, char transb, dnnl_dim_t batch,
+        dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, float alpha,
+        const float *const *A, dnnl_dim_t lda, const float *const *B,
+        dnnl_dim_t ldb, float beta, float *const *C, dnnl_dim_t ldc) {
+    return static_cast<status>(dnnl_sgemm_batch(transa, transb, batch, M, N, K,
+            alpha, A, lda, B, ldb, beta, C, ldc));
+}
+
+/// @copydoc dnnl_sgemm_batch_strided()
+inline status sgemm_batch_strided(char transa, char transb, dnnl_dim_t batch,
+        dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, float alpha, const float *A,
+        dnnl_dim_t lda, dnnl_dim_t stride_a, const float *B, dnnl_dim_t ldb,
+        dnnl_dim_t stride_b, float beta, float *C, dnnl_dim_t ldc,
+        dnnl_dim_t stride_c) {
+    return static_cast<status>(dnnl_sgemm_batch_strided(transa, transb, batch,
+            M, N, K, alpha, A, lda, stride_a, B, ldb, stride_b, beta, C, ldc,
+            stride_c));
+}
+
+/// @copydoc dnnl_gemm_u8s8s32_batch()
+inline status gemm_u8s8s32_batch(char transa, char transb, char offsetc,
+        dnnl_dim_t batch, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K,
+        float alpha, const uint8_t *const *A, dnnl_dim_t lda, uint8_t ao,
+        const int8_t *const *B, dnnl_dim_t ldb, int8_t bo, float beta,
+        int32_t *const *C, dnnl_dim_t ldc, const int32_t *co) {
+    return static_cast<status>(dnnl_gemm_u8s8s32_batch(transa, transb, offsetc,
+            batch, M, N, K, alpha, A, lda, ao, B, ldb, bo, beta, C, ldc, co));
+}
+
+/// @copydoc dnnl_gemm_u8s8s32_batch_strided()
+inline status gemm_u8s8s32_batch_strided(char transa, char transb,
+        char offsetc, dnnl_dim_t batch, dnnl_dim_t M, dnnl_dim_t N,
+        dnnl_dim_t K, float alpha, const uint8_t *A, dnnl_dim_t lda,
+        dnnl_dim_t stride_a, uint8_t ao, const int8_t *B, dnnl_dim_t ldb,
+        dnnl_dim_t stride_b, int8_t bo, float beta, int32_t *C,
+        dnnl_dim_t ldc, dnnl_dim_t stride_c, const int32_t *co) {
+    return static_cast<status>(dnnl_gemm_u8s8s32_batch_strided(transa, transb,
+            offsetc, batch, M, N, K, alpha, A, lda, stride_a, ao, B, ldb,
+            stride_b, bo, beta, C, ldc, stride_c, co));
+}
+
+/// @copydoc dnnl_gemm_s8s8s32_batch()
+inline status gemm_s8s8s32_batch(char transa, char transb, char offsetc,
+        dnnl_dim_t batch, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K,
+        float alpha, const int8_t *const *A, dnnl_dim_t lda, int8_t ao,
+        const int8_t *const *B, dnnl_dim_t ldb, int8_t bo, float beta,
+        int32_t *const *C, dnnl_dim_t ldc, const int32_t *co) {
+    return static_cast<status>(dnnl_gemm_s8s8s32_batch(transa, transb, offsetc,
+            batch, M, N, K, alpha, A, lda, ao, B, ldb, bo, beta, C, ldc, co));
+}
+
+/// @copydoc dnnl_gemm_s8s8s32_batch_strided()
+inline status gemm_s8s8s32_batch_strided(char transa, char transb,
+        char offsetc, dnnl_dim_t batch, dnnl_dim_t M, dnnl_dim_t N,
+        dnnl_dim_t K, float alpha, const int8_t *A, dnnl_dim_t lda,
+        dnnl_dim_t stride_a, int8_t ao, const int8_t *B, dnnl_dim_t ldb,
+        dnnl_dim_t stride_b, int8_t bo, float beta, int32_t *C,
+        dnnl_dim_t ldc, dnnl_dim_t stride_c, const int32_t *co) {
+    return static_cast<status>(dnnl_gemm_s8s8s32_batch_strided(transa, transb,
+            offsetc, batch, M, N, K, alpha, A, lda, stride_a, ao, B, ldb,
+            stride_b, bo, beta, C, ldc, stride_c, co));
+}
+
+/// @copydoc dnnl_sgemm_pack_get_size()
+inline status sgemm_pack_get_size(char identifier, char transa, char transb,
+        dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, dnnl_dim_t lda,
+        dnnl_dim_t ldb, size_t *size) {
+    return static_cast<status>(dnnl_sgemm_pack_get_size(
+            identifier, transa, transb, M, N, K, lda, ldb, size));
+}
+
+/// @copydoc dnnl_sgemm_pack()
+inline status sgemm_pack(char identifier, char transa, char transb,
+        dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, dnnl_dim_t lda,
+        dnnl_dim_t ldb, const float *src, float *dst) {
+    return static_cast<status>(dnnl_sgemm_pack(
+            identifier, transa, transb, M, N, K, lda, ldb, src, dst));
+}
+
+/// @copydoc dnnl_sgemm_compute()
+inline status sgemm_compute(char transa, char transb, dnnl_dim_t M,
+        dnnl_dim_t N, dnnl_dim_t K, const float *A, dnnl_dim_t lda,
+        const float *B, dnnl_dim_t ldb, float beta, float *C, dnnl_dim_t ldc) {
+    return static_cast<status>(dnnl_sgemm_compute(
+            transa, transb, M, N, K, A, lda, B, ldb, beta, C, ldc));
+}
+
+/// @copydoc dnnl_gemm_bf16bf16f32_pack_get_size()
+inline status gemm_bf16bf16f32_pack_get_size(char identifier, char transa,
+        char transb, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, dnnl_dim_t lda,
+        dnnl_dim_t ldb, size_t *size) {
+    return static_cast<status>(dnnl_gemm_bf16bf16f32_pack_get_size(
+            identifier, transa, transb, M, N, K, lda, ldb, size));
+}
+
+/// @copydoc dnnl_gemm_bf16bf16f32_pack()
+inline status gemm_bf16bf16f32_pack(char identifier, char transa, char transb,
+        dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, dnnl_dim_t lda,
+        dnnl_dim_t ldb, const uint16_t *src, uint16_t *dst) {
+    return static_cast<status>(dnnl_gemm_bf16bf16f32_pack(
+            identifier, transa, transb, M, N, K, lda, ldb, src, dst));
+}
+
+/// @copydoc dnnl_gemm_bf16bf16f32_compute()
+inline status gemm_bf16bf16f32_compute(char transa, char transb,
+        dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, const uint16_t *A,
+        dnnl_dim_t lda, const uint16_t *B, dnnl_dim_t ldb, float beta,
+        float *C, dnnl_dim_t ldc) {
+    return static_cast<status>(dnnl_gemm_bf16bf16f32_compute(
+            transa, transb, M, N, K, A, lda, B, ldb, beta, C, ldc));
+}
+
+/// @copydoc dnnl_gemm_u8s8s32_pack_get_size()
+inline status gemm_u8s8s32_pack_get_size(char identifier, char transa,
+        char transb, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, dnnl_dim_t lda,
+        dnnl_dim_t ldb, size_t *size) {
+    return static_cast<status>(dnnl_gemm_u8s8s32_pack_get_size(
+            identifier, transa, transb, M, N, K, lda, ldb, size));
+}
+
+/// @copydoc dnnl_gemm_u8s8s32_pack()
+inline status gemm_u8s8s32_pack(char identifier, char transa, char transb,
+        dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, dnnl_dim_t lda,
+        dnnl_dim_t ldb, const void *src, void *dst) {
+    return static_cast<status>(dnnl_gemm_u8s8s32_pack(
+            identifier, transa, transb, M, N, K, lda, ldb, src, dst));
+}
+
+/// @copydoc dnnl_gemm_u8s8s32_compute()
+inline status gemm_u8s8s32_compute(char transa, char transb, char offsetc,
+        dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, const void *A,
+        dnnl_dim_t lda, const void *B, dnnl_dim_t ldb, float beta,
+        int32_t *C, dnnl_dim_t ldc, const int32_t *co) {
+    return static_cast<status>(dnnl_gemm_u8s8s32_compute(transa, transb,
+            offsetc, M, N, K, A, lda, B, ldb, beta, C, ldc, co));
+}
+
+/// @copydoc dnnl_gemm_s8s8s32_pack_get_size()
+inline status gemm_s8s8s32_pack_get_size(char identifier, char transa,
+        char transb, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, dnnl_dim_t lda,
+        dnnl_dim_t ldb, size_t *size) {
+    return static_cast<status>(dnnl_gemm_s8s8s32_pack_get_size(
+            identifier, transa, transb, M, N, K, lda, ldb, size));
+}
+
+/// @copydoc dnnl_gemm_s8s8s32_pack()
+inline status gemm_s8s8s32_pack(char identifier, char transa, char transb,
+        dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, dnnl_dim_t lda,
+        dnnl_dim_t ldb, const void *src, void *dst) {
+    return static_cast<status>(dnnl_gemm_s8s8s32_pack(
+            identifier, transa, transb, M, N, K, lda, ldb, src, dst));
+}
+
+/// @copydoc dnnl_gemm_s8s8s32_compute()
+inline status gemm_s8s8s32_compute(char transa, char transb, char offsetc,
+        dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, const void *A,
+        dnnl_dim_t lda, const void *B, dnnl_dim_t ldb, float beta,
+        int32_t *C, dnnl_dim_t ldc, const int32_t *co) {
+    return static_cast<status>(dnnl_gemm_s8s8s32_compute(transa, transb,
+            offsetc, M, N, K, A, lda, B, ldb, beta, C, ldc, co));
+}
+
 /// @} dnnl_api_blas
 
 // implementation section
@@ -10764,6 +12066,52 @@ inline primitive::primitive(const_dnnl_primitive_desc_t c_pd) {
 
 inline primitive::primitive(const primitive_desc &pd) : primitive(pd.get()) {}
 
+inline primitive::primitive(
+        const primitive_desc &pd, const std::vector<uint8_t> &cache_blob) {
+    dnnl_primitive_t result;
+    error::wrap_c_api(dnnl_primitive_create_from_cache_blob(&result, pd.get(),
+                              cache_blob.size(), cache_blob.data()),
+            "could not create a primitive from a cache blob");
+    reset(result);
+}
+
+inline std::vector<uint8_t> primitive::get_cache_blob() const {
+    size_t size = 0;
+    error::wrap_c_api(dnnl_primitive_get_cache_blob(get(), &size, nullptr),
+            "could not get a cache blob size from a primitive");
+    std::vector<uint8_t> cache_blob(size);
+    error::wrap_c_api(
+            dnnl_primitive_get_cache_blob(get(), &size, cache_blob.data()),
+            "could not get a cache blob from a primitive");
+    return cache_blob;
+}
+
+inline memory_footprint_t primitive::get_memory_footprint() const {
+    memory_footprint_t result;
+    error::wrap_c_api(dnnl_primitive_get_memory_footprint(get(), &result),
+            "could not get a primitive memory footprint");
+    return result;
+}
+
+inline std::vector<primitive> primitive::create_batch(
+        const std::vector<primitive_desc> &pds) {
+    std::vector<const_dnnl_primitive_desc_t> c_pds;
+    c_pds.reserve(pds.size());
+    for (const auto &pd : pds)
+        c_pds.push_back(pd.get());
+
+    std::vector<dnnl_primitive_t> results(pds.size(), nullptr);
+    error::wrap_c_api(dnnl_primitive_create_batch(results.data(),
+                              (int)results.size(), c_pds.data()),
+            "could not create a batch of primitives");
+
+    std::vector<primitive> prims;
+    prims.reserve(results.size());
+    for (auto r : results)
+        prims.emplace_back(r);
+    return prims;
+}
+
 inline void primitive::execute(const stream &astream,
         const std::unordered_map<int, memory> &args) const {
     std::vector<dnnl_exec_arg_t> c_args;
@@ -10776,6 +12124,38 @@ inline void primitive::execute(const stream &astream,
             "could not execute a primitive");
 }
 
+inline void primitive::execute(
+        const stream &astream, const bound_args &args) const {
+    error::wrap_c_api(
+            dnnl_primitive_execute_bound(get(), astream.get(), args.get()),
+            "could not execute a primitive");
+}
+
+inline void primitive::execute_batch(const stream &astream,
+        const std::vector<std::unordered_map<int, memory>> &batch) const {
+    std::vector<std::vector<dnnl_exec_arg_t>> c_args(batch.size());
+    std::vector<const dnnl_exec_arg_t *> c_args_ptrs(batch.size());
+    std::vector<int> c_nargs(batch.size());
+    for (size_t i = 0; i < batch.size(); i++) {
+        c_args[i].reserve(batch[i].size());
+        for (const auto &a : batch[i])
+            c_args[i].push_back({a.first, a.second.get(true)});
+        c_args_ptrs[i] = c_args[i].data();
+        c_nargs[i] = (int)c_args[i].size();
+    }
+
+    error::wrap_c_api(dnnl_primitive_execute_batch(get(), astream.get(),
+                              (int)batch.size(), c_nargs.data(),
+                              c_args_ptrs.data()),
+            "could not execute a batch of a primitive");
+}
+
+inline stream &stream::set_scratchpad(const memory &scratchpad) {
+    error::wrap_c_api(dnnl_stream_set_scratchpad(get(), scratchpad.get()),
+            "could not set a stream scratchpad");
+    return *this;
+}
+
 /// @endcond
 
 #undef DNNL_DEFINE_BITMASK_OPS
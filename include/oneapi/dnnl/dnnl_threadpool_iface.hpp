@@ -56,6 +56,22 @@ struct threadpool_iface {
     /// waiting for the submitted closures to finish execution on its own.
     static constexpr uint64_t ASYNCHRONOUS = 1;
 
+    /// If set, primitives executed on a stream created with this threadpool
+    /// are executed asynchronously with respect to the submitting thread:
+    /// primitive execution returns immediately after the primitive is
+    /// queued, the primitives are executed in the order of submission, and
+    /// dnnl::stream::wait() is the only synchronization point. The memory
+    /// objects passed to the primitives must stay alive and must not be
+    /// accessed by the user until the stream is waited on.
+    static constexpr uint64_t ASYNCHRONOUS_EXECUTION = 2;
+
+    /// If set, all n closures submitted by a parallel_for() call run
+    /// concurrently, each on its own thread. oneDNN then synchronizes the
+    /// closures with a barrier and executes the primitives that consist of
+    /// several phases, such as a computation followed by a reduction, in a
+    /// single parallel_for() call instead of one call per phase.
+    static constexpr uint64_t CONCURRENT_CLOSURES = 4;
+
     virtual ~threadpool_iface() {}
 };
 
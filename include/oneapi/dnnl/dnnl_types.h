@@ -91,6 +91,9 @@ typedef enum {
     dnnl_format_kind_wino,
     /// Packed weights format used in RNN
     dnnl_format_kind_rnn_packed,
+    /// A two-dimensional tensor in the block compressed sparse row format.
+    /// See @ref dnnl_sparse_desc_t for more information.
+    dnnl_format_kind_sparse,
 } dnnl_format_kind_t;
 
 /// Memory format tag specification.
@@ -461,6 +464,13 @@ typedef enum {
     dnnl_abdEc32e,
     dnnl_abdEC32e2c,
     dnnl_abdEC32e4c,
+    dnnl_BA16a64b,
+    dnnl_BA8a64b2a,
+    dnnl_BA4a64b4a,
+    dnnl_aCB16b64c,
+    dnnl_aCB8b64c2b,
+    dnnl_aCB4b64c4b,
+    dnnl_ABcde16b16a2b,
 
     /// Just a sentinel, not real memory format tag. Must be changed after new
     /// format tag is added.
@@ -735,6 +745,7 @@ typedef enum {
     dnnl_OIdhw4i32o4i = dnnl_ABcde4b32a4b,
     dnnl_OIdhw4i64o4i = dnnl_ABcde4b64a4b,
     dnnl_OIdhw16i16o4i = dnnl_ABcde16b16a4b,
+    dnnl_OIdhw16i16o2i = dnnl_ABcde16b16a2b,
     dnnl_OIdhw2i8o4i = dnnl_ABcde2b8a4b,
     dnnl_OIdhw8o8i = dnnl_ABcde8a8b,
     dnnl_OIdhw8o4i = dnnl_ABcde8a4b,
@@ -936,6 +947,12 @@ typedef enum {
     dnnl_reduction,
     /// A PReLU primitive.
     dnnl_prelu,
+    /// An embedding bag primitive.
+    dnnl_embedding_bag,
+    /// A group normalization primitive.
+    dnnl_group_normalization,
+    /// An optimizer primitive.
+    dnnl_optimizer,
 
     /// Parameter to allow internal only primitives without undefined behavior.
     /// This parameter is chosen to be valid for so long as sizeof(int) >= 2.
@@ -1000,6 +1017,14 @@ typedef enum {
     dnnl_eltwise_round = 0x40,
     /// Eltwise: logsigmoid
     dnnl_eltwise_logsigmoid = 0x50,
+    /// Eltwise: hardswish
+    dnnl_eltwise_hardswish = 0x60,
+    /// Eltwise: hardsigmoid
+    dnnl_eltwise_hardsigmoid = 0x70,
+    /// Eltwise: mish
+    dnnl_eltwise_mish = 0x80,
+    /// Eltwise: scaled exponential linear unit (selu)
+    dnnl_eltwise_selu = 0x90,
     /// Eltwise: ReLU (dst for backward)
     dnnl_eltwise_relu_use_dst_for_bwd = 0x100,
     /// Eltwise: hyperbolic tangent non-linearity (tanh) (dst for backward)
@@ -1040,6 +1065,13 @@ typedef enum {
     /// Primitive expects 4 biases on input:
     /// \f$[b_{u}, b_{r}, b_{c_x}, b_{c_h}]\f$
     dnnl_lbr_gru = 0x4fff,
+    /// GRU cell with attentional update gate (AUGRU)
+    ///
+    /// Modification of original GRU cell. The update gate is scaled by the
+    /// attention score \f$a_t\f$ of the iteration:
+    /// \f[ \tilde{u}_t = (1 - a_t) * u_t \f]
+    /// The attention is passed as #DNNL_ARG_AUGRU_ATTENTION.
+    dnnl_vanilla_augru = 0x5fff,
     /// Binary add
     dnnl_binary_add = 0x1fff0,
     /// Binary mul
@@ -1074,6 +1106,10 @@ typedef enum {
     dnnl_reduction_norm_lp_power_p_max,
     /// Reduction using lp norm without final pth-root
     dnnl_reduction_norm_lp_power_p_sum,
+    /// Stochastic gradient descent, optionally with momentum
+    dnnl_optimizer_sgd = 0x3fff0,
+    /// Adam with decoupled weight decay (AdamW)
+    dnnl_optimizer_adam = 0x3fff1,
 } dnnl_alg_kind_t;
 
 /// Flags for normalization primitives.
@@ -1126,6 +1162,19 @@ typedef enum {
     ///  - on training primitive requires workspace (required to be able to
     ///    perform backward pass)
     dnnl_fuse_norm_relu = 0x4U,
+
+    /// Fuse with a residual addition
+    ///
+    /// Supported by layer normalization on forward propagation only.
+    ///
+    /// If specified:
+    ///  - the primitive normalizes the sum of the #DNNL_ARG_SRC and
+    ///    #DNNL_ARG_SRC_1 tensors, both described by the data memory
+    ///    descriptor
+    ///  - the sum is additionally written to #DNNL_ARG_DST_1 if that
+    ///    argument is passed at execution, so that it can be reused as the
+    ///    input of the next residual connection
+    dnnl_fuse_residual_add = 0x8U,
 } dnnl_normalization_flags_t;
 
 /// @} dnnl_api_primitives_common
@@ -1244,6 +1293,33 @@ typedef struct {
     char reserved[200];
 } dnnl_rnn_packed_desc_t;
 
+/// Description of a two-dimensional tensor in the block compressed sparse
+/// row (BCSR) format.
+///
+/// The tensor is split into blocks of `block_dims[0] x block_dims[1]`
+/// elements, and only the blocks that contain non-zero elements are stored.
+/// The memory holds three arrays:
+/// - The values of the stored blocks, ordered by block row and then by block
+///   column. The elements of each block are stored in the row-major order.
+/// - The block row pointers, the number of block rows plus one int32 values
+///   located at @p row_ptr_offset bytes. The stored blocks of block row `r`
+///   are the blocks `row_ptr[r]` to `row_ptr[r + 1] - 1`.
+/// - The block column indices of the stored blocks, int32 values located at
+///   @p col_idx_offset bytes.
+typedef struct {
+    /// Sizes of the blocks along the two dimensions.
+    dnnl_dim_t block_dims[2];
+    /// Number of blocks the memory can hold. The tensor may have at most as
+    /// many non-zero blocks.
+    dnnl_dim_t nnz_blocks;
+    /// Offset of the block row pointers, in bytes.
+    size_t row_ptr_offset;
+    /// Offset of the block column indices, in bytes.
+    size_t col_idx_offset;
+    /// Size of the memory, in bytes.
+    size_t size;
+} dnnl_sparse_desc_t;
+
 /// Flags for memory special features
 typedef enum {
     dnnl_memory_extra_flag_none = 0x0U,
@@ -1324,6 +1400,8 @@ typedef struct {
         dnnl_wino_desc_t wino_desc;
         /// Tensor of packed weights for RNN.
         dnnl_rnn_packed_desc_t rnn_packed_desc;
+        /// Tensor of weights in the block compressed sparse row format.
+        dnnl_sparse_desc_t sparse_desc;
         // ... other descriptions possible
     } format_desc;
 
@@ -1459,7 +1537,9 @@ typedef struct {
     /// #dnnl_eltwise_logistic, #dnnl_eltwise_exp, #dnnl_eltwise_gelu_tanh,
     /// #dnnl_eltwise_swish, #dnnl_eltwise_log, #dnnl_eltwise_clip,
     /// #dnnl_eltwise_clip_v2, #dnnl_eltwise_pow, #dnnl_eltwise_gelu_erf,
-    /// #dnnl_eltwise_round, #dnnl_eltwise_logsigmoid.
+    /// #dnnl_eltwise_round, #dnnl_eltwise_logsigmoid,
+    /// #dnnl_eltwise_hardswish, #dnnl_eltwise_hardsigmoid, #dnnl_eltwise_mish,
+    /// #dnnl_eltwise_selu.
     /// Possible values for passing destination memory on backward:
     /// #dnnl_eltwise_relu_use_dst_for_bwd, #dnnl_eltwise_tanh_use_dst_for_bwd,
     /// #dnnl_eltwise_elu_use_dst_for_bwd, #dnnl_eltwise_sqrt_use_dst_for_bwd,
@@ -1493,6 +1573,10 @@ typedef struct {
     ///  - #dnnl_eltwise_gelu_erf: @p alpha and @p beta ignored
     ///  - #dnnl_eltwise_round: @p alpha and @p beta ignored
     ///  - #dnnl_eltwise_logsigmoid @p alpha and @p beta ignored
+    ///  - #dnnl_eltwise_hardswish: @p alpha -- slope, @p beta -- shift
+    ///  - #dnnl_eltwise_hardsigmoid: @p alpha -- slope, @p beta -- shift
+    ///  - #dnnl_eltwise_mish: @p alpha and @p beta ignored
+    ///  - #dnnl_eltwise_selu: @p alpha -- negative slope, @p beta -- scale
     float alpha, beta;
 } dnnl_eltwise_desc_t;
 
@@ -1769,7 +1853,21 @@ typedef struct {
 /// Flags for RNN cell.
 typedef enum {
     /// Undefined RNN flags
-    dnnl_rnn_flags_undef = 0x0
+    dnnl_rnn_flags_undef = 0x0,
+    /// Variable sequence lengths (forward only). The actual length of every
+    /// sequence of the batch is passed at execution time as a
+    /// one-dimensional #dnnl_s32 tensor of size minibatch
+    /// (#DNNL_ARG_SEQ_LENGTHS). The lengths must be non-increasing and lie
+    /// in [1, T]. The elements of dst_layer beyond the length of a sequence
+    /// are set to zero, dst_iter (and dst_iter_c) hold the states of the
+    /// last valid iteration of every sequence.
+    dnnl_rnn_flags_seq_lengths = 0x1,
+    /// Gate recomputation (training only). The workspace keeps the states
+    /// of the cells only, the activated gates are recomputed from them
+    /// during the backward propagation at the cost of the forward gemms
+    /// of every cell. The flag must be passed to both the forward training
+    /// and the backward propagation descriptors.
+    dnnl_rnn_flags_recompute_gates = 0x2
 } dnnl_rnn_flags_t;
 
 /// A direction of RNN primitive execution.
@@ -1797,7 +1895,8 @@ typedef struct {
     /// #dnnl_forward_inference, and #dnnl_backward.
     dnnl_prop_kind_t prop_kind;
     /// RNN cell kind. Must be one of #dnnl_vanilla_rnn,
-    /// #dnnl_vanilla_lstm, #dnnl_vanilla_gru, or #dnnl_lbr_gru.
+    /// #dnnl_vanilla_lstm, #dnnl_vanilla_gru, #dnnl_lbr_gru, or
+    /// #dnnl_vanilla_augru.
     dnnl_alg_kind_t cell_kind;
     /// The direction of RNN primitive execution.
     dnnl_rnn_direction_t direction;
@@ -1977,6 +2076,104 @@ typedef struct {
 
 /// @} dnnl_api_reduction
 
+/// @addtogroup dnnl_api_embedding_bag
+/// @{
+
+/// A descriptor of an embedding bag operation.
+typedef struct {
+    /// The kind of primitive. Used for self-identifying the primitive
+    /// descriptor. Must be #dnnl_embedding_bag.
+    dnnl_primitive_kind_t primitive_kind;
+    /// The kind of propagation. Possible values: #dnnl_forward_training and
+    /// #dnnl_forward_inference.
+    dnnl_prop_kind_t prop_kind;
+    /// The kind of bag pooling. Possible values: #dnnl_reduction_sum and
+    /// #dnnl_reduction_mean.
+    dnnl_alg_kind_t alg_kind;
+    /// Indices memory descriptor: the rows of the table to gather.
+    dnnl_memory_desc_t indices_desc;
+    /// Offsets memory descriptor: the position of the first index of each
+    /// bag.
+    dnnl_memory_desc_t offsets_desc;
+    /// Table memory descriptor.
+    dnnl_memory_desc_t table_desc;
+    /// Per-row scale and shift memory descriptor of a quantized table.
+    dnnl_memory_desc_t scale_shift_desc;
+    /// Destination memory descriptor.
+    dnnl_memory_desc_t dst_desc;
+} dnnl_embedding_bag_desc_t;
+
+/// @} dnnl_api_embedding_bag
+
+/// @addtogroup dnnl_api_group_normalization
+/// @{
+
+/// A descriptor of a Group Normalization operation.
+typedef struct {
+    /// The kind of primitive. Used for self-identifying the primitive
+    /// descriptor. Must be #dnnl_group_normalization.
+    dnnl_primitive_kind_t primitive_kind;
+    /// The kind of propagation. Possible values: #dnnl_forward_training and
+    /// #dnnl_forward_inference.
+    dnnl_prop_kind_t prop_kind;
+    /// Source and destination memory descriptor.
+    dnnl_memory_desc_t data_desc;
+    /// Scale and shift data memory descriptor.
+    ///
+    /// Scaleshift memory descriptor uses 2D #dnnl_nc format[2, Channels]
+    /// where 1-st dimension contains gamma parameter, 2-nd dimension
+    /// contains beta parameter.
+    dnnl_memory_desc_t data_scaleshift_desc;
+    /// Mean and variance data memory descriptors.
+    ///
+    /// Statistics (mean and variance) memory descriptor is the 2D tensor
+    /// [Batch, Groups] in #dnnl_ab format.
+    dnnl_memory_desc_t stat_desc;
+    /// Number of groups the channels are split into.
+    dnnl_dim_t groups;
+    /// Group normalization epsilon parameter.
+    float group_norm_epsilon;
+    unsigned flags;
+} dnnl_group_normalization_desc_t;
+
+/// @} dnnl_api_group_normalization
+
+/// @addtogroup dnnl_api_optimizer
+/// @{
+
+/// A descriptor of an optimizer step operation.
+typedef struct {
+    /// The kind of primitive. Used for self-identifying the primitive
+    /// descriptor. Must be #dnnl_optimizer.
+    dnnl_primitive_kind_t primitive_kind;
+    /// The kind of optimizer algorithm. Possible values:
+    /// #dnnl_optimizer_sgd and #dnnl_optimizer_adam.
+    dnnl_alg_kind_t alg_kind;
+    /// Master weights memory descriptor. The master weights are updated in
+    /// place; the optimizer states share this memory descriptor.
+    dnnl_memory_desc_t weights_desc;
+    /// Gradients memory descriptor.
+    dnnl_memory_desc_t diff_weights_desc;
+    /// Memory descriptor of the optional copy of the updated weights, for
+    /// instance in #dnnl_bf16. Zero memory descriptor if there is no copy.
+    dnnl_memory_desc_t dst_desc;
+    /// Momentum for #dnnl_optimizer_sgd, or the decay rate of the first
+    /// moment for #dnnl_optimizer_adam.
+    float momentum;
+    /// Decay rate of the second moment for #dnnl_optimizer_adam.
+    float beta2;
+    /// Epsilon for #dnnl_optimizer_adam.
+    float epsilon;
+    /// Weight decay (L2 penalty for #dnnl_optimizer_sgd, decoupled decay for
+    /// #dnnl_optimizer_adam).
+    float weight_decay;
+    /// Maximal L2 norm of the gradients of the tensor. Non-positive values
+    /// disable the clipping.
+    float max_grad_norm;
+} dnnl_optimizer_desc_t;
+
+/// @} dnnl_api_optimizer
+
 /// @} dnnl_api_primitives
 
 /// @addtogroup dnnl_api_engine
@@ -2062,6 +2259,18 @@ typedef enum {
     dnnl_scratchpad_mode_user,
 } dnnl_scratchpad_mode_t;
 
+/// Floating-point math mode
+typedef enum {
+    /// Default behavior, no down-conversions allowed
+    dnnl_fpmath_mode_strict,
+    /// Implicit f32->bf16 conversions allowed
+    dnnl_fpmath_mode_bf16,
+    /// Implicit f32->f16 conversions allowed
+    dnnl_fpmath_mode_f16,
+    /// Implicit f32->f16 or f32->bf16 conversions allowed
+    dnnl_fpmath_mode_any,
+} dnnl_fpmath_mode_t;
+
 /// @struct dnnl_primitive_attr
 /// @brief An opaque structure for primitive descriptor attributes.
 ///
@@ -2126,18 +2335,33 @@ typedef const struct dnnl_primitive *const_dnnl_primitive_t;
 /// A special mnemonic for reorder source argument. An alias for
 /// #DNNL_ARG_SRC_0.
 #define DNNL_ARG_FROM DNNL_ARG_SRC_0
+/// A special mnemonic for the runtime hyperparameters of an optimizer. An
+/// alias for #DNNL_ARG_SRC_0.
+#define DNNL_ARG_HYPERPARAMETERS DNNL_ARG_SRC_0
 
 /// Source argument #1.
 #define DNNL_ARG_SRC_1 2
 /// A special mnemonic for RNN input recurrent hidden state vector. An alias
 /// for #DNNL_ARG_SRC_1.
 #define DNNL_ARG_SRC_ITER DNNL_ARG_SRC_1
+/// A special mnemonic for embedding bag offsets. An alias for
+/// #DNNL_ARG_SRC_1.
+#define DNNL_ARG_OFFSETS DNNL_ARG_SRC_1
 
 /// Source argument #2.
 #define DNNL_ARG_SRC_2 3
 /// A special mnemonic for RNN input recurrent cell state vector. An alias for
 /// #DNNL_ARG_SRC_2.
 #define DNNL_ARG_SRC_ITER_C DNNL_ARG_SRC_2
+/// A special mnemonic for AUGRU attention vector. An alias for
+/// #DNNL_ARG_SRC_2: AUGRU has no cell state.
+#define DNNL_ARG_AUGRU_ATTENTION DNNL_ARG_SRC_2
+
+/// Source argument #3.
+#define DNNL_ARG_SRC_3 4
+/// A special mnemonic for RNN sequence lengths. An alias for
+/// #DNNL_ARG_SRC_3.
+#define DNNL_ARG_SEQ_LENGTHS DNNL_ARG_SRC_3
 
 /// Destination argument #0.
 #define DNNL_ARG_DST_0 17
@@ -2179,12 +2403,21 @@ typedef const struct dnnl_primitive *const_dnnl_primitive_t;
 /// A special mnemonic for RNN weights applied to the recurrent input.
 /// An alias for #DNNL_ARG_WEIGHTS_1.
 #define DNNL_ARG_WEIGHTS_ITER DNNL_ARG_WEIGHTS_1
+/// A special mnemonic for the per-row scale and shift of a quantized
+/// embedding bag table. An alias for #DNNL_ARG_WEIGHTS_1.
+#define DNNL_ARG_WEIGHTS_SCALE_SHIFT DNNL_ARG_WEIGHTS_1
+/// A special mnemonic for the first optimizer state (momentum or first
+/// moment). An alias for #DNNL_ARG_WEIGHTS_1.
+#define DNNL_ARG_MOMENT_1 DNNL_ARG_WEIGHTS_1
 
 /// Weights argument #2.
 #define DNNL_ARG_WEIGHTS_2 35
 /// A special mnemonic for RNN weights applied to the peephole weights.
 /// An alias for #DNNL_ARG_WEIGHTS_2.
 #define DNNL_ARG_WEIGHTS_PEEPHOLE DNNL_ARG_WEIGHTS_2
+/// A special mnemonic for the second optimizer state (second moment). An
+/// alias for #DNNL_ARG_WEIGHTS_2.
+#define DNNL_ARG_MOMENT_2 DNNL_ARG_WEIGHTS_2
 
 /// Weights argument #3.
 #define DNNL_ARG_WEIGHTS_3 36
@@ -2284,6 +2517,16 @@ typedef const struct dnnl_primitive *const_dnnl_primitive_t;
 /// Output scaling factors provided at execution time.
 #define DNNL_ARG_ATTR_OUTPUT_SCALES 513
 
+/// Bitmask of the elements kept by the dropout.
+/// See @ref dev_guide_attributes_dropout
+#define DNNL_ARG_ATTR_DROPOUT_MASK 514
+
+/// Probability of the dropout provided at execution time, an f32 scalar.
+#define DNNL_ARG_ATTR_DROPOUT_PROBABILITY 515
+
+/// Seed of the dropout provided at execution time, an s32 scalar.
+#define DNNL_ARG_ATTR_DROPOUT_SEED 516
+
 /// Starting index for source arguments for primitives that take a variable
 /// number of source arguments.
 #define DNNL_ARG_MULTIPLE_SRC 1024
@@ -2316,6 +2559,15 @@ typedef struct {
     dnnl_memory_t memory; ///< Input/output memory
 } dnnl_exec_arg_t;
 
+/// @struct dnnl_bound_args
+/// An opaque structure holding execution arguments bound to a primitive in
+/// advance, see dnnl_bound_args_create().
+struct dnnl_bound_args;
+/// A bound execution arguments handle.
+typedef struct dnnl_bound_args *dnnl_bound_args_t;
+/// A constant bound execution arguments handle.
+typedef const struct dnnl_bound_args *const_dnnl_bound_args_t;
+
 /// @} dnnl_api_primitives_common
 
 /// @addtogroup dnnl_api_primitives_common
@@ -2375,6 +2627,12 @@ typedef enum {
 
     dnnl_query_prop_kind, ///< propagation kind
 
+    dnnl_query_flops_f64, ///< estimated number of operations of an
+    ///  execution, 0 if not estimated
+    dnnl_query_bytes_moved_s64, ///< size of all inputs and outputs memory --
+    ///  the memory traffic of an execution if every argument is accessed
+    ///  once (bytes)
+
     // memory and op descriptor section
     dnnl_query_some_d = 64, ///< stub
     dnnl_query_op_d, ///< op descriptor
@@ -2397,6 +2655,9 @@ typedef enum {
     dnnl_query_resampling_d, ///< resampling descriptor
     dnnl_query_pooling_v2_d, ///< pooling version 2 descriptor
     dnnl_query_reduction_d, ///< reduction descriptor
+    dnnl_query_embedding_bag_d, ///< embedding bag descriptor
+    dnnl_query_group_normalization_d, ///< group normalization descriptor
+    dnnl_query_optimizer_d, ///< optimizer descriptor
 
     // memory descriptor section
     dnnl_query_some_md = 128, ///< stub
@@ -2425,12 +2686,30 @@ typedef enum {
 typedef enum {
     // In-order execution.
     dnnl_stream_in_order = 0x1U,
-    /// Out-of-order execution.
+    /// Out-of-order execution. On OpenCL GPU streams the primitives that
+    /// do not access the same memory objects may run concurrently.
     dnnl_stream_out_of_order = 0x2U,
     /// Default stream configuration.
     dnnl_stream_default_flags = dnnl_stream_in_order,
+    /// Collects the device time of the kernels executed on the stream.
+    /// Supported only by the OpenCL GPU runtime.
+    dnnl_stream_profiling = 0x4U,
 } dnnl_stream_flags_t;
 
+/// @brief Kinds of the profiling data collected by a stream.
+typedef enum {
+    /// Undefined profiling data kind.
+    dnnl_profiling_data_kind_undef = 0,
+    /// Device execution time of a primitive in nanoseconds: the sum of the
+    /// times its kernels were running on the device.
+    dnnl_profiling_data_kind_time,
+    /// Overhead of a primitive execution in nanoseconds: the time from
+    /// queueing the first kernel of the primitive to the completion of the
+    /// last one minus the device execution time. Includes the queueing and
+    /// submission latencies and the gaps between the kernels.
+    dnnl_profiling_data_kind_overhead_time,
+} dnnl_profiling_data_kind_t;
+
 /// @struct dnnl_stream
 /// An opaque structure to describe an execution stream.
 struct dnnl_stream;
@@ -2486,6 +2765,26 @@ typedef struct {
     unsigned gpu_runtime; ///< GPU runtime
 } dnnl_version_t;
 
+/// A function that receives the verbose output line by line.
+///
+/// @param line Verbose line without the terminating newline character.
+/// @param user_data Pointer passed to dnnl_set_verbose_callback().
+typedef void (*dnnl_verbose_callback_t)(const char *line, void *user_data);
+
+/// A function that allocates memory for the library.
+///
+/// @param size Size of the allocation in bytes.
+/// @param alignment Required alignment of the allocation in bytes. Always a
+///     power of two.
+/// @returns Pointer to the allocated memory or NULL on failure.
+typedef void *(*dnnl_malloc_fn_t)(size_t size, size_t alignment);
+
+/// A function that frees memory allocated by the matching
+/// #dnnl_malloc_fn_t.
+///
+/// @param ptr Pointer to the memory to free. May be NULL.
+typedef void (*dnnl_free_fn_t)(void *ptr);
+
 /// Disable profiling completely
 #define DNNL_JIT_PROFILE_NONE 0u
 
@@ -2554,6 +2853,49 @@ typedef enum {
 
 /// @} dnnl_api_service
 
+/// @addtogroup dnnl_api_primitives_common
+/// @{
+
+/// Memory held by a primitive, or by all the primitives of the primitive
+/// cache, in bytes.
+typedef struct {
+    /// Buffers computed at the primitive creation and kept for all the
+    /// executions, such as transformed weights or precomputed tables
+    uint64_t constant;
+    /// Code generated just in time for the primitive and its nested
+    /// primitives
+    uint64_t jit_code;
+    /// Scratchpad owned by the primitive in the library scratchpad mode. The
+    /// scratchpad shared by the primitives of a thread
+    /// (DNNL_ENABLE_CONCURRENT_EXEC=OFF) is not included.
+    uint64_t scratchpad;
+    /// Sum of all the above
+    uint64_t total;
+} dnnl_memory_footprint_t;
+
+/// @} dnnl_api_primitives_common
+
+/// @addtogroup dnnl_api_primitive_cache
+/// @{
+
+/// Primitive cache statistics. All the counters are accumulated since the
+/// library was loaded or since the last call to
+/// dnnl_reset_primitive_cache_stats().
+typedef struct {
+    /// Number of primitive creations served from the cache
+    uint64_t hits;
+    /// Number of primitive creations that were not found in the cache
+    uint64_t misses;
+    /// Number of entries evicted from the cache because of the capacity limit
+    uint64_t evictions;
+    /// Total time, in nanoseconds, spent creating primitives on cache misses
+    uint64_t creation_time_ns;
+    /// Total time, in nanoseconds, spent waiting for the cache write lock
+    uint64_t lock_wait_time_ns;
+} dnnl_primitive_cache_stats_t;
+
+/// @} dnnl_api_primitive_cache
+
 /// @} dnnl_api
 
 #ifdef __cplusplus
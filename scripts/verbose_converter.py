@@ -0,0 +1,321 @@
+#!/usr/bin/env python3
+################################################################################
+# Copyright 2020 Intel Corporation
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+################################################################################
+
+# Converts DNNL_VERBOSE output into benchdnn batch files, one per driver, so
+# that the primitives of a recorded workload can be re-created (and their
+# creation and execution time measured) without the application:
+#
+#   DNNL_VERBOSE=1 ./app > app.log
+#   python3 scripts/verbose_converter.py -i app.log -o app_batches
+#   ./benchdnn --conv --mode=P --batch=app_batches/conv.in
+#
+# Only unique problems are kept. Lines of unsupported primitive kinds are
+# reported to stderr and skipped.
+#
+# With --replay, a replay.sh script is written instead. It runs every executed
+# primitive of the log in the recorded order, one benchdnn call per layer, and
+# prints the time of each layer next to the time from the log and the total
+# time of the sequence:
+#
+#   python3 scripts/verbose_converter.py -i app.log -o app_replay --replay
+#   BENCHDNN=./build/tests/benchdnn/benchdnn sh app_replay/replay.sh
+#
+# The layers are measured in isolation: the data does not flow from one layer
+# to the next, so the cache effects between layers are not reproduced.
+
+import argparse
+import os
+import sys
+
+
+class md_t:
+    def __init__(self, s):
+        # <arg>_<dt>::<kind>:<tag>:<flags>[:...]
+        arg, rest = s.split('_', 1) if '_' in s else ('', s)
+        fields = rest.split(':')
+        self.arg = arg
+        self.dt = fields[0]
+        self.tag = fields[3] if len(fields) > 3 else 'any'
+
+
+def parse_mds(s):
+    return {md.arg: md for md in (md_t(e) for e in s.split())}
+
+
+def cfg_str(*dts):
+    if all(dt == dts[0] for dt in dts):
+        return dts[0]
+    return ''.join(dts)
+
+
+def dir_str(prop, with_bias):
+    # benchdnn has no inference with bias, training uses the same kernels
+    if prop == 'forward_inference':
+        return 'FWD_B' if with_bias else 'FWD_I'
+    if prop in ('forward_training', 'forward'):
+        return 'FWD_B' if with_bias else 'FWD_D'
+    if prop == 'backward_data':
+        return 'BWD_D'
+    if prop == 'backward_weights':
+        return 'BWD_WB' if with_bias else 'BWD_W'
+    if prop == 'backward':
+        return 'BWD_DW'
+    return None
+
+
+def scale_policy(mask):
+    return {0: 'common', 2: 'per_oc'}.get(mask, 'per_dim_%d' % mask)
+
+
+def split_attrs(attr):
+    # attributes are separated by ';' which may also appear inside quotes
+    attrs, cur, quoted = [], '', False
+    for c in attr:
+        if c == "'":
+            quoted = not quoted
+        if c == ';' and not quoted:
+            attrs.append(cur)
+            cur = ''
+        else:
+            cur += c
+    return [a for a in attrs + [cur] if a]
+
+
+def attr_opts(attr):
+    opts = []
+    for a in split_attrs(attr):
+        key, _, val = a.partition(':')
+        if key == 'oscale':
+            mask, _, scale = val.partition(':')
+            policy = scale_policy(int(mask))
+            opts.append('--attr-oscale=%s%s' %
+                        (policy, ':' + scale if scale else ''))
+        elif key == 'post_ops':
+            entries = []
+            for e in filter(None, val.strip("'").split(';')):
+                e = e.replace('eltwise_', '').replace('binary_', '')
+                entries.append(e)
+            opts.append("--attr-post-ops='%s'" % ';'.join(entries))
+        elif key == 'scales':
+            # <arg>:<mask>[:<scale>]
+            entries = []
+            for e in val.strip("'").split('_'):
+                arg, mask, scale = (e.split(':') + [''])[:3]
+                entries.append('%s:%s%s' % (arg, scale_policy(int(mask)),
+                                            ':' + scale if scale else ''))
+            opts.append('--attr-scales=%s' % '_'.join(entries))
+        elif key == 'zero_points':
+            # <arg>:<mask>:<zero point>, only common zero points are printed
+            entries = []
+            for e in val.strip("'").split('_'):
+                arg, _, zp = (e.split(':') + ['', ''])[:3]
+                entries.append('%s:%s' % (arg, zp or '*'))
+            opts.append('--attr-zero-points=%s' % '_'.join(entries))
+        elif key == 'scratchpad_mode':
+            opts.append('--attr-scratchpad=%s' % val)
+        elif key == 'fpmath_mode':
+            opts.append('--attr-fpmath=%s' % val)
+        else:
+            raise ValueError('unsupported attribute: ' + key)
+    return opts
+
+
+def aux_dict(aux):
+    return dict(e.partition(':')[::2] for e in aux.split())
+
+
+def convert_conv(prop, mds, attr, aux, prb):
+    src, wei, dst = mds['src'], mds['wei'], mds['dst']
+    opts = ['--dir=%s' % dir_str(prop, 'bia' in mds),
+            '--cfg=%s' % cfg_str(src.dt, wei.dt, dst.dt),
+            '--stag=%s' % src.tag, '--wtag=%s' % wei.tag,
+            '--dtag=%s' % dst.tag]
+    alg = aux_dict(aux).get('alg', '')
+    opts.append('--alg=%s' % alg.replace('convolution_', '').replace(
+        'deconvolution_', '').replace('winograd', 'wino'))
+    return opts + attr_opts(attr) + [prb]
+
+
+def convert_ip(prop, mds, attr, aux, prb):
+    src, wei, dst = mds['src'], mds['wei'], mds['dst']
+    opts = ['--dir=%s' % dir_str(prop, 'bia' in mds),
+            '--cfg=%s' % cfg_str(src.dt, wei.dt, dst.dt),
+            '--stag=%s' % src.tag, '--wtag=%s' % wei.tag,
+            '--dtag=%s' % dst.tag]
+    return opts + attr_opts(attr) + [prb]
+
+
+def convert_matmul(prop, mds, attr, aux, prb):
+    src, wei, dst = mds['src'], mds['wei'], mds['dst']
+    opts = ['--cfg=%s' % cfg_str(src.dt, wei.dt, dst.dt),
+            '--stag=%s' % src.tag, '--wtag=%s' % wei.tag,
+            '--dtag=%s' % dst.tag]
+    if 'bia' in mds:
+        opts.append('--bia_dt=%s' % mds['bia'].dt)
+    return opts + attr_opts(attr) + [prb]
+
+
+def convert_pool(prop, mds, attr, aux, prb):
+    src, dst = mds['src'], mds['dst']
+    algs = {'pooling_max': 'MAX',
+            'pooling_avg_include_padding': 'AVG_P',
+            'pooling_avg_exclude_padding': 'AVG_NP'}
+    opts = ['--dir=%s' % dir_str(prop, False),
+            '--cfg=%s' % cfg_str(src.dt, dst.dt), '--tag=%s' % src.tag,
+            '--alg=%s' % algs[aux_dict(aux)['alg']]]
+    return opts + attr_opts(attr) + [prb]
+
+
+def convert_reorder(prop, mds, attr, aux, prb):
+    src, dst = mds['src'], mds['dst']
+    opts = ['--sdt=%s' % src.dt, '--ddt=%s' % dst.dt,
+            '--stag=%s' % src.tag, '--dtag=%s' % dst.tag]
+    return opts + attr_opts(attr) + [prb]
+
+
+def convert_eltwise(prop, mds, attr, aux, prb):
+    data = mds['data']
+    a = aux_dict(aux)
+    alg = a['alg'].replace('eltwise_', '').replace('_use_dst_for_bwd', '_dst')
+    opts = ['--dir=%s' % dir_str(prop, False), '--dt=%s' % data.dt,
+            '--tag=%s' % data.tag, '--alg=%s' % alg,
+            '--alpha=%s' % a['alpha'], '--beta=%s' % a['beta']]
+    return opts + attr_opts(attr) + [prb]
+
+
+converters = {
+    'convolution': ('conv', convert_conv),
+    'deconvolution': ('deconv', convert_conv),
+    'inner_product': ('ip', convert_ip),
+    'matmul': ('matmul', convert_matmul),
+    'pooling': ('pool', convert_pool),
+    'eltwise': ('eltwise', convert_eltwise),
+    'reorder': ('reorder', convert_reorder),
+}
+
+
+def convert_line(line, exec_only):
+    """Returns (driver, options, time from the log) or None."""
+    fields = line.strip().split(',')
+    if len(fields) < 10 or fields[0] != 'dnnl_verbose':
+        return None
+    if not (fields[1] == 'exec'
+            or (not exec_only and fields[1].startswith('create'))):
+        return None
+    prim_kind, prop = fields[3], fields[5]
+    mds, attr, aux, prb = fields[6], fields[7], fields[8], fields[9]
+    if prim_kind not in converters:
+        print('skipping unsupported primitive: %s' % line.strip(),
+              file=sys.stderr)
+        return None
+    driver, conv_f = converters[prim_kind]
+    try:
+        opts = conv_f(prop, parse_mds(mds), attr, aux, prb)
+    except (KeyError, ValueError):
+        print('skipping malformed line: %s' % line.strip(), file=sys.stderr)
+        return None
+    log_ms = fields[10] if len(fields) > 10 else '0'
+    return driver, opts, log_ms
+
+
+def convert(lines):
+    batches = {}
+    for line in lines:
+        converted = convert_line(line, exec_only=False)
+        if converted is None:
+            continue
+        driver, opts, _ = converted
+        batch = batches.setdefault(driver, [])
+        entry = ' '.join(['--reset'] + opts)
+        if entry not in batch:
+            batch.append(entry)
+    return batches
+
+
+def replay_script(lines, times):
+    """Returns a shell script that measures the executed primitives of the
+    log one by one in the recorded order."""
+    cmds = []
+    for line in lines:
+        converted = convert_line(line, exec_only=True)
+        if converted is None:
+            continue
+        driver, opts, log_ms = converted
+        layer = len(cmds)
+        # the perf template only has ':'-separated plain tokens so that it
+        # needs no quoting and is easy to pick from the benchdnn output
+        template = 'replay:%d:%s:%%0time%%:%s' % (layer, driver, log_ms)
+        cmds.append('# %s\n"$BENCHDNN" --%s $OPTS --perf-template=%s %s' %
+                    (line.strip(), driver, template, ' '.join(opts)))
+    return '\n'.join([
+        '#!/bin/sh',
+        '# Generated by scripts/verbose_converter.py --replay',
+        'BENCHDNN=${BENCHDNN:-./benchdnn}',
+        'OPTS="--mode=P --fix-times-per-prb=%d"' % times,
+        '{',
+        '\n'.join(cmds),
+        "} | awk -F: '/^replay:/ {",
+        '    printf "layer %4d %-10s %10.4f ms (log: %s ms)\\n",',
+        '            $2, $3, $4, $5',
+        '    total += $4; log_total += $5',
+        '} END {',
+        '    printf "%-21s %10.4f ms (log: %.4f ms)\\n",',
+        '            "total", total, log_total',
+        "}'",
+        ''])
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description='Converts DNNL_VERBOSE output into benchdnn batch files.')
+    parser.add_argument('-i', '--input', default='-',
+                        help='verbose log file (default: stdin)')
+    parser.add_argument('-o', '--output', default='.',
+                        help='directory for the <driver>.in batch files')
+    parser.add_argument('-r', '--replay', action='store_true',
+                        help='write a replay.sh script that measures the '
+                        'executed primitives in the recorded order')
+    parser.add_argument('-t', '--times', type=int, default=10,
+                        help='runs per layer in the replay (default: 10)')
+    args = parser.parse_args()
+
+    f = sys.stdin if args.input == '-' else open(args.input)
+    lines = f.readlines()
+    if f is not sys.stdin:
+        f.close()
+
+    if not os.path.isdir(args.output):
+        os.makedirs(args.output)
+
+    if args.replay:
+        path = os.path.join(args.output, 'replay.sh')
+        with open(path, 'w') as out:
+            out.write(replay_script(lines, args.times))
+        print('sh %s' % path)
+        return
+
+    batches = convert(lines)
+    for driver, batch in sorted(batches.items()):
+        path = os.path.join(args.output, driver + '.in')
+        with open(path, 'w') as out:
+            out.write('\n'.join(batch) + '\n')
+        print('./benchdnn --%s --batch=%s  # %d problems' %
+              (driver, path, len(batch)))
+
+
+if __name__ == '__main__':
+    main()
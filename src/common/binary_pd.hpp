@@ -91,6 +91,10 @@ struct binary_pd_t : public primitive_desc_t {
     int n_inputs() const override { return 2 + n_binary_po_inputs(); }
     int n_outputs() const override { return 1; }
 
+    double flops() const override {
+        return (double)memory_desc_wrapper(dst_md()).nelems();
+    }
+
     const dims_t &broadcast_dims() const { return broadcast_dims_; }
 
     bool has_zero_dim_memory() const {
@@ -89,6 +89,10 @@ const alg_kind_t eltwise_clip_v2 = dnnl_eltwise_clip_v2;
 const alg_kind_t eltwise_pow = dnnl_eltwise_pow;
 const alg_kind_t eltwise_gelu_tanh = dnnl_eltwise_gelu_tanh;
 const alg_kind_t eltwise_gelu_erf = dnnl_eltwise_gelu_erf;
+const alg_kind_t eltwise_hardswish = dnnl_eltwise_hardswish;
+const alg_kind_t eltwise_hardsigmoid = dnnl_eltwise_hardsigmoid;
+const alg_kind_t eltwise_mish = dnnl_eltwise_mish;
+const alg_kind_t eltwise_selu = dnnl_eltwise_selu;
 const alg_kind_t eltwise_relu_use_dst_for_bwd
         = dnnl_eltwise_relu_use_dst_for_bwd;
 const alg_kind_t eltwise_tanh_use_dst_for_bwd
@@ -112,6 +116,7 @@ const alg_kind_t vanilla_rnn = dnnl_vanilla_rnn;
 const alg_kind_t vanilla_lstm = dnnl_vanilla_lstm;
 const alg_kind_t vanilla_gru = dnnl_vanilla_gru;
 const alg_kind_t lbr_gru = dnnl_lbr_gru;
+const alg_kind_t vanilla_augru = dnnl_vanilla_augru;
 const alg_kind_t binary_add = dnnl_binary_add;
 const alg_kind_t binary_mul = dnnl_binary_mul;
 const alg_kind_t binary_max = dnnl_binary_max;
@@ -131,6 +136,8 @@ const alg_kind_t reduction_norm_lp_power_p_max
         = dnnl_reduction_norm_lp_power_p_max;
 const alg_kind_t reduction_norm_lp_power_p_sum
         = dnnl_reduction_norm_lp_power_p_sum;
+const alg_kind_t optimizer_sgd = dnnl_optimizer_sgd;
+const alg_kind_t optimizer_adam = dnnl_optimizer_adam;
 } // namespace alg_kind
 
 using data_type_t = dnnl_data_type_t;
@@ -150,6 +157,14 @@ const scratchpad_mode_t library = dnnl_scratchpad_mode_library;
 const scratchpad_mode_t user = dnnl_scratchpad_mode_user;
 } // namespace scratchpad_mode
 
+using fpmath_mode_t = dnnl_fpmath_mode_t;
+namespace fpmath_mode {
+const fpmath_mode_t strict = dnnl_fpmath_mode_strict;
+const fpmath_mode_t bf16 = dnnl_fpmath_mode_bf16;
+const fpmath_mode_t f16 = dnnl_fpmath_mode_f16;
+const fpmath_mode_t any = dnnl_fpmath_mode_any;
+} // namespace fpmath_mode
+
 using rnn_packed_format_t = dnnl_rnn_packed_memory_format_t;
 namespace rnn_packed_format {
 const rnn_packed_format_t undef = dnnl_packed_format_undef;
@@ -165,6 +180,7 @@ const format_kind_t any = dnnl_format_kind_any;
 const format_kind_t blocked = dnnl_blocked;
 const format_kind_t wino = dnnl_format_kind_wino;
 const format_kind_t rnn_packed = dnnl_format_kind_rnn_packed;
+const format_kind_t sparse = dnnl_format_kind_sparse;
 } // namespace format_kind
 
 using format_tag_t = dnnl_format_tag_t;
@@ -431,6 +447,13 @@ const format_tag_t abDC32d4c = dnnl_abDC32d4c;
 const format_tag_t abdEc32e = dnnl_abdEc32e;
 const format_tag_t abdEC32e2c = dnnl_abdEC32e2c;
 const format_tag_t abdEC32e4c = dnnl_abdEC32e4c;
+const format_tag_t BA16a64b = dnnl_BA16a64b;
+const format_tag_t BA8a64b2a = dnnl_BA8a64b2a;
+const format_tag_t BA4a64b4a = dnnl_BA4a64b4a;
+const format_tag_t aCB16b64c = dnnl_aCB16b64c;
+const format_tag_t aCB8b64c2b = dnnl_aCB8b64c2b;
+const format_tag_t aCB4b64c4b = dnnl_aCB4b64c4b;
+const format_tag_t ABcde16b16a2b = dnnl_ABcde16b16a2b;
 
 const format_tag_t last = dnnl_format_tag_last;
 
@@ -592,6 +615,7 @@ const format_tag_t OIdhw4i16o4i = dnnl_OIdhw4i16o4i;
 const format_tag_t OIdhw4i32o4i = dnnl_OIdhw4i32o4i;
 const format_tag_t OIdhw4i64o4i = dnnl_OIdhw4i64o4i;
 const format_tag_t OIdhw16i16o4i = dnnl_OIdhw16i16o4i;
+const format_tag_t OIdhw16i16o2i = dnnl_OIdhw16i16o2i;
 const format_tag_t OIdhw2i8o4i = dnnl_OIdhw2i8o4i;
 const format_tag_t OIdhw8o16i2o = dnnl_OIdhw8o16i2o;
 const format_tag_t IOdhw8o16i2o = dnnl_IOdhw8o16i2o;
@@ -769,6 +793,9 @@ const primitive_kind_t logsoftmax = dnnl_logsoftmax;
 const primitive_kind_t matmul = dnnl_matmul;
 const primitive_kind_t resampling = dnnl_resampling;
 const primitive_kind_t reduction = dnnl_reduction;
+const primitive_kind_t embedding_bag = dnnl_embedding_bag;
+const primitive_kind_t group_normalization = dnnl_group_normalization;
+const primitive_kind_t optimizer = dnnl_optimizer;
 
 // Internal only primitive kinds.
 const primitive_kind_t internal_only_start = (primitive_kind_t)(1 << 12);
@@ -797,6 +824,9 @@ const query_t reorder_dst_engine = dnnl_query_reorder_dst_engine;
 
 const query_t prop_kind = dnnl_query_prop_kind;
 
+const query_t flops_f64 = dnnl_query_flops_f64;
+const query_t bytes_moved_s64 = dnnl_query_bytes_moved_s64;
+
 const query_t some_d = dnnl_query_some_d;
 const query_t op_d = dnnl_query_op_d;
 const query_t convolution_d = dnnl_query_convolution_d;
@@ -818,6 +848,9 @@ const query_t logsoftmax_d = dnnl_query_logsoftmax_d;
 const query_t matmul_d = dnnl_query_matmul_d;
 const query_t resampling_d = dnnl_query_resampling_d;
 const query_t reduction_d = dnnl_query_reduction_d;
+const query_t embedding_bag_d = dnnl_query_embedding_bag_d;
+const query_t group_normalization_d = dnnl_query_group_normalization_d;
+const query_t optimizer_d = dnnl_query_optimizer_d;
 
 const query_t some_md = dnnl_query_some_md;
 const query_t src_md = dnnl_query_src_md;
@@ -839,6 +872,7 @@ const query_t zero_pad_d = internal_only_start;
 using blocking_desc_t = dnnl_blocking_desc_t;
 using rnn_packed_desc_t = dnnl_rnn_packed_desc_t;
 using wino_desc_t = dnnl_wino_desc_t;
+using sparse_desc_t = dnnl_sparse_desc_t;
 using memory_extra_desc_t = dnnl_memory_extra_desc_t;
 using memory_desc_t = dnnl_memory_desc_t;
 using convolution_desc_t = dnnl_convolution_desc_t;
@@ -858,6 +892,16 @@ using logsoftmax_desc_t = dnnl_logsoftmax_desc_t;
 using matmul_desc_t = dnnl_matmul_desc_t;
 using resampling_desc_t = dnnl_resampling_desc_t;
 using reduction_desc_t = dnnl_reduction_desc_t;
+using embedding_bag_desc_t = dnnl_embedding_bag_desc_t;
+using group_normalization_desc_t = dnnl_group_normalization_desc_t;
+using optimizer_desc_t = dnnl_optimizer_desc_t;
+
+using rnn_flags_t = dnnl_rnn_flags_t;
+namespace rnn_flags {
+const rnn_flags_t undef = dnnl_rnn_flags_undef;
+const rnn_flags_t seq_lengths = dnnl_rnn_flags_seq_lengths;
+const rnn_flags_t recompute_gates = dnnl_rnn_flags_recompute_gates;
+} // namespace rnn_flags
 
 using rnn_direction_t = dnnl_rnn_direction_t;
 using rnn_desc_t = dnnl_rnn_desc_t;
@@ -900,6 +944,9 @@ struct op_desc_t {
         resampling_desc_t resampling;
         zero_pad_desc_t zero_pad;
         reduction_desc_t reduction;
+        embedding_bag_desc_t embedding_bag;
+        group_normalization_desc_t group_normalization;
+        optimizer_desc_t optimizer;
     };
 
 #define DECL_CTOR_AND_CONVERTERS(c_type) \
@@ -932,6 +979,9 @@ struct op_desc_t {
     DECL_CTOR_AND_CONVERTERS(resampling_desc_t);
     DECL_CTOR_AND_CONVERTERS(zero_pad_desc_t);
     DECL_CTOR_AND_CONVERTERS(reduction_desc_t);
+    DECL_CTOR_AND_CONVERTERS(embedding_bag_desc_t);
+    DECL_CTOR_AND_CONVERTERS(group_normalization_desc_t);
+    DECL_CTOR_AND_CONVERTERS(optimizer_desc_t);
 
     // concat_desc_t and sum_desc_t have data members which have non-trivial
     // special member functions hence the default destructor is implicitly
@@ -953,7 +1003,16 @@ namespace stream_flags {
 const stream_flags_t in_order = dnnl_stream_in_order;
 const stream_flags_t out_of_order = dnnl_stream_out_of_order;
 const stream_flags_t default_flags = dnnl_stream_default_flags;
+const stream_flags_t profiling = dnnl_stream_profiling;
 } // namespace stream_flags
+
+using profiling_data_kind_t = dnnl_profiling_data_kind_t;
+namespace profiling_data_kind {
+const profiling_data_kind_t undef = dnnl_profiling_data_kind_undef;
+const profiling_data_kind_t time = dnnl_profiling_data_kind_time;
+const profiling_data_kind_t overhead_time
+        = dnnl_profiling_data_kind_overhead_time;
+} // namespace profiling_data_kind
 using stream_t = dnnl_stream;
 
 struct memory_storage_t;
@@ -975,7 +1034,10 @@ struct deconvolution_pd_t;
 struct eltwise_bwd_pd_t;
 struct eltwise_fwd_pd_t;
 struct eltwise_pd_t;
+struct embedding_bag_pd_t;
 struct gemm_pd_t;
+struct group_normalization_fwd_pd_t;
+struct group_normalization_pd_t;
 struct inner_product_bwd_data_pd_t;
 struct inner_product_bwd_weights_pd_t;
 struct inner_product_fwd_pd_t;
@@ -987,6 +1049,7 @@ struct lrn_bwd_pd_t;
 struct lrn_fwd_pd_t;
 struct lrn_pd_t;
 struct matmul_pd_t;
+struct optimizer_pd_t;
 struct pooling_bwd_pd_t;
 struct pooling_fwd_pd_t;
 struct pooling_pd_t;
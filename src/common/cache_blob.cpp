@@ -0,0 +1,143 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#include <cstring>
+
+#include "oneapi/dnnl/dnnl_version.h"
+
+#include "cache_blob.hpp"
+
+namespace dnnl {
+namespace impl {
+
+namespace {
+
+const char magic[8] = {'D', 'N', 'N', 'L', 'C', 'B', '0', '1'};
+
+std::string version_string() {
+    return std::to_string(DNNL_VERSION_MAJOR) + "."
+            + std::to_string(DNNL_VERSION_MINOR) + "."
+            + std::to_string(DNNL_VERSION_PATCH) + ":" + DNNL_VERSION_HASH;
+}
+
+void write_bytes(uint8_t *&ptr, const void *src, size_t size) {
+    std::memcpy(ptr, src, size);
+    ptr += size;
+}
+
+bool read_bytes(const uint8_t *&ptr, const uint8_t *end, void *dst,
+        size_t size) {
+    if ((size_t)(end - ptr) < size) return false;
+    std::memcpy(dst, ptr, size);
+    ptr += size;
+    return true;
+}
+
+thread_local const cache_blob_t *active_cache_blob_ = nullptr;
+
+} // namespace
+
+uint64_t cache_blob_t::hash_key(const std::string &key) {
+    uint64_t h = 14695981039346656037ULL;
+    for (unsigned char c : key) {
+        h ^= c;
+        h *= 1099511628211ULL;
+    }
+    return h;
+}
+
+size_t cache_blob_t::serialized_size() const {
+    size_t size = sizeof(magic) + sizeof(uint64_t) + version_string().size()
+            + sizeof(uint64_t);
+    for (const auto &e : entries_)
+        size += 2 * sizeof(uint64_t) + e.second.size();
+    return size;
+}
+
+void cache_blob_t::serialize(uint8_t *data) const {
+    const std::string version = version_string();
+    const uint64_t version_size = version.size();
+    const uint64_t nentries = entries_.size();
+
+    write_bytes(data, magic, sizeof(magic));
+    write_bytes(data, &version_size, sizeof(version_size));
+    write_bytes(data, version.data(), version.size());
+    write_bytes(data, &nentries, sizeof(nentries));
+    for (const auto &e : entries_) {
+        const uint64_t binary_size = e.second.size();
+        write_bytes(data, &e.first, sizeof(e.first));
+        write_bytes(data, &binary_size, sizeof(binary_size));
+        write_bytes(data, e.second.data(), e.second.size());
+    }
+}
+
+status_t cache_blob_t::deserialize(const uint8_t *data, size_t size) {
+    const uint8_t *end = data + size;
+    entries_.clear();
+
+    char m[sizeof(magic)];
+    if (!read_bytes(data, end, m, sizeof(m))
+            || std::memcmp(m, magic, sizeof(magic)) != 0)
+        return status::invalid_arguments;
+
+    const std::string version = version_string();
+    uint64_t version_size = 0;
+    if (!read_bytes(data, end, &version_size, sizeof(version_size))
+            || version_size != version.size())
+        return status::invalid_arguments;
+    std::string stored_version(version_size, '\0');
+    if (!read_bytes(data, end, &stored_version[0], version_size)
+            || stored_version != version)
+        return status::invalid_arguments;
+
+    uint64_t nentries = 0;
+    if (!read_bytes(data, end, &nentries, sizeof(nentries)))
+        return status::invalid_arguments;
+    for (uint64_t i = 0; i < nentries; i++) {
+        uint64_t key_hash = 0, binary_size = 0;
+        if (!read_bytes(data, end, &key_hash, sizeof(key_hash))
+                || !read_bytes(data, end, &binary_size, sizeof(binary_size))
+                || (uint64_t)(end - data) < binary_size) {
+            entries_.clear();
+            return status::invalid_arguments;
+        }
+        entries_.emplace(key_hash,
+                std::vector<unsigned char>(data, data + binary_size));
+        data += binary_size;
+    }
+    if (data != end) {
+        entries_.clear();
+        return status::invalid_arguments;
+    }
+    return status::success;
+}
+
+const cache_blob_t *active_cache_blob() {
+    return active_cache_blob_;
+}
+
+cache_blob_guard_t::cache_blob_guard_t(const cache_blob_t *cache_blob)
+    : prev_(active_cache_blob_) {
+    active_cache_blob_ = cache_blob;
+}
+
+cache_blob_guard_t::~cache_blob_guard_t() {
+    active_cache_blob_ = prev_;
+}
+
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,84 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#ifndef COMMON_CACHE_BLOB_HPP
+#define COMMON_CACHE_BLOB_HPP
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "c_types_map.hpp"
+#include "utils.hpp"
+
+namespace dnnl {
+namespace impl {
+
+// Program binaries of a primitive, indexed by a hash of the key they were
+// built with (the device, the driver, the build options and the source, as
+// for the persistent cache). A primitive is serialized into a cache blob with
+// dnnl_primitive_get_cache_blob(), and the primitives created while the
+// cache blob is active (see cache_blob_guard_t) take the binaries from it
+// instead of building them. A binary that is missing from the cache blob,
+// e.g. because the blob was created for another device, is built as usual.
+struct cache_blob_t {
+    // 64-bit FNV-1a, stable across standard library implementations.
+    static uint64_t hash_key(const std::string &key);
+
+    void add(uint64_t key_hash, const std::vector<unsigned char> &binary) {
+        if (binary.empty()) return;
+        entries_.emplace(key_hash, binary);
+    }
+
+    const std::vector<unsigned char> *find(uint64_t key_hash) const {
+        auto it = entries_.find(key_hash);
+        return it == entries_.end() ? nullptr : &it->second;
+    }
+
+    bool empty() const { return entries_.empty(); }
+
+    // The serialized cache blob starts with a magic and the library version,
+    // so that a blob created by another build of the library is rejected.
+    size_t serialized_size() const;
+    void serialize(uint8_t *data) const;
+    status_t deserialize(const uint8_t *data, size_t size);
+
+private:
+    std::map<uint64_t, std::vector<unsigned char>> entries_;
+};
+
+// Returns the cache blob of the primitive being created by the calling
+// thread, if any.
+const cache_blob_t *active_cache_blob();
+
+// Makes a cache blob active for the primitives, including the nested ones,
+// created by the calling thread within the scope of the guard.
+struct cache_blob_guard_t {
+    cache_blob_guard_t(const cache_blob_t *cache_blob);
+    ~cache_blob_guard_t();
+
+private:
+    const cache_blob_t *prev_;
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(cache_blob_guard_t);
+};
+
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -86,6 +86,15 @@ struct concat_pd_t : public primitive_desc_t {
         return index < n_inputs() ? &src_image_mds_[index] : &glob_zero_md;
     }
 
+    /* returns true if the src is described exactly as its image in the dst,
+     * i.e. the src may be a sub-memory of the dst created by the user with
+     * dnnl_memory_desc_init_submemory() and written in place by the producer
+     */
+    bool is_src_image(int index) const {
+        return index < (int)src_image_mds_.size()
+                && src_mds_[index] == src_image_mds_[index];
+    }
+
 protected:
     int n_, concat_dim_;
     memory_desc_t dst_md_;
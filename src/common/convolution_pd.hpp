@@ -71,6 +71,11 @@ struct convolution_pd_t : public primitive_desc_t {
         return status::success;
     }
 
+    double flops() const override {
+        return 2.0 * MB() * OC() * (IC() / G()) * OD() * OH() * OW() * KD()
+                * KH() * KW();
+    }
+
     /* common conv aux functions */
 
     dim_t MB() const { return invariant_src_md()->dims[0]; }
@@ -248,9 +253,16 @@ struct convolution_fwd_pd_t : public convolution_pd_t {
         , dst_md_(desc_.dst_desc) {}
 
     arg_usage_t arg_usage(int arg) const override {
-        if (utils::one_of(arg, DNNL_ARG_SRC, DNNL_ARG_WEIGHTS))
+        if (arg == DNNL_ARG_SRC)
+            return with_src_concat() ? arg_usage_t::unused
+                                     : arg_usage_t::input;
+
+        if (arg >= DNNL_ARG_MULTIPLE_SRC
+                && arg < DNNL_ARG_MULTIPLE_SRC + n_src_concat())
             return arg_usage_t::input;
 
+        if (arg == DNNL_ARG_WEIGHTS) return arg_usage_t::input;
+
         if (arg == DNNL_ARG_BIAS && with_bias()) return arg_usage_t::input;
 
         if (arg == DNNL_ARG_DST) return arg_usage_t::output;
@@ -259,6 +271,10 @@ struct convolution_fwd_pd_t : public convolution_pd_t {
     }
 
     const memory_desc_t *arg_md(int arg) const override {
+        if (arg >= DNNL_ARG_MULTIPLE_SRC
+                && arg < DNNL_ARG_MULTIPLE_SRC + n_src_concat())
+            return src_concat_md(arg - DNNL_ARG_MULTIPLE_SRC);
+
         switch (arg) {
             case DNNL_ARG_SRC: return src_md(0);
             case DNNL_ARG_WEIGHTS: return weights_md(0);
@@ -282,17 +298,48 @@ struct convolution_fwd_pd_t : public convolution_pd_t {
 
     int n_inputs() const override {
         return 2 + with_bias() + attr_post_op_dw_inputs()
-                + n_binary_po_inputs();
+                + n_binary_po_inputs()
+                + (with_src_concat() ? n_src_concat() - 1 : 0);
     }
 
     int n_outputs() const override { return 1; }
 
+    bool with_src_concat() const {
+        return !attr_.src_concat_.has_default_values();
+    }
+    int n_src_concat() const { return attr_.src_concat_.nsrcs(); }
+
+    /** returns the memory descriptor of the i-th of the sources that are
+     * read as the src concatenated along the channels */
+    const memory_desc_t *src_concat_md(int index) const {
+        return index < (int)src_concat_mds_.size() ? &src_concat_mds_[index]
+                                                   : &glob_zero_md;
+    }
+
 protected:
     memory_desc_t src_md_;
     memory_desc_t weights_md_;
     memory_desc_t bias_md_;
     memory_desc_t dst_md_;
 
+    /* the sources of the src concat have the blocking of the src. An
+     * implementation that supports the attribute must call this once the
+     * format of the src is set. */
+    std::vector<memory_desc_t> src_concat_mds_;
+
+    status_t init_src_concat_mds() {
+        const auto &channels = attr_.src_concat_.channels_;
+        src_concat_mds_.resize(channels.size());
+        for (size_t i = 0; i < channels.size(); ++i) {
+            auto &md = src_concat_mds_[i];
+            md = src_md_;
+            md.dims[1] = md.padded_dims[1] = channels[i];
+            CHECK(memory_desc_init_by_blocking_desc(
+                    md, src_md_.format_desc.blocking));
+        }
+        return status::success;
+    }
+
     bool set_default_formats_common(
             format_tag_t src_tag, format_tag_t wei_tag, format_tag_t dst_tag) {
         return set_default_formats_common_template(src_md_, src_tag,
@@ -57,6 +57,11 @@ struct deconvolution_pd_t : public primitive_desc_t {
         return status::success;
     }
 
+    double flops() const override {
+        return 2.0 * MB() * IC() * (OC() / G()) * ID() * IH() * IW() * KD()
+                * KH() * KW();
+    }
+
     /* common deconv aux functions (note that conv_desc_t == deconv_desc_t) */
 
     dim_t MB() const { return invariant_src_md()->dims[0]; }
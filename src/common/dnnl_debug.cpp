@@ -81,7 +81,10 @@ int dnnl_md2fmt_str(
 
     DPRINT("%s:", dnnl_fmt_kind2str(md.format_kind()));
 
-    if (!md.is_blocking_desc()) {
+    if (md.is_sparse_desc()) {
+        const auto &sd = md.sparse_desc();
+        DPRINT("%dx%d:", (int)sd.block_dims[0], (int)sd.block_dims[1]);
+    } else if (!md.is_blocking_desc()) {
         /* TODO: extend */
         DPRINT("%s:", "");
     } else {
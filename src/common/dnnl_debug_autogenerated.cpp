@@ -53,6 +53,7 @@ const char *dnnl_fmt_kind2str(dnnl_format_kind_t v) {
     if (v == dnnl_blocked) return "blocked";
     if (v == dnnl_format_kind_wino) return "wino";
     if (v == dnnl_format_kind_rnn_packed) return "rnn_packed";
+    if (v == dnnl_format_kind_sparse) return "sparse";
     assert(!"unknown fmt_kind");
     return "unknown fmt_kind";
 }
@@ -320,6 +321,13 @@ const char *dnnl_fmt_tag2str(dnnl_format_tag_t v) {
     if (v == dnnl_abdEc32e) return "abdEc32e";
     if (v == dnnl_abdEC32e2c) return "abdEC32e2c";
     if (v == dnnl_abdEC32e4c) return "abdEC32e4c";
+    if (v == dnnl_BA16a64b) return "BA16a64b";
+    if (v == dnnl_BA8a64b2a) return "BA8a64b2a";
+    if (v == dnnl_BA4a64b4a) return "BA4a64b4a";
+    if (v == dnnl_aCB16b64c) return "aCB16b64c";
+    if (v == dnnl_aCB8b64c2b) return "aCB8b64c2b";
+    if (v == dnnl_aCB4b64c4b) return "aCB4b64c4b";
+    if (v == dnnl_ABcde16b16a2b) return "ABcde16b16a2b";
     if (v == dnnl_format_tag_last) return "format_tag_last";
     if (v == dnnl_x) return "x";
     if (v == dnnl_nc) return "nc";
@@ -483,6 +491,7 @@ const char *dnnl_fmt_tag2str(dnnl_format_tag_t v) {
     if (v == dnnl_OIdhw4i32o4i) return "OIdhw4i32o4i";
     if (v == dnnl_OIdhw4i64o4i) return "OIdhw4i64o4i";
     if (v == dnnl_OIdhw16i16o4i) return "OIdhw16i16o4i";
+    if (v == dnnl_OIdhw16i16o2i) return "OIdhw16i16o2i";
     if (v == dnnl_OIdhw2i8o4i) return "OIdhw2i8o4i";
     if (v == dnnl_OIdhw8o8i) return "OIdhw8o8i";
     if (v == dnnl_OIdhw8o4i) return "OIdhw8o4i";
@@ -634,6 +643,9 @@ const char *dnnl_prim_kind2str(dnnl_primitive_kind_t v) {
     if (v == dnnl_pooling_v2) return "pooling_v2";
     if (v == dnnl_reduction) return "reduction";
     if (v == dnnl_prelu) return "prelu";
+    if (v == dnnl_embedding_bag) return "embedding_bag";
+    if (v == dnnl_group_normalization) return "group_normalization";
+    if (v == dnnl_optimizer) return "optimizer";
     if (v == dnnl_primitive_kind_max) return "primitive_kind_max";
     assert(!"unknown prim_kind");
     return "unknown prim_kind";
@@ -667,6 +679,10 @@ const char *dnnl_alg_kind2str(dnnl_alg_kind_t v) {
     if (v == dnnl_eltwise_gelu_erf) return "eltwise_gelu_erf";
     if (v == dnnl_eltwise_round) return "eltwise_round";
     if (v == dnnl_eltwise_logsigmoid) return "eltwise_logsigmoid";
+    if (v == dnnl_eltwise_hardswish) return "eltwise_hardswish";
+    if (v == dnnl_eltwise_hardsigmoid) return "eltwise_hardsigmoid";
+    if (v == dnnl_eltwise_mish) return "eltwise_mish";
+    if (v == dnnl_eltwise_selu) return "eltwise_selu";
     if (v == dnnl_eltwise_relu_use_dst_for_bwd) return "eltwise_relu_use_dst_for_bwd";
     if (v == dnnl_eltwise_tanh_use_dst_for_bwd) return "eltwise_tanh_use_dst_for_bwd";
     if (v == dnnl_eltwise_elu_use_dst_for_bwd) return "eltwise_elu_use_dst_for_bwd";
@@ -684,6 +700,7 @@ const char *dnnl_alg_kind2str(dnnl_alg_kind_t v) {
     if (v == dnnl_vanilla_lstm) return "vanilla_lstm";
     if (v == dnnl_vanilla_gru) return "vanilla_gru";
     if (v == dnnl_lbr_gru) return "lbr_gru";
+    if (v == dnnl_vanilla_augru) return "vanilla_augru";
     if (v == dnnl_binary_add) return "binary_add";
     if (v == dnnl_binary_mul) return "binary_mul";
     if (v == dnnl_binary_max) return "binary_max";
@@ -701,12 +718,16 @@ const char *dnnl_alg_kind2str(dnnl_alg_kind_t v) {
     if (v == dnnl_reduction_norm_lp_sum) return "reduction_norm_lp_sum";
     if (v == dnnl_reduction_norm_lp_power_p_max) return "reduction_norm_lp_power_p_max";
     if (v == dnnl_reduction_norm_lp_power_p_sum) return "reduction_norm_lp_power_p_sum";
+    if (v == dnnl_optimizer_sgd) return "optimizer_sgd";
+    if (v == dnnl_optimizer_adam) return "optimizer_adam";
     assert(!"unknown alg_kind");
     return "unknown alg_kind";
 }
 
 const char *dnnl_rnn_flags2str(dnnl_rnn_flags_t v) {
     if (v == dnnl_rnn_flags_undef) return "undef";
+    if (v == dnnl_rnn_flags_seq_lengths) return "seq_lengths";
+    if (v == dnnl_rnn_flags_recompute_gates) return "recompute_gates";
     assert(!"unknown rnn_flags");
     return "unknown rnn_flags";
 }
@@ -736,6 +757,15 @@ const char *dnnl_scratchpad_mode2str(dnnl_scratchpad_mode_t v) {
     return "unknown scratchpad_mode";
 }
 
+const char *dnnl_fpmath_mode2str(dnnl_fpmath_mode_t v) {
+    if (v == dnnl_fpmath_mode_strict) return "strict";
+    if (v == dnnl_fpmath_mode_bf16) return "bf16";
+    if (v == dnnl_fpmath_mode_f16) return "f16";
+    if (v == dnnl_fpmath_mode_any) return "any";
+    assert(!"unknown fpmath_mode");
+    return "unknown fpmath_mode";
+}
+
 const char *dnnl_cpu_isa2str(dnnl_cpu_isa_t v) {
     if (v == dnnl_cpu_isa_all) return "cpu_isa_all";
     if (v == dnnl_cpu_isa_sse41) return "cpu_isa_sse41";
@@ -18,6 +18,7 @@
 #define COMMON_DNNL_THREAD_HPP
 
 #include <algorithm>
+#include <atomic>
 
 #include "utils.hpp"
 #include "z_magic.hpp"
@@ -84,6 +85,37 @@ void deactivate_threadpool();
 // Returns the active threadpool for the calling thread.
 dnnl::threadpool_interop::threadpool_iface *get_active_threadpool();
 
+// Barrier for the closures of a single parallel region. Only usable when the
+// threadpool runs all the closures concurrently (see
+// threadpool_iface::CONCURRENT_CLOSURES).
+struct thr_barrier_t {
+    thr_barrier_t(int nthr) : nthr_(nthr), count_(0), generation_(0) {}
+
+    void wait() {
+        const unsigned gen = generation_.load(std::memory_order_acquire);
+        if (count_.fetch_add(1, std::memory_order_acq_rel) + 1 == nthr_) {
+            count_.store(0, std::memory_order_relaxed);
+            generation_.fetch_add(1, std::memory_order_release);
+            return;
+        }
+        while (generation_.load(std::memory_order_acquire) == gen)
+            std::this_thread::yield();
+    }
+
+private:
+    const int nthr_;
+    std::atomic<int> count_;
+    std::atomic<unsigned> generation_;
+};
+
+// Sets the barrier of the synchronized parallel region the calling thread
+// executes a closure of, nullptr outside of such a region.
+void set_active_barrier(thr_barrier_t *barrier);
+
+// Returns the barrier of the synchronized parallel region of the calling
+// thread.
+thr_barrier_t *get_active_barrier();
+
 } // namespace threadpool_utils
 } // namespace impl
 } // namespace dnnl
@@ -101,11 +133,15 @@ inline int dnnl_get_max_threads() {
 }
 inline int dnnl_in_parallel() {
     using namespace dnnl::impl::threadpool_utils;
+    if (get_active_barrier() != nullptr) return 1;
     dnnl::threadpool_interop::threadpool_iface *tp = get_active_threadpool();
     return tp ? tp->get_in_parallel() : 0;
 }
 inline void dnnl_thr_barrier() {
-    assert(!"no barrier with THREADPOOL");
+    using namespace dnnl::impl::threadpool_utils;
+    // A region of a single thread has no barrier
+    thr_barrier_t *barrier = get_active_barrier();
+    if (barrier) barrier->wait();
 }
 #endif
 
@@ -137,6 +173,18 @@ inline int dnnl_get_current_num_threads() {
 #endif
 }
 
+/* The number of threads to execute a primitive with, when its work
+ * partitioning was planned for nthr_plan threads at creation. The primitive
+ * may be executed with fewer threads than it was created with (e.g. after
+ * omp_set_num_threads() or with a smaller threadpool); running nthr_plan
+ * threads would then oversubscribe the cores or execute the parallel section
+ * in several waves. Drivers that recompute their partitioning from the
+ * actual number of threads use this value instead of nthr_plan. */
+inline int dnnl_get_exec_num_threads(int nthr_plan) {
+    const int nthr_cur = dnnl_get_current_num_threads();
+    return (nthr_plan == 0 || nthr_plan > nthr_cur) ? nthr_cur : nthr_plan;
+}
+
 #if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP
 #define PRAGMA_OMP(...) PRAGMA_MACRO(CHAIN2(omp, __VA_ARGS__))
 #define OMP_GET_THREAD_NUM() omp_get_thread_num()
@@ -171,7 +219,20 @@ namespace dnnl {
 namespace impl {
 
 inline bool dnnl_thr_syncable() {
+#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_THREADPOOL
+    // True both inside a synchronized region and on the thread that is about
+    // to start one, so that the drivers take the same decision on each side
+    // of parallel()
+    using namespace threadpool_utils;
+    if (get_active_barrier() != nullptr) return true;
+    dnnl::threadpool_interop::threadpool_iface *tp = get_active_threadpool();
+    return tp && !tp->get_in_parallel()
+            && (tp->get_flags()
+                    & dnnl::threadpool_interop::threadpool_iface::
+                            CONCURRENT_CLOSURES);
+#else
     return DNNL_THR_SYNC == 1;
+#endif
 }
 
 template <typename T, typename U>
@@ -36,6 +36,9 @@
  *  - parallel_nd_in_omp(dims..., f)     - queries current nthr and ithr and
  *                                         then calls for_nd (mostly for
  *                                         convenience)
+ *  - parallel_nd_dynamic(dims..., f)    - same as parallel_nd, but the work
+ *                                         is distributed dynamically in
+ *                                         chunks instead of statically
  */
 
 #if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_THREADPOOL
@@ -50,6 +53,11 @@ inline int adjust_num_threads(int nthr, size_t work_amount) {
     if (nthr == 0) nthr = dnnl_get_current_num_threads();
 #if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP
     return (work_amount == 1 || omp_in_parallel()) ? 1 : nthr;
+#elif DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_THREADPOOL
+    // As with OpenMP, a region nested in a synchronized one is executed by
+    // the calling thread alone
+    if (threadpool_utils::get_active_barrier() != nullptr) return 1;
+    return (int)std::min((size_t)nthr, work_amount);
 #else
     return (int)std::min((size_t)nthr, work_amount);
 #endif
@@ -89,14 +97,21 @@ void parallel(int nthr, F f) {
             f(ithr, nthr);
         threadpool_utils::activate_threadpool(tp);
     } else {
-        bool async = tp->get_flags()
-                & dnnl::threadpool_interop::threadpool_iface::ASYNCHRONOUS;
+        using tp_iface = dnnl::threadpool_interop::threadpool_iface;
+        bool async = tp->get_flags() & tp_iface::ASYNCHRONOUS;
+        // With concurrent closures the phases of a primitive are separated
+        // by dnnl_thr_barrier() instead of separate parallel() calls
+        bool sync = tp->get_flags() & tp_iface::CONCURRENT_CLOSURES;
         counting_barrier_t b;
         if (async) b.init(nthr);
-        tp->parallel_for(nthr, [tp, &f, &b, async](int ithr, int nthr) {
+        thr_barrier_t thr_barrier(nthr);
+        tp->parallel_for(nthr, [tp, &f, &b, &thr_barrier, async, sync](
+                                       int ithr, int nthr) {
             bool is_master = threadpool_utils::get_active_threadpool() == tp;
             if (!is_master) threadpool_utils::activate_threadpool(tp);
+            if (sync) threadpool_utils::set_active_barrier(&thr_barrier);
             f(ithr, nthr);
+            if (sync) threadpool_utils::set_active_barrier(nullptr);
             if (!is_master) threadpool_utils::deactivate_threadpool();
             if (async) b.notify();
         });
@@ -448,6 +463,150 @@ void parallel_nd(const T0 &D0, const T1 &D1, const T2 &D2, const T3 &D3,
         });
 }
 
+/* parallel_nd_dynamic section */
+
+// Dynamic scheduling: the flattened iteration space is split into chunks
+// that the threads claim one by one through an atomic counter. A thread that
+// is done with its chunk takes the next available one, so threads that are
+// faster (e.g. not sharing a core or not preempted) take over the work of the
+// slower ones instead of waiting for them at the end of the parallel section.
+// This is beneficial when the cost of an iteration varies or when the threads
+// do not run at the same speed, at the price of an atomic operation per chunk
+// and of a less predictable mapping of the data to the threads.
+template <typename F>
+void parallel_dynamic(size_t work_amount, F f) {
+    const int nthr
+            = adjust_num_threads(dnnl_get_current_num_threads(), work_amount);
+    if (nthr == 0 || work_amount == 0) return;
+    if (nthr == 1) {
+        f((size_t)0, work_amount);
+        return;
+    }
+
+    // Several chunks per thread are enough to compensate for an imbalance
+    // while keeping the contention on the counter low
+    const size_t chunks_per_thr = 8;
+    const size_t chunk = utils::div_up(work_amount, nthr * chunks_per_thr);
+    std::atomic<size_t> next_chunk_start(0);
+    parallel(nthr, [&](int, int) {
+        for (size_t start = next_chunk_start.fetch_add(chunk);
+                start < work_amount;
+                start = next_chunk_start.fetch_add(chunk))
+            f(start, std::min(start + chunk, work_amount));
+    });
+}
+
+// Dynamically scheduled counterpart of parallel(nthr, f) for the drivers that
+// partition their work with balance211(..., nthr, ithr, ...): f is called for
+// several "virtual" threads per actual thread, and the virtual threads are
+// claimed dynamically. f must not rely on ithr to address per-thread state.
+template <typename F>
+void parallel_dynamic_ithr(int nthr, F f) {
+    if (nthr == 0) nthr = dnnl_get_current_num_threads();
+    const int chunks_per_thr = 8;
+    const int nthr_virt = nthr == 1 ? 1 : nthr * chunks_per_thr;
+    parallel_dynamic((size_t)nthr_virt, [&](size_t start, size_t end) {
+        for (size_t ithr = start; ithr < end; ++ithr)
+            f((int)ithr, nthr_virt);
+    });
+}
+
+template <typename T0, typename F>
+void parallel_nd_dynamic(const T0 &D0, F f) {
+    const size_t work_amount = (size_t)D0;
+    parallel_dynamic(work_amount, [&](size_t start, size_t end) {
+        for (size_t iwork = start; iwork < end; ++iwork)
+            f((T0)iwork);
+    });
+}
+
+template <typename T0, typename T1, typename F>
+void parallel_nd_dynamic(const T0 &D0, const T1 &D1, F f) {
+    const size_t work_amount = (size_t)D0 * D1;
+    parallel_dynamic(work_amount, [&](size_t start, size_t end) {
+        T0 d0 {0};
+        T1 d1 {0};
+        utils::nd_iterator_init(start, d0, D0, d1, D1);
+        for (size_t iwork = start; iwork < end; ++iwork) {
+            f(d0, d1);
+            utils::nd_iterator_step(d0, D0, d1, D1);
+        }
+    });
+}
+
+template <typename T0, typename T1, typename T2, typename F>
+void parallel_nd_dynamic(const T0 &D0, const T1 &D1, const T2 &D2, F f) {
+    const size_t work_amount = (size_t)D0 * D1 * D2;
+    parallel_dynamic(work_amount, [&](size_t start, size_t end) {
+        T0 d0 {0};
+        T1 d1 {0};
+        T2 d2 {0};
+        utils::nd_iterator_init(start, d0, D0, d1, D1, d2, D2);
+        for (size_t iwork = start; iwork < end; ++iwork) {
+            f(d0, d1, d2);
+            utils::nd_iterator_step(d0, D0, d1, D1, d2, D2);
+        }
+    });
+}
+
+template <typename T0, typename T1, typename T2, typename T3, typename F>
+void parallel_nd_dynamic(
+        const T0 &D0, const T1 &D1, const T2 &D2, const T3 &D3, F f) {
+    const size_t work_amount = (size_t)D0 * D1 * D2 * D3;
+    parallel_dynamic(work_amount, [&](size_t start, size_t end) {
+        T0 d0 {0};
+        T1 d1 {0};
+        T2 d2 {0};
+        T3 d3 {0};
+        utils::nd_iterator_init(start, d0, D0, d1, D1, d2, D2, d3, D3);
+        for (size_t iwork = start; iwork < end; ++iwork) {
+            f(d0, d1, d2, d3);
+            utils::nd_iterator_step(d0, D0, d1, D1, d2, D2, d3, D3);
+        }
+    });
+}
+
+template <typename T0, typename T1, typename T2, typename T3, typename T4,
+        typename F>
+void parallel_nd_dynamic(const T0 &D0, const T1 &D1, const T2 &D2,
+        const T3 &D3, const T4 &D4, F f) {
+    const size_t work_amount = (size_t)D0 * D1 * D2 * D3 * D4;
+    parallel_dynamic(work_amount, [&](size_t start, size_t end) {
+        T0 d0 {0};
+        T1 d1 {0};
+        T2 d2 {0};
+        T3 d3 {0};
+        T4 d4 {0};
+        utils::nd_iterator_init(start, d0, D0, d1, D1, d2, D2, d3, D3, d4, D4);
+        for (size_t iwork = start; iwork < end; ++iwork) {
+            f(d0, d1, d2, d3, d4);
+            utils::nd_iterator_step(d0, D0, d1, D1, d2, D2, d3, D3, d4, D4);
+        }
+    });
+}
+
+template <typename T0, typename T1, typename T2, typename T3, typename T4,
+        typename T5, typename F>
+void parallel_nd_dynamic(const T0 &D0, const T1 &D1, const T2 &D2,
+        const T3 &D3, const T4 &D4, const T5 &D5, F f) {
+    const size_t work_amount = (size_t)D0 * D1 * D2 * D3 * D4 * D5;
+    parallel_dynamic(work_amount, [&](size_t start, size_t end) {
+        T0 d0 {0};
+        T1 d1 {0};
+        T2 d2 {0};
+        T3 d3 {0};
+        T4 d4 {0};
+        T5 d5 {0};
+        utils::nd_iterator_init(
+                start, d0, D0, d1, D1, d2, D2, d3, D3, d4, D4, d5, D5);
+        for (size_t iwork = start; iwork < end; ++iwork) {
+            f(d0, d1, d2, d3, d4, d5);
+            utils::nd_iterator_step(
+                    d0, D0, d1, D1, d2, D2, d3, D3, d4, D4, d5, D5);
+        }
+    });
+}
+
 /* parallel_nd_in_omp section */
 
 template <typename... Args>
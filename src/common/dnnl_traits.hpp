@@ -130,6 +130,9 @@ PKIND_TRAITS_INST(logsoftmax);
 PKIND_TRAITS_INST(matmul);
 PKIND_TRAITS_INST(resampling);
 PKIND_TRAITS_INST(reduction);
+PKIND_TRAITS_INST(embedding_bag);
+PKIND_TRAITS_INST(group_normalization);
+PKIND_TRAITS_INST(optimizer);
 #undef PKIND_TRAITS_INST
 
 } // namespace impl
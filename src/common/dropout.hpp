@@ -0,0 +1,91 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_DROPOUT_HPP
+#define COMMON_DROPOUT_HPP
+
+#include <math.h>
+#include <stdint.h>
+
+#include "c_types_map.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace dropout {
+
+// The dropout mask is a counter-based hash of the physical offset of an
+// element in the destination, so that it can be generated in any order, by
+// any number of threads, and regenerated on backward from the seed alone.
+// The hash is the finalizer of MurmurHash3 applied to
+// `offset * golden_ratio + mixed_seed`: every step is a 32-bit integer
+// operation that vectorizes as is, and the jit kernels must follow it
+// exactly.
+constexpr uint32_t golden_ratio = 0x9e3779b9u;
+constexpr uint32_t fmix_mul_1 = 0x85ebca6bu;
+constexpr uint32_t fmix_mul_2 = 0xc2b2ae35u;
+
+inline uint32_t fmix32(uint32_t x) {
+    x ^= x >> 16;
+    x *= fmix_mul_1;
+    x ^= x >> 13;
+    x *= fmix_mul_2;
+    x ^= x >> 16;
+    return x;
+}
+
+struct params_t {
+    uint32_t seed; // the user seed mixed once, so that close seeds diverge
+    // an element is kept iff the top 31 bits of its hash, as a signed
+    // integer, are greater than keep_above; p == 1 drops everything
+    int32_t keep_above;
+    float scale; // 1 / (1 - p) for the kept elements
+};
+
+inline status_t init_params(params_t &p, float probability, int32_t seed) {
+    if (!(probability >= 0.f && probability <= 1.f))
+        return status::invalid_arguments;
+    const double threshold = nearbyint((double)probability * (1u << 31));
+    p.seed = fmix32((uint32_t)seed);
+    p.keep_above = (int32_t)(threshold - 1);
+    p.scale = probability < 1.f ? 1.f / (1.f - probability) : 0.f;
+    return status::success;
+}
+
+inline bool keep(const params_t &p, dim_t off) {
+    const uint32_t x = fmix32((uint32_t)off * golden_ratio + p.seed);
+    return (int32_t)(x >> 1) > p.keep_above;
+}
+
+inline float apply(const params_t &p, dim_t off, float v) {
+    return keep(p, off) ? v * p.scale : 0.f;
+}
+
+// Bit `i % 8` of byte `i / 8` of the mask is set iff the element at offset
+// `i` is kept.
+inline uint8_t mask_byte(const params_t &p, dim_t byte_idx) {
+    uint8_t byte = 0;
+    for (int b = 0; b < 8; ++b)
+        if (keep(p, byte_idx * 8 + b)) byte |= (uint8_t)(1u << b);
+    return byte;
+}
+
+} // namespace dropout
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -55,6 +55,10 @@ struct eltwise_pd_t : public primitive_desc_t {
         return status::success;
     }
 
+    double flops() const override {
+        return (double)memory_desc_wrapper(data_desc()).nelems();
+    }
+
     /* common eltwise aux functions */
 
     dim_t MB() const { return data_desc().dims[0]; }
@@ -137,7 +141,8 @@ struct eltwise_fwd_pd_t : public eltwise_pd_t {
         return one_of(alg, eltwise_relu, eltwise_tanh, eltwise_elu,
                        eltwise_square, eltwise_abs, eltwise_sqrt, eltwise_swish,
                        eltwise_bounded_relu, eltwise_gelu_tanh,
-                       eltwise_gelu_erf, eltwise_round)
+                       eltwise_gelu_erf, eltwise_round, eltwise_hardswish,
+                       eltwise_mish, eltwise_selu)
                 || one_of(alg, eltwise_relu_use_dst_for_bwd,
                         eltwise_tanh_use_dst_for_bwd,
                         eltwise_elu_use_dst_for_bwd,
@@ -145,6 +150,7 @@ struct eltwise_fwd_pd_t : public eltwise_pd_t {
                 || (one_of(alg, eltwise_clip, eltwise_clip_v2) && alpha <= 0
                         && beta >= 0)
                 || (alg == eltwise_linear && beta == 0)
+                || (alg == eltwise_hardsigmoid && beta <= 0)
                 || (alg == eltwise_pow && beta > 0);
     }
 
@@ -218,7 +224,8 @@ struct eltwise_bwd_pd_t : public eltwise_pd_t {
                        eltwise_gelu_erf, eltwise_gelu_tanh, eltwise_linear,
                        eltwise_logistic, eltwise_logsigmoid, eltwise_relu,
                        eltwise_soft_relu, eltwise_square, eltwise_swish,
-                       eltwise_tanh)
+                       eltwise_tanh, eltwise_hardswish, eltwise_hardsigmoid,
+                       eltwise_mish, eltwise_selu)
                 || one_of(alg, eltwise_elu_use_dst_for_bwd,
                         eltwise_exp_use_dst_for_bwd,
                         eltwise_logistic_use_dst_for_bwd,
@@ -0,0 +1,88 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dnnl/dnnl.h"
+
+#include "c_types_map.hpp"
+#include "type_helpers.hpp"
+#include "utils.hpp"
+
+using namespace dnnl::impl;
+using namespace dnnl::impl::utils;
+using namespace dnnl::impl::status;
+using namespace dnnl::impl::prop_kind;
+using namespace dnnl::impl::alg_kind;
+using namespace dnnl::impl::types;
+
+dnnl_status_t dnnl_embedding_bag_forward_desc_init(
+        dnnl_embedding_bag_desc_t *desc, dnnl_prop_kind_t prop_kind,
+        dnnl_alg_kind_t alg_kind, const dnnl_memory_desc_t *indices_desc,
+        const dnnl_memory_desc_t *offsets_desc,
+        const dnnl_memory_desc_t *table_desc,
+        const dnnl_memory_desc_t *scale_shift_desc,
+        const dnnl_memory_desc_t *dst_desc) {
+    bool args_ok
+            = !any_null(desc, indices_desc, offsets_desc, table_desc, dst_desc)
+            && one_of(prop_kind, forward_training, forward_inference)
+            && one_of(alg_kind, reduction_sum, reduction_mean);
+    if (!args_ok) return invalid_arguments;
+
+    const bool is_quantized
+            = one_of(table_desc->data_type, data_type::s8, data_type::u8);
+    const bool with_scale_shift = scale_shift_desc
+            && !memory_desc_wrapper(scale_shift_desc).is_zero();
+
+    const dim_t rows = table_desc->dims[0];
+    const dim_t dim = table_desc->dims[1];
+    const dim_t bags = offsets_desc->dims[0];
+
+    args_ok = indices_desc->ndims == 1 && offsets_desc->ndims == 1
+            && table_desc->ndims == 2 && dst_desc->ndims == 2
+            && indices_desc->data_type == data_type::s32
+            && offsets_desc->data_type == data_type::s32
+            && one_of(table_desc->data_type, data_type::f32, data_type::bf16,
+                    data_type::s8, data_type::u8)
+            && one_of(dst_desc->data_type, data_type::f32, data_type::bf16)
+            && dst_desc->dims[0] == bags && dst_desc->dims[1] == dim
+            && with_scale_shift == is_quantized
+            && IMPLICATION(with_scale_shift,
+                    scale_shift_desc->ndims == 2
+                            && scale_shift_desc->dims[0] == rows
+                            && scale_shift_desc->dims[1] == 2
+                            && scale_shift_desc->data_type == data_type::f32);
+    if (!args_ok) return invalid_arguments;
+
+    if (memory_desc_wrapper(table_desc).format_any()
+            || memory_desc_wrapper(indices_desc).format_any()
+            || memory_desc_wrapper(offsets_desc).format_any()
+            || (with_scale_shift
+                    && memory_desc_wrapper(scale_shift_desc).format_any()))
+        return invalid_arguments;
+
+    auto ed = embedding_bag_desc_t();
+    ed.primitive_kind = primitive_kind::embedding_bag;
+    ed.prop_kind = prop_kind;
+    ed.alg_kind = alg_kind;
+
+    ed.indices_desc = *indices_desc;
+    ed.offsets_desc = *offsets_desc;
+    ed.table_desc = *table_desc;
+    ed.scale_shift_desc = with_scale_shift ? *scale_shift_desc : zero_md();
+    ed.dst_desc = *dst_desc;
+
+    *desc = ed;
+    return success;
+}
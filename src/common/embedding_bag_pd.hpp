@@ -0,0 +1,139 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_EMBEDDING_BAG_PD_HPP
+#define COMMON_EMBEDDING_BAG_PD_HPP
+
+#include "c_types_map.hpp"
+#include "primitive_desc.hpp"
+#include "type_helpers.hpp"
+#include "utils.hpp"
+
+namespace dnnl {
+namespace impl {
+
+struct embedding_bag_pd_t : public primitive_desc_t {
+    static constexpr auto base_pkind = primitive_kind::embedding_bag;
+
+    typedef embedding_bag_pd_t hint_class;
+
+    embedding_bag_pd_t(const embedding_bag_desc_t *adesc,
+            const primitive_attr_t *attr, const hint_class *hint_fwd)
+        : primitive_desc_t(attr, base_pkind)
+        , desc_(*adesc)
+        , indices_md_(desc_.indices_desc)
+        , offsets_md_(desc_.offsets_desc)
+        , table_md_(desc_.table_desc)
+        , scale_shift_md_(desc_.scale_shift_desc)
+        , dst_md_(desc_.dst_desc) {}
+
+    const embedding_bag_desc_t *desc() const { return &desc_; }
+    const op_desc_t *op_desc() const override {
+        return reinterpret_cast<const op_desc_t *>(this->desc());
+    }
+
+    status_t query(query_t what, int idx, void *result) const override {
+        switch (what) {
+            case query::prop_kind:
+                *(prop_kind_t *)result = desc()->prop_kind;
+                break;
+            case query::embedding_bag_d:
+                *(const embedding_bag_desc_t **)result = desc();
+                break;
+            default: return primitive_desc_t::query(what, idx, result);
+        }
+        return status::success;
+    }
+
+    arg_usage_t arg_usage(int arg) const override {
+        switch (arg) {
+            case DNNL_ARG_SRC:
+            case DNNL_ARG_OFFSETS:
+            case DNNL_ARG_WEIGHTS: return arg_usage_t::input;
+            case DNNL_ARG_WEIGHTS_SCALE_SHIFT:
+                return with_scale_shift() ? arg_usage_t::input
+                                          : arg_usage_t::unused;
+            case DNNL_ARG_DST: return arg_usage_t::output;
+            default: return primitive_desc_t::arg_usage(arg);
+        }
+    }
+
+    const memory_desc_t *arg_md(int arg) const override {
+        switch (arg) {
+            case DNNL_ARG_SRC: return src_md(0);
+            case DNNL_ARG_OFFSETS: return src_md(1);
+            case DNNL_ARG_WEIGHTS: return weights_md(0);
+            case DNNL_ARG_WEIGHTS_SCALE_SHIFT: return weights_md(1);
+            case DNNL_ARG_DST: return dst_md(0);
+            default: return primitive_desc_t::arg_md(arg);
+        }
+    }
+
+    const memory_desc_t *src_md(int index = 0) const override {
+        if (index == 0) return &indices_md_;
+        if (index == 1) return &offsets_md_;
+        return &glob_zero_md;
+    }
+    const memory_desc_t *weights_md(int index = 0) const override {
+        if (index == 0) return &table_md_;
+        if (index == 1 && with_scale_shift()) return &scale_shift_md_;
+        return &glob_zero_md;
+    }
+    const memory_desc_t *dst_md(int index = 0) const override {
+        return index == 0 ? &dst_md_ : &glob_zero_md;
+    }
+
+    int n_inputs() const override { return 3 + with_scale_shift(); }
+    int n_outputs() const override { return 1; }
+
+    double flops() const override {
+        return (double)num_indices() * emb_dim()
+                * (1 + 2 * with_scale_shift());
+    }
+
+    /* common embedding bag aux functions */
+
+    dim_t num_indices() const { return indices_md_.dims[0]; }
+    dim_t num_bags() const { return offsets_md_.dims[0]; }
+    dim_t num_rows() const { return table_md_.dims[0]; }
+    dim_t emb_dim() const { return table_md_.dims[1]; }
+
+    bool with_scale_shift() const {
+        return !memory_desc_wrapper(desc_.scale_shift_desc).is_zero();
+    }
+    bool has_zero_dim_memory() const {
+        return memory_desc_wrapper(dst_md_).has_zero_dim();
+    }
+
+protected:
+    embedding_bag_desc_t desc_;
+
+    memory_desc_t indices_md_;
+    memory_desc_t offsets_md_;
+    memory_desc_t table_md_;
+    memory_desc_t scale_shift_md_;
+    memory_desc_t dst_md_;
+
+    status_t set_default_params() {
+        if (dst_md_.format_kind != format_kind::any) return status::success;
+        return memory_desc_init_by_tag(dst_md_, format_tag::ab);
+    }
+};
+
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -0,0 +1,68 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <assert.h>
+#include "oneapi/dnnl/dnnl.h"
+
+#include "c_types_map.hpp"
+#include "type_helpers.hpp"
+#include "utils.hpp"
+
+using namespace dnnl::impl;
+using namespace dnnl::impl::utils;
+using namespace dnnl::impl::status;
+using namespace dnnl::impl::prop_kind;
+using namespace dnnl::impl::types;
+
+status_t dnnl_group_normalization_forward_desc_init(
+        group_normalization_desc_t *gnorm_desc, prop_kind_t prop_kind,
+        const memory_desc_t *data_desc, dim_t groups, float epsilon,
+        unsigned flags) {
+    bool args_ok = true && !any_null(gnorm_desc, data_desc)
+            && one_of(prop_kind, forward_training, forward_inference)
+            && 2 <= data_desc->ndims && data_desc->ndims <= 5
+            && (flags & ~(dnnl_use_global_stats | dnnl_use_scaleshift)) == 0;
+    if (!args_ok) return invalid_arguments;
+
+    if (memory_desc_wrapper(data_desc).has_runtime_dims_or_strides())
+        return unimplemented;
+
+    const dim_t C = data_desc->dims[1];
+    if (groups <= 0 || C % groups != 0) return invalid_arguments;
+
+    auto gd = group_normalization_desc_t();
+    gd.primitive_kind = primitive_kind::group_normalization;
+    gd.prop_kind = prop_kind;
+
+    gd.data_desc = *data_desc;
+
+    dims_t stat_dims = {data_desc->dims[0], groups};
+    CHECK(dnnl_memory_desc_init_by_tag(
+            &gd.stat_desc, 2, stat_dims, data_type::f32, format_tag::ab));
+
+    dims_t scaleshift_dims = {2, C};
+    CHECK(dnnl_memory_desc_init_by_tag(&gd.data_scaleshift_desc, 2,
+            scaleshift_dims, data_type::f32, format_tag::nc));
+
+    gd.groups = groups;
+    gd.group_norm_epsilon = epsilon;
+    gd.flags = flags;
+
+    *gnorm_desc = gd;
+    return success;
+}
+
+// vim: et ts=4 sw=4 cindent cino^=l0,\:0,N-s
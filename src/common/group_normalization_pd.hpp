@@ -0,0 +1,191 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_GROUP_NORMALIZATION_PD_HPP
+#define COMMON_GROUP_NORMALIZATION_PD_HPP
+
+#include "oneapi/dnnl/dnnl.h"
+
+#include "c_types_map.hpp"
+#include "primitive_desc.hpp"
+#include "utils.hpp"
+
+namespace dnnl {
+namespace impl {
+
+struct group_normalization_fwd_pd_t;
+
+struct group_normalization_pd_t : public primitive_desc_t {
+    static constexpr auto base_pkind = primitive_kind::group_normalization;
+
+    group_normalization_pd_t(const group_normalization_desc_t *adesc,
+            const primitive_attr_t *attr,
+            const group_normalization_fwd_pd_t *hint_fwd_pd)
+        : primitive_desc_t(attr, base_pkind)
+        , desc_(*adesc)
+        , hint_fwd_pd_(hint_fwd_pd)
+        , data_md_(desc_.data_desc)
+        , stat_md_(desc_.stat_desc)
+        , scaleshift_md_(desc_.data_scaleshift_desc) {}
+
+    const group_normalization_desc_t *desc() const { return &desc_; }
+    const op_desc_t *op_desc() const override {
+        return reinterpret_cast<const op_desc_t *>(this->desc());
+    }
+
+    status_t query(query_t what, int idx, void *result) const override {
+        switch (what) {
+            case query::prop_kind:
+                *(prop_kind_t *)result = desc()->prop_kind;
+                break;
+            case query::group_normalization_d:
+                *(const group_normalization_desc_t **)result = desc();
+                break;
+            default: return primitive_desc_t::query(what, idx, result);
+        }
+        return status::success;
+    }
+
+    /* common group_normalization aux functions */
+    int ndims() const { return desc_.data_desc.ndims; }
+    dim_t MB() const { return desc_.data_desc.dims[0]; }
+    dim_t C() const { return desc_.data_desc.dims[1]; }
+    dim_t G() const { return desc_.groups; }
+    dim_t D() const { return ndims() >= 5 ? desc_.data_desc.dims[2] : 1; }
+    dim_t H() const {
+        return ndims() >= 4 ? desc_.data_desc.dims[ndims() - 2] : 1;
+    }
+    dim_t W() const {
+        return ndims() >= 3 ? desc_.data_desc.dims[ndims() - 1] : 1;
+    }
+    // number of channels in a group
+    dim_t group_size() const { return C() / G(); }
+
+    bool stats_are_src() const { return desc_.flags & dnnl_use_global_stats; }
+    bool stats_are_tmp() const { return !(stats_are_src() || is_training()); }
+
+    bool use_scaleshift() const { return desc_.flags & dnnl_use_scaleshift; }
+    bool use_global_stats() const {
+        return desc_.flags & dnnl_use_global_stats;
+    }
+
+    bool is_fwd() const {
+        return utils::one_of(desc_.prop_kind, prop_kind::forward_training,
+                prop_kind::forward_inference);
+    }
+    bool is_training() const {
+        return desc_.prop_kind == prop_kind::forward_training;
+    }
+
+    bool has_zero_dim_memory() const {
+        return memory_desc_wrapper(desc_.data_desc).has_zero_dim();
+    }
+
+    const memory_desc_t *stat_md() const { return &stat_md_; }
+
+protected:
+    group_normalization_desc_t desc_;
+    const group_normalization_fwd_pd_t *hint_fwd_pd_;
+
+    memory_desc_t data_md_;
+    memory_desc_t stat_md_;
+    memory_desc_t scaleshift_md_;
+};
+
+struct group_normalization_fwd_pd_t : public group_normalization_pd_t {
+    typedef group_normalization_fwd_pd_t base_class;
+    typedef group_normalization_fwd_pd_t hint_class;
+
+    group_normalization_fwd_pd_t(const group_normalization_desc_t *adesc,
+            const primitive_attr_t *attr,
+            const group_normalization_fwd_pd_t *hint_fwd_pd)
+        : group_normalization_pd_t(adesc, attr, hint_fwd_pd) {}
+
+    arg_usage_t arg_usage(int arg) const override {
+        if (arg == DNNL_ARG_SRC) return arg_usage_t::input;
+        if (arg == DNNL_ARG_DST) return arg_usage_t::output;
+
+        if (utils::one_of(arg, DNNL_ARG_MEAN, DNNL_ARG_VARIANCE)) {
+            if (stats_are_src()) return arg_usage_t::input;
+            if (!stats_are_src() && is_training()) return arg_usage_t::output;
+            return arg_usage_t::unused;
+        }
+
+        if (arg == DNNL_ARG_SCALE_SHIFT && use_scaleshift())
+            return arg_usage_t::input;
+
+        return primitive_desc_t::arg_usage(arg);
+    }
+
+    const memory_desc_t *arg_md(int arg) const override {
+        switch (arg) {
+            case DNNL_ARG_SRC: return src_md(0);
+            case DNNL_ARG_DST: return dst_md(0);
+            case DNNL_ARG_MEAN: return stats_are_src() ? src_md(1) : dst_md(1);
+            case DNNL_ARG_VARIANCE:
+                return stats_are_src() ? src_md(2) : dst_md(2);
+            case DNNL_ARG_SCALE_SHIFT: return weights_md(0);
+            default: return group_normalization_pd_t::arg_md(arg);
+        }
+    }
+
+    const memory_desc_t *src_md(int index = 0) const override {
+        if (index == 0) return &data_md_;
+        if (stats_are_src() && (index == 1 || index == 2)) return &stat_md_;
+        return &glob_zero_md;
+    }
+
+    const memory_desc_t *dst_md(int index = 0) const override {
+        if (index == 0) return &data_md_;
+        if (!stats_are_src() && is_training() && (index == 1 || index == 2))
+            return &stat_md_;
+        return &glob_zero_md;
+    }
+
+    const memory_desc_t *weights_md(int index = 0) const override {
+        return index == 0 ? &scaleshift_md_ : &glob_zero_md;
+    }
+
+    int n_inputs() const override {
+        return 1 + 2 * stats_are_src() + use_scaleshift();
+    }
+    int n_outputs() const override {
+        return 1 + 2 * (!stats_are_src()) * is_training();
+    }
+
+protected:
+    bool check_scale_shift_data_type() const {
+        return IMPLICATION(
+                use_scaleshift(), weights_md()->data_type == data_type::f32);
+    }
+
+    // A single eltwise post-op, applied to the normalized values before the
+    // conversion to the destination data type.
+    bool attr_eltwise_ok() const {
+        using sm = primitive_attr_t::skip_mask_t;
+        const auto &po = attr()->post_ops_;
+        return attr()->has_default_values(sm::post_ops)
+                && IMPLICATION(po.len() > 0,
+                        po.len() == 1 && po.entry_[0].is_eltwise());
+    }
+};
+
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino^=l0,\:0,N-s
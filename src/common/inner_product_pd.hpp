@@ -56,6 +56,8 @@ struct inner_product_pd_t : public primitive_desc_t {
         return status::success;
     }
 
+    double flops() const override { return 2.0 * MB() * OC() * IC_total(); }
+
     /* common inner_product aux functions */
 
     dim_t MB() const { return invariant_src_md()->dims[0]; }
@@ -0,0 +1,88 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#if defined(DNNL_ENABLE_ITT_TASKS)
+
+#include <string.h>
+#include <vector>
+
+#include <ittnotify.h>
+
+#include "oneapi/dnnl/dnnl_debug.h"
+
+#include "ittnotify.hpp"
+#include "primitive_desc.hpp"
+#include "utils.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace itt {
+
+const bool itt_tasks = getenv_int("DNNL_ITT_TASKS", 1) != 0;
+
+namespace {
+__itt_domain *get_domain() {
+    static __itt_domain *domain = __itt_domain_create("dnnl::primitive");
+    return domain;
+}
+
+// The string handles are interned by the ITT API, the ones of the primitive
+// kinds are created once
+__itt_string_handle *get_task_name(primitive_kind_t kind) {
+    static const std::vector<__itt_string_handle *> names = []() {
+        std::vector<__itt_string_handle *> names;
+        for (int k = 0; k <= (int)primitive_kind::optimizer; ++k)
+            names.push_back(__itt_string_handle_create(
+                    dnnl_prim_kind2str((primitive_kind_t)k)));
+        return names;
+    }();
+    static __itt_string_handle *zero_pad_name
+            = __itt_string_handle_create("zero_pad");
+
+    if (kind == primitive_kind::zero_pad) return zero_pad_name;
+    return (size_t)kind < names.size() ? names[kind]
+                                       : names[primitive_kind::undefined];
+}
+
+__itt_string_handle *get_info_key() {
+    static __itt_string_handle *key = __itt_string_handle_create("info");
+    return key;
+}
+} // namespace
+
+void primitive_task_start(const primitive_desc_iface_t *pd_iface) {
+    __itt_domain *domain = get_domain();
+    // The domain is enabled only when a collector is attached
+    if (!domain->flags) return;
+
+    __itt_task_begin(domain, __itt_null, __itt_null,
+            get_task_name(pd_iface->impl()->kind()));
+    const char *info = pd_iface->info();
+    __itt_metadata_str_add(
+            domain, __itt_null, get_info_key(), info, strlen(info));
+}
+
+void primitive_task_end() {
+    __itt_domain *domain = get_domain();
+    if (!domain->flags) return;
+    __itt_task_end(domain);
+}
+
+} // namespace itt
+} // namespace impl
+} // namespace dnnl
+
+#endif
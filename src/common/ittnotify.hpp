@@ -0,0 +1,50 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_ITTNOTIFY_HPP
+#define COMMON_ITTNOTIFY_HPP
+
+#include "c_types_map.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace itt {
+
+#if defined(DNNL_ENABLE_ITT_TASKS)
+// Set from DNNL_ITT_TASKS at load time (enabled by default), so that the
+// check costs a single branch when the annotations are disabled
+extern const bool itt_tasks;
+inline bool get_itt_tasks() {
+    return itt_tasks;
+}
+
+// Annotates a primitive execution as an ITT task named after the primitive
+// kind, with the verbose primitive information attached as metadata
+void primitive_task_start(const primitive_desc_iface_t *pd_iface);
+void primitive_task_end();
+#else
+inline bool get_itt_tasks() {
+    return false;
+}
+inline void primitive_task_start(const primitive_desc_iface_t *) {}
+inline void primitive_task_end() {}
+#endif
+
+} // namespace itt
+} // namespace impl
+} // namespace dnnl
+
+#endif
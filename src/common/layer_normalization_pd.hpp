@@ -73,6 +73,9 @@ struct layer_normalization_pd_t : public primitive_desc_t {
     bool use_global_stats() const {
         return desc_.flags & dnnl_use_global_stats;
     }
+    bool fuse_residual_add() const {
+        return desc_.flags & dnnl_fuse_residual_add;
+    }
 
     bool is_fwd() const {
         return utils::one_of(desc_.prop_kind, prop_kind::forward_training,
@@ -146,6 +149,11 @@ struct layer_normalization_fwd_pd_t : public layer_normalization_pd_t {
         if (arg == DNNL_ARG_SCALE_SHIFT && use_scaleshift())
             return arg_usage_t::input;
 
+        if (arg == DNNL_ARG_SRC_1 && fuse_residual_add())
+            return arg_usage_t::input;
+        if (arg == DNNL_ARG_DST_1 && fuse_residual_add())
+            return arg_usage_t::output;
+
         return primitive_desc_t::arg_usage(arg);
     }
 
@@ -153,6 +161,9 @@ struct layer_normalization_fwd_pd_t : public layer_normalization_pd_t {
         switch (arg) {
             case DNNL_ARG_SRC: return src_md(0);
             case DNNL_ARG_DST: return dst_md(0);
+            case DNNL_ARG_SRC_1:
+            case DNNL_ARG_DST_1:
+                return fuse_residual_add() ? &data_md_ : &glob_zero_md;
             case DNNL_ARG_MEAN: return stats_are_src() ? src_md(1) : dst_md(1);
             case DNNL_ARG_VARIANCE:
                 return stats_are_src() ? src_md(2) : dst_md(2);
@@ -179,10 +190,12 @@ struct layer_normalization_fwd_pd_t : public layer_normalization_pd_t {
     }
 
     int n_inputs() const override {
-        return 1 + 2 * stats_are_src() + use_scaleshift();
+        return 1 + 2 * stats_are_src() + use_scaleshift()
+                + fuse_residual_add();
     }
     int n_outputs() const override {
-        return 1 + 2 * (!stats_are_src()) * is_training();
+        return 1 + 2 * (!stats_are_src()) * is_training()
+                + fuse_residual_add();
     }
 
 protected:
@@ -359,6 +359,54 @@ inline U gelu_erf_fwd(T s) {
     return (U)(0.5f * s * (1.f + ::erff(v)));
 }
 
+template <typename T, typename A,
+        typename U = typename utils::remove_reference<T>::type>
+inline U hardsigmoid_fwd(T s, A alpha, A beta) {
+    float v = alpha * s + beta;
+    return v <= 0.f ? (U)0 : v >= 1.f ? (U)1 : (U)v;
+}
+template <typename T, typename A,
+        typename U = typename utils::remove_reference<T>::type>
+inline U hardsigmoid_bwd(T dd, T s, A alpha, A beta) {
+    float v = alpha * s + beta;
+    return v <= 0.f ? (U)0 : v >= 1.f ? (U)0 : (U)(dd * alpha);
+}
+
+template <typename T, typename A,
+        typename U = typename utils::remove_reference<T>::type>
+inline U hardswish_fwd(T s, A alpha, A beta) {
+    return (U)(s * hardsigmoid_fwd<float>(s, alpha, beta));
+}
+template <typename T, typename A,
+        typename U = typename utils::remove_reference<T>::type>
+inline U hardswish_bwd(T dd, T s, A alpha, A beta) {
+    float v = alpha * s + beta;
+    float w = v <= 0.f ? 0.f : v >= 1.f ? 1.f : 2.f * alpha * s + beta;
+    return (U)(dd * w);
+}
+
+template <typename T, typename U = typename utils::remove_reference<T>::type>
+inline U mish_fwd(T s) {
+    return (U)(s * tanh_fwd(soft_relu_fwd<float>(s)));
+}
+template <typename T, typename U = typename utils::remove_reference<T>::type>
+inline U mish_bwd(T dd, T s) {
+    float tanh_sp = tanh_fwd(soft_relu_fwd<float>(s));
+    float v = tanh_sp + s * (1.f - tanh_sp * tanh_sp) * logistic_fwd<float>(s);
+    return (U)(dd * v);
+}
+
+template <typename T, typename A,
+        typename U = typename utils::remove_reference<T>::type>
+inline U selu_fwd(T s, A alpha, A beta) {
+    return (U)(beta * elu_fwd<float>(s, alpha));
+}
+template <typename T, typename A,
+        typename U = typename utils::remove_reference<T>::type>
+inline U selu_bwd(T dd, T s, A alpha, A beta) {
+    return (U)(beta * elu_bwd<float>(dd, s, alpha));
+}
+
 template <typename T, typename U = typename utils::remove_reference<T>::type>
 inline U gelu_erf_bwd(T dd, T s) {
     const float two_over_sqrt_pi = 1.12837922573089599609375f;
@@ -380,7 +428,8 @@ inline bool is_eltwise_ok(
                       eltwise_logsigmoid, eltwise_logistic, eltwise_exp,
                       eltwise_gelu_tanh, eltwise_swish, eltwise_log,
                       eltwise_clip, eltwise_clip_v2, eltwise_pow,
-                      eltwise_gelu_erf, eltwise_round)
+                      eltwise_gelu_erf, eltwise_round, eltwise_hardswish,
+                      eltwise_hardsigmoid, eltwise_mish, eltwise_selu)
             && IMPLICATION(alg == eltwise_bounded_relu, alpha >= 0)
             && IMPLICATION(
                     one_of(alg, eltwise_clip, eltwise_clip_v2), beta >= alpha)
@@ -414,6 +463,7 @@ inline float get_bias(const char *bias, size_t offset, data_type_t data_type) {
         CASE(data_type::s8);
         CASE(data_type::u8);
         CASE(data_type::bf16);
+        CASE(data_type::f16);
         CASE(data_type::s32);
         CASE(data_type::f32);
         default: assert(!"unimplemented");
@@ -124,6 +124,11 @@ struct matmul_pd_t : public primitive_desc_t {
     dim_t N() const { return dst_md_.dims[ndims() - 1]; }
     dim_t K() const { return src_md_.dims[ndims() - 1]; }
 
+    double flops() const override {
+        if (has_runtime_dims_or_strides()) return 0;
+        return 2.0 * batch() * M() * N() * K();
+    }
+
     bool is_bias_1xN() const {
         if (!with_bias()) return false;
 
@@ -136,6 +141,20 @@ struct matmul_pd_t : public primitive_desc_t {
         return dims[n_dims - 1] == N();
     }
 
+    // bias with the batch dimensions of dst, or broadcast along some of them,
+    // and broadcast along M
+    bool is_bias_batched_1xN() const {
+        if (!with_bias()) return false;
+
+        const auto &dims = weights_md(1)->dims;
+        const int n_dims = ndims();
+        for (int i = 0; i < n_dims - 2; ++i) {
+            if (!utils::one_of(dims[i], 1, dst_md_.dims[i])) return false;
+        }
+
+        return dims[n_dims - 2] == 1 && dims[n_dims - 1] == N();
+    }
+
 protected:
     matmul_desc_t desc_;
 
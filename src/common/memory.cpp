@@ -204,6 +204,49 @@ status_t dnnl_memory_desc_init_by_strides(memory_desc_t *memory_desc, int ndims,
     return success;
 }
 
+status_t dnnl_memory_desc_init_by_sparse_blocks(memory_desc_t *memory_desc,
+        int ndims, const dims_t dims, data_type_t data_type,
+        const dims_t block_dims, dim_t nnz_blocks) {
+    if (any_null(memory_desc, dims, block_dims)) return invalid_arguments;
+
+    bool args_ok = ndims == 2
+            && memory_desc_sanity_check(
+                    ndims, dims, data_type, format_kind::sparse);
+    if (!args_ok) return invalid_arguments;
+    for (int d = 0; d < ndims; ++d)
+        if (dims[d] == DNNL_RUNTIME_DIM_VAL || block_dims[d] <= 0)
+            return invalid_arguments;
+
+    auto md = memory_desc_t();
+    md.ndims = ndims;
+    array_copy(md.dims, dims, ndims);
+    md.data_type = data_type;
+    for (int d = 0; d < ndims; ++d)
+        md.padded_dims[d] = rnd_up(dims[d], block_dims[d]);
+    md.format_kind = format_kind::sparse;
+
+    const dim_t nblk_rows = md.padded_dims[0] / block_dims[0];
+    const dim_t nblk_cols = md.padded_dims[1] / block_dims[1];
+    if (nnz_blocks < 0 || nnz_blocks > nblk_rows * nblk_cols)
+        return invalid_arguments;
+
+    // each array starts at a cache line boundary
+    const size_t align = 64;
+    const size_t blk_size = block_dims[0] * block_dims[1];
+    auto &sd = md.format_desc.sparse_desc;
+    array_copy(sd.block_dims, block_dims, ndims);
+    sd.nnz_blocks = nnz_blocks;
+    sd.row_ptr_offset = rnd_up(
+            nnz_blocks * blk_size * types::data_type_size(data_type), align);
+    sd.col_idx_offset = rnd_up(
+            sd.row_ptr_offset + (nblk_rows + 1) * sizeof(int32_t), align);
+    sd.size = sd.col_idx_offset + nnz_blocks * sizeof(int32_t);
+
+    *memory_desc = md;
+
+    return success;
+}
+
 status_t dnnl_memory_desc_init_submemory(memory_desc_t *md,
         const memory_desc_t *parent_md, const dims_t dims,
         const dims_t offsets) {
@@ -395,6 +395,13 @@ status_t memory_desc_wrapper::compute_blocking(
         C(abdEc32e, {0, 1, 3, 4, 2}, {32}, {4});
         C(abdEC32e2c, {0, 1, 3, 4, 2}, {32, 2}, {4, 2});
         C(abdEC32e4c, {0, 1, 3, 4, 2}, {32, 4}, {4, 2});
+        C(BA16a64b, {1, 0}, {16, 64}, {0, 1});
+        C(BA8a64b2a, {1, 0}, {8, 64, 2}, {0, 1, 0});
+        C(BA4a64b4a, {1, 0}, {4, 64, 4}, {0, 1, 0});
+        C(aCB16b64c, {0, 2, 1}, {16, 64}, {1, 2});
+        C(aCB8b64c2b, {0, 2, 1}, {8, 64, 2}, {1, 2, 1});
+        C(aCB4b64c4b, {0, 2, 1}, {4, 64, 4}, {1, 2, 1});
+        C(ABcde16b16a2b, {0, 1, 2, 3, 4}, {16, 16, 2}, {1, 0, 1});
         default: break;
     }
 
@@ -57,6 +57,7 @@ struct memory_desc_wrapper : public c_compatible {
     bool is_rnn_packed_desc() const {
         return format_kind() == format_kind::rnn_packed;
     }
+    bool is_sparse_desc() const { return format_kind() == format_kind::sparse; }
 
     const blocking_desc_t &blocking_desc() const {
         assert(is_blocking_desc());
@@ -70,6 +71,10 @@ struct memory_desc_wrapper : public c_compatible {
         assert(is_rnn_packed_desc());
         return md_->format_desc.rnn_packed_desc;
     }
+    const sparse_desc_t &sparse_desc() const {
+        assert(is_sparse_desc());
+        return md_->format_desc.sparse_desc;
+    }
 
     const memory_extra_desc_t &extra() const { return md_->extra; }
 
@@ -157,6 +162,8 @@ struct memory_desc_wrapper : public c_compatible {
             return wino_desc().size;
         } else if (format_kind() == format_kind::rnn_packed) {
             return rnn_packed_desc().size;
+        } else if (format_kind() == format_kind::sparse) {
+            return sparse_desc().size;
         } else {
             if (offset0() != 0) return 0;
 
@@ -420,7 +427,8 @@ inline bool memory_desc_wrapper::similar_to(const memory_desc_wrapper &rhs,
 
     if (one_of(format_kind(), format_kind::undef, format_kind::any))
         return false;
-    if (is_wino_desc() || is_rnn_packed_desc()) return false;
+    if (is_wino_desc() || is_rnn_packed_desc() || is_sparse_desc())
+        return false;
 
     const int ds = dim_start;
     const auto &blk = blocking_desc();
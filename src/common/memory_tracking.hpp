@@ -159,11 +159,14 @@ enum {
     key_bnorm_tmp_diff_ss,
     key_bnorm_tmp_stats,
     key_bnorm_reduction,
+    key_bnorm_stats_shift,
     key_brgemm_primitive_addr_a,
     key_brgemm_primitive_addr_b,
     key_brgemm_primitive_buffer,
     key_brgemm_primitive_buffer_a,
     key_brgemm_primitive_buffer_b,
+    key_brgemm_primitive_buffer_comp,
+    key_brgemm_primitive_zp_bias,
     key_concat_iptrs,
     key_concat_istrides,
     key_concat_nelems,
@@ -187,6 +190,7 @@ enum {
     key_conv_gemm_acc,
     key_conv_gemm_col,
     key_conv_gemm_imtr,
+    key_conv_group_wei,
     key_conv_int_dat_in_acc_dt,
     key_conv_padded_bias,
     key_conv_rtus_space,
@@ -196,10 +200,12 @@ enum {
     key_conv_tr_diff_dst_bctx,
     key_conv_tr_src,
     key_conv_tr_src_bctx,
+    key_conv_tr_wei,
     key_conv_wei_reduction,
     key_conv_wei_bia_reduction,
     key_conv_wei_bia_reduction_bctx,
     key_deconv_bias,
+    key_deconv_phase_comp,
     key_deconv_sum,
     key_eltwise_diff_dst,
     key_eltwise_src,
@@ -208,6 +214,8 @@ enum {
     key_gemm_int_c_in_acc_dt,
     key_gemm_tmp_buffer,
     key_gemm_flag,
+    key_gnorm_reduction,
+    key_gnorm_scale_shift,
     key_iprod_bias_bf16_convert_wsp,
     key_iprod_dst_bf16_convert_wsp,
     key_iprod_dst_reorder,
@@ -217,8 +225,11 @@ enum {
     key_lnorm_tmp_diff_ss,
     key_lnorm_reduction,
     key_matmul_dst_in_acc_dt,
+    key_optimizer_reduction,
+    key_pool_dst_argmax,
     key_pool_dst_bf16cvt,
     key_pool_dst_plain2blocked_cvt,
+    key_pool_ind_argmax,
     key_pool_ind_plain2blocked_cvt,
     key_pool_src_bf16cvt,
     key_pool_src_plain2blocked_cvt,
@@ -302,7 +302,8 @@ status_t memory_t::zero_pad(stream_t *stream) const {
 status_t memory_t::zero_pad(const exec_ctx_t &ctx) const {
     memory_desc_wrapper mdw(md());
     const bool skip_zeroing = false || memory_storage()->is_null()
-            || mdw.is_zero() || !mdw.is_blocking_desc();
+            || mdw.is_zero() || !mdw.is_blocking_desc()
+            || mdw.nelems(false) == mdw.nelems(true);
     if (skip_zeroing) return success;
 
     stream_t *stream = ctx.stream();
@@ -0,0 +1,88 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <assert.h>
+#include "oneapi/dnnl/dnnl.h"
+
+#include "c_types_map.hpp"
+#include "type_helpers.hpp"
+#include "utils.hpp"
+
+using namespace dnnl::impl;
+using namespace dnnl::impl::utils;
+using namespace dnnl::impl::status;
+using namespace dnnl::impl::alg_kind;
+using namespace dnnl::impl::types;
+
+status_t dnnl_optimizer_desc_init(optimizer_desc_t *desc, alg_kind_t alg_kind,
+        const memory_desc_t *weights_desc,
+        const memory_desc_t *diff_weights_desc, const memory_desc_t *dst_desc,
+        float momentum, float beta2, float epsilon, float weight_decay,
+        float max_grad_norm) {
+    using namespace data_type;
+
+    bool args_ok = true && !any_null(desc, weights_desc, diff_weights_desc)
+            && one_of(alg_kind, optimizer_sgd, optimizer_adam)
+            && weights_desc->ndims >= 1 && weights_desc->data_type == f32
+            && one_of(diff_weights_desc->data_type, f32, bf16)
+            && weights_desc->ndims == diff_weights_desc->ndims
+            && array_cmp(weights_desc->dims, diff_weights_desc->dims,
+                    weights_desc->ndims)
+            && momentum >= 0.f && weight_decay >= 0.f;
+    if (!args_ok) return invalid_arguments;
+
+    if (alg_kind == optimizer_adam) {
+        bool adam_ok = momentum < 1.f && beta2 >= 0.f && beta2 < 1.f
+                && epsilon > 0.f;
+        if (!adam_ok) return invalid_arguments;
+    }
+
+    const bool with_dst = dst_desc && !is_zero_md(dst_desc);
+    if (with_dst) {
+        bool dst_ok = one_of(dst_desc->data_type, f32, bf16)
+                && dst_desc->ndims == weights_desc->ndims
+                && array_cmp(
+                        dst_desc->dims, weights_desc->dims, dst_desc->ndims);
+        if (!dst_ok) return invalid_arguments;
+    }
+
+    if (memory_desc_wrapper(weights_desc).has_runtime_dims_or_strides()
+            || memory_desc_wrapper(diff_weights_desc)
+                       .has_runtime_dims_or_strides()
+            || (with_dst
+                    && memory_desc_wrapper(dst_desc)
+                               .has_runtime_dims_or_strides()))
+        return unimplemented;
+
+    auto od = optimizer_desc_t();
+    od.primitive_kind = primitive_kind::optimizer;
+    od.alg_kind = alg_kind;
+
+    od.weights_desc = *weights_desc;
+    od.diff_weights_desc = *diff_weights_desc;
+    od.dst_desc = with_dst ? *dst_desc : glob_zero_md;
+
+    od.momentum = momentum;
+    od.beta2 = alg_kind == optimizer_adam ? beta2 : 0.f;
+    od.epsilon = alg_kind == optimizer_adam ? epsilon : 0.f;
+    od.weight_decay = weight_decay;
+    od.max_grad_norm = max_grad_norm > 0.f ? max_grad_norm : 0.f;
+
+    *desc = od;
+    return success;
+}
+
+// vim: et ts=4 sw=4 cindent cino^=l0,\:0,N-s
@@ -0,0 +1,162 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_OPTIMIZER_PD_HPP
+#define COMMON_OPTIMIZER_PD_HPP
+
+#include "oneapi/dnnl/dnnl.h"
+
+#include "c_types_map.hpp"
+#include "primitive_desc.hpp"
+#include "type_helpers.hpp"
+#include "utils.hpp"
+
+namespace dnnl {
+namespace impl {
+
+struct optimizer_pd_t : public primitive_desc_t {
+    static constexpr auto base_pkind = primitive_kind::optimizer;
+
+    typedef optimizer_pd_t base_class;
+    typedef optimizer_pd_t hint_class;
+
+    // Layout of the runtime hyperparameters tensor
+    enum { hp_learning_rate = 0, hp_step, hp_grad_scale, hp_size };
+
+    optimizer_pd_t(const optimizer_desc_t *adesc, const primitive_attr_t *attr,
+            const hint_class *hint_fwd)
+        : primitive_desc_t(attr, base_pkind)
+        , desc_(*adesc)
+        , weights_md_(desc_.weights_desc)
+        , diff_weights_md_(desc_.diff_weights_desc)
+        , dst_md_(desc_.dst_desc)
+        , hp_md_(glob_zero_md) {
+        const dims_t hp_dims = {hp_size};
+        dnnl_memory_desc_init_by_tag(
+                &hp_md_, 1, hp_dims, data_type::f32, format_tag::a);
+    }
+
+    const optimizer_desc_t *desc() const { return &desc_; }
+    const op_desc_t *op_desc() const override {
+        return reinterpret_cast<const op_desc_t *>(this->desc());
+    }
+
+    status_t query(query_t what, int idx, void *result) const override {
+        switch (what) {
+            case query::optimizer_d:
+                *(const optimizer_desc_t **)result = desc();
+                break;
+            default: return primitive_desc_t::query(what, idx, result);
+        }
+        return status::success;
+    }
+
+    // The master weights and the states are read and updated in place
+    arg_usage_t arg_usage(int arg) const override {
+        if (arg == DNNL_ARG_HYPERPARAMETERS) return arg_usage_t::input;
+        if (arg == DNNL_ARG_DIFF_WEIGHTS) return arg_usage_t::input;
+        if (arg == DNNL_ARG_WEIGHTS) return arg_usage_t::output;
+        if (arg == DNNL_ARG_MOMENT_1 && n_states() >= 1)
+            return arg_usage_t::output;
+        if (arg == DNNL_ARG_MOMENT_2 && n_states() >= 2)
+            return arg_usage_t::output;
+        if (arg == DNNL_ARG_DST && with_dst()) return arg_usage_t::output;
+
+        return primitive_desc_t::arg_usage(arg);
+    }
+
+    const memory_desc_t *arg_md(int arg) const override {
+        switch (arg) {
+            case DNNL_ARG_HYPERPARAMETERS: return src_md(0);
+            case DNNL_ARG_WEIGHTS: return weights_md(0);
+            case DNNL_ARG_MOMENT_1: return weights_md(1);
+            case DNNL_ARG_MOMENT_2: return weights_md(2);
+            case DNNL_ARG_DIFF_WEIGHTS: return diff_weights_md(0);
+            case DNNL_ARG_DST: return dst_md(0);
+            default: return primitive_desc_t::arg_md(arg);
+        }
+    }
+
+    const memory_desc_t *src_md(int index = 0) const override {
+        return index == 0 ? &hp_md_ : &glob_zero_md;
+    }
+    const memory_desc_t *weights_md(int index = 0) const override {
+        return index <= n_states() ? &weights_md_ : &glob_zero_md;
+    }
+    const memory_desc_t *diff_weights_md(int index = 0) const override {
+        return index == 0 ? &diff_weights_md_ : &glob_zero_md;
+    }
+    const memory_desc_t *dst_md(int index = 0) const override {
+        return index == 0 ? &dst_md_ : &glob_zero_md;
+    }
+
+    int n_inputs() const override { return 2; }
+    int n_outputs() const override { return 1 + n_states() + with_dst(); }
+
+    /* common optimizer aux functions */
+    alg_kind_t alg() const { return desc_.alg_kind; }
+    bool is_adam() const { return alg() == alg_kind::optimizer_adam; }
+    // SGD keeps the momentum only if it is used
+    int n_states() const {
+        return is_adam() ? 2 : (desc_.momentum != 0.f ? 1 : 0);
+    }
+    bool with_dst() const { return !types::is_zero_md(&dst_md_); }
+    bool with_clipping() const { return desc_.max_grad_norm > 0.f; }
+    dim_t nelems() const { return memory_desc_wrapper(weights_md_).nelems(); }
+
+    bool has_zero_dim_memory() const {
+        return memory_desc_wrapper(weights_md_).has_zero_dim();
+    }
+
+protected:
+    optimizer_desc_t desc_;
+
+    memory_desc_t weights_md_;
+    memory_desc_t diff_weights_md_;
+    memory_desc_t dst_md_;
+    memory_desc_t hp_md_;
+
+    // The updated tensors are owned by the user, hence the master weights
+    // default to a plain layout that the other tensors follow.
+    status_t set_default_params() {
+        if (weights_md_.format_kind == format_kind::any)
+            CHECK(memory_desc_init_by_strides(weights_md_, nullptr));
+        if (diff_weights_md_.format_kind == format_kind::any)
+            CHECK(memory_desc_init_by_blocking_desc(diff_weights_md_,
+                    weights_md_.format_desc.blocking));
+        if (with_dst() && dst_md_.format_kind == format_kind::any)
+            CHECK(memory_desc_init_by_blocking_desc(
+                    dst_md_, weights_md_.format_desc.blocking));
+        return status::success;
+    }
+
+    // All the tensors are traversed as one-dimensional arrays
+    bool same_dense_layout() const {
+        const memory_desc_wrapper w_d(weights_md_), dw_d(diff_weights_md_),
+                d_d(dst_md_);
+        return w_d.is_dense() && w_d.similar_to(dw_d, true, false)
+                && dw_d.is_dense()
+                && IMPLICATION(with_dst(),
+                        w_d.similar_to(d_d, true, false) && d_d.is_dense());
+    }
+};
+
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino^=l0,\:0,N-s
@@ -0,0 +1,173 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifdef _WIN32
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <thread>
+
+#include "oneapi/dnnl/dnnl_version.h"
+
+#include "persistent_cache.hpp"
+#include "utils.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace persistent_cache {
+
+namespace {
+
+const char magic[8] = {'D', 'N', 'N', 'L', 'P', 'C', '0', '1'};
+
+const std::string &get_cache_dir() {
+    static const std::string dir = [] {
+        const char *name = "DNNL_PERSISTENT_CACHE_DIR";
+        // A negative value is the length of the variable value
+        const int len = -getenv(name, nullptr, 0);
+        if (len <= 0) return std::string();
+        std::vector<char> buf(len + 1);
+        if (getenv(name, buf.data(), len + 1) <= 0) return std::string();
+        return std::string(buf.data());
+    }();
+    return dir;
+}
+
+// The key is prefixed with the library version so that entries created by a
+// different build of the library are never reused.
+std::string full_key(const std::string &key) {
+    std::string k = std::to_string(DNNL_VERSION_MAJOR) + "."
+            + std::to_string(DNNL_VERSION_MINOR) + "."
+            + std::to_string(DNNL_VERSION_PATCH) + ":" + DNNL_VERSION_HASH
+            + ":";
+    k += key;
+    return k;
+}
+
+// 64-bit FNV-1a: unlike std::hash the value is stable across standard
+// library implementations, so the file names stay valid across builds.
+uint64_t hash_key(const std::string &key) {
+    uint64_t h = 14695981039346656037ULL;
+    for (unsigned char c : key) {
+        h ^= c;
+        h *= 1099511628211ULL;
+    }
+    return h;
+}
+
+std::string entry_path(const std::string &key) {
+    char name[32];
+    snprintf(name, sizeof(name), "dnnl_%016llx.bin",
+            (unsigned long long)hash_key(key));
+    return get_cache_dir() + "/" + name;
+}
+
+bool read_u64(FILE *f, uint64_t &v) {
+    return fread(&v, sizeof(v), 1, f) == 1;
+}
+
+bool write_u64(FILE *f, uint64_t v) {
+    return fwrite(&v, sizeof(v), 1, f) == 1;
+}
+
+int get_pid() {
+#ifdef _WIN32
+    return _getpid();
+#else
+    return (int)::getpid();
+#endif
+}
+
+} // namespace
+
+bool is_enabled() {
+    return !get_cache_dir().empty();
+}
+
+status_t load(const std::string &key, std::vector<unsigned char> &blob) {
+    if (!is_enabled()) return status::runtime_error;
+
+    const std::string k = full_key(key);
+    FILE *f = fopen(entry_path(k).c_str(), "rb");
+    if (!f) return status::runtime_error;
+
+    bool ok = true;
+    char m[sizeof(magic)];
+    ok = ok && fread(m, sizeof(m), 1, f) == 1
+            && memcmp(m, magic, sizeof(magic)) == 0;
+
+    uint64_t key_size = 0;
+    ok = ok && read_u64(f, key_size) && key_size == k.size();
+    if (ok) {
+        std::string stored_key(key_size, '\0');
+        ok = fread(&stored_key[0], 1, key_size, f) == key_size
+                && stored_key == k;
+    }
+
+    uint64_t blob_size = 0;
+    ok = ok && read_u64(f, blob_size) && blob_size > 0;
+    if (ok) {
+        blob.resize(blob_size);
+        ok = fread(blob.data(), 1, blob_size, f) == blob_size;
+    }
+
+    fclose(f);
+    if (!ok) {
+        blob.clear();
+        return status::runtime_error;
+    }
+    return status::success;
+}
+
+status_t store(const std::string &key, const std::vector<unsigned char> &blob) {
+    if (!is_enabled() || blob.empty()) return status::runtime_error;
+
+    const std::string k = full_key(key);
+    const std::string path = entry_path(k);
+
+    // Write to a private temporary file first and move it in place, so that
+    // concurrent readers (possibly in other processes) never observe a
+    // partially written entry.
+    const std::string tmp_path = path + ".tmp." + std::to_string(get_pid())
+            + "." + std::to_string(std::hash<std::thread::id>()(
+                    std::this_thread::get_id()));
+    FILE *f = fopen(tmp_path.c_str(), "wb");
+    if (!f) return status::runtime_error;
+
+    bool ok = fwrite(magic, sizeof(magic), 1, f) == 1;
+    ok = ok && write_u64(f, k.size());
+    ok = ok && fwrite(k.data(), 1, k.size(), f) == k.size();
+    ok = ok && write_u64(f, blob.size());
+    ok = ok && fwrite(blob.data(), 1, blob.size(), f) == blob.size();
+    ok = (fclose(f) == 0) && ok;
+
+    if (ok) ok = std::rename(tmp_path.c_str(), path.c_str()) == 0;
+    if (!ok) {
+        std::remove(tmp_path.c_str());
+        return status::runtime_error;
+    }
+    return status::success;
+}
+
+} // namespace persistent_cache
+} // namespace impl
+} // namespace dnnl
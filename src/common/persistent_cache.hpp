@@ -0,0 +1,50 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_PERSISTENT_CACHE_HPP
+#define COMMON_PERSISTENT_CACHE_HPP
+
+#include <string>
+#include <vector>
+
+#include "c_types_map.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace persistent_cache {
+
+// On-disk storage of relocatable binary blobs (e.g. OpenCL program binaries)
+// that survives process restarts. The storage is enabled by setting the
+// DNNL_PERSISTENT_CACHE_DIR environment variable to an existing directory.
+//
+// A blob is identified by a key which must capture everything the blob
+// depends on (library version is added automatically). The full key is
+// stored alongside the blob and compared on load, so a hash collision of
+// file names can never return a wrong blob.
+bool is_enabled();
+
+// Returns status::success and fills `blob` if a valid entry exists,
+// status::runtime_error otherwise.
+status_t load(const std::string &key, std::vector<unsigned char> &blob);
+
+// Best effort: a failure to store the entry is not an error for the caller.
+status_t store(const std::string &key, const std::vector<unsigned char> &blob);
+
+} // namespace persistent_cache
+} // namespace impl
+} // namespace dnnl
+
+#endif
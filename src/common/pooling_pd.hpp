@@ -64,6 +64,10 @@ struct pooling_pd_t : public primitive_desc_t {
         return status::success;
     }
 
+    double flops() const override {
+        return (double)MB() * C() * OD() * OH() * OW() * KD() * KH() * KW();
+    }
+
     /* common pooling aux functions */
 
     dim_t MB() const { return src_desc().dims[0]; }
@@ -268,11 +272,16 @@ struct pooling_bwd_pd_t : public pooling_pd_t {
             const primitive_attr_t *attr, const pooling_fwd_pd_t *hint_fwd_pd)
         : pooling_pd_t(adesc, attr, hint_fwd_pd)
         , diff_src_md_(desc_.diff_src_desc)
-        , diff_dst_md_(desc_.diff_dst_desc) {}
+        , diff_dst_md_(desc_.diff_dst_desc)
+        , src_md_(recompute_argmax() ? *hint_fwd_pd->src_md()
+                                     : types::zero_md()) {}
 
     arg_usage_t arg_usage(int arg) const override {
         if (arg == DNNL_ARG_DIFF_DST) return arg_usage_t::input;
 
+        if (arg == DNNL_ARG_SRC && recompute_argmax())
+            return arg_usage_t::input;
+
         if (arg == DNNL_ARG_DIFF_SRC) return arg_usage_t::output;
 
         if (arg == DNNL_ARG_WORKSPACE && (!types::is_zero_md(workspace_md())))
@@ -285,10 +294,15 @@ struct pooling_bwd_pd_t : public pooling_pd_t {
         switch (arg) {
             case DNNL_ARG_DIFF_SRC: return diff_src_md(0);
             case DNNL_ARG_DIFF_DST: return diff_dst_md(0);
+            case DNNL_ARG_SRC: return src_md(0);
             default: return pooling_pd_t::arg_md(arg);
         }
     }
 
+    const memory_desc_t *src_md(int index = 0) const override {
+        return index == 0 && recompute_argmax() ? &src_md_ : &glob_zero_md;
+    }
+
     const memory_desc_t *diff_src_md(int index = 0) const override {
         return index == 0 ? &diff_src_md_ : &glob_zero_md;
     }
@@ -301,13 +315,25 @@ struct pooling_bwd_pd_t : public pooling_pd_t {
     }
 
     int n_inputs() const override {
-        return 1 + (!types::is_zero_md(workspace_md()));
+        return 1 + (!types::is_zero_md(workspace_md())) + recompute_argmax();
     }
     int n_outputs() const override { return 1; }
 
+    // Max pooling backward created with a forward inference hint, which has
+    // no workspace, recomputes the positions of the maxima from the forward
+    // source (DNNL_ARG_SRC) instead of reading them from the workspace. This
+    // saves the memory and the bandwidth of the workspace at the cost of
+    // another pass over the source.
+    bool recompute_argmax() const {
+        return desc_.alg_kind == alg_kind::pooling_max && hint_fwd_pd_
+                && hint_fwd_pd_->desc()->prop_kind
+                == prop_kind::forward_inference;
+    }
+
 protected:
     memory_desc_t diff_src_md_;
     memory_desc_t diff_dst_md_;
+    memory_desc_t src_md_;
 
     virtual status_t set_default_params() {
         if (diff_dst_md()->format_kind == format_kind::any) {
@@ -15,9 +15,16 @@
 *******************************************************************************/
 
 #include <assert.h>
+#include <atomic>
+#include <future>
+#include <thread>
+#include <vector>
 
 #include "c_types_map.hpp"
+#include "cache_blob.hpp"
+#include "dnnl_thread.hpp"
 #include "engine.hpp"
+#include "ittnotify.hpp"
 #include "primitive.hpp"
 #include "primitive_desc.hpp"
 #include "primitive_exec_types.hpp"
@@ -50,6 +57,28 @@ void unpoison_outputs(const exec_args_t &args) {
 namespace dnnl {
 namespace impl {
 
+namespace {
+thread_local jit_code_size_tracker_t *jit_code_size_tracker = nullptr;
+} // namespace
+
+jit_code_size_tracker_t::jit_code_size_tracker_t()
+    : parent_(jit_code_size_tracker) {
+    jit_code_size_tracker = this;
+}
+
+jit_code_size_tracker_t::~jit_code_size_tracker_t() {
+    jit_code_size_tracker = parent_;
+    add_nested(size());
+}
+
+void jit_code_size_tracker_t::add(size_t size) {
+    if (jit_code_size_tracker) jit_code_size_tracker->own_size_ += size;
+}
+
+void jit_code_size_tracker_t::add_nested(size_t size) {
+    if (jit_code_size_tracker) jit_code_size_tracker->nested_size_ += size;
+}
+
 nested_scratchpad_t::nested_scratchpad_t(const exec_ctx_t &master_ctx, int key,
         const std::shared_ptr<primitive_t> &nested_p) {
     auto scratchpad = master_ctx.get_scratchpad_grantor();
@@ -88,9 +117,7 @@ status_t primitive_create(primitive_iface_t **primitive_iface,
 
         const char *str = p_iface.second ? "cache_hit" : "cache_miss";
         ms = get_msec() - ms;
-        printf("dnnl_verbose,create:%s,%s,%g\n", str,
-                p_iface.first->pd()->info(), ms);
-        fflush(stdout);
+        verbose_print_prim("create", str, p_iface.first->pd(), ms);
     } else {
         status = primitive_desc_iface->create_primitive_iface(p_iface);
     }
@@ -105,18 +132,29 @@ status_t primitive_execute(
 
     stream->before_exec_hook();
 
+    const bool itt_task = itt::get_itt_tasks();
+    if (itt_task) itt::primitive_task_start(primitive_iface->pd());
+
     if (get_verbose()) {
         stream->wait();
         double ms = get_msec();
         status = stream->enqueue_primitive(primitive_iface, ctx);
         stream->wait();
         ms = get_msec() - ms;
-        printf("dnnl_verbose,exec,%s,%g\n", primitive_iface->pd()->info(), ms);
-        fflush(stdout);
+        verbose_print_prim("exec", nullptr, primitive_iface->pd(), ms);
+    } else if (get_verbose_sample_period() > 0 && verbose_sample_next()) {
+        stream->wait();
+        double ms = get_msec();
+        status = stream->enqueue_primitive(primitive_iface, ctx);
+        stream->wait();
+        ms = get_msec() - ms;
+        verbose_record_sample(primitive_iface->pd(), ms);
     } else {
         status = stream->enqueue_primitive(primitive_iface, ctx);
     }
 
+    if (itt_task) itt::primitive_task_end();
+
     stream->after_exec_hook();
 
     if (msan_enabled) unpoison_outputs(ctx.args());
@@ -141,6 +179,69 @@ status_t dnnl_primitive_create(primitive_iface_t **primitive_iface,
     return dnnl::impl::primitive_create(primitive_iface, primitive_desc_iface);
 }
 
+status_t dnnl_primitive_create_from_cache_blob(
+        primitive_iface_t **primitive_iface,
+        const primitive_desc_iface_t *primitive_desc_iface, size_t size,
+        const uint8_t *cache_blob) {
+    if (utils::any_null(primitive_iface, primitive_desc_iface, cache_blob)
+            || size == 0)
+        return invalid_arguments;
+    if (primitive_desc_iface->engine()->kind() != engine_kind::gpu)
+        return unimplemented;
+
+    cache_blob_t blob;
+    CHECK(blob.deserialize(cache_blob, size));
+    cache_blob_guard_t guard(&blob);
+    return dnnl::impl::primitive_create(primitive_iface, primitive_desc_iface);
+}
+
+status_t dnnl_primitive_create_batch(primitive_iface_t **primitive_ifaces,
+        int count, const primitive_desc_iface_t *const *primitive_desc_ifaces) {
+    if (count < 0 || (count > 0 && utils::any_null(primitive_ifaces,
+                                   primitive_desc_ifaces)))
+        return invalid_arguments;
+    for (int i = 0; i < count; i++) {
+        primitive_ifaces[i] = nullptr;
+        if (primitive_desc_ifaces[i] == nullptr) return invalid_arguments;
+    }
+
+    std::vector<status_t> statuses(count, success);
+    std::atomic<int> next(0);
+    // The number of threads is not inherited by the creating threads, while
+    // the implementations may depend on it
+    const int nthr = dnnl_get_max_threads();
+    MAYBE_UNUSED(nthr);
+    auto create = [&]() {
+#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP
+        omp_set_num_threads(nthr);
+#endif
+        for (int i = next++; i < count; i = next++)
+            statuses[i] = dnnl::impl::primitive_create(
+                    &primitive_ifaces[i], primitive_desc_ifaces[i]);
+    };
+
+    // Identical primitive descriptors are safe to create concurrently: the
+    // primitive cache lets only one of the threads create the primitive
+    const int nworkers = nstl::min(
+            count, nstl::max(1, (int)std::thread::hardware_concurrency()));
+    std::vector<std::future<void>> workers;
+    for (int w = 1; w < nworkers; w++)
+        workers.push_back(std::async(std::launch::async, create));
+    create();
+    for (auto &w : workers)
+        w.wait();
+
+    for (int i = 0; i < count; i++) {
+        if (statuses[i] == success) continue;
+        for (int j = 0; j < count; j++) {
+            dnnl_primitive_destroy(primitive_ifaces[j]);
+            primitive_ifaces[j] = nullptr;
+        }
+        return statuses[i];
+    }
+    return success;
+}
+
 status_t dnnl_primitive_execute(const primitive_iface_t *primitive_iface,
         stream_t *stream, int nargs, const dnnl_exec_arg_t *c_args) {
     bool ok = true && !utils::any_null(primitive_iface, stream)
@@ -159,6 +260,87 @@ status_t dnnl_primitive_execute(const primitive_iface_t *primitive_iface,
     return status;
 }
 
+status_t dnnl_primitive_execute_batch(const primitive_iface_t *primitive_iface,
+        stream_t *stream, int batch, const int *nargs,
+        const dnnl_exec_arg_t *const *c_args) {
+    bool ok = true && !utils::any_null(primitive_iface, stream)
+            && primitive_iface->engine() == stream->engine() && batch >= 0
+            && IMPLICATION(batch > 0, !utils::any_null(nargs, c_args));
+    if (!ok) return invalid_arguments;
+
+    std::vector<std::shared_ptr<const exec_args_t>> args(batch);
+    for (int i = 0; i < batch; i++) {
+        if (nargs[i] > 0 && c_args[i] == nullptr) return invalid_arguments;
+        exec_args_t item_args;
+        CHECK(cvt_primitive_args(primitive_iface->pd()->impl().get(), nargs[i],
+                c_args[i], item_args));
+        args[i] = std::make_shared<const exec_args_t>(std::move(item_args));
+    }
+
+    // Asynchronous runtimes and GPU engines execute the items one by one
+    engine_t *engine = stream->engine();
+    if (engine->kind() != engine_kind::cpu
+            || !is_native_runtime(engine->runtime_kind())) {
+        for (int i = 0; i < batch; i++) {
+            exec_ctx_t ctx(stream, args[i]);
+            CHECK(dnnl::impl::primitive_execute(primitive_iface, ctx));
+        }
+        return success;
+    }
+
+    stream->before_exec_hook();
+
+    const bool itt_task = itt::get_itt_tasks();
+    if (itt_task) itt::primitive_task_start(primitive_iface->pd());
+
+    double ms = get_verbose() ? get_msec() : 0;
+    status_t status = primitive_iface->execute_batch(stream, args);
+    if (get_verbose()) {
+        ms = get_msec() - ms;
+        verbose_print_prim("exec", "batch", primitive_iface->pd(), ms);
+    }
+
+    if (itt_task) itt::primitive_task_end();
+
+    stream->after_exec_hook();
+
+    if (msan_enabled)
+        for (const auto &a : args)
+            unpoison_outputs(*a);
+
+    return status;
+}
+
+status_t dnnl_bound_args_create(dnnl_bound_args **bound_args,
+        const primitive_iface_t *primitive_iface, int nargs,
+        const dnnl_exec_arg_t *c_args) {
+    if (utils::any_null(bound_args, primitive_iface)) return invalid_arguments;
+
+    exec_args_t args;
+    status_t status = cvt_primitive_args(
+            primitive_iface->pd()->impl().get(), nargs, c_args, args);
+    if (status != status::success) return status;
+
+    return safe_ptr_assign(
+            *bound_args, new dnnl_bound_args(primitive_iface, std::move(args)));
+}
+
+status_t dnnl_primitive_execute_bound(const primitive_iface_t *primitive_iface,
+        stream_t *stream, const dnnl_bound_args *bound_args) {
+    bool ok = true && !utils::any_null(primitive_iface, stream, bound_args)
+            && primitive_iface->engine() == stream->engine()
+            && bound_args->primitive_iface() == primitive_iface;
+    if (!ok) return invalid_arguments;
+
+    exec_ctx_t ctx(stream, bound_args->args());
+    return dnnl::impl::primitive_execute(primitive_iface, ctx);
+}
+
+status_t dnnl_bound_args_destroy(dnnl_bound_args *bound_args) {
+    delete bound_args;
+    return success;
+}
+
 status_t dnnl_primitive_get_primitive_desc(
         const primitive_iface_t *primitive_iface,
         const primitive_desc_iface_t **primitive_desc_iface) {
@@ -167,6 +349,32 @@ status_t dnnl_primitive_get_primitive_desc(
     return safe_ptr_assign(*primitive_desc_iface, primitive_iface->pd());
 }
 
+status_t dnnl_primitive_get_cache_blob(const primitive_iface_t *primitive_iface,
+        size_t *size, uint8_t *cache_blob) {
+    if (utils::any_null(primitive_iface, size)) return invalid_arguments;
+    if (primitive_iface->engine()->kind() != engine_kind::gpu)
+        return unimplemented;
+
+    cache_blob_t blob;
+    CHECK(primitive_iface->get_cache_blob(blob));
+    const size_t blob_size = blob.serialized_size();
+    if (cache_blob == nullptr) {
+        *size = blob_size;
+        return success;
+    }
+    if (*size != blob_size) return invalid_arguments;
+    blob.serialize(cache_blob);
+    return success;
+}
+
+status_t dnnl_primitive_get_memory_footprint(
+        const primitive_iface_t *primitive_iface,
+        dnnl_memory_footprint_t *footprint) {
+    if (utils::any_null(primitive_iface, footprint)) return invalid_arguments;
+    primitive_iface->get_memory_footprint(footprint);
+    return success;
+}
+
 status_t dnnl_primitive_destroy(primitive_iface_t *primitive_iface) {
     if (primitive_iface != nullptr) primitive_iface->release();
     return success;
@@ -188,7 +396,18 @@ dnnl_primitive::dnnl_primitive(const std::shared_ptr<primitive_t> &primitive,
     , pd_(utils::make_unique<reorder_primitive_desc_iface_t>(
               primitive_->pd(), engine, src_engine, dst_engine)) {}
 
+// lazy creation specialization
+dnnl_primitive::dnnl_primitive(const std::shared_ptr<primitive_desc_t> &pd,
+        engine_t *engine, dnnl_primitive *fallback)
+    : counter_(1)
+    , pd_(utils::make_unique<primitive_desc_iface_t>(pd, engine))
+    , fallback_(fallback)
+    , is_ready_(false) {}
+
 dnnl_primitive::~dnnl_primitive() {
+    // The creation may still be running and use the members
+    if (lazy_creation_.valid()) lazy_creation_.wait();
+    if (fallback_) fallback_->release();
     if (scratchpad_debug::is_protect_scratchpad() && scratchpad_ != nullptr
             && scratchpad_->get_memory_storage() != nullptr) {
         const memory_tracking::registry_t &registry
@@ -199,6 +418,38 @@ dnnl_primitive::~dnnl_primitive() {
 }
 
 status_t dnnl_primitive::init() {
+    if (fallback_ == nullptr) return init_impl();
+
+    // The number of threads is not inherited by the creating thread, while
+    // the implementation may depend on it
+    const int nthr = dnnl_get_max_threads();
+    lazy_creation_ = std::async(
+            std::launch::async, [this, nthr]() { create_lazily(nthr); });
+    return success;
+}
+
+void dnnl_primitive::create_lazily(int nthr) {
+#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP
+    omp_set_num_threads(nthr);
+#endif
+    double ms = get_msec();
+    std::pair<std::shared_ptr<primitive_t>, bool> p;
+    status_t status = pd_->impl()->create_primitive(p, engine());
+    if (status == success) {
+        primitive_ = p.first;
+        status = init_impl();
+    }
+    // On failure the executions keep going to the fallback
+    if (status != success) return;
+
+    if (get_verbose() >= 2) {
+        ms = get_msec() - ms;
+        verbose_print_prim("create", "lazy", pd_.get(), ms);
+    }
+    is_ready_.store(true, std::memory_order_release);
+}
+
+status_t dnnl_primitive::init_impl() {
     const size_t scratchpad_size
             = primitive_->pd()->scratchpad_size(scratchpad_mode::library);
 
@@ -230,20 +481,115 @@ engine_t *dnnl_primitive::engine() const {
     return pd_->engine();
 }
 
+status_t dnnl_primitive::get_cache_blob(cache_blob_t &cache_blob) const {
+    // A lazily created primitive is serialized once it is ready, while the
+    // fallback is never serialized in its place
+    if (lazy_creation_.valid()) lazy_creation_.wait();
+    if (!is_ready_.load(std::memory_order_acquire)) return runtime_error;
+    return primitive_->get_cache_blob(cache_blob);
+}
+
+void dnnl_primitive::get_memory_footprint(
+        dnnl_memory_footprint_t *footprint) const {
+    // Until a lazily created primitive is ready, the memory is held by the
+    // fallback
+    if (!is_ready_.load(std::memory_order_acquire))
+        return fallback_->get_memory_footprint(footprint);
+
+    footprint->constant = primitive_->constant_memory_size();
+    footprint->jit_code = primitive_->jit_code_size();
+    footprint->scratchpad = scratchpad_ && !primitive_->use_global_scratchpad()
+            ? scratchpad_->size()
+            : 0;
+    footprint->total
+            = footprint->constant + footprint->jit_code + footprint->scratchpad;
+}
+
 const primitive_desc_iface_t *dnnl_primitive::pd() const {
     return pd_.get();
 }
 
 status_t dnnl_primitive::execute(exec_ctx_t &ctx) const {
+    if (!is_ready_.load(std::memory_order_acquire))
+        return fallback_->execute(ctx);
+
     const memory_storage_t *mem_storage = nullptr;
     if (primitive_->pd()->attr()->scratchpad_mode_ == scratchpad_mode::user) {
         memory_t *scratchpad_memory = ctx.output(DNNL_ARG_SCRATCHPAD);
+        // Fall back to the scratchpad attached to the stream, which is shared
+        // by all primitives executed on it
+        if (scratchpad_memory == nullptr && ctx.stream() != nullptr
+                && ctx.stream()->scratchpad() != nullptr) {
+            scratchpad_memory = ctx.stream()->scratchpad();
+            const size_t size = memory_desc_wrapper(scratchpad_memory->md())
+                                        .size();
+            if (size < (size_t)primitive_->pd()->scratchpad_size(
+                        scratchpad_mode::user))
+                return invalid_arguments;
+        }
         mem_storage = scratchpad_memory ? scratchpad_memory->memory_storage()
                                         : nullptr;
     } else if (scratchpad_) {
         mem_storage = scratchpad_->get_memory_storage();
     }
 
+    return execute_impl(ctx, mem_storage);
+}
+
+status_t dnnl_primitive::execute_batch(stream_t *stream,
+        const std::vector<std::shared_ptr<const exec_args_t>> &batch) const {
+    if (!is_ready_.load(std::memory_order_acquire))
+        return fallback_->execute_batch(stream, batch);
+
+    const int n_items = (int)batch.size();
+    if (n_items == 0) return success;
+
+    const auto &pd = primitive_->pd();
+    const bool user_scratchpad
+            = pd->attr()->scratchpad_mode_ == scratchpad_mode::user;
+    // The scratchpad attached to the stream cannot be shared by the items
+    if (user_scratchpad && pd->scratchpad_size(scratchpad_mode::user) > 0) {
+        for (const auto &args : batch)
+            if (args->count(DNNL_ARG_SCRATCHPAD) == 0)
+                return invalid_arguments;
+    }
+
+    // Every thread gets its own page-aligned slice of a single scratchpad,
+    // the items processed by a thread reuse its slice one after another
+    const int max_nthr = nstl::min(dnnl_get_max_threads(), n_items);
+    const size_t slice_size = utils::rnd_up(
+            pd->scratchpad_size(scratchpad_mode::library), (size_t)4096);
+    std::unique_ptr<scratchpad_t> scratchpad;
+    if (!user_scratchpad && slice_size > 0) {
+        scratchpad.reset(create_scratchpad(pd_->engine(),
+                max_nthr * slice_size, /* use_global_scratchpad = */ false));
+        if (!scratchpad || scratchpad->size() < max_nthr * slice_size)
+            return out_of_memory;
+    }
+
+    std::vector<status_t> statuses(max_nthr, success);
+    parallel(max_nthr, [&](const int ithr, const int nthr) {
+        std::unique_ptr<memory_storage_t> slice;
+        if (scratchpad)
+            slice = scratchpad->get_memory_storage()->get_sub_storage(
+                    ithr * slice_size, slice_size);
+
+        int start {0}, end {0};
+        balance211(n_items, nthr, ithr, start, end);
+        for (int i = start; i < end && statuses[ithr] == success; i++) {
+            exec_ctx_t ctx(stream, batch[i]);
+            statuses[ithr] = user_scratchpad ? execute(ctx)
+                                             : execute_impl(ctx, slice.get());
+        }
+    });
+
+    for (auto s : statuses)
+        if (s != success) return s;
+    return success;
+}
+
+status_t dnnl_primitive::execute_impl(
+        exec_ctx_t &ctx, const memory_storage_t *mem_storage) const {
     auto scratchpad_grantor
             = primitive_->pd()->scratchpad_registry().grantor(mem_storage, ctx);
     ctx.set_scratchpad_grantor(&scratchpad_grantor);
@@ -23,6 +23,7 @@
 #include "oneapi/dnnl/dnnl.h"
 
 #include "c_types_map.hpp"
+#include "cache_blob.hpp"
 #include "memory_storage.hpp"
 #include "memory_tracking.hpp"
 #include "primitive_desc.hpp"
@@ -30,13 +31,40 @@
 #include "rw_mutex.hpp"
 #include "scratchpad.hpp"
 
+#include <chrono>
 #include <future>
 #include <type_traits>
+#include <vector>
 
 namespace dnnl {
 namespace impl {
 
 struct resource_mapper_t;
+
+// Accumulates the size of the JIT code generated by the calling thread while
+// it is alive. The trackers nest, so that the code of the nested primitives
+// is also accounted to the primitive being initialized around them.
+struct jit_code_size_tracker_t {
+    jit_code_size_tracker_t();
+    ~jit_code_size_tracker_t();
+
+    size_t size() const { return own_size_ + nested_size_; }
+    size_t own_size() const { return own_size_; }
+
+    // Accounts `size` bytes of generated code to the innermost tracker of the
+    // calling thread, if any
+    static void add(size_t size);
+    // Same, for the code of a nested primitive
+    static void add_nested(size_t size);
+
+private:
+    size_t own_size_ = 0;
+    size_t nested_size_ = 0;
+    jit_code_size_tracker_t *parent_;
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(jit_code_size_tracker_t);
+};
+
 // Primitive implementation
 struct primitive_t : public c_compatible {
     using primitive_list_t = std::vector<const primitive_t *>;
@@ -63,6 +91,24 @@ struct primitive_t : public c_compatible {
 
     bool use_global_scratchpad() const { return use_global_scratchpad_; }
 
+    // Adds the program binaries of the primitive and of its nested
+    // primitives to the cache blob. The code generated for CPU primitives
+    // embeds the addresses of the primitive data and cannot be serialized.
+    virtual status_t get_cache_blob(cache_blob_t &cache_blob) const {
+        return status::unimplemented;
+    }
+
+    // Size of the buffers computed at initialization and kept for all the
+    // executions. Implementations holding such buffers report them here.
+    virtual size_t constant_memory_size() const { return 0; }
+
+    // Size of the JIT code generated at initialization of the primitive and
+    // of its nested primitives
+    size_t jit_code_size() const { return jit_code_size_; }
+    // Same, without the nested primitives, which have their own entries in
+    // the primitive cache
+    size_t own_jit_code_size() const { return own_jit_code_size_; }
+
 protected:
     template <typename impl_type, typename pd_t>
     static status_t create_primitive_common(
@@ -90,12 +136,24 @@ protected:
             // created by another thread.
             p = p_future.get().primitive;
             if (!p) return p_future.get().status;
+            // A nested primitive from the cache is still held by the
+            // primitive being initialized
+            jit_code_size_tracker_t::add_nested(p->jit_code_size());
         } else {
             // The requested primitive is NOT present in the cache therefore
             // we have to create it and notify the waiting threads
             // once the creation is done.
+            using namespace std::chrono;
+            auto start = steady_clock::now();
             p = std::make_shared<impl_type>(pd);
-            status = p->init(engine, use_global_scratchpad);
+            {
+                jit_code_size_tracker_t jit_code_size_tracker;
+                status = p->init(engine, use_global_scratchpad);
+                p->jit_code_size_ = jit_code_size_tracker.size();
+                p->own_jit_code_size_ = jit_code_size_tracker.own_size();
+            }
+            auto time = duration_cast<nanoseconds>(steady_clock::now() - start);
+            global_primitive_cache.add_creation_time((uint64_t)time.count());
             if (status != status::success) {
                 // Communicate an error.
                 p_promise.set_value({nullptr, status});
@@ -108,6 +166,10 @@ protected:
                 // Store the created primitive in the shared future and notify
                 // the waiting threads.
                 p_promise.set_value({p, status});
+                // Nested primitives are cached as separate entries
+                global_primitive_cache.update_entry(key,
+                        p->constant_memory_size() + p->own_jit_code_size(),
+                        (uint64_t)time.count());
             }
         }
         primitive = std::make_pair(p, is_from_cache);
@@ -116,6 +178,8 @@ protected:
 
     std::shared_ptr<primitive_desc_t> pd_;
     bool use_global_scratchpad_;
+    size_t jit_code_size_ = 0;
+    size_t own_jit_code_size_ = 0;
 
 private:
     primitive_t() = delete;
@@ -227,6 +291,11 @@ status_t primitive_execute(
 //
 // Note: primitive_desc_iface_t and impl::primitive_t share the same
 // impl::primitive_desc_t
+//
+// With the lazy creation the impl::primitive_t is created in background
+// while the executions are forwarded to a fallback primitive_iface_t of a
+// reference implementation. Once the creation is done, the executions
+// switch to the created implementation.
 struct dnnl_primitive : public dnnl::impl::c_compatible {
     dnnl_primitive(const std::shared_ptr<dnnl::impl::primitive_t> &primitive,
             dnnl::impl::engine_t *engine);
@@ -236,10 +305,22 @@ struct dnnl_primitive : public dnnl::impl::c_compatible {
             dnnl::impl::engine_t *engine, dnnl::impl::engine_t *src_engine,
             dnnl::impl::engine_t *dst_engine);
 
+    // This is a ctor for the lazy creation, takes ownership of `fallback`
+    dnnl_primitive(const std::shared_ptr<dnnl::impl::primitive_desc_t> &pd,
+            dnnl::impl::engine_t *engine, dnnl_primitive *fallback);
+
     dnnl::impl::status_t init();
     dnnl::impl::engine_t *engine() const;
     const primitive_desc_iface_t *pd() const;
     dnnl::impl::status_t execute(dnnl::impl::exec_ctx_t &ctx) const;
+    // Executes the primitive over independent argument sets in parallel,
+    // each item on a single thread. Native CPU runtimes only.
+    dnnl::impl::status_t execute_batch(dnnl::impl::stream_t *stream,
+            const std::vector<std::shared_ptr<const dnnl::impl::exec_args_t>>
+                    &batch) const;
+    dnnl::impl::status_t get_cache_blob(
+            dnnl::impl::cache_blob_t &cache_blob) const;
+    void get_memory_footprint(dnnl_memory_footprint_t *footprint) const;
 
     void retain() { counter_++; }
 
@@ -251,16 +332,47 @@ protected:
     ~dnnl_primitive();
 
 private:
+    dnnl::impl::status_t init_impl();
+    dnnl::impl::status_t execute_impl(dnnl::impl::exec_ctx_t &ctx,
+            const dnnl::impl::memory_storage_t *scratchpad_storage) const;
+    void create_lazily(int nthr);
+
     std::atomic<int> counter_;
     std::shared_ptr<dnnl::impl::primitive_t> primitive_;
     std::unique_ptr<dnnl::impl::scratchpad_t> scratchpad_;
     std::unique_ptr<primitive_desc_iface_t> pd_;
     dnnl::impl::resource_mapper_t resource_mapper_;
 
+    dnnl_primitive *fallback_ = nullptr;
+    std::atomic<bool> is_ready_ {true};
+    std::future<void> lazy_creation_;
+
     dnnl_primitive() = delete;
     DNNL_DISALLOW_COPY_AND_ASSIGN(dnnl_primitive);
 };
 
+// Execution arguments converted and validated once for a primitive. The
+// arguments are shared with the execution contexts instead of being
+// rebuilt on every execution.
+struct dnnl_bound_args : public dnnl::impl::c_compatible {
+    dnnl_bound_args(const dnnl_primitive *primitive_iface,
+            dnnl::impl::exec_args_t &&args)
+        : primitive_iface_(primitive_iface)
+        , args_(std::make_shared<const dnnl::impl::exec_args_t>(
+                  std::move(args))) {}
+
+    const dnnl_primitive *primitive_iface() const { return primitive_iface_; }
+    const std::shared_ptr<const dnnl::impl::exec_args_t> &args() const {
+        return args_;
+    }
+
+private:
+    const dnnl_primitive *primitive_iface_;
+    std::shared_ptr<const dnnl::impl::exec_args_t> args_;
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(dnnl_bound_args);
+};
+
 #endif
 
 // vim: et ts=4 sw=4 cindent cino^=l0,\:0,N-s
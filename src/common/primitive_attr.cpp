@@ -138,6 +138,8 @@ bool primitive_attr_t::has_default_values(dnnl_primitive_attr::skip_mask_t mask,
     CHECK_MASK(smask_t::rnn_weights_qparams, rnn_weights_qparams_);
     CHECK_MASK(smask_t::rnn_weights_projection_qparams,
             rnn_weights_projection_qparams_);
+    CHECK_MASK(smask_t::src_concat, src_concat_);
+    CHECK_MASK(smask_t::dropout, dropout_);
     CHECK_ARG(IMPLICATION((bool)(~mask & smask_t::sum_dt),
             post_ops_.sum_with_default_dt(dst_dt)));
     CHECK_ARG(this->defined(defined_mask));
@@ -164,6 +166,15 @@ bool primitive_attr_t::defined(dnnl_primitive_attr::skip_mask_t mask) const {
 #undef CHECK_ARG
 }
 
+status_t src_concat_t::set(int nsrcs, const dim_t *channels) {
+    if (nsrcs < 0 || (nsrcs > 0 && channels == nullptr))
+        return invalid_arguments;
+    for (int i = 0; i < nsrcs; ++i)
+        if (channels[i] <= 0) return invalid_arguments;
+    channels_.assign(channels, channels + nsrcs);
+    return success;
+}
+
 status_t post_ops_t::append_sum(float scale, data_type_t dt) {
     if (len() == post_ops_limit) return out_of_memory;
     entry_.emplace_back();
@@ -272,6 +283,20 @@ status_t post_ops_t::append_binary(
     return success;
 }
 
+status_t post_ops_t::append_pooling_k2s2(alg_kind_t alg) {
+    if (len() == post_ops_limit) return out_of_memory;
+    using namespace alg_kind;
+    bool alg_ok = one_of(alg, pooling_max, pooling_avg_include_padding,
+            pooling_avg_exclude_padding);
+    if (!alg_ok) return invalid_arguments;
+
+    entry_.emplace_back();
+    auto &e = entry_.back();
+    e.kind = primitive_kind::pooling;
+    e.pooling.alg = alg;
+    return success;
+}
+
 bool post_ops_t::defined() const {
     for (int idx = 0; idx < len(); ++idx) {
         auto kind = entry_[idx].kind;
@@ -287,6 +312,8 @@ bool post_ops_t::defined() const {
             if (c.scales && is_runtime_value(*(c.scales))) return false;
         } else if (kind == primitive_kind::binary) {
             // binary is always defined
+        } else if (kind == primitive_kind::pooling) {
+            // pooling is always defined
         } else {
             assert(!"unreachable");
         }
@@ -305,6 +332,16 @@ status_t primitive_attr_t::set_scratchpad_mode(
     return success;
 }
 
+status_t primitive_attr_t::set_fpmath_mode(fpmath_mode_t fpmath_mode) {
+    using namespace dnnl::impl::fpmath_mode;
+
+    const bool ok = one_of(fpmath_mode, strict, bf16, f16, any);
+    if (!ok) return invalid_arguments;
+
+    fpmath_mode_ = fpmath_mode;
+    return success;
+}
+
 status_t primitive_attr_t::set_post_ops(const post_ops_t &post_ops) {
     return post_ops_.copy_from(post_ops);
 }
@@ -349,6 +386,22 @@ status_t dnnl_primitive_attr_set_scratchpad_mode(
     return attr->set_scratchpad_mode(scratchpad_mode);
 }
 
+status_t dnnl_primitive_attr_get_fpmath_mode(
+        const primitive_attr_t *attr, fpmath_mode_t *fpmath_mode) {
+    if (any_null(attr, fpmath_mode)) return invalid_arguments;
+
+    *fpmath_mode = attr->fpmath_mode_;
+
+    return success;
+}
+
+status_t dnnl_primitive_attr_set_fpmath_mode(
+        primitive_attr_t *attr, fpmath_mode_t fpmath_mode) {
+    if (any_null(attr)) return invalid_arguments;
+
+    return attr->set_fpmath_mode(fpmath_mode);
+}
+
 status_t dnnl_primitive_attr_get_output_scales(const primitive_attr_t *attr,
         dim_t *count, int *mask, const float **scales) {
     if (any_null(attr, count, mask, scales)) return invalid_arguments;
@@ -417,6 +470,38 @@ status_t dnnl_primitive_attr_set_post_ops(
     return attr->set_post_ops(*post_ops);
 }
 
+status_t dnnl_primitive_attr_get_src_concat(
+        const primitive_attr_t *attr, int *nsrcs, const dim_t **channels) {
+    if (any_null(attr, nsrcs, channels)) return invalid_arguments;
+
+    *nsrcs = attr->src_concat_.nsrcs();
+    *channels = attr->src_concat_.channels_.data();
+    return success;
+}
+
+status_t dnnl_primitive_attr_set_src_concat(
+        primitive_attr_t *attr, int nsrcs, const dim_t *channels) {
+    if (attr == nullptr) return invalid_arguments;
+
+    return attr->src_concat_.set(nsrcs, channels);
+}
+
+status_t dnnl_primitive_attr_get_dropout(
+        const primitive_attr_t *attr, int *enabled, int *with_mask) {
+    if (any_null(attr, enabled, with_mask)) return invalid_arguments;
+
+    *enabled = attr->dropout_.enabled_;
+    *with_mask = attr->dropout_.with_mask_;
+    return success;
+}
+
+status_t dnnl_primitive_attr_set_dropout(
+        primitive_attr_t *attr, int enabled, int with_mask) {
+    if (attr == nullptr) return invalid_arguments;
+
+    return attr->dropout_.set(enabled, with_mask);
+}
+
 status_t dnnl_post_ops_create(post_ops_t **post_ops) {
     if (post_ops == nullptr) return invalid_arguments;
 
@@ -585,6 +670,23 @@ status_t dnnl_post_ops_get_params_binary(const post_ops_t *post_ops, int index,
     return success;
 }
 
+status_t dnnl_post_ops_append_pooling_k2s2(
+        post_ops_t *post_ops, alg_kind_t alg_kind) {
+    if (post_ops == nullptr) return invalid_arguments;
+
+    return post_ops->append_pooling_k2s2(alg_kind);
+}
+
+status_t dnnl_post_ops_get_params_pooling_k2s2(
+        const post_ops_t *post_ops, int index, alg_kind_t *alg_kind) {
+    if (!simple_get_params_check(post_ops, index, primitive_kind::pooling))
+        return invalid_arguments;
+
+    if (alg_kind) *alg_kind = post_ops->entry_[index].pooling.alg;
+
+    return success;
+}
+
 status_t dnnl_primitive_attr_set_rnn_data_qparams(
         primitive_attr_t *attr, const float scale, const float shift) {
     if (attr == nullptr) return invalid_arguments;
@@ -350,6 +350,11 @@ struct dnnl_post_ops : public dnnl::impl::c_compatible {
             dnnl::impl::memory_desc_t src1_desc;
         };
 
+        // 2x2 window, stride 2, no padding
+        struct pooling_t {
+            dnnl::impl::alg_kind_t alg;
+        };
+
         dnnl::impl::primitive_kind_t kind
                 = dnnl::impl::primitive_kind::undefined;
         union {
@@ -360,6 +365,7 @@ struct dnnl_post_ops : public dnnl::impl::c_compatible {
             eltwise_t eltwise;
             depthwise_conv_t depthwise_conv;
             binary_t binary;
+            pooling_t pooling;
         };
 
         bool is_eltwise(bool require_scale_one = false) const {
@@ -391,6 +397,10 @@ struct dnnl_post_ops : public dnnl::impl::c_compatible {
             return kind == dnnl::impl::primitive_kind::binary;
         }
 
+        bool is_pooling() const {
+            return kind == dnnl::impl::primitive_kind::pooling;
+        }
+
         dnnl::impl::status_t set_depthwise_scales(const float *scales);
 
         bool operator==(const entry_t &rhs) const {
@@ -430,6 +440,9 @@ struct dnnl_post_ops : public dnnl::impl::c_compatible {
                     ret = binary.alg == rhs.binary.alg
                             && binary.src1_desc == rhs.binary.src1_desc;
                     break;
+                case primitive_kind::pooling:
+                    ret = pooling.alg == rhs.pooling.alg;
+                    break;
                 default: assert(!"unsupported post_op");
             }
             return ret;
@@ -476,6 +489,7 @@ struct dnnl_post_ops : public dnnl::impl::c_compatible {
             dnnl::impl::dim_t count, int mask, const float *scales);
     dnnl::impl::status_t append_binary(dnnl::impl::alg_kind_t alg,
             const dnnl::impl::memory_desc_t *src1_desc);
+    dnnl::impl::status_t append_pooling_k2s2(dnnl::impl::alg_kind_t alg);
 
     int find(dnnl::impl::primitive_kind_t kind, int start = 0,
             int stop = -1) const {
@@ -531,9 +545,55 @@ private:
     static constexpr int post_ops_limit = 32;
 };
 
+namespace dnnl {
+namespace impl {
+
+// Channels of the sources that a primitive reads as a single source
+// concatenated along dimension 1.
+struct src_concat_t : public c_compatible {
+    bool operator==(const src_concat_t &rhs) const {
+        return channels_ == rhs.channels_;
+    }
+
+    bool has_default_values() const { return channels_.empty(); }
+
+    int nsrcs() const { return (int)channels_.size(); }
+
+    status_t set(int nsrcs, const dim_t *channels);
+
+    std::vector<dim_t> channels_;
+};
+
+// Dropout of the destination of a primitive. The probability and the seed
+// are runtime arguments, so the attribute only tells whether the dropout is
+// applied and whether the mask of the kept elements is stored.
+struct dropout_t : public c_compatible {
+    dropout_t() : enabled_(false), with_mask_(false) {}
+
+    bool operator==(const dropout_t &rhs) const {
+        return enabled_ == rhs.enabled_ && with_mask_ == rhs.with_mask_;
+    }
+
+    bool has_default_values() const { return !enabled_; }
+
+    status_t set(bool enabled, bool with_mask) {
+        if (!enabled && with_mask) return status::invalid_arguments;
+        enabled_ = enabled;
+        with_mask_ = with_mask;
+        return status::success;
+    }
+
+    bool enabled_;
+    bool with_mask_;
+};
+
+} // namespace impl
+} // namespace dnnl
+
 struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
     dnnl_primitive_attr()
-        : scratchpad_mode_(dnnl::impl::scratchpad_mode::library) {}
+        : scratchpad_mode_(dnnl::impl::scratchpad_mode::library)
+        , fpmath_mode_(dnnl::impl::fpmath_mode::strict) {}
 
     dnnl_primitive_attr *clone() const {
         return new dnnl_primitive_attr(*this);
@@ -551,12 +611,15 @@ struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
         CHECK(scales_.copy_from(other.scales_));
         zero_points_ = other.zero_points_;
         scratchpad_mode_ = other.scratchpad_mode_;
+        fpmath_mode_ = other.fpmath_mode_;
         CHECK(post_ops_.copy_from(other.post_ops_));
         rnn_data_qparams_ = other.rnn_data_qparams_;
         CHECK(rnn_weights_qparams_.copy_from(other.rnn_weights_qparams_));
         CHECK(rnn_weights_projection_qparams_.copy_from(
                 other.rnn_weights_projection_qparams_));
         CHECK(rnn_tparams_.copy_from(other.rnn_tparams_));
+        src_concat_ = other.src_concat_;
+        dropout_ = other.dropout_;
 
         return status::success;
     }
@@ -575,12 +638,15 @@ struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
         rnn_weights_qparams = 1u << 7,
         rnn_tparams = 1u << 8,
         sum_dt = 1 << 9,
-        rnn_weights_projection_qparams = 1u << 10
+        rnn_weights_projection_qparams = 1u << 10,
+        src_concat = 1u << 11,
+        dropout = 1u << 12
     };
 
     /** Returns true if the attributes have default values.
      *
-     * @note The scratchpad_mode_ is not take into account */
+     * @note The scratchpad_mode_ and fpmath_mode_ are not taken into
+     * account: every implementation may follow the strict math */
     bool has_default_values(skip_mask_t mask = skip_mask_t::none,
             dnnl::impl::data_type_t dst_dt = dnnl_data_type_undef) const;
 
@@ -589,6 +655,7 @@ struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
 
     bool operator==(const dnnl_primitive_attr &rhs) const {
         bool ret = scratchpad_mode_ == rhs.scratchpad_mode_
+                && fpmath_mode_ == rhs.fpmath_mode_
                 && output_scales_ == rhs.output_scales_
                 && scales_ == rhs.scales_ && zero_points_ == rhs.zero_points_
                 && post_ops_ == rhs.post_ops_
@@ -596,12 +663,15 @@ struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
                 && rnn_weights_qparams_ == rhs.rnn_weights_qparams_
                 && rnn_weights_projection_qparams_
                         == rhs.rnn_weights_projection_qparams_
-                && rnn_tparams_ == rhs.rnn_tparams_;
+                && rnn_tparams_ == rhs.rnn_tparams_
+                && src_concat_ == rhs.src_concat_
+                && dropout_ == rhs.dropout_;
         return ret;
     }
 
     dnnl::impl::status_t set_scratchpad_mode(
             dnnl::impl::scratchpad_mode_t scratchpad_mode);
+    dnnl::impl::status_t set_fpmath_mode(dnnl::impl::fpmath_mode_t fpmath_mode);
     dnnl::impl::status_t set_post_ops(const dnnl::impl::post_ops_t &post_ops);
 
     // NOTE: make sure that the types below have overloaded comparison operator
@@ -609,11 +679,14 @@ struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
     dnnl::impl::arg_scales_t scales_;
     dnnl::impl::zero_points_t zero_points_;
     dnnl::impl::scratchpad_mode_t scratchpad_mode_;
+    dnnl::impl::fpmath_mode_t fpmath_mode_;
     dnnl::impl::post_ops_t post_ops_;
     dnnl::impl::rnn_data_qparams_t rnn_data_qparams_;
     dnnl::impl::scales_t rnn_weights_qparams_;
     dnnl::impl::scales_t rnn_weights_projection_qparams_;
     dnnl::impl::rnn_tparams_t rnn_tparams_;
+    dnnl::impl::src_concat_t src_concat_;
+    dnnl::impl::dropout_t dropout_;
 
     dnnl_primitive_attr &operator=(const dnnl_primitive_attr &other) = delete;
 };
@@ -16,9 +16,10 @@
 
 #include "primitive_cache.hpp"
 #include "c_types_map.hpp"
+#include "primitive.hpp"
 #include "rw_mutex.hpp"
 
-#include <list>
+#include <algorithm>
 #include <unordered_map>
 
 namespace dnnl {
@@ -28,10 +29,13 @@ primitive_cache_t &primitive_cache() {
 #ifndef DNNL_DISABLE_PRIMITIVE_CACHE
     static const int capacity
             = getenv_int("DNNL_PRIMITIVE_CACHE_CAPACITY", 1024);
+    static const int capacity_mb
+            = getenv_int("DNNL_PRIMITIVE_CACHE_CAPACITY_MB", 0);
 #else
     static const int capacity = 0;
+    static const int capacity_mb = 0;
 #endif
-    static lru_primitive_cache_t cache(capacity);
+    static lru_primitive_cache_t cache(capacity, capacity_mb);
     return cache;
 }
 
@@ -49,9 +53,9 @@ status_t lru_primitive_cache_t::set_capacity(int capacity) {
     utils::lock_write_t lock_w(rw_mutex());
     capacity_ = (size_t)capacity;
     // Check if number of entries exceeds the new capacity
-    if (cache_list_.size() > capacity_) {
+    if (cache_mapper_.size() > capacity_) {
         // Evict excess entries
-        size_t n_excess_entries = cache_list_.size() - capacity_;
+        size_t n_excess_entries = cache_mapper_.size() - capacity_;
         evict(n_excess_entries);
     }
     return status::success;
@@ -62,21 +66,60 @@ int lru_primitive_cache_t::get_capacity() const {
     return (int)capacity_;
 }
 
+status_t lru_primitive_cache_t::set_capacity_mb(int capacity_mb) {
+    utils::lock_write_t lock_w(rw_mutex());
+    capacity_bytes_ = (size_t)capacity_mb << 20;
+    evict_bytes();
+    return status::success;
+}
+
+int lru_primitive_cache_t::get_capacity_mb() const {
+    utils::lock_read_t lock_r(rw_mutex());
+    return (int)(capacity_bytes_ >> 20);
+}
+
 // For undocumented API
 int lru_primitive_cache_t::get_size() const {
     utils::lock_read_t lock_r(rw_mutex());
-    return (int)cache_list_.size();
+    return (int)cache_mapper_.size();
+}
+
+void lru_primitive_cache_t::get_memory_footprint(
+        dnnl_memory_footprint_t *footprint) const {
+    *footprint = dnnl_memory_footprint_t();
+    utils::lock_read_t lock_r(rw_mutex());
+    for (const auto &e : cache_mapper_) {
+        // The primitives being created are skipped instead of waited for
+        const auto &value = e.second.value_;
+        if (value.wait_for(std::chrono::seconds(0))
+                != std::future_status::ready)
+            continue;
+        const auto &p = value.get().primitive;
+        if (!p) continue;
+        footprint->constant += p->constant_memory_size();
+        // Nested primitives are cached as separate entries
+        footprint->jit_code += p->own_jit_code_size();
+    }
+    footprint->total = footprint->constant + footprint->jit_code;
 }
 
 lru_primitive_cache_t::value_t lru_primitive_cache_t::get_or_add(
         const key_t &key, const value_t &value) {
-    // Cache is disabled
     lock_read();
+    // Cache is disabled
     if (capacity_ == 0) {
         unlock_read();
         return value_t();
     }
 
+    // Check if the requested entry is present in the cache (likely cache hit)
+    auto e = get(key);
+    if (e.valid()) {
+        unlock_read();
+        hits_++;
+        return e;
+    }
+
     unlock_read();
     lock_write();
 
@@ -86,34 +129,57 @@ lru_primitive_cache_t::value_t lru_primitive_cache_t::get_or_add(
         return value_t();
     }
 
-    // Check if the requested entry is present in the cache
-    auto e = get(key);
+    // Double check if the requested entry is present in the cache since
+    // another thread could have added it in between the locks
+    e = get(key);
     if (!e.valid()) {
         // If the entry is missing in the cache then add it
         add(key, value);
+        misses_++;
+    } else {
+        hits_++;
     }
     unlock_write();
     return e;
 }
 
 void lru_primitive_cache_t::add(const key_t &key, const value_t &value) {
-    if (cache_list_.size() >= capacity_) {
+    if (cache_mapper_.size() >= capacity_) {
         // Evict the least recently used entry
         evict(1);
     }
-    // Place a new entry to cache_list_ and update cache_mapper_
-    cache_list_.emplace_front(key, value);
-    cache_mapper_.insert(std::make_pair(key, cache_list_.begin()));
-    assert(cache_list_.size() == cache_mapper_.size());
+    cache_mapper_.emplace(std::piecewise_construct, std::forward_as_tuple(key),
+            std::forward_as_tuple(value, now()));
 }
 
+// Can be called under a read lock: only the atomic timestamp of the found
+// entry is modified
 lru_primitive_cache_t::value_t lru_primitive_cache_t::get(const key_t &key) {
     auto it = cache_mapper_.find(key);
-    if (it == cache_mapper_.end()) { return value_t(); }
+    if (it == cache_mapper_.end()) return value_t();
+
+    it->second.timestamp_.store(now());
+    // The priority is refreshed once the cost of the entry is known
+    const double cost = it->second.cost_.load();
+    if (cost != infinity()) it->second.priority_.store(inflation_ + cost);
+    return it->second.value_;
+}
+
+void lru_primitive_cache_t::update_entry(
+        const key_t &key, size_t size, uint64_t creation_time_ns) {
+    utils::lock_write_t lock_w(rw_mutex());
+    auto it = cache_mapper_.find(key);
+    // The entry could have been evicted while the primitive was created
+    if (it == cache_mapper_.end()) return;
 
-    // Move 1 cache_list_ node to the front of the cache_list_
-    cache_list_.splice(cache_list_.begin(), cache_list_, it->second);
-    return cache_list_.front().second;
+    auto &e = it->second;
+    size_bytes_ = size_bytes_ - e.size_ + size;
+    e.size_ = size;
+    const double cost
+            = (double)creation_time_ns / (double)nstl::max(size, (size_t)1);
+    e.cost_.store(cost);
+    e.priority_.store(inflation_ + cost);
+    evict_bytes();
 }
 
 void lru_primitive_cache_t::remove_if_invalidated(const key_t &key) {
@@ -125,7 +191,7 @@ void lru_primitive_cache_t::remove_if_invalidated(const key_t &key) {
         return;
     }
 
-    const auto &value = it->second->second;
+    const auto &value = it->second.value_;
     if (value.get().primitive) {
         // If the entry is not invalidated
         unlock_write();
@@ -133,18 +199,68 @@ void lru_primitive_cache_t::remove_if_invalidated(const key_t &key) {
     }
 
     // Remove the invalidated entry
-    cache_list_.erase(it->second);
-    cache_mapper_.erase(it);
-    assert(cache_list_.size() == cache_mapper_.size());
+    erase(it);
     unlock_write();
 }
 
-// Evicts n the least recently used entries
+bool lru_primitive_cache_t::contains(const key_t &key) const {
+    utils::lock_read_t lock_r(rw_mutex());
+    return cache_mapper_.count(key) != 0;
+}
+
+// Evicts n the least recently used entries, or the entries with the lowest
+// priority when the memory is limited
 void lru_primitive_cache_t::evict(size_t n) {
+    using v_t = std::unordered_map<key_t, timed_entry_t>::value_type;
+
+    if (n == cache_mapper_.size()) {
+        evictions_ += cache_mapper_.size();
+        cache_mapper_.clear();
+        size_bytes_ = 0;
+        return;
+    }
+
     for (size_t e = 0; e < n; e++) {
-        cache_mapper_.erase(cache_list_.back().first);
-        cache_list_.pop_back();
+        // Eviction is performed under the write lock, so no timestamp or
+        // priority can be updated concurrently
+        auto it = std::min_element(cache_mapper_.begin(), cache_mapper_.end(),
+                [&](const v_t &left, const v_t &right) {
+                    const auto &l = left.second;
+                    const auto &r = right.second;
+                    if (capacity_bytes_ != 0) {
+                        const double l_priority
+                                = l.priority_.load(std::memory_order_relaxed);
+                        const double r_priority
+                                = r.priority_.load(std::memory_order_relaxed);
+                        if (l_priority != r_priority)
+                            return l_priority < r_priority;
+                    }
+                    // Find the smallest timestamp
+                    return l.timestamp_.load(std::memory_order_relaxed)
+                            < r.timestamp_.load(std::memory_order_relaxed);
+                });
+        if (capacity_bytes_ != 0) {
+            const double priority = it->second.priority_;
+            if (priority != infinity() && priority > inflation_)
+                inflation_ = priority;
+        }
+        erase(it);
     }
+    evictions_ += n;
+}
+
+// Evicts entries until the memory held by the primitives fits the limit.
+// Only the created primitives have a finite priority and a size, so they
+// are evicted first.
+void lru_primitive_cache_t::evict_bytes() {
+    while (capacity_bytes_ != 0 && size_bytes_ > capacity_bytes_)
+        evict(1);
+}
+
+void lru_primitive_cache_t::erase(
+        std::unordered_map<key_t, timed_entry_t>::iterator it) {
+    size_bytes_ -= it->second.size_;
+    cache_mapper_.erase(it);
 }
 
 } // namespace impl
@@ -167,3 +283,47 @@ dnnl::impl::status_t dnnl_set_primitive_cache_capacity(int capacity) {
 #endif
     return dnnl::impl::status::success;
 }
+
+dnnl::impl::status_t dnnl_get_primitive_cache_capacity_mb(int *capacity_mb) {
+    if (capacity_mb == nullptr) return dnnl::impl::status::invalid_arguments;
+    *capacity_mb = 0;
+#ifndef DNNL_DISABLE_PRIMITIVE_CACHE
+    *capacity_mb = dnnl::impl::primitive_cache().get_capacity_mb();
+#endif
+    return dnnl::impl::status::success;
+}
+
+dnnl::impl::status_t dnnl_set_primitive_cache_capacity_mb(int capacity_mb) {
+    if (capacity_mb < 0) return dnnl::impl::status::invalid_arguments;
+#ifndef DNNL_DISABLE_PRIMITIVE_CACHE
+    return dnnl::impl::primitive_cache().set_capacity_mb(capacity_mb);
+#endif
+    return dnnl::impl::status::success;
+}
+
+dnnl::impl::status_t dnnl_get_primitive_cache_stats(
+        dnnl_primitive_cache_stats_t *stats) {
+    if (stats == nullptr) return dnnl::impl::status::invalid_arguments;
+    *stats = dnnl_primitive_cache_stats_t();
+#ifndef DNNL_DISABLE_PRIMITIVE_CACHE
+    dnnl::impl::primitive_cache().get_stats(stats);
+#endif
+    return dnnl::impl::status::success;
+}
+
+dnnl::impl::status_t dnnl_reset_primitive_cache_stats() {
+#ifndef DNNL_DISABLE_PRIMITIVE_CACHE
+    dnnl::impl::primitive_cache().reset_stats();
+#endif
+    return dnnl::impl::status::success;
+}
+
+dnnl::impl::status_t dnnl_get_primitive_cache_memory_footprint(
+        dnnl_memory_footprint_t *footprint) {
+    if (footprint == nullptr) return dnnl::impl::status::invalid_arguments;
+    *footprint = dnnl_memory_footprint_t();
+#ifndef DNNL_DISABLE_PRIMITIVE_CACHE
+    dnnl::impl::primitive_cache().get_memory_footprint(footprint);
+#endif
+    return dnnl::impl::status::success;
+}
@@ -17,8 +17,10 @@
 #ifndef COMMON_PRIMITIVE_CACHE_HPP
 #define COMMON_PRIMITIVE_CACHE_HPP
 
+#include <atomic>
+#include <chrono>
 #include <future>
-#include <list>
+#include <limits>
 #include <memory>
 #include <unordered_map>
 
@@ -45,11 +47,49 @@ struct primitive_cache_t : public c_compatible {
     virtual status_t set_capacity(int capacity) = 0;
     virtual int get_capacity() const = 0;
 
+    // Limit of the memory held by the cached primitives, 0 if none
+    virtual status_t set_capacity_mb(int capacity_mb) = 0;
+    virtual int get_capacity_mb() const = 0;
+
     virtual value_t get_or_add(const key_t &key, const value_t &value) = 0;
     virtual void remove_if_invalidated(const key_t &key) = 0;
 
+    // Records the memory held by a created primitive and the time its
+    // creation took, which weigh the entry for the eviction when the cache
+    // capacity is limited by memory
+    virtual void update_entry(
+            const key_t &key, size_t size, uint64_t creation_time_ns)
+            = 0;
+
+    // Checks whether the entry is present without updating its timestamp
+    virtual bool contains(const key_t &key) const = 0;
+
     virtual int get_size() const = 0;
 
+    // Sums the memory held by the created primitives of the cache
+    virtual void get_memory_footprint(
+            dnnl_memory_footprint_t *footprint) const = 0;
+
+    void get_stats(dnnl_primitive_cache_stats_t *stats) const {
+        stats->hits = hits_;
+        stats->misses = misses_;
+        stats->evictions = evictions_;
+        stats->creation_time_ns = creation_time_ns_;
+        stats->lock_wait_time_ns = lock_wait_time_ns_;
+    }
+
+    void reset_stats() {
+        hits_ = 0;
+        misses_ = 0;
+        evictions_ = 0;
+        creation_time_ns_ = 0;
+        lock_wait_time_ns_ = 0;
+    }
+
+    // Accounts the time spent on creation of a primitive which was missing
+    // in the cache
+    void add_creation_time(uint64_t ns) { creation_time_ns_ += ns; }
+
 protected:
     static utils::rw_mutex_t &rw_mutex() {
         static utils::rw_mutex_t mutex;
@@ -57,34 +97,97 @@ protected:
     }
 
     void lock_read() { rw_mutex().lock_read(); }
-    void lock_write() { rw_mutex().lock_write(); }
+    void lock_write() {
+        using namespace std::chrono;
+        auto start = steady_clock::now();
+        rw_mutex().lock_write();
+        auto wait = duration_cast<nanoseconds>(steady_clock::now() - start);
+        lock_wait_time_ns_ += (uint64_t)wait.count();
+    }
     void unlock_read() { rw_mutex().unlock_read(); }
     void unlock_write() { rw_mutex().unlock_write(); }
+
+    std::atomic<uint64_t> hits_ {0};
+    std::atomic<uint64_t> misses_ {0};
+    std::atomic<uint64_t> evictions_ {0};
+    std::atomic<uint64_t> creation_time_ns_ {0};
+    std::atomic<uint64_t> lock_wait_time_ns_ {0};
 };
 
-// The cache uses LRU replacement policy
+// The cache uses LRU replacement policy. Instead of keeping the entries in a
+// list ordered by the last access, which requires a write lock on every
+// cache hit, each entry holds an atomic timestamp of the last access. This
+// way the lookup of an existing entry (the most frequent case) is performed
+// under a read lock and concurrent cache hits do not serialize. The price is
+// a linear search of the least recently used entry on eviction, which is
+// negligible compared to the primitive creation that caused it.
+//
+// When the memory held by the primitives is limited as well, the entries are
+// evicted with the GreedyDual-Size policy instead: the priority of an entry
+// is its creation time per byte held, offset by an inflation value on every
+// access. The inflation value grows to the priority of every evicted entry,
+// so that the entries which are not accessed anymore eventually go, while
+// the small and expensive to create primitives stay longer than the large
+// and cheap ones.
 struct lru_primitive_cache_t : public primitive_cache_t {
-    lru_primitive_cache_t(int capacity) : capacity_(capacity) {}
+    lru_primitive_cache_t(int capacity, int capacity_mb)
+        : capacity_(capacity), capacity_bytes_((size_t)capacity_mb << 20) {}
 
     ~lru_primitive_cache_t() override = default;
 
     status_t set_capacity(int capacity) override;
     int get_capacity() const override;
 
+    status_t set_capacity_mb(int capacity_mb) override;
+    int get_capacity_mb() const override;
+
     value_t get_or_add(const key_t &key, const value_t &value) override;
     void remove_if_invalidated(const key_t &key) override;
+    void update_entry(const key_t &key, size_t size,
+            uint64_t creation_time_ns) override;
+
+    bool contains(const key_t &key) const override;
 
     int get_size() const override;
 
+    void get_memory_footprint(
+            dnnl_memory_footprint_t *footprint) const override;
+
 private:
+    struct timed_entry_t {
+        timed_entry_t(const value_t &value, size_t timestamp)
+            : value_(value), timestamp_(timestamp) {}
+        value_t value_;
+        std::atomic<size_t> timestamp_;
+        // Set once the primitive is created. Until then the entry is not
+        // evicted because of the memory limit.
+        size_t size_ = 0;
+        std::atomic<double> cost_ {infinity()};
+        std::atomic<double> priority_ {infinity()};
+    };
+
+    static constexpr double infinity() {
+        return std::numeric_limits<double>::infinity();
+    }
+
+    static size_t now() {
+        return (size_t)std::chrono::steady_clock::now()
+                .time_since_epoch()
+                .count();
+    }
+
     void evict(size_t n);
+    void evict_bytes();
+    void erase(std::unordered_map<key_t, timed_entry_t>::iterator it);
     void add(const key_t &key, const value_t &value);
     value_t get(const key_t &key);
 
     size_t capacity_;
-    using cache_list_t = std::list<std::pair<key_t, value_t>>;
-    cache_list_t cache_list_;
-    std::unordered_map<key_t, cache_list_t::iterator> cache_mapper_;
+    size_t capacity_bytes_;
+    size_t size_bytes_ = 0;
+    // Inflation value of the GreedyDual-Size policy
+    std::atomic<double> inflation_ {0};
+    std::unordered_map<key_t, timed_entry_t> cache_mapper_;
 };
 
 primitive_cache_t &primitive_cache();
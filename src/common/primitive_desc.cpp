@@ -14,17 +14,102 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <string.h>
+
 #include "oneapi/dnnl/dnnl.h"
 
 #include "c_types_map.hpp"
+#include "dnnl_thread.hpp"
+#include "engine.hpp"
 #include "nstl.hpp"
 
 #include "primitive.hpp"
+#include "primitive_cache.hpp"
 #include "primitive_desc.hpp"
+#include "primitive_hashing.hpp"
+#include "primitive_iterator.hpp"
 
 using namespace dnnl::impl;
 using namespace dnnl::impl::status;
 
+dim_t primitive_desc_t::bytes_moved() const {
+    static const int args[] = {DNNL_ARG_SRC_0, DNNL_ARG_SRC_1, DNNL_ARG_SRC_2,
+            DNNL_ARG_SRC_3, DNNL_ARG_DST_0, DNNL_ARG_DST_1, DNNL_ARG_DST_2,
+            DNNL_ARG_WEIGHTS_0, DNNL_ARG_WEIGHTS_1, DNNL_ARG_WEIGHTS_2,
+            DNNL_ARG_WEIGHTS_3, DNNL_ARG_BIAS, DNNL_ARG_MEAN,
+            DNNL_ARG_VARIANCE, DNNL_ARG_WORKSPACE, DNNL_ARG_DIFF_SRC_0,
+            DNNL_ARG_DIFF_SRC_1, DNNL_ARG_DIFF_SRC_2, DNNL_ARG_DIFF_DST_0,
+            DNNL_ARG_DIFF_DST_1, DNNL_ARG_DIFF_DST_2, DNNL_ARG_DIFF_WEIGHTS_0,
+            DNNL_ARG_DIFF_WEIGHTS_1, DNNL_ARG_DIFF_WEIGHTS_2,
+            DNNL_ARG_DIFF_WEIGHTS_3, DNNL_ARG_DIFF_BIAS};
+
+    // Runtime dimensions are unknown at creation time and are counted as 0
+    auto md_size = [](const memory_desc_t *md) -> dim_t {
+        if (!md) return 0;
+        const memory_desc_wrapper mdw(md);
+        return mdw.has_runtime_dims_or_strides() ? 0 : (dim_t)mdw.size();
+    };
+
+    dim_t bytes = 0;
+    for (int arg : args)
+        if (arg_usage(arg) != arg_usage_t::unused) bytes += md_size(arg_md(arg));
+    // Sum and concat
+    for (int i = 0; i < n_inputs(); ++i) {
+        const int arg = DNNL_ARG_MULTIPLE_SRC + i;
+        if (arg_usage(arg) != arg_usage_t::unused) bytes += md_size(arg_md(arg));
+    }
+    const auto &po = attr()->post_ops_;
+    for (int idx = 0; idx < po.len(); ++idx)
+        if (po.contain(primitive_kind::binary, idx))
+            bytes += md_size(&po.entry_[idx].binary.src1_desc);
+    return bytes;
+}
+
+namespace {
+// Returns a reference implementation of the same operation that takes
+// exactly the same memory descriptors as `pd` and is fast to create, or
+// nullptr if there is none or the lazy creation does not apply to `pd`
+primitive_desc_t *lazy_fallback_pd(
+        const primitive_desc_t *pd, engine_t *engine) {
+    if (engine->kind() != engine_kind::cpu
+            || DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_THREADPOOL)
+        return nullptr;
+    if (pd->op_desc() == nullptr || strncmp(pd->name(), "ref", 3) == 0)
+        return nullptr;
+    // A user scratchpad is sized for the requested implementation
+    if (pd->attr()->scratchpad_mode_ == scratchpad_mode::user) return nullptr;
+    // Backward implementations may depend on the forward hint
+    prop_kind_t prop_kind = prop_kind::undef;
+    if (pd->query(query::prop_kind, 0, &prop_kind) != success
+            || !utils::one_of(prop_kind, prop_kind::forward_training,
+                    prop_kind::forward_inference))
+        return nullptr;
+
+    primitive_hashing::key_t key(pd, engine, dnnl_get_max_threads());
+    if (primitive_cache().contains(key)) return nullptr;
+
+    auto same_mds = [&](const primitive_desc_t *fpd) {
+        if (fpd->n_inputs() != pd->n_inputs()
+                || fpd->n_outputs() != pd->n_outputs())
+            return false;
+        for (int i = 0; i < pd->n_inputs(); i++)
+            if (*fpd->input_md(i) != *pd->input_md(i)) return false;
+        for (int i = 0; i < pd->n_outputs(); i++)
+            if (*fpd->output_md(i) != *pd->output_md(i)) return false;
+        return *fpd->workspace_md() == *pd->workspace_md();
+    };
+
+    primitive_desc_iterator_t it(engine, pd->op_desc(), pd->attr(), nullptr);
+    if (!it.is_initialized()) return nullptr;
+    while (++it != it.end()) {
+        std::unique_ptr<primitive_desc_t> fpd(it.fetch_once());
+        if (fpd && strncmp(fpd->name(), "ref", 3) == 0 && same_mds(fpd.get()))
+            return fpd.release();
+    }
+    return nullptr;
+}
+} // namespace
+
 dnnl_primitive_desc::dnnl_primitive_desc(primitive_desc_t *pd, engine_t *engine)
     : pd_(pd), engine_(engine) {}
 
@@ -34,6 +119,30 @@ dnnl_primitive_desc::dnnl_primitive_desc(
 
 status_t dnnl_primitive_desc::create_primitive_iface(
         std::pair<primitive_iface_t *, bool> &primitive_iface) const {
+    // The binaries of a primitive created from a cache blob are loaded
+    // without compilation, so there is nothing to create in background
+    if (get_lazy_primitive_creation() && active_cache_blob() == nullptr) {
+        primitive_desc_t *fallback_pd = lazy_fallback_pd(pd_.get(), engine());
+        if (fallback_pd != nullptr) {
+            // The fallback primitive is created synchronously while the
+            // requested one is created in background
+            std::pair<primitive_iface_t *, bool> fallback;
+            const primitive_desc_iface_t fallback_pd_iface(
+                    std::shared_ptr<primitive_desc_t>(fallback_pd), engine());
+            CHECK(fallback_pd_iface.create_primitive_iface(fallback));
+            primitive_iface_t *p_iface = nullptr;
+            CHECK(safe_ptr_assign(p_iface,
+                    new primitive_iface_t(pd_, engine(), fallback.first)));
+            auto status = p_iface->init();
+            if (status != status::success) {
+                p_iface->release();
+                return status;
+            }
+            primitive_iface = std::make_pair(p_iface, false);
+            return status::success;
+        }
+    }
+
     // Step 1: create impl::primitive_t or get it from primitive cache
     std::pair<std::shared_ptr<primitive_t>, bool> p;
     auto status = pd_->create_primitive(p, engine());
@@ -83,6 +83,14 @@ struct primitive_desc_t : public c_compatible {
                                     | DNNL_ARG_SRC_1))
                 return arg_usage_t::input;
         }
+        if (!attr()->dropout_.has_default_values()) {
+            if (utils::one_of(arg, DNNL_ARG_ATTR_DROPOUT_PROBABILITY,
+                        DNNL_ARG_ATTR_DROPOUT_SEED))
+                return arg_usage_t::input;
+            if (arg == DNNL_ARG_ATTR_DROPOUT_MASK
+                    && attr()->dropout_.with_mask_)
+                return arg_usage_t::output;
+        }
 
         return arg_usage_t::unused;
     }
@@ -91,6 +99,7 @@ struct primitive_desc_t : public c_compatible {
         switch (arg) {
             case DNNL_ARG_WORKSPACE: return workspace_md(0);
             case DNNL_ARG_SCRATCHPAD: return scratchpad_md(0);
+            case DNNL_ARG_ATTR_DROPOUT_MASK: return &dropout_mask_md_;
             default: return &glob_zero_md;
         }
     }
@@ -122,6 +131,17 @@ struct primitive_desc_t : public c_compatible {
                 &scratchpad_md_, size ? 1 : 0, dims, data_type::u8, dnnl_x);
     }
 
+    // The dropout mask has a bit per element of the destination, including
+    // the padding, so it is known only once the destination format is.
+    void init_dropout_mask_md() {
+        dropout_mask_md_ = types::zero_md();
+        if (!attr_.dropout_.with_mask_) return;
+        dims_t dims = {utils::div_up(
+                memory_desc_wrapper(dst_md()).nelems(true), (dim_t)8)};
+        dnnl_memory_desc_init_by_tag(
+                &dropout_mask_md_, 1, dims, data_type::u8, dnnl_x);
+    }
+
     virtual std::type_index impl_id() const {
         assert(!"primitive_desc_t doesn't have impl_id");
         return typeid(primitive_desc_t);
@@ -176,6 +196,11 @@ struct primitive_desc_t : public c_compatible {
 
             case query::impl_info_str: *(const char **)result = name(); break;
 
+            case query::flops_f64: *(double *)result = flops(); break;
+            case query::bytes_moved_s64:
+                *(dim_t *)result = bytes_moved();
+                break;
+
             default: return status::unimplemented;
         }
         return status::success;
@@ -183,6 +208,15 @@ struct primitive_desc_t : public c_compatible {
 
     virtual int n_inputs() const { return 0; }
     virtual int n_outputs() const { return 0; }
+
+    /** returns an estimate of the number of operations of an execution, or
+     * 0 if the primitive does not provide one */
+    virtual double flops() const { return 0; }
+
+    /** returns the size of all the inputs and outputs, without the
+     * scratchpad, which is the memory traffic of an execution that
+     * accesses every argument once */
+    dim_t bytes_moved() const;
     virtual int n_binary_po_inputs() const {
         int n_inputs = 0;
         for (int idx = 0; idx < attr()->post_ops_.len(); ++idx) {
@@ -192,6 +226,10 @@ struct primitive_desc_t : public c_compatible {
         return n_inputs;
     }
 
+    /** returns true if the implementation handles weights in the sparse
+     * format, the other ones are not even initialized for such weights */
+    virtual bool supports_sparse_weights() const { return false; }
+
     virtual status_t create_primitive(
             std::pair<std::shared_ptr<primitive_t>, bool> &primitive,
             engine_t *engine) const = 0;
@@ -235,12 +273,23 @@ struct primitive_desc_t : public c_compatible {
             delete _pd;
             return out_of_memory;
         }
+        if (_pd->weights_md(0)->format_kind == format_kind::sparse
+                && !_pd->supports_sparse_weights()) {
+            report_dispatch(_pd, dispatch_reason::sparse);
+            delete _pd;
+            return unimplemented;
+        }
+        set_dispatch_reason(nullptr);
         if (_pd->init(engine) != success) {
+            const char *reason = take_dispatch_reason();
+            report_dispatch(_pd, reason ? reason : dispatch_reason::unknown);
             delete _pd;
             return unimplemented;
         }
+        report_dispatch(_pd, nullptr);
 
         _pd->init_scratchpad_md();
+        _pd->init_dropout_mask_md();
         *pd = _pd;
         return success;
     }
@@ -249,7 +298,16 @@ protected:
     primitive_attr_t attr_;
     primitive_kind_t kind_;
 
+    // Reports the decision of an implementation at the dispatch verbose
+    // level: rejected with `reason`, or accepted if it is nullptr.
+    static void report_dispatch(
+            const primitive_desc_t *pd, const char *reason) {
+        if (get_verbose() >= 4)
+            verbose_print_dispatch(pd->kind(), pd->name(), reason);
+    }
+
     memory_desc_t scratchpad_md_;
+    memory_desc_t dropout_mask_md_ = types::zero_md();
 
     mutable pd_info_t info_;
 
@@ -66,24 +66,24 @@ status_t cvt_primitive_args(const primitive_desc_t *pd, int nargs,
 }
 
 memory_t *exec_ctx_t::input(int arg) const {
-    if (args_.count(arg) != 1) return nullptr;
-    const auto ma = args_.at(arg);
-    assert(ma.is_const);
-    return ma.mem;
+    const auto it = args_->find(arg);
+    if (it == args_->end()) return nullptr;
+    assert(it->second.is_const);
+    return it->second.mem;
 }
 
 memory_t *exec_ctx_t::output(int arg) const {
-    if (args_.count(arg) != 1) return nullptr;
-    const auto ma = args_.at(arg);
-    assert(!ma.is_const);
-    return ma.mem;
+    const auto it = args_->find(arg);
+    if (it == args_->end()) return nullptr;
+    assert(!it->second.is_const);
+    return it->second.mem;
 }
 
 memory_t *exec_ctx_t::memory(int arg) const {
-    assert(args_.count(arg) == 1);
-    const auto ma = args_.at(arg);
-    assert(!ma.is_const);
-    return ma.mem;
+    const auto it = args_->find(arg);
+    assert(it != args_->end());
+    assert(!it->second.is_const);
+    return it->second.mem;
 }
 
 void exec_ctx_t::register_memory_mapping(void *handle, void *host_ptr) {
@@ -92,10 +92,10 @@ void exec_ctx_t::register_memory_mapping(void *handle, void *host_ptr) {
 }
 
 void *exec_ctx_t::host_ptr(int arg) const {
-    if (args_.count(arg) != 1) return nullptr;
+    const auto it = args_->find(arg);
+    if (it == args_->end()) return nullptr;
 
-    auto *mem = args_.at(arg).mem;
-    auto *mem_storage = mem->memory_storage();
+    auto *mem_storage = it->second.mem->memory_storage();
     return host_ptr(mem_storage);
 }
 
@@ -146,8 +146,9 @@ memory_desc_wrapper exec_ctx_t::memory_mdw(
         if (!mdw_from_primitive_desc.has_runtime_dims_or_strides())
             return mdw_from_primitive_desc;
     }
-    if (args_.count(arg) != 1) return memory_desc_wrapper(&glob_zero_md);
-    return memory_desc_wrapper(args_.at(arg).mem->md());
+    const auto it = args_->find(arg);
+    if (it == args_->end()) return memory_desc_wrapper(&glob_zero_md);
+    return memory_desc_wrapper(it->second.mem->md());
 }
 
 const resource_mapper_t *exec_ctx_t::get_resource_mapper() const {
@@ -17,6 +17,7 @@
 #ifndef COMMON_PRIMITIVE_EXEC_TYPES_HPP
 #define COMMON_PRIMITIVE_EXEC_TYPES_HPP
 
+#include <memory>
 #include <unordered_map>
 
 #include "oneapi/dnnl/dnnl_types.h"
@@ -55,17 +56,23 @@ status_t cvt_primitive_args(const primitive_desc_t *pd, int nargs,
 /** Primitive execution context (helps passing stream, memories, and events. */
 struct resource_mapper_t;
 struct exec_ctx_t {
-    explicit exec_ctx_t(stream_t *stream) : stream_(stream) {}
+    explicit exec_ctx_t(stream_t *stream)
+        : stream_(stream), args_(std::make_shared<const exec_args_t>()) {}
     exec_ctx_t(stream_t *stream, exec_args_t &&args)
-        : stream_(stream), args_(std::move(args)) {}
+        : stream_(stream)
+        , args_(std::make_shared<const exec_args_t>(std::move(args))) {}
+    // Shares the arguments with the caller, used for the arguments bound to
+    // a primitive once and reused by every execution.
+    exec_ctx_t(stream_t *stream, const std::shared_ptr<const exec_args_t> &args)
+        : stream_(stream), args_(args) {}
     exec_ctx_t(const exec_ctx_t &other, exec_args_t &&args)
         : stream_(other.stream_)
-        , args_(std::move(args))
+        , args_(std::make_shared<const exec_args_t>(std::move(args)))
         , memory_mapping_(other.memory_mapping_)
         , resource_mapper_(other.resource_mapper_) {}
 
     stream_t *stream() const { return stream_; }
-    const exec_args_t &args() const { return args_; }
+    const exec_args_t &args() const { return *args_; }
 
     memory_t *input(int arg) const;
     memory_t *output(int arg) const;
@@ -117,7 +124,7 @@ struct exec_ctx_t {
 
 private:
     stream_t *stream_;
-    exec_args_t args_;
+    std::shared_ptr<const exec_args_t> args_;
 
     std::unordered_map<void *, void *> memory_mapping_;
     const resource_mapper_t *resource_mapper_ = nullptr;
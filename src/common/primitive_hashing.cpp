@@ -71,9 +71,15 @@ void key_t::init_mds(const primitive_desc_t *pd) {
         case primitive_kind::eltwise: {
             break;
         }
+        case primitive_kind::embedding_bag: {
+            break;
+        }
         case primitive_kind::gemm: {
             break;
         }
+        case primitive_kind::group_normalization: {
+            break;
+        }
         case primitive_kind::inner_product: {
             break;
         }
@@ -89,12 +95,18 @@ void key_t::init_mds(const primitive_desc_t *pd) {
         case primitive_kind::matmul: {
             break;
         }
+        case primitive_kind::optimizer: {
+            break;
+        }
         case primitive_kind::pooling:
         case primitive_kind::pooling_v2: {
             auto typed_pd = utils::downcast<const pooling_pd_t *>(pd);
             if (!typed_pd->is_fwd()) {
                 mds.push_back(*typed_pd->diff_dst_md(0));
                 mds.push_back(*typed_pd->diff_src_md(0));
+                // max pooling reads either the workspace or the source
+                mds.push_back(*typed_pd->workspace_md(0));
+                mds.push_back(*typed_pd->src_md(0));
             }
             break;
         }
@@ -215,6 +227,16 @@ size_t get_md_hash(const memory_desc_t &md) {
                     seed, md.format_desc.rnn_packed_desc.offset_compensation);
             seed = hash_combine(seed, md.format_desc.rnn_packed_desc.size);
             break;
+        case format_kind::sparse:
+            seed = get_array_hash(
+                    seed, md.format_desc.sparse_desc.block_dims, 2);
+            seed = hash_combine(seed, md.format_desc.sparse_desc.nnz_blocks);
+            seed = hash_combine(
+                    seed, md.format_desc.sparse_desc.row_ptr_offset);
+            seed = hash_combine(
+                    seed, md.format_desc.sparse_desc.col_idx_offset);
+            seed = hash_combine(seed, md.format_desc.sparse_desc.size);
+            break;
         default: assert(!"unknown format_kind");
     }
 
@@ -244,6 +266,8 @@ size_t get_attr_hash(const primitive_attr_t &attr) {
     size_t seed = 0;
     // scratchpad_mode
     seed = hash_combine(seed, static_cast<size_t>(attr.scratchpad_mode_));
+    // fpmath_mode
+    seed = hash_combine(seed, static_cast<size_t>(attr.fpmath_mode_));
 
     if (!attr.output_scales_.has_default_values()) {
         // output_scales: mask
@@ -311,6 +335,10 @@ size_t get_attr_hash(const primitive_attr_t &attr) {
                         seed, static_cast<size_t>(entry.binary.alg));
                 seed = hash_combine(seed, get_md_hash(entry.binary.src1_desc));
                 break;
+            case primitive_kind::pooling:
+                seed = hash_combine(
+                        seed, static_cast<size_t>(entry.pooling.alg));
+                break;
             default: assert(!"unknown post_op");
         }
     }
@@ -326,6 +354,12 @@ size_t get_attr_hash(const primitive_attr_t &attr) {
         seed = get_array_hash(seed, attr.rnn_weights_qparams_.scales_,
                 attr.rnn_weights_qparams_.count_);
     }
+    // src_concat: channels[:]
+    seed = get_array_hash(seed, attr.src_concat_.channels_.data(),
+            attr.src_concat_.nsrcs());
+    // dropout: enabled, with_mask
+    seed = hash_combine(seed, attr.dropout_.enabled_);
+    seed = hash_combine(seed, attr.dropout_.with_mask_);
     // Combined hash for attributes
     return seed;
 }
@@ -423,6 +457,22 @@ size_t get_desc_hash(const eltwise_desc_t &desc) {
     return seed;
 }
 
+size_t get_desc_hash(const embedding_bag_desc_t &desc) {
+    size_t seed = 0;
+    // Kinds
+    seed = hash_combine(seed, static_cast<size_t>(desc.primitive_kind));
+    seed = hash_combine(seed, static_cast<size_t>(desc.prop_kind));
+    seed = hash_combine(seed, static_cast<size_t>(desc.alg_kind));
+    // Memory descriptors
+    seed = hash_combine(seed, get_md_hash(desc.indices_desc));
+    seed = hash_combine(seed, get_md_hash(desc.offsets_desc));
+    seed = hash_combine(seed, get_md_hash(desc.table_desc));
+    seed = hash_combine(seed, get_md_hash(desc.scale_shift_desc));
+    seed = hash_combine(seed, get_md_hash(desc.dst_desc));
+    // Combined hash for embedding bag desc
+    return seed;
+}
+
 size_t get_desc_hash(const gemm_desc_t &desc) {
     size_t seed = 0;
     // Kinds
@@ -437,6 +487,25 @@ size_t get_desc_hash(const gemm_desc_t &desc) {
     return seed;
 }
 
+size_t get_desc_hash(const group_normalization_desc_t &desc) {
+    size_t seed = 0;
+    // Kinds
+    seed = hash_combine(seed, static_cast<size_t>(desc.primitive_kind));
+    seed = hash_combine(seed, static_cast<size_t>(desc.prop_kind));
+    // Memory descriptors
+    seed = hash_combine(seed, get_md_hash(desc.data_desc));
+    seed = hash_combine(seed, get_md_hash(desc.data_scaleshift_desc));
+    seed = hash_combine(seed, get_md_hash(desc.stat_desc));
+    // Groups
+    seed = hash_combine(seed, desc.groups);
+    // Epsilon
+    seed = hash_combine(seed, desc.group_norm_epsilon);
+    // Flags
+    seed = hash_combine(seed, desc.flags);
+    // Combined hash for group_normalization desc
+    return seed;
+}
+
 size_t get_desc_hash(const inner_product_desc_t &desc) {
     size_t seed = 0;
     // Kinds
@@ -512,6 +581,25 @@ size_t get_desc_hash(const matmul_desc_t &desc) {
     return seed;
 }
 
+size_t get_desc_hash(const optimizer_desc_t &desc) {
+    size_t seed = 0;
+    // Kinds
+    seed = hash_combine(seed, static_cast<size_t>(desc.primitive_kind));
+    seed = hash_combine(seed, static_cast<size_t>(desc.alg_kind));
+    // Memory descriptors
+    seed = hash_combine(seed, get_md_hash(desc.weights_desc));
+    seed = hash_combine(seed, get_md_hash(desc.diff_weights_desc));
+    seed = hash_combine(seed, get_md_hash(desc.dst_desc));
+    // Hyperparameters
+    seed = hash_combine(seed, desc.momentum);
+    seed = hash_combine(seed, desc.beta2);
+    seed = hash_combine(seed, desc.epsilon);
+    seed = hash_combine(seed, desc.weight_decay);
+    seed = hash_combine(seed, desc.max_grad_norm);
+    // Combined hash for optimizer desc
+    return seed;
+}
+
 size_t get_desc_hash(const pooling_desc_t &desc) {
     size_t seed = 0;
     // Kinds
@@ -46,11 +46,14 @@ struct cached_op_desc_t {
             CASE(binary)
             CASE(convolution)
             CASE(eltwise)
+            CASE(embedding_bag)
             CASE(gemm)
+            CASE(group_normalization)
             CASE(inner_product)
             CASE(layer_normalization)
             CASE(lrn)
             CASE(matmul)
+            CASE(optimizer)
             case primitive_kind::pooling_v2:
             CASE(pooling)
             CASE(prelu)
@@ -89,11 +92,14 @@ struct cached_op_desc_t {
             CASE(concat)
             CASE(convolution)
             CASE(eltwise)
+            CASE(embedding_bag)
             CASE(gemm)
+            CASE(group_normalization)
             CASE(inner_product)
             CASE(layer_normalization)
             CASE(lrn)
             CASE(matmul)
+            CASE(optimizer)
             case primitive_kind::pooling_v2:
             CASE(pooling)
             CASE(prelu)
@@ -124,11 +130,14 @@ struct cached_op_desc_t {
     DECLARE_CONVERSION_OPERATOR(concat)
     DECLARE_CONVERSION_OPERATOR(convolution)
     DECLARE_CONVERSION_OPERATOR(eltwise)
+    DECLARE_CONVERSION_OPERATOR(embedding_bag)
     DECLARE_CONVERSION_OPERATOR(gemm)
+    DECLARE_CONVERSION_OPERATOR(group_normalization)
     DECLARE_CONVERSION_OPERATOR(inner_product)
     DECLARE_CONVERSION_OPERATOR(layer_normalization)
     DECLARE_CONVERSION_OPERATOR(lrn)
     DECLARE_CONVERSION_OPERATOR(matmul)
+    DECLARE_CONVERSION_OPERATOR(optimizer)
     DECLARE_CONVERSION_OPERATOR(pooling)
     DECLARE_CONVERSION_OPERATOR(pooling_v2)
     DECLARE_CONVERSION_OPERATOR(prelu)
@@ -155,12 +164,15 @@ struct cached_op_desc_t {
             CASE(concat)
             CASE(convolution)
             CASE(eltwise)
+            CASE(embedding_bag)
             CASE(gemm)
+            CASE(group_normalization)
             CASE(inner_product)
             CASE(layer_normalization)
             CASE(logsoftmax)
             CASE(lrn)
             CASE(matmul)
+            CASE(optimizer)
             case primitive_kind::pooling_v2:
             CASE(pooling)
             CASE(prelu)
@@ -231,11 +243,14 @@ size_t get_desc_hash(const batch_normalization_desc_t &desc);
 size_t get_desc_hash(const binary_desc_t &desc);
 size_t get_desc_hash(const convolution_desc_t &desc);
 size_t get_desc_hash(const eltwise_desc_t &desc);
+size_t get_desc_hash(const embedding_bag_desc_t &desc);
 size_t get_desc_hash(const gemm_desc_t &desc);
+size_t get_desc_hash(const group_normalization_desc_t &desc);
 size_t get_desc_hash(const inner_product_desc_t &desc);
 size_t get_desc_hash(const layer_normalization_desc_t &desc);
 size_t get_desc_hash(const lrn_desc_t &desc);
 size_t get_desc_hash(const matmul_desc_t &desc);
+size_t get_desc_hash(const optimizer_desc_t &desc);
 size_t get_desc_hash(const pooling_desc_t &desc);
 size_t get_desc_hash(const pooling_v2_desc_t &desc);
 size_t get_desc_hash(const prelu_desc_t &desc);
@@ -308,11 +323,14 @@ struct hash<dnnl::impl::primitive_hashing::key_t> {
             CASE(convolution)
             CASE(deconvolution)
             CASE(eltwise)
+            CASE(embedding_bag)
             CASE(gemm)
+            CASE(group_normalization)
             CASE(inner_product)
             CASE(layer_normalization)
             CASE(lrn)
             CASE(matmul)
+            CASE(optimizer)
             case primitive_kind::pooling_v2:
             CASE(pooling)
             CASE(prelu)
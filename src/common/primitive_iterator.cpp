@@ -37,11 +37,51 @@ status_t dnnl_primitive_desc_iterator_create(
     using namespace primitive_kind;
     bool known_primitive_kind = utils::one_of(op_desc->kind,
             batch_normalization, binary, convolution, deconvolution, eltwise,
-            gemm, inner_product, layer_normalization, lrn, logsoftmax, matmul,
-            pooling, pooling_v2, prelu, reduction, resampling, rnn, shuffle,
-            softmax);
+            embedding_bag, gemm, group_normalization, inner_product,
+            layer_normalization, lrn, logsoftmax, matmul, optimizer, pooling,
+            pooling_v2, prelu, reduction, resampling, rnn, shuffle, softmax);
     if (!known_primitive_kind) return invalid_arguments;
 
+    // The pooling post-op changes the shape of the destination, which only
+    // convolution knows how to handle, and nothing can follow it.
+    if (attr) {
+        const auto &po = attr->post_ops_;
+        const int pool_idx = po.find(pooling);
+        if (pool_idx != -1
+                && (op_desc->kind != convolution || pool_idx != po.len() - 1))
+            return invalid_arguments;
+
+        // The channels of the concatenated sources must make up the source
+        // of a forward convolution.
+        const auto &sc = attr->src_concat_;
+        if (!sc.has_default_values()) {
+            if (op_desc->kind != convolution) return invalid_arguments;
+            const auto &cd = *(const convolution_desc_t *)op_desc;
+            dim_t channels = 0;
+            for (int i = 0; i < sc.nsrcs(); ++i)
+                channels += sc.channels_[i];
+            if (!utils::one_of(cd.prop_kind, prop_kind::forward_training,
+                        prop_kind::forward_inference)
+                    || channels != cd.src_desc.dims[1])
+                return invalid_arguments;
+        }
+
+        // The dropout applies to the eltwise and binary destinations, and
+        // the backward regenerates the mask from the seed instead of
+        // reading it.
+        const auto &dr = attr->dropout_;
+        if (!dr.has_default_values()) {
+            if (!utils::one_of(op_desc->kind, eltwise, binary))
+                return invalid_arguments;
+            if (op_desc->kind == eltwise && dr.with_mask_) {
+                const auto &ed = *(const eltwise_desc_t *)op_desc;
+                if (!utils::one_of(ed.prop_kind, prop_kind::forward_training,
+                            prop_kind::forward_inference))
+                    return invalid_arguments;
+            }
+        }
+    }
+
     auto it = new primitive_desc_iterator_t(engine, op_desc, attr,
             hint_fwd_pd ? hint_fwd_pd->impl().get() : nullptr);
     if (it == nullptr) return out_of_memory;
@@ -15,10 +15,13 @@
 *******************************************************************************/
 
 #include <assert.h>
+#include <unordered_map>
 #include "oneapi/dnnl/dnnl.h"
 
 #include "c_types_map.hpp"
 #include "engine.hpp"
+#include "primitive_hashing.hpp"
+#include "rw_mutex.hpp"
 #include "type_helpers.hpp"
 #include "utils.hpp"
 
@@ -48,6 +51,62 @@ static engine_t *get_reorder_engine(
     return src_engine;
 }
 
+namespace {
+// The cpu reorder implementation list is long, and most of its entries
+// reject a given pair of memory descriptors only after some checks. Small
+// reorders of the inputs and outputs are typically created over and over
+// with the same descriptors, so the position of the implementation picked
+// for them is remembered and tried first. A creation function depends on
+// the descriptors, attributes and engine only, hence the result is the
+// same as the one of the full list walk.
+struct reorder_dispatch_key_t {
+    const void *impl_list;
+    memory_desc_t src_md;
+    memory_desc_t dst_md;
+
+    bool operator==(const reorder_dispatch_key_t &rhs) const {
+        return impl_list == rhs.impl_list && src_md == rhs.src_md
+                && dst_md == rhs.dst_md;
+    }
+};
+
+struct reorder_dispatch_key_hash_t {
+    size_t operator()(const reorder_dispatch_key_t &key) const {
+        size_t seed = std::hash<const void *>()(key.impl_list);
+        seed = hash_combine(seed, primitive_hashing::get_md_hash(key.src_md));
+        seed = hash_combine(seed, primitive_hashing::get_md_hash(key.dst_md));
+        return seed;
+    }
+};
+
+struct reorder_dispatch_table_t {
+    int find(const reorder_dispatch_key_t &key) {
+        utils::lock_read_t lock_r(mutex_);
+        const auto it = table_.find(key);
+        return it == table_.end() ? -1 : it->second;
+    }
+
+    void insert(const reorder_dispatch_key_t &key, int impl_idx) {
+        utils::lock_write_t lock_w(mutex_);
+        // the table only saves the list walk, dropping it is always safe
+        if (table_.size() >= capacity_) table_.clear();
+        table_[key] = impl_idx;
+    }
+
+private:
+    static constexpr size_t capacity_ = 1024;
+    utils::rw_mutex_t mutex_;
+    std::unordered_map<reorder_dispatch_key_t, int,
+            reorder_dispatch_key_hash_t>
+            table_;
+};
+
+reorder_dispatch_table_t &reorder_dispatch_table() {
+    static reorder_dispatch_table_t table;
+    return table;
+}
+} // namespace
+
 status_t dnnl_reorder_primitive_desc_create(
         primitive_desc_iface_t **reorder_pd_iface, const memory_desc_t *src_md,
         engine_t *src_engine, const memory_desc_t *dst_md, engine_t *dst_engine,
@@ -68,15 +127,37 @@ status_t dnnl_reorder_primitive_desc_create(
     if (attr == nullptr) attr = &default_attr();
 
     auto e = get_reorder_engine(src_engine, dst_engine);
-    for (auto r = e->get_reorder_implementation_list(src_md, dst_md); *r; ++r) {
+    const auto impl_list = e->get_reorder_implementation_list(src_md, dst_md);
+
+    auto create_iface = [&](reorder_pd_t *reorder_pd) {
+        auto status = safe_ptr_assign(*reorder_pd_iface,
+                new reorder_primitive_desc_iface_t(
+                        reorder_pd, e, src_engine, dst_engine));
+        if (status != status::success) delete reorder_pd;
+        return status;
+    };
+
+    // the dispatch table is limited to cpu reorders with default attributes
+    const bool use_dispatch_table = s_ek == engine_kind::cpu
+            && d_ek == engine_kind::cpu && attr->has_default_values();
+    const reorder_dispatch_key_t key {impl_list, *src_md, *dst_md};
+    if (use_dispatch_table) {
+        const int impl_idx = reorder_dispatch_table().find(key);
+        reorder_pd_t *reorder_pd = nullptr;
+        if (impl_idx >= 0
+                && impl_list[impl_idx](&reorder_pd, e, attr, src_engine,
+                           src_md, dst_engine, dst_md)
+                        == success)
+            return create_iface(reorder_pd);
+    }
+
+    for (auto r = impl_list; *r; ++r) {
         reorder_pd_t *reorder_pd = nullptr;
         if ((*r)(&reorder_pd, e, attr, src_engine, src_md, dst_engine, dst_md)
                 == success) {
-            auto status = safe_ptr_assign(*reorder_pd_iface,
-                    new reorder_primitive_desc_iface_t(
-                            reorder_pd, e, src_engine, dst_engine));
-            if (status != status::success) delete reorder_pd;
-            return status;
+            if (use_dispatch_table)
+                reorder_dispatch_table().insert(key, (int)(r - impl_list));
+            return create_iface(reorder_pd);
         }
     }
     return unimplemented;
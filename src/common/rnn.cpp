@@ -31,6 +31,7 @@ int get_gates_count(dnnl_alg_kind_t cell_kind) {
         case dnnl::impl::alg_kind::vanilla_rnn: return 1;
         case dnnl::impl::alg_kind::vanilla_gru: return 3;
         case dnnl::impl::alg_kind::lbr_gru: return 3;
+        case dnnl::impl::alg_kind::vanilla_augru: return 3;
         case dnnl::impl::alg_kind::vanilla_lstm: return 4;
         default: assert(!"unknown cell kind"); return 0;
     }
@@ -93,7 +94,8 @@ status_t check_data_type_consistency_fwd(const rnn_desc_t &r) {
 
     bool is_forward = !(r.prop_kind == prop_kind::backward);
     bool is_inference = r.prop_kind == prop_kind::forward_inference;
-    bool is_int8_ok = one_of(r.cell_kind, dnnl_vanilla_lstm, dnnl_vanilla_gru);
+    bool is_int8_ok = one_of(r.cell_kind, dnnl_vanilla_rnn, dnnl_vanilla_lstm,
+            dnnl_vanilla_gru, dnnl_lbr_gru);
 
     bool cell_state_check = expect_dt(r.src_iter_c_desc, f32, f16)
             && expect_dt(r.dst_iter_c_desc, f32, f16);
@@ -125,14 +127,14 @@ status_t check_data_type_consistency_fwd(const rnn_desc_t &r) {
             && everyone_is(s8, weights_iter_dt, weights_layer_dt)
             && expect_dt(r.src_iter_desc, u8)
             && expect_dt(r.src_iter_c_desc, f32)
-            && r.weights_peephole_desc.data_type == data_type::undef
+            && expect_dt(r.weights_peephole_desc, f32)
             && one_of(weights_projection_dt, s8, data_type::undef)
             && expect_dt(r.dst_iter_desc, u8)
             && expect_dt(r.dst_iter_c_desc, f32) && expect_dt(r.bias_desc, f32);
 
     bool is_f32u8f32 = is_inference && is_int8_ok && src_layer_dt == u8
             && everyone_is(s8, weights_iter_dt, weights_layer_dt)
-            && r.weights_peephole_desc.data_type == data_type::undef
+            && expect_dt(r.weights_peephole_desc, f32)
             && one_of(weights_projection_dt, s8, data_type::undef)
             && one_of(dst_layer_dt, u8, f32) && expect_dt(r.src_iter_desc, f32)
             && expect_dt(r.dst_iter_desc, f32) && expect_dt(r.bias_desc, f32);
@@ -186,7 +188,8 @@ status_t check_dim_consistency(const rnn_desc_t &r) {
             = (r.direction == dnnl_bidirectional_concat) ? 2 : 1;
 
     bool args_ok = IMPLICATION(utils::one_of(r.cell_kind, alg_kind::vanilla_gru,
-                                       alg_kind::lbr_gru),
+                                       alg_kind::lbr_gru,
+                                       alg_kind::vanilla_augru),
                            SIC == DHC)
             && dlc_multiplier * DIC == DLC
             && IMPLICATION(L > 1, dlc_multiplier * SLC == DLC)
@@ -241,7 +244,7 @@ status_t rnn_common_fwd_desc_init(dnnl_rnn_desc_t *rnn_desc,
 
     // check that a supported cell kind has been passed
     bool args_ok = one_of(cell_kind, dnnl_vanilla_rnn, dnnl_vanilla_lstm,
-            dnnl_vanilla_gru, dnnl_lbr_gru);
+            dnnl_vanilla_gru, dnnl_lbr_gru, dnnl_vanilla_augru);
     if (!args_ok) return invalid_arguments;
 
     // check that all mandatory parameters are non-null
@@ -265,6 +268,12 @@ status_t rnn_common_fwd_desc_init(dnnl_rnn_desc_t *rnn_desc,
         if (!args_ok) return invalid_arguments;
     }
 
+    // check that only the known flags are passed
+    args_ok = args_ok
+            && (flags & ~(rnn_flags::seq_lengths | rnn_flags::recompute_gates))
+                    == 0;
+    if (!args_ok) return invalid_arguments;
+
     CHECK(check_runtime_dims_or_strides({src_layer_desc, src_iter_desc,
             src_iter_c_desc, weights_layer_desc, weights_iter_desc,
             weights_peephole_desc, weights_projection_desc, bias_desc,
@@ -343,6 +352,13 @@ status_t rnn_common_bwd_desc_init(dnnl_rnn_desc_t *rnn_desc,
                     diff_dst_layer_desc);
     if (!args_ok) return invalid_arguments;
 
+    // variable sequence lengths are supported for forward only
+    args_ok = args_ok
+            && (flags & ~(rnn_flags::seq_lengths | rnn_flags::recompute_gates))
+                    == 0;
+    if (!args_ok) return invalid_arguments;
+    if (flags & rnn_flags::seq_lengths) return unimplemented;
+
     if (cell_kind == dnnl_vanilla_rnn) {
         using namespace alg_kind;
         args_ok = args_ok
@@ -518,6 +534,22 @@ status_t dnnl_gru_forward_desc_init(dnnl_rnn_desc_t *rnn_desc,
     return st;
 }
 
+status_t dnnl_augru_forward_desc_init(dnnl_rnn_desc_t *rnn_desc,
+        dnnl_prop_kind_t prop_kind, dnnl_rnn_direction_t direction,
+        const dnnl_memory_desc_t *src_layer_desc,
+        const dnnl_memory_desc_t *src_iter_desc,
+        const dnnl_memory_desc_t *weights_layer_desc,
+        const dnnl_memory_desc_t *weights_iter_desc,
+        const dnnl_memory_desc_t *bias_desc,
+        const dnnl_memory_desc_t *dst_layer_desc,
+        const dnnl_memory_desc_t *dst_iter_desc, unsigned flags) {
+    status_t st = rnn_common_fwd_desc_init(rnn_desc, prop_kind,
+            dnnl_vanilla_augru, direction, src_layer_desc, src_iter_desc,
+            nullptr, weights_layer_desc, weights_iter_desc, nullptr, nullptr,
+            bias_desc, dst_layer_desc, dst_iter_desc, nullptr, flags);
+    return st;
+}
+
 status_t dnnl_lbr_gru_forward_desc_init(dnnl_rnn_desc_t *rnn_desc,
         dnnl_prop_kind_t prop_kind, dnnl_rnn_direction_t direction,
         const dnnl_memory_desc_t *src_layer_desc,
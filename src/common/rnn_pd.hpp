@@ -111,6 +111,14 @@ struct rnn_pd_t : public primitive_desc_t {
                 prop_kind::forward_inference);
     }
 
+    double flops() const override {
+        // Gates matrix multiplications only; backward computes the gradients
+        // of both the data and the weights
+        const double fwd_flops
+                = 2.0 * L() * D() * T() * MB() * G() * DHC() * (SLC() + SIC());
+        return is_fwd() ? fwd_flops : 2 * fwd_flops;
+    }
+
     dim_t T() const { return desc_.src_layer_desc.dims[0]; }
     dim_t MB() const { return desc_.src_layer_desc.dims[1]; }
 
@@ -162,6 +170,8 @@ struct rnn_pd_t : public primitive_desc_t {
 
     bool is_lstm() const { return cell_kind() == dnnl_vanilla_lstm; }
 
+    bool is_augru() const { return cell_kind() == dnnl_vanilla_augru; }
+
     bool is_lstm_peephole() const {
         return !memory_desc_wrapper(weights_peephole_md_).is_zero();
     }
@@ -170,6 +180,14 @@ struct rnn_pd_t : public primitive_desc_t {
         return !memory_desc_wrapper(weights_projection_md_).is_zero();
     }
 
+    bool with_seq_lengths() const {
+        return desc_.flags & rnn_flags::seq_lengths;
+    }
+
+    bool with_recompute_gates() const {
+        return desc_.flags & rnn_flags::recompute_gates;
+    }
+
     dnnl_rnn_direction_t direction() const { return desc_.direction; }
 
 protected:
@@ -197,17 +215,36 @@ struct rnn_fwd_pd_t : public rnn_pd_t {
 
     rnn_fwd_pd_t(const rnn_desc_t *adesc, const primitive_attr_t *attr,
             const rnn_fwd_pd_t *hint_fwd_pd)
-        : rnn_pd_t(adesc, attr, hint_fwd_pd) {}
+        : rnn_pd_t(adesc, attr, hint_fwd_pd)
+        , seq_lengths_md_()
+        , augru_attention_md_() {
+        if (with_seq_lengths()) {
+            const dims_t seq_lengths_dims = {MB()};
+            dnnl_memory_desc_init_by_tag(&seq_lengths_md_, 1,
+                    seq_lengths_dims, data_type::s32, format_tag::x);
+        }
+        if (is_augru()) {
+            const dims_t attention_dims = {T(), MB(), 1};
+            dnnl_memory_desc_init_by_tag(&augru_attention_md_, 3,
+                    attention_dims, data_type::f32, format_tag::tnc);
+        }
+    }
 
     arg_usage_t arg_usage(int arg) const override {
         if (arg == DNNL_ARG_SRC_LAYER) return arg_usage_t::input;
 
+        if (arg == DNNL_ARG_SEQ_LENGTHS && with_seq_lengths())
+            return arg_usage_t::input;
+
         if (arg == DNNL_ARG_SRC_ITER && with_src_iter())
             return arg_usage_t::input;
 
         if (arg == DNNL_ARG_SRC_ITER_C && with_src_iter_c())
             return arg_usage_t::input;
 
+        if (arg == DNNL_ARG_AUGRU_ATTENTION && is_augru())
+            return arg_usage_t::input;
+
         if (utils::one_of(arg, DNNL_ARG_WEIGHTS_LAYER, DNNL_ARG_WEIGHTS_ITER))
             return arg_usage_t::input;
 
@@ -237,7 +274,9 @@ struct rnn_fwd_pd_t : public rnn_pd_t {
         switch (arg) {
             case DNNL_ARG_SRC_LAYER: return src_md(0);
             case DNNL_ARG_SRC_ITER: return src_md(1);
-            case DNNL_ARG_SRC_ITER_C: return src_md(2);
+            // DNNL_ARG_AUGRU_ATTENTION is an alias of DNNL_ARG_SRC_ITER_C
+            case DNNL_ARG_SRC_ITER_C:
+                return is_augru() ? augru_attention_md() : src_md(2);
             case DNNL_ARG_WEIGHTS_LAYER: return weights_md(0);
             case DNNL_ARG_WEIGHTS_ITER: return weights_md(1);
             case DNNL_ARG_WEIGHTS_PEEPHOLE:
@@ -251,17 +290,31 @@ struct rnn_fwd_pd_t : public rnn_pd_t {
             case DNNL_ARG_DST_LAYER: return dst_md(0);
             case DNNL_ARG_DST_ITER: return dst_md(1);
             case DNNL_ARG_DST_ITER_C: return dst_md(2);
+            case DNNL_ARG_SEQ_LENGTHS: return seq_lengths_md();
             default: return rnn_pd_t::arg_md(arg);
         }
     }
 
+    const memory_desc_t *seq_lengths_md() const {
+        return with_seq_lengths() ? &seq_lengths_md_ : &glob_zero_md;
+    }
+
+    const memory_desc_t *augru_attention_md() const {
+        return is_augru() ? &augru_attention_md_ : &glob_zero_md;
+    }
+
     int n_inputs() const override {
         return 3 + is_lstm_peephole() + is_lstm_projection() + with_bias()
-                + with_src_iter() + with_src_iter_c();
+                + with_src_iter() + with_src_iter_c() + with_seq_lengths()
+                + is_augru();
     }
     int n_outputs() const override {
         return 1 + with_dst_iter() + with_dst_iter_c() + is_training();
     }
+
+protected:
+    memory_desc_t seq_lengths_md_;
+    memory_desc_t augru_attention_md_;
 };
 
 struct rnn_bwd_pd_t : public rnn_pd_t {
@@ -20,6 +20,9 @@
 #include "utils.hpp"
 
 #include "cpu/cpu_engine.hpp"
+#if DNNL_GPU_RUNTIME != DNNL_RUNTIME_NONE
+#include "gpu/compute/compute_engine.hpp"
+#endif
 
 #include "scratchpad.hpp"
 
@@ -94,6 +97,40 @@ private:
     DNNL_DISALLOW_COPY_AND_ASSIGN(concurrent_scratchpad_t);
 };
 
+#if DNNL_GPU_RUNTIME != DNNL_RUNTIME_NONE
+/*
+  Implementation of the scratchpad_t interface that takes the memory from the
+  pool of the GPU engine and returns it back on destruction
+*/
+struct pooled_scratchpad_t : public scratchpad_t {
+    pooled_scratchpad_t(
+            const std::shared_ptr<gpu::compute::memory_pool_t> &pool,
+            size_t size)
+        : pool_(pool) {
+        mem_storage_ = pool_->acquire(size, capacity_);
+        size_ = mem_storage_ ? size : 0;
+    }
+
+    ~pooled_scratchpad_t() override {
+        if (mem_storage_) pool_->release(mem_storage_, capacity_);
+    }
+
+    const memory_storage_t *get_memory_storage() const override {
+        return mem_storage_;
+    }
+
+    size_t size() const override { return size_; }
+
+private:
+    std::shared_ptr<gpu::compute::memory_pool_t> pool_;
+    memory_storage_t *mem_storage_ = nullptr;
+    size_t size_ = 0;
+    size_t capacity_ = 0;
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(pooled_scratchpad_t);
+};
+#endif
+
 /*
   Implementation of the scratchpad_t interface that uses a global
   scratchpad
@@ -102,27 +139,35 @@ private:
 struct global_scratchpad_t : public scratchpad_t {
     global_scratchpad_t(engine_t *engine, size_t size) {
         // TODO: check if engine is the same
-        if (size > size_) {
-            delete mem_storage_;
-            // Try to expand the global scratchpad to the necessary size
-            mem_storage_ = create_scratchpad_memory_storage(engine, size);
-            if (mem_storage_ == nullptr) {
+        size_class_ = get_size_class(size);
+        // The requested size is rounded up to its size class so that
+        // primitives with slightly different requirements do not cause a
+        // reallocation of the buffer each time a bigger one is created.
+        const size_t class_size = get_class_size(size_class_);
+        if (class_size > size_) {
+            if (!realloc(engine, class_size)) {
                 // Recreate scratchpad with original capacity
-                mem_storage_ = create_scratchpad_memory_storage(engine, size_);
-                if (mem_storage_ == nullptr) size_ = 0;
-            } else
-                size_ = size;
+                if (!realloc(engine, size_)) size_ = 0;
+            }
         }
+        class_count_[size_class_]++;
         reference_count_++;
     }
 
     ~global_scratchpad_t() override {
+        // Guard against the destruction on a thread other than the one the
+        // scratchpad was created on
+        if (reference_count_ == 0) return;
+
         reference_count_--;
+        if (class_count_[size_class_] > 0) class_count_[size_class_]--;
         if (reference_count_ == 0) {
             delete mem_storage_;
             mem_storage_ = nullptr;
             size_ = 0;
+            return;
         }
+        trim();
     }
 
     const memory_storage_t *get_memory_storage() const override {
@@ -132,9 +177,53 @@ struct global_scratchpad_t : public scratchpad_t {
     size_t size() const override { return size_; }
 
 private:
+    // Size classes: 4 classes per power of two starting from 64 KB, which
+    // limits the memory overhead of rounding up to 25%.
+    static constexpr int n_size_classes = 4 * 40;
+    static constexpr size_t min_class_size = 64 * 1024;
+
+    static size_t get_class_size(int size_class) {
+        const size_t pow2 = min_class_size << (size_class / 4);
+        return pow2 + (pow2 / 4) * (size_class % 4);
+    }
+
+    static int get_size_class(size_t size) {
+        int size_class = 0;
+        while (size_class < n_size_classes - 1
+                && get_class_size(size_class) < size)
+            size_class++;
+        return size_class;
+    }
+
+    static bool realloc(engine_t *engine, size_t size) {
+        // Free the previous buffer first to not increase peak memory usage
+        delete mem_storage_;
+        mem_storage_ = create_scratchpad_memory_storage(engine, size);
+        if (mem_storage_ == nullptr) return false;
+        size_ = size;
+        return true;
+    }
+
+    // Gives memory back when the biggest users of the scratchpad are gone:
+    // the buffer is shrunk to the largest size class still in use as soon as
+    // it becomes at least two times smaller than the current size.
+    static void trim() {
+        int max_class = n_size_classes - 1;
+        while (max_class > 0 && class_count_[max_class] == 0)
+            max_class--;
+        const size_t class_size = get_class_size(max_class);
+        if (2 * class_size > size_ || mem_storage_ == nullptr) return;
+
+        engine_t *engine = mem_storage_->engine();
+        if (!realloc(engine, class_size)) size_ = 0;
+    }
+
+    int size_class_;
+
     thread_local static memory_storage_t *mem_storage_;
     thread_local static size_t size_;
     thread_local static unsigned int reference_count_;
+    thread_local static unsigned int class_count_[n_size_classes];
 };
 
 // CAVEAT: avoid having non-trivially-constructed thread-local objects. Their
@@ -145,12 +234,24 @@ private:
 thread_local memory_storage_t *global_scratchpad_t::mem_storage_ = nullptr;
 thread_local size_t global_scratchpad_t::size_ = 0;
 thread_local unsigned int global_scratchpad_t::reference_count_ = 0;
+thread_local unsigned int
+        global_scratchpad_t::class_count_[global_scratchpad_t::n_size_classes]
+        = {0};
+constexpr int global_scratchpad_t::n_size_classes;
+constexpr size_t global_scratchpad_t::min_class_size;
 
 /*
    Scratchpad creation routine
 */
 scratchpad_t *create_scratchpad(
         engine_t *engine, size_t size, bool use_global_scratchpad) {
+#if DNNL_GPU_RUNTIME != DNNL_RUNTIME_NONE
+    if (engine->kind() == engine_kind::gpu) {
+        auto pool = utils::downcast<gpu::compute::compute_engine_t *>(engine)
+                            ->memory_pool();
+        if (pool) return new pooled_scratchpad_t(pool, size);
+    }
+#endif
 #ifndef DNNL_ENABLE_CONCURRENT_EXEC
     /*
      * TODO: global scratchpad should be able to handle memory
@@ -19,6 +19,7 @@
 
 #include "c_types_map.hpp"
 #include "engine.hpp"
+#include "memory.hpp"
 #include "primitive.hpp"
 #include "primitive_exec_types.hpp"
 #include "stream.hpp"
@@ -40,6 +41,12 @@ status_t dnnl_stream_create(
     bool args_ok = !utils::any_null(stream, engine);
     if (!args_ok) return invalid_arguments;
 
+    // Only the OpenCL events provide the device time of the kernels
+    if ((flags & stream_flags::profiling)
+            && !(engine->kind() == engine_kind::gpu
+                    && engine->runtime_kind() == runtime_kind::ocl))
+        return unimplemented;
+
     return engine->create_stream(stream, flags);
 }
 
@@ -56,6 +63,67 @@ status_t dnnl_stream_wait(stream_t *stream) {
     return stream->wait();
 }
 
+status_t dnnl_stream_set_scratchpad(stream_t *stream, memory_t *memory) {
+    if (any_null(stream)) return invalid_arguments;
+    if (memory != nullptr) {
+        bool args_ok = memory->engine() == stream->engine()
+                && memory->md()->format_kind != format_kind::any;
+        if (!args_ok) return invalid_arguments;
+    }
+
+    stream->set_scratchpad(memory);
+    return success;
+}
+
+status_t dnnl_stream_reset_profiling(stream_t *stream) {
+    if (any_null(stream)) return invalid_arguments;
+    if (!stream->is_profiling_enabled()) return invalid_arguments;
+    return stream->reset_profiling();
+}
+
+status_t dnnl_stream_get_profiling_data(stream_t *stream,
+        profiling_data_kind_t data_kind, int *num_entries, uint64_t *data) {
+    if (any_null(stream, num_entries)) return invalid_arguments;
+    bool args_ok = stream->is_profiling_enabled()
+            && utils::one_of(data_kind, profiling_data_kind::time,
+                    profiling_data_kind::overhead_time)
+            && IMPLICATION(data != nullptr, *num_entries >= 0);
+    if (!args_ok) return invalid_arguments;
+    return stream->get_profiling_data(data_kind, num_entries, data);
+}
+
+status_t dnnl_stream_begin_capture(stream_t *stream) {
+    if (any_null(stream)) return invalid_arguments;
+    return stream->begin_capture();
+}
+
+status_t dnnl_stream_end_capture(stream_t *stream) {
+    if (any_null(stream)) return invalid_arguments;
+    return stream->end_capture();
+}
+
+status_t dnnl_stream_replay(stream_t *stream) {
+    if (any_null(stream)) return invalid_arguments;
+    return stream->replay();
+}
+
+status_t dnnl_stream_set_cpu_affinity(
+        stream_t *stream, int ncpus, const int *cpus) {
+    if (any_null(stream) || ncpus < 0 || (ncpus > 0 && cpus == nullptr))
+        return invalid_arguments;
+    return stream->set_cpu_affinity(ncpus, cpus);
+}
+
+status_t dnnl_stream_fork(stream_t *stream) {
+    if (any_null(stream)) return invalid_arguments;
+    return stream->fork();
+}
+
+status_t dnnl_stream_join(stream_t *stream) {
+    if (any_null(stream)) return invalid_arguments;
+    return stream->join();
+}
+
 status_t dnnl_stream_destroy(stream_t *stream) {
     delete stream;
     return success;
@@ -50,9 +50,52 @@ struct dnnl_stream : public dnnl::impl::c_compatible {
     virtual void before_exec_hook() {}
     virtual void after_exec_hook() {}
 
+    /** profiling of the executed primitives, see dnnl_stream_profiling */
+    bool is_profiling_enabled() const {
+        return flags_ & dnnl::impl::stream_flags::profiling;
+    }
+    virtual dnnl::impl::status_t reset_profiling() {
+        return dnnl::impl::status::unimplemented;
+    }
+    virtual dnnl::impl::status_t get_profiling_data(
+            dnnl::impl::profiling_data_kind_t data_kind, int *num_entries,
+            uint64_t *data) {
+        return dnnl::impl::status::unimplemented;
+    }
+
+    /** restricts the threads of the executions to the given cpus */
+    virtual dnnl::impl::status_t set_cpu_affinity(int ncpus, const int *cpus) {
+        return dnnl::impl::status::unimplemented;
+    }
+
+    /** recording and replay of the device commands of the executions */
+    virtual dnnl::impl::status_t begin_capture() {
+        return dnnl::impl::status::unimplemented;
+    }
+    virtual dnnl::impl::status_t end_capture() {
+        return dnnl::impl::status::unimplemented;
+    }
+    virtual dnnl::impl::status_t replay() {
+        return dnnl::impl::status::unimplemented;
+    }
+
+    /** deferred execution of independent primitives, see dnnl_stream_fork */
+    virtual dnnl::impl::status_t fork() {
+        return dnnl::impl::status::unimplemented;
+    }
+    virtual dnnl::impl::status_t join() {
+        return dnnl::impl::status::unimplemented;
+    }
+
     virtual dnnl::impl::status_t zero_pad(const dnnl::impl::memory_t *memory,
             const dnnl::impl::exec_ctx_t &ctx);
 
+    /** returns the scratchpad shared by primitives executed on the stream */
+    dnnl::impl::memory_t *scratchpad() const { return scratchpad_; }
+    void set_scratchpad(dnnl::impl::memory_t *scratchpad) {
+        scratchpad_ = scratchpad;
+    }
+
 #if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
     dnnl_stream(dnnl::impl::engine_t *engine,
             dnnl::threadpool_interop::threadpool_iface *threadpool)
@@ -74,6 +117,7 @@ struct dnnl_stream : public dnnl::impl::c_compatible {
 protected:
     dnnl::impl::engine_t *engine_;
     unsigned flags_;
+    dnnl::impl::memory_t *scratchpad_ = nullptr;
 #if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
     dnnl::threadpool_interop::threadpool_iface *threadpool_ = nullptr;
 #endif
@@ -84,6 +84,10 @@ struct sum_pd_t : public primitive_desc_t {
     int n_inputs() const override { return n_; }
     int n_outputs() const override { return 1; }
 
+    double flops() const override {
+        return 2.0 * n_ * memory_desc_wrapper(dst_md()).nelems();
+    }
+
     const float *scales() const { return &scales_[0]; }
 
     bool need_output_reorder() const { return dst_md()->data_type != dnnl_f32; }
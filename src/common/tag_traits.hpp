@@ -306,6 +306,7 @@ DECL_TRAITS(ABcde4b16a4b, _AB, _4b16a4b, 5);
 DECL_TRAITS(ABcde4b32a4b, _AB, _4b32a4b, 5);
 DECL_TRAITS(ABcde4b64a4b, _AB, _4b64a4b, 5);
 DECL_TRAITS(ABcde16b16a4b, _AB, _16b16a4b, 5);
+DECL_TRAITS(ABcde16b16a2b, _AB, _16b16a2b, 5);
 DECL_TRAITS(ABcde2b8a4b, _AB, _2b8a4b, 5);
 DECL_TRAITS(aBcde16b, _B, _16b, 5);
 DECL_TRAITS(ABcde16b16a, _AB, _16b16a, 5);
@@ -190,6 +190,16 @@ inline bool wino_desc_is_equal(const wino_desc_t &lhs, const wino_desc_t &rhs) {
             && lhs.r == rhs.r;
 }
 
+inline bool sparse_desc_is_equal(
+        const sparse_desc_t &lhs, const sparse_desc_t &rhs) {
+    return lhs.block_dims[0] == rhs.block_dims[0]
+            && lhs.block_dims[1] == rhs.block_dims[1]
+            && lhs.nnz_blocks == rhs.nnz_blocks
+            && lhs.row_ptr_offset == rhs.row_ptr_offset
+            && lhs.col_idx_offset == rhs.col_idx_offset
+            && lhs.size == rhs.size;
+}
+
 inline bool rnn_packed_desc_is_equal(
         const rnn_packed_desc_t &lhs, const rnn_packed_desc_t &rhs) {
     bool ok = true && lhs.format == rhs.format && lhs.ldb == rhs.ldb
@@ -245,6 +255,8 @@ inline data_type_t default_accum_data_type(data_type_t src_dt,
         if ((src_dt == u8 || src_dt == s8) && wei_dt == s8
                 && one_of(dst_dt, f32, s32, s8, u8))
             return s32;
+        // s8 weights are converted to f32 for the computations
+        if (src_dt == f32 && wei_dt == s8 && dst_dt == f32) return f32;
     } else if (prop_kind == backward_data) {
         if (one_of(src_dt, f32, s32, s8, u8) && wei_dt == s8
                 && one_of(dst_dt, s8, u8))
@@ -277,6 +289,9 @@ inline bool operator==(const memory_desc_t &lhs, const memory_desc_t &rhs) {
     else if (lhs.format_kind == format_kind::rnn_packed)
         return types::rnn_packed_desc_is_equal(lhs.format_desc.rnn_packed_desc,
                 rhs.format_desc.rnn_packed_desc);
+    else if (lhs.format_kind == format_kind::sparse)
+        return types::sparse_desc_is_equal(
+                lhs.format_desc.sparse_desc, rhs.format_desc.sparse_desc);
     return true;
 }
 
@@ -348,6 +363,19 @@ inline bool operator==(
     return ret;
 }
 
+inline bool operator==(
+        const embedding_bag_desc_t &lhs, const embedding_bag_desc_t &rhs) {
+    bool ret = COMPARE_DESC_MEMBERS(primitive_kind)
+            && COMPARE_DESC_MEMBERS(prop_kind)
+            && COMPARE_DESC_MEMBERS(alg_kind)
+            && COMPARE_DESC_MEMBERS(indices_desc)
+            && COMPARE_DESC_MEMBERS(offsets_desc)
+            && COMPARE_DESC_MEMBERS(table_desc)
+            && COMPARE_DESC_MEMBERS(scale_shift_desc)
+            && COMPARE_DESC_MEMBERS(dst_desc);
+    return ret;
+}
+
 inline bool operator==(const eltwise_desc_t &lhs, const eltwise_desc_t &rhs) {
     bool ret = COMPARE_DESC_MEMBERS(primitive_kind)
             && COMPARE_DESC_MEMBERS(prop_kind)
@@ -369,6 +397,34 @@ inline bool operator==(const gemm_desc_t &lhs, const gemm_desc_t &rhs) {
     return ret;
 }
 
+inline bool operator==(const group_normalization_desc_t &lhs,
+        const group_normalization_desc_t &rhs) {
+    bool ret = COMPARE_DESC_MEMBERS(primitive_kind)
+            && COMPARE_DESC_MEMBERS(prop_kind)
+            && COMPARE_DESC_MEMBERS(data_desc)
+            && COMPARE_DESC_MEMBERS(data_scaleshift_desc)
+            && COMPARE_DESC_MEMBERS(stat_desc)
+            && COMPARE_DESC_MEMBERS(groups)
+            && COMPARE_DESC_MEMBERS(group_norm_epsilon)
+            && COMPARE_DESC_MEMBERS(flags);
+    return ret;
+}
+
+inline bool operator==(
+        const optimizer_desc_t &lhs, const optimizer_desc_t &rhs) {
+    bool ret = COMPARE_DESC_MEMBERS(primitive_kind)
+            && COMPARE_DESC_MEMBERS(alg_kind)
+            && COMPARE_DESC_MEMBERS(weights_desc)
+            && COMPARE_DESC_MEMBERS(diff_weights_desc)
+            && COMPARE_DESC_MEMBERS(dst_desc)
+            && COMPARE_DESC_MEMBERS(momentum)
+            && COMPARE_DESC_MEMBERS(beta2)
+            && COMPARE_DESC_MEMBERS(epsilon)
+            && COMPARE_DESC_MEMBERS(weight_decay)
+            && COMPARE_DESC_MEMBERS(max_grad_norm);
+    return ret;
+}
+
 inline bool operator==(
         const inner_product_desc_t &lhs, const inner_product_desc_t &rhs) {
     bool ret = COMPARE_DESC_MEMBERS(primitive_kind)
@@ -24,6 +24,7 @@
 #endif
 
 #ifdef __linux__
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <sys/types.h>
 #endif
@@ -108,11 +109,43 @@ int getpagesize() {
 #endif
 }
 
+namespace {
+struct allocator_t {
+    dnnl_malloc_fn_t malloc_fn;
+    dnnl_free_fn_t free_fn;
+};
+
+// Locked by the first allocation, so that every buffer is freed by the
+// allocator it came from
+set_before_first_get_setting_t<allocator_t> allocator {{nullptr, nullptr}};
+
+#ifdef __linux__
+setting_t<size_t> hugepage_threshold {0};
+size_t get_hugepage_threshold() {
+    if (!hugepage_threshold.initialized())
+        hugepage_threshold.set(
+                (size_t)nstl::max(0, getenv_int("DNNL_HUGEPAGE_THRESHOLD", 0)));
+    return hugepage_threshold.get();
+}
+#endif
+} // namespace
+
 void *malloc(size_t size, int alignment) {
     void *ptr;
     if (memory_debug::is_mem_debug())
         return memory_debug::malloc(size, alignment);
 
+    const allocator_t a = allocator.get();
+    if (a.malloc_fn) return a.malloc_fn(size, alignment);
+
+#ifdef __linux__
+    // Huge pages are only used if the buffer is aligned to them
+    const size_t hugepage_size = 2 * 1024 * 1024;
+    const size_t threshold = get_hugepage_threshold();
+    const bool use_hugepages = threshold > 0 && size >= threshold;
+    if (use_hugepages) alignment = nstl::max(alignment, (int)hugepage_size);
+#endif
+
 #ifdef _WIN32
     ptr = _aligned_malloc(size, alignment);
     int rc = ptr ? 0 : -1;
@@ -120,6 +153,12 @@ void *malloc(size_t size, int alignment) {
     int rc = ::posix_memalign(&ptr, alignment, size);
 #endif
 
+#ifdef __linux__
+    // The advice is a hint: a failure leaves the buffer on regular pages
+    if (rc == 0 && use_hugepages)
+        madvise(ptr, utils::rnd_dn(size, hugepage_size), MADV_HUGEPAGE);
+#endif
+
     return (rc == 0) ? ptr : nullptr;
 }
 
@@ -127,6 +166,9 @@ void free(void *p) {
 
     if (memory_debug::is_mem_debug()) return memory_debug::free(p);
 
+    const allocator_t a = allocator.get();
+    if (a.free_fn) return a.free_fn(p);
+
 #ifdef _WIN32
     _aligned_free(p);
 #else
@@ -161,6 +203,14 @@ unsigned get_jit_profiling_flags() {
     return jit_profiling_flags.get();
 }
 
+static setting_t<bool> lazy_primitive_creation {false};
+bool get_lazy_primitive_creation() {
+    if (!lazy_primitive_creation.initialized())
+        lazy_primitive_creation.set(
+                !!getenv_int("DNNL_LAZY_PRIMITIVE_CREATION", 0));
+    return lazy_primitive_creation.get();
+}
+
 static setting_t<std::string> jit_profiling_jitdumpdir;
 dnnl_status_t init_jit_profiling_jitdumpdir(
         const char *jitdumpdir, bool overwrite) {
@@ -227,8 +277,30 @@ dnnl_cpu_isa_t dnnl_get_effective_cpu_isa() {
     return dnnl::impl::cpu::platform::get_effective_cpu_isa();
 }
 
+dnnl_status_t dnnl_set_memory_allocator(
+        dnnl_malloc_fn_t malloc_fn, dnnl_free_fn_t free_fn) {
+    using namespace dnnl::impl;
+    if ((malloc_fn == nullptr) != (free_fn == nullptr))
+        return status::invalid_arguments;
+    return allocator.set({malloc_fn, free_fn}) ? status::success
+                                               : status::invalid_arguments;
+}
+
+dnnl_status_t dnnl_set_hugepage_threshold(size_t threshold) {
+#ifdef __linux__
+    using namespace dnnl::impl;
+    hugepage_threshold.set(threshold);
+    return status::success;
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
 #if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_THREADPOOL
 #include "oneapi/dnnl/dnnl_threadpool_iface.hpp"
+
+#include "dnnl_thread.hpp"
+
 namespace dnnl {
 namespace impl {
 namespace threadpool_utils {
@@ -253,6 +325,18 @@ dnnl::threadpool_interop::threadpool_iface *get_active_threadpool() {
     return active_threadpool;
 }
 
+namespace {
+static thread_local thr_barrier_t *active_barrier = nullptr;
+}
+
+void set_active_barrier(thr_barrier_t *barrier) {
+    active_barrier = barrier;
+}
+
+thr_barrier_t *get_active_barrier() {
+    return active_barrier;
+}
+
 } // namespace threadpool_utils
 } // namespace impl
 } // namespace dnnl
@@ -549,6 +549,7 @@ int getenv_int(const char *name, int default_value = 0);
 bool get_jit_dump();
 unsigned get_jit_profiling_flags();
 std::string get_jit_profiling_jitdumpdir();
+bool get_lazy_primitive_creation();
 FILE *fopen(const char *filename, const char *mode);
 int getpagesize();
 
@@ -14,7 +14,12 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <cmath>
+#include <map>
+#include <stdarg.h>
 #include <stdlib.h>
+#include <string.h>
+#include <vector>
 #ifndef _WIN32
 #include <sys/time.h>
 #else
@@ -26,6 +31,8 @@
 #include "oneapi/dnnl/dnnl_version.h"
 
 #include "c_types_map.hpp"
+#include "dnnl_thread.hpp"
+#include "primitive_desc.hpp"
 #include "verbose.hpp"
 
 #include "batch_normalization_pd.hpp"
@@ -34,11 +41,14 @@
 #include "convolution_pd.hpp"
 #include "deconvolution_pd.hpp"
 #include "eltwise_pd.hpp"
+#include "embedding_bag_pd.hpp"
 #include "gemm_pd.hpp"
+#include "group_normalization_pd.hpp"
 #include "inner_product_pd.hpp"
 #include "layer_normalization_pd.hpp"
 #include "lrn_pd.hpp"
 #include "matmul_pd.hpp"
+#include "optimizer_pd.hpp"
 #include "pooling_pd.hpp"
 #include "prelu_pd.hpp"
 #include "reduction_pd.hpp"
@@ -75,14 +85,30 @@ int get_verbose() {
     }
     static bool version_printed = false;
     if (!version_printed && verbose.get() > 0) {
-        printf("dnnl_verbose,info,oneDNN v%d.%d.%d (commit %s)\n",
-                dnnl_version()->major, dnnl_version()->minor,
-                dnnl_version()->patch, dnnl_version()->hash);
-        printf("dnnl_verbose,info,cpu,runtime:%s\n",
-                dnnl_runtime2str(dnnl_version()->cpu_runtime));
-        printf("dnnl_verbose,info,cpu,isa:%s\n", cpu::platform::get_isa_info());
-        printf("dnnl_verbose,info,gpu,runtime:%s\n",
-                dnnl_runtime2str(dnnl_version()->gpu_runtime));
+        const auto *ver = dnnl_version();
+        if (get_verbose_json()) {
+            std::string s = "{\"event\":\"info\"";
+            char version[32];
+            snprintf(version, sizeof(version), "%d.%d.%d", ver->major,
+                    ver->minor, ver->patch);
+            verbose_json_append(s, "version", version);
+            verbose_json_append(s, "commit", ver->hash);
+            verbose_json_append(
+                    s, "cpu_runtime", dnnl_runtime2str(ver->cpu_runtime));
+            verbose_json_append(s, "isa", cpu::platform::get_isa_info());
+            verbose_json_append(
+                    s, "gpu_runtime", dnnl_runtime2str(ver->gpu_runtime));
+            verbose_printf("%s}\n", s.c_str());
+        } else {
+            verbose_printf("dnnl_verbose,info,oneDNN v%d.%d.%d (commit %s)\n",
+                    ver->major, ver->minor, ver->patch, ver->hash);
+            verbose_printf("dnnl_verbose,info,cpu,runtime:%s\n",
+                    dnnl_runtime2str(ver->cpu_runtime));
+            verbose_printf("dnnl_verbose,info,cpu,isa:%s\n",
+                    cpu::platform::get_isa_info());
+            verbose_printf("dnnl_verbose,info,gpu,runtime:%s\n",
+                    dnnl_runtime2str(ver->gpu_runtime));
+        }
 #if DNNL_GPU_RUNTIME == DNNL_RUNTIME_OCL
         gpu::ocl::print_verbose_header();
 #endif
@@ -95,6 +121,299 @@ int get_verbose() {
     return verbose.get();
 }
 
+static setting_t<bool> verbose_json {false};
+bool get_verbose_json() {
+#if !defined(DISABLE_VERBOSE)
+    if (!verbose_json.initialized()) {
+        const int len = 5;
+        char val[len] = {0};
+        verbose_json.set(getenv("DNNL_VERBOSE_FORMAT", val, len) == 4
+                && strcmp(val, "json") == 0);
+    }
+    return verbose_json.get();
+#else
+    return false;
+#endif
+}
+
+namespace {
+struct verbose_output_t {
+    std::mutex mutex;
+    FILE *file = stdout;
+    dnnl_verbose_callback_t callback = nullptr;
+    void *user_data = nullptr;
+};
+
+// The output is never destroyed, so that the lines printed by the
+// destructors of static objects, e.g. the JIT kernels summary, still go to
+// the right place.
+verbose_output_t &get_verbose_output() {
+    static verbose_output_t *output = []() {
+        auto *o = new verbose_output_t;
+        const int len = 1024;
+        char path[len] = {0};
+        if (getenv("DNNL_VERBOSE_OUTPUT", path, len) > 0) {
+            FILE *f = fopen(path, "w");
+            if (f) o->file = f;
+        }
+        return o;
+    }();
+    return *output;
+}
+} // namespace
+
+void verbose_printf(const char *fmt, ...) {
+    va_list args;
+    va_start(args, fmt);
+    va_list args_copy;
+    va_copy(args_copy, args);
+    const int len = vsnprintf(nullptr, 0, fmt, args_copy);
+    va_end(args_copy);
+    if (len < 0) {
+        va_end(args);
+        return;
+    }
+    std::vector<char> line(len + 1);
+    vsnprintf(line.data(), line.size(), fmt, args);
+    va_end(args);
+
+    auto &out = get_verbose_output();
+    std::lock_guard<std::mutex> guard(out.mutex);
+    if (out.callback) {
+        if (len > 0 && line[len - 1] == '\n') line[len - 1] = '\0';
+        out.callback(line.data(), out.user_data);
+    } else {
+        fputs(line.data(), out.file);
+        fflush(out.file);
+    }
+}
+
+void verbose_json_append(std::string &s, const char *key, const char *value) {
+    s += ",\"";
+    s += key;
+    s += "\":\"";
+    for (const char *c = value; c && *c; ++c) {
+        if (*c == '"' || *c == '\\') s += '\\';
+        s += *c;
+    }
+    s += '"';
+}
+
+// The fields of the primitive info are comma separated, in the order of the
+// CSV lines.
+static void verbose_json_append_info(std::string &s, const std::string &info) {
+    static const char *keys[] = {"engine", "primitive", "impl", "prop", "mds",
+            "attr", "aux", "problem"};
+    const int n_keys = sizeof(keys) / sizeof(keys[0]);
+    size_t pos = 0;
+    for (int k = 0; k < n_keys && pos <= info.size(); ++k) {
+        size_t end = k == n_keys - 1 ? std::string::npos : info.find(',', pos);
+        if (end == std::string::npos) end = info.size();
+        verbose_json_append(s, keys[k], info.substr(pos, end - pos).c_str());
+        pos = end + 1;
+    }
+}
+
+void verbose_print_prim(const char *event, const char *detail,
+        const primitive_desc_iface_t *pd_iface, double ms) {
+    const char *info = pd_iface->info();
+    if (!get_verbose_json()) {
+        if (detail)
+            verbose_printf(
+                    "dnnl_verbose,%s:%s,%s,%g\n", event, detail, info, ms);
+        else
+            verbose_printf("dnnl_verbose,%s,%s,%g\n", event, info, ms);
+        return;
+    }
+
+    std::string s = "{\"event\":\"";
+    s += event;
+    s += '"';
+    if (detail) verbose_json_append(s, "detail", detail);
+    verbose_json_append_info(s, info);
+
+    char nums[128];
+    int nthr = 0;
+    if (strcmp(event, "exec") == 0
+            && pd_iface->engine()->kind() == engine_kind::cpu)
+        nthr = dnnl_get_current_num_threads();
+    const size_t scratchpad_size
+            = pd_iface->impl()->scratchpad_registry().size();
+    if (nthr > 0)
+        snprintf(nums, sizeof(nums),
+                ",\"scratchpad\":%zu,\"threads\":%d,\"time_ms\":%g}\n",
+                scratchpad_size, nthr, ms);
+    else
+        snprintf(nums, sizeof(nums), ",\"scratchpad\":%zu,\"time_ms\":%g}\n",
+                scratchpad_size, ms);
+    verbose_printf("%s%s", s.c_str(), nums);
+}
+
+namespace {
+thread_local const char *dispatch_reason_ = nullptr;
+} // namespace
+
+void set_dispatch_reason(const char *reason) {
+    dispatch_reason_ = reason;
+}
+
+const char *take_dispatch_reason() {
+    const char *reason = dispatch_reason_;
+    dispatch_reason_ = nullptr;
+    return reason;
+}
+
+void verbose_print_dispatch(
+        primitive_kind_t kind, const char *impl_name, const char *reason) {
+    const char *status = reason ? "rejected" : "accepted";
+    if (!get_verbose_json()) {
+        if (reason)
+            verbose_printf("dnnl_verbose,dispatch,%s,%s,%s,%s\n",
+                    dnnl_prim_kind2str(kind), impl_name, status, reason);
+        else
+            verbose_printf("dnnl_verbose,dispatch,%s,%s,%s\n",
+                    dnnl_prim_kind2str(kind), impl_name, status);
+        return;
+    }
+
+    std::string s = "{\"event\":\"dispatch\"";
+    verbose_json_append(s, "primitive", dnnl_prim_kind2str(kind));
+    verbose_json_append(s, "impl", impl_name);
+    verbose_json_append(s, "status", status);
+    if (reason) verbose_json_append(s, "reason", reason);
+    verbose_printf("%s}\n", s.c_str());
+}
+
+static setting_t<int> verbose_sample {0};
+int get_verbose_sample_period() {
+#if !defined(DISABLE_VERBOSE)
+    if (!verbose_sample.initialized())
+        verbose_sample.set(nstl::max(0, getenv_int("DNNL_VERBOSE_SAMPLE", 0)));
+    return verbose_sample.get();
+#else
+    return 0;
+#endif
+}
+
+namespace {
+// Execution times of a primitive. Bucket `i` of the histogram counts the
+// samples below 2^i microseconds that do not fit the previous buckets, the
+// last one counts all the longer samples.
+struct sample_stats_t {
+    static constexpr int n_buckets = 24;
+
+    size_t count = 0;
+    double sum_ms = 0, min_ms = 0, max_ms = 0;
+    size_t hist[n_buckets] = {0};
+
+    void add(double ms) {
+        min_ms = count ? nstl::min(min_ms, ms) : ms;
+        max_ms = count ? nstl::max(max_ms, ms) : ms;
+        sum_ms += ms;
+        count++;
+        int b = 0;
+        for (double us = 1; b < n_buckets - 1 && ms * 1e3 >= us; us *= 2)
+            b++;
+        hist[b]++;
+    }
+};
+
+struct sample_registry_t {
+    std::mutex mutex;
+    std::map<std::string, sample_stats_t> stats;
+
+    // Prints the statistics of every primitive and resets them
+    void dump() {
+        std::lock_guard<std::mutex> guard(mutex);
+        for (const auto &e : stats) {
+            const auto &st = e.second;
+            std::string hist;
+            char buf[64];
+            for (int b = 0; b < sample_stats_t::n_buckets; ++b) {
+                if (!st.hist[b]) continue;
+                snprintf(buf, sizeof(buf), "%s%.0f:%zu",
+                        hist.empty() ? "" : " ", std::pow(2., b), st.hist[b]);
+                hist += buf;
+            }
+            if (get_verbose_json()) {
+                std::string s = "{\"event\":\"sample\"";
+                verbose_json_append_info(s, e.first);
+                verbose_json_append(s, "hist_us", hist.c_str());
+                verbose_printf(
+                        "%s,\"count\":%zu,\"avg_ms\":%g,\"min_ms\":%g,"
+                        "\"max_ms\":%g}\n",
+                        s.c_str(), st.count, st.sum_ms / st.count, st.min_ms,
+                        st.max_ms);
+            } else {
+                verbose_printf(
+                        "dnnl_verbose,sample,%s,count:%zu,avg:%g,min:%g,"
+                        "max:%g,hist_us:%s\n",
+                        e.first.c_str(), st.count, st.sum_ms / st.count,
+                        st.min_ms, st.max_ms, hist.c_str());
+            }
+        }
+        stats.clear();
+    }
+};
+
+// Never destroyed, so that the threads exiting after the static objects
+// were destroyed can still flush their samples
+sample_registry_t &get_sample_registry() {
+    static sample_registry_t *registry = new sample_registry_t;
+    return *registry;
+}
+
+// The samples of a thread. Only the owning thread writes to the buffer, and
+// it moves the samples to the registry when the buffer is full, when the
+// statistics are dumped on demand, and when the thread exits.
+struct sample_buffer_t {
+    static constexpr int capacity = 64;
+
+    struct sample_t {
+        std::string info;
+        double ms;
+    };
+    sample_t samples[capacity];
+    int size = 0;
+    unsigned counter = 0;
+
+    ~sample_buffer_t() { flush(); }
+
+    void add(const char *info, double ms) {
+        samples[size].info = info;
+        samples[size].ms = ms;
+        if (++size == capacity) flush();
+    }
+
+    void flush() {
+        if (size == 0) return;
+        auto &registry = get_sample_registry();
+        std::lock_guard<std::mutex> guard(registry.mutex);
+        for (int i = 0; i < size; ++i)
+            registry.stats[samples[i].info].add(samples[i].ms);
+        size = 0;
+    }
+};
+
+thread_local sample_buffer_t sample_buffer;
+
+// Dumps the statistics at exit, after the buffer of the main thread is
+// flushed
+struct sample_dumper_t {
+    ~sample_dumper_t() { get_sample_registry().dump(); }
+};
+} // namespace
+
+bool verbose_sample_next() {
+    const int period = get_verbose_sample_period();
+    return period > 0 && ++sample_buffer.counter % period == 0;
+}
+
+void verbose_record_sample(const primitive_desc_iface_t *pd_iface, double ms) {
+    static sample_dumper_t dumper;
+    sample_buffer.add(pd_iface->info(), ms);
+}
+
 double get_msec() {
 #ifdef _WIN32
     static LARGE_INTEGER frequency;
@@ -194,12 +513,18 @@ void format_prb_desc_str(
 }
 
 void attr2str(char *str, int len, int written, const primitive_attr_t *attr) {
-    // scratchpad mode is not a part of has_default_values(). Check it first.
+    // scratchpad and fpmath modes are not a part of has_default_values().
+    // Check them first.
     const scratchpad_mode_t &spm = attr->scratchpad_mode_;
     if (spm != scratchpad_mode_t::dnnl_scratchpad_mode_library) {
         DPRINT(str, len, written, "scratchpad_mode:%s;",
                 dnnl_scratchpad_mode2str(spm));
     }
+    const fpmath_mode_t &fpm = attr->fpmath_mode_;
+    if (fpm != fpmath_mode::strict) {
+        DPRINT(str, len, written, "fpmath_mode:%s;",
+                dnnl_fpmath_mode2str(fpm));
+    }
 
     if (attr->has_default_values()) return;
 
@@ -301,6 +626,10 @@ void attr2str(char *str, int len, int written, const primitive_attr_t *attr) {
                             dnnl_alg_kind2str(eb.alg),
                             dnnl_dt2str(eb.src1_desc.data_type), mask);
                 } break;
+                case primitive_kind::pooling: {
+                    DPRINT(str, len, written, "%s_k2s2;",
+                            dnnl_alg_kind2str(e.pooling.alg));
+                } break;
                 default: assert(!"unsupported post op primitive kind!"); break;
             }
         }
@@ -312,6 +641,18 @@ void attr2str(char *str, int len, int written, const primitive_attr_t *attr) {
         DPRINT(str, len, written, "rnn_data_qparams:%g:%g;", rnn_qp.scale_,
                 rnn_qp.shift_);
     }
+
+    const src_concat_t &sc = attr->src_concat_;
+    if (!sc.has_default_values()) {
+        DPRINT(str, len, written, "src_concat:" DFMT, sc.channels_[0]);
+        for (int i = 1; i < sc.nsrcs(); ++i)
+            DPRINT(str, len, written, "x" DFMT, sc.channels_[i]);
+        DPRINT(str, len, written, ";");
+    }
+
+    const dropout_t &dr = attr->dropout_;
+    if (!dr.has_default_values())
+        DPRINT(str, len, written, "dropout%s;", dr.with_mask_ ? ":mask" : "");
 }
 
 void flags2str(char *str, int len, int written, unsigned flags) {
@@ -319,6 +660,7 @@ void flags2str(char *str, int len, int written, unsigned flags) {
     if (flags & dnnl_use_global_stats) s += "G";
     if (flags & dnnl_use_scaleshift) s += "S";
     if (flags & dnnl_fuse_norm_relu) s += "R";
+    if (flags & dnnl_fuse_residual_add) s += "A";
     DPRINT(str, len, written, "flags:%s", s.c_str());
 }
 
@@ -665,6 +1007,34 @@ static void init_info_layer_normalization(engine_t *e, pd_t *s, char *buffer) {
             dat_str, attr_str, aux_str, prb_str);
 }
 
+template <typename pd_t>
+static void init_info_group_normalization(
+        const engine_t *e, pd_t *s, char *buffer) {
+    DECL_DAT_AUX_PRB_STRS();
+
+    { // data
+        auto md = s->src_md();
+        DPRINT(dat_str, DNNL_VERBOSE_DAT_LEN, dat_written, "data_");
+        MD2STR(dat_str, DNNL_VERBOSE_DAT_LEN, dat_written, md);
+    }
+    if (!s->stats_are_tmp()) { // stats
+        auto md = s->stats_are_src() ? s->src_md(1) : s->dst_md(1);
+        DPRINT(dat_str, DNNL_VERBOSE_DAT_LEN, dat_written, " stats_");
+        MD2STR(dat_str, DNNL_VERBOSE_DAT_LEN, dat_written, md);
+    }
+
+    attr2str(attr_str, DNNL_VERBOSE_ATTR_LEN, attr_written, s->attr());
+
+    flags2str(aux_str, DNNL_VERBOSE_AUX_LEN, aux_written, s->desc()->flags);
+
+    format_prb_desc_str(
+            prb_str, DNNL_VERBOSE_PRB_LEN, prb_written, s->src_md());
+    DPRINT(prb_str, DNNL_VERBOSE_PRB_LEN, prb_written, "g" DFMT, s->G());
+
+    verbose_templ(buffer, e, s->kind(), s->name(), s->desc()->prop_kind,
+            dat_str, attr_str, aux_str, prb_str);
+}
+
 template <typename pd_t>
 static void init_info_lrn(const engine_t *e, pd_t *s, char *buffer) {
     DECL_DAT_AUX_PRB_STRS();
@@ -950,6 +1320,12 @@ static void init_info_rnn(engine_t *e, pd_t *s, char *buffer) {
             dnnl_alg_kind2str(s->cell_kind()),
             dnnl_rnn_direction2str(s->direction()),
             dnnl_alg_kind2str(s->activation_kind()));
+    if (s->with_seq_lengths())
+        DPRINT(aux_str, DNNL_VERBOSE_AUX_LEN, aux_written,
+                " flags:seq_lengths");
+    if (s->with_recompute_gates())
+        DPRINT(aux_str, DNNL_VERBOSE_AUX_LEN, aux_written,
+                " flags:recompute_gates");
 
     DPRINT(prb_str, DNNL_VERBOSE_PRB_LEN, prb_written,
             "l" DFMT "t" DFMT "mb" DFMT "sic" DFMT "slc" DFMT "dhc" DFMT
@@ -1074,6 +1450,50 @@ static void init_info_resampling(const engine_t *e, pd_t *s, char *buffer) {
             dat_str, attr_str, aux_str, prb_str);
 }
 
+template <typename pd_t>
+static void init_info_embedding_bag(
+        const engine_t *e, pd_t *s, char *buffer) {
+    DECL_DAT_AUX_PRB_STRS();
+
+    { // indices
+        auto md = s->src_md(0);
+        DPRINT(dat_str, DNNL_VERBOSE_DAT_LEN, dat_written, "indices_");
+        MD2STR(dat_str, DNNL_VERBOSE_DAT_LEN, dat_written, md);
+    }
+    { // offsets
+        auto md = s->src_md(1);
+        DPRINT(dat_str, DNNL_VERBOSE_DAT_LEN, dat_written, " offsets_");
+        MD2STR(dat_str, DNNL_VERBOSE_DAT_LEN, dat_written, md);
+    }
+    { // table
+        auto md = s->weights_md(0);
+        DPRINT(dat_str, DNNL_VERBOSE_DAT_LEN, dat_written, " table_");
+        MD2STR(dat_str, DNNL_VERBOSE_DAT_LEN, dat_written, md);
+    }
+    if (s->with_scale_shift()) {
+        auto md = s->weights_md(1);
+        DPRINT(dat_str, DNNL_VERBOSE_DAT_LEN, dat_written, " scale_shift_");
+        MD2STR(dat_str, DNNL_VERBOSE_DAT_LEN, dat_written, md);
+    }
+    { // dst
+        auto md = s->dst_md();
+        DPRINT(dat_str, DNNL_VERBOSE_DAT_LEN, dat_written, " dst_");
+        MD2STR(dat_str, DNNL_VERBOSE_DAT_LEN, dat_written, md);
+    }
+
+    attr2str(attr_str, DNNL_VERBOSE_ATTR_LEN, attr_written, s->attr());
+
+    DPRINT(aux_str, DNNL_VERBOSE_AUX_LEN, aux_written, "alg:%s",
+            dnnl_alg_kind2str(s->desc()->alg_kind));
+
+    DPRINT(prb_str, DNNL_VERBOSE_PRB_LEN, prb_written,
+            "mb" DFMT "idx" DFMT "rows" DFMT "dim" DFMT,
+            s->num_bags(), s->num_indices(), s->num_rows(), s->emb_dim());
+
+    verbose_templ(buffer, e, s->kind(), s->name(), s->desc()->prop_kind,
+            dat_str, attr_str, aux_str, prb_str);
+}
+
 void init_info_zero_pad(
         const engine_t *e, const primitive_desc_t *s, char *buffer) {
     DECL_DAT_AUX_PRB_STRS();
@@ -1109,6 +1529,40 @@ static void init_info_reduction(const engine_t *e, pd_t *s, char *buffer) {
             attr_str, aux_str, prb_str);
 }
 
+template <typename pd_t>
+static void init_info_optimizer(const engine_t *e, pd_t *s, char *buffer) {
+    DECL_DAT_AUX_PRB_STRS();
+
+    { // weights
+        auto md = s->weights_md();
+        DPRINT(dat_str, DNNL_VERBOSE_DAT_LEN, dat_written, "wei_");
+        MD2STR(dat_str, DNNL_VERBOSE_DAT_LEN, dat_written, md);
+    }
+    { // diff weights
+        auto md = s->diff_weights_md();
+        DPRINT(dat_str, DNNL_VERBOSE_DAT_LEN, dat_written, " diff_wei_");
+        MD2STR(dat_str, DNNL_VERBOSE_DAT_LEN, dat_written, md);
+    }
+    if (s->with_dst()) { // dst
+        auto md = s->dst_md();
+        DPRINT(dat_str, DNNL_VERBOSE_DAT_LEN, dat_written, " dst_");
+        MD2STR(dat_str, DNNL_VERBOSE_DAT_LEN, dat_written, md);
+    }
+
+    attr2str(attr_str, DNNL_VERBOSE_ATTR_LEN, attr_written, s->attr());
+
+    const auto *d = s->desc();
+    DPRINT(aux_str, DNNL_VERBOSE_AUX_LEN, aux_written,
+            "alg:%s momentum:%g beta2:%g eps:%g wd:%g max_norm:%g",
+            dnnl_alg_kind2str(d->alg_kind), d->momentum, d->beta2, d->epsilon,
+            d->weight_decay, d->max_grad_norm);
+
+    dnnl_md2dim_str(prb_str, DNNL_VERBOSE_PRB_LEN, s->weights_md());
+
+    verbose_templ(buffer, e, s->kind(), s->name(), prop_kind::undef, dat_str,
+            attr_str, aux_str, prb_str);
+}
+
 #undef DPRINT
 } // namespace
 
@@ -1132,12 +1586,15 @@ void pd_info_t::init(engine_t *engine, const primitive_desc_t *pd) {
             CASE(convolution);
             CASE(deconvolution);
             CASE(eltwise);
+            CASE(embedding_bag);
             CASE(gemm);
+            CASE(group_normalization);
             CASE(inner_product);
             CASE(layer_normalization);
             CASE(lrn);
             CASE(logsoftmax);
             CASE(matmul);
+            CASE(optimizer);
             case primitive_kind::pooling_v2:
             CASE(pooling);
             CASE(prelu);
@@ -1166,11 +1623,26 @@ void pd_info_t::init(engine_t *engine, const primitive_desc_t *pd) {
 
 dnnl_status_t dnnl_set_verbose(int level) {
     using namespace dnnl::impl::status;
-    if (level < 0 || level > 2) return invalid_arguments;
+    if (level < 0 || level > 3) return invalid_arguments;
     dnnl::impl::verbose.set(level);
     return success;
 }
 
+dnnl_status_t dnnl_dump_verbose_samples(void) {
+    dnnl::impl::sample_buffer.flush();
+    dnnl::impl::get_sample_registry().dump();
+    return dnnl::impl::status::success;
+}
+
+dnnl_status_t dnnl_set_verbose_callback(
+        dnnl_verbose_callback_t callback, void *user_data) {
+    auto &out = dnnl::impl::get_verbose_output();
+    std::lock_guard<std::mutex> guard(out.mutex);
+    out.callback = callback;
+    out.user_data = user_data;
+    return dnnl::impl::status::success;
+}
+
 const dnnl_version_t *dnnl_version(void) {
     static const dnnl_version_t ver
             = {DNNL_VERSION_MAJOR, DNNL_VERSION_MINOR, DNNL_VERSION_PATCH,
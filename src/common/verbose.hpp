@@ -20,6 +20,7 @@
 #include <cinttypes>
 #include <mutex>
 #include <stdio.h>
+#include <string>
 
 #include "c_types_map.hpp"
 #include "oneapi/dnnl/dnnl_debug.h"
@@ -36,6 +37,77 @@ struct verbose_t {
 int get_verbose();
 double get_msec();
 
+/// Returns true if the verbose lines are JSON objects instead of comma
+/// separated values (DNNL_VERBOSE_FORMAT=json).
+bool get_verbose_json();
+
+/// Prints a line of verbose output. The line goes to the callback set with
+/// dnnl_set_verbose_callback(), to the file from DNNL_VERBOSE_OUTPUT, or to
+/// stdout. The lines of concurrent threads are not interleaved.
+void verbose_printf(const char *fmt, ...);
+
+/// Prints a primitive creation or execution line. `detail` is an optional
+/// qualifier of the event, e.g. the primitive cache state at creation.
+void verbose_print_prim(const char *event, const char *detail,
+        const primitive_desc_iface_t *pd_iface, double ms);
+
+/// Returns N of the sampled mode, in which 1 in N primitive executions of a
+/// thread is timed (DNNL_VERBOSE_SAMPLE=N), or 0 if the mode is disabled.
+int get_verbose_sample_period();
+
+/// Returns true if the next primitive execution of the calling thread is to
+/// be timed in the sampled mode.
+bool verbose_sample_next();
+
+/// Records the execution time of a sampled execution. The samples are
+/// aggregated into per-primitive histograms, which are printed at exit or
+/// with dnnl_dump_verbose_samples().
+void verbose_record_sample(const primitive_desc_iface_t *pd_iface, double ms);
+
+/// Appends `,"key":"value"` with `value` escaped to a JSON object string.
+void verbose_json_append(std::string &s, const char *key, const char *value);
+
+/// Reasons for an implementation to reject a problem, reported for every
+/// implementation tried at the dispatch verbose level (DNNL_VERBOSE=4).
+namespace dispatch_reason {
+constexpr const char *isa = "unsupported isa";
+constexpr const char *prop_kind = "unsupported propagation kind";
+constexpr const char *alg_kind = "unsupported algorithm";
+constexpr const char *data_type = "unsupported data types";
+constexpr const char *format = "unsupported memory formats";
+constexpr const char *attr = "unsupported attributes";
+constexpr const char *post_ops = "unsupported post-ops";
+constexpr const char *shape = "unsupported shape";
+constexpr const char *zero_dim = "zero-sized memory";
+constexpr const char *sparse = "sparse weights";
+constexpr const char *runtime = "unsupported threading runtime";
+constexpr const char *heuristic = "not efficient for the problem";
+constexpr const char *unknown = "unsupported configuration";
+} // namespace dispatch_reason
+
+/// Records the reason for the implementation being initialized by the
+/// calling thread to reject the problem.
+void set_dispatch_reason(const char *reason);
+
+/// Returns the reason recorded by the calling thread, if any, and clears it.
+const char *take_dispatch_reason();
+
+/// Prints a dispatch line for an implementation that rejected a problem with
+/// `reason`, or that accepted it if `reason` is nullptr.
+void verbose_print_dispatch(
+        primitive_kind_t kind, const char *impl_name, const char *reason);
+
+/// Returns status::unimplemented from an implementation initialization with
+/// the reason reported at the dispatch verbose level if `cond` is false.
+#define VDISPATCH(cond, reason) \
+    do { \
+        if (!(cond)) { \
+            dnnl::impl::set_dispatch_reason( \
+                    dnnl::impl::dispatch_reason::reason); \
+            return dnnl::impl::status::unimplemented; \
+        } \
+    } while (0)
+
 #if !defined(DISABLE_VERBOSE)
 #define DNNL_VERBOSE_BUF_LEN 1024
 #else
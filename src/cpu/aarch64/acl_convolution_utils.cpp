@@ -62,8 +62,13 @@ status_t acl_init_conf(acl_conv_conf_t &acp, memory_desc_t &src_md,
     const bool is_3d = ndims == 5;
     bool is_nspc;
 
+    // The only grouped convolutions Compute Library supports are the
+    // depthwise ones, with a single input and output channel per group
+    acp.is_depthwise = with_groups && wei_d.dims()[1] == 1
+            && wei_d.dims()[2] == 1;
+
     // Compute Library unsupported shape scenarios
-    if (one_of(true, is_3d, is_1d, with_groups)) {
+    if (one_of(true, is_3d, is_1d, with_groups && !acp.is_depthwise)) {
         return status::unimplemented;
     }
 
@@ -135,11 +140,12 @@ status_t acl_init_conf(acl_conv_conf_t &acp, memory_desc_t &src_md,
         is_nspc = utils::one_of(src_tag, nhwc);
 
         memory_desc_t want_wei_md = weights_md;
-        auto wei_tag = is_nspc ? ohwi : oihw;
+        auto wei_tag = acp.is_depthwise ? (is_nspc ? hwigo : goihw)
+                                        : (is_nspc ? ohwi : oihw);
         CHECK(memory_desc_init_by_tag(want_wei_md, wei_tag));
 
         // Compute Library does not support mismatching layouts
-        if ((src_tag != wei_tag) || (src_tag != dst_tag))
+        if (src_tag == format_tag::undef || src_tag != dst_tag)
             return status::unimplemented;
 
         if (weights_md.format_kind == format_kind::any) {
@@ -168,6 +174,13 @@ status_t acl_init_conf(acl_conv_conf_t &acp, memory_desc_t &src_md,
     if (acl_bia_data_t == arm_compute::DataType::UNKNOWN)
         acl_bia_data_t = arm_compute::DataType::F32;
 
+    // The depthwise weights have no input channels dimension
+    const auto wei_shape = acp.is_depthwise
+            ? (is_nspc ? arm_compute::TensorShape(oc, kw, kh)
+                       : arm_compute::TensorShape(kw, kh, oc))
+            : (is_nspc ? arm_compute::TensorShape(ic, kw, kh, oc)
+                       : arm_compute::TensorShape(kw, kh, ic, oc));
+
     // clang-format off
     acp.src_info = arm_compute::TensorInfo(
             is_nspc ? arm_compute::TensorShape(ic, iw, ih, mb) :
@@ -177,8 +190,7 @@ status_t acl_init_conf(acl_conv_conf_t &acp, memory_desc_t &src_md,
             acl_layout);
 
     acp.wei_info = arm_compute::TensorInfo(
-            is_nspc ? arm_compute::TensorShape(ic, kw, kh, oc) :
-            arm_compute::TensorShape(kw, kh, ic, oc),
+            wei_shape,
             1,
             acl_wei_data_t,
             acl_layout);
@@ -202,13 +214,38 @@ status_t acl_init_conf(acl_conv_conf_t &acp, memory_desc_t &src_md,
     acp.is_int8 = utils::one_of(src_d.data_type(), s8, u8)
             && wei_d.data_type() == s8;
 
+    // oneDNN computes dst = oscale * (conv(src - src_zp, wei) + bias) + dst_zp.
+    // Compute Library dequantizes a tensor as scale * (q - offset), so the
+    // zero points map to the offsets of the source and the destination, and
+    // the output scales map either to the inverse of the destination scale,
+    // or to the per channel weights scales. The latter are also needed for
+    // the signed weights of an unsigned source.
     if (acp.is_int8) {
-        const float *scales = attr.output_scales_.scales_;
-        acp.src_info.set_quantization_info(arm_compute::QuantizationInfo(1, 0));
+        const auto &oscales = attr.output_scales_;
+        const int src_zp = *attr.zero_points_.get(DNNL_ARG_SRC);
+        const int dst_zp = *attr.zero_points_.get(DNNL_ARG_DST);
+        const bool wei_per_channel
+                = oscales.mask_ != 0 || src_d.data_type() == u8;
+
+        acp.src_info.set_quantization_info(
+                arm_compute::QuantizationInfo(1, src_zp));
         acp.bia_info.set_quantization_info(arm_compute::QuantizationInfo(1, 0));
-        acp.wei_info.set_quantization_info(arm_compute::QuantizationInfo(1, 0));
-        acp.dst_info.set_quantization_info(
-                arm_compute::QuantizationInfo(1.0f / scales[0], 0));
+        if (wei_per_channel) {
+            std::vector<float> wei_scales(oc);
+            for (int i = 0; i < oc; ++i)
+                wei_scales[i] = oscales.scales_[oscales.mask_ == 0 ? 0 : i];
+            acp.wei_info.set_data_type(
+                    arm_compute::DataType::QSYMM8_PER_CHANNEL);
+            acp.wei_info.set_quantization_info(
+                    arm_compute::QuantizationInfo(wei_scales));
+            acp.dst_info.set_quantization_info(
+                    arm_compute::QuantizationInfo(1, dst_zp));
+        } else {
+            acp.wei_info.set_quantization_info(
+                    arm_compute::QuantizationInfo(1, 0));
+            acp.dst_info.set_quantization_info(arm_compute::QuantizationInfo(
+                    1.0f / oscales.scales_[0], dst_zp));
+        }
     }
 
     // Post-op activations
@@ -224,6 +261,7 @@ status_t init_conf_gemm(acl_conv_conf_t &acp, memory_desc_t &src_md,
 
     // General Compute Library checks, memory tags are also set there
     CHECK(acl_init_conf(acp, src_md, weights_md, dst_md, bias_md, cd, attr));
+    if (acp.is_depthwise) return status::unimplemented;
 
     // clang-format off
     // Validate convolution manually to check for return status
@@ -265,6 +303,7 @@ status_t init_conf_wino(acl_conv_conf_t &acp, memory_desc_t &src_md,
 
     // General Compute Library checks, memory tags are also set there
     CHECK(acl_init_conf(acp, src_md, weights_md, dst_md, bias_md, cd, attr));
+    if (acp.is_depthwise) return status::unimplemented;
 
     const bool wino_shape_ok // unit strides only, no dilations
             = (acp.padstride_info.stride() == std::pair<uint, uint> {1, 1})
@@ -290,6 +329,35 @@ status_t init_conf_wino(acl_conv_conf_t &acp, memory_desc_t &src_md,
     return status::success;
 }
 
+status_t init_conf_depthwise(acl_conv_conf_t &acp, memory_desc_t &src_md,
+        memory_desc_t &weights_md, memory_desc_t &dst_md,
+        memory_desc_t &bias_md, const convolution_desc_t &cd,
+        const primitive_attr_t &attr) {
+
+    // General Compute Library checks, memory tags are also set there
+    CHECK(acl_init_conf(acp, src_md, weights_md, dst_md, bias_md, cd, attr));
+    if (!acp.is_depthwise) return status::unimplemented;
+
+    // clang-format off
+    // Validate convolution manually to check for return status
+    arm_compute::NEDepthwiseConvolutionLayer acl_dw_conv;
+    auto acl_st = acl_dw_conv.validate(
+        &acp.src_info,
+        &acp.wei_info,
+        acp.with_bias ? &acp.bia_info : nullptr,
+        &acp.dst_info,
+        acp.padstride_info,
+        1, // depth multiplier
+        acp.act_info,
+        acp.dilation_info);
+    // clang-format on
+    if (acl_st.error_code() != arm_compute::ErrorCode::OK) {
+        return status::unimplemented;
+    }
+
+    return status::success;
+}
+
 arm_compute::DataType get_acl_data_t(const dnnl_data_type_t dt) {
     switch (dt) {
         case bf16: return arm_compute::DataType::BFLOAT16; break;
@@ -45,6 +45,8 @@ status_t acl_gemm_convolution_fwd_t<src_type, wei_type, dst_type,
 
     bool with_bias = pd()->acp_.with_bias;
 
+    std::lock_guard<std::mutex> lock(mtx_);
+
     // Retrieve primitive resource and configured Compute Library objects
     auto *acl_resource = ctx.get_resource_mapper()->get<acl_resource_t>(this);
     acl_obj_t<arm_compute::NEGEMMConvolutionLayer> &acl_obj
@@ -79,6 +81,7 @@ status_t acl_gemm_convolution_fwd_t<src_type, wei_type, dst_type,
 using namespace data_type;
 template struct acl_gemm_convolution_fwd_t<f32>;
 template struct acl_gemm_convolution_fwd_t<s8, s8, s8, s32>;
+template struct acl_gemm_convolution_fwd_t<u8, s8, u8, s32>;
 
 } // namespace aarch64
 } // namespace cpu
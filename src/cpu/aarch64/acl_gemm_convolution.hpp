@@ -17,6 +17,8 @@
 #ifndef CPU_AARCH64_ACL_GEMM_CONVOLUTION_HPP
 #define CPU_AARCH64_ACL_GEMM_CONVOLUTION_HPP
 
+#include <mutex>
+
 #include "common/c_types_map.hpp"
 #include "common/memory_tracking.hpp"
 #include "common/primitive.hpp"
@@ -127,17 +129,22 @@ struct acl_gemm_convolution_fwd_t : public primitive_t {
     protected:
         bool output_scales_mask_ok() const {
             using namespace data_type;
-            const auto &mask = attr()->output_scales_.mask_;
+            const auto &oscales = attr()->output_scales_;
+            // Common or per output channel scales, known at creation
             return IMPLICATION(!utils::one_of(src_type, s8, u8),
-                           attr()->output_scales_.has_default_values())
-                    // TODO: add support for per_channel quantization
-                    && mask == 0;
+                           oscales.has_default_values())
+                    && utils::one_of(oscales.mask_, 0, 1 << 1)
+                    && oscales.defined();
         }
 
         bool zero_points_ok() const {
             using namespace data_type;
-            // TODO: add support for asymmetric quantization
-            return attr()->zero_points_.has_default_values();
+            const auto &zp = attr()->zero_points_;
+            // Common source and destination zero points, known at creation
+            return IMPLICATION(!utils::one_of(src_type, s8, u8),
+                           zp.has_default_values())
+                    && zp.has_default_values(DNNL_ARG_WEIGHTS) && zp.common()
+                    && zp.defined();
         }
 
         bool post_ops_ok() const {
@@ -185,6 +192,12 @@ private:
     status_t execute_forward(const exec_ctx_t &ctx) const;
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
 
+    // The Compute Library function and its tensors are configured once and
+    // kept in the primitive resource, so that the weights are reshaped only
+    // on the first run. The tensors are shared by all the executions
+    // of the primitive, hence the executions are serialized.
+    mutable std::mutex mtx_;
+
 }; // acl_gemm_convolution_fwd_t
 
 } // namespace aarch64
@@ -0,0 +1,158 @@
+/*******************************************************************************
+* Copyright 2020 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dnnl/dnnl_types.h"
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+#include "cpu/aarch64/acl_inner_product.hpp"
+
+#include <cstring>
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+using namespace dnnl::impl::status;
+using namespace dnnl::impl::memory_tracking::names;
+using namespace dnnl::impl::utils;
+
+status_t acl_inner_product_fwd_t::pd_t::init_conf() {
+    using namespace format_tag;
+
+    const int ndims = src_md_.ndims;
+    const bool is_2d = ndims == 2;
+
+    // Compute Library takes 2D tensors only. Both src and weights are
+    // flattened over the channels and the spatial dimensions, which is
+    // valid as long as the two share the same layout.
+    const auto plain_tag = pick(ndims - 2, ab, abc, abcd, abcde);
+    const auto nspc_tag = is_2d ? plain_tag : pick(ndims - 3, acb, acdb, acdeb);
+
+    format_tag_t src_tag = undef;
+    if (src_md_.format_kind == format_kind::any) {
+        CHECK(memory_desc_init_by_tag(src_md_, plain_tag));
+        src_tag = plain_tag;
+    } else {
+        src_tag = memory_desc_matches_one_of_tag(src_md_, plain_tag, nspc_tag);
+    }
+    if (src_tag == undef) return status::unimplemented;
+
+    if (weights_md_.format_kind == format_kind::any)
+        CHECK(memory_desc_init_by_tag(weights_md_, src_tag));
+    if (!memory_desc_matches_tag(weights_md_, src_tag))
+        return status::unimplemented;
+
+    if (dst_md_.format_kind == format_kind::any)
+        CHECK(memory_desc_init_by_tag(dst_md_, nc));
+    if (!memory_desc_matches_tag(dst_md_, nc)) return status::unimplemented;
+
+    aip_.with_bias = with_bias();
+    if (aip_.with_bias) {
+        if (bias_md_.format_kind == format_kind::any)
+            CHECK(memory_desc_init_by_tag(bias_md_, x));
+        if (!memory_desc_matches_tag(bias_md_, x))
+            return status::unimplemented;
+    }
+
+    const int mb = MB();
+    const int oc = OC();
+    const int ic = IC_total();
+    const auto acl_data_t = arm_compute::DataType::F32;
+
+    // clang-format off
+    aip_.src_info = arm_compute::TensorInfo(
+            arm_compute::TensorShape(ic, mb), 1, acl_data_t);
+    aip_.wei_info = arm_compute::TensorInfo(
+            arm_compute::TensorShape(ic, oc), 1, acl_data_t);
+    aip_.bia_info = arm_compute::TensorInfo(
+            aip_.with_bias ? arm_compute::TensorShape(oc)
+                           : arm_compute::TensorShape(),
+            1, acl_data_t);
+    aip_.dst_info = arm_compute::TensorInfo(
+            arm_compute::TensorShape(oc, mb), 1, acl_data_t);
+    // clang-format on
+
+    // oneDNN weights are OC x IC, Compute Library transposes them once
+    // during the first run
+    aip_.fc_info.transpose_weights = true;
+    aip_.fc_info.activation_info = acl_convolution_utils::get_acl_act(*attr());
+
+    // clang-format off
+    // Validate fully connected layer manually to check for return status
+    auto acl_st = arm_compute::NEFullyConnectedLayer::validate(
+        &aip_.src_info,
+        &aip_.wei_info,
+        aip_.with_bias ? &aip_.bia_info : nullptr,
+        &aip_.dst_info,
+        aip_.fc_info);
+    // clang-format on
+    if (acl_st.error_code() != arm_compute::ErrorCode::OK) {
+        return status::unimplemented;
+    }
+
+    return status::success;
+}
+
+status_t acl_inner_product_fwd_t::execute_forward(
+        const exec_ctx_t &ctx) const {
+    status_t status = status::success;
+    auto src_base = CTX_IN_MEM(const data_t *, DNNL_ARG_SRC);
+    auto wei_base = CTX_IN_MEM(const data_t *, DNNL_ARG_WEIGHTS);
+    auto bia_base = CTX_IN_MEM(const data_t *, DNNL_ARG_BIAS);
+    auto dst_base = CTX_OUT_MEM(data_t *, DNNL_ARG_DST);
+
+    bool with_bias = pd()->aip_.with_bias;
+
+    std::lock_guard<std::mutex> lock(mtx_);
+
+    // Retrieve primitive resource and configured Compute Library objects
+    auto *acl_resource
+            = ctx.get_resource_mapper()->get<acl_ip_resource_t>(this);
+    acl_obj_t<arm_compute::NEFullyConnectedLayer> &acl_obj
+            = acl_resource->get_acl_obj();
+
+    acl_obj.src_tensor.allocator()->import_memory(
+            const_cast<data_t *>(src_base));
+    acl_obj.wei_tensor.allocator()->import_memory(
+            const_cast<data_t *>(wei_base));
+    acl_obj.dst_tensor.allocator()->import_memory(dst_base);
+
+    // Retrieve extra bias memory from the scratchpad and copy from user memory
+    if (with_bias) {
+        const auto scratchpad = ctx.get_scratchpad_grantor();
+        auto *bia_memory = scratchpad.get<data_t>(key_none);
+        std::memcpy(bia_memory, bia_base, pd()->OC() * sizeof(data_t));
+        acl_obj.bia_tensor.allocator()->import_memory(bia_memory);
+    }
+
+    acl_obj.conv.run();
+
+    acl_obj.src_tensor.allocator()->free();
+    acl_obj.wei_tensor.allocator()->free();
+    acl_obj.dst_tensor.allocator()->free();
+    if (with_bias) { acl_obj.bia_tensor.allocator()->free(); }
+
+    return status;
+}
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
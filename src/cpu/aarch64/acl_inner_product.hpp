@@ -0,0 +1,179 @@
+/*******************************************************************************
+* Copyright 2020 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_AARCH64_ACL_INNER_PRODUCT_HPP
+#define CPU_AARCH64_ACL_INNER_PRODUCT_HPP
+
+#include <mutex>
+
+#include "common/c_types_map.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/primitive.hpp"
+
+#include "cpu/aarch64/acl_convolution_utils.hpp"
+
+#include "cpu/cpu_inner_product_pd.hpp"
+
+#include "arm_compute/runtime/NEON/NEFunctions.h"
+#include "arm_compute/runtime/Scheduler.h"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+struct acl_ip_conf_t {
+    bool with_bias;
+    arm_compute::TensorInfo src_info;
+    arm_compute::TensorInfo wei_info;
+    arm_compute::TensorInfo bia_info;
+    arm_compute::TensorInfo dst_info;
+    arm_compute::FullyConnectedLayerInfo fc_info;
+};
+
+struct acl_ip_resource_t : public resource_t {
+    acl_ip_resource_t()
+        : acl_obj_(utils::make_unique<
+                acl_obj_t<arm_compute::NEFullyConnectedLayer>>()) {}
+
+    status_t configure(const acl_ip_conf_t &aip) {
+        if (!acl_obj_) return status::out_of_memory;
+
+        // Init Compute Library tensors based on info from descriptor
+        acl_obj_->src_tensor.allocator()->init(aip.src_info);
+        acl_obj_->wei_tensor.allocator()->init(aip.wei_info);
+        acl_obj_->dst_tensor.allocator()->init(aip.dst_info);
+        acl_obj_->bia_tensor.allocator()->init(aip.bia_info);
+
+        // clang-format off
+        acl_obj_->conv.configure(
+            &acl_obj_->src_tensor,
+            &acl_obj_->wei_tensor,
+            aip.with_bias ? &acl_obj_->bia_tensor : nullptr,
+            &acl_obj_->dst_tensor,
+            aip.fc_info);
+        // clang-format on
+
+        return status::success;
+    }
+
+    acl_obj_t<arm_compute::NEFullyConnectedLayer> &get_acl_obj() const {
+        return *acl_obj_;
+    }
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(acl_ip_resource_t);
+
+private:
+    std::unique_ptr<acl_obj_t<arm_compute::NEFullyConnectedLayer>> acl_obj_;
+
+}; // acl_ip_resource_t
+
+struct acl_inner_product_fwd_t : public primitive_t {
+    struct pd_t : public cpu_inner_product_fwd_pd_t {
+        using cpu_inner_product_fwd_pd_t::cpu_inner_product_fwd_pd_t;
+
+        DECLARE_COMMON_PD_T(
+                "gemm:acl", acl_inner_product_fwd_t, USE_GLOBAL_SCRATCHPAD);
+
+        status_t init(engine_t *engine) {
+            using namespace data_type;
+            using smask_t = primitive_attr_t::skip_mask_t;
+
+            bool ok = is_fwd() && !has_zero_dim_memory()
+                    && expect_data_types(f32, f32, f32, f32, undef)
+                    && attr()->has_default_values(smask_t::post_ops)
+                    && post_ops_ok();
+            if (!ok) return status::unimplemented;
+
+            if (init_conf() != status::success) return status::unimplemented;
+
+            // Number of threads in Compute Library is set by OMP_NUM_THREADS
+            // dnnl_get_max_threads() == OMP_NUM_THREADS
+            arm_compute::Scheduler::get().set_num_threads(
+                    dnnl_get_max_threads());
+
+            // The same as for the convolutions, the biases are passed to
+            // Compute Library through the scratchpad
+            if (aip_.with_bias) {
+                auto scratchpad = scratchpad_registry().registrar();
+                scratchpad.template book<float>(
+                        memory_tracking::names::key_none, OC());
+            }
+
+            return status::success;
+        }
+
+        acl_ip_conf_t aip_;
+
+    protected:
+        status_t init_conf();
+
+        bool post_ops_ok() const {
+            auto const &po = attr()->post_ops_;
+            auto is_eltwise
+                    = [&](int idx) { return po.entry_[idx].is_eltwise(); };
+
+            bool eltwise_ok = false;
+            // Compute Library supports only one eltwise post-op
+            if (po.len() == 1 && is_eltwise(0)) {
+                const auto act_type = po.entry_[0].eltwise.alg;
+                eltwise_ok = acl_convolution_utils::acl_act_ok(act_type);
+            }
+
+            return eltwise_ok || (po.len() == 0);
+        }
+    };
+
+    acl_inner_product_fwd_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t create_resource(
+            engine_t *engine, resource_mapper_t &mapper) const override {
+        if (mapper.has_resource(this)) return status::success;
+
+        auto r = utils::make_unique<acl_ip_resource_t>();
+        if (!r) return status::out_of_memory;
+
+        // Configure the resource based on information from primitive descriptor
+        auto st = r->configure(pd()->aip_);
+        if (st == status::success) { mapper.add(this, std::move(r)); }
+
+        return st;
+    }
+
+    typedef prec_traits<data_type::f32>::type data_t;
+
+    status_t execute(const exec_ctx_t &ctx) const override {
+        return execute_forward(ctx);
+    }
+
+private:
+    status_t execute_forward(const exec_ctx_t &ctx) const;
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    // The Compute Library function and its tensors are configured once and
+    // kept in the primitive resource, so that the weights are reshaped only
+    // on the first run. The tensors are shared by all the executions
+    // of the primitive, hence the executions are serialized.
+    mutable std::mutex mtx_;
+
+}; // acl_inner_product_fwd_t
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -44,6 +44,8 @@ status_t acl_wino_convolution_fwd_t::execute_forward(
 
     bool with_bias = pd()->acp_.with_bias;
 
+    std::lock_guard<std::mutex> lock(mtx_);
+
     // Retrieve primitive resource and configured Compute Library objects
     auto *acl_resource
             = ctx.get_resource_mapper()->get<acl_wino_resource_t>(this);
@@ -17,6 +17,8 @@
 #ifndef CPU_AARCH64_ACL_WINOGRAD_CONVOLUTION_HPP
 #define CPU_AARCH64_ACL_WINOGRAD_CONVOLUTION_HPP
 
+#include <mutex>
+
 #include "common/c_types_map.hpp"
 #include "common/dnnl_thread.hpp"
 #include "common/memory_tracking.hpp"
@@ -166,6 +168,12 @@ private:
     status_t execute_forward(const exec_ctx_t &ctx) const;
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
 
+    // The Compute Library function and its tensors are configured once and
+    // kept in the primitive resource, so that the weights are reshaped only
+    // on the first run. The tensors are shared by all the executions
+    // of the primitive, hence the executions are serialized.
+    mutable std::mutex mtx_;
+
 }; // acl_wino_convolution_fwd_t
 
 } // namespace aarch64
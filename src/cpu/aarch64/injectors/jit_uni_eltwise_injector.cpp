@@ -0,0 +1,448 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/nstl.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/aarch64/injectors/jit_uni_eltwise_injector.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+using namespace Xbyak_aarch64;
+
+template <cpu_isa_t isa>
+bool jit_uni_eltwise_injector_f32<isa>::is_supported(alg_kind_t alg) {
+    using namespace alg_kind;
+    return utils::one_of(alg, eltwise_relu, eltwise_tanh, eltwise_elu,
+            eltwise_square, eltwise_abs, eltwise_sqrt, eltwise_linear,
+            eltwise_bounded_relu, eltwise_logistic, eltwise_exp,
+            eltwise_gelu_tanh, eltwise_swish, eltwise_clip);
+}
+
+template <cpu_isa_t isa>
+size_t jit_uni_eltwise_injector_f32<isa>::aux_vecs_count() const {
+    using namespace alg_kind;
+    size_t count = 0;
+    switch (alg_) {
+        case eltwise_relu: count = alpha_ == 0.f ? 0 : 1; break;
+        case eltwise_elu: count = 4; break;
+        case eltwise_tanh: count = 4; break;
+        case eltwise_square: count = 0; break;
+        case eltwise_abs: count = 0; break;
+        case eltwise_sqrt: count = 0; break;
+        case eltwise_linear: count = 2; break;
+        case eltwise_bounded_relu: count = 1; break;
+        case eltwise_logistic: count = 4; break;
+        case eltwise_exp: count = 3; break;
+        case eltwise_gelu_tanh: count = 5; break;
+        case eltwise_swish: count = 5; break;
+        case eltwise_clip: count = 1; break;
+        default: assert(!"unsupported eltwise algorithm");
+    }
+    // the scale is applied with the help of an auxiliary register
+    if (scale_ != 1.f) count = nstl::max(count, (size_t)1);
+    return count;
+}
+
+template <cpu_isa_t isa>
+void jit_uni_eltwise_injector_f32<isa>::injector_preamble(
+        size_t start_idx, size_t end_idx) {
+    preserved_vecs_count = 0;
+    const size_t vecs_to_preserve = aux_vecs_count();
+    // The registers to compute have to leave room for the auxiliary ones.
+    assert(vecs_to_preserve + (end_idx - start_idx) <= vecs_count);
+
+    for (size_t idx = 0; idx < vecs_count; idx++) {
+        if (preserved_vecs_count >= vecs_to_preserve) break;
+        if (start_idx <= idx && idx < end_idx) continue;
+
+        preserved_vec_idxs[preserved_vecs_count++] = idx;
+    }
+    assert(preserved_vecs_count == vecs_to_preserve);
+
+    if (save_state_) {
+        h->str(x_table, pre_ptr(h->sp, -16));
+        if (preserved_vecs_count) {
+            h->sub(h->sp, h->sp, preserved_vecs_count * vlen);
+            for (size_t i = 0; i < preserved_vecs_count; i++)
+                h->str(ZReg(preserved_vec_idxs[i]),
+                        ptr(h->sp, static_cast<int32_t>(i), MUL_VL));
+        }
+        load_table_addr();
+    }
+
+    z_aux0 = TReg(preserved_vec_idxs[0]);
+    z_aux1 = TReg(preserved_vec_idxs[1]);
+    z_aux2 = TReg(preserved_vec_idxs[2]);
+    z_aux3 = TReg(preserved_vec_idxs[3]);
+    z_aux4 = TReg(preserved_vec_idxs[4]);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_eltwise_injector_f32<isa>::injector_postamble() {
+    if (!save_state_) return;
+
+    if (preserved_vecs_count) {
+        for (size_t i = 0; i < preserved_vecs_count; i++)
+            h->ldr(ZReg(preserved_vec_idxs[i]),
+                    ptr(h->sp, static_cast<int32_t>(i), MUL_VL));
+        h->add(h->sp, h->sp, preserved_vecs_count * vlen);
+    }
+    h->ldr(x_table, post_ptr(h->sp, 16));
+}
+
+template <cpu_isa_t isa>
+void jit_uni_eltwise_injector_f32<isa>::table_val(
+        const TReg &z, key_t key, size_t key_off_idx) {
+    const size_t off = (key + key_off_idx) * sizeof(float);
+    assert(off <= 252);
+    h->ld1rw(z, p_all / T_z, ptr(x_table, static_cast<int32_t>(off)));
+}
+
+template <cpu_isa_t isa>
+void jit_uni_eltwise_injector_f32<isa>::mov_vec(
+        const TReg &z_dst, const TReg &z_src) {
+    h->mov(ZRegD(z_dst.getIdx()), ZRegD(z_src.getIdx()));
+}
+
+template <cpu_isa_t isa>
+void jit_uni_eltwise_injector_f32<isa>::exp_compute_vector_fwd(
+        const TReg &z_src) {
+    // exp(x) =
+    // = exp(n * ln(2) + r) // divide x by ln(2) and get quot and rem
+    // = 2^n * exp(r) // simplify the exp(n*ln(2)) expression
+
+    // get mask of values lower than log(FLT_MIN) to zero them in the output
+    table_val(z_aux0, exp_ln_flt_min_f);
+    h->fcmlt(p_tmp0.s, p_all / T_z, z_src, z_aux0);
+
+    h->fmax(z_src, p_all / T_m, z_aux0);
+    table_val(z_aux0, exp_ln_flt_max_f);
+    h->fmin(z_src, p_all / T_m, z_aux0);
+    mov_vec(z_aux1, z_src);
+
+    // calculate exp(x)
+    // fx = x * log2ef + 0.5
+    table_val(z_aux0, exp_log2ef);
+    h->fmul(z_src, z_src, z_aux0);
+    table_val(z_aux0, half);
+    h->fadd(z_src, z_src, z_aux0);
+
+    // tmp = floorf(fx)
+    h->frintm(z_aux2, p_all / T_m, z_src);
+
+    // x = x - fx * ln2
+    table_val(z_aux0, ln2f);
+    h->fmls(z_aux1, p_all / T_m, z_aux2, z_aux0);
+
+    // We do not count 2^n here, because n can reach 128 and 2^128 is not
+    // representable by fp32, so to get around this problem, instead of
+    // computing 2^n * exp(r) will be counted 2*2^(n-1)*exp(r), because 2^127
+    // and 2 are numbers representable in fp32.
+
+    // compute 2^(n-1)
+    table_val(z_aux0, one);
+    h->fsub(z_src, z_aux2, z_aux0);
+    h->fcvtzs(z_aux2, p_all / T_m, z_src);
+    table_val(z_aux0, exponent_bias);
+    h->add(z_aux2, z_aux2, z_aux0);
+    h->lsl(z_aux2, z_aux2, n_mantissa_bits);
+    // set zeroes at those points which were < log(FLT_MIN)
+    h->mov(z_aux2, p_tmp0 / T_m, 0);
+
+    // compute polynomial
+    table_val(z_src, exp_pol, 4);
+    for (int i = 3; i >= 0; i--) {
+        table_val(z_aux0, exp_pol, i);
+        h->fmad(z_src, p_all / T_m, z_aux1, z_aux0);
+    }
+    table_val(z_aux0, one);
+    h->fmad(z_src, p_all / T_m, z_aux1, z_aux0);
+
+    // y = y * 2^n
+    h->fmul(z_src, z_src, z_aux2);
+    h->fadd(z_src, z_src, z_src);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_eltwise_injector_f32<isa>::relu_compute_vector_fwd(
+        const TReg &z_src) {
+    if (alpha_ == 0.f) {
+        h->fmax(z_src, p_all / T_m, 0.f);
+        return;
+    }
+    h->fcmlt(p_tmp0.s, p_all / T_z, z_src, 0.);
+    table_val(z_aux0, alpha);
+    h->fmul(z_src, p_tmp0 / T_m, z_aux0);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_eltwise_injector_f32<isa>::elu_compute_vector_fwd(
+        const TReg &z_src) {
+    // IMPORTANT: we use z_aux3 for the copy as exp uses z_aux0..z_aux2
+    mov_vec(z_aux3, z_src);
+
+    // compute exponent
+    exp_compute_vector_fwd(z_src);
+
+    // alpha * (exp(x) - 1)
+    table_val(z_aux0, one);
+    h->fsub(z_src, z_src, z_aux0);
+    table_val(z_aux0, alpha);
+    h->fmul(z_src, z_src, z_aux0);
+
+    // combine with the positive part
+    h->fcmgt(p_tmp0.s, p_all / T_z, z_aux3, 0.);
+    h->mov(z_src, p_tmp0 / T_m, z_aux3);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_eltwise_injector_f32<isa>::tanh_compute_vector_fwd(
+        const TReg &z_src) {
+    // tanh(x) = 1 - 2 / (exp(2x) + 1), which loses the relative accuracy
+    // close to zero, where the odd Taylor series
+    // tanh(x) = x + x^3 * (c3 + x^2 * (c5 + x^2 * (c7 + x^2 * c9)))
+    // is used instead.
+    // IMPORTANT: we use z_aux3 for the copy as exp uses z_aux0..z_aux2
+    mov_vec(z_aux3, z_src);
+
+    h->fadd(z_src, z_src, z_src);
+    exp_compute_vector_fwd(z_src);
+    table_val(z_aux0, one);
+    h->fadd(z_src, z_src, z_aux0);
+    table_val(z_aux1, two);
+    h->fdivr(z_src, p_all / T_m, z_aux1);
+    h->fsub(z_src, z_aux0, z_src);
+
+    // the series
+    h->fmul(z_aux1, z_aux3, z_aux3);
+    table_val(z_aux2, tanh_pol, 3);
+    for (int i = 2; i >= 0; i--) {
+        table_val(z_aux0, tanh_pol, i);
+        h->fmad(z_aux2, p_all / T_m, z_aux1, z_aux0);
+    }
+    h->fmul(z_aux2, z_aux2, z_aux1);
+    h->fmad(z_aux2, p_all / T_m, z_aux3, z_aux3);
+
+    // take the series where |x| < bound
+    h->fabs(z_aux1, p_all / T_m, z_aux3);
+    table_val(z_aux0, tanh_taylor_bound);
+    h->fcmlt(p_tmp0.s, p_all / T_z, z_aux1, z_aux0);
+    h->mov(z_src, p_tmp0 / T_m, z_aux2);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_eltwise_injector_f32<isa>::square_compute_vector_fwd(
+        const TReg &z_src) {
+    h->fmul(z_src, z_src, z_src);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_eltwise_injector_f32<isa>::abs_compute_vector_fwd(
+        const TReg &z_src) {
+    h->fabs(z_src, p_all / T_m, z_src);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_eltwise_injector_f32<isa>::sqrt_compute_vector_fwd(
+        const TReg &z_src) {
+    h->fsqrt(z_src, p_all / T_m, z_src);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_eltwise_injector_f32<isa>::linear_compute_vector_fwd(
+        const TReg &z_src) {
+    // compute x = alpha * x + beta;
+    table_val(z_aux0, alpha);
+    table_val(z_aux1, beta);
+    h->fmad(z_src, p_all / T_m, z_aux0, z_aux1);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_eltwise_injector_f32<isa>::bounded_relu_compute_vector_fwd(
+        const TReg &z_src) {
+    h->fmax(z_src, p_all / T_m, 0.f);
+    table_val(z_aux0, alpha);
+    h->fmin(z_src, p_all / T_m, z_aux0);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_eltwise_injector_f32<isa>::logistic_compute_vector_fwd(
+        const TReg &z_src) {
+    // To avoid exp(x) overflow happened at x > logf(FLT_MAX), negate positive,
+    // compute exp(x), where x <= 0 to get 0 <= exp(x) <= 1 and restore value
+    // sign at the end. This is possible due to logistic is symmetric function.
+    // IMPORTANT: we use z_aux3 for the copy as exp uses z_aux0..z_aux2
+    mov_vec(z_aux3, z_src);
+    h->fabs(z_src, p_all / T_m, z_src);
+    h->fneg(z_src, p_all / T_m, z_src);
+
+    exp_compute_vector_fwd(z_src);
+    // y = exp(x) / (exp(x) + 1)
+    table_val(z_aux0, one);
+    h->fadd(z_aux1, z_src, z_aux0);
+    h->fdiv(z_src, p_all / T_m, z_aux1);
+
+    // now we have to apply the "symmetry" based on original sign
+    h->fsub(z_aux1, z_aux0, z_src);
+    h->fcmgt(p_tmp0.s, p_all / T_z, z_aux3, 0.);
+    h->mov(z_src, p_tmp0 / T_m, z_aux1);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_eltwise_injector_f32<isa>::gelu_tanh_compute_vector_fwd(
+        const TReg &z_src) {
+    // IMPORTANT: we use z_aux4 for the copy as tanh uses z_aux0..z_aux3
+    mov_vec(z_aux4, z_src);
+
+    // compute G(x) = sqrt_root_two_over_pi * x * (1 + fitting_const * x * x)
+    h->fmul(z_aux0, z_src, z_src);
+    table_val(z_aux1, gelu_tanh_fitting_const);
+    table_val(z_aux2, one);
+    h->fmad(z_aux0, p_all / T_m, z_aux1, z_aux2);
+    h->fmul(z_src, z_src, z_aux0);
+    table_val(z_aux0, gelu_tanh_sqrt_two_over_pi);
+    h->fmul(z_src, z_src, z_aux0);
+
+    // compute tanh(G(x))
+    tanh_compute_vector_fwd(z_src);
+
+    // compute 0.5 * x * (1 + tanh(G(x)))
+    table_val(z_aux0, one);
+    h->fadd(z_src, z_src, z_aux0);
+    table_val(z_aux0, half);
+    h->fmul(z_src, z_src, z_aux0);
+    h->fmul(z_src, z_src, z_aux4);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_eltwise_injector_f32<isa>::swish_compute_vector_fwd(
+        const TReg &z_src) {
+    // IMPORTANT: we use z_aux4 for the copy as logistic uses z_aux0..z_aux3
+    mov_vec(z_aux4, z_src);
+    // x*alpha
+    table_val(z_aux0, alpha);
+    h->fmul(z_src, z_src, z_aux0);
+    // sigmoid(x*alpha)
+    logistic_compute_vector_fwd(z_src);
+    // x*sigmoid(alpha*x)
+    h->fmul(z_src, z_src, z_aux4);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_eltwise_injector_f32<isa>::clip_compute_vector_fwd(
+        const TReg &z_src) {
+    // x = min(max(x, alpha), beta)
+    table_val(z_aux0, alpha);
+    h->fmax(z_src, p_all / T_m, z_aux0);
+    table_val(z_aux0, beta);
+    h->fmin(z_src, p_all / T_m, z_aux0);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_eltwise_injector_f32<isa>::compute_body(
+        size_t start_idx, size_t end_idx) {
+    using namespace alg_kind;
+    for (size_t idx = start_idx; idx < end_idx; idx++) {
+        const TReg z(idx);
+        switch (alg_) {
+            case eltwise_relu: relu_compute_vector_fwd(z); break;
+            case eltwise_elu: elu_compute_vector_fwd(z); break;
+            case eltwise_tanh: tanh_compute_vector_fwd(z); break;
+            case eltwise_square: square_compute_vector_fwd(z); break;
+            case eltwise_abs: abs_compute_vector_fwd(z); break;
+            case eltwise_sqrt: sqrt_compute_vector_fwd(z); break;
+            case eltwise_linear: linear_compute_vector_fwd(z); break;
+            case eltwise_bounded_relu:
+                bounded_relu_compute_vector_fwd(z);
+                break;
+            case eltwise_logistic: logistic_compute_vector_fwd(z); break;
+            case eltwise_exp: exp_compute_vector_fwd(z); break;
+            case eltwise_gelu_tanh: gelu_tanh_compute_vector_fwd(z); break;
+            case eltwise_swish: swish_compute_vector_fwd(z); break;
+            case eltwise_clip: clip_compute_vector_fwd(z); break;
+            default: assert(!"unsupported eltwise algorithm");
+        }
+        if (scale_ != 1.f) {
+            table_val(z_aux0, scale);
+            h->fmul(z, z, z_aux0);
+        }
+    }
+}
+
+template <cpu_isa_t isa>
+void jit_uni_eltwise_injector_f32<isa>::compute_vector_range(
+        size_t start_idx, size_t end_idx) {
+    assert(start_idx < end_idx && end_idx <= vecs_count);
+
+    injector_preamble(start_idx, end_idx);
+    compute_body(start_idx, end_idx);
+    injector_postamble();
+}
+
+template <cpu_isa_t isa>
+void jit_uni_eltwise_injector_f32<isa>::prepare_table(bool gen_table) {
+    if (!gen_table) return;
+
+    // The entries are emitted in the order of key_t so that the offset of
+    // an entry is its key times the entry size.
+    const uint32_t table[] = {
+            0x3f800000, // one
+            0x40000000, // two
+            0x3f000000, // half
+            (uint32_t)float2int(alpha_), // alpha
+            (uint32_t)float2int(beta_), // beta
+            (uint32_t)float2int(scale_), // scale
+            0x3fb8aa3b, // exp_log2ef: log2(e)
+            0x42b17218, // exp_ln_flt_max_f: logf(FLT_MAX)
+            0xc2aeac50, // exp_ln_flt_min_f: logf(FLT_MIN)
+            0x3f317218, // ln2f: ln(2)
+            0x0000007f, // exponent_bias
+            // exp(x) polynomial approximation, p0 = 1.0f
+            0x3f7ffffb, // p1 = 0.999999701f
+            0x3efffee3, // p2 = 0.499991506f
+            0x3e2aad40, // p3 = 0.166676521f
+            0x3d2b9d0d, // p4 = 0.0418978221f
+            0x3c07cfce, // p5 = 0.00828929059f
+            // tanh(x) Taylor series, the first coefficient is 1.0f
+            0xbeaaaaab, // c3 = -1/3
+            0x3e088889, // c5 = 2/15
+            0xbd5d0dd1, // c7 = -17/315
+            0x3cb327a4, // c9 = 62/2835
+            0x3e800000, // tanh_taylor_bound = 0.25f
+            0x3d372713, // gelu_tanh_fitting_const = 0.044715f
+            0x3f4c422a, // gelu_tanh_sqrt_two_over_pi = 0.797884f
+    };
+    static_assert(sizeof(table) / sizeof(table[0]) == undef_key,
+            "eltwise injector table is inconsistent with its keys");
+
+    h->align(64);
+    h->L(l_table);
+    for (const auto &v : table)
+        h->dw(v);
+}
+
+template struct jit_uni_eltwise_injector_f32<sve_512>;
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
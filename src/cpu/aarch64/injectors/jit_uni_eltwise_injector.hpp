@@ -0,0 +1,165 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_AARCH64_INJECTORS_JIT_UNI_ELTWISE_INJECTOR_HPP
+#define CPU_AARCH64_INJECTORS_JIT_UNI_ELTWISE_INJECTOR_HPP
+
+#include <assert.h>
+
+#include "common/c_types_map.hpp"
+#include "common/primitive_attr.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/aarch64/jit_generator.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+// Forward eltwise injector for f32 data in SVE registers. It follows the x64
+// jit_uni_eltwise_injector_f32 interface: the host kernel loads the data into
+// vector registers, calls compute_vector_range() and emits the table of
+// constants with prepare_table() after its code.
+template <cpu_isa_t isa>
+struct jit_uni_eltwise_injector_f32 {
+    using TReg = typename cpu_isa_traits<isa>::Vmm;
+
+    // Arguments description:
+    // host - jit generator which is filled with instructions
+    // alg, alpha, beta, scale - user eltwise arguments
+    // save_state - when true, preserves on stack the auxiliary vector
+    //   registers and x_table. Restores them when done.
+    // x_table - GPR where table label is stored to get access for pre-defined
+    //   constants used in alg codes.
+    // p_all - predicate register with all the lanes set. Has to be one of
+    //   p0-p7 since it governs arithmetic and load instructions.
+    // p_tmp0 - predicate register to operate with masks in alg codes. Has
+    //   to be one of p0-p7 as well. Its value is not preserved.
+    jit_uni_eltwise_injector_f32(jit_generator *host, alg_kind_t alg,
+            float alpha, float beta, float scale, bool save_state = true,
+            Xbyak_aarch64::XReg x_table = Xbyak_aarch64::XReg(21),
+            Xbyak_aarch64::PReg p_all = Xbyak_aarch64::PReg(1),
+            Xbyak_aarch64::PReg p_tmp0 = Xbyak_aarch64::PReg(2))
+        : alg_(alg)
+        , alpha_(alpha)
+        , beta_(beta)
+        , scale_(scale)
+        , h(host)
+        , save_state_(save_state)
+        , x_table(x_table)
+        , p_all(p_all)
+        , p_tmp0(p_tmp0) {
+        assert(isa == sve_512);
+        assert(is_supported(alg_));
+        assert(p_all.getIdx() < 8 && p_tmp0.getIdx() < 8);
+    }
+
+    jit_uni_eltwise_injector_f32(jit_generator *host,
+            const post_ops_t::entry_t::eltwise_t &eltwise,
+            bool save_state = true,
+            Xbyak_aarch64::XReg x_table = Xbyak_aarch64::XReg(21),
+            Xbyak_aarch64::PReg p_all = Xbyak_aarch64::PReg(1),
+            Xbyak_aarch64::PReg p_tmp0 = Xbyak_aarch64::PReg(2))
+        : jit_uni_eltwise_injector_f32(host, eltwise.alg, eltwise.alpha,
+                eltwise.beta, eltwise.scale, save_state, x_table, p_all,
+                p_tmp0) {}
+
+    static bool is_supported(alg_kind_t alg);
+
+    void compute_vector_range(size_t start_idx, size_t end_idx);
+    void compute_vector(size_t idx) { compute_vector_range(idx, idx + 1); }
+    void prepare_table(bool gen_table = true);
+    void load_table_addr() { h->adr(x_table, l_table); }
+
+private:
+    const alg_kind_t alg_;
+    const float alpha_;
+    const float beta_;
+    const float scale_;
+
+    jit_generator *const h;
+
+    const bool save_state_;
+    const Xbyak_aarch64::XReg x_table;
+    const Xbyak_aarch64::PReg p_all;
+    const Xbyak_aarch64::PReg p_tmp0;
+
+    Xbyak_aarch64::Label l_table;
+
+    static constexpr size_t vlen = cpu_isa_traits<isa>::vlen;
+    static constexpr size_t preserved_vecs_max = 5;
+    static constexpr size_t vecs_count = cpu_isa_traits<isa>::n_vregs;
+    static constexpr int n_mantissa_bits = 23;
+
+    size_t preserved_vecs_count = 0;
+    size_t preserved_vec_idxs[preserved_vecs_max] = {0};
+
+    TReg z_aux0 {0}, z_aux1 {0}, z_aux2 {0}, z_aux3 {0}, z_aux4 {0};
+
+    size_t aux_vecs_count() const;
+
+    void injector_preamble(size_t start_idx, size_t end_idx);
+    void injector_postamble();
+    void compute_body(size_t start_idx, size_t end_idx);
+
+    void exp_compute_vector_fwd(const TReg &z_src);
+    void relu_compute_vector_fwd(const TReg &z_src);
+    void elu_compute_vector_fwd(const TReg &z_src);
+    void tanh_compute_vector_fwd(const TReg &z_src);
+    void square_compute_vector_fwd(const TReg &z_src);
+    void abs_compute_vector_fwd(const TReg &z_src);
+    void sqrt_compute_vector_fwd(const TReg &z_src);
+    void linear_compute_vector_fwd(const TReg &z_src);
+    void bounded_relu_compute_vector_fwd(const TReg &z_src);
+    void logistic_compute_vector_fwd(const TReg &z_src);
+    void gelu_tanh_compute_vector_fwd(const TReg &z_src);
+    void swish_compute_vector_fwd(const TReg &z_src);
+    void clip_compute_vector_fwd(const TReg &z_src);
+
+    // The constants are stored once per entry and broadcast on load, the
+    // offsets of ld1rw limit the table to 64 entries.
+    enum key_t {
+        one = 0, // 1.f
+        two, // 2.f
+        half, // 0.5f
+        alpha, // alpha
+        beta, // beta
+        scale, // scale
+        exp_log2ef, // log2(e)
+        exp_ln_flt_max_f, // logf(FLT_MAX) - max normal value
+        exp_ln_flt_min_f, // logf(FLT_MIN) - min normal value
+        ln2f, // ln(2)
+        exponent_bias, // (127 = 2^7 - 1), the exponent bias
+        exp_pol, // 5 entries: see the table definition
+        tanh_pol = exp_pol + 5, // 4 entries: see the table definition
+        tanh_taylor_bound = tanh_pol + 4, // bound of the Taylor series
+        gelu_tanh_fitting_const, // 0.044715f
+        gelu_tanh_sqrt_two_over_pi, // sqrtf(2.f/pi) = 0.797884f
+        undef_key,
+    };
+
+    void table_val(const TReg &z, key_t key, size_t key_off_idx = 0);
+    void mov_vec(const TReg &z_dst, const TReg &z_src);
+};
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
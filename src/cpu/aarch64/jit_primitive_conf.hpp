@@ -0,0 +1,71 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_AARCH64_JIT_PRIMITIVE_CONF_HPP
+#define CPU_AARCH64_JIT_PRIMITIVE_CONF_HPP
+
+#include <stdint.h>
+
+#include "common/primitive_attr.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+/* convolution */
+struct jit_conv_conf_t {
+    prop_kind_t prop_kind;
+
+    int simd_w;
+    int ndims;
+    int mb;
+    int ngroups, ic, oc;
+    int ih, iw, oh, ow;
+    int l_pad, t_pad;
+    int kh, kw;
+    int stride_h, stride_w;
+    int dilate_h, dilate_w;
+    format_tag_t src_tag, wei_tag, dst_tag;
+    bool with_bias;
+    bool with_sum;
+    bool with_eltwise;
+
+    post_ops_t::entry_t::eltwise_t eltwise;
+    float sum_scale;
+
+    int nb_ic, ic_block;
+    int nb_oc, oc_block;
+    int nb_oc_blocking; /* used in jit kernels for nb_oc work blocking taking
+                           into account vector registers distribution */
+    int ur_w;
+    int ur_w_tail;
+};
+
+struct jit_conv_call_s {
+    const void *src;
+    const void *dst;
+    const void *filt;
+    const void *bias;
+    size_t kh_padding;
+};
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -0,0 +1,391 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/c_types_map.hpp"
+#include "common/memory.hpp"
+#include "common/nstl.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/aarch64/jit_sve_512_conv_kernel.hpp"
+
+#define GET_OFF(field) static_cast<uint32_t>(offsetof(jit_conv_call_s, field))
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+using namespace dnnl::impl::format_tag;
+using namespace dnnl::impl::memory_tracking::names;
+using namespace dnnl::impl::utils;
+using namespace Xbyak_aarch64;
+
+namespace {
+
+// Splits the full ur_w blocks of an output row into the blocks that touch
+// the left padding, the blocks that read the input only and the blocks that
+// touch the right padding. The blocks in the middle are processed in a loop,
+// the others are generated one by one.
+void get_ow_blocks(const jit_conv_conf_t &jcp, int &n_head, int &n_body,
+        int &n_tail) {
+    const int n_full = jcp.ow / jcp.ur_w;
+    const int ext_kw = (jcp.kw - 1) * (jcp.dilate_w + 1) + 1;
+    auto is_body = [&](int b) {
+        const int iw_s = b * jcp.ur_w * jcp.stride_w - jcp.l_pad;
+        const int iw_e = iw_s + (jcp.ur_w - 1) * jcp.stride_w + ext_kw;
+        return iw_s >= 0 && iw_e <= jcp.iw;
+    };
+
+    n_head = 0;
+    while (n_head < n_full && !is_body(n_head))
+        n_head++;
+    n_body = 0;
+    while (n_head + n_body < n_full && is_body(n_head + n_body))
+        n_body++;
+    n_tail = n_full - n_head - n_body;
+}
+
+} // namespace
+
+jit_sve_512_conv_fwd_kernel::jit_sve_512_conv_fwd_kernel(
+        const jit_conv_conf_t &ajcp, const primitive_attr_t &attr)
+    : jcp(ajcp), attr_(attr) {
+    if (jcp.with_eltwise)
+        eltwise_injector_.reset(new injector_t(
+                this, jcp.eltwise, false, x_table, p_all, p_tmp0));
+}
+
+bool jit_sve_512_conv_fwd_kernel::is_src_valid(
+        int ow_start, int jj, int ki) const {
+    // ow_start < 0 marks the blocks that never touch the padding
+    if (ow_start < 0) return true;
+    const int iw = (ow_start + jj) * jcp.stride_w - jcp.l_pad
+            + ki * (jcp.dilate_w + 1);
+    return iw >= 0 && iw < jcp.iw;
+}
+
+void jit_sve_512_conv_fwd_kernel::prepare_output(int ur_w) {
+    for (int ocb = 0; ocb < jcp.nb_oc_blocking; ocb++)
+        for (int jj = 0; jj < ur_w; jj++) {
+            const TReg z = z_out(ocb, jj);
+            if (!jcp.with_bias)
+                eor(ZRegD(z.getIdx()), ZRegD(z.getIdx()), ZRegD(z.getIdx()));
+            else if (jj == 0)
+                ld1w(z, p_all / T_z, ptr(reg_bias, ocb, MUL_VL));
+            else
+                mov(ZRegD(z.getIdx()), ZRegD(z_out(ocb, 0).getIdx()));
+        }
+}
+
+void jit_sve_512_conv_fwd_kernel::compute_loop_fma(int ur_w, int ow_start) {
+    const int ic_block = jcp.ic_block;
+    const int oc_block = jcp.oc_block;
+    const int typesize = sizeof(float);
+    const int ker_ocb_stride
+            = jcp.nb_ic * jcp.kh * jcp.kw * ic_block * oc_block * typesize;
+    const int ker_kw_stride = ic_block * oc_block * typesize;
+    const int src_w_stride = ic_block * typesize;
+    // ld1w takes the offsets in [-8, 7] vectors, so the weights pointers are
+    // shifted to the middle of the 16 input channels
+    const int ic_mid = 8;
+
+    Label icb_loop, kh_loop, skip_kh_loop;
+
+    mov(aux_reg_src_ic, reg_src);
+    mov(aux_reg_ker_ic, reg_ker);
+    mov_imm(reg_icb, jcp.nb_ic);
+
+    L(icb_loop);
+    {
+        mov(aux_reg_src, aux_reg_src_ic);
+        mov(aux_reg_ker, aux_reg_ker_ic);
+        mov(reg_kj, reg_kh);
+        cmp(reg_kj, 0);
+        b(LE, skip_kh_loop);
+
+        L(kh_loop);
+        {
+            for (int ki = 0; ki < jcp.kw; ki++) {
+                int jj_start = 0;
+                while (jj_start < ur_w && !is_src_valid(ow_start, jj_start, ki))
+                    jj_start++;
+                int jj_end = ur_w;
+                while (jj_end > jj_start
+                        && !is_src_valid(ow_start, jj_end - 1, ki))
+                    jj_end--;
+                if (jj_start == jj_end) continue;
+
+                for (int ocb = 0; ocb < jcp.nb_oc_blocking; ocb++)
+                    add_imm(reg_ker_ocb[ocb], aux_reg_ker,
+                            ocb * ker_ocb_stride + ki * ker_kw_stride
+                                    + ic_mid * vlen,
+                            X_TMP_0);
+
+                for (int ic = 0; ic < ic_block; ic++) {
+                    for (int ocb = 0; ocb < jcp.nb_oc_blocking; ocb++)
+                        ld1w(z_wei(ocb), p_all / T_z,
+                                ptr(reg_ker_ocb[ocb], ic - ic_mid, MUL_VL));
+                    for (int jj = jj_start; jj < jj_end; jj++) {
+                        const int src_off = (jj * jcp.stride_w
+                                                    + ki * (jcp.dilate_w + 1))
+                                * src_w_stride;
+                        if (src_off != 0)
+                            add_imm(reg_tmp_addr, aux_reg_src, src_off,
+                                    X_TMP_0);
+                        ld1rw(z_src, p_all / T_z,
+                                ptr(src_off != 0 ? reg_tmp_addr : aux_reg_src,
+                                        ic * typesize));
+                        for (int ocb = 0; ocb < jcp.nb_oc_blocking; ocb++)
+                            fmla(z_out(ocb, jj), p_all / T_m, z_src,
+                                    z_wei(ocb));
+                    }
+                }
+            }
+
+            add_imm(aux_reg_src, aux_reg_src,
+                    (jcp.dilate_h + 1) * jcp.iw * src_w_stride, X_TMP_0);
+            add_imm(aux_reg_ker, aux_reg_ker, jcp.kw * ker_kw_stride,
+                    X_TMP_0);
+            subs(reg_kj, reg_kj, 1);
+            b(GT, kh_loop);
+        }
+        L(skip_kh_loop);
+
+        add_imm(aux_reg_src_ic, aux_reg_src_ic,
+                jcp.ih * jcp.iw * src_w_stride, X_TMP_0);
+        add_imm(aux_reg_ker_ic, aux_reg_ker_ic,
+                jcp.kh * jcp.kw * ker_kw_stride, X_TMP_0);
+        subs(reg_icb, reg_icb, 1);
+        b(GT, icb_loop);
+    }
+}
+
+void jit_sve_512_conv_fwd_kernel::store_output(int ur_w) {
+    const int typesize = sizeof(float);
+    const int dst_ocb_stride = jcp.oh * jcp.ow * jcp.oc_block * typesize;
+
+    // Returns the address of the output vector, uses the immediate offset
+    // of ld1w/st1w when possible
+    auto out_addr = [&](int ocb, int jj) {
+        const int off = ocb * dst_ocb_stride + jj * vlen;
+        if (off % vlen == 0 && off / vlen <= 7)
+            return ptr(reg_dst, off / vlen, MUL_VL);
+        add_imm(reg_tmp_addr, reg_dst, off, X_TMP_0);
+        return ptr(reg_tmp_addr, 0, MUL_VL);
+    };
+
+    if (jcp.with_sum) {
+        const bool scale_is_one = jcp.sum_scale == 1.f;
+        if (!scale_is_one) {
+            mov_imm(W_TMP_0, float2int(jcp.sum_scale));
+            dup(z_sum_scale, W_TMP_0);
+        }
+        for (int ocb = 0; ocb < jcp.nb_oc_blocking; ocb++)
+            for (int jj = 0; jj < ur_w; jj++) {
+                const TReg z = z_out(ocb, jj);
+                ld1w(z_src, p_all / T_z, out_addr(ocb, jj));
+                if (scale_is_one)
+                    fadd(z, z, z_src);
+                else
+                    fmla(z, p_all / T_m, z_src, z_sum_scale);
+            }
+    }
+
+    if (jcp.with_eltwise) {
+        eltwise_injector_->load_table_addr();
+        eltwise_injector_->compute_vector_range(0, ur_w * jcp.nb_oc_blocking);
+    }
+
+    for (int ocb = 0; ocb < jcp.nb_oc_blocking; ocb++)
+        for (int jj = 0; jj < ur_w; jj++)
+            st1w(z_out(ocb, jj), p_all, out_addr(ocb, jj));
+}
+
+void jit_sve_512_conv_fwd_kernel::compute_block(int ur_w, int ow_start) {
+    const int typesize = sizeof(float);
+
+    prepare_output(ur_w);
+    compute_loop_fma(ur_w, ow_start);
+    store_output(ur_w);
+
+    add_imm(reg_src, reg_src, ur_w * jcp.stride_w * jcp.ic_block * typesize,
+            X_TMP_0);
+    add_imm(reg_dst, reg_dst, ur_w * jcp.oc_block * typesize, X_TMP_0);
+}
+
+void jit_sve_512_conv_fwd_kernel::generate() {
+    const int typesize = sizeof(float);
+
+    preamble();
+
+    ldr(reg_src, ptr(reg_param, GET_OFF(src)));
+    ldr(reg_dst, ptr(reg_param, GET_OFF(dst)));
+    ldr(reg_ker, ptr(reg_param, GET_OFF(filt)));
+    ldr(reg_kh, ptr(reg_param, GET_OFF(kh_padding)));
+    if (jcp.with_bias) ldr(reg_bias, ptr(reg_param, GET_OFF(bias)));
+    ptrue(p_all.s);
+
+    // reg_src points to the input column of the first filter tap of the
+    // current block, which is negative for the left padding
+    if (jcp.l_pad > 0)
+        add_imm(reg_src, reg_src, -jcp.l_pad * jcp.ic_block * typesize,
+                X_TMP_0);
+
+    int n_head, n_body, n_tail;
+    get_ow_blocks(jcp, n_head, n_body, n_tail);
+
+    int ow = 0;
+    for (int b = 0; b < n_head; b++, ow += jcp.ur_w)
+        compute_block(jcp.ur_w, ow);
+
+    if (n_body == 1) {
+        compute_block(jcp.ur_w, -1);
+    } else if (n_body > 1) {
+        Label ow_loop;
+        mov_imm(reg_ow_blocks, n_body);
+        L(ow_loop);
+        {
+            compute_block(jcp.ur_w, -1);
+            subs(reg_ow_blocks, reg_ow_blocks, 1);
+            b(GT, ow_loop);
+        }
+    }
+    ow += n_body * jcp.ur_w;
+
+    for (int b = 0; b < n_tail; b++, ow += jcp.ur_w)
+        compute_block(jcp.ur_w, ow);
+
+    if (jcp.ur_w_tail > 0) compute_block(jcp.ur_w_tail, ow);
+
+    postamble();
+
+    if (jcp.with_eltwise) eltwise_injector_->prepare_table();
+}
+
+status_t jit_sve_512_conv_fwd_kernel::init_conf(jit_conv_conf_t &jcp,
+        const convolution_desc_t &cd, memory_desc_t &src_md,
+        memory_desc_t &weights_md, memory_desc_t &dst_md,
+        memory_desc_t &bias_md, const primitive_attr_t &attr) {
+    if (!mayiuse(sve_512)) return status::unimplemented;
+
+    const memory_desc_wrapper src_d(&src_md);
+    const memory_desc_wrapper weights_d(&weights_md);
+    const memory_desc_wrapper dst_d(&dst_md);
+
+    const bool with_groups = weights_d.ndims() == src_d.ndims() + 1;
+    const int ndims = src_d.ndims();
+    if (!utils::one_of(ndims, 3, 4)) return status::unimplemented;
+    const bool is_1d = ndims == 3;
+
+    jcp = zero<decltype(jcp)>();
+    jcp.prop_kind = cd.prop_kind;
+    jcp.ndims = ndims;
+    jcp.ngroups = with_groups ? weights_d.dims()[0] : 1;
+    jcp.mb = src_d.dims()[0];
+    jcp.oc = dst_d.dims()[1] / jcp.ngroups;
+    jcp.ic = src_d.dims()[1] / jcp.ngroups;
+    jcp.ih = is_1d ? 1 : src_d.dims()[ndims - 2];
+    jcp.iw = src_d.dims()[ndims - 1];
+    jcp.oh = is_1d ? 1 : dst_d.dims()[ndims - 2];
+    jcp.ow = dst_d.dims()[ndims - 1];
+    jcp.kh = is_1d ? 1 : weights_d.dims()[with_groups + ndims - 2];
+    jcp.kw = weights_d.dims()[with_groups + ndims - 1];
+    jcp.t_pad = is_1d ? 0 : cd.padding[0][ndims - 4];
+    jcp.l_pad = cd.padding[0][ndims - 3];
+    jcp.stride_h = is_1d ? 1 : cd.strides[ndims - 4];
+    jcp.stride_w = cd.strides[ndims - 3];
+    jcp.dilate_h = is_1d ? 0 : cd.dilates[ndims - 4];
+    jcp.dilate_w = cd.dilates[ndims - 3];
+    jcp.with_bias = cd.bias_desc.format_kind != format_kind::undef;
+
+    jcp.simd_w = cpu_isa_traits<sve_512>::vlen / sizeof(float);
+    jcp.ic_block = jcp.simd_w;
+    jcp.oc_block = jcp.simd_w;
+    if (jcp.ic % jcp.ic_block != 0 || jcp.oc % jcp.oc_block != 0)
+        return status::unimplemented;
+    jcp.nb_ic = jcp.ic / jcp.ic_block;
+    jcp.nb_oc = jcp.oc / jcp.oc_block;
+
+    const auto dat_tag = is_1d ? nCw16c : nChw16c;
+    const auto wei_tag = with_groups ? (is_1d ? gOIw16i16o : gOIhw16i16o)
+                                     : (is_1d ? OIw16i16o : OIhw16i16o);
+    if (src_d.format_kind() == format_kind::any)
+        CHECK(memory_desc_init_by_tag(src_md, dat_tag));
+    if (dst_d.format_kind() == format_kind::any)
+        CHECK(memory_desc_init_by_tag(dst_md, dat_tag));
+    if (weights_d.format_kind() == format_kind::any)
+        CHECK(memory_desc_init_by_tag(weights_md, wei_tag));
+    if (jcp.with_bias && bias_md.format_kind == format_kind::any)
+        CHECK(memory_desc_init_by_tag(bias_md, x));
+
+    jcp.src_tag = src_d.matches_one_of_tag(dat_tag);
+    jcp.dst_tag = dst_d.matches_one_of_tag(dat_tag);
+    jcp.wei_tag = weights_d.matches_one_of_tag(wei_tag);
+    if (jcp.src_tag != dat_tag || jcp.dst_tag != dat_tag
+            || jcp.wei_tag != wei_tag)
+        return status::unimplemented;
+    if (jcp.with_bias && bias_md.format_desc.blocking.strides[0] != 1)
+        return status::unimplemented;
+
+    const auto &p = attr.post_ops_;
+    auto is_eltwise = [&](int idx) {
+        return p.entry_[idx].is_eltwise()
+                && injector_t::is_supported(p.entry_[idx].eltwise.alg);
+    };
+    auto is_sum = [&](int idx) { return p.entry_[idx].is_sum(); };
+    bool post_ops_ok = false;
+    switch (p.len()) {
+        case 0: post_ops_ok = true; break;
+        case 1: post_ops_ok = is_eltwise(0) || is_sum(0); break;
+        case 2: post_ops_ok = is_sum(0) && is_eltwise(1); break;
+        default: post_ops_ok = false;
+    }
+    if (!post_ops_ok) return status::unimplemented;
+
+    const int sum_idx = p.find(primitive_kind::sum);
+    jcp.with_sum = sum_idx != -1;
+    jcp.sum_scale = jcp.with_sum ? p.entry_[sum_idx].sum.scale : 1.f;
+    const int eltwise_idx = p.find(primitive_kind::eltwise);
+    jcp.with_eltwise = eltwise_idx != -1;
+    if (jcp.with_eltwise) jcp.eltwise = p.entry_[eltwise_idx].eltwise;
+
+    // The broadcast input value is reused by nb_oc_blocking output channel
+    // blocks, the rest of the accumulators go to the output width.
+    jcp.nb_oc_blocking = 4;
+    while (jcp.nb_oc % jcp.nb_oc_blocking != 0)
+        jcp.nb_oc_blocking--;
+    jcp.ur_w = nstl::min(jcp.ow, max_acc_regs / jcp.nb_oc_blocking);
+    jcp.ur_w_tail = jcp.ow % jcp.ur_w;
+
+    // Every block that touches the padding is generated separately, make sure
+    // the code fits into the buffer
+    int n_head, n_body, n_tail;
+    get_ow_blocks(jcp, n_head, n_body, n_tail);
+    const int n_blocks
+            = n_head + (n_body > 0) + n_tail + (jcp.ur_w_tail > 0);
+    const size_t block_insts = (size_t)jcp.kw * jcp.ic_block
+            * (jcp.nb_oc_blocking + jcp.ur_w * (3 + jcp.nb_oc_blocking));
+    const size_t code_size_estimate = n_blocks * block_insts * 4;
+    if (code_size_estimate > MAX_CODE_SIZE / 2) return status::unimplemented;
+
+    return status::success;
+}
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,104 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_AARCH64_JIT_SVE_512_CONV_KERNEL_HPP
+#define CPU_AARCH64_JIT_SVE_512_CONV_KERNEL_HPP
+
+#include <memory>
+
+#include "common/c_types_map.hpp"
+#include "common/memory_tracking.hpp"
+
+#include "cpu/aarch64/injectors/jit_uni_eltwise_injector.hpp"
+#include "cpu/aarch64/jit_generator.hpp"
+#include "cpu/aarch64/jit_primitive_conf.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+// Direct f32 forward convolution for the blocked layouts with 16 channels
+// per block. A call computes a full output row for nb_oc_blocking output
+// channel blocks, looping over all the input channel blocks and the kh
+// rows that hit the input inside the kernel.
+struct jit_sve_512_conv_fwd_kernel : public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_sve_512_conv_fwd_kernel)
+
+    jit_sve_512_conv_fwd_kernel(
+            const jit_conv_conf_t &ajcp, const primitive_attr_t &attr);
+
+    static status_t init_conf(jit_conv_conf_t &jcp,
+            const convolution_desc_t &cd, memory_desc_t &src_md,
+            memory_desc_t &weights_md, memory_desc_t &dst_md,
+            memory_desc_t &bias_md, const primitive_attr_t &attr);
+
+    jit_conv_conf_t jcp;
+    const primitive_attr_t &attr_;
+
+private:
+    using TReg = typename cpu_isa_traits<sve_512>::Vmm;
+    using injector_t = jit_uni_eltwise_injector_f32<sve_512>;
+
+    static constexpr int vlen = cpu_isa_traits<sve_512>::vlen;
+    // The eltwise injector takes up to 5 auxiliary registers after the
+    // accumulators.
+    static constexpr int max_acc_regs = 27;
+
+    const Xbyak_aarch64::XReg reg_param = abi_param1;
+    const Xbyak_aarch64::XReg reg_src = x1;
+    const Xbyak_aarch64::XReg reg_dst = x2;
+    const Xbyak_aarch64::XReg reg_ker = x3;
+    const Xbyak_aarch64::XReg reg_bias = x4;
+    const Xbyak_aarch64::XReg reg_kh = x5;
+    const Xbyak_aarch64::XReg aux_reg_src = x6;
+    const Xbyak_aarch64::XReg aux_reg_ker = x7;
+    const Xbyak_aarch64::XReg aux_reg_src_ic = x8;
+    const Xbyak_aarch64::XReg aux_reg_ker_ic = x10;
+    const Xbyak_aarch64::XReg reg_kj = x11;
+    const Xbyak_aarch64::XReg reg_icb = x12;
+    const Xbyak_aarch64::XReg reg_ow_blocks = x13;
+    const Xbyak_aarch64::XReg reg_tmp_addr = x14;
+    // one weights pointer per output channel block
+    const Xbyak_aarch64::XReg reg_ker_ocb[4] = {x15, x16, x17, x19};
+    const Xbyak_aarch64::XReg x_table = x21;
+
+    const Xbyak_aarch64::PReg p_all = p1;
+    const Xbyak_aarch64::PReg p_tmp0 = p2;
+
+    const TReg z_src = TReg(31);
+    const TReg z_sum_scale = TReg(30);
+
+    std::unique_ptr<injector_t> eltwise_injector_;
+
+    TReg z_out(int ocb, int jj) const { return TReg(ocb * jcp.ur_w + jj); }
+    TReg z_wei(int ocb) const { return TReg(31 - 1 - ocb); }
+
+    bool is_src_valid(int ow_start, int jj, int ki) const;
+    void prepare_output(int ur_w);
+    void compute_loop_fma(int ur_w, int ow_start);
+    void store_output(int ur_w);
+    void compute_block(int ur_w, int ow_start);
+
+    void generate() override;
+};
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -0,0 +1,89 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/aarch64/jit_sve_512_convolution.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+using namespace dnnl::impl::utils;
+
+void jit_sve_512_convolution_fwd_t::execute_forward(
+        const exec_ctx_t &ctx) const {
+    auto src = CTX_IN_MEM(const data_t *, DNNL_ARG_SRC);
+    auto weights = CTX_IN_MEM(const data_t *, DNNL_ARG_WEIGHTS);
+    auto bias = CTX_IN_MEM(const data_t *, DNNL_ARG_BIAS);
+    auto dst = CTX_OUT_MEM(data_t *, DNNL_ARG_DST);
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+    const memory_desc_wrapper weights_d(pd()->weights_md(0));
+
+    const auto &jcp = pd()->jcp_;
+    const bool is_1d = jcp.ndims == 3;
+    const bool with_groups = pd()->with_groups();
+    const int oc_chunks = jcp.nb_oc / jcp.nb_oc_blocking;
+    const int dh = jcp.dilate_h + 1;
+
+    // The 1D case is the 2D one with a single row
+    auto src_off = [&](int n, int c, int h) {
+        return is_1d ? src_d.blk_off(n, c) : src_d.blk_off(n, c, h);
+    };
+    auto dst_off = [&](int n, int c, int h) {
+        return is_1d ? dst_d.blk_off(n, c) : dst_d.blk_off(n, c, h);
+    };
+    auto wei_off = [&](int g, int oc, int kh) {
+        if (with_groups)
+            return is_1d ? weights_d.blk_off(g, oc)
+                         : weights_d.blk_off(g, oc, 0, kh);
+        return is_1d ? weights_d.blk_off(oc) : weights_d.blk_off(oc, 0, kh);
+    };
+
+    parallel_nd(jcp.mb, jcp.ngroups, oc_chunks, jcp.oh,
+            [&](int n, int g, int occ, int oh) {
+                const int ocb = occ * jcp.nb_oc_blocking;
+                const int g_ocb = g * jcp.nb_oc + ocb;
+                const int g_icb = g * jcp.nb_ic;
+
+                // the filter rows that hit the input
+                const int ih_s = oh * jcp.stride_h - jcp.t_pad;
+                int kh_s = ih_s < 0 ? div_up(-ih_s, dh) : 0;
+                const int kh_e = nstl::min(jcp.kh, div_up(jcp.ih - ih_s, dh));
+                const int kh_padding = nstl::max(0, kh_e - kh_s);
+                if (kh_padding == 0) kh_s = 0;
+                const int ih = kh_padding == 0 ? 0 : ih_s + kh_s * dh;
+
+                jit_conv_call_s p = jit_conv_call_s();
+                p.src = src + src_off(n, g_icb, ih);
+                p.dst = dst + dst_off(n, g_ocb, oh);
+                p.filt = weights + wei_off(g, ocb, kh_s);
+                p.bias = jcp.with_bias ? bias + g_ocb * jcp.oc_block : nullptr;
+                p.kh_padding = kh_padding;
+                (*kernel_)(&p);
+            });
+}
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,322 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/eltwise_pd.hpp"
+#include "common/nstl.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/aarch64/injectors/jit_uni_eltwise_injector.hpp"
+#include "cpu/aarch64/jit_generator.hpp"
+#include "cpu/aarch64/jit_uni_binary.hpp"
+
+#define GET_OFF(field) static_cast<uint32_t>(offsetof(jit_args_t, field))
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+using namespace Xbyak_aarch64;
+
+struct jit_args_t {
+    const void *src0;
+    const void *src1;
+    void *dst;
+    size_t work_amount;
+};
+
+struct jit_uni_binary_kernel_t : public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_binary_kernel_t)
+
+    jit_uni_binary_kernel_t(const binary_pd_t *pd, bool bcast)
+        : pd_(pd), bcast_(bcast) {
+        const auto &po = pd_->attr()->post_ops_;
+        for (int i = 0; i < po.len(); i++)
+            if (po.entry_[i].is_eltwise())
+                injectors_.emplace_back(new injector_t(this,
+                        po.entry_[i].eltwise, false, x_table, p_all, p_tmp0));
+    }
+
+    void operator()(jit_args_t *p) { jit_generator::operator()(p); }
+
+private:
+    using injector_t = jit_uni_eltwise_injector_f32<sve_512>;
+    using TReg = typename cpu_isa_traits<sve_512>::Vmm;
+
+    static constexpr int vlen = cpu_isa_traits<sve_512>::vlen;
+    static constexpr int simd_w = vlen / sizeof(float);
+    // Registers [0, unroll) keep the result, [unroll, 2 * unroll) src1 and
+    // the previous dst for sum. The eltwise injectors take the auxiliary
+    // registers right after the result ones, which is fine as the
+    // temporaries are not needed by then.
+    static constexpr int unroll = 4;
+
+    const binary_pd_t *pd_;
+    const bool bcast_;
+    std::vector<std::unique_ptr<injector_t>> injectors_;
+
+    const XReg reg_param = abi_param1;
+    const XReg reg_src0 = x1;
+    const XReg reg_src1 = x2;
+    const XReg reg_dst = x3;
+    const XReg reg_work_amount = x4;
+    const XReg x_table = x21;
+
+    const PReg p_all = p1;
+    const PReg p_tmp0 = p2;
+    const PReg p_tail = p3;
+
+    const TReg z_src1_bcast = TReg(31);
+    const TReg z_sum_scale = TReg(30);
+
+    void compute_binary(const TReg &z, const TReg &z_src1) {
+        using namespace alg_kind;
+        switch (pd_->desc()->alg_kind) {
+            case binary_add: fadd(z, z, z_src1); break;
+            case binary_mul: fmul(z, z, z_src1); break;
+            case binary_max: fmax(z, p_all / T_m, z_src1); break;
+            case binary_min: fmin(z, p_all / T_m, z_src1); break;
+            case binary_div: fdiv(z, p_all / T_m, z_src1); break;
+            case binary_sub: fsub(z, z, z_src1); break;
+            default: assert(!"unsupported alg");
+        }
+    }
+
+    void compute(int n_vecs, const PReg &p_load) {
+        for (int i = 0; i < n_vecs; i++) {
+            if (!bcast_)
+                ld1w(TReg(unroll + i), p_load / T_z,
+                        ptr(reg_src1, i, MUL_VL));
+            ld1w(TReg(i), p_load / T_z, ptr(reg_src0, i, MUL_VL));
+        }
+        for (int i = 0; i < n_vecs; i++)
+            compute_binary(TReg(i), bcast_ ? z_src1_bcast : TReg(unroll + i));
+
+        const auto &po = pd_->attr()->post_ops_;
+        size_t injector_idx = 0;
+        for (int e = 0; e < po.len(); e++) {
+            if (po.entry_[e].is_eltwise()) {
+                const auto &inj = injectors_[injector_idx++];
+                inj->load_table_addr();
+                inj->compute_vector_range(0, n_vecs);
+            } else {
+                // sum
+                mov_imm(W_TMP_0, float2int(po.entry_[e].sum.scale));
+                dup(z_sum_scale, W_TMP_0);
+                for (int i = 0; i < n_vecs; i++)
+                    ld1w(TReg(unroll + i), p_load / T_z,
+                            ptr(reg_dst, i, MUL_VL));
+                for (int i = 0; i < n_vecs; i++)
+                    fmla(TReg(i), p_all / T_m, TReg(unroll + i), z_sum_scale);
+            }
+        }
+
+        for (int i = 0; i < n_vecs; i++)
+            st1w(TReg(i), p_load, ptr(reg_dst, i, MUL_VL));
+    }
+
+    void advance(int n_vecs) {
+        add(reg_src0, reg_src0, n_vecs * vlen);
+        if (!bcast_) add(reg_src1, reg_src1, n_vecs * vlen);
+        add(reg_dst, reg_dst, n_vecs * vlen);
+        sub(reg_work_amount, reg_work_amount, n_vecs * simd_w);
+    }
+
+    void generate() override {
+        preamble();
+
+        ldr(reg_src0, ptr(reg_param, GET_OFF(src0)));
+        ldr(reg_src1, ptr(reg_param, GET_OFF(src1)));
+        ldr(reg_dst, ptr(reg_param, GET_OFF(dst)));
+        ldr(reg_work_amount, ptr(reg_param, GET_OFF(work_amount)));
+        ptrue(p_all.s);
+        if (bcast_) ld1rw(z_src1_bcast, p_all / T_z, ptr(reg_src1));
+
+        Label unroll_loop, tail_loop, exit;
+
+        L(unroll_loop);
+        {
+            cmp(reg_work_amount, unroll * simd_w);
+            b(LT, tail_loop);
+            compute(unroll, p_all);
+            advance(unroll);
+            b(unroll_loop);
+        }
+
+        // The tail is processed one vector at a time, the last one is
+        // masked.
+        L(tail_loop);
+        {
+            cmp(reg_work_amount, 0);
+            b(LE, exit);
+            whilelt(p_tail.s, xzr, reg_work_amount);
+            compute(1, p_tail);
+            advance(1);
+            b(tail_loop);
+        }
+
+        L(exit);
+        postamble();
+
+        for (const auto &inj : injectors_)
+            inj->prepare_table();
+    }
+};
+
+template <data_type_t src_type>
+bool jit_uni_binary_t<src_type>::pd_t::init_broadcast() {
+    const memory_desc_wrapper src0_d(src_md(0));
+    const memory_desc_wrapper src1_d(src_md(1));
+
+    bcast_rows_ = 0;
+    bcast_row_len_ = 0;
+    if (src0_d == src1_d) return true;
+
+    // src1 has to match src0 in the leading dimensions and be broadcast
+    // along the rest
+    const int ndims = src0_d.ndims();
+    int bcast_start = ndims;
+    while (bcast_start > 0 && src1_d.dims()[bcast_start - 1] == 1)
+        bcast_start--;
+    if (bcast_start == ndims) return false;
+    for (int d = 0; d < bcast_start; d++)
+        if (src1_d.dims()[d] != src0_d.dims()[d]) return false;
+
+    // the rows are contiguous only for the plain row-major src0
+    using namespace format_tag;
+    const auto plain_tag = utils::pick(ndims - 1, a, ab, abc, abcd, abcde,
+            abcdef);
+    if (!src0_d.matches_tag(plain_tag)
+            || src0_d.nelems(true) != src0_d.nelems())
+        return false;
+
+    bcast_rows_ = utils::array_product(src0_d.dims(), bcast_start);
+    bcast_row_len_ = utils::array_product(
+            src0_d.dims() + bcast_start, ndims - bcast_start);
+    return true;
+}
+
+template <data_type_t src_type>
+bool jit_uni_binary_t<src_type>::pd_t::post_ops_ok() const {
+    const auto &po = attr()->post_ops_;
+    for (int i = 0; i < po.len(); i++) {
+        const auto &e = po.entry_[i];
+        if (e.is_sum()) {
+            if (i > 0) return false;
+        } else if (!e.is_eltwise()
+                || !jit_uni_eltwise_injector_f32<sve_512>::is_supported(
+                        e.eltwise.alg)
+                || (!memory_desc_wrapper(dst_md()).is_dense()
+                        && !eltwise_fwd_pd_t::eltwise_preserves_zero(
+                                e.eltwise)))
+            return false;
+    }
+    return true;
+}
+
+template <data_type_t src_type>
+status_t jit_uni_binary_t<src_type>::pd_t::init(engine_t *engine) {
+    using sm = primitive_attr_t::skip_mask_t;
+
+    const memory_desc_wrapper src0_d(src_md(0));
+    const memory_desc_wrapper src1_d(src_md(1));
+    const memory_desc_wrapper dst_d(dst_md());
+
+    bool ok = mayiuse(sve_512)
+            && utils::everyone_is(src_type, src_md(0)->data_type,
+                    src_md(1)->data_type, dst_md()->data_type)
+            && set_default_params() == status::success
+            && !has_zero_dim_memory() && src0_d == dst_d
+            && src0_d.is_dense(true) && src1_d.is_dense(true)
+            // the padded area is processed as well, so it has to stay zero
+            && IMPLICATION(src0_d.nelems(true) != src0_d.nelems(),
+                    alg_preserves_zero())
+            && attr()->has_default_values(sm::post_ops) && post_ops_ok()
+            && init_broadcast();
+    return ok ? status::success : status::unimplemented;
+}
+
+template <data_type_t src_type>
+jit_uni_binary_t<src_type>::jit_uni_binary_t(const pd_t *apd)
+    : primitive_t(apd) {}
+
+template <data_type_t src_type>
+jit_uni_binary_t<src_type>::~jit_uni_binary_t() = default;
+
+template <data_type_t src_type>
+status_t jit_uni_binary_t<src_type>::init(engine_t *engine) {
+    CHECK(safe_ptr_assign(kernel_,
+            new jit_uni_binary_kernel_t(pd(), pd()->bcast_rows_ > 0)));
+    return kernel_->create_kernel();
+}
+
+template <data_type_t src_type>
+status_t jit_uni_binary_t<src_type>::execute(const exec_ctx_t &ctx) const {
+    using data_t = typename prec_traits<src_type>::type;
+
+    const auto src0 = CTX_IN_MEM(const data_t *, DNNL_ARG_SRC_0);
+    const auto src1 = CTX_IN_MEM(const data_t *, DNNL_ARG_SRC_1);
+    auto dst = CTX_OUT_MEM(data_t *, DNNL_ARG_DST);
+
+    const memory_desc_wrapper src0_d(pd()->src_md(0));
+    const memory_desc_wrapper src1_d(pd()->src_md(1));
+    const int simd_w = cpu_isa_traits<sve_512>::vlen / sizeof(data_t);
+
+    if (pd()->bcast_rows_ > 0) {
+        const dim_t rows = pd()->bcast_rows_;
+        const dim_t row_len = pd()->bcast_row_len_;
+        parallel_nd(rows, [&](dim_t r) {
+            const dim_t off = src0_d.off_l(r * row_len);
+            jit_args_t args;
+            args.src0 = src0 + off;
+            args.src1 = src1 + src1_d.off_l(r);
+            args.dst = dst + off;
+            args.work_amount = row_len;
+            (*kernel_)(&args);
+        });
+        return status::success;
+    }
+
+    const dim_t nelems = src0_d.nelems(true);
+    const dim_t offset0 = src0_d.offset0();
+
+    parallel(0, [&](const int ithr, const int nthr) {
+        dim_t start {0}, end {0};
+
+        balance211(utils::div_up(nelems, simd_w), nthr, ithr, start, end);
+        start = nstl::min(nelems, start * simd_w);
+        end = nstl::min(nelems, end * simd_w);
+        if (start == end) return;
+
+        jit_args_t args;
+        args.src0 = src0 + offset0 + start;
+        args.src1 = src1 + offset0 + start;
+        args.dst = dst + offset0 + start;
+        args.work_amount = end - start;
+        (*kernel_)(&args);
+    });
+
+    return status::success;
+}
+
+template struct jit_uni_binary_t<data_type::f32>;
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
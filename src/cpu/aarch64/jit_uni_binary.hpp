@@ -0,0 +1,85 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_AARCH64_JIT_UNI_BINARY_HPP
+#define CPU_AARCH64_JIT_UNI_BINARY_HPP
+
+#include <assert.h>
+#include <memory>
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_binary_pd.hpp"
+
+#include "cpu/aarch64/cpu_isa_traits.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+struct jit_uni_binary_kernel_t;
+
+// Supports an operation on tensors of the same layout and a broadcast of
+// src1 along the trailing dimensions of a plain src0, e.g. NxCxHxW:NxCx1x1 or
+// NxCxHxW:1x1x1x1. The broadcast value is the same for a whole row of src0.
+template <data_type_t src_type>
+struct jit_uni_binary_t : public primitive_t {
+    struct pd_t : public cpu_binary_pd_t {
+        using cpu_binary_pd_t::cpu_binary_pd_t;
+
+        DECLARE_COMMON_PD_T(
+                JIT_IMPL_NAME_HELPER("jit:", sve_512, ""), jit_uni_binary_t);
+
+        status_t init(engine_t *engine);
+
+        // the number of rows of src0 with a single value of src1 and their
+        // length; zero rows mean the operation on the whole tensors
+        dim_t bcast_rows_ = 0;
+        dim_t bcast_row_len_ = 0;
+
+    private:
+        bool alg_preserves_zero() const {
+            using namespace alg_kind;
+            return utils::one_of(desc()->alg_kind, binary_add, binary_max,
+                    binary_min, binary_mul, binary_sub);
+        }
+        bool init_broadcast();
+        bool post_ops_ok() const;
+    };
+
+    jit_uni_binary_t(const pd_t *apd);
+    ~jit_uni_binary_t();
+
+    status_t init(engine_t *engine) override;
+
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    std::unique_ptr<jit_uni_binary_kernel_t> kernel_;
+};
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -0,0 +1,223 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/nstl.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/aarch64/injectors/jit_uni_eltwise_injector.hpp"
+#include "cpu/aarch64/jit_generator.hpp"
+#include "cpu/aarch64/jit_uni_eltwise.hpp"
+
+#define GET_OFF(field) static_cast<uint32_t>(offsetof(jit_args_t, field))
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+using namespace Xbyak_aarch64;
+
+struct jit_args_t {
+    const void *src;
+    void *dst;
+    size_t work_amount;
+};
+
+struct jit_uni_eltwise_kernel_t : public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_eltwise_kernel_t)
+
+    jit_uni_eltwise_kernel_t(const eltwise_pd_t *pd) : pd_(pd) {
+        const auto &desc = *pd_->desc();
+        // The predicates and the table register are shared by the injectors,
+        // the table address is reloaded before every injector is applied.
+        injectors_.emplace_back(new injector_t(this, desc.alg_kind,
+                desc.alpha, desc.beta, 1.f, false, x_table, p_all, p_tmp0));
+
+        const auto &po = pd_->attr()->post_ops_;
+        for (int i = 0; i < po.len(); i++)
+            injectors_.emplace_back(new injector_t(this, po.entry_[i].eltwise,
+                    false, x_table, p_all, p_tmp0));
+    }
+
+    void operator()(jit_args_t *p) { jit_generator::operator()(p); }
+
+private:
+    using injector_t = jit_uni_eltwise_injector_f32<sve_512>;
+    using TReg = typename cpu_isa_traits<sve_512>::Vmm;
+
+    static constexpr int vlen = cpu_isa_traits<sve_512>::vlen;
+    static constexpr int simd_w = vlen / sizeof(float);
+    // The injectors take the auxiliary registers right after the unrolled
+    // ones, so the unrolling has to leave up to 5 of them free.
+    static constexpr int unroll = 4;
+
+    const eltwise_pd_t *pd_;
+    std::vector<std::unique_ptr<injector_t>> injectors_;
+
+    const XReg reg_param = abi_param1;
+    const XReg reg_src = x1;
+    const XReg reg_dst = x2;
+    const XReg reg_work_amount = x3;
+    const XReg x_table = x21;
+
+    const PReg p_all = p1;
+    const PReg p_tmp0 = p2;
+    const PReg p_tail = p3;
+
+    void compute(size_t n_vecs) {
+        for (const auto &inj : injectors_) {
+            inj->load_table_addr();
+            inj->compute_vector_range(0, n_vecs);
+        }
+    }
+
+    void generate() override {
+        preamble();
+
+        ldr(reg_src, ptr(reg_param, GET_OFF(src)));
+        ldr(reg_dst, ptr(reg_param, GET_OFF(dst)));
+        ldr(reg_work_amount, ptr(reg_param, GET_OFF(work_amount)));
+        ptrue(p_all.s);
+
+        Label unroll_loop, tail_loop, exit;
+
+        L(unroll_loop);
+        {
+            cmp(reg_work_amount, unroll * simd_w);
+            b(LT, tail_loop);
+
+            for (int i = 0; i < unroll; i++)
+                ld1w(TReg(i), p_all / T_z, ptr(reg_src, i, MUL_VL));
+            compute(unroll);
+            for (int i = 0; i < unroll; i++)
+                st1w(TReg(i), p_all, ptr(reg_dst, i, MUL_VL));
+
+            add(reg_src, reg_src, unroll * vlen);
+            add(reg_dst, reg_dst, unroll * vlen);
+            sub(reg_work_amount, reg_work_amount, unroll * simd_w);
+            b(unroll_loop);
+        }
+
+        // The tail is processed one vector at a time, the last one is
+        // masked.
+        L(tail_loop);
+        {
+            cmp(reg_work_amount, 0);
+            b(LE, exit);
+
+            whilelt(p_tail.s, xzr, reg_work_amount);
+            ld1w(TReg(0), p_tail / T_z, ptr(reg_src));
+            compute(1);
+            st1w(TReg(0), p_tail, ptr(reg_dst));
+
+            add(reg_src, reg_src, vlen);
+            add(reg_dst, reg_dst, vlen);
+            sub(reg_work_amount, reg_work_amount, simd_w);
+            b(tail_loop);
+        }
+
+        L(exit);
+        postamble();
+
+        for (const auto &inj : injectors_)
+            inj->prepare_table();
+    }
+};
+
+template <cpu_isa_t isa, data_type_t d_type>
+status_t jit_uni_eltwise_fwd_t<isa, d_type>::pd_t::init(engine_t *engine) {
+    using sm = primitive_attr_t::skip_mask_t;
+
+    const memory_desc_wrapper data_d(src_md());
+
+    bool ok = mayiuse(isa) && is_fwd() && src_md()->data_type == d_type
+            && !has_zero_dim_memory() && data_d.is_dense(true)
+            && jit_uni_eltwise_injector_f32<isa>::is_supported(
+                    desc()->alg_kind)
+            // the padded area is processed as well, so it has to stay zero
+            && IMPLICATION(!data_d.is_dense(), is_zero_preserved())
+            && attr()->has_default_values(sm::post_ops) && post_ops_ok();
+    return ok ? status::success : status::unimplemented;
+}
+
+template <cpu_isa_t isa, data_type_t d_type>
+bool jit_uni_eltwise_fwd_t<isa, d_type>::pd_t::post_ops_ok() const {
+    const auto &po = attr()->post_ops_;
+    for (int i = 0; i < po.len(); i++) {
+        const auto &e = po.entry_[i];
+        if (!e.is_eltwise()
+                || !jit_uni_eltwise_injector_f32<isa>::is_supported(
+                        e.eltwise.alg)
+                || (!memory_desc_wrapper(src_md()).is_dense()
+                        && !eltwise_fwd_pd_t::eltwise_preserves_zero(
+                                e.eltwise)))
+            return false;
+    }
+    return true;
+}
+
+template <cpu_isa_t isa, data_type_t d_type>
+jit_uni_eltwise_fwd_t<isa, d_type>::jit_uni_eltwise_fwd_t(const pd_t *apd)
+    : primitive_t(apd) {}
+
+template <cpu_isa_t isa, data_type_t d_type>
+jit_uni_eltwise_fwd_t<isa, d_type>::~jit_uni_eltwise_fwd_t() = default;
+
+template <cpu_isa_t isa, data_type_t d_type>
+status_t jit_uni_eltwise_fwd_t<isa, d_type>::init(engine_t *engine) {
+    CHECK(safe_ptr_assign(kernel_, new jit_uni_eltwise_kernel_t(pd())));
+    return kernel_->create_kernel();
+}
+
+template <cpu_isa_t isa, data_type_t d_type>
+status_t jit_uni_eltwise_fwd_t<isa, d_type>::execute(
+        const exec_ctx_t &ctx) const {
+    auto src = CTX_IN_MEM(const data_t *, DNNL_ARG_SRC);
+    auto dst = CTX_OUT_MEM(data_t *, DNNL_ARG_DST);
+
+    const memory_desc_wrapper data_d(pd()->src_md());
+    const auto nelems = data_d.nelems(true);
+    const int simd_w = cpu_isa_traits<isa>::vlen / data_d.data_type_size();
+
+    src += data_d.offset0();
+    dst += data_d.offset0();
+
+    parallel(0, [&](const int ithr, const int nthr) {
+        dim_t start {0}, end {0};
+
+        balance211(utils::div_up(nelems, simd_w), nthr, ithr, start, end);
+        start = nstl::min(nelems, start * simd_w);
+        end = nstl::min(nelems, end * simd_w);
+        if (start == end) return;
+
+        jit_args_t args;
+        args.src = src + start;
+        args.dst = dst + start;
+        args.work_amount = end - start;
+        (*kernel_)(&args);
+    });
+
+    return status::success;
+}
+
+template struct jit_uni_eltwise_fwd_t<sve_512, data_type::f32>;
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -117,11 +117,11 @@ struct jit_uni_reorder_kernel_f32_t : public kernel_t, public jit_generator {
         using namespace data_type;
 
         bool ok = true && p.ndims > 0
-                && utils::one_of(p.itype, f32, s32, s8, u8)
-                && utils::one_of(p.otype, f32, s32, s8, u8)
+                && utils::one_of(p.itype, f32, bf16, s32, s8, u8)
+                && utils::one_of(p.otype, f32, bf16, s32, s8, u8)
                 && utils::everyone_is(0, p.ioff, p.ooff) /* do we need this? */
                 && utils::one_of(p.beta, 0.f, 1.f) /* anything else? */
-                && simple_impl_desc_init(p, nullptr) && mayiuse(sve_512);
+                && simple_impl_desc_init(p, nullptr) && isa_ok();
         if (!ok) return false;
 
         const ptrdiff_t max_stride = (1LL << 31) - 1;
@@ -136,6 +136,11 @@ struct jit_uni_reorder_kernel_f32_t : public kernel_t, public jit_generator {
         return true;
     }
 
+    /* The generic path works on the lower 128 bits of the vector registers,
+       hence it does not depend on the SVE vector length. The tr8x8 path is
+       written for 512-bit vectors and checks for sve_512 on its own. */
+    static bool isa_ok() { return mayiuse(sve_512) || mayiuse(sve_256); }
+
     int n(int d) {
         assert(d < prb_.ndims);
         return (int)prb_.nodes[d].n;
@@ -525,12 +530,16 @@ struct jit_uni_reorder_kernel_f32_t : public kernel_t, public jit_generator {
                               cvt_z_u8_s32(startIdx, regNum);
                               cvt_z_s32_f32(startIdx, regNum);
                               break;
+                          case bf16: cvt_v_bf16_f32(startIdx, regNum); break;
                           default: assert(!"unreachable");
                       }
                   };
         auto cvt2odt = [=](const int startIdx, const int regNum,
                                data_type_t odt, data_type_t idt) {
             switch (odt) {
+                case bf16:
+                    if (idt == f32) cvt_v_f32_bf16(startIdx, regNum);
+                    break;
                 case s32:
                     if (idt == f32)
                         cvt_z_f32_s32(startIdx, regNum);
@@ -556,7 +565,7 @@ struct jit_uni_reorder_kernel_f32_t : public kernel_t, public jit_generator {
         };
 
         /* check whether loading 4 values at once is possible */
-        bool can_load_xmm = mayiuse(sve_512) && reg_unroll % 4 == 0;
+        bool can_load_xmm = isa_ok() && reg_unroll % 4 == 0;
         for (int ur = 1; ur < reg_unroll; ++ur)
             if (i_off[ur] != i_off[ur - 1] + 1) can_load_xmm = false;
         const int load_step = can_load_xmm ? 4 : 1;
@@ -569,6 +578,7 @@ struct jit_uni_reorder_kernel_f32_t : public kernel_t, public jit_generator {
 
         const bool interim_f32 = false
                 || utils::one_of(f32, prb_.itype, prb_.otype)
+                || utils::one_of(bf16, prb_.itype, prb_.otype)
                 || prb_.scale_type != scale_type_t::NONE || prb_.beta != 0.f;
 
         const bool need_saturation
@@ -850,6 +860,8 @@ struct jit_uni_reorder_kernel_f32_t : public kernel_t, public jit_generator {
                         for (int i = 0; i < count; i++) {
                             if (prb_.otype == s32) {
                                 ldr(SReg(tmp_vec_idx[i]), ptr(x_tmp_vec[i]));
+                            } else if (prb_.otype == bf16) {
+                                ldr(HReg(tmp_vec_idx[i]), ptr(x_tmp_vec[i]));
                             } else if (utils::one_of(prb_.otype, s8, u8)) {
                                 ldr(BReg(tmp_vec_idx[i]), ptr(x_tmp_vec[i]));
                             } else {
@@ -1139,6 +1151,40 @@ struct jit_uni_reorder_kernel_f32_t : public kernel_t, public jit_generator {
             smax(ZRegB(i), 0);
     }
 
+    /* bf16 is the upper half of f32: the conversions work on the 4 values
+       in the lower 128 bits of the registers, as the generic path does. */
+    void cvt_v_bf16_f32(const int startIdx, const int regNum) {
+        for (int i = startIdx; i < startIdx + regNum; i++)
+            shll(VReg4S(i), VReg4H(i), 16);
+    }
+
+    /* Round to nearest even with integer arithmetic, as the bf16 extension
+       is not available on every SVE core, and keep NaNs quiet. */
+    void cvt_v_f32_bf16(const int startIdx, const int regNum) {
+        const VReg4S v_one(z_tmp1.getIdx());
+        const VReg4S v_bias(z_tmp2.getIdx());
+        const VReg4S v_round(z_tmp3.getIdx());
+        const VReg4S v_not_nan(z_tmp4.getIdx());
+
+        movi(v_one, 1);
+        mov_imm(W_TMP_0, 0x7fff);
+        dup(v_bias, W_TMP_0);
+        for (int i = startIdx; i < startIdx + regNum; i++) {
+            const VReg4S v(i);
+            /* round = x + 0x7fff + ((x >> 16) & 1) */
+            ushr(v_round, v, 16);
+            and_(VReg16B(v_round.getIdx()), VReg16B(v_round.getIdx()),
+                    VReg16B(v_one.getIdx()));
+            add(v_round, v_round, v);
+            add(v_round, v_round, v_bias);
+            fcmeq(v_not_nan, v, v);
+            orr(v, 0x40, LSL, 16);
+            bit(VReg16B(i), VReg16B(v_round.getIdx()),
+                    VReg16B(v_not_nan.getIdx()));
+            shrn(VReg4H(i), v, 16);
+        }
+    }
+
     jit_uni_reorder_kernel_f32_t(const desc_t &desc) : kernel_t(desc) {
         itype_sz = data_type_size(prb_.itype);
         otype_sz = data_type_size(prb_.otype);
@@ -1178,7 +1224,7 @@ struct jit_uni_reorder_kernel_f32_t : public kernel_t, public jit_generator {
                 mov_imm(reg_tmp, 0x7f7f7f7f7f7f7f7f);
                 mov(VReg4S(ymm_8x127b.getIdx())[0], WReg(reg_tmp.getIdx()));
             }
-        } else if (mayiuse(sve_512)) {
+        } else if (isa_ok()) {
             movi(xmm_zero, 0);
 
             if (prb_.itype == data_type::u8 && prb_.otype == data_type::s8) {
@@ -1630,6 +1676,12 @@ status_t jit_uni_reorder_create(reorder_pd_t **reorder_pd, engine_t *engine,
         const primitive_attr_t *attr, engine_t *src_engine,
         const memory_desc_t *src_md, engine_t *dst_engine,
         const memory_desc_t *dst_md) {
+    // leave tiny reorders to the simple implementations, which do not need
+    // any code generation at creation time
+    if (is_small_reorder(src_md) && attr->has_default_values()
+            && dst_md->extra.flags == memory_extra_flags::none)
+        return status::unimplemented;
+
     auto ret = jit_uni_reorder_t::pd_t::create(
             reorder_pd, engine, attr, src_engine, src_md, dst_engine, dst_md);
     return ret;
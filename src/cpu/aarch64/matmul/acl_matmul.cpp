@@ -0,0 +1,158 @@
+/*******************************************************************************
+* Copyright 2020 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dnnl/dnnl_types.h"
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+#include "cpu/aarch64/matmul/acl_matmul.hpp"
+
+#include <cstring>
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+namespace matmul {
+
+using namespace dnnl::impl::status;
+using namespace dnnl::impl::memory_tracking::names;
+using namespace dnnl::impl::utils;
+
+status_t acl_matmul_t::pd_t::init_conf() {
+    using namespace format_tag;
+
+    const int ndims = dst_md_.ndims;
+    const int batch_ndims = ndims - 2;
+
+    // Compute Library GEMM has no transposition flags, so all the tensors
+    // have to be row-major. The batch is supported only when the weights
+    // are shared by all the matrices, in which case it is folded into M.
+    const auto plain_tag = pick(batch_ndims, ab, abc, abcd, abcde, abcdef);
+    for (auto md : {&src_md_, &weights_md_, &dst_md_})
+        if (!memory_desc_matches_tag(*md, plain_tag))
+            return status::unimplemented;
+    if (array_product(weights_md_.dims, batch_ndims) != 1)
+        return status::unimplemented;
+
+    amp_.with_bias = with_bias();
+    if (amp_.with_bias && !memory_desc_matches_tag(bias_md_, plain_tag))
+        return status::unimplemented;
+
+    const int m = batch() * M();
+    const int n = N();
+    const int k = K();
+    const auto acl_data_t = arm_compute::DataType::F32;
+
+    // clang-format off
+    amp_.src_info = arm_compute::TensorInfo(
+            arm_compute::TensorShape(k, m), 1, acl_data_t);
+    amp_.wei_info = arm_compute::TensorInfo(
+            arm_compute::TensorShape(n, k), 1, acl_data_t);
+    amp_.bia_info = arm_compute::TensorInfo(
+            amp_.with_bias ? arm_compute::TensorShape(n)
+                           : arm_compute::TensorShape(),
+            1, acl_data_t);
+    amp_.dst_info = arm_compute::TensorInfo(
+            arm_compute::TensorShape(n, m), 1, acl_data_t);
+    // clang-format on
+
+    // oneDNN applies the output scale after the bias:
+    // dst = eltwise(scale * (src * wei + bias)), Compute Library computes
+    // dst = act(alpha * src * wei + beta * bias)
+    const float scale = attr()->output_scales_.scales_[0];
+    amp_.alpha = scale;
+    amp_.beta = scale;
+
+    // The weights are allowed to change between the executions, so they are
+    // reshaped on every run
+    // clang-format off
+    amp_.gemm_info = arm_compute::GEMMInfo(
+            false, // is_a_reshaped
+            false, // is_b_reshaped
+            false, // reshape_b_only_on_first_run
+            0, // depth_output_gemm3d
+            false, // reinterpret_input_as_3d
+            false, // retain_internal_weights
+            arm_compute::GEMMLowpOutputStageInfo(),
+            false, // fp_mixed_precision
+            amp_.with_bias, // broadcast_bias
+            acl_convolution_utils::get_acl_act(*attr()));
+
+    // Validate GEMM manually to check for return status
+    auto acl_st = arm_compute::NEGEMM::validate(
+        &amp_.src_info,
+        &amp_.wei_info,
+        amp_.with_bias ? &amp_.bia_info : nullptr,
+        &amp_.dst_info,
+        amp_.alpha,
+        amp_.beta,
+        amp_.gemm_info);
+    // clang-format on
+    if (acl_st.error_code() != arm_compute::ErrorCode::OK) {
+        return status::unimplemented;
+    }
+
+    return status::success;
+}
+
+status_t acl_matmul_t::execute_forward(const exec_ctx_t &ctx) const {
+    status_t status = status::success;
+    auto src_base = CTX_IN_MEM(const data_t *, DNNL_ARG_SRC);
+    auto wei_base = CTX_IN_MEM(const data_t *, DNNL_ARG_WEIGHTS);
+    auto bia_base = CTX_IN_MEM(const data_t *, DNNL_ARG_BIAS);
+    auto dst_base = CTX_OUT_MEM(data_t *, DNNL_ARG_DST);
+
+    bool with_bias = pd()->amp_.with_bias;
+
+    std::lock_guard<std::mutex> lock(mtx_);
+
+    // Retrieve primitive resource and configured Compute Library objects
+    auto *acl_resource
+            = ctx.get_resource_mapper()->get<acl_matmul_resource_t>(this);
+    acl_obj_t<arm_compute::NEGEMM> &acl_obj = acl_resource->get_acl_obj();
+
+    acl_obj.src_tensor.allocator()->import_memory(
+            const_cast<data_t *>(src_base));
+    acl_obj.wei_tensor.allocator()->import_memory(
+            const_cast<data_t *>(wei_base));
+    acl_obj.dst_tensor.allocator()->import_memory(dst_base);
+
+    // Retrieve extra bias memory from the scratchpad and copy from user memory
+    if (with_bias) {
+        const auto scratchpad = ctx.get_scratchpad_grantor();
+        auto *bia_memory = scratchpad.get<data_t>(key_none);
+        std::memcpy(bia_memory, bia_base, pd()->N() * sizeof(data_t));
+        acl_obj.bia_tensor.allocator()->import_memory(bia_memory);
+    }
+
+    acl_obj.conv.run();
+
+    acl_obj.src_tensor.allocator()->free();
+    acl_obj.wei_tensor.allocator()->free();
+    acl_obj.dst_tensor.allocator()->free();
+    if (with_bias) { acl_obj.bia_tensor.allocator()->free(); }
+
+    return status;
+}
+
+} // namespace matmul
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,188 @@
+/*******************************************************************************
+* Copyright 2020 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_AARCH64_MATMUL_ACL_MATMUL_HPP
+#define CPU_AARCH64_MATMUL_ACL_MATMUL_HPP
+
+#include <mutex>
+
+#include "common/c_types_map.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/primitive.hpp"
+
+#include "cpu/aarch64/acl_convolution_utils.hpp"
+
+#include "cpu/matmul/cpu_matmul_pd.hpp"
+
+#include "arm_compute/runtime/NEON/NEFunctions.h"
+#include "arm_compute/runtime/Scheduler.h"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+namespace matmul {
+
+struct acl_matmul_conf_t {
+    bool with_bias;
+    arm_compute::TensorInfo src_info;
+    arm_compute::TensorInfo wei_info;
+    arm_compute::TensorInfo bia_info;
+    arm_compute::TensorInfo dst_info;
+    arm_compute::GEMMInfo gemm_info;
+    float alpha;
+    float beta;
+};
+
+struct acl_matmul_resource_t : public resource_t {
+    acl_matmul_resource_t()
+        : acl_obj_(utils::make_unique<acl_obj_t<arm_compute::NEGEMM>>()) {}
+
+    status_t configure(const acl_matmul_conf_t &amp) {
+        if (!acl_obj_) return status::out_of_memory;
+
+        // Init Compute Library tensors based on info from descriptor
+        acl_obj_->src_tensor.allocator()->init(amp.src_info);
+        acl_obj_->wei_tensor.allocator()->init(amp.wei_info);
+        acl_obj_->dst_tensor.allocator()->init(amp.dst_info);
+        acl_obj_->bia_tensor.allocator()->init(amp.bia_info);
+
+        // clang-format off
+        acl_obj_->conv.configure(
+            &acl_obj_->src_tensor,
+            &acl_obj_->wei_tensor,
+            amp.with_bias ? &acl_obj_->bia_tensor : nullptr,
+            &acl_obj_->dst_tensor,
+            amp.alpha,
+            amp.beta,
+            amp.gemm_info);
+        // clang-format on
+
+        return status::success;
+    }
+
+    acl_obj_t<arm_compute::NEGEMM> &get_acl_obj() const { return *acl_obj_; }
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(acl_matmul_resource_t);
+
+private:
+    std::unique_ptr<acl_obj_t<arm_compute::NEGEMM>> acl_obj_;
+
+}; // acl_matmul_resource_t
+
+struct acl_matmul_t : public primitive_t {
+    struct pd_t : public ::dnnl::impl::cpu::matmul::cpu_matmul_pd_t {
+        using ::dnnl::impl::cpu::matmul::cpu_matmul_pd_t::cpu_matmul_pd_t;
+
+        DECLARE_COMMON_PD_T("gemm:acl", acl_matmul_t, USE_GLOBAL_SCRATCHPAD);
+
+        status_t init(engine_t *engine) {
+            using namespace data_type;
+            using smask_t = primitive_attr_t::skip_mask_t;
+
+            bool ok = src_md()->data_type == f32
+                    && weights_md()->data_type == f32
+                    && desc()->accum_data_type == f32
+                    && dst_md()->data_type == f32
+                    && IMPLICATION(with_bias(),
+                            weights_md(1)->data_type == f32 && is_bias_1xN())
+                    && !has_zero_dim_memory() && !has_runtime_dims_or_strides()
+                    && attr()->has_default_values(
+                            smask_t::oscale | smask_t::post_ops)
+                    && attr()->output_scales_.mask_ == 0 && post_ops_ok()
+                    && set_default_formats();
+            if (!ok) return status::unimplemented;
+
+            if (init_conf() != status::success) return status::unimplemented;
+
+            // Number of threads in Compute Library is set by OMP_NUM_THREADS
+            // dnnl_get_max_threads() == OMP_NUM_THREADS
+            arm_compute::Scheduler::get().set_num_threads(
+                    dnnl_get_max_threads());
+
+            // The same as for the convolutions, the biases are passed to
+            // Compute Library through the scratchpad
+            if (amp_.with_bias) {
+                auto scratchpad = scratchpad_registry().registrar();
+                scratchpad.template book<float>(
+                        memory_tracking::names::key_none, N());
+            }
+
+            return status::success;
+        }
+
+        acl_matmul_conf_t amp_;
+
+    protected:
+        status_t init_conf();
+
+        bool post_ops_ok() const {
+            auto const &po = attr()->post_ops_;
+            auto is_eltwise
+                    = [&](int idx) { return po.entry_[idx].is_eltwise(); };
+
+            bool eltwise_ok = false;
+            // Compute Library supports only one eltwise post-op
+            if (po.len() == 1 && is_eltwise(0)) {
+                const auto act_type = po.entry_[0].eltwise.alg;
+                eltwise_ok = acl_convolution_utils::acl_act_ok(act_type);
+            }
+
+            return eltwise_ok || (po.len() == 0);
+        }
+    };
+
+    acl_matmul_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t create_resource(
+            engine_t *engine, resource_mapper_t &mapper) const override {
+        if (mapper.has_resource(this)) return status::success;
+
+        auto r = utils::make_unique<acl_matmul_resource_t>();
+        if (!r) return status::out_of_memory;
+
+        // Configure the resource based on information from primitive descriptor
+        auto st = r->configure(pd()->amp_);
+        if (st == status::success) { mapper.add(this, std::move(r)); }
+
+        return st;
+    }
+
+    typedef prec_traits<data_type::f32>::type data_t;
+
+    status_t execute(const exec_ctx_t &ctx) const override {
+        return execute_forward(ctx);
+    }
+
+private:
+    status_t execute_forward(const exec_ctx_t &ctx) const;
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    // The Compute Library function and its tensors are configured once and
+    // kept in the primitive resource, so that the weights are reshaped only
+    // on the first run. The tensors are shared by all the executions
+    // of the primitive, hence the executions are serialized.
+    mutable std::mutex mtx_;
+
+}; // acl_matmul_t
+
+} // namespace matmul
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -26,6 +26,20 @@ namespace cpu {
 
 struct cpu_batch_normalization_fwd_pd_t : public batch_normalization_fwd_pd_t {
     using batch_normalization_fwd_pd_t::batch_normalization_fwd_pd_t;
+
+protected:
+    // Common output scale followed by a single eltwise post-op. Both are
+    // applied to the normalized values before the conversion to the
+    // destination data type, e.g. to requantize an int8 destination.
+    bool attr_oscale_and_eltwise_ok() const {
+        using sm = primitive_attr_t::skip_mask_t;
+        const auto &po = attr()->post_ops_;
+        return attr()->has_default_values(sm::oscale | sm::post_ops)
+                && attr()->output_scales_.mask_ == 0
+                && attr()->output_scales_.defined()
+                && IMPLICATION(po.len() > 0,
+                        po.len() == 1 && po.entry_[0].is_eltwise());
+    }
 };
 
 struct cpu_batch_normalization_bwd_pd_t : public batch_normalization_bwd_pd_t {
@@ -28,14 +28,19 @@
 #include "cpu/ref_convolution.hpp"
 #include "cpu/ref_fused_convolution.hpp"
 
-#if DNNL_AARCH64 && DNNL_AARCH64_USE_ACL
+#if DNNL_AARCH64
+#include "cpu/aarch64/jit_sve_512_convolution.hpp"
+#if DNNL_AARCH64_USE_ACL
+#include "cpu/aarch64/acl_depthwise_convolution.hpp"
 #include "cpu/aarch64/acl_gemm_convolution.hpp"
 #include "cpu/aarch64/acl_winograd_convolution.hpp"
+#endif
 using namespace dnnl::impl::cpu::aarch64;
 #endif
 
 #if DNNL_X64
 #include "cpu/x64/gemm_bf16_convolution.hpp"
+#include "cpu/x64/gemm_f32_wino_conv_4x3.hpp"
 #include "cpu/x64/jit_avx2_1x1_convolution.hpp"
 #include "cpu/x64/jit_avx2_convolution.hpp"
 #include "cpu/x64/jit_avx512_common_1x1_convolution.hpp"
@@ -43,6 +48,7 @@ using namespace dnnl::impl::cpu::aarch64;
 #include "cpu/x64/jit_avx512_common_convolution_winograd.hpp"
 #include "cpu/x64/jit_avx512_core_amx_1x1_convolution.hpp"
 #include "cpu/x64/jit_avx512_core_amx_convolution.hpp"
+#include "cpu/x64/jit_brgemm_conv.hpp"
 #include "cpu/x64/jit_avx512_core_bf16_1x1_convolution.hpp"
 #include "cpu/x64/jit_avx512_core_bf16_convolution.hpp"
 #include "cpu/x64/jit_avx512_core_f32_wino_conv_2x3.hpp"
@@ -53,6 +59,7 @@ using namespace dnnl::impl::cpu::aarch64;
 #include "cpu/x64/jit_sse41_1x1_convolution.hpp"
 #include "cpu/x64/jit_sse41_convolution.hpp"
 #include "cpu/x64/jit_uni_dw_convolution.hpp"
+#include "cpu/x64/jit_uni_group_convolution.hpp"
 #include "cpu/x64/jit_uni_x8s8s32x_1x1_convolution.hpp"
 #include "cpu/x64/jit_uni_x8s8s32x_convolution.hpp"
 using namespace dnnl::impl::cpu::x64;
@@ -91,19 +98,25 @@ const std::map<conv_impl_key_t, std::vector<pd_create_f>> impl_list_map {
     // FWD fp
     {{forward, f32, f32, f32}, {
         CPU_INSTANCE_X64(jit_avx512_common_dw_convolution_fwd_t)
+        CPU_INSTANCE_X64(jit_uni_group_convolution_fwd_t<avx512_common>)
         CPU_INSTANCE_X64(jit_avx512_common_1x1_convolution_fwd_f32_t)
+        CPU_INSTANCE_X64(brgemm_convolution_fwd_t<avx512_core>)
         CPU_INSTANCE_X64(jit_avx512_core_f32_wino_conv_2x3_fwd_t)
         CPU_INSTANCE_X64(jit_avx512_core_f32_wino_conv_4x3_fwd_t)
         CPU_INSTANCE_X64(jit_avx512_common_convolution_winograd_fwd_t)
         CPU_INSTANCE_X64(jit_avx512_common_convolution_fwd_t<f32>)
+        CPU_INSTANCE_AARCH64_ACL(acl_depthwise_convolution_fwd_t<f32>)
         CPU_INSTANCE_AARCH64_ACL(acl_wino_convolution_fwd_t)
         CPU_INSTANCE_X64(jit_avx2_dw_convolution_fwd_t)
+        CPU_INSTANCE_X64(jit_uni_group_convolution_fwd_t<avx2>)
         CPU_INSTANCE_X64(jit_avx2_1x1_convolution_fwd_t)
         CPU_INSTANCE_X64(jit_sse41_dw_convolution_fwd_t)
         CPU_INSTANCE_X64(jit_sse41_1x1_convolution_fwd_t)
+        CPU_INSTANCE_X64(gemm_f32_wino_conv_4x3_fwd_t)
         CPU_INSTANCE_X64(jit_avx2_convolution_fwd_t)
         CPU_INSTANCE_X64(jit_sse41_convolution_fwd_t)
         CPU_INSTANCE_AARCH64_ACL(acl_gemm_convolution_fwd_t<f32>)
+        CPU_INSTANCE_AARCH64(jit_sve_512_convolution_fwd_t)
         CPU_INSTANCE(gemm_convolution_fwd_t)
         CPU_INSTANCE(ref_convolution_fwd_t<f32>)
         CPU_INSTANCE(ref_fused_convolution_fwd_t)
@@ -112,8 +125,10 @@ const std::map<conv_impl_key_t, std::vector<pd_create_f>> impl_list_map {
     {{forward, bf16, bf16, f32}, {
         CPU_INSTANCE_X64(jit_avx512_core_amx_1x1_convolution_fwd_t<bf16, bf16, f32>)
         CPU_INSTANCE_X64(jit_avx512_core_amx_convolution_fwd_t<bf16, bf16, f32>)
+        CPU_INSTANCE_X64(brgemm_convolution_fwd_t<avx512_core_bf16_amx_bf16>)
         CPU_INSTANCE_X64(jit_uni_dw_convolution_fwd_t<avx512_core, bf16, f32>)
         CPU_INSTANCE_X64(jit_avx512_core_bf16_1x1_convolution_fwd_t<f32>)
+        CPU_INSTANCE_X64(brgemm_convolution_fwd_t<avx512_core_bf16>)
         CPU_INSTANCE_X64(jit_avx512_core_bf16_convolution_fwd_t)
         CPU_INSTANCE_X64(gemm_bf16_convolution_fwd_t<f32>)
         CPU_INSTANCE(ref_convolution_fwd_t<bf16, bf16, f32, f32>)
@@ -122,14 +137,24 @@ const std::map<conv_impl_key_t, std::vector<pd_create_f>> impl_list_map {
     {{forward, bf16, bf16, bf16}, {
         CPU_INSTANCE_X64(jit_avx512_core_amx_1x1_convolution_fwd_t<bf16, bf16, bf16>)
         CPU_INSTANCE_X64(jit_avx512_core_amx_convolution_fwd_t<bf16, bf16, bf16>)
+        CPU_INSTANCE_X64(brgemm_convolution_fwd_t<avx512_core_bf16_amx_bf16>)
         CPU_INSTANCE_X64(jit_uni_dw_convolution_fwd_t<avx512_core, bf16, bf16>)
         CPU_INSTANCE_X64(jit_avx512_core_bf16_1x1_convolution_fwd_t<bf16>)
+        CPU_INSTANCE_X64(brgemm_convolution_fwd_t<avx512_core_bf16>)
         CPU_INSTANCE_X64(jit_avx512_core_bf16_convolution_fwd_t)
         CPU_INSTANCE_X64(gemm_bf16_convolution_fwd_t<bf16>)
         CPU_INSTANCE(ref_convolution_fwd_t<bf16, bf16, bf16, f32>)
         CPU_INSTANCE(ref_fused_convolution_fwd_t)
         nullptr,
     }},
+    {{forward, f16, f16, f32}, {
+        CPU_INSTANCE(ref_convolution_fwd_t<f16, f16, f32, f32>)
+        nullptr,
+    }},
+    {{forward, f16, f16, f16}, {
+        CPU_INSTANCE(ref_convolution_fwd_t<f16, f16, f16, f32>)
+        nullptr,
+    }},
     // BWD_D fp
     {{backward_data, f32, f32, f32}, {
         CPU_INSTANCE_X64(jit_avx512_common_dw_convolution_bwd_data_t)
@@ -147,6 +172,7 @@ const std::map<conv_impl_key_t, std::vector<pd_create_f>> impl_list_map {
     }},
     {{backward_data, f32, bf16, bf16}, {
         CPU_INSTANCE_X64(jit_uni_dw_convolution_bwd_data_t<avx512_core, bf16, f32>)
+        CPU_INSTANCE_X64(jit_avx512_core_amx_convolution_bwd_data_t)
         CPU_INSTANCE_X64(jit_avx512_core_bf16_1x1_convolution_bwd_data_t<f32>)
         CPU_INSTANCE_X64(jit_avx512_core_bf16_convolution_bwd_data_t)
         CPU_INSTANCE_X64(gemm_bf16_convolution_bwd_data_t<f32>)
@@ -155,6 +181,7 @@ const std::map<conv_impl_key_t, std::vector<pd_create_f>> impl_list_map {
     }},
     {{backward_data, bf16, bf16, bf16}, {
         CPU_INSTANCE_X64(jit_uni_dw_convolution_bwd_data_t<avx512_core, bf16, bf16>)
+        CPU_INSTANCE_X64(jit_avx512_core_amx_convolution_bwd_data_t)
         CPU_INSTANCE_X64(jit_avx512_core_bf16_1x1_convolution_bwd_data_t<bf16>)
         CPU_INSTANCE_X64(jit_avx512_core_bf16_convolution_bwd_data_t)
         CPU_INSTANCE_X64(gemm_bf16_convolution_bwd_data_t<bf16>)
@@ -178,6 +205,7 @@ const std::map<conv_impl_key_t, std::vector<pd_create_f>> impl_list_map {
     }},
     {{backward_weights, bf16, f32, bf16}, {
         CPU_INSTANCE_X64(jit_uni_dw_convolution_bwd_weights_t<avx512_core, bf16, f32>)
+        CPU_INSTANCE_X64(jit_avx512_core_amx_convolution_bwd_weights_t)
         CPU_INSTANCE_X64(jit_avx512_core_bf16_1x1_convolution_bwd_weights_t<f32>)
         CPU_INSTANCE_X64(jit_avx512_core_bf16_convolution_bwd_weights_t)
         CPU_INSTANCE_X64(gemm_bf16_convolution_bwd_weights_t<f32>)
@@ -186,6 +214,7 @@ const std::map<conv_impl_key_t, std::vector<pd_create_f>> impl_list_map {
     }},
     {{backward_weights, bf16, bf16, bf16}, {
         CPU_INSTANCE_X64(jit_uni_dw_convolution_bwd_weights_t<avx512_core, bf16, bf16>)
+        CPU_INSTANCE_X64(jit_avx512_core_amx_convolution_bwd_weights_t)
         CPU_INSTANCE_X64(jit_avx512_core_bf16_1x1_convolution_bwd_weights_t<bf16>)
         CPU_INSTANCE_X64(jit_avx512_core_bf16_convolution_bwd_weights_t)
         CPU_INSTANCE_X64(gemm_bf16_convolution_bwd_weights_t<bf16>)
@@ -196,7 +225,9 @@ const std::map<conv_impl_key_t, std::vector<pd_create_f>> impl_list_map {
     {{forward, s8, s8, f32}, {
         CPU_INSTANCE_X64(jit_avx512_core_amx_1x1_convolution_fwd_t<s8, s8, f32>)
         CPU_INSTANCE_X64(jit_avx512_core_amx_convolution_fwd_t<s8, s8, f32>)
+        CPU_INSTANCE_X64(brgemm_convolution_fwd_t<avx512_core_bf16_amx_int8>)
         CPU_INSTANCE_X64(jit_avx512_core_x8s8s32x_1x1_convolution_fwd_t<s8, f32>)
+        CPU_INSTANCE_X64(brgemm_convolution_fwd_t<avx512_core_vnni>)
         CPU_INSTANCE_X64(jit_avx512_core_x8s8s32x_convolution_fwd_t<s8, f32>)
         CPU_INSTANCE_X64(jit_uni_x8s8s32x_1x1_convolution_fwd_t<avx2, s8, f32>)
         CPU_INSTANCE_X64(jit_uni_x8s8s32x_convolution_fwd_t<avx2, s8, f32>)
@@ -210,7 +241,9 @@ const std::map<conv_impl_key_t, std::vector<pd_create_f>> impl_list_map {
     {{forward, s8, s8, s32}, {
         CPU_INSTANCE_X64(jit_avx512_core_amx_1x1_convolution_fwd_t<s8, s8, s32>)
         CPU_INSTANCE_X64(jit_avx512_core_amx_convolution_fwd_t<s8, s8, s32>)
+        CPU_INSTANCE_X64(brgemm_convolution_fwd_t<avx512_core_bf16_amx_int8>)
         CPU_INSTANCE_X64(jit_avx512_core_x8s8s32x_1x1_convolution_fwd_t<s8, s32>)
+        CPU_INSTANCE_X64(brgemm_convolution_fwd_t<avx512_core_vnni>)
         CPU_INSTANCE_X64(jit_avx512_core_x8s8s32x_convolution_fwd_t<s8, s32>)
         CPU_INSTANCE_X64(jit_uni_x8s8s32x_1x1_convolution_fwd_t<avx2, s8, s32>)
         CPU_INSTANCE_X64(jit_uni_x8s8s32x_convolution_fwd_t<avx2, s8, s32>)
@@ -224,12 +257,15 @@ const std::map<conv_impl_key_t, std::vector<pd_create_f>> impl_list_map {
     {{forward, s8, s8, s8}, {
         CPU_INSTANCE_X64(jit_avx512_core_amx_1x1_convolution_fwd_t<s8, s8, s8>)
         CPU_INSTANCE_X64(jit_avx512_core_amx_convolution_fwd_t<s8, s8, s8>)
+        CPU_INSTANCE_X64(brgemm_convolution_fwd_t<avx512_core_bf16_amx_int8>)
         CPU_INSTANCE_X64(jit_avx512_core_x8s8s32x_1x1_convolution_fwd_t<s8, s8>)
+        CPU_INSTANCE_X64(brgemm_convolution_fwd_t<avx512_core_vnni>)
         CPU_INSTANCE_X64(jit_avx512_core_x8s8s32x_convolution_fwd_t<s8, s8>)
         CPU_INSTANCE_X64(jit_uni_x8s8s32x_1x1_convolution_fwd_t<avx2, s8, s8>)
         CPU_INSTANCE_X64(jit_uni_x8s8s32x_convolution_fwd_t<avx2, s8, s8>)
         CPU_INSTANCE_X64(jit_uni_x8s8s32x_1x1_convolution_fwd_t<sse41, s8, s8>)
         CPU_INSTANCE_X64(jit_uni_x8s8s32x_convolution_fwd_t<sse41, s8, s8>)
+        CPU_INSTANCE_AARCH64_ACL(acl_depthwise_convolution_fwd_t<s8, s8, s8, s32>)
         CPU_INSTANCE_AARCH64_ACL(acl_gemm_convolution_fwd_t<s8, s8, s8, s32>)
         CPU_INSTANCE(_gemm_x8s8s32x_convolution_fwd_t<s8, s8>)
         CPU_INSTANCE(ref_convolution_fwd_t<s8, s8, s8, s32>)
@@ -239,7 +275,9 @@ const std::map<conv_impl_key_t, std::vector<pd_create_f>> impl_list_map {
     {{forward, s8, s8, u8}, {
         CPU_INSTANCE_X64(jit_avx512_core_amx_1x1_convolution_fwd_t<s8, s8, u8>)
         CPU_INSTANCE_X64(jit_avx512_core_amx_convolution_fwd_t<s8, s8, u8>)
+        CPU_INSTANCE_X64(brgemm_convolution_fwd_t<avx512_core_bf16_amx_int8>)
         CPU_INSTANCE_X64(jit_avx512_core_x8s8s32x_1x1_convolution_fwd_t<s8, u8>)
+        CPU_INSTANCE_X64(brgemm_convolution_fwd_t<avx512_core_vnni>)
         CPU_INSTANCE_X64(jit_avx512_core_x8s8s32x_convolution_fwd_t<s8, u8>)
         CPU_INSTANCE_X64(jit_uni_x8s8s32x_1x1_convolution_fwd_t<avx2, s8, u8>)
         CPU_INSTANCE_X64(jit_uni_x8s8s32x_convolution_fwd_t<avx2, s8, u8>)
@@ -254,8 +292,10 @@ const std::map<conv_impl_key_t, std::vector<pd_create_f>> impl_list_map {
     {{forward, u8, s8, f32}, {
         CPU_INSTANCE_X64(jit_avx512_core_amx_1x1_convolution_fwd_t<u8, s8, f32>)
         CPU_INSTANCE_X64(jit_avx512_core_amx_convolution_fwd_t<u8, s8, f32>)
+        CPU_INSTANCE_X64(brgemm_convolution_fwd_t<avx512_core_bf16_amx_int8>)
         CPU_INSTANCE_X64(jit_avx512_core_u8s8s32x_wino_convolution_fwd_t<f32>)
         CPU_INSTANCE_X64(jit_avx512_core_x8s8s32x_1x1_convolution_fwd_t<u8, f32>)
+        CPU_INSTANCE_X64(brgemm_convolution_fwd_t<avx512_core_vnni>)
         CPU_INSTANCE_X64(jit_avx512_core_x8s8s32x_convolution_fwd_t<u8, f32>)
         CPU_INSTANCE_X64(jit_uni_x8s8s32x_1x1_convolution_fwd_t<avx2, u8, f32>)
         CPU_INSTANCE_X64(jit_uni_x8s8s32x_convolution_fwd_t<avx2, u8, f32>)
@@ -268,8 +308,10 @@ const std::map<conv_impl_key_t, std::vector<pd_create_f>> impl_list_map {
     {{forward, u8, s8, s32}, {
         CPU_INSTANCE_X64(jit_avx512_core_amx_1x1_convolution_fwd_t<u8, s8, s32>)
         CPU_INSTANCE_X64(jit_avx512_core_amx_convolution_fwd_t<u8, s8, s32>)
+        CPU_INSTANCE_X64(brgemm_convolution_fwd_t<avx512_core_bf16_amx_int8>)
         CPU_INSTANCE_X64(jit_avx512_core_u8s8s32x_wino_convolution_fwd_t<s32>)
         CPU_INSTANCE_X64(jit_avx512_core_x8s8s32x_1x1_convolution_fwd_t<u8, s32>)
+        CPU_INSTANCE_X64(brgemm_convolution_fwd_t<avx512_core_vnni>)
         CPU_INSTANCE_X64(jit_avx512_core_x8s8s32x_convolution_fwd_t<u8, s32>)
         CPU_INSTANCE_X64(jit_uni_x8s8s32x_1x1_convolution_fwd_t<avx2, u8, s32>)
         CPU_INSTANCE_X64(jit_uni_x8s8s32x_convolution_fwd_t<avx2, u8, s32>)
@@ -282,8 +324,10 @@ const std::map<conv_impl_key_t, std::vector<pd_create_f>> impl_list_map {
     {{forward, u8, s8, s8}, {
         CPU_INSTANCE_X64(jit_avx512_core_amx_1x1_convolution_fwd_t<u8, s8, s8>)
         CPU_INSTANCE_X64(jit_avx512_core_amx_convolution_fwd_t<u8, s8, s8>)
+        CPU_INSTANCE_X64(brgemm_convolution_fwd_t<avx512_core_bf16_amx_int8>)
         CPU_INSTANCE_X64(jit_avx512_core_u8s8s32x_wino_convolution_fwd_t<s8>)
         CPU_INSTANCE_X64(jit_avx512_core_x8s8s32x_1x1_convolution_fwd_t<u8, s8>)
+        CPU_INSTANCE_X64(brgemm_convolution_fwd_t<avx512_core_vnni>)
         CPU_INSTANCE_X64(jit_avx512_core_x8s8s32x_convolution_fwd_t<u8, s8>)
         CPU_INSTANCE_X64(jit_uni_x8s8s32x_1x1_convolution_fwd_t<avx2, u8, s8>)
         CPU_INSTANCE_X64(jit_uni_x8s8s32x_convolution_fwd_t<avx2, u8, s8>)
@@ -297,13 +341,17 @@ const std::map<conv_impl_key_t, std::vector<pd_create_f>> impl_list_map {
     {{forward, u8, s8, u8}, {
         CPU_INSTANCE_X64(jit_avx512_core_amx_1x1_convolution_fwd_t<u8, s8, u8>)
         CPU_INSTANCE_X64(jit_avx512_core_amx_convolution_fwd_t<u8, s8, u8>)
+        CPU_INSTANCE_X64(brgemm_convolution_fwd_t<avx512_core_bf16_amx_int8>)
         CPU_INSTANCE_X64(jit_avx512_core_u8s8s32x_wino_convolution_fwd_t<u8>)
         CPU_INSTANCE_X64(jit_avx512_core_x8s8s32x_1x1_convolution_fwd_t<u8, u8>)
+        CPU_INSTANCE_X64(brgemm_convolution_fwd_t<avx512_core_vnni>)
         CPU_INSTANCE_X64(jit_avx512_core_x8s8s32x_convolution_fwd_t<u8, u8>)
         CPU_INSTANCE_X64(jit_uni_x8s8s32x_1x1_convolution_fwd_t<avx2, u8, u8>)
         CPU_INSTANCE_X64(jit_uni_x8s8s32x_convolution_fwd_t<avx2, u8, u8>)
         CPU_INSTANCE_X64(jit_uni_x8s8s32x_1x1_convolution_fwd_t<sse41, u8, u8>)
         CPU_INSTANCE_X64(jit_uni_x8s8s32x_convolution_fwd_t<sse41, u8, u8>)
+        CPU_INSTANCE_AARCH64_ACL(acl_depthwise_convolution_fwd_t<u8, s8, u8, s32>)
+        CPU_INSTANCE_AARCH64_ACL(acl_gemm_convolution_fwd_t<u8, s8, u8, s32>)
         CPU_INSTANCE(_gemm_x8s8s32x_convolution_fwd_t<u8, u8>)
         CPU_INSTANCE(ref_convolution_fwd_t<u8, s8, u8, s32>)
         CPU_INSTANCE(ref_fused_convolution_fwd_t)
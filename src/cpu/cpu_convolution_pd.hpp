@@ -56,6 +56,12 @@ struct cpu_convolution_fwd_pd_t : public convolution_fwd_pd_t {
 
 struct cpu_convolution_bwd_data_pd_t : public convolution_bwd_data_pd_t {
     using convolution_bwd_data_pd_t::convolution_bwd_data_pd_t;
+
+    bool wants_padded_bias() const {
+        if (!with_bias()) return false;
+        memory_desc_wrapper diff_src_d(&diff_src_md_);
+        return IC() != diff_src_d.padded_dims()[1];
+    }
 };
 
 struct cpu_convolution_bwd_weights_pd_t : public convolution_bwd_weights_pd_t {
@@ -0,0 +1,54 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/dnnl_thread.hpp"
+#include "common/primitive.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_dropout_utils.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace dropout_utils {
+
+status_t init_params(dropout::params_t &p, const exec_ctx_t &ctx) {
+    const auto probability
+            = CTX_IN_MEM(const float *, DNNL_ARG_ATTR_DROPOUT_PROBABILITY);
+    const auto seed = CTX_IN_MEM(const int32_t *, DNNL_ARG_ATTR_DROPOUT_SEED);
+    if (utils::any_null(probability, seed)) return status::invalid_arguments;
+    return dropout::init_params(p, *probability, *seed);
+}
+
+void store_mask(const dropout::params_t &p, uint8_t *mask, dim_t byte_start,
+        dim_t byte_end, bool parallel) {
+    if (mask == nullptr || byte_start >= byte_end) return;
+    if (!parallel) {
+        for (dim_t i = byte_start; i < byte_end; ++i)
+            mask[i] = dropout::mask_byte(p, i);
+        return;
+    }
+    parallel_nd(byte_end - byte_start, [&](dim_t i) {
+        mask[byte_start + i] = dropout::mask_byte(p, byte_start + i);
+    });
+}
+
+} // namespace dropout_utils
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,44 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_CPU_DROPOUT_UTILS_HPP
+#define CPU_CPU_DROPOUT_UTILS_HPP
+
+#include "common/c_types_map.hpp"
+#include "common/dropout.hpp"
+#include "common/primitive_exec_types.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace dropout_utils {
+
+// Initializes the dropout parameters from the runtime probability and seed.
+status_t init_params(dropout::params_t &p, const exec_ctx_t &ctx);
+
+// Stores the bytes [byte_start, byte_end) of the mask of the kept elements.
+// The bytes are computed in parallel if `parallel` is true.
+void store_mask(const dropout::params_t &p, uint8_t *mask, dim_t byte_start,
+        dim_t byte_end, bool parallel = true);
+
+} // namespace dropout_utils
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
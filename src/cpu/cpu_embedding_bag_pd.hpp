@@ -0,0 +1,58 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_CPU_EMBEDDING_BAG_PD_HPP
+#define CPU_CPU_EMBEDDING_BAG_PD_HPP
+
+#include "common/embedding_bag_pd.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+struct cpu_embedding_bag_pd_t : public embedding_bag_pd_t {
+    using embedding_bag_pd_t::embedding_bag_pd_t;
+
+    // Splits the bags between the threads so that every thread gathers
+    // about the same number of rows. A bag weighs its number of indices plus
+    // one, so that the empty bags are spread too. The bag weights prefix sum
+    // is offsets[b] + b, which is increasing, hence a binary search.
+    void balance_bags(const int32_t *offsets, int nthr, int ithr,
+            dim_t &start, dim_t &end) const {
+        const dim_t bags = num_bags();
+        const dim_t total = num_indices() + bags;
+        auto first_bag_from = [&](dim_t weight) {
+            dim_t lo = 0, hi = bags;
+            while (lo < hi) {
+                const dim_t mid = lo + (hi - lo) / 2;
+                if (offsets[mid] + mid < weight)
+                    lo = mid + 1;
+                else
+                    hi = mid;
+            }
+            return lo;
+        };
+        start = ithr == 0 ? 0 : first_bag_from(total * ithr / nthr);
+        end = ithr == nthr - 1 ? bags
+                               : first_bag_from(total * (ithr + 1) / nthr);
+    }
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
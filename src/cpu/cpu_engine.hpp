@@ -46,11 +46,14 @@ DECLARE_IMPL_LIST(binary);
 DECLARE_IMPL_LIST(convolution);
 DECLARE_IMPL_LIST(deconvolution);
 DECLARE_IMPL_LIST(eltwise);
+DECLARE_IMPL_LIST(embedding_bag);
+DECLARE_IMPL_LIST(group_normalization);
 DECLARE_IMPL_LIST(inner_product);
 DECLARE_IMPL_LIST(layer_normalization);
 DECLARE_IMPL_LIST(lrn);
 DECLARE_IMPL_LIST(logsoftmax);
 DECLARE_IMPL_LIST(matmul);
+DECLARE_IMPL_LIST(optimizer);
 DECLARE_IMPL_LIST(pooling_v2);
 DECLARE_IMPL_LIST(prelu);
 DECLARE_IMPL_LIST(reduction);
@@ -84,11 +87,14 @@ public:
             CASE(convolution);
             CASE(deconvolution);
             CASE(eltwise);
+            CASE(embedding_bag);
+            CASE(group_normalization);
             CASE(inner_product);
             CASE(layer_normalization);
             CASE(lrn);
             CASE(logsoftmax);
             CASE(matmul);
+            CASE(optimizer);
             case primitive_kind::pooling:
             CASE(pooling_v2);
             CASE(prelu);
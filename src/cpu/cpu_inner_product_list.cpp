@@ -19,13 +19,20 @@
 #include "cpu/gemm_inner_product.hpp"
 #include "cpu/gemm_x8s8s32x_inner_product.hpp"
 #include "cpu/ref_inner_product.hpp"
+#include "cpu/ref_sparse_inner_product.hpp"
 
 #if DNNL_X64
 #include "cpu/x64/gemm_bf16_inner_product.hpp"
 #include "cpu/x64/jit_brgemm_inner_product.hpp"
+#include "cpu/x64/jit_brgemm_sparse_inner_product.hpp"
 using namespace dnnl::impl::cpu::x64;
 #endif
 
+#if DNNL_AARCH64 && DNNL_AARCH64_USE_ACL
+#include "cpu/aarch64/acl_inner_product.hpp"
+using namespace dnnl::impl::cpu::aarch64;
+#endif
+
 namespace dnnl {
 namespace impl {
 namespace cpu {
@@ -38,15 +45,24 @@ using namespace dnnl::impl::data_type;
 // clang-format off
 const pd_create_f impl_list[] = {
         /* f32 */
+        CPU_INSTANCE_X64(brgemm_sparse_inner_product_fwd_t)
+        CPU_INSTANCE_X64(brgemm_inner_product_fwd_t<avx512_core, f32>)
+        CPU_INSTANCE_X64(brgemm_inner_product_bwd_data_t<avx512_core, f32>)
+        CPU_INSTANCE_X64(brgemm_inner_product_bwd_weights_t<avx512_core, f32>)
+        CPU_INSTANCE_AARCH64_ACL(acl_inner_product_fwd_t)
         CPU_INSTANCE(gemm_inner_product_fwd_t<f32>)
         CPU_INSTANCE(gemm_inner_product_bwd_data_t<f32>)
         CPU_INSTANCE(gemm_inner_product_bwd_weights_t<f32>)
+        CPU_INSTANCE(ref_sparse_inner_product_fwd_t)
         CPU_INSTANCE(ref_inner_product_fwd_t<f32>)
+        CPU_INSTANCE(ref_inner_product_fwd_t<f32, s8, f32, f32>)
         CPU_INSTANCE(ref_inner_product_bwd_data_t<f32, f32, f32, f32>)
         CPU_INSTANCE(ref_inner_product_bwd_weights_t<f32>)
         /* bfloat16 */
         CPU_INSTANCE_X64(brgemm_inner_product_fwd_t<avx512_core_bf16, bf16, bf16, f32>)
         CPU_INSTANCE_X64(brgemm_inner_product_fwd_t<avx512_core_bf16, bf16>)
+        CPU_INSTANCE_X64(brgemm_inner_product_fwd_t<avx512_core_bf16, bf16, s8, f32>)
+        CPU_INSTANCE_X64(brgemm_inner_product_fwd_t<avx512_core_bf16, bf16, s8, bf16>)
         CPU_INSTANCE_X64(brgemm_inner_product_bwd_data_t<avx512_core_bf16, f32, bf16, bf16>)
         CPU_INSTANCE_X64(brgemm_inner_product_bwd_data_t<avx512_core_bf16, bf16>)
         CPU_INSTANCE_X64(brgemm_inner_product_bwd_weights_t<avx512_core_bf16, bf16, f32, bf16>)
@@ -59,6 +75,8 @@ const pd_create_f impl_list[] = {
         CPU_INSTANCE_X64(gemm_bf16_inner_product_bwd_weights_t<bf16>)
         CPU_INSTANCE(ref_inner_product_fwd_t<bf16, bf16, bf16, f32>)
         CPU_INSTANCE(ref_inner_product_fwd_t<bf16, bf16, f32, f32>)
+        CPU_INSTANCE(ref_inner_product_fwd_t<bf16, s8, f32, f32>)
+        CPU_INSTANCE(ref_inner_product_fwd_t<bf16, s8, bf16, f32>)
         /* int */
         CPU_INSTANCE_X64(brgemm_inner_product_fwd_t<avx512_core_bf16_amx_int8, u8, s8, u8>)
         CPU_INSTANCE_X64(brgemm_inner_product_fwd_t<avx512_core_bf16_amx_int8, u8, s8, s8>)
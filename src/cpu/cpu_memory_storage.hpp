@@ -20,6 +20,7 @@
 #include <memory>
 
 #include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
 #include "common/memory.hpp"
 #include "common/memory_storage.hpp"
 #include "common/utils.hpp"
@@ -67,6 +68,7 @@ protected:
         void *ptr = malloc(size, platform::get_cache_line_size());
         if (!ptr) return status::out_of_memory;
         data_ = decltype(data_)(ptr, destroy);
+        first_touch(ptr, size);
         return status::success;
     }
 
@@ -77,6 +79,24 @@ private:
 
     static void release(void *ptr) {}
     static void destroy(void *ptr) { free(ptr); }
+
+    // Touches every page of a freshly allocated buffer from the threads of
+    // the current threading runtime. With the default first-touch policy
+    // the pages land on the NUMA nodes of these threads, so a stream backed
+    // by a threadpool (or a TBB arena) pinned to a socket gets its weights
+    // and scratchpad allocated on that socket. The page faults are also
+    // taken here rather than during the first execution.
+    static void first_touch(void *ptr, size_t size) {
+        char *p = static_cast<char *>(ptr);
+        const size_t page_size = (size_t)getpagesize();
+        const size_t n_pages = utils::div_up(size, page_size);
+        parallel(0, [&](const int ithr, const int nthr) {
+            size_t start {0}, end {0};
+            balance211(n_pages, nthr, ithr, start, end);
+            for (size_t pg = start; pg < end; pg++)
+                p[pg * page_size] = 0;
+        });
+    }
 };
 
 } // namespace cpu
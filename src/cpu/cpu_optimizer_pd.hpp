@@ -0,0 +1,45 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+#ifndef CPU_CPU_OPTIMIZER_PD_HPP
+#define CPU_CPU_OPTIMIZER_PD_HPP
+
+#include "common/dnnl_thread.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/optimizer_pd.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+struct cpu_optimizer_pd_t : public optimizer_pd_t {
+    using optimizer_pd_t::optimizer_pd_t;
+
+protected:
+    // Per-thread partial sums of the squared gradients, for the clipping
+    void init_scratchpad() {
+        if (!with_clipping()) return;
+        auto scratchpad = scratchpad_registry().registrar();
+        scratchpad.template book<double>(
+                memory_tracking::names::key_optimizer_reduction,
+                dnnl_get_max_threads());
+    }
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
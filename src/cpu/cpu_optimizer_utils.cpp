@@ -0,0 +1,120 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+#include <cmath>
+
+#include "common/bfloat16.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/nstl.hpp"
+
+#include "cpu/cpu_optimizer_utils.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace optimizer_utils {
+
+double sum_of_squares(const void *diff_weights, data_type_t dt, dim_t nelems,
+        double *partials) {
+    const int max_nthr = dnnl_get_max_threads();
+    for (int ithr = 0; ithr < max_nthr; ++ithr)
+        partials[ithr] = 0.;
+
+    // The blocks are accumulated in f32 to keep the inner loop vectorized,
+    // and summed up in double
+    const dim_t blk = 1024;
+    parallel(max_nthr, [&](const int ithr, const int nthr) {
+        dim_t start {0}, end {0};
+        balance211(nelems, nthr, ithr, start, end);
+        double acc = 0.;
+        for (dim_t s = start; s < end; s += blk) {
+            const dim_t e = nstl::min(end, s + blk);
+            float blk_acc = 0.f;
+            if (dt == data_type::bf16) {
+                const bfloat16_t *g
+                        = static_cast<const bfloat16_t *>(diff_weights);
+                PRAGMA_OMP_SIMD(reduction(+ : blk_acc))
+                for (dim_t i = s; i < e; ++i) {
+                    const float v = g[i];
+                    blk_acc += v * v;
+                }
+            } else {
+                const float *g = static_cast<const float *>(diff_weights);
+                PRAGMA_OMP_SIMD(reduction(+ : blk_acc))
+                for (dim_t i = s; i < e; ++i)
+                    blk_acc += g[i] * g[i];
+            }
+            acc += blk_acc;
+        }
+        partials[ithr] = acc;
+    });
+
+    double sum = 0.;
+    for (int ithr = 0; ithr < max_nthr; ++ithr)
+        sum += partials[ithr];
+    return sum;
+}
+
+status_t init_coeffs(coeffs_t &c, const optimizer_pd_t *pd, const float *hp,
+        const void *diff_weights, double *partials) {
+    const auto *d = pd->desc();
+    const float lr = hp[optimizer_pd_t::hp_learning_rate];
+    const float step = hp[optimizer_pd_t::hp_step];
+    float grad_scale = hp[optimizer_pd_t::hp_grad_scale];
+
+    if (pd->with_clipping()) {
+        // The padded area of a dense tensor is zero and does not contribute
+        const memory_desc_wrapper dw_d(pd->diff_weights_md());
+        const char *g = static_cast<const char *>(diff_weights)
+                + dw_d.blk_off(0) * dw_d.data_type_size();
+        const double norm = std::fabs(grad_scale)
+                * std::sqrt(sum_of_squares(
+                        g, dw_d.data_type(), dw_d.nelems(true), partials));
+        if (norm > d->max_grad_norm)
+            grad_scale = (float)(grad_scale * (d->max_grad_norm / norm));
+    }
+    c.grad_scale = grad_scale;
+
+    if (pd->is_adam()) {
+        if (step < 1.f) return status::invalid_arguments;
+        c.weight_decay = 0.f;
+        c.weights_scale = 1.f - lr * d->weight_decay;
+        c.beta1 = d->momentum;
+        c.one_minus_beta1 = 1.f - d->momentum;
+        c.beta2 = d->beta2;
+        c.one_minus_beta2 = 1.f - d->beta2;
+        const double bias_correction1 = 1. - std::pow(d->momentum, step);
+        const double bias_correction2 = 1. - std::pow(d->beta2, step);
+        c.step_size = (float)(lr / bias_correction1);
+        c.inv_sqrt_bias_correction2 = (float)(1. / std::sqrt(bias_correction2));
+        c.eps = d->epsilon;
+    } else {
+        c.weight_decay = d->weight_decay;
+        c.weights_scale = 1.f;
+        c.beta1 = d->momentum;
+        c.one_minus_beta1 = 1.f;
+        c.beta2 = 0.f;
+        c.one_minus_beta2 = 0.f;
+        c.step_size = lr;
+        c.inv_sqrt_bias_correction2 = 1.f;
+        c.eps = 0.f;
+    }
+    return status::success;
+}
+
+} // namespace optimizer_utils
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,65 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+#ifndef CPU_CPU_OPTIMIZER_UTILS_HPP
+#define CPU_CPU_OPTIMIZER_UTILS_HPP
+
+#include "common/optimizer_pd.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace optimizer_utils {
+
+// Coefficients of a single update step. Both algorithms are expressed with
+// the same formulas, SGD leaves the Adam specific terms neutral:
+//   g = grad_scale * g + weight_decay * w
+//   m = beta1 * m + one_minus_beta1 * g
+//   v = beta2 * v + one_minus_beta2 * g * g                  (Adam only)
+//   w = weights_scale * w - step_size * m                    (SGD)
+//   w = weights_scale * w - step_size * m
+//           / (sqrt(v) * inv_sqrt_bias_correction2 + eps)    (Adam)
+// where m is replaced with g for SGD without momentum. The layout is shared
+// with the JIT kernels, which broadcast the fields by offset.
+struct coeffs_t {
+    float grad_scale;
+    float weight_decay;
+    float weights_scale;
+    float beta1;
+    float one_minus_beta1;
+    float beta2;
+    float one_minus_beta2;
+    float step_size;
+    float inv_sqrt_bias_correction2;
+    float eps;
+};
+
+// Returns the sum of the squares of the gradients. The `partials` buffer
+// holds one value per thread.
+double sum_of_squares(const void *diff_weights, data_type_t dt, dim_t nelems,
+        double *partials);
+
+// Initializes the coefficients from the descriptor and the runtime
+// hyperparameters {learning rate, step, gradients scale}. The gradients
+// are read only if the descriptor requests clipping, and must be dense then.
+status_t init_coeffs(coeffs_t &c, const optimizer_pd_t *pd, const float *hp,
+        const void *diff_weights, double *partials);
+
+} // namespace optimizer_utils
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -21,6 +21,7 @@
 #include "cpu/ref_pooling.hpp"
 
 #if DNNL_X64
+#include "cpu/x64/jit_uni_global_pooling.hpp"
 #include "cpu/x64/jit_uni_i8i8_pooling.hpp"
 #include "cpu/x64/jit_uni_pooling.hpp"
 using namespace dnnl::impl::cpu::x64;
@@ -37,6 +38,10 @@ using namespace dnnl::impl::data_type;
 
 // clang-format off
 const pd_create_f impl_list[] = {
+        /* global */
+        CPU_INSTANCE_X64(jit_uni_global_pooling_fwd_t<avx512_core>)
+        CPU_INSTANCE_X64(jit_uni_global_pooling_fwd_t<avx2>)
+        CPU_INSTANCE_X64(jit_uni_global_pooling_fwd_t<sse41>)
         /* fp */
         CPU_INSTANCE_X64(jit_uni_pooling_fwd_t<avx512_core, bf16>)
         CPU_INSTANCE_X64(jit_uni_pooling_bwd_t<avx512_core, bf16>)
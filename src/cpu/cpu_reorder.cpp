@@ -27,6 +27,7 @@
 
 #include "cpu/rnn/rnn_reorders.hpp"
 #include "cpu/simple_reorder.hpp"
+#include "cpu/sparse_reorder.hpp"
 
 #if DNNL_X64
 #include "cpu/x64/jit_uni_reorder.hpp"
@@ -103,6 +104,7 @@ const impl_list_map_t regular_impl_list_map {
         rnn_weights_reorder_t<f32, bf16>::pd_t::create,
 
         DNNL_X64_ONLY(x64::jit_uni_reorder_create,)
+        DNNL_AARCH64_ONLY(aarch64::jit_uni_reorder_create,)
 
         REG_SR_BIDIR(f32, any, bf16, nChw16c),
         REG_SR_BIDIR(f32, any, bf16, nCdhw16c),
@@ -123,6 +125,8 @@ const impl_list_map_t regular_impl_list_map {
 
     // f32 -> f16
     {{f32, f16, 0}, {
+        DNNL_X64_ONLY(x64::jit_uni_reorder_create,)
+
         REG_SR(f32, any, f16, any, fmt_order::any, spec::reference),
 
         nullptr,
@@ -132,6 +136,8 @@ const impl_list_map_t regular_impl_list_map {
     {{f32, f32, 0}, {
         REG_FAST_DIRECT_COPY_F32_F32_COMMA
 
+        sparse_reorder_t<f32>::pd_t::create,
+
         DNNL_X64_ONLY(x64::jit_uni_reorder_create,)
         DNNL_AARCH64_ONLY(aarch64::jit_uni_reorder_create,)
 
@@ -339,6 +345,7 @@ const impl_list_map_t regular_impl_list_map {
         rnn_weights_reorder_t<bf16, bf16>::pd_t::create,
 
         DNNL_X64_ONLY(x64::jit_uni_reorder_create,)
+        DNNL_AARCH64_ONLY(aarch64::jit_uni_reorder_create,)
 
         REG_SR_BIDIR(bf16, any, f32, nChw16c),
         REG_SR_BIDIR(bf16, any, f32, nCdhw16c),
@@ -371,6 +378,8 @@ const impl_list_map_t regular_impl_list_map {
 
     // f16 ->
     {{f16, data_type::undef, 0}, {
+        DNNL_X64_ONLY(x64::jit_uni_reorder_create,)
+
         REG_SR(f16, any, f16, any, fmt_order::any, spec::reference),
         REG_SR(f16, any, f32, any, fmt_order::any, spec::reference),
 
@@ -467,6 +476,9 @@ const impl_list_map_t regular_impl_list_map {
 const impl_list_map_t comp_s8s8_impl_list_map {
     // f32 -> s8
     {{f32, s8, 2}, {
+        DNNL_X64_ONLY(x64::jit_uni_reorder_create,)
+        DNNL_AARCH64_ONLY(aarch64::jit_uni_reorder_create,)
+
         REG_SR(f32, oi, s8, OI4i16o4i, fmt_order::keep, spec::conv_req_comp),
         REG_SR(f32, io, s8, OI4i16o4i, fmt_order::keep, spec::conv_req_comp),
         REG_SR(f32, oi, s8, OI4i32o4i, fmt_order::keep, spec::conv_req_comp),
@@ -478,6 +490,9 @@ const impl_list_map_t comp_s8s8_impl_list_map {
     }},
     // f32 -> s8
     {{f32, s8, 3}, {
+        DNNL_X64_ONLY(x64::jit_uni_reorder_create,)
+        DNNL_AARCH64_ONLY(aarch64::jit_uni_reorder_create,)
+
         REG_SR(f32, any, s8, wio, fmt_order::keep, spec::conv_req_comp),
         REG_SR(f32, oiw, s8, OIw4i16o4i, fmt_order::keep, spec::conv_req_comp),
         REG_SR(f32, oiw, s8, OIw4i32o4i, fmt_order::keep, spec::conv_req_comp),
@@ -493,6 +508,9 @@ const impl_list_map_t comp_s8s8_impl_list_map {
         nullptr,
     }},
     {{f32, s8, 4}, {
+        DNNL_X64_ONLY(x64::jit_uni_reorder_create,)
+        DNNL_AARCH64_ONLY(aarch64::jit_uni_reorder_create,)
+
         REG_SR(f32, any, s8, hwio, fmt_order::keep, spec::conv_req_comp),
         REG_SR(f32, any, s8, wigo, fmt_order::keep, spec::conv_req_comp),
         REG_SR(f32, goiw, s8, gOIw4i16o4i, fmt_order::keep, spec::conv_req_comp),
@@ -521,6 +539,9 @@ const impl_list_map_t comp_s8s8_impl_list_map {
         nullptr,
     }},
     {{f32, s8, 5}, {
+        DNNL_X64_ONLY(x64::jit_uni_reorder_create,)
+        DNNL_AARCH64_ONLY(aarch64::jit_uni_reorder_create,)
+
         REG_SR(f32, any, s8, hwigo, fmt_order::keep, spec::conv_req_comp),
         REG_SR(f32, any, s8, dhwio, fmt_order::keep, spec::conv_req_comp),
         REG_SR(f32, goihw, s8, gOIhw4i16o4i, fmt_order::keep, spec::conv_req_comp),
@@ -549,6 +570,9 @@ const impl_list_map_t comp_s8s8_impl_list_map {
         nullptr,
     }},
     {{f32, s8, 6}, {
+        DNNL_X64_ONLY(x64::jit_uni_reorder_create,)
+        DNNL_AARCH64_ONLY(aarch64::jit_uni_reorder_create,)
+
         REG_SR(f32, any, s8, dhwigo, fmt_order::keep, spec::conv_req_comp),
         REG_SR(f32, goidhw, s8, gOIdhw4i16o4i, fmt_order::keep, spec::conv_req_comp),
         REG_SR(f32, goidhw, s8, gOIdhw2i8o4i, fmt_order::keep, spec::conv_req_comp),
@@ -558,6 +582,9 @@ const impl_list_map_t comp_s8s8_impl_list_map {
     }},
     // bf16 -> s8
     {{bf16, s8, 2}, {
+        DNNL_X64_ONLY(x64::jit_uni_reorder_create,)
+        DNNL_AARCH64_ONLY(aarch64::jit_uni_reorder_create,)
+
         REG_SR(bf16, oi, s8, OI4i16o4i, fmt_order::keep, spec::conv_req_comp),
         REG_SR(bf16, io, s8, OI4i16o4i, fmt_order::keep, spec::conv_req_comp),
         REG_SR(bf16, oi, s8, OI4i32o4i, fmt_order::keep, spec::conv_req_comp),
@@ -569,6 +596,9 @@ const impl_list_map_t comp_s8s8_impl_list_map {
     }},
     // bf16 -> s8
     {{bf16, s8, 3}, {
+        DNNL_X64_ONLY(x64::jit_uni_reorder_create,)
+        DNNL_AARCH64_ONLY(aarch64::jit_uni_reorder_create,)
+
         REG_SR(bf16, any, s8, wio, fmt_order::keep, spec::conv_req_comp),
         REG_SR(bf16, oiw, s8, OIw4i16o4i, fmt_order::keep, spec::conv_req_comp),
         REG_SR(bf16, oiw, s8, OIw4i32o4i, fmt_order::keep, spec::conv_req_comp),
@@ -584,6 +614,9 @@ const impl_list_map_t comp_s8s8_impl_list_map {
         nullptr,
     }},
     {{bf16, s8, 4}, {
+        DNNL_X64_ONLY(x64::jit_uni_reorder_create,)
+        DNNL_AARCH64_ONLY(aarch64::jit_uni_reorder_create,)
+
         REG_SR(bf16, any, s8, hwio, fmt_order::keep, spec::conv_req_comp),
         REG_SR(bf16, any, s8, wigo, fmt_order::keep, spec::conv_req_comp),
         REG_SR(bf16, goiw, s8, gOIw4i16o4i, fmt_order::keep, spec::conv_req_comp),
@@ -612,6 +645,9 @@ const impl_list_map_t comp_s8s8_impl_list_map {
         nullptr,
     }},
     {{bf16, s8, 5}, {
+        DNNL_X64_ONLY(x64::jit_uni_reorder_create,)
+        DNNL_AARCH64_ONLY(aarch64::jit_uni_reorder_create,)
+
         REG_SR(bf16, any, s8, hwigo, fmt_order::keep, spec::conv_req_comp),
         REG_SR(bf16, any, s8, dhwio, fmt_order::keep, spec::conv_req_comp),
         REG_SR(bf16, goihw, s8, gOIhw4i16o4i, fmt_order::keep, spec::conv_req_comp),
@@ -640,6 +676,9 @@ const impl_list_map_t comp_s8s8_impl_list_map {
         nullptr,
     }},
     {{bf16, s8, 6}, {
+        DNNL_X64_ONLY(x64::jit_uni_reorder_create,)
+        DNNL_AARCH64_ONLY(aarch64::jit_uni_reorder_create,)
+
         REG_SR(bf16, any, s8, dhwigo, fmt_order::keep, spec::conv_req_comp),
         REG_SR(bf16, goidhw, s8, gOIdhw4i16o4i, fmt_order::keep, spec::conv_req_comp),
         REG_SR(bf16, goidhw, s8, gOIdhw2i8o4i, fmt_order::keep, spec::conv_req_comp),
@@ -649,6 +688,9 @@ const impl_list_map_t comp_s8s8_impl_list_map {
     }},
     // s8 -> s8
     {{s8, s8, 2}, {
+        DNNL_X64_ONLY(x64::jit_uni_reorder_create,)
+        DNNL_AARCH64_ONLY(aarch64::jit_uni_reorder_create,)
+
         REG_SR(s8, oi, s8, OI4i16o4i, fmt_order::keep, spec::conv_req_comp),
         REG_SR(s8, io, s8, OI4i16o4i, fmt_order::keep, spec::conv_req_comp),
         REG_SR(s8, oi, s8, OI4i32o4i, fmt_order::keep, spec::conv_req_comp),
@@ -660,6 +702,9 @@ const impl_list_map_t comp_s8s8_impl_list_map {
     }},
     // s8 -> s8
     {{s8, s8, 3}, {
+        DNNL_X64_ONLY(x64::jit_uni_reorder_create,)
+        DNNL_AARCH64_ONLY(aarch64::jit_uni_reorder_create,)
+
         REG_SR(s8, any, s8, wio, fmt_order::keep, spec::conv_req_comp),
         REG_SR(s8, oiw, s8, OIw4i16o4i, fmt_order::keep, spec::conv_req_comp),
         REG_SR(s8, oiw, s8, OIw4i32o4i, fmt_order::keep, spec::conv_req_comp),
@@ -675,6 +720,9 @@ const impl_list_map_t comp_s8s8_impl_list_map {
         nullptr,
     }},
     {{s8, s8, 4}, {
+        DNNL_X64_ONLY(x64::jit_uni_reorder_create,)
+        DNNL_AARCH64_ONLY(aarch64::jit_uni_reorder_create,)
+
         REG_SR(s8, any, s8, hwio, fmt_order::keep, spec::conv_req_comp),
         REG_SR(s8, any, s8, wigo, fmt_order::keep, spec::conv_req_comp),
         REG_SR(s8, goiw, s8, gOIw4i16o4i, fmt_order::keep, spec::conv_req_comp),
@@ -703,6 +751,9 @@ const impl_list_map_t comp_s8s8_impl_list_map {
         nullptr,
     }},
     {{s8, s8, 5}, {
+        DNNL_X64_ONLY(x64::jit_uni_reorder_create,)
+        DNNL_AARCH64_ONLY(aarch64::jit_uni_reorder_create,)
+
         REG_SR(s8, any, s8, hwigo, fmt_order::keep, spec::conv_req_comp),
         REG_SR(s8, any, s8, dhwio, fmt_order::keep, spec::conv_req_comp),
         REG_SR(s8, goihw, s8, gOIhw4i16o4i, fmt_order::keep, spec::conv_req_comp),
@@ -731,6 +782,9 @@ const impl_list_map_t comp_s8s8_impl_list_map {
         nullptr,
     }},
     {{s8, s8, 6}, {
+        DNNL_X64_ONLY(x64::jit_uni_reorder_create,)
+        DNNL_AARCH64_ONLY(aarch64::jit_uni_reorder_create,)
+
         REG_SR(s8, any, s8, dhwigo, fmt_order::keep, spec::conv_req_comp),
         REG_SR(s8, goidhw, s8, gOIdhw4i16o4i, fmt_order::keep, spec::conv_req_comp),
         REG_SR(s8, goidhw, s8, gOIdhw2i8o4i, fmt_order::keep, spec::conv_req_comp),
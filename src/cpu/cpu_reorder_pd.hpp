@@ -20,6 +20,7 @@
 #include <assert.h>
 
 #include "common/c_types_map.hpp"
+#include "common/memory_desc_wrapper.hpp"
 #include "common/reorder_pd.hpp"
 #include "common/utils.hpp"
 #include "cpu/cpu_engine.hpp"
@@ -41,6 +42,14 @@ struct cpu_reorder_pd_t : public reorder_pd_t {
     }
 };
 
+// Reorders of that few elements are cheaper to copy element by element on a
+// single thread than to generate a jit kernel for or to split over threads.
+inline bool is_small_reorder(const memory_desc_wrapper &src_d) {
+    const dim_t small_reorder_nelems = 256;
+    return !src_d.has_runtime_dims_or_strides()
+            && src_d.nelems(true) <= small_reorder_nelems;
+}
+
 } // namespace cpu
 } // namespace impl
 } // namespace dnnl
@@ -31,6 +31,15 @@ namespace cpu {
 
 struct cpu_softmax_fwd_pd_t : public softmax_fwd_pd_t {
     using softmax_fwd_pd_t::softmax_fwd_pd_t;
+
+protected:
+    // Only a common output scale known at creation time is supported. It is
+    // applied right before the store, which allows to fold the quantization
+    // scale of the consumer into softmax.
+    bool attr_oscale_ok() const {
+        const auto &oscale = attr()->output_scales_;
+        return oscale.mask_ == 0 && oscale.defined();
+    }
 };
 
 struct cpu_softmax_bwd_pd_t : public softmax_bwd_pd_t {
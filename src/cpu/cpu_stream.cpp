@@ -0,0 +1,323 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dnnl/dnnl_config.h"
+
+#include <atomic>
+#include <unordered_map>
+
+#include "common/primitive.hpp"
+#include "common/scratchpad.hpp"
+
+#include "cpu/cpu_stream.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+namespace {
+// Primitives executed on a thread other than the one the stream is used from
+// would find no global scratchpad, since it is thread local. Keeps a
+// reference to a global scratchpad of the calling thread that is big enough
+// for all the primitives executed there.
+void reserve_scratchpad(std::unique_ptr<scratchpad_t> &scratchpad,
+        size_t &scratchpad_size, const primitive_iface_t *primitive_iface) {
+#ifndef DNNL_ENABLE_CONCURRENT_EXEC
+    const auto &pd = primitive_iface->pd()->impl();
+    const size_t size = pd->scratchpad_size(scratchpad_mode::library);
+    if (size <= scratchpad_size) return;
+
+    // The new scratchpad is created before the old one is released, so that
+    // the underlying buffer is grown rather than freed
+    scratchpad.reset(create_scratchpad(primitive_iface->engine(), size, true));
+    scratchpad_size = size;
+#else
+    UNUSED(scratchpad);
+    UNUSED(scratchpad_size);
+    UNUSED(primitive_iface);
+#endif
+}
+} // namespace
+
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
+
+async_executor_t::async_executor_t(
+        dnnl::threadpool_interop::threadpool_iface *threadpool)
+    : threadpool_(threadpool) {
+    thread_ = std::thread([this]() { run(); });
+}
+
+async_executor_t::~async_executor_t() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    cv_.notify_all();
+    thread_.join();
+}
+
+void async_executor_t::submit(
+        const primitive_iface_t *primitive_iface, exec_ctx_t &ctx) {
+    // The primitive must stay alive until it is executed even if the user
+    // destroys it right after the submission
+    auto *p_iface = const_cast<primitive_iface_t *>(primitive_iface);
+    p_iface->retain();
+
+    exec_ctx_t ctx_copy(ctx);
+    std::function<status_t()> task = [this, p_iface, ctx_copy]() mutable {
+        reserve_scratchpad(scratchpad_, scratchpad_size_, p_iface);
+        status_t status = p_iface->execute(ctx_copy);
+        p_iface->release();
+        return status;
+    };
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        tasks_.push_back(std::move(task));
+    }
+    cv_.notify_all();
+}
+
+status_t async_executor_t::wait() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    cv_.wait(lock, [this]() { return tasks_.empty() && !busy_; });
+    status_t status = status_;
+    status_ = status::success;
+    return status;
+}
+
+void async_executor_t::run() {
+    threadpool_utils::activate_threadpool(threadpool_);
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+        cv_.wait(lock, [this]() { return stop_ || !tasks_.empty(); });
+        if (tasks_.empty()) break;
+
+        auto task = std::move(tasks_.front());
+        tasks_.pop_front();
+        busy_ = true;
+        lock.unlock();
+
+        status_t status = task();
+
+        lock.lock();
+        if (status_ == status::success) status_ = status;
+        busy_ = false;
+        cv_.notify_all();
+    }
+    lock.unlock();
+
+    // The global scratchpad is thread local and has to be released on the
+    // thread it was created on
+    scratchpad_.reset();
+    threadpool_utils::deactivate_threadpool();
+}
+
+#else
+
+branch_executor_t::~branch_executor_t() {
+    join();
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    cv_.notify_all();
+    for (auto &w : workers_)
+        w->thread.join();
+}
+
+void branch_executor_t::submit(
+        const primitive_iface_t *primitive_iface, exec_ctx_t &ctx) {
+    // The primitive must stay alive until the join even if the user destroys
+    // it right after the submission
+    auto *p_iface = const_cast<primitive_iface_t *>(primitive_iface);
+    p_iface->retain();
+    branches_.push_back({p_iface, exec_ctx_t(ctx), 0});
+}
+
+status_t branch_executor_t::join() {
+    if (branches_.empty()) return status::success;
+
+    // The branches executing the same primitive or using the scratchpad of
+    // the stream share their scratchpad, so they go to the same team
+    const int nthr = dnnl_get_max_threads();
+    std::unordered_map<const void *, int> teams;
+    int nkeys = 0;
+    for (auto &b : branches_) {
+        const bool stream_scratchpad
+                = b.primitive_iface->pd()->impl()->attr()->scratchpad_mode_
+                        == scratchpad_mode::user
+                && b.ctx.output(DNNL_ARG_SCRATCHPAD) == nullptr;
+        const void *key = stream_scratchpad ? nullptr : b.primitive_iface;
+        auto it = teams.find(key);
+        if (it == teams.end()) it = teams.emplace(key, nkeys++ % nthr).first;
+        b.team = it->second;
+    }
+    const int nteams = nstl::min(nkeys, nthr);
+
+    std::vector<std::vector<branch_t *>> team_branches(nteams);
+    for (auto &b : branches_)
+        team_branches[b.team].push_back(&b);
+
+    // The threads are split evenly between the teams
+    auto team_nthr = [&](int team) {
+        int start {0}, end {0};
+        balance211(nthr, nteams, team, start, end);
+        return end - start;
+    };
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        while ((int)workers_.size() < nteams - 1) {
+            workers_.emplace_back(new worker_t());
+            auto *w = workers_.back().get();
+            w->thread = std::thread([this, w]() { run(w); });
+        }
+        for (int team = 1; team < nteams; team++) {
+            auto *w = workers_[team - 1].get();
+            w->branches = team_branches[team];
+            w->nthr = team_nthr(team);
+            pending_++;
+        }
+    }
+    cv_.notify_all();
+
+    status_t status = run_team(team_branches[0], team_nthr(0), nullptr);
+
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        cv_.wait(lock, [this]() { return pending_ == 0; });
+    }
+    for (int team = 1; team < nteams; team++)
+        if (status == status::success) status = workers_[team - 1]->status;
+
+    for (auto &b : branches_)
+        b.primitive_iface->release();
+    branches_.clear();
+    return status;
+}
+
+status_t branch_executor_t::run_team(
+        const std::vector<branch_t *> &branches, int nthr, worker_t *worker) {
+    status_t status = status::success;
+    auto execute = [&]() {
+        for (auto *b : branches) {
+            if (worker)
+                reserve_scratchpad(worker->scratchpad, worker->scratchpad_size,
+                        b->primitive_iface);
+            status_t st = b->primitive_iface->execute(b->ctx);
+            if (status == status::success) status = st;
+        }
+    };
+
+#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP
+    const int saved_nthr = omp_get_max_threads();
+    omp_set_num_threads(nthr);
+    execute();
+    omp_set_num_threads(saved_nthr);
+#elif DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_TBB
+    tbb::task_arena arena(nthr);
+    arena.execute(execute);
+#else
+    MAYBE_UNUSED(nthr);
+    execute();
+#endif
+    return status;
+}
+
+status_t cpu_stream_t::set_cpu_affinity(int ncpus, const int *cpus) {
+    std::vector<int> current;
+    if (!platform::get_thread_affinity(current)) return status::unimplemented;
+    for (int i = 0; i < ncpus; i++)
+        if (cpus[i] < 0) return status::invalid_arguments;
+
+    static std::atomic<uint64_t> last_affinity_id(0);
+    affinity_.assign(cpus, cpus + ncpus);
+    affinity_id_ = ++last_affinity_id;
+
+#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_TBB
+    observer_.reset();
+    arena_.reset();
+    if (ncpus > 0) {
+        arena_.reset(new tbb::task_arena(ncpus));
+        arena_->initialize();
+        observer_.reset(new affinity_observer_t(*arena_, affinity_));
+    }
+#endif
+    return status::success;
+}
+
+void cpu_stream_t::before_exec_hook() {
+    if (affinity_.empty()) return;
+    platform::get_thread_affinity(saved_affinity_);
+
+#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP
+    // One OpenMP thread per cpu. The team of the submitting thread keeps its
+    // placement between the executions, so it is pinned again only when
+    // another stream used it in the meantime.
+    static thread_local uint64_t pinned_affinity_id = 0;
+    const int nthr = (int)affinity_.size();
+    saved_nthr_ = omp_get_max_threads();
+    omp_set_num_threads(nthr);
+    if (pinned_affinity_id != affinity_id_) {
+        parallel(nthr, [&](int ithr, int) {
+            platform::set_thread_affinity({affinity_[ithr]});
+        });
+        pinned_affinity_id = affinity_id_;
+    }
+    platform::set_thread_affinity({affinity_[0]});
+#elif DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_SEQ
+    platform::set_thread_affinity(affinity_);
+#endif
+    // With TBB the threads are pinned by the observer of the stream arena
+}
+
+void cpu_stream_t::after_exec_hook() {
+    if (affinity_.empty()) return;
+#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP
+    omp_set_num_threads(saved_nthr_);
+#endif
+    platform::set_thread_affinity(saved_affinity_);
+}
+
+void branch_executor_t::run(worker_t *worker) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+        cv_.wait(lock,
+                [&]() { return stop_ || !worker->branches.empty(); });
+        if (worker->branches.empty()) break;
+
+        lock.unlock();
+        worker->status = run_team(worker->branches, worker->nthr, worker);
+        lock.lock();
+
+        worker->branches.clear();
+        pending_--;
+        cv_.notify_all();
+    }
+    lock.unlock();
+
+    // The global scratchpad is thread local and has to be released on the
+    // thread it was created on
+    worker->scratchpad.reset();
+}
+
+#endif
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
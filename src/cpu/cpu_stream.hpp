@@ -19,31 +19,184 @@
 
 #include "oneapi/dnnl/dnnl_config.h"
 
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
 #if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
+#include <deque>
+#include <functional>
+
 #include "oneapi/dnnl/dnnl_threadpool_iface.hpp"
 #endif
 
 #include "common/c_types_map.hpp"
 #include "common/dnnl_thread.hpp"
+#include "common/primitive_exec_types.hpp"
+#include "common/scratchpad.hpp"
 #include "common/stream.hpp"
 
+#include "cpu/platform.hpp"
+
+#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_TBB
+#include "tbb/task_scheduler_observer.h"
+#endif
+
 namespace dnnl {
 namespace impl {
 namespace cpu {
 
+#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_TBB
+// Pins every thread entering the arena of a stream to the cpu of its slot
+struct affinity_observer_t : public tbb::task_scheduler_observer {
+    affinity_observer_t(tbb::task_arena &arena, const std::vector<int> &cpus)
+        : tbb::task_scheduler_observer(arena), cpus_(cpus) {
+        observe(true);
+    }
+    ~affinity_observer_t() { observe(false); }
+
+    void on_scheduler_entry(bool is_worker) override {
+        const int slot = tbb::this_task_arena::current_thread_index();
+        platform::set_thread_affinity({cpus_[slot % (int)cpus_.size()]});
+    }
+
+private:
+    std::vector<int> cpus_;
+};
+#endif
+
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
+// Executes the primitives submitted to a stream on a dedicated thread in the
+// order of submission, so that the submitting thread is not blocked. The
+// dedicated thread only drives the execution: the computations are still
+// dispatched to the user threadpool by parallel().
+struct async_executor_t {
+    async_executor_t(dnnl::threadpool_interop::threadpool_iface *threadpool);
+    ~async_executor_t();
+
+    void submit(const primitive_iface_t *primitive_iface, exec_ctx_t &ctx);
+
+    // Blocks until all the submitted primitives are executed and returns the
+    // status of the first failed one, if any. The status is reset.
+    status_t wait();
+
+private:
+    void run();
+
+    dnnl::threadpool_interop::threadpool_iface *threadpool_;
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::deque<std::function<status_t()>> tasks_;
+    bool busy_ = false;
+    bool stop_ = false;
+    status_t status_ = status::success;
+    // Accessed only by the executing thread
+    std::unique_ptr<scratchpad_t> scratchpad_;
+    size_t scratchpad_size_ = 0;
+    std::thread thread_;
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(async_executor_t);
+};
+#else
+// Executes the independent primitives submitted between the stream fork and
+// join, e.g. the branches of an inception block, concurrently on disjoint
+// teams of threads. Each of them is too small to use all the threads
+// efficiently on its own. The first team runs on the joining thread, every
+// other team is driven by a dedicated thread kept alive between the joins.
+struct branch_executor_t {
+    branch_executor_t() = default;
+    ~branch_executor_t();
+
+    void submit(const primitive_iface_t *primitive_iface, exec_ctx_t &ctx);
+
+    // Executes the submitted primitives and blocks until they are completed.
+    // Returns the status of the first failed one, if any.
+    status_t join();
+
+private:
+    struct branch_t {
+        primitive_iface_t *primitive_iface;
+        exec_ctx_t ctx;
+        int team;
+    };
+
+    struct worker_t {
+        std::thread thread;
+        std::vector<branch_t *> branches;
+        int nthr = 0;
+        status_t status = status::success;
+        // Keeps the thread local global scratchpad of the worker big enough
+        std::unique_ptr<scratchpad_t> scratchpad;
+        size_t scratchpad_size = 0;
+    };
+
+    static status_t run_team(const std::vector<branch_t *> &branches, int nthr,
+            worker_t *worker);
+    void run(worker_t *worker);
+
+    std::vector<branch_t> branches_;
+    std::vector<std::unique_ptr<worker_t>> workers_;
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    int pending_ = 0;
+    bool stop_ = false;
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(branch_executor_t);
+};
+#endif
+
 struct cpu_stream_t : public stream_t {
     cpu_stream_t(engine_t *engine, unsigned flags) : stream_t(engine, flags) {}
     virtual ~cpu_stream_t() = default;
 
     dnnl::impl::status_t wait() override {
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
+        if (async_executor_) return async_executor_->wait();
+#else
+        if (forked_) return branch_executor_.join();
+#endif
         // CPU execution is synchronous so return immediately
         return dnnl::impl::status::success;
     }
 
+    dnnl::impl::status_t fork() override {
+        if (forked_) return dnnl::impl::status::invalid_arguments;
+        forked_ = true;
+        return dnnl::impl::status::success;
+    }
+
+    dnnl::impl::status_t join() override {
+        if (!forked_) return dnnl::impl::status::invalid_arguments;
+        forked_ = false;
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
+        // The primitives were executed at the submission
+        return dnnl::impl::status::success;
+#else
+        return branch_executor_.join();
+#endif
+    }
+
 #if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
     cpu_stream_t(engine_t *engine,
             dnnl::threadpool_interop::threadpool_iface *threadpool)
-        : stream_t(engine, threadpool) {}
+        : stream_t(engine, threadpool) {
+        using namespace dnnl::threadpool_interop;
+        if (threadpool
+                && (threadpool->get_flags()
+                        & threadpool_iface::ASYNCHRONOUS_EXECUTION))
+            async_executor_.reset(new async_executor_t(threadpool));
+    }
+
+    dnnl::impl::status_t enqueue_primitive(
+            const primitive_iface_t *primitive_iface,
+            dnnl::impl::exec_ctx_t &ctx) override {
+        if (!async_executor_)
+            return stream_t::enqueue_primitive(primitive_iface, ctx);
+        async_executor_->submit(primitive_iface, ctx);
+        return dnnl::impl::status::success;
+    }
 
     void before_exec_hook() override {
         dnnl::threadpool_interop::threadpool_iface *tp;
@@ -54,7 +207,50 @@ struct cpu_stream_t : public stream_t {
     void after_exec_hook() override {
         threadpool_utils::deactivate_threadpool();
     }
+
+private:
+    std::unique_ptr<async_executor_t> async_executor_;
+#else
+    dnnl::impl::status_t enqueue_primitive(
+            const primitive_iface_t *primitive_iface,
+            dnnl::impl::exec_ctx_t &ctx) override {
+        if (forked_) {
+            branch_executor_.submit(primitive_iface, ctx);
+            return dnnl::impl::status::success;
+        }
+#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_TBB
+        if (arena_) {
+            status_t status = status::success;
+            arena_->execute([&]() {
+                status = stream_t::enqueue_primitive(primitive_iface, ctx);
+            });
+            return status;
+        }
+#endif
+        return stream_t::enqueue_primitive(primitive_iface, ctx);
+    }
+
+    dnnl::impl::status_t set_cpu_affinity(
+            int ncpus, const int *cpus) override;
+    void before_exec_hook() override;
+    void after_exec_hook() override;
+
+private:
+    branch_executor_t branch_executor_;
+
+    std::vector<int> affinity_;
+    // Identifies the affinity across the streams, so that the threads are
+    // pinned again only after another affinity was applied to them
+    uint64_t affinity_id_ = 0;
+    // State of the submitting thread restored after the execution
+    std::vector<int> saved_affinity_;
+    int saved_nthr_ = 0;
+#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_TBB
+    std::unique_ptr<tbb::task_arena> arena_;
+    std::unique_ptr<affinity_observer_t> observer_;
+#endif
 #endif
+    bool forked_ = false;
 };
 
 } // namespace cpu
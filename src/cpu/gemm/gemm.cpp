@@ -14,6 +14,8 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <vector>
+
 #include "oneapi/dnnl/dnnl.h"
 #if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
 #include "oneapi/dnnl/dnnl_threadpool_iface.hpp"
@@ -137,6 +139,116 @@ dnnl_status_t extended_sgemm(const char *transa, const char *transb,
             transa, transb, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc, bias);
 }
 
+dnnl_status_t extended_sgemm_grouped(dim_t group_count, const char *transa,
+        const char *transb, const dim_t *M, const dim_t *N, const dim_t *K,
+        const float *alpha, const float *const *A, const dim_t *lda,
+        const float *const *B, const dim_t *ldb, const float *beta,
+        float *const *C, const dim_t *ldc) {
+    if (group_count < 0) return dnnl_invalid_arguments;
+    if (group_count == 0) return dnnl_success;
+    if (utils::any_null(transa, transb, M, N, K, alpha, A, lda, B, ldb, beta,
+                C, ldc))
+        return dnnl_invalid_arguments;
+
+    dim_t total_work = 0;
+    for (dim_t g = 0; g < group_count; g++) {
+        // packed matrices are not supported
+        if (utils::one_of(transa[g], 'P', 'p')
+                || utils::one_of(transb[g], 'P', 'p'))
+            return dnnl_invalid_arguments;
+        dnnl_status_t status = check_gemm_input(&transa[g], &transb[g], &M[g],
+                &N[g], &K[g], A[g], &lda[g], B[g], &ldb[g], C[g], &ldc[g],
+                &alpha[g], &beta[g], false);
+        if (status != dnnl_success) return status;
+        total_work += M[g] * N[g] * nstl::max(K[g], dim_t(1));
+    }
+    if (total_work == 0) return dnnl_success;
+
+    const int nthr = dnnl_get_current_num_threads();
+    if (nthr == 1) {
+        for (dim_t g = 0; g < group_count; g++) {
+            if (M[g] == 0 || N[g] == 0) continue;
+            dnnl_status_t status = extended_sgemm(&transa[g], &transb[g], &M[g],
+                    &N[g], &K[g], &alpha[g], A[g], &lda[g], B[g], &ldb[g],
+                    &beta[g], C[g], &ldc[g]);
+            if (status != dnnl_success) return status;
+        }
+        return dnnl_success;
+    }
+
+    // The groups are split into tiles of at most 1 / nthr of the total work
+    // (unless the tiles become too small), and every thread computes a
+    // contiguous range of tiles of roughly the same amount of work with a
+    // sequential gemm. This way small groups do not leave threads idle and
+    // large groups are still shared between several threads.
+    struct tile_t {
+        dim_t g, m0, n0, m, n, work_start, work;
+    };
+    const dim_t min_blk = 32;
+    const dim_t thr_work = utils::div_up(total_work, nthr);
+    std::vector<tile_t> tiles;
+    dim_t work_start = 0;
+    for (dim_t g = 0; g < group_count; g++) {
+        if (M[g] == 0 || N[g] == 0) continue;
+        const dim_t k = nstl::max(K[g], dim_t(1));
+        dim_t nb_m = 1, nb_n = 1;
+        while (utils::div_up(M[g], nb_m) * utils::div_up(N[g], nb_n) * k
+                > thr_work) {
+            const dim_t m_blk = utils::div_up(M[g], nb_m);
+            const dim_t n_blk = utils::div_up(N[g], nb_n);
+            // C is column-major, prefer splitting the columns
+            if (n_blk >= m_blk && n_blk >= 2 * min_blk)
+                nb_n++;
+            else if (m_blk >= 2 * min_blk)
+                nb_m++;
+            else if (n_blk >= 2 * min_blk)
+                nb_n++;
+            else
+                break;
+        }
+        for_(dim_t in = 0; in < nb_n; in++)
+        for (dim_t im = 0; im < nb_m; im++) {
+            tile_t t;
+            t.g = g;
+            dim_t m_end = 0, n_end = 0;
+            balance211(M[g], nb_m, im, t.m0, m_end);
+            balance211(N[g], nb_n, in, t.n0, n_end);
+            t.m = m_end - t.m0;
+            t.n = n_end - t.n0;
+            t.work_start = work_start;
+            t.work = t.m * t.n * k;
+            work_start += t.work;
+            tiles.push_back(t);
+        }
+    }
+
+    std::vector<dnnl_status_t> thr_status(nthr, dnnl_success);
+    parallel(nthr, [&](const int ithr, const int nthr) {
+        for (const auto &t : tiles) {
+            // the tile belongs to the thread owning its middle
+            const double mid = t.work_start + 0.5 * t.work;
+            const int owner = nstl::min(
+                    (int)(mid * nthr / total_work), nthr - 1);
+            if (owner != ithr) continue;
+
+            const dim_t g = t.g;
+            const bool is_trans_a = utils::one_of(transa[g], 'T', 't');
+            const bool is_trans_b = utils::one_of(transb[g], 'T', 't');
+            const float *a = A[g] + (is_trans_a ? t.m0 * lda[g] : t.m0);
+            const float *b = B[g] + (is_trans_b ? t.n0 : t.n0 * ldb[g]);
+            float *c = C[g] + t.m0 + t.n0 * ldc[g];
+            dnnl_status_t status = extended_sgemm(&transa[g], &transb[g], &t.m,
+                    &t.n, &K[g], &alpha[g], a, &lda[g], b, &ldb[g], &beta[g],
+                    c, &ldc[g]);
+            if (status != dnnl_success) thr_status[ithr] = status;
+        }
+    });
+
+    for (auto status : thr_status)
+        if (status != dnnl_success) return status;
+    return dnnl_success;
+}
+
 // Tries calling Intel MKL cblas_gemm_s8u8s32 if applicable and available
 dnnl_status_t try_cblas_gemm_s8u8s32(const char *transa, const char *transb,
         const char *offsetc, const dim_t *M, const dim_t *N, const dim_t *K,
@@ -252,6 +364,148 @@ dnnl_status_t gemm_bf16bf16f32(const char *transa, const char *transb,
     return dnnl_unimplemented;
 }
 
+namespace {
+// Matrices of a batch of gemm problems: either an array of pointers or a base
+// pointer with a constant stride between consecutive problems. An array of
+// evenly spaced pointers is also treated as strided.
+template <typename T>
+struct batch_ptr_t {
+    batch_ptr_t(T *base, dim_t stride)
+        : ptrs_(nullptr), base_(base), stride_(stride), is_strided_(true) {}
+
+    batch_ptr_t(T *const *ptrs, dim_t batch)
+        : ptrs_(ptrs)
+        , base_(ptrs ? ptrs[0] : nullptr)
+        , stride_(0)
+        , is_strided_(false) {
+        if (!ptrs || batch < 1) return;
+        const auto addr = [&](dim_t i) { return (ptrdiff_t)ptrs[i]; };
+        const ptrdiff_t step = batch > 1 ? addr(1) - addr(0) : 0;
+        if (step % (ptrdiff_t)sizeof(T) != 0) return;
+        for (dim_t i = 1; i < batch; i++)
+            if (addr(i) - addr(i - 1) != step) return;
+        stride_ = step / (ptrdiff_t)sizeof(T);
+        is_strided_ = true;
+    }
+
+    T *operator[](dim_t i) const {
+        return is_strided_ ? base_ + i * stride_ : ptrs_[i];
+    }
+
+    bool is_null() const { return base_ == nullptr; }
+    bool is_strided() const { return is_strided_; }
+    dim_t stride() const { return stride_; }
+
+private:
+    T *const *ptrs_;
+    T *base_;
+    dim_t stride_;
+    bool is_strided_;
+};
+
+// Computes a batch of problems of the same sizes with gemm(m, n, a, b, c)
+// taking column-major matrices.
+//
+// When one of the matrices is shared by the whole batch and the others are
+// adjacent in memory, the batch is folded into the M or N dimension of a
+// single gemm, so that the shared matrix is packed once. Otherwise small
+// problems are distributed among the threads and computed by sequential
+// gemms, which avoids paying the threading overhead of the gemm driver for
+// every problem of the batch.
+template <typename a_dt, typename b_dt, typename c_dt, typename gemm_t>
+dnnl_status_t gemm_batch(const char *transa, const char *transb, dim_t batch,
+        dim_t M, dim_t N, dim_t K, const batch_ptr_t<const a_dt> &A, dim_t lda,
+        const batch_ptr_t<const b_dt> &B, dim_t ldb, const batch_ptr_t<c_dt> &C,
+        dim_t ldc, bool can_fold_m, bool can_fold_n, const gemm_t &gemm) {
+    if (batch < 0 || utils::any_null(transa, transb))
+        return dnnl_invalid_arguments;
+    if (batch == 0) return dnnl_success;
+    if (A.is_null() || B.is_null() || C.is_null())
+        return dnnl_invalid_arguments;
+    if (batch == 1) return gemm(M, N, A[0], B[0], C[0]);
+
+    const bool is_trans_a = utils::one_of(*transa, 'T', 't');
+    const bool is_trans_b = utils::one_of(*transb, 'T', 't');
+    const bool all_strided
+            = A.is_strided() && B.is_strided() && C.is_strided();
+
+    // A is shared, B and C of consecutive problems are consecutive columns
+    const bool fold_n = can_fold_n && all_strided && A.stride() == 0
+            && C.stride() == N * ldc
+            && (is_trans_b ? B.stride() == N && ldb >= N * batch
+                           : B.stride() == N * ldb);
+    if (fold_n) return gemm(M, N * batch, A[0], B[0], C[0]);
+
+    // B is shared, A and C of consecutive problems are consecutive rows
+    const bool fold_m = can_fold_m && all_strided && B.stride() == 0
+            && C.stride() == M && ldc >= M * batch
+            && (is_trans_a ? A.stride() == M * lda
+                           : A.stride() == M && lda >= M * batch);
+    if (fold_m) return gemm(M * batch, N, A[0], B[0], C[0]);
+
+    // Below this amount of work per thread, splitting a single problem among
+    // the threads does not pay off
+    const dim_t thr_min_work = 64 * 64 * 64;
+    const dim_t work = M * N * nstl::max(K, dim_t(1));
+    const int nthr = dnnl_get_current_num_threads();
+    if (nthr == 1 || (batch < nthr && work >= nthr * thr_min_work)) {
+        for (dim_t i = 0; i < batch; i++) {
+            dnnl_status_t status = gemm(M, N, A[i], B[i], C[i]);
+            if (status != dnnl_success) return status;
+        }
+        return dnnl_success;
+    }
+
+    const int nthr_batch = (int)nstl::min(dim_t(nthr), batch);
+    std::vector<dnnl_status_t> thr_status(nthr_batch, dnnl_success);
+    parallel(nthr_batch, [&](const int ithr, const int nthr) {
+        dim_t start = 0, end = 0;
+        balance211(batch, nthr, ithr, start, end);
+        for (dim_t i = start; i < end; i++) {
+            dnnl_status_t status = gemm(M, N, A[i], B[i], C[i]);
+            if (status != dnnl_success) thr_status[ithr] = status;
+        }
+    });
+
+    for (auto status : thr_status)
+        if (status != dnnl_success) return status;
+    return dnnl_success;
+}
+
+dnnl_status_t sgemm_batch(const char *transa, const char *transb, dim_t batch,
+        dim_t M, dim_t N, dim_t K, float alpha,
+        const batch_ptr_t<const float> &A, dim_t lda,
+        const batch_ptr_t<const float> &B, dim_t ldb, float beta,
+        const batch_ptr_t<float> &C, dim_t ldc) {
+    auto gemm = [&](dim_t m, dim_t n, const float *a, const float *b,
+                        float *c) {
+        return extended_sgemm(transa, transb, &m, &n, &K, &alpha, a, &lda, b,
+                &ldb, &beta, c, &ldc);
+    };
+    return gemm_batch(transa, transb, batch, M, N, K, A, lda, B, ldb, C, ldc,
+            true, true, gemm);
+}
+
+template <typename b_dt>
+dnnl_status_t gemm_s8x8s32_batch(const char *transa, const char *transb,
+        const char *offsetc, dim_t batch, dim_t M, dim_t N, dim_t K,
+        float alpha, const batch_ptr_t<const int8_t> &A, dim_t lda, int8_t ao,
+        const batch_ptr_t<const b_dt> &B, dim_t ldb, b_dt bo, float beta,
+        const batch_ptr_t<int32_t> &C, dim_t ldc, const int32_t *co) {
+    if (!offsetc) return dnnl_invalid_arguments;
+    auto gemm = [&](dim_t m, dim_t n, const int8_t *a, const b_dt *b,
+                        int32_t *c) {
+        return gemm_s8x8s32<b_dt>(transa, transb, offsetc, &m, &n, &K, &alpha,
+                a, &lda, &ao, b, &ldb, &bo, &beta, c, &ldc, co);
+    };
+    // the row and column offsets of C are not repeated for a folded batch
+    const bool can_fold_m = !utils::one_of(*offsetc, 'C', 'c');
+    const bool can_fold_n = !utils::one_of(*offsetc, 'R', 'r');
+    return gemm_batch(transa, transb, batch, M, N, K, A, lda, B, ldb, C, ldc,
+            can_fold_m, can_fold_n, gemm);
+}
+} // namespace
+
 } // namespace cpu
 } // namespace impl
 } // namespace dnnl
@@ -266,15 +520,30 @@ dnnl_status_t dnnl_sgemm(char transa, char transb, dim_t M, dim_t N, dim_t K,
             &lda, &beta, C, &ldc);
 }
 
-namespace {
-const char *c2f_offsetC(const char *offC) {
-    if (offC) {
-        if (offC[0] == 'R' || offC[0] == 'r') return "C";
-        if (offC[0] == 'C' || offC[0] == 'c') return "R";
-    }
-    return offC;
+dnnl_status_t dnnl_sgemm_grouped(dim_t group_count, const char *transa,
+        const char *transb, const dim_t *M, const dim_t *N, const dim_t *K,
+        const float *alpha, const float *const *A, const dim_t *lda,
+        const float *const *B, const dim_t *ldb, const float *beta,
+        float *const *C, const dim_t *ldc) {
+    return extended_sgemm_grouped(group_count, transb, transa, N, M, K, alpha,
+            B, ldb, A, lda, beta, C, ldc);
+}
+
+dnnl_status_t dnnl_sgemm_batch(char transa, char transb, dim_t batch,
+        dim_t M, dim_t N, dim_t K, float alpha, const float *const *A,
+        dim_t lda, const float *const *B, dim_t ldb, float beta,
+        float *const *C, dim_t ldc) {
+    return sgemm_batch(&transb, &transa, batch, N, M, K, alpha, {B, batch},
+            ldb, {A, batch}, lda, beta, {C, batch}, ldc);
+}
+
+dnnl_status_t dnnl_sgemm_batch_strided(char transa, char transb, dim_t batch,
+        dim_t M, dim_t N, dim_t K, float alpha, const float *A, dim_t lda,
+        dim_t stride_a, const float *B, dim_t ldb, dim_t stride_b, float beta,
+        float *C, dim_t ldc, dim_t stride_c) {
+    return sgemm_batch(&transb, &transa, batch, N, M, K, alpha,
+            {B, stride_b}, ldb, {A, stride_a}, lda, beta, {C, stride_c}, ldc);
 }
-} // namespace
 
 dnnl_status_t dnnl_gemm_u8s8s32(char transa, char transb, char offsetc, dim_t M,
         dim_t N, dim_t K, float alpha, const uint8_t *A, dim_t lda, uint8_t ao,
@@ -292,6 +561,46 @@ dnnl_status_t dnnl_gemm_s8s8s32(char transa, char transb, char offsetc, dim_t M,
             &K, &alpha, B, &ldb, &bo, A, &lda, &ao, &beta, C, &ldc, co);
 }
 
+dnnl_status_t dnnl_gemm_u8s8s32_batch(char transa, char transb,
+        char offsetc, dim_t batch, dim_t M, dim_t N, dim_t K, float alpha,
+        const uint8_t *const *A, dim_t lda, uint8_t ao, const int8_t *const *B,
+        dim_t ldb, int8_t bo, float beta, int32_t *const *C, dim_t ldc,
+        const int32_t *co) {
+    return gemm_s8x8s32_batch<uint8_t>(&transb, &transa, c2f_offsetC(&offsetc),
+            batch, N, M, K, alpha, {B, batch}, ldb, bo, {A, batch}, lda, ao,
+            beta, {C, batch}, ldc, co);
+}
+
+dnnl_status_t dnnl_gemm_u8s8s32_batch_strided(char transa, char transb,
+        char offsetc, dim_t batch, dim_t M, dim_t N, dim_t K, float alpha,
+        const uint8_t *A, dim_t lda, dim_t stride_a, uint8_t ao,
+        const int8_t *B, dim_t ldb, dim_t stride_b, int8_t bo, float beta,
+        int32_t *C, dim_t ldc, dim_t stride_c, const int32_t *co) {
+    return gemm_s8x8s32_batch<uint8_t>(&transb, &transa, c2f_offsetC(&offsetc),
+            batch, N, M, K, alpha, {B, stride_b}, ldb, bo, {A, stride_a}, lda,
+            ao, beta, {C, stride_c}, ldc, co);
+}
+
+dnnl_status_t dnnl_gemm_s8s8s32_batch(char transa, char transb,
+        char offsetc, dim_t batch, dim_t M, dim_t N, dim_t K, float alpha,
+        const int8_t *const *A, dim_t lda, int8_t ao, const int8_t *const *B,
+        dim_t ldb, int8_t bo, float beta, int32_t *const *C, dim_t ldc,
+        const int32_t *co) {
+    return gemm_s8x8s32_batch<int8_t>(&transb, &transa, c2f_offsetC(&offsetc),
+            batch, N, M, K, alpha, {B, batch}, ldb, bo, {A, batch}, lda, ao,
+            beta, {C, batch}, ldc, co);
+}
+
+dnnl_status_t dnnl_gemm_s8s8s32_batch_strided(char transa, char transb,
+        char offsetc, dim_t batch, dim_t M, dim_t N, dim_t K, float alpha,
+        const int8_t *A, dim_t lda, dim_t stride_a, int8_t ao, const int8_t *B,
+        dim_t ldb, dim_t stride_b, int8_t bo, float beta, int32_t *C,
+        dim_t ldc, dim_t stride_c, const int32_t *co) {
+    return gemm_s8x8s32_batch<int8_t>(&transb, &transa, c2f_offsetC(&offsetc),
+            batch, N, M, K, alpha, {B, stride_b}, ldb, bo, {A, stride_a}, lda,
+            ao, beta, {C, stride_c}, ldc, co);
+}
+
 extern "C" dnnl_status_t DNNL_API dnnl_gemm_bf16bf16f32(char transa,
         char transb, dim_t M, dim_t N, dim_t K, float alpha,
         const bfloat16_t *A, dim_t lda, const bfloat16_t *B, dim_t ldb,
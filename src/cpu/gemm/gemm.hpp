@@ -39,6 +39,14 @@ dnnl_status_t extended_sgemm(const char *transa, const char *transb,
         const float *beta, float *C, const dim_t *ldc,
         const float *bias = nullptr, bool force_jit_gemm = false);
 
+// Computes group_count independent sgemm problems, every parameter is an array
+// of group_count values. The matrices are assumed to be column-major.
+dnnl_status_t extended_sgemm_grouped(dim_t group_count, const char *transa,
+        const char *transb, const dim_t *M, const dim_t *N, const dim_t *K,
+        const float *alpha, const float *const *A, const dim_t *lda,
+        const float *const *B, const dim_t *ldb, const float *beta,
+        float *const *C, const dim_t *ldc);
+
 template <typename b_dt>
 dnnl_status_t gemm_s8x8s32(const char *transa, const char *transb,
         const char *offsetc, const dim_t *M, const dim_t *N, const dim_t *K,
@@ -51,6 +59,15 @@ dnnl_status_t gemm_bf16bf16f32(const char *transa, const char *transb,
         const bfloat16_t *A, const dim_t *lda, const bfloat16_t *B,
         const dim_t *ldb, const float *beta, float *C, const dim_t *ldc);
 
+// Converts the C offset kind of the row-major API to the column-major one
+inline const char *c2f_offsetC(const char *offC) {
+    if (offC) {
+        if (offC[0] == 'R' || offC[0] == 'r') return "C";
+        if (offC[0] == 'C' || offC[0] == 'c') return "R";
+    }
+    return offC;
+}
+
 #if defined(USE_CBLAS)
 #define GEMM_IMPL_STR "gemm:blas"
 #elif DNNL_X64
@@ -14,8 +14,13 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include "oneapi/dnnl/dnnl.h"
+
+#include "common/utils.hpp"
+
 #include "cpu/platform.hpp"
 
+#include "cpu/gemm/gemm.hpp"
 #include "cpu/gemm/gemm_pack.hpp"
 
 #if DNNL_X64
@@ -170,3 +175,109 @@ dnnl_status_t gemm_s8s8s32_compute(const char *transa, const char *transb,
 } // namespace cpu
 } // namespace impl
 } // namespace dnnl
+
+using namespace dnnl::impl;
+using namespace dnnl::impl::cpu;
+
+namespace {
+// The row-major matrix A is the column-major matrix B and vice versa
+const char *c2f_identifier(char identifier) {
+    if (utils::one_of(identifier, 'A', 'a')) return "B";
+    if (utils::one_of(identifier, 'B', 'b')) return "A";
+    return nullptr;
+}
+} // namespace
+
+dnnl_status_t dnnl_sgemm_pack_get_size(char identifier, char transa,
+        char transb, dim_t M, dim_t N, dim_t K, dim_t lda, dim_t ldb,
+        size_t *size) {
+    if (!size) return dnnl_invalid_arguments;
+    return sgemm_pack_get_size(c2f_identifier(identifier), &transb, &transa,
+            &N, &M, &K, &ldb, &lda, size);
+}
+
+dnnl_status_t dnnl_sgemm_pack(char identifier, char transa, char transb,
+        dim_t M, dim_t N, dim_t K, dim_t lda, dim_t ldb, const float *src,
+        float *dst) {
+    return sgemm_pack(c2f_identifier(identifier), &transb, &transa, &N, &M,
+            &K, &ldb, &lda, src, dst);
+}
+
+dnnl_status_t dnnl_sgemm_compute(char transa, char transb, dim_t M, dim_t N,
+        dim_t K, const float *A, dim_t lda, const float *B, dim_t ldb,
+        float beta, float *C, dim_t ldc) {
+    return sgemm_compute(
+            &transb, &transa, &N, &M, &K, B, &ldb, A, &lda, &beta, C, &ldc);
+}
+
+dnnl_status_t dnnl_gemm_bf16bf16f32_pack_get_size(char identifier,
+        char transa, char transb, dim_t M, dim_t N, dim_t K, dim_t lda,
+        dim_t ldb, size_t *size) {
+    if (!size) return dnnl_invalid_arguments;
+    return gemm_bf16bf16f32_pack_get_size(c2f_identifier(identifier), &transb,
+            &transa, &N, &M, &K, &ldb, &lda, size);
+}
+
+dnnl_status_t dnnl_gemm_bf16bf16f32_pack(char identifier, char transa,
+        char transb, dim_t M, dim_t N, dim_t K, dim_t lda, dim_t ldb,
+        const uint16_t *src, uint16_t *dst) {
+    return gemm_bf16bf16f32_pack(c2f_identifier(identifier), &transb, &transa,
+            &N, &M, &K, &ldb, &lda, reinterpret_cast<const bfloat16_t *>(src),
+            reinterpret_cast<bfloat16_t *>(dst));
+}
+
+dnnl_status_t dnnl_gemm_bf16bf16f32_compute(char transa, char transb,
+        dim_t M, dim_t N, dim_t K, const uint16_t *A, dim_t lda,
+        const uint16_t *B, dim_t ldb, float beta, float *C, dim_t ldc) {
+    return gemm_bf16bf16f32_compute(&transb, &transa, &N, &M, &K,
+            reinterpret_cast<const bfloat16_t *>(B), &ldb,
+            reinterpret_cast<const bfloat16_t *>(A), &lda, &beta, C, &ldc);
+}
+
+dnnl_status_t dnnl_gemm_u8s8s32_pack_get_size(char identifier, char transa,
+        char transb, dim_t M, dim_t N, dim_t K, dim_t lda, dim_t ldb,
+        size_t *size) {
+    if (!size) return dnnl_invalid_arguments;
+    return gemm_s8u8s32_pack_get_size(c2f_identifier(identifier), &transb,
+            &transa, &N, &M, &K, &ldb, &lda, size);
+}
+
+dnnl_status_t dnnl_gemm_u8s8s32_pack(char identifier, char transa,
+        char transb, dim_t M, dim_t N, dim_t K, dim_t lda, dim_t ldb,
+        const void *src, void *dst) {
+    return gemm_s8u8s32_pack(c2f_identifier(identifier), &transb, &transa, &N,
+            &M, &K, &ldb, &lda, src, dst);
+}
+
+dnnl_status_t dnnl_gemm_u8s8s32_compute(char transa, char transb,
+        char offsetc, dim_t M, dim_t N, dim_t K, const void *A, dim_t lda,
+        const void *B, dim_t ldb, float beta, int32_t *C, dim_t ldc,
+        const int32_t *co) {
+    return gemm_s8u8s32_compute(&transb, &transa, c2f_offsetC(&offsetc), &N,
+            &M, &K, static_cast<const int8_t *>(B), &ldb,
+            static_cast<const uint8_t *>(A), &lda, &beta, C, &ldc, co);
+}
+
+dnnl_status_t dnnl_gemm_s8s8s32_pack_get_size(char identifier, char transa,
+        char transb, dim_t M, dim_t N, dim_t K, dim_t lda, dim_t ldb,
+        size_t *size) {
+    if (!size) return dnnl_invalid_arguments;
+    return gemm_s8s8s32_pack_get_size(c2f_identifier(identifier), &transb,
+            &transa, &N, &M, &K, &ldb, &lda, size);
+}
+
+dnnl_status_t dnnl_gemm_s8s8s32_pack(char identifier, char transa,
+        char transb, dim_t M, dim_t N, dim_t K, dim_t lda, dim_t ldb,
+        const void *src, void *dst) {
+    return gemm_s8s8s32_pack(c2f_identifier(identifier), &transb, &transa, &N,
+            &M, &K, &ldb, &lda, src, dst);
+}
+
+dnnl_status_t dnnl_gemm_s8s8s32_compute(char transa, char transb,
+        char offsetc, dim_t M, dim_t N, dim_t K, const void *A, dim_t lda,
+        const void *B, dim_t ldb, float beta, int32_t *C, dim_t ldc,
+        const int32_t *co) {
+    return gemm_s8s8s32_compute(&transb, &transa, c2f_offsetC(&offsetc), &N,
+            &M, &K, static_cast<const int8_t *>(B), &ldb,
+            static_cast<const int8_t *>(A), &lda, &beta, C, &ldc, co);
+}
@@ -92,7 +92,7 @@ status_t gemm_convolution_fwd_t::execute_forward_thr_nspc(const int ithr,
     size_t start = 0, end = 0;
     const bool is_problem_3d = pd()->ndims() == 5;
 
-    assert(IMPLICATION(is_problem_3d,
+    assert(IMPLICATION(is_problem_3d && !jcp.implicit_gemm,
             jcp.oh_block == jcp.oh && jcp.ow_block == jcp.ow
                     && jcp.ic_block == jcp.ic));
     assert(IMPLICATION(jcp.ow_block != jcp.ow, jcp.oh_block == 1));
@@ -147,11 +147,34 @@ status_t gemm_convolution_fwd_t::execute_forward_thr_nspc(const int ithr,
             const char *BT = jcp.im2col_sz ? "T" : "N";
             const data_t onef = 1.f;
             const float beta = this->beta_;
-            const data_t *__restrict src_od
-                    = src + od * jcp.oh * jcp.ow * jcp.ngroups * jcp.ic;
-            status_t st = extended_sgemm("N", BT, &M, &N, &K, &onef, wei, &LDA,
-                    jcp.im2col_sz ? col : (data_t *)src_od, &LDB, &beta, dst,
-                    &LDC);
+            status_t st = status::success;
+            if (jcp.implicit_gemm) {
+                // The kernel taps accumulate into the destination.
+                if (beta == 0.f) {
+                    for (dim_t os = 0; os < N; os++) {
+                        PRAGMA_OMP_SIMD()
+                        for (dim_t oc = 0; oc < M; oc++)
+                            dst[os * dst_os_stride + oc] = 0.f;
+                    }
+                }
+                const dim_t K_tap = jcp.ic;
+                const dim_t LDB_tap = jcp.stride_w * jcp.ngroups * jcp.ic;
+                jit_gemm_convolution_utils::for_each_implicit_gemm(jcp, od, oh,
+                        h_step, ow, w_step,
+                        [&](int tap, dim_t src_sp, dim_t dst_sp, dim_t N_tap) {
+                            if (st != status::success) return;
+                            st = extended_sgemm("N", "N", &M, &N_tap, &K_tap,
+                                    &onef, wei + tap * K_tap * LDA, &LDA,
+                                    src + src_sp * jcp.ngroups * jcp.ic,
+                                    &LDB_tap, &onef, dst + dst_sp * LDC, &LDC);
+                        });
+            } else {
+                const data_t *__restrict src_od
+                        = src + od * jcp.oh * jcp.ow * jcp.ngroups * jcp.ic;
+                st = extended_sgemm("N", BT, &M, &N, &K, &onef, wei, &LDA,
+                        jcp.im2col_sz ? col : (data_t *)src_od, &LDB, &beta,
+                        dst, &LDC);
+            }
             if (st != status::success) return st;
 
             if (jcp.with_bias || eltwise_) {
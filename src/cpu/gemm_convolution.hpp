@@ -41,16 +41,17 @@ struct gemm_convolution_fwd_t : public primitive_t {
                 GEMM_IMPL_STR, gemm_convolution_fwd_t, USE_GLOBAL_SCRATCHPAD);
 
         status_t init(engine_t *engine) {
-            bool ok = true && is_fwd()
-                    && set_default_alg_kind(alg_kind::convolution_direct)
-                    && expect_data_types(data_type::f32, data_type::f32,
-                            data_type::f32, data_type::f32, data_type::f32)
-                    && !has_zero_dim_memory()
-                    && attr()->has_default_values(
+            VDISPATCH(is_fwd(), prop_kind);
+            VDISPATCH(set_default_alg_kind(alg_kind::convolution_direct),
+                    alg_kind);
+            VDISPATCH(expect_data_types(data_type::f32, data_type::f32,
+                            data_type::f32, data_type::f32, data_type::f32),
+                    data_type);
+            VDISPATCH(!has_zero_dim_memory(), zero_dim);
+            VDISPATCH(attr()->has_default_values(
                             primitive_attr_t::skip_mask_t::post_ops,
-                            data_type::f32)
-                    && post_ops_ok();
-            if (!ok) return status::unimplemented;
+                            data_type::f32), attr);
+            VDISPATCH(post_ops_ok(), post_ops);
 
             auto scratchpad = scratchpad_registry().registrar();
             return jit_gemm_convolution_utils::init_conf(jcp_, scratchpad,
@@ -124,12 +125,14 @@ struct gemm_convolution_bwd_data_t : public primitive_t {
                 USE_GLOBAL_SCRATCHPAD);
 
         status_t init(engine_t *engine) {
-            bool ok = true && desc()->prop_kind == prop_kind::backward_data
-                    && set_default_alg_kind(alg_kind::convolution_direct)
-                    && expect_data_types(data_type::f32, data_type::f32,
-                            data_type::undef, data_type::f32, data_type::f32)
-                    && !has_zero_dim_memory() && attr()->has_default_values();
-            if (!ok) return status::unimplemented;
+            VDISPATCH(desc()->prop_kind == prop_kind::backward_data, prop_kind);
+            VDISPATCH(set_default_alg_kind(alg_kind::convolution_direct),
+                    alg_kind);
+            VDISPATCH(expect_data_types(data_type::f32, data_type::f32,
+                            data_type::undef, data_type::f32, data_type::f32),
+                    data_type);
+            VDISPATCH(!has_zero_dim_memory(), zero_dim);
+            VDISPATCH(attr()->has_default_values(), attr);
 
             auto scratchpad = scratchpad_registry().registrar();
             return jit_gemm_convolution_utils::init_conf(jcp_, scratchpad,
@@ -172,12 +175,15 @@ struct gemm_convolution_bwd_weights_t : public primitive_t {
                 USE_GLOBAL_SCRATCHPAD);
 
         status_t init(engine_t *engine) {
-            bool ok = true && desc()->prop_kind == prop_kind::backward_weights
-                    && set_default_alg_kind(alg_kind::convolution_direct)
-                    && expect_data_types(data_type::f32, data_type::f32,
-                            data_type::f32, data_type::f32, data_type::f32)
-                    && !has_zero_dim_memory() && attr()->has_default_values();
-            if (!ok) return status::unimplemented;
+            VDISPATCH(desc()->prop_kind == prop_kind::backward_weights,
+                    prop_kind);
+            VDISPATCH(set_default_alg_kind(alg_kind::convolution_direct),
+                    alg_kind);
+            VDISPATCH(expect_data_types(data_type::f32, data_type::f32,
+                            data_type::f32, data_type::f32, data_type::f32),
+                    data_type);
+            VDISPATCH(!has_zero_dim_memory(), zero_dim);
+            VDISPATCH(attr()->has_default_values(), attr);
 
             auto scratchpad = scratchpad_registry().registrar();
             return jit_gemm_convolution_utils::init_conf(jcp_, scratchpad,
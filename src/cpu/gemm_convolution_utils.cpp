@@ -989,6 +989,27 @@ void col2im(const conv_gemm_conf_t &jcp, const float *col, float *im,
         parallel_nd(jcp.ic, ker);
 }
 
+// Switches the forward nspc convolutions needing im2col to the implicit GEMM,
+// which gathers every kernel tap from the source instead of materializing
+// ic * ks columns per output point. The reduction dimension of each GEMM is
+// then the number of input channels only, so it pays off with enough input
+// channels and output points per row. Signed inputs need the im2col shift.
+static void init_implicit_gemm(conv_gemm_conf_t &jcp, int max_threads) {
+    constexpr int min_ic = 64, min_ow = 16;
+    jcp.implicit_gemm = jcp.im2col_sz != 0 && jcp.is_nspc && !jcp.signed_input
+            && jcp.ic >= min_ic && jcp.ow >= min_ow;
+    if (!jcp.implicit_gemm) return;
+
+    // Every thread computes its own blocks of output rows with sequential
+    // GEMMs.
+    const int outer_work = jcp.mb * jcp.ngroups;
+    const int nb_oh = nstl::min(jcp.oh, utils::div_up(max_threads, outer_work));
+    jcp.oh_block = utils::div_up(jcp.oh, nb_oh);
+    jcp.ow_block = jcp.ow;
+    jcp.outer_threading = true;
+    jcp.im2col_sz = 0;
+}
+
 status_t init_conf(conv_gemm_conf_t &jcp,
         memory_tracking::registrar_t &scratchpad, const convolution_desc_t &cd,
         memory_desc_t &src_md, memory_desc_t &weights_md, memory_desc_t &dst_md,
@@ -1042,6 +1063,7 @@ status_t init_conf(conv_gemm_conf_t &jcp,
     jcp.signed_input = src_d.data_type() == data_type::s8;
 
     jcp.outer_threading = false;
+    jcp.implicit_gemm = false;
 
     auto set_or_check_tags
             = [&](format_tag_t desired_src_tag, format_tag_t desired_dst_tag,
@@ -1181,6 +1203,7 @@ status_t init_conf(conv_gemm_conf_t &jcp,
                               !jcp.signed_input)
                     ? (ptrdiff_t)jcp.ic * jcp.ks * jcp.os
                     : 0;
+            init_implicit_gemm(jcp, max_threads);
 
             const int wei_size = jcp.oc * jcp.ic * jcp.kh * jcp.kw;
             bool is_blocking_applicable = true && is_fwd && jcp.im2col_sz
@@ -1296,8 +1319,9 @@ status_t init_conf(conv_gemm_conf_t &jcp,
                     key_conv_gemm_col, jcp.nthr * jcp.im2col_sz);
             scratchpad.book<int32_t>(key_conv_int_dat_in_acc_dt,
                     jcp.nthr * jcp.oh_block * jcp.ow_block * jcp.oc);
-            scratchpad.book<int8_t>(
-                    key_conv_gemm_imtr, jcp.nthr * jcp.id * jcp.is * jcp.ic);
+            if (!jcp.implicit_gemm)
+                scratchpad.book<int8_t>(key_conv_gemm_imtr,
+                        jcp.nthr * jcp.id * jcp.is * jcp.ic);
         } else if (is_bwd_d) {
             jcp.im2col_sz
                     = !everyone_is(true, jcp.ow == jcp.iw, jcp.oh == jcp.ih,
@@ -1339,6 +1363,8 @@ status_t init_conf(conv_gemm_conf_t &jcp,
                 ? (ptrdiff_t)jcp.ic * jcp.ks * jcp.os
                 : 0;
         if (jcp.is_nspc && is_fwd) {
+            if (!is_bf16_conv) init_implicit_gemm(jcp, max_threads);
+
             const size_t wei_size
                     = static_cast<size_t>(jcp.oc) * jcp.ic * jcp.kh * jcp.kw;
             bool is_blocking_applicable = true && is_fwd && jcp.im2col_sz
@@ -1476,9 +1502,11 @@ status_t init_conf(conv_gemm_conf_t &jcp,
                                 * jcp.ow_block * jcp.oc);
             }
 
-            scratchpad.book(key_conv_gemm_imtr,
-                    jcp.nthr * static_cast<size_t>(jcp.id) * jcp.is * jcp.ic,
-                    gemm_col_datatype_size);
+            if (!jcp.implicit_gemm)
+                scratchpad.book(key_conv_gemm_imtr,
+                        jcp.nthr * static_cast<size_t>(jcp.id) * jcp.is
+                                * jcp.ic,
+                        gemm_col_datatype_size);
             if (is_bf16_to_bf16_conv && jcp.with_bias
                     && one_of(data_type::bf16, cd.diff_bias_desc.data_type,
                             cd.bias_desc.data_type)) {
@@ -20,6 +20,7 @@
 #include "common/c_types_map.hpp"
 #include "common/dnnl_thread.hpp"
 #include "common/memory_tracking.hpp"
+#include "common/utils.hpp"
 
 #include "cpu/cpu_convolution_pd.hpp"
 #include "cpu/cpu_engine.hpp"
@@ -47,6 +48,9 @@ struct conv_gemm_conf_t {
 
     int nthr;
     ptrdiff_t im2col_sz;
+    // The GEMMs read the nspc source directly, one kernel tap at a time,
+    // instead of the im2col columns.
+    bool implicit_gemm;
     bool need_wei_reduction;
     bool signed_input;
     int oh_block;
@@ -79,6 +83,45 @@ void im2col_dt(const conv_gemm_conf_t &jcp, const im_dt *__restrict im,
         im_dt *__restrict imtr, col_dt *__restrict col, int hs, int hb, int ws,
         int wb);
 
+// Calls f(tap, src_sp, dst_sp, n) for every GEMM of the implicit GEMM
+// convolution of the output rows [oh, oh + h_step) and columns
+// [ow, ow + w_step) of the depth od: the n output points from dst_sp within
+// the block get the contribution of the kernel tap tap from the input points
+// at the spatial offset src_sp + i * stride_w. The taps falling into the
+// padding are skipped.
+template <typename F>
+void for_each_implicit_gemm(const conv_gemm_conf_t &jcp, int od, int oh,
+        int h_step, int ow, int w_step, F f) {
+    const int id_start = od * jcp.stride_d - jcp.f_pad;
+    for (int i = 0; i < h_step; i++) {
+        const int ih_start = (oh + i) * jcp.stride_h - jcp.t_pad;
+        for_(int kd = 0; kd < jcp.kd; kd++)
+        for (int kh = 0; kh < jcp.kh; kh++) {
+            const int id = id_start + kd * (jcp.dilate_d + 1);
+            const int ih = ih_start + kh * (jcp.dilate_h + 1);
+            if (id < 0 || id >= jcp.id || ih < 0 || ih >= jcp.ih) continue;
+
+            for (int kw = 0; kw < jcp.kw; kw++) {
+                // iw = ow * stride_w + iw_off has to be within [0, iw)
+                const int iw_off = kw * (jcp.dilate_w + 1) - jcp.l_pad;
+                const int ow_start = nstl::max(ow,
+                        utils::div_up(nstl::max(0, -iw_off), jcp.stride_w));
+                const int ow_end = jcp.iw - 1 - iw_off < 0
+                        ? 0
+                        : nstl::min(ow + w_step,
+                                (jcp.iw - 1 - iw_off) / jcp.stride_w + 1);
+                if (ow_start >= ow_end) continue;
+
+                const int tap = (kd * jcp.kh + kh) * jcp.kw + kw;
+                const dim_t src_sp = ((dim_t)id * jcp.ih + ih) * jcp.iw
+                        + ow_start * jcp.stride_w + iw_off;
+                const dim_t dst_sp = (dim_t)i * w_step + ow_start - ow;
+                f(tap, src_sp, dst_sp, (dim_t)(ow_end - ow_start));
+            }
+        }
+    }
+}
+
 template <typename T>
 void col2im_dt(
         const conv_gemm_conf_t &jcp, const T *__restrict col, T *__restrict im);
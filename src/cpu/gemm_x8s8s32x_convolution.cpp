@@ -110,7 +110,7 @@ _gemm_x8s8s32x_convolution_fwd_t<src_type, dst_type>::execute_forward_thr(
     size_t start = 0, end = 0;
 
     const bool is_problem_3d = pd()->ndims() == 5;
-    assert(IMPLICATION(is_problem_3d,
+    assert(IMPLICATION(is_problem_3d && !jcp.implicit_gemm,
             jcp.oh_block == jcp.oh && jcp.ow_block == jcp.ow
                     && jcp.ic_block == jcp.ic));
 
@@ -161,12 +161,32 @@ _gemm_x8s8s32x_convolution_fwd_t<src_type, dst_type>::execute_forward_thr(
             const uint8_t off_b = 0;
             const int32_t off_c = 0;
             const float onef = 1.f, zerof = 0.f;
-            const src_data_t *__restrict src_od
-                    = src + od * jcp.oh * jcp.ow * jcp.ngroups * jcp.ic;
-            st = gemm_s8x8s32("N", BT, jcp.signed_input ? "C" : "F", &M, &N, &K,
-                    &onef, wei, &LDA, &off_a,
-                    jcp.im2col_sz ? col : (uint8_t *)src_od, &LDB, &off_b,
-                    &zerof, acc, &M, jcp.signed_input ? wei_comp : &off_c);
+            if (jcp.implicit_gemm) {
+                // The kernel taps accumulate into acc.
+                for (dim_t i = 0; i < N * M; i++)
+                    acc[i] = 0;
+                const dim_t K_tap = jcp.ic;
+                const dim_t LDB_tap = jcp.stride_w * jcp.ngroups * jcp.ic;
+                jit_gemm_convolution_utils::for_each_implicit_gemm(jcp, od, oh,
+                        h_step, ow, w_step,
+                        [&](int tap, dim_t src_sp, dim_t dst_sp, dim_t N_tap) {
+                            if (st != status::success) return;
+                            st = gemm_s8x8s32("N", "N", "F", &M, &N_tap, &K_tap,
+                                    &onef, wei + tap * K_tap * LDA, &LDA,
+                                    &off_a,
+                                    (const uint8_t *)src
+                                            + src_sp * jcp.ngroups * jcp.ic,
+                                    &LDB_tap, &off_b, &onef, acc + dst_sp * M,
+                                    &M, &off_c);
+                        });
+            } else {
+                const src_data_t *__restrict src_od
+                        = src + od * jcp.oh * jcp.ow * jcp.ngroups * jcp.ic;
+                st = gemm_s8x8s32("N", BT, jcp.signed_input ? "C" : "F", &M,
+                        &N, &K, &onef, wei, &LDA, &off_a,
+                        jcp.im2col_sz ? col : (uint8_t *)src_od, &LDB, &off_b,
+                        &zerof, acc, &M, jcp.signed_input ? wei_comp : &off_c);
+            }
 
             if (st != status::success) return st;
 
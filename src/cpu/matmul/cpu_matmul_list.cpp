@@ -20,6 +20,17 @@
 #include "cpu/matmul/gemm_f32_matmul.hpp"
 #include "cpu/matmul/gemm_x8s8s32x_matmul.hpp"
 #include "cpu/matmul/ref_matmul.hpp"
+#include "cpu/matmul/ref_sparse_matmul.hpp"
+
+#if DNNL_X64
+#include "cpu/x64/matmul/brgemm_matmul.hpp"
+using namespace dnnl::impl::cpu::x64;
+#endif
+
+#if DNNL_AARCH64 && DNNL_AARCH64_USE_ACL
+#include "cpu/aarch64/matmul/acl_matmul.hpp"
+using namespace dnnl::impl::cpu::aarch64;
+#endif
 
 namespace dnnl {
 namespace impl {
@@ -31,7 +42,14 @@ namespace {
 using namespace dnnl::impl::data_type;
 
 #define INSTANCE(...) &primitive_desc_t::create<__VA_ARGS__::pd_t>
+// clang-format off
 const pd_create_f impl_list[] = {
+        CPU_INSTANCE_X64(x64::matmul::brgemm_matmul_t<avx512_core>)
+        CPU_INSTANCE_X64(x64::matmul::brgemm_matmul_t<avx512_core_bf16_amx_bf16>)
+        CPU_INSTANCE_X64(x64::matmul::brgemm_matmul_t<avx512_core_bf16>)
+        CPU_INSTANCE_X64(x64::matmul::brgemm_matmul_t<avx512_core_bf16_amx_int8>)
+        CPU_INSTANCE_X64(x64::matmul::brgemm_matmul_t<avx512_core_vnni>)
+        CPU_INSTANCE_AARCH64_ACL(aarch64::matmul::acl_matmul_t)
         INSTANCE(matmul::gemm_f32_matmul_t),
         INSTANCE(matmul::gemm_bf16_matmul_t<f32>),
         INSTANCE(matmul::gemm_bf16_matmul_t<bf16>),
@@ -43,9 +61,15 @@ const pd_create_f impl_list[] = {
         INSTANCE(matmul::gemm_x8s8s32x_matmul_t<u8, s8, s32>),
         INSTANCE(matmul::gemm_x8s8s32x_matmul_t<u8, s8, s8>),
         INSTANCE(matmul::gemm_x8s8s32x_matmul_t<u8, s8, u8>),
+        INSTANCE(matmul::ref_sparse_matmul_t),
         INSTANCE(matmul::ref_matmul_t<f32>),
         INSTANCE(matmul::ref_matmul_t<bf16, bf16, f32, f32>),
         INSTANCE(matmul::ref_matmul_t<bf16, bf16, bf16, f32>),
+        INSTANCE(matmul::ref_matmul_t<f16, f16, f32, f32>),
+        INSTANCE(matmul::ref_matmul_t<f16, f16, f16, f32>),
+        INSTANCE(matmul::ref_matmul_t<f32, s8, f32, f32>),
+        INSTANCE(matmul::ref_matmul_t<bf16, s8, f32, f32>),
+        INSTANCE(matmul::ref_matmul_t<bf16, s8, bf16, f32>),
         INSTANCE(matmul::ref_matmul_t<s8, s8, f32, s32>),
         INSTANCE(matmul::ref_matmul_t<s8, s8, s32, s32>),
         INSTANCE(matmul::ref_matmul_t<s8, s8, s8, s32>),
@@ -57,6 +81,7 @@ const pd_create_f impl_list[] = {
         /* eol */
         nullptr,
 };
+// clang-format on
 #undef INSTANCE
 } // namespace
 
@@ -136,6 +136,11 @@ using namespace data_type;
 template struct ref_matmul_t<f32, f32, f32, f32>;
 template struct ref_matmul_t<bf16, bf16, f32, f32>;
 template struct ref_matmul_t<bf16, bf16, bf16, f32>;
+template struct ref_matmul_t<f16, f16, f32, f32>;
+template struct ref_matmul_t<f16, f16, f16, f32>;
+template struct ref_matmul_t<f32, s8, f32, f32>;
+template struct ref_matmul_t<bf16, s8, f32, f32>;
+template struct ref_matmul_t<bf16, s8, bf16, f32>;
 template struct ref_matmul_t<s8, s8, f32, s32>;
 template struct ref_matmul_t<s8, s8, s32, s32>;
 template struct ref_matmul_t<s8, s8, s8, s32>;
@@ -0,0 +1,112 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/type_helpers.hpp"
+
+#include "cpu/matmul/ref_sparse_matmul.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace matmul {
+
+void ref_sparse_matmul_t::execute_ref(const exec_ctx_t &ctx) const {
+    using namespace memory_tracking::names;
+
+    const auto src = CTX_IN_MEM(const float *, DNNL_ARG_SRC);
+    const auto weights = CTX_IN_MEM(const char *, DNNL_ARG_WEIGHTS);
+    const auto bias = CTX_IN_MEM(const float *, DNNL_ARG_BIAS);
+    auto dst = CTX_OUT_MEM(float *, DNNL_ARG_DST);
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper weights_d(pd()->weights_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+    const memory_desc_wrapper bia_d(pd()->weights_md(1));
+
+    const dim_t M = pd()->M();
+    const dim_t N = pd()->N();
+    const dim_t K = pd()->K();
+
+    const auto &sd = weights_d.sparse_desc();
+    const dim_t KB = sd.block_dims[0], NB = sd.block_dims[1];
+    const dim_t nb_K = weights_d.padded_dims()[0] / KB;
+    const float *values = reinterpret_cast<const float *>(weights);
+    const int32_t *row_ptr
+            = reinterpret_cast<const int32_t *>(weights + sd.row_ptr_offset);
+    const int32_t *col_idx
+            = reinterpret_cast<const int32_t *>(weights + sd.col_idx_offset);
+
+    const auto &oscale = pd()->attr()->output_scales_;
+    const dim_t scale_stride = oscale.mask_ == 0 ? 0 : 1;
+    const bool bia_per_m = bias && bia_d.dims()[0] != 1;
+    const bool bia_per_n = bias && bia_d.dims()[1] != 1;
+
+    const dim_t N_padded = weights_d.padded_dims()[1];
+    float *acc_base = ctx.get_scratchpad_grantor().get<float>(
+            key_matmul_dst_in_acc_dt);
+
+    parallel(0, [&](const int ithr, const int nthr) {
+        dim_t m_start {0}, m_end {0};
+        balance211(M, nthr, ithr, m_start, m_end);
+        float *acc = acc_base + ithr * N_padded;
+
+        for (dim_t m = m_start; m < m_end; ++m) {
+            for (dim_t n = 0; n < N_padded; ++n)
+                acc[n] = 0.f;
+
+            for (dim_t kb = 0; kb < nb_K; ++kb) {
+                const dim_t k_work = nstl::min(KB, K - kb * KB);
+                for (dim_t blk = row_ptr[kb]; blk < row_ptr[kb + 1]; ++blk) {
+                    const float *v = values + blk * KB * NB;
+                    float *acc_blk = acc + col_idx[blk] * NB;
+                    for (dim_t k = 0; k < k_work; ++k) {
+                        const float s = src[src_d.off(m, kb * KB + k)];
+                        for (dim_t n = 0; n < NB; ++n)
+                            acc_blk[n] += s * v[k * NB + n];
+                    }
+                }
+            }
+
+            for (dim_t n = 0; n < N; ++n) {
+                float res = acc[n];
+                if (bias) {
+                    const dim_t bia_m = bia_per_m ? m : 0;
+                    const dim_t bia_n = bia_per_n ? n : 0;
+                    res += bias[bia_d.off(bia_m, bia_n)];
+                }
+                res *= oscale.scales_[scale_stride * n];
+
+                const dim_t dst_off = dst_d.off(m, n);
+
+                ref_post_ops_t::args_t args;
+                args.dst_val = dst[dst_off];
+                args.ctx = &ctx;
+                args.l_offset = m * N + n;
+                args.dst_md = pd()->dst_md();
+                ref_post_ops->execute(res, args);
+
+                dst[dst_off] = res;
+            }
+        }
+    });
+}
+
+} // namespace matmul
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,106 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_MATMUL_REF_SPARSE_MATMUL_HPP
+#define CPU_MATMUL_REF_SPARSE_MATMUL_HPP
+
+#include <assert.h>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/primitive.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/primitive_attr_postops.hpp"
+
+#include "cpu/matmul/cpu_matmul_pd.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace matmul {
+
+// f32 2D matmul with weights in the block compressed sparse row format. The
+// rows of the weights are the K dimension, so a row of the destination is
+// accumulated from the non-zero blocks only.
+struct ref_sparse_matmul_t : public primitive_t {
+    struct pd_t : public cpu_matmul_pd_t {
+        using cpu_matmul_pd_t::cpu_matmul_pd_t;
+
+        DECLARE_COMMON_PD_T("ref:sparse", ref_sparse_matmul_t);
+
+        status_t init(engine_t *engine) {
+            using namespace data_type;
+            using smask_t = primitive_attr_t::skip_mask_t;
+
+            const auto &oscale = attr()->output_scales_;
+            bool ok = ndims() == 2
+                    && memory_desc_wrapper(weights_md_).is_sparse_desc()
+                    && src_md()->data_type == f32
+                    && weights_md()->data_type == f32
+                    && desc()->accum_data_type == f32
+                    && dst_md()->data_type == f32
+                    && IMPLICATION(with_bias(), bias_md_.data_type == f32)
+                    && !has_runtime_dims_or_strides()
+                    && attr()->has_default_values(
+                            smask_t::oscale | smask_t::post_ops)
+                    && utils::one_of(oscale.mask_, 0, 1 << 1)
+                    && set_default_formats();
+            if (!ok) return status::unimplemented;
+
+            init_scratchpad();
+            return status::success;
+        }
+
+        bool supports_sparse_weights() const override { return true; }
+
+    private:
+        void init_scratchpad() {
+            using namespace memory_tracking::names;
+            auto scratchpad = scratchpad_registry().registrar();
+            scratchpad.book<float>(key_matmul_dst_in_acc_dt,
+                    dnnl_get_max_threads() * weights_md_.padded_dims[1]);
+        }
+    };
+
+    ref_sparse_matmul_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override {
+        ref_post_ops
+                = utils::make_unique<ref_post_ops_t>(pd()->attr()->post_ops_);
+        if (!ref_post_ops) return status::out_of_memory;
+        return status::success;
+    }
+
+    status_t execute(const exec_ctx_t &ctx) const override {
+        execute_ref(ctx);
+        return status::success;
+    }
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+    void execute_ref(const exec_ctx_t &ctx) const;
+    std::unique_ptr<ref_post_ops_t> ref_post_ops;
+};
+
+} // namespace matmul
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -126,8 +126,8 @@ struct nchw_pooling_bwd_t : public primitive_t {
             if (!ok) return status::unimplemented;
 
             if (desc()->alg_kind == pooling_max) {
-                bool ws_ok
-                        = true && hint_fwd_pd_ && hint_fwd_pd_->workspace_md();
+                bool ws_ok = true && !recompute_argmax() && hint_fwd_pd_
+                        && hint_fwd_pd_->workspace_md();
                 if (!ws_ok) return status::unimplemented;
 
                 const auto &ws_blk
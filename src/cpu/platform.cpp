@@ -15,6 +15,10 @@
 * limitations under the License.
 *******************************************************************************/
 
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
 #include "cpu/platform.hpp"
 
 #if DNNL_X64
@@ -64,11 +68,29 @@ bool has_data_type_support(data_type_t data_type) {
 #else
             return false;
 #endif
-        case data_type::f16: return false;
+        case data_type::f16:
+#if DNNL_X64
+            // f16 is a storage type: the conversions rely on F16C
+            return x64::mayiuse(x64::avx2);
+#else
+            return false;
+#endif
         default: return true;
     }
 }
 
+bool has_data_type_storage_support(data_type_t data_type) {
+    switch (data_type) {
+        case data_type::bf16:
+#if DNNL_X64
+            return x64::mayiuse(x64::avx2);
+#else
+            return false;
+#endif
+        default: return has_data_type_support(data_type);
+    }
+}
+
 float s8s8_weights_scale_factor() {
 #if DNNL_X64
     return x64::mayiuse(x64::avx512_core_vnni) ? 1.0f : 0.5f;
@@ -109,6 +131,24 @@ unsigned get_num_cores() {
 #endif
 }
 
+// Hybrid parts mix cores of different performance, so that static work
+// partitioning makes the fast cores wait for the slow ones
+bool has_hybrid_cores() {
+#if DNNL_X64
+    // CPUID.(EAX=07H, ECX=0):EDX[15] is the hybrid flag
+    static const bool is_hybrid = []() {
+        unsigned data[4] = {};
+        Xbyak::util::Cpu::getCpuid(0, data);
+        if (data[0] < 7) return false;
+        Xbyak::util::Cpu::getCpuidEx(7, 0, data);
+        return ((data[3] >> 15) & 1) == 1;
+    }();
+    return is_hybrid;
+#else
+    return false;
+#endif
+}
+
 int get_vector_register_size() {
 #if DNNL_X64
     using namespace x64;
@@ -123,6 +163,36 @@ int get_vector_register_size() {
     return 0;
 }
 
+bool get_thread_affinity(std::vector<int> &cpus) {
+#if defined(__linux__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if (sched_getaffinity(0, sizeof(set), &set) != 0) return false;
+    cpus.clear();
+    for (int cpu = 0; cpu < CPU_SETSIZE; cpu++)
+        if (CPU_ISSET(cpu, &set)) cpus.push_back(cpu);
+    return true;
+#else
+    UNUSED(cpus);
+    return false;
+#endif
+}
+
+bool set_thread_affinity(const std::vector<int> &cpus) {
+#if defined(__linux__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (int cpu : cpus) {
+        if (cpu < 0 || cpu >= CPU_SETSIZE) return false;
+        CPU_SET(cpu, &set);
+    }
+    return sched_setaffinity(0, sizeof(set), &set) == 0;
+#else
+    UNUSED(cpus);
+    return false;
+#endif
+}
+
 } // namespace platform
 } // namespace cpu
 } // namespace impl
@@ -18,6 +18,8 @@
 #ifndef CPU_PLATFORM_HPP
 #define CPU_PLATFORM_HPP
 
+#include <vector>
+
 #include "oneapi/dnnl/dnnl_config.h"
 
 #include "common/c_types_map.hpp"
@@ -94,10 +96,15 @@ dnnl_cpu_isa_t get_effective_cpu_isa();
 status_t set_max_cpu_isa(dnnl_cpu_isa_t isa);
 
 bool DNNL_API has_data_type_support(data_type_t data_type);
+// Weaker than has_data_type_support(): the data type may be kept in memory
+// and converted to and from f32 on the fly, but there are no instructions to
+// compute in it (e.g. bf16 on avx2).
+bool has_data_type_storage_support(data_type_t data_type);
 float s8s8_weights_scale_factor();
 
-unsigned get_per_core_cache_size(int level);
-unsigned get_num_cores();
+unsigned DNNL_API get_per_core_cache_size(int level);
+unsigned DNNL_API get_num_cores();
+bool has_hybrid_cores();
 
 constexpr int get_cache_line_size() {
     return 64;
@@ -105,6 +112,11 @@ constexpr int get_cache_line_size() {
 
 int get_vector_register_size();
 
+// Gets and sets the logical CPUs the calling thread may run on. Return false
+// if the operation is not supported by the OS or failed.
+bool get_thread_affinity(std::vector<int> &cpus);
+bool set_thread_affinity(const std::vector<int> &cpus);
+
 } // namespace platform
 
 // XXX: find a better place for these values?
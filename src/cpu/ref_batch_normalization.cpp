@@ -22,6 +22,7 @@
 #include "common/dnnl_thread.hpp"
 #include "common/memory_tracking.hpp"
 #include "common/type_helpers.hpp"
+#include "cpu/primitive_attr_postops.hpp"
 #include "cpu/ref_batch_normalization.hpp"
 #include "cpu/simple_q10n.hpp"
 
@@ -102,12 +103,18 @@ void ref_batch_normalization_fwd_t<d_type>::execute_forward(
         return;
     }
 
-    const bool with_relu = pd()->with_relu_post_op();
+    const float oscale = pd()->attr()->output_scales_.scales_[0];
+    const auto &po = pd()->attr()->post_ops_;
+    const bool with_eltwise = po.len() == 1;
+    std::unique_ptr<ref_eltwise_scalar_fwd_t> eltwise;
+    if (with_eltwise)
+        eltwise.reset(new ref_eltwise_scalar_fwd_t(po.entry_[0].eltwise));
     auto maybe_post_op = [&](acc_data_t res) {
-        return (with_relu && res < 0.0f) ? 0.0f : res;
+        res *= oscale;
+        return with_eltwise ? eltwise->compute_scalar(res) : res;
     };
 
-    parallel_nd(C, [&](dim_t c) {
+    parallel_nd_dynamic(C, [&](dim_t c) {
         acc_data_t v_mean = calculate_stats ? 0 : mean[c];
         acc_data_t v_variance = calculate_stats ? 0 : variance[c];
 
@@ -212,7 +219,7 @@ void ref_batch_normalization_bwd_t<d_type>::execute_backward(
         return;
     }
 
-    parallel_nd(C, [&](dim_t c) {
+    parallel_nd_dynamic(C, [&](dim_t c) {
         acc_data_t v_mean = mean[c];
         acc_data_t v_variance = variance[c];
         acc_data_t sqrt_variance
@@ -47,7 +47,7 @@ struct ref_batch_normalization_fwd_t : public primitive_t {
             bool ok = is_fwd() && src_md()->data_type == d_type
                     && platform::has_data_type_support(d_type)
                     && check_scale_shift_data_type()
-                    && (attr()->has_default_values() || with_relu_post_op());
+                    && attr_oscale_and_eltwise_ok();
             if (!ok) return status::unimplemented;
 
             if (src_md()->data_type == s8 && !stats_is_src())
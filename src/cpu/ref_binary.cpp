@@ -23,6 +23,7 @@
 #include "common/math_utils.hpp"
 #include "common/nstl.hpp"
 #include "common/type_helpers.hpp"
+#include "cpu/cpu_dropout_utils.hpp"
 #include "cpu/simple_q10n.hpp"
 
 #include "cpu/ref_binary.hpp"
@@ -61,6 +62,10 @@ status_t ref_binary_t<src0_type, src1_type, dst_type>::execute_ref(
     const auto nelems_A = src0_d.nelems();
     const auto ndims = pd()->ndims();
 
+    const bool with_dropout = !pd()->attr()->dropout_.has_default_values();
+    dropout::params_t dp;
+    if (with_dropout) CHECK(dropout_utils::init_params(dp, ctx));
+
     parallel_nd(nelems_A, [&](dim_t i) {
         dims_t l_dims; // single decomposition for all physical offsets
         utils::l_dims_by_l_offset(l_dims, i, src0_d.dims(), ndims);
@@ -86,10 +91,18 @@ status_t ref_binary_t<src0_type, src1_type, dst_type>::execute_ref(
         args.l_offset = i;
         args.dst_md = pd()->dst_md();
         ref_post_ops->execute(acc, args);
+        if (with_dropout)
+            acc = dropout::apply(dp, off_C - dst_d.offset0(), acc);
 
         dst[off_C] = cpu::saturate_and_round<dst_data_t>(acc);
     });
 
+    if (with_dropout && pd()->attr()->dropout_.with_mask_) {
+        auto mask = CTX_OUT_MEM(uint8_t *, DNNL_ARG_ATTR_DROPOUT_MASK);
+        dropout_utils::store_mask(
+                dp, mask, 0, utils::div_up(dst_d.nelems(true), (dim_t)8));
+    }
+
     return status::success;
 }
 
@@ -53,7 +53,8 @@ struct ref_binary_t : public primitive_t {
                     && platform::has_data_type_support(dst_type)
                     && set_default_params() == status::success
                     && IMPLICATION(utils::one_of(dst_type, f32, bf16),
-                            attr()->has_default_values(sm::post_ops))
+                            attr()->has_default_values(
+                                    sm::post_ops | sm::dropout))
                     && IMPLICATION(utils::one_of(dst_type, s8, u8),
                             attr()->has_default_values(
                                     sm::post_ops | sm::scales))
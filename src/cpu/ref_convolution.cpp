@@ -635,6 +635,8 @@ using namespace data_type;
 template struct ref_convolution_fwd_t<f32>;
 template struct ref_convolution_fwd_t<bf16, bf16, bf16, f32>;
 template struct ref_convolution_fwd_t<bf16, bf16, f32, f32>;
+template struct ref_convolution_fwd_t<f16, f16, f16, f32>;
+template struct ref_convolution_fwd_t<f16, f16, f32, f32>;
 
 template struct ref_convolution_fwd_t<u8, s8, f32, s32>;
 template struct ref_convolution_fwd_t<u8, s8, s32, s32>;
@@ -44,27 +44,30 @@ struct ref_convolution_fwd_t : public primitive_t {
             using namespace data_type;
             using smask_t = primitive_attr_t::skip_mask_t;
 
-            bool ok = is_fwd()
-                    && set_default_alg_kind(alg_kind::convolution_direct)
-                    && expect_data_types(src_type, wei_type, data_type::undef,
-                            dst_type, acc_type)
-                    && platform::has_data_type_support(src_type)
-                    && platform::has_data_type_support(wei_type)
-                    && platform::has_data_type_support(dst_type)
-                    && IMPLICATION(with_bias(),
+            VDISPATCH(is_fwd(), prop_kind);
+            VDISPATCH(set_default_alg_kind(alg_kind::convolution_direct),
+                    alg_kind);
+            VDISPATCH(expect_data_types(src_type, wei_type, data_type::undef,
+                            dst_type, acc_type), data_type);
+            VDISPATCH(platform::has_data_type_storage_support(src_type), isa);
+            VDISPATCH(platform::has_data_type_storage_support(wei_type), isa);
+            VDISPATCH(platform::has_data_type_storage_support(dst_type), isa);
+            VDISPATCH(IMPLICATION(with_bias(),
                             IMPLICATION(src_type == u8,
                                     utils::one_of(bias_md_.data_type, f32, s32,
                                             s8, u8))
                                     && IMPLICATION(src_type == f32,
-                                            bias_md_.data_type == f32))
-                    && set_default_formats()
-                    && attr()->has_default_values(smask_t::oscale
+                                            bias_md_.data_type == f32)),
+                    data_type);
+            VDISPATCH(set_default_formats(), format);
+            VDISPATCH(attr()->has_default_values(smask_t::oscale
                                     | smask_t::zero_points_runtime
                                     | smask_t::post_ops,
-                            dst_type)
-                    && output_scales_mask_ok() && zero_points_ok()
-                    && post_ops_ok();
-            return ok ? status::success : status::unimplemented;
+                            dst_type), attr);
+            VDISPATCH(output_scales_mask_ok(), attr);
+            VDISPATCH(zero_points_ok(), attr);
+            VDISPATCH(post_ops_ok(), post_ops);
+            return status::success;
         }
 
     protected:
@@ -99,7 +102,8 @@ struct ref_convolution_fwd_t : public primitive_t {
         }
 
         bool post_ops_ok() const {
-            return attr()->post_ops_.find(primitive_kind::convolution) == -1;
+            return attr()->post_ops_.find(primitive_kind::convolution) == -1
+                    && attr()->post_ops_.find(primitive_kind::pooling) == -1;
         }
     };
 
@@ -136,19 +140,22 @@ struct ref_convolution_bwd_data_t : public primitive_t {
         DECLARE_COMMON_PD_T("ref:any", ref_convolution_bwd_data_t);
 
         status_t init(engine_t *engine) {
-            bool ok = true && desc()->prop_kind == prop_kind::backward_data
-                    && set_default_alg_kind(alg_kind::convolution_direct)
-                    && expect_data_types(diff_src_type, wei_type,
-                            data_type::undef, diff_dst_type, acc_type)
-                    && platform::has_data_type_support(diff_src_type)
-                    && platform::has_data_type_support(wei_type)
-                    && platform::has_data_type_support(diff_dst_type)
-                    && set_default_formats()
-                    && attr()->has_default_values(
-                            primitive_attr_t::skip_mask_t::oscale)
-                    && output_scales_mask_ok();
-
-            return ok ? status::success : status::unimplemented;
+            VDISPATCH(desc()->prop_kind == prop_kind::backward_data, prop_kind);
+            VDISPATCH(set_default_alg_kind(alg_kind::convolution_direct),
+                    alg_kind);
+            VDISPATCH(expect_data_types(diff_src_type, wei_type,
+                            data_type::undef, diff_dst_type, acc_type),
+                    data_type);
+            VDISPATCH(platform::has_data_type_support(diff_src_type),
+                    data_type);
+            VDISPATCH(platform::has_data_type_support(wei_type), data_type);
+            VDISPATCH(platform::has_data_type_support(diff_dst_type),
+                    data_type);
+            VDISPATCH(set_default_formats(), format);
+            VDISPATCH(attr()->has_default_values(
+                            primitive_attr_t::skip_mask_t::oscale), attr);
+            VDISPATCH(output_scales_mask_ok(), attr);
+            return status::success;
         }
 
         // Bias support is disabled to enable highly optimized conv impl in
@@ -200,15 +207,20 @@ struct ref_convolution_bwd_weights_t : public primitive_t {
         DECLARE_COMMON_PD_T("ref:any", ref_convolution_bwd_weights_t);
 
         status_t init(engine_t *engine) {
-            bool ok = true && desc()->prop_kind == prop_kind::backward_weights
-                    && set_default_alg_kind(alg_kind::convolution_direct)
-                    && expect_data_types(src_type, diff_wei_type, diff_wei_type,
-                            diff_dst_type, acc_type)
-                    && platform::has_data_type_support(src_type)
-                    && platform::has_data_type_support(diff_wei_type)
-                    && platform::has_data_type_support(diff_dst_type)
-                    && set_default_formats() && attr()->has_default_values();
-            return ok ? status::success : status::unimplemented;
+            VDISPATCH(desc()->prop_kind == prop_kind::backward_weights,
+                    prop_kind);
+            VDISPATCH(set_default_alg_kind(alg_kind::convolution_direct),
+                    alg_kind);
+            VDISPATCH(expect_data_types(src_type, diff_wei_type, diff_wei_type,
+                            diff_dst_type, acc_type), data_type);
+            VDISPATCH(platform::has_data_type_support(src_type), data_type);
+            VDISPATCH(platform::has_data_type_support(diff_wei_type),
+                    data_type);
+            VDISPATCH(platform::has_data_type_support(diff_dst_type),
+                    data_type);
+            VDISPATCH(set_default_formats(), format);
+            VDISPATCH(attr()->has_default_values(), attr);
+            return status::success;
         }
 
     protected:
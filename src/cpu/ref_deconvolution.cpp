@@ -229,7 +229,8 @@ status_t ref_deconvolution_fwd_t::execute(const exec_ctx_t &ctx) const {
     using namespace memory_tracking::names;
     const auto scratchpad = ctx.get_scratchpad_grantor();
     const bool ref_bias = pd()->with_bias() && !pd()->conv_supports_bias_;
-    const bool non_default_attr = !pd()->attr()->has_default_values();
+    const bool non_default_attr
+            = !pd()->attr()->has_default_values() && !pd()->conv_supports_attr_;
 
     const auto &args = ctx.args();
     exec_args_t conv_args;
@@ -237,6 +238,15 @@ status_t ref_deconvolution_fwd_t::execute(const exec_ctx_t &ctx) const {
     conv_args[DNNL_ARG_WEIGHTS] = args.at(DNNL_ARG_WEIGHTS);
     if (pd()->with_bias() && pd()->conv_supports_bias_)
         conv_args[DNNL_ARG_BIAS] = args.at(DNNL_ARG_BIAS);
+    if (pd()->conv_supports_attr_) {
+        const auto &po = pd()->attr()->post_ops_;
+        for (int idx = 0; idx < po.len(); ++idx) {
+            if (!po.entry_[idx].is_binary()) continue;
+            const int arg
+                    = DNNL_ARG_ATTR_MULTIPLE_POST_OP(idx) | DNNL_ARG_SRC_1;
+            conv_args[arg] = args.at(arg);
+        }
+    }
 
     // Create intermediate memory for f32 output if needed.
     auto dst = args.at(DNNL_ARG_DST);
@@ -249,7 +259,8 @@ status_t ref_deconvolution_fwd_t::execute(const exec_ctx_t &ctx) const {
 
     // When sum post-op happens, we need to copy original destination memory
     // prior call to external convolution happens.
-    if (pd()->attr()->post_ops_.find(primitive_kind::sum) != -1) {
+    if (non_default_attr
+            && pd()->attr()->post_ops_.find(primitive_kind::sum) != -1) {
         void *original_dst = scratchpad.get(key_deconv_sum);
         const memory_desc_wrapper dst_d(pd()->dst_md());
         void *dst = CTX_OUT_MEM(void *, DNNL_ARG_DST);
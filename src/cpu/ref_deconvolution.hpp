@@ -98,6 +98,7 @@ struct ref_deconvolution_fwd_t : public primitive_t {
             : cpu_deconvolution_fwd_pd_t(other)
             , conv_pd_(other.conv_pd_->clone())
             , conv_supports_bias_(other.conv_supports_bias_)
+            , conv_supports_attr_(other.conv_supports_attr_)
             , dst_tag_(other.dst_tag_) {}
 
         ~pd_t() = default;
@@ -115,6 +116,34 @@ struct ref_deconvolution_fwd_t : public primitive_t {
             conv_attr.set_scratchpad_mode(scratchpad_mode::user);
 
             convolution_desc_t cd;
+            // When only post-ops were requested, try to find a bwd_d conv impl
+            // which applies them together with the bias, if requested, in
+            // requested dst_dt, so that the output is written in a single
+            // pass.
+            if (!attr()->has_default_values()
+                    && attr()->has_default_values(
+                            primitive_attr_t::skip_mask_t::post_ops)) {
+                primitive_attr_t fused_attr(*attr());
+                if (!fused_attr.is_initialized()) return status::out_of_memory;
+                fused_attr.set_scratchpad_mode(scratchpad_mode::user);
+
+                CHECK(conv_descr_create(desc(), &cd, dst_md()->data_type));
+                dnnl_primitive_desc_iterator it(
+                        engine, (op_desc_t *)&cd, &fused_attr, nullptr);
+                if (!it.is_initialized()) return status::out_of_memory;
+
+                while (++it != it.end()) {
+                    conv_pd_.reset(it.fetch_once());
+                    const auto conv_pd = utils::downcast<
+                            cpu_convolution_bwd_data_pd_t *>(conv_pd_.get());
+                    if (with_bias() && !conv_pd->support_bias()) continue;
+                    if (conv_pd_->weights_md()->extra.flags != 0) continue;
+                    conv_supports_bias_ = with_bias();
+                    conv_supports_attr_ = true;
+                    return status::success;
+                }
+            }
+
             // When no attributes were requested, try to find a bwd_d conv impl
             // which supports bias update in-place, if requested, in requested
             // dst_dt. If appropriate conv impl was not found, enforce f32
@@ -195,6 +224,8 @@ struct ref_deconvolution_fwd_t : public primitive_t {
 
         std::unique_ptr<primitive_desc_t> conv_pd_;
         bool conv_supports_bias_ = false;
+        // the conv applies the post-ops and writes the destination directly
+        bool conv_supports_attr_ = false;
         format_tag_t dst_tag_;
 
     private:
@@ -206,8 +237,9 @@ struct ref_deconvolution_fwd_t : public primitive_t {
             // This scratchpad is required for intermediate f32 conv output
             // since original memory can be of smaller size and will cause
             // out of boundary access.
-            if ((with_bias() && !conv_supports_bias_)
-                    || !attr()->has_default_values()) {
+            const bool ref_attr
+                    = !attr()->has_default_values() && !conv_supports_attr_;
+            if ((with_bias() && !conv_supports_bias_) || ref_attr) {
                 const memory_desc_wrapper diff_src_d(conv_pd_->diff_src_md());
                 assert(diff_src_d.data_type_size() == sizeof(float));
                 scratchpad.book(key_deconv_bias, diff_src_d.nelems(true),
@@ -217,7 +249,7 @@ struct ref_deconvolution_fwd_t : public primitive_t {
             // post-op. It will be overwritten by conv execution and will not
             // be available to get the correct result.
             const memory_desc_wrapper dst_d(dst_md());
-            if (attr()->post_ops_.find(primitive_kind::sum) != -1)
+            if (ref_attr && attr()->post_ops_.find(primitive_kind::sum) != -1)
                 scratchpad.book(key_deconv_sum, dst_d.nelems(true),
                         dst_d.data_type_size());
         }
@@ -231,7 +263,8 @@ struct ref_deconvolution_fwd_t : public primitive_t {
         }
 
         bool post_ops_ok() const {
-            return attr()->post_ops_.find(primitive_kind::convolution) == -1;
+            return attr()->post_ops_.find(primitive_kind::convolution) == -1
+                    && attr()->post_ops_.find(primitive_kind::pooling) == -1;
         }
     };
 
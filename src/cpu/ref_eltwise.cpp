@@ -21,6 +21,7 @@
 #include "common/math_utils.hpp"
 #include "common/type_helpers.hpp"
 
+#include "cpu/cpu_dropout_utils.hpp"
 #include "cpu/ref_eltwise.hpp"
 #include "cpu/simple_q10n.hpp"
 
@@ -75,10 +76,10 @@ void ref_eltwise_fwd_t<data_type>::execute_forward_nCspBc_padded(
 }
 
 template <impl::data_type_t data_type>
-void ref_eltwise_fwd_t<data_type>::execute_forward_generic(
+status_t ref_eltwise_fwd_t<data_type>::execute_forward_generic(
         const exec_ctx_t &ctx) const {
     /* fast return */
-    if (pd()->has_zero_dim_memory()) return;
+    if (pd()->has_zero_dim_memory()) return status::success;
 
     auto src = CTX_IN_MEM(const data_t *, DNNL_ARG_SRC);
     auto dst = CTX_OUT_MEM(data_t *, DNNL_ARG_DST);
@@ -95,7 +96,11 @@ void ref_eltwise_fwd_t<data_type>::execute_forward_generic(
     const float beta = pd()->desc()->beta;
     const int ndims = pd()->desc()->data_desc.ndims;
 
-    parallel_nd(
+    const bool with_dropout = !pd()->attr()->dropout_.has_default_values();
+    dropout::params_t dp;
+    if (with_dropout) CHECK(dropout_utils::init_params(dp, ctx));
+
+    parallel_nd_dynamic(
             MB, C, D, H, W, [&](dim_t n, dim_t c, dim_t d, dim_t h, dim_t w) {
                 auto data_p_off = DATA_OFF(data_d, n, c, d, h, w);
                 float res = compute_eltwise_scalar_fwd(
@@ -107,9 +112,19 @@ void ref_eltwise_fwd_t<data_type>::execute_forward_generic(
                 args.l_offset = data_l_off;
                 args.dst_md = pd()->dst_md();
                 ref_post_ops->execute(res, args);
+                if (with_dropout)
+                    res = dropout::apply(
+                            dp, data_p_off - data_d.offset0(), res);
 
                 dst[data_p_off] = cpu::saturate_and_round<data_t>(res);
             });
+
+    if (with_dropout && pd()->attr()->dropout_.with_mask_) {
+        auto mask = CTX_OUT_MEM(uint8_t *, DNNL_ARG_ATTR_DROPOUT_MASK);
+        dropout_utils::store_mask(
+                dp, mask, 0, utils::div_up(data_d.nelems(true), (dim_t)8));
+    }
+    return status::success;
 }
 
 template <impl::data_type_t data_type>
@@ -144,10 +159,10 @@ void ref_eltwise_fwd_t<data_type>::execute_forward_dense(
 }
 
 template <impl::data_type_t data_type>
-void ref_eltwise_bwd_t<data_type>::execute_backward_generic(
+status_t ref_eltwise_bwd_t<data_type>::execute_backward_generic(
         const exec_ctx_t &ctx) const {
     /* fast return */
-    if (pd()->has_zero_dim_memory()) return;
+    if (pd()->has_zero_dim_memory()) return status::success;
 
     auto src = pd()->use_dst() ? CTX_IN_MEM(const data_t *, DNNL_ARG_DST)
                                : CTX_IN_MEM(const data_t *, DNNL_ARG_SRC);
@@ -167,15 +182,25 @@ void ref_eltwise_bwd_t<data_type>::execute_backward_generic(
     const float beta = pd()->desc()->beta;
     const int ndims = pd()->desc()->data_desc.ndims;
 
-    parallel_nd(
+    // the forward dropout is linear, so it is applied to the diff
+    // destination before the derivative of the eltwise
+    const bool with_dropout = !pd()->attr()->dropout_.has_default_values();
+    dropout::params_t dp;
+    if (with_dropout) CHECK(dropout_utils::init_params(dp, ctx));
+
+    parallel_nd_dynamic(
             MB, C, D, H, W, [&](dim_t n, dim_t c, dim_t d, dim_t h, dim_t w) {
                 auto data_off = DATA_OFF(data_d, n, c, d, h, w);
                 auto diff_data_off = DATA_OFF(diff_data_d, n, c, d, h, w);
                 data_t s = src[data_off];
-                data_t dd = diff_dst[diff_data_off];
+                float dd = diff_dst[diff_data_off];
+                if (with_dropout)
+                    dd = dropout::apply(
+                            dp, diff_data_off - diff_data_d.offset0(), dd);
                 data_t &ds = diff_src[diff_data_off];
                 ds = compute_eltwise_scalar_bwd(alg_kind, dd, s, alpha, beta);
             });
+    return status::success;
 }
 
 template <>
@@ -255,6 +280,7 @@ void ref_eltwise_bwd_t<data_type::bf16>::execute_backward_dense(
 
 template struct ref_eltwise_fwd_t<data_type::f32>;
 template struct ref_eltwise_fwd_t<data_type::bf16>;
+template struct ref_eltwise_fwd_t<data_type::f16>;
 template struct ref_eltwise_fwd_t<data_type::s32>;
 template struct ref_eltwise_fwd_t<data_type::s8>;
 template struct ref_eltwise_fwd_t<data_type::u8>;
@@ -45,8 +45,8 @@ struct ref_eltwise_fwd_t : public primitive_t {
             using sm = primitive_attr_t::skip_mask_t;
 
             bool ok = is_fwd() && data_type == desc()->data_desc.data_type
-                    && platform::has_data_type_support(data_type)
-                    && attr()->has_default_values(sm::post_ops);
+                    && platform::has_data_type_storage_support(data_type)
+                    && attr()->has_default_values(sm::post_ops | sm::dropout);
             if (!ok) return status::unimplemented;
 
             auto src_d = memory_desc_wrapper(src_md());
@@ -61,7 +61,8 @@ struct ref_eltwise_fwd_t : public primitive_t {
                     && src_d.only_padded_dim(1) && src_d.is_dense(true);
 
             const auto &po = attr()->post_ops_;
-            if (has_zero_dim_memory() || !po.has_default_values())
+            if (has_zero_dim_memory() || !po.has_default_values()
+                    || !attr()->dropout_.has_default_values())
                 use_dense_ = use_nCspBc_padded_ = false;
 
             return status::success;
@@ -87,7 +88,7 @@ struct ref_eltwise_fwd_t : public primitive_t {
         else if (pd()->use_nCspBc_padded_)
             execute_forward_nCspBc_padded(ctx);
         else
-            execute_forward_generic(ctx);
+            return execute_forward_generic(ctx);
         return status::success;
     }
 
@@ -95,7 +96,7 @@ private:
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
     void execute_forward_nCspBc_padded(const exec_ctx_t &ctx) const;
     void execute_forward_dense(const exec_ctx_t &ctx) const;
-    void execute_forward_generic(const exec_ctx_t &ctx) const;
+    status_t execute_forward_generic(const exec_ctx_t &ctx) const;
     std::unique_ptr<ref_post_ops_t> ref_post_ops;
 };
 
@@ -108,13 +109,18 @@ struct ref_eltwise_bwd_t : public primitive_t {
 
         status_t init(engine_t *engine) {
             using namespace utils;
+            using sm = primitive_attr_t::skip_mask_t;
 
+            // the dropout is regenerated on the diff destination, so the
+            // derivative has to be computed from the source
             bool ok = !is_fwd()
                     && everyone_is(data_type, desc()->data_desc.data_type,
                             desc()->diff_data_desc.data_type)
                     && platform::has_data_type_support(data_type)
                     && set_default_formats_common()
-                    && attr()->has_default_values();
+                    && attr()->has_default_values(sm::dropout)
+                    && IMPLICATION(
+                            !attr()->dropout_.has_default_values(), !use_dst());
             if (!ok) return status::unimplemented;
 
             const memory_desc_wrapper diff_dst_d(diff_dst_md());
@@ -124,6 +130,7 @@ struct ref_eltwise_bwd_t : public primitive_t {
 
             if (has_zero_dim_memory()) use_dense_ = false;
             if (diff_dst_d != memory_desc_wrapper(src_md())) use_dense_ = false;
+            if (!attr()->dropout_.has_default_values()) use_dense_ = false;
 
             if (data_type == data_type::bf16) init_scratchpad();
 
@@ -153,13 +160,13 @@ struct ref_eltwise_bwd_t : public primitive_t {
         if (pd()->use_dense_)
             execute_backward_dense(ctx);
         else
-            execute_backward_generic(ctx);
+            return execute_backward_generic(ctx);
         return status::success;
     }
 
 private:
     void execute_backward_dense(const exec_ctx_t &ctx) const;
-    void execute_backward_generic(const exec_ctx_t &ctx) const;
+    status_t execute_backward_generic(const exec_ctx_t &ctx) const;
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
 };
 
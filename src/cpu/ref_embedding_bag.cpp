@@ -0,0 +1,109 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <vector>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+
+#include "cpu/simple_q10n.hpp"
+
+#include "cpu/ref_embedding_bag.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+template <data_type_t table_type, data_type_t dst_type>
+status_t ref_embedding_bag_t<table_type, dst_type>::execute_forward(
+        const exec_ctx_t &ctx) const {
+    auto indices = CTX_IN_MEM(const int32_t *, DNNL_ARG_SRC);
+    auto offsets = CTX_IN_MEM(const int32_t *, DNNL_ARG_OFFSETS);
+    auto table = CTX_IN_MEM(const table_t *, DNNL_ARG_WEIGHTS);
+    auto scale_shift = CTX_IN_MEM(const float *, DNNL_ARG_WEIGHTS_SCALE_SHIFT);
+    auto dst = CTX_OUT_MEM(dst_t *, DNNL_ARG_DST);
+
+    const memory_desc_wrapper indices_d(pd()->src_md(0));
+    const memory_desc_wrapper offsets_d(pd()->src_md(1));
+    const memory_desc_wrapper table_d(pd()->weights_md(0));
+    const memory_desc_wrapper scale_shift_d(pd()->weights_md(1));
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+
+    const dim_t bags = pd()->num_bags();
+    const dim_t n_indices = pd()->num_indices();
+    const dim_t dim = pd()->emb_dim();
+    const bool with_scale_shift = pd()->with_scale_shift();
+    const bool is_mean = pd()->desc()->alg_kind == alg_kind::reduction_mean;
+
+    // The bags partitioning searches the offsets, which must be dense
+    const bool dense_offsets = offsets_d.is_dense();
+    std::vector<int32_t> offsets_buf;
+    if (!dense_offsets) {
+        offsets_buf.resize(bags);
+        for (dim_t b = 0; b < bags; ++b)
+            offsets_buf[b] = offsets[offsets_d.off(b)];
+    }
+    const int32_t *offs = dense_offsets ? offsets : offsets_buf.data();
+
+    // The rows are accumulated by blocks of the embedding dimension to keep
+    // the accumulators in registers and read the table rows sequentially
+    constexpr dim_t dim_block = 16;
+
+    parallel(0, [&](const int ithr, const int nthr) {
+        dim_t start {0}, end {0};
+        pd()->balance_bags(offs, nthr, ithr, start, end);
+
+        for (dim_t b = start; b < end; ++b) {
+            const dim_t i_beg = offs[b];
+            const dim_t i_end = b + 1 < bags ? offs[b + 1] : n_indices;
+            const float scale
+                    = is_mean && i_end > i_beg ? 1.f / (i_end - i_beg) : 1.f;
+
+            for (dim_t d0 = 0; d0 < dim; d0 += dim_block) {
+                const dim_t d_len = nstl::min(dim_block, dim - d0);
+                float acc[dim_block] = {0};
+                for (dim_t i = i_beg; i < i_end; ++i) {
+                    const dim_t row = indices[indices_d.off(i)];
+                    float row_scale = 1.f, row_shift = 0.f;
+                    if (with_scale_shift) {
+                        row_scale = scale_shift[scale_shift_d.off(row, 0)];
+                        row_shift = scale_shift[scale_shift_d.off(row, 1)];
+                    }
+                    for (dim_t d = 0; d < d_len; ++d) {
+                        const float v = table[table_d.off(row, d0 + d)];
+                        acc[d] += row_scale * v + row_shift;
+                    }
+                }
+                for (dim_t d = 0; d < d_len; ++d)
+                    dst[dst_d.off(b, d0 + d)]
+                            = saturate_and_round<dst_t>(scale * acc[d]);
+            }
+        }
+    });
+
+    return status::success;
+}
+
+using namespace data_type;
+template struct ref_embedding_bag_t<f32, f32>;
+template struct ref_embedding_bag_t<bf16, bf16>;
+template struct ref_embedding_bag_t<bf16, f32>;
+template struct ref_embedding_bag_t<s8, f32>;
+template struct ref_embedding_bag_t<u8, f32>;
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,67 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_REF_EMBEDDING_BAG_HPP
+#define CPU_REF_EMBEDDING_BAG_HPP
+
+#include "common/primitive.hpp"
+#include "common/type_helpers.hpp"
+#include "cpu/cpu_embedding_bag_pd.hpp"
+#include "cpu/platform.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+template <data_type_t table_type, data_type_t dst_type>
+struct ref_embedding_bag_t : public primitive_t {
+    struct pd_t : public cpu_embedding_bag_pd_t {
+        using cpu_embedding_bag_pd_t::cpu_embedding_bag_pd_t;
+
+        DECLARE_COMMON_PD_T("ref:any", ref_embedding_bag_t);
+
+        status_t init(engine_t *engine) {
+            bool ok = table_type == weights_md(0)->data_type
+                    && dst_type == dst_md()->data_type
+                    && platform::has_data_type_support(table_type)
+                    && platform::has_data_type_support(dst_type)
+                    && set_default_params() == status::success
+                    && attr()->has_default_values();
+            if (!ok) return status::unimplemented;
+
+            return status::success;
+        }
+    };
+
+    ref_embedding_bag_t(const pd_t *apd) : primitive_t(apd) {}
+
+    using table_t = typename prec_traits<table_type>::type;
+    using dst_t = typename prec_traits<dst_type>::type;
+
+    status_t execute(const exec_ctx_t &ctx) const override {
+        return execute_forward(ctx);
+    }
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+    status_t execute_forward(const exec_ctx_t &ctx) const;
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
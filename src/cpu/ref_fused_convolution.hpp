@@ -17,12 +17,14 @@
 #ifndef CPU_REF_FUSED_CONVOLUTION_HPP
 #define CPU_REF_FUSED_CONVOLUTION_HPP
 
+#include "common/dnnl_thread.hpp"
 #include "common/primitive.hpp"
 #include "common/primitive_iterator.hpp"
 #include "common/stream.hpp"
 
 #include "cpu/cpu_convolution_pd.hpp"
 #include "cpu/dw_convolution_utils.hpp"
+#include "cpu/platform.hpp"
 
 namespace dnnl {
 namespace impl {
@@ -35,6 +37,7 @@ struct ref_fused_convolution_fwd_t : public primitive_t {
             int op_arg;
             bool is_ctx_arg;
             bool is_const;
+            bool is_tiled; // the ctx arg is passed by minibatch tiles
             union {
                 size_t offset;
                 int ctx_arg;
@@ -47,17 +50,28 @@ struct ref_fused_convolution_fwd_t : public primitive_t {
             arg_info.op_arg = op_arg;
             arg_info.is_ctx_arg = true;
             arg_info.is_const = false; // unused
+            arg_info.is_tiled = false;
             arg_info.ctx_arg = ctx_arg;
             arg_info.md = glob_zero_md;
             info_.push_back(arg_info);
         }
 
+        // A ctx arg of which every tile is described by the tile_md
+        void append_tiled_ctx_arg(
+                int op_arg, const memory_desc_t *tile_md, bool is_const) {
+            append_ctx_arg(op_arg, op_arg);
+            info_.back().is_const = is_const;
+            info_.back().is_tiled = true;
+            info_.back().md = *tile_md;
+        }
+
         void append_inout_arg(int arg, size_t offset, const memory_desc_t *md,
                 bool is_const) {
             arg_info_t arg_info;
             arg_info.op_arg = arg;
             arg_info.is_ctx_arg = false;
             arg_info.is_const = is_const;
+            arg_info.is_tiled = false;
             arg_info.offset = offset;
             arg_info.md = *md;
             info_.push_back(arg_info);
@@ -86,23 +100,49 @@ struct ref_fused_convolution_fwd_t : public primitive_t {
 
         virtual status_t init(engine_t *engine) {
             bool ok = true && is_fwd()
-                    && (attr()->post_ops_.find(primitive_kind::sum) == -1);
+                    && (attr()->post_ops_.find(primitive_kind::sum) == -1)
+                    && !with_src_concat();
 
             if (!ok) return status::unimplemented;
 
-            CHECK(init_ops(engine));
+            const dim_t mb = desc()->src_desc.dims[0];
+            CHECK(init_ops(engine, mb));
+            src_md_ = *op_pds_.front()->src_md();
+            dst_md_ = *op_pds_.back()->dst_md();
+
+            // Run the chain by minibatch tiles so that the intermediate
+            // tensors of a tile stay in cache and the next op consumes them
+            // right after they are computed.
+            const dim_t mb_tile = get_mb_tile();
+            if (mb_tile < mb) {
+                auto full_op_pds = std::move(op_pds_);
+                auto full_args = std::move(args_);
+                const auto full_user_scratchpad_size = user_scratchpad_size_;
+                const auto full_inout_buffer_size = inout_buffer_size_;
+                op_pds_.clear();
+                args_.clear();
+
+                const status_t status = init_ops(engine, mb_tile);
+                const bool tiled_ok = status == status::success
+                        && *op_pds_.front()->src_md()
+                                == mb_tile_md(src_md_, mb_tile)
+                        && *op_pds_.back()->dst_md()
+                                == mb_tile_md(dst_md_, mb_tile);
+                if (tiled_ok) {
+                    mb_tile_ = mb_tile;
+                } else {
+                    op_pds_ = std::move(full_op_pds);
+                    args_ = std::move(full_args);
+                    user_scratchpad_size_ = full_user_scratchpad_size;
+                    inout_buffer_size_ = full_inout_buffer_size;
+                }
+            }
+
+            CHECK(init_scratchpad_memory(inout_buffer_size_));
             init_name();
             return status::success;
         }
 
-        const memory_desc_t *src_md(int index = 0) const override {
-            return op_pds_.front()->src_md(index);
-        }
-
-        const memory_desc_t *dst_md(int index = 0) const override {
-            return op_pds_.back()->dst_md(index);
-        }
-
         const memory_desc_t *weights_md(int index = 0) const override {
             return op_pds_.front()->weights_md(index); // for now
         }
@@ -129,6 +169,8 @@ struct ref_fused_convolution_fwd_t : public primitive_t {
         }
 
         size_t user_scratchpad_size_;
+        size_t inout_buffer_size_;
+        dim_t mb_tile_ = 0; // 0 if the ops are run for the whole minibatch
         std::vector<std::unique_ptr<primitive_desc_t>> op_pds_;
         std::vector<arg_cache_t> args_;
 
@@ -136,6 +178,43 @@ struct ref_fused_convolution_fwd_t : public primitive_t {
         std::string name_;
         const unsigned int max_fusions_ = 1;
 
+        static memory_desc_t mb_tile_md(const memory_desc_t &md, dim_t mb) {
+            memory_desc_t tile_md = md;
+            tile_md.dims[0] = mb;
+            tile_md.padded_dims[0] = mb;
+            return tile_md;
+        }
+
+        // A tile of images is a dense chunk of memory if the minibatch is
+        // the outermost and not blocked dimension
+        static bool is_mb_tiling_ok(const memory_desc_t &md) {
+            const memory_desc_wrapper mdw(md);
+            return mdw.is_blocking_desc() && mdw.is_dense(true)
+                    && mdw.offset0() == 0 && mdw.padded_offsets()[0] == 0
+                    && mdw.blocking_desc().strides[0] * mdw.dims()[0]
+                    == mdw.nelems(true);
+        }
+
+        // Returns the largest divisor of the minibatch for which the
+        // intermediate tensors fit into a half of L2 of all the threads
+        dim_t get_mb_tile() const {
+            const dim_t mb = MB();
+            const bool ok = mb > 1 && is_mb_tiling_ok(src_md_)
+                    && is_mb_tiling_ok(dst_md_)
+                    && attr()->post_ops_.find(primitive_kind::binary) == -1;
+            if (!ok) return mb;
+
+            const size_t l2_size = platform::get_per_core_cache_size(2)
+                    * dnnl_get_max_threads();
+            const size_t image_size = inout_buffer_size_ / mb;
+            const dim_t max_tile = nstl::max<dim_t>(
+                    1, (dim_t)(l2_size / 2 / nstl::max<size_t>(image_size, 1)));
+            dim_t mb_tile = nstl::min(mb, max_tile);
+            while (mb % mb_tile != 0)
+                --mb_tile;
+            return mb_tile;
+        }
+
         status_t append_op(primitive_desc_t *op_pd, size_t &sp_begin,
                 size_t &sp_end, engine_t *engine) {
             auto from_md = op_pds_.back()->dst_md();
@@ -178,8 +257,15 @@ struct ref_fused_convolution_fwd_t : public primitive_t {
             return status::success;
         }
 
-        status_t init_ops(engine_t *engine) {
+        status_t init_ops(engine_t *engine, dim_t mb) {
             using namespace data_type;
+            const bool is_tiled = mb < desc()->src_desc.dims[0];
+            convolution_desc_t cd = *desc();
+            if (is_tiled) {
+                cd.src_desc = mb_tile_md(src_md_, mb);
+                cd.dst_desc = mb_tile_md(cd.dst_desc, mb);
+            }
+
             primitive_attr_t root_attr(*attr());
             if (!root_attr.is_initialized()) return status::out_of_memory;
             root_attr.set_scratchpad_mode(scratchpad_mode::user);
@@ -195,7 +281,7 @@ struct ref_fused_convolution_fwd_t : public primitive_t {
             attr_1x1.set_scratchpad_mode(scratchpad_mode::user);
 
             dnnl_primitive_desc_iterator it(
-                    engine, op_desc(), &attr_1x1, nullptr);
+                    engine, (op_desc_t *)&cd, &attr_1x1, nullptr);
             if (!it.is_initialized()) return status::out_of_memory;
             ++it;
             primitive_desc_t *root_pd = it.fetch_once();
@@ -210,7 +296,11 @@ struct ref_fused_convolution_fwd_t : public primitive_t {
 
             // Create arg cache for the root pd
             arg_cache_t arg_cache;
-            arg_cache.append_ctx_arg(DNNL_ARG_SRC);
+            if (is_tiled)
+                arg_cache.append_tiled_ctx_arg(
+                        DNNL_ARG_SRC, root_pd->src_md(), true);
+            else
+                arg_cache.append_ctx_arg(DNNL_ARG_SRC);
             arg_cache.append_ctx_arg(DNNL_ARG_WEIGHTS);
             if (desc()->bias_desc.data_type != data_type::undef)
                 arg_cache.append_ctx_arg(DNNL_ARG_BIAS);
@@ -274,7 +364,11 @@ struct ref_fused_convolution_fwd_t : public primitive_t {
                 arg_cache_t arg_cache;
                 arg_cache.append_inout_arg(DNNL_ARG_SRC, inout_sp_offset_begin,
                         op->src_md(), true);
-                arg_cache.append_ctx_arg(DNNL_ARG_DST);
+                if (is_tiled)
+                    arg_cache.append_tiled_ctx_arg(
+                            DNNL_ARG_DST, op->dst_md(), false);
+                else
+                    arg_cache.append_ctx_arg(DNNL_ARG_DST);
                 arg_cache.append_ctx_arg(DNNL_ARG_WEIGHTS,
                         DNNL_ARG_ATTR_POST_OP_DW | DNNL_ARG_WEIGHTS);
                 if (op->weights_md(1)->data_type != data_type::undef)
@@ -300,8 +394,7 @@ struct ref_fused_convolution_fwd_t : public primitive_t {
             }
 
             assert(!op_pds_.empty());
-
-            CHECK(init_scratchpad_memory(inout_sp_offset_end));
+            inout_buffer_size_ = inout_sp_offset_end;
 
             return status::success;
         }
@@ -328,6 +421,8 @@ struct ref_fused_convolution_fwd_t : public primitive_t {
 
         void copy_from(const pd_t &other) {
             user_scratchpad_size_ = other.user_scratchpad_size_;
+            inout_buffer_size_ = other.inout_buffer_size_;
+            mb_tile_ = other.mb_tile_;
             op_pds_.clear();
             for (const auto &other_op_pd : other.op_pds_)
                 op_pds_.emplace_back(other_op_pd->clone());
@@ -358,16 +453,30 @@ struct ref_fused_convolution_fwd_t : public primitive_t {
 
         const auto &ctx_args = ctx.args();
         const auto op_count = primitives_.size();
-        std::vector<std::unique_ptr<memory_t>> inout_memory;
+        const dim_t n_tiles
+                = pd()->mb_tile_ ? pd()->MB() / pd()->mb_tile_ : 1;
 
+        for_(dim_t tile = 0; tile < n_tiles; ++tile)
         for (size_t i = 0; i < op_count; ++i) {
             const auto &op = primitives_[i];
             const auto &arg_cache = pd()->args_[i];
 
             exec_args_t exec_args;
+            std::vector<std::unique_ptr<memory_t>> inout_memory;
 
             for (const auto &arg_info : arg_cache.info()) {
-                if (arg_info.is_ctx_arg) {
+                if (arg_info.is_ctx_arg && arg_info.is_tiled) {
+                    const auto *mem = ctx_args.at(arg_info.ctx_arg).mem;
+                    const size_t tile_size
+                            = memory_desc_wrapper(arg_info.md).size();
+                    inout_memory.emplace_back(new memory_t(engine,
+                            &arg_info.md,
+                            mem->memory_storage()->get_sub_storage(
+                                    tile * tile_size, tile_size),
+                            false));
+                    exec_args[arg_info.op_arg].mem = inout_memory.back().get();
+                    exec_args[arg_info.op_arg].is_const = arg_info.is_const;
+                } else if (arg_info.is_ctx_arg) {
                     exec_args[arg_info.op_arg] = ctx_args.at(arg_info.ctx_arg);
                 } else {
                     inout_memory.emplace_back(new memory_t(engine, &arg_info.md,
@@ -0,0 +1,138 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <assert.h>
+#include <math.h>
+
+#include "common/bfloat16.hpp"
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/type_helpers.hpp"
+#include "cpu/primitive_attr_postops.hpp"
+#include "cpu/ref_group_normalization.hpp"
+
+#define DATA_OFF(f, n, c, d, h, w) \
+    (ndims == 2) ? (f).off(n, c) \
+                 : ((ndims == 3) ? (f).off(n, c, w) \
+                                 : ((ndims == 4) ? (f).off(n, c, h, w) \
+                                                 : (f).off(n, c, d, h, w)))
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+using namespace data_type;
+
+template <impl::data_type_t d_type>
+void ref_group_normalization_fwd_t<d_type>::execute_forward(
+        const exec_ctx_t &ctx) const {
+    /* fast return */
+    if (this->pd()->has_zero_dim_memory()) return;
+
+    auto src = CTX_IN_MEM(const data_t *, DNNL_ARG_SRC);
+    auto scaleshift = CTX_IN_MEM(const float *, DNNL_ARG_SCALE_SHIFT);
+
+    auto mean = pd()->stats_are_src()
+            ? const_cast<float *>(CTX_IN_MEM(const float *, DNNL_ARG_MEAN))
+            : CTX_OUT_MEM(float *, DNNL_ARG_MEAN);
+    auto variance = pd()->stats_are_src()
+            ? const_cast<float *>(CTX_IN_MEM(const float *, DNNL_ARG_VARIANCE))
+            : CTX_OUT_MEM(float *, DNNL_ARG_VARIANCE);
+
+    auto dst = CTX_OUT_MEM(data_t *, DNNL_ARG_DST);
+
+    const memory_desc_wrapper data_d(pd()->src_md());
+    const memory_desc_wrapper stat_d(pd()->stat_md());
+    const memory_desc_wrapper scaleshift_d(pd()->weights_md());
+
+    const auto ndims = data_d.ndims();
+    const dim_t N = pd()->MB();
+    const dim_t G = pd()->G();
+    const dim_t Cg = pd()->group_size();
+    const dim_t D = pd()->D();
+    const dim_t H = pd()->H();
+    const dim_t W = pd()->W();
+    const dim_t group_nelems = Cg * D * H * W;
+
+    const float eps = pd()->desc()->group_norm_epsilon;
+    const bool use_scaleshift = pd()->use_scaleshift();
+    const bool calculate_stats = !pd()->stats_are_src();
+    const bool save_stats = pd()->is_training();
+
+    const auto &po = pd()->attr()->post_ops_;
+    const bool with_eltwise = po.len() == 1;
+    std::unique_ptr<ref_eltwise_scalar_fwd_t> eltwise;
+    if (with_eltwise)
+        eltwise.reset(new ref_eltwise_scalar_fwd_t(po.entry_[0].eltwise));
+
+    parallel_nd(N, G, [&](dim_t n, dim_t g) {
+        const dim_t c_start = g * Cg;
+        const auto s_off = stat_d.off(n, g);
+
+        float v_mean = calculate_stats ? 0 : mean[s_off];
+        float v_variance = calculate_stats ? 0 : variance[s_off];
+
+        if (calculate_stats) {
+            for_(dim_t c = c_start; c < c_start + Cg; ++c)
+            for_(dim_t d = 0; d < D; ++d)
+            for_(dim_t h = 0; h < H; ++h)
+            for (dim_t w = 0; w < W; ++w)
+                v_mean += (float)src[DATA_OFF(data_d, n, c, d, h, w)];
+            v_mean /= group_nelems;
+
+            for_(dim_t c = c_start; c < c_start + Cg; ++c)
+            for_(dim_t d = 0; d < D; ++d)
+            for_(dim_t h = 0; h < H; ++h)
+            for (dim_t w = 0; w < W; ++w) {
+                float m = (float)src[DATA_OFF(data_d, n, c, d, h, w)] - v_mean;
+                v_variance += m * m;
+            }
+            v_variance /= group_nelems;
+        }
+
+        const float inv_sqrtvar = 1.f / sqrtf(v_variance + eps);
+
+        for (dim_t c = c_start; c < c_start + Cg; ++c) {
+            const float sm = use_scaleshift
+                    ? scaleshift[scaleshift_d.off(0, c)] * inv_sqrtvar
+                    : inv_sqrtvar;
+            const float sv
+                    = use_scaleshift ? scaleshift[scaleshift_d.off(1, c)] : 0;
+            for_(dim_t d = 0; d < D; ++d)
+            for_(dim_t h = 0; h < H; ++h)
+            for (dim_t w = 0; w < W; ++w) {
+                const auto d_off = DATA_OFF(data_d, n, c, d, h, w);
+                float res = sm * ((float)src[d_off] - v_mean) + sv;
+                if (with_eltwise) res = eltwise->compute_scalar(res);
+                dst[d_off] = res;
+            }
+        }
+
+        if (calculate_stats && save_stats) {
+            mean[s_off] = v_mean;
+            variance[s_off] = v_variance;
+        }
+    });
+}
+
+template struct ref_group_normalization_fwd_t<f32>;
+template struct ref_group_normalization_fwd_t<bf16>;
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino^=l0,\:0,N-s
@@ -125,6 +125,9 @@ using namespace data_type;
 template struct ref_inner_product_fwd_t<f32>;
 template struct ref_inner_product_fwd_t<bf16, bf16, bf16, f32>;
 template struct ref_inner_product_fwd_t<bf16, bf16, f32, f32>;
+template struct ref_inner_product_fwd_t<f32, s8, f32, f32>;
+template struct ref_inner_product_fwd_t<bf16, s8, f32, f32>;
+template struct ref_inner_product_fwd_t<bf16, s8, bf16, f32>;
 template struct ref_inner_product_fwd_t<u8, s8, f32, s32>;
 template struct ref_inner_product_fwd_t<u8, s8, s32, s32>;
 template struct ref_inner_product_fwd_t<u8, s8, s8, s32>;
@@ -47,9 +47,9 @@ struct ref_inner_product_fwd_t : public primitive_t {
             bool ok = is_fwd()
                     && expect_data_types(src_type, wei_type, data_type::undef,
                             dst_type, acc_type)
-                    && platform::has_data_type_support(src_type)
-                    && platform::has_data_type_support(wei_type)
-                    && platform::has_data_type_support(dst_type)
+                    && platform::has_data_type_storage_support(src_type)
+                    && platform::has_data_type_storage_support(wei_type)
+                    && platform::has_data_type_storage_support(dst_type)
                     && IMPLICATION(with_bias(),
                             IMPLICATION(src_type == u8,
                                     utils::one_of(bias_md_.data_type, f32, s32,
@@ -67,7 +67,8 @@ struct ref_inner_product_fwd_t : public primitive_t {
         bool output_scales_mask_ok() const {
             using namespace data_type;
             const auto &mask = attr()->output_scales_.mask_;
-            return IMPLICATION(!utils::one_of(src_type, s8, u8),
+            // the scales of s8 weights are passed as output scales
+            return IMPLICATION(wei_type != s8,
                            attr()->output_scales_.has_default_values())
                     && (mask == 0 || mask == 1 << 1);
         }
@@ -57,11 +57,22 @@ void ref_layer_normalization_fwd_t<d_type>::execute_forward(
 
     auto dst = CTX_OUT_MEM(data_t *, DNNL_ARG_DST);
 
+    // the residual input and the optional output for the sum
+    auto src_1 = CTX_IN_MEM(const data_t *, DNNL_ARG_SRC_1);
+    auto dst_1 = CTX_OUT_MEM(data_t *, DNNL_ARG_DST_1);
+
     const memory_desc_wrapper src_d(pd()->src_md());
     const memory_desc_wrapper dst_d(pd()->dst_md());
     const memory_desc_wrapper stat_d(pd()->stat_md());
     const memory_desc_wrapper scaleshift_d(pd()->weights_md());
 
+    const bool fuse_residual_add = pd()->fuse_residual_add();
+    auto src_val = [&](size_t off) {
+        float v = maybe_up_convert(src[off]);
+        if (fuse_residual_add) v += maybe_up_convert(src_1[off]);
+        return v;
+    };
+
     const dim_t N = pd()->across_axis();
     const dim_t C = pd()->norm_axis();
 
@@ -88,11 +99,11 @@ void ref_layer_normalization_fwd_t<d_type>::execute_forward(
 
         if (calculate_stats) {
             for (dim_t c = 0; c < C; ++c)
-                v_mean += maybe_up_convert(src[src_d.off_l(n * C + c)]);
+                v_mean += src_val(src_d.off_l(n * C + c));
             v_mean /= C;
 
             for (dim_t c = 0; c < C; ++c) {
-                float m = src[src_d.off_l(n * C + c)] - v_mean;
+                float m = src_val(src_d.off_l(n * C + c)) - v_mean;
                 v_variance += m * m;
             }
             v_variance /= C;
@@ -109,7 +120,9 @@ void ref_layer_normalization_fwd_t<d_type>::execute_forward(
             const size_t dst_off = dst_d.off_l(n * C + c),
                          src_off = src_d.off_l(n * C + c);
 
-            dst[dst_off] = sm * (maybe_up_convert(src[src_off]) - v_mean) + sv;
+            const float s = src_val(src_off);
+            dst[dst_off] = sm * (s - v_mean) + sv;
+            if (dst_1) dst_1[src_off] = s;
         }
 
         if (calculate_stats) {
@@ -0,0 +1,108 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+#include <math.h>
+
+#include "common/bfloat16.hpp"
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/type_helpers.hpp"
+
+#include "cpu/cpu_optimizer_utils.hpp"
+#include "cpu/ref_optimizer.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+using namespace data_type;
+
+namespace {
+float load(const void *ptr, data_type_t dt, dim_t off) {
+    if (dt == bf16) return static_cast<const bfloat16_t *>(ptr)[off];
+    return static_cast<const float *>(ptr)[off];
+}
+
+void store(void *ptr, data_type_t dt, dim_t off, float v) {
+    if (dt == bf16)
+        static_cast<bfloat16_t *>(ptr)[off] = v;
+    else
+        static_cast<float *>(ptr)[off] = v;
+}
+} // namespace
+
+status_t ref_optimizer_t::execute_ref(const exec_ctx_t &ctx) const {
+    if (pd()->has_zero_dim_memory()) return status::success;
+
+    auto hp = CTX_IN_MEM(const float *, DNNL_ARG_HYPERPARAMETERS);
+    auto diff_weights = CTX_IN_MEM(const void *, DNNL_ARG_DIFF_WEIGHTS);
+    auto weights = CTX_OUT_MEM(float *, DNNL_ARG_WEIGHTS);
+    auto moment_1 = CTX_OUT_MEM(float *, DNNL_ARG_MOMENT_1);
+    auto moment_2 = CTX_OUT_MEM(float *, DNNL_ARG_MOMENT_2);
+    auto dst = CTX_OUT_MEM(void *, DNNL_ARG_DST);
+
+    const int n_states = pd()->n_states();
+    if ((n_states >= 1 && !moment_1) || (n_states >= 2 && !moment_2))
+        return status::invalid_arguments;
+
+    const auto scratchpad = ctx.get_scratchpad_grantor();
+    double *partials = scratchpad.template get<double>(
+            memory_tracking::names::key_optimizer_reduction);
+
+    optimizer_utils::coeffs_t c;
+    CHECK(optimizer_utils::init_coeffs(c, pd(), hp, diff_weights, partials));
+
+    const memory_desc_wrapper w_d(pd()->weights_md());
+    const memory_desc_wrapper dw_d(pd()->diff_weights_md());
+    const memory_desc_wrapper d_d(pd()->dst_md());
+    const data_type_t dw_dt = dw_d.data_type();
+    const data_type_t d_dt = d_d.data_type();
+    const bool is_adam = pd()->is_adam();
+    const bool with_state = pd()->n_states() > 0;
+    const bool with_dst = pd()->with_dst();
+
+    parallel_nd(pd()->nelems(), [&](dim_t e) {
+        const dim_t w_off = w_d.off_l(e);
+        const float w = weights[w_off];
+        const float g = c.grad_scale * load(diff_weights, dw_dt, dw_d.off_l(e))
+                + c.weight_decay * w;
+
+        float m = g;
+        if (with_state) {
+            m = c.beta1 * moment_1[w_off] + c.one_minus_beta1 * g;
+            moment_1[w_off] = m;
+        }
+
+        float upd = m;
+        if (is_adam) {
+            const float v
+                    = c.beta2 * moment_2[w_off] + c.one_minus_beta2 * g * g;
+            moment_2[w_off] = v;
+            upd = m / (sqrtf(v) * c.inv_sqrt_bias_correction2 + c.eps);
+        }
+
+        const float w_new = c.weights_scale * w - c.step_size * upd;
+        weights[w_off] = w_new;
+        if (with_dst) store(dst, d_dt, d_d.off_l(e), w_new);
+    });
+
+    return status::success;
+}
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino^=l0,\:0,N-s
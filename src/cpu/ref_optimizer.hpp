@@ -0,0 +1,80 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+#ifndef CPU_REF_OPTIMIZER_HPP
+#define CPU_REF_OPTIMIZER_HPP
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/platform.hpp"
+
+#include "cpu/cpu_optimizer_pd.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+struct ref_optimizer_t : public primitive_t {
+    struct pd_t : public cpu_optimizer_pd_t {
+        using cpu_optimizer_pd_t::cpu_optimizer_pd_t;
+
+        DECLARE_COMMON_PD_T("ref:any", ref_optimizer_t);
+
+        status_t init(engine_t *engine) {
+            using namespace data_type;
+
+            bool ok = set_default_params() == status::success
+                    && platform::has_data_type_support(
+                            diff_weights_md()->data_type)
+                    && IMPLICATION(with_dst(),
+                            platform::has_data_type_support(
+                                    dst_md()->data_type))
+                    && memory_desc_wrapper(weights_md()).is_blocking_desc()
+                    && memory_desc_wrapper(diff_weights_md())
+                               .is_blocking_desc()
+                    && IMPLICATION(with_clipping(),
+                            memory_desc_wrapper(diff_weights_md())
+                                    .is_dense(true))
+                    && IMPLICATION(with_dst(),
+                            memory_desc_wrapper(dst_md()).is_blocking_desc())
+                    && attr()->has_default_values();
+            if (!ok) return status::unimplemented;
+
+            init_scratchpad();
+            return status::success;
+        }
+    };
+
+    ref_optimizer_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t execute(const exec_ctx_t &ctx) const override {
+        return execute_ref(ctx);
+    }
+
+private:
+    status_t execute_ref(const exec_ctx_t &ctx) const;
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino^=l0,\:0,N-s
@@ -165,7 +165,7 @@ void ref_pooling_fwd_t<data_type, acc_type>::execute_forward(
     const int OW = pd()->OW();
 
     if (alg == alg_kind::pooling_max) {
-        parallel_nd(MB, OC, OD, OH, OW,
+        parallel_nd_dynamic(MB, OC, OD, OH, OW,
                 [&](int mb, int oc, int od, int oh, int ow) {
                     auto data_p_off = get_offset(dst_d, mb, oc, od, oh, ow);
                     auto data_l_off
@@ -183,7 +183,7 @@ void ref_pooling_fwd_t<data_type, acc_type>::execute_forward(
                     dst[data_p_off] = cpu::saturate_and_round<data_t>(res);
                 });
     } else {
-        parallel_nd(MB, OC, OD, OH, OW,
+        parallel_nd_dynamic(MB, OC, OD, OH, OW,
                 [&](int mb, int oc, int od, int oh, int ow) {
                     auto data_p_off = get_offset(dst_d, mb, oc, od, oh, ow);
                     auto data_l_off
@@ -208,11 +208,14 @@ void ref_pooling_bwd_t<data_type>::execute_backward(
 
     auto diff_dst = CTX_IN_MEM(const data_t *, DNNL_ARG_DIFF_DST);
     auto ws = CTX_IN_MEM(const unsigned char *, DNNL_ARG_WORKSPACE);
+    auto src = CTX_IN_MEM(const data_t *, DNNL_ARG_SRC);
     auto diff_src = CTX_OUT_MEM(data_t *, DNNL_ARG_DIFF_SRC);
 
     const memory_desc_wrapper diff_dst_d(pd()->diff_dst_md());
     const memory_desc_wrapper diff_src_d(pd()->diff_src_md());
     const memory_desc_wrapper ws_d(pd()->workspace_md());
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const bool recompute_argmax = pd()->recompute_argmax();
 
     const auto alg = pd()->desc()->alg_kind;
 
@@ -241,12 +244,44 @@ void ref_pooling_bwd_t<data_type>::execute_backward(
         }
     };
 
+    // The same search as on forward: the first maximum in the window wins.
+    auto argmax = [=](int mb, int oc, int od, int oh, int ow) {
+        float max = numeric_limits<data_t>::lowest();
+        int index = 0;
+        for (int kd = 0; kd < KD; ++kd) {
+            const int id = od * SD - padF + kd * (DD + 1);
+            if (id < 0 || id >= ID) continue;
+            for (int kh = 0; kh < KH; ++kh) {
+                const int ih = oh * SH - padT + kh * (DH + 1);
+                if (ih < 0 || ih >= IH) continue;
+                for (int kw = 0; kw < KW; ++kw) {
+                    const int iw = ow * SW - padL + kw * (DW + 1);
+                    if (iw < 0 || iw >= IW) continue;
+
+                    const float s
+                            = src[get_offset(src_d, mb, oc, id, ih, iw)];
+                    if (s > max) {
+                        max = s;
+                        index = (kd * KH + kh) * KW + kw;
+                    }
+                }
+            }
+        }
+        return index;
+    };
+
     auto ker_max
             = [=](const data_t *d, int mb, int oc, int od, int oh, int ow) {
-                  const auto ws_off = get_offset(ws_d, mb, oc, od, oh, ow);
-                  const int index = ws_d.data_type() == data_type::u8
-                          ? (int)ws[ws_off]
-                          : ((int *)ws)[ws_off];
+                  int index = 0;
+                  if (recompute_argmax)
+                      index = argmax(mb, oc, od, oh, ow);
+                  else {
+                      const auto ws_off
+                              = get_offset(ws_d, mb, oc, od, oh, ow);
+                      index = ws_d.data_type() == data_type::u8
+                              ? (int)ws[ws_off]
+                              : ((int *)ws)[ws_off];
+                  }
                   const int kd = (index / KW) / KH;
                   const int kh = (index / KW) % KH;
                   const int kw = index % KW;
@@ -97,7 +97,10 @@ struct ref_pooling_bwd_t : public primitive_t {
                     && attr()->has_default_values();
             if (!ok) return status::unimplemented;
 
-            if (desc()->alg_kind == alg_kind::pooling_max) {
+            if (recompute_argmax()) {
+                if (src_md()->data_type != data_type)
+                    return status::unimplemented;
+            } else if (desc()->alg_kind == alg_kind::pooling_max) {
                 init_default_ws();
                 if (!compare_ws(hint_fwd_pd_)) return status::unimplemented;
             }
@@ -83,6 +83,10 @@ struct ref_shuffle_t : public primitive_t {
 
     ~ref_shuffle_t() { free(rev_transposed_); }
 
+    size_t constant_memory_size() const override {
+        return pd()->axis_size() * sizeof(int);
+    }
+
     status_t execute(const exec_ctx_t &ctx) const override {
         const data_type_t data_type = pd()->data_md()->data_type;
         switch (types::data_type_size(data_type)) {
@@ -35,6 +35,7 @@ void ref_softmax_fwd_t<data_type>::execute_forward_dense(
     auto dst = CTX_OUT_MEM(data_t *, DNNL_ARG_DST);
 
     const auto ou_stride = pd()->outer_stride();
+    const float oscale = pd()->attr()->output_scales_.scales_[0];
 
     parallel_nd(outer_size_, [&](int ou) {
         const data_t *src_data = src + ou * ou_stride;
@@ -111,7 +112,7 @@ void ref_softmax_fwd_t<data_type>::execute_forward_dense(
 
         // scal
         if (pd()->is_softmax()) {
-            space_denom = space_denom ? (1.f / space_denom) : 1.f;
+            space_denom = space_denom ? (oscale / space_denom) : oscale;
         } else if (pd()->is_logsoftmax()) {
             space_denom = logf(space_denom);
         }
@@ -119,7 +120,7 @@ void ref_softmax_fwd_t<data_type>::execute_forward_dense(
             if (pd()->is_softmax()) {
                 dst_data[c] = dst_data[c] * space_denom;
             } else if (pd()->is_logsoftmax()) {
-                dst_data[c] = dst_data[c] - space_denom;
+                dst_data[c] = oscale * (dst_data[c] - space_denom);
             }
         }
     });
@@ -133,6 +134,7 @@ void ref_softmax_fwd_t<data_type>::execute_forward_generic(
     auto dst = CTX_OUT_MEM(data_t *, DNNL_ARG_DST);
 
     const memory_desc_wrapper data_d(pd()->src_md());
+    const float oscale = pd()->attr()->output_scales_.scales_[0];
 
     parallel_nd(outer_size_, [&](int ou) {
         float space_max_val = 0, space_denom_val = 0;
@@ -176,9 +178,9 @@ void ref_softmax_fwd_t<data_type>::execute_forward_generic(
             for (int c = 0; c < channels_; c++) {
                 size_t off = data_d.off_l(ou_in_offset + c * inner_size_);
                 if (pd()->is_softmax()) {
-                    dst[off] = dst[off] / space_denom[in];
+                    dst[off] = oscale * dst[off] / space_denom[in];
                 } else if (pd()->is_logsoftmax()) {
-                    dst[off] = dst[off] - space_denom[in];
+                    dst[off] = oscale * (dst[off] - space_denom[in]);
                 }
             }
         }
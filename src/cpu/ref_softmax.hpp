@@ -40,7 +40,9 @@ struct ref_softmax_fwd_t : public primitive_t {
 
         status_t init(engine_t *engine) {
             bool ok = true && is_fwd() && src_md()->data_type == data_type
-                    && attr()->has_default_values();
+                    && attr()->has_default_values(
+                            primitive_attr_t::skip_mask_t::oscale)
+                    && attr_oscale_ok();
             if (!ok) return status::unimplemented;
 
             init_scratchpad();
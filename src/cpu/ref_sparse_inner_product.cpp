@@ -0,0 +1,83 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/type_helpers.hpp"
+
+#include "cpu/ref_sparse_inner_product.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+void ref_sparse_inner_product_fwd_t::execute_forward(
+        const exec_ctx_t &ctx) const {
+    auto src = CTX_IN_MEM(const float *, DNNL_ARG_SRC);
+    auto weights = CTX_IN_MEM(const char *, DNNL_ARG_WEIGHTS);
+    auto bias = CTX_IN_MEM(const float *, DNNL_ARG_BIAS);
+    auto dst = CTX_OUT_MEM(float *, DNNL_ARG_DST);
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+    const memory_desc_wrapper weights_d(pd()->weights_md(0));
+    const memory_desc_wrapper bias_d(pd()->weights_md(1));
+
+    const auto MB = pd()->MB();
+    const auto OC = pd()->OC();
+    const auto IC = pd()->IC();
+
+    const auto &sd = weights_d.sparse_desc();
+    const dim_t OCB = sd.block_dims[0], ICB = sd.block_dims[1];
+    const float *values = reinterpret_cast<const float *>(weights);
+    const int32_t *row_ptr
+            = reinterpret_cast<const int32_t *>(weights + sd.row_ptr_offset);
+    const int32_t *col_idx
+            = reinterpret_cast<const int32_t *>(weights + sd.col_idx_offset);
+
+    const auto &oscale = pd()->attr()->output_scales_;
+    const dim_t scale_stride = oscale.mask_ == 0 ? 0 : 1;
+
+    parallel_nd(MB, OC, [&](dim_t mb, dim_t oc) {
+        const dim_t ocb = oc / OCB;
+        float a = bias ? bias[bias_d.off(oc)] : 0.f;
+        for (dim_t blk = row_ptr[ocb]; blk < row_ptr[ocb + 1]; ++blk) {
+            const float *v = values + (blk * OCB + oc % OCB) * ICB;
+            const dim_t ic_start = col_idx[blk] * ICB;
+            const dim_t ic_work = nstl::min(ICB, IC - ic_start);
+            for (dim_t icb = 0; icb < ic_work; ++icb)
+                a += v[icb] * src[src_d.off(mb, ic_start + icb)];
+        }
+        a *= oscale.scales_[oc * scale_stride];
+
+        const dim_t dst_off = dst_d.off(mb, oc);
+
+        ref_post_ops_t::args_t args;
+        args.dst_val = dst[dst_off];
+        args.ctx = &ctx;
+        args.l_offset = mb * OC + oc;
+        args.dst_md = pd()->dst_md();
+        ref_post_ops->execute(a, args);
+
+        dst[dst_off] = a;
+    });
+}
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
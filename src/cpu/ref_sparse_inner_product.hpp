@@ -0,0 +1,100 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_REF_SPARSE_INNER_PRODUCT_HPP
+#define CPU_REF_SPARSE_INNER_PRODUCT_HPP
+
+#include <assert.h>
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/primitive_attr_postops.hpp"
+
+#include "cpu/cpu_inner_product_pd.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+// f32 forward inner product with weights in the block compressed sparse row
+// format, the zero blocks of the weights are skipped
+struct ref_sparse_inner_product_fwd_t : public primitive_t {
+    struct pd_t : public cpu_inner_product_fwd_pd_t {
+        using cpu_inner_product_fwd_pd_t::cpu_inner_product_fwd_pd_t;
+
+        DECLARE_COMMON_PD_T("ref:sparse", ref_sparse_inner_product_fwd_t);
+
+        status_t init(engine_t *engine) {
+            using namespace data_type;
+            using smask_t = primitive_attr_t::skip_mask_t;
+
+            const auto &oscale = attr()->output_scales_;
+            bool ok = is_fwd() && ndims() == 2
+                    && memory_desc_wrapper(weights_md_).is_sparse_desc()
+                    && expect_data_types(f32, f32, data_type::undef, f32, f32)
+                    && IMPLICATION(with_bias(), bias_md_.data_type == f32)
+                    && set_default_formats() == status::success
+                    && attr()->has_default_values(
+                            smask_t::oscale | smask_t::post_ops)
+                    && utils::one_of(oscale.mask_, 0, 1 << 1);
+            return ok ? status::success : status::unimplemented;
+        }
+
+        bool supports_sparse_weights() const override { return true; }
+
+    private:
+        status_t set_default_formats() {
+            using namespace format_tag;
+            if (src_md_.format_kind == format_kind::any)
+                CHECK(memory_desc_init_by_tag(src_md_, nc));
+            if (dst_md_.format_kind == format_kind::any)
+                CHECK(memory_desc_init_by_tag(dst_md_, nc));
+            if (bias_md_.format_kind == format_kind::any)
+                CHECK(memory_desc_init_by_tag(bias_md_, x));
+            return status::success;
+        }
+    };
+
+    ref_sparse_inner_product_fwd_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override {
+        ref_post_ops
+                = utils::make_unique<ref_post_ops_t>(pd()->attr()->post_ops_);
+        if (!ref_post_ops) return status::out_of_memory;
+        return status::success;
+    }
+
+    status_t execute(const exec_ctx_t &ctx) const override {
+        execute_forward(ctx);
+        return status::success;
+    }
+
+private:
+    void execute_forward(const exec_ctx_t &ctx) const;
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+    std::unique_ptr<ref_post_ops_t> ref_post_ops;
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -159,7 +159,7 @@ rnn_cell_execution_sig((_ref_rnn_common_t<aprop, src_type, weights_type,
             ? brgemm_kernel_iter_b1_[iter_desc_idx].get()
             : brgemm_kernel_iter_b0_[iter_desc_idx].get();
 
-    parallel(max_nthr, [&](const int ithr, const int nthr) {
+    auto cell_body = [&](const int ithr, const int nthr) {
         gemm_acc_t *amx_buffer = nullptr;
         const src_iter_t **A_addr = nullptr;
         weights_t **B_addr = nullptr;
@@ -325,7 +325,13 @@ rnn_cell_execution_sig((_ref_rnn_common_t<aprop, src_type, weights_type,
             ++start;
             nd_iterator_step(nb_i, Nblocking, mb, rnn.M_blocks);
         }
-    });
+    };
+    // In the persistent mode every thread of the team runs the cell and
+    // picks its blocks, the same ones at every iteration
+    if (rnn.brgemm_persistent)
+        cell_body(OMP_GET_THREAD_NUM(), OMP_GET_NUM_THREADS());
+    else
+        parallel(max_nthr, cell_body);
     if (rnn.unfused_post_gemm) {
         rnn_postgemm_->execute(rnn, cell_position, ws_gates_, scratch_gates_,
                 dst_postgemm, dst_iter_c_, src_iter_, src_iter_c_,
@@ -587,14 +593,50 @@ dnnl_status_t common_bwd_cell_exec_template(T1 gemm_layer_f, T2 gemm_iter_f,
     return dnnl_success;
 }
 
+#if DNNL_X64
+// Computes C[mb][N] = A[mb][K] * B[K][N] (row-major) by blocks of
+// m_block x n_block, K being the whole reduction dimension of the kernels
+template <typename a_t, typename b_t, typename c_t>
+void brgemm_bwd_data_gemm(const rnn_utils::rnn_conf_t &rnn,
+        const brgemm_kernel_t *kernel, const brgemm_kernel_t *kernel_n_tail,
+        dim_t N, const a_t *A, dim_t LDA, const b_t *B, c_t *C, dim_t LDC) {
+    const dim_t N_blocks = utils::div_up(N, rnn.n_block);
+    parallel_nd(rnn.M_blocks, N_blocks, [&](dim_t mb, dim_t nb) {
+        const dim_t m = mb * rnn.m_block;
+        const dim_t n = nb * rnn.n_block;
+        const a_t *A_m = A + m * LDA;
+        const b_t *B_n = B + n;
+        const bool do_n_tail = (n + rnn.n_block) > N;
+        brgemm_kernel_execute(do_n_tail ? kernel_n_tail : kernel, 1,
+                (void **)&A_m, (void **)&B_n, (void *)(C + m * LDC + n));
+    });
+}
+#endif
+
 template <>
 rnn_cell_execution_sig(ref_rnn_bwd_f32_t::cell_execution_ref) {
     auto gemm_layer = [&](const float *A, const float *B, float *C) {
+#if DNNL_X64
+        if (rnn.use_brgemm_bwd_data) {
+            brgemm_bwd_data_gemm(rnn, brgemm_kernel_bwd_layer_.get(),
+                    brgemm_kernel_bwd_layer_N_tail_.get(), rnn.slc, B,
+                    rnn.scratch_gates_ld, A, C, rnn.ws_diff_states_layer_ld);
+            return dnnl_success;
+        }
+#endif
         return (this->*gemm_layer_func)('N', 'N', rnn.slc, rnn.mb,
                 rnn.n_gates * rnn.dhc, 1.0, A, rnn.weights_layer_ld, B,
                 rnn.scratch_gates_ld, 0.0, C, rnn.ws_diff_states_layer_ld);
     };
     auto gemm_iter = [&](const float *A, const float *B, float *C) {
+#if DNNL_X64
+        if (rnn.use_brgemm_bwd_data) {
+            brgemm_bwd_data_gemm(rnn, brgemm_kernel_bwd_iter_.get(),
+                    brgemm_kernel_bwd_iter_N_tail_.get(), rnn.sic, B,
+                    rnn.scratch_gates_ld, A, C, rnn.ws_diff_states_iter_ld);
+            return dnnl_success;
+        }
+#endif
         return (this->*gemm_iter_func)('N', 'N', rnn.sic, rnn.mb,
                 rnn.n_gates * rnn.dhc, 1.0, A, rnn.weights_iter_ld, B,
                 rnn.scratch_gates_ld, 0.0, C, rnn.ws_diff_states_iter_ld);
@@ -621,6 +663,35 @@ rnn_cell_execution_sig(ref_rnn_bwd_f32_t::cell_execution_ref) {
                 rnn.scratch_diff_ht_ld, B, rnn.ws_ht_ld, 1.0f, C,
                 rnn.diff_weights_projection_ld);
     };
+
+    if (rnn.recompute_gates) {
+        // The forward cell is computed again to get the activated gates. The
+        // weights are in the backward layout, hence transposed. The states
+        // are in the workspace already, so the recomputed ones are dropped
+        // to the scratch, with the leading dimensions of the workspace as
+        // the flags of the destinations are cleared from the cell position.
+        CHECK(gemm('T', 'N', rnn.n_gates * rnn.dhc, rnn.mb, rnn.slc, 1.0,
+                w_layer_[0], rnn.weights_layer_ld, src_layer_,
+                rnn.src_layer_ld(cell_position), 0.0, scratch_gates_,
+                rnn.scratch_gates_ld));
+        CHECK(gemm('T', 'N', rnn.n_gates * rnn.dhc, rnn.mb, rnn.sic, 1.0,
+                w_iter_[0], rnn.weights_iter_ld, src_iter_,
+                rnn.src_iter_ld(cell_position), 1.0, scratch_gates_,
+                rnn.scratch_gates_ld));
+
+        cell_position_t recompute_position = middle_cell;
+        for (auto flag : {first_iter, first_layer, c_state_first_iter})
+            if (cell_position & flag) recompute_position |= flag;
+        float *recompute_dst_layer = scratch_cell_;
+        float *recompute_dst_iter_c = scratch_cell_
+                + rnn.ws_states_layer_nld * rnn.ws_states_layer_ld;
+        rnn_postgemm_recompute_->execute(rnn, recompute_position, ws_gates_,
+                scratch_gates_, recompute_dst_layer, recompute_dst_iter_c,
+                src_iter_, src_iter_c_, nullptr, nullptr, nullptr, nullptr,
+                nullptr, nullptr, weights_peephole_, bias_[0], ws_grid_,
+                nullptr, nullptr, nullptr, rnn.dhc * sizeof(float));
+    }
+
     return common_bwd_cell_exec_template(gemm_layer, gemm_iter, gemm_proj,
             gemm_weights_layer, gemm_weights_iter, gemm_weights_proj,
             rnn_postgemm_, rnn, cell_position, dst_layer_, dst_iter_c_,
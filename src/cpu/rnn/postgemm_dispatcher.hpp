@@ -72,7 +72,7 @@ struct rnn_postgemm_dispatcher {
         if (pd->attr()->rnn_tparams_.test_mode_) {
             auto ngates = utils::map(pd->cell_kind(), 0, alg_kind::vanilla_rnn,
                     1, alg_kind::vanilla_lstm, 4, alg_kind::vanilla_gru, 3,
-                    alg_kind::lbr_gru, 3);
+                    alg_kind::lbr_gru, 3, alg_kind::vanilla_augru, 3);
             assert(pd->attr()->rnn_tparams_.ngates_ == ngates);
             MAYBE_UNUSED(ngates);
         }
@@ -81,7 +81,8 @@ struct rnn_postgemm_dispatcher {
             case alg_kind::vanilla_lstm:
                 postgemm_func = &class_name::lstm_postgemm;
                 // used for int8 requantization after projection
-                postgemm_part2_func = pd->is_lstm_projection() && pd_->is_fwd()
+                postgemm_part2_func = pd->is_lstm_projection()
+                                && aprop == prop_kind::forward
                         ? &class_name::lstm_projection_postgemm
                         : nullptr;
                 break;
@@ -105,6 +106,7 @@ struct rnn_postgemm_dispatcher {
                 }
                 break;
             case alg_kind::vanilla_gru:
+            case alg_kind::vanilla_augru:
                 postgemm_func = &class_name::gru_part1_postgemm;
                 postgemm_part2_func = &class_name::gru_part2_postgemm;
                 break;
@@ -128,7 +130,7 @@ struct rnn_postgemm_dispatcher {
         size_t states_nelems = rnn.ws_states_layer_nld * rnn.ws_states_layer_ld;
         size_t gates_nelems = rnn.scratch_gates_nld * rnn.scratch_gates_ld;
 
-        if (pd_->is_fwd()) {
+        if (aprop == prop_kind::forward) {
             msan_unpoison(dst_layer_, sizeof(*dst_layer_) * states_nelems);
             msan_unpoison(dst_iter_, sizeof(*dst_iter_) * states_nelems);
             if (rnn.is_training)
@@ -157,7 +159,7 @@ struct rnn_postgemm_dispatcher {
     rnn_postgemm_sig(execute) {
 #if DNNL_X64
         if (rnn_postgemm_) {
-            rnn_postgemm_->execute(rnn, cell_position, ws_gates_,
+            rnn_postgemm_->execute<aprop>(rnn, cell_position, ws_gates_,
                     scratch_gates_, dst_layer_, dst_iter_c_, src_iter_,
                     src_iter_c_, diff_src_layer_, diff_src_iter_,
                     diff_src_iter_c_, diff_dst_layer_, diff_dst_iter_,
@@ -184,7 +186,7 @@ struct rnn_postgemm_dispatcher {
     rnn_postgemm_sig(execute_part2) {
 #if DNNL_X64
         if (rnn_postgemm_part2_) {
-            rnn_postgemm_part2_->execute(rnn, cell_position, ws_gates_,
+            rnn_postgemm_part2_->execute<aprop>(rnn, cell_position, ws_gates_,
                     scratch_gates_, dst_layer_, dst_iter_c_, src_iter_,
                     src_iter_c_, diff_src_layer_, diff_src_iter_,
                     diff_src_iter_c_, diff_dst_layer_, diff_dst_iter_,
@@ -232,10 +234,10 @@ private:
 
         if (pd_->attr()->rnn_tparams_.test_mode_) return;
 
-        const bool jit_fwd = pd_->is_fwd()
+        const bool jit_fwd = aprop == prop_kind::forward
                 && utils::one_of(src_type, data_type::f32, data_type::u8,
                         data_type::bf16);
-        const bool jit_bwd = !pd_->is_fwd()
+        const bool jit_bwd = aprop == prop_kind::backward
                 && utils::one_of(src_type, data_type::f32, data_type::bf16);
 
 #define CREATE_WITH_DIR(k, ker_t) \
@@ -255,9 +257,16 @@ private:
 
         if (pd_->cell_kind() == alg_kind::vanilla_lstm) {
             CREATE(rnn_postgemm_, jit_uni_lstm_cell_postgemm);
+            // int8 projection (de)quantization, the other data types only
+            // convert or copy the output of the projection
+            if (jit_fwd && pd_->is_lstm_projection()
+                    && src_type == data_type::u8)
+                CREATE_WITH_DIR(rnn_postgemm_part2_,
+                        jit_uni_lstm_cell_projection_postgemm_fwd);
         } else if (pd_->cell_kind() == alg_kind::vanilla_rnn) {
             CREATE(rnn_postgemm_, jit_uni_rnn_cell_postgemm);
-        } else if (pd_->cell_kind() == alg_kind::vanilla_gru) {
+        } else if (utils::one_of(pd_->cell_kind(), alg_kind::vanilla_gru,
+                           alg_kind::vanilla_augru)) {
             CREATE(rnn_postgemm_, jit_uni_gru_cell_postgemm_part1);
             CREATE(rnn_postgemm_part2_, jit_uni_gru_cell_postgemm_part2);
         } else if (pd_->cell_kind() == alg_kind::lbr_gru) {
@@ -87,7 +87,8 @@ void gru_fwd_part2_postgemm_template(T1 func1, T2 to_src, T3 acc_to_float,
         const rnn_utils::rnn_conf_t &rnn,
         rnn_utils::cell_position_t cell_position, src_data_t *ws_gates_,
         scratch_data_t *scratch_gates_, src_data_t *dst_layer_,
-        src_data_t *dst_iter_, const src_data_t *src_iter_, float *bias_) {
+        src_data_t *dst_iter_, const src_data_t *src_iter_, float *bias_,
+        const float *augru_attention_) {
     ws_gates_aoc<src_data_t> ws_gates(rnn, ws_gates_);
     scratch_gates_aoc<scratch_data_t> scratch_gates(rnn, scratch_gates_);
     bias_aoc_t bias(rnn, bias_);
@@ -100,9 +101,13 @@ void gru_fwd_part2_postgemm_template(T1 func1, T2 to_src, T3 acc_to_float,
     ws_states_iter_aoc<const src_data_t> src_iter(rnn, src_iter_, src_iter_ld);
 
     parallel_nd(rnn.mb, [&](int i) {
+        // AUGRU scales the update gate with the attention of the row
+        const float attention_scale
+                = augru_attention_ ? 1.0f - augru_attention_[i] : 1.0f;
         PRAGMA_OMP_SIMD()
         for (int j = 0; j < rnn.dhc; j++) {
-            auto G0 = reinterpret_as_float(scratch_gates(i, 0, j));
+            auto G0 = attention_scale
+                    * reinterpret_as_float(scratch_gates(i, 0, j));
             auto G2 // default func1 is tanh
                     = func1(scales + 2,
                             acc_to_float(scratch_gates(i, 2, j), 2, j)
@@ -142,6 +147,10 @@ rnn_postgemm_sig(rnn_postgemm_fwd_f32_t::gru_part1_postgemm) {
 template <>
 rnn_postgemm_sig(rnn_postgemm_fwd_f32_t::gru_part2_postgemm) {
     const float *scales = pd_->attr()->rnn_tparams_.scales_;
+    // the attention of the iteration is passed as the c state of AUGRU
+    const float *augru_attention
+            = pd_->cell_kind() == alg_kind::vanilla_augru ? src_iter_c_
+                                                          : nullptr;
     auto linear_f = [](const float *scale, float a) { return *scale * a; };
     auto tanh_f
             = [](const float *scale, float a) { return tanh_fwd<float>(a); };
@@ -152,11 +161,11 @@ rnn_postgemm_sig(rnn_postgemm_fwd_f32_t::gru_part2_postgemm) {
     if (!pd_->attr()->rnn_tparams_.test_mode_)
         gru_fwd_part2_postgemm_template(tanh_f, id, deq_id, id, id, scales, rnn,
                 cell_position, ws_gates_, scratch_gates_, dst_layer_, dst_iter_,
-                src_iter_, bias_);
+                src_iter_, bias_, augru_attention);
     else
         gru_fwd_part2_postgemm_template(linear_f, id, deq_id, id, id, scales,
                 rnn, cell_position, ws_gates_, scratch_gates_, dst_layer_,
-                dst_iter_, src_iter_, bias_);
+                dst_iter_, src_iter_, bias_, augru_attention);
 }
 
 template <>
@@ -184,6 +193,10 @@ rnn_postgemm_sig(rnn_postgemm_fwd_bf16_t::gru_part1_postgemm) {
 template <>
 rnn_postgemm_sig(rnn_postgemm_fwd_bf16_t::gru_part2_postgemm) {
     const float *scales = pd_->attr()->rnn_tparams_.scales_;
+    // the attention of the iteration is passed as the c state of AUGRU
+    const float *augru_attention
+            = pd_->cell_kind() == alg_kind::vanilla_augru ? src_iter_c_
+                                                          : nullptr;
     auto linear_f = [](const float *scale, float a) { return *scale * a; };
     auto tanh_f
             = [](const float *scale, float a) { return tanh_fwd<float>(a); };
@@ -196,11 +209,13 @@ rnn_postgemm_sig(rnn_postgemm_fwd_bf16_t::gru_part2_postgemm) {
     if (!pd_->attr()->rnn_tparams_.test_mode_)
         gru_fwd_part2_postgemm_template(tanh_f, dn_cvt_f32_bf16, deq_id,
                 up_cvt_bf16_f32, id, scales, rnn, cell_position, ws_gates_,
-                scratch_gates_, dst_layer_, dst_iter_, src_iter_, bias_);
+                scratch_gates_, dst_layer_, dst_iter_, src_iter_, bias_,
+                augru_attention);
     else
         gru_fwd_part2_postgemm_template(linear_f, dn_cvt_f32_bf16, deq_id,
                 up_cvt_bf16_f32, id, scales, rnn, cell_position, ws_gates_,
-                scratch_gates_, dst_layer_, dst_iter_, src_iter_, bias_);
+                scratch_gates_, dst_layer_, dst_iter_, src_iter_, bias_,
+                augru_attention);
 }
 
 template <>
@@ -282,12 +297,12 @@ rnn_postgemm_sig(rnn_postgemm_fwd_u8_t::gru_part2_postgemm) {
         gru_fwd_part2_postgemm_template(tanh_f, quantize_f32_u8,
                 dequantize_s32_f32, dequantize_u8_f32, reinterpret_s32_f32,
                 scales, rnn, cell_position, ws_gates_, scratch_gates_,
-                dst_layer_, dst_iter_, src_iter_, bias_);
+                dst_layer_, dst_iter_, src_iter_, bias_, nullptr);
     else
         gru_fwd_part2_postgemm_template(linear_f, quantize_f32_u8,
                 dequantize_s32_f32, dequantize_u8_f32, reinterpret_s32_f32,
                 scales, rnn, cell_position, ws_gates_, scratch_gates_,
-                dst_layer_, dst_iter_, src_iter_, bias_);
+                dst_layer_, dst_iter_, src_iter_, bias_, nullptr);
 }
 
 template <typename T, typename src_data_t, typename acc_data_t,
@@ -21,6 +21,8 @@
 #include "common/dnnl_thread.hpp"
 #include "common/math_utils.hpp"
 
+#include "cpu/simple_q10n.hpp"
+
 #include "cpu/rnn/postgemm_dispatcher.hpp"
 
 namespace dnnl {
@@ -32,10 +34,11 @@ using namespace dnnl::impl::math;
 using namespace rnn_utils;
 #define AOC array_offset_calculator
 
-template <typename T1, typename T2, typename T3, typename src_data_t,
-        typename scratch_data_t>
+template <typename T1, typename T2, typename T3, typename T4, typename T5,
+        typename src_data_t, typename scratch_data_t>
 void gru_lbr_fwd_postgemm_template(T1 func1, T2 func2, T3 to_src,
-        const float *scales, const rnn_utils::rnn_conf_t &rnn,
+        T4 acc_to_float, T5 src_to_float, const float *scales,
+        const rnn_utils::rnn_conf_t &rnn,
         rnn_utils::cell_position_t cell_position, src_data_t *ws_gates_,
         scratch_data_t *scratch_gates_, src_data_t *dst_layer_,
         src_data_t *dst_iter_, const src_data_t *src_iter_, float *bias_,
@@ -57,16 +60,22 @@ void gru_lbr_fwd_postgemm_template(T1 func1, T2 func2, T3 to_src,
     parallel_nd(rnn.mb, [&](int i) {
         PRAGMA_OMP_SIMD()
         for (int j = 0; j < rnn.dhc; j++) {
-            float Wh_b = scratch_cell(i, 2, j) + bias(3, j);
+            float Wh_b = acc_to_float(scratch_cell(i, 2, j), 2, j) + bias(3, j);
             auto G0 = func1(scales, // default func1 is sigmoid
-                    scratch_gates(i, 0, j) + scratch_cell(i, 0, j)
+                    acc_to_float(scratch_gates(i, 0, j)
+                                    + scratch_cell(i, 0, j),
+                            0, j)
                             + bias(0, j));
             auto G1 = func1(scales + 1, // default func1 is sigmoid
-                    scratch_gates(i, 1, j) + scratch_cell(i, 1, j)
+                    acc_to_float(scratch_gates(i, 1, j)
+                                    + scratch_cell(i, 1, j),
+                            1, j)
                             + bias(1, j));
             auto G2 = func2(scales + 2, // default func2 is tanh
-                    scratch_gates(i, 2, j) + G1 * Wh_b + bias(2, j));
-            auto tmp = to_src(src_iter(i, j) * G0 + (1.0f - G0) * G2);
+                    acc_to_float(scratch_gates(i, 2, j), 2, j) + G1 * Wh_b
+                            + bias(2, j));
+            auto tmp = to_src(
+                    src_to_float(src_iter(i, j)) * G0 + (1.0f - G0) * G2);
             if (dst_layer_ != nullptr) dst_layer(i, j) = tmp;
             if (dst_iter_ != nullptr) dst_iter(i, j) = tmp;
             if (rnn.is_training) {
@@ -90,15 +99,19 @@ rnn_postgemm_sig(rnn_postgemm_fwd_f32_t::gru_lbr_postgemm) {
     auto tanh_f
             = [](const float *scale, float a) { return tanh_fwd<float>(a); };
     auto to_src = [](float a) { return a; };
+    auto deq_id = [](float f, int i, int j) { return f; };
+    auto id = [](float f) { return f; };
 
     if (!pd_->attr()->rnn_tparams_.test_mode_)
-        gru_lbr_fwd_postgemm_template(logistic_f, tanh_f, to_src, scales, rnn,
-                cell_position, ws_gates_, scratch_gates_, dst_layer_, dst_iter_,
-                src_iter_, bias_, ws_grid_, scratch_cell_);
+        gru_lbr_fwd_postgemm_template(logistic_f, tanh_f, to_src, deq_id, id,
+                scales, rnn, cell_position, ws_gates_, scratch_gates_,
+                dst_layer_, dst_iter_, src_iter_, bias_, ws_grid_,
+                scratch_cell_);
     else
-        gru_lbr_fwd_postgemm_template(linear_f, linear_f, to_src, scales, rnn,
-                cell_position, ws_gates_, scratch_gates_, dst_layer_, dst_iter_,
-                src_iter_, bias_, ws_grid_, scratch_cell_);
+        gru_lbr_fwd_postgemm_template(linear_f, linear_f, to_src, deq_id, id,
+                scales, rnn, cell_position, ws_gates_, scratch_gates_,
+                dst_layer_, dst_iter_, src_iter_, bias_, ws_grid_,
+                scratch_cell_);
 }
 
 template <>
@@ -112,20 +125,66 @@ rnn_postgemm_sig(rnn_postgemm_fwd_bf16_t::gru_lbr_postgemm) {
     auto tanh_f
             = [](const float *scale, float a) { return tanh_fwd<float>(a); };
     auto to_src = [](float a) { return bfloat16_t(a); };
+    auto deq_id = [](float f, int i, int j) { return f; };
+    auto up_cvt_bf16_f32 = [](bfloat16_t b) { return float(b); };
 
     if (!pd_->attr()->rnn_tparams_.test_mode_)
-        gru_lbr_fwd_postgemm_template(logistic_f, tanh_f, to_src, scales, rnn,
-                cell_position, ws_gates_, scratch_gates_, dst_layer_, dst_iter_,
-                src_iter_, bias_, ws_grid_, scratch_cell_);
+        gru_lbr_fwd_postgemm_template(logistic_f, tanh_f, to_src, deq_id,
+                up_cvt_bf16_f32, scales, rnn, cell_position, ws_gates_,
+                scratch_gates_, dst_layer_, dst_iter_, src_iter_, bias_,
+                ws_grid_, scratch_cell_);
     else
-        gru_lbr_fwd_postgemm_template(linear_f, linear_f, to_src, scales, rnn,
-                cell_position, ws_gates_, scratch_gates_, dst_layer_, dst_iter_,
-                src_iter_, bias_, ws_grid_, scratch_cell_);
+        gru_lbr_fwd_postgemm_template(linear_f, linear_f, to_src, deq_id,
+                up_cvt_bf16_f32, scales, rnn, cell_position, ws_gates_,
+                scratch_gates_, dst_layer_, dst_iter_, src_iter_, bias_,
+                ws_grid_, scratch_cell_);
 }
 
 template <>
 rnn_postgemm_sig(rnn_postgemm_fwd_u8_t::gru_lbr_postgemm) {
-    assert(!"GRU LBR int8 is not supported");
+    const float *scales = pd_->attr()->rnn_tparams_.scales_;
+
+    auto linear_f = [](const float *scale, float a) { return *scale * a; };
+    auto logistic_f = [](const float *scale, float a) {
+        return logistic_fwd<float>(a);
+    };
+    auto tanh_f
+            = [](const float *scale, float a) { return tanh_fwd<float>(a); };
+
+    float *weights_scales = pd_->attr()->rnn_weights_qparams_.scales_;
+    float data_shift = pd_->attr()->rnn_data_qparams_.shift_;
+    float data_scale = pd_->attr()->rnn_data_qparams_.scale_;
+
+    auto quantize_f32_u8 = [&](float f) {
+        float qf = f * data_scale + data_shift;
+        qf = nstl::min(qf, 255.0f);
+        qf = nstl::max(qf, 0.0f);
+        return (dst_layer_t)mxcsr_cvt(qf);
+    };
+
+    // Both gemms of a gate share the weights scales, so the accumulators of
+    // the r and u gates are summed up before the dequantization
+    auto dequantize_s32_f32 = [&](gemm_acc_t s, int gate, int j) {
+        float wscale = pd_->attr()->rnn_weights_qparams_.mask_ == 0
+                ? weights_scales[0]
+                : weights_scales[gate * rnn.dhc + j];
+        return saturate<float>(s) * (1.f / (wscale * data_scale));
+    };
+
+    auto dequantize_u8_f32 = [&](src_iter_t s) {
+        return (static_cast<float>(s) - data_shift) * (1.f / data_scale);
+    };
+
+    if (!pd_->attr()->rnn_tparams_.test_mode_)
+        gru_lbr_fwd_postgemm_template(logistic_f, tanh_f, quantize_f32_u8,
+                dequantize_s32_f32, dequantize_u8_f32, scales, rnn,
+                cell_position, ws_gates_, scratch_gates_, dst_layer_, dst_iter_,
+                src_iter_, bias_, ws_grid_, scratch_cell_);
+    else
+        gru_lbr_fwd_postgemm_template(linear_f, linear_f, quantize_f32_u8,
+                dequantize_s32_f32, dequantize_u8_f32, scales, rnn,
+                cell_position, ws_gates_, scratch_gates_, dst_layer_, dst_iter_,
+                src_iter_, bias_, ws_grid_, scratch_cell_);
 }
 
 template <typename T1, typename src_data_t, typename acc_data_t,
@@ -21,6 +21,8 @@
 #include "common/dnnl_thread.hpp"
 #include "common/math_utils.hpp"
 
+#include "cpu/simple_q10n.hpp"
+
 #include "cpu/rnn/postgemm_dispatcher.hpp"
 
 namespace dnnl {
@@ -71,8 +73,10 @@ float linear(float s, float alpha, float clipping) {
     return alpha * s;
 }
 
-template <typename T, typename src_data_t, typename scratch_data_t>
-void rnn_fwd_postgemm_template(T func1, const float *scales, float alpha,
+template <typename T1, typename T2, typename src_data_t,
+        typename scratch_data_t>
+void rnn_fwd_postgemm_template(T1 func1, T2 acc_to_float, const float *scales,
+        float alpha,
         const rnn_utils::rnn_conf_t &rnn,
         rnn_utils::cell_position_t cell_position, src_data_t *ws_gates_,
         scratch_data_t *scratch_gates_, src_data_t *dst_layer_,
@@ -91,8 +95,9 @@ void rnn_fwd_postgemm_template(T func1, const float *scales, float alpha,
 
     parallel_nd(rnn.mb, [&](int i) {
         for (int j = 0; j < rnn.dhc; j++) {
-            const float h
-                    = func1(scratch_gates(i, 0, j) + bias(0, j), alpha, 0);
+            const auto h = func1(
+                    acc_to_float(scratch_gates(i, 0, j), 0, j) + bias(0, j),
+                    alpha, 0);
             if (dst_layer_ != nullptr) dst_layer(i, j) = h;
             if (dst_iter_ != nullptr) dst_iter(i, j) = h;
             if (rnn.is_training) ws_gates(i, 0, j) = h;
@@ -109,15 +114,16 @@ rnn_postgemm_sig(rnn_postgemm_fwd_f32_t::rnn_postgemm) {
     auto linear_f = [](float a, float alpha, float clipping) {
         return linear(a, alpha, clipping);
     };
+    auto deq_id = [](float f, int i, int j) { return f; };
     auto alpha = pd_->desc()->alpha;
     if (!pd_->attr()->rnn_tparams_.test_mode_)
-        rnn_fwd_postgemm_template(act_f, nullptr, alpha, rnn, cell_position,
-                ws_gates_, scratch_gates_, dst_layer_, dst_iter_, src_iter_,
-                bias_);
+        rnn_fwd_postgemm_template(act_f, deq_id, nullptr, alpha, rnn,
+                cell_position, ws_gates_, scratch_gates_, dst_layer_,
+                dst_iter_, src_iter_, bias_);
     else
-        rnn_fwd_postgemm_template(linear_f, scales, alpha, rnn, cell_position,
-                ws_gates_, scratch_gates_, dst_layer_, dst_iter_, src_iter_,
-                bias_);
+        rnn_fwd_postgemm_template(linear_f, deq_id, scales, alpha, rnn,
+                cell_position, ws_gates_, scratch_gates_, dst_layer_,
+                dst_iter_, src_iter_, bias_);
 }
 
 template <>
@@ -129,20 +135,54 @@ rnn_postgemm_sig(rnn_postgemm_fwd_bf16_t::rnn_postgemm) {
     auto linear_f = [](float a, float alpha, float clipping) {
         return bfloat16_t(linear(a, alpha, clipping));
     };
+    auto deq_id = [](float f, int i, int j) { return f; };
     auto alpha = pd_->desc()->alpha;
     if (!pd_->attr()->rnn_tparams_.test_mode_)
-        rnn_fwd_postgemm_template(act_f, nullptr, alpha, rnn, cell_position,
-                ws_gates_, scratch_gates_, dst_layer_, dst_iter_, src_iter_,
-                bias_);
+        rnn_fwd_postgemm_template(act_f, deq_id, nullptr, alpha, rnn,
+                cell_position, ws_gates_, scratch_gates_, dst_layer_,
+                dst_iter_, src_iter_, bias_);
     else
-        rnn_fwd_postgemm_template(linear_f, scales, alpha, rnn, cell_position,
-                ws_gates_, scratch_gates_, dst_layer_, dst_iter_, src_iter_,
-                bias_);
+        rnn_fwd_postgemm_template(linear_f, deq_id, scales, alpha, rnn,
+                cell_position, ws_gates_, scratch_gates_, dst_layer_,
+                dst_iter_, src_iter_, bias_);
 }
 
 template <>
 rnn_postgemm_sig(rnn_postgemm_fwd_u8_t::rnn_postgemm) {
-    assert(!"VANILLA RNN int8 is not supported");
+    const float *scales = pd_->attr()->rnn_tparams_.scales_;
+    float *weights_scales = pd_->attr()->rnn_weights_qparams_.scales_;
+    float data_shift = pd_->attr()->rnn_data_qparams_.shift_;
+    float data_scale = pd_->attr()->rnn_data_qparams_.scale_;
+
+    auto quantize_f32_u8 = [&](float f) {
+        float qf = f * data_scale + data_shift;
+        qf = nstl::min(qf, 255.0f);
+        qf = nstl::max(qf, 0.0f);
+        return (dst_layer_t)mxcsr_cvt(qf);
+    };
+
+    auto dequantize_s32_f32 = [&](gemm_acc_t s, int gate, int j) {
+        float wscale = pd_->attr()->rnn_weights_qparams_.mask_ == 0
+                ? weights_scales[0]
+                : weights_scales[gate * rnn.dhc + j];
+        return saturate<float>(s) * (1.f / (wscale * data_scale));
+    };
+
+    auto act_f = [&](float a, float alpha, float clipping) {
+        return quantize_f32_u8(this->activation_func(a, alpha, clipping));
+    };
+    auto linear_f = [&](float a, float alpha, float clipping) {
+        return quantize_f32_u8(linear(a, alpha, clipping));
+    };
+    auto alpha = pd_->desc()->alpha;
+    if (!pd_->attr()->rnn_tparams_.test_mode_)
+        rnn_fwd_postgemm_template(act_f, dequantize_s32_f32, nullptr, alpha,
+                rnn, cell_position, ws_gates_, scratch_gates_, dst_layer_,
+                dst_iter_, src_iter_, bias_);
+    else
+        rnn_fwd_postgemm_template(linear_f, dequantize_s32_f32, scales, alpha,
+                rnn, cell_position, ws_gates_, scratch_gates_, dst_layer_,
+                dst_iter_, src_iter_, bias_);
 }
 
 template <typename T1, typename T2, typename src_data_t, typename acc_data_t,
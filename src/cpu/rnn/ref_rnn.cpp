@@ -29,6 +29,8 @@
 
  */
 
+#include <vector>
+
 #include "common/dnnl_thread.hpp"
 
 #include "cpu/simple_q10n.hpp"
@@ -36,6 +38,10 @@
 #include "cpu/gemm/gemm.hpp"
 #include "cpu/gemm/gemm_pack.hpp"
 
+#if DNNL_X64
+#include "cpu/x64/cpu_barrier.hpp"
+#endif
+
 #include "cpu/rnn/ref_rnn.hpp"
 
 namespace dnnl {
@@ -189,6 +195,197 @@ rnn_grid_execution_sig((_ref_rnn_common_t<aprop, src_type, weights_type,
     auto dst_iter_mdw = memory_desc_wrapper(pd()->dst_md(1));
     auto src_iter_c_mdw = memory_desc_wrapper(pd()->src_md(2));
     auto dst_iter_c_mdw = memory_desc_wrapper(pd()->dst_md(2));
+    auto augru_attention_mdw
+            = memory_desc_wrapper(pd()->arg_md(DNNL_ARG_AUGRU_ATTENTION));
+
+    // With variable sequence lengths only the first iter_mb[iter] sequences
+    // of the batch are still running at the iteration iter, the others drop
+    // out of the cells as the lengths are sorted in non-increasing order.
+    std::vector<int> iter_mb;
+    if (seq_lengths_) {
+        iter_mb.resize(rnn.n_iter, 0);
+        for (int b = 0; b < rnn.mb; b++)
+            for (int it = 0; it < seq_lengths_[b]; it++)
+                iter_mb[it]++;
+    }
+
+    // Computes the cell of the j-th layer and the i-th iteration (in the
+    // order of execution)
+    auto cell_execution = [&](int dir, int j, int i) -> dnnl_status_t {
+        int lay = (aprop == prop_kind::forward) ? j : rnn.n_layer - j - 1;
+        int iter = (aprop == prop_kind::forward) ? i : rnn.n_iter - i - 1;
+
+        // We set the FWD parameters to the cell execution
+        // call
+
+        // dst_layer is equal to dst_iter. To avoid
+        // duplication of memory access we hence use only
+        // dst_layer and set dst_iter to nullptr, unless we
+        // cannot for one of the following condition:
+        // - in the last layer and last iteration, we need to
+        //   copy ht in two tensors (dst_layer and dst_iter)
+        dst_layer_t *cell_dst_layer
+                = &(ws_states_layer(lay + 1, dir, iter + 1, 0));
+        dst_iter_t *cell_dst_iter = nullptr;
+        const src_layer_t *cell_src_layer
+                = &(ws_states_layer(lay, dir, iter + 1, 0));
+        const src_iter_t *cell_src_iter
+                = &(ws_states_iter(lay + 1, dir, iter, 0));
+
+        float *cell_dst_iter_c = &(ws_states_iter_c(lay + 1, dir, iter + 1, 0));
+        const float *cell_src_iter_c
+                = &(ws_states_iter_c(lay + 1, dir, iter, 0));
+
+        // the cell_position is used only when skip_data_copy is
+        // supported currently supported only for forward
+        cell_position_t cell_position = middle_cell;
+        if (iter == 0) cell_position |= first_iter;
+        if (lay == 0) cell_position |= first_layer;
+        if (iter == rnn.n_iter - 1) cell_position |= last_iter;
+        if (lay == rnn.n_layer - 1) cell_position |= last_layer;
+
+        // The dst_* paths should be before the src_* paths as
+        // the later will override cell_src_layer and
+        // cell_src_iter appropriately for 1st layer and 1st
+        // iter.
+        bool last_iter_skip_copy
+                = rnn.skip_dst_iter_copy() && (cell_position & last_iter);
+        if (last_iter_skip_copy) {
+            cell_dst_layer = dst_iter_ + dst_iter_mdw.off(lay, dir, 0, 0);
+            cell_src_layer = dst_iter_ + dst_iter_mdw.off(lay - 1, dir, 0, 0);
+        }
+
+        if (rnn.skip_dst_layer_copy() && (cell_position & last_layer)) {
+            // Note: for last layer and last iter, the output is in dst_layer
+            // and still need to be copied to dst_iter
+            cell_dst_layer = dst_layer_ + dst_layer_mdw.off(iter, 0, 0);
+            cell_dst_iter = last_iter_skip_copy
+                    ? dst_iter_ + dst_iter_mdw.off(lay, dir, 0, 0)
+                    : nullptr;
+            cell_src_iter = (iter != 0)
+                    ? dst_layer_ + dst_layer_mdw.off(iter - 1, 0, 0)
+                    : cell_src_iter;
+        }
+        if (rnn.skip_src_iter_copy() && (cell_position & first_iter))
+            cell_src_iter = src_iter_ + src_iter_mdw.off(lay, dir, 0, 0);
+
+        if (rnn.skip_src_layer_copy() && (cell_position & first_layer))
+            cell_src_layer = src_layer_ + src_layer_mdw.off(iter, 0, 0);
+
+        // because the c state is always f32 and require no
+        // conversion, we can always skip to copy for the 1st
+        // and last iteration
+        if (iter == 0 && src_iter_c_) {
+            cell_src_iter_c = src_iter_c_ + src_iter_c_mdw.off(lay, dir, 0, 0);
+            cell_position |= c_state_first_iter;
+        }
+        if (iter == rnn.n_iter - 1 && dst_iter_c_) {
+            cell_dst_iter_c = dst_iter_c_ + dst_iter_c_mdw.off(lay, dir, 0, 0);
+            cell_position |= c_state_last_iter;
+        }
+
+        // AUGRU has no c state: its slot carries the attention of the
+        // iteration down to the postgemm
+        if (augru_attention_)
+            cell_src_iter_c
+                    = augru_attention_ + augru_attention_mdw.off(iter, 0, 0);
+
+        auto cell_scratch_gates = rnn.n_iter_scratch_gates == 1
+                ? scratch_gates_
+                : scratch_gates_
+                        + iter * rnn.scratch_gates_nld * rnn.scratch_gates_ld;
+        auto cell_scratch_cell = scratch_cell_;
+        if (rnn.wavefront_execution) {
+            // the cells of a wavefront belong to different layers (and
+            // directions) and every layer has its own scratch
+            const int n_scratch = rnn.concurrent_directions
+                    ? rnn.n_dir * rnn.n_layer
+                    : rnn.n_layer;
+            const int i_scratch = rnn.concurrent_directions
+                    ? dir * rnn.n_layer + lay
+                    : lay;
+            cell_scratch_gates
+                    += i_scratch * rnn.scratch_gates_nld * rnn.scratch_gates_ld;
+            cell_scratch_cell = reinterpret_cast<scratch_t *>(
+                    reinterpret_cast<char *>(scratch_cell_)
+                    + i_scratch * (rnn.scratch_cell_size / n_scratch));
+        }
+
+        dst_iter_t *proj_ht = nullptr;
+        if (rnn.is_lstm_projection) {
+            if (rnn.is_training)
+                proj_ht = &(ws_ht(lay, dir, iter, 0));
+            else
+                proj_ht = scratch_ht_;
+        }
+
+        rnn_conf_t varlen_rnn;
+        const rnn_conf_t *cell_rnn = &rnn;
+        if (seq_lengths_) {
+            varlen_rnn = rnn;
+            varlen_rnn.mb = iter_mb[iter];
+            cell_rnn = &varlen_rnn;
+        }
+
+        return (this->*cell_func)(*cell_rnn, cell_position, cell_dst_layer,
+                cell_dst_iter_c, &(ws_diff_states_layer(lay, dir, iter, 0)),
+                &(ws_diff_states_iter(lay, dir, iter, 0)),
+                &(ws_diff_states_iter_c(lay, dir, iter, 0)),
+                &(weights_layer(lay, dir, 0)), &(weights_iter(lay, dir, 0)),
+                &(weights_projection(lay, dir)),
+                &(weights_peephole(lay, dir, 0)),
+                w_proj_comp + (j * rnn.n_dir + dir) * rnn.dic,
+                &(bias(lay, dir, 0)), cell_src_layer, cell_src_iter,
+                cell_src_iter_c, &(ws_diff_states_layer(lay + 1, dir, iter, 0)),
+                &(ws_diff_states_iter(lay, dir, iter + 1, 0)),
+                &(ws_diff_states_iter_c(lay, dir, iter + 1, 0)),
+                &(diff_weights_layer(lay, dir, 0)),
+                &(diff_weights_iter(lay, dir, 0)),
+                &(diff_weights_projection(lay, dir, 0)),
+                &(diff_weights_peephole(lay, dir, 0)),
+                &(diff_bias(lay, dir, 0)),
+                rnn.recompute_gates ? ws_gates_
+                                    : &(ws_gates(lay, dir, iter, 0)),
+                cell_scratch_gates, proj_ht,
+                scratch_diff_ht_, &(ws_grid(lay, dir, iter, 0)),
+                cell_scratch_cell, cell_dst_iter, amx_scratchpad, A_addr_global,
+                B_addr_global);
+    };
+
+    if (rnn.wavefront_execution) {
+        // The cell (lay, iter) depends on (lay - 1, iter) and (lay, iter - 1)
+        // only, hence the cells on an anti-diagonal lay + iter = const are
+        // independent and run concurrently, one cell per thread. With
+        // concurrent directions the anti-diagonals of both directions are
+        // processed together.
+        const int n_dir_wave = rnn.concurrent_directions ? rnn.n_dir : 1;
+        std::vector<dnnl_status_t> cell_status(
+                rnn.n_layer * n_dir_wave, dnnl_success);
+        for_(int dir_start = 0; dir_start < rnn.n_dir; dir_start += n_dir_wave)
+        for (int d = 0; d < rnn.n_layer + rnn.n_iter - 1; d++) {
+            const int j_start = nstl::max(0, d - rnn.n_iter + 1);
+            const int j_end = nstl::min(d + 1, rnn.n_layer);
+            const int n_dir_cells = j_end - j_start;
+            const int n_cells = n_dir_cells * n_dir_wave;
+            // a lone cell is better off with all the threads for itself
+            if (n_cells == 1) {
+                CHECK(cell_execution(dir_start, j_start, d - j_start));
+                continue;
+            }
+
+            parallel(nstl::min(n_cells, dnnl_get_max_threads()),
+                    [&](const int ithr, const int nthr) {
+                        for (int c = ithr; c < n_cells; c += nthr) {
+                            const int dir = dir_start + c / n_dir_cells;
+                            const int j = j_start + c % n_dir_cells;
+                            cell_status[c] = cell_execution(dir, j, d - j);
+                        }
+                    });
+            for (int c = 0; c < n_cells; c++)
+                CHECK(cell_status[c]);
+        }
+        return dnnl_success;
+    }
 
     // We run the grid of computation
     for (int dir = 0; dir < rnn.n_dir; dir++) {
@@ -221,124 +418,27 @@ rnn_grid_execution_sig((_ref_rnn_common_t<aprop, src_type, weights_type,
 
             // TODO: enable merging projection gemm in bwd lstm projection
 
-            for (int i = 0; i < rnn.n_iter; i++) {
-                int iter = (aprop == prop_kind::forward) ? i
-                                                         : rnn.n_iter - i - 1;
-
-                // We set the FWD parameters to the cell execution
-                // call
-
-                // dst_layer is equal to dst_iter. To avoid
-                // duplication of memory access we hence use only
-                // dst_layer and set dst_iter to nullptr, unless we
-                // cannot for one of the following condition:
-                // - in the last layer and last iteration, we need to
-                //   copy ht in two tensors (dst_layer and dst_iter)
-                dst_layer_t *cell_dst_layer
-                        = &(ws_states_layer(lay + 1, dir, iter + 1, 0));
-                dst_iter_t *cell_dst_iter = nullptr;
-                const src_layer_t *cell_src_layer
-                        = &(ws_states_layer(lay, dir, iter + 1, 0));
-                const src_iter_t *cell_src_iter
-                        = &(ws_states_iter(lay + 1, dir, iter, 0));
-
-                float *cell_dst_iter_c
-                        = &(ws_states_iter_c(lay + 1, dir, iter + 1, 0));
-                const float *cell_src_iter_c
-                        = &(ws_states_iter_c(lay + 1, dir, iter, 0));
-
-                // the cell_position is used only when skip_data_copy is
-                // supported currently supported only for forward
-                cell_position_t cell_position = middle_cell;
-                if (iter == 0) cell_position |= first_iter;
-                if (lay == 0) cell_position |= first_layer;
-                if (iter == rnn.n_iter - 1) cell_position |= last_iter;
-                if (lay == rnn.n_layer - 1) cell_position |= last_layer;
-
-                // The dst_* paths should be before the src_* paths as
-                // the later will override cell_src_layer and
-                // cell_src_iter appropriately for 1st layer and 1st
-                // iter.
-                bool last_iter_skip_copy = rnn.skip_dst_iter_copy()
-                        && (cell_position & last_iter);
-                if (last_iter_skip_copy) {
-                    cell_dst_layer
-                            = dst_iter_ + dst_iter_mdw.off(lay, dir, 0, 0);
-                    cell_src_layer
-                            = dst_iter_ + dst_iter_mdw.off(lay - 1, dir, 0, 0);
-                }
-
-                if (rnn.skip_dst_layer_copy() && (cell_position & last_layer)) {
-                    // Note: for last layer and last iter, the output is in dst_layer
-                    // and still need to be copied to dst_iter
-                    cell_dst_layer = dst_layer_ + dst_layer_mdw.off(iter, 0, 0);
-                    cell_dst_iter = last_iter_skip_copy
-                            ? dst_iter_ + dst_iter_mdw.off(lay, dir, 0, 0)
-                            : nullptr;
-                    cell_src_iter = (iter != 0)
-                            ? dst_layer_ + dst_layer_mdw.off(iter - 1, 0, 0)
-                            : cell_src_iter;
-                }
-                if (rnn.skip_src_iter_copy() && (cell_position & first_iter))
-                    cell_src_iter
-                            = src_iter_ + src_iter_mdw.off(lay, dir, 0, 0);
-
-                if (rnn.skip_src_layer_copy() && (cell_position & first_layer))
-                    cell_src_layer = src_layer_ + src_layer_mdw.off(iter, 0, 0);
-
-                // because the c state is always f32 and require no
-                // conversion, we can always skip to copy for the 1st
-                // and last iteration
-                if (iter == 0 && src_iter_c_) {
-                    cell_src_iter_c
-                            = src_iter_c_ + src_iter_c_mdw.off(lay, dir, 0, 0);
-                    cell_position |= c_state_first_iter;
-                }
-                if (iter == rnn.n_iter - 1 && dst_iter_c_) {
-                    cell_dst_iter_c
-                            = dst_iter_c_ + dst_iter_c_mdw.off(lay, dir, 0, 0);
-                    cell_position |= c_state_last_iter;
-                }
-
-                auto cell_scratch_gates = rnn.n_iter_scratch_gates == 1
-                        ? scratch_gates_
-                        : scratch_gates_
-                                + iter * rnn.scratch_gates_nld
-                                        * rnn.scratch_gates_ld;
-
-                dst_iter_t *proj_ht = nullptr;
-                if (rnn.is_lstm_projection) {
-                    if (rnn.is_training)
-                        proj_ht = &(ws_ht(lay, dir, iter, 0));
-                    else
-                        proj_ht = scratch_ht_;
-                }
-
-                CHECK((this->*cell_func)(rnn, cell_position, cell_dst_layer,
-                        cell_dst_iter_c,
-                        &(ws_diff_states_layer(lay, dir, iter, 0)),
-                        &(ws_diff_states_iter(lay, dir, iter, 0)),
-                        &(ws_diff_states_iter_c(lay, dir, iter, 0)),
-                        &(weights_layer(lay, dir, 0)),
-                        &(weights_iter(lay, dir, 0)),
-                        &(weights_projection(lay, dir)),
-                        &(weights_peephole(lay, dir, 0)),
-                        w_proj_comp + (j * rnn.n_dir + dir) * rnn.dic,
-                        &(bias(lay, dir, 0)), cell_src_layer, cell_src_iter,
-                        cell_src_iter_c,
-                        &(ws_diff_states_layer(lay + 1, dir, iter, 0)),
-                        &(ws_diff_states_iter(lay, dir, iter + 1, 0)),
-                        &(ws_diff_states_iter_c(lay, dir, iter + 1, 0)),
-                        &(diff_weights_layer(lay, dir, 0)),
-                        &(diff_weights_iter(lay, dir, 0)),
-                        &(diff_weights_projection(lay, dir, 0)),
-                        &(diff_weights_peephole(lay, dir, 0)),
-                        &(diff_bias(lay, dir, 0)),
-                        &(ws_gates(lay, dir, iter, 0)), cell_scratch_gates,
-                        proj_ht, scratch_diff_ht_,
-                        &(ws_grid(lay, dir, iter, 0)), scratch_cell_,
-                        cell_dst_iter, amx_scratchpad, A_addr_global,
-                        B_addr_global));
+            if (rnn.brgemm_persistent) {
+#if DNNL_X64
+                // The threads keep their blocks of the gate columns for the
+                // whole layer. An iteration needs all the states of the
+                // previous one, hence the barrier after every cell.
+                x64::simple_barrier::ctx_t barrier_ctx;
+                x64::simple_barrier::ctx_init(&barrier_ctx);
+                std::vector<dnnl_status_t> thr_status(rnn.nthr, dnnl_success);
+                parallel(rnn.nthr, [&](const int ithr, const int nthr) {
+                    for (int i = 0; i < rnn.n_iter; i++) {
+                        dnnl_status_t st = cell_execution(dir, j, i);
+                        if (st != dnnl_success) thr_status[ithr] = st;
+                        x64::simple_barrier::barrier(&barrier_ctx, nthr);
+                    }
+                });
+                for (auto st : thr_status)
+                    CHECK(st);
+#endif
+            } else {
+                for (int i = 0; i < rnn.n_iter; i++)
+                    CHECK(cell_execution(dir, j, i));
             }
 
             if ((aprop == prop_kind::backward) && rnn.merge_gemm_layer) {
@@ -671,7 +771,7 @@ template <typename src_data_t, typename dst_layer_dt, typename dst_iter_dt>
 void copy_res_layer_fwd_template(const rnn_conf_t &rnn, const rnn_pd_t *pd,
         dst_layer_dt *dst_layer_, memory_desc_wrapper &dst_layer_d,
         const dst_iter_dt *dst_iter_, const memory_desc_wrapper &dst_iter_d,
-        const src_data_t *ws_states_layer_) {
+        const src_data_t *ws_states_layer_, const int32_t *seq_lengths_) {
 
     AOC<const src_data_t, 5> ws_states_layer(ws_states_layer_, rnn.n_layer + 1,
             rnn.n_dir, rnn.n_iter + 1, rnn.mb, rnn.ws_states_layer_ld);
@@ -699,6 +799,12 @@ void copy_res_layer_fwd_template(const rnn_conf_t &rnn, const rnn_pd_t *pd,
         }
     };
 
+    auto zero_vec = [&](dst_layer_dt *dd) {
+        PRAGMA_OMP_SIMD()
+        for (int s = 0; s < rnn.dlc; s++)
+            dd[s] = (dst_layer_dt)0.f;
+    };
+
     auto acc_vec = [&](dst_layer_dt *dd, const src_data_t *ss) {
         if (dequantize) {
             PRAGMA_OMP_SIMD()
@@ -729,7 +835,11 @@ void copy_res_layer_fwd_template(const rnn_conf_t &rnn, const rnn_pd_t *pd,
                             = &ws_states_layer(rnn.n_layer, dir, it + 1, b, 0);
                     auto *dd = &dst_layer_[dst_layer_d.blk_off(
                             it, b, dir * rnn.dlc)];
-                    copy_vec(dd, ss);
+                    // the sequence is over, the workspace holds garbage
+                    if (seq_lengths_ && it >= seq_lengths_[b])
+                        zero_vec(dd);
+                    else
+                        copy_vec(dd, ss);
                     dir = 1;
                 }
                 if (rnn.exec_dir != l2r) {
@@ -802,11 +912,12 @@ void copy_res_layer_bwd_template(const rnn_conf_t &rnn,
     void cname::copy_res_layer(const rnn_conf_t &rnn, \
             dst_layer_dt *dst_layer_, gemm_acc_t *diff_src_layer, \
             const dst_iter_dt *dst_iter_, const src_layer_t *ws_states_layer_, \
-            const gemm_acc_t *ws_diff_states_layer_) const { \
+            const gemm_acc_t *ws_diff_states_layer_, \
+            const int32_t *seq_lengths_) const { \
         auto dst_layer_d = memory_desc_wrapper(pd()->dst_md(0)); \
         auto dst_iter_d = memory_desc_wrapper(pd()->dst_md(1)); \
         copy_res_layer_fwd_template(rnn, pd(), dst_layer_, dst_layer_d, \
-                dst_iter_, dst_iter_d, ws_states_layer_); \
+                dst_iter_, dst_iter_d, ws_states_layer_, seq_lengths_); \
     }
 
 RNN_DECL_COPY_RES_LAYER_FWD(ref_rnn_fwd_f32_t)
@@ -819,7 +930,8 @@ RNN_DECL_COPY_RES_LAYER_FWD(ref_rnn_fwd_u8s8_t)
     void cname::copy_res_layer(const rnn_conf_t &rnn, \
             dst_layer_dt *dst_layer_, gemm_acc_t *diff_src_layer_, \
             const dst_iter_dt *dst_iter_, const src_layer_t *ws_states_layer_, \
-            const gemm_acc_t *ws_diff_states_layer_) const { \
+            const gemm_acc_t *ws_diff_states_layer_, \
+            const int32_t *seq_lengths_) const { \
         auto diff_src_layer_d = memory_desc_wrapper(pd()->diff_src_md(0)); \
         copy_res_layer_bwd_template(rnn, diff_src_layer_, diff_src_layer_d, \
                 ws_diff_states_layer_); \
@@ -833,7 +945,8 @@ void copy_res_iter_fwd_template(const rnn_conf_t &rnn, const rnn_pd_t *pd,
         dst_iter_dt *dst_iter_, memory_desc_wrapper &dst_iter_d,
         float *dst_iter_c_, memory_desc_wrapper dst_iter_c_d,
         const dst_layer_dt *dst_layer_, memory_desc_wrapper dst_layer_d,
-        const src_data_t *ws_states_iter_, const float *ws_states_iter_c_) {
+        const src_data_t *ws_states_iter_, const float *ws_states_iter_c_,
+        const int32_t *seq_lengths_) {
     if (dst_iter_ == nullptr) return;
 
     AOC<const src_data_t, 5> ws_states_iter(ws_states_iter_, rnn.n_layer + 1,
@@ -863,9 +976,20 @@ void copy_res_iter_fwd_template(const rnn_conf_t &rnn, const rnn_pd_t *pd,
     auto n_layer_in_ws = rnn.n_layer - rnn.skip_dst_layer_copy();
 
     parallel_nd(n_layer_in_ws, rnn.n_dir, rnn.mb, [&](int lay, int dir, int b) {
-        const auto *ss = &ws_states_iter(lay + 1, dir, rnn.n_iter, b, 0);
+        const int it = seq_lengths_ ? seq_lengths_[b] : rnn.n_iter;
+        const auto *ss = &ws_states_iter(lay + 1, dir, it, b, 0);
         auto *dd = dst_iter_ + dst_iter_d.blk_off(lay, dir, b, 0);
         copy_vec(dd, ss);
+
+        // the c state of the last iteration is written to dst_iter_c by the
+        // cell, the one of a shorter sequence stays in the workspace
+        if (dst_iter_c_ && it < rnn.n_iter) {
+            const auto *ss_c = &ws_states_iter_c(lay + 1, dir, it, b, 0);
+            auto *dd_c = dst_iter_c_ + dst_iter_c_d.blk_off(lay, dir, b, 0);
+            PRAGMA_OMP_SIMD()
+            for (int s = 0; s < rnn.dhc; s++)
+                dd_c[s] = ss_c[s];
+        }
     });
 
     if (rnn.skip_dst_layer_copy()) {
@@ -917,13 +1041,14 @@ void copy_res_iter_bwd_template(const rnn_conf_t &rnn, const rnn_pd_t *pd,
             const src_layer_t *ws_states_layer_, \
             const float *ws_states_iter_c_, \
             const gemm_acc_t *ws_diff_states_iter_, \
-            const gemm_acc_t *ws_diff_states_iter_c_) const { \
+            const gemm_acc_t *ws_diff_states_iter_c_, \
+            const int32_t *seq_lengths_) const { \
         auto dst_layer_d = memory_desc_wrapper(pd()->dst_md(0)); \
         auto dst_iter_d = memory_desc_wrapper(pd()->dst_md(1)); \
         auto dst_iter_c_d = memory_desc_wrapper(pd()->dst_md(2)); \
         copy_res_iter_fwd_template(rnn, pd(), dst_iter_, dst_iter_d, \
                 dst_iter_c_, dst_iter_c_d, dst_layer_, dst_layer_d, \
-                ws_states_layer_, ws_states_iter_c_); \
+                ws_states_layer_, ws_states_iter_c_, seq_lengths_); \
     }
 
 RNN_DECL_COPY_RES_ITER_FWD(ref_rnn_fwd_f32_t)
@@ -939,7 +1064,8 @@ RNN_DECL_COPY_RES_ITER_FWD(ref_rnn_fwd_u8s8_t)
             const src_layer_t *ws_states_layer_, \
             const float *ws_states_iter_c_, \
             const gemm_acc_t *ws_diff_states_iter_, \
-            const gemm_acc_t *ws_diff_states_iter_c_) const { \
+            const gemm_acc_t *ws_diff_states_iter_c_, \
+            const int32_t *seq_lengths_) const { \
         auto diff_src_iter_d = memory_desc_wrapper(pd()->diff_src_md(1)); \
         auto diff_src_iter_c_d = memory_desc_wrapper(pd()->diff_src_md(2)); \
         copy_res_iter_bwd_template(rnn, pd(), diff_src_iter_, diff_src_iter_d, \
@@ -992,14 +1118,27 @@ rnn_bias_finalize_sig((_ref_rnn_common_t<aprop, src_type, weights_type,
         float data_scale = pd()->attr()->rnn_data_qparams_.scale_;
         float *weights_scales = pd()->attr()->rnn_weights_qparams_.scales_;
         bool scale_per_oc = pd()->attr()->rnn_weights_qparams_.mask_ != 0;
-        for (int i = 0; i < rnn.n_layer * rnn.n_dir; i++)
-            for (int j = 0; j < rnn.n_bias * rnn.dhc; j++) {
-                size_t off = i * rnn.n_bias * rnn.dhc + j;
-                float weights_scale
-                        = scale_per_oc ? weights_scales[j] : weights_scales[0];
-                scratch_bias_[off] -= (w_iter_comp[off] + w_layer_comp[off])
-                        * data_shift / (weights_scale * data_scale);
-            }
+        for_(int i = 0; i < rnn.n_layer * rnn.n_dir; i++)
+        for_(int g = 0; g < rnn.n_bias; g++)
+        for (int k = 0; k < rnn.dhc; k++) {
+            // The compensations are computed for the n_gates gates of the
+            // weights. In LBR GRU the extra bias of the last gate is applied
+            // to the iteration gemm only, so the compensations of the last
+            // gate are split between the two last biases.
+            const int comp_g = nstl::min(g, rnn.n_gates - 1);
+            const size_t comp_off = (i * rnn.n_gates + comp_g) * rnn.dhc + k;
+            const size_t off = (i * rnn.n_bias + g) * rnn.dhc + k;
+            const bool with_iter_comp = !rnn.is_lbr || g != rnn.n_gates - 1;
+            const bool with_layer_comp = !rnn.is_lbr || g != rnn.n_gates;
+            float comp = 0.f;
+            if (with_iter_comp) comp += w_iter_comp[comp_off];
+            if (with_layer_comp) comp += w_layer_comp[comp_off];
+            float weights_scale = scale_per_oc
+                    ? weights_scales[comp_g * rnn.dhc + k]
+                    : weights_scales[0];
+            scratch_bias_[off]
+                    -= comp * data_shift / (weights_scale * data_scale);
+        }
     }
 }
 
@@ -1052,7 +1191,13 @@ void _ref_rnn_common_t<aprop, src_type, weights_type, acc_type>::execute_(
     const rnn_conf_t &rnn = this->pd()->rnn_;
     auto src_layer = CTX_IN_MEM(const src_layer_t *, DNNL_ARG_SRC_LAYER);
     auto src_iter = CTX_IN_MEM(const char *, DNNL_ARG_SRC_ITER);
-    auto src_iter_c = CTX_IN_MEM(const float *, DNNL_ARG_SRC_ITER_C);
+    // DNNL_ARG_AUGRU_ATTENTION is an alias of DNNL_ARG_SRC_ITER_C
+    auto src_iter_c = this->pd()->is_augru()
+            ? nullptr
+            : CTX_IN_MEM(const float *, DNNL_ARG_SRC_ITER_C);
+    auto augru_attention = this->pd()->is_augru()
+            ? CTX_IN_MEM(const float *, DNNL_ARG_AUGRU_ATTENTION)
+            : nullptr;
     auto layer_weights_n_comp
             = CTX_IN_MEM(const char *, DNNL_ARG_WEIGHTS_LAYER);
     auto iter_weights_n_comp = CTX_IN_MEM(const char *, DNNL_ARG_WEIGHTS_ITER);
@@ -1061,6 +1206,9 @@ void _ref_rnn_common_t<aprop, src_type, weights_type, acc_type>::execute_(
     auto projection_weights_n_comp
             = CTX_IN_MEM(const char *, DNNL_ARG_WEIGHTS_PROJECTION);
     auto bias = CTX_IN_MEM(const float *, DNNL_ARG_BIAS);
+    auto seq_lengths = rnn.with_seq_lengths
+            ? CTX_IN_MEM(const int32_t *, DNNL_ARG_SEQ_LENGTHS)
+            : nullptr;
 
     auto dst_layer = rnn.is_fwd
             ? CTX_OUT_MEM(char *, DNNL_ARG_DST_LAYER)
@@ -1225,16 +1373,18 @@ void _ref_rnn_common_t<aprop, src_type, weights_type, acc_type>::execute_(
             ws_gates, ws_ht, ws_grid, scratch_gates, scratch_ht,
             scratch_diff_ht, scratch_cell, diff_weights_layer,
             diff_weights_iter, diff_weights_projection, diff_weights_peephole,
-            diff_bias, amx_scratchpad, A_addr_global, B_addr_global);
+            diff_bias, amx_scratchpad, A_addr_global, B_addr_global,
+            seq_lengths, augru_attention);
 
     // Finally we copy the results to the result buffers
     if (!(rnn.skip_dst_layer_copy() && rnn.is_fwd)) {
         if (pd()->dst_md(0)->data_type == data_type::f32)
             copy_res_layer(rnn, (float *)dst_layer, diff_src_layer, dst_iter,
-                    ws_states_layer, ws_diff_states_layer);
+                    ws_states_layer, ws_diff_states_layer, seq_lengths);
         else
             copy_res_layer(rnn, (dst_layer_t *)dst_layer, diff_src_layer,
-                    dst_iter, ws_states_layer, ws_diff_states_layer);
+                    dst_iter, ws_states_layer, ws_diff_states_layer,
+                    seq_lengths);
     }
 
     if (!(rnn.skip_dst_iter_copy() && rnn.is_fwd)) {
@@ -1242,12 +1392,12 @@ void _ref_rnn_common_t<aprop, src_type, weights_type, acc_type>::execute_(
             copy_res_iter(rnn, (float *)dst_iter, dst_iter_c, diff_src_iter,
                     diff_src_iter_c, dst_layer, ws_states_iter,
                     ws_states_iter_c, ws_diff_states_iter,
-                    ws_diff_states_iter_c);
+                    ws_diff_states_iter_c, seq_lengths);
         else
             copy_res_iter(rnn, (dst_iter_t *)dst_iter, dst_iter_c,
                     diff_src_iter, diff_src_iter_c, dst_layer, ws_states_iter,
                     ws_states_iter_c, ws_diff_states_iter,
-                    ws_diff_states_iter_c);
+                    ws_diff_states_iter_c, seq_lengths);
     }
 };
 
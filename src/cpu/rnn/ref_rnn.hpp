@@ -18,6 +18,7 @@
 #define CPU_RNN_REF_RNN_HPP
 
 #include <assert.h>
+#include <vector>
 
 #include "common/c_types_map.hpp"
 #include "common/memory_tracking.hpp"
@@ -123,7 +124,10 @@ struct _ref_rnn_common_t : public primitive_t {
             bool ok = true
                     && one_of(cell_kind, alg_kind::vanilla_rnn,
                             alg_kind::vanilla_lstm, alg_kind::vanilla_gru,
-                            alg_kind::lbr_gru)
+                            alg_kind::lbr_gru, alg_kind::vanilla_augru)
+                    && IMPLICATION(cell_kind == alg_kind::vanilla_augru,
+                            this->desc()->prop_kind == forward_inference
+                                    && weights_type != data_type::s8)
                     && IMPLICATION(aprop == prop_kind::forward,
                             one_of(this->desc()->prop_kind, forward_training,
                                     forward_inference))
@@ -133,10 +137,21 @@ struct _ref_rnn_common_t : public primitive_t {
                     && everyone_is(
                             weights_type, weights_iter_dt, weights_layer_dt)
                     && this->set_default_params() == status::success
-                    && this->with_bias();
+                    && this->with_bias()
+                    && IMPLICATION(this->with_seq_lengths(),
+                            this->desc()->prop_kind == forward_inference
+                                    && this->direction()
+                                            == dnnl_unidirectional_left2right
+                                    && weights_type != data_type::s8)
+                    && IMPLICATION(this->with_recompute_gates(),
+                            src_type == data_type::f32
+                                    && one_of(cell_kind, alg_kind::vanilla_rnn,
+                                            alg_kind::vanilla_lstm)
+                                    && !this->is_lstm_projection());
             if (!ok) return status::unimplemented;
 
             rnn_.is_brgemm = false;
+            rnn_.brgemm_persistent = false;
             ok = init_conf<class_name>(rnn_, *this->desc(), this->src_md(0),
                     this->src_md(1), this->src_md(2), this->weights_md(0),
                     this->weights_md(1),
@@ -296,6 +311,21 @@ struct _ref_rnn_common_t : public primitive_t {
 
             rnn_.unfused_post_gemm = (rnn_.M_blocks == 1);
 
+            // For small batches the weights dominate the memory traffic of a
+            // cell. If the per thread slice of the weights of a layer fits in
+            // L2, the cells of the layer are executed by a persistent thread
+            // team, every thread owning the same blocks of gate columns at
+            // every iteration. Each block is finalized by its own thread,
+            // hence the post-gemm has to be fused.
+            const dim_t wei_per_thr = sizeof(weights_t)
+                    * (rnn_.K1padded + rnn_.K2padded) * rnn_.n_block
+                    * rnn_.n_gates
+                    * utils::div_up(rnn_.N_blocks * rnn_.M_blocks, rnn_.nthr);
+            rnn_.brgemm_persistent = rnn_.n_iter > 1 && rnn_.nthr > 1
+                    && !rnn_.is_lstm_projection && dnnl_thr_syncable()
+                    && wei_per_thr < l2_cache_size / 2;
+            if (rnn_.brgemm_persistent) rnn_.unfused_post_gemm = false;
+
             rnn_.LDA1[0] = rnn_.src_layer_ld_;
             rnn_.LDA1[1] = rnn_.dst_iter_ld_;
             rnn_.LDA1[2] = rnn_.ws_states_layer_ld;
@@ -413,7 +443,7 @@ struct _ref_rnn_common_t : public primitive_t {
                     && everyone_is(
                             weights_type, weights_iter_dt, weights_layer_dt)
                     && this->set_default_params() == status::success
-                    && this->with_bias();
+                    && this->with_bias() && !this->with_seq_lengths();
             if (!ok) return status::unimplemented;
 
             rnn_.is_brgemm = true;
@@ -547,7 +577,11 @@ struct _ref_rnn_common_t : public primitive_t {
                         data_align, perf_align);
             }
 
-            int max_nparts = this->cell_kind() == alg_kind::vanilla_gru ? 2 : 1;
+            int max_nparts = utils::one_of(this->cell_kind(),
+                                     alg_kind::vanilla_gru,
+                                     alg_kind::vanilla_augru)
+                    ? 2
+                    : 1;
             int ptr_wei_sz = rnn_.n_layer * rnn_.n_dir * max_nparts;
             scratchpad.template book<float *>(
                     key_rnn_ptrs_wei_layer, ptr_wei_sz);
@@ -585,7 +619,9 @@ struct _ref_rnn_common_t : public primitive_t {
     };
 
     _ref_rnn_common_t(const pd_t *apd)
-        : primitive_t(apd), rnn_postgemm_(nullptr) {}
+        : primitive_t(apd)
+        , rnn_postgemm_(nullptr)
+        , rnn_postgemm_recompute_(nullptr) {}
 
     status_t init(engine_t *engine) override {
         /// @todo set max_feature_size assuming that we limit the number of
@@ -620,6 +656,10 @@ struct _ref_rnn_common_t : public primitive_t {
         rnn_postgemm_ = new rnn_postgemm_dispatcher<aprop, src_type,
                 scratch_type, acc_type>(pd()->rnn_, pd());
         assert(rnn_postgemm_ != nullptr);
+        if (aprop == prop_kind::backward && pd()->rnn_.recompute_gates)
+            rnn_postgemm_recompute_ = new rnn_postgemm_dispatcher<
+                    prop_kind::forward, src_type, acc_type, acc_type>(
+                    pd()->rnn_, pd());
         switch (pd()->cell_kind()) {
             case alg_kind::vanilla_rnn:
             case alg_kind::vanilla_lstm:
@@ -628,6 +668,7 @@ struct _ref_rnn_common_t : public primitive_t {
                         : &class_name::cell_execution_ref;
                 break;
             case alg_kind::vanilla_gru:
+            case alg_kind::vanilla_augru:
                 cell_func = &class_name::cell_execution_gru;
                 break;
             case alg_kind::lbr_gru:
@@ -647,6 +688,9 @@ struct _ref_rnn_common_t : public primitive_t {
                 scratch_ht_offset_, scratch_diff_ht_offset_,
                 scratch_cell_offset_, scratchpad_size, workspace_size);
 #if DNNL_X64
+        // the kernels are generated together once all descriptors are known
+        std::vector<const x64::brgemm_t *> brgemm_descs;
+        std::vector<std::unique_ptr<x64::brgemm_kernel_t> *> brgemm_kernels;
         auto init_brgemm = [&](x64::brgemm_t *desc, x64::cpu_isa_t isa,
                                    std::unique_ptr<x64::brgemm_kernel_t> &ker,
                                    dim_t M, dim_t N, dim_t K, dim_t LDA,
@@ -658,9 +702,8 @@ struct _ref_rnn_common_t : public primitive_t {
                         weights_type, transA, transB, layout, 1.0, beta, LDA,
                         LDB, LDC, M, N, K)
                     == status::success) {
-                x64::brgemm_kernel_t *_t_ptr;
-                brgemm_kernel_create(&_t_ptr, *desc);
-                safe_ptr_assign<x64::brgemm_kernel_t>(ker, _t_ptr);
+                brgemm_descs.push_back(desc);
+                brgemm_kernels.push_back(&ker);
             }
         };
 
@@ -791,13 +834,65 @@ struct _ref_rnn_common_t : public primitive_t {
                 }
             }
         }
+
+        if (pd()->rnn_.use_brgemm_bwd_data) {
+            // diff_src = scratch_gates * weights, all row-major with the
+            // weights in ldgoi format
+            const auto &rnn = pd()->rnn_;
+            const dim_t K = rnn.n_gates * rnn.dhc;
+            const dim_t sic = rnn.sic, slc = rnn.slc;
+            init_brgemm(&brgemm_desc_bwd_iter_, x64::isa_any,
+                    brgemm_kernel_bwd_iter_, rnn.m_block,
+                    nstl::min(sic, rnn.n_block), K, rnn.scratch_gates_ld,
+                    rnn.weights_iter_ld, rnn.ws_diff_states_iter_ld, 0.0);
+            if (rnn.sic % rnn.n_block)
+                init_brgemm(&brgemm_desc_bwd_iter_N_tail_, x64::isa_any,
+                        brgemm_kernel_bwd_iter_N_tail_, rnn.m_block,
+                        rnn.sic % rnn.n_block, K, rnn.scratch_gates_ld,
+                        rnn.weights_iter_ld, rnn.ws_diff_states_iter_ld, 0.0);
+            if (!rnn.merge_gemm_layer) {
+                init_brgemm(&brgemm_desc_bwd_layer_, x64::isa_any,
+                        brgemm_kernel_bwd_layer_, rnn.m_block,
+                        nstl::min(slc, rnn.n_block), K,
+                        rnn.scratch_gates_ld, rnn.weights_layer_ld,
+                        rnn.ws_diff_states_layer_ld, 0.0);
+                if (rnn.slc % rnn.n_block)
+                    init_brgemm(&brgemm_desc_bwd_layer_N_tail_, x64::isa_any,
+                            brgemm_kernel_bwd_layer_N_tail_, rnn.m_block,
+                            rnn.slc % rnn.n_block, K, rnn.scratch_gates_ld,
+                            rnn.weights_layer_ld, rnn.ws_diff_states_layer_ld,
+                            0.0);
+            }
+        }
+
+        const int n_kernels = (int)brgemm_descs.size();
+        std::vector<x64::brgemm_kernel_t *> kernels(n_kernels, nullptr);
+        if (n_kernels > 0)
+            x64::brgemm_kernels_create(
+                    n_kernels, kernels.data(), brgemm_descs.data());
+        for (int i = 0; i < n_kernels; i++)
+            safe_ptr_assign<x64::brgemm_kernel_t>(
+                    *brgemm_kernels[i], kernels[i]);
 #endif
         return status::success;
     }
 
-    ~_ref_rnn_common_t() { delete rnn_postgemm_; }
+    ~_ref_rnn_common_t() {
+        delete rnn_postgemm_;
+        delete rnn_postgemm_recompute_;
+    }
 
     status_t execute(const exec_ctx_t &ctx) const override {
+        if (pd()->with_seq_lengths()) {
+            // the finished sequences must form the tail of the batch
+            auto seq_lengths
+                    = CTX_IN_MEM(const int32_t *, DNNL_ARG_SEQ_LENGTHS);
+            for (dim_t b = 0; b < pd()->MB(); b++) {
+                const dim_t prev = b == 0 ? pd()->T() : seq_lengths[b - 1];
+                if (seq_lengths[b] < 1 || seq_lengths[b] > prev)
+                    return status::invalid_arguments;
+            }
+        }
         execute_(ctx);
         return status::success;
     }
@@ -822,6 +917,11 @@ private:
     x64::brgemm_t brgemm_desc_proj_K_tail_b1_[4];
     x64::brgemm_t brgemm_desc_proj_NK_tail_b1_[4];
 
+    x64::brgemm_t brgemm_desc_bwd_iter_;
+    x64::brgemm_t brgemm_desc_bwd_iter_N_tail_;
+    x64::brgemm_t brgemm_desc_bwd_layer_;
+    x64::brgemm_t brgemm_desc_bwd_layer_N_tail_;
+
     std::unique_ptr<x64::brgemm_kernel_t> brgemm_kernel_layer_b0_[3];
     std::unique_ptr<x64::brgemm_kernel_t> brgemm_kernel_iter_b0_[3];
     std::unique_ptr<x64::brgemm_kernel_t> brgemm_kernel_iter_b1_[3];
@@ -840,6 +940,11 @@ private:
     std::unique_ptr<x64::brgemm_kernel_t> brgemm_kernel_proj_K_tail_b1_[4];
     std::unique_ptr<x64::brgemm_kernel_t> brgemm_kernel_proj_NK_tail_b1_[4];
 
+    std::unique_ptr<x64::brgemm_kernel_t> brgemm_kernel_bwd_iter_;
+    std::unique_ptr<x64::brgemm_kernel_t> brgemm_kernel_bwd_iter_N_tail_;
+    std::unique_ptr<x64::brgemm_kernel_t> brgemm_kernel_bwd_layer_;
+    std::unique_ptr<x64::brgemm_kernel_t> brgemm_kernel_bwd_layer_N_tail_;
+
     char pallete_buff_[64];
     char pallete_buff_n_tail_[64];
     char pallete_buff_k1_tail_[64];
@@ -882,7 +987,8 @@ private:
     void copy_res_layer(const rnn_utils::rnn_conf_t &rnn,
             dst_layer_dt *dst_layer_, gemm_acc_t *diff_src_layer_,
             const dst_iter_dt *dst_iter_, const src_layer_t *ws_states_layer_,
-            const gemm_acc_t *ws_diff_states_layer_) const;
+            const gemm_acc_t *ws_diff_states_layer_,
+            const int32_t *seq_lengths_) const;
 
     template <typename prim_dst_iter_t, typename prim_dst_layer_t>
     void copy_res_iter(const rnn_utils::rnn_conf_t &rnn,
@@ -891,7 +997,8 @@ private:
             const prim_dst_layer_t *dst_layer_,
             const src_iter_t *ws_states_iter_, const float *ws_states_iter_c,
             const gemm_acc_t *ws_diff_states_iter_,
-            const gemm_acc_t *ws_diff_states_iter_c_) const;
+            const gemm_acc_t *ws_diff_states_iter_c_,
+            const int32_t *seq_lengths_) const;
 
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
 
@@ -911,6 +1018,9 @@ private:
     size_t scratch_cell_offset_;
     rnn_postgemm_dispatcher<aprop, src_type, scratch_type, acc_type>
             *rnn_postgemm_;
+    // backward with recomputed gates: the forward postgemm of the cells
+    rnn_postgemm_dispatcher<prop_kind::forward, src_type, acc_type, acc_type>
+            *rnn_postgemm_recompute_;
 
     grid_execution_f grid_computation;
     cell_execution_f cell_func;
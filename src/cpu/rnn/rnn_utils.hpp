@@ -20,6 +20,7 @@
 #include <type_traits>
 
 #include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
 #include "common/memory_desc_wrapper.hpp"
 #include "common/utils.hpp"
 
@@ -81,7 +82,8 @@
             gemm_acc_t *diff_weights_iter_, float *diff_weights_projection_, \
             float *diff_weights_peephole_, float *diff_bias_, \
             gemm_acc_t *amx_scratchpad, const src_iter_t **A_addr_global, \
-            weights_t **B_addr_global) const
+            weights_t **B_addr_global, const int32_t *seq_lengths_, \
+            const float *augru_attention_) const
 
 #define rnn_gemm_sig(f) \
     dnnl_status_t f(const char transA, const char transB, dim_t m, dim_t n, \
@@ -236,6 +238,22 @@ struct rnn_conf_t {
     bool merge_gemm_iter, merge_gemm_layer, force_nocopy, use_layer_packed_gemm,
             use_iter_packed_gemm, use_projection_packed_gemm;
     int n_iter_scratch_gates;
+    /// the cells on the same anti-diagonal of the (layer, iter) grid run
+    /// concurrently, every layer uses its own scratch_gates and scratch_cell
+    bool wavefront_execution;
+    /// bidirectional wavefront execution: the grids of both directions are
+    /// traversed at the same time, every direction uses its own scratches
+    bool concurrent_directions;
+    /// backward: the data gemms of a cell (diff_src_iter and, if not merged,
+    /// diff_src_layer) are computed with brgemm kernels by blocks of
+    /// m_block x n_block
+    bool use_brgemm_bwd_data;
+    /// forward inference: the sequence lengths are passed at execution time
+    /// and the finished sequences drop out of the cells of later iterations
+    bool with_seq_lengths;
+    /// training: the workspace holds the gates of a single cell, backward
+    /// recomputes them from the states before every cell
+    bool recompute_gates;
 
     inline bool is_int8() const {
         return utils::one_of(
@@ -270,12 +288,14 @@ struct rnn_conf_t {
                         dt_conf, u8u8u8u8, u8u8u8f32, all_f32, all_bf16);
     }
     inline bool skip_dst_layer_copy() const {
-        return (exec_dir == l2r)
+        // with variable sequence lengths the results of the finished
+        // sequences are taken from the workspace
+        return !with_seq_lengths && (exec_dir == l2r)
                 && utils::one_of(
                         dt_conf, u8u8u8u8, f32u8f32u8, all_f32, all_bf16);
     }
     inline bool skip_dst_iter_copy() const {
-        return (exec_dir == l2r) && (dst_iter_ld_ > 0)
+        return !with_seq_lengths && (exec_dir == l2r) && (dst_iter_ld_ > 0)
                 && utils::one_of(
                         dt_conf, u8u8u8u8, u8u8u8f32, all_f32, all_bf16);
     }
@@ -397,6 +417,10 @@ struct rnn_conf_t {
     x64::cpu_isa_t brgemm_isa;
 #endif
     bool unfused_post_gemm;
+    /// a single thread team runs all the cells of a layer: every thread keeps
+    /// computing the same gate columns, so that its slice of the weights
+    /// stays in its L2, and the threads synchronize after every cell
+    bool brgemm_persistent;
 };
 
 bool is_ldigo(const memory_desc_wrapper &md);
@@ -428,6 +452,9 @@ bool init_conf(rnn_conf_t &rnn, const rnn_desc_t &rd,
             && !memory_desc_wrapper(rd.weights_peephole_desc).is_zero();
     rnn.is_lstm_projection = rd.cell_kind == dnnl_vanilla_lstm
             && !memory_desc_wrapper(rd.weights_projection_desc).is_zero();
+    rnn.with_seq_lengths = rd.flags & rnn_flags::seq_lengths;
+    rnn.recompute_gates
+            = rnn.is_training && (rd.flags & rnn_flags::recompute_gates);
 
     switch (rd.direction) {
         case dnnl_unidirectional_left2right: rnn.exec_dir = l2r; break;
@@ -554,7 +581,8 @@ bool init_conf(rnn_conf_t &rnn, const rnn_desc_t &rd,
             : dst_iter_c_d.blocking_desc().strides[2];
 
     /* Set the correct number of weights parts */
-    bool is_orig_gru = rd.cell_kind == alg_kind::vanilla_gru;
+    bool is_orig_gru = utils::one_of(
+            rd.cell_kind, alg_kind::vanilla_gru, alg_kind::vanilla_augru);
     rnn.n_parts_weights_layer = 1;
     rnn.parts_weights_layer[0] = rnn.n_gates;
     rnn.parts_weights_layer[1] = 0;
@@ -573,8 +601,8 @@ bool init_conf(rnn_conf_t &rnn, const rnn_desc_t &rd,
     /* Decide wich gemm implementation to use: packed/nonpacked jit/cblas
      * and if to mergre gemm across iterations */
     bool is_f32 = rnn.dt_conf == all_f32, is_bf16 = rnn.dt_conf == all_bf16;
-    bool is_gru = utils::one_of(
-            rd.cell_kind, alg_kind::vanilla_gru, alg_kind::lbr_gru);
+    bool is_gru = utils::one_of(rd.cell_kind, alg_kind::vanilla_gru,
+            alg_kind::lbr_gru, alg_kind::vanilla_augru);
     bool is_inference = !rnn.is_training;
 
     // To be able to merge the GEMM on the layer input when not
@@ -590,6 +618,7 @@ bool init_conf(rnn_conf_t &rnn, const rnn_desc_t &rd,
                               && dst_layer_is_trivial_stride))
                     && (((rnn.is_fwd && rnn.mb < 128) || !rnn.is_fwd)
                             || rnn.is_int8())
+                    && !rnn.with_seq_lengths
             : false;
     rnn.merge_gemm_iter = (!rnn.is_brgemm)
             ? dst_layer_is_trivial_stride && !(rnn.is_fwd || is_gru)
@@ -625,6 +654,57 @@ bool init_conf(rnn_conf_t &rnn, const rnn_desc_t &rd,
                     && ((is_f32 && pack_sgemm_supported() && rnn.n_iter == 1)
                             || rnn.is_int8() || is_bf16)
             : false;
+    // the packed gemms are initialized for the whole batch
+    if (rnn.with_seq_lengths)
+        rnn.use_layer_packed_gemm = rnn.use_iter_packed_gemm
+                = rnn.use_projection_packed_gemm = false;
+
+    /* Decide whether to run the independent cells concurrently. For small
+     * batches the cell gemms are too small to occupy all the threads, while
+     * a stacked RNN has up to min(n_layer, n_iter) independent cells at a
+     * time. Packed gemms are excluded as the packed weights are split
+     * between the threads of the whole team. The two directions of a
+     * bidirectional RNN are independent, so they double the number of
+     * concurrent cells and the sum or concatenation of their outputs is
+     * done once the grids are complete. */
+    rnn.concurrent_directions = rnn.n_dir == 2;
+    rnn.wavefront_execution = !rnn.is_brgemm && rnn.is_fwd && is_inference
+            && ((rnn.n_layer > 1 && rnn.n_iter > 1)
+                    || rnn.concurrent_directions)
+            && rnn.mb <= 16 && !rnn.is_lstm_projection
+            && !rnn.use_layer_packed_gemm && !rnn.use_iter_packed_gemm
+            && dnnl_get_max_threads() > 1;
+    if (!rnn.wavefront_execution) rnn.concurrent_directions = false;
+    // the layer gemm is merged across iterations of a single layer only
+    if (rnn.wavefront_execution) rnn.merge_gemm_layer = false;
+
+    /* Decide whether to use brgemm for the backward data gemms of a cell.
+     * They have only mb rows and are called for every cell, so the regular
+     * gemm spends a significant part of the time on packing the operands.
+     * The weights gemms are kept as is since they are merged across
+     * iterations whenever possible. */
+    rnn.use_brgemm_bwd_data = false;
+#if DNNL_X64
+    rnn.use_brgemm_bwd_data = !rnn.is_fwd && is_f32
+            && utils::one_of(rd.cell_kind, alg_kind::vanilla_rnn,
+                    alg_kind::vanilla_lstm)
+            && x64::mayiuse(x64::avx512_core);
+    if (rnn.use_brgemm_bwd_data) {
+        // split the minibatch only if the columns cannot occupy the threads
+        rnn.n_block = 32;
+        const dim_t N_blocks = utils::div_up(
+                nstl::min(rnn.sic, rnn.slc), rnn.n_block);
+        const dim_t max_m_block = nstl::max(1,
+                rnn.mb / utils::div_up(dnnl_get_max_threads(), N_blocks));
+        rnn.m_block = 1;
+        for (dim_t m = max_m_block; m > 1; m--)
+            if (rnn.mb % m == 0) {
+                rnn.m_block = m;
+                break;
+            }
+        rnn.M_blocks = rnn.mb / rnn.m_block;
+    }
+#endif
 
     /* Set packed gemm sizes */
     /* TODO: investigate the benefit of mixing packed and non-packed weights parts */
@@ -798,9 +878,12 @@ void set_conf(rnn_conf_t &rnn, const rnn_desc_t &rd,
                     * sizeof(typename T::gemm_acc_t)
             : (size_t)0;
 
+    const int n_cells_ws_gates = rnn.recompute_gates
+            ? 1
+            : rnn.n_layer * rnn.n_dir * rnn.n_iter;
     rnn.ws_gates_size = rnn.is_training
-            ? (size_t)rnn.n_layer * rnn.n_dir * rnn.n_iter * rnn.ws_gates_nld
-                    * rnn.ws_gates_ld * sizeof(typename T::gates_t)
+            ? (size_t)n_cells_ws_gates * rnn.ws_gates_nld * rnn.ws_gates_ld
+                    * sizeof(typename T::gates_t)
             : (size_t)0;
     rnn.ws_ht_size = rnn.is_training
             ? (size_t)rnn.n_layer * rnn.n_dir * rnn.n_iter * rnn.ws_ht_nld
@@ -808,8 +891,11 @@ void set_conf(rnn_conf_t &rnn, const rnn_desc_t &rd,
             : (size_t)0;
     rnn.n_iter_scratch_gates
             = (rnn.merge_gemm_layer || rnn.merge_gemm_iter) ? rnn.n_iter : 1;
-    rnn.scratch_gates_size = rnn.n_iter_scratch_gates * rnn.scratch_gates_nld
-            * rnn.scratch_gates_ld * sizeof(typename T::scratch_t);
+    const int n_layer_scratch = (rnn.wavefront_execution ? rnn.n_layer : 1)
+            * (rnn.concurrent_directions ? rnn.n_dir : 1);
+    rnn.scratch_gates_size = n_layer_scratch * rnn.n_iter_scratch_gates
+            * rnn.scratch_gates_nld * rnn.scratch_gates_ld
+            * sizeof(typename T::scratch_t);
     rnn.scratch_ht_size
             = rnn.scratch_ht_nld * rnn.scratch_ht_ld * sizeof(typename T::ht_t);
     rnn.scratch_diff_ht_size = rnn.is_training ? rnn.scratch_diff_ht_nld
@@ -818,14 +904,29 @@ void set_conf(rnn_conf_t &rnn, const rnn_desc_t &rd,
 
     /* set other sizes */
     /// scratchpad buffer for each cell to hold intermediate data in gru/lbr_gru
+    /// in lbr_gru it is accessed with ws_gates_ld, which is padded for the
+    /// gates data type and can exceed scratch_gates_ld in int8
     rnn.scratch_cell_size = rnn.is_lbr
-            ? (size_t)rnn.scratch_gates_nld * rnn.scratch_gates_ld
+            ? (size_t)rnn.scratch_gates_nld
+                    * nstl::max(rnn.scratch_gates_ld, rnn.ws_gates_ld)
                     * sizeof(typename T::gemm_acc_t)
-            : (rd.cell_kind == alg_kind::vanilla_gru
+            : (utils::one_of(rd.cell_kind, alg_kind::vanilla_gru,
+                               alg_kind::vanilla_augru)
                             ? (size_t)rnn.ws_states_layer_nld
                                     * rnn.ws_states_layer_ld
                                     * sizeof(typename T::gemm_acc_t)
                             : 0);
+    rnn.scratch_cell_size *= n_layer_scratch;
+    /// with recomputed gates the cell outputs of the forward postgemm are
+    /// dropped to the scratch, as the states are in the workspace already
+    if (rnn.recompute_gates)
+        rnn.scratch_cell_size = (size_t)rnn.ws_states_layer_nld
+                        * rnn.ws_states_layer_ld
+                        * sizeof(typename T::dst_layer_t)
+                + (is_lstm ? (size_t)rnn.ws_states_iter_c_nld
+                                        * rnn.ws_states_iter_c_ld
+                                        * sizeof(float)
+                           : 0);
     /// workspace needed for lbr GRU
     rnn.ws_per_cell = (size_t)rnn.is_lbr * rnn.mb * rnn.dhc
             * sizeof(typename T::gemm_acc_t);
@@ -100,6 +100,8 @@ void simple_layer_normalization_fwd_t<data_type>::execute_forward(
     auto src = CTX_IN_MEM(const data_t *, DNNL_ARG_SRC);
     auto dst = CTX_OUT_MEM(data_t *, DNNL_ARG_DST);
     auto scaleshift = CTX_IN_MEM(const float *, DNNL_ARG_SCALE_SHIFT);
+    auto src_1 = CTX_IN_MEM(const data_t *, DNNL_ARG_SRC_1);
+    auto dst_1 = CTX_OUT_MEM(data_t *, DNNL_ARG_DST_1);
 
     float *mean, *variance;
     if (pd()->use_tmp_stats()) {
@@ -128,10 +130,14 @@ void simple_layer_normalization_fwd_t<data_type>::execute_forward(
         auto v_mean = calculate_stats ? 0 : mean[n];
         auto v_variance = calculate_stats ? 0 : variance[n];
 
+        const dim_t off = n * C_padded;
+        const data_t *src_1_n = src_1 ? &src_1[off] : nullptr;
+        data_t *dst_1_n = dst_1 ? &dst_1[off] : nullptr;
+
         if (calculate_stats)
-            (*stat_kernel_)(&src[n * C_padded], &v_mean, &v_variance);
+            (*stat_kernel_)(&src[off], src_1_n, &v_mean, &v_variance);
 
-        (*data_kernel_)(&src[n * C_padded], &dst[n * C_padded], scaleshift,
+        (*data_kernel_)(&src[off], src_1_n, &dst[off], dst_1_n, scaleshift,
                 &v_mean, &v_variance);
 
         if (calculate_stats) {
@@ -197,28 +203,43 @@ void simple_layer_normalization_bwd_t<data_type>::execute_backward(
     const dim_t C = pd()->norm_axis();
     const dim_t C_padded = src_d.padded_dims()[pd()->ndims() - 1];
 
-    float *reduce = scratchpad.template get<float>(key_lnorm_reduction);
-    if (diff_scaleshift == nullptr)
-        diff_scaleshift = scratchpad.template get<float>(key_lnorm_tmp_diff_ss);
+    // diff_scaleshift is not needed for backward_data, and a user may not
+    // ask for it even when scaleshift is used
+    const bool calculate_diff_ss = diff_scaleshift != nullptr;
+    float *reduce = calculate_diff_ss
+            ? scratchpad.template get<float>(key_lnorm_reduction)
+            : nullptr;
 
+    // The partial diff_scaleshift and diff_src of a row are computed one
+    // right after another, so that src and diff_dst are read from memory
+    // only once
     int max_nthr = dnnl_get_max_threads();
     parallel(max_nthr, [&](int ithr, int nthr) {
         assert(nthr == max_nthr);
         dim_t N_s = 0, N_e = 0;
         balance211(N, nthr, ithr, N_s, N_e);
 
-        float *my_diff_gamma = reduce + C * ithr;
-        float *my_diff_beta = reduce + C * nthr + C * ithr;
-        for (dim_t c = 0; c < C; c++) {
-            my_diff_gamma[c] = 0.;
-            my_diff_beta[c] = 0.;
+        float *my_diff_gamma = nullptr, *my_diff_beta = nullptr;
+        if (calculate_diff_ss) {
+            my_diff_gamma = reduce + C * ithr;
+            my_diff_beta = reduce + C * nthr + C * ithr;
+            for (dim_t c = 0; c < C; c++) {
+                my_diff_gamma[c] = 0.;
+                my_diff_beta[c] = 0.;
+            }
         }
         for (dim_t n = N_s; n < N_e; n++) {
-            (*diff_ss_kernel_)(&src[n * C_padded], &diff_dst[n * C_padded],
-                    my_diff_gamma, my_diff_beta, &mean[n], &variance[n]);
+            if (calculate_diff_ss)
+                (*diff_ss_kernel_)(&src[n * C_padded], &diff_dst[n * C_padded],
+                        my_diff_gamma, my_diff_beta, &mean[n], &variance[n]);
+            (*diff_data_kernel_)(&src[n * C_padded], &diff_dst[n * C_padded],
+                    &diff_src[n * C_padded], scaleshift, &mean[n],
+                    &variance[n]);
         }
     });
 
+    if (!calculate_diff_ss) return;
+
     parallel_nd(C, [&](dim_t c) {
         float diff_gamma = 0, diff_beta = 0;
         for (dim_t n = 0; n < max_nthr; n++) {
@@ -228,18 +249,6 @@ void simple_layer_normalization_bwd_t<data_type>::execute_backward(
         diff_scaleshift[c] = diff_gamma;
         diff_scaleshift[C + c] = diff_beta;
     });
-
-    parallel(max_nthr, [&](int ithr, int nthr) {
-        assert(nthr == max_nthr);
-        dim_t N_s = 0, N_e = 0;
-        balance211(N, nthr, ithr, N_s, N_e);
-
-        for (dim_t n = N_s; n < N_e; n++) {
-            (*diff_data_kernel_)(&src[n * C_padded], &diff_dst[n * C_padded],
-                    &diff_src[n * C_padded], scaleshift, &mean[n],
-                    &variance[n]);
-        }
-    });
 }
 
 template struct simple_layer_normalization_fwd_t<bf16>;
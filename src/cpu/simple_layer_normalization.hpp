@@ -186,10 +186,9 @@ struct simple_layer_normalization_bwd_t : public primitive_t {
                 scratchpad.template book<float>(
                         key_lnorm_tmp_var, across_axis());
             }
-            scratchpad.template book<float>(key_lnorm_reduction,
-                    2 * norm_axis() * dnnl_get_max_threads());
-            scratchpad.template book<float>(
-                    key_lnorm_tmp_diff_ss, 2 * norm_axis());
+            if (use_scaleshift())
+                scratchpad.template book<float>(key_lnorm_reduction,
+                        2 * norm_axis() * dnnl_get_max_threads());
             if (reordered_stat_md_ != *stat_md() && !stats_are_tmp()) {
                 scratchpad.book(key_nested, reorder_pd_->scratchpad_registry());
             }
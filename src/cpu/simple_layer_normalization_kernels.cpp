@@ -32,8 +32,26 @@ namespace lnorm_utils {
 using namespace data_type;
 
 template <>
-void statistics_kernel_t<f32>::operator()(
-        const float *src, float *mean, float *var) const {
+void statistics_kernel_t<f32>::operator()(const float *src,
+        const float *src_1, float *mean, float *var) const {
+    if (src_1) {
+        float v_mean = 0;
+        for (dim_t c = 0; c < C_; ++c)
+            v_mean += src[c] + src_1[c];
+        v_mean /= C_;
+
+        float v_variance = 0;
+        for (dim_t c = 0; c < C_; ++c) {
+            auto m = src[c] + src_1[c] - v_mean;
+            v_variance += m * m;
+        }
+        v_variance /= C_;
+
+        *mean = v_mean;
+        *var = v_variance;
+        return;
+    }
+
     float v_mean = 0;
     PRAGMA_OMP_SIMD(reduction(+ : v_mean))
     for (dim_t c = 0; c < C_; ++c) {
@@ -54,10 +72,22 @@ void statistics_kernel_t<f32>::operator()(
 }
 
 template <>
-void data_kernel_t<f32>::operator()(const float *src, float *dst,
-        const float *ss, const float *mean, const float *var) const {
+void data_kernel_t<f32>::operator()(const float *src, const float *src_1,
+        float *dst, float *dst_1, const float *ss, const float *mean,
+        const float *var) const {
     const float inv_sqrtvar = 1. / sqrtf(*var + eps_);
 
+    if (src_1) {
+        for (dim_t c = 0; c < C_; ++c) {
+            const float sm = (use_scaleshift_ ? ss[c] : 1.0f) * inv_sqrtvar;
+            const float sv = use_scaleshift_ ? ss[C_ + c] : 0;
+            const float s = src[c] + src_1[c];
+            dst[c] = sm * (s - *mean) + sv;
+            if (dst_1) dst_1[c] = s;
+        }
+        return;
+    }
+
     // XXX: manual unrolling for use_scaleshift_ due to clang issue.
     //      see: CLANG_WA_01_SAFE_TO_USE_OMP_SIMD
     if (use_scaleshift_) {
@@ -147,13 +177,14 @@ void diff_data_kernel_t<bf16>::operator()(const bfloat16_t *src,
 }
 
 template <>
-void statistics_kernel_t<bf16>::operator()(
-        const bfloat16_t *src, float *mean, float *var) const {
+void statistics_kernel_t<bf16>::operator()(const bfloat16_t *src,
+        const bfloat16_t *src_1, float *mean, float *var) const {
     assert(!"No default statistics_kernel_t operator() for bf16 input!");
 }
 
 template <>
-void data_kernel_t<bf16>::operator()(const bfloat16_t *src, bfloat16_t *dst,
+void data_kernel_t<bf16>::operator()(const bfloat16_t *src,
+        const bfloat16_t *src_1, bfloat16_t *dst, bfloat16_t *dst_1,
         const float *ss, const float *mean, const float *var) const {
     assert(!"No default data_kernel_t operator() for bf16 input!");
 }
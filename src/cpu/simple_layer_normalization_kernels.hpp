@@ -31,15 +31,18 @@ struct statistics_kernel_t {
             const layer_normalization_pd_t *pd);
     virtual ~statistics_kernel_t() = default;
 
-    virtual void operator()(const data_t *src, float *mean, float *var) const;
+    // src_1 is the residual added to src, nullptr if there is none
+    virtual void operator()(const data_t *src, const data_t *src_1,
+            float *mean, float *var) const;
 
     virtual status_t create_kernel() { return status::success; }
 
 protected:
     statistics_kernel_t(const layer_normalization_pd_t *pd)
-        : C_(pd->norm_axis()) {}
+        : C_(pd->norm_axis()), fuse_residual_add_(pd->fuse_residual_add()) {}
 
     int C_;
+    bool fuse_residual_add_;
 };
 
 template <data_type_t data_type>
@@ -48,8 +51,11 @@ struct data_kernel_t {
     static data_kernel_t<data_type> *create(const layer_normalization_pd_t *pd);
     virtual ~data_kernel_t() = default;
 
-    virtual void operator()(const data_t *src, data_t *dst, const float *ss,
-            const float *mean, const float *var) const;
+    // src_1 is the residual added to src and dst_1 receives their sum,
+    // either is nullptr if absent
+    virtual void operator()(const data_t *src, const data_t *src_1,
+            data_t *dst, data_t *dst_1, const float *ss, const float *mean,
+            const float *var) const;
 
     virtual status_t create_kernel() { return status::success; }
 
@@ -57,10 +63,12 @@ protected:
     data_kernel_t(const layer_normalization_pd_t *pd)
         : C_(pd->norm_axis())
         , use_scaleshift_(pd->use_scaleshift())
+        , fuse_residual_add_(pd->fuse_residual_add())
         , eps_(pd->desc()->layer_norm_epsilon) {}
 
     int C_;
     bool use_scaleshift_;
+    bool fuse_residual_add_;
     const float eps_;
 };
 
@@ -1446,17 +1446,21 @@ struct simple_reorder_impl<SIMPLE_REORDER_TEMPL_CALL,
                 input_d.dims() + ndims_start, ndims_mask);
         const ptrdiff_t D_rest = nelems / D_start / D_mask;
 
-        parallel_nd(D_start, D_mask, D_rest,
-                [&](ptrdiff_t ds, ptrdiff_t dm, ptrdiff_t dr) {
-                    const float scale = scales[dm];
+        auto ker = [&](ptrdiff_t ds, ptrdiff_t dm, ptrdiff_t dr) {
+            const float scale = scales[dm];
 
-                    const size_t e = (ds * D_mask + dm) * D_rest + dr;
-                    const auto &i = input[input_d.off_l(e)];
-                    auto &o = output[output_d.off_l(e)];
+            const size_t e = (ds * D_mask + dm) * D_rest + dr;
+            const auto &i = input[input_d.off_l(e)];
+            auto &o = output[output_d.off_l(e)];
 
-                    float f = scale * ((float)i - i0) + o0;
-                    o = _qz<data_type::f32, type_o>()(f, o, 1.f, beta);
-                });
+            float f = scale * ((float)i - i0) + o0;
+            o = _qz<data_type::f32, type_o>()(f, o, 1.f, beta);
+        };
+
+        if (is_small_reorder(input_d))
+            for_nd(0, 1, D_start, D_mask, D_rest, ker);
+        else
+            parallel_nd_dynamic(D_start, D_mask, D_rest, ker);
 
         return status::success;
     }
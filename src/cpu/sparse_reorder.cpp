@@ -0,0 +1,126 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/dnnl_thread.hpp"
+
+#include "cpu/sparse_reorder.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+template <data_type_t type>
+status_t sparse_reorder_t<type>::compress(const exec_ctx_t &ctx) const {
+    auto src = CTX_IN_MEM(const data_t *, DNNL_ARG_FROM);
+    auto dst = CTX_OUT_MEM(char *, DNNL_ARG_TO);
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+    const auto &sd = dst_d.sparse_desc();
+
+    const dim_t D0 = dst_d.dims()[0], D1 = dst_d.dims()[1];
+    const dim_t B0 = sd.block_dims[0], B1 = sd.block_dims[1];
+    const dim_t NB0 = dst_d.padded_dims()[0] / B0;
+    const dim_t NB1 = dst_d.padded_dims()[1] / B1;
+
+    data_t *values = reinterpret_cast<data_t *>(dst);
+    int32_t *row_ptr = reinterpret_cast<int32_t *>(dst + sd.row_ptr_offset);
+    int32_t *col_idx = reinterpret_cast<int32_t *>(dst + sd.col_idx_offset);
+
+    auto is_zero_block = [&](dim_t b0, dim_t b1) {
+        for_(dim_t i0 = b0 * B0; i0 < nstl::min(D0, (b0 + 1) * B0); ++i0)
+        for (dim_t i1 = b1 * B1; i1 < nstl::min(D1, (b1 + 1) * B1); ++i1)
+            if (src[src_d.off(i0, i1)] != (data_t)0) return false;
+        return true;
+    };
+
+    // count the non-zero blocks of each block row first, so that the rows
+    // can then be filled in parallel
+    parallel_nd(NB0, [&](dim_t b0) {
+        int32_t nnz = 0;
+        for (dim_t b1 = 0; b1 < NB1; ++b1)
+            if (!is_zero_block(b0, b1)) ++nnz;
+        row_ptr[b0 + 1] = nnz;
+    });
+    row_ptr[0] = 0;
+    for (dim_t b0 = 0; b0 < NB0; ++b0)
+        row_ptr[b0 + 1] += row_ptr[b0];
+    if (row_ptr[NB0] > sd.nnz_blocks) return status::invalid_arguments;
+
+    parallel_nd(NB0, [&](dim_t b0) {
+        dim_t blk = row_ptr[b0];
+        for (dim_t b1 = 0; b1 < NB1; ++b1) {
+            if (is_zero_block(b0, b1)) continue;
+            data_t *v = values + blk * B0 * B1;
+            for_(dim_t i0 = 0; i0 < B0; ++i0)
+            for (dim_t i1 = 0; i1 < B1; ++i1) {
+                const dim_t d0 = b0 * B0 + i0, d1 = b1 * B1 + i1;
+                v[i0 * B1 + i1] = d0 < D0 && d1 < D1
+                        ? src[src_d.off(d0, d1)]
+                        : (data_t)0;
+            }
+            col_idx[blk++] = (int32_t)b1;
+        }
+    });
+
+    return status::success;
+}
+
+template <data_type_t type>
+status_t sparse_reorder_t<type>::decompress(const exec_ctx_t &ctx) const {
+    auto src = CTX_IN_MEM(const char *, DNNL_ARG_FROM);
+    auto dst = CTX_OUT_MEM(data_t *, DNNL_ARG_TO);
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+    const auto &sd = src_d.sparse_desc();
+
+    const dim_t D0 = src_d.dims()[0], D1 = src_d.dims()[1];
+    const dim_t B0 = sd.block_dims[0], B1 = sd.block_dims[1];
+    const dim_t NB0 = src_d.padded_dims()[0] / B0;
+
+    const data_t *values = reinterpret_cast<const data_t *>(src);
+    const int32_t *row_ptr
+            = reinterpret_cast<const int32_t *>(src + sd.row_ptr_offset);
+    const int32_t *col_idx
+            = reinterpret_cast<const int32_t *>(src + sd.col_idx_offset);
+
+    parallel_nd(NB0, [&](dim_t b0) {
+        const dim_t d0_end = nstl::min(D0, (b0 + 1) * B0);
+        for_(dim_t d0 = b0 * B0; d0 < d0_end; ++d0)
+        for (dim_t d1 = 0; d1 < D1; ++d1)
+            dst[dst_d.off(d0, d1)] = (data_t)0;
+
+        for (dim_t blk = row_ptr[b0]; blk < row_ptr[b0 + 1]; ++blk) {
+            const data_t *v = values + blk * B0 * B1;
+            const dim_t b1 = col_idx[blk];
+            const dim_t d1_end = nstl::min(D1, (b1 + 1) * B1);
+            for_(dim_t d0 = b0 * B0; d0 < d0_end; ++d0)
+            for (dim_t d1 = b1 * B1; d1 < d1_end; ++d1)
+                dst[dst_d.off(d0, d1)] = v[(d0 % B0) * B1 + d1 % B1];
+        }
+    });
+
+    return status::success;
+}
+
+template struct sparse_reorder_t<data_type::f32>;
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
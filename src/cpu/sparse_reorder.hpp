@@ -0,0 +1,92 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_SPARSE_REORDER_HPP
+#define CPU_SPARSE_REORDER_HPP
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_reorder_pd.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+// Compresses a dense two-dimensional tensor into the block compressed sparse
+// row format, or decompresses it back.
+template <data_type_t type>
+struct sparse_reorder_t : public primitive_t {
+    struct pd_t : public cpu_reorder_pd_t {
+        using cpu_reorder_pd_t::cpu_reorder_pd_t;
+
+        DECLARE_COMMON_PD_T("sparse:any", sparse_reorder_t);
+
+        static status_t create(reorder_pd_t **reorder_pd, engine_t *engine,
+                const primitive_attr_t *attr, engine_t *src_engine,
+                const memory_desc_t *src_md, engine_t *dst_engine,
+                const memory_desc_t *dst_md) {
+            using namespace status;
+
+            const memory_desc_wrapper id(src_md), od(dst_md);
+            const bool compress = id.is_blocking_desc() && od.is_sparse_desc();
+            const bool decompress
+                    = id.is_sparse_desc() && od.is_blocking_desc();
+            bool args_ok = (compress || decompress) && id.data_type() == type
+                    && od.data_type() == type && id.ndims() == 2
+                    && od.ndims() == 2 && id.consistent_with(od)
+                    && !id.has_runtime_dims_or_strides()
+                    && !od.has_runtime_dims_or_strides()
+                    && attr->has_default_values();
+            if (!args_ok) return invalid_arguments;
+
+            auto _pd = new pd_t(attr, src_engine->kind(), src_md,
+                    dst_engine->kind(), dst_md);
+            if (_pd == nullptr) return out_of_memory;
+            if (_pd->init(engine, src_engine, dst_engine) != success) {
+                delete _pd;
+                return unimplemented;
+            }
+            _pd->init_scratchpad_md();
+            return safe_ptr_assign(*reorder_pd, _pd);
+        }
+    };
+
+    sparse_reorder_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t execute(const exec_ctx_t &ctx) const override {
+        const memory_desc_wrapper id(pd()->src_md());
+        if (id.is_sparse_desc()) return decompress(ctx);
+        return compress(ctx);
+    }
+
+private:
+    typedef typename prec_traits<type>::type data_t;
+
+    status_t compress(const exec_ctx_t &ctx) const;
+    status_t decompress(const exec_ctx_t &ctx) const;
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -34,12 +34,33 @@ struct jit_amx_tilecfg_t : public jit_generator {
     void tile_configure(const char *palette) const { (*this)(palette); }
 
 private:
+    // The kernel is called for every parallel chunk, mostly with the palette
+    // that is already loaded. The current configuration is stored and
+    // compared with the requested one first, so that the tiles are released
+    // and reloaded only when it changes. Reading the state back rather than
+    // caching it keeps the check correct when a kernel or the application
+    // reconfigures the tiles in between.
     void generate() override {
+        const int palette_size = 64;
+        Xbyak::Label reconfigure, done;
+
         preamble();
+        sub(rsp, palette_size);
+
+        sttilecfg(ptr[rsp]);
+        for (int off = 0; off < palette_size; off += 8) {
+            mov(rax, ptr[rsp + off]);
+            cmp(rax, ptr[abi_param1 + off]);
+            jne(reconfigure, T_NEAR);
+        }
+        jmp(done, T_NEAR);
 
+        L(reconfigure);
         tilerelease();
         ldtilecfg(ptr[abi_param1]);
 
+        L(done);
+        add(rsp, palette_size);
         postamble();
     }
 };
@@ -14,9 +14,12 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <vector>
+
 #include "cpu/x64/brgemm/brgemm.hpp"
 
 #include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
 #include "common/nstl.hpp"
 #include "common/type_helpers.hpp"
 #include "common/utils.hpp"
@@ -172,9 +175,12 @@ status_t brgemm_desc_init(brgemm_t *brg, cpu_isa_t isa,
 
     brg->is_int8 = (one_of(brg->dt_a, data_type::u8, data_type::s8)
             && brg->dt_b == data_type::s8);
-    brg->is_bf16
-            = (brg->dt_a == data_type::bf16 && brg->dt_b == data_type::bf16);
-    brg->is_f32 = (brg->dt_a == data_type::f32 && brg->dt_b == data_type::f32);
+    brg->with_wei_decomp = one_of(brg->dt_a, data_type::f32, data_type::bf16)
+            && brg->dt_b == data_type::s8;
+    brg->is_bf16 = brg->dt_a == data_type::bf16
+            && (brg->dt_b == data_type::bf16 || brg->with_wei_decomp);
+    brg->is_f32 = brg->dt_a == data_type::f32
+            && (brg->dt_b == data_type::f32 || brg->with_wei_decomp);
     if (!brg->is_int8 && !brg->is_bf16 && !brg->is_f32)
         return status::unimplemented;
     brg->dt_c = (brg->is_int8) ? data_type::s32 : data_type::f32;
@@ -193,6 +199,11 @@ status_t brgemm_desc_init(brgemm_t *brg, cpu_isa_t isa,
                     avx512_core_bf16_amx_bf16, avx512_core_bf16_amx_int8)) {
             return status::invalid_arguments;
         }
+        // the tiles cannot convert B on load
+        if (brg->with_wei_decomp
+                && one_of(isa, avx512_core_bf16_amx_bf16,
+                        avx512_core_bf16_amx_int8))
+            return status::unimplemented;
         brg->is_int8_amx = brg->is_bf16_amx = false;
         if (brg->is_int8 && isa == avx512_core_bf16_amx_int8) {
             if (!mayiuse(avx512_core_bf16_amx_int8))
@@ -206,7 +217,8 @@ status_t brgemm_desc_init(brgemm_t *brg, cpu_isa_t isa,
         }
     } else {
         brg->is_int8_amx = brg->is_int8 && mayiuse(avx512_core_bf16_amx_int8);
-        brg->is_bf16_amx = brg->is_bf16 && mayiuse(avx512_core_bf16_amx_bf16);
+        brg->is_bf16_amx = brg->is_bf16 && !brg->with_wei_decomp
+                && mayiuse(avx512_core_bf16_amx_bf16);
     }
     brg->req_s8s8_compensation
             = brg->is_int8 && !brg->is_int8_amx && brg->dt_a == data_type::s8;
@@ -224,6 +236,8 @@ status_t brgemm_desc_init(brgemm_t *brg, cpu_isa_t isa,
     brg->with_eltwise = false;
     brg->with_sum = false;
     brg->sum_scale = 0;
+    brg->with_dst_zero_point = false;
+    brg->dst_zero_point = 0;
     brg->with_scales = false;
 
     brg->beta = beta;
@@ -259,6 +273,8 @@ status_t brgemm_desc_init(brgemm_t *brg, cpu_isa_t isa,
                         ? 28
                         : ((brg->beta == 1.f || brg->beta == 0.f) ? 30 : 29));
         max_regs -= brg->req_s8s8_compensation;
+        // two registers hold the halves of B converted to bf16
+        if (brg->with_wei_decomp && brg->is_bf16) max_regs -= 2;
         max_regs /= ld_block + 1;
         int min_block = 6;
 
@@ -375,6 +391,11 @@ status_t brgemm_desc_add_postops(brgemm_t *brg, const primitive_attr_t *attr,
             && (!one_of(dt_d, data_type::f32))
             && (!one_of(dt_bias, data_type::undef, data_type::f32)))
         return status::unimplemented;
+    if (brg->with_wei_decomp
+            && (!one_of(dt_d, data_type::f32, brg->dt_a)
+                    || !one_of(dt_bias, data_type::undef, data_type::f32,
+                            brg->dt_a)))
+        return status::unimplemented;
 
     brg->dt_d = dt_d;
     brg->typesize_D = types::data_type_size(brg->dt_d);
@@ -388,10 +409,24 @@ status_t brgemm_desc_add_postops(brgemm_t *brg, const primitive_attr_t *attr,
     brg->with_eltwise = eltwise_ind != -1;
     if (brg->with_eltwise) brg->eltwise = p.entry_[eltwise_ind].eltwise;
 
+    if (brg->with_wei_decomp) {
+        // the scales of the weights, applied to the f32 accumulators
+        const auto &oscales = brg->attr->output_scales_;
+        brg->is_oc_scale = oscales.mask_ == 1 << 1;
+        brg->with_scales = true;
+    }
+
     if (brg->is_int8) {
         const auto &oscales = brg->attr->output_scales_;
         brg->is_oc_scale = oscales.mask_ == 1 << 1;
         brg->with_scales = true;
+
+        // the value is embedded into the kernel, it has to be known
+        const auto &zp = brg->attr->zero_points_;
+        brg->with_dst_zero_point = !zp.has_default_values(DNNL_ARG_DST);
+        if (brg->with_dst_zero_point && !zp.defined(DNNL_ARG_DST))
+            return status::unimplemented;
+        brg->dst_zero_point = (float)*zp.get(DNNL_ARG_DST);
     }
 
     return status::success;
@@ -404,6 +439,40 @@ status_t brgemm_kernel_create(
     return (*brg_kernel)->create_kernel();
 }
 
+status_t brgemm_kernels_create(
+        int n, brgemm_kernel_t **brg_kernels, const brgemm_t *const *brgs) {
+    std::vector<int> todo;
+    for (int i = 0; i < n; i++) {
+        brg_kernels[i] = nullptr;
+        if (brgs[i]) todo.push_back(i);
+    }
+    if (todo.empty()) return success;
+
+    // The kernels are independent, so the code generation is distributed
+    // among the threads to reduce the primitive creation time.
+    const int ntodo = (int)todo.size();
+    std::vector<status_t> st(ntodo, success);
+    parallel(nstl::min(ntodo, dnnl_get_max_threads()),
+            [&](const int ithr, const int nthr) {
+                int start {0}, end {0};
+                balance211(ntodo, nthr, ithr, start, end);
+                for (int j = start; j < end; j++) {
+                    const int i = todo[j];
+                    st[j] = brgemm_kernel_create(&brg_kernels[i], *brgs[i]);
+                }
+            });
+
+    for (int j = 0; j < ntodo; j++) {
+        if (st[j] == success) continue;
+        for (int i = 0; i < n; i++) {
+            brgemm_kernel_destroy(brg_kernels[i]);
+            brg_kernels[i] = nullptr;
+        }
+        return st[j];
+    }
+    return success;
+}
+
 void brgemm_kernel_destroy(brgemm_kernel_t *brg_kernel) {
     delete brg_kernel;
 }
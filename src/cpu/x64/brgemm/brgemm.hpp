@@ -94,6 +94,16 @@ status_t brgemm_desc_add_postops(brgemm_t *brg, const primitive_attr_t *attr,
 status_t brgemm_kernel_create(
         brgemm_kernel_t **brg_kernel, const brgemm_t &brg);
 
+/// Generates several BRGEMM kernels concurrently
+///
+/// @param n Number of kernels
+/// @param brg_kernels Output BRGEMM kernels, nullptr for the skipped ones or
+///     for all of them on failure
+/// @param brgs BRGEMM descriptors, null descriptors are skipped
+///
+status_t brgemm_kernels_create(
+        int n, brgemm_kernel_t **brg_kernels, const brgemm_t *const *brgs);
+
 /// Destroys a BRGEMM kernel
 ///
 /// @param brg_kernel BRGEMM kernel
@@ -17,6 +17,8 @@
 #ifndef CPU_X64_BRGEMM_BRGEMM_TYPES_HPP
 #define CPU_X64_BRGEMM_BRGEMM_TYPES_HPP
 
+#include <memory>
+
 #include "common/primitive_attr.hpp"
 
 namespace dnnl {
@@ -81,6 +83,9 @@ struct brgemm_t {
     bool is_int8, is_int8_amx;
     bool is_bf16, is_bf16_amx;
     bool is_f32;
+    // f32 or bf16 A with s8 B: the values of B are converted to the type of
+    // A when loaded, is_f32 or is_bf16 defines the computations
+    bool with_wei_decomp;
 
     dim_t stride_a; // Offset in bytes
     dim_t stride_b;
@@ -93,6 +98,8 @@ struct brgemm_t {
     bool with_bias;
     bool with_sum;
     float sum_scale;
+    bool with_dst_zero_point;
+    float dst_zero_point;
     bool with_eltwise;
     bool with_scales;
     bool req_s8s8_compensation;
@@ -121,6 +128,8 @@ struct brgemm_kernel_params_t {
 
 struct jit_brgemm_kernel_base_t;
 
+// Kernels generated for equal descriptors are shared process-wide between
+// brgemm_kernel_t objects and released with the last of them.
 struct brgemm_kernel_t {
     brgemm_kernel_t(const brgemm_t abrd);
     ~brgemm_kernel_t();
@@ -129,7 +138,8 @@ struct brgemm_kernel_t {
     void operator()(brgemm_kernel_params_t *) const;
 
 private:
-    jit_brgemm_kernel_base_t *brgemm_kernel_ = nullptr;
+    brgemm_t brg_;
+    std::shared_ptr<jit_brgemm_kernel_base_t> brgemm_kernel_;
 
     DNNL_DISALLOW_COPY_AND_ASSIGN(brgemm_kernel_t);
 };
@@ -14,6 +14,10 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <map>
+#include <mutex>
+#include <string>
+
 #include "common/c_types_map.hpp"
 #include "common/nstl.hpp"
 #include "common/type_helpers.hpp"
@@ -128,6 +132,9 @@ private:
 
     Xbyak::Opmask ld_full_mask = Xbyak::Opmask(2);
     Xbyak::Opmask ld_tail_mask = Xbyak::Opmask(3);
+    // tail masks of the two halves of a vnni row of s8 B converted to bf16
+    Xbyak::Opmask ld_tail_mask_lo = Xbyak::Opmask(4);
+    Xbyak::Opmask ld_tail_mask_hi = Xbyak::Opmask(5);
 
     Xbyak::Zmm accm(int ld_block, int bd, int ld) {
         return Xbyak::Zmm(31 - (bd * ld_block + ld));
@@ -174,6 +181,8 @@ private:
             int bd_block, int ld_block, bool is_ld_tail);
     void apply_alpha_beta(int bd_block, int ld_block, bool is_ld_tail);
 
+    void load_B(Xbyak::Zmm zmm, int ld, int rd, bool is_ld_tail);
+
     void restore_A_B_matrices();
     void restore_offsets();
     void set_A_B_matrices();
@@ -327,13 +336,6 @@ void jit_brgemm_kernel_base_t::read_params() {
         mov(ptr[rsp + reg_buf_offs_], reg_buf);
     }
 
-    if (brg.type == brgemm_offs) {
-        mov(reg_offset_A, ptr[param1 + GET_OFF(offset_A)]);
-        mov(reg_offset_B, ptr[param1 + GET_OFF(offset_B)]);
-
-        mov(ptr[rsp + origin_offset_A_offs_], reg_offset_A);
-        mov(ptr[rsp + origin_offset_B_offs_], reg_offset_B);
-    }
     if (brg.with_bias) {
         mov(reg_bias, ptr[param1 + GET_OFF(ptr_bias)]);
         mov(ptr[rsp + reg_bias_offs_], reg_bias);
@@ -345,6 +347,15 @@ void jit_brgemm_kernel_base_t::read_params() {
 
     mov(reg_do_post_ops, ptr[param1 + GET_OFF(do_post_ops)]);
     mov(ptr[rsp + reg_do_post_ops_offs_], reg_do_post_ops);
+
+    // reg_offset_B is param1, so the offsets are read last.
+    if (brg.type == brgemm_offs) {
+        mov(reg_offset_A, ptr[param1 + GET_OFF(offset_A)]);
+        mov(reg_offset_B, ptr[param1 + GET_OFF(offset_B)]);
+
+        mov(ptr[rsp + origin_offset_A_offs_], reg_offset_A);
+        mov(ptr[rsp + origin_offset_B_offs_], reg_offset_B);
+    }
 }
 
 void jit_brgemm_kernel_base_t::load_accumulators(
@@ -494,6 +505,17 @@ void jit_brgemm_kernel_base_t::store_accumulators_apply_post_ops(
     if (brg.with_eltwise && sum_before_eltwise)
         eltwise_injector_->compute_vector_range(32 - bd_block * ld_block2, 32);
 
+    if (brg.with_dst_zero_point) {
+        auto zmm_zp = zmm_tmp_1();
+        mov(reg_tmp_gpr, (size_t)&brg.dst_zero_point);
+        vbroadcastss(zmm_zp, ptr[reg_tmp_gpr]);
+        for_(int bd = 0; bd < bd_block; bd++)
+        for (int ld = 0; ld < ld_block2; ld++) {
+            auto zmm = accm(ld_block2, bd, ld);
+            vaddps(zmm, zmm, zmm_zp);
+        }
+    }
+
     const bool dt_requires_saturation
             = one_of(brg.dt_d, data_type::u8, data_type::s8, data_type::s32);
     auto zmm_lbound = zmm_tmp_1();
@@ -704,6 +726,29 @@ void jit_brgemm_kernel_base_t::set_A_B_matrices() {
     add(reg_aux_B, reg_b_offset);
 }
 
+void jit_brgemm_kernel_base_t::load_B(
+        Xbyak::Zmm zmm, int ld, int rd, bool is_ld_tail) {
+    const auto addr = ptr[reg_aux_B + B_offset(ld, rd)];
+    if (!brg.with_wei_decomp) {
+        vmovups(zmm_mask(zmm, is_ld_tail, false, ld_tail_mask), addr);
+    } else if (brg.is_f32) {
+        vpmovsxbd(zmm_mask(zmm, is_ld_tail, false, ld_tail_mask), addr);
+        vcvtdq2ps(zmm, zmm);
+    } else {
+        // 16 pairs of s8 values, converted by halves of 8 pairs each and
+        // packed back in the same order into 32 bf16 values
+        const auto zmm_lo = zmm_tmp_2();
+        const auto zmm_hi = zmm_tmp_3();
+        const auto addr_hi = ptr[reg_aux_B + B_offset(ld, rd) + 16];
+        vpmovsxbd(zmm_mask(zmm_lo, is_ld_tail, false, ld_tail_mask_lo), addr);
+        vpmovsxbd(
+                zmm_mask(zmm_hi, is_ld_tail, false, ld_tail_mask_hi), addr_hi);
+        vcvtdq2ps(zmm_lo, zmm_lo);
+        vcvtdq2ps(zmm_hi, zmm_hi);
+        vcvtne2ps2bf16(zmm, zmm_hi, zmm_lo);
+    }
+}
+
 void jit_brgemm_kernel_base_t::gemm_microkernel_amx(int bd_block2,
         bool is_bdb_tail, int ld_block2, bool is_rd_tail, bool is_ld_tail) {
     MAYBE_UNUSED(is_rd_tail);
@@ -801,12 +846,7 @@ void jit_brgemm_kernel_base_t::gemm_microkernel_avx512(int bd_block2,
             broadcast(bcst(bd), A_offset(bd, rd), is_tail_bcast);
         }
         for (int ld = 0; ld < ld_block2; ld++) {
-            if (is_ld_tail) {
-                vmovups(load() | ld_tail_mask | T_z,
-                        ptr[reg_aux_B + B_offset(ld, rd)]);
-            } else {
-                vmovups(load(), ptr[reg_aux_B + B_offset(ld, rd)]);
-            }
+            load_B(load(), ld, rd, is_ld_tail);
             for (int bd = 0; bd < bd_block; bd++) {
                 auto zmm = accm(ld_block2, bd, ld);
                 if (is_emdbd)
@@ -820,14 +860,8 @@ void jit_brgemm_kernel_base_t::gemm_microkernel_avx512(int bd_block2,
 #else
     for (int rd = 0; rd < rd_loop; rd += brg.rd_step) {
         int prefetch_count_B = 0;
-        for (int ld = 0; ld < ld_block2; ld++) {
-            if (is_ld_tail) {
-                vmovups(load(ld) | ld_tail_mask | T_z,
-                        ptr[reg_aux_B + B_offset(ld, rd)]);
-            } else {
-                vmovups(load(ld), ptr[reg_aux_B + B_offset(ld, rd)]);
-            }
-        }
+        for (int ld = 0; ld < ld_block2; ld++)
+            load_B(load(ld), ld, rd, is_ld_tail);
         for (int bd = 0; bd < bd_block; bd++) {
             if (!is_emdbd) {
                 bool is_tail_bcast = is_rd_tail && rd_tail_size != 0
@@ -1067,6 +1101,15 @@ void jit_brgemm_kernel_base_t::generate() {
     kmovq(ld_full_mask, reg_mask);
     mov(reg_mask, tail_mask);
     kmovq(ld_tail_mask, reg_mask);
+    if (brg.with_wei_decomp && brg.is_bf16) {
+        // a pair of values per column of the tail
+        const int tail_len = 2 * brg.ldb_tail;
+        const int lo_len = nstl::min(tail_len, 16);
+        mov(reg_mask, size_t((1 << lo_len) - 1));
+        kmovq(ld_tail_mask_lo, reg_mask);
+        mov(reg_mask, size_t((1 << (tail_len - lo_len)) - 1));
+        kmovq(ld_tail_mask_hi, reg_mask);
+    }
 
     read_params();
 
@@ -1086,21 +1129,112 @@ void jit_brgemm_kernel_base_t::generate() {
     if (brg.with_eltwise) eltwise_injector_->prepare_table();
 }
 
-brgemm_kernel_t::brgemm_kernel_t(const brgemm_t abrd) {
-    brgemm_kernel_ = new jit_brgemm_kernel_base_t(abrd);
+namespace {
+template <typename T>
+void append_to_key(std::string &key, const T &v) {
+    key.append(reinterpret_cast<const char *>(&v), sizeof(v));
+}
+
+// Serializes everything the generated code depends on. The attributes are
+// only used for the post-ops, so they are taken by value rather than by
+// pointer. Returns false for the descriptors that are not cached.
+bool brgemm_kernel_key(const brgemm_t &brg, std::string &key) {
+    for (int v : {brg.bcast_dim, brg.load_dim, brg.reduce_dim, brg.LDA,
+                 brg.LDB, brg.LDC, brg.LDD, brg.bdb, brg.bd_block,
+                 brg.bdb_tail, brg.bdb2, brg.bd_block2, brg.bdb2_tail,
+                 brg.ldb, brg.ld_block, brg.ldb_tail, brg.ldb2, brg.ld_block2,
+                 brg.ldb2_tail, brg.rdb, brg.rd_block, brg.rdb_tail,
+                 brg.rd_step, brg.ld_step, brg.typesize_A, brg.typesize_B,
+                 brg.typesize_C, brg.typesize_D, brg.typesize_bias,
+                 brg.is_oc_scale, (int)brg.layout, (int)brg.type,
+                 (int)brg.dt_a, (int)brg.dt_b, (int)brg.dt_c, (int)brg.dt_d,
+                 (int)brg.dt_bias})
+        append_to_key(key, v);
+    for (bool v : {brg.is_int8, brg.is_int8_amx, brg.is_bf16, brg.is_bf16_amx,
+                 brg.is_f32, brg.with_wei_decomp, brg.embd_bcst,
+                 brg.with_bias, brg.with_sum, brg.with_eltwise,
+                 brg.with_scales, brg.req_s8s8_compensation,
+                 brg.with_dst_zero_point})
+        append_to_key(key, v);
+    for (float v : {brg.alpha, brg.beta, brg.sum_scale, brg.dst_zero_point})
+        append_to_key(key, v);
+    append_to_key(key, brg.stride_a);
+    append_to_key(key, brg.stride_b);
+
+    if (!brg.attr) return true;
+    const auto &p = brg.attr->post_ops_;
+    for (int i = 0; i < p.len(); i++) {
+        const auto &e = p.entry_[i];
+        append_to_key(key, (int)e.kind);
+        if (e.is_eltwise()) {
+            append_to_key(key, (int)e.eltwise.alg);
+            for (float v : {e.eltwise.scale, e.eltwise.alpha, e.eltwise.beta})
+                append_to_key(key, v);
+        } else if (e.is_sum(false)) {
+            append_to_key(key, e.sum.scale);
+            append_to_key(key, (int)e.sum.dt);
+        } else {
+            return false;
+        }
+    }
+    return true;
+}
+
+struct brgemm_kernel_cache_t {
+    std::shared_ptr<jit_brgemm_kernel_base_t> get(const std::string &key) {
+        std::lock_guard<std::mutex> guard(mutex_);
+        auto it = kernels_.find(key);
+        return it == kernels_.end() ? nullptr : it->second.lock();
+    }
+
+    // Returns the kernel that ends up in the cache: another thread might
+    // have added one for the same key in the meantime.
+    std::shared_ptr<jit_brgemm_kernel_base_t> add(const std::string &key,
+            const std::shared_ptr<jit_brgemm_kernel_base_t> &kernel) {
+        std::lock_guard<std::mutex> guard(mutex_);
+        for (auto it = kernels_.begin(); it != kernels_.end();)
+            it = it->second.expired() ? kernels_.erase(it) : std::next(it);
+        auto &entry = kernels_[key];
+        auto cached = entry.lock();
+        if (cached) return cached;
+        entry = kernel;
+        return kernel;
+    }
+
+private:
+    std::mutex mutex_;
+    std::map<std::string, std::weak_ptr<jit_brgemm_kernel_base_t>> kernels_;
+};
+
+brgemm_kernel_cache_t &brgemm_kernel_cache() {
+    static brgemm_kernel_cache_t cache;
+    return cache;
 }
+} // namespace
+
+brgemm_kernel_t::brgemm_kernel_t(const brgemm_t abrd) : brg_(abrd) {}
 
 status_t brgemm_kernel_t::create_kernel() {
-    return brgemm_kernel_->create_kernel();
+    std::string key;
+    const bool use_cache = brgemm_kernel_key(brg_, key);
+    if (use_cache) {
+        brgemm_kernel_ = brgemm_kernel_cache().get(key);
+        if (brgemm_kernel_) return status::success;
+    }
+
+    std::shared_ptr<jit_brgemm_kernel_base_t> kernel(
+            new jit_brgemm_kernel_base_t(brg_));
+    CHECK(kernel->create_kernel());
+    brgemm_kernel_
+            = use_cache ? brgemm_kernel_cache().add(key, kernel) : kernel;
+    return status::success;
 }
 
 void brgemm_kernel_t::operator()(brgemm_kernel_params_t *params) const {
     (*brgemm_kernel_)(params);
 }
 
-brgemm_kernel_t::~brgemm_kernel_t() {
-    delete brgemm_kernel_;
-}
+brgemm_kernel_t::~brgemm_kernel_t() = default;
 
 } // namespace x64
 } // namespace cpu
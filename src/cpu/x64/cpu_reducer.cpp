@@ -223,13 +223,18 @@ struct reducer_2d_driver_f_s_32_t : public reducer_2d_driver_t<data_type> {
             else
                 load_dst(nloads[id], load_len[id]);
 
-            if (nloads[id] > 1) {
+            // the unrolled sources are addressed by a displacement, which
+            // must fit 32 bits
+            const size_t max_src_off
+                    = (size_t)(this->n_src_ - 1) * this->src_ld_ * typesize;
+            if (nloads[id] > 1 || max_src_off > INT_MAX) {
                 Label loop_srcs;
                 this->mov(reg_src_id, this->n_src_);
                 this->L(loop_srcs);
 
                 accumulate(nloads[id], load_len[id], 0);
-                this->add(reg_src, this->src_ld_ * typesize);
+                this->safe_add(
+                        reg_src, this->src_ld_ * typesize, reg_long_offt);
 
                 this->dec(reg_src_id);
                 this->jnz(loop_srcs, this->T_NEAR);
@@ -551,8 +556,9 @@ template struct cpu_reducer_2d_t<data_type::s32>;
 /* accumulator section */
 
 template <impl::data_type_t data_type>
-cpu_accumulator_1d_t<data_type>::cpu_accumulator_1d_t() : drv_(nullptr) {
-    drv_ = create_reduce_2d_drv<data_type>(1, 0, 0, 0, false);
+cpu_accumulator_1d_t<data_type>::cpu_accumulator_1d_t(int n_src, size_t src_ld)
+    : drv_(nullptr) {
+    drv_ = create_reduce_2d_drv<data_type>(n_src, src_ld, 0, 0, false);
 }
 
 template <impl::data_type_t data_type>
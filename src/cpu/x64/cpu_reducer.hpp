@@ -330,12 +330,17 @@ private:
     DNNL_DISALLOW_COPY_AND_ASSIGN(cpu_reducer_2d_t);
 };
 
-/** simple 1d accumulator: y[:] += x[:] */
+/** simple 1d accumulator: y[:] += x[:]
+ *
+ * With @p n_src > 1 the accumulator sums @p n_src sources located
+ * @p src_ld elements apart: y[:] += sum(x[i * src_ld + :]). All the sources
+ * are added up in registers, so y is read and written once, which makes it
+ * the preferred way to reduce several per-thread partial buffers. */
 template <impl::data_type_t data_type>
 struct cpu_accumulator_1d_t {
     typedef typename prec_traits<data_type>::type data_t;
 
-    cpu_accumulator_1d_t();
+    cpu_accumulator_1d_t(int n_src = 1, size_t src_ld = 0);
     ~cpu_accumulator_1d_t();
     void accumulate(data_t *dst, const data_t *src, size_t size);
 
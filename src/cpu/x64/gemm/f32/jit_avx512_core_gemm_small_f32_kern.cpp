@@ -0,0 +1,155 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cassert>
+#include <cstddef>
+
+#include "cpu/x64/gemm/f32/jit_avx512_core_gemm_small_f32_kern.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+#define GET_OFF(field) \
+    offsetof(jit_avx512_core_gemm_small_f32_kern::call_params_t, field)
+
+using namespace Xbyak;
+
+jit_avx512_core_gemm_small_f32_kern::jit_avx512_core_gemm_small_f32_kern(
+        int nvec, int unroll_n, bool trans_b, bool beta_zero)
+    : jit_generator(nullptr, 16 * 1024)
+    , nvec_(nvec)
+    , unroll_n_(unroll_n)
+    , trans_b_(trans_b)
+    , beta_zero_(beta_zero) {
+    assert(1 <= nvec && nvec <= max_nvec);
+    assert(1 <= unroll_n && unroll_n <= max_unroll_n);
+}
+
+Address jit_avx512_core_gemm_small_f32_kern::b_addr(int j) {
+    if (trans_b_) return ptr_b[reg_b_[0] + j * sizeof(float)];
+
+    const auto &base = reg_b_[j / 3];
+    switch (j % 3) {
+        case 0: return ptr_b[base];
+        case 1: return ptr_b[base + reg_ldb_];
+        default: return ptr_b[base + reg_ldb_ * 2];
+    }
+}
+
+void jit_avx512_core_gemm_small_f32_kern::generate() {
+    constexpr int vlen = cpu_isa_traits<avx512_core>::vlen;
+
+    preamble();
+
+    mov(reg_a_, ptr[reg_param_ + GET_OFF(a)]);
+    mov(reg_b_[0], ptr[reg_param_ + GET_OFF(b)]);
+    mov(reg_c_, ptr[reg_param_ + GET_OFF(c)]);
+    mov(reg_k_, ptr[reg_param_ + GET_OFF(k)]);
+    mov(reg_lda_, ptr[reg_param_ + GET_OFF(lda)]);
+    mov(reg_ldb_, ptr[reg_param_ + GET_OFF(ldb)]);
+    mov(reg_ldc_, ptr[reg_param_ + GET_OFF(ldc)]);
+    shl(reg_lda_, 2);
+    shl(reg_ldb_, 2);
+    shl(reg_ldc_, 2);
+
+    mov(reg_tmp_.cvt32(), dword[reg_param_ + GET_OFF(mask)]);
+    kmovw(k_tail_, reg_tmp_.cvt32());
+
+    if (!trans_b_) {
+        lea(reg_ldb3_, ptr[reg_ldb_ + reg_ldb_ * 2]);
+        for (int i = 1; i * 3 < unroll_n_; i++)
+            lea(reg_b_[i], ptr[reg_b_[i - 1] + reg_ldb3_]);
+    }
+
+    for_(int v = 0; v < nvec_; v++)
+    for (int j = 0; j < unroll_n_; j++)
+        vxorps(zmm_acc(v, j), zmm_acc(v, j), zmm_acc(v, j));
+
+    // The driver never calls the kernel with an empty K dimension.
+    Label k_loop;
+    L(k_loop);
+    {
+        for (int v = 0; v < nvec_; v++) {
+            const auto src = ptr[reg_a_ + v * vlen];
+            if (v == nvec_ - 1)
+                vmovups(zmm_a(v) | k_tail_ | T_z, src);
+            else
+                vmovups(zmm_a(v), src);
+        }
+
+        for (int j = 0; j < unroll_n_; j++) {
+            if (nvec_ == 1) {
+                vfmadd231ps(zmm_acc(0, j), zmm_a(0), b_addr(j));
+            } else {
+                // Broadcast once for all the vectors of the column.
+                vbroadcastss(zmm_b(j), b_addr(j));
+                for (int v = 0; v < nvec_; v++)
+                    vfmadd231ps(zmm_acc(v, j), zmm_a(v), zmm_b(j));
+            }
+        }
+
+        add(reg_a_, reg_lda_);
+        if (trans_b_) {
+            add(reg_b_[0], reg_ldb_);
+        } else {
+            for (int i = 0; i * 3 < unroll_n_; i++)
+                add(reg_b_[i], sizeof(float));
+        }
+
+        dec(reg_k_);
+        jnz(k_loop, T_NEAR);
+    }
+
+    mov(reg_tmp_, ptr[reg_param_ + GET_OFF(alpha)]);
+    vbroadcastss(zmm_alpha_, dword[reg_tmp_]);
+    if (!beta_zero_) {
+        mov(reg_tmp_, ptr[reg_param_ + GET_OFF(beta)]);
+        vbroadcastss(zmm_beta_, dword[reg_tmp_]);
+    }
+
+    for (int j = 0; j < unroll_n_; j++) {
+        for (int v = 0; v < nvec_; v++) {
+            const auto acc = zmm_acc(v, j);
+            const auto dst = ptr[reg_c_ + v * vlen];
+            const bool is_tail = v == nvec_ - 1;
+
+            vmulps(acc, acc, zmm_alpha_);
+            if (!beta_zero_) {
+                if (is_tail)
+                    vmovups(zmm_c_ | k_tail_ | T_z, dst);
+                else
+                    vmovups(zmm_c_, dst);
+                vfmadd231ps(acc, zmm_c_, zmm_beta_);
+            }
+            if (is_tail)
+                vmovups(dst | k_tail_, acc);
+            else
+                vmovups(dst, acc);
+        }
+        add(reg_c_, reg_ldc_);
+    }
+
+    postamble();
+}
+
+#undef GET_OFF
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
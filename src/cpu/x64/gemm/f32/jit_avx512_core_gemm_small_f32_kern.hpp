@@ -0,0 +1,93 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_GEMM_F32_JIT_AVX512_CORE_GEMM_SMALL_F32_KERN_HPP
+#define CPU_X64_GEMM_F32_JIT_AVX512_CORE_GEMM_SMALL_F32_KERN_HPP
+
+#include "cpu/x64/jit_generator.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+// Computes a block of a small column-major f32 GEMM without copying the
+// matrices:
+//   C[0:m, 0:unroll_n] = alpha * A[0:m, 0:k] * op(B)[0:k, 0:unroll_n]
+//           + beta * C[0:m, 0:unroll_n]
+// with A not transposed and m up to nvec * 16, the rows of the last vector
+// being selected by a mask.
+class jit_avx512_core_gemm_small_f32_kern : public jit_generator {
+public:
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_avx512_core_gemm_small_f32_kern);
+
+    struct call_params_t {
+        const float *a, *b;
+        float *c;
+        dim_t k, lda, ldb, ldc;
+        const float *alpha, *beta;
+        int32_t mask;
+    };
+
+    static constexpr int max_nvec = 2;
+    static constexpr int max_unroll_n = 12;
+
+    jit_avx512_core_gemm_small_f32_kern(
+            int nvec, int unroll_n, bool trans_b, bool beta_zero);
+
+    void operator()(const call_params_t *p) const {
+        jit_generator::operator()(p);
+    }
+
+protected:
+    void generate() override;
+
+private:
+    const int nvec_, unroll_n_;
+    const bool trans_b_, beta_zero_;
+
+    const Xbyak::Reg64 reg_param_ = abi_param1;
+    const Xbyak::Reg64 reg_a_ = r8;
+    const Xbyak::Reg64 reg_c_ = r10;
+    const Xbyak::Reg64 reg_k_ = r11;
+    const Xbyak::Reg64 reg_lda_ = r12;
+    const Xbyak::Reg64 reg_ldb_ = r13;
+    const Xbyak::Reg64 reg_ldc_ = r14;
+    const Xbyak::Reg64 reg_ldb3_ = r15;
+    const Xbyak::Reg64 reg_tmp_ = abi_not_param1;
+    // Every B pointer covers 3 columns of a not transposed B.
+    const Xbyak::Reg64 reg_b_[4] = {r9, rax, rbx, rdx};
+
+    const Xbyak::Opmask k_tail_ = k1;
+
+    const Xbyak::Zmm zmm_alpha_ = zmm26;
+    const Xbyak::Zmm zmm_beta_ = zmm27;
+    const Xbyak::Zmm zmm_c_ = zmm28;
+
+    Xbyak::Zmm zmm_acc(int v, int j) const {
+        return Xbyak::Zmm(v * unroll_n_ + j);
+    }
+    Xbyak::Zmm zmm_a(int v) const { return Xbyak::Zmm(24 + v); }
+    Xbyak::Zmm zmm_b(int j) const { return Xbyak::Zmm(29 + j % 3); }
+    Xbyak::Address b_addr(int j);
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif // CPU_X64_GEMM_F32_JIT_AVX512_CORE_GEMM_SMALL_F32_KERN_HPP
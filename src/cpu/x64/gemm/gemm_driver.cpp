@@ -15,6 +15,7 @@
 *******************************************************************************/
 
 #include <cstdint>
+#include <mutex>
 #if defined(_MSC_VER)
 #include <malloc.h>
 #endif
@@ -41,6 +42,7 @@
 #include "cpu/x64/gemm/gemv_driver.hpp"
 
 #include "cpu/x64/gemm/f32/jit_avx512_common_gemm_f32.hpp"
+#include "cpu/x64/gemm/f32/jit_avx512_core_gemm_small_f32_kern.hpp"
 #include "cpu/x64/gemm/f32/jit_avx512_core_gemm_smalln_tn_f32_kern.hpp"
 #include "cpu/x64/gemm/f32/jit_avx_gemm_f32.hpp"
 
@@ -1196,7 +1198,7 @@ static inline void set_thread_opts_pack(int nthrs,
         gemm_threading_t &thread_info,
         const gemm_info_t<a_type, b_type, c_type> *arg,
         bool do_k_blocking = true, bool do_m_blocking = true,
-        bool do_n_blocking = true) {
+        bool do_n_blocking = true, int nthrs_k_forced = 0) {
 
     constexpr bool is_int8 = utils::one_of(
             data_traits<a_type>::data_type, data_type::s8, data_type::u8);
@@ -1251,7 +1253,9 @@ static inline void set_thread_opts_pack(int nthrs,
     };
 
     // Choose k blocking.
-    if ((m / MBLK + n / NBLK) < nthrs && do_k_blocking) {
+    if (nthrs_k_forced > 0 && do_k_blocking) {
+        nthr_k = nstl::min(nthrs_k_forced, nthrs);
+    } else if ((m / MBLK + n / NBLK) < nthrs && do_k_blocking) {
         for (int nk = 1; nk <= 4 && k >= ((KBLK + 1) * nk); nk++)
             if (nthrs % nk == 0) nthr_k = nk;
 
@@ -1603,6 +1607,84 @@ static inline void adjust_thread_count(dim_t m, dim_t n, dim_t k, int *nthrs) {
     *nthrs = i;
 }
 
+// Chooses the number of threads along the K dimension for GEMMs with little
+// parallelism in the M and N dimensions (e.g. M = N = 64 and K = 100000).
+// The choice is based on a simple model of the per-thread time:
+// - compute, at the peak FMA throughput,
+// - copy of the A and B slices, bound by the memory bandwidth,
+// - reduction of the partial C results of the k-slices, bound by the cache
+//   bandwidth if a partial result fits into the L2 cache and by the memory
+//   bandwidth otherwise, plus the cost of the synchronization.
+// Returns 1 if splitting K does not pay off.
+template <typename a_type, typename b_type, typename c_type>
+static inline int get_nthr_k_model(
+        int nthrs, const gemm_info_t<a_type, b_type, c_type> *arg) {
+
+    constexpr bool is_int8 = utils::one_of(
+            data_traits<a_type>::data_type, data_type::s8, data_type::u8);
+    constexpr bool is_bf16 = data_traits<a_type>::data_type == data_type::bf16;
+
+    // Minimal thread blocks in M and N, as in set_thread_opts_pack().
+    constexpr dim_t MBLK_MIN = 32;
+    constexpr dim_t NBLK_MIN = 32;
+
+    // Bytes per cycle per core.
+    const double mem_bw = 8.0;
+    const double cache_bw = 32.0;
+    const double sync_intercept = 4.0e+3;
+    const double sync_slope = 5.0e+2;
+    // Prefer the cheaper decomposition without k-slices unless the gain is
+    // significant.
+    const double gain_thresh = 0.8;
+
+    const dim_t m = arg->m, n = arg->n, k = arg->k;
+    const dim_t nthr_mn_max
+            = utils::div_up(m, MBLK_MIN) * utils::div_up(n, NBLK_MIN);
+    if (nthrs <= 1 || nthr_mn_max >= nthrs) return 1;
+
+    const double fp_per_cycle = 2.0 * 2.0 * get_vector_length<c_type>()
+            * (is_int8 ? 4 : is_bf16 ? 2 : 1);
+    const size_t l2_size = platform::get_per_core_cache_size(2);
+
+    auto estimate = [&](int nthr_k) {
+        const int nthr_mn = (int)nstl::min(dim_t(nthrs / nthr_k), nthr_mn_max);
+        const int nthr_m
+                = (int)nstl::min(utils::div_up(m, MBLK_MIN), dim_t(nthr_mn));
+        const int nthr_n = nstl::max(nthr_mn / nthr_m, 1);
+        const double m_t = (double)utils::div_up(m, nthr_m);
+        const double n_t = (double)utils::div_up(n, nthr_n);
+        const double k_t = (double)utils::div_up(k, nthr_k);
+
+        const double compute = 2.0 * m_t * n_t * k_t / fp_per_cycle;
+        const double copy
+                = (m_t * sizeof(a_type) + n_t * sizeof(b_type)) * k_t / mem_bw;
+        if (nthr_k == 1) return compute + copy;
+
+        // Every thread adds its partial result to C and then the nthr_k
+        // threads of a slice together read it back and update C.
+        const double c_bytes = m_t * n_t * sizeof(c_type);
+        const double reduce_bw = c_bytes <= l2_size ? cache_bw : mem_bw;
+        const double reduce = 3.0 * c_bytes / reduce_bw;
+        const double sync = sync_intercept + nthr_k * nthr_mn * sync_slope;
+        return compute + copy + reduce + sync;
+    };
+
+    // Every k-slice should cover at least a full k-block.
+    const int nthr_k_max = (int)nstl::min(dim_t(nthrs), k / arg->bk);
+
+    int nthr_k_best = 1;
+    double time_best = gain_thresh * estimate(1);
+    for (int nthr_k = 2; nthr_k <= nthr_k_max; nthr_k++) {
+        const double time = estimate(nthr_k);
+        if (time < time_best) {
+            time_best = time;
+            nthr_k_best = nthr_k;
+        }
+    }
+
+    return nthr_k_best;
+}
+
 template <typename a_type, typename b_type, typename c_type>
 static dnnl_status_t call_no_copy_sgemm(
         int nthrs, gemm_info_t<a_type, b_type, c_type> *arg) {
@@ -1625,6 +1707,158 @@ static dnnl_status_t call_no_copy_sgemm(
         return pack_no_copy(arg);
 }
 
+// Returns the small GEMM kernel for the given variant, generating it on the
+// first use.
+static const jit_avx512_core_gemm_small_f32_kern *get_gemm_small_kernel(
+        int nvec, int unroll_n, bool trans_b, bool beta_zero) {
+    using kernel_t = jit_avx512_core_gemm_small_f32_kern;
+    constexpr int max_nvec = kernel_t::max_nvec;
+    constexpr int max_unroll_n = kernel_t::max_unroll_n;
+
+    static kernel_t *kernels[max_nvec][max_unroll_n][2][2];
+    static std::once_flag initialized[max_nvec][max_unroll_n][2][2];
+
+    auto &kernel = kernels[nvec - 1][unroll_n - 1][trans_b][beta_zero];
+    std::call_once(initialized[nvec - 1][unroll_n - 1][trans_b][beta_zero],
+            [&] {
+                auto *k = new kernel_t(nvec, unroll_n, trans_b, beta_zero);
+                if (k->create_kernel() != dnnl_success) {
+                    delete k;
+                    k = nullptr;
+                }
+                kernel = k;
+            });
+    return kernel;
+}
+
+// Fast path for GEMMs with all the dimensions up to 32: a single thread
+// calls the small f32 kernels right away, skipping the kernels setup of
+// gemm_info_t, the thread partitioning and the copy of the matrices. The
+// matrices are only converted to f32 when needed: a transposed A, the bf16
+// and the 8-bit integer matrices (the integer products of such small
+// matrices are exact in f32). The conversions outweigh the setup savings
+// past 8 for the bf16 and integer GEMMs.
+template <typename a_type, typename b_type, typename c_type>
+static dnnl_status_t gemm_small_driver(const char *transA, const char *transB,
+        const char *offsetC, const dim_t *p_m, const dim_t *p_n,
+        const dim_t *p_k, const float *p_alpha, const a_type *a,
+        const dim_t *p_lda, const a_type *oa, const b_type *b,
+        const dim_t *p_ldb, const b_type *ob, const float *p_beta, c_type *c,
+        const dim_t *p_ldc, const c_type *oc) {
+    using kernel_t = jit_avx512_core_gemm_small_f32_kern;
+    constexpr int vlen = 16;
+
+    constexpr bool is_f32 = data_traits<a_type>::data_type == data_type::f32;
+    constexpr dim_t max_dim = is_f32 ? 32 : 8;
+    constexpr bool is_int8 = utils::one_of(
+            data_traits<a_type>::data_type, data_type::s8, data_type::u8);
+
+    if (!mayiuse(avx512_core)) return dnnl_unimplemented;
+
+    const dim_t m = *p_m, n = *p_n, k = *p_k;
+    if (m <= 0 || m > max_dim || n <= 0 || n > max_dim || k <= 0
+            || k > max_dim)
+        return dnnl_unimplemented;
+
+    const char ta = *transA, tb = *transB;
+    if (!utils::one_of(ta, 'N', 'n', 'T', 't')
+            || !utils::one_of(tb, 'N', 'n', 'T', 't'))
+        return dnnl_unimplemented;
+    const bool trans_a = utils::one_of(ta, 'T', 't');
+    const bool trans_b = utils::one_of(tb, 'T', 't');
+
+    const dim_t lda = *p_lda, ldb = *p_ldb, ldc = *p_ldc;
+    const float alpha = p_alpha ? *p_alpha : 1.0f;
+    const float beta = p_beta ? *p_beta : 1.0f;
+
+    // The integer results are scaled and rounded after the kernels.
+    const float alpha_kernel = is_int8 ? 1.0f : alpha;
+    const float beta_kernel = is_int8 ? 0.0f : beta;
+    const bool beta_zero = beta_kernel == 0.0f;
+
+    const int nvec = (int)utils::div_up(m, vlen);
+    const int unroll_n = (int)nstl::min(n, dim_t(kernel_t::max_unroll_n));
+    const int n_tail = (int)(n % unroll_n);
+    const auto *kernel
+            = get_gemm_small_kernel(nvec, unroll_n, trans_b, beta_zero);
+    const auto *kernel_tail = n_tail
+            ? get_gemm_small_kernel(nvec, n_tail, trans_b, beta_zero)
+            : kernel;
+    if (!kernel || !kernel_tail) return dnnl_unimplemented;
+
+    const float ao = is_int8 && oa ? (float)*oa : 0.0f;
+    const float bo = is_int8 && ob ? (float)*ob : 0.0f;
+
+    float a_buf[max_dim * max_dim];
+    const float *a_f32 = (const float *)a;
+    dim_t lda_f32 = lda;
+    if (!is_f32 || trans_a) {
+        for_(dim_t j = 0; j < k; j++)
+        for (dim_t i = 0; i < m; i++) {
+            const a_type v = trans_a ? a[j + i * lda] : a[i + j * lda];
+            a_buf[i + j * m] = (float)v - ao;
+        }
+        a_f32 = a_buf;
+        lda_f32 = m;
+    }
+
+    float b_buf[max_dim * max_dim];
+    const float *b_f32 = (const float *)b;
+    dim_t ldb_f32 = ldb;
+    if (!is_f32) {
+        const dim_t rows = trans_b ? n : k, cols = trans_b ? k : n;
+        for_(dim_t j = 0; j < cols; j++)
+        for (dim_t i = 0; i < rows; i++)
+            b_buf[i + j * rows] = (float)b[i + j * ldb] - bo;
+        b_f32 = b_buf;
+        ldb_f32 = rows;
+    }
+
+    float c_buf[max_dim * max_dim];
+    float *c_f32 = is_int8 ? c_buf : (float *)c;
+    const dim_t ldc_f32 = is_int8 ? m : ldc;
+
+    kernel_t::call_params_t p;
+    p.k = k;
+    p.lda = lda_f32;
+    p.ldb = ldb_f32;
+    p.ldc = ldc_f32;
+    p.alpha = &alpha_kernel;
+    p.beta = &beta_kernel;
+    p.mask = (1 << (m - (nvec - 1) * vlen)) - 1;
+    for (dim_t j = 0; j < n; j += unroll_n) {
+        p.a = a_f32;
+        p.b = b_f32 + (trans_b ? j : j * ldb_f32);
+        p.c = c_f32 + j * ldc_f32;
+        (*(j + unroll_n <= n ? kernel : kernel_tail))(&p);
+    }
+
+    offset_type offsetc = offset_type::none;
+    if (offsetC && oc) {
+        if (utils::one_of(*offsetC, 'F', 'f'))
+            offsetc = offset_type::fixed;
+        else if (utils::one_of(*offsetC, 'R', 'r'))
+            offsetc = offset_type::row;
+        else
+            offsetc = offset_type::column;
+    }
+
+    if (is_int8) {
+        c_type c_partial[max_dim * max_dim];
+        for (dim_t i = 0; i < m * n; i++)
+            c_partial[i] = (c_type)c_buf[i];
+        add_results(m, n, alpha, beta, c_partial, m, c, ldc, oc, offsetc);
+    } else if (offsetc != offset_type::none) {
+        for_(dim_t j = 0; j < n; j++)
+        for (dim_t i = 0; i < m; i++)
+            c[i + j * ldc] += offsetc == offset_type::fixed
+                    ? oc[0]
+                    : offsetc == offset_type::row ? oc[j] : oc[i];
+    }
+
+    return dnnl_success;
+}
+
 template <typename a_type, typename b_type, typename c_type>
 static dnnl_status_t gemm_threading_driver(
         gemm_info_t<a_type, b_type, c_type> *arg) {
@@ -1638,6 +1872,20 @@ static dnnl_status_t gemm_threading_driver(
 
     if ((arg->m <= 0) || (arg->n <= 0)) return dnnl_success;
 
+    // The copy-based kernels are not called at all for an empty K dimension,
+    // only C has to be scaled (and its bias applied).
+    if (!is_int8 && !packing && !is_a_packed && !is_b_packed && arg->k <= 0) {
+        const bool with_bias = arg->offsetc == offset_type::column;
+        parallel_nd(arg->n, [&](dim_t j) {
+            c_type *c = arg->c + j * arg->ldc;
+            for (dim_t i = 0; i < arg->m; i++) {
+                c[i] = arg->beta == 0.0f ? c_type(0) : arg->beta * c[i];
+                if (with_bias) c[i] += arg->co[i];
+            }
+        });
+        return dnnl_success;
+    }
+
     if (!is_a_packed && !is_b_packed && jump_to_gemv_s8x8s32(arg))
         return dnnl_success;
 
@@ -1690,6 +1938,16 @@ static dnnl_status_t gemm_threading_driver(
             // Decide partition type later if no partitions in k-dimension.
             if (force_k_decomp.nthrs_k > 1 && force_k_decomp.nthrs_m > 1)
                 force_threading = &force_k_decomp;
+        } else {
+            // Split K for the rest of the shapes with too little
+            // parallelism in M and N according to the cost model.
+            int nthr_k = get_nthr_k_model(nthr_goal, arg);
+            if (nthr_k > 1) {
+                set_thread_opts_pack(nthr_goal, force_k_decomp, arg, true,
+                        true, true, nthr_k);
+                if (force_k_decomp.nthrs_k > 1)
+                    force_threading = &force_k_decomp;
+            }
         }
 
         if (force_threading) {
@@ -1742,7 +2000,9 @@ static dnnl_status_t gemm_threading_driver(
         if (arg->measure_only) return dnnl_success;
     }
 
-    if (nocopy_checker(nthr_goal, arg))
+    // The k-partitioning chosen above relies on the copy-based kernels.
+    bool k_decomp = force_threading == &force_k_decomp;
+    if (!k_decomp && nocopy_checker(nthr_goal, arg))
         return call_no_copy_sgemm(nthr_goal, arg);
 
     if (nthr_goal == 1)
@@ -1963,6 +2223,12 @@ dnnl_status_t gemm_driver(const char *transA, const char *transB,
     // gemm_driver can only dispatch nocopy for avx and above.
     assert(IMPLICATION(force_nocopy, mayiuse(avx)));
 
+    if (packing == pack_type::none
+            && gemm_small_driver(transA, transB, offsetC, m, n, k, alpha, a,
+                       lda, oa, b, ldb, ob, beta, c, ldc, oc)
+                    == dnnl_success)
+        return dnnl_success;
+
     gemm_info_t<a_type, b_type, c_type> args(transA, transB, offsetC, m, n, k,
             alpha, a, lda, oa, b, ldb, ob, beta, c, ldc, oc, force_nocopy,
             packing, pack_dst, measure_only);
@@ -0,0 +1,307 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/gemm/gemm.hpp"
+#include "cpu/platform.hpp"
+
+#include "cpu/x64/gemm_f32_wino_conv_4x3.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+using namespace dnnl::impl::memory_tracking::names;
+using namespace dnnl::impl::utils;
+
+namespace {
+constexpr int alpha = 6;
+constexpr int tile_size = 4;
+constexpr int kernel_size = 3;
+constexpr int alpha_sq = alpha * alpha;
+// number of channels transformed at once
+constexpr int c_blk = 16;
+
+// d -> B^T d
+inline void trans_src_1d(const float *d, dim_t ds, float *r, dim_t rs) {
+    r[0 * rs] = 4.f * d[0 * ds] - 5.f * d[2 * ds] + d[4 * ds];
+    r[1 * rs] = -4.f * (d[1 * ds] + d[2 * ds]) + d[3 * ds] + d[4 * ds];
+    r[2 * rs] = 4.f * (d[1 * ds] - d[2 * ds]) - d[3 * ds] + d[4 * ds];
+    r[3 * rs] = 2.f * (d[3 * ds] - d[1 * ds]) - d[2 * ds] + d[4 * ds];
+    r[4 * rs] = 2.f * (d[1 * ds] - d[3 * ds]) - d[2 * ds] + d[4 * ds];
+    r[5 * rs] = 4.f * d[1 * ds] - 5.f * d[3 * ds] + d[5 * ds];
+}
+
+// m -> A^T m
+inline void trans_dst_1d(const float *m, dim_t ms, float *r, dim_t rs) {
+    const float t1p2 = m[1 * ms] + m[2 * ms], t1m2 = m[1 * ms] - m[2 * ms];
+    const float t3p4 = m[3 * ms] + m[4 * ms], t3m4 = m[3 * ms] - m[4 * ms];
+    r[0 * rs] = m[0 * ms] + t1p2 + t3p4;
+    r[1 * rs] = t1m2 + 2.f * t3m4;
+    r[2 * rs] = t1p2 + 4.f * t3p4;
+    r[3 * rs] = t1m2 + 8.f * t3m4 + m[5 * ms];
+}
+
+const float G[alpha][kernel_size] = {{1.f / 4, 0.f, 0.f},
+        {-1.f / 6, -1.f / 6, -1.f / 6}, {-1.f / 6, 1.f / 6, -1.f / 6},
+        {1.f / 24, 1.f / 12, 1.f / 6}, {1.f / 24, -1.f / 12, 1.f / 6},
+        {0.f, 0.f, 1.f}};
+} // namespace
+
+status_t gemm_f32_wino_conv_4x3_fwd_t::pd_t::init_conf() {
+    const memory_desc_wrapper src_d(src_md());
+    const memory_desc_wrapper wei_d(weights_md());
+    const memory_desc_wrapper dst_d(dst_md());
+
+    const bool shape_ok = ndims() == 4 && !with_groups() && KH() == 3
+            && KW() == 3 && KSH() == 1 && KSW() == 1 && KDH() == 0
+            && KDW() == 0;
+    const bool layout_ok = src_d.is_plain() && wei_d.is_plain()
+            && dst_d.is_plain()
+            && IMPLICATION(with_bias(),
+                    memory_desc_wrapper(weights_md(1)).is_dense());
+    if (!shape_ok || !layout_ok) return status::unimplemented;
+
+    auto &c = conf_;
+    c.mb = MB();
+    c.ic = IC();
+    c.oc = OC();
+    c.ih = IH();
+    c.iw = IW();
+    c.oh = OH();
+    c.ow = OW();
+    c.t_pad = padT();
+    c.l_pad = padL();
+    c.with_bias = with_bias();
+    c.with_post_ops = attr()->post_ops_.len() > 0;
+    c.nthr = dnnl_get_max_threads();
+
+    // The avx512 Winograd implementations are preferred whenever available,
+    // and the transforms only pay off with enough channels to feed the GEMMs.
+    if (desc()->alg_kind == alg_kind::convolution_auto
+            && (mayiuse(avx512_common) || c.ic < 64 || c.oc < 64))
+        return status::unimplemented;
+
+    c.tiles_h = div_up(c.oh, tile_size);
+    c.tiles_w = div_up(c.ow, tile_size);
+    c.ntiles = c.mb * c.tiles_h * c.tiles_w;
+
+    // Keep the transformed source and destination of a tile block in L2,
+    // but do not let the GEMMs get too thin, and give every thread some work.
+    const size_t tile_bytes = sizeof(float) * alpha_sq * (c.ic + c.oc);
+    const dim_t L2_tiles = (dim_t)(platform::get_per_core_cache_size(2)
+            / nstl::max(tile_bytes, (size_t)1));
+    c.tile_block = nstl::max(nstl::min(L2_tiles, (dim_t)64), (dim_t)8);
+    c.tile_block = nstl::min(c.tile_block, div_up(c.ntiles, c.nthr));
+    c.tile_block = nstl::max(c.tile_block, (dim_t)1);
+    c.nb_tile = div_up(c.ntiles, c.tile_block);
+
+    return status::success;
+}
+
+void gemm_f32_wino_conv_4x3_fwd_t::pd_t::init_scratchpad() {
+    const auto &c = conf_;
+    auto scratchpad = scratchpad_registry().registrar();
+    scratchpad.book<float>(key_wino_U, (size_t)alpha_sq * c.ic * c.oc);
+    scratchpad.book<float>(
+            key_wino_V, (size_t)alpha_sq * c.ic * c.tile_block * c.nthr);
+    scratchpad.book<float>(
+            key_wino_M, (size_t)alpha_sq * c.oc * c.tile_block * c.nthr);
+}
+
+// U[alpha][alpha][ic][oc] = G g G^T
+void gemm_f32_wino_conv_4x3_fwd_t::transform_weights(
+        const float *wei, float *U) const {
+    const auto &c = pd()->conf_;
+    const memory_desc_wrapper wei_d(pd()->weights_md());
+    const auto &strides = wei_d.blocking_desc().strides;
+    const dim_t kh_s = strides[2], kw_s = strides[3];
+
+    parallel_nd(c.ic, c.oc, [&](dim_t ic, dim_t oc) {
+        const float *g = &wei[wei_d.blk_off(oc, ic, 0, 0)];
+        float Gg[alpha][kernel_size];
+        for_(int i = 0; i < alpha; i++)
+        for (int kw = 0; kw < kernel_size; kw++) {
+            Gg[i][kw] = 0.f;
+            for (int kh = 0; kh < kernel_size; kh++)
+                Gg[i][kw] += G[i][kh] * g[kh * kh_s + kw * kw_s];
+        }
+        for_(int i = 0; i < alpha; i++)
+        for (int j = 0; j < alpha; j++) {
+            float u = 0.f;
+            for (int kw = 0; kw < kernel_size; kw++)
+                u += Gg[i][kw] * G[j][kw];
+            U[((i * alpha + j) * c.ic + ic) * c.oc + oc] = u;
+        }
+    });
+}
+
+void gemm_f32_wino_conv_4x3_fwd_t::execute_forward(
+        const exec_ctx_t &ctx) const {
+    auto src = CTX_IN_MEM(const float *, DNNL_ARG_SRC);
+    auto wei = CTX_IN_MEM(const float *, DNNL_ARG_WEIGHTS);
+    auto bia = CTX_IN_MEM(const float *, DNNL_ARG_BIAS);
+    auto dst = CTX_OUT_MEM(float *, DNNL_ARG_DST);
+
+    const auto &c = pd()->conf_;
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+    const memory_desc_wrapper bia_d(pd()->weights_md(1));
+    const dim_t src_c_s = src_d.blocking_desc().strides[1];
+    const dim_t dst_c_s = dst_d.blocking_desc().strides[1];
+    if (bia) bia += bia_d.offset0();
+
+    const auto scratchpad = ctx.get_scratchpad_grantor();
+    float *U = scratchpad.get<float>(key_wino_U);
+    float *V = scratchpad.get<float>(key_wino_V);
+    float *M = scratchpad.get<float>(key_wino_M);
+
+    transform_weights(wei, U);
+
+    const dim_t V_a_s = c.tile_block * c.ic;
+    const dim_t M_a_s = c.tile_block * c.oc;
+    const dim_t tiles_per_img = c.tiles_h * c.tiles_w;
+
+    // V[alpha][alpha][tile][ic] = B^T d B
+    auto transform_src = [&](float *V_thr, dim_t tile_start, dim_t ntiles) {
+        for (dim_t tt = 0; tt < ntiles; tt++) {
+            const dim_t tile = tile_start + tt;
+            const dim_t n = tile / tiles_per_img;
+            const dim_t ty = (tile % tiles_per_img) / c.tiles_w;
+            const dim_t tx = tile % c.tiles_w;
+            const dim_t ih0 = ty * tile_size - c.t_pad;
+            const dim_t iw0 = tx * tile_size - c.l_pad;
+
+            for (dim_t c0 = 0; c0 < c.ic; c0 += c_blk) {
+                const dim_t cn = nstl::min((dim_t)c_blk, c.ic - c0);
+                float I[alpha][alpha][c_blk], T[alpha][alpha][c_blk];
+                for_(int i = 0; i < alpha; i++)
+                for (int j = 0; j < alpha; j++) {
+                    const dim_t ih = ih0 + i, iw = iw0 + j;
+                    if (ih < 0 || ih >= c.ih || iw < 0 || iw >= c.iw) {
+                        PRAGMA_OMP_SIMD()
+                        for (int ic = 0; ic < cn; ic++)
+                            I[i][j][ic] = 0.f;
+                        continue;
+                    }
+                    const float *s = &src[src_d.blk_off(n, c0, ih, iw)];
+                    PRAGMA_OMP_SIMD()
+                    for (int ic = 0; ic < cn; ic++)
+                        I[i][j][ic] = s[ic * src_c_s];
+                }
+                for (int j = 0; j < alpha; j++) {
+                    PRAGMA_OMP_SIMD()
+                    for (int ic = 0; ic < cn; ic++)
+                        trans_src_1d(&I[0][j][ic], alpha * c_blk, &T[0][j][ic],
+                                alpha * c_blk);
+                }
+                float *v = &V_thr[tt * c.ic + c0];
+                for (int i = 0; i < alpha; i++) {
+                    PRAGMA_OMP_SIMD()
+                    for (int ic = 0; ic < cn; ic++)
+                        trans_src_1d(&T[i][0][ic], c_blk,
+                                &v[i * alpha * V_a_s + ic], V_a_s);
+                }
+            }
+        }
+    };
+
+    // dst = A^T m A followed by bias and post-ops
+    auto transform_dst = [&](const float *M_thr, dim_t tile_start,
+                                 dim_t ntiles) {
+        for (dim_t tt = 0; tt < ntiles; tt++) {
+            const dim_t tile = tile_start + tt;
+            const dim_t n = tile / tiles_per_img;
+            const dim_t oh0 = (tile % tiles_per_img) / c.tiles_w * tile_size;
+            const dim_t ow0 = tile % c.tiles_w * tile_size;
+
+            for (dim_t c0 = 0; c0 < c.oc; c0 += c_blk) {
+                const dim_t cn = nstl::min((dim_t)c_blk, c.oc - c0);
+                float T[tile_size][alpha][c_blk];
+                float O[tile_size][tile_size][c_blk];
+                const float *m = &M_thr[tt * c.oc + c0];
+                for (int j = 0; j < alpha; j++) {
+                    PRAGMA_OMP_SIMD()
+                    for (int oc = 0; oc < cn; oc++)
+                        trans_dst_1d(&m[j * M_a_s + oc], alpha * M_a_s,
+                                &T[0][j][oc], alpha * c_blk);
+                }
+                for (int i = 0; i < tile_size; i++) {
+                    PRAGMA_OMP_SIMD()
+                    for (int oc = 0; oc < cn; oc++)
+                        trans_dst_1d(&T[i][0][oc], c_blk, &O[i][0][oc], c_blk);
+                }
+
+                for_(int i = 0; i < tile_size; i++)
+                for (int j = 0; j < tile_size; j++) {
+                    const dim_t oh = oh0 + i, ow = ow0 + j;
+                    if (oh >= c.oh || ow >= c.ow) continue;
+                    float *d = &dst[dst_d.blk_off(n, c0, oh, ow)];
+                    if (c.with_bias) {
+                        PRAGMA_OMP_SIMD()
+                        for (int oc = 0; oc < cn; oc++)
+                            O[i][j][oc] += bia[c0 + oc];
+                    }
+                    if (c.with_post_ops) {
+                        ref_post_ops_t::args_t args;
+                        for (int oc = 0; oc < cn; oc++) {
+                            args.dst_val = d[oc * dst_c_s];
+                            ref_post_ops_->execute(O[i][j][oc], args);
+                        }
+                    }
+                    PRAGMA_OMP_SIMD()
+                    for (int oc = 0; oc < cn; oc++)
+                        d[oc * dst_c_s] = O[i][j][oc];
+                }
+            }
+        }
+    };
+
+    parallel(c.nthr, [&](const int ithr, const int nthr) {
+        dim_t start = 0, end = 0;
+        balance211(c.nb_tile, nthr, ithr, start, end);
+        float *V_thr = &V[ithr * alpha_sq * V_a_s];
+        float *M_thr = &M[ithr * alpha_sq * M_a_s];
+
+        for (dim_t tb = start; tb < end; tb++) {
+            const dim_t tile_start = tb * c.tile_block;
+            const dim_t ntiles
+                    = nstl::min(c.tile_block, c.ntiles - tile_start);
+
+            transform_src(V_thr, tile_start, ntiles);
+
+            // M[a][tile][oc] = V[a][tile][ic] * U[a][ic][oc], column major
+            const float one = 1.f, zero = 0.f;
+            const dim_t ic = c.ic, oc = c.oc;
+            for (int a = 0; a < alpha_sq; a++)
+                extended_sgemm("N", "N", &oc, &ntiles, &ic, &one,
+                        &U[a * ic * oc], &oc, &V_thr[a * V_a_s], &ic, &zero,
+                        &M_thr[a * M_a_s], &oc);
+
+            transform_dst(M_thr, tile_start, ntiles);
+        }
+    });
+}
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
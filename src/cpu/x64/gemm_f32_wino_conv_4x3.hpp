@@ -0,0 +1,128 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_GEMM_F32_WINO_CONV_4X3_HPP
+#define CPU_X64_GEMM_F32_WINO_CONV_4X3_HPP
+
+#include <memory>
+
+#include "common/c_types_map.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/primitive.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_convolution_pd.hpp"
+#include "cpu/primitive_attr_postops.hpp"
+
+#include "cpu/x64/cpu_isa_traits.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+// Winograd F(4x4, 3x3) forward convolution for the targets without the
+// avx512 Winograd implementations. For each block of tiles a thread
+// transforms the source, runs the 36 tile GEMMs with the jit sgemm and
+// transforms the result back, so the transformed data stays in L2.
+struct gemm_f32_wino_conv_4x3_conf_t {
+    dim_t mb, ic, oc, ih, iw, oh, ow;
+    dim_t t_pad, l_pad;
+    dim_t tiles_h, tiles_w, ntiles;
+    dim_t tile_block, nb_tile;
+    int nthr;
+    bool with_bias, with_post_ops;
+};
+
+struct gemm_f32_wino_conv_4x3_fwd_t : public primitive_t {
+    struct pd_t : public cpu_convolution_fwd_pd_t {
+        pd_t(const convolution_desc_t *adesc, const primitive_attr_t *attr,
+                const typename pd_t::base_class *hint_fwd_pd)
+            : cpu_convolution_fwd_pd_t(adesc, attr, hint_fwd_pd), conf_() {}
+
+        DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("gemm_wino_4x3:", avx2, ""),
+                gemm_f32_wino_conv_4x3_fwd_t);
+
+        status_t init(engine_t *engine) {
+            using namespace data_type;
+            VDISPATCH(is_fwd(), prop_kind);
+            VDISPATCH(utils::one_of(desc()->alg_kind,
+                            alg_kind::convolution_auto,
+                            alg_kind::convolution_winograd), alg_kind);
+            VDISPATCH(mayiuse(avx2), isa);
+            VDISPATCH(expect_data_types(f32, f32, f32, f32, f32), data_type);
+            VDISPATCH(attr()->has_default_values(
+                            primitive_attr_t::skip_mask_t::post_ops, f32),
+                    attr);
+            VDISPATCH(post_ops_ok(), post_ops);
+            VDISPATCH(set_default_formats(), format);
+
+            status_t status = init_conf();
+            if (status != status::success) return status;
+            if (!set_default_alg_kind(alg_kind::convolution_winograd))
+                return status::unimplemented;
+
+            init_scratchpad();
+            return status::success;
+        }
+
+        gemm_f32_wino_conv_4x3_conf_t conf_;
+
+    protected:
+        status_t init_conf();
+        void init_scratchpad();
+
+        bool post_ops_ok() const {
+            using namespace primitive_kind;
+            const auto &po = attr()->post_ops_;
+            for (int i = 0; i < po.len(); i++)
+                if (!utils::one_of(po.entry_[i].kind, sum, eltwise))
+                    return false;
+            return true;
+        }
+
+        bool set_default_formats() {
+            using namespace format_tag;
+            return set_default_formats_common(nhwc, oihw, nhwc);
+        }
+    };
+
+    gemm_f32_wino_conv_4x3_fwd_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override {
+        ref_post_ops_.reset(new ref_post_ops_t(pd()->attr()->post_ops_));
+        return status::success;
+    }
+
+    status_t execute(const exec_ctx_t &ctx) const override {
+        execute_forward(ctx);
+        return status::success;
+    }
+
+private:
+    void execute_forward(const exec_ctx_t &ctx) const;
+    void transform_weights(const float *wei, float *U) const;
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    std::unique_ptr<ref_post_ops_t> ref_post_ops_;
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -44,7 +44,8 @@ void jit_uni_eltwise_injector_f32<isa>::injector_preamble(
             && utils::one_of(alg_, eltwise_tanh, eltwise_elu, eltwise_abs,
                     eltwise_soft_relu, eltwise_logsigmoid, eltwise_logistic,
                     eltwise_exp, eltwise_gelu_tanh, eltwise_swish,
-                    eltwise_gelu_erf, eltwise_tanh_use_dst_for_bwd,
+                    eltwise_gelu_erf, eltwise_mish, eltwise_selu,
+                    eltwise_tanh_use_dst_for_bwd,
                     eltwise_elu_use_dst_for_bwd,
                     eltwise_logistic_use_dst_for_bwd,
                     eltwise_exp_use_dst_for_bwd);
@@ -274,11 +275,18 @@ void jit_uni_eltwise_injector_f32<isa>::exp_compute_vector_fwd(
     blend_with_mask(vmm_aux2, vmm_src);
 
     // compute polynomial
-    h->uni_vmovups(vmm_src, table_val(exp_pol, 4));
-    h->uni_vfmadd213ps(vmm_src, vmm_aux1, table_val(exp_pol, 3));
-    h->uni_vfmadd213ps(vmm_src, vmm_aux1, table_val(exp_pol, 2));
-    h->uni_vfmadd213ps(vmm_src, vmm_aux1, table_val(exp_pol, 1));
-    h->uni_vfmadd213ps(vmm_src, vmm_aux1, table_val(exp_pol, 0));
+    if (fast_math_) {
+        // degree 3 is enough for ~4e-4 relative error on [-ln2/2, ln2/2]
+        h->uni_vmovups(vmm_src, table_val(exp_fast_pol, 2));
+        h->uni_vfmadd213ps(vmm_src, vmm_aux1, table_val(exp_fast_pol, 1));
+        h->uni_vfmadd213ps(vmm_src, vmm_aux1, table_val(exp_fast_pol, 0));
+    } else {
+        h->uni_vmovups(vmm_src, table_val(exp_pol, 4));
+        h->uni_vfmadd213ps(vmm_src, vmm_aux1, table_val(exp_pol, 3));
+        h->uni_vfmadd213ps(vmm_src, vmm_aux1, table_val(exp_pol, 2));
+        h->uni_vfmadd213ps(vmm_src, vmm_aux1, table_val(exp_pol, 1));
+        h->uni_vfmadd213ps(vmm_src, vmm_aux1, table_val(exp_pol, 0));
+    }
     h->uni_vfmadd213ps(vmm_src, vmm_aux1, table_val(one));
     // y = y * 2^n
     h->uni_vmulps(vmm_src, vmm_src, vmm_aux2);
@@ -320,6 +328,29 @@ void jit_uni_eltwise_injector_f32<isa>::elu_compute_vector_fwd(
 template <cpu_isa_t isa>
 void jit_uni_eltwise_injector_f32<isa>::tanh_compute_vector_fwd(
         const Vmm &vmm_src) {
+    if (fast_math_) {
+        // tanh(x) ~ x * P(x^2) / Q(x^2), the [7/6] Pade approximant, which
+        // stays within 1e-4 relative error up to |x| = 9 where tanh(x)
+        // rounds to 1.f; the final clamp removes the overshoot near it.
+        h->uni_vminps(vmm_src, vmm_src, table_val(tanh_fast_bound, 0));
+        h->uni_vmaxps(vmm_src, vmm_src, table_val(tanh_fast_bound, 1));
+        h->uni_vmovups(vmm_aux1, vmm_src);
+        h->uni_vmulps(vmm_aux1, vmm_aux1, vmm_aux1);
+        h->uni_vmovups(vmm_aux2, table_val(tanh_fast_num, 2));
+        h->uni_vfmadd213ps(vmm_aux2, vmm_aux1, table_val(tanh_fast_num, 1));
+        h->uni_vfmadd213ps(vmm_aux2, vmm_aux1, table_val(tanh_fast_num, 0));
+        h->uni_vfmadd213ps(vmm_aux2, vmm_aux1, table_val(one));
+        h->uni_vmulps(vmm_src, vmm_src, vmm_aux2);
+        h->uni_vmovups(vmm_aux2, table_val(tanh_fast_den, 2));
+        h->uni_vfmadd213ps(vmm_aux2, vmm_aux1, table_val(tanh_fast_den, 1));
+        h->uni_vfmadd213ps(vmm_aux2, vmm_aux1, table_val(tanh_fast_den, 0));
+        h->uni_vfmadd213ps(vmm_aux2, vmm_aux1, table_val(one));
+        h->uni_vdivps(vmm_src, vmm_src, vmm_aux2);
+        h->uni_vminps(vmm_src, vmm_src, table_val(one));
+        h->uni_vmaxps(vmm_src, vmm_src, table_val(minus_one));
+        return;
+    }
+
     // we add a check as the avx2 code cannot be used for avx
     assert(IMPLICATION(isa == avx2, mayiuse(avx2)));
 
@@ -1400,6 +1431,126 @@ size_t jit_uni_eltwise_injector_f32<isa>::aux_gprs_count() {
     return 0;
 };
 
+template <cpu_isa_t isa>
+void jit_uni_eltwise_injector_f32<isa>::hardsigmoid_compute_vector_fwd(
+        const Vmm &vmm_src) {
+    // result = max(0, min(1, alpha * x + beta))
+    h->uni_vmovups(vmm_aux0, table_val(alpha));
+    h->uni_vfmadd213ps(vmm_src, vmm_aux0, table_val(beta));
+    h->uni_vmaxps(vmm_src, vmm_src, table_val(zero));
+    h->uni_vminps(vmm_src, vmm_src, table_val(one));
+}
+
+template <cpu_isa_t isa>
+void jit_uni_eltwise_injector_f32<isa>::hardswish_compute_vector_fwd(
+        const Vmm &vmm_src) {
+    // result = x * hardsigmoid(x)
+    h->uni_vmovups(vmm_aux1, vmm_src);
+    hardsigmoid_compute_vector_fwd(vmm_src);
+    h->uni_vmulps(vmm_src, vmm_src, vmm_aux1);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_eltwise_injector_f32<isa>::mish_compute_vector_fwd(
+        const Vmm &vmm_src) {
+    // mish(x) = x * tanh(ln(1 + e^x)) = x * n / (n + 2), where
+    // n = e^x * (e^x + 2). The exp argument is bounded by logf(FLT_MAX) / 4,
+    // so n does not overflow; above the bound n / (n + 2) rounds to 1.f.
+    // IMPORTANT: we use vmm_aux3 to keep x as exp_compute does not use it.
+    h->uni_vmovups(vmm_aux3, vmm_src);
+    h->uni_vminps(vmm_src, vmm_src, table_val(mish_fwd_max_x));
+    exp_compute_vector_fwd(vmm_src);
+    h->uni_vmovups(vmm_aux1, vmm_src);
+    h->uni_vaddps(vmm_aux1, vmm_aux1, table_val(two));
+    h->uni_vmulps(vmm_src, vmm_src, vmm_aux1);
+    h->uni_vmovups(vmm_aux1, vmm_src);
+    h->uni_vaddps(vmm_aux1, vmm_aux1, table_val(two));
+    h->uni_vdivps(vmm_src, vmm_src, vmm_aux1);
+    h->uni_vmulps(vmm_src, vmm_src, vmm_aux3);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_eltwise_injector_f32<isa>::selu_compute_vector_fwd(
+        const Vmm &vmm_src) {
+    // result = beta * elu(x)
+    elu_compute_vector_fwd(vmm_src);
+    h->uni_vmulps(vmm_src, vmm_src, table_val(beta));
+}
+
+template <cpu_isa_t isa>
+void jit_uni_eltwise_injector_f32<isa>::hardsigmoid_compute_vector_bwd(
+        const Vmm &vmm_src) {
+    // result = 0 < alpha * x + beta < 1 ? alpha : 0
+    h->uni_vmovups(vmm_aux0, table_val(alpha));
+    h->uni_vfmadd213ps(vmm_src, vmm_aux0, table_val(beta));
+    h->uni_vmovups(vmm_aux1, table_val(alpha));
+    compute_cmp_mask(vmm_src, table_val(zero), _cmp_le_os);
+    blend_with_mask(vmm_aux1, table_val(zero));
+    compute_cmp_mask(vmm_src, table_val(one), _cmp_ge_os);
+    blend_with_mask(vmm_aux1, table_val(zero));
+    h->uni_vmovups(vmm_src, vmm_aux1);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_eltwise_injector_f32<isa>::hardswish_compute_vector_bwd(
+        const Vmm &vmm_src) {
+    // result = v <= 0 ? 0 : v >= 1 ? 1 : v + alpha * x, v = alpha * x + beta
+    h->uni_vmovups(vmm_aux1, vmm_src);
+    h->uni_vmulps(vmm_aux1, vmm_aux1, table_val(alpha));
+    h->uni_vmovups(vmm_aux0, table_val(alpha));
+    h->uni_vfmadd213ps(vmm_src, vmm_aux0, table_val(beta));
+    h->uni_vaddps(vmm_aux1, vmm_aux1, vmm_src);
+    compute_cmp_mask(vmm_src, table_val(zero), _cmp_le_os);
+    blend_with_mask(vmm_aux1, table_val(zero));
+    compute_cmp_mask(vmm_src, table_val(one), _cmp_ge_os);
+    blend_with_mask(vmm_aux1, table_val(one));
+    h->uni_vmovups(vmm_src, vmm_aux1);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_eltwise_injector_f32<isa>::mish_compute_vector_bwd(
+        const Vmm &vmm_src) {
+    // mish'(x) = w * omega / delta^2, where w = e^x,
+    // omega = w^3 + 4 * w^2 + (4 * x + 6) * w + 4 * (x + 1),
+    // delta = w^2 + 2 * w + 2. The exp argument is bounded by
+    // logf(FLT_MAX) / 8, so delta^2 does not overflow; above the bound the
+    // result rounds to 1.f.
+    // IMPORTANT: we use vmm_aux3 to keep x as exp_compute does not use it.
+    h->uni_vminps(vmm_src, vmm_src, table_val(mish_bwd_max_x));
+    h->uni_vmovups(vmm_aux3, vmm_src);
+    exp_compute_vector_fwd(vmm_src);
+    // aux4 = 4 * (x + 1)
+    h->uni_vmovups(vmm_aux4, vmm_aux3);
+    h->uni_vaddps(vmm_aux4, vmm_aux4, table_val(one));
+    h->uni_vaddps(vmm_aux4, vmm_aux4, vmm_aux4);
+    h->uni_vaddps(vmm_aux4, vmm_aux4, vmm_aux4);
+    // aux0 = omega by Horner's scheme: ((w + 4) * w + 4 * x + 6) * w + aux4
+    h->uni_vmovups(vmm_aux0, vmm_src);
+    h->uni_vaddps(vmm_aux0, vmm_aux0, table_val(two));
+    h->uni_vaddps(vmm_aux0, vmm_aux0, table_val(two));
+    h->uni_vmulps(vmm_aux0, vmm_aux0, vmm_src);
+    h->uni_vaddps(vmm_aux0, vmm_aux0, vmm_aux4);
+    h->uni_vaddps(vmm_aux0, vmm_aux0, table_val(two));
+    h->uni_vmulps(vmm_aux0, vmm_aux0, vmm_src);
+    h->uni_vaddps(vmm_aux0, vmm_aux0, vmm_aux4);
+    // aux1 = delta = (w + 2) * w + 2
+    h->uni_vmovups(vmm_aux1, vmm_src);
+    h->uni_vaddps(vmm_aux1, vmm_aux1, table_val(two));
+    h->uni_vmulps(vmm_aux1, vmm_aux1, vmm_src);
+    h->uni_vaddps(vmm_aux1, vmm_aux1, table_val(two));
+    h->uni_vmulps(vmm_aux1, vmm_aux1, vmm_aux1);
+    h->uni_vmulps(vmm_src, vmm_src, vmm_aux0);
+    h->uni_vdivps(vmm_src, vmm_src, vmm_aux1);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_eltwise_injector_f32<isa>::selu_compute_vector_bwd(
+        const Vmm &vmm_src) {
+    // result = beta * elu'(x)
+    elu_compute_vector_bwd(vmm_src);
+    h->uni_vmulps(vmm_src, vmm_src, table_val(beta));
+}
+
 template <cpu_isa_t isa>
 void jit_uni_eltwise_injector_f32<isa>::round_compute_vector_fwd(
         const Vmm &vmm_src) {
@@ -1438,6 +1589,10 @@ size_t jit_uni_eltwise_injector_f32<isa>::aux_vecs_count() {
             case eltwise_pow: return 2;
             case eltwise_gelu_erf: return 5;
             case eltwise_round: return 0;
+            case eltwise_hardswish: return 2;
+            case eltwise_hardsigmoid: return 1;
+            case eltwise_mish: return 4;
+            case eltwise_selu: return 4;
             default: assert(!"unsupported eltwise algorithm");
         }
     } else {
@@ -1468,6 +1623,10 @@ size_t jit_uni_eltwise_injector_f32<isa>::aux_vecs_count() {
             case eltwise_clip_v2: return 2;
             case eltwise_pow: return 2;
             case eltwise_gelu_erf: return 5;
+            case eltwise_hardswish: return 2;
+            case eltwise_hardsigmoid: return 2;
+            case eltwise_mish: return 5;
+            case eltwise_selu: return 3;
             default: assert(!"unsupported eltwise algorithm");
         }
     }
@@ -1527,6 +1686,14 @@ void jit_uni_eltwise_injector_f32<isa>::compute_body(
                     gelu_erf_compute_vector_fwd(Vmm(idx));
                     break;
                 case eltwise_round: round_compute_vector_fwd(Vmm(idx)); break;
+                case eltwise_hardswish:
+                    hardswish_compute_vector_fwd(Vmm(idx));
+                    break;
+                case eltwise_hardsigmoid:
+                    hardsigmoid_compute_vector_fwd(Vmm(idx));
+                    break;
+                case eltwise_mish: mish_compute_vector_fwd(Vmm(idx)); break;
+                case eltwise_selu: selu_compute_vector_fwd(Vmm(idx)); break;
                 default: assert(!"unsupported eltwise algorithm");
             }
         } else {
@@ -1569,6 +1736,14 @@ void jit_uni_eltwise_injector_f32<isa>::compute_body(
                 case eltwise_gelu_erf:
                     gelu_erf_compute_vector_bwd(Vmm(idx));
                     break;
+                case eltwise_hardswish:
+                    hardswish_compute_vector_bwd(Vmm(idx));
+                    break;
+                case eltwise_hardsigmoid:
+                    hardsigmoid_compute_vector_bwd(Vmm(idx));
+                    break;
+                case eltwise_mish: mish_compute_vector_bwd(Vmm(idx)); break;
+                case eltwise_selu: selu_compute_vector_bwd(Vmm(idx)); break;
                 default: assert(!"unsupported eltwise algorithm");
             }
         }
@@ -1676,6 +1851,26 @@ void jit_uni_eltwise_injector_f32<isa>::register_table_entries() {
             {exp_pol, {0x3c07cfce, true}} // p5 = 0.00828929059f
     };
 
+    // exp(x) minimax polynomial approximation for fast math mode
+    static const table_t exp_fast_polynomial {
+            // p0 = 1.0f
+            {exp_fast_pol, {0x3f807bd8, true}}, // p1 = 1.00377936f
+            {exp_fast_pol, {0x3f00f613, true}}, // p2 = 0.5037548f
+            {exp_fast_pol, {0x3e0037a1, true}} // p3 = 0.1252122f
+    };
+
+    // tanh(x) Pade approximant coefficients for fast math mode
+    static const table_t tanh_fast_consts {
+            {tanh_fast_bound, {0x41100000, true}}, // 9.f
+            {tanh_fast_bound, {0xc1100000, true}}, // -9.f
+            {tanh_fast_num, {0x3e034835, true}}, // 17325 / 135135
+            {tanh_fast_num, {0x3b375147, true}}, // 378 / 135135
+            {tanh_fast_num, {0x36f84d94, true}}, // 1 / 135135
+            {tanh_fast_den, {0x3eec4ec5, true}}, // 62370 / 135135
+            {tanh_fast_den, {0x3cbef4a9, true}}, // 3150 / 135135
+            {tanh_fast_den, {0x395943e2, true}} // 28 / 135135
+    };
+
     // tanh(x) constants for four interval approximation
     static const table_t tanh_consts {{tanh_idx_bias, {0x39800000, true}},
             {tanh_idx_mask, {0xffc00000, true}},
@@ -1960,6 +2155,12 @@ void jit_uni_eltwise_injector_f32<isa>::register_table_entries() {
             {gelu_erf_pol, {0x3f87dc22, true}}, // p5 = 1.061405429f
     };
 
+    // mish(x) constants
+    static const table_t mish_consts {
+            {mish_fwd_max_x, {0x41b17218, true}}, // 22.18070977f
+            {mish_bwd_max_x, {0x41317218, true}}, // 11.09035488f
+    };
+
     // log(x) constants
     static const table_t log_consts {
             {log_minus_inf, {0xff800000, true}},
@@ -2088,7 +2289,9 @@ void jit_uni_eltwise_injector_f32<isa>::register_table_entries() {
                 case eltwise_exp:
                 case eltwise_logistic_use_dst_for_bwd:
                 case eltwise_logistic:
-                case eltwise_swish: exp_ = true; break;
+                case eltwise_swish:
+                case eltwise_selu: exp_ = true; break;
+                case eltwise_mish: mish_ = true; break;
                 case eltwise_gelu_erf: gelu_erf_ = true; break;
                 case eltwise_gelu_tanh: gelu_tanh_ = true; break;
                 case eltwise_log: log_ = true; break;
@@ -2106,13 +2309,15 @@ void jit_uni_eltwise_injector_f32<isa>::register_table_entries() {
         bool gelu_tanh_ = false;
         bool gelu_erf_ = false;
         bool log_ = false;
+        bool mish_ = false;
 
-        bool exp() const { return exp_ || soft_relu_ || gelu_erf_; }
+        bool exp() const { return exp_ || soft_relu_ || gelu_erf_ || mish_; }
         bool tanh() const { return tanh_ || gelu_tanh_; }
         bool soft_relu() const { return soft_relu_; }
         bool gelu_tanh() const { return gelu_tanh_; }
         bool gelu_erf() const { return gelu_erf_; }
         bool log() const { return log_; }
+        bool mish() const { return mish_; }
     };
 
     need_t need(alg_);
@@ -2137,8 +2342,10 @@ void jit_uni_eltwise_injector_f32<isa>::register_table_entries() {
     push_entries_of(common_values);
     if (need.exp()) push_entries_of(exp_consts);
     if (need.exp()) push_entries_of(exp_polynomial);
-    if (need.tanh()) push_entries_of(tanh_consts);
-    if (need.tanh()) push_entries_of(tanh_polynomial_table);
+    if (need.exp() && fast_math_) push_entries_of(exp_fast_polynomial);
+    if (need.tanh() && fast_math_) push_entries_of(tanh_fast_consts);
+    if (need.tanh() && !fast_math_) push_entries_of(tanh_consts);
+    if (need.tanh() && !fast_math_) push_entries_of(tanh_polynomial_table);
     if (need.soft_relu()) push_entries_of(soft_relu_consts);
     if (need.soft_relu()) push_entries_of(soft_relu_polynomial);
     if (need.gelu_tanh()) push_entries_of(gelu_tanh_consts);
@@ -2147,6 +2354,7 @@ void jit_uni_eltwise_injector_f32<isa>::register_table_entries() {
     if (need.log()) push_entries_of(log_consts);
     if (need.log()) push_entries_of(log_polynomial);
     if (need.log()) push_entries_of(log_predefined_values);
+    if (need.mish()) push_entries_of(mish_consts);
 
     // Now that we registered the entries, we set the offsets.  No
     // entries should be registered after this point.  This allows to
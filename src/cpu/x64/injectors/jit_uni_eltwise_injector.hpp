@@ -38,18 +38,20 @@ struct static_params_t {
     static_params_t(bool save_state = true,
             Xbyak::Reg64 p_table = Xbyak::util::rax,
             Xbyak::Opmask k_mask = Xbyak::Opmask(1), bool is_fwd = true,
-            bool use_dst = false)
+            bool use_dst = false, bool fast_math = false)
         : save_state(save_state)
         , p_table(p_table)
         , k_mask(k_mask)
         , is_fwd(is_fwd)
-        , use_dst(use_dst) {}
+        , use_dst(use_dst)
+        , fast_math(fast_math) {}
 
     bool save_state;
     Xbyak::Reg64 p_table;
     Xbyak::Opmask k_mask;
     bool is_fwd;
     bool use_dst;
+    bool fast_math;
 };
 } // namespace eltwise_injector
 
@@ -69,11 +71,13 @@ struct jit_uni_eltwise_injector_f32 {
     //   - algorithm derivative.
     // use_dst - defines whether source or destination point is passed to alg
     //   code. Depends on algorithm. See `_use_dst_for_bwd` algs definition.
+    // fast_math - when true, forward exp and tanh (and the algs built on top
+    //   of them) use shorter approximations with ~1e-3 relative accuracy.
     jit_uni_eltwise_injector_f32(jit_generator *host, alg_kind_t alg,
             float alpha, float beta, float scale, bool save_state = true,
             Xbyak::Reg64 p_table = Xbyak::util::rax,
             Xbyak::Opmask k_mask = Xbyak::Opmask(1), bool is_fwd = true,
-            bool use_dst = false)
+            bool use_dst = false, bool fast_math = false)
         : alg_(alg)
         , alpha_(alpha)
         , beta_(beta)
@@ -83,7 +87,8 @@ struct jit_uni_eltwise_injector_f32 {
         , p_table(p_table)
         , k_mask(k_mask)
         , is_fwd_(is_fwd)
-        , use_dst_(use_dst) {
+        , use_dst_(use_dst)
+        , fast_math_(fast_math && is_fwd) {
         using namespace alg_kind;
         assert(utils::one_of(
                 isa, sse41, avx, avx2, avx512_common, avx512_core));
@@ -93,7 +98,9 @@ struct jit_uni_eltwise_injector_f32 {
                 eltwise_logsigmoid, eltwise_exp, eltwise_gelu_tanh,
                 eltwise_swish, eltwise_log, eltwise_clip, eltwise_clip_v2,
                 eltwise_pow, eltwise_gelu_erf, eltwise_round,
-                eltwise_relu_use_dst_for_bwd, eltwise_tanh_use_dst_for_bwd,
+                eltwise_hardswish, eltwise_hardsigmoid, eltwise_mish,
+                eltwise_selu, eltwise_relu_use_dst_for_bwd,
+                eltwise_tanh_use_dst_for_bwd,
                 eltwise_elu_use_dst_for_bwd, eltwise_sqrt_use_dst_for_bwd,
                 eltwise_logistic_use_dst_for_bwd, eltwise_exp_use_dst_for_bwd,
                 eltwise_clip_v2_use_dst_for_bwd));
@@ -104,10 +111,10 @@ struct jit_uni_eltwise_injector_f32 {
             const post_ops_t::entry_t::eltwise_t &eltwise,
             bool save_state = true, Xbyak::Reg64 p_table = Xbyak::util::rax,
             Xbyak::Opmask k_mask = Xbyak::Opmask(1), bool is_fwd = true,
-            bool use_dst = false)
+            bool use_dst = false, bool fast_math = false)
         : jit_uni_eltwise_injector_f32(host, eltwise.alg, eltwise.alpha,
                 eltwise.beta, eltwise.scale, save_state, p_table, k_mask,
-                is_fwd, use_dst) {}
+                is_fwd, use_dst, fast_math) {}
 
     void compute_vector_range(size_t start_idx, size_t end_idx);
     void compute_vector_range(const injector_utils::vmm_index_set_t &vmm_idxs);
@@ -128,6 +135,7 @@ private:
     const Xbyak::Opmask k_mask;
     const bool is_fwd_;
     const bool use_dst_;
+    const bool fast_math_;
 
     Xbyak::Label l_table;
 
@@ -203,6 +211,10 @@ private:
     void pow_compute_vector_fwd(const Vmm &vmm_src);
     void gelu_erf_compute_vector_fwd(const Vmm &vmm_src);
     void round_compute_vector_fwd(const Vmm &vmm_src);
+    void hardswish_compute_vector_fwd(const Vmm &vmm_src);
+    void hardsigmoid_compute_vector_fwd(const Vmm &vmm_src);
+    void mish_compute_vector_fwd(const Vmm &vmm_src);
+    void selu_compute_vector_fwd(const Vmm &vmm_src);
 
     void exp_compute_vector_bwd(const Vmm &vmm_src);
     void relu_compute_vector_bwd(const Vmm &vmm_src);
@@ -222,6 +234,10 @@ private:
     void clip_compute_vector_bwd(const Vmm &vmm_src);
     void pow_compute_vector_bwd(const Vmm &vmm_src);
     void gelu_erf_compute_vector_bwd(const Vmm &vmm_src);
+    void hardswish_compute_vector_bwd(const Vmm &vmm_src);
+    void hardsigmoid_compute_vector_bwd(const Vmm &vmm_src);
+    void mish_compute_vector_bwd(const Vmm &vmm_src);
+    void selu_compute_vector_bwd(const Vmm &vmm_src);
 
     enum key_t {
         scale = 0, // scale argument
@@ -241,11 +257,15 @@ private:
         exp_ln_flt_max_f, // logf(FLT_MAX) - max normal value
         exp_ln_flt_min_f, // logf(FLT_MIN) - min normal value
         exp_pol, // see correspondent table for float values
+        exp_fast_pol, // shorter polynomial used in fast math mode
         tanh_idx_bias, // bias applied during index computation
         tanh_idx_mask, // mask applied to extract index
         tanh_linear_ubound, // arg below which tanh(x) = x
         tanh_saturation_lbound, // arg after which tanh(x) = 1.f
         tanh_pol_table, // table of polynomial coefficients
+        tanh_fast_bound, // 9.f and -9.f, the fast math input range
+        tanh_fast_num, // Pade approximant numerator coefficients
+        tanh_fast_den, // Pade approximant denominator coefficients
         soft_relu_one_twenty_six, // 126.f
         soft_relu_mantissa_sign_mask, // mask for mantissa bits and sign
         soft_relu_pol, // see correspondent table for float values
@@ -256,6 +276,8 @@ private:
         gelu_erf_one_over_sqrt_two, // 1.f / sqrtf(2.f)
         gelu_erf_one_over_sqrt_pi, // 1.f / sqrtf(pi) = 0.564190f
         gelu_erf_pol, // see correspondent table for float values
+        mish_fwd_max_x, // logf(FLT_MAX) / 4, the bound to avoid overflow
+        mish_bwd_max_x, // logf(FLT_MAX) / 8, the bound to avoid overflow
         log_minus_inf, // -inf
         log_qnan, // qnan
         log_mantissa_mask, // gets mantissa bits
@@ -40,7 +40,7 @@ jit_uni_postops_injector_t<isa>::jit_uni_postops_injector_t(jit_generator *host,
             alg_to_eltwise_injector_.emplace(post_op.eltwise.alg,
                     jit_uni_eltwise_injector_f32<isa>(host_, post_op.eltwise,
                             esp.save_state, esp.p_table, esp.k_mask, esp.is_fwd,
-                            esp.use_dst));
+                            esp.use_dst, esp.fast_math));
         } else if (post_op.is_binary()) {
             is_binary = true;
         }
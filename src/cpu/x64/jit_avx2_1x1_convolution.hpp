@@ -57,15 +57,17 @@ struct jit_avx2_1x1_convolution_fwd_t : public primitive_t {
                 jit_avx2_1x1_convolution_fwd_t);
 
         status_t init(engine_t *engine) {
-            bool ok = true && is_fwd()
-                    && set_default_alg_kind(alg_kind::convolution_direct)
-                    && expect_data_types(data_type::f32, data_type::f32,
-                            data_type::f32, data_type::f32, data_type::f32)
-                    && attr()->has_default_values(
+            VDISPATCH(is_fwd(), prop_kind);
+            VDISPATCH(set_default_alg_kind(alg_kind::convolution_direct),
+                    alg_kind);
+            VDISPATCH(expect_data_types(data_type::f32, data_type::f32,
+                            data_type::f32, data_type::f32, data_type::f32),
+                    data_type);
+            VDISPATCH(attr()->has_default_values(
                             primitive_attr_t::skip_mask_t::post_ops,
-                            data_type::f32)
-                    && !has_zero_dim_memory() && set_default_formats();
-            if (!ok) return status::unimplemented;
+                            data_type::f32), attr);
+            VDISPATCH(!has_zero_dim_memory(), zero_dim);
+            VDISPATCH(set_default_formats(), format);
 
             const convolution_desc_t *conv_d = desc();
             const memory_desc_t *src_d = src_md();
@@ -335,13 +337,15 @@ struct jit_avx2_1x1_convolution_bwd_data_t : public primitive_t {
                 jit_avx2_1x1_convolution_bwd_data_t);
 
         status_t init(engine_t *engine) {
-            bool ok = true && desc()->prop_kind == prop_kind::backward_data
-                    && set_default_alg_kind(alg_kind::convolution_direct)
-                    && expect_data_types(data_type::f32, data_type::f32,
-                            data_type::undef, data_type::f32, data_type::f32)
-                    && attr()->has_default_values() && !has_zero_dim_memory()
-                    && set_default_formats();
-            if (!ok) return status::unimplemented;
+            VDISPATCH(desc()->prop_kind == prop_kind::backward_data, prop_kind);
+            VDISPATCH(set_default_alg_kind(alg_kind::convolution_direct),
+                    alg_kind);
+            VDISPATCH(expect_data_types(data_type::f32, data_type::f32,
+                            data_type::undef, data_type::f32, data_type::f32),
+                    data_type);
+            VDISPATCH(attr()->has_default_values(), attr);
+            VDISPATCH(!has_zero_dim_memory(), zero_dim);
+            VDISPATCH(set_default_formats(), format);
 
             const convolution_desc_t *conv_d = desc();
             const memory_desc_t *diff_src_d = diff_src_md();
@@ -417,13 +421,16 @@ struct jit_avx2_1x1_convolution_bwd_weights_t : public primitive_t {
                 jit_avx2_1x1_convolution_bwd_weights_t);
 
         status_t init(engine_t *engine) {
-            bool ok = true && desc()->prop_kind == prop_kind::backward_weights
-                    && set_default_alg_kind(alg_kind::convolution_direct)
-                    && expect_data_types(data_type::f32, data_type::f32,
-                            data_type::f32, data_type::f32, data_type::f32)
-                    && attr()->has_default_values() && !has_zero_dim_memory()
-                    && set_default_formats();
-            if (!ok) return status::unimplemented;
+            VDISPATCH(desc()->prop_kind == prop_kind::backward_weights,
+                    prop_kind);
+            VDISPATCH(set_default_alg_kind(alg_kind::convolution_direct),
+                    alg_kind);
+            VDISPATCH(expect_data_types(data_type::f32, data_type::f32,
+                            data_type::f32, data_type::f32, data_type::f32),
+                    data_type);
+            VDISPATCH(attr()->has_default_values(), attr);
+            VDISPATCH(!has_zero_dim_memory(), zero_dim);
+            VDISPATCH(set_default_formats(), format);
 
             const convolution_desc_t *conv_d = desc();
             const memory_desc_t *src_d = src_md();
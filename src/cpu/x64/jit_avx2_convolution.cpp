@@ -19,6 +19,8 @@
 #include "common/type_helpers.hpp"
 #include "common/utils.hpp"
 
+#include "cpu/platform.hpp"
+
 #include "cpu/x64/jit_avx2_convolution.hpp"
 
 namespace dnnl {
@@ -185,7 +187,13 @@ void jit_avx2_convolution_fwd_t::execute_forward(const exec_ctx_t &ctx) const {
         bias = padded_bias;
     }
 
-    parallel(jcp.nthr, ker);
+    // The work items are independent, so on hybrid parts they are scheduled
+    // dynamically to not make the fast cores wait for the slow ones
+    const int nthr = dnnl_get_exec_num_threads(jcp.nthr);
+    if (platform::has_hybrid_cores())
+        parallel_dynamic_ithr(nthr, ker);
+    else
+        parallel(nthr, ker);
 
     if (pd()->wants_zero_pad_dst()) ctx.memory(DNNL_ARG_DST)->zero_pad(ctx);
 }
@@ -216,7 +224,10 @@ void jit_avx2_convolution_bwd_data_t::execute_backward_data(
             + (size_t)jcp.od * jcp.oh * jcp.ow * oc_chunk
             + (size_t)jcp.kd * jcp.kh * jcp.kw * ic_chunk * oc_chunk;
 
-    if (work_amount < (size_t)2 * jcp.nthr || iter_data_amount > L2) {
+    // The blocking is re-planned for the number of threads available at
+    // execution, which may be smaller than the one at creation
+    const int nthr = dnnl_get_exec_num_threads(jcp.nthr);
+    if (work_amount < (size_t)2 * nthr || iter_data_amount > L2) {
         ih_block_size = 1;
         num_ih_blocks = utils::div_up(jcp.ih, ih_block_size);
         work_amount *= num_ih_blocks;
@@ -344,7 +355,7 @@ void jit_avx2_convolution_bwd_data_t::execute_backward_data(
         }
     };
 
-    parallel(jcp.nthr, ker);
+    parallel(nthr, ker);
 }
 
 void jit_avx2_convolution_bwd_weights_t::execute_backward_weights(
@@ -43,15 +43,17 @@ struct jit_avx2_convolution_fwd_t : public primitive_t {
                 jit_avx2_convolution_fwd_t);
 
         status_t init(engine_t *engine) {
-            bool ok = true && is_fwd()
-                    && set_default_alg_kind(alg_kind::convolution_direct)
-                    && expect_data_types(data_type::f32, data_type::f32,
-                            data_type::f32, data_type::f32, data_type::f32)
-                    && attr()->has_default_values(
+            VDISPATCH(is_fwd(), prop_kind);
+            VDISPATCH(set_default_alg_kind(alg_kind::convolution_direct),
+                    alg_kind);
+            VDISPATCH(expect_data_types(data_type::f32, data_type::f32,
+                            data_type::f32, data_type::f32, data_type::f32),
+                    data_type);
+            VDISPATCH(attr()->has_default_values(
                             primitive_attr_t::skip_mask_t::post_ops,
-                            data_type::f32)
-                    && !has_zero_dim_memory() && set_default_formats();
-            if (!ok) return status::unimplemented;
+                            data_type::f32), attr);
+            VDISPATCH(!has_zero_dim_memory(), zero_dim);
+            VDISPATCH(set_default_formats(), format);
 
             status_t status = jit_avx2_conv_fwd_kernel_f32::init_conf(
                     jcp_, *desc(), src_md(), weights_md(), dst_md(), *attr());
@@ -117,13 +119,15 @@ struct jit_avx2_convolution_bwd_data_t : public primitive_t {
                 jit_avx2_convolution_bwd_data_t);
 
         status_t init(engine_t *engine) {
-            bool ok = true && desc()->prop_kind == prop_kind::backward_data
-                    && set_default_alg_kind(alg_kind::convolution_direct)
-                    && expect_data_types(data_type::f32, data_type::f32,
-                            data_type::undef, data_type::f32, data_type::f32)
-                    && attr()->has_default_values() && !has_zero_dim_memory()
-                    && set_default_formats();
-            if (!ok) return status::unimplemented;
+            VDISPATCH(desc()->prop_kind == prop_kind::backward_data, prop_kind);
+            VDISPATCH(set_default_alg_kind(alg_kind::convolution_direct),
+                    alg_kind);
+            VDISPATCH(expect_data_types(data_type::f32, data_type::f32,
+                            data_type::undef, data_type::f32, data_type::f32),
+                    data_type);
+            VDISPATCH(attr()->has_default_values(), attr);
+            VDISPATCH(!has_zero_dim_memory(), zero_dim);
+            VDISPATCH(set_default_formats(), format);
 
             status_t status = jit_avx2_conv_bwd_data_kernel_f32::init_conf(jcp_,
                     *desc(), *diff_src_md(), *weights_md(), *diff_dst_md());
@@ -184,13 +188,16 @@ struct jit_avx2_convolution_bwd_weights_t : public primitive_t {
                 jit_avx2_convolution_bwd_weights_t);
 
         status_t init(engine_t *engine) {
-            bool ok = true && desc()->prop_kind == prop_kind::backward_weights
-                    && set_default_alg_kind(alg_kind::convolution_direct)
-                    && expect_data_types(data_type::f32, data_type::f32,
-                            data_type::f32, data_type::f32, data_type::f32)
-                    && attr()->has_default_values() && !has_zero_dim_memory()
-                    && set_default_formats();
-            if (!ok) return status::unimplemented;
+            VDISPATCH(desc()->prop_kind == prop_kind::backward_weights,
+                    prop_kind);
+            VDISPATCH(set_default_alg_kind(alg_kind::convolution_direct),
+                    alg_kind);
+            VDISPATCH(expect_data_types(data_type::f32, data_type::f32,
+                            data_type::f32, data_type::f32, data_type::f32),
+                    data_type);
+            VDISPATCH(attr()->has_default_values(), attr);
+            VDISPATCH(!has_zero_dim_memory(), zero_dim);
+            VDISPATCH(set_default_formats(), format);
 
             status_t status = jit_avx2_conv_bwd_weights_kernel_f32::init_conf(
                     jcp_, *desc(), *src_md(), *diff_weights_md(),
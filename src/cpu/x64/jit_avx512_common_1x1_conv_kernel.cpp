@@ -27,6 +27,8 @@
 
 #include "cpu/platform.hpp"
 #include "cpu/x64/cpu_barrier.hpp"
+#include "cpu/x64/injectors/injector_utils.hpp"
+#include "cpu/x64/injectors/jit_uni_binary_injector.hpp"
 
 #include "cpu/x64/jit_avx512_common_1x1_conv_kernel.hpp"
 #include "cpu/x64/jit_uni_1x1_conv_utils.hpp"
@@ -44,6 +46,31 @@ using namespace dnnl::impl::utils;
 
 using namespace Xbyak;
 
+jit_avx512_common_1x1_conv_kernel::jit_avx512_common_1x1_conv_kernel(
+        const jit_1x1_conv_conf_t &ajcp, const primitive_attr_t &attr,
+        const memory_desc_t &dst_md)
+    : jcp(ajcp), attr_(attr) {
+    if (jcp.with_eltwise || jcp.with_binary) {
+        using namespace binary_injector;
+        static constexpr bool preserve_gpr = true;
+        static constexpr bool preserve_vmm = false;
+        static constexpr size_t helper_vmm_idx = 31;
+        static constexpr bool use_exact_tail_scalar_bcast = false;
+        const size_t tail_size = jcp.load_dim % jcp.load_block;
+
+        rhs_arg_static_params_t rhs_arg_static_params {helper_vmm_idx, r13, r14,
+                preserve_gpr, preserve_vmm,
+                GET_OFF(post_ops_binary_rhs_arg_vec),
+                memory_desc_wrapper(dst_md), tail_size, k_load_dim_mask,
+                use_exact_tail_scalar_bcast};
+        static_params_t static_params {this->param1, rhs_arg_static_params};
+
+        postops_injector_ = utils::make_unique<
+                injector::jit_uni_postops_injector_t<avx512_common>>(
+                this, jcp.post_ops, static_params);
+    }
+}
+
 void jit_avx512_common_1x1_conv_kernel::bcast_loop(int load_loop_blk) {
     mov(aux1_reg_bcast_data, reg_bcast_data);
     mov(aux_reg_bcast_data, reg_bcast_data);
@@ -147,6 +174,63 @@ void jit_avx512_common_1x1_conv_kernel::bcast_loop(int load_loop_blk) {
     }
 }
 
+void jit_avx512_common_1x1_conv_kernel::apply_postops(
+        int load_loop_blk, int ur) {
+    injector_utils::vmm_index_set_t vmm_idxs;
+    if (jcp.with_binary) {
+        binary_injector::rhs_arg_dynamic_params_t rhs_arg_params;
+        const bool out_layout_nxc = is_out_layout_nxc(jcp);
+        const int load_dim_tail = jcp.load_dim % jcp.load_block;
+        const int i_load_shift = out_layout_nxc
+                ? jcp.load_block
+                : jcp.bcast_dim * jcp.load_block;
+        const int i_ur_shift = out_layout_nxc ? jcp.load_dim : jcp.load_block;
+        const auto oc_off_oprnd = r12;
+        const auto out_off_oprnd = r15;
+
+        for (int i_load = 0; i_load < load_loop_blk; ++i_load) {
+            // the tail mask is all 1's unless the oc tail is processed
+            const bool mask_flag
+                    = load_dim_tail && i_load + 1 == load_loop_blk;
+            for (int i_ur = 0; i_ur < ur; ++i_ur) {
+                const int vmm_idx = i_ur * load_loop_blk + i_load;
+                vmm_idxs.emplace(vmm_idx);
+
+                rhs_arg_params.vmm_idx_to_oc_elem_off_addr.emplace(
+                        vmm_idx, ptr[param1 + GET_OFF(oc_l_off)]);
+                rhs_arg_params.vmm_idx_to_oc_elem_off_val.emplace(
+                        vmm_idx, i_load * jcp.load_block);
+                rhs_arg_params.vmm_idx_to_oc_off_oprnd.emplace(
+                        vmm_idx, oc_off_oprnd);
+                rhs_arg_params.vmm_idx_to_out_elem_off_val.emplace(vmm_idx,
+                        i_load * i_load_shift + i_ur * i_ur_shift);
+                rhs_arg_params.vmm_idx_to_out_off_oprnd.emplace(
+                        vmm_idx, out_off_oprnd);
+                if (mask_flag) rhs_arg_params.vmm_tail_idx_.emplace(vmm_idx);
+            }
+        }
+
+        const injector_utils::register_preserve_guard_t register_guard(
+                this, {abi_param1, oc_off_oprnd, out_off_oprnd});
+        const size_t reg_guard_stack_occupied
+                = register_guard.stack_space_occupied();
+        mov(abi_param1,
+                ptr[rsp + reg_abi_param1_backup + reg_guard_stack_occupied]);
+        mov(oc_off_oprnd,
+                ptr[rsp + reg_binary_post_op_acc_off
+                        + reg_guard_stack_occupied]);
+        mov(out_off_oprnd, aux_reg_output_data);
+        sub(out_off_oprnd, ptr[param1 + GET_OFF(dst_orig)]);
+        shr(out_off_oprnd, std::log2(jcp.typesize_out));
+
+        postops_injector_->compute_vector_range(vmm_idxs, rhs_arg_params);
+    } else {
+        for (int i = 0; i < ur * load_loop_blk; ++i)
+            vmm_idxs.emplace(i);
+        postops_injector_->compute_vector_range(vmm_idxs);
+    }
+}
+
 void jit_avx512_common_1x1_conv_kernel::reduce_loop(
         int load_loop_blk, int ur, int substep, bool wraparound) {
     const bool out_layout_nxc = is_out_layout_nxc(jcp);
@@ -280,14 +364,14 @@ void jit_avx512_common_1x1_conv_kernel::reduce_loop(
             }
 
         L(store_noadd);
-        if (jcp.with_eltwise) {
-            Label store_noeltwise;
+        if (jcp.with_eltwise || jcp.with_binary) {
+            Label store_nopostops;
             test(reg_reduce_pos_flag, FLAG_REDUCE_LAST);
-            jz(store_noeltwise, T_NEAR);
+            jz(store_nopostops, T_NEAR);
 
-            eltwise_injector_->compute_vector_range(0, ur * load_loop_blk);
+            apply_postops(load_loop_blk, ur);
 
-            L(store_noeltwise);
+            L(store_nopostops);
         }
 
         auto store_output = [=](bool output_is_aligned) {
@@ -512,6 +596,12 @@ void jit_avx512_common_1x1_conv_kernel::generate() {
     mov(reg_output_data, ptr[param1 + GET_OFF(output_data)]);
 
     sub(rsp, stack_space_needed);
+    if (jcp.with_binary) {
+        const auto zeroed_reg = r15;
+        xor_(zeroed_reg, zeroed_reg);
+        mov(EVEX_compress_addr(rsp, reg_binary_post_op_acc_off), zeroed_reg);
+        mov(EVEX_compress_addr(rsp, reg_abi_param1_backup), abi_param1);
+    }
 
     if (jcp.with_bias) mov(reg_bias_data, ptr[param1 + GET_OFF(bias_data)]);
 
@@ -557,6 +647,15 @@ void jit_avx512_common_1x1_conv_kernel::generate() {
                                                 : (jcp.with_dw_conv
                                                                 ? jcp.ow
                                                                 : jcp.bcast_dim)));
+                if (jcp.with_binary) {
+                    const auto oc_off_oprnd = aux_reg_load_data;
+                    mov(oc_off_oprnd,
+                            EVEX_compress_addr(
+                                    rsp, reg_binary_post_op_acc_off));
+                    add(oc_off_oprnd, jcp.load_block * load_loop_blk);
+                    mov(EVEX_compress_addr(rsp, reg_binary_post_op_acc_off),
+                            oc_off_oprnd);
+                }
                 break;
             case backward_data:
                 add(reg_output_data,
@@ -634,32 +733,32 @@ void jit_avx512_common_1x1_conv_kernel::generate() {
 
     postamble();
 
-    if (jcp.with_eltwise) eltwise_injector_->prepare_table();
+    if (jcp.with_eltwise) postops_injector_->prepare_table();
 }
 
-bool jit_avx512_common_1x1_conv_kernel::post_ops_ok(
-        jit_1x1_conv_conf_t &jcp, const primitive_attr_t &attr) {
+bool jit_avx512_common_1x1_conv_kernel::post_ops_ok(jit_1x1_conv_conf_t &jcp,
+        const primitive_attr_t &attr, const memory_desc_wrapper &dst_d) {
     const auto &p = attr.post_ops_;
 
     auto is_eltwise = [&](int idx) { return p.entry_[idx].is_eltwise(); };
-    auto is_sum = [&](int idx) { return p.entry_[idx].is_sum(); };
     auto is_convolution
             = [&](int idx) { return p.entry_[idx].is_convolution(); };
 
     int dw_idx = p.find(primitive_kind::convolution);
-    int len = dw_idx != -1 ? dw_idx + 1 : p.len();
-
-    switch (len) {
-        case 0: return true; // no post_ops
-        case 1: // eltwise OR sum OR Convolution
-            return is_eltwise(0) || is_sum(0) || is_convolution(0);
-        case 2: // sum -> eltwise OR eltwise -> convolution
-            return (is_sum(0) && is_eltwise(1))
-                    || (is_eltwise(0) && is_convolution(1));
-        default: return false;
+    if (dw_idx != -1) {
+        // only a single eltwise may precede the fused depthwise convolution
+        switch (dw_idx) {
+            case 0: return is_convolution(0);
+            case 1: return is_eltwise(0) && is_convolution(1);
+            default: return false;
+        }
     }
 
-    return false;
+    using namespace injector;
+    static constexpr bool sum_at_pos_0_only = true;
+    static constexpr bool sum_requires_scale_one = true;
+    return injector::post_ops_ok({avx512_common, {eltwise, binary, sum}, p,
+            &dst_d, sum_at_pos_0_only, sum_requires_scale_one});
 }
 
 status_t jit_avx512_common_1x1_conv_kernel::init_conf(jit_1x1_conv_conf_t &jcp,
@@ -711,7 +810,7 @@ status_t jit_avx512_common_1x1_conv_kernel::init_conf(jit_1x1_conv_conf_t &jcp,
     jcp.is = jcp.id * jcp.ih * jcp.iw;
     jcp.tr_is = rnd_up(jcp.is, 4);
 
-    if (!post_ops_ok(jcp, attr)) return status::unimplemented;
+    if (!post_ops_ok(jcp, attr, dst_d)) return status::unimplemented;
 
     const auto &p = attr.post_ops_;
     const int dw_conv_ind = p.find(primitive_kind::convolution);
@@ -725,6 +824,15 @@ status_t jit_avx512_common_1x1_conv_kernel::init_conf(jit_1x1_conv_conf_t &jcp,
         jcp.eltwise = p.entry_[eltwise_ind].eltwise;
         if (dst_d.data_type() == data_type::s32) return status::unimplemented;
     }
+    jcp.with_binary = p.find(primitive_kind::binary, 0, dw_conv_ind) != -1;
+    if (jcp.with_binary && jcp.with_dw_conv) return status::unimplemented;
+    if (jcp.with_dw_conv) {
+        // dw_conv and post_ops after it are handled externally, so skip them
+        jcp.post_ops.entry_.assign(
+                p.entry_.cbegin(), p.entry_.cbegin() + dw_conv_ind);
+    } else {
+        jcp.post_ops = p;
+    }
 
     const auto dat_tag_nxc = pick(ndims - 3, nwc, nhwc, ndhwc);
     const auto dat_tag_nCx16c = pick(ndims - 3, nCw16c, nChw16c, nCdhw16c);
@@ -742,6 +850,9 @@ status_t jit_avx512_common_1x1_conv_kernel::init_conf(jit_1x1_conv_conf_t &jcp,
         jcp.oc = rnd_up(jcp.oc, simd_w);
         jcp.ic = rnd_up(jcp.ic, simd_w);
     }
+    // the channels padded in the blocked layout have no rhs values to load
+    if (jcp.with_binary && jcp.oc != jcp.oc_without_padding)
+        return status::unimplemented;
 
     bool args_ok = true && jcp.ngroups == 1 && jcp.src_tag == required_dat_tag
             && jcp.dst_tag == required_dat_tag
@@ -19,6 +19,7 @@
 #include "common/type_helpers.hpp"
 #include "common/utils.hpp"
 
+#include "cpu/x64/injectors/jit_uni_binary_injector.hpp"
 #include "cpu/x64/jit_generator.hpp"
 
 #include "cpu/x64/jit_avx512_common_1x1_convolution.hpp"
@@ -41,12 +42,21 @@ using namespace dnnl::impl::utils;
 template <data_type_t src_type, data_type_t wei_type, data_type_t dst_type>
 void jit_avx512_common_1x1_convolution_fwd_t<src_type, wei_type,
         dst_type>::execute_forward(const exec_ctx_t &ctx) const {
-    auto src = CTX_IN_MEM(const src_data_t *, DNNL_ARG_SRC);
     auto weights = CTX_IN_MEM(const wei_data_t *, DNNL_ARG_WEIGHTS);
     auto bias = CTX_IN_MEM(const dst_data_t *, DNNL_ARG_BIAS);
     auto dst = CTX_OUT_MEM(dst_data_t *, DNNL_ARG_DST);
     auto weights_dw = CTX_IN_MEM(
             const wei_data_t *, DNNL_ARG_ATTR_POST_OP_DW | DNNL_ARG_WEIGHTS);
+
+    // with the src concat, the src is read from several memory objects
+    std::vector<const src_data_t *> srcs;
+    if (pd()->with_src_concat()) {
+        for (int i = 0; i < pd()->n_src_concat(); ++i)
+            srcs.push_back(CTX_IN_MEM(
+                    const src_data_t *, DNNL_ARG_MULTIPLE_SRC + i));
+    } else {
+        srcs.push_back(CTX_IN_MEM(const src_data_t *, DNNL_ARG_SRC));
+    }
     auto bias_dw = CTX_IN_MEM(
             const dst_data_t *, DNNL_ARG_ATTR_POST_OP_DW | DNNL_ARG_BIAS);
 
@@ -62,9 +72,12 @@ void jit_avx512_common_1x1_convolution_fwd_t<src_type, wei_type,
         bias = padded_bias;
     }
 
+    const auto post_ops_binary_rhs_arg_vec
+            = binary_injector::prepare_binary_args(jcp.post_ops, ctx);
+
     parallel(jcp.nthr, [&](const int ithr, const int nthr) {
-        execute_forward_thr(ithr, nthr, src, weights, bias, weights_dw, bias_dw,
-                dst, scratchpad);
+        execute_forward_thr(ithr, nthr, srcs.data(), weights, bias, weights_dw,
+                bias_dw, dst, scratchpad, post_ops_binary_rhs_arg_vec.data());
     });
 
     if (pd()->wants_zero_pad_dst()) ctx.memory(DNNL_ARG_DST)->zero_pad(ctx);
@@ -73,10 +86,11 @@ void jit_avx512_common_1x1_convolution_fwd_t<src_type, wei_type,
 template <data_type_t src_type, data_type_t wei_type, data_type_t dst_type>
 void jit_avx512_common_1x1_convolution_fwd_t<src_type, wei_type,
         dst_type>::execute_forward_thr(const int ithr, const int nthr,
-        const src_data_t *src, const wei_data_t *weights,
+        const src_data_t *const *srcs, const wei_data_t *weights,
         const dst_data_t *bias, const wei_data_t *weights_dw,
         const dst_data_t *bias_dw, dst_data_t *dst,
-        const memory_tracking::grantor_t &scratchpad) const {
+        const memory_tracking::grantor_t &scratchpad,
+        const void *post_ops_binary_rhs_arg_vec) const {
     const memory_desc_wrapper src_d(pd()->src_md());
     const memory_desc_wrapper dst_d(pd()->dst_md());
     const memory_desc_wrapper weights_d(pd()->weights_md(0));
@@ -129,6 +143,23 @@ void jit_avx512_common_1x1_convolution_fwd_t<src_type, wei_type,
     std::vector<dst_data_t *> addrs;
     // End
 
+    // Returns the address of the src point that holds the input channels of
+    // the block ic_off_idx. With the src concat, it is looked up in the
+    // source that holds the block, no reduction chunk spans two sources.
+    auto src_addr = [&](int n, int ic_off_idx, int id, int ih, int iw) {
+        if (!pd()->with_src_concat())
+            return srcs[0] + data_blk_off(src_d, n, ic_off_idx, id, ih, iw);
+        int isrc = 0;
+        for (;; ++isrc) {
+            const int nb_ic_src = pd()->src_concat_md(isrc)->dims[1]
+                    / jcp.ic_block;
+            if (ic_off_idx < nb_ic_src) break;
+            ic_off_idx -= nb_ic_src;
+        }
+        const memory_desc_wrapper src_i_d(pd()->src_concat_md(isrc));
+        return srcs[isrc] + data_blk_off(src_i_d, n, ic_off_idx, id, ih, iw);
+    };
+
     auto init_bcast = [&](int iwork, int bcast_end, int &n, int &g,
                               int &bcast_step, int &od, int &oh, int &ow,
                               int &id, int &ih, int &iw) {
@@ -184,6 +215,9 @@ void jit_avx512_common_1x1_convolution_fwd_t<src_type, wei_type,
                                          : &dst[dst_off];
         p.bias_data
                 = &bias[oc_off_idx * (is_dst_layout_nxc ? 1 : jcp.oc_block)];
+        p.oc_l_off = g * jcp.oc + ocb * jcp.oc_block;
+        p.post_ops_binary_rhs_arg_vec = post_ops_binary_rhs_arg_vec;
+        p.dst_orig = dst;
 
         p.load_data
                 = &weights[pd()->with_groups() ? weights_d.blk_off(g, ocb, icb)
@@ -198,12 +232,12 @@ void jit_avx512_common_1x1_convolution_fwd_t<src_type, wei_type,
                     + (is_src_layout_nxc ? ic_off_idx
                                          : jcp.is * ic_off_idx * jcp.ic_block);
             if (ocb == ocb_start) {
-                rp.src = src + data_blk_off(src_d, n, ic_off_idx, id, ih, iw);
+                rp.src = src_addr(n, ic_off_idx, id, ih, iw);
                 (*rtus_driver_)(&rp);
             }
             p.bcast_data = rp.ws;
         } else
-            p.bcast_data = src + data_blk_off(src_d, n, ic_off_idx, id, ih, iw);
+            p.bcast_data = src_addr(n, ic_off_idx, id, ih, iw);
 
         (*kernel_)(&p);
     };
@@ -573,7 +607,8 @@ template struct jit_avx512_common_1x1_convolution_bwd_data_t<data_type::f32>;
 status_t jit_avx512_common_1x1_convolution_bwd_weights_t ::init(
         engine_t *engine) {
     CHECK(safe_ptr_assign(kernel_,
-            new jit_avx512_common_1x1_conv_kernel(pd()->jcp_, *pd()->attr())));
+            new jit_avx512_common_1x1_conv_kernel(
+                    pd()->jcp_, *pd()->attr(), *pd()->dst_md(0))));
     CHECK(safe_ptr_assign(
             acc_ker_, new cpu_accumulator_1d_t<data_type::f32>()));
     CHECK(safe_ptr_assign(reducer_bias_,
@@ -58,14 +58,17 @@ struct jit_avx512_common_1x1_convolution_fwd_t : public primitive_t {
 
         status_t init(engine_t *engine) {
             using namespace utils;
-            bool ok = true && is_fwd()
-                    && set_default_alg_kind(alg_kind::convolution_direct)
-                    && expect_data_types(src_type, wei_type, dst_type, dst_type,
-                            data_type::undef)
-                    && attr()->has_default_values(
-                            primitive_attr_t::skip_mask_t::post_ops, dst_type)
-                    && !has_zero_dim_memory() && set_default_formats();
-            if (!ok) return status::unimplemented;
+            using smask_t = primitive_attr_t::skip_mask_t;
+            VDISPATCH(is_fwd(), prop_kind);
+            VDISPATCH(set_default_alg_kind(alg_kind::convolution_direct),
+                    alg_kind);
+            VDISPATCH(expect_data_types(src_type, wei_type, dst_type, dst_type,
+                            data_type::undef), data_type);
+            VDISPATCH(attr()->has_default_values(
+                            smask_t::post_ops | smask_t::src_concat, dst_type),
+                    attr);
+            VDISPATCH(!has_zero_dim_memory(), zero_dim);
+            VDISPATCH(set_default_formats(), format);
 
             const convolution_desc_t *conv_d = desc();
             const memory_desc_t *src_d = src_md();
@@ -76,6 +79,11 @@ struct jit_avx512_common_1x1_convolution_fwd_t : public primitive_t {
                     dnnl_get_max_threads(), rtus_.reduce_src_);
             if (status != status::success) return status;
 
+            if (with_src_concat()) {
+                status = src_concat_init();
+                if (status != status::success) return status;
+            }
+
             if (jcp_.with_dw_conv) {
                 status = depthwise_po_init(engine);
                 if (status != status::success) return status;
@@ -135,6 +143,29 @@ struct jit_avx512_common_1x1_convolution_fwd_t : public primitive_t {
             return set_default_formats_common(dat_tag, wei_tag, dat_tag);
         }
 
+        // The sources are read in place: each chunk of input channels the
+        // kernel reduces over must come from a single source, hence every
+        // source must hold a whole number of reduction chunks.
+        status_t src_concat_init() {
+            using namespace format_tag;
+            const auto dat_tag = utils::pick(ndims() - 3, nCw16c, nChw16c,
+                    nCdhw16c);
+            const bool ok = jcp_.src_tag == dat_tag && jcp_.ngroups == 1
+                    && !jcp_.with_dw_conv;
+            if (!ok) return status::unimplemented;
+
+            int nb_chunk = jcp_.nb_reduce_blocking;
+            for (int i = 0; i < n_src_concat(); ++i) {
+                const dim_t channels = attr()->src_concat_.channels_[i];
+                if (channels % jcp_.ic_block != 0) return status::unimplemented;
+                nb_chunk = math::gcd(
+                        nb_chunk, (int)(channels / jcp_.ic_block));
+            }
+            jcp_.nb_reduce_blocking = nb_chunk;
+
+            return init_src_concat_mds();
+        }
+
         status_t copy(const pd_t &other) {
             jcp_ = other.jcp_;
             rtus_ = other.rtus_;
@@ -209,6 +240,8 @@ struct jit_avx512_common_1x1_convolution_fwd_t : public primitive_t {
             while (jcp_1x1.nb_load % jcp_1x1.nb_load_blocking != 0)
                 --jcp_1x1.nb_load_blocking;
             jcp_1x1.nb_load_blocking_max = jcp_1x1.nb_load_blocking;
+            fit_dw_conv_buffer_to_l2(jcp_1x1, jcp_dw.kh, jcp_dw.iw,
+                    types::data_type_size(dw_conv_pd_->src_md()->data_type));
 
             while (jcp_1x1.nb_load_blocking % jcp_dw.nb_ch_blocking != 0)
                 --jcp_dw.nb_ch_blocking;
@@ -248,7 +281,7 @@ struct jit_avx512_common_1x1_convolution_fwd_t : public primitive_t {
     status_t init(engine_t *engine) override {
         CHECK(safe_ptr_assign(kernel_,
                 new jit_avx512_common_1x1_conv_kernel(
-                        pd()->jcp_, *pd()->attr())));
+                        pd()->jcp_, *pd()->attr(), *pd()->dst_md(0))));
         CHECK(kernel_->create_kernel());
 
         if (pd()->jcp_.with_dw_conv) {
@@ -270,10 +303,11 @@ struct jit_avx512_common_1x1_convolution_fwd_t : public primitive_t {
 private:
     void execute_forward(const exec_ctx_t &ctx) const;
     void execute_forward_thr(const int ithr, const int nthr,
-            const src_data_t *src, const wei_data_t *weights,
+            const src_data_t *const *srcs, const wei_data_t *weights,
             const dst_data_t *bias, const wei_data_t *weights_dw,
             const dst_data_t *bias_dw, dst_data_t *dst,
-            const memory_tracking::grantor_t &scratchpad) const;
+            const memory_tracking::grantor_t &scratchpad,
+            const void *post_ops_binary_rhs_arg_vec) const;
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
 
     std::unique_ptr<jit_avx512_common_1x1_conv_kernel> kernel_;
@@ -300,13 +334,15 @@ struct jit_avx512_common_1x1_convolution_bwd_data_t : public primitive_t {
                 jit_avx512_common_1x1_convolution_bwd_data_t);
 
         status_t init(engine_t *engine) {
-            bool ok = true && desc()->prop_kind == prop_kind::backward_data
-                    && set_default_alg_kind(alg_kind::convolution_direct)
-                    && expect_data_types(diff_src_type, wei_type,
-                            data_type::undef, diff_dst_type, data_type::undef)
-                    && attr()->has_default_values() && !has_zero_dim_memory()
-                    && set_default_formats();
-            if (!ok) return status::unimplemented;
+            VDISPATCH(desc()->prop_kind == prop_kind::backward_data, prop_kind);
+            VDISPATCH(set_default_alg_kind(alg_kind::convolution_direct),
+                    alg_kind);
+            VDISPATCH(expect_data_types(diff_src_type, wei_type,
+                            data_type::undef, diff_dst_type, data_type::undef),
+                    data_type);
+            VDISPATCH(attr()->has_default_values(), attr);
+            VDISPATCH(!has_zero_dim_memory(), zero_dim);
+            VDISPATCH(set_default_formats(), format);
 
             const convolution_desc_t *conv_d = desc();
             const memory_desc_t *diff_src_d = diff_src_md();
@@ -356,7 +392,7 @@ struct jit_avx512_common_1x1_convolution_bwd_data_t : public primitive_t {
     status_t init(engine_t *engine) override {
         CHECK(safe_ptr_assign(kernel_,
                 new jit_avx512_common_1x1_conv_kernel(
-                        pd()->jcp_, *pd()->attr())));
+                        pd()->jcp_, *pd()->attr(), *pd()->dst_md(0))));
         CHECK(kernel_->create_kernel());
         CHECK(init_rtus_driver<avx512_common>(this));
         return status::success;
@@ -390,13 +426,16 @@ struct jit_avx512_common_1x1_convolution_bwd_weights_t : public primitive_t {
                 jit_avx512_common_1x1_convolution_bwd_weights_t);
 
         status_t init(engine_t *engine) {
-            bool ok = true && desc()->prop_kind == prop_kind::backward_weights
-                    && set_default_alg_kind(alg_kind::convolution_direct)
-                    && expect_data_types(data_type::f32, data_type::f32,
-                            data_type::f32, data_type::f32, data_type::f32)
-                    && attr()->has_default_values() && !has_zero_dim_memory()
-                    && set_default_formats();
-            if (!ok) return status::unimplemented;
+            VDISPATCH(desc()->prop_kind == prop_kind::backward_weights,
+                    prop_kind);
+            VDISPATCH(set_default_alg_kind(alg_kind::convolution_direct),
+                    alg_kind);
+            VDISPATCH(expect_data_types(data_type::f32, data_type::f32,
+                            data_type::f32, data_type::f32, data_type::f32),
+                    data_type);
+            VDISPATCH(attr()->has_default_values(), attr);
+            VDISPATCH(!has_zero_dim_memory(), zero_dim);
+            VDISPATCH(set_default_formats(), format);
 
             const convolution_desc_t *conv_d = desc();
             const memory_desc_t *src_d = src_md();
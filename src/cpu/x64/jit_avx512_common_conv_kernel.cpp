@@ -15,6 +15,7 @@
 *******************************************************************************/
 
 #include "common/c_types_map.hpp"
+#include "common/eltwise_pd.hpp"
 #include "common/nstl.hpp"
 #include "common/type_helpers.hpp"
 #include "common/utils.hpp"
@@ -92,6 +93,32 @@ inline bool is_owb_prefetching(const jit_conv_conf_t &jcp) {
 
 } // namespace
 
+template <typename Vmm>
+_jit_avx512_common_conv_fwd_kernel<Vmm>::_jit_avx512_common_conv_fwd_kernel(
+        const jit_conv_conf_t &ajcp, const primitive_attr_t &attr,
+        const memory_desc_t &dst_md)
+    : jcp(ajcp), attr_(attr) {
+    if (jcp.with_eltwise || jcp.with_binary) {
+        using namespace binary_injector;
+        static constexpr bool preserve_gpr = true;
+        static constexpr bool preserve_vmm = false;
+        static constexpr size_t helper_vmm_idx = 31;
+        static constexpr bool use_exact_tail_scalar_bcast = false;
+        const size_t tail_size = jcp.oc_tail;
+
+        rhs_arg_static_params_t rhs_arg_static_params {helper_vmm_idx, r13, r14,
+                preserve_gpr, preserve_vmm,
+                GET_OFF(post_ops_binary_rhs_arg_vec),
+                memory_desc_wrapper(dst_md), tail_size, k_oc_tail_mask,
+                use_exact_tail_scalar_bcast};
+        static_params_t static_params {this->param1, rhs_arg_static_params};
+
+        postops_injector_ = utils::make_unique<
+                injector::jit_uni_postops_injector_t<avx512_common>>(
+                this, jcp.post_ops, static_params);
+    }
+}
+
 template <typename Vmm>
 void _jit_avx512_common_conv_fwd_kernel<Vmm>::prepare_output(int ur_w) {
     for (int k = 0; k < jcp.nb_oc_blocking; k++)
@@ -106,9 +133,52 @@ void _jit_avx512_common_conv_fwd_kernel<Vmm>::prepare_output(int ur_w) {
         }
 }
 
+template <typename Vmm>
+void _jit_avx512_common_conv_fwd_kernel<Vmm>::apply_postops(int ur_w) {
+    injector_utils::vmm_index_set_t vmm_idxs;
+    if (jcp.with_binary) {
+        binary_injector::rhs_arg_dynamic_params_t rhs_arg_params;
+        const auto temp_offset_reg = reg_ker_prf;
+        const int oc_tail = jcp.oc_tail;
+        for (int k = 0; k < jcp.nb_oc_blocking; k++) {
+            // with oc tail the mask is all 1's unless it is the last block
+            const bool mask_flag = oc_tail && k + 1 == jcp.nb_oc_blocking;
+            for (int j = 0; j < ur_w; j++) {
+                const size_t aux_output_offset
+                        = get_output_offset(j, k) / jcp.typesize_out;
+                const int vmm_idx = vmm_out(j, k).getIdx();
+                vmm_idxs.emplace(vmm_idx);
+
+                rhs_arg_params.vmm_idx_to_oc_elem_off_addr.emplace(
+                        vmm_idx, ptr[param1 + GET_OFF(oc_l_off)]);
+                rhs_arg_params.vmm_idx_to_oc_elem_off_val.emplace(
+                        vmm_idx, k * jcp.oc_block);
+                rhs_arg_params.vmm_idx_to_out_elem_off_val.emplace(
+                        vmm_idx, aux_output_offset);
+                rhs_arg_params.vmm_idx_to_out_off_oprnd.emplace(
+                        vmm_idx, temp_offset_reg);
+                if (mask_flag) rhs_arg_params.vmm_tail_idx_.emplace(vmm_idx);
+            }
+        }
+
+        const injector_utils::register_preserve_guard_t register_guard(
+                this, {temp_offset_reg});
+        mov(temp_offset_reg, reg_out);
+        sub(temp_offset_reg, ptr[param1 + GET_OFF(dst_orig)]);
+        shr(temp_offset_reg, std::log2(sizeof(float)));
+
+        postops_injector_->compute_vector_range(vmm_idxs, rhs_arg_params);
+    } else {
+        for (int k = 0; k < jcp.nb_oc_blocking; k++)
+            for (int j = 0; j < ur_w; j++)
+                vmm_idxs.emplace(vmm_out(j, k).getIdx());
+        postops_injector_->compute_vector_range(vmm_idxs);
+    }
+}
+
 template <typename Vmm>
 void _jit_avx512_common_conv_fwd_kernel<Vmm>::store_output(int ur_w) {
-    Label no_update_label, store_label, eltwise_label;
+    Label no_update_label, store_label, post_ops_label;
 
     // Note 1: the following code has conditions that fix a regression
     // in Densenet
@@ -154,7 +224,7 @@ void _jit_avx512_common_conv_fwd_kernel<Vmm>::store_output(int ur_w) {
         }
 
     if (!jcp.with_sum) {
-        jmp(eltwise_label, T_NEAR);
+        jmp(post_ops_label, T_NEAR);
     } else {
         auto _jmp = [&](const Label &l) {
             return mayiuse(avx512_mic) ? jne(l, T_NEAR) : jz(l, T_NEAR);
@@ -162,7 +232,7 @@ void _jit_avx512_common_conv_fwd_kernel<Vmm>::store_output(int ur_w) {
 
         // *Note 1
         _test(mayiuse(avx512_mic) ? 0 : FLAG_IC_FIRST);
-        _jmp(eltwise_label);
+        _jmp(post_ops_label);
     }
 
     L(no_update_label);
@@ -180,8 +250,8 @@ void _jit_avx512_common_conv_fwd_kernel<Vmm>::store_output(int ur_w) {
         }
     }
 
-    L(eltwise_label);
-    if (jcp.with_eltwise) {
+    L(post_ops_label);
+    if (jcp.with_eltwise || jcp.with_binary) {
         auto _jmp = [&](const Label &l) {
             return mayiuse(avx512_mic) ? jl(l, T_NEAR) : jz(l, T_NEAR);
         };
@@ -190,7 +260,21 @@ void _jit_avx512_common_conv_fwd_kernel<Vmm>::store_output(int ur_w) {
         _test(mayiuse(avx512_mic) ? jcp.nb_ic - 1 : FLAG_IC_LAST);
         _jmp(store_label);
 
-        eltwise_injector_->compute_vector_range(0, jcp.nb_oc_blocking * ur_w);
+        apply_postops(ur_w);
+
+        if (jcp.zero_pad_dst_in_kernel) {
+            // Only the last oc block of the last oc chunk has padded channels
+            Label no_padded_oc_label;
+            const int last_oc_l_off
+                    = (jcp.nb_oc - jcp.nb_oc_blocking) * jcp.oc_block;
+            cmp(qword[param1 + GET_OFF(oc_l_off)], last_oc_l_off);
+            jne(no_padded_oc_label, T_NEAR);
+            for (int j = 0; j < ur_w; j++) {
+                Vmm vmm = vmm_out(j, jcp.nb_oc_blocking - 1);
+                vmovups(vmm | k_oc_tail_mask | T_z, vmm);
+            }
+            L(no_padded_oc_label);
+        }
     }
 
     L(store_label);
@@ -1039,6 +1123,11 @@ void _jit_avx512_common_conv_fwd_kernel<Vmm>::generate() {
         mov(reg_tail_32, (1 << oc_tail) - 1);
         kmovw(k_oc_tail_mask, reg_tail_32);
         L(done);
+    } else if (jcp.zero_pad_dst_in_kernel) {
+        // blocked dst only: the mask selects the unpadded channels
+        Reg32 reg_tail_32 = reg_tail.cvt32();
+        mov(reg_tail_32, (1 << (jcp.oc_without_padding % jcp.oc_block)) - 1);
+        kmovw(k_oc_tail_mask, reg_tail_32);
     }
 
     int r_pad = nstl::max(0, jcp.r_pad);
@@ -1235,24 +1324,16 @@ void _jit_avx512_common_conv_fwd_kernel<Vmm>::generate() {
     }
     postamble();
 
-    if (jcp.with_eltwise) eltwise_injector_->prepare_table();
+    if (jcp.with_eltwise) postops_injector_->prepare_table();
 }
 
-bool jit_avx512_common_conv_fwd_kernel::post_ops_ok(
-        jit_conv_conf_t &jcp, const primitive_attr_t &attr) {
-    const auto &p = attr.post_ops_;
-
-    auto is_eltwise = [&](int idx) { return p.entry_[idx].is_eltwise(); };
-    auto is_sum = [&](int idx) { return p.entry_[idx].is_sum(); };
-
-    switch (p.len()) {
-        case 0: return true; // no post_ops
-        case 1: return is_eltwise(0) || is_sum(0); // sum OR eltwise
-        case 2: return is_sum(0) && is_eltwise(1); // sum -> eltwise
-        default: return false;
-    }
-
-    return false;
+bool jit_avx512_common_conv_fwd_kernel::post_ops_ok(jit_conv_conf_t &jcp,
+        const primitive_attr_t &attr, const memory_desc_wrapper &dst_d) {
+    using namespace injector;
+    static constexpr bool sum_at_pos_0_only = true;
+    static constexpr bool sum_requires_scale_one = true;
+    return injector::post_ops_ok({avx512_common, {eltwise, binary, sum},
+            attr.post_ops_, &dst_d, sum_at_pos_0_only, sum_requires_scale_one});
 }
 
 status_t jit_avx512_common_conv_fwd_kernel::init_conf(jit_conv_conf_t &jcp,
@@ -1367,7 +1448,7 @@ status_t jit_avx512_common_conv_fwd_kernel::init_conf(jit_conv_conf_t &jcp,
     jcp.ic_tail = is_data_layout_nxc ? jcp.ic % jcp.simd_w : 0;
     jcp.oc_tail = is_data_layout_nxc ? jcp.oc % jcp.simd_w : 0;
 
-    if (!post_ops_ok(jcp, attr)) return status::unimplemented;
+    if (!post_ops_ok(jcp, attr, dst_d)) return status::unimplemented;
 
     const auto &p = attr.post_ops_;
     jcp.with_sum = p.find(primitive_kind::sum) != -1;
@@ -1377,6 +1458,21 @@ status_t jit_avx512_common_conv_fwd_kernel::init_conf(jit_conv_conf_t &jcp,
         jcp.eltwise = p.entry_[eltwise_ind].eltwise;
         if (dst_d.data_type() == data_type::s32) return status::unimplemented;
     }
+    jcp.with_binary = p.find(primitive_kind::binary) != -1;
+    jcp.post_ops = p;
+    // Zeroing the padded channels while they are still in registers saves
+    // the pass over the whole dst that the primitive would do otherwise.
+    jcp.zero_pad_dst_in_kernel = jcp.with_eltwise && !is_data_layout_nxc
+            && jcp.oc != jcp.oc_without_padding
+            && !eltwise_fwd_pd_t::eltwise_preserves_zero(
+                    jcp.eltwise.alg, jcp.eltwise.alpha, jcp.eltwise.beta);
+    // The binary injector works on full zmm registers, and the channels padded
+    // in the blocked layout have no rhs values to load.
+    if (jcp.with_binary
+            && (jcp.oc_block != full_simd_w
+                    || IMPLICATION(!is_data_layout_nxc,
+                            jcp.oc_without_padding % jcp.oc_block != 0)))
+        return status::unimplemented;
 
     format_tag_t src_tag, dst_tag, wei_tag;
 
@@ -1815,6 +1911,32 @@ void jit_avx512_common_conv_fwd_kernel::init_scratchpad(
         scratchpad.book(key_conv_padded_bias, jcp.oc, jcp.typesize_out);
 }
 
+template <typename Vmm>
+_jit_avx512_common_conv_bwd_data_kernel_f32<Vmm>::
+        _jit_avx512_common_conv_bwd_data_kernel_f32(
+                const jit_conv_conf_t &ajcp, const memory_desc_t &diff_src_md)
+    : jcp(ajcp) {
+    if (jcp.with_eltwise || jcp.with_binary) {
+        using namespace binary_injector;
+        static constexpr bool preserve_gpr = true;
+        static constexpr bool preserve_vmm = false;
+        static constexpr size_t helper_vmm_idx = 31;
+        static constexpr bool use_exact_tail_scalar_bcast = false;
+        const size_t tail_size = jcp.ic_tail;
+
+        rhs_arg_static_params_t rhs_arg_static_params {helper_vmm_idx, r13, r14,
+                preserve_gpr, preserve_vmm,
+                GET_OFF(post_ops_binary_rhs_arg_vec),
+                memory_desc_wrapper(diff_src_md), tail_size, k_ic_tail_mask,
+                use_exact_tail_scalar_bcast};
+        static_params_t static_params {this->param1, rhs_arg_static_params};
+
+        postops_injector_ = utils::make_unique<
+                injector::jit_uni_postops_injector_t<avx512_common>>(
+                this, jcp.post_ops, static_params);
+    }
+}
+
 template <typename Vmm>
 void _jit_avx512_common_conv_bwd_data_kernel_f32<Vmm>::prepare_output(
         int ur_w) {
@@ -1829,14 +1951,65 @@ void _jit_avx512_common_conv_bwd_data_kernel_f32<Vmm>::prepare_output(
     }
 }
 
+template <typename Vmm>
+void _jit_avx512_common_conv_bwd_data_kernel_f32<Vmm>::apply_postops(
+        int ur_w) {
+    injector_utils::vmm_index_set_t vmm_idxs;
+    if (jcp.with_binary) {
+        binary_injector::rhs_arg_dynamic_params_t rhs_arg_params;
+        const auto temp_offset_reg = reg_ker_prf;
+        const int ic_tail = jcp.ic_tail;
+        for (int k = 0; k < jcp.nb_ic_blocking; k++) {
+            // with ic tail the mask is all 1's unless it is the last block
+            const bool mask_flag = ic_tail && k + 1 == jcp.nb_ic_blocking;
+            for (int j = 0; j < ur_w; j++) {
+                const size_t aux_src_offset
+                        = get_diff_src_offset(j, k) / typesize;
+                const int vmm_idx = vmm_out(j, k).getIdx();
+                vmm_idxs.emplace(vmm_idx);
+
+                // the channels of diff_src are the output channels of the
+                // post-ops
+                rhs_arg_params.vmm_idx_to_oc_elem_off_addr.emplace(
+                        vmm_idx, ptr[param1 + GET_OFF(oc_l_off)]);
+                rhs_arg_params.vmm_idx_to_oc_elem_off_val.emplace(
+                        vmm_idx, k * jcp.ic_block);
+                rhs_arg_params.vmm_idx_to_out_elem_off_val.emplace(
+                        vmm_idx, aux_src_offset);
+                rhs_arg_params.vmm_idx_to_out_off_oprnd.emplace(
+                        vmm_idx, temp_offset_reg);
+                if (mask_flag) rhs_arg_params.vmm_tail_idx_.emplace(vmm_idx);
+            }
+        }
+
+        const injector_utils::register_preserve_guard_t register_guard(
+                this, {temp_offset_reg});
+        mov(temp_offset_reg, reg_src);
+        sub(temp_offset_reg, ptr[param1 + GET_OFF(dst_orig)]);
+        shr(temp_offset_reg, std::log2(sizeof(float)));
+
+        postops_injector_->compute_vector_range(vmm_idxs, rhs_arg_params);
+    } else {
+        for (int k = 0; k < jcp.nb_ic_blocking; k++)
+            for (int j = 0; j < ur_w; j++)
+                vmm_idxs.emplace(vmm_out(j, k).getIdx());
+        postops_injector_->compute_vector_range(vmm_idxs);
+    }
+}
+
 template <typename Vmm>
 void _jit_avx512_common_conv_bwd_data_kernel_f32<Vmm>::store_output(int ur_w) {
-    Label no_update_label;
+    Label no_update_label, post_ops_label, store_label;
     const int ic_tail = jcp.ic_tail;
 
+    // The first chunk of output channels overwrites diff_src, unless it is
+    // accumulated on the previous values by the sum post-op. The bias is
+    // added once, by the first chunk.
     mov(reg_channel, ptr[param + GET_OFF(channel)]);
-    cmp(reg_channel, 0);
-    je(no_update_label, T_NEAR);
+    if (!jcp.with_sum) {
+        cmp(reg_channel, 0);
+        je(no_update_label, T_NEAR);
+    }
     for (int k = 0; k < jcp.nb_ic_blocking; k++) {
         for (int j = 0; j < ur_w; j++) {
             Vmm vmm = vmm_out(j, k);
@@ -1846,8 +2019,39 @@ void _jit_avx512_common_conv_bwd_data_kernel_f32<Vmm>::store_output(int ur_w) {
                             reg_src, aux_src_offset, reg_long_offt));
         }
     }
+    if (jcp.with_bias) {
+        if (jcp.with_sum) {
+            cmp(reg_channel, 0);
+            jne(post_ops_label, T_NEAR);
+        } else
+            jmp(post_ops_label, T_NEAR);
+    }
 
     L(no_update_label);
+    if (jcp.with_bias) {
+        mov(reg_bias, ptr[param + GET_OFF(bias)]);
+        for (int k = 0; k < jcp.nb_ic_blocking; k++) {
+            const int bias_offset = typesize * k * jcp.ic_block;
+            for (int j = 0; j < ur_w; j++) {
+                Vmm vmm = vmm_out(j, k);
+                // mask only needed for last ic_block
+                if (ic_tail && k + 1 == jcp.nb_ic_blocking)
+                    vmm = vmm | k_ic_tail_mask | T_z;
+                vaddps(vmm, EVEX_compress_addr(reg_bias, bias_offset));
+            }
+        }
+    }
+
+    L(post_ops_label);
+    if (jcp.with_eltwise || jcp.with_binary) {
+        // the post-ops are applied by the last chunk of output channels
+        mov(reg_channel, ptr[param + GET_OFF(flags)]);
+        test(reg_channel, FLAG_OC_LAST);
+        jz(store_label, T_NEAR);
+        apply_postops(ur_w);
+    }
+
+    L(store_label);
     for (int k = 0; k < jcp.nb_ic_blocking; k++) {
         for (int j = 0; j < ur_w; j++) {
             Vmm vmm = vmm_out(j, k);
@@ -2628,17 +2832,31 @@ void _jit_avx512_common_conv_bwd_data_kernel_f32<Vmm>::generate() {
     L(end_label);
 
     postamble();
+
+    if (jcp.with_eltwise) postops_injector_->prepare_table();
+}
+
+bool jit_avx512_common_conv_bwd_data_kernel_f32::post_ops_ok(
+        const primitive_attr_t &attr, const memory_desc_wrapper &diff_src_d) {
+    using namespace injector;
+    static constexpr bool sum_at_pos_0_only = true;
+    static constexpr bool sum_requires_scale_one = true;
+    return injector::post_ops_ok({avx512_common, {eltwise, binary, sum},
+            attr.post_ops_, &diff_src_d, sum_at_pos_0_only,
+            sum_requires_scale_one});
 }
 
 status_t jit_avx512_common_conv_bwd_data_kernel_f32::init_conf(
         jit_conv_conf_t &jcp, const convolution_desc_t &cd,
         memory_desc_t &diff_src_md, memory_desc_t &weights_md,
-        memory_desc_t &diff_dst_md, int nthreads) {
+        memory_desc_t &diff_dst_md, memory_desc_t &bias_md,
+        const primitive_attr_t &attr, int nthreads) {
     if (!mayiuse(avx512_common)) return status::unimplemented;
 
     const memory_desc_wrapper diff_src_d(&diff_src_md);
     const memory_desc_wrapper weights_d(&weights_md);
     const memory_desc_wrapper diff_dst_d(&diff_dst_md);
+    const memory_desc_wrapper bias_d(&bias_md);
     jcp = zero<decltype(jcp)>();
 
     const bool with_groups = weights_d.ndims() == diff_src_d.ndims() + 1;
@@ -2749,6 +2967,34 @@ status_t jit_avx512_common_conv_bwd_data_kernel_f32::init_conf(
     jcp.ic_tail = is_data_layout_nxc ? jcp.ic % jcp.simd_w : 0;
     jcp.oc_tail = is_data_layout_nxc ? jcp.oc % jcp.simd_w : 0;
 
+    // The bias and the post-ops are set by a deconvolution, whose destination
+    // is diff_src here.
+    jcp.with_bias = cd.bias_desc.format_kind != format_kind::undef;
+    if (jcp.with_bias) {
+        if (bias_d.format_kind() == format_kind::any)
+            CHECK(memory_desc_init_by_tag(bias_md, x));
+        if (bias_d.data_type() != data_type::f32) return status::unimplemented;
+    }
+
+    if (!post_ops_ok(attr, diff_src_d)) return status::unimplemented;
+
+    const auto &p = attr.post_ops_;
+    jcp.with_sum = p.find(primitive_kind::sum) != -1;
+    const int eltwise_ind = p.find(primitive_kind::eltwise);
+    jcp.with_eltwise = eltwise_ind != -1;
+    if (jcp.with_eltwise) jcp.eltwise = p.entry_[eltwise_ind].eltwise;
+    jcp.with_binary = p.find(primitive_kind::binary) != -1;
+    jcp.post_ops = p;
+    // The padded channels of the blocked layout must stay zero, and the
+    // binary injector works on full zmm registers.
+    const bool has_padded_ic = jcp.ic != jcp.ic_without_padding;
+    if (jcp.with_eltwise && has_padded_ic
+            && !eltwise_fwd_pd_t::eltwise_preserves_zero(
+                    jcp.eltwise.alg, jcp.eltwise.alpha, jcp.eltwise.beta))
+        return status::unimplemented;
+    if (jcp.with_binary && (jcp.ic_block != full_simd_w || has_padded_ic))
+        return status::unimplemented;
+
     format_tag_t dat_tag, wei_tag;
     const auto nxc_tag = pick(ndims - 3, nwc, nhwc, ndhwc);
 
@@ -3065,8 +3311,8 @@ status_t jit_avx512_common_conv_bwd_data_kernel_f32::init_conf(
 
 void jit_avx512_common_conv_bwd_data_kernel_f32::init_scratchpad(
         memory_tracking::registrar_t &scratchpad, const jit_conv_conf_t &jcp) {
-    UNUSED(scratchpad);
-    UNUSED(jcp);
+    if (jcp.with_bias && jcp.ic != jcp.ic_without_padding)
+        scratchpad.book(key_conv_padded_bias, jcp.ic, jcp.typesize_out);
 }
 
 // Initialize static data members
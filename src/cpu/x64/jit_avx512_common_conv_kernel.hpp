@@ -20,7 +20,7 @@
 #include "common/c_types_map.hpp"
 #include "common/memory_tracking.hpp"
 
-#include "cpu/x64/injectors/jit_uni_eltwise_injector.hpp"
+#include "cpu/x64/injectors/jit_uni_postops_injector.hpp"
 #include "cpu/x64/jit_generator.hpp"
 #include "cpu/x64/jit_primitive_conf.hpp"
 
@@ -32,15 +32,8 @@ namespace x64 {
 template <typename Vmm>
 struct _jit_avx512_common_conv_fwd_kernel : public jit_generator {
 
-    _jit_avx512_common_conv_fwd_kernel(
-            const jit_conv_conf_t &ajcp, const primitive_attr_t &attr)
-        : jcp(ajcp), attr_(attr), eltwise_injector_(nullptr) {
-        if (jcp.with_eltwise)
-            eltwise_injector_ = new jit_uni_eltwise_injector_f32<avx512_common>(
-                    this, jcp.eltwise);
-    }
-
-    ~_jit_avx512_common_conv_fwd_kernel() { delete eltwise_injector_; }
+    _jit_avx512_common_conv_fwd_kernel(const jit_conv_conf_t &ajcp,
+            const primitive_attr_t &attr, const memory_desc_t &dst_md);
 
     DECLARE_CPU_JIT_AUX_FUNCTIONS(_jit_avx512_common_conv_fwd_kernel)
 
@@ -113,9 +106,11 @@ private:
     Xbyak::Reg64 imm_addr64 = r15;
     Vmm vmm_wei = Vmm(31);
 
-    jit_uni_eltwise_injector_f32<avx512_common> *eltwise_injector_;
+    std::unique_ptr<injector::jit_uni_postops_injector_t<avx512_common>>
+            postops_injector_;
 
     inline void prepare_output(int ur_w);
+    inline void apply_postops(int ur_w);
     inline void store_output(int ur_w);
     inline void compute_loop_fma(int ur_w, int pad_l, int pad_r);
     inline void compute_loop_fma_core(int ur_w, int pad_l, int pad_r);
@@ -179,21 +174,21 @@ private:
 
 struct jit_avx512_common_conv_fwd_kernel {
 
-    jit_avx512_common_conv_fwd_kernel(
-            const jit_conv_conf_t &ajcp, const primitive_attr_t &attr)
+    jit_avx512_common_conv_fwd_kernel(const jit_conv_conf_t &ajcp,
+            const primitive_attr_t &attr, const memory_desc_t &dst_md)
         : kernel_(nullptr) {
         switch (ajcp.oc_block) {
             case 16:
                 kernel_ = new _jit_avx512_common_conv_fwd_kernel<Xbyak::Zmm>(
-                        ajcp, attr);
+                        ajcp, attr, dst_md);
                 return;
             case 8:
                 kernel_ = new _jit_avx512_common_conv_fwd_kernel<Xbyak::Ymm>(
-                        ajcp, attr);
+                        ajcp, attr, dst_md);
                 return;
             case 4:
                 kernel_ = new _jit_avx512_common_conv_fwd_kernel<Xbyak::Xmm>(
-                        ajcp, attr);
+                        ajcp, attr, dst_md);
                 return;
             default: assert(!"invalid channel blocking");
         }
@@ -205,7 +200,8 @@ struct jit_avx512_common_conv_fwd_kernel {
 
     enum { typesize = sizeof(float) };
 
-    static bool post_ops_ok(jit_conv_conf_t &jcp, const primitive_attr_t &attr);
+    static bool post_ops_ok(jit_conv_conf_t &jcp, const primitive_attr_t &attr,
+            const memory_desc_wrapper &dst_d);
     static status_t init_conf(jit_conv_conf_t &jcp,
             const convolution_desc_t &cd, memory_desc_t &src_pd,
             memory_desc_t &weights_pd, memory_desc_t &dst_pd,
@@ -225,8 +221,8 @@ private:
 template <typename Vmm>
 struct _jit_avx512_common_conv_bwd_data_kernel_f32 : public jit_generator {
 
-    _jit_avx512_common_conv_bwd_data_kernel_f32(const jit_conv_conf_t &ajcp)
-        : jcp(ajcp) {}
+    _jit_avx512_common_conv_bwd_data_kernel_f32(
+            const jit_conv_conf_t &ajcp, const memory_desc_t &diff_src_md);
 
     DECLARE_CPU_JIT_AUX_FUNCTIONS(_jit_avx512_common_conv_bwd_data_kernel_f32)
     jit_conv_conf_t jcp;
@@ -265,6 +261,7 @@ private:
     reg64_t reg_kh = abi_not_param1;
 
     reg64_t reg_channel = rsi;
+    reg64_t reg_bias = rdx;
 
     reg64_t reg_tmp = rbp;
     reg64_t reg_long_offt = r14;
@@ -291,7 +288,11 @@ private:
 
     Vmm vmm_wei = Vmm(31);
 
+    std::unique_ptr<injector::jit_uni_postops_injector_t<avx512_common>>
+            postops_injector_;
+
     inline void prepare_output(int ur_w);
+    inline void apply_postops(int ur_w);
     inline void store_output(int ur_w);
     inline void compute_loop_4fma(int ur_w, int l_overflow, int r_overflow);
     inline void compute_loop_fma(int ur_w, int l_overflow, int r_overflow);
@@ -353,20 +354,21 @@ private:
 
 struct jit_avx512_common_conv_bwd_data_kernel_f32 {
 
-    jit_avx512_common_conv_bwd_data_kernel_f32(const jit_conv_conf_t &ajcp)
+    jit_avx512_common_conv_bwd_data_kernel_f32(
+            const jit_conv_conf_t &ajcp, const memory_desc_t &diff_src_md)
         : kernel_(nullptr) {
         switch (ajcp.ic_block) {
             case 16:
                 kernel_ = new _jit_avx512_common_conv_bwd_data_kernel_f32<
-                        Xbyak::Zmm>(ajcp);
+                        Xbyak::Zmm>(ajcp, diff_src_md);
                 return;
             case 8:
                 kernel_ = new _jit_avx512_common_conv_bwd_data_kernel_f32<
-                        Xbyak::Ymm>(ajcp);
+                        Xbyak::Ymm>(ajcp, diff_src_md);
                 return;
             case 4:
                 kernel_ = new _jit_avx512_common_conv_bwd_data_kernel_f32<
-                        Xbyak::Xmm>(ajcp);
+                        Xbyak::Xmm>(ajcp, diff_src_md);
                 return;
             default: assert(!"invalid channel blocking");
         }
@@ -378,9 +380,12 @@ struct jit_avx512_common_conv_bwd_data_kernel_f32 {
 
     enum { typesize = sizeof(float) };
 
+    static bool post_ops_ok(const primitive_attr_t &attr,
+            const memory_desc_wrapper &diff_src_d);
     static status_t init_conf(jit_conv_conf_t &jcp,
             const convolution_desc_t &cd, memory_desc_t &diff_src_d,
-            memory_desc_t &weights_d, memory_desc_t &diff_dst_d, int nthreads);
+            memory_desc_t &weights_d, memory_desc_t &diff_dst_d,
+            memory_desc_t &bias_d, const primitive_attr_t &attr, int nthreads);
     static void init_scratchpad(memory_tracking::registrar_t &scratchpad,
             const jit_conv_conf_t &jcp);
 
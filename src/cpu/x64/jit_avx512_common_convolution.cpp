@@ -19,6 +19,7 @@
 #include "common/type_helpers.hpp"
 #include "common/utils.hpp"
 
+#include "cpu/x64/injectors/jit_uni_binary_injector.hpp"
 #include "cpu/x64/jit_avx512_common_convolution.hpp"
 
 namespace dnnl {
@@ -60,9 +61,10 @@ inline void jit_conv_ker_pipeline(const jit_conv_ker_t ker, jit_conv_call_s &p,
 inline void jit_conv_ker_pipeline_ow_thr(const jit_conv_ker_t ker,
         jit_conv_call_s &p, const void *src, const void *dst, const void *filt,
         const void *bias, int channel, int kh_padding, int owb, int reduce_work,
-        int load_work, int flags) {
+        int load_work, int flags, size_t oc_l_off = 0) {
     PIPELINE(owb);
     PIPELINE(flags);
+    PIPELINE(oc_l_off);
     jit_conv_ker_pipeline(ker, p, src, dst, filt, bias, channel, kh_padding,
             reduce_work, load_work);
 }
@@ -70,8 +72,10 @@ inline void jit_conv_ker_pipeline_ow_thr(const jit_conv_ker_t ker,
 inline void jit_conv_ker_pipeline_iw_thr(const jit_conv_ker_t ker,
         jit_conv_call_s &p, const void *src, const void *dst, const void *filt,
         const void *bias, int channel, int kh_padding, int iwb, int reduce_work,
-        int load_work) {
+        int load_work, int flags = 0, size_t oc_l_off = 0) {
     PIPELINE(iwb);
+    PIPELINE(flags);
+    PIPELINE(oc_l_off);
 
     jit_conv_ker_pipeline(ker, p, src, dst, filt, bias, channel, kh_padding,
             reduce_work, load_work);
@@ -95,14 +99,26 @@ inline void jit_conv_3d_ker_pipeline(const jit_conv_ker_t ker,
 
     if (p.src) ker(&p);
 }
+// The special case for the BWD_D driver, which applies the post-ops
+inline void jit_conv_3d_ker_pipeline_bwd_d(const jit_conv_ker_t ker,
+        jit_conv_call_s &p, const void *src, const void *dst, const void *filt,
+        const void *bias, int channel, int kh_padding, int kd_padding,
+        int reduce_work, int load_work, int flags, size_t oc_l_off) {
+    PIPELINE(flags);
+    PIPELINE(oc_l_off);
+
+    jit_conv_3d_ker_pipeline(ker, p, src, dst, filt, bias, channel, kh_padding,
+            kd_padding, reduce_work, load_work);
+}
 // The special case for the driver with ow-parallelization (FWD)
 // TODO: implement it for BWD_D and BWD_W too
 inline void jit_conv_3d_ker_pipeline_ow_thr(const jit_conv_ker_t ker,
         jit_conv_call_s &p, const void *src, const void *dst, const void *filt,
         const void *bias, int channel, int kh_padding, int kd_padding, int owb,
-        int reduce_work, int load_work, int flags) {
+        int reduce_work, int load_work, int flags, size_t oc_l_off = 0) {
     PIPELINE(owb);
     PIPELINE(flags);
+    PIPELINE(oc_l_off);
 
     jit_conv_3d_ker_pipeline(ker, p, src, dst, filt, bias, channel, kh_padding,
             kd_padding, reduce_work, load_work);
@@ -194,6 +210,8 @@ void jit_avx512_common_convolution_fwd_t<src_type, wei_type,
     const auto &jcp = pd()->jcp_;
     const jit_conv_ker_t jit_ker = (decltype(jit_ker))kernel_->jit_ker();
     assert(jcp.nb_oc % jcp.nb_oc_blocking == 0);
+    const auto post_ops_binary_rhs_arg_vec
+            = binary_injector::prepare_binary_args(jcp.post_ops, ctx);
 
     int oc_chunks = jcp.nb_oc / jcp.nb_oc_blocking;
     int g_blocking = 1;
@@ -207,6 +225,9 @@ void jit_avx512_common_convolution_fwd_t<src_type, wei_type,
         start_copy = start;
 
         auto par_conv = jit_conv_call_s();
+        par_conv.post_ops_binary_rhs_arg_vec
+                = post_ops_binary_rhs_arg_vec.data();
+        par_conv.dst_orig = dst;
         size_t src_c_stride = src_d.blk_off(0, 1);
         size_t wht_ic_stride = wht_blk_off(weights_d, 0, 0, 1);
 
@@ -257,6 +278,7 @@ void jit_avx512_common_convolution_fwd_t<src_type, wei_type,
                 int icb_end = min(jcp.nb_ic, icb_l2 + jcp.nb_ic_L2);
                 const int oc_work = utils::this_block_size(ocb * jcp.oc_block,
                         jcp.oc, jcp.nb_oc_blocking * jcp.oc_block);
+                const size_t oc_l_off = g * jcp.oc + ocb * jcp.oc_block;
                 int ic_work = icb_step * jcp.ic_block;
                 for (int icb = icb_l2; icb < icb_end; icb += icb_step) {
                     int curr_nb_ic = nstl::min(icb_step, icb_end - icb);
@@ -269,7 +291,7 @@ void jit_avx512_common_convolution_fwd_t<src_type, wei_type,
                     }
                     jit_conv_ker_pipeline_ow_thr(jit_ker, par_conv, src_w,
                             dst_w, wht_w, bias_w, icb, 1, owb, ic_work, oc_work,
-                            flags);
+                            flags, oc_l_off);
 
                     src_w += src_c_stride;
                     wht_w += wht_ic_stride;
@@ -318,6 +340,8 @@ void jit_avx512_common_convolution_fwd_t<src_type, wei_type,
     const auto &jcp = pd()->jcp_;
     const jit_conv_ker_t jit_ker = (decltype(jit_ker))kernel_->jit_ker();
     assert(jcp.nb_oc % jcp.nb_oc_blocking == 0);
+    const auto post_ops_binary_rhs_arg_vec
+            = binary_injector::prepare_binary_args(jcp.post_ops, ctx);
 
     int oc_chunks = jcp.nb_oc / jcp.nb_oc_blocking;
     int g_blocking = 1;
@@ -331,6 +355,9 @@ void jit_avx512_common_convolution_fwd_t<src_type, wei_type,
         start_copy = start;
 
         auto par_conv = jit_conv_call_s();
+        par_conv.post_ops_binary_rhs_arg_vec
+                = post_ops_binary_rhs_arg_vec.data();
+        par_conv.dst_orig = dst;
         size_t src_h_stride = src_d.blk_off(0, 0, 1);
         size_t src_c_stride = src_d.blk_off(0, 1);
         size_t dst_h_stride = dst_d.blk_off(0, 0, 1);
@@ -394,6 +421,7 @@ void jit_avx512_common_convolution_fwd_t<src_type, wei_type,
                     const int oc_work
                             = utils::this_block_size(ocb * jcp.oc_block, jcp.oc,
                                     jcp.nb_oc_blocking * jcp.oc_block);
+                    const size_t oc_l_off = g * jcp.oc + ocb * jcp.oc_block;
                     int ic_work = icb_step * jcp.ic_block;
                     for (int icb = icb_l2; icb < icb_end; icb += icb_step) {
                         int curr_nb_ic = nstl::min(icb_step, icb_end - icb);
@@ -426,7 +454,8 @@ void jit_avx512_common_convolution_fwd_t<src_type, wei_type,
 
                             jit_conv_ker_pipeline_ow_thr(jit_ker, par_conv,
                                     aux_src, dst_c, aux_wht, bias_w, icb,
-                                    kh_padding, owb, ic_work, oc_work, flags);
+                                    kh_padding, owb, ic_work, oc_work, flags,
+                                    oc_l_off);
 
                             src_c += src_h_stride * jcp.stride_h;
                             dst_c += dst_h_stride;
@@ -477,6 +506,8 @@ void jit_avx512_common_convolution_fwd_t<src_type, wei_type,
     const auto &jcp = pd()->jcp_;
     const jit_conv_ker_t jit_ker = (decltype(jit_ker))kernel_->jit_ker();
     assert(jcp.nb_oc % jcp.nb_oc_blocking == 0);
+    const auto post_ops_binary_rhs_arg_vec
+            = binary_injector::prepare_binary_args(jcp.post_ops, ctx);
 
     int oc_chunks = jcp.nb_oc / jcp.nb_oc_blocking;
     int g_blocking = 1;
@@ -491,6 +522,9 @@ void jit_avx512_common_convolution_fwd_t<src_type, wei_type,
         start_copy = start;
 
         auto par_conv = jit_conv_call_s();
+        par_conv.post_ops_binary_rhs_arg_vec
+                = post_ops_binary_rhs_arg_vec.data();
+        par_conv.dst_orig = dst;
         size_t src_d_stride = src_d.blk_off(0, 0, 1);
         size_t src_h_stride = src_d.blk_off(0, 0, 0, 1);
         size_t src_c_stride = src_d.blk_off(0, 1);
@@ -562,6 +596,7 @@ void jit_avx512_common_convolution_fwd_t<src_type, wei_type,
                 int icb_end = min(jcp.nb_ic, icb_l2 + jcp.nb_ic_L2);
                 const int oc_work = utils::this_block_size(ocb * jcp.oc_block,
                         jcp.oc, jcp.nb_oc_blocking * jcp.oc_block);
+                const size_t oc_l_off = g * jcp.oc + ocb * jcp.oc_block;
                 int ic_work = icb_step * jcp.ic_block;
                 for (int icb = icb_l2; icb < icb_end; icb += icb_step) {
                     int curr_nb_ic = nstl::min(icb_step, icb_end - icb);
@@ -589,7 +624,7 @@ void jit_avx512_common_convolution_fwd_t<src_type, wei_type,
                                 src_c + i_t_overflow * dilate_h * src_h_stride,
                                 dst_c, wht_w + i_t_overflow * wht_h_stride,
                                 bias_w, icb, kh_padding, kd_padding, owb,
-                                ic_work, oc_work, flags);
+                                ic_work, oc_work, flags, oc_l_off);
 
                         src_c += src_h_stride * jcp.stride_h;
                         dst_c += dst_h_stride;
@@ -626,20 +661,41 @@ void jit_avx512_common_convolution_fwd_t<src_type, wei_type,
 
 template struct jit_avx512_common_convolution_fwd_t<data_type::f32>;
 
+template <data_type_t diff_dst_type, data_type_t wei_type,
+        data_type_t diff_src_type>
+void jit_avx512_common_convolution_bwd_data_t<diff_dst_type, wei_type,
+        diff_src_type>::prepare_padded_bias(const diff_src_data_t *&bias,
+        const memory_tracking::grantor_t &scratchpad) const {
+    if (!pd()->wants_padded_bias()) return;
+
+    auto padded_bias
+            = scratchpad.template get<diff_src_data_t>(key_conv_padded_bias);
+    utils::array_copy(padded_bias, bias, pd()->jcp_.ic_without_padding);
+    utils::array_set(padded_bias + pd()->jcp_.ic_without_padding,
+            (diff_src_data_t)0,
+            pd()->jcp_.ic - pd()->jcp_.ic_without_padding);
+    bias = padded_bias;
+}
+
 template <data_type_t diff_dst_type, data_type_t wei_type,
         data_type_t diff_src_type>
 void jit_avx512_common_convolution_bwd_data_t<diff_dst_type, wei_type,
         diff_src_type>::execute_backward_data_1d(const exec_ctx_t &ctx) const {
     auto diff_dst = CTX_IN_MEM(const diff_dst_data_t *, DNNL_ARG_DIFF_DST);
     auto weights = CTX_IN_MEM(const wei_data_t *, DNNL_ARG_WEIGHTS);
+    auto bias = CTX_IN_MEM(const diff_src_data_t *, DNNL_ARG_BIAS);
     auto diff_src = CTX_OUT_MEM(diff_src_data_t *, DNNL_ARG_DIFF_SRC);
 
+    prepare_padded_bias(bias, ctx.get_scratchpad_grantor());
+
     const memory_desc_wrapper diff_dst_d(pd()->diff_dst_md());
     const memory_desc_wrapper diff_src_d(pd()->diff_src_md());
     const memory_desc_wrapper weights_d(pd()->weights_md(0));
 
     const auto &jcp = pd()->jcp_;
     const jit_conv_ker_t jit_ker = (decltype(jit_ker))kernel_->jit_ker();
+    const auto post_ops_binary_rhs_arg_vec
+            = binary_injector::prepare_binary_args(jcp.post_ops, ctx);
 
     int ic_chunks = jcp.nb_ic / jcp.nb_ic_blocking;
     int g_blocking = 1;
@@ -653,6 +709,9 @@ void jit_avx512_common_convolution_bwd_data_t<diff_dst_type, wei_type,
         start_copy = start;
 
         auto par_conv = jit_conv_call_s();
+        par_conv.post_ops_binary_rhs_arg_vec
+                = post_ops_binary_rhs_arg_vec.data();
+        par_conv.dst_orig = diff_src;
         size_t diff_dst_c_stride = diff_dst_d.blk_off(0, 1);
         size_t wht_oc_stride = wht_blk_off(weights_d, 0, 1);
 
@@ -695,6 +754,8 @@ void jit_avx512_common_convolution_bwd_data_t<diff_dst_type, wei_type,
                 auto diff_dst_w
                         = diff_dst + diff_dst_d.blk_off(n, oc_off_idx, ow_s);
                 auto wht_w = weights + wht_blk_off(weights_d, g, ocb_l2, icb);
+                const size_t ic_l_off = g * jcp.ic + icb * jcp.ic_block;
+                auto bias_w = bias ? bias + ic_l_off : nullptr;
 
                 int ocb_step = is_ddst_layout_nxc ? jcp.nb_oc_L2 : 1;
                 int ocb_end = min(jcp.nb_oc, ocb_l2 + jcp.nb_oc_L2);
@@ -703,14 +764,16 @@ void jit_avx512_common_convolution_bwd_data_t<diff_dst_type, wei_type,
                 int reduce_work = ocb_step * jcp.oc_block;
                 for (int ocb = ocb_l2; ocb < ocb_end; ocb += ocb_step) {
                     int curr_nb_oc = nstl::min(ocb_step, ocb_end - ocb);
+                    int flags = 0;
                     if (ocb + curr_nb_oc >= jcp.nb_oc) {
+                        flags |= FLAG_OC_LAST;
                         reduce_work = utils::this_block_size(ocb * jcp.oc_block,
                                 jcp.oc, ocb_step * jcp.oc_block);
                     }
 
                     jit_conv_ker_pipeline_iw_thr(jit_ker, par_conv, diff_src_w,
-                            diff_dst_w, wht_w, nullptr, ocb, 1, iwb,
-                            reduce_work, load_work);
+                            diff_dst_w, wht_w, bias_w, ocb, 1, iwb, reduce_work,
+                            load_work, flags, ic_l_off);
                     diff_dst_w += diff_dst_c_stride;
                     wht_w += wht_oc_stride;
                 }
@@ -748,14 +811,19 @@ void jit_avx512_common_convolution_bwd_data_t<diff_dst_type, wei_type,
         diff_src_type>::execute_backward_data_2d(const exec_ctx_t &ctx) const {
     auto diff_dst = CTX_IN_MEM(const diff_dst_data_t *, DNNL_ARG_DIFF_DST);
     auto weights = CTX_IN_MEM(const wei_data_t *, DNNL_ARG_WEIGHTS);
+    auto bias = CTX_IN_MEM(const diff_src_data_t *, DNNL_ARG_BIAS);
     auto diff_src = CTX_OUT_MEM(diff_src_data_t *, DNNL_ARG_DIFF_SRC);
 
+    prepare_padded_bias(bias, ctx.get_scratchpad_grantor());
+
     const memory_desc_wrapper diff_dst_d(pd()->diff_dst_md());
     const memory_desc_wrapper diff_src_d(pd()->diff_src_md());
     const memory_desc_wrapper weights_d(pd()->weights_md(0));
 
     const auto &jcp = pd()->jcp_;
     const jit_conv_ker_t jit_ker = (decltype(jit_ker))kernel_->jit_ker();
+    const auto post_ops_binary_rhs_arg_vec
+            = binary_injector::prepare_binary_args(jcp.post_ops, ctx);
 
     int ic_chunks = jcp.nb_ic / jcp.nb_ic_blocking;
     int g_blocking = 1;
@@ -769,6 +837,9 @@ void jit_avx512_common_convolution_bwd_data_t<diff_dst_type, wei_type,
         start_copy = start;
 
         auto par_conv = jit_conv_call_s();
+        par_conv.post_ops_binary_rhs_arg_vec
+                = post_ops_binary_rhs_arg_vec.data();
+        par_conv.dst_orig = diff_src;
         size_t diff_src_h_stride = diff_src_d.blk_off(0, 0, 1);
         size_t diff_dst_h_stride = diff_dst_d.blk_off(0, 0, 1);
         size_t diff_dst_c_stride = diff_dst_d.blk_off(0, 1);
@@ -819,6 +890,9 @@ void jit_avx512_common_convolution_bwd_data_t<diff_dst_type, wei_type,
                         = diff_dst + diff_dst_d.blk_off(n, oc_off_idx, 0, ow_s);
                 auto wht_w = weights + wht_blk_off(weights_d, g, ocb_l2, icb);
 
+                const size_t ic_l_off = g * jcp.ic + icb * jcp.ic_block;
+                auto bias_w = bias ? bias + ic_l_off : nullptr;
+
                 int ocb_step = is_ddst_layout_nxc ? jcp.nb_oc_L2 : 1;
                 int ocb_end = min(jcp.nb_oc, ocb_l2 + jcp.nb_oc_L2);
                 const int load_work = utils::this_block_size(icb * jcp.ic_block,
@@ -826,7 +900,9 @@ void jit_avx512_common_convolution_bwd_data_t<diff_dst_type, wei_type,
                 int reduce_work = ocb_step * jcp.oc_block;
                 for (int ocb = ocb_l2; ocb < ocb_end; ocb += ocb_step) {
                     int curr_nb_oc = nstl::min(ocb_step, ocb_end - ocb);
+                    int flags = 0;
                     if (ocb + curr_nb_oc >= jcp.nb_oc) {
+                        flags |= FLAG_OC_LAST;
                         reduce_work = utils::this_block_size(ocb * jcp.oc_block,
                                 jcp.oc, ocb_step * jcp.oc_block);
                     }
@@ -879,8 +955,9 @@ void jit_avx512_common_convolution_bwd_data_t<diff_dst_type, wei_type,
                         jit_conv_ker_pipeline_iw_thr(jit_ker, par_conv,
                                 diff_src_w + ij * diff_src_h_stride,
                                 diff_dst_w + oj * diff_dst_h_stride,
-                                wht_w + k_lo * wht_h_stride, nullptr, ocb,
-                                k_len, iwb, reduce_work, load_work);
+                                wht_w + k_lo * wht_h_stride, bias_w, ocb,
+                                k_len, iwb, reduce_work, load_work, flags,
+                                ic_l_off);
                     }
                     diff_dst_w += diff_dst_c_stride;
                     wht_w += wht_oc_stride;
@@ -916,14 +993,19 @@ void jit_avx512_common_convolution_bwd_data_t<diff_dst_type, wei_type,
         diff_src_type>::execute_backward_data_3d(const exec_ctx_t &ctx) const {
     auto diff_dst = CTX_IN_MEM(const diff_dst_data_t *, DNNL_ARG_DIFF_DST);
     auto weights = CTX_IN_MEM(const wei_data_t *, DNNL_ARG_WEIGHTS);
+    auto bias = CTX_IN_MEM(const diff_src_data_t *, DNNL_ARG_BIAS);
     auto diff_src = CTX_OUT_MEM(diff_src_data_t *, DNNL_ARG_DIFF_SRC);
 
+    prepare_padded_bias(bias, ctx.get_scratchpad_grantor());
+
     const memory_desc_wrapper diff_dst_d(pd()->diff_dst_md());
     const memory_desc_wrapper diff_src_d(pd()->diff_src_md());
     const memory_desc_wrapper weights_d(pd()->weights_md(0));
 
     const auto &jcp = pd()->jcp_;
     const jit_conv_ker_t jit_ker = (decltype(jit_ker))kernel_->jit_ker();
+    const auto post_ops_binary_rhs_arg_vec
+            = binary_injector::prepare_binary_args(jcp.post_ops, ctx);
 
     int ic_chunks = jcp.nb_ic / jcp.nb_ic_blocking;
     int g_blocking = 1;
@@ -937,6 +1019,9 @@ void jit_avx512_common_convolution_bwd_data_t<diff_dst_type, wei_type,
         start_copy = start;
 
         auto par_conv = jit_conv_call_s();
+        par_conv.post_ops_binary_rhs_arg_vec
+                = post_ops_binary_rhs_arg_vec.data();
+        par_conv.dst_orig = diff_src;
         size_t diff_src_h_stride = diff_src_d.blk_off(0, 0, 0, 1);
         size_t diff_src_d_stride = diff_src_d.blk_off(0, 0, 1);
         size_t diff_dst_h_stride = diff_dst_d.blk_off(0, 0, 0, 1);
@@ -1032,6 +1117,9 @@ void jit_avx512_common_convolution_bwd_data_t<diff_dst_type, wei_type,
                 auto wht_w = weights + wht_blk_off(weights_d, g, ocb_l2, icb)
                         + d_lo * wht_d_stride;
 
+                const size_t ic_l_off = g * jcp.ic + icb * jcp.ic_block;
+                auto bias_w = bias ? bias + ic_l_off : nullptr;
+
                 int ocb_step = is_ddst_layout_nxc ? jcp.nb_oc_L2 : 1;
                 int ocb_end = min(jcp.nb_oc, ocb_l2 + jcp.nb_oc_L2);
                 const int load_work = utils::this_block_size(icb * jcp.ic_block,
@@ -1039,7 +1127,9 @@ void jit_avx512_common_convolution_bwd_data_t<diff_dst_type, wei_type,
                 int reduce_work = ocb_step * jcp.oc_block;
                 for (int ocb = ocb_l2; ocb < ocb_end; ocb += ocb_step) {
                     int curr_nb_oc = nstl::min(ocb_step, ocb_end - ocb);
+                    int flags = 0;
                     if (ocb + curr_nb_oc >= jcp.nb_oc) {
+                        flags |= FLAG_OC_LAST;
                         reduce_work = utils::this_block_size(ocb * jcp.oc_block,
                                 jcp.oc, ocb_step * jcp.oc_block);
                     }
@@ -1090,11 +1180,12 @@ void jit_avx512_common_convolution_bwd_data_t<diff_dst_type, wei_type,
                         }
                         assert(k_len >= 0);
 
-                        jit_conv_3d_ker_pipeline(jit_ker, par_conv,
+                        jit_conv_3d_ker_pipeline_bwd_d(jit_ker, par_conv,
                                 diff_src_w + ij * diff_src_h_stride,
                                 diff_dst_w + oj * diff_dst_h_stride,
-                                wht_w + k_lo * wht_h_stride, nullptr, ocb,
-                                k_len, d_len, reduce_work, load_work);
+                                wht_w + k_lo * wht_h_stride, bias_w, ocb,
+                                k_len, d_len, reduce_work, load_work, flags,
+                                ic_l_off);
                     }
                     diff_dst_w += diff_dst_c_stride;
                     wht_w += wht_oc_stride;
@@ -1119,8 +1210,8 @@ void jit_avx512_common_convolution_bwd_data_t<diff_dst_type, wei_type,
         // on the last iteration of loop above. Only valid pointers make sense
         // here as call parameters to avoid execution of prefetch instructions
         // with nullptr, other parameters are not used in real jit call here
-        jit_conv_3d_ker_pipeline(jit_ker, par_conv, diff_src, diff_dst, weights,
-                nullptr, 0, 1, 1, 0, 0);
+        jit_conv_3d_ker_pipeline_bwd_d(jit_ker, par_conv, diff_src, diff_dst,
+                weights, nullptr, 0, 1, 1, 0, 0, 0, 0);
     });
 }
 
@@ -1151,6 +1242,13 @@ status_t jit_avx512_common_convolution_bwd_weights_t<src_type, diff_dst_type,
         CHECK(safe_ptr_assign(
                 acc_ker_, new cpu_accumulator_1d_t<diff_weights_type>()));
         CHECK(acc_ker_->create_kernel());
+
+        const size_t wei_size = (size_t)j.ngroups * rnd_up(j.oc, j.oc_block)
+                * rnd_up(j.ic, j.ic_block) * j.kh * j.kw * j.kd;
+        CHECK(safe_ptr_assign(wei_red_ker_,
+                new cpu_accumulator_1d_t<diff_weights_type>(
+                        nthr_mb_ - 1, wei_size)));
+        CHECK(wei_red_ker_->create_kernel());
     }
 
     CHECK(safe_ptr_assign(reducer_bias_,
@@ -1862,38 +1960,36 @@ void jit_avx512_common_convolution_bwd_weights_t<src_type, diff_dst_type,
     balance211(work, nthr_mb_, ti->ithr_mb, start, end);
     if (start == end) return;
 
-    for (int thr_mb = 1; thr_mb < nthr_mb_; ++thr_mb) {
-        int w = start;
-        int sub_g_start {0}, sub_oc_b_start {0}, sub_ic_b_kh_start {0};
-        nd_iterator_init(w, sub_g_start, ti->g_work, sub_oc_b_start,
-                ti->oc_b_work, sub_ic_b_kh_start, ic_b_kh_work);
-        while (w < end) {
-            const int g = ti->g_start + sub_g_start;
-            const int oc_b = ti->oc_b_start + sub_oc_b_start;
-            const int ic_b = ti->ic_b_start + sub_ic_b_kh_start / jcp.kh;
-            const int kh = sub_ic_b_kh_start % jcp.kh;
+    int w = start;
+    int sub_g_start {0}, sub_oc_b_start {0}, sub_ic_b_kh_start {0};
+    nd_iterator_init(w, sub_g_start, ti->g_work, sub_oc_b_start, ti->oc_b_work,
+            sub_ic_b_kh_start, ic_b_kh_work);
+    while (w < end) {
+        const int g = ti->g_start + sub_g_start;
+        const int oc_b = ti->oc_b_start + sub_oc_b_start;
+        const int ic_b = ti->ic_b_start + sub_ic_b_kh_start / jcp.kh;
+        const int kh = sub_ic_b_kh_start % jcp.kh;
 
-            const int acc_size
-                    = nstl::min(end - w, ic_b_kh_work - sub_ic_b_kh_start)
-                    * jcp.kw * jcp.ic_block * jcp.oc_block;
+        const int acc_size
+                = nstl::min(end - w, ic_b_kh_work - sub_ic_b_kh_start)
+                * jcp.kw * jcp.ic_block * jcp.oc_block;
 
-            const size_t off = wht_blk_off(diff_weights_d, g, oc_b, ic_b, kh);
+        const size_t off = wht_blk_off(diff_weights_d, g, oc_b, ic_b, kh);
 
-            diff_weights_data_t *d
-                    = (diff_weights_data_t *)ti->diff_weights + off;
-            diff_weights_data_t *s
-                    = ti->wei_bia_reduction + (thr_mb - 1) * wei_size + off;
+        diff_weights_data_t *d = (diff_weights_data_t *)ti->diff_weights + off;
+        diff_weights_data_t *s = ti->wei_bia_reduction + off;
 
-            acc_ker_->accumulate(d, s, acc_size);
+        wei_red_ker_->accumulate(d, s, acc_size);
 
-            nd_iterator_jump(w, end, sub_g_start, ti->g_work, sub_oc_b_start,
-                    ti->oc_b_work, sub_ic_b_kh_start, ic_b_kh_work);
-        }
+        nd_iterator_jump(w, end, sub_g_start, ti->g_work, sub_oc_b_start,
+                ti->oc_b_work, sub_ic_b_kh_start, ic_b_kh_work);
+    }
 
-        if (jcp.with_bias && jcp.is_1stconv && jcp.ver == ver_4fma) {
-            if (ti->ithr == 0)
-                acc_ker_->accumulate((diff_weights_data_t *)ti->diff_bias,
-                        diff_bias_ws, bia_size);
+    if (jcp.with_bias && jcp.is_1stconv && jcp.ver == ver_4fma
+            && ti->ithr == 0) {
+        for (int thr_mb = 1; thr_mb < nthr_mb_; ++thr_mb) {
+            acc_ker_->accumulate((diff_weights_data_t *)ti->diff_bias,
+                    diff_bias_ws, bia_size);
             diff_bias_ws += bia_size;
         }
     }
@@ -1907,8 +2003,6 @@ void jit_avx512_common_convolution_bwd_weights_t<src_type, diff_dst_type,
     const memory_desc_wrapper diff_weights_d(pd()->diff_weights_md(0));
 
     const auto &jcp = kernel_->jcp;
-    const int wei_size = jcp.ngroups * rnd_up(jcp.oc, jcp.oc_block)
-            * rnd_up(jcp.ic, jcp.ic_block) * jcp.kh * jcp.kw * jcp.kd;
 
     /* diff_weights[:] += sum(wei_reduction_[thr_mb][:]) */
     if (dnnl_thr_syncable())
@@ -1921,31 +2015,27 @@ void jit_avx512_common_convolution_bwd_weights_t<src_type, diff_dst_type,
     balance211(work, nthr_mb_, ti->ithr_mb, start, end);
     if (start == end) return;
 
-    for (int thr_mb = 1; thr_mb < nthr_mb_; ++thr_mb) {
-        int w = start;
-        int sub_g_start {0}, sub_oc_b_start {0}, sub_ic_b_kh_start {0};
-        nd_iterator_init(w, sub_g_start, ti->g_work, sub_oc_b_start,
+    int w = start;
+    int sub_g_start {0}, sub_oc_b_start {0}, sub_ic_b_kh_start {0};
+    nd_iterator_init(w, sub_g_start, ti->g_work, sub_oc_b_start, ti->oc_b_work,
+            sub_ic_b_kh_start, ic_b_kh_work);
+    while (w < end) {
+        const int g = ti->g_start + sub_g_start;
+        const int oc_b = ti->oc_b_start + sub_oc_b_start;
+        const int ic_b = ti->ic_b_start + sub_ic_b_kh_start / jcp.kd;
+        const int kd = sub_ic_b_kh_start % jcp.kd;
+
+        const int acc_size
+                = nstl::min(end - w, ic_b_kh_work - sub_ic_b_kh_start)
+                * jcp.kw * jcp.ic_block * jcp.oc_block * jcp.kh;
+
+        const size_t off = wht_blk_off(diff_weights_d, g, oc_b, ic_b, kd);
+        diff_weights_data_t *d = (diff_weights_data_t *)ti->diff_weights + off;
+        diff_weights_data_t *s = ti->wei_bia_reduction + off;
+        wei_red_ker_->accumulate(d, s, acc_size);
+
+        nd_iterator_jump(w, end, sub_g_start, ti->g_work, sub_oc_b_start,
                 ti->oc_b_work, sub_ic_b_kh_start, ic_b_kh_work);
-        while (w < end) {
-            const int g = ti->g_start + sub_g_start;
-            const int oc_b = ti->oc_b_start + sub_oc_b_start;
-            const int ic_b = ti->ic_b_start + sub_ic_b_kh_start / jcp.kd;
-            const int kd = sub_ic_b_kh_start % jcp.kd;
-
-            const int acc_size
-                    = nstl::min(end - w, ic_b_kh_work - sub_ic_b_kh_start)
-                    * jcp.kw * jcp.ic_block * jcp.oc_block * jcp.kh;
-
-            const size_t off = wht_blk_off(diff_weights_d, g, oc_b, ic_b, kd);
-            diff_weights_data_t *d
-                    = (diff_weights_data_t *)ti->diff_weights + off;
-            diff_weights_data_t *s
-                    = ti->wei_bia_reduction + (thr_mb - 1) * wei_size + off;
-            acc_ker_->accumulate(d, s, acc_size);
-
-            nd_iterator_jump(w, end, sub_g_start, ti->g_work, sub_oc_b_start,
-                    ti->oc_b_work, sub_ic_b_kh_start, ic_b_kh_work);
-        }
     }
 }
 
@@ -47,14 +47,15 @@ struct jit_avx512_common_convolution_fwd_t : public primitive_t {
                 jit_avx512_common_convolution_fwd_t);
 
         status_t init(engine_t *engine) {
-            bool ok = true && is_fwd()
-                    && set_default_alg_kind(alg_kind::convolution_direct)
-                    && expect_data_types(src_type, wei_type, dst_type, dst_type,
-                            data_type::undef)
-                    && attr()->has_default_values(
-                            primitive_attr_t::skip_mask_t::post_ops, dst_type)
-                    && !has_zero_dim_memory();
-            if (!ok) return status::unimplemented;
+            VDISPATCH(is_fwd(), prop_kind);
+            VDISPATCH(set_default_alg_kind(alg_kind::convolution_direct),
+                    alg_kind);
+            VDISPATCH(expect_data_types(src_type, wei_type, dst_type, dst_type,
+                            data_type::undef), data_type);
+            VDISPATCH(attr()->has_default_values(
+                            primitive_attr_t::skip_mask_t::post_ops, dst_type),
+                    attr);
+            VDISPATCH(!has_zero_dim_memory(), zero_dim);
 
             status_t status = jit_avx512_common_conv_fwd_kernel::init_conf(jcp_,
                     *desc(), src_md_, weights_md_, dst_md_, bias_md_, *attr(),
@@ -80,7 +81,7 @@ struct jit_avx512_common_convolution_fwd_t : public primitive_t {
     status_t init(engine_t *engine) override {
         CHECK(safe_ptr_assign(kernel_,
                 new jit_avx512_common_conv_fwd_kernel(
-                        pd()->jcp_, *pd()->attr())));
+                        pd()->jcp_, *pd()->attr(), *pd()->dst_md(0))));
         return kernel_->create_kernel();
     }
 
@@ -94,7 +95,8 @@ struct jit_avx512_common_convolution_fwd_t : public primitive_t {
         else
             assert(false);
 
-        if (pd()->wants_zero_pad_dst()) ctx.memory(DNNL_ARG_DST)->zero_pad(ctx);
+        if (pd()->wants_zero_pad_dst() && !pd()->jcp_.zero_pad_dst_in_kernel)
+            ctx.memory(DNNL_ARG_DST)->zero_pad(ctx);
         return status::success;
     }
 
@@ -122,17 +124,22 @@ struct jit_avx512_common_convolution_bwd_data_t : public primitive_t {
                 jit_avx512_common_convolution_bwd_data_t);
 
         status_t init(engine_t *engine) {
-            bool ok = true && desc()->prop_kind == prop_kind::backward_data
-                    && set_default_alg_kind(alg_kind::convolution_direct)
-                    && expect_data_types(diff_src_type, wei_type,
-                            data_type::undef, diff_dst_type, data_type::undef)
-                    && attr()->has_default_values() && !has_zero_dim_memory();
-            if (!ok) return status::unimplemented;
+            VDISPATCH(desc()->prop_kind == prop_kind::backward_data, prop_kind);
+            VDISPATCH(set_default_alg_kind(alg_kind::convolution_direct),
+                    alg_kind);
+            VDISPATCH(expect_data_types(diff_src_type, wei_type,
+                            data_type::undef, diff_dst_type, data_type::undef),
+                    data_type);
+            VDISPATCH(attr()->has_default_values(
+                              primitive_attr_t::skip_mask_t::post_ops),
+                    attr);
+            VDISPATCH(!has_zero_dim_memory(), zero_dim);
 
             status_t status
                     = jit_avx512_common_conv_bwd_data_kernel_f32::init_conf(
                             jcp_, *desc(), diff_src_md_, weights_md_,
-                            diff_dst_md_, dnnl_get_max_threads());
+                            diff_dst_md_, bias_md_, *attr(),
+                            dnnl_get_max_threads());
             if (status != status::success) return status;
 
             auto scratchpad = scratchpad_registry().registrar();
@@ -142,6 +149,10 @@ struct jit_avx512_common_convolution_bwd_data_t : public primitive_t {
             return status::success;
         }
 
+        // The bias and the post-ops of a deconvolution are applied by the
+        // kernel while diff_src is in registers.
+        bool support_bias() const override { return true; }
+
         jit_conv_conf_t jcp_;
     };
 
@@ -154,7 +165,8 @@ struct jit_avx512_common_convolution_bwd_data_t : public primitive_t {
 
     status_t init(engine_t *engine) override {
         CHECK(safe_ptr_assign(kernel_,
-                new jit_avx512_common_conv_bwd_data_kernel_f32(pd()->jcp_)));
+                new jit_avx512_common_conv_bwd_data_kernel_f32(
+                        pd()->jcp_, *pd()->diff_src_md())));
         return kernel_->create_kernel();
     }
 
@@ -171,6 +183,8 @@ struct jit_avx512_common_convolution_bwd_data_t : public primitive_t {
     }
 
 private:
+    void prepare_padded_bias(const diff_src_data_t *&bias,
+            const memory_tracking::grantor_t &scratchpad) const;
     void execute_backward_data_1d(const exec_ctx_t &ctx) const;
     void execute_backward_data_2d(const exec_ctx_t &ctx) const;
     void execute_backward_data_3d(const exec_ctx_t &ctx) const;
@@ -193,12 +207,15 @@ struct jit_avx512_common_convolution_bwd_weights_t : public primitive_t {
                 jit_avx512_common_convolution_bwd_weights_t);
 
         status_t init(engine_t *engine) {
-            bool ok = true && desc()->prop_kind == prop_kind::backward_weights
-                    && set_default_alg_kind(alg_kind::convolution_direct)
-                    && expect_data_types(src_type, diff_weights_type,
-                            diff_weights_type, diff_dst_type, data_type::undef)
-                    && attr()->has_default_values() && !has_zero_dim_memory();
-            if (!ok) return status::unimplemented;
+            VDISPATCH(desc()->prop_kind == prop_kind::backward_weights,
+                    prop_kind);
+            VDISPATCH(set_default_alg_kind(alg_kind::convolution_direct),
+                    alg_kind);
+            VDISPATCH(expect_data_types(src_type, diff_weights_type,
+                            diff_weights_type, diff_dst_type, data_type::undef),
+                    data_type);
+            VDISPATCH(attr()->has_default_values(), attr);
+            VDISPATCH(!has_zero_dim_memory(), zero_dim);
 
             status_t status
                     = jit_avx512_common_conv_bwd_weights_kernel_f32::init_conf(
@@ -268,6 +285,8 @@ private:
     std::unique_ptr<jit_avx512_common_conv_bwd_weights_kernel_f32> kernel_;
     std::unique_ptr<jit_trans_src_t> trans_kernel_;
     std::unique_ptr<cpu_accumulator_1d_t<diff_weights_type>> acc_ker_;
+    // sums the partial weights of all the mb threads in a single pass
+    std::unique_ptr<cpu_accumulator_1d_t<diff_weights_type>> wei_red_ker_;
     std::unique_ptr<cpu_reducer_t<diff_weights_type>> reducer_bias_;
 };
 
@@ -95,17 +95,18 @@ struct jit_avx512_common_convolution_winograd_fwd_t
                 USE_GLOBAL_SCRATCHPAD);
 
         status_t init(engine_t *engine) {
-            bool ok = true && is_fwd()
-                    && utils::one_of(desc()->alg_kind,
+            VDISPATCH(is_fwd(), prop_kind);
+            VDISPATCH(utils::one_of(desc()->alg_kind,
                             alg_kind::convolution_auto,
-                            alg_kind::convolution_winograd)
-                    && expect_data_types(data_type::f32, data_type::f32,
-                            data_type::f32, data_type::f32, data_type::f32)
-                    && attr()->has_default_values(
+                            alg_kind::convolution_winograd), alg_kind);
+            VDISPATCH(expect_data_types(data_type::f32, data_type::f32,
+                            data_type::f32, data_type::f32, data_type::f32),
+                    data_type);
+            VDISPATCH(attr()->has_default_values(
                             primitive_attr_t::skip_mask_t::post_ops,
-                            data_type::f32)
-                    && !has_zero_dim_memory() && set_default_formats();
-            if (!ok) return status::unimplemented;
+                            data_type::f32), attr);
+            VDISPATCH(!has_zero_dim_memory(), zero_dim);
+            VDISPATCH(set_default_formats(), format);
 
             status_t status
                     = jit_avx512_common_conv_winograd_fwd_kernel_f32::init_conf(
@@ -173,15 +174,17 @@ struct jit_avx512_common_convolution_winograd_bwd_data_t
                 USE_GLOBAL_SCRATCHPAD);
 
         status_t init(engine_t *engine) {
-            bool ok = true && desc()->prop_kind == prop_kind::backward_data
-                    && expect_data_types(data_type::f32, data_type::f32,
-                            data_type::undef, data_type::f32, data_type::f32)
-                    && utils::one_of(desc()->alg_kind,
+            VDISPATCH(desc()->prop_kind == prop_kind::backward_data, prop_kind);
+            VDISPATCH(expect_data_types(data_type::f32, data_type::f32,
+                            data_type::undef, data_type::f32, data_type::f32),
+                    data_type);
+            VDISPATCH(utils::one_of(desc()->alg_kind,
                             alg_kind::convolution_auto,
-                            alg_kind::convolution_winograd)
-                    && attr()->has_default_values() && !has_zero_dim_memory()
-                    && set_default_formats() && dnnl_thr_syncable();
-            if (!ok) return status::unimplemented;
+                            alg_kind::convolution_winograd), alg_kind);
+            VDISPATCH(attr()->has_default_values(), attr);
+            VDISPATCH(!has_zero_dim_memory(), zero_dim);
+            VDISPATCH(set_default_formats(), format);
+            VDISPATCH(dnnl_thr_syncable(), runtime);
 
             status_t status
                     = jit_avx512_common_conv_winograd_bwd_data_kernel_f32::
@@ -248,15 +251,18 @@ struct jit_avx512_common_convolution_winograd_bwd_weights_t
                 USE_GLOBAL_SCRATCHPAD);
 
         status_t init(engine_t *engine) {
-            bool ok = true && desc()->prop_kind == prop_kind::backward_weights
-                    && utils::one_of(desc()->alg_kind,
+            VDISPATCH(desc()->prop_kind == prop_kind::backward_weights,
+                    prop_kind);
+            VDISPATCH(utils::one_of(desc()->alg_kind,
                             alg_kind::convolution_auto,
-                            alg_kind::convolution_winograd)
-                    && expect_data_types(data_type::f32, data_type::f32,
-                            data_type::f32, data_type::f32, data_type::f32)
-                    && attr()->has_default_values() && !has_zero_dim_memory()
-                    && set_default_formats() && dnnl_thr_syncable();
-            if (!ok) return status::unimplemented;
+                            alg_kind::convolution_winograd), alg_kind);
+            VDISPATCH(expect_data_types(data_type::f32, data_type::f32,
+                            data_type::f32, data_type::f32, data_type::f32),
+                    data_type);
+            VDISPATCH(attr()->has_default_values(), attr);
+            VDISPATCH(!has_zero_dim_memory(), zero_dim);
+            VDISPATCH(set_default_formats(), format);
+            VDISPATCH(dnnl_thr_syncable(), runtime);
 
             status_t status
                     = jit_avx512_common_conv_winograd_bwd_weights_kernel_f32::
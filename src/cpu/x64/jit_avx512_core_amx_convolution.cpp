@@ -14,8 +14,13 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <string.h>
+
 #include "common/c_types_map.hpp"
 #include "common/dnnl_thread.hpp"
+#include "common/primitive_iterator.hpp"
+#include "common/reorder_pd.hpp"
+#include "common/stream.hpp"
 #include "common/type_helpers.hpp"
 #include "common/utils.hpp"
 
@@ -416,6 +421,378 @@ template struct jit_avx512_core_amx_convolution_fwd_t<data_type::bf16,
 template struct jit_avx512_core_amx_convolution_fwd_t<data_type::bf16,
         data_type::bf16, data_type::f32>;
 
+namespace {
+status_t swap_axes(
+        memory_desc_t &out_md, const memory_desc_t &in_md, int a, int b) {
+    int perm[DNNL_MAX_NDIMS];
+    for (int d = 0; d < DNNL_MAX_NDIMS; ++d)
+        perm[d] = d;
+    nstl::swap(perm[a], perm[b]);
+    return dnnl_memory_desc_permute_axes(&out_md, &in_md, perm);
+}
+
+status_t create_amx_fwd_pd(std::unique_ptr<primitive_desc_t> &fwd_pd,
+        engine_t *engine, const convolution_desc_t &cd) {
+    primitive_attr_t fwd_attr;
+    fwd_attr.set_scratchpad_mode(scratchpad_mode::user);
+
+    dnnl_primitive_desc_iterator it(
+            engine, (const op_desc_t *)&cd, &fwd_attr, nullptr);
+    if (!it.is_initialized()) return status::out_of_memory;
+    if (++it == it.end()) return status::unimplemented;
+    fwd_pd.reset(it.fetch_once());
+
+    // The data transformations only pay off with the AMX kernel, any other
+    // forward implementation loses to the regular backward ones.
+    if (strstr(fwd_pd->name(), "amx") == nullptr) return status::unimplemented;
+    return status::success;
+}
+} // namespace
+
+status_t jit_avx512_core_amx_convolution_bwd_data_t::pd_t::init(
+        engine_t *engine) {
+    using namespace data_type;
+    bool ok = desc()->prop_kind == prop_kind::backward_data
+            && set_default_alg_kind(alg_kind::convolution_direct)
+            && mayiuse(avx512_core_bf16_amx_bf16) && one_of(ndims(), 3, 4)
+            && one_of(diff_src_md_.data_type, f32, bf16)
+            && everyone_is(bf16, weights_md_.data_type, diff_dst_md_.data_type)
+            && attr()->has_default_values() && !has_zero_dim_memory();
+    if (!ok) return status::unimplemented;
+
+    // the forward kernel does not support depthwise convolutions
+    const bool is_depthwise = with_groups() && everyone_is(G(), IC(), OC());
+    if (is_depthwise) return status::unimplemented;
+
+    CHECK(init_fwd_pd(engine));
+
+    if (weights_md_.format_kind == format_kind::any)
+        CHECK(swap_axes(weights_md_, *fwd_pd_->weights_md(), with_groups(),
+                with_groups() + 1));
+    if (diff_src_md_.format_kind == format_kind::any)
+        diff_src_md_ = *fwd_pd_->dst_md();
+    if (diff_dst_md_.format_kind == format_kind::any)
+        diff_dst_md_ = *fwd_pd_->src_md();
+
+    init_scratchpad();
+    return status::success;
+}
+
+status_t jit_avx512_core_amx_convolution_bwd_data_t::pd_t::init_fwd_pd(
+        engine_t *engine) {
+    const int sp_ndims = ndims() - 2;
+    dims_t strides, padding_l, padding_r;
+    for (int d = 0; d < sp_ndims; ++d) {
+        if (desc()->strides[d] != 1) return status::unimplemented;
+        const dim_t ker = desc()->weights_desc.dims[with_groups() + 2 + d];
+        const dim_t ker_range = (ker - 1) * (desc()->dilates[d] + 1);
+        strides[d] = 1;
+        padding_l[d] = ker_range - desc()->padding[0][d];
+        padding_r[d] = ker_range - desc()->padding[1][d];
+    }
+
+    // the weights are transformed anyway, let the kernel pick their layout
+    const int wei_ndims = desc()->weights_desc.ndims;
+    dims_t wei_dims;
+    array_copy(wei_dims, desc()->weights_desc.dims, wei_ndims);
+    nstl::swap(wei_dims[with_groups()], wei_dims[with_groups() + 1]);
+    memory_desc_t wei_md;
+    CHECK(dnnl_memory_desc_init_by_tag(&wei_md, wei_ndims, wei_dims,
+            data_type::bf16, format_tag::any));
+
+    convolution_desc_t cd;
+    if (conv_desc_init(&cd, prop_kind::forward_training,
+                alg_kind::convolution_direct, &desc()->diff_dst_desc, &wei_md,
+                nullptr, &desc()->diff_src_desc, strides, desc()->dilates,
+                padding_l, padding_r)
+            != status::success)
+        return status::unimplemented;
+
+    CHECK(create_amx_fwd_pd(fwd_pd_, engine, cd));
+    return fwd_pd_->weights_md()->extra.flags == 0 ? status::success
+                                                   : status::unimplemented;
+}
+
+void jit_avx512_core_amx_convolution_bwd_data_t::pd_t::init_scratchpad() {
+    auto scratchpad = scratchpad_registry().registrar();
+    scratchpad.book<char>(key_conv_tr_wei,
+            memory_desc_wrapper(fwd_pd_->weights_md()).size());
+    scratchpad.book(key_nested, fwd_pd_->scratchpad_registry());
+}
+
+void jit_avx512_core_amx_convolution_bwd_data_t::transform_weights(
+        const bfloat16_t *wei, bfloat16_t *tr_wei) const {
+    const memory_desc_wrapper wei_d(pd()->weights_md());
+    const memory_desc_wrapper tr_wei_d(pd()->fwd_pd_->weights_md());
+
+    const bool with_groups = pd()->with_groups();
+    const bool is_1d = pd()->ndims() == 3;
+    const dim_t G = pd()->G();
+    const dim_t OC = pd()->OC() / G;
+    const dim_t IC = pd()->IC() / G;
+    const dim_t KH = pd()->KH();
+    const dim_t KW = pd()->KW();
+
+    auto off = [&](const memory_desc_wrapper &d, dim_t g, dim_t o, dim_t i,
+                       dim_t kh, dim_t kw) {
+        dims_t pos;
+        int p = 0;
+        if (with_groups) pos[p++] = g;
+        pos[p++] = o;
+        pos[p++] = i;
+        if (!is_1d) pos[p++] = kh;
+        pos[p++] = kw;
+        return d.off_v(pos);
+    };
+
+    // the kernel reads the channels padded up to the block size
+    if (tr_wei_d.nelems(false) != tr_wei_d.nelems(true))
+        memset(tr_wei, 0, tr_wei_d.size());
+
+    parallel_nd(G, OC, IC, KH, [&](dim_t g, dim_t oc, dim_t ic, dim_t kh) {
+        for (dim_t kw = 0; kw < KW; ++kw)
+            tr_wei[off(tr_wei_d, g, ic, oc, KH - 1 - kh, KW - 1 - kw)]
+                    = wei[off(wei_d, g, oc, ic, kh, kw)];
+    });
+}
+
+status_t jit_avx512_core_amx_convolution_bwd_data_t::execute(
+        const exec_ctx_t &ctx) const {
+    const auto scratchpad = ctx.get_scratchpad_grantor();
+    engine_t *engine = ctx.stream()->engine();
+
+    auto weights = CTX_IN_MEM(const bfloat16_t *, DNNL_ARG_WEIGHTS);
+    transform_weights(weights, scratchpad.get<bfloat16_t>(key_conv_tr_wei));
+    memory_t tr_wei(engine, pd()->fwd_pd_->weights_md(),
+            scratchpad.get_memory_storage(key_conv_tr_wei), false);
+
+    const auto &args = ctx.args();
+    exec_args_t fwd_args;
+    fwd_args[DNNL_ARG_SRC] = args.at(DNNL_ARG_DIFF_DST);
+    fwd_args[DNNL_ARG_WEIGHTS] = {&tr_wei, true};
+    fwd_args[DNNL_ARG_DST] = args.at(DNNL_ARG_DIFF_SRC);
+    exec_ctx_t fwd_ctx(ctx, std::move(fwd_args));
+
+    nested_scratchpad_t ns(ctx, key_nested, fwd_p_);
+    fwd_ctx.set_scratchpad_grantor(ns.grantor());
+    return fwd_p_->execute(fwd_ctx);
+}
+
+jit_avx512_core_amx_convolution_bwd_weights_t::pd_t::pd_t(const pd_t &other)
+    : cpu_convolution_bwd_weights_pd_t(other)
+    , fwd_pd_(other.fwd_pd_->clone()) {
+    for (const auto &r_pd : other.reorder_pds_)
+        reorder_pds_.emplace_back(r_pd->clone());
+}
+
+status_t jit_avx512_core_amx_convolution_bwd_weights_t::pd_t::init(
+        engine_t *engine) {
+    using namespace data_type;
+    using namespace format_tag;
+    bool ok = desc()->prop_kind == prop_kind::backward_weights
+            && set_default_alg_kind(alg_kind::convolution_direct)
+            && mayiuse(avx512_core_bf16_amx_bf16) && one_of(ndims(), 3, 4)
+            && !with_groups()
+            && everyone_is(bf16, src_md_.data_type, diff_dst_md_.data_type)
+            && one_of(diff_weights_md_.data_type, f32, bf16)
+            && IMPLICATION(with_bias(),
+                    one_of(diff_bias_md_.data_type, f32, bf16))
+            && attr()->has_default_values() && !has_zero_dim_memory();
+    if (!ok) return status::unimplemented;
+
+    const bool is_1d = ndims() == 3;
+    const auto dat_tag = is_1d ? nwc : nhwc;
+    const auto wei_tag = is_1d ? oiw : oihw;
+    if (!set_default_formats_common(dat_tag, wei_tag, dat_tag))
+        return status::unimplemented;
+
+    CHECK(init_fwd_pd(engine));
+
+    memory_desc_t src_md, diff_dst_md, diff_weights_md;
+    CHECK(swap_axes(src_md, src_md_, 0, 1));
+    CHECK(swap_axes(diff_dst_md, diff_dst_md_, 0, 1));
+    CHECK(swap_axes(diff_weights_md, *fwd_pd_->dst_md(), 0, 1));
+    CHECK(add_reorder(engine, src_md, *fwd_pd_->src_md()));
+    CHECK(add_reorder(engine, diff_dst_md, *fwd_pd_->weights_md()));
+    CHECK(add_reorder(engine, diff_weights_md, diff_weights_md_));
+
+    init_scratchpad();
+    return status::success;
+}
+
+status_t jit_avx512_core_amx_convolution_bwd_weights_t::pd_t::init_fwd_pd(
+        engine_t *engine) {
+    const int nd = ndims();
+    dims_t tr_src_dims = {IC(), MB()};
+    dims_t tr_diff_dst_dims = {OC(), MB()};
+    dims_t tr_diff_wei_dims = {IC(), OC()};
+    dims_t strides, dilates, padding_l, padding_r;
+    for (int d = 0; d < nd - 2; ++d) {
+        const dim_t in = src_md_.dims[2 + d];
+        const dim_t out = diff_dst_md_.dims[2 + d];
+        const dim_t ker = diff_weights_md_.dims[2 + d];
+        const dim_t str = desc()->strides[d];
+        const dim_t dil = desc()->dilates[d];
+        tr_src_dims[2 + d] = in;
+        tr_diff_dst_dims[2 + d] = out;
+        tr_diff_wei_dims[2 + d] = ker;
+        strides[d] = dil + 1;
+        dilates[d] = str - 1;
+        padding_l[d] = desc()->padding[0][d];
+        padding_r[d] = (ker - 1) * (dil + 1) + (out - 1) * str + 1 - in
+                - padding_l[d];
+    }
+
+    memory_desc_t tr_src_md, tr_diff_dst_md, tr_diff_wei_md;
+    CHECK(dnnl_memory_desc_init_by_tag(&tr_src_md, nd, tr_src_dims,
+            data_type::bf16, format_tag::any));
+    CHECK(dnnl_memory_desc_init_by_tag(&tr_diff_dst_md, nd, tr_diff_dst_dims,
+            data_type::bf16, format_tag::any));
+    CHECK(dnnl_memory_desc_init_by_tag(&tr_diff_wei_md, nd, tr_diff_wei_dims,
+            data_type::f32, format_tag::any));
+
+    convolution_desc_t cd;
+    if (conv_desc_init(&cd, prop_kind::forward_training,
+                alg_kind::convolution_direct, &tr_src_md, &tr_diff_dst_md,
+                nullptr, &tr_diff_wei_md, strides, dilates, padding_l,
+                padding_r)
+            != status::success)
+        return status::unimplemented;
+
+    CHECK(create_amx_fwd_pd(fwd_pd_, engine, cd));
+    return fwd_pd_->weights_md()->extra.flags == 0 ? status::success
+                                                   : status::unimplemented;
+}
+
+status_t jit_avx512_core_amx_convolution_bwd_weights_t::pd_t::add_reorder(
+        engine_t *engine, const memory_desc_t &src_md,
+        const memory_desc_t &dst_md) {
+    primitive_attr_t r_attr;
+    r_attr.set_scratchpad_mode(scratchpad_mode::user);
+    for (auto r = engine->get_reorder_implementation_list(&src_md, &dst_md);
+            *r; ++r) {
+        reorder_pd_t *r_pd = nullptr;
+        if ((*r)(&r_pd, engine, &r_attr, engine, &src_md, engine, &dst_md)
+                == status::success) {
+            reorder_pds_.emplace_back(r_pd);
+            return status::success;
+        }
+    }
+    return status::unimplemented;
+}
+
+void jit_avx512_core_amx_convolution_bwd_weights_t::pd_t::init_scratchpad() {
+    auto scratchpad = scratchpad_registry().registrar();
+    scratchpad.book<char>(
+            key_conv_tr_src, memory_desc_wrapper(fwd_pd_->src_md()).size());
+    scratchpad.book<char>(key_conv_tr_diff_dst,
+            memory_desc_wrapper(fwd_pd_->weights_md()).size());
+    scratchpad.book<char>(key_conv_wei_reduction,
+            memory_desc_wrapper(fwd_pd_->dst_md()).size());
+    scratchpad.book(key_nested, fwd_pd_->scratchpad_registry());
+    for (size_t i = 0; i < reorder_pds_.size(); ++i)
+        scratchpad.book(key_nested_multiple + (int)i,
+                reorder_pds_[i]->scratchpad_registry());
+}
+
+status_t jit_avx512_core_amx_convolution_bwd_weights_t::init(
+        engine_t *engine) {
+    CHECK(pd()->fwd_pd_->create_primitive(fwd_p_, engine));
+    reorders_.resize(pd()->reorder_pds_.size());
+    for (size_t i = 0; i < reorders_.size(); ++i)
+        CHECK(pd()->reorder_pds_[i]->create_primitive(reorders_[i], engine));
+    return status::success;
+}
+
+status_t jit_avx512_core_amx_convolution_bwd_weights_t::execute_reorder(
+        const exec_ctx_t &ctx, int idx, const memory_storage_t &src,
+        const memory_storage_t &dst) const {
+    engine_t *engine = ctx.stream()->engine();
+    const auto &r_pd = pd()->reorder_pds_[idx];
+    memory_t src_mem(engine, r_pd->src_md(), src.clone(), false);
+    memory_t dst_mem(engine, r_pd->dst_md(), dst.clone(), false);
+
+    exec_args_t r_args;
+    r_args[DNNL_ARG_FROM] = {&src_mem, true};
+    r_args[DNNL_ARG_TO] = {&dst_mem, false};
+    exec_ctx_t r_ctx(ctx, std::move(r_args));
+
+    nested_scratchpad_t ns(ctx, key_nested_multiple + idx, reorders_[idx]);
+    r_ctx.set_scratchpad_grantor(ns.grantor());
+    return reorders_[idx]->execute(r_ctx);
+}
+
+void jit_avx512_core_amx_convolution_bwd_weights_t::compute_diff_bias(
+        const exec_ctx_t &ctx) const {
+    auto diff_dst = CTX_IN_MEM(const bfloat16_t *, DNNL_ARG_DIFF_DST);
+    auto diff_bias = CTX_OUT_MEM(void *, DNNL_ARG_DIFF_BIAS);
+
+    const memory_desc_wrapper diff_dst_d(pd()->diff_dst_md());
+    const memory_desc_wrapper diff_bias_d(pd()->diff_weights_md(1));
+    const bool is_1d = pd()->ndims() == 3;
+    const dim_t MB = pd()->MB();
+    const dim_t OH = pd()->OH();
+    const dim_t OW = pd()->OW();
+
+    parallel_nd(pd()->OC(), [&](dim_t oc) {
+        float db = 0;
+        for_(dim_t mb = 0; mb < MB; ++mb)
+        for_(dim_t oh = 0; oh < OH; ++oh)
+        for (dim_t ow = 0; ow < OW; ++ow) {
+            const auto off = is_1d ? diff_dst_d.off(mb, oc, ow)
+                                   : diff_dst_d.off(mb, oc, oh, ow);
+            db += (float)diff_dst[off];
+        }
+        const auto bia_off = diff_bias_d.off(oc);
+        if (diff_bias_d.data_type() == data_type::bf16)
+            ((bfloat16_t *)diff_bias)[bia_off] = db;
+        else
+            ((float *)diff_bias)[bia_off] = db;
+    });
+}
+
+status_t jit_avx512_core_amx_convolution_bwd_weights_t::execute(
+        const exec_ctx_t &ctx) const {
+    const auto scratchpad = ctx.get_scratchpad_grantor();
+    engine_t *engine = ctx.stream()->engine();
+    const auto &fwd_pd = pd()->fwd_pd_;
+
+    auto tr_src_storage = scratchpad.get_memory_storage(key_conv_tr_src);
+    auto tr_diff_dst_storage
+            = scratchpad.get_memory_storage(key_conv_tr_diff_dst);
+    auto tr_diff_wei_storage
+            = scratchpad.get_memory_storage(key_conv_wei_reduction);
+
+    CHECK(execute_reorder(ctx, pd_t::tr_src, CTX_IN_STORAGE(DNNL_ARG_SRC),
+            *tr_src_storage));
+    CHECK(execute_reorder(ctx, pd_t::tr_diff_dst,
+            CTX_IN_STORAGE(DNNL_ARG_DIFF_DST), *tr_diff_dst_storage));
+
+    memory_t tr_src(engine, fwd_pd->src_md(), tr_src_storage->clone(), false);
+    memory_t tr_diff_dst(engine, fwd_pd->weights_md(),
+            tr_diff_dst_storage->clone(), false);
+    memory_t tr_diff_wei(engine, fwd_pd->dst_md(),
+            tr_diff_wei_storage->clone(), false);
+
+    exec_args_t fwd_args;
+    fwd_args[DNNL_ARG_SRC] = {&tr_src, true};
+    fwd_args[DNNL_ARG_WEIGHTS] = {&tr_diff_dst, true};
+    fwd_args[DNNL_ARG_DST] = {&tr_diff_wei, false};
+    exec_ctx_t fwd_ctx(ctx, std::move(fwd_args));
+
+    {
+        nested_scratchpad_t ns(ctx, key_nested, fwd_p_);
+        fwd_ctx.set_scratchpad_grantor(ns.grantor());
+        CHECK(fwd_p_->execute(fwd_ctx));
+    }
+
+    CHECK(execute_reorder(ctx, pd_t::tr_diff_weights, *tr_diff_wei_storage,
+            CTX_OUT_STORAGE(DNNL_ARG_DIFF_WEIGHTS)));
+
+    if (pd()->with_bias()) compute_diff_bias(ctx);
+    return status::success;
+}
+
 } // namespace x64
 } // namespace cpu
 } // namespace impl
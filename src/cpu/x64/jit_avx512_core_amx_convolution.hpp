@@ -17,6 +17,10 @@
 #ifndef CPU_X64_JIT_AVX512_CORE_AMX_CONVOLUTION_HPP
 #define CPU_X64_JIT_AVX512_CORE_AMX_CONVOLUTION_HPP
 
+#include <memory>
+#include <vector>
+
+#include "common/bfloat16.hpp"
 #include "common/c_types_map.hpp"
 #include "common/dnnl_thread.hpp"
 #include "common/memory_tracking.hpp"
@@ -123,6 +127,98 @@ private:
     std::unique_ptr<jit_avx512_core_amx_fwd_kernel_t> kernel_;
 };
 
+// Backward by data is computed by the forward AMX kernel: with unit strides
+// diff_src is the convolution of diff_dst with the spatially flipped weights
+// whose input and output channels are swapped. The weights are transformed
+// into the scratchpad on every execution.
+struct jit_avx512_core_amx_convolution_bwd_data_t : public primitive_t {
+    struct pd_t : public cpu_convolution_bwd_data_pd_t {
+        pd_t(const convolution_desc_t *adesc, const primitive_attr_t *attr,
+                const convolution_fwd_pd_t *hint_fwd_pd)
+            : cpu_convolution_bwd_data_pd_t(adesc, attr, hint_fwd_pd) {}
+
+        pd_t(const pd_t &other)
+            : cpu_convolution_bwd_data_pd_t(other)
+            , fwd_pd_(other.fwd_pd_->clone()) {}
+
+        DECLARE_COMMON_PD_T(
+                JIT_IMPL_NAME_HELPER("jit:", avx512_core_bf16_amx_bf16, ""),
+                jit_avx512_core_amx_convolution_bwd_data_t);
+
+        status_t init(engine_t *engine);
+
+        std::unique_ptr<primitive_desc_t> fwd_pd_;
+
+    private:
+        status_t init_fwd_pd(engine_t *engine);
+        void init_scratchpad();
+    };
+
+    jit_avx512_core_amx_convolution_bwd_data_t(const pd_t *apd)
+        : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override {
+        return pd()->fwd_pd_->create_primitive(fwd_p_, engine);
+    }
+
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+    void transform_weights(const bfloat16_t *wei, bfloat16_t *tr_wei) const;
+
+    std::shared_ptr<primitive_t> fwd_p_;
+};
+
+// Backward by weights is computed by the forward AMX kernel as well, with
+// the minibatch taking the role of the input channels: the transposed src
+// [IC][MB][IH][IW] convolved with the transposed diff_dst [OC][MB][OH][OW]
+// gives the transposed diff_weights [IC][OC][KH][KW]. The strides and the
+// dilations of the original convolution swap places. The transpositions are
+// done by nested reorders, the bias is reduced separately.
+struct jit_avx512_core_amx_convolution_bwd_weights_t : public primitive_t {
+    struct pd_t : public cpu_convolution_bwd_weights_pd_t {
+        pd_t(const convolution_desc_t *adesc, const primitive_attr_t *attr,
+                const convolution_fwd_pd_t *hint_fwd_pd)
+            : cpu_convolution_bwd_weights_pd_t(adesc, attr, hint_fwd_pd) {}
+
+        pd_t(const pd_t &other);
+
+        DECLARE_COMMON_PD_T(
+                JIT_IMPL_NAME_HELPER("jit:", avx512_core_bf16_amx_bf16, ""),
+                jit_avx512_core_amx_convolution_bwd_weights_t);
+
+        status_t init(engine_t *engine);
+
+        enum { tr_src = 0, tr_diff_dst, tr_diff_weights, n_reorders };
+
+        std::unique_ptr<primitive_desc_t> fwd_pd_;
+        std::vector<std::unique_ptr<primitive_desc_t>> reorder_pds_;
+
+    private:
+        status_t init_fwd_pd(engine_t *engine);
+        status_t add_reorder(engine_t *engine, const memory_desc_t &src_md,
+                const memory_desc_t &dst_md);
+        void init_scratchpad();
+    };
+
+    jit_avx512_core_amx_convolution_bwd_weights_t(const pd_t *apd)
+        : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+    status_t execute_reorder(const exec_ctx_t &ctx, int idx,
+            const memory_storage_t &src, const memory_storage_t &dst) const;
+    void compute_diff_bias(const exec_ctx_t &ctx) const;
+
+    std::shared_ptr<primitive_t> fwd_p_;
+    std::vector<std::shared_ptr<primitive_t>> reorders_;
+};
+
 } // namespace x64
 } // namespace cpu
 } // namespace impl
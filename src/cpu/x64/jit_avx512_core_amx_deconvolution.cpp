@@ -0,0 +1,185 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <string.h>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/primitive_iterator.hpp"
+#include "common/stream.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/x64/jit_avx512_core_amx_deconvolution.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+using namespace dnnl::impl::memory_tracking::names;
+using namespace dnnl::impl::utils;
+
+status_t jit_avx512_core_amx_deconvolution_fwd_t::pd_t::init(
+        engine_t *engine) {
+    using namespace data_type;
+    using smask_t = primitive_attr_t::skip_mask_t;
+
+    const auto src_type = src_md_.data_type;
+    const auto wei_type = weights_md_.data_type;
+    const auto dst_type = dst_md_.data_type;
+    const bool is_int8 = one_of(src_type, u8, s8) && wei_type == s8
+            && one_of(dst_type, f32, s32, s8, u8);
+    const bool is_bf16 = everyone_is(bf16, src_type, wei_type)
+            && one_of(dst_type, f32, bf16);
+
+    bool ok = is_fwd()
+            && desc()->alg_kind == alg_kind::deconvolution_direct
+            && mayiuse(is_int8 ? avx512_core_bf16_amx_int8
+                               : avx512_core_bf16_amx_bf16)
+            && (is_int8 || is_bf16) && one_of(ndims(), 3, 4)
+            && attr()->has_default_values(smask_t::oscale | smask_t::post_ops)
+            && !has_zero_dim_memory();
+    if (!ok) return status::unimplemented;
+
+    CHECK(init_convolution(engine));
+
+    if (weights_md_.format_kind == format_kind::any)
+        weights_md_ = *conv_pd_->weights_md();
+    if (src_md_.format_kind == format_kind::any)
+        src_md_ = *conv_pd_->src_md();
+    if (dst_md_.format_kind == format_kind::any)
+        dst_md_ = *conv_pd_->dst_md();
+    if (bias_md_.format_kind == format_kind::any)
+        bias_md_ = *conv_pd_->weights_md(1);
+
+    init_scratchpad();
+    return status::success;
+}
+
+status_t jit_avx512_core_amx_deconvolution_fwd_t::pd_t::init_convolution(
+        engine_t *engine) {
+    const int sp_ndims = ndims() - 2;
+    dims_t strides, padding_l, padding_r;
+    for (int d = 0; d < sp_ndims; ++d) {
+        if (desc()->strides[d] != 1) return status::unimplemented;
+        const dim_t ker = desc()->weights_desc.dims[with_groups() + 2 + d];
+        const dim_t ker_range = (ker - 1) * (desc()->dilates[d] + 1);
+        strides[d] = 1;
+        padding_l[d] = ker_range - desc()->padding[0][d];
+        padding_r[d] = ker_range - desc()->padding[1][d];
+    }
+
+    // the weights are flipped anyway, let the kernel pick their layout
+    memory_desc_t wei_md = desc()->weights_desc;
+    CHECK(dnnl_memory_desc_init_by_tag(&wei_md, wei_md.ndims, wei_md.dims,
+            wei_md.data_type, format_tag::any));
+
+    convolution_desc_t cd;
+    if (conv_desc_init(&cd, desc()->prop_kind,
+                alg_kind::convolution_direct, &desc()->src_desc, &wei_md,
+                &desc()->bias_desc, &desc()->dst_desc, strides,
+                desc()->dilates, padding_l, padding_r)
+            != status::success)
+        return status::unimplemented;
+
+    primitive_attr_t conv_attr(*attr());
+    if (!conv_attr.is_initialized()) return status::out_of_memory;
+    conv_attr.set_scratchpad_mode(scratchpad_mode::user);
+
+    dnnl_primitive_desc_iterator it(
+            engine, (const op_desc_t *)&cd, &conv_attr, nullptr);
+    if (!it.is_initialized()) return status::out_of_memory;
+    if (++it == it.end()) return status::unimplemented;
+    conv_pd_.reset(it.fetch_once());
+
+    // Flipping the weights on every call only pays off with the AMX kernel
+    const bool is_amx = strstr(conv_pd_->name(), "amx") != nullptr;
+    return is_amx && conv_pd_->weights_md()->extra.flags == 0
+            ? status::success
+            : status::unimplemented;
+}
+
+void jit_avx512_core_amx_deconvolution_fwd_t::pd_t::init_scratchpad() {
+    auto scratchpad = scratchpad_registry().registrar();
+    scratchpad.book<char>(key_conv_tr_wei,
+            memory_desc_wrapper(conv_pd_->weights_md()).size());
+    scratchpad.book(key_nested, conv_pd_->scratchpad_registry());
+}
+
+void jit_avx512_core_amx_deconvolution_fwd_t::flip_weights(
+        const char *wei, char *tr_wei) const {
+    const memory_desc_wrapper wei_d(pd()->weights_md());
+    const memory_desc_wrapper tr_wei_d(pd()->conv_pd_->weights_md());
+    const size_t dt_size = wei_d.data_type_size();
+
+    const bool with_groups = pd()->with_groups();
+    const bool is_1d = pd()->ndims() == 3;
+    const dim_t G = pd()->G();
+    const dim_t OC = pd()->OC() / G;
+    const dim_t IC = pd()->IC() / G;
+    const dim_t KH = pd()->KH();
+    const dim_t KW = pd()->KW();
+
+    auto off = [&](const memory_desc_wrapper &d, dim_t g, dim_t oc, dim_t ic,
+                       dim_t kh, dim_t kw) {
+        dims_t pos;
+        int p = 0;
+        if (with_groups) pos[p++] = g;
+        pos[p++] = oc;
+        pos[p++] = ic;
+        if (!is_1d) pos[p++] = kh;
+        pos[p++] = kw;
+        return d.off_v(pos) * dt_size;
+    };
+
+    // the kernel reads the channels padded up to the block size
+    if (tr_wei_d.nelems(false) != tr_wei_d.nelems(true))
+        memset(tr_wei, 0, tr_wei_d.size());
+
+    parallel_nd(G, OC, IC, KH, [&](dim_t g, dim_t oc, dim_t ic, dim_t kh) {
+        for (dim_t kw = 0; kw < KW; ++kw)
+            memcpy(tr_wei + off(tr_wei_d, g, oc, ic, KH - 1 - kh, KW - 1 - kw),
+                    wei + off(wei_d, g, oc, ic, kh, kw), dt_size);
+    });
+}
+
+status_t jit_avx512_core_amx_deconvolution_fwd_t::execute(
+        const exec_ctx_t &ctx) const {
+    const auto scratchpad = ctx.get_scratchpad_grantor();
+    engine_t *engine = ctx.stream()->engine();
+
+    auto weights = CTX_IN_MEM(const char *, DNNL_ARG_WEIGHTS);
+    flip_weights(weights, scratchpad.get<char>(key_conv_tr_wei));
+    memory_t tr_wei(engine, pd()->conv_pd_->weights_md(),
+            scratchpad.get_memory_storage(key_conv_tr_wei), false);
+
+    // src, bias, dst, runtime scales and post-op arguments are shared
+    exec_args_t conv_args(ctx.args());
+    conv_args[DNNL_ARG_WEIGHTS] = {&tr_wei, true};
+    exec_ctx_t conv_ctx(ctx, std::move(conv_args));
+
+    nested_scratchpad_t ns(ctx, key_nested, conv_p_);
+    conv_ctx.set_scratchpad_grantor(ns.grantor());
+    return conv_p_->execute(conv_ctx);
+}
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino^=l0,\:0,N-s
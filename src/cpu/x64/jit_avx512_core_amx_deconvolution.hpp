@@ -0,0 +1,83 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_JIT_AVX512_CORE_AMX_DECONVOLUTION_HPP
+#define CPU_X64_JIT_AVX512_CORE_AMX_DECONVOLUTION_HPP
+
+#include <memory>
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+
+#include "cpu/cpu_deconvolution_pd.hpp"
+
+#include "cpu/x64/cpu_isa_traits.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+// With unit strides a deconvolution is the forward convolution of its src
+// with the spatially flipped weights, padded by (K - 1) * (D + 1) - pad. The
+// AMX convolution is run as a nested primitive on weights flipped into the
+// scratchpad, so that bias, output scales and post-ops come for free.
+struct jit_avx512_core_amx_deconvolution_fwd_t : public primitive_t {
+    struct pd_t : public cpu_deconvolution_fwd_pd_t {
+        pd_t(const deconvolution_desc_t *adesc, const primitive_attr_t *attr,
+                const deconvolution_fwd_pd_t *hint_fwd_pd)
+            : cpu_deconvolution_fwd_pd_t(adesc, attr, hint_fwd_pd) {}
+
+        pd_t(const pd_t &other)
+            : cpu_deconvolution_fwd_pd_t(other)
+            , conv_pd_(other.conv_pd_->clone()) {}
+
+        DECLARE_COMMON_PD_T(conv_pd_->name(),
+                jit_avx512_core_amx_deconvolution_fwd_t);
+
+        status_t init(engine_t *engine);
+
+        std::unique_ptr<primitive_desc_t> conv_pd_;
+
+    private:
+        status_t init_convolution(engine_t *engine);
+        void init_scratchpad();
+    };
+
+    jit_avx512_core_amx_deconvolution_fwd_t(const pd_t *apd)
+        : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override {
+        return pd()->conv_pd_->create_primitive(conv_p_, engine);
+    }
+
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+    void flip_weights(const char *wei, char *tr_wei) const;
+
+    std::shared_ptr<primitive_t> conv_p_;
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino^=l0,\:0,N-s
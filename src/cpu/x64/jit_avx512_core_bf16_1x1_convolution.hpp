@@ -192,9 +192,12 @@ struct jit_avx512_core_bf16_1x1_convolution_fwd_t : public primitive_t {
             // for 1x1: Check that no better ISA is available.
             // for dw: Always fuse with same ISA.
             // Caveat: May be a better dw conv exists.
+            // The AMX 1x1 convolution does not support the depthwise fusion,
+            // so the chain is fused here even if AMX is available: the
+            // intermediate tensor is too large for L2 and running the two
+            // convolutions one after another is bound by the memory traffic.
 
-            bool ok = !mayiuse(avx512_core_bf16_amx_bf16)
-                    && (attr_1x1.post_ops_.find(primitive_kind::sum) == -1)
+            bool ok = (attr_1x1.post_ops_.find(primitive_kind::sum) == -1)
                     // TODO: Below may be further tuned.
                     && (l2_cache * 2 < src_d.size())
                     // load_grp_count check can be redundant due to l2 check
@@ -252,6 +255,8 @@ struct jit_avx512_core_bf16_1x1_convolution_fwd_t : public primitive_t {
             while (jcp_1x1.nb_load % jcp_1x1.nb_load_blocking != 0)
                 --jcp_1x1.nb_load_blocking;
             jcp_1x1.nb_load_blocking_max = jcp_1x1.nb_load_blocking;
+            fit_dw_conv_buffer_to_l2(jcp_1x1, jcp_dw->kh, jcp_dw->iw,
+                    types::data_type_size(dw_conv_pd_->src_md()->data_type));
 
             while (jcp_1x1.nb_load_blocking % jcp_dw->nb_ch_blocking != 0)
                 --jcp_dw->nb_ch_blocking;
@@ -16,6 +16,7 @@
 
 #include "common/bfloat16.hpp"
 #include "common/c_types_map.hpp"
+#include "common/eltwise_pd.hpp"
 #include "common/math_utils.hpp"
 #include "common/nstl.hpp"
 #include "common/type_helpers.hpp"
@@ -942,6 +943,53 @@ void _jit_avx512_core_bf16_bwd_data_kernel<Vmm>::store_output(int ur_w) {
     if (!isa_has_bf16(jcp.isa)) bf16_emu_->init_vcvtneps2bf16();
     const int ic_tail = jcp.ic_tail;
 
+    // The bias and the post-ops of a deconvolution, whose destination is
+    // diff_src here. All the output channels are accumulated by a single
+    // call, so they are applied right before the store.
+    if (jcp.with_sum) {
+        for (int k = 0; k < jcp.nb_ic_blocking; k++) {
+            for (int j = 0; j < ur_w; j++) {
+                // mask only needed for last ic_block
+                bool mask_flag = ic_tail && k + 1 == jcp.nb_ic_blocking;
+                Vmm vmm = vmm_dsrc(j, k);
+                size_t aux_diff_src_offset = get_diff_src_offset(j, k);
+                auto addr = EVEX_compress_addr(reg_src, aux_diff_src_offset);
+                if (jcp.dst_dt == data_type::bf16) {
+                    vpmovzxwd(may_be_mask_vmm(vmm_prev_dsrc, mask_flag, true),
+                            addr);
+                    vpslld(vmm_prev_dsrc, vmm_prev_dsrc, 16);
+                    vaddps(vmm, vmm_prev_dsrc);
+                } else {
+                    vaddps(may_be_mask_vmm(vmm, mask_flag, true), addr);
+                }
+            }
+        }
+    }
+
+    if (jcp.with_bias) {
+        mov(reg_bias, ptr[param1 + GET_OFF(bias)]);
+        for (int k = 0; k < jcp.nb_ic_blocking; k++) {
+            int bias_offset = jcp.typesize_bia * k * jcp.ic_block;
+            for (int j = 0; j < ur_w; j++) {
+                // mask only needed for last ic_block
+                bool mask_flag = ic_tail && k + 1 == jcp.nb_ic_blocking;
+                Vmm vmm = vmm_dsrc(j, k);
+                if (jcp.bia_dt == data_type::bf16) {
+                    vpmovzxwd(may_be_mask_vmm(vmm_bias, mask_flag, true),
+                            EVEX_compress_addr(reg_bias, bias_offset));
+                    vpslld(vmm_bias, vmm_bias, 16);
+                    vaddps(vmm, vmm_bias);
+                } else
+                    vaddps(may_be_mask_vmm(vmm, mask_flag, true),
+                            EVEX_compress_addr(reg_bias, bias_offset));
+            }
+        }
+    }
+
+    if (jcp.with_eltwise)
+        eltwise_injector_->compute_vector_range(
+                0, jcp.nb_ic_blocking * jcp.ur_w);
+
     if (jcp.dst_dt == data_type::f32) {
         for (int k = 0; k < jcp.nb_ic_blocking; k++)
             for (int j = 0; j < ur_w; j++) {
@@ -1368,15 +1416,28 @@ void _jit_avx512_core_bf16_bwd_data_kernel<Vmm>::generate() {
     L(end_label);
 
     postamble();
+
+    if (jcp.with_eltwise) eltwise_injector_->prepare_table();
+}
+
+void jit_avx512_core_bf16_bwd_data_kernel::init_scratchpad(
+        memory_tracking::registrar_t &scratchpad, const jit_conv_conf_t &jcp) {
+    using namespace memory_tracking::names;
+    if (jcp.with_bias && jcp.ic != jcp.ic_without_padding) {
+        assert(jcp.ngroups == 1);
+        scratchpad.book(key_conv_padded_bias, jcp.ic, jcp.typesize_bia);
+    }
 }
 
 status_t jit_avx512_core_bf16_bwd_data_kernel::init_conf(jit_conv_conf_t &jcp,
         const convolution_desc_t &cd, memory_desc_t &diff_src_md,
-        memory_desc_t &weights_md, memory_desc_t &diff_dst_md, int nthreads) {
+        memory_desc_t &weights_md, memory_desc_t &diff_dst_md,
+        memory_desc_t &bias_md, const primitive_attr_t &attr, int nthreads) {
 
     const memory_desc_wrapper diff_src_d(&diff_src_md);
     const memory_desc_wrapper weights_d(&weights_md);
     const memory_desc_wrapper diff_dst_d(&diff_dst_md);
+    const memory_desc_wrapper bias_d(&bias_md);
 
     const bool with_groups = weights_d.ndims() == diff_src_d.ndims() + 1;
     int ndims = diff_src_d.ndims();
@@ -1394,6 +1455,7 @@ status_t jit_avx512_core_bf16_bwd_data_kernel::init_conf(jit_conv_conf_t &jcp,
     jcp.oc = diff_dst_d.dims()[1] / jcp.ngroups;
     jcp.oc_without_padding = jcp.oc;
     jcp.ic = diff_src_d.dims()[1] / jcp.ngroups;
+    jcp.ic_without_padding = jcp.ic;
 
     jcp.id = (ndims == 5) ? diff_src_d.dims()[2] : 1;
     jcp.ih = (ndims == 3) ? 1 : diff_src_d.dims()[ndims - 2];
@@ -1488,6 +1550,36 @@ status_t jit_avx512_core_bf16_bwd_data_kernel::init_conf(jit_conv_conf_t &jcp,
     jcp.ic_tail = is_data_layout_nxc ? jcp.ic % jcp.simd_w : 0;
     jcp.oc_tail = is_data_layout_nxc ? jcp.oc % jcp.simd_w : 0;
 
+    // The bias and the post-ops are set by a deconvolution, whose destination
+    // is diff_src here.
+    jcp.with_bias = cd.bias_desc.format_kind != format_kind::undef;
+    jcp.bia_dt = jcp.with_bias ? cd.bias_desc.data_type : data_type::undef;
+    jcp.typesize_bia = jcp.with_bias ? types::data_type_size(jcp.bia_dt) : 0;
+    if (jcp.with_bias) {
+        if (!utils::one_of(jcp.bia_dt, data_type::f32, data_type::bf16))
+            return status::unimplemented;
+        if (bias_d.format_kind() == format_kind::any)
+            CHECK(memory_desc_init_by_tag(bias_md, x));
+    }
+
+    if (!jit_avx512_core_bf16_fwd_kernel::post_ops_ok(jcp, attr))
+        return status::unimplemented;
+
+    const auto &p = attr.post_ops_;
+    const int sum_ind = p.find(primitive_kind::sum);
+    jcp.with_sum = sum_ind != -1;
+    if (jcp.with_sum && p.entry_[sum_ind].sum.scale != 1.f)
+        return status::unimplemented;
+    const int eltwise_ind = p.find(primitive_kind::eltwise);
+    jcp.with_eltwise = eltwise_ind != -1;
+    if (jcp.with_eltwise) {
+        jcp.eltwise = p.entry_[eltwise_ind].eltwise;
+        // the padded channels of the blocked layout must stay zero
+        if (jcp.ic != jcp.ic_without_padding
+                && !eltwise_fwd_pd_t::eltwise_preserves_zero(jcp.eltwise))
+            return status::unimplemented;
+    }
+
     format_tag_t wei_tag, dat_tag;
 
     if (jcp.simd_w == 8) {
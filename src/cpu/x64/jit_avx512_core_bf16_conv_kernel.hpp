@@ -269,14 +269,21 @@ struct _jit_avx512_core_bf16_bwd_data_kernel : public jit_generator {
     _jit_avx512_core_bf16_bwd_data_kernel(const jit_conv_conf_t &ajcp)
         : jit_generator(nullptr, ker_code_size, true, avx512_core_bf16)
         , jcp(ajcp)
+        , eltwise_injector_(nullptr)
         , bf16_emu_(nullptr) {
+        if (jcp.with_eltwise)
+            eltwise_injector_ = new jit_uni_eltwise_injector_f32<avx512_core>(
+                    this, jcp.eltwise);
         if (!isa_has_bf16(jcp.isa))
             bf16_emu_ = new bf16_emulation_t(this, bf16_emu_reserv_1,
                     bf16_emu_reserv_2, bf16_emu_reserv_3, bf16_emu_scratch,
                     bf16_emu_reserv_4, bf16_emu_reserv_5);
     }
 
-    ~_jit_avx512_core_bf16_bwd_data_kernel() { delete bf16_emu_; }
+    ~_jit_avx512_core_bf16_bwd_data_kernel() {
+        delete bf16_emu_;
+        delete eltwise_injector_;
+    }
 
     DECLARE_CPU_JIT_AUX_FUNCTIONS(_jit_avx512_core_bf16_bwd_data_kernel_f32)
 
@@ -312,6 +319,8 @@ private:
 
     reg64_t reg_oc = r11;
     reg64_t reg_ic = aux_reg_ker_d;
+    // the weights pointer is reloaded by every compute_loop()
+    reg64_t reg_bias = aux_reg_ker;
 
     Xbyak::Opmask k_ic_tail_mask = Xbyak::Opmask(2);
     Xbyak::Opmask k_ic_tail_mask_extended = Xbyak::Opmask(3);
@@ -357,6 +366,11 @@ private:
     Xbyak::Zmm bf16_emu_reserv_5 = Xbyak::Zmm(30);
 
     Vmm vmm_wei = Vmm(31);
+    // the weights register is free once the accumulation is done
+    Vmm vmm_prev_dsrc = Vmm(31);
+    Vmm vmm_bias = Vmm(31);
+
+    jit_uni_eltwise_injector_f32<avx512_core> *eltwise_injector_;
     bf16_emulation_t *bf16_emu_;
 
     inline void prepare_output(int ur_w);
@@ -464,7 +478,10 @@ struct jit_avx512_core_bf16_bwd_data_kernel {
     static status_t init_conf(jit_conv_conf_t &jcp,
             const convolution_desc_t &cd, memory_desc_t &diff_src_md,
             memory_desc_t &weights_md, memory_desc_t &diff_dst_md,
+            memory_desc_t &bias_md, const primitive_attr_t &attr,
             int nthreads);
+    static void init_scratchpad(memory_tracking::registrar_t &scratchpad,
+            const jit_conv_conf_t &jcp);
     void operator()(const jit_conv_call_s *p) const { (*kernel_)(p); }
     const Xbyak::uint8 *jit_ker() const { return kernel_->jit_ker(); }
 
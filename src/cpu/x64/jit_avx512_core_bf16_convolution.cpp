@@ -391,12 +391,29 @@ void jit_avx512_core_bf16_convolution_fwd_t::execute_forward_3d(
     });
 }
 
+void jit_avx512_core_bf16_convolution_bwd_data_t::prepare_padded_bias(
+        const char *&bias, const memory_tracking::grantor_t &scratchpad) const {
+    if (!pd()->wants_padded_bias()) return;
+
+    const size_t bia_dt_size = pd()->jcp_.typesize_bia;
+    auto padded_bias = scratchpad.template get<char>(
+            memory_tracking::names::key_conv_padded_bias);
+    utils::array_copy(
+            padded_bias, bias, bia_dt_size * pd()->jcp_.ic_without_padding);
+    utils::array_set(padded_bias + bia_dt_size * pd()->jcp_.ic_without_padding,
+            0.f, bia_dt_size * (pd()->jcp_.ic - pd()->jcp_.ic_without_padding));
+    bias = padded_bias;
+}
+
 void jit_avx512_core_bf16_convolution_bwd_data_t ::execute_backward_data_3d(
         const exec_ctx_t &ctx) const {
     auto diff_dst = CTX_IN_MEM(const diff_dst_data_t *, DNNL_ARG_DIFF_DST);
     auto weights = CTX_IN_MEM(const wei_data_t *, DNNL_ARG_WEIGHTS);
+    auto bias = CTX_IN_MEM(const char *, DNNL_ARG_BIAS);
     auto diff_src = CTX_OUT_MEM(char *, DNNL_ARG_DIFF_SRC);
 
+    prepare_padded_bias(bias, ctx.get_scratchpad_grantor());
+
     const memory_desc_wrapper diff_dst_d(pd()->diff_dst_md());
     const memory_desc_wrapper diff_src_d(pd()->diff_src_md());
     const memory_desc_wrapper weights_d(pd()->weights_md(0));
@@ -490,6 +507,10 @@ void jit_avx512_core_bf16_convolution_bwd_data_t ::execute_backward_data_3d(
             const int oc_idx = is_ddst_layout_nxc ? g * jcp.oc : g * jcp.nb_oc;
             auto diff_dst_w = diff_dst + diff_dst_d.blk_off(n, oc_idx, od_s);
             auto wht_w = weights + wht_blk_off(weights_d, g, 0, icb, kd_lo);
+            auto bias_w = bias ? bias
+                            + jcp.typesize_bia
+                                    * (g * jcp.ic + icb * jcp.ic_block)
+                               : nullptr;
 
             for (int ij = ih_s; ij < ih_e; ++ij) {
                 int oj, kh_len, kh_lo;
@@ -537,6 +558,7 @@ void jit_avx512_core_bf16_convolution_bwd_data_t ::execute_backward_data_3d(
                 par_conv.filt = wht_w + kh_lo * wht_h_stride;
                 par_conv.kh_padding = kh_len;
                 par_conv.kd_padding = kd_len;
+                par_conv.bias = bias_w;
 
                 (*kernel_)(&par_conv);
             }
@@ -561,8 +583,11 @@ void jit_avx512_core_bf16_convolution_bwd_data_t ::execute_backward_data(
         const exec_ctx_t &ctx) const {
     auto diff_dst = CTX_IN_MEM(const diff_dst_data_t *, DNNL_ARG_DIFF_DST);
     auto weights = CTX_IN_MEM(const wei_data_t *, DNNL_ARG_WEIGHTS);
+    auto bias = CTX_IN_MEM(const char *, DNNL_ARG_BIAS);
     auto diff_src = CTX_OUT_MEM(char *, DNNL_ARG_DIFF_SRC);
 
+    prepare_padded_bias(bias, ctx.get_scratchpad_grantor());
+
     const memory_desc_wrapper diff_dst_d(pd()->diff_dst_md());
     const memory_desc_wrapper diff_src_d(pd()->diff_src_md());
     const memory_desc_wrapper weights_d(pd()->weights_md(0));
@@ -627,6 +652,10 @@ void jit_avx512_core_bf16_convolution_bwd_data_t ::execute_backward_data(
                 diff_dst_w += diff_dst_d.blk_off(n, oc_idx, 0, ow_s);
             }
             auto wht_w = weights + wht_blk_off(weights_d, g, 0, icb);
+            auto bias_w = bias ? bias
+                            + jcp.typesize_bia
+                                    * (g * jcp.ic + icb * jcp.ic_block)
+                               : nullptr;
 
             for (int ij = ih_s; ij < ih_e; ++ij) {
                 int oj, k_len, k_lo;
@@ -674,6 +703,7 @@ void jit_avx512_core_bf16_convolution_bwd_data_t ::execute_backward_data(
                 par_conv.filt = wht_w + k_lo * wht_h_stride;
                 par_conv.kh_padding = k_len;
                 par_conv.iwb = iwb;
+                par_conv.bias = bias_w;
 
                 (*kernel_)(&par_conv);
             }
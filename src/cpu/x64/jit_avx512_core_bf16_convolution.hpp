@@ -133,15 +133,27 @@ struct jit_avx512_core_bf16_convolution_bwd_data_t : public primitive_t {
                             || expect_data_types(data_type::bf16,
                                     data_type::bf16, data_type::undef,
                                     data_type::bf16, data_type::undef))
-                    && attr()->has_default_values() && !has_zero_dim_memory();
+                    && attr()->has_default_values(
+                            primitive_attr_t::skip_mask_t::post_ops)
+                    && !has_zero_dim_memory();
             if (!ok) return status::unimplemented;
 
             status_t status = jit_avx512_core_bf16_bwd_data_kernel::init_conf(
                     jcp_, *desc(), diff_src_md_, weights_md_, diff_dst_md_,
-                    dnnl_get_max_threads());
+                    bias_md_, *attr(), dnnl_get_max_threads());
+            if (status != status::success) return status;
+
+            auto scratchpad = scratchpad_registry().registrar();
+            jit_avx512_core_bf16_bwd_data_kernel::init_scratchpad(
+                    scratchpad, jcp_);
+
             return status;
         }
 
+        // The bias and the post-ops of a deconvolution are applied by the
+        // kernel before diff_src is stored.
+        bool support_bias() const override { return true; }
+
         jit_conv_conf_t jcp_;
     };
 
@@ -169,6 +181,8 @@ struct jit_avx512_core_bf16_convolution_bwd_data_t : public primitive_t {
     }
 
 private:
+    void prepare_padded_bias(const char *&bias,
+            const memory_tracking::grantor_t &scratchpad) const;
     void execute_backward_data(const exec_ctx_t &ctx) const;
     void execute_backward_data_3d(const exec_ctx_t &ctx) const;
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
@@ -587,6 +587,10 @@ inline void jit_avx512_dw_conv_bwd_data_kernel_bf16::apply_filter(
     int stride_h = jcp.stride_h;
     int stride_w = jcp.stride_w;
 
+    const bool layout_nxc = is_layout_nxc();
+    const int ch_stride = layout_nxc ? ch_blk : oh * ow * ch_blk;
+    const int w_stride = layout_nxc ? jcp.ngroups : ch_blk;
+
     Label iter_exit_label;
 
     cmp(reg_kh, 0);
@@ -613,7 +617,7 @@ inline void jit_avx512_dw_conv_bwd_data_kernel_bf16::apply_filter(
 
                 for (int w = 0; w < ur_str_w; w++) {
                     Zmm zmm_acc = get_acc_reg(ch * ur_str_w + w);
-                    int ddst_off = (ch * oh * ow + w) * ch_blk;
+                    int ddst_off = ch * ch_stride + w * w_stride;
                     vpmovzxwd(zmm_dst_reg,
                             ptr[aux1_reg_ddst + ddst_off * jcp.typesize_in]);
 
@@ -625,7 +629,7 @@ inline void jit_avx512_dw_conv_bwd_data_kernel_bf16::apply_filter(
             }
 
             add(aux1_reg_kernel, ch_blk * stride_w * jcp.typesize_in);
-            sub(aux1_reg_ddst, ch_blk * jcp.typesize_in);
+            sub(aux1_reg_ddst, w_stride * jcp.typesize_in);
 
             sub(iter_kw, stride_w);
             cmp(iter_kw, 0);
@@ -633,7 +637,7 @@ inline void jit_avx512_dw_conv_bwd_data_kernel_bf16::apply_filter(
         }
 
         add(aux_reg_kernel, kw * ch_blk * stride_h * jcp.typesize_in);
-        sub(aux_reg_ddst, ow * ch_blk * jcp.typesize_in);
+        sub(aux_reg_ddst, ow * w_stride * jcp.typesize_in);
 
         sub(iter_kh, stride_h);
         cmp(iter_kh, 0);
@@ -650,12 +654,16 @@ inline void jit_avx512_dw_conv_bwd_data_kernel_bf16::store_dsrc(
     int ih = jcp.ih;
     int stride_w = jcp.stride_w;
 
+    const bool layout_nxc = is_layout_nxc();
+    const int ch_stride = layout_nxc ? ch_blk : ih * iw * ch_blk;
+    const int w_stride = layout_nxc ? jcp.ngroups : ch_blk;
+
     if (jcp.dsrc_dt == data_type::bf16 && !isa_has_bf16(jcp.isa))
         bf16_emu_->init_vcvtneps2bf16();
 
     for (int ch = 0; ch < ur_ch_blocks; ch++) {
         for (int w = 0; w < ur_str_w; w++) {
-            int dsrc_off = (ch * ih * iw + w * stride_w) * ch_blk;
+            int dsrc_off = ch * ch_stride + w * stride_w * w_stride;
             auto zmm_dsrc = get_acc_reg(ch * ur_str_w + w);
 
             if (jcp.dsrc_dt == data_type::f32) {
@@ -683,6 +691,8 @@ inline void jit_avx512_dw_conv_bwd_data_kernel_bf16::loop_body(
     Label tail_w_label;
     Label exit_label;
 
+    const int w_stride = is_layout_nxc() ? jcp.ngroups : jcp.ch_block;
+
     L(unrolled_w_label);
     {
         int ur_w = jcp.ur_w;
@@ -697,8 +707,8 @@ inline void jit_avx512_dw_conv_bwd_data_kernel_bf16::loop_body(
         apply_filter(ur_ch_blocks, ur_w);
         store_dsrc(ur_ch_blocks, ur_w);
 
-        add(reg_dsrc, jcp.typesize_out * ur_w * jcp.ch_block * jcp.stride_w);
-        add(reg_ddst, jcp.typesize_in * ur_w * jcp.ch_block);
+        add(reg_dsrc, jcp.typesize_out * ur_w * w_stride * jcp.stride_w);
+        add(reg_ddst, jcp.typesize_in * ur_w * w_stride);
 
         sub(reg_ur_str_w, ur_w);
         jmp(unrolled_w_label);
@@ -718,8 +728,8 @@ inline void jit_avx512_dw_conv_bwd_data_kernel_bf16::loop_body(
         apply_filter(ur_ch_blocks, ur_w);
         store_dsrc(ur_ch_blocks, ur_w);
 
-        add(reg_dsrc, jcp.typesize_out * ur_w * jcp.ch_block * jcp.stride_w);
-        add(reg_ddst, jcp.typesize_in * ur_w * jcp.ch_block);
+        add(reg_dsrc, jcp.typesize_out * ur_w * w_stride * jcp.stride_w);
+        add(reg_ddst, jcp.typesize_in * ur_w * w_stride);
 
         sub(reg_ur_str_w, ur_w);
         jmp(tail_w_label);
@@ -791,6 +801,7 @@ inline void jit_avx512_dw_conv_bwd_weights_kernel_bf16::compute_ow_step_unroll(
     const int iw_block = ow_block * jcp.stride_w;
     const int right_border = jcp.iw - iw_block;
     const int r_pad = jcp.r_pad;
+    const int w_stride = is_layout_nxc() ? jcp.ngroups : jcp.ch_block;
 
     const int cascade_input = nstl::min(jcp.stride_w, jcp.kw);
 
@@ -800,12 +811,12 @@ inline void jit_avx512_dw_conv_bwd_weights_kernel_bf16::compute_ow_step_unroll(
 
     /* LOAD initial input registers, then cascade LOADs and FMAs*/
     for (int i_ur = 0; i_ur < unroll_w; ++i_ur) {
-        int off_output = i_ur * jcp.ch_block;
+        int off_output = i_ur * w_stride;
         vpmovzxwd(zmm_out_reg,
                 ptr[reg_tmp_output + off_output * jcp.typesize_in]);
         if (i_ur == 0) {
             for (int c = 0; c < input_overlap; ++c) {
-                int off_input = (c - pad_offset) * jcp.ch_block;
+                int off_input = (c - pad_offset) * w_stride;
                 if (off_input < 0 && unroll_w == jcp.ow) continue;
 
                 const bool over_steps_bdry = true && is_last_block
@@ -819,7 +830,7 @@ inline void jit_avx512_dw_conv_bwd_weights_kernel_bf16::compute_ow_step_unroll(
         } else {
             for (int c = 0; c < cascade_input; ++c) {
                 int overlap = (i_ur - 1) * jcp.stride_w + input_overlap;
-                int off_input = (overlap + c - pad_offset) * jcp.ch_block;
+                int off_input = (overlap + c - pad_offset) * w_stride;
                 if (off_input < 0 || overlap + c + l_pad > right_border)
                     continue;
 
@@ -858,8 +869,9 @@ inline void jit_avx512_dw_conv_bwd_weights_kernel_bf16::compute_ow_step_unroll(
 inline void
 jit_avx512_dw_conv_bwd_weights_kernel_bf16::compute_bias_step_unroll(
         const int unroll_w) {
+    const int w_stride = is_layout_nxc() ? jcp.ngroups : jcp.ch_block;
     for (int i = 0; i < unroll_w; ++i) {
-        int off_output = i * jcp.ch_block;
+        int off_output = i * w_stride;
         /* bf16 output data requires conversion to f32 */
         vpmovzxwd(zmm_out_reg,
                 ptr[reg_tmp_output + off_output * jcp.typesize_in]);
@@ -892,7 +904,7 @@ inline void jit_avx512_dw_conv_bwd_weights_kernel_bf16::compute_bias_loop(
     const int unroll_w_trips = jcp.ow / unroll_w;
     const int tail_w = jcp.ow > block_size ? jcp.ow % block_size : 0;
 
-    const int ch_offset = jcp.ch_block;
+    const int w_stride = is_layout_nxc() ? jcp.ngroups : jcp.ch_block;
 
     mov(reg_oh, ptr[this->param1 + offsetof(jit_dw_conv_call_s, oh_index)]);
     mov(reg_oh_worksize,
@@ -907,7 +919,7 @@ inline void jit_avx512_dw_conv_bwd_weights_kernel_bf16::compute_bias_loop(
         {
 
             compute_bias_step_unroll(unroll_w);
-            add(reg_tmp_output, unroll_w * ch_offset * jcp.typesize_in);
+            add(reg_tmp_output, unroll_w * w_stride * jcp.typesize_in);
 
             dec(reg_iter_ow_blk);
             cmp(reg_iter_ow_blk, 0);
@@ -916,7 +928,7 @@ inline void jit_avx512_dw_conv_bwd_weights_kernel_bf16::compute_bias_loop(
 
         if (tail_w > 0) {
             compute_bias_step_unroll(tail_w);
-            add(reg_tmp_output, tail_w * ch_offset * jcp.typesize_in);
+            add(reg_tmp_output, tail_w * w_stride * jcp.typesize_in);
         }
 
         inc(reg_oh);
@@ -961,6 +973,7 @@ inline void jit_avx512_dw_conv_bwd_weights_kernel_bf16::compute_h_step(
         int unroll_w, int l_pad, int pad_offset, int ow_block) {
 
     const int ch_offset = jcp.ch_block;
+    const int w_stride = is_layout_nxc() ? jcp.ngroups : jcp.ch_block;
 
     Label kh_loop_label, skip_loop_label;
 
@@ -975,7 +988,7 @@ inline void jit_avx512_dw_conv_bwd_weights_kernel_bf16::compute_h_step(
         store_filter();
 
         add(reg_tmp_filter, jcp.kw * ch_offset * jcp.typesize_out);
-        add(reg_tmp_input, jcp.iw * ch_offset * jcp.typesize_in);
+        add(reg_tmp_input, jcp.iw * w_stride * jcp.typesize_in);
         dec(reg_kh);
         cmp(reg_kh, 0);
         jg(kh_loop_label, T_NEAR);
@@ -986,7 +999,7 @@ inline void jit_avx512_dw_conv_bwd_weights_kernel_bf16::compute_h_step(
     mov(reg_kh, reg_kh_count);
     L(kh_comeback_label);
     {
-        sub(reg_tmp_input, jcp.iw * ch_offset * jcp.typesize_in);
+        sub(reg_tmp_input, jcp.iw * w_stride * jcp.typesize_in);
         sub(reg_tmp_filter, jcp.kw * ch_offset * jcp.typesize_out);
         dec(reg_kh);
         cmp(reg_kh, 0);
@@ -1004,6 +1017,7 @@ inline void jit_avx512_dw_conv_bwd_weights_kernel_bf16::compute_h_loop(
             = jcp.oh - 1 - utils::div_up(jcp.b_pad, jcp.stride_h);
 
     const int ch_offset = jcp.ch_block;
+    const int w_stride = is_layout_nxc() ? jcp.ngroups : jcp.ch_block;
     const int t_overlap_off = jcp.t_pad % jcp.stride_h == 0 ? jcp.stride_h : 1;
     const int b_overlap_off = jcp.b_pad % jcp.stride_h == 0 ? jcp.stride_h : 1;
 
@@ -1024,7 +1038,7 @@ inline void jit_avx512_dw_conv_bwd_weights_kernel_bf16::compute_h_loop(
 
         compute_h_step(unroll_w, l_pad, pad_offset, ow_block);
 
-        add(reg_tmp_output, jcp.ow * ch_offset * jcp.typesize_in);
+        add(reg_tmp_output, jcp.ow * w_stride * jcp.typesize_in);
 
         /* If within the top_pad region */
         if (jcp.t_pad > 0) {
@@ -1043,7 +1057,7 @@ inline void jit_avx512_dw_conv_bwd_weights_kernel_bf16::compute_h_loop(
             if (jcp.t_pad % jcp.stride_h != 0) {
                 int inp_corr = jcp.stride_h - jcp.t_pad % jcp.stride_h;
                 add(reg_tmp_input,
-                        inp_corr * jcp.iw * ch_offset * jcp.typesize_in);
+                        inp_corr * jcp.iw * w_stride * jcp.typesize_in);
             }
             jmp(tpad_loop_label, T_NEAR);
         }
@@ -1055,7 +1069,7 @@ inline void jit_avx512_dw_conv_bwd_weights_kernel_bf16::compute_h_loop(
         sub(reg_kh_count, b_overlap_off);
 
         L(skip_bpad_label);
-        add(reg_tmp_input, jcp.stride_h * jcp.iw * ch_offset * jcp.typesize_in);
+        add(reg_tmp_input, jcp.stride_h * jcp.iw * w_stride * jcp.typesize_in);
 
         L(tpad_loop_label);
 
@@ -1069,7 +1083,7 @@ inline void jit_avx512_dw_conv_bwd_weights_kernel_bf16::compute_h_loop(
 inline void
 jit_avx512_dw_conv_bwd_weights_kernel_bf16::compute_ow_block_unroll() {
 
-    const int ch_offset = jcp.ch_block;
+    const int w_stride = is_layout_nxc() ? jcp.ngroups : jcp.ch_block;
     int ow = jcp.ow;
     int pad_offset = 0;
     int l_pad = jcp.l_pad;
@@ -1136,9 +1150,9 @@ jit_avx512_dw_conv_bwd_weights_kernel_bf16::compute_ow_block_unroll() {
     /* compute left padded block */
     if (l_pad && do_unroll_w) {
         compute_h_loop(unroll_w, l_pad, 0, 0);
-        add(reg_output_baddr, unroll_w * ch_offset * jcp.typesize_in);
+        add(reg_output_baddr, unroll_w * w_stride * jcp.typesize_in);
         add(reg_input_baddr,
-                unroll_w * jcp.stride_w * ch_offset * jcp.typesize_in);
+                unroll_w * jcp.stride_w * w_stride * jcp.typesize_in);
         unroll_w_trips--;
         pad_offset = l_pad;
         l_pad = 0;
@@ -1156,9 +1170,9 @@ jit_avx512_dw_conv_bwd_weights_kernel_bf16::compute_ow_block_unroll() {
     }
     if (unroll_w_trips > 0) {
         compute_h_loop(unroll_w, l_pad, pad_offset, 0);
-        add(reg_output_baddr, unroll_w * ch_offset * jcp.typesize_in);
+        add(reg_output_baddr, unroll_w * w_stride * jcp.typesize_in);
         add(reg_input_baddr,
-                unroll_w * jcp.stride_w * ch_offset * jcp.typesize_in);
+                unroll_w * jcp.stride_w * w_stride * jcp.typesize_in);
     }
     if (do_ow_blk_loop) {
         dec(reg_iter_ow_blk);
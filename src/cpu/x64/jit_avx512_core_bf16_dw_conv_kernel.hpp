@@ -177,6 +177,11 @@ private:
 
     bf16_emulation_t *bf16_emu_;
 
+    inline bool is_layout_nxc() {
+        return utils::one_of(jcp.src_tag, format_tag::ndhwc, format_tag::nhwc,
+                format_tag::nwc);
+    }
+
     inline void loop_body(int ur_ch_blocks);
     inline void load_ddst(int ur_ch_blocks, int ur_str_w);
     inline void apply_filter(int ur_ch_blocks, int ur_str_w);
@@ -253,6 +258,11 @@ private:
 
     bf16_emulation_t *bf16_emu_;
 
+    inline bool is_layout_nxc() {
+        return utils::one_of(jcp.src_tag, format_tag::ndhwc, format_tag::nhwc,
+                format_tag::nwc);
+    }
+
     /* Micro-kernel JIT'ing, fusing 'kw' and 'ow_block' loops into unrolled FMAs
      */
     inline void compute_ow_step_unroll(
@@ -167,6 +167,73 @@ private:
     };
 };
 
+// avx2 has neither vcvtneps2bf16 nor the avx512 instructions the emulation
+// above relies on, so the rounding is done with integer arithmetic. NaN
+// inputs are converted to the canonical bf16 qnan.
+struct bf16_emulation_avx2_t {
+    using Ymm_t = const Xbyak::Ymm;
+    using Xmm_t = const Xbyak::Xmm;
+    using reg64_t = const Xbyak::Reg64;
+
+    bf16_emulation_avx2_t(jit_generator *host, Ymm_t one, Ymm_t even,
+            Ymm_t qnan, reg64_t scratch, Ymm_t tr0)
+        : host_(host)
+        , one_(one)
+        , even_(even)
+        , qnan_(qnan)
+        , scratch_(scratch)
+        , tr0_(tr0) {}
+
+    // Converts the f32 values of `in` to bf16 with round to nearest even.
+    // Each result is left in the low word of its dword, `in` is clobbered.
+    template <typename Vmm>
+    void cvt_ps_to_bf16_dw(const Vmm &out, const Vmm &in) {
+        const Vmm tr0(tr0_.getIdx()), one(one_.getIdx());
+        const Vmm even(even_.getIdx()), qnan(qnan_.getIdx());
+
+        host_->vpsrld(tr0, in, 16);
+        host_->vpand(tr0, tr0, one);
+        host_->vpaddd(tr0, tr0, even);
+        host_->vpaddd(tr0, tr0, in);
+        host_->vpsrld(tr0, tr0, 16);
+
+        host_->vcmpunordps(in, in, in);
+        host_->vblendvps(out, tr0, qnan, in);
+    }
+
+    // Packs the bf16 values of `in` to the lower half of `out`, `in` is
+    // clobbered.
+    void vcvtneps2bf16(Xmm_t &out, Ymm_t in) {
+        cvt_ps_to_bf16_dw(in, in);
+        host_->vpackusdw(in, in, in);
+        host_->vpermq(Ymm_t(out.getIdx()), in, 0xd8);
+    }
+
+    void init_vcvtneps2bf16() {
+        host_->mov(scratch_.cvt32(), 0x1);
+        host_->vmovd(Xmm_t(one_.getIdx()), scratch_.cvt32());
+        host_->vpbroadcastd(one_, Xmm_t(one_.getIdx()));
+
+        host_->mov(scratch_.cvt32(), 0x7fff);
+        host_->vmovd(Xmm_t(even_.getIdx()), scratch_.cvt32());
+        host_->vpbroadcastd(even_, Xmm_t(even_.getIdx()));
+
+        host_->mov(scratch_.cvt32(), 0x7fc0);
+        host_->vmovd(Xmm_t(qnan_.getIdx()), scratch_.cvt32());
+        host_->vpbroadcastd(qnan_, Xmm_t(qnan_.getIdx()));
+    }
+
+    static cpu_isa_t get_isa() { return avx2; }
+
+private:
+    jit_generator *const host_;
+    Ymm_t one_;
+    Ymm_t even_;
+    Ymm_t qnan_;
+    reg64_t scratch_;
+    Ymm_t tr0_;
+};
+
 struct jit_avx512_core_cvt_ps_to_bf16_t : public jit_generator {
     DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_avx512_core_cvt_ps_to_bf16)
 
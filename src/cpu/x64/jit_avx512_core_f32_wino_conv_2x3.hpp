@@ -51,17 +51,18 @@ struct jit_avx512_core_f32_wino_conv_2x3_fwd_t : public primitive_t {
                 jit_avx512_core_f32_wino_conv_2x3_fwd_t);
 
         status_t init(engine_t *engine) {
-            bool ok = true && desc()->prop_kind == prop_kind::forward_inference
-                    && utils::one_of(desc()->alg_kind,
+            VDISPATCH(desc()->prop_kind == prop_kind::forward_inference,
+                    prop_kind);
+            VDISPATCH(utils::one_of(desc()->alg_kind,
                             alg_kind::convolution_auto,
-                            alg_kind::convolution_winograd)
-                    && expect_data_types(data_type::f32, data_type::f32,
-                            data_type::f32, data_type::f32, data_type::f32)
-                    && attr()->has_default_values(
+                            alg_kind::convolution_winograd), alg_kind);
+            VDISPATCH(expect_data_types(data_type::f32, data_type::f32,
+                            data_type::f32, data_type::f32, data_type::f32),
+                    data_type);
+            VDISPATCH(attr()->has_default_values(
                             primitive_attr_t::skip_mask_t::post_ops,
-                            data_type::f32)
-                    && set_default_formats();
-            if (!ok) return status::unimplemented;
+                            data_type::f32), attr);
+            VDISPATCH(set_default_formats(), format);
 
             memory_desc_t expect_wei_md = *weights_md();
             status_t jit_conf_result = jit_conf(expect_wei_md);
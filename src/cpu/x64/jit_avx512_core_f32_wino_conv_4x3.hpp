@@ -125,17 +125,17 @@ struct jit_avx512_core_f32_wino_conv_4x3_fwd_t
                 jit_avx512_core_f32_wino_conv_4x3_fwd_t, USE_GLOBAL_SCRATCHPAD);
 
         status_t init(engine_t *engine) {
-            bool ok = true && is_fwd()
-                    && utils::one_of(desc()->alg_kind,
+            VDISPATCH(is_fwd(), prop_kind);
+            VDISPATCH(utils::one_of(desc()->alg_kind,
                             alg_kind::convolution_auto,
-                            alg_kind::convolution_winograd)
-                    && expect_data_types(data_type::f32, data_type::f32,
-                            data_type::f32, data_type::f32, data_type::f32)
-                    && attr()->has_default_values(
+                            alg_kind::convolution_winograd), alg_kind);
+            VDISPATCH(expect_data_types(data_type::f32, data_type::f32,
+                            data_type::f32, data_type::f32, data_type::f32),
+                    data_type);
+            VDISPATCH(attr()->has_default_values(
                             primitive_attr_t::skip_mask_t::post_ops,
-                            data_type::f32)
-                    && set_default_formats();
-            if (!ok) return status::unimplemented;
+                            data_type::f32), attr);
+            VDISPATCH(set_default_formats(), format);
 
             status_t status
                     = jit_avx512_core_f32_wino_conv_4x3_fwd_kernel::init_conf(
@@ -216,15 +216,16 @@ struct jit_avx512_core_f32_wino_conv_4x3_bwd_data_t
                 USE_GLOBAL_SCRATCHPAD);
 
         status_t init(engine_t *engine) {
-            bool ok = true && dnnl_thr_syncable()
-                    && desc()->prop_kind == prop_kind::backward_data
-                    && utils::one_of(desc()->alg_kind,
+            VDISPATCH(dnnl_thr_syncable(), runtime);
+            VDISPATCH(desc()->prop_kind == prop_kind::backward_data, prop_kind);
+            VDISPATCH(utils::one_of(desc()->alg_kind,
                             alg_kind::convolution_auto,
-                            alg_kind::convolution_winograd)
-                    && expect_data_types(data_type::f32, data_type::f32,
-                            data_type::undef, data_type::f32, data_type::f32)
-                    && attr()->has_default_values() && set_default_formats();
-            if (!ok) return status::unimplemented;
+                            alg_kind::convolution_winograd), alg_kind);
+            VDISPATCH(expect_data_types(data_type::f32, data_type::f32,
+                            data_type::undef, data_type::f32, data_type::f32),
+                    data_type);
+            VDISPATCH(attr()->has_default_values(), attr);
+            VDISPATCH(set_default_formats(), format);
 
             status_t status
                     = jit_avx512_core_f32_wino_conv_4x3_bwd_data_kernel ::
@@ -303,15 +304,17 @@ struct jit_avx512_core_f32_wino_conv_4x3_bwd_weights_t : public primitive_t {
                 USE_GLOBAL_SCRATCHPAD);
 
         status_t init(engine_t *engine) {
-            bool ok = true && dnnl_thr_syncable()
-                    && desc()->prop_kind == prop_kind::backward_weights
-                    && utils::one_of(desc()->alg_kind,
+            VDISPATCH(dnnl_thr_syncable(), runtime);
+            VDISPATCH(desc()->prop_kind == prop_kind::backward_weights,
+                    prop_kind);
+            VDISPATCH(utils::one_of(desc()->alg_kind,
                             alg_kind::convolution_auto,
-                            alg_kind::convolution_winograd)
-                    && expect_data_types(data_type::f32, data_type::f32,
-                            data_type::f32, data_type::f32, data_type::f32)
-                    && attr()->has_default_values() && set_default_formats();
-            if (!ok) return status::unimplemented;
+                            alg_kind::convolution_winograd), alg_kind);
+            VDISPATCH(expect_data_types(data_type::f32, data_type::f32,
+                            data_type::f32, data_type::f32, data_type::f32),
+                    data_type);
+            VDISPATCH(attr()->has_default_values(), attr);
+            VDISPATCH(set_default_formats(), format);
 
             status_t status
                     = jit_avx512_core_f32_wino_conv_4x3_bwd_weights_kernel::
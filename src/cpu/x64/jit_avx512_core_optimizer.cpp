@@ -0,0 +1,253 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+#include <stddef.h>
+
+#include "common/dnnl_thread.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/x64/jit_avx512_core_optimizer.hpp"
+
+#define GET_OFF(field) offsetof(jit_optimizer_call_s, field)
+#define COEFF(field) coeff(offsetof(optimizer_utils::coeffs_t, field))
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+using namespace dnnl::impl::data_type;
+using namespace dnnl::impl::utils;
+using namespace Xbyak;
+
+void jit_avx512_core_optimizer_kernel_t::compute(int unroll, bool tail) {
+    auto load = [&](const Zmm &z, const Address &a) {
+        if (tail)
+            vmovups(z | k_tail | T_z, a);
+        else
+            vmovups(z, a);
+    };
+    auto store = [&](const Address &a, const Zmm &z) {
+        if (tail)
+            vmovups(a | k_tail, z);
+        else
+            vmovups(a, z);
+    };
+
+    for (int u = 0; u < unroll; u++) {
+        const dim_t off = u * simd_w;
+        const Zmm w = vreg(u, 0), g = vreg(u, 1), m = vreg(u, 2),
+                  v = vreg(u, 3);
+
+        load(w, addr(reg_weights, off, f32));
+        if (jcp.diff_weights_dt == bf16) {
+            const auto a = addr(reg_diff_weights, off, bf16);
+            if (tail)
+                vpmovzxwd(g | k_tail | T_z, a);
+            else
+                vpmovzxwd(g, a);
+            vpslld(g, g, 16);
+        } else {
+            load(g, addr(reg_diff_weights, off, f32));
+        }
+        vmulps(g, g, COEFF(grad_scale));
+        if (jcp.with_l2) vfmadd231ps(g, w, COEFF(weight_decay));
+
+        Zmm upd = g;
+        if (jcp.with_state) {
+            load(m, addr(reg_moment_1, off, f32));
+            vmulps(m, m, COEFF(beta1));
+            vfmadd231ps(m, g, COEFF(one_minus_beta1));
+            store(addr(reg_moment_1, off, f32), m);
+            upd = m;
+        }
+        if (jcp.is_adam) {
+            load(v, addr(reg_moment_2, off, f32));
+            vmulps(v, v, COEFF(beta2));
+            vmulps(g, g, g);
+            vfmadd231ps(v, g, COEFF(one_minus_beta2));
+            store(addr(reg_moment_2, off, f32), v);
+            // g = m / (sqrt(v) * inv_sqrt_bias_correction2 + eps)
+            vsqrtps(g, v);
+            vfmadd213ps(g, COEFF(inv_sqrt_bias_correction2), COEFF(eps));
+            vdivps(g, m, g);
+            upd = g;
+            vmulps(w, w, COEFF(weights_scale));
+        }
+        vfnmadd231ps(w, upd, COEFF(step_size));
+        store(addr(reg_weights, off, f32), w);
+
+        if (!jcp.with_dst) continue;
+        if (jcp.dst_dt == f32) {
+            store(addr(reg_dst, off, f32), w);
+            continue;
+        }
+        const Ymm y_dst = Ymm(v.getIdx());
+        if (jcp.use_bf16_emulation)
+            bf16_emulation_->vcvtneps2bf16(y_dst, w);
+        else
+            vcvtneps2bf16(y_dst, w);
+        const auto a = addr(reg_dst, off, bf16);
+        if (tail)
+            vmovdqu16(a | k_tail, y_dst);
+        else
+            vmovdqu16(a, y_dst);
+    }
+}
+
+void jit_avx512_core_optimizer_kernel_t::loop(int unroll) {
+    Label loop_label, exit_label;
+    const int step = unroll * simd_w;
+
+    L(loop_label);
+    cmp(reg_size, step);
+    jl(exit_label, T_NEAR);
+    compute(unroll, false);
+    add(reg_weights, step * sizeof(float));
+    if (jcp.with_state) add(reg_moment_1, step * sizeof(float));
+    if (jcp.is_adam) add(reg_moment_2, step * sizeof(float));
+    add(reg_diff_weights, step * types::data_type_size(jcp.diff_weights_dt));
+    if (jcp.with_dst) add(reg_dst, step * types::data_type_size(jcp.dst_dt));
+    sub(reg_size, step);
+    jmp(loop_label, T_NEAR);
+
+    L(exit_label);
+}
+
+void jit_avx512_core_optimizer_kernel_t::generate() {
+    preamble();
+
+    if (jcp.use_bf16_emulation) {
+        bf16_emulation_.reset(new bf16_emulation_t(this, bf16_emu_one,
+                bf16_emu_even, bf16_emu_selector, reg_bf16_scratch,
+                bf16_emu_tmp));
+        bf16_emulation_->init_vcvtneps2bf16();
+    }
+
+    mov(reg_weights, ptr[param + GET_OFF(weights)]);
+    if (jcp.with_state) mov(reg_moment_1, ptr[param + GET_OFF(moment_1)]);
+    if (jcp.is_adam) mov(reg_moment_2, ptr[param + GET_OFF(moment_2)]);
+    mov(reg_diff_weights, ptr[param + GET_OFF(diff_weights)]);
+    if (jcp.with_dst) mov(reg_dst, ptr[param + GET_OFF(dst)]);
+    mov(reg_coeffs, ptr[param + GET_OFF(coeffs)]);
+    mov(reg_size, ptr[param + GET_OFF(size)]);
+
+    for (int i = 0; i < n_coeffs; i++)
+        vbroadcastss(zmm_coeff(i), ptr[reg_coeffs + i * sizeof(float)]);
+
+    if (jcp.loop_unroll > 1) loop(jcp.loop_unroll);
+    loop(1);
+
+    // The remaining elements are processed under a mask
+    Label done_label;
+    cmp(reg_size, 0);
+    jle(done_label, T_NEAR);
+    mov(reg_tmp, 1);
+    shlx(reg_tmp, reg_tmp, reg_size);
+    sub(reg_tmp, 1);
+    kmovw(k_tail, reg_tmp.cvt32());
+    compute(1, true);
+    L(done_label);
+
+    postamble();
+}
+
+status_t jit_avx512_core_optimizer_kernel_t::init_conf(
+        jit_optimizer_conf_t &jcp, const optimizer_pd_t *pd) {
+    jcp.isa = mayiuse(avx512_core_bf16) ? avx512_core_bf16 : avx512_core;
+    jcp.is_adam = pd->is_adam();
+    jcp.with_state = pd->n_states() > 0;
+    jcp.with_l2 = !jcp.is_adam && pd->desc()->weight_decay != 0.f;
+    jcp.with_dst = pd->with_dst();
+    jcp.diff_weights_dt = pd->diff_weights_md()->data_type;
+    jcp.dst_dt = jcp.with_dst ? pd->dst_md()->data_type : f32;
+    jcp.use_bf16_emulation = jcp.with_dst && jcp.dst_dt == bf16
+            && jcp.isa != avx512_core_bf16;
+
+    jcp.loop_unroll = (cpu_isa_traits<avx512_core>::n_vregs - n_coeffs
+                              - n_bf16_vregs)
+            / n_vregs_per_unroll;
+    if (jcp.loop_unroll < 1) return status::unimplemented;
+
+    return status::success;
+}
+
+status_t jit_avx512_core_optimizer_t::execute(const exec_ctx_t &ctx) const {
+    if (pd()->has_zero_dim_memory()) return status::success;
+
+    const auto &jcp = pd()->jcp_;
+    auto hp = CTX_IN_MEM(const float *, DNNL_ARG_HYPERPARAMETERS);
+    auto diff_weights = CTX_IN_MEM(const char *, DNNL_ARG_DIFF_WEIGHTS);
+    auto weights = CTX_OUT_MEM(float *, DNNL_ARG_WEIGHTS);
+    auto moment_1 = CTX_OUT_MEM(float *, DNNL_ARG_MOMENT_1);
+    auto moment_2 = CTX_OUT_MEM(float *, DNNL_ARG_MOMENT_2);
+    auto dst = CTX_OUT_MEM(char *, DNNL_ARG_DST);
+
+    const int n_states = pd()->n_states();
+    if ((n_states >= 1 && !moment_1) || (n_states >= 2 && !moment_2))
+        return status::invalid_arguments;
+
+    const auto scratchpad = ctx.get_scratchpad_grantor();
+    double *partials = scratchpad.template get<double>(
+            memory_tracking::names::key_optimizer_reduction);
+
+    optimizer_utils::coeffs_t coeffs;
+    CHECK(optimizer_utils::init_coeffs(
+            coeffs, pd(), hp, diff_weights, partials));
+
+    // All the tensors are dense with the same layout, the padded area is
+    // updated along with the data and stays zero
+    const memory_desc_wrapper w_d(pd()->weights_md());
+    const memory_desc_wrapper dw_d(pd()->diff_weights_md());
+    const memory_desc_wrapper d_d(pd()->dst_md());
+    const dim_t w_off0 = w_d.blk_off(0);
+    weights += w_off0;
+    if (moment_1) moment_1 += w_off0;
+    if (moment_2) moment_2 += w_off0;
+    diff_weights += dw_d.blk_off(0) * dw_d.data_type_size();
+    if (jcp.with_dst) dst += d_d.blk_off(0) * d_d.data_type_size();
+    const size_t dw_dt_size = dw_d.data_type_size();
+    const size_t dst_dt_size = jcp.with_dst ? d_d.data_type_size() : 0;
+
+    const dim_t nelems = w_d.nelems(true);
+    const dim_t block = 1024;
+    const dim_t nblocks = div_up(nelems, block);
+
+    parallel(0, [&](const int ithr, const int nthr) {
+        dim_t start {0}, end {0};
+        balance211(nblocks, nthr, ithr, start, end);
+        if (start == end) return;
+
+        const dim_t start_e = start * block;
+        const dim_t end_e = nstl::min(nelems, end * block);
+        auto arg = jit_optimizer_call_s();
+        arg.weights = weights + start_e;
+        arg.moment_1 = moment_1 ? moment_1 + start_e : nullptr;
+        arg.moment_2 = moment_2 ? moment_2 + start_e : nullptr;
+        arg.diff_weights = diff_weights + start_e * dw_dt_size;
+        arg.dst = jcp.with_dst ? dst + start_e * dst_dt_size : nullptr;
+        arg.coeffs = &coeffs;
+        arg.size = end_e - start_e;
+        (*kernel_)(&arg);
+    });
+
+    return status::success;
+}
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
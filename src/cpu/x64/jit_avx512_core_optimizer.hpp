@@ -0,0 +1,165 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+#ifndef CPU_X64_JIT_AVX512_CORE_OPTIMIZER_HPP
+#define CPU_X64_JIT_AVX512_CORE_OPTIMIZER_HPP
+
+#include <memory>
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+#include "common/type_helpers.hpp"
+
+#include "cpu/cpu_optimizer_pd.hpp"
+#include "cpu/cpu_optimizer_utils.hpp"
+#include "cpu/x64/cpu_isa_traits.hpp"
+#include "cpu/x64/jit_avx512_core_bf16cvt.hpp"
+#include "cpu/x64/jit_generator.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+struct jit_optimizer_conf_t {
+    cpu_isa_t isa;
+    bool is_adam;
+    bool with_state;
+    bool with_l2; /* the weight decay is added to the gradients (SGD) */
+    bool with_dst;
+    data_type_t diff_weights_dt;
+    data_type_t dst_dt;
+    bool use_bf16_emulation;
+    int loop_unroll;
+};
+
+struct jit_optimizer_call_s {
+    float *weights;
+    float *moment_1;
+    float *moment_2;
+    const void *diff_weights;
+    void *dst;
+    const optimizer_utils::coeffs_t *coeffs;
+    dim_t size;
+};
+
+// Updates the weights, the states, and the optional copy of the weights in a
+// single pass: every element is loaded and stored exactly once.
+struct jit_avx512_core_optimizer_kernel_t : public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_avx512_core_optimizer_kernel_t)
+
+    jit_avx512_core_optimizer_kernel_t(const jit_optimizer_conf_t &ajcp)
+        : jcp(ajcp) {}
+
+    static status_t init_conf(
+            jit_optimizer_conf_t &jcp, const optimizer_pd_t *pd);
+
+    const jit_optimizer_conf_t jcp;
+
+private:
+    using Zmm = Xbyak::Zmm;
+    using Ymm = Xbyak::Ymm;
+    using reg64_t = const Xbyak::Reg64;
+
+    static constexpr int simd_w = cpu_isa_traits<avx512_core>::vlen
+            / sizeof(float);
+
+    reg64_t param = abi_param1;
+    reg64_t reg_weights = r8;
+    reg64_t reg_moment_1 = r9;
+    reg64_t reg_moment_2 = r10;
+    reg64_t reg_diff_weights = r11;
+    reg64_t reg_dst = r12;
+    reg64_t reg_size = r13;
+    reg64_t reg_coeffs = r14;
+    reg64_t reg_tmp = r15;
+    reg64_t reg_bf16_scratch = rax;
+
+    const Xbyak::Opmask k_tail = k1;
+
+    // The coefficients occupy the first registers, followed by the ones
+    // reserved for the bf16 emulation and four registers per unroll
+    // iteration.
+    enum {
+        n_coeffs = sizeof(optimizer_utils::coeffs_t) / sizeof(float),
+        n_bf16_vregs = 4,
+        n_vregs_per_unroll = 4,
+    };
+    Zmm zmm_coeff(int i) const { return Zmm(i); }
+    Zmm bf16_emu_one = Zmm(n_coeffs);
+    Zmm bf16_emu_even = Zmm(n_coeffs + 1);
+    Zmm bf16_emu_selector = Zmm(n_coeffs + 2);
+    Zmm bf16_emu_tmp = Zmm(n_coeffs + 3);
+    Zmm vreg(int i_unroll, int i) const {
+        return Zmm(n_coeffs + n_bf16_vregs + n_vregs_per_unroll * i_unroll
+                + i);
+    }
+
+    std::unique_ptr<bf16_emulation_t> bf16_emulation_;
+
+    Zmm coeff(size_t offset) const {
+        return zmm_coeff((int)(offset / sizeof(float)));
+    }
+    Xbyak::Address addr(reg64_t base, dim_t elem_off, data_type_t dt) {
+        return ptr[base + elem_off * types::data_type_size(dt)];
+    }
+    void compute(int unroll, bool tail);
+    void loop(int unroll);
+    void generate() override;
+};
+
+struct jit_avx512_core_optimizer_t : public primitive_t {
+    using kernel_t = jit_avx512_core_optimizer_kernel_t;
+
+    struct pd_t : public cpu_optimizer_pd_t {
+        using cpu_optimizer_pd_t::cpu_optimizer_pd_t;
+
+        DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("jit:", jcp_.isa, ""),
+                jit_avx512_core_optimizer_t);
+
+        status_t init(engine_t *engine) {
+            bool ok = mayiuse(avx512_core)
+                    && set_default_params() == status::success
+                    && same_dense_layout() && attr()->has_default_values();
+            if (!ok) return status::unimplemented;
+
+            CHECK(kernel_t::init_conf(jcp_, this));
+            init_scratchpad();
+            return status::success;
+        }
+
+        jit_optimizer_conf_t jcp_;
+    };
+
+    jit_avx512_core_optimizer_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override {
+        CHECK(safe_ptr_assign(kernel_, new kernel_t(pd()->jcp_)));
+        return kernel_->create_kernel();
+    }
+
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+    std::unique_ptr<kernel_t> kernel_;
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -1177,6 +1177,11 @@ bool jit_avx512_core_x8s8s32x_fwd_kernel::post_ops_ok(
 
     auto is_eltwise = [&](int idx) { return p.entry_[idx].is_eltwise(); };
 
+    // the pooling post-op is applied by the driver to the stored rows, hence
+    // it cannot be combined with a sum that would read the un-pooled dst
+    if (p.len() > 0 && p.entry_[p.len() - 1].is_pooling())
+        return p.len() == 1 || (p.len() == 2 && is_eltwise(0));
+
     switch (p.len()) {
         case 0: return true;
         case 1: return is_eltwise(0) || p.contain(sum, 0);
@@ -1397,6 +1402,14 @@ status_t jit_avx512_core_x8s8s32x_fwd_kernel::init_conf(jit_conv_conf_t &jcp,
     }
     if (jcp.dst_tag != dat_tag) return status::unimplemented;
 
+    const int pool_ind = p.find(primitive_kind::pooling);
+    jcp.with_pool = pool_ind != -1;
+    if (jcp.with_pool) {
+        jcp.pool_alg = p.entry_[pool_ind].pooling.alg;
+        if (!is_2d || jcp.ngroups != 1 || jcp.oh < 2 || jcp.ow < 2)
+            return status::unimplemented;
+    }
+
     if (jcp.with_bias) {
         if (bias_d.format_kind() == format_kind::any)
             CHECK(memory_desc_init_by_tag(bias_md, format_tag::x));
@@ -1522,11 +1535,19 @@ void jit_avx512_core_x8s8s32x_fwd_kernel::init_scratchpad(
         memory_tracking::registrar_t &scratchpad, const jit_conv_conf_t &jcp,
         const primitive_attr_t &attr) {
     if (jcp.signed_input && jcp.ver != ver_vnni) {
-        dim_t count = attr.output_scales_.count_ == 1
-                ? (dim_t)16
-                : attr.output_scales_.count_;
+        // runtime scales are not known here, so book for per-oc ones
+        dim_t count = jcp.is_oc_scale
+                ? (dim_t)jcp.ngroups * jcp.oc_without_padding
+                : (dim_t)16;
         scratchpad.book<float>(key_conv_adjusted_scales, count);
     }
+    if (jcp.with_pool) {
+        // a pair of un-pooled dst rows per thread
+        const size_t dst_dt_size = types::data_type_size(jcp.dst_dt);
+        scratchpad.book(key_fusion_inout_buffer,
+                (size_t)jcp.nthr * 2 * jcp.ow * jcp.oc_without_padding,
+                dst_dt_size);
+    }
 }
 
 template struct _jit_avx512_core_x8s8s32x_fwd_kernel<Zmm>;
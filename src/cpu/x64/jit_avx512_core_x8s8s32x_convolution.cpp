@@ -20,6 +20,7 @@
 #include "common/utils.hpp"
 
 #include "cpu/cpu_primitive.hpp"
+#include "cpu/simple_q10n.hpp"
 
 #include "cpu/x64/jit_avx512_core_x8s8s32x_convolution.hpp"
 
@@ -62,20 +63,8 @@ status_t jit_avx512_core_x8s8s32x_convolution_fwd_t<src_type,
     assert(jcp.nb_oc % jcp.nb_oc_blocking == 0);
     assert(jcp.nb_ch % jcp.nb_ch_blocking == 0);
 
-    const float *oscales = pd()->attr()->output_scales_.scales_;
-    if (jcp.signed_input && jcp.ver != ver_vnni) {
-        auto local_scales = ctx.get_scratchpad_grantor().template get<float>(
-                key_conv_adjusted_scales);
-        size_t count = pd()->attr()->output_scales_.count_;
-        float factor = 1.f / pd()->jcp_.wei_adj_scale;
-        if (count == 1) {
-            utils::array_set(local_scales, oscales[0] * factor, 16);
-        } else {
-            for (size_t c = 0; c < count; c++)
-                local_scales[c] = oscales[c] * factor;
-        }
-        oscales = local_scales;
-    }
+    DEFINE_SCALES_BUFFER(oscales);
+    oscales = adjust_oscales(ctx.get_scratchpad_grantor(), oscales);
 
     size_t offset = weights_d.size() - weights_d.additional_buffer_size();
     auto w = const_cast<wei_data_t *>(weights);
@@ -92,7 +81,8 @@ status_t jit_avx512_core_x8s8s32x_convolution_fwd_t<src_type,
     int group_block = jcp.ch_block;
     int work_amount = jcp.mb * nb_groups * oc_chunks * jcp.nb_ow;
 
-    parallel(jcp.nthr, [&](const int ithr, const int nthr) {
+    const int nthr_exec = dnnl_get_exec_num_threads(jcp.nthr);
+    parallel(nthr_exec, [&](const int ithr, const int nthr) {
         int start {0}, end {0};
         balance211(work_amount, nthr, ithr, start, end);
 
@@ -197,20 +187,8 @@ status_t jit_avx512_core_x8s8s32x_convolution_fwd_t<src_type,
     assert(jcp.nb_oc % jcp.nb_oc_blocking == 0);
     assert(jcp.nb_ch % jcp.nb_ch_blocking == 0);
 
-    const float *oscales = pd()->attr()->output_scales_.scales_;
-    if (jcp.signed_input && jcp.ver != ver_vnni) {
-        auto local_scales = ctx.get_scratchpad_grantor().template get<float>(
-                key_conv_adjusted_scales);
-        size_t count = pd()->attr()->output_scales_.count_;
-        float factor = 1.f / pd()->jcp_.wei_adj_scale;
-        if (count == 1) {
-            utils::array_set(local_scales, oscales[0] * factor, 16);
-        } else {
-            for (size_t c = 0; c < count; c++)
-                local_scales[c] = oscales[c] * factor;
-        }
-        oscales = local_scales;
-    }
+    DEFINE_SCALES_BUFFER(oscales);
+    oscales = adjust_oscales(ctx.get_scratchpad_grantor(), oscales);
 
     size_t offset = weights_d.size() - weights_d.additional_buffer_size();
     auto w = const_cast<wei_data_t *>(weights);
@@ -226,7 +204,8 @@ status_t jit_avx512_core_x8s8s32x_convolution_fwd_t<src_type,
     int nb_groups = jcp.nb_ch;
     int work_amount = jcp.mb * nb_groups * oc_chunks * jcp.oh * jcp.nb_ow;
 
-    parallel(jcp.nthr, [&](const int ithr, const int nthr) {
+    const int nthr_exec = dnnl_get_exec_num_threads(jcp.nthr);
+    parallel(nthr_exec, [&](const int ithr, const int nthr) {
         int start {0}, end {0};
         balance211(work_amount, nthr, ithr, start, end);
 
@@ -369,20 +348,8 @@ status_t jit_avx512_core_x8s8s32x_convolution_fwd_t<src_type,
     assert(jcp.nb_oc_blocking == 1);
     assert(jcp.nb_ch % jcp.nb_ch_blocking == 0);
 
-    const float *oscales = pd()->attr()->output_scales_.scales_;
-    if (jcp.signed_input && jcp.ver != ver_vnni) {
-        auto local_scales = ctx.get_scratchpad_grantor().template get<float>(
-                key_conv_adjusted_scales);
-        size_t count = pd()->attr()->output_scales_.count_;
-        float factor = 1.f / pd()->jcp_.wei_adj_scale;
-        if (count == 1) {
-            utils::array_set(local_scales, oscales[0] * factor, 16);
-        } else {
-            for (size_t c = 0; c < count; c++)
-                local_scales[c] = oscales[c] * factor;
-        }
-        oscales = local_scales;
-    }
+    DEFINE_SCALES_BUFFER(oscales);
+    oscales = adjust_oscales(ctx.get_scratchpad_grantor(), oscales);
 
     size_t offset = weights_d.size() - weights_d.additional_buffer_size();
     auto w = const_cast<wei_data_t *>(weights);
@@ -458,6 +425,158 @@ status_t jit_avx512_core_x8s8s32x_convolution_fwd_t<src_type,
     return status::success;
 }
 
+template <data_type_t src_type, data_type_t dst_type>
+status_t jit_avx512_core_x8s8s32x_convolution_fwd_t<src_type,
+        dst_type>::execute_forward_2d_pool(const exec_ctx_t &ctx) const {
+    auto src = CTX_IN_MEM(const src_data_t *, DNNL_ARG_SRC);
+    auto weights = CTX_IN_MEM(const wei_data_t *, DNNL_ARG_WEIGHTS);
+    auto bias = CTX_IN_MEM(const char *, DNNL_ARG_BIAS);
+    auto dst = CTX_OUT_MEM(dst_data_t *, DNNL_ARG_DST);
+
+    DEFINE_ZERO_POINTS_BUFFER(src_zero_point, DNNL_ARG_SRC);
+    DEFINE_ZERO_POINTS_BUFFER(dst_zero_point, DNNL_ARG_DST);
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+    const memory_desc_wrapper weights_d(pd()->weights_md(0));
+    const memory_desc_wrapper bias_d(pd()->weights_md(1));
+
+    const size_t bia_dt_size = pd()->with_bias()
+            ? types::data_type_size(pd()->desc()->bias_desc.data_type)
+            : 0;
+
+    const auto &jcp = pd()->jcp_;
+    assert(jcp.with_pool && jcp.ngroups == 1 && !jcp.is_depthwise);
+    assert(jcp.nb_oc % jcp.nb_oc_blocking == 0);
+
+    DEFINE_SCALES_BUFFER(oscales);
+    oscales = adjust_oscales(ctx.get_scratchpad_grantor(), oscales);
+
+    size_t offset = weights_d.size() - weights_d.additional_buffer_size();
+    auto w = const_cast<wei_data_t *>(weights);
+    int32_t *compensation = (jcp.signed_input)
+            ? reinterpret_cast<int32_t *>(&w[offset])
+            : nullptr;
+    int32_t *zp_compensation = jcp.src_zero_point
+            ? reinterpret_cast<int32_t *>(&w[offset])
+                    + (jcp.signed_input ? jcp.oc : 0)
+            : nullptr;
+
+    // The convolution rows are stored to a per-thread buffer laid out as a
+    // pair of nhwc dst rows, which stays in cache until it is pooled.
+    auto rows_buffer = ctx.get_scratchpad_grantor().template get<dst_data_t>(
+            key_fusion_inout_buffer);
+    const dim_t ow_stride = jcp.oc_without_padding;
+    const dim_t row_size = jcp.ow * ow_stride;
+
+    const int oc_chunks = jcp.nb_oc / jcp.nb_oc_blocking_thr_chunk;
+    const int PH = jcp.oh / 2, PW = jcp.ow / 2;
+    const int work_amount = jcp.mb * oc_chunks * PH;
+    const bool is_max = jcp.pool_alg == alg_kind::pooling_max;
+
+    const int nthr_exec = dnnl_get_exec_num_threads(jcp.nthr);
+    parallel(nthr_exec, [&](const int ithr, const int nthr) {
+        int start {0}, end {0};
+        balance211(work_amount, nthr, ithr, start, end);
+
+        dst_data_t *rows = rows_buffer + ithr * 2 * row_size;
+        auto p = jit_conv_call_s();
+
+        size_t src_h_stride = src_d.blk_off(0, 0, 1);
+        size_t wht_h_stride = wht_blk_off(weights_d, 0, 0, 0, 1);
+
+        int n {0}, occ {0}, ph {0};
+        nd_iterator_init(start, n, jcp.mb, occ, oc_chunks, ph, PH);
+        for (int iwork = start; iwork < end; ++iwork) {
+            for (int occ1 = 0; occ1 < jcp.nb_oc_blocking_thr_chunk;
+                    occ1 += jcp.nb_oc_blocking) {
+                int ocb = occ * jcp.nb_oc_blocking_thr_chunk + occ1;
+                int g_oc = ocb * jcp.oc_block;
+
+                auto bias_w = bias ? bias + (bias_d.blk_off(g_oc) * bia_dt_size)
+                                   : nullptr;
+                int32_t *compensation_w
+                        = (jcp.signed_input) ? compensation + g_oc : nullptr;
+                auto wht_w = weights + wht_blk_off(weights_d, 0, ocb, 0);
+                auto scales = &oscales[jcp.is_oc_scale * g_oc];
+
+                for (int r = 0; r < 2; ++r) {
+                    int ij = -jcp.t_pad + (2 * ph + r) * jcp.stride_h;
+                    int dilate_h = jcp.dilate_h + 1;
+                    int i_t_overflow
+                            = nstl::min(jcp.kh, div_up(max(0, -ij), dilate_h));
+                    int i_b_overflow = nstl::min(jcp.kh,
+                            div_up(max(0,
+                                           ij - jcp.ih + (jcp.kh - 1) * dilate_h
+                                                   + 1),
+                                    dilate_h));
+                    int kh_padding = nstl::max(
+                            0, jcp.kh - i_t_overflow - i_b_overflow);
+
+                    size_t wei_stride = (jcp.signed_input || jcp.src_zero_point)
+                            ? 0
+                            : i_t_overflow * wht_h_stride;
+
+                    for (int owb = 0; owb < jcp.nb_ow; ++owb) {
+                        int ow_s = owb * jcp.ow_block;
+                        int iw_s = ow_s * jcp.stride_w;
+                        auto src_w = src + src_d.blk_off(n, 0, ij, iw_s);
+
+                        p.src = src_w + i_t_overflow * dilate_h * src_h_stride;
+                        p.dst = rows + r * row_size + ow_s * ow_stride + g_oc;
+                        p.filt = wht_w + wei_stride;
+                        p.bias = bias_w;
+                        p.compensation = compensation_w;
+                        p.zp_compensation = jcp.src_zero_point
+                                ? zp_compensation + g_oc
+                                : nullptr;
+                        p.src_zero_point
+                                = jcp.src_zero_point ? src_zero_point : nullptr;
+                        p.dst_zero_point
+                                = jcp.dst_zero_point ? dst_zero_point : nullptr;
+                        p.oc_blocks = ocb;
+                        p.kh_padding = kh_padding;
+                        p.scales = scales;
+                        p.t_overflow = i_t_overflow;
+                        p.b_overflow = i_b_overflow;
+                        p.owb = owb;
+
+                        (*kernel_)(&p);
+                    }
+                }
+            }
+
+            const int oc_s = occ * jcp.nb_oc_blocking_thr_chunk * jcp.oc_block;
+            const int oc_e = nstl::min(jcp.oc_without_padding,
+                    oc_s + jcp.nb_oc_blocking_thr_chunk * jcp.oc_block);
+            for (int pw = 0; pw < PW; ++pw) {
+                const dst_data_t *r0 = rows + 2 * pw * ow_stride;
+                const dst_data_t *r1 = r0 + ow_stride;
+                const dst_data_t *r2 = r0 + row_size;
+                const dst_data_t *r3 = r2 + ow_stride;
+                dst_data_t *d = dst + dst_d.blk_off(n, 0, ph, pw);
+                if (is_max) {
+                    PRAGMA_OMP_SIMD()
+                    for (int oc = oc_s; oc < oc_e; ++oc)
+                        d[oc] = nstl::max(nstl::max(r0[oc], r1[oc]),
+                                nstl::max(r2[oc], r3[oc]));
+                } else {
+                    // without padding both averaging algorithms divide by 4
+                    PRAGMA_OMP_SIMD()
+                    for (int oc = oc_s; oc < oc_e; ++oc) {
+                        const float s = (float)r0[oc] + (float)r1[oc]
+                                + (float)r2[oc] + (float)r3[oc];
+                        d[oc] = cpu::saturate_and_round<dst_data_t>(0.25f * s);
+                    }
+                }
+            }
+
+            nd_iterator_step(n, jcp.mb, occ, oc_chunks, ph, PH);
+        }
+    });
+    return status::success;
+}
+
 template <data_type_t src_type, data_type_t dst_type>
 status_t jit_avx512_core_x8s8s32x_convolution_fwd_t<src_type,
         dst_type>::execute_forward_3d(const exec_ctx_t &ctx) const {
@@ -484,20 +603,8 @@ status_t jit_avx512_core_x8s8s32x_convolution_fwd_t<src_type,
     assert(jcp.nb_oc % jcp.nb_oc_blocking == 0);
     assert(jcp.nb_ch % jcp.nb_ch_blocking == 0);
 
-    const float *oscales = pd()->attr()->output_scales_.scales_;
-    if (jcp.signed_input && jcp.ver != ver_vnni) {
-        auto local_scales = ctx.get_scratchpad_grantor().template get<float>(
-                key_conv_adjusted_scales);
-        size_t count = pd()->attr()->output_scales_.count_;
-        float factor = 1.f / pd()->jcp_.wei_adj_scale;
-        if (count == 1) {
-            utils::array_set(local_scales, oscales[0] * factor, 16);
-        } else {
-            for (size_t c = 0; c < count; c++)
-                local_scales[c] = oscales[c] * factor;
-        }
-        oscales = local_scales;
-    }
+    DEFINE_SCALES_BUFFER(oscales);
+    oscales = adjust_oscales(ctx.get_scratchpad_grantor(), oscales);
 
     size_t offset = weights_d.size() - weights_d.additional_buffer_size();
     auto w = const_cast<wei_data_t *>(weights);
@@ -513,7 +620,8 @@ status_t jit_avx512_core_x8s8s32x_convolution_fwd_t<src_type,
     int work_amount
             = jcp.mb * nb_groups * oc_chunks * jcp.od * jcp.oh * jcp.nb_ow;
 
-    parallel(jcp.nthr, [&](const int ithr, const int nthr) {
+    const int nthr_exec = dnnl_get_exec_num_threads(jcp.nthr);
+    parallel(nthr_exec, [&](const int ithr, const int nthr) {
         int start {0}, end {0};
         balance211(work_amount, nthr, ithr, start, end);
 
@@ -651,6 +759,27 @@ status_t jit_avx512_core_x8s8s32x_convolution_fwd_t<src_type,
     return status::success;
 }
 
+template <data_type_t src_type, data_type_t dst_type>
+const float *jit_avx512_core_x8s8s32x_convolution_fwd_t<src_type,
+        dst_type>::adjust_oscales(const memory_tracking::grantor_t &scratchpad,
+        const float *oscales) const {
+    // The scales are used in place unless the s8s8 weights were scaled down
+    // by the reorder, so that runtime scales need no copy on vnni.
+    const auto &jcp = pd()->jcp_;
+    if (!(jcp.signed_input && jcp.ver != ver_vnni)) return oscales;
+
+    auto local_scales = scratchpad.template get<float>(
+            key_conv_adjusted_scales);
+    const float factor = 1.f / jcp.wei_adj_scale;
+    if (jcp.is_oc_scale) {
+        for (dim_t c = 0; c < pd()->OC(); c++)
+            local_scales[c] = oscales[c] * factor;
+    } else {
+        utils::array_set(local_scales, oscales[0] * factor, 16);
+    }
+    return local_scales;
+}
+
 template struct jit_avx512_core_x8s8s32x_convolution_fwd_t<data_type::s8,
         data_type::u8>;
 template struct jit_avx512_core_x8s8s32x_convolution_fwd_t<data_type::u8,
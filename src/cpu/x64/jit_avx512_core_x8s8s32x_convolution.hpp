@@ -37,7 +37,9 @@ struct jit_avx512_core_x8s8s32x_convolution_fwd_t : public primitive_t {
     struct pd_t : public cpu_convolution_fwd_pd_t {
         pd_t(const convolution_desc_t *adesc, const primitive_attr_t *attr,
                 const typename pd_t::base_class *hint_fwd_pd)
-            : cpu_convolution_fwd_pd_t(adesc, attr, hint_fwd_pd), jcp_() {}
+            : cpu_convolution_fwd_pd_t(adesc, attr, hint_fwd_pd)
+            , jcp_()
+            , pooled_dst_md_() {}
 
         DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("jit_int8:",
                                     ((jcp_.ver == ver_vnni) ? avx512_core_vnni
@@ -55,7 +57,7 @@ struct jit_avx512_core_x8s8s32x_convolution_fwd_t : public primitive_t {
                             utils::one_of(bias_md_.data_type, data_type::f32,
                                     data_type::s32, data_type::s8,
                                     data_type::u8))
-                    && attr()->has_default_values(smask_t::oscale
+                    && attr()->has_default_values(smask_t::oscale_runtime
                                     | smask_t::zero_points_runtime
                                     | smask_t::post_ops,
                             dst_type)
@@ -67,6 +69,13 @@ struct jit_avx512_core_x8s8s32x_convolution_fwd_t : public primitive_t {
                     *attr(), dnnl_get_max_threads());
             if (status != status::success) return status;
 
+            if (jcp_.with_pool) {
+                const dims_t pooled_dims = {dst_md_.dims[0], dst_md_.dims[1],
+                        dst_md_.dims[2] / 2, dst_md_.dims[3] / 2};
+                CHECK(dnnl_memory_desc_init_by_tag(&pooled_dst_md_, 4,
+                        pooled_dims, dst_md_.data_type, jcp_.dst_tag));
+            }
+
             auto scratchpad = scratchpad_registry().registrar();
             jit_avx512_core_x8s8s32x_fwd_kernel::init_scratchpad(
                     scratchpad, jcp_, *attr());
@@ -74,7 +83,16 @@ struct jit_avx512_core_x8s8s32x_convolution_fwd_t : public primitive_t {
             return status;
         }
 
+        const memory_desc_t *dst_md(int index = 0) const override {
+            if (index == 0 && jcp_.with_pool) return &pooled_dst_md_;
+            return cpu_convolution_fwd_pd_t::dst_md(index);
+        }
+
+        // the dst of the convolution itself, before the pooling post-op
+        const memory_desc_t *conv_dst_md() const { return &dst_md_; }
+
         jit_conv_conf_t jcp_;
+        memory_desc_t pooled_dst_md_;
 
     protected:
         bool zero_points_ok() const {
@@ -111,6 +129,8 @@ struct jit_avx512_core_x8s8s32x_convolution_fwd_t : public primitive_t {
         else if (_pd->ndims() == 4)
             if (_pd->jcp_.is_depthwise)
                 return execute_forward_2d_dw(ctx);
+            else if (_pd->jcp_.with_pool)
+                return execute_forward_2d_pool(ctx);
             else
                 return execute_forward_2d(ctx);
         else if (_pd->ndims() == 5)
@@ -122,7 +142,10 @@ private:
     status_t execute_forward_1d(const exec_ctx_t &ctx) const;
     status_t execute_forward_2d(const exec_ctx_t &ctx) const;
     status_t execute_forward_2d_dw(const exec_ctx_t &ctx) const;
+    status_t execute_forward_2d_pool(const exec_ctx_t &ctx) const;
     status_t execute_forward_3d(const exec_ctx_t &ctx) const;
+    const float *adjust_oscales(const memory_tracking::grantor_t &scratchpad,
+            const float *oscales) const;
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
 
     std::unique_ptr<jit_avx512_core_x8s8s32x_fwd_kernel> kernel_;
@@ -340,6 +340,14 @@ status_t _jit_avx512_core_x8s8s32x_deconv_fwd_kernel::init_conf(
             ? weights_d.extra().scale_adjust
             : 1.f;
 
+    /* With the signed source, the taps that fall in the stride holes are
+       computed on the shifted zeros, so that the compensation of all the
+       taps applies to every output. For 1D and 2D, the compensation is
+       instead computed per stride phase, and only the taps of the phase of
+       an output are computed. */
+    jcp.stride_phase_comp = jcp.signed_input && !jcp.is_depthwise && !is_3d
+            && (jcp.stride_h > 1 || jcp.stride_w > 1);
+
     jcp.loop_order = jcp.ngroups > 1 ? loop_ngc : loop_cgn;
     return status::success;
 }
@@ -368,6 +376,9 @@ void _jit_avx512_core_x8s8s32x_deconv_fwd_kernel::init_scratchpad(
         dim_t count = nstl::max<dim_t>(attr.output_scales_.count_, 16);
         scratchpad.book<float>(key_conv_adjusted_scales, count);
     }
+    if (jcp.stride_phase_comp)
+        scratchpad.book<int32_t>(key_deconv_phase_comp,
+                (size_t)jcp.stride_h * jcp.stride_w * jcp.ngroups * jcp.oc);
 }
 
 template <typename Vmm>
@@ -376,7 +387,9 @@ void jit_avx512_core_x8s8s32x_deconv_fwd_kernel<Vmm>::compute_ker(int ur_w,
         bool h_padded) {
 
     const int ch_block_all = jcp.ch_block * jcp.ic_block * jcp.oc_block;
-    const int ur_w_stride = jcp.signed_input ? 1 : jcp.stride_w;
+    const int ur_w_stride = jcp.signed_input && !jcp.stride_phase_comp
+            ? 1
+            : jcp.stride_w;
 
     auto src_offset = [=](int oj, int icb, int ki) {
         return jcp.typesize_in
@@ -412,6 +425,9 @@ void jit_avx512_core_x8s8s32x_deconv_fwd_kernel<Vmm>::compute_ker(int ur_w,
 
         int _start = (jcp.signed_input) ? 0 : jj_start;
         int _end = (jcp.signed_input) ? ur_w : jj_end;
+        /* only the outputs of the stride phase of ki */
+        if (jcp.stride_phase_comp)
+            _start = modulo(ki - jcp.l_pad, jcp.stride_w);
 
         int tail_size = jcp.is_depthwise ? jcp.ngroups % jcp.ch_block
                                          : jcp.ic_without_padding % 4;
@@ -502,7 +518,9 @@ void jit_avx512_core_x8s8s32x_deconv_fwd_kernel<Vmm>::kh_loop(int ur_w,
             * jcp.ngroups * jcp.ic_without_padding;
     int shift_src_id = jcp.typesize_in * (jcp.dilate_d + 1) * jcp.ih * jcp.iw
             * jcp.ngroups * jcp.ic_without_padding;
-    const int stride_h = jcp.signed_input ? 1 : jcp.stride_h;
+    const int stride_h = jcp.signed_input && !jcp.stride_phase_comp
+            ? 1
+            : jcp.stride_h;
     int shift_filt_kh = jcp.typesize_in * jcp.kw * ch_block_all * stride_h;
     const int stride_d = jcp.signed_input ? 1 : jcp.stride_d;
     int shift_filt_kd
@@ -596,7 +614,7 @@ void jit_avx512_core_x8s8s32x_deconv_fwd_kernel<Vmm>::kh_loop(int ur_w,
         dec(reg_kh);
 
         /* Insert weight compensation in stride 'holes' */
-        if (jcp.signed_input && jcp.stride_h > 1) {
+        if (jcp.signed_input && !jcp.stride_phase_comp && jcp.stride_h > 1) {
             Label kh_comp_loop;
 
             cmp(reg_kh, 0);
@@ -749,7 +767,7 @@ void jit_avx512_core_x8s8s32x_deconv_fwd_kernel<Vmm>::store_output(
             if (jcp.signed_input && jcp.ver != ver_vnni)
                 vmulps(vmm_bias, vmm_bias, vmm_bias_alpha());
         }
-        if (jcp.signed_input) {
+        if (jcp.signed_input && !jcp.stride_phase_comp) {
             int comp_offset = sizeof(int32_t) * ocb * jcp.oc_block;
             auto comp_addr = EVEX_compress_addr(reg_compensation, comp_offset);
             cvt2ps(data_type::s32, vmm_comp, comp_addr, mask_flag);
@@ -757,8 +775,17 @@ void jit_avx512_core_x8s8s32x_deconv_fwd_kernel<Vmm>::store_output(
 
         for (int ur = 0; ur < ur_w; ur++) {
             const Vmm vmm = vmm_out(ur, ocb);
+            if (jcp.stride_phase_comp) {
+                /* the output block starts at a multiple of stride_w */
+                const int phase = modulo(ur + jcp.l_pad, jcp.stride_w);
+                size_t comp_offset = sizeof(int32_t)
+                        * (phase * jcp.ngroups * jcp.oc + ocb * jcp.oc_block);
+                vpaddd(vmm, vmm,
+                        EVEX_compress_addr(reg_compensation, comp_offset));
+            }
             vcvtdq2ps(vmm, vmm);
-            if (jcp.signed_input) vaddps(vmm, vmm, vmm_comp);
+            if (jcp.signed_input && !jcp.stride_phase_comp)
+                vaddps(vmm, vmm, vmm_comp);
             if (jcp.with_bias) vaddps(vmm, vmm, vmm_bias);
             const Vmm mask_vmm = mask_flag ? vmm | ktail_mask | T_z : vmm;
             vmulps(mask_vmm, vmm,
@@ -1034,6 +1061,44 @@ void jit_avx512_core_x8s8s32x_deconv_fwd_kernel<Vmm>::generate() {
     if (jcp.with_eltwise) postops_injector_->prepare_table();
 }
 
+template <data_type_t src_type, data_type_t dst_type>
+const int32_t *_jit_avx512_core_x8s8s32x_deconvolution_fwd_t<src_type,
+        dst_type>::compute_phase_compensation(const exec_ctx_t &ctx,
+        const wei_data_t *weights) const {
+    const auto &jcp = pd()->jcp_;
+    const memory_desc_wrapper weights_d(pd()->weights_md(0));
+    const bool with_groups = pd()->with_groups();
+    auto comp = ctx.get_scratchpad_grantor().template get<int32_t>(
+            key_deconv_phase_comp);
+
+    /* comp[ph_h][ph_w][g][oc] = -128 * sum of the weights of the taps with
+       kh % stride_h == ph_h and kw % stride_w == ph_w */
+    const size_t phase_stride = (size_t)jcp.ngroups * jcp.oc;
+    const int nb_phases = jcp.stride_h * jcp.stride_w;
+    parallel_nd(jcp.ngroups, jcp.oc, [&](dim_t g, dim_t oc) {
+        int32_t *c = comp + g * jcp.oc + oc;
+        for (int ph = 0; ph < nb_phases; ph++)
+            c[ph * phase_stride] = 0;
+        if (oc >= jcp.oc_without_padding) return;
+
+        for_(int ic = 0; ic < jcp.ic_without_padding; ic++)
+        for_(int kh = 0; kh < jcp.kh; kh++)
+        for (int kw = 0; kw < jcp.kw; kw++) {
+            dims_t pos;
+            int d = 0;
+            if (with_groups) pos[d++] = g;
+            pos[d++] = oc;
+            pos[d++] = ic;
+            if (jcp.ndims == 4) pos[d++] = kh;
+            pos[d++] = kw;
+            const int ph = (kh % jcp.stride_h) * jcp.stride_w
+                    + kw % jcp.stride_w;
+            c[ph * phase_stride] -= 128 * weights[weights_d.off_v(pos)];
+        }
+    });
+    return comp;
+}
+
 template <data_type_t src_type, data_type_t dst_type>
 void _jit_avx512_core_x8s8s32x_deconvolution_fwd_t<src_type,
         dst_type>::execute_forward_1d(const exec_ctx_t &ctx) const {
@@ -1070,9 +1135,11 @@ void _jit_avx512_core_x8s8s32x_deconvolution_fwd_t<src_type,
     }
     size_t offset = (size_t)jcp.ngroups * jcp.oc * jcp.ic * jcp.kh * jcp.kw;
     auto w = const_cast<wei_data_t *>(weights);
-    int32_t *compensation = (jcp.signed_input)
+    const int32_t *compensation = (jcp.signed_input)
             ? reinterpret_cast<int32_t *>(&w[offset])
             : nullptr;
+    if (jcp.stride_phase_comp)
+        compensation = compute_phase_compensation(ctx, weights);
 
     parallel(jcp.nthr, [&](const int ithr, const int nthr) {
         int start {0}, end {0};
@@ -1159,9 +1226,11 @@ void _jit_avx512_core_x8s8s32x_deconvolution_fwd_t<src_type,
     }
     size_t offset = (size_t)jcp.ngroups * jcp.oc * jcp.ic * jcp.kh * jcp.kw;
     auto w = const_cast<wei_data_t *>(weights);
-    int32_t *compensation = (jcp.signed_input)
+    const int32_t *compensation = (jcp.signed_input)
             ? reinterpret_cast<int32_t *>(&w[offset])
             : nullptr;
+    if (jcp.stride_phase_comp)
+        compensation = compute_phase_compensation(ctx, weights);
 
     parallel(jcp.nthr, [&](const int ithr, const int nthr) {
         int start {0}, end {0};
@@ -1194,7 +1263,7 @@ void _jit_avx512_core_x8s8s32x_deconvolution_fwd_t<src_type,
             auto bias_w = jcp.with_bias
                     ? bias + (bias_d.blk_off(g_oc) * jcp.typesize_bia)
                     : nullptr;
-            int32_t *compensation_w
+            const int32_t *compensation_w
                     = (jcp.signed_input) ? compensation + g_oc : nullptr;
 
             auto scales = &oscales[jcp.is_oc_scale * g_oc];
@@ -1249,6 +1318,18 @@ void _jit_avx512_core_x8s8s32x_deconvolution_fwd_t<src_type,
                                                 + 1));
                 p.b_overflow = kh_lo;
                 p.kh_padding = kh_len;
+                if (jcp.stride_phase_comp) {
+                    /* only the taps of the stride phase of the row */
+                    const int phase = modulo(oj + jcp.t_pad, jcp.stride_h);
+                    const int nb_phase_taps
+                            = div_up(jcp.kh - phase, jcp.stride_h);
+                    p.filt = wht_w + phase * wht_kh_stride;
+                    p.compensation = compensation_w
+                            + (size_t)phase * jcp.stride_w * jcp.ngroups
+                                    * jcp.oc;
+                    p.b_overflow = (kh_lo - phase) / jcp.stride_h;
+                    p.t_overflow = nb_phase_taps - kh_len - p.b_overflow;
+                }
                 p.scales = scales;
                 p.oc_blocks = jcp.is_depthwise ? g : ocb;
                 p.post_ops_binary_rhs_arg_vec
@@ -0,0 +1,377 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <string.h>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_primitive.hpp"
+
+#include "cpu/x64/amx_tile_configure.hpp"
+#include "cpu/x64/jit_brgemm_conv.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+using namespace dnnl::impl::data_type;
+using namespace dnnl::impl::memory_tracking::names;
+using namespace dnnl::impl::status;
+using namespace dnnl::impl::utils;
+
+using namespace nstl;
+
+namespace {
+
+dim_t get_blk_off(const memory_desc_wrapper &md, int ndims, dim_t x0,
+        dim_t x1, int d, int h, int w) {
+    switch (ndims) {
+        case 3: return md.blk_off(x0, x1, w);
+        case 4: return md.blk_off(x0, x1, h, w);
+        case 5: return md.blk_off(x0, x1, d, h, w);
+        default: assert(!"unsupported ndims"); return 0;
+    }
+}
+
+} // namespace
+
+template <cpu_isa_t isa>
+status_t brgemm_convolution_fwd_t<isa>::pd_t::init(engine_t *engine) {
+    const auto src_type = src_md(0)->data_type;
+    const bool is_int8 = one_of(src_type, u8, s8);
+
+    auto check_attr = [=]() {
+        if (is_int8) {
+            return attr()->has_default_values(
+                    primitive_attr_t::skip_mask_t::oscale
+                    | primitive_attr_t::skip_mask_t::post_ops);
+        } else {
+            return attr()->has_default_values(
+                    primitive_attr_t::skip_mask_t::post_ops);
+        }
+    };
+
+    VDISPATCH(is_fwd(), prop_kind);
+    VDISPATCH(mayiuse(isa), isa);
+    VDISPATCH(set_default_alg_kind(alg_kind::convolution_direct), alg_kind);
+    VDISPATCH(IMPLICATION(with_bias(),
+                    ((is_int8
+                             && one_of(bias_md_.data_type, f32, s32, s8, u8))
+                            || (src_type == bf16
+                                    && one_of(bias_md_.data_type, f32, bf16))
+                            || everyone_is(f32, src_type, bias_md_.data_type))),
+            data_type);
+    VDISPATCH(check_attr(), attr);
+    VDISPATCH(!has_zero_dim_memory(), zero_dim);
+
+    CHECK(brgemm_convolution_utils::init_conf(isa, jbgp_, *desc(), src_md_,
+            weights_md_, dst_md_, bias_md_, *attr(), dnnl_get_max_threads()));
+
+    const float alpha = 1.0;
+    const float beta = 1.0;
+    const float beta_init = 0.0;
+    for_(int i_init = 0; i_init < 2; i_init++)
+    for_(int i_M = 0; i_M < 2; i_M++)
+    for_(int i_N = 0; i_N < 2; i_N++)
+    for (int i_K = 0; i_K < 2; i_K++) {
+        auto vbeta = (i_init) ? beta_init : beta;
+        auto vM = (i_M) ? jbgp_.M_tail : jbgp_.M;
+        auto vN = (i_N) ? jbgp_.N_tail : jbgp_.N;
+        auto vK = (i_K) ? jbgp_.K_tail : jbgp_.K;
+
+        int idx = get_brg_kernel_idx(i_init, i_M, i_N, i_K);
+        if (idx < 0) continue;
+        brgemm_t &brg = brg_descs_[idx];
+        CHECK(brgemm_desc_init(&brg, isa, jbgp_.brg_type, jbgp_.src_dt,
+                jbgp_.wei_dt, false, false, brgemm_row_major, alpha, vbeta,
+                jbgp_.LDA, jbgp_.LDB, jbgp_.LDC, vM, vN, vK));
+
+        CHECK(brgemm_desc_add_postops(
+                &brg, attr(), jbgp_.dst_dt, jbgp_.LDD, jbgp_.bia_dt));
+    }
+
+    auto scratchpad = scratchpad_registry().registrar();
+    brgemm_convolution_utils::init_scratchpad(scratchpad, jbgp_);
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_convolution_fwd_t<isa>::init(engine_t *engine) {
+    const auto &jbgp = pd()->jbgp_;
+
+    const brgemm_t *descs[max_num_brg_kernels_conv] = {nullptr};
+    for_(int i_M = 0; i_M < 2; i_M++)
+    for_(int i_N = 0; i_N < 2; i_N++)
+    for_(int i_K = 0; i_K < 2; i_K++)
+    for (int i_init = 0; i_init < 2; i_init++) {
+        int idx = pd()->get_brg_kernel_idx(i_init, i_M, i_N, i_K);
+        if (idx >= 0) descs[idx] = &pd()->brg_descs_[idx];
+    }
+
+    brgemm_kernel_t *kers[max_num_brg_kernels_conv];
+    CHECK(brgemm_kernels_create(max_num_brg_kernels_conv, kers, descs));
+    for (int idx = 0; idx < max_num_brg_kernels_conv; idx++) {
+        if (!descs[idx]) continue;
+        CHECK(safe_ptr_assign(brg_kernels_[idx], kers[idx]));
+        if (one_of(isa, avx512_core_bf16_amx_int8, avx512_core_bf16_amx_bf16))
+            CHECK(brgemm_init_tiles(
+                    pd()->brg_descs_[idx], &brg_kernel_palettes_[idx][0]));
+    }
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper weights_d(pd()->weights_md(0));
+    const size_t src_dt_sz = types::data_type_size(jbgp.src_dt);
+    const size_t wei_dt_sz = types::data_type_size(jbgp.wei_dt);
+    const int iwp = brgemm_convolution_utils::get_padded_iw(jbgp);
+
+    auto add_tap = [&](int kd, int kh, int kw, int icb) {
+        const int id = kd * (jbgp.dilate_d + 1);
+        const int ih = kh * (jbgp.dilate_h + 1);
+        const int iw = kw * (jbgp.dilate_w + 1);
+        const dim_t ic = (dim_t)icb * jbgp.ic_block;
+        const dim_t off_A = jbgp.use_buffer_a
+                ? (((dim_t)kd * jbgp.kh + kh) * iwp + iw) * jbgp.ic + ic
+                : get_blk_off(src_d, jbgp.ndims, 0, ic, id, ih, iw)
+                        - src_d.offset0();
+        const dim_t off_B
+                = get_blk_off(weights_d, jbgp.ndims, 0, icb, kd, kh, kw)
+                - weights_d.offset0();
+        offs_A_.push_back(src_dt_sz * off_A);
+        offs_B_.push_back(wei_dt_sz * off_B);
+    };
+
+    const int nb_ic_full = jbgp.ic / jbgp.ic_block;
+    offs_A_.reserve(jbgp.gemm_batch_size);
+    offs_B_.reserve(jbgp.gemm_batch_size);
+    for_(int kd = 0; kd < jbgp.kd; kd++)
+    for_(int kh = 0; kh < jbgp.kh; kh++)
+    for_(int kw = 0; kw < jbgp.kw; kw++)
+    for (int icb = 0; icb < nb_ic_full; icb++)
+        add_tap(kd, kh, kw, icb);
+    bs_main_ = (int)offs_A_.size();
+
+    if (jbgp.K_tail > 0) {
+        for_(int kd = 0; kd < jbgp.kd; kd++)
+        for_(int kh = 0; kh < jbgp.kh; kh++)
+        for (int kw = 0; kw < jbgp.kw; kw++)
+            add_tap(kd, kh, kw, nb_ic_full);
+    }
+    bs_tail_ = (int)offs_A_.size() - bs_main_;
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+void brgemm_convolution_fwd_t<isa>::execute_forward(
+        const exec_ctx_t &ctx) const {
+    auto src = CTX_IN_MEM(const char *, DNNL_ARG_SRC);
+    auto weights = CTX_IN_MEM(const char *, DNNL_ARG_WEIGHTS);
+    auto bias = CTX_IN_MEM(const char *, DNNL_ARG_BIAS);
+    auto dst = CTX_OUT_MEM(char *, DNNL_ARG_DST);
+
+    memory_tracking::grantor_t scratchpad = ctx.get_scratchpad_grantor();
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+    const memory_desc_wrapper weights_d(pd()->weights_md(0));
+
+    const float *oscales = pd()->attr()->output_scales_.scales_;
+
+    const auto &jbgp = pd()->jbgp_;
+    const int ndims = jbgp.ndims;
+
+    const size_t src_dt_sz = types::data_type_size(jbgp.src_dt);
+    const size_t wei_dt_sz = types::data_type_size(jbgp.wei_dt);
+    const size_t dst_dt_sz = types::data_type_size(jbgp.dst_dt);
+    const size_t acc_dt_sz = types::data_type_size(jbgp.acc_dt);
+    const size_t bia_dt_sz
+            = jbgp.with_bias ? types::data_type_size(jbgp.bia_dt) : 0;
+
+    char *c_buffer_global = (jbgp.use_buffer)
+            ? scratchpad.template get<char>(key_brgemm_primitive_buffer)
+            : nullptr;
+    char *a_buffer_global = (jbgp.use_buffer_a)
+            ? scratchpad.template get<char>(key_brgemm_primitive_buffer_a)
+            : nullptr;
+    const bool is_amx = one_of(
+            jbgp.isa, avx512_core_bf16_amx_int8, avx512_core_bf16_amx_bf16);
+    char *wsp_tile_base = is_amx
+            ? scratchpad.template get<char>(key_conv_amx_tile_buffer)
+            : nullptr;
+
+    const bool are_post_ops_applicable = one_of(true, jbgp.with_sum,
+            jbgp.with_bias, jbgp.with_scales, jbgp.with_eltwise,
+            jbgp.acc_dt != jbgp.dst_dt, jbgp.signed_input);
+
+    const size_t offset = weights_d.size() - weights_d.additional_buffer_size();
+    const int32_t *compensation = (jbgp.signed_input)
+            ? reinterpret_cast<const int32_t *>(&weights[offset])
+            : nullptr;
+
+    const int iwp = brgemm_convolution_utils::get_padded_iw(jbgp);
+    const size_t a_row_size = (size_t)iwp * jbgp.ic * src_dt_sz;
+    const size_t a_buffer_size = jbgp.kd * jbgp.kh * a_row_size;
+
+    // Copies the src rows used by the output row (n, od, oh) into the
+    // buffer, filling the padded area with zeros.
+    const auto copy_src_rows = [&](char *a_buffer, int n, int od, int oh) {
+        const int copy_s = nstl::min(jbgp.l_pad, iwp);
+        const int copy_e
+                = nstl::max(copy_s, nstl::min(iwp, jbgp.l_pad + jbgp.iw));
+        const size_t pix_size = jbgp.ic * src_dt_sz;
+        for_(int kd = 0; kd < jbgp.kd; kd++)
+        for (int kh = 0; kh < jbgp.kh; kh++) {
+            char *row = a_buffer + (kd * jbgp.kh + kh) * a_row_size;
+            const int id = od * jbgp.stride_d - jbgp.f_pad
+                    + kd * (jbgp.dilate_d + 1);
+            const int ih = oh * jbgp.stride_h - jbgp.t_pad
+                    + kh * (jbgp.dilate_h + 1);
+            if (id < 0 || id >= jbgp.id || ih < 0 || ih >= jbgp.ih) {
+                memset(row, 0, a_row_size);
+                continue;
+            }
+            if (copy_s > 0) memset(row, 0, copy_s * pix_size);
+            if (copy_e > copy_s)
+                memcpy(row + copy_s * pix_size,
+                        src
+                                + src_dt_sz
+                                        * get_blk_off(src_d, ndims, n, 0, id,
+                                                ih, copy_s - jbgp.l_pad),
+                        (copy_e - copy_s) * pix_size);
+            if (copy_e < iwp)
+                memset(row + copy_e * pix_size, 0, (iwp - copy_e) * pix_size);
+        }
+    };
+
+    const auto ker = [&](const int ithr, char *a_buffer, int n, int od,
+                             int oh, int owb, int ocb) {
+        char *c_buffer = (jbgp.use_buffer)
+                ? c_buffer_global + ithr * acc_dt_sz * jbgp.LDC * jbgp.M
+                : nullptr;
+        char *wsp_tile = is_amx ? wsp_tile_base + ithr * 1024 : nullptr;
+
+        const int ow = owb * jbgp.ow_block;
+        const int oc = ocb * jbgp.oc_block;
+        const bool is_M_tail = (jbgp.ow - ow < jbgp.ow_block);
+        const bool is_N_tail = (jbgp.oc - oc < jbgp.oc_block);
+
+        const char *ptr_A = jbgp.use_buffer_a
+                ? a_buffer + src_dt_sz * ow * jbgp.stride_w * jbgp.ic
+                : src
+                        + src_dt_sz
+                                * get_blk_off(src_d, ndims, n, 0,
+                                        od * jbgp.stride_d, oh * jbgp.stride_h,
+                                        ow * jbgp.stride_w);
+        const char *ptr_B = weights
+                + wei_dt_sz * get_blk_off(weights_d, ndims, ocb, 0, 0, 0, 0);
+        char *ptr_D = dst
+                + dst_dt_sz * get_blk_off(dst_d, ndims, n, oc, od, oh, ow);
+        char *ptr_C = (jbgp.use_buffer) ? c_buffer : ptr_D;
+        const char *bias_w = jbgp.with_bias ? bias + bia_dt_sz * oc : nullptr;
+        void *scratch = is_amx ? (void *)wsp_tile
+                               : (jbgp.signed_input ? (void *)&compensation[oc]
+                                                    : nullptr);
+
+        if (bs_main_ > 0) {
+            int brg_ker_idx = pd()->get_brg_kernel_idx(
+                    true, is_M_tail, is_N_tail, false);
+            auto brg_kernel = brg_kernels_[brg_ker_idx].get();
+            if (is_amx)
+                amx_tile_configure(&brg_kernel_palettes_[brg_ker_idx][0]);
+            if (are_post_ops_applicable && bs_tail_ == 0) {
+                brgemm_kernel_execute_postops(brg_kernel, bs_main_, ptr_A,
+                        offs_A_.data(), ptr_B, offs_B_.data(), (void *)ptr_C,
+                        (void *)ptr_D, bias_w, &oscales[jbgp.is_oc_scale * oc],
+                        scratch);
+            } else {
+                brgemm_kernel_execute(brg_kernel, bs_main_, ptr_A,
+                        offs_A_.data(), ptr_B, offs_B_.data(), (void *)ptr_C,
+                        is_amx ? (void *)wsp_tile : nullptr);
+            }
+        }
+
+        if (bs_tail_ > 0) {
+            int brg_ker_idx = pd()->get_brg_kernel_idx(
+                    bs_main_ == 0, is_M_tail, is_N_tail, true);
+            auto brg_kernel_ic_tail = brg_kernels_[brg_ker_idx].get();
+            if (is_amx)
+                amx_tile_configure(&brg_kernel_palettes_[brg_ker_idx][0]);
+            if (are_post_ops_applicable) {
+                brgemm_kernel_execute_postops(brg_kernel_ic_tail, bs_tail_,
+                        ptr_A, offs_A_.data() + bs_main_, ptr_B,
+                        offs_B_.data() + bs_main_, (void *)ptr_C,
+                        (void *)ptr_D, bias_w, &oscales[jbgp.is_oc_scale * oc],
+                        scratch);
+            } else {
+                brgemm_kernel_execute(brg_kernel_ic_tail, bs_tail_, ptr_A,
+                        offs_A_.data() + bs_main_, ptr_B,
+                        offs_B_.data() + bs_main_, (void *)ptr_C,
+                        is_amx ? (void *)wsp_tile : nullptr);
+            }
+        }
+    };
+
+    const dim_t work_amount = (dim_t)jbgp.mb * jbgp.nb_od * jbgp.oh
+            * jbgp.od_block * jbgp.nb_ow * jbgp.nb_oc;
+
+    parallel(0, [&](const int ithr, const int nthr) {
+        if (ithr >= work_amount) return;
+
+        dim_t start {0}, end {0};
+        balance211(work_amount, nthr, ithr, start, end);
+
+        char *a_buffer = (jbgp.use_buffer_a)
+                ? a_buffer_global + ithr * a_buffer_size
+                : nullptr;
+        dim_t last_row = -1;
+
+        int n {0}, odb {0}, oh {0}, odi {0}, owb {0}, ocb {0};
+        nd_iterator_init(start, n, jbgp.mb, odb, jbgp.nb_od, oh, jbgp.oh, odi,
+                jbgp.od_block, owb, jbgp.nb_ow, ocb, jbgp.nb_oc);
+        while (start < end) {
+            // the last block of od may be incomplete
+            const int od = odb * jbgp.od_block + odi;
+            if (od < jbgp.od) {
+                if (jbgp.use_buffer_a) {
+                    const dim_t row
+                            = ((dim_t)n * jbgp.od + od) * jbgp.oh + oh;
+                    if (row != last_row) copy_src_rows(a_buffer, n, od, oh);
+                    last_row = row;
+                }
+                ker(ithr, a_buffer, n, od, oh, owb, ocb);
+            }
+            ++start;
+            nd_iterator_step(n, jbgp.mb, odb, jbgp.nb_od, oh, jbgp.oh, odi,
+                    jbgp.od_block, owb, jbgp.nb_ow, ocb, jbgp.nb_oc);
+        }
+    });
+}
+
+template struct brgemm_convolution_fwd_t<avx512_core>;
+template struct brgemm_convolution_fwd_t<avx512_core_bf16>;
+template struct brgemm_convolution_fwd_t<avx512_core_vnni>;
+template struct brgemm_convolution_fwd_t<avx512_core_bf16_amx_int8>;
+template struct brgemm_convolution_fwd_t<avx512_core_bf16_amx_bf16>;
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
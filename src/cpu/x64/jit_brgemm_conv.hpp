@@ -0,0 +1,112 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_JIT_BRGEMM_CONV_HPP
+#define CPU_X64_JIT_BRGEMM_CONV_HPP
+
+#include <vector>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/primitive.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_convolution_pd.hpp"
+#include "cpu/platform.hpp"
+
+#include "cpu/x64/brgemm/brgemm.hpp"
+#include "cpu/x64/cpu_isa_traits.hpp"
+#include "cpu/x64/jit_brgemm_conv_utils.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+namespace {
+static const int max_num_brg_kernels_conv = 2 * 2 * 2 * 2;
+
+inline int get_brg_kernel_index(const jit_brgemm_primitive_conf_t &jbgp,
+        bool do_initialization, bool is_M_tail, bool is_N_tail,
+        bool is_K_tail) {
+    auto vM = (is_M_tail) ? jbgp.M_tail : jbgp.M;
+    auto vN = (is_N_tail) ? jbgp.N_tail : jbgp.N;
+    auto vK = (is_K_tail) ? jbgp.K_tail : jbgp.K;
+    if (vM == 0 || vN == 0 || vK == 0 || jbgp.LDA < vK || jbgp.LDB < vN
+            || jbgp.LDC < vN)
+        return -1;
+
+    int idx = 8 * (int)do_initialization + 4 * (int)is_M_tail
+            + 2 * (int)is_N_tail + (int)is_K_tail;
+
+    assert(idx < max_num_brg_kernels_conv);
+    return idx;
+}
+
+} // namespace
+
+template <cpu_isa_t isa>
+struct brgemm_convolution_fwd_t : public primitive_t {
+    struct pd_t : public cpu_convolution_fwd_pd_t {
+        pd_t(const convolution_desc_t *adesc, const primitive_attr_t *attr,
+                const typename pd_t::base_class *hint_fwd_pd)
+            : cpu_convolution_fwd_pd_t(adesc, attr, hint_fwd_pd), jbgp_() {}
+
+        DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("brgconv:", isa, ""),
+                brgemm_convolution_fwd_t);
+
+        status_t init(engine_t *engine);
+
+        int get_brg_kernel_idx(bool do_initialization, bool is_M_tail,
+                bool is_N_tail, bool is_K_tail) const {
+            return get_brg_kernel_index(
+                    jbgp_, do_initialization, is_M_tail, is_N_tail, is_K_tail);
+        }
+
+        brgemm_t brg_descs_[max_num_brg_kernels_conv];
+        jit_brgemm_primitive_conf_t jbgp_;
+    };
+
+    brgemm_convolution_fwd_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+
+    status_t execute(const exec_ctx_t &ctx) const override {
+        execute_forward(ctx);
+        return status::success;
+    }
+
+private:
+    void execute_forward(const exec_ctx_t &ctx) const;
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    std::unique_ptr<brgemm_kernel_t> brg_kernels_[max_num_brg_kernels_conv];
+    char brg_kernel_palettes_[max_num_brg_kernels_conv][64];
+
+    // Byte offsets of the batch elements relative to the A (src) and B
+    // (weights) base pointers: taps with full ic blocks first, then taps
+    // with the ic tail block.
+    std::vector<dim_t> offs_A_, offs_B_;
+    int bs_main_ = 0, bs_tail_ = 0;
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
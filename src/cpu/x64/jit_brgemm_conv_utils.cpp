@@ -0,0 +1,283 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "dnnl_types.h"
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/x64/cpu_isa_traits.hpp"
+#include "cpu/x64/jit_brgemm_conv_utils.hpp"
+#include "cpu/x64/jit_brgemm_inner_product_utils.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+using namespace dnnl::impl::status;
+using namespace dnnl::impl::format_tag;
+using namespace dnnl::impl::memory_tracking::names;
+using namespace dnnl::impl::utils;
+
+using namespace prop_kind;
+using namespace data_type;
+
+namespace brgemm_convolution_utils {
+
+status_t init_conf(cpu_isa_t isa, jit_brgemm_primitive_conf_t &jbgp,
+        const convolution_desc_t &cd, memory_desc_t &src_md,
+        memory_desc_t &weights_md, memory_desc_t &dst_md,
+        memory_desc_t &bias_md, const primitive_attr_t &attr, int nthreads) {
+    const memory_desc_wrapper src_d(&src_md);
+    const memory_desc_wrapper weights_d(&weights_md);
+    const memory_desc_wrapper dst_d(&dst_md);
+
+    const bool with_groups = weights_d.ndims() == src_d.ndims() + 1;
+    if (with_groups) return unimplemented;
+
+    jbgp = zero<decltype(jbgp)>();
+    const int ndims = src_d.ndims();
+    jbgp.ndims = ndims;
+    jbgp.isa = isa;
+    jbgp.prop_kind = cd.prop_kind;
+    jbgp.ngroups = 1;
+    jbgp.mb = src_d.dims()[0];
+    jbgp.oc = jbgp.oc_without_padding = dst_d.dims()[1];
+    jbgp.ic = jbgp.ic_without_padding = src_d.dims()[1];
+    jbgp.id = (ndims == 5) ? src_d.dims()[2] : 1;
+    jbgp.ih = (ndims == 3) ? 1 : src_d.dims()[ndims - 2];
+    jbgp.iw = src_d.dims()[ndims - 1];
+    jbgp.od = (ndims == 5) ? dst_d.dims()[2] : 1;
+    jbgp.oh = (ndims == 3) ? 1 : dst_d.dims()[ndims - 2];
+    jbgp.ow = dst_d.dims()[ndims - 1];
+    jbgp.kd = (ndims == 5) ? weights_d.dims()[2] : 1;
+    jbgp.kh = (ndims == 3) ? 1 : weights_d.dims()[ndims - 2];
+    jbgp.kw = weights_d.dims()[ndims - 1];
+
+    jbgp.f_pad = (ndims == 5) ? cd.padding[0][0] : 0;
+    jbgp.t_pad = (ndims == 3) ? 0 : cd.padding[0][ndims - 4];
+    jbgp.l_pad = cd.padding[0][ndims - 3];
+    jbgp.back_pad = (ndims == 5) ? cd.padding[1][0] : 0;
+    jbgp.b_pad = (ndims == 3) ? 0 : cd.padding[1][ndims - 4];
+    jbgp.r_pad = cd.padding[1][ndims - 3];
+    jbgp.stride_d = (ndims == 5) ? cd.strides[0] : 1;
+    jbgp.stride_h = (ndims == 3) ? 1 : cd.strides[ndims - 4];
+    jbgp.stride_w = cd.strides[ndims - 3];
+    jbgp.dilate_d = (ndims == 5) ? cd.dilates[0] : 0;
+    jbgp.dilate_h = (ndims == 3) ? 0 : cd.dilates[ndims - 4];
+    jbgp.dilate_w = cd.dilates[ndims - 3];
+
+    const int full_simd_w = 16;
+    jbgp.simd_w = full_simd_w;
+
+    jbgp.with_bias = cd.bias_desc.format_kind != format_kind::undef;
+
+    jbgp.src_dt = src_d.data_type();
+    jbgp.dst_dt = dst_d.data_type();
+    jbgp.wei_dt = weights_d.data_type();
+    jbgp.bia_dt = jbgp.with_bias ? cd.bias_desc.data_type : data_type::undef;
+    jbgp.signed_input = isa == avx512_core_vnni && jbgp.src_dt == s8;
+
+    const bool is_amx
+            = one_of(isa, avx512_core_bf16_amx_int8, avx512_core_bf16_amx_bf16);
+    const bool is_int8 = one_of(jbgp.src_dt, u8, s8) && jbgp.wei_dt == s8
+            && one_of(jbgp.dst_dt, u8, s8, s32, f32);
+    const bool is_bf16 = everyone_is(bf16, jbgp.src_dt, jbgp.wei_dt)
+            && one_of(jbgp.dst_dt, bf16, f32);
+    const bool is_f32 = everyone_is(f32, jbgp.src_dt, jbgp.wei_dt, jbgp.dst_dt);
+
+    if (!IMPLICATION(is_int8,
+                one_of(isa, avx512_core_vnni, avx512_core_bf16_amx_int8)))
+        return unimplemented;
+    if (!IMPLICATION(is_bf16,
+                one_of(isa, avx512_core_bf16, avx512_core_bf16_amx_bf16)))
+        return unimplemented;
+    if (!IMPLICATION(isa == avx512_core_bf16_amx_bf16, is_bf16))
+        return unimplemented;
+    if (!IMPLICATION(is_f32, isa == avx512_core)) return unimplemented;
+
+    if (is_int8) {
+        jbgp.acc_dt = s32;
+        jbgp.with_scales = true;
+    } else if (is_bf16 || is_f32) {
+        jbgp.acc_dt = f32;
+    } else
+        return unimplemented;
+
+    const auto &p = attr.post_ops_;
+    jbgp.with_sum = p.find(primitive_kind::sum) != -1;
+    const int eltwise_ind = p.find(primitive_kind::eltwise);
+    jbgp.with_eltwise = eltwise_ind != -1;
+    if (jbgp.with_eltwise) jbgp.eltwise = p.entry_[eltwise_ind].eltwise;
+    if (!brgemm_inner_product_utils::post_ops_ok(jbgp, attr))
+        return unimplemented;
+    if (jbgp.with_scales) {
+        const auto &oscales = attr.output_scales_;
+        jbgp.is_oc_scale = oscales.mask_ == 1 << 1;
+
+        // only common and per-oc-channel scales are supported
+        const bool oscales_ok = one_of(oscales.mask_, 0, 1 << 1);
+        if (!oscales_ok) return unimplemented;
+    }
+
+    // Only channels last activations are supported. Blocked layouts are
+    // served by the direct kernels, so src and dst are not allowed to be
+    // 'any' here.
+    auto set_or_check_tags = [&]() -> status_t {
+        const format_tag_t desired_tag = pick(ndims - 3, nwc, nhwc, ndhwc);
+        jbgp.src_tag = memory_desc_matches_one_of_tag(src_md, desired_tag);
+        jbgp.dst_tag = memory_desc_matches_one_of_tag(dst_md, desired_tag);
+        if (one_of(format_tag::undef, jbgp.src_tag, jbgp.dst_tag))
+            return unimplemented;
+
+        if (jbgp.with_bias && bias_md.format_kind == format_kind::any)
+            CHECK(memory_desc_init_by_tag(bias_md, x));
+
+        memory_desc_t want_wei_md = weights_md;
+        // the bf16 tiles take pairs of input channels in a 32 deep
+        // reduction block
+        jbgp.wei_tag = isa == avx512_core_bf16_amx_bf16
+                ? pick(ndims - 3, OIw16i16o2i, OIhw16i16o2i, OIdhw16i16o2i)
+                : brgemm_inner_product_utils::get_brgemm_ip_weights_tag(
+                        isa, (dim_t)jbgp.oc, jbgp.wei_dt, ndims - 2);
+        CHECK(memory_desc_init_by_tag(want_wei_md, jbgp.wei_tag));
+
+        if (jbgp.signed_input) {
+            want_wei_md.extra.flags = 0
+                    | memory_extra_flags::compensation_conv_s8s8
+                    | memory_extra_flags::scale_adjust;
+            want_wei_md.extra.compensation_mask = (1 << 0);
+            want_wei_md.extra.scale_adjust
+                    = platform::s8s8_weights_scale_factor();
+        }
+        if (weights_md.format_kind == format_kind::any) {
+            weights_md = want_wei_md;
+            return success;
+        }
+        return (want_wei_md == weights_md) ? success : unimplemented;
+    };
+
+    CHECK(set_or_check_tags());
+
+    // Each kernel tap and each ic block of the reduction is one element of
+    // the batch, the ow dimension of a single output row is M and the oc
+    // block is N.
+    if (is_amx) {
+        // a tile row is 64 bytes of the reduction dimension
+        jbgp.ic_block = 64 / types::data_type_size(jbgp.src_dt);
+        jbgp.oc_block = jbgp.simd_w;
+    } else {
+        jbgp.ic_block = jbgp.simd_w;
+        if (jbgp.oc >= 4 * jbgp.simd_w) {
+            jbgp.oc_block = 4 * jbgp.simd_w;
+        } else if (jbgp.oc >= 2 * jbgp.simd_w) {
+            jbgp.oc_block = 2 * jbgp.simd_w;
+        } else {
+            jbgp.oc_block = jbgp.simd_w;
+        }
+    }
+
+    jbgp.nb_ic = div_up(jbgp.ic, jbgp.ic_block);
+    jbgp.nb_oc = div_up(jbgp.oc, jbgp.oc_block);
+
+    const int max_M = 64, min_M = is_amx ? 16 : 6;
+    jbgp.ow_block = 1;
+    for (int m_ = max_M; m_ >= min_M; m_--) {
+        if (jbgp.ow % m_ == 0) {
+            jbgp.ow_block = m_;
+            break;
+        }
+    }
+    if (jbgp.ow_block == 1) jbgp.ow_block = nstl::min(jbgp.ow, max_M);
+    jbgp.nb_ow = div_up(jbgp.ow, jbgp.ow_block);
+
+    // The output rows of consecutive od share most of their src planes. The
+    // rows are traversed by blocks of od_block depths at the same oh, so
+    // that the src rows of a block of planes, together with the weights
+    // read by every row, stay in L2 from one oh to the next.
+    jbgp.od_block = 1;
+    if (ndims == 5) {
+        const size_t src_dt_sz = types::data_type_size(jbgp.src_dt);
+        const size_t wei_size = (size_t)jbgp.kd * jbgp.kh * jbgp.kw
+                * jbgp.ic * jbgp.oc * types::data_type_size(jbgp.wei_dt);
+        const int ext_kd = (jbgp.kd - 1) * (jbgp.dilate_d + 1) + 1;
+        const int ext_kh = (jbgp.kh - 1) * (jbgp.dilate_h + 1) + 1;
+        const size_t plane_size
+                = (size_t)ext_kh * jbgp.iw * jbgp.ic * src_dt_sz;
+        const size_t L2 = platform::get_per_core_cache_size(2);
+        const dim_t n_planes
+                = wei_size < L2 ? (dim_t)((L2 - wei_size) / plane_size) : 0;
+        if (n_planes > ext_kd)
+            jbgp.od_block = (int)nstl::min<dim_t>(jbgp.od,
+                    (n_planes - ext_kd) / jbgp.stride_d + 1);
+    }
+    jbgp.nb_od = div_up(jbgp.od, jbgp.od_block);
+
+    jbgp.M = jbgp.ow_block;
+    jbgp.M_tail = jbgp.ow % jbgp.ow_block;
+    jbgp.K = jbgp.ic_block;
+    jbgp.K_tail = jbgp.ic % jbgp.ic_block;
+    jbgp.N = jbgp.oc_block;
+    jbgp.N_tail = jbgp.oc % jbgp.oc_block;
+
+    jbgp.use_buffer = IMPLICATION(jbgp.dst_dt == jbgp.acc_dt, jbgp.with_sum);
+    // Spatial padding is handled by copying the src rows required by an
+    // output row into a zero padded buffer, so that every tap is valid for
+    // every output point and a single M can be used for the whole row.
+    jbgp.use_buffer_a = jbgp.f_pad > 0 || jbgp.t_pad > 0 || jbgp.l_pad > 0
+            || jbgp.back_pad > 0 || jbgp.b_pad > 0 || jbgp.r_pad > 0;
+
+    jbgp.LDA = jbgp.stride_w * jbgp.ic_without_padding;
+    jbgp.LDB = jbgp.N;
+    jbgp.LDC = (jbgp.use_buffer) ? jbgp.N : jbgp.oc_without_padding;
+    jbgp.LDD = jbgp.oc_without_padding;
+
+    jbgp.gemm_batch_size = jbgp.kd * jbgp.kh * jbgp.kw * jbgp.nb_ic;
+    jbgp.brg_type = brgemm_offs;
+    jbgp.nthr = nthreads;
+
+    return success;
+}
+
+void init_scratchpad(memory_tracking::registrar_t &scratchpad,
+        const jit_brgemm_primitive_conf_t &jbgp) {
+    if (jbgp.use_buffer)
+        scratchpad.book(key_brgemm_primitive_buffer,
+                (size_t)jbgp.nthr * jbgp.LDC * jbgp.M,
+                types::data_type_size(jbgp.acc_dt));
+
+    if (jbgp.use_buffer_a) {
+        const size_t row_size = (size_t)get_padded_iw(jbgp) * jbgp.ic;
+        scratchpad.book(key_brgemm_primitive_buffer_a,
+                (size_t)jbgp.nthr * jbgp.kd * jbgp.kh * row_size,
+                types::data_type_size(jbgp.src_dt));
+    }
+
+    if (one_of(jbgp.isa, avx512_core_bf16_amx_int8, avx512_core_bf16_amx_bf16))
+        scratchpad.book(
+                key_conv_amx_tile_buffer, jbgp.nthr * 1024, sizeof(char));
+}
+
+} // namespace brgemm_convolution_utils
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,57 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_JIT_BRGEMM_CONV_UTILS_HPP
+#define CPU_X64_JIT_BRGEMM_CONV_UTILS_HPP
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/memory_tracking.hpp"
+
+#include "cpu/cpu_convolution_pd.hpp"
+#include "cpu/cpu_engine.hpp"
+#include "cpu/platform.hpp"
+#include "cpu/x64/jit_brgemm_primitive_conf.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+namespace brgemm_convolution_utils {
+
+status_t init_conf(cpu_isa_t isa, jit_brgemm_primitive_conf_t &jbgp,
+        const convolution_desc_t &cd, memory_desc_t &src_md,
+        memory_desc_t &weights_md, memory_desc_t &dst_md,
+        memory_desc_t &bias_md, const primitive_attr_t &attr, int nthreads);
+
+void init_scratchpad(memory_tracking::registrar_t &scratchpad,
+        const jit_brgemm_primitive_conf_t &jbgp);
+
+// Width of a zero padded src row which covers all the output points of a row
+inline int get_padded_iw(const jit_brgemm_primitive_conf_t &jbgp) {
+    return (jbgp.ow - 1) * jbgp.stride_w + (jbgp.kw - 1) * (jbgp.dilate_w + 1)
+            + 1;
+}
+
+} // namespace brgemm_convolution_utils
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
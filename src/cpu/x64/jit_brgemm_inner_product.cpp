@@ -16,9 +16,12 @@
 
 #include "common/c_types_map.hpp"
 #include "common/dnnl_thread.hpp"
+#include "common/math_utils.hpp"
 #include "common/type_helpers.hpp"
 #include "common/utils.hpp"
 
+#include "cpu/cpu_primitive.hpp"
+
 #include "cpu/x64/amx_tile_configure.hpp"
 #include "cpu/x64/cpu_barrier.hpp"
 #include "cpu/x64/jit_brgemm_inner_product.hpp"
@@ -38,7 +41,7 @@ using namespace nstl;
 
 template <cpu_isa_t isa, data_type_t src_type, data_type_t wei_type,
         data_type_t dst_type>
-void brgemm_inner_product_fwd_t<isa, src_type, wei_type,
+status_t brgemm_inner_product_fwd_t<isa, src_type, wei_type,
         dst_type>::execute_forward(const exec_ctx_t &ctx) const {
     auto src_ = CTX_IN_MEM(const src_data_t *, DNNL_ARG_SRC);
     auto weights_ = CTX_IN_MEM(const wei_data_t *, DNNL_ARG_WEIGHTS);
@@ -50,7 +53,7 @@ void brgemm_inner_product_fwd_t<isa, src_type, wei_type,
     auto dst = const_cast<dst_data_t *>(dst_);
 
     memory_tracking::grantor_t scratchpad = ctx.get_scratchpad_grantor();
-    const size_t bia_dt_size = pd()->with_bias()
+    size_t bia_dt_size = pd()->with_bias()
             ? types::data_type_size(pd()->desc()->bias_desc.data_type)
             : 0;
 
@@ -78,7 +81,7 @@ void brgemm_inner_product_fwd_t<isa, src_type, wei_type,
     int ic_chunks = jbgp.nb_ic / jbgp.nb_ic_blocking;
     bool are_post_ops_applicable = one_of(true, jbgp.with_sum, jbgp.with_bias,
             jbgp.with_scales, jbgp.with_eltwise, jbgp.acc_dt != jbgp.dst_dt,
-            jbgp.signed_input);
+            jbgp.signed_input, jbgp.src_zero_point, jbgp.dst_zero_point);
 
     size_t offset = weights_d.size() - weights_d.additional_buffer_size();
     auto w = const_cast<wei_data_t *>(weights);
@@ -86,6 +89,26 @@ void brgemm_inner_product_fwd_t<isa, src_type, wei_type,
             ? reinterpret_cast<int32_t *>(&w[offset])
             : nullptr;
 
+    // The src zero point compensation stored after the s8s8 one is
+    // converted into an f32 bias: acc - zp_src * sum(wei) + bias.
+    const bool with_bias = jbgp.with_bias || jbgp.src_zero_point;
+    if (jbgp.src_zero_point) {
+        DEFINE_ZERO_POINT_VALUE(src_zero_point, DNNL_ARG_SRC);
+        const int32_t *zp_compensation = reinterpret_cast<const int32_t *>(
+                                                 &w[offset])
+                + (jbgp.signed_input ? weights_d.padded_dims()[0] : 0);
+        float *zp_bias = scratchpad.template get<float>(
+                key_brgemm_primitive_zp_bias);
+        const auto bia_dt = pd()->desc()->bias_desc.data_type;
+        parallel_nd(jbgp.oc, [&](int oc) {
+            const float b = jbgp.with_bias ? math::get_bias(bias, oc, bia_dt)
+                                           : 0.f;
+            zp_bias[oc] = b + (float)(src_zero_point * zp_compensation[oc]);
+        });
+        bias = reinterpret_cast<const char *>(zp_bias);
+        bia_dt_size = sizeof(float);
+    }
+
     const auto ker = [&](const int ithr, int n, int ocb, int icc) {
         src_data_t **addr_A = addr_A_global + ithr * 16 * jbgp.gemm_batch_size;
         wei_data_t **addr_B = addr_B_global + ithr * 16 * jbgp.gemm_batch_size;
@@ -127,8 +150,7 @@ void brgemm_inner_product_fwd_t<isa, src_type, wei_type,
                                                 : (char *)dst
                                 + sizeof(dst_data_t) * dst_d.blk_off(n, oc);
                 auto ptr_D = dst + dst_d.blk_off(n, oc);
-                auto bias_w
-                        = jbgp.with_bias ? bias + bia_dt_size * oc : nullptr;
+                auto bias_w = with_bias ? bias + bia_dt_size * oc : nullptr;
                 brgemm_kernel_execute_postops(brg_kernel, nb_ic_b,
                         (void **)addr_A, (void **)addr_B, (void *)ptr_C,
                         (void *)ptr_D, (void *)bias_w,
@@ -162,8 +184,7 @@ void brgemm_inner_product_fwd_t<isa, src_type, wei_type,
                                                 : (char *)dst
                                 + sizeof(dst_data_t) * dst_d.blk_off(n, oc);
                 auto ptr_D = dst + dst_d.blk_off(n, oc);
-                auto bias_w
-                        = jbgp.with_bias ? bias + bia_dt_size * oc : nullptr;
+                auto bias_w = with_bias ? bias + bia_dt_size * oc : nullptr;
                 brgemm_kernel_execute_postops(brg_kernel_ic_tail, 1,
                         (void **)addr_A, (void **)addr_B, (void *)ptr_C,
                         (void *)ptr_D, (void *)bias_w,
@@ -204,10 +225,15 @@ void brgemm_inner_product_fwd_t<isa, src_type, wei_type,
             nd_iterator_step(oss, os_chunks, ocb, jbgp.nb_oc);
         }
     });
+
+    return status::success;
 }
 
+template struct brgemm_inner_product_fwd_t<avx512_core, f32>;
 template struct brgemm_inner_product_fwd_t<avx512_core_bf16, bf16>;
 template struct brgemm_inner_product_fwd_t<avx512_core_bf16, bf16, bf16, f32>;
+template struct brgemm_inner_product_fwd_t<avx512_core_bf16, bf16, s8, bf16>;
+template struct brgemm_inner_product_fwd_t<avx512_core_bf16, bf16, s8, f32>;
 template struct brgemm_inner_product_fwd_t<avx512_core_vnni, u8, s8, f32>;
 template struct brgemm_inner_product_fwd_t<avx512_core_vnni, u8, s8, s32>;
 template struct brgemm_inner_product_fwd_t<avx512_core_vnni, u8, s8, u8>;
@@ -478,6 +504,7 @@ void brgemm_inner_product_bwd_data_t<isa, src_type, wei_type,
     });
 }
 
+template struct brgemm_inner_product_bwd_data_t<avx512_core, f32>;
 template struct brgemm_inner_product_bwd_data_t<avx512_core_bf16, bf16>;
 template struct brgemm_inner_product_bwd_data_t<avx512_core_bf16, f32, bf16,
         bf16>;
@@ -950,6 +977,7 @@ void brgemm_inner_product_bwd_weights_t<isa, src_type, diff_wei_type,
     }
 }
 
+template struct brgemm_inner_product_bwd_weights_t<avx512_core, f32>;
 template struct brgemm_inner_product_bwd_weights_t<avx512_core_bf16, bf16>;
 template struct brgemm_inner_product_bwd_weights_t<avx512_core_bf16, bf16, f32,
         bf16>;
@@ -57,6 +57,20 @@ inline int get_brg_kernel_index(const jit_brgemm_primitive_conf_t &jbgp,
     return idx;
 }
 
+// Generates the kernels for all the valid descriptors of a primitive
+template <typename pd_t>
+status_t create_brg_kernels(const pd_t *pd, brgemm_kernel_t **kernels) {
+    const brgemm_t *descs[max_num_brg_kernels_ip] = {nullptr};
+    for_(int i_M = 0; i_M < 2; i_M++)
+    for_(int i_N = 0; i_N < 2; i_N++)
+    for_(int i_K = 0; i_K < 2; i_K++)
+    for (int i_init = 0; i_init < 2; i_init++) {
+        int idx = pd->get_brg_kernel_idx(i_init, i_M, i_N, i_K);
+        if (idx >= 0) descs[idx] = &pd->brg_descs_[idx];
+    }
+    return brgemm_kernels_create(max_num_brg_kernels_ip, kernels, descs);
+}
+
 } // namespace
 
 template <cpu_isa_t isa, impl::data_type_t src_type,
@@ -74,6 +88,13 @@ struct brgemm_inner_product_fwd_t : public primitive_t {
         status_t init(engine_t *engine) {
             auto check_attr = [=]() {
                 if (utils::one_of(src_type, data_type::u8, data_type::s8)) {
+                    return attr()->has_default_values(
+                            primitive_attr_t::skip_mask_t::oscale
+                            | primitive_attr_t::skip_mask_t::post_ops
+                            | primitive_attr_t::skip_mask_t::
+                                    zero_points_runtime);
+                } else if (wei_type == data_type::s8) {
+                    // the scales of the compressed weights
                     return attr()->has_default_values(
                             primitive_attr_t::skip_mask_t::oscale
                             | primitive_attr_t::skip_mask_t::post_ops);
@@ -126,8 +147,11 @@ struct brgemm_inner_product_fwd_t : public primitive_t {
 
                 auto dt_d = dst_type;
                 auto LDD = jbgp_.oc_without_padding;
+                // the src zero point compensation is folded into an f32 bias
+                auto dt_bias = jbgp_.src_zero_point ? data_type::f32
+                                                    : jbgp_.bia_dt;
                 CHECK(brgemm_desc_add_postops(
-                        &brg, attr(), dt_d, LDD, jbgp_.bia_dt));
+                        &brg, attr(), dt_d, LDD, dt_bias));
             }
 
             auto scratchpad = scratchpad_registry().registrar();
@@ -149,16 +173,11 @@ struct brgemm_inner_product_fwd_t : public primitive_t {
     brgemm_inner_product_fwd_t(const pd_t *apd) : primitive_t(apd) {}
 
     status_t init(engine_t *engine) override {
-        for_(int i_M = 0; i_M < 2; i_M++)
-        for_(int i_N = 0; i_N < 2; i_N++)
-        for_(int i_K = 0; i_K < 2; i_K++)
-        for (int i_init = 0; i_init < 2; i_init++) {
-            int idx = pd()->get_brg_kernel_idx(i_init, i_M, i_N, i_K);
-            if (idx < 0) continue;
-
-            brgemm_kernel_t *ker = nullptr;
-            CHECK(brgemm_kernel_create(&ker, pd()->brg_descs_[idx]));
-            CHECK(safe_ptr_assign(brg_kernels_[idx], ker));
+        brgemm_kernel_t *kers[max_num_brg_kernels_ip];
+        CHECK(create_brg_kernels(pd(), kers));
+        for (int idx = 0; idx < max_num_brg_kernels_ip; idx++) {
+            if (!kers[idx]) continue;
+            CHECK(safe_ptr_assign(brg_kernels_[idx], kers[idx]));
             if (isa == avx512_core_bf16_amx_int8)
                 CHECK(brgemm_init_tiles(
                         pd()->brg_descs_[idx], &brg_kernel_palettes_[idx][0]));
@@ -168,12 +187,11 @@ struct brgemm_inner_product_fwd_t : public primitive_t {
     }
 
     status_t execute(const exec_ctx_t &ctx) const override {
-        execute_forward(ctx);
-        return status::success;
+        return execute_forward(ctx);
     }
 
 private:
-    void execute_forward(const exec_ctx_t &ctx) const;
+    status_t execute_forward(const exec_ctx_t &ctx) const;
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
 
     typedef typename prec_traits<src_type>::type src_data_t;
@@ -258,17 +276,10 @@ struct brgemm_inner_product_bwd_data_t : public primitive_t {
 
     status_t init(engine_t *engine) override {
         const auto &jbgp = pd()->jbgp_;
-        for_(int i_M = 0; i_M < 2; i_M++)
-        for_(int i_N = 0; i_N < 2; i_N++)
-        for_(int i_K = 0; i_K < 2; i_K++)
-        for (int i_init = 0; i_init < 2; i_init++) {
-            int idx = pd()->get_brg_kernel_idx(i_init, i_M, i_N, i_K);
-            if (idx < 0) continue;
-
-            brgemm_kernel_t *ker = nullptr;
-            CHECK(brgemm_kernel_create(&ker, pd()->brg_descs_[idx]));
-            CHECK(safe_ptr_assign(brg_kernels_[idx], ker));
-        }
+        brgemm_kernel_t *kers[max_num_brg_kernels_ip];
+        CHECK(create_brg_kernels(pd(), kers));
+        for (int idx = 0; idx < max_num_brg_kernels_ip; idx++)
+            if (kers[idx]) CHECK(safe_ptr_assign(brg_kernels_[idx], kers[idx]));
 
         if (jbgp.use_buffer_b)
             CHECK(create_brgemm_trans_wei(trans_B_kernel_, &pd()->jbgp_));
@@ -357,6 +368,8 @@ struct brgemm_inner_product_bwd_weights_t : public primitive_t {
 
     status_t init(engine_t *engine) override {
         const auto &jbgp = pd()->jbgp_;
+        brgemm_kernel_t *kers[max_num_brg_kernels_ip];
+        CHECK(create_brg_kernels(pd(), kers));
         for_(int i_M = 0; i_M < 2; i_M++)
         for_(int i_N = 0; i_N < 2; i_N++)
         for_(int i_K = 0; i_K < 2; i_K++)
@@ -364,9 +377,7 @@ struct brgemm_inner_product_bwd_weights_t : public primitive_t {
             int idx = pd()->get_brg_kernel_idx(i_init, i_M, i_N, i_K);
             if (idx < 0) continue;
 
-            brgemm_kernel_t *ker = nullptr;
-            CHECK(brgemm_kernel_create(&ker, pd()->brg_descs_[idx]));
-            CHECK(safe_ptr_assign(brg_kernels_[idx], ker));
+            CHECK(safe_ptr_assign(brg_kernels_[idx], kers[idx]));
 
             if (jbgp.with_bias && i_M == 0 && i_init == 0) {
                 kernels_db_[i_K][i_N] = nullptr;
@@ -477,18 +477,40 @@ status_t init_ip_conf(cpu_isa_t isa, jit_brgemm_primitive_conf_t &jbgp,
                             && jbgp.src_dt == f32,
                     everyone_is(bf16, jbgp.src_dt, jbgp.dst_dt)
                             && jbgp.wei_dt == f32);
+    const bool is_f32 = everyone_is(f32, jbgp.src_dt, jbgp.wei_dt, jbgp.dst_dt);
 
     if (!IMPLICATION(is_int8,
                 one_of(isa, avx512_core_vnni, avx512_core_bf16_amx_int8)))
         return status::unimplemented;
     if (!IMPLICATION(is_bf16, isa == avx512_core_bf16))
         return status::unimplemented;
+    if (!IMPLICATION(is_f32, isa == avx512_core)) return status::unimplemented;
+    // Weights-only compression: the kernels convert s8 weights to bf16 on
+    // load, the weights scales are passed as output scales.
+    const bool is_wei_decomp = jbgp.src_dt == bf16 && jbgp.wei_dt == s8
+            && one_of(jbgp.dst_dt, bf16, f32)
+            && one_of(jbgp.prop_kind, forward_training, forward_inference);
+    if (!IMPLICATION(is_wei_decomp, isa == avx512_core_bf16))
+        return status::unimplemented;
 
     if (is_int8) {
         jbgp.acc_dt = s32;
         jbgp.with_scales = true;
-    } else if (is_bf16) {
+
+        // Common zero points only. The src one is compensated through the
+        // weights: the reorder precomputes the sums of the weights over the
+        // input channels, so that it is not done again on every call.
+        const auto &zp = attr.zero_points_;
+        jbgp.src_zero_point = !zp.has_default_values(DNNL_ARG_SRC);
+        jbgp.dst_zero_point = !zp.has_default_values(DNNL_ARG_DST);
+        const bool zp_ok = zp.has_default_values(DNNL_ARG_WEIGHTS)
+                && zp.common(DNNL_ARG_SRC) && zp.common(DNNL_ARG_DST)
+                && zp.defined(DNNL_ARG_DST)
+                && IMPLICATION(jbgp.src_zero_point, isa == avx512_core_vnni);
+        if (!zp_ok) return status::unimplemented;
+    } else if (is_bf16 || is_f32 || is_wei_decomp) {
         jbgp.acc_dt = f32;
+        jbgp.with_scales = is_wei_decomp;
     } else
         return status::unimplemented;
 
@@ -519,8 +541,9 @@ status_t init_ip_conf(cpu_isa_t isa, jit_brgemm_primitive_conf_t &jbgp,
             CHECK(memory_desc_init_by_tag(bias_md, x));
 
         memory_desc_t want_wei_md = weights_md;
-        jbgp.wei_tag = get_brgemm_ip_weights_tag(
-                isa, (dim_t)jbgp.oc, jbgp.wei_dt, ndims - 2);
+        // converted s8 weights are laid out as the bf16 ones
+        jbgp.wei_tag = get_brgemm_ip_weights_tag(isa, (dim_t)jbgp.oc,
+                is_wei_decomp ? bf16 : jbgp.wei_dt, ndims - 2);
         CHECK(memory_desc_init_by_tag(want_wei_md, jbgp.wei_tag));
 
         if (jbgp.signed_input) {
@@ -531,6 +554,11 @@ status_t init_ip_conf(cpu_isa_t isa, jit_brgemm_primitive_conf_t &jbgp,
             want_wei_md.extra.scale_adjust
                     = platform::s8s8_weights_scale_factor();
         }
+        if (jbgp.src_zero_point) {
+            want_wei_md.extra.flags
+                    |= memory_extra_flags::compensation_conv_asymmetric_src;
+            want_wei_md.extra.asymm_compensation_mask = (1 << 0);
+        }
         if (weights_md.format_kind == format_kind::any) {
             weights_md = want_wei_md;
             return status::success;
@@ -561,6 +589,8 @@ void init_scratchpad(memory_tracking::registrar_t &scratchpad,
         scratchpad.book(key_brgemm_primitive_addr_a, n_elems, sc_size, 64);
         scratchpad.book(key_brgemm_primitive_addr_b, n_elems, sc_size, 64);
     }
+    if (jbgp.src_zero_point)
+        scratchpad.book(key_brgemm_primitive_zp_bias, jbgp.oc, sizeof(float));
     if (jbgp.use_buffer) {
         size_t nelements = (size_t)jbgp.nthr * jbgp.LDC * jbgp.M;
         if (jbgp.prop_kind == dnnl_backward_weights && jbgp.nthr_mb > 1) {
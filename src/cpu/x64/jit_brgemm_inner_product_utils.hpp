@@ -35,6 +35,12 @@ namespace x64 {
 
 namespace brgemm_inner_product_utils {
 
+format_tag_t get_brgemm_ip_weights_tag(
+        cpu_isa_t isa, dim_t oc, data_type_t wei_dt, int n_sp_dims);
+
+bool post_ops_ok(
+        jit_brgemm_primitive_conf_t &jbgp, const primitive_attr_t &attr);
+
 status_t init_ip_conf(cpu_isa_t isa, jit_brgemm_primitive_conf_t &jbgp,
         const inner_product_desc_t &ipd, memory_desc_t &src_md,
         memory_desc_t &weights_md, memory_desc_t &dst_md,
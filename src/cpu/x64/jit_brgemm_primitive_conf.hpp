@@ -46,10 +46,13 @@ struct jit_brgemm_primitive_conf_t {
     bool with_eltwise;
     bool with_scales;
     bool signed_input;
+    bool src_zero_point;
+    bool dst_zero_point;
     post_ops_t::entry_t::eltwise_t eltwise;
     int nb_ic, ic_block;
     int nb_oc, oc_block;
     int nb_iw, iw_block;
+    int nb_od, od_block;
     int nb_ow, ow_block;
     int nb_os, os_block;
     int nb_oc_blocking;
@@ -0,0 +1,216 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/dnnl_thread.hpp"
+#include "common/type_helpers.hpp"
+
+#include "cpu/x64/jit_brgemm_sparse_inner_product.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+using namespace dnnl::impl::memory_tracking::names;
+using namespace dnnl::impl::utils;
+
+using pd_t = brgemm_sparse_inner_product_fwd_t::pd_t;
+
+bool pd_t::post_ops_ok() const {
+    using namespace primitive_kind;
+    const auto &p = attr()->post_ops_;
+
+    auto is_eltwise = [&](int idx) { return p.entry_[idx].is_eltwise(); };
+
+    switch (p.len()) {
+        case 0: return true;
+        case 1: return is_eltwise(0) || p.contain(sum, 0);
+        case 2: return p.contain(sum, 0) && is_eltwise(1);
+        default: return false;
+    }
+}
+
+status_t pd_t::set_default_formats() {
+    using namespace format_tag;
+    if (src_md_.format_kind == format_kind::any)
+        CHECK(memory_desc_init_by_tag(src_md_, nc));
+    if (dst_md_.format_kind == format_kind::any)
+        CHECK(memory_desc_init_by_tag(dst_md_, nc));
+    if (bias_md_.format_kind == format_kind::any)
+        CHECK(memory_desc_init_by_tag(bias_md_, x));
+    return status::success;
+}
+
+status_t pd_t::init(engine_t *engine) {
+    using namespace data_type;
+
+    const memory_desc_wrapper wei_d(&weights_md_);
+    bool ok = mayiuse(avx512_core) && is_fwd() && ndims() == 2
+            && wei_d.is_sparse_desc()
+            && expect_data_types(f32, f32, data_type::undef, f32, f32)
+            && IMPLICATION(with_bias(), bias_md_.data_type == f32)
+            && set_default_formats() == status::success
+            && memory_desc_wrapper(&src_md_).matches_tag(format_tag::nc)
+            && memory_desc_wrapper(&dst_md_).matches_tag(format_tag::nc)
+            && attr()->has_default_values(
+                    primitive_attr_t::skip_mask_t::post_ops)
+            && post_ops_ok() && !has_zero_dim_memory();
+    if (!ok) return status::unimplemented;
+
+    // only column blocks reduce to K = 1 gemms, the other shapes are left
+    // to the reference implementation
+    const auto &sd = wei_d.sparse_desc();
+    const dim_t simd_w = 16;
+    ok = sd.block_dims[1] == 1 && sd.block_dims[0] % simd_w == 0
+            && sd.block_dims[0] <= 4 * simd_w;
+    if (!ok) return status::unimplemented;
+
+    const dim_t M_blk_max = 64;
+    M_blk_ = nstl::min(MB(), M_blk_max);
+    nb_M_ = div_up(MB(), M_blk_);
+    M_tail_ = MB() % M_blk_;
+    N_blk_ = sd.block_dims[0];
+    nb_N_ = div_up(OC(), N_blk_);
+    N_tail_ = OC() % N_blk_;
+
+    for_(int i_M = 0; i_M < 2; i_M++)
+    for (int i_N = 0; i_N < 2; i_N++) {
+        const int idx = get_brg_kernel_idx(i_M, i_N);
+        if (idx < 0) continue;
+        const dim_t vM = i_M ? M_tail_ : M_blk_;
+        const dim_t vN = i_N ? N_tail_ : N_blk_;
+        brgemm_t &brg = brg_descs_[idx];
+        CHECK(brgemm_desc_init(&brg, avx512_core, brgemm_addr, f32, f32,
+                false, false, brgemm_row_major, 1.f, 0.f, IC(), N_blk_, OC(),
+                vM, vN, 1));
+        CHECK(brgemm_desc_add_postops(&brg, attr(), f32, OC(),
+                with_bias() ? f32 : data_type::undef));
+    }
+
+    init_scratchpad();
+    return status::success;
+}
+
+void pd_t::init_scratchpad() {
+    // a block row may reference every column of the weights
+    const size_t max_bs = IC();
+    const size_t nthr = dnnl_get_max_threads();
+    auto scratchpad = scratchpad_registry().registrar();
+    scratchpad.book(key_brgemm_primitive_addr_a, nthr * max_bs,
+            sizeof(const void *));
+    scratchpad.book(key_brgemm_primitive_addr_b, nthr * max_bs,
+            sizeof(const void *));
+    // the batch of an empty block row is a single zero block, so that the
+    // kernel still initializes dst and applies the bias and post-ops
+    scratchpad.book<float>(key_brgemm_primitive_buffer_b, N_blk_);
+}
+
+status_t brgemm_sparse_inner_product_fwd_t::init(engine_t *engine) {
+    const brgemm_t *descs[pd_t::max_num_brg_kernels] = {nullptr};
+    for_(int i_M = 0; i_M < 2; i_M++)
+    for (int i_N = 0; i_N < 2; i_N++) {
+        const int idx = pd()->get_brg_kernel_idx(i_M, i_N);
+        if (idx >= 0) descs[idx] = &pd()->brg_descs_[idx];
+    }
+    brgemm_kernel_t *kers[pd_t::max_num_brg_kernels];
+    CHECK(brgemm_kernels_create(pd_t::max_num_brg_kernels, kers, descs));
+    for (int idx = 0; idx < pd_t::max_num_brg_kernels; idx++)
+        if (kers[idx]) CHECK(safe_ptr_assign(brg_kernels_[idx], kers[idx]));
+    return status::success;
+}
+
+status_t brgemm_sparse_inner_product_fwd_t::execute_forward(
+        const exec_ctx_t &ctx) const {
+    auto src = CTX_IN_MEM(const float *, DNNL_ARG_SRC);
+    auto weights = CTX_IN_MEM(const char *, DNNL_ARG_WEIGHTS);
+    auto bias = CTX_IN_MEM(const float *, DNNL_ARG_BIAS);
+    auto dst = CTX_OUT_MEM(float *, DNNL_ARG_DST);
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper wei_d(pd()->weights_md(0));
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+    const auto &sd = wei_d.sparse_desc();
+
+    src += src_d.offset0();
+    dst += dst_d.offset0();
+    const float *values = reinterpret_cast<const float *>(weights);
+    const int32_t *row_ptr
+            = reinterpret_cast<const int32_t *>(weights + sd.row_ptr_offset);
+    const int32_t *col_idx
+            = reinterpret_cast<const int32_t *>(weights + sd.col_idx_offset);
+
+    const dim_t IC = pd()->IC(), OC = pd()->OC();
+    const dim_t M_blk = pd()->M_blk_, nb_M = pd()->nb_M_;
+    const dim_t N_blk = pd()->N_blk_, nb_N = pd()->nb_N_;
+
+    const auto &scratchpad = ctx.get_scratchpad_grantor();
+    auto addr_A_global
+            = scratchpad.get<const void *>(key_brgemm_primitive_addr_a);
+    auto addr_B_global
+            = scratchpad.get<const void *>(key_brgemm_primitive_addr_b);
+    auto zero_blk = scratchpad.get<float>(key_brgemm_primitive_buffer_b);
+    for (dim_t i = 0; i < N_blk; ++i)
+        zero_blk[i] = 0.f;
+
+    parallel(0, [&](const int ithr, const int nthr) {
+        dim_t start {0}, end {0};
+        balance211(nb_M * nb_N, nthr, ithr, start, end);
+        if (start >= end) return;
+
+        const void **addr_A = addr_A_global + ithr * IC;
+        const void **addr_B = addr_B_global + ithr * IC;
+
+        // the block rows are the inner loop, so that a src block is reused
+        // across all the block rows of the weights while it is in cache
+        dim_t mb {0}, nb {0};
+        nd_iterator_init(start, mb, nb_M, nb, nb_N);
+        for (dim_t iwork = start; iwork < end; ++iwork) {
+            const dim_t m = mb * M_blk;
+            const float *src_m = src + m * IC;
+
+            int bs = row_ptr[nb + 1] - row_ptr[nb];
+            for (int b = 0; b < bs; ++b) {
+                const dim_t blk = row_ptr[nb] + b;
+                addr_A[b] = src_m + col_idx[blk];
+                addr_B[b] = values + blk * N_blk;
+            }
+            if (bs == 0) {
+                addr_A[0] = src_m;
+                addr_B[0] = zero_blk;
+                bs = 1;
+            }
+
+            const bool is_M_tail = m + M_blk > pd()->MB();
+            const bool is_N_tail = (nb + 1) * N_blk > OC;
+            const int idx = pd()->get_brg_kernel_idx(is_M_tail, is_N_tail);
+            float *dst_mn = dst + m * OC + nb * N_blk;
+            brgemm_kernel_execute_postops(brg_kernels_[idx].get(), bs, addr_A,
+                    addr_B, dst_mn, dst_mn,
+                    bias ? bias + nb * N_blk : nullptr, nullptr);
+
+            nd_iterator_step(mb, nb_M, nb, nb_N);
+        }
+    });
+
+    return status::success;
+}
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,91 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_JIT_BRGEMM_SPARSE_INNER_PRODUCT_HPP
+#define CPU_X64_JIT_BRGEMM_SPARSE_INNER_PRODUCT_HPP
+
+#include "common/c_types_map.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/primitive.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_inner_product_pd.hpp"
+
+#include "cpu/x64/brgemm/brgemm.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+// f32 forward inner product with weights in the block compressed sparse row
+// format with column blocks (block_dims[1] == 1). Each non-zero block is a
+// K = 1 slice of the weights, so a block row of the weights maps to a
+// batch-reduce gemm over its non-zero blocks with the matching src columns.
+struct brgemm_sparse_inner_product_fwd_t : public primitive_t {
+    struct pd_t : public cpu_inner_product_fwd_pd_t {
+        using cpu_inner_product_fwd_pd_t::cpu_inner_product_fwd_pd_t;
+
+        DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("brgemm:", avx512_core, ""),
+                brgemm_sparse_inner_product_fwd_t);
+
+        status_t init(engine_t *engine);
+
+        bool supports_sparse_weights() const override { return true; }
+
+        int get_brg_kernel_idx(bool is_M_tail, bool is_N_tail) const {
+            const dim_t vM = is_M_tail ? M_tail_ : M_blk_;
+            const dim_t vN = is_N_tail ? N_tail_ : N_blk_;
+            if (vM == 0 || vN == 0) return -1;
+            return 2 * (int)is_M_tail + (int)is_N_tail;
+        }
+
+        static constexpr int max_num_brg_kernels = 2 * 2;
+
+        brgemm_t brg_descs_[max_num_brg_kernels];
+        dim_t M_blk_ = 0, M_tail_ = 0, nb_M_ = 0;
+        dim_t N_blk_ = 0, N_tail_ = 0, nb_N_ = 0;
+
+    private:
+        bool post_ops_ok() const;
+        status_t set_default_formats();
+        void init_scratchpad();
+    };
+
+    brgemm_sparse_inner_product_fwd_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+
+    status_t execute(const exec_ctx_t &ctx) const override {
+        return execute_forward(ctx);
+    }
+
+private:
+    status_t execute_forward(const exec_ctx_t &ctx) const;
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    std::unique_ptr<brgemm_kernel_t>
+            brg_kernels_[pd_t::max_num_brg_kernels];
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,154 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
+#include <atomic>
+
+#include "common/utils.hpp"
+
+#include "cpu/x64/jit_code_arena.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+namespace jit_code_arena {
+
+#ifdef __linux__
+namespace {
+
+// Chunks are aligned to their size, so that the chunk of a code buffer is
+// found by masking its address. A buffer that does not fit a chunk gets a
+// dedicated mapping with the same alignment.
+constexpr size_t chunk_size = 2 * 1024 * 1024;
+constexpr size_t code_align = 64;
+
+struct chunk_t {
+    // live code buffers plus one while a thread allocates from the chunk
+    std::atomic<int> refs;
+    size_t size;
+    // only accessed by the thread that allocates from the chunk
+    size_t offset;
+    uint8_t *last;
+};
+
+const size_t header_size = utils::rnd_up(sizeof(chunk_t), code_align);
+
+chunk_t *map_chunk(size_t size) {
+    const int prot = PROT_READ | PROT_WRITE | PROT_EXEC;
+    void *p = mmap(nullptr, size + chunk_size, prot,
+            MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (p == MAP_FAILED) return nullptr;
+
+    uint8_t *raw = static_cast<uint8_t *>(p);
+    uint8_t *base = reinterpret_cast<uint8_t *>(
+            utils::rnd_up(reinterpret_cast<size_t>(raw), chunk_size));
+    if (base != raw) munmap(raw, base - raw);
+    munmap(base + size, raw + chunk_size - base);
+    madvise(base, size, MADV_HUGEPAGE);
+
+    chunk_t *c = reinterpret_cast<chunk_t *>(base);
+    c->refs = 1;
+    c->size = size;
+    c->offset = header_size;
+    c->last = nullptr;
+    return c;
+}
+
+void release(chunk_t *c) {
+    if (c && --c->refs == 0) munmap(c, c->size);
+}
+
+chunk_t *chunk_of(const void *p) {
+    return reinterpret_cast<chunk_t *>(
+            reinterpret_cast<size_t>(p) & ~(chunk_size - 1));
+}
+
+struct thread_chunk_t {
+    chunk_t *chunk = nullptr;
+    ~thread_chunk_t() { release(chunk); }
+};
+
+thread_local thread_chunk_t thread_chunk;
+
+struct allocator_t : public Xbyak::Allocator {
+    uint8_t *alloc(size_t size) override {
+        const size_t padded_size = utils::rnd_up(size, code_align);
+        if (padded_size > chunk_size - header_size) {
+            chunk_t *c = map_chunk(
+                    utils::rnd_up(header_size + padded_size, chunk_size));
+            return c ? reinterpret_cast<uint8_t *>(c) + header_size : nullptr;
+        }
+
+        chunk_t *&c = thread_chunk.chunk;
+        if (c == nullptr || c->offset + padded_size > c->size) {
+            release(c);
+            c = map_chunk(chunk_size);
+            if (c == nullptr) return nullptr;
+        }
+        uint8_t *p = reinterpret_cast<uint8_t *>(c) + c->offset;
+        c->offset += padded_size;
+        c->last = p;
+        ++c->refs;
+        return p;
+    }
+
+    void free(uint8_t *p) override {
+        if (p == nullptr) return;
+        chunk_t *c = chunk_of(p);
+        if (c == thread_chunk.chunk && c->last == p) {
+            c->offset = p - reinterpret_cast<uint8_t *>(c);
+            c->last = nullptr;
+        }
+        release(c);
+    }
+
+    // The chunks are shared by many kernels and stay executable
+    bool useProtect() const override { return false; }
+};
+
+allocator_t allocator;
+
+} // namespace
+
+Xbyak::Allocator *get_allocator() {
+    static const bool enabled = getenv_int("DNNL_JIT_CODE_ARENA", 0) != 0;
+    return enabled ? &allocator : nullptr;
+}
+
+void trim(const void *code, size_t code_size) {
+    chunk_t *c = thread_chunk.chunk;
+    if (c == nullptr || c->last != code) return;
+    c->offset = static_cast<const uint8_t *>(code)
+            - reinterpret_cast<uint8_t *>(c)
+            + utils::rnd_up(code_size, code_align);
+}
+#else
+Xbyak::Allocator *get_allocator() {
+    return nullptr;
+}
+
+void trim(const void *, size_t) {}
+#endif
+
+} // namespace jit_code_arena
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,47 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_JIT_CODE_ARENA_HPP
+#define CPU_X64_JIT_CODE_ARENA_HPP
+
+#include "cpu/x64/cpu_isa_traits.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+namespace jit_code_arena {
+
+// Returns the Xbyak allocator that packs the JIT code into shared
+// executable chunks backed by huge pages, or nullptr if the arena is disabled
+// (DNNL_JIT_CODE_ARENA environment variable, Linux only).
+//
+// Every thread fills its own chunk, so the kernels of a primitive created by
+// one thread are placed next to each other.
+Xbyak::Allocator *get_allocator();
+
+// Returns the unused tail of a finalized code buffer to the chunk of the
+// calling thread. Does nothing if the buffer was not the last one allocated
+// by the thread.
+void trim(const void *code, size_t code_size);
+
+} // namespace jit_code_arena
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -22,8 +22,10 @@
 #include "common/bit_cast.hpp"
 #include "common/type_helpers.hpp"
 #include "common/utils.hpp"
+#include "common/verbose.hpp"
 
 #include "cpu/x64/cpu_isa_traits.hpp"
+#include "cpu/x64/jit_code_arena.hpp"
 
 #include "cpu/x64/jit_utils/jit_utils.hpp"
 
@@ -1660,7 +1662,8 @@ public:
             bool use_autogrow = true, cpu_isa_t max_cpu_isa = isa_all)
         : Xbyak::CodeGenerator(code_size,
                 (code_ptr == nullptr && use_autogrow) ? Xbyak::AutoGrow
-                                                      : code_ptr)
+                                                      : code_ptr,
+                jit_code_arena::get_allocator())
         , max_cpu_isa_(max_cpu_isa) {}
 
     virtual ~jit_generator() {}
@@ -1682,9 +1685,13 @@ public:
     }
 
     virtual status_t create_kernel() {
+        const double start_ms = get_msec();
         generate();
         jit_ker_ = getCode();
-        return (jit_ker_) ? status::success : status::runtime_error;
+        if (!jit_ker_) return status::runtime_error;
+        jit_utils::record_jit_code_stats(
+                name(), getSize(), get_msec() - start_ms);
+        return status::success;
     }
 
 private:
@@ -1693,6 +1700,7 @@ private:
         this->ready();
         if (!is_initialized()) return nullptr;
         const Xbyak::uint8 *code = CodeGenerator::getCode();
+        jit_code_arena::trim(code, getSize());
         register_jit_code(code, getSize());
         return code;
     }
@@ -107,6 +107,12 @@ struct jit_conv_conf_t {
     bool with_sum;
     bool with_eltwise;
     bool with_binary;
+    // The kernel zeroes the padded channels of a blocked dst itself, after
+    // the post-ops
+    bool zero_pad_dst_in_kernel;
+    // 2x2 pooling post-op: the dst holds the pooled rows only
+    bool with_pool;
+    alg_kind_t pool_alg;
 
     bool is_fused_conv;
     int dw_conv_buffer_oc;
@@ -182,6 +188,8 @@ struct jit_conv_conf_t {
     bool signed_input;
     bool need_saturation;
     float wei_adj_scale;
+    // s8s8 deconvolution: the compensation is computed per stride phase
+    bool stride_phase_comp;
     // zero-point compensation
     bool src_zero_point;
     bool dst_zero_point;
@@ -25,6 +25,8 @@
 #include "common/type_helpers.hpp"
 #include "common/utils.hpp"
 
+#include "cpu/platform.hpp"
+
 #include "cpu/x64/jit_generator.hpp"
 #include "cpu/x64/jit_primitive_conf.hpp"
 
@@ -606,6 +608,25 @@ inline int best_divider(int value, int min_divider, int max_divider,
 
 typedef jit_1x1_conv_conf_t jcp_t;
 
+// Reduces the output channels blocking of a 1x1 convolution fused with a
+// depthwise one, so that the kh rows of the intermediate tensor each thread
+// keeps in its ring buffer take not more than a half of L2. The blocking
+// stays a divisor of nb_load as the fused drivers require.
+inline void fit_dw_conv_buffer_to_l2(
+        jcp_t &jcp, int kh, int iw, size_t typesize) {
+    const size_t l2_size = platform::get_per_core_cache_size(2);
+    auto buffer_size = [&](int nb_load_blocking) {
+        return (size_t)kh * iw * nb_load_blocking * jcp.oc_block * typesize;
+    };
+    while (jcp.nb_load_blocking > 1
+            && buffer_size(jcp.nb_load_blocking) > l2_size / 2) {
+        do {
+            --jcp.nb_load_blocking;
+        } while (jcp.nb_load % jcp.nb_load_blocking != 0);
+    }
+    jcp.nb_load_blocking_max = jcp.nb_load_blocking;
+}
+
 inline bool is_bcast_layout_nxc(const jcp_t &jcp) {
     switch (jcp.prop_kind) {
         case prop_kind::forward_training:
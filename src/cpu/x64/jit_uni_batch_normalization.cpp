@@ -62,6 +62,7 @@ struct jit_bnorm_t : public jit_generator {
         const void *src, *dst;
         const void *diff_src, *diff_dst;
         const acc_data_t *rbuf1, *rbuf2;
+        const acc_data_t *stats_shift;
         const uint8_t *ws;
         barrier::ctx_64_t *barrier;
     };
@@ -93,6 +94,7 @@ struct jit_bnorm_t : public jit_generator {
     Reg64 reg_var = reg_param;
     Reg64 reg_diff_scale_shift = rax;
     Reg64 reg_coff_max_bwd_copy = reg_diff_scale_shift;
+    Reg64 reg_stats_shift = reg_diff_scale_shift;
 
     Reg64 reg_coff = r8;
     Reg64 reg_coff_max = r9;
@@ -171,13 +173,19 @@ struct jit_bnorm_t : public jit_generator {
         stack_off_s_tail = 88,
         stack_off_is_cblk_tail = 96,
         stack_off_ws_off_copy = 104,
-        stack_size_required = 112,
+        stack_off_stats_shift = 112,
+        stack_size_required = 120,
     };
 
     int bit_shift() { return 5 - is_bf16_; }
 
     bool stream_store_supported() { return !is_bf16_; }
 
+    // Statistics for blocked layouts are computed by a single pass over src
+    bool is_single_pass_stats() const {
+        return bdesc_->is_fwd() && !bdesc_->stats_is_src() && !is_nspc_;
+    }
+
     bool is_c_padded() const {
         const memory_desc_wrapper data_d(bdesc_->src_md());
         return bdesc_->C() != data_d.padded_dims()[1];
@@ -203,7 +211,8 @@ struct jit_bnorm_t : public jit_generator {
     void load_common_params() {
 #define PARAM_OFF(x) offsetof(call_params_t, x)
         mov(reg_rbuf1, ptr[reg_param + PARAM_OFF(rbuf1)]);
-        if (bdesc_->is_bwd()) mov(reg_rbuf2, ptr[reg_param + PARAM_OFF(rbuf2)]);
+        if (bdesc_->is_bwd() || is_single_pass_stats())
+            mov(reg_rbuf2, ptr[reg_param + PARAM_OFF(rbuf2)]);
         mov(reg_coff_max, ptr[reg_param + PARAM_OFF(coff_max)]);
         mov(reg_soff_max, ptr[reg_param + PARAM_OFF(soff_max)]);
         mov(reg_mb_stride_Bc, ptr[reg_param + PARAM_OFF(mb_stride_Bc)]);
@@ -232,6 +241,10 @@ struct jit_bnorm_t : public jit_generator {
         mov(ptr[rsp + stack_off_ws], reg_tmp);
         mov(reg_tmp, ptr[reg_param + PARAM_OFF(barrier)]);
         mov(ptr[rsp + stack_off_barrier], reg_tmp);
+        if (is_single_pass_stats()) {
+            mov(reg_tmp, ptr[reg_param + PARAM_OFF(stats_shift)]);
+            mov(ptr[rsp + stack_off_stats_shift], reg_tmp);
+        }
         if (is_spatial_thr_) {
             mov(reg_tmp, ptr[reg_param + PARAM_OFF(spat_size_loc)]);
             mov(ptr[rsp + stack_off_spat_size_loc], reg_tmp);
@@ -444,6 +457,10 @@ struct jit_bnorm_t : public jit_generator {
                 + 1 * chan_data_offt];
     }
 
+    Address stats_shift_ptr(size_t offt = 0) {
+        return vmmword[reg_stats_shift + reg_coff + offt];
+    }
+
     Address gamma_ptr(size_t offt = 0) {
         return vmmword[reg_scale_shift + reg_coff + offt + 0 * chan_data_offt];
     }
@@ -492,42 +509,6 @@ struct jit_bnorm_t : public jit_generator {
             fini(i);
     }
 
-    void mean_channels() {
-        Label ch_label;
-        L(ch_label);
-        {
-            uni_vmovups(Vmm(0), vmmword[reg_rbuf1 + reg_coff]);
-            spat_loop(
-                    spat_size, unroll_blocks, unroll_regs,
-                    [=](size_t base_reg) {
-                        Vmm v = Vmm(base_reg * 2);
-                        if (base_reg) uni_vpxor(v, v, v);
-                    },
-                    [=](size_t base_reg, size_t i) {
-                        Vmm v0 = Vmm(base_reg * 2 + 0);
-                        Vmm v1 = Vmm(base_reg * 2 + 1);
-                        size_t offt = i * vlen_spat_data_;
-                        uni_vmovups_spat_data(
-                                v1, vmmword[reg_src + reg_soff + offt]);
-                        uni_vaddps(v0, v0, v1);
-                        mic_prefetcht0(
-                                ptr[reg_src + reg_soff + offt + t0_pf_offt]);
-                        mic_prefetcht1(
-                                ptr[reg_src + reg_soff + offt + t1_pf_offt]);
-                    },
-                    [=](size_t base_reg) {
-                        Vmm b = Vmm(0);
-                        Vmm v = Vmm(base_reg * 2);
-                        if (base_reg) uni_vaddps(b, b, v);
-                    });
-            uni_vmovups(vmmword[reg_rbuf1 + reg_coff], Vmm(0));
-
-            add(reg_coff, vlen);
-            cmp(reg_coff, reg_coff_max);
-            jl(ch_label);
-        }
-    }
-
     void mean_variance_nspc(
             const int num_ch_blks, int num_spat_pts, bool compute_mean) {
 
@@ -723,57 +704,67 @@ struct jit_bnorm_t : public jit_generator {
         if (is_bf16_) shl(reg_coff_max, 1);
     }
 
-    void var_channels() {
+    // Accumulates the sums of (src - shift) and (src - shift)^2 in rbuf1 and
+    // rbuf2 respectively. The shift is a per channel src value, which is the
+    // same for all the threads. Since it is close to the mean, the variance
+    // computed from these sums does not suffer from cancellation.
+    void mean_variance_channels() {
         Label ch_label;
         L(ch_label);
         {
-            uni_vmovups_maybe_tail(vmean, mean_ptr());
+            uni_vmovups(vmean, stats_shift_ptr());
             uni_vmovups(Vmm(0), vmmword[reg_rbuf1 + reg_coff]);
+            uni_vmovups(Vmm(1), vmmword[reg_rbuf2 + reg_coff]);
             spat_loop(
                     spat_size, unroll_blocks, unroll_regs,
                     [=](size_t base_reg) {
-                        Vmm v = Vmm(base_reg * 3);
-                        if (base_reg > 0) uni_vpxor(v, v, v);
+                        Vmm vsum = Vmm(base_reg * 3);
+                        Vmm vsqsum = Vmm(base_reg * 3 + 1);
+                        if (base_reg) {
+                            uni_vpxor(vsum, vsum, vsum);
+                            uni_vpxor(vsqsum, vsqsum, vsqsum);
+                        }
                     },
                     [=](size_t base_reg, size_t i) {
-                        Vmm v = Vmm(3 * base_reg);
-                        Vmm vtmp0 = Vmm(3 * base_reg + 1);
-                        Vmm vtmp1 = Vmm(3 * base_reg + 2);
+                        Vmm vsum = Vmm(base_reg * 3);
+                        Vmm vsqsum = Vmm(base_reg * 3 + 1);
+                        Vmm vtmp = Vmm(base_reg * 3 + 2);
                         size_t offt = i * vlen_spat_data_;
                         uni_vmovups_spat_data(
-                                vtmp0, vmmword[reg_src + reg_soff + offt]);
-                        if (isa == sse41) {
-                            movups(vtmp1, vmean);
-                            subps(vtmp1, vtmp0);
-                        } else {
-                            vsubps(vtmp1, vmean, vtmp0);
-                        }
-                        uni_vfmadd231ps(v, vtmp1, vtmp1);
-
+                                vtmp, vmmword[reg_src + reg_soff + offt]);
+                        uni_vsubps(vtmp, vtmp, vmean);
+                        uni_vaddps(vsum, vsum, vtmp);
+                        uni_vfmadd231ps(vsqsum, vtmp, vtmp);
                         mic_prefetcht0(
                                 ptr[reg_src + reg_soff + offt + t0_pf_offt]);
                         mic_prefetcht1(
                                 ptr[reg_src + reg_soff + offt + t1_pf_offt]);
                     },
                     [=](size_t base_reg) {
-                        Vmm b = Vmm(0);
-                        Vmm v = Vmm(base_reg * 3);
-                        if (base_reg) uni_vaddps(b, b, v);
+                        if (base_reg) {
+                            uni_vaddps(Vmm(0), Vmm(0), Vmm(base_reg * 3));
+                            uni_vaddps(Vmm(1), Vmm(1), Vmm(base_reg * 3 + 1));
+                        }
                     });
             uni_vmovups(vmmword[reg_rbuf1 + reg_coff], Vmm(0));
+            uni_vmovups(vmmword[reg_rbuf2 + reg_coff], Vmm(1));
+
             add(reg_coff, vlen);
             cmp(reg_coff, reg_coff_max);
             jl(ch_label);
         }
     }
 
-    void compute_mean_variance() {
+    void compute_mean_variance_single_pass() {
+        mov(reg_stats_shift, ptr[rsp + stack_off_stats_shift]);
+
         uni_vpxor(Vmm(0), Vmm(0), Vmm(0));
         xor_(reg_coff, reg_coff);
         Label zero_rbuf;
         L(zero_rbuf);
         {
             uni_vmovups(vmmword[reg_rbuf1 + reg_coff], Vmm(0));
+            uni_vmovups(vmmword[reg_rbuf2 + reg_coff], Vmm(0));
             add(reg_coff, isa == sse41 ? vlen / 2 : vlen);
             cmp(reg_coff, reg_coff_max);
             jne(zero_rbuf);
@@ -782,39 +773,115 @@ struct jit_bnorm_t : public jit_generator {
         mov(reg_src, ptr[rsp + stack_off_src]);
 
         xor_(reg_soff, reg_soff);
-        Label mean_spatial;
-        L(mean_spatial);
+        Label mean_variance_spatial;
+        L(mean_variance_spatial);
         {
             xor_(reg_coff, reg_coff);
 
             if (isa == sse41) mov(reg_tmp_off, reg_soff);
 
-            is_nspc_ ? compute_mean_variance_nspc() : mean_channels();
+            mean_variance_channels();
 
             if (isa == sse41) {
                 mov(reg_soff, reg_tmp_off);
                 add(reg_src, vlen / 2);
                 mov(reg_coff, vlen / 2);
 
-                mean_channels();
+                mean_variance_channels();
 
                 sub(reg_src, vlen / 2);
             }
 
             // Process next image
-            if (is_nspc_) {
-                // Can use static offset since we comeback after spatial loop
-                add(reg_src, mb_offt);
-                add(reg_soff, mb_offt);
-            } else {
-                add(reg_soff, reg_mb_stride_Bc);
+            add(reg_soff, reg_mb_stride_Bc);
+            cmp(reg_soff, reg_soff_max);
+            jl(mean_variance_spatial);
+        }
+
+        Label no_reduction;
+        barrier();
+        {
+            mov(reg_tmp, ptr[rsp + stack_off_N_ithr]);
+            cmp(reg_tmp, 0);
+            jne(no_reduction);
+            mov(reg_nnthr, ptr[rsp + stack_off_N_nthr]);
+            xor_(reg_coff, reg_coff);
+            Label reduction_channels;
+            L(reduction_channels);
+            {
+                mov(reg_roff, reg_coff);
+                uni_vpxor(Vmm(0), Vmm(0), Vmm(0));
+                uni_vpxor(Vmm(1), Vmm(1), Vmm(1));
+                mov(reg_ctr, reg_nnthr);
+                Label reduction_thrs;
+                L(reduction_thrs);
+                {
+                    uni_vaddps(Vmm(0), Vmm(0), vmmword[reg_rbuf1 + reg_roff]);
+                    uni_vaddps(Vmm(1), Vmm(1), vmmword[reg_rbuf2 + reg_roff]);
+                    add(reg_roff, reg_coff_max);
+                    sub(reg_ctr, 1);
+                    jnz(reduction_thrs);
+                }
+                // mean = shift + E[src - shift]
+                // var = E[(src - shift)^2] - E[src - shift]^2
+                uni_vdivps(Vmm(0), Vmm(0), vchan_size);
+                uni_vdivps(Vmm(1), Vmm(1), vchan_size);
+                uni_vmovups(Vmm(2), Vmm(0));
+                uni_vmulps(Vmm(2), Vmm(2), Vmm(0));
+                uni_vsubps(Vmm(1), Vmm(1), Vmm(2));
+                uni_vpxor(Vmm(2), Vmm(2), Vmm(2));
+                uni_vmaxps(Vmm(1), Vmm(1), Vmm(2));
+                uni_vmovups(Vmm(2), stats_shift_ptr());
+                uni_vaddps(Vmm(0), Vmm(0), Vmm(2));
+                uni_vmovups_maybe_tail(mean_ptr(), Vmm(0));
+                uni_vmovups_maybe_tail(var_ptr(), Vmm(1));
+
+                add(reg_coff, isa == sse41 ? vlen / 2 : vlen);
+                cmp(reg_coff, reg_coff_max);
+                jl(reduction_channels);
             }
+        }
+        L(no_reduction);
+        barrier();
+    }
+
+    void compute_mean_variance() {
+        if (is_single_pass_stats()) {
+            compute_mean_variance_single_pass();
+            return;
+        }
+
+        uni_vpxor(Vmm(0), Vmm(0), Vmm(0));
+        xor_(reg_coff, reg_coff);
+        Label zero_rbuf;
+        L(zero_rbuf);
+        {
+            uni_vmovups(vmmword[reg_rbuf1 + reg_coff], Vmm(0));
+            add(reg_coff, isa == sse41 ? vlen / 2 : vlen);
+            cmp(reg_coff, reg_coff_max);
+            jne(zero_rbuf);
+        }
+
+        mov(reg_src, ptr[rsp + stack_off_src]);
+
+        xor_(reg_soff, reg_soff);
+        Label mean_spatial;
+        L(mean_spatial);
+        {
+            xor_(reg_coff, reg_coff);
+
+            compute_mean_variance_nspc();
+
+            // Process next image
+            // Can use static offset since we comeback after spatial loop
+            add(reg_src, mb_offt);
+            add(reg_soff, mb_offt);
 
             cmp(reg_soff, reg_soff_max);
             jl(mean_spatial);
         }
 
-        if (is_nspc_) mov(reg_src, ptr[rsp + stack_off_src]); // comeback
+        mov(reg_src, ptr[rsp + stack_off_src]); // comeback
 
         Label no_mean_reduction;
         barrier();
@@ -858,34 +925,18 @@ struct jit_bnorm_t : public jit_generator {
         {
             xor_(reg_coff, reg_coff);
 
-            if (isa == sse41) mov(reg_tmp_off, reg_soff);
-
-            is_nspc_ ? compute_mean_variance_nspc(false) : var_channels();
-
-            if (isa == sse41) {
-                mov(reg_soff, reg_tmp_off);
-                add(reg_src, vlen / 2);
-                mov(reg_coff, vlen / 2);
-
-                var_channels();
-
-                sub(reg_src, vlen / 2);
-            }
+            compute_mean_variance_nspc(false);
 
             // Process next image
-            if (is_nspc_) {
-                // Can use static offset since we comeback after spatial loop
-                add(reg_src, mb_offt);
-                add(reg_soff, mb_offt);
-            } else {
-                add(reg_soff, reg_mb_stride_Bc);
-            }
+            // Can use static offset since we comeback after spatial loop
+            add(reg_src, mb_offt);
+            add(reg_soff, mb_offt);
 
             cmp(reg_soff, reg_soff_max);
             jl(var_spatial);
         }
 
-        if (is_nspc_) mov(reg_src, ptr[rsp + stack_off_src]); // comeback
+        mov(reg_src, ptr[rsp + stack_off_src]); // comeback
 
         Label no_var_reduction;
         barrier();
@@ -1749,10 +1800,12 @@ struct driver_t : public c_compatible {
 
         int sbuf_sz = use_tmp_stats(bdesc) * 2 * C_PADDED;
         int pbuf_sz = use_tmp_diff_scale_shift(bdesc) * 2 * C_PADDED;
-        int rbuf_sz
-                = (bdesc->is_fwd() ? 1 : 2) * C_PADDED * dnnl_get_max_threads();
+        int rbuf_sz = (bdesc->is_fwd() && !is_single_pass_stats(bdesc) ? 1 : 2)
+                * C_PADDED * dnnl_get_max_threads();
+        int shift_sz = is_single_pass_stats(bdesc) * C_PADDED;
 
         scratchpad.book<acc_data_t>(key_bnorm_tmp_stats, sbuf_sz);
+        scratchpad.book<acc_data_t>(key_bnorm_stats_shift, shift_sz);
         scratchpad.book<acc_data_t>(key_bnorm_tmp_diff_ss, pbuf_sz);
         scratchpad.book<acc_data_t>(key_bnorm_reduction, rbuf_sz);
 
@@ -1770,6 +1823,7 @@ struct driver_t : public c_compatible {
         auto sbuf = scratchpad.get<acc_data_t>(key_bnorm_tmp_stats);
         auto pbuf = scratchpad.get<acc_data_t>(key_bnorm_tmp_diff_ss);
         auto rbuf = scratchpad.get<acc_data_t>(key_bnorm_reduction);
+        auto stats_shift = scratchpad.get<acc_data_t>(key_bnorm_stats_shift);
         auto barriers = scratchpad.get<barrier::ctx_64_t>(key_barrier);
 
         dim_t N = bdesc_->MB();
@@ -1876,6 +1930,7 @@ struct driver_t : public c_compatible {
                             * simd_w;
             // rbuf1 and rbuf2 have to be disjoint
             p.rbuf2 = p.rbuf1 + C_PADDED * nthr;
+            p.stats_shift = stats_shift + coff_base;
             p.is_cblk_tail = (it * C_blks_per_iter + C_blk_e) * simd_w > C;
 
             size_t iter_bariers
@@ -1885,6 +1940,25 @@ struct driver_t : public c_compatible {
         }
     }
 
+    // The shift of the single pass statistics is the first src value of a
+    // channel. It is set before the parallel section so that all the threads
+    // computing the same channels use the same shift.
+    void init_stats_shift(const void *src,
+            const memory_tracking::grantor_t &scratchpad) const {
+        auto stats_shift = scratchpad.get<acc_data_t>(key_bnorm_stats_shift);
+        if (!stats_shift) return;
+
+        const dim_t C_PADDED = get_c_padded(bdesc_);
+        const dim_t SP = bdesc_->D() * bdesc_->H() * bdesc_->W();
+        const bool is_bf16
+                = bdesc_->desc()->data_desc.data_type == data_type::bf16;
+        for (dim_t c = 0; c < C_PADDED; ++c) {
+            const dim_t off = (c / simd_w) * SP * simd_w + c % simd_w;
+            stats_shift[c] = is_bf16 ? (float)((const bfloat16_t *)src)[off]
+                                     : ((const float *)src)[off];
+        }
+    }
+
     void init_barriers(const memory_tracking::grantor_t &scratchpad) {
         auto barriers = scratchpad.get<barrier::ctx_64_t>(key_barrier);
         if (barriers) {
@@ -1903,6 +1977,13 @@ private:
                         / sizeof(acc_data_t) // BF16 will expand to FP32
     };
 
+    static bool is_single_pass_stats(const batch_normalization_pd_t *bdesc) {
+        const memory_desc_wrapper src_d(bdesc->src_md());
+        return bdesc->is_fwd() && !bdesc->stats_is_src()
+                && !src_d.matches_one_of_tag(
+                        format_tag::nhwc, format_tag::ndhwc);
+    }
+
     static bool use_tmp_stats(const batch_normalization_pd_t *bdesc) {
         return true && !bdesc->stats_is_src()
                 && bdesc->desc()->prop_kind == prop_kind::forward_inference;
@@ -2008,6 +2089,7 @@ status_t jit_uni_batch_normalization_fwd_t<isa>::execute(
     auto scratchpad = ctx.get_scratchpad_grantor();
 
     bnorm_driver_->init_barriers(scratchpad);
+    bnorm_driver_->init_stats_shift(src, scratchpad);
 
     parallel(0, [&](const int ithr, const int nthr) {
         bnorm_driver_->exec(ithr, nthr, src, nullptr, dst, nullptr, scale_shift,
@@ -23,6 +23,7 @@
 #include "common/type_helpers.hpp"
 #include "common/utils.hpp"
 
+#include "cpu/x64/injectors/jit_uni_eltwise_injector.hpp"
 #include "cpu/x64/jit_generator.hpp"
 
 #include "cpu/x64/jit_uni_batch_normalization_s8.hpp"
@@ -41,7 +42,7 @@ using data_t = int8_t;
 struct call_params_t {
     // keep int sizes at 8 bytes -- jit code expects this
     size_t channel_offt_count, spat_offt_count;
-    float eps;
+    float eps, oscale;
     const float *scale_shift, *mean, *var;
     const data_t *src, *dst;
 };
@@ -73,6 +74,9 @@ struct jit_bnorm_base_t : public jit_generator {
     Reg64 reg_channel_offt_1byte = r15;
     Reg64 reg_channel_offt_4byte = rax;
 
+    Reg64 reg_eltwise_table = rdx;
+
+    Vmm voscale = Vmm(isa == avx512_core ? 28 : 10);
     Vmm vzero = Vmm(isa == avx512_core ? 29 : 13);
     Xmm xone = Xmm(14);
     Vmm vone = Vmm(isa == avx512_core ? 30 : 14);
@@ -84,6 +88,8 @@ struct jit_bnorm_base_t : public jit_generator {
     size_t num_c_blocks_;
     size_t c_tail_;
     bool with_relu_;
+    bool with_oscale_;
+    std::unique_ptr<jit_uni_eltwise_injector_f32<isa>> eltwise_injector_;
 
     void compute_predefined_variables() {
         chan_data_offt_ = pd_->C() * sizeof(float);
@@ -91,6 +97,7 @@ struct jit_bnorm_base_t : public jit_generator {
         c_tail_ = pd_->C() % c_in_xmm_;
         with_relu_ = (pd_->with_relu_post_op() || pd_->fuse_norm_relu())
                 && pd_->is_fwd();
+        with_oscale_ = !pd_->attr()->output_scales_.has_default_values();
     }
 
     void load_common_params() {
@@ -100,7 +107,10 @@ struct jit_bnorm_base_t : public jit_generator {
 
 #define PARAM_OFF(x) offsetof(call_params_t, x)
         uni_vbroadcastss(veps, vmmword[reg_param + PARAM_OFF(eps)]);
+        if (with_oscale_)
+            uni_vbroadcastss(voscale, vmmword[reg_param + PARAM_OFF(oscale)]);
         uni_vpxor(vzero, vzero, vzero);
+        if (eltwise_injector_) eltwise_injector_->load_table_addr();
 
         mov(reg_channel_offt_count,
                 ptr[reg_param + PARAM_OFF(channel_offt_count)]);
@@ -164,6 +174,17 @@ struct jit_bnorm_base_t : public jit_generator {
             uni_vmulps(vmean, vmean, vscale);
             uni_vsubps(vshift, vzero, vmean, vshift);
         }
+
+        if (with_oscale_) {
+            uni_vmulps(vscale, vscale, voscale);
+            uni_vmulps(vshift, vshift, voscale);
+        }
+    }
+
+    // Applies the post-op to the normalized values held by vmm
+    void apply_post_op(const Vmm &vmm) {
+        if (with_relu_) uni_vmaxps(vmm, vmm, vzero);
+        if (eltwise_injector_) eltwise_injector_->compute_vector(vmm.getIdx());
     }
 
     void forward() {
@@ -185,9 +206,18 @@ struct jit_bnorm_base_t : public jit_generator {
         prepare_tail_mask();
         forward();
         postamble();
+        if (eltwise_injector_) eltwise_injector_->prepare_table();
     }
 
-    jit_bnorm_base_t(const batch_normalization_pd_t *pd) : pd_(pd) {}
+    jit_bnorm_base_t(const batch_normalization_pd_t *pd) : pd_(pd) {
+        // Other than ReLU eltwise post-ops need auxiliary vector registers,
+        // which are available on avx512_core only.
+        const auto &po = pd_->attr()->post_ops_;
+        if (isa == avx512_core && po.len() == 1 && !pd_->with_relu_post_op())
+            eltwise_injector_.reset(new jit_uni_eltwise_injector_f32<isa>(
+                    this, po.entry_[0].eltwise, false, reg_eltwise_table,
+                    Opmask(2)));
+    }
 };
 
 template <cpu_isa_t isa>
@@ -233,12 +263,13 @@ struct jit_bnorm_t<avx512_core> : public jit_bnorm_base_t<avx512_core> {
         Label c_loop;
         L(c_loop);
         {
+            // the registers right after v are left for the eltwise injector
             Xmm x = Xmm(0);
             Vmm v = Vmm(0);
-            Vmm vscale = Vmm(1);
-            Vmm vshift = Vmm(2);
-            Vmm vmean = Vmm(3);
-            Vmm vsqrtvar = Vmm(4);
+            Vmm vscale = Vmm(24);
+            Vmm vshift = Vmm(25);
+            Vmm vmean = Vmm(26);
+            Vmm vsqrtvar = Vmm(27);
 
             // compute single vscale and vshift vectors...
             compute_vscaleshift(vscale, vshift, vmean, vsqrtvar, 0, need_tail);
@@ -259,7 +290,7 @@ struct jit_bnorm_t<avx512_core> : public jit_bnorm_base_t<avx512_core> {
                 vcvtdq2ps(v, v);
 
                 uni_vfmadd213ps(v, vscale, vshift);
-                if (with_relu_) uni_vmaxps(v, v, vzero);
+                apply_post_op(v);
 
                 vcvtps2dq(v, v);
                 if (need_tail) {
@@ -385,10 +416,8 @@ struct jit_bnorm_t<avx2> : public jit_bnorm_base_t<avx2> {
 
                 uni_vfmadd213ps(v0, vscale0, vshift0);
                 uni_vfmadd213ps(v1, vscale1, vshift1);
-                if (with_relu_) {
-                    uni_vmaxps(v0, v0, vzero);
-                    uni_vmaxps(v1, v1, vzero);
-                }
+                apply_post_op(v0);
+                apply_post_op(v1);
 
                 vcvtps2dq(v0, v0); // BA
                 vcvtps2dq(v1, v1); // DC
@@ -504,10 +533,8 @@ struct jit_bnorm_t<sse41> : public jit_bnorm_base_t<sse41> {
 
                 uni_vfmadd213ps(v0, vscale0, vshift0);
                 uni_vfmadd213ps(v1, vscale1, vshift1);
-                if (with_relu_) {
-                    maxps(v0, vzero);
-                    maxps(v1, vzero);
-                }
+                apply_post_op(v0);
+                apply_post_op(v1);
 
                 cvtps2dq(v0, v0);
                 cvtps2dq(v1, v1);
@@ -563,6 +590,7 @@ struct driver_t : public c_compatible {
         call_params_t p;
 
         p.eps = pd_->desc()->batch_norm_epsilon;
+        p.oscale = pd_->attr()->output_scales_.scales_[0];
 
         p.scale_shift = scale_shift;
         p.mean = mean;
@@ -604,7 +632,9 @@ status_t jit_uni_batch_normalization_s8_fwd_t<isa>::pd_t::init(
             && one_of(ndims(), 4, 5) && stats_is_src()
             && src_md()->data_type == s8 && check_scale_shift_data_type()
             && memory_desc_matches_tag(*src_md(), desired_fmt_tag)
-            && (attr()->has_default_values() || this->with_relu_post_op());
+            && attr_oscale_and_eltwise_ok()
+            && IMPLICATION(attr()->post_ops_.len() > 0,
+                    isa == avx512_core || with_relu_post_op());
     if (!ok) return status::unimplemented;
 
     return status::success;
@@ -155,6 +155,7 @@ struct jit_uni_binary_kernel_t : public binary_kernel_t {
             = (isa == sse41) ? xword : ((isa == avx2) ? yword : zword);
 
     const binary_pd_t *pd_;
+    const binary_generic_bcast_conf_t generic_bcast_;
     bool is_bf16_;
     const bool is_avx512 = utils::one_of(isa, avx512_core, avx512_core_bf16);
     const Reg64 &reg_param_ = abi_param1;
@@ -195,8 +196,14 @@ struct jit_uni_binary_kernel_t : public binary_kernel_t {
     void init() {
         const memory_desc_wrapper src0_d(pd_->src_md(0));
         const memory_desc_wrapper src1_d(pd_->src_md(1));
-        bcast_per_oc_ = get_bcast_per_c(src0_d);
-        op_type_ = pd_->is_tensor_op() ? op_t::tensor : bcast_per_oc_;
+        if (generic_bcast_.enabled) {
+            // the kernel walks the inner dims as a dense tensor
+            bcast_per_oc_ = op_t::none;
+            op_type_ = op_t::tensor;
+        } else {
+            bcast_per_oc_ = get_bcast_per_c(src0_d);
+            op_type_ = pd_->is_tensor_op() ? op_t::tensor : bcast_per_oc_;
+        }
         assert(op_type_ != op_t::none);
         is_bf16_ = src0_d.data_type() == data_type::bf16;
         data_type_size_ = is_bf16_ ? sizeof(bfloat16_t) : sizeof(float);
@@ -205,15 +212,18 @@ struct jit_uni_binary_kernel_t : public binary_kernel_t {
         const bool postops_per_oc_broadcast_exists
                 = binary_injector::any_binary_postop_rhs_per_oc_broadcast(
                         po, src0_d);
-        broadcast_src1_value_
-                = op_type_ == op_t::bcast_n_c_spatial || src1_d.nelems() == 1;
+        broadcast_src1_value_ = generic_bcast_.enabled
+                ? generic_bcast_.inner_bcast
+                : op_type_ == op_t::bcast_n_c_spatial || src1_d.nelems() == 1;
         use_stride_src1_ = !broadcast_src1_value_
                 && (op_type_ == op_t::tensor
                         || op_type_ == op_t::bcast_n_spatial_c);
         use_stride_rhs_postops_ = postops_per_oc_broadcast_exists
                 && bcast_per_oc_ == op_t::bcast_n_spatial_c;
 
-        tail_size_ = get_tail_size(src0_d, postops_per_oc_broadcast_exists);
+        tail_size_ = generic_bcast_.enabled
+                ? generic_bcast_.inner_nelems % simd_w_
+                : get_tail_size(src0_d, postops_per_oc_broadcast_exists);
         offt_src0_ = vlen_ / (is_bf16_ ? 2 : 1);
         offt_src1_ = use_stride_src1_ ? offt_src0_ : 0;
         do_sum_ = po.contain(primitive_kind::sum, 0)
@@ -398,9 +408,12 @@ struct jit_uni_binary_kernel_t : public binary_kernel_t {
             postops_injector_->prepare_table();
     }
 
-    jit_uni_binary_kernel_t(const binary_pd_t *pd, bool tail_kernel = false)
+    jit_uni_binary_kernel_t(const binary_pd_t *pd,
+            const binary_generic_bcast_conf_t &generic_bcast,
+            bool tail_kernel = false)
         : binary_kernel_t(cpu_isa_traits<isa>::vlen)
         , pd_(pd)
+        , generic_bcast_(generic_bcast)
         , is_tail_kernel_(tail_kernel) {
         init();
     }
@@ -425,7 +438,7 @@ struct jit_uni_binary_subkernel_t<avx512_core_bf16, src_type>
     }
 
     void prepare_bf16_bcast_mask() {
-        if (is_bf16_ && op_type_ != op_t::tensor) {
+        if (is_bf16_ && broadcast_src1_value_) {
             const Reg32 regw_tmp = reg_tmp_.cvt32();
             mov(regw_tmp, 1);
             kmovd(bf16_bcast_opmask, regw_tmp);
@@ -544,8 +557,9 @@ struct jit_uni_binary_subkernel_t<avx512_core_bf16, src_type>
         }
     }
 
-    jit_uni_binary_subkernel_t(const binary_pd_t *pd, bool tail_kernel)
-        : jit_uni_binary_kernel_t(pd, tail_kernel) {}
+    jit_uni_binary_subkernel_t(const binary_pd_t *pd,
+            const binary_generic_bcast_conf_t &generic_bcast, bool tail_kernel)
+        : jit_uni_binary_kernel_t(pd, generic_bcast, tail_kernel) {}
 };
 
 template <data_type_t src_type>
@@ -580,7 +594,7 @@ struct jit_uni_binary_subkernel_t<avx512_core, src_type>
     }
 
     void prepare_bf16_bcast_mask() {
-        if (is_bf16_ && op_type_ != op_t::tensor) {
+        if (is_bf16_ && broadcast_src1_value_) {
             const Reg32 regw_tmp = reg_tmp_.cvt32();
             mov(regw_tmp, 1);
             kmovd(bf16_bcast_opmask, regw_tmp);
@@ -699,8 +713,9 @@ struct jit_uni_binary_subkernel_t<avx512_core, src_type>
         }
     }
 
-    jit_uni_binary_subkernel_t(const binary_pd_t *pd, bool tail_kernel)
-        : jit_uni_binary_kernel_t(pd, tail_kernel) {}
+    jit_uni_binary_subkernel_t(const binary_pd_t *pd,
+            const binary_generic_bcast_conf_t &generic_bcast, bool tail_kernel)
+        : jit_uni_binary_kernel_t(pd, generic_bcast, tail_kernel) {}
 };
 
 template <data_type_t src_type>
@@ -766,8 +781,9 @@ struct jit_uni_binary_subkernel_t<avx2, src_type>
         }
     }
 
-    jit_uni_binary_subkernel_t(const binary_pd_t *pd, bool tail_kernel)
-        : jit_uni_binary_kernel_t(pd, tail_kernel) {}
+    jit_uni_binary_subkernel_t(const binary_pd_t *pd,
+            const binary_generic_bcast_conf_t &generic_bcast, bool tail_kernel)
+        : jit_uni_binary_kernel_t(pd, generic_bcast, tail_kernel) {}
 };
 
 template <data_type_t src_type>
@@ -835,27 +851,30 @@ struct jit_uni_binary_subkernel_t<sse41, src_type>
         }
     }
 
-    jit_uni_binary_subkernel_t(const binary_pd_t *pd, bool tail_kernel)
-        : jit_uni_binary_kernel_t(pd, tail_kernel) {}
+    jit_uni_binary_subkernel_t(const binary_pd_t *pd,
+            const binary_generic_bcast_conf_t &generic_bcast, bool tail_kernel)
+        : jit_uni_binary_kernel_t(pd, generic_bcast, tail_kernel) {}
 };
 
 #undef PARAM_OFF
 
 template <data_type_t src_type>
-binary_kernel_t *create_binary_kernel(const binary_pd_t *pd, bool tail_kernel) {
+binary_kernel_t *create_binary_kernel(
+        const typename jit_uni_binary_t<src_type>::pd_t *pd, bool tail_kernel) {
+    const auto &gbc = pd->generic_bcast();
     if (mayiuse(avx512_core_bf16)) {
         using subkernel_t
                 = jit_uni_binary_subkernel_t<avx512_core_bf16, src_type>;
-        return new subkernel_t(pd, tail_kernel);
+        return new subkernel_t(pd, gbc, tail_kernel);
     } else if (mayiuse(avx512_core)) {
         using subkernel_t = jit_uni_binary_subkernel_t<avx512_core, src_type>;
-        return new subkernel_t(pd, tail_kernel);
+        return new subkernel_t(pd, gbc, tail_kernel);
     } else if (mayiuse(avx2)) {
         using subkernel_t = jit_uni_binary_subkernel_t<avx2, src_type>;
-        return new subkernel_t(pd, tail_kernel);
+        return new subkernel_t(pd, gbc, tail_kernel);
     } else {
         using subkernel_t = jit_uni_binary_subkernel_t<sse41, src_type>;
-        return new subkernel_t(pd, tail_kernel);
+        return new subkernel_t(pd, gbc, tail_kernel);
     }
 }
 
@@ -920,8 +939,50 @@ status_t jit_uni_binary_t<src_type>::execute(const exec_ctx_t &ctx) const {
             && has_oc_tail && (with_postops || point_broadcast);
     const auto kernel = kernel_.get();
     const auto kernel_tail = kernel_tail_.get();
+    const auto &gbc = pd()->generic_bcast();
+
+    if (gbc.enabled) {
+        const auto &bcast_dims = pd()->broadcast_dims();
+        const auto &strides0 = src0_d.blocking_desc().strides;
+        const auto &strides1 = src1_d.blocking_desc().strides;
+        const dim_t outer = utils::array_product(dims, gbc.outer_ndims);
+        const dim_t inner = gbc.inner_nelems;
+
+        // Compute strategy:
+        // Parallel over the outer dims, src0/dst and src1 offsets come from
+        // the stride tables with src1 strides zeroed on broadcast dims. The
+        // inner dims are split into simd-aligned blocks as well when the
+        // outer dims alone do not give enough work to all threads, so that
+        // only the last block of a row has the tail the kernel is built for.
+        const dim_t nthr = dnnl_get_max_threads();
+        const dim_t inner_split = utils::div_up(nthr, outer);
+        const dim_t inner_blk = inner_split > 1
+                ? utils::rnd_up(
+                        utils::div_up(inner, inner_split), (dim_t)simd_w)
+                : inner;
+        const dim_t n_inner_blks = utils::div_up(inner, inner_blk);
+
+        parallel_nd(outer, n_inner_blks, [&](dim_t o, dim_t ib) {
+            dim_t off0 = 0, off1 = 0, idx = o;
+            for (int d = gbc.outer_ndims - 1; d >= 0; --d) {
+                const dim_t pos = idx % dims[d];
+                idx /= dims[d];
+                off0 += pos * strides0[d];
+                if (!bcast_dims[d]) off1 += pos * strides1[d];
+            }
+            const dim_t start = ib * inner_blk;
+            const dim_t len = nstl::min(inner_blk, inner - start);
 
-    if ((no_broadcast || point_broadcast_no_oc_tail)
+            binary_kernel_t::call_params_t p;
+            p.spat_offt_count = len * sizeof(data_t);
+            p.src0 = src0 + off0 + start;
+            p.src1 = src1 + off1 + (gbc.inner_bcast ? 0 : start);
+            p.dst = dst + off0 + start;
+            p.oc_l_off = 0;
+            p.post_ops_binary_rhs_arg_vec = post_ops_binary_rhs_arg_vec.data();
+            (*kernel)(&p);
+        });
+    } else if ((no_broadcast || point_broadcast_no_oc_tail)
             && !postops_per_oc_broadcast_exists && !blocked_oc_tail) {
         const dim_t nelems0 = src0_d.nelems(true);
         const dim_t nelems0_simd = nelems0 / simd_w;
@@ -36,6 +36,17 @@ namespace x64 {
 
 struct binary_kernel_t;
 
+// Broadcast patterns not covered by the per-channel strategies are computed
+// by a loop nest over the outer dims of plain tensors. Each iteration calls
+// the kernel over the inner dims, across which src1 is either dense or a
+// single broadcast value.
+struct binary_generic_bcast_conf_t {
+    bool enabled = false;
+    int outer_ndims = 0;
+    bool inner_bcast = false;
+    dim_t inner_nelems = 0;
+};
+
 template <data_type_t src_type>
 struct jit_uni_binary_t : public primitive_t {
     struct pd_t : public cpu_binary_pd_t {
@@ -75,7 +86,13 @@ struct jit_uni_binary_t : public primitive_t {
             return status::success;
         }
 
+        const binary_generic_bcast_conf_t &generic_bcast() const {
+            return generic_bcast_;
+        }
+
     private:
+        binary_generic_bcast_conf_t generic_bcast_;
+
         // alg_preserves_zero returns true if operation preserves zero in case
         // of both inputs contain zero.
         bool alg_preserves_zero() const {
@@ -109,12 +126,12 @@ struct jit_uni_binary_t : public primitive_t {
             // broadcast operation
             const auto ndims = src0_d.ndims();
             ok = ndims >= 2;
-            // supported case: NxCxDxHxW:{NxCx1x1x1,1xCx1x1x1,1x1x1x1x1}
+            // per-channel case: NxCxDxHxW:{NxCx1x1x1,1xCx1x1x1,1x1x1x1x1}
             const auto &bcast_dims = broadcast_dims();
             ok = ok && IMPLICATION(bcast_dims[0] == 0, bcast_dims[1] == 0);
             for (int d = 2; d < ndims; ++d)
                 ok = ok && bcast_dims[d] == 1;
-            if (!ok) return false;
+            if (!ok) return init_generic_bcast();
 
             if (src0_d.is_plain() && src1_d.is_plain()) {
                 const auto &bd0 = src0_d.blocking_desc();
@@ -137,6 +154,53 @@ struct jit_uni_binary_t : public primitive_t {
 
             return valid_bd(src0_d) && valid_bd(src1_d);
         }
+
+        bool init_generic_bcast() {
+            const memory_desc_wrapper src0_d(src_md(0));
+            const memory_desc_wrapper src1_d(src_md(1));
+
+            // the loop nest addresses plain row-major tensors only
+            const auto is_row_major = [](const memory_desc_wrapper &mdw) {
+                if (!mdw.is_plain()) return false;
+                const auto &strides = mdw.blocking_desc().strides;
+                dim_t stride = 1;
+                for (int d = mdw.ndims() - 1; d >= 0; --d) {
+                    if (mdw.dims()[d] != 1 && strides[d] != stride)
+                        return false;
+                    stride *= mdw.dims()[d];
+                }
+                return true;
+            };
+            if (!is_row_major(src0_d) || !is_row_major(src1_d)) return false;
+
+            // binary post-ops rely on the offsets of per-channel strategies
+            if (attr()->post_ops_.find(primitive_kind::binary) != -1)
+                return false;
+
+            // the inner dims are the longest trailing run of dims with the
+            // same broadcast kind, dims of size one match either kind
+            const auto &dims = src0_d.dims();
+            const auto &bcast_dims = broadcast_dims();
+            int outer_ndims = src0_d.ndims();
+            int inner_bcast = -1;
+            for (; outer_ndims > 0; --outer_ndims) {
+                const int d = outer_ndims - 1;
+                if (dims[d] == 1) continue;
+                if (inner_bcast == -1)
+                    inner_bcast = bcast_dims[d];
+                else if (bcast_dims[d] != inner_bcast)
+                    break;
+            }
+            // no outer dims: tensor or point broadcast, both handled above
+            if (outer_ndims == 0) return false;
+
+            generic_bcast_.enabled = true;
+            generic_bcast_.outer_ndims = outer_ndims;
+            generic_bcast_.inner_bcast = inner_bcast == 1;
+            generic_bcast_.inner_nelems = utils::array_product(
+                    dims + outer_ndims, src0_d.ndims() - outer_ndims);
+            return true;
+        }
     };
 
     jit_uni_binary_t(const pd_t *apd);
@@ -0,0 +1,227 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+
+#include "common/memory.hpp"
+#include "common/memory_desc_wrapper.hpp"
+#include "common/reorder_pd.hpp"
+#include "common/stream.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/x64/jit_uni_concat.hpp"
+#include "cpu/x64/jit_uni_reorder.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+using namespace dnnl::impl::status;
+
+namespace {
+
+// Layout of a md along the concat dimension: blocks of `blk` elements at a
+// distance of `blk_stride`, the elements of a block being `elem_stride`
+// apart. A plain layout is a layout with 1-element blocks.
+struct concat_dim_layout_t {
+    dim_t blk, blk_stride, elem_stride;
+};
+
+bool init_concat_dim_layout(concat_dim_layout_t &l,
+        const memory_desc_wrapper &md, int concat_dim) {
+    if (!md.is_blocking_desc() || md.extra().flags != 0) return false;
+
+    // only a single level of blocking along the concat dimension
+    const auto &bd = md.blocking_desc();
+    const bool ok = bd.inner_nblks == 0
+            || (bd.inner_nblks == 1 && bd.inner_idxs[0] == concat_dim);
+    if (!ok) return false;
+
+    l.blk = bd.inner_nblks == 0 ? 1 : bd.inner_blks[0];
+    l.blk_stride = bd.strides[concat_dim];
+    l.elem_stride = bd.inner_nblks == 0 ? l.blk_stride : 1;
+    return true;
+}
+
+// Describes the pieces [k * period + off, k * period + off + len) of the
+// concat dimension, k in [0, nk), as a strided md with the k index right
+// before the piece index. The pieces must not cross a block boundary.
+status_t init_piece_md(memory_desc_t &piece_md, const memory_desc_wrapper &md,
+        const concat_dim_layout_t &l, int concat_dim, dim_t off, dim_t len,
+        dim_t nk, dim_t period) {
+    const int ndims = md.ndims();
+    if (ndims + 1 > DNNL_MAX_NDIMS) return unimplemented;
+
+    dims_t dims, strides;
+    for (int d = 0, piece_d = 0; d < ndims; ++d, ++piece_d) {
+        if (d == concat_dim) {
+            dims[piece_d] = nk;
+            strides[piece_d] = period / l.blk * l.blk_stride;
+            ++piece_d;
+            dims[piece_d] = len;
+            strides[piece_d] = l.elem_stride;
+        } else {
+            dims[piece_d] = md.dims()[d];
+            strides[piece_d] = md.blocking_desc().strides[d];
+        }
+    }
+
+    CHECK(dnnl_memory_desc_init_by_strides(
+            &piece_md, ndims + 1, dims, md.data_type(), strides));
+    piece_md.offset0 = md.offset0() + off / l.blk * l.blk_stride
+            + off % l.blk * l.elem_stride;
+    return success;
+}
+
+} // namespace
+
+status_t jit_uni_concat_t::pd_t::init(engine_t *engine) {
+    // Whenever every src has an image in the dst, the simple concat or the
+    // reference one with a reorder per src already work in a single pass.
+    if (cpu_concat_pd_t::init() == success) return unimplemented;
+    src_image_mds_.clear();
+
+    const bool ok = attr()->has_default_values()
+            && dst_md_.format_kind == format_kind::blocked
+            && !memory_desc_wrapper(dst_md_).has_zero_dim();
+    if (!ok) return unimplemented;
+
+    dim_t dst_off = 0;
+    for (int i = 0; i < n_; ++i) {
+        CHECK(add_reorders(engine, i, dst_off));
+        dst_off += src_mds_[i].dims[concat_dim_];
+    }
+
+    init_scratchpad();
+    return success;
+}
+
+status_t jit_uni_concat_t::pd_t::add_reorders(
+        engine_t *engine, int src_idx, dim_t dst_off) {
+    const memory_desc_wrapper src_d(src_mds_[src_idx]);
+    const memory_desc_wrapper dst_d(dst_md_);
+    const dim_t len = src_d.dims()[concat_dim_];
+    if (len == 0) return success;
+
+    concat_dim_layout_t src_l, dst_l;
+    if (!init_concat_dim_layout(src_l, src_d, concat_dim_)
+            || !init_concat_dim_layout(dst_l, dst_d, concat_dim_))
+        return unimplemented;
+
+    const dim_t period = nstl::max(src_l.blk, dst_l.blk);
+    if (period % src_l.blk != 0 || period % dst_l.blk != 0)
+        return unimplemented;
+
+    // The block boundaries of both the src and the dst, in the src
+    // coordinates, split a period into pieces. A plain layout is affine
+    // along the whole concat dimension and adds no boundaries.
+    std::vector<dim_t> bounds {0, period};
+    if (src_l.blk > 1)
+        for (dim_t c = 0; c < period; c += src_l.blk)
+            bounds.push_back(c);
+    if (dst_l.blk > 1)
+        for (dim_t c = (dst_l.blk - dst_off % dst_l.blk) % dst_l.blk;
+                c < period; c += dst_l.blk)
+            bounds.push_back(c);
+    std::sort(bounds.begin(), bounds.end());
+    bounds.erase(std::unique(bounds.begin(), bounds.end()), bounds.end());
+
+    auto add_reorder = [&](dim_t off, dim_t piece_len, dim_t nk) {
+        memory_desc_t src_piece_md, dst_piece_md;
+        CHECK(init_piece_md(src_piece_md, src_d, src_l, concat_dim_, off,
+                piece_len, nk, period));
+        CHECK(init_piece_md(dst_piece_md, dst_d, dst_l, concat_dim_,
+                dst_off + off, piece_len, nk, period));
+
+        primitive_attr_t r_attr;
+        r_attr.set_scratchpad_mode(scratchpad_mode::user);
+        reorder_pd_t *r_pd = nullptr;
+        CHECK(jit_uni_reorder_create(&r_pd, engine, &r_attr, engine,
+                &src_piece_md, engine, &dst_piece_md));
+        reorder_pds_.emplace_back(r_pd);
+        reorder_src_.push_back(src_idx);
+        return success;
+    };
+
+    const dim_t nk = len / period;
+    const dim_t tail = len % period;
+    for (size_t b = 0; b + 1 < bounds.size(); ++b) {
+        const dim_t off = bounds[b], piece_len = bounds[b + 1] - off;
+        if (nk > 0) CHECK(add_reorder(off, piece_len, nk));
+        if (off < tail)
+            CHECK(add_reorder(nk * period + off,
+                    nstl::min(bounds[b + 1], tail) - off, 1));
+    }
+    return success;
+}
+
+void jit_uni_concat_t::pd_t::copy(const pd_t &rhs) {
+    reorder_src_ = rhs.reorder_src_;
+    for (const auto &r_pd : rhs.reorder_pds_)
+        reorder_pds_.emplace_back(r_pd->clone());
+}
+
+void jit_uni_concat_t::pd_t::init_scratchpad() {
+    using namespace memory_tracking::names;
+    auto scratchpad = scratchpad_registry().registrar();
+    for (size_t i = 0; i < reorder_pds_.size(); i++)
+        scratchpad.book(key_nested_multiple + (int)i,
+                reorder_pds_[i]->scratchpad_registry());
+}
+
+status_t jit_uni_concat_t::init(engine_t *engine) {
+    const size_t n = pd()->reorder_pds_.size();
+    reorders_.resize(n);
+    for (size_t i = 0; i < n; ++i)
+        CHECK(pd()->reorder_pds_[i]->create_primitive(reorders_[i], engine));
+    return success;
+}
+
+status_t jit_uni_concat_t::execute(const exec_ctx_t &ctx) const {
+    using namespace memory_tracking::names;
+    engine_t *engine = ctx.stream()->engine();
+    auto &dst_storage = CTX_OUT_STORAGE(DNNL_ARG_DST);
+
+    for (size_t i = 0; i < reorders_.size(); ++i) {
+        const auto &r_pd = pd()->reorder_pds_[i];
+        const int src_arg = DNNL_ARG_MULTIPLE_SRC + pd()->reorder_src_[i];
+        memory_t src_piece(engine, r_pd->src_md(),
+                CTX_IN_STORAGE(src_arg).clone(), false);
+        memory_t dst_piece(engine, r_pd->dst_md(), dst_storage.clone(), false);
+
+        exec_args_t r_args;
+        r_args[DNNL_ARG_SRC] = {&src_piece, true};
+        r_args[DNNL_ARG_DST] = {&dst_piece, false};
+        exec_ctx_t r_ctx(ctx, std::move(r_args));
+
+        nested_scratchpad_t ns(ctx, key_nested_multiple + (int)i, reorders_[i]);
+        r_ctx.set_scratchpad_grantor(ns.grantor());
+        CHECK(reorders_[i]->execute(r_ctx));
+    }
+
+    // the pieces cover the dst dims only, the padded area is left as is
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+    if (dst_d.nelems(false) != dst_d.nelems(true))
+        CHECK(ctx.memory(DNNL_ARG_DST)->zero_pad(ctx));
+    return success;
+}
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,77 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_JIT_UNI_CONCAT_HPP
+#define CPU_X64_JIT_UNI_CONCAT_HPP
+
+#include <memory>
+#include <vector>
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+
+#include "cpu/cpu_concat_pd.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+/* Concatenation into a dst whose blocks along the concat dimension are not
+ * aligned with the srcs, e.g. nChw16c srcs with channel tails concatenated
+ * along the channels. No sub-memory of the dst describes such a src, so the
+ * reference concat goes through an intermediate plain dst.
+ *
+ * Here every src is split into pieces that do not cross a block boundary
+ * neither in the src nor in the dst. The pieces that have the same offset
+ * within the lcm of the blocks form a strided problem, which is processed
+ * by a jit reorder writing directly into the dst. Every element is thus read
+ * and written once, with the data type conversion done on the fly. */
+struct jit_uni_concat_t : public primitive_t {
+    struct pd_t : public cpu_concat_pd_t {
+        using cpu_concat_pd_t::cpu_concat_pd_t;
+        pd_t(const pd_t &rhs) : cpu_concat_pd_t(rhs) { copy(rhs); }
+
+        DECLARE_CONCAT_PD_T("jit:uni", jit_uni_concat_t);
+
+        status_t init(engine_t *engine);
+
+        std::vector<std::unique_ptr<primitive_desc_t>> reorder_pds_;
+        // index of the src read by each of the reorders
+        std::vector<int> reorder_src_;
+
+    private:
+        status_t add_reorders(engine_t *engine, int src_idx, dim_t dst_off);
+        void copy(const pd_t &rhs);
+        void init_scratchpad();
+    };
+
+    jit_uni_concat_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+    std::vector<std::shared_ptr<primitive_t>> reorders_;
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
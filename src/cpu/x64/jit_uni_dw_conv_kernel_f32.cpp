@@ -562,6 +562,10 @@ inline void jit_uni_dw_conv_bwd_data_kernel_f32<isa>::apply_filter(
     int stride_h = jcp.stride_h;
     int stride_w = jcp.stride_w;
 
+    const bool layout_nxc = is_layout_nxc();
+    const int ch_stride = layout_nxc ? ch_blk : oh * ow * ch_blk;
+    const int w_stride = layout_nxc ? jcp.ngroups : ch_blk;
+
     Label iter_exit_label;
 
     cmp(reg_kh, 0);
@@ -590,7 +594,7 @@ inline void jit_uni_dw_conv_bwd_data_kernel_f32<isa>::apply_filter(
                             ptr[aux1_reg_kernel + ker_off * sizeof(float)]);
 
                     for (int w = 0; w < ur_str_w; w++) {
-                        int ddst_off = (ch * oh * ow + w) * ch_blk + i * 4;
+                        int ddst_off = ch * ch_stride + w * w_stride + i * 4;
 
                         Vmm vmm_src = get_src_reg(0);
                         uni_vmovups(vmm_src,
@@ -604,7 +608,7 @@ inline void jit_uni_dw_conv_bwd_data_kernel_f32<isa>::apply_filter(
             }
 
             add(aux1_reg_kernel, ch_blk * stride_w * sizeof(float));
-            sub(aux1_reg_ddst, ch_blk * sizeof(float));
+            sub(aux1_reg_ddst, w_stride * sizeof(float));
 
             sub(iter_kw, stride_w);
             cmp(iter_kw, 0);
@@ -612,7 +616,7 @@ inline void jit_uni_dw_conv_bwd_data_kernel_f32<isa>::apply_filter(
         }
 
         add(aux_reg_kernel, kw * ch_blk * stride_h * sizeof(float));
-        sub(aux_reg_ddst, ow * ch_blk * sizeof(float));
+        sub(aux_reg_ddst, ow * w_stride * sizeof(float));
 
         sub(iter_kh, stride_h);
         cmp(iter_kh, 0);
@@ -630,11 +634,16 @@ inline void jit_uni_dw_conv_bwd_data_kernel_f32<isa>::store_dsrc(
     int ih = jcp.ih;
     int stride_w = jcp.stride_w;
 
+    const bool layout_nxc = is_layout_nxc();
+    const int ch_stride = layout_nxc ? ch_blk : ih * iw * ch_blk;
+    const int w_stride = layout_nxc ? jcp.ngroups : ch_blk;
+
     int repeats = isa == sse41 ? 2 : 1;
     for (int i = 0; i < repeats; i++) {
         for (int ch = 0; ch < ur_ch_blocks; ch++) {
             for (int w = 0; w < ur_str_w; w++) {
-                int dsrc_off = (ch * ih * iw + w * stride_w) * ch_blk + i * 4;
+                int dsrc_off
+                        = ch * ch_stride + w * stride_w * w_stride + i * 4;
                 Vmm vmm_acc = get_acc_reg(
                         i * ur_ch_blocks * ur_str_w + ch * ur_str_w + w);
 
@@ -651,6 +660,8 @@ inline void jit_uni_dw_conv_bwd_data_kernel_f32<isa>::loop_body(
     Label tail_w_label;
     Label exit_label;
 
+    const int w_stride = is_layout_nxc() ? jcp.ngroups : jcp.ch_block;
+
     L(unrolled_w_label);
     {
         int ur_w = jcp.ur_w;
@@ -665,8 +676,8 @@ inline void jit_uni_dw_conv_bwd_data_kernel_f32<isa>::loop_body(
         apply_filter(ur_ch_blocks, ur_w);
         store_dsrc(ur_ch_blocks, ur_w);
 
-        add(reg_dsrc, sizeof(float) * ur_w * jcp.ch_block * jcp.stride_w);
-        add(reg_ddst, sizeof(float) * ur_w * jcp.ch_block);
+        add(reg_dsrc, sizeof(float) * ur_w * w_stride * jcp.stride_w);
+        add(reg_ddst, sizeof(float) * ur_w * w_stride);
 
         sub(reg_ur_str_w, ur_w);
         jmp(unrolled_w_label);
@@ -686,8 +697,8 @@ inline void jit_uni_dw_conv_bwd_data_kernel_f32<isa>::loop_body(
         apply_filter(ur_ch_blocks, ur_w);
         store_dsrc(ur_ch_blocks, ur_w);
 
-        add(reg_dsrc, sizeof(float) * ur_w * jcp.ch_block * jcp.stride_w);
-        add(reg_ddst, sizeof(float) * ur_w * jcp.ch_block);
+        add(reg_dsrc, sizeof(float) * ur_w * w_stride * jcp.stride_w);
+        add(reg_ddst, sizeof(float) * ur_w * w_stride);
 
         sub(reg_ur_str_w, ur_w);
         jmp(tail_w_label);
@@ -783,6 +794,7 @@ inline void jit_uni_dw_conv_bwd_weights_kernel_f32<isa>::compute_ow_step_unroll(
     const int iw_block = ow_block * jcp.stride_w;
     const int right_border = jcp.iw - iw_block;
     const int r_pad = jcp.r_pad;
+    const int w_stride = is_layout_nxc() ? jcp.ngroups : jcp.ch_block;
 
     const int cascade_input = nstl::min(jcp.stride_w, jcp.kw);
 
@@ -793,14 +805,13 @@ inline void jit_uni_dw_conv_bwd_weights_kernel_f32<isa>::compute_ow_step_unroll(
     /* LOAD initial input registers, then cascade LOADs and FMAs*/
     for (int r = 0; r < reg_repeats; ++r) {
         for (int i_ur = 0; i_ur < unroll_w; ++i_ur) {
-            int off_output = (i_ur * reg_repeats + r) * simd_w;
+            int off_output = i_ur * w_stride + r * simd_w;
             Vmm vmm_output = get_output_reg(r);
             uni_vmovups(vmm_output,
                     ptr[reg_tmp_output + off_output * sizeof(float)]);
             if (i_ur == 0) {
                 for (int c = 0; c < input_overlap; ++c) {
-                    int off_input
-                            = ((c - pad_offset) * reg_repeats + r) * simd_w;
+                    int off_input = (c - pad_offset) * w_stride + r * simd_w;
                     if (off_input < 0 && unroll_w == jcp.ow) continue;
 
                     const bool over_steps_bdry = true && is_last_block
@@ -815,9 +826,8 @@ inline void jit_uni_dw_conv_bwd_weights_kernel_f32<isa>::compute_ow_step_unroll(
             } else {
                 for (int c = 0; c < cascade_input; ++c) {
                     int overlap = (i_ur - 1) * jcp.stride_w + input_overlap;
-                    int off_input
-                            = ((overlap + c - pad_offset) * reg_repeats + r)
-                            * simd_w;
+                    int off_input = (overlap + c - pad_offset) * w_stride
+                            + r * simd_w;
                     if (off_input < 0 || overlap + c + l_pad > right_border)
                         continue;
 
@@ -860,10 +870,11 @@ template <cpu_isa_t isa>
 inline void
 jit_uni_dw_conv_bwd_weights_kernel_f32<isa>::compute_bias_step_unroll(
         const int unroll_w) {
+    const int w_stride = is_layout_nxc() ? jcp.ngroups : jcp.ch_block;
     for (int r = 0; r < reg_repeats; ++r) {
         for (int i = 0; i < unroll_w; ++i) {
             Vmm vmm_bias = get_bias_reg(r);
-            int off_output = (i * reg_repeats + r) * simd_w;
+            int off_output = i * w_stride + r * simd_w;
             if (isa == sse41) {
                 /* Need to support unaligned address loads for SSE41 */
                 Vmm vmm_output = get_output_reg(1 + r);
@@ -910,7 +921,7 @@ inline void jit_uni_dw_conv_bwd_weights_kernel_f32<isa>::compute_bias_loop(
     const int unroll_w_trips = jcp.ow / unroll_w;
     const int tail_w = jcp.ow > block_size ? jcp.ow % block_size : 0;
 
-    const int ch_offset = jcp.ch_block;
+    const int w_stride = is_layout_nxc() ? jcp.ngroups : jcp.ch_block;
 
     mov(reg_oh, ptr[this->param1 + offsetof(jit_dw_conv_call_s, oh_index)]);
     mov(reg_oh_worksize,
@@ -925,7 +936,7 @@ inline void jit_uni_dw_conv_bwd_weights_kernel_f32<isa>::compute_bias_loop(
         {
 
             compute_bias_step_unroll(unroll_w);
-            add(reg_tmp_output, unroll_w * ch_offset * sizeof(float));
+            add(reg_tmp_output, unroll_w * w_stride * sizeof(float));
 
             dec(reg_iter_ow_blk);
             cmp(reg_iter_ow_blk, 0);
@@ -934,7 +945,7 @@ inline void jit_uni_dw_conv_bwd_weights_kernel_f32<isa>::compute_bias_loop(
 
         if (tail_w > 0) {
             compute_bias_step_unroll(tail_w);
-            add(reg_tmp_output, tail_w * ch_offset * sizeof(float));
+            add(reg_tmp_output, tail_w * w_stride * sizeof(float));
         }
 
         inc(reg_oh);
@@ -981,6 +992,7 @@ inline void jit_uni_dw_conv_bwd_weights_kernel_f32<isa>::compute_h_step(
         int unroll_w, int l_pad, int pad_offset, int ow_block) {
 
     const int ch_offset = jcp.ch_block;
+    const int w_stride = is_layout_nxc() ? jcp.ngroups : jcp.ch_block;
 
     Label kh_loop_label, skip_loop_label;
 
@@ -995,7 +1007,7 @@ inline void jit_uni_dw_conv_bwd_weights_kernel_f32<isa>::compute_h_step(
         store_filter();
 
         add(reg_tmp_filter, jcp.kw * ch_offset * sizeof(float));
-        add(reg_tmp_input, jcp.iw * ch_offset * sizeof(float));
+        add(reg_tmp_input, jcp.iw * w_stride * sizeof(float));
         dec(reg_kh);
         cmp(reg_kh, 0);
         jg(kh_loop_label);
@@ -1006,7 +1018,7 @@ inline void jit_uni_dw_conv_bwd_weights_kernel_f32<isa>::compute_h_step(
     mov(reg_kh, reg_kh_count);
     L(kh_comeback_label);
     {
-        sub(reg_tmp_input, jcp.iw * ch_offset * sizeof(float));
+        sub(reg_tmp_input, jcp.iw * w_stride * sizeof(float));
         sub(reg_tmp_filter, jcp.kw * ch_offset * sizeof(float));
         dec(reg_kh);
         cmp(reg_kh, 0);
@@ -1025,6 +1037,7 @@ inline void jit_uni_dw_conv_bwd_weights_kernel_f32<isa>::compute_h_loop(
             = jcp.oh - 1 - utils::div_up(jcp.b_pad, jcp.stride_h);
 
     const int ch_offset = jcp.ch_block;
+    const int w_stride = is_layout_nxc() ? jcp.ngroups : jcp.ch_block;
     const int t_overlap_off = jcp.t_pad % jcp.stride_h == 0 ? jcp.stride_h : 1;
     const int b_overlap_off = jcp.b_pad % jcp.stride_h == 0 ? jcp.stride_h : 1;
 
@@ -1045,7 +1058,7 @@ inline void jit_uni_dw_conv_bwd_weights_kernel_f32<isa>::compute_h_loop(
 
         compute_h_step(unroll_w, l_pad, pad_offset, ow_block);
 
-        add(reg_tmp_output, jcp.ow * ch_offset * sizeof(float));
+        add(reg_tmp_output, jcp.ow * w_stride * sizeof(float));
 
         /* If within the top_pad region */
         if (jcp.t_pad > 0) {
@@ -1064,7 +1077,7 @@ inline void jit_uni_dw_conv_bwd_weights_kernel_f32<isa>::compute_h_loop(
             if (jcp.t_pad % jcp.stride_h != 0) {
                 int inp_corr = jcp.stride_h - jcp.t_pad % jcp.stride_h;
                 add(reg_tmp_input,
-                        inp_corr * jcp.iw * ch_offset * sizeof(float));
+                        inp_corr * jcp.iw * w_stride * sizeof(float));
             }
             jmp(tpad_loop_label, T_NEAR);
         }
@@ -1076,7 +1089,7 @@ inline void jit_uni_dw_conv_bwd_weights_kernel_f32<isa>::compute_h_loop(
         sub(reg_kh_count, b_overlap_off);
 
         L(skip_bpad_label);
-        add(reg_tmp_input, jcp.stride_h * jcp.iw * ch_offset * sizeof(float));
+        add(reg_tmp_input, jcp.stride_h * jcp.iw * w_stride * sizeof(float));
 
         L(tpad_loop_label);
 
@@ -1091,7 +1104,7 @@ template <cpu_isa_t isa>
 inline void
 jit_uni_dw_conv_bwd_weights_kernel_f32<isa>::compute_ow_block_unroll() {
 
-    const int ch_offset = jcp.ch_block;
+    const int w_stride = is_layout_nxc() ? jcp.ngroups : jcp.ch_block;
     int ow = jcp.ow;
     int pad_offset = 0;
     int l_pad = jcp.l_pad;
@@ -1158,9 +1171,9 @@ jit_uni_dw_conv_bwd_weights_kernel_f32<isa>::compute_ow_block_unroll() {
     /* compute left padded block */
     if (l_pad && do_unroll_w) {
         compute_h_loop(unroll_w, l_pad, 0, 0);
-        add(reg_output_baddr, unroll_w * ch_offset * sizeof(float));
+        add(reg_output_baddr, unroll_w * w_stride * sizeof(float));
         add(reg_input_baddr,
-                unroll_w * jcp.stride_w * ch_offset * sizeof(float));
+                unroll_w * jcp.stride_w * w_stride * sizeof(float));
         unroll_w_trips--;
         pad_offset = l_pad;
         l_pad = 0;
@@ -1178,9 +1191,9 @@ jit_uni_dw_conv_bwd_weights_kernel_f32<isa>::compute_ow_block_unroll() {
     }
     if (unroll_w_trips > 0) {
         compute_h_loop(unroll_w, l_pad, pad_offset, 0);
-        add(reg_output_baddr, unroll_w * ch_offset * sizeof(float));
+        add(reg_output_baddr, unroll_w * w_stride * sizeof(float));
         add(reg_input_baddr,
-                unroll_w * jcp.stride_w * ch_offset * sizeof(float));
+                unroll_w * jcp.stride_w * w_stride * sizeof(float));
     }
     if (do_ow_blk_loop) {
         dec(reg_iter_ow_blk);
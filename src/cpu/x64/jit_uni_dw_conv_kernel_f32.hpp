@@ -146,6 +146,11 @@ private:
     reg64_t reg_kh = r13;
     reg64_t reg_kw = r14;
 
+    inline bool is_layout_nxc() {
+        return utils::one_of(jcp.src_tag, format_tag::ndhwc, format_tag::nhwc,
+                format_tag::nwc);
+    }
+
     inline void loop_body(int ur_ch_blocks);
     inline void load_ddst(int ur_ch_blocks, int ur_str_w);
     inline void apply_filter(int ur_ch_blocks, int ur_str_w);
@@ -204,6 +209,11 @@ private:
     reg64_t reg_filter_baddr = abi_not_param1;
     reg64_t reg_bias_baddr = r13;
 
+    inline bool is_layout_nxc() {
+        return utils::one_of(jcp.src_tag, format_tag::ndhwc, format_tag::nhwc,
+                format_tag::nwc);
+    }
+
     /* Micro-kernel JIT'ing, fusing 'kw' and 'ow_block' loops into unrolled FMAs
      */
     inline void compute_ow_step_unroll(
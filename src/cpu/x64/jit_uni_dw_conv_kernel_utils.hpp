@@ -359,14 +359,16 @@ status_t jit_uni_dw_conv_bwd_data_kernel<isa, kernel_dt>::init_conf(
     auto dat_tag = one_of(isa, avx512_common, avx512_core) ? nChw16c : nChw8c;
     auto wei_tag = one_of(isa, avx512_common, avx512_core) ? Goihw16g : Goihw8g;
 
-    jcp.src_tag = diff_src_d.matches_one_of_tag(dat_tag);
+    jcp.src_tag = diff_src_d.matches_one_of_tag(dat_tag, nhwc);
     jcp.wei_tag = weights_d.matches_one_of_tag(wei_tag);
-    jcp.dst_tag = diff_dst_d.matches_one_of_tag(dat_tag);
+    jcp.dst_tag = diff_dst_d.matches_one_of_tag(dat_tag, nhwc);
 
+    // channels are not padded in nhwc, which the checks on the padded dims
+    // below take care of
     bool args_ok = true && jcp.oc == jcp.ngroups && jcp.ic == jcp.ngroups
             && jcp.ngroups % simd_w == 0 && jcp.dilate_h == 0
-            && jcp.dilate_w == 0 && jcp.src_tag == dat_tag
-            && jcp.wei_tag == wei_tag && jcp.dst_tag == dat_tag
+            && jcp.dilate_w == 0 && one_of(jcp.src_tag, dat_tag, nhwc)
+            && jcp.wei_tag == wei_tag && jcp.dst_tag == jcp.src_tag
             && jcp.oh == (jcp.ihp - jcp.kh) / jcp.stride_h + 1
             && jcp.ow == (jcp.iwp - jcp.kw) / jcp.stride_w + 1
             && jcp.ic <= diff_src_d.padded_dims()[1]
@@ -491,12 +493,13 @@ status_t jit_uni_dw_conv_bwd_weights_kernel<isa, kernel_dt>::init_conf(
     auto dat_tag = one_of(isa, avx512_common, avx512_core) ? nChw16c : nChw8c;
     auto wei_tag = one_of(isa, avx512_common, avx512_core) ? Goihw16g : Goihw8g;
 
-    jcp.src_tag = src_d.matches_one_of_tag(dat_tag);
+    jcp.src_tag = src_d.matches_one_of_tag(dat_tag, nhwc);
     jcp.wei_tag = diff_weights_d.matches_one_of_tag(wei_tag);
-    jcp.dst_tag = diff_dst_d.matches_one_of_tag(dat_tag);
+    jcp.dst_tag = diff_dst_d.matches_one_of_tag(dat_tag, nhwc);
 
-    bool args_ok = true && jcp.src_tag == dat_tag && jcp.wei_tag == wei_tag
-            && jcp.dst_tag == dat_tag && jcp.ngroups % jcp.ch_block == 0
+    bool args_ok = true && one_of(jcp.src_tag, dat_tag, nhwc)
+            && jcp.wei_tag == wei_tag && jcp.dst_tag == jcp.src_tag
+            && jcp.ngroups % jcp.ch_block == 0
             && jcp.dilate_h == 0 && jcp.dilate_w == 0 && jcp.kw <= 3
             && jcp.stride_w <= jcp.kw // no gaps in kernel
             && jcp.oh == (jcp.ihp - jcp.kh) / jcp.stride_h + 1
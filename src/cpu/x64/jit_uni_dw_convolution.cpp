@@ -79,7 +79,7 @@ void jit_uni_dw_convolution_fwd_t<isa, src_type, dst_type>::execute_forward(
     const auto is_dst_layout_nxc = jcp.dst_tag == format_tag::nhwc;
 
     const int work_amount = jcp.mb * chb_work * jcp.oh;
-    const auto nthr = jcp.nthr;
+    const int nthr = dnnl_get_exec_num_threads(jcp.nthr);
 
     parallel(nthr, [&](const int ithr, const int nthr) {
         int start {0}, end {0};
@@ -186,6 +186,7 @@ void jit_uni_dw_convolution_bwd_data_t<isa, diff_dst_type,
     const memory_desc_wrapper weights_d(pd()->weights_md(0));
 
     const auto &jcp = pd()->jcp_;
+    const bool is_layout_nxc = jcp.src_tag == format_tag::nhwc;
 
     auto kernel_params = [&](int ur_str_w, int iw, int oh, int ih,
                                  int i_t_overflow, int i_b_overflow,
@@ -200,8 +201,9 @@ void jit_uni_dw_convolution_bwd_data_t<isa, diff_dst_type,
         int stride_off_w = ow % jcp.stride_w;
         ow /= jcp.stride_w;
 
-        par_conv.src = &diff_src[diff_src_d.blk_off(n, ch, ih, iw)];
-        par_conv.dst = &diff_dst[diff_dst_d.blk_off(n, ch, oh, ow)];
+        const int c_off = is_layout_nxc ? ch * jcp.ch_block : ch;
+        par_conv.src = &diff_src[diff_src_d.blk_off(n, c_off, ih, iw)];
+        par_conv.dst = &diff_dst[diff_dst_d.blk_off(n, c_off, oh, ow)];
         par_conv.filt = &weights[weights_d.blk_off(ch, 0, 0,
                 i_b_overflow + stride_off_h, i_r_overflow + stride_off_w)];
 
@@ -314,6 +316,9 @@ void jit_uni_dw_convolution_bwd_weights_t<isa, src_type,
     const size_t bias_size = jcp.with_bias ? jcp.ngroups : 0;
 
     const int ch_block = jcp.ch_block;
+    // in nhwc a group block is addressed by its channel offset within a pixel
+    const bool is_layout_nxc = jcp.src_tag == format_tag::nhwc;
+    const size_t w_stride = is_layout_nxc ? jcp.ngroups : ch_block;
 
     auto set_kernel_params
             = [&](jit_dw_conv_call_s *conv_params, const int batch,
@@ -334,18 +339,21 @@ void jit_uni_dw_convolution_bwd_weights_t<isa, src_type,
                   conv_params->oh_index = oh_s;
                   conv_params->oh_count = oh_e;
 
-                  size_t diff_dst_off
-                          = ((batch * (jcp.ngroups / ch_block) + group) * jcp.oh
-                                    + oh_start)
-                          * jcp.ow;
-
-                  size_t src_off
-                          = ((batch * (jcp.ngroups / ch_block) + group) * jcp.ih
-                                    + ih_s - tpad_underflow_off)
-                          * jcp.iw;
-
-                  conv_params->output = &diff_dst[diff_dst_off * ch_block];
-                  conv_params->input = &src[src_off * ch_block];
+                  const size_t b_g = is_layout_nxc
+                          ? batch
+                          : (size_t)batch * jcp.nb_ch + group;
+                  const size_t c_off = is_layout_nxc ? group * ch_block : 0;
+
+                  const size_t diff_dst_off
+                          = (b_g * jcp.oh + oh_start) * jcp.ow * w_stride
+                          + c_off;
+                  const size_t src_off
+                          = (b_g * jcp.ih + ih_s - tpad_underflow_off) * jcp.iw
+                                  * w_stride
+                          + c_off;
+
+                  conv_params->output = &diff_dst[diff_dst_off];
+                  conv_params->input = &src[src_off];
               };
 
     parallel(jcp.nthr, [&](const int ithr, const int nthr) {
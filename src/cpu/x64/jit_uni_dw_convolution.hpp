@@ -43,17 +43,19 @@ struct jit_uni_dw_convolution_fwd_t : public primitive_t {
                 jit_uni_dw_convolution_fwd_t);
 
         status_t init(engine_t *engine) {
-            bool ok = true && is_fwd()
-                    && set_default_alg_kind(alg_kind::convolution_direct)
-                    && expect_data_types(src_type, src_type, data_type::undef,
-                            dst_type, data_type::f32)
-                    && IMPLICATION(this->with_bias(),
+            VDISPATCH(is_fwd(), prop_kind);
+            VDISPATCH(set_default_alg_kind(alg_kind::convolution_direct),
+                    alg_kind);
+            VDISPATCH(expect_data_types(src_type, src_type, data_type::undef,
+                            dst_type, data_type::f32), data_type);
+            VDISPATCH(IMPLICATION(this->with_bias(),
                             utils::one_of(this->desc()->bias_desc.data_type,
-                                    data_type::f32, data_type::bf16))
-                    && attr()->has_default_values(
-                            primitive_attr_t::skip_mask_t::post_ops, dst_type)
-                    && !has_zero_dim_memory();
-            if (!ok) return status::unimplemented;
+                                    data_type::f32, data_type::bf16)),
+                    data_type);
+            VDISPATCH(attr()->has_default_values(
+                            primitive_attr_t::skip_mask_t::post_ops, dst_type),
+                    attr);
+            VDISPATCH(!has_zero_dim_memory(), zero_dim);
 
             status_t status
                     = jit_uni_dw_conv_fwd_kernel<isa, src_type>::init_conf(jcp_,
@@ -116,14 +118,15 @@ struct jit_uni_dw_convolution_bwd_data_t : public primitive_t {
                 jit_uni_dw_convolution_bwd_data_t);
 
         status_t init(engine_t *engine) {
-            bool ok = true && desc()->prop_kind == prop_kind::backward_data
-                    && set_default_alg_kind(alg_kind::convolution_direct)
-                    && expect_data_types(diff_src_type, diff_dst_type,
-                            data_type::undef, diff_dst_type, data_type::f32)
-                    && attr()->has_default_values() && !has_zero_dim_memory()
-                    && set_default_formats();
-
-            if (!ok) return status::unimplemented;
+            VDISPATCH(desc()->prop_kind == prop_kind::backward_data, prop_kind);
+            VDISPATCH(set_default_alg_kind(alg_kind::convolution_direct),
+                    alg_kind);
+            VDISPATCH(expect_data_types(diff_src_type, diff_dst_type,
+                            data_type::undef, diff_dst_type, data_type::f32),
+                    data_type);
+            VDISPATCH(attr()->has_default_values(), attr);
+            VDISPATCH(!has_zero_dim_memory(), zero_dim);
+            VDISPATCH(set_default_formats(), format);
 
             status_t status = jit_uni_dw_conv_bwd_data_kernel<isa,
                     diff_dst_type>::init_conf(jcp_, *desc(), *diff_src_md(),
@@ -202,17 +205,21 @@ struct jit_uni_dw_convolution_bwd_weights_t : public primitive_t {
                 jit_uni_dw_convolution_bwd_weights);
 
         status_t init(engine_t *engine) {
-            bool ok = true && desc()->prop_kind == prop_kind::backward_weights
-                    && set_default_alg_kind(alg_kind::convolution_direct)
-                    && expect_data_types(src_type, diff_weights_type,
-                            data_type::undef, src_type, data_type::f32)
-                    && IMPLICATION(this->with_bias(),
+            VDISPATCH(desc()->prop_kind == prop_kind::backward_weights,
+                    prop_kind);
+            VDISPATCH(set_default_alg_kind(alg_kind::convolution_direct),
+                    alg_kind);
+            VDISPATCH(expect_data_types(src_type, diff_weights_type,
+                            data_type::undef, src_type, data_type::f32),
+                    data_type);
+            VDISPATCH(IMPLICATION(this->with_bias(),
                             utils::one_of(
                                     this->desc()->diff_bias_desc.data_type,
-                                    data_type::f32, data_type::bf16))
-                    && attr()->has_default_values() && !has_zero_dim_memory()
-                    && set_default_formats();
-            if (!ok) return status::unimplemented;
+                                    data_type::f32, data_type::bf16)),
+                    data_type);
+            VDISPATCH(attr()->has_default_values(), attr);
+            VDISPATCH(!has_zero_dim_memory(), zero_dim);
+            VDISPATCH(set_default_formats(), format);
 
             const int max_threads
                     = dnnl_in_parallel() ? 1 : dnnl_get_max_threads();
@@ -14,12 +14,17 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <vector>
+
 #include "common/bfloat16.hpp"
 #include "common/c_types_map.hpp"
 #include "common/dnnl_thread.hpp"
+#include "common/dropout.hpp"
 #include "common/nstl.hpp"
 #include "common/utils.hpp"
 
+#include "cpu/cpu_dropout_utils.hpp"
+
 #include "cpu/x64/jit_avx512_core_bf16cvt.hpp"
 #include "cpu/x64/jit_generator.hpp"
 
@@ -40,6 +45,10 @@ struct jit_args_t {
     const void *dst; // fwd: dst;  bwd: diff_src;
     const void *diff_dst; // fwd: nullptr;  bwd: diff_dst;
     size_t work_amount;
+    // fwd dropout only
+    size_t dropout_off; // offset of the first element in dst
+    void *dropout_mask; // mask byte of the first element, may be nullptr
+    const dropout::params_t *dropout_params;
 };
 
 struct jit_uni_eltwise_kernel : public jit_generator {
@@ -52,6 +61,7 @@ protected:
 
     data_type_t data_type() const { return pd_->src_md()->data_type; }
     bool is_bf16() const { return data_type() == data_type::bf16; }
+    bool is_f16() const { return data_type() == data_type::f16; }
     int dtype_size() const { return types::data_type_size(data_type()); }
 };
 
@@ -124,7 +134,11 @@ struct jit_uni_kernel_t : public jit_uni_eltwise_kernel {
     DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_kernel)
 
     jit_uni_kernel_t(const eltwise_pd_t *pd) : jit_uni_eltwise_kernel(pd) {
-        if (is_bf16()) {
+        if (is_bf16_avx2()) {
+            bf16_emu_avx2_.reset(new bf16_emulation_avx2_t(this,
+                    bf16_emu_avx2_one, bf16_emu_avx2_even, bf16_emu_avx2_qnan,
+                    bf16_emu_scratch, bf16_emu_avx2_tr0));
+        } else if (is_bf16()) {
             if (!mayiuse(avx512_core_bf16))
                 bf16_emu_.reset(new bf16_emulation_t(this, bf16_emu_reserv_1,
                         bf16_emu_reserv_2, bf16_emu_reserv_3, bf16_emu_scratch,
@@ -137,16 +151,31 @@ struct jit_uni_kernel_t : public jit_uni_eltwise_kernel {
         // there's no auxiliary vregs on fwd path
         const bool is_fwd = pd_->is_fwd();
         const bool save_state = is_fwd ? false : true;
+        const bool fast_math
+                = pd_->attr()->fpmath_mode_ != fpmath_mode::strict;
         eltwise_injector_.reset(new jit_uni_eltwise_injector_f32<isa>(this,
                 desc.alg_kind, desc.alpha, desc.beta, 1.f, save_state,
-                reg_injector_table, injector_mask, is_fwd, pd_->use_dst()));
+                reg_injector_table, injector_mask, is_fwd, pd_->use_dst(),
+                fast_math));
+
+        // eltwise post-ops are applied to the same registers, so the whole
+        // chain takes a single pass over memory
+        const auto &po = pd_->attr()->post_ops_;
+        for (int i = 0; i < po.len(); i++)
+            post_ops_injectors_.emplace_back(
+                    new jit_uni_eltwise_injector_f32<isa>(this,
+                            po.entry_[i].eltwise, save_state,
+                            reg_injector_table, injector_mask, true, false,
+                            fast_math));
     }
 
     void generate() override {
         const bool is_fwd = pd_->is_fwd();
         preamble();
 
-        if (is_bf16()) {
+        if (is_bf16_avx2()) {
+            bf16_emu_avx2_->init_vcvtneps2bf16();
+        } else if (is_bf16()) {
             bf16_injector_->prepare_mask();
             if (!mayiuse(avx512_core_bf16)) bf16_emu_->init_vcvtneps2bf16();
         }
@@ -157,6 +186,7 @@ struct jit_uni_kernel_t : public jit_uni_eltwise_kernel {
         if (!is_fwd) mov(reg_diff_dst, ptr[param + GET_OFF(diff_dst)]);
         mov(reg_work_amount, ptr[param + GET_OFF(work_amount)]);
         eltwise_injector_->load_table_addr();
+        if (with_dropout()) dropout_prepare(param);
 
         Label reminder_loop_start, reminder_loop_end;
         Label vectorized_loop_start, vectorized_loop_end;
@@ -176,22 +206,42 @@ struct jit_uni_kernel_t : public jit_uni_eltwise_kernel {
         // there's a restriction on certain blocked layouts, when this behavior
         // can be relevantly easy controlled, this will cost much from code
         // perspective and will complicate the compute logic significantly.
-        if (is_bf16()) {
+        if (is_bf16_avx2()) {
+            load_bf16_avx2(vmm_src, reg_src);
+            compute_vector(vmm_src.getIdx());
+            if (!is_fwd) {
+                load_bf16_avx2(vmm_diff_dst, reg_diff_dst);
+                uni_vmulps(vmm_src, vmm_src, vmm_diff_dst);
+            }
+            bf16_emu_avx2_->vcvtneps2bf16(xmm_src, Ymm(vmm_src.getIdx()));
+            vmovdqu(ptr[reg_dst], xmm_src);
+        } else if (is_bf16()) {
             bf16_injector_->load_bf16_cvt_to_f32(vmm_src.getIdx(), reg_src);
-            eltwise_injector_->compute_vector(vmm_src.getIdx());
+            compute_vector(vmm_src.getIdx());
             if (!is_fwd) {
                 bf16_injector_->load_bf16_cvt_to_f32(
                         vmm_diff_dst.getIdx(), reg_diff_dst);
                 uni_vmulps(vmm_src, vmm_src, vmm_diff_dst);
             }
             bf16_injector_->cvt_f32_to_bf16_store(1, vmm_src.getIdx(), reg_dst);
+        } else if (is_f16()) {
+            // f16 is a storage type only: the values are converted with F16C
+            // on the fly and computed in f32
+            vcvtph2ps(vmm_src, ptr[reg_src]);
+            compute_vector(vmm_src.getIdx());
+            if (!is_fwd) {
+                vcvtph2ps(vmm_diff_dst, ptr[reg_diff_dst]);
+                uni_vmulps(vmm_src, vmm_src, vmm_diff_dst);
+            }
+            vcvtps2ph(ptr[reg_dst], vmm_src, 0x0);
         } else {
             uni_vmovups(vmm_src, ptr[reg_src]);
-            eltwise_injector_->compute_vector(vmm_src.getIdx());
+            compute_vector(vmm_src.getIdx());
             if (!is_fwd) {
                 uni_vmovups(vmm_diff_dst, ptr[reg_diff_dst]);
                 uni_vmulps(vmm_src, vmm_src, vmm_diff_dst);
             }
+            if (with_dropout()) dropout_vector();
             uni_vmovups(ptr[reg_dst], vmm_src);
         }
 
@@ -210,10 +260,19 @@ struct jit_uni_kernel_t : public jit_uni_eltwise_kernel {
 
         cmp(reg_work_amount, 0);
         jle(reminder_loop_end, T_NEAR);
-        if (is_bf16()) {
+        if (is_bf16_avx2()) {
+            load_bf16_avx2(xmm_src, reg_src, true);
+            compute_vector(xmm_src.getIdx());
+            if (!is_fwd) {
+                load_bf16_avx2(xmm_diff_dst, reg_diff_dst, true);
+                uni_vmulps(xmm_src, xmm_src, xmm_diff_dst);
+            }
+            bf16_emu_avx2_->cvt_ps_to_bf16_dw(xmm_src, xmm_src);
+            vpextrw(ptr[reg_dst], xmm_src, 0);
+        } else if (is_bf16()) {
             bf16_injector_->load_bf16_cvt_to_f32(
                     vmm_src.getIdx(), reg_src, true);
-            eltwise_injector_->compute_vector(vmm_src.getIdx());
+            compute_vector(vmm_src.getIdx());
             if (!is_fwd) {
                 bf16_injector_->load_bf16_cvt_to_f32(
                         vmm_diff_dst.getIdx(), reg_diff_dst, true);
@@ -221,13 +280,23 @@ struct jit_uni_kernel_t : public jit_uni_eltwise_kernel {
             }
             bf16_injector_->cvt_f32_to_bf16_store(
                     1, vmm_src.getIdx(), reg_dst, true);
+        } else if (is_f16()) {
+            load_f16_scalar(xmm_src, reg_src);
+            compute_vector(xmm_src.getIdx());
+            if (!is_fwd) {
+                load_f16_scalar(xmm_diff_dst, reg_diff_dst);
+                uni_vmulps(xmm_src, xmm_src, xmm_diff_dst);
+            }
+            vcvtps2ph(xmm_src, xmm_src, 0x0);
+            vpextrw(ptr[reg_dst], xmm_src, 0);
         } else {
             uni_vmovss(xmm_src, ptr[reg_src]);
-            eltwise_injector_->compute_vector(xmm_src.getIdx());
+            compute_vector(xmm_src.getIdx());
             if (!is_fwd) {
                 uni_vmovss(xmm_diff_dst, ptr[reg_diff_dst]);
                 uni_vmulps(xmm_src, xmm_src, xmm_diff_dst);
             }
+            if (with_dropout()) dropout_scalar();
             uni_vmovss(ptr[reg_dst], xmm_src);
         }
         add(reg_src, dtype_size());
@@ -242,14 +311,147 @@ struct jit_uni_kernel_t : public jit_uni_eltwise_kernel {
         postamble();
 
         eltwise_injector_->prepare_table();
+        for (auto &injector : post_ops_injectors_)
+            injector->prepare_table();
+        if (with_dropout()) dropout_prepare_table();
     }
 
 private:
     using Vmm = typename cpu_isa_traits<isa>::Vmm;
 
+    // All injectors share the table register, so with post-ops every
+    // injector loads its own table address before computing
+    void compute_vector(size_t idx) {
+        if (!post_ops_injectors_.empty()) eltwise_injector_->load_table_addr();
+        eltwise_injector_->compute_vector(idx);
+        for (auto &injector : post_ops_injectors_) {
+            injector->load_table_addr();
+            injector->compute_vector(idx);
+        }
+    }
+
+    // The dropout is computed in registers right before the store: the
+    // offsets of the lanes are hashed with common/dropout.hpp, the dropped
+    // lanes are zeroed and the kept ones scaled. Only the f32 forward on
+    // avx2 and avx512_common uses it, where the injectors on fwd take at
+    // most Vmm(0)..Vmm(6) and no gprs.
+    bool with_dropout() const {
+        return pd_->is_fwd() && !pd_->attr()->dropout_.has_default_values();
+    }
+    bool with_dropout_mask() const {
+        return with_dropout() && pd_->attr()->dropout_.with_mask_;
+    }
+
+    void dropout_prepare(const Reg64 &param) {
+        using namespace dropout;
+        mov(reg_dropout_off, ptr[param + GET_OFF(dropout_off)]);
+        if (with_dropout_mask())
+            mov(reg_dropout_mask, ptr[param + GET_OFF(dropout_mask)]);
+        mov(reg_dropout_tmp, ptr[param + GET_OFF(dropout_params)]);
+        uni_vpbroadcastd(vmm_dp_seed,
+                ptr[reg_dropout_tmp + offsetof(params_t, seed)]);
+        uni_vpbroadcastd(vmm_dp_keep_above,
+                ptr[reg_dropout_tmp + offsetof(params_t, keep_above)]);
+        uni_vbroadcastss(vmm_dp_scale,
+                ptr[reg_dropout_tmp + offsetof(params_t, scale)]);
+
+        mov(reg_dropout_tmp, l_dropout_table);
+        uni_vmovdqu(vmm_dp_iota, ptr[reg_dropout_tmp]);
+        const int consts_off = simd_w() * sizeof(uint32_t);
+        uni_vpbroadcastd(vmm_dp_golden, ptr[reg_dropout_tmp + consts_off]);
+        uni_vpbroadcastd(vmm_dp_mul_1, ptr[reg_dropout_tmp + consts_off + 4]);
+        uni_vpbroadcastd(vmm_dp_mul_2, ptr[reg_dropout_tmp + consts_off + 8]);
+    }
+
+    void dropout_prepare_table() {
+        align(64);
+        L(l_dropout_table);
+        for (int i = 0; i < simd_w(); i++)
+            dd(i);
+        dd(dropout::golden_ratio);
+        dd(dropout::fmix_mul_1);
+        dd(dropout::fmix_mul_2);
+    }
+
+    // Turns the offsets in `x` into the values compared with keep_above.
+    template <typename T>
+    void dropout_hash(const T &x, const T &t) {
+        vpmulld(x, x, T(vmm_dp_golden.getIdx()));
+        vpaddd(x, x, T(vmm_dp_seed.getIdx()));
+        vpsrld(t, x, 16);
+        uni_vpxor(x, x, t);
+        vpmulld(x, x, T(vmm_dp_mul_1.getIdx()));
+        vpsrld(t, x, 13);
+        uni_vpxor(x, x, t);
+        vpmulld(x, x, T(vmm_dp_mul_2.getIdx()));
+        vpsrld(t, x, 16);
+        uni_vpxor(x, x, t);
+        vpsrld(x, x, 1);
+    }
+
+    void dropout_vector() {
+        const Xmm xmm_x(vmm_dp_x.getIdx());
+        vmovd(xmm_x, reg_dropout_off.cvt32());
+        vpbroadcastd(vmm_dp_x, xmm_x);
+        vpaddd(vmm_dp_x, vmm_dp_x, vmm_dp_iota);
+        dropout_hash(vmm_dp_x, vmm_dp_tmp);
+
+        // a mask byte covers 8 lanes, so the vector stores 1 or 2 of them
+        if (isa == avx512_common) {
+            vpcmpgtd(k_dropout, vmm_dp_x, vmm_dp_keep_above);
+            vmulps(vmm_src | k_dropout | Xbyak::util::T_z, vmm_src,
+                    vmm_dp_scale);
+            if (with_dropout_mask()) kmovw(ptr[reg_dropout_mask], k_dropout);
+        } else {
+            vpcmpgtd(vmm_dp_x, vmm_dp_x, vmm_dp_keep_above);
+            vmulps(vmm_src, vmm_src, vmm_dp_scale);
+            vandps(vmm_src, vmm_src, vmm_dp_x);
+            if (with_dropout_mask()) {
+                vmovmskps(reg_dropout_tmp.cvt32(), vmm_dp_x);
+                mov(ptr[reg_dropout_mask], reg_dropout_tmp.cvt8());
+            }
+        }
+        add(reg_dropout_off, simd_w());
+        if (with_dropout_mask()) add(reg_dropout_mask, simd_w() / 8);
+    }
+
+    // The mask bytes of the tail are stored by the caller.
+    void dropout_scalar() {
+        const Xmm xmm_x(vmm_dp_x.getIdx());
+        const Xmm xmm_tmp(vmm_dp_tmp.getIdx());
+        vmovd(xmm_x, reg_dropout_off.cvt32());
+        dropout_hash(xmm_x, xmm_tmp);
+        vpcmpgtd(xmm_x, xmm_x, Xmm(vmm_dp_keep_above.getIdx()));
+        vmulss(xmm_src, xmm_src, Xmm(vmm_dp_scale.getIdx()));
+        vandps(xmm_src, xmm_src, xmm_x);
+        inc(reg_dropout_off);
+    }
+
+    // avx2 has no bf16 support at all: the values are widened with integer
+    // instructions and rounded back with bf16_emulation_avx2_t
+    bool is_bf16_avx2() const { return is_bf16() && isa == avx2; }
+
+    template <typename T>
+    void load_bf16_avx2(const T &vmm, const Reg64 &reg, bool is_tail = false) {
+        if (is_tail) {
+            uni_vpxor(vmm, vmm, vmm);
+            vpinsrw(vmm, vmm, ptr[reg], 0);
+            vpslld(vmm, vmm, 16);
+        } else {
+            vpmovzxwd(vmm, ptr[reg]);
+            vpslld(vmm, vmm, 16);
+        }
+    }
+
+    void load_f16_scalar(const Xmm &xmm, const Reg64 &reg) {
+        uni_vpxor(xmm, xmm, xmm);
+        vpinsrw(xmm, xmm, ptr[reg], 0);
+        vcvtph2ps(xmm, xmm);
+    }
+
     int vlen() {
         int vlen = cpu_isa_traits<isa>::vlen;
-        return is_bf16() ? vlen / 2 : vlen;
+        return (is_bf16() || is_f16()) ? vlen / 2 : vlen;
     }
     int simd_w() { return vlen() / dtype_size(); }
 
@@ -259,14 +461,32 @@ private:
     Reg64 reg_diff_dst = r10;
     Reg64 reg_work_amount = rsi;
     Reg64 imm_addr64 = rbx;
+    Reg64 reg_dropout_off = r11;
+    Reg64 reg_dropout_mask = r12;
+    Reg64 reg_dropout_tmp = r13;
 
     Opmask injector_mask = Opmask(1);
+    Opmask k_dropout = Opmask(2);
 
     Xmm xmm_src = Xmm(1);
     Vmm vmm_src = Vmm(1);
     Xmm xmm_diff_dst = Xmm(2);
     Vmm vmm_diff_dst = Vmm(2);
     std::unique_ptr<jit_uni_eltwise_injector_f32<isa>> eltwise_injector_;
+    std::vector<std::unique_ptr<jit_uni_eltwise_injector_f32<isa>>>
+            post_ops_injectors_;
+
+    /* dropout support */
+    Vmm vmm_dp_x = Vmm(7);
+    Vmm vmm_dp_tmp = Vmm(8);
+    Vmm vmm_dp_iota = Vmm(9);
+    Vmm vmm_dp_golden = Vmm(10);
+    Vmm vmm_dp_mul_1 = Vmm(11);
+    Vmm vmm_dp_mul_2 = Vmm(12);
+    Vmm vmm_dp_seed = Vmm(13);
+    Vmm vmm_dp_keep_above = Vmm(14);
+    Vmm vmm_dp_scale = Vmm(15);
+    Label l_dropout_table;
 
     /* bf16 support */
     Zmm bf16_emu_reserv_1 = Zmm(26);
@@ -279,6 +499,13 @@ private:
 
     std::unique_ptr<jit_bf16_injector_t> bf16_injector_;
     std::unique_ptr<bf16_emulation_t> bf16_emu_;
+
+    /* bf16 support on avx2, the injectors take the low registers */
+    Ymm bf16_emu_avx2_one = Ymm(12);
+    Ymm bf16_emu_avx2_even = Ymm(13);
+    Ymm bf16_emu_avx2_qnan = Ymm(14);
+    Ymm bf16_emu_avx2_tr0 = Ymm(15);
+    std::unique_ptr<bf16_emulation_avx2_t> bf16_emu_avx2_;
 };
 
 } // namespace
@@ -286,20 +513,42 @@ private:
 template <cpu_isa_t isa, data_type_t d_type>
 status_t jit_uni_eltwise_fwd_t<isa, d_type>::pd_t::init(engine_t *engine) {
     using namespace alg_kind;
+    using sm = primitive_attr_t::skip_mask_t;
 
     const memory_desc_wrapper data_d(src_md());
 
     bool ok = mayiuse(isa) && is_fwd() && src_md()->data_type == d_type
             && IMPLICATION(src_md()->data_type == data_type::bf16,
-                    mayiuse(avx512_core))
+                    isa == avx2 || mayiuse(avx512_core))
+            && IMPLICATION(
+                    src_md()->data_type == data_type::f16, mayiuse(avx2))
             && !has_zero_dim_memory()
             && data_d.is_dense(true)
             // refer to a comment in jit_uni_kernel why this is needed
             && IMPLICATION(!data_d.is_dense(), is_zero_preserved())
-            && attr()->has_default_values();
+            && attr()->has_default_values(sm::post_ops | sm::dropout)
+            && post_ops_ok()
+            && IMPLICATION(!attr()->dropout_.has_default_values(),
+                    d_type == data_type::f32
+                            && utils::one_of(isa, avx2, avx512_common));
     return ok ? status::success : status::unimplemented;
 }
 
+template <cpu_isa_t isa, data_type_t d_type>
+bool jit_uni_eltwise_fwd_t<isa, d_type>::pd_t::post_ops_ok() const {
+    const auto &po = attr()->post_ops_;
+    for (int i = 0; i < po.len(); i++) {
+        const auto &e = po.entry_[i];
+        // the padded area stays zero only if every op preserves zero
+        if (!e.is_eltwise()
+                || (!memory_desc_wrapper(src_md()).is_dense()
+                        && !eltwise_fwd_pd_t::eltwise_preserves_zero(
+                                e.eltwise)))
+            return false;
+    }
+    return true;
+}
+
 template <cpu_isa_t isa, data_type_t d_type>
 jit_uni_eltwise_fwd_t<isa, d_type>::jit_uni_eltwise_fwd_t(const pd_t *apd)
     : primitive_t(apd) {}
@@ -326,6 +575,16 @@ status_t jit_uni_eltwise_fwd_t<isa, d_type>::execute(
     src += data_d.offset0();
     dst += data_d.offset0();
 
+    const auto &dr = pd()->attr()->dropout_;
+    dropout::params_t dp;
+    if (dr.enabled_) CHECK(dropout_utils::init_params(dp, ctx));
+    auto mask = dr.with_mask_
+            ? CTX_OUT_MEM(uint8_t *, DNNL_ARG_ATTR_DROPOUT_MASK)
+            : nullptr;
+    // the threads start at multiples of 16 elements, so that no mask byte
+    // is shared between them
+    const dim_t kernel_simd_w = cpu_isa_traits<isa>::vlen / sizeof(float);
+
     parallel(0, [&](const int ithr, const int nthr) {
         dim_t start {0}, end {0};
 
@@ -339,7 +598,18 @@ status_t jit_uni_eltwise_fwd_t<isa, d_type>::execute(
         args.dst = dst + start;
         args.diff_dst = nullptr;
         args.work_amount = end - start;
+        args.dropout_off = start;
+        args.dropout_mask = mask ? mask + start / 8 : nullptr;
+        args.dropout_params = &dp;
         (*kernel_)(&args);
+
+        // the kernel stores the mask bytes of the full vectors only
+        if (mask) {
+            const dim_t tail_start = start
+                    + utils::rnd_dn(end - start, kernel_simd_w);
+            dropout_utils::store_mask(dp, mask, tail_start / 8,
+                    utils::div_up(end, (dim_t)8), false);
+        }
     });
 
     return status::success;
@@ -419,6 +689,9 @@ template struct jit_uni_eltwise_fwd_t<avx, data_type::f32>;
 template struct jit_uni_eltwise_fwd_t<avx2, data_type::f32>;
 template struct jit_uni_eltwise_fwd_t<avx512_common, data_type::f32>;
 template struct jit_uni_eltwise_fwd_t<avx512_core, data_type::bf16>;
+template struct jit_uni_eltwise_fwd_t<avx2, data_type::bf16>;
+template struct jit_uni_eltwise_fwd_t<avx2, data_type::f16>;
+template struct jit_uni_eltwise_fwd_t<avx512_core, data_type::f16>;
 
 template struct jit_uni_eltwise_bwd_t<sse41, data_type::f32>;
 template struct jit_uni_eltwise_bwd_t<avx, data_type::f32>;
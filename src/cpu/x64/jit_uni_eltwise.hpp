@@ -42,6 +42,7 @@ struct jit_uni_eltwise_fwd_t : public primitive_t {
 
         DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("jit:",
                                     ((d_type == data_type::bf16)
+                                            && isa != avx2
                                             && mayiuse(avx512_core_bf16))
                                             ? avx512_core_bf16
                                             : isa,
@@ -49,6 +50,9 @@ struct jit_uni_eltwise_fwd_t : public primitive_t {
                 jit_uni_eltwise_fwd_t);
 
         status_t init(engine_t *engine);
+
+    private:
+        bool post_ops_ok() const;
     };
 
     jit_uni_eltwise_fwd_t(const pd_t *apd);
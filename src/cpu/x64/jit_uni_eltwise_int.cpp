@@ -14,11 +14,15 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <memory>
+#include <vector>
+
 #include "common/c_types_map.hpp"
 #include "common/dnnl_thread.hpp"
 #include "common/nstl.hpp"
 #include "common/utils.hpp"
 
+#include "cpu/x64/injectors/jit_uni_eltwise_injector.hpp"
 #include "cpu/x64/jit_generator.hpp"
 
 #include "cpu/x64/jit_uni_eltwise_int.hpp"
@@ -60,7 +64,8 @@ template <cpu_isa_t isa>
 struct jit_uni_subkernel_int_t : public jit_uni_eltwise_int_kernel {
     DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_subkernel_int)
 
-    jit_uni_subkernel_int_t(const eltwise_desc_t &desc)
+    jit_uni_subkernel_int_t(
+            const eltwise_desc_t &desc, const post_ops_t &post_ops)
         : jit_uni_eltwise_int_kernel(desc) {
         using namespace data_type;
 
@@ -69,6 +74,14 @@ struct jit_uni_subkernel_int_t : public jit_uni_eltwise_int_kernel {
                 alg_kind::eltwise_linear));
         assert(utils::one_of(data_type(), s32, s8, u8));
         assert(utils::one_of(isa, sse41, avx2, avx512_common));
+
+        // eltwise post-ops are applied in f32 before the conversion back to
+        // the integer data type
+        for (int i = 0; i < post_ops.len(); i++)
+            post_ops_injectors_.emplace_back(
+                    new jit_uni_eltwise_injector_f32<isa>(this,
+                            post_ops.entry_[i].eltwise, false,
+                            reg_injector_table, k_mask));
     }
 
     void generate() override {
@@ -123,6 +136,9 @@ struct jit_uni_subkernel_int_t : public jit_uni_eltwise_int_kernel {
 
         L(loop_label[2]);
         postamble();
+
+        for (auto &injector : post_ops_injectors_)
+            injector->prepare_table();
     }
 
 private:
@@ -134,6 +150,7 @@ private:
     Reg64 reg_work_amount = rsi;
     Reg64 imm_addr64 = rbx;
     Reg64 reg_int8 = r9;
+    Reg64 reg_injector_table = r11;
 
     Xmm xmm_alpha = Xmm(13);
     Xmm xmm_beta = Xmm(14);
@@ -147,6 +164,9 @@ private:
     opmask_t k_mask = k1;
     opmask_t k_mask_int8 = k2; // Mask for store 1 byte in case of AVX512
 
+    std::vector<std::unique_ptr<jit_uni_eltwise_injector_f32<isa>>>
+            post_ops_injectors_;
+
     bool is32bit() const { return data_type() == data_type::s32; }
 
     // Load 32bit data type (s32)
@@ -196,10 +216,30 @@ private:
                     vectorize, vr_from, mem_from, data_type() == data_type::s8);
     }
 
-    // Processing
+    // Processing, the result is in f32
     void process_linear(const Vmm &vr_to, const Vmm &vr_from);
     void process_relu(const Vmm &vr_to, const Vmm &vr_from);
 
+    // Applies the post-ops and converts the result to s32
+    void finalize(const Vmm &vr_to, const alg_kind_t alg) {
+        for (auto &injector : post_ops_injectors_) {
+            injector->load_table_addr();
+            injector->compute_vector(vr_to.getIdx());
+        }
+
+        // Saturate before converting from f32 to s32
+        if (alg == alg_kind::eltwise_linear || !post_ops_injectors_.empty()) {
+            Vmm vmm_saturation_ubound = vmm_tmp;
+            Reg64 reg_tmp = r10;
+            uni_vpxor(vmm_zero, vmm_zero, vmm_zero);
+            init_saturate_f32(vmm_zero, vmm_saturation_ubound, reg_tmp,
+                    data_type::f32, data_type());
+            saturate_f32(vr_to, vmm_zero, vmm_saturation_ubound, data_type());
+        }
+
+        uni_vcvtps2dq(vr_to, vr_to);
+    }
+
     // Store s32 for any isa
     void store_32bit(
             const bool vectorize, const Address &mem_to, const Vmm &vr_to) {
@@ -247,6 +287,8 @@ private:
                 break;
             default: assert(!"unsupported alg");
         }
+        for (size_t i = 0; i < uf; i++)
+            finalize(vreg_to(i), alg);
 
         // 3. Store (mem <- vregs)
         for (size_t i = 0; i < uf; i++)
@@ -259,16 +301,6 @@ void jit_uni_subkernel_int_t<isa>::process_linear(
         const Vmm &vr_to, const Vmm &vr_from) {
     uni_vcvtdq2ps(vr_to, vr_from);
     uni_vfmadd213ps(vr_to, vmm_alpha, vmm_beta);
-
-    // Saturate before converting from f32 to s32
-    Vmm vmm_saturation_ubound = vmm_tmp;
-    Reg64 reg_tmp = r10;
-    uni_vpxor(vmm_zero, vmm_zero, vmm_zero);
-    init_saturate_f32(vmm_zero, vmm_saturation_ubound, reg_tmp, data_type::f32,
-            data_type());
-    saturate_f32(vr_to, vmm_zero, vmm_saturation_ubound, data_type());
-
-    uni_vcvtps2dq(vr_to, vr_to);
 }
 
 template <cpu_isa_t isa>
@@ -289,7 +321,6 @@ void jit_uni_subkernel_int_t<sse41>::process_relu(
     movups(mask, vr_from);
     cmpps(mask, vmm_zero, _cmp_nle_us);
     blendvps(vr_to, vr_from);
-    cvtps2dq(vr_to, vr_to);
 }
 
 template <>
@@ -300,7 +331,6 @@ void jit_uni_subkernel_int_t<avx2>::process_relu(
     vmulps(vr_to, vr_from, vmm_alpha);
     vcmpgtps(vmm_mask, vr_from, vmm_zero);
     vblendvps(vr_to, vr_to, vr_from, vmm_mask);
-    vcvtps2dq(vr_to, vr_to);
 }
 
 template <>
@@ -311,7 +341,6 @@ void jit_uni_subkernel_int_t<avx512_common>::process_relu(
     vmulps(vr_to, vr_from, vmm_alpha);
     vcmpps(k_mask, vr_from, vmm_zero, _cmp_nle_us);
     vblendmps(vr_to | k_mask, vr_to, vr_from);
-    vcvtps2dq(vr_to, vr_to);
 }
 
 template <cpu_isa_t isa>
@@ -399,6 +428,18 @@ void jit_uni_subkernel_int_t<avx512_common>::store_8bit(const bool vectorize,
 
 template <cpu_isa_t isa, data_type_t d_type>
 status_t jit_uni_eltwise_int_fwd_t<isa, d_type>::pd_t::init(engine_t *engine) {
+    using sm = primitive_attr_t::skip_mask_t;
+
+    // the padded area stays zero only if every post-op preserves zero
+    const bool is_dense = memory_desc_wrapper(src_md()).is_dense();
+    const auto &po = attr()->post_ops_;
+    bool post_ops_ok = true;
+    for (int i = 0; i < po.len(); i++)
+        post_ops_ok = post_ops_ok && po.entry_[i].is_eltwise()
+                && IMPLICATION(!is_dense,
+                        eltwise_fwd_pd_t::eltwise_preserves_zero(
+                                po.entry_[i].eltwise));
+
     bool ok = mayiuse(isa)
             && desc()->data_desc.data_type == d_type
             // only relu and linear so far
@@ -406,7 +447,7 @@ status_t jit_uni_eltwise_int_fwd_t<isa, d_type>::pd_t::init(engine_t *engine) {
                     alg_kind::eltwise_linear)
             && !has_zero_dim_memory()
             && memory_desc_wrapper(src_md()).is_dense(true)
-            && attr()->has_default_values();
+            && attr()->has_default_values(sm::post_ops) && post_ops_ok;
 
     return ok ? status::success : status::unimplemented;
 }
@@ -419,7 +460,8 @@ jit_uni_eltwise_int_fwd_t<isa, d_type>::jit_uni_eltwise_int_fwd_t(
 template <cpu_isa_t isa, data_type_t d_type>
 status_t jit_uni_eltwise_int_fwd_t<isa, d_type>::init(engine_t *engine) {
     const auto &desc = *pd()->desc();
-    CHECK(safe_ptr_assign(kernel_, new jit_uni_subkernel_int_t<isa>(desc)));
+    CHECK(safe_ptr_assign(kernel_,
+            new jit_uni_subkernel_int_t<isa>(desc, pd()->attr()->post_ops_)));
     return kernel_->create_kernel();
 }
 
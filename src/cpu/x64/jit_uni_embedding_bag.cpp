@@ -0,0 +1,210 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/dnnl_thread.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/x64/jit_uni_embedding_bag.hpp"
+
+#define GET_OFF(field) offsetof(jit_embedding_bag_call_s, field)
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+using namespace dnnl::impl::data_type;
+using namespace dnnl::impl::utils;
+using namespace Xbyak;
+
+template <cpu_isa_t isa>
+status_t jit_uni_embedding_bag_kernel_t<isa>::init_conf(
+        jit_embedding_bag_conf_t &jep, const embedding_bag_pd_t *pd) {
+    jep.table_dt = pd->weights_md(0)->data_type;
+    jep.emb_dim = pd->emb_dim();
+    jep.with_scale_shift = pd->with_scale_shift();
+    jep.max_unroll
+            = nstl::min(16, cpu_isa_traits<isa>::n_vregs - n_reserved_vregs);
+    // The rows are random accesses: looking a few rows ahead covers the
+    // memory latency without evicting the rows being accumulated.
+    jep.prefetch_distance = 8;
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+void jit_uni_embedding_bag_kernel_t<isa>::accumulate_row(
+        int unroll, dim_t row_off) {
+    const size_t dt_size = types::data_type_size(jep.table_dt);
+    for (int u = 0; u < unroll; u++) {
+        const Vmm vacc = vmm_acc(u);
+        const auto addr = ptr[reg_table + reg_row
+                + (row_off + u * simd_w) * dt_size];
+        switch (jep.table_dt) {
+            case f32: vaddps(vacc, vacc, addr); break;
+            case bf16:
+                vpmovzxwd(vmm_tmp, addr);
+                vpslld(vmm_tmp, vmm_tmp, 16);
+                vaddps(vacc, vacc, vmm_tmp);
+                break;
+            case s8:
+            case u8:
+                if (jep.table_dt == s8)
+                    vpmovsxbd(vmm_tmp, addr);
+                else
+                    vpmovzxbd(vmm_tmp, addr);
+                vcvtdq2ps(vmm_tmp, vmm_tmp);
+                vfmadd231ps(vacc, vmm_tmp, vmm_row_scale);
+                break;
+            default: assert(!"unsupported data type");
+        }
+    }
+}
+
+template <cpu_isa_t isa>
+void jit_uni_embedding_bag_kernel_t<isa>::prefetch_row(
+        int unroll, dim_t row_off) {
+    const size_t dt_size = types::data_type_size(jep.table_dt);
+    const dim_t row_bytes = jep.emb_dim * dt_size;
+    const dim_t block_bytes = unroll * simd_w * dt_size;
+    const dim_t cache_line = 64;
+
+    Label skip_label;
+    lea(reg_pf_ptr, ptr[reg_ptr + jep.prefetch_distance * sizeof(int32_t)]);
+    cmp(reg_pf_ptr, reg_indices_end);
+    jae(skip_label, T_NEAR);
+    movsxd(reg_pf_row, dword[reg_pf_ptr]);
+    imul(reg_pf_row, reg_pf_row, (int)row_bytes);
+    for (dim_t off = 0; off < block_bytes; off += cache_line)
+        prefetcht0(ptr[reg_table + reg_pf_row + row_off * dt_size + off]);
+    L(skip_label);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_embedding_bag_kernel_t<isa>::compute_block(
+        int unroll, dim_t dim_off) {
+    const dim_t row_bytes
+            = jep.emb_dim * types::data_type_size(jep.table_dt);
+
+    for (int u = 0; u < unroll; u++)
+        uni_vxorps(vmm_acc(u), vmm_acc(u), vmm_acc(u));
+    if (jep.with_scale_shift)
+        uni_vxorps(vmm_shift_sum, vmm_shift_sum, vmm_shift_sum);
+
+    Label loop_label, exit_label;
+    mov(reg_ptr, reg_indices);
+    mov(reg_cnt, reg_n);
+
+    L(loop_label);
+    cmp(reg_cnt, 0);
+    jle(exit_label, T_NEAR);
+    {
+        movsxd(reg_row, dword[reg_ptr]);
+        if (jep.with_scale_shift) {
+            vbroadcastss(vmm_row_scale, ptr[reg_scale_shift + reg_row * 8]);
+            vbroadcastss(
+                    vmm_row_shift, ptr[reg_scale_shift + reg_row * 8 + 4]);
+            vaddps(vmm_shift_sum, vmm_shift_sum, vmm_row_shift);
+        }
+        imul(reg_row, reg_row, (int)row_bytes);
+        prefetch_row(unroll, dim_off);
+        accumulate_row(unroll, dim_off);
+
+        add(reg_ptr, sizeof(int32_t));
+        sub(reg_cnt, 1);
+        jmp(loop_label, T_NEAR);
+    }
+    L(exit_label);
+
+    for (int u = 0; u < unroll; u++) {
+        const Vmm vacc = vmm_acc(u);
+        if (jep.with_scale_shift) vaddps(vacc, vacc, vmm_shift_sum);
+        vmulps(vacc, vacc, vmm_scale);
+        uni_vmovups(ptr[reg_dst + (dim_off + u * simd_w) * sizeof(float)],
+                vacc);
+    }
+}
+
+template <cpu_isa_t isa>
+void jit_uni_embedding_bag_kernel_t<isa>::generate() {
+    preamble();
+
+    mov(reg_table, ptr[param + GET_OFF(table)]);
+    if (jep.with_scale_shift)
+        mov(reg_scale_shift, ptr[param + GET_OFF(scale_shift)]);
+    mov(reg_indices, ptr[param + GET_OFF(indices)]);
+    mov(reg_indices_end, ptr[param + GET_OFF(indices_end)]);
+    mov(reg_dst, ptr[param + GET_OFF(dst)]);
+    mov(reg_n, ptr[param + GET_OFF(n_indices)]);
+    vbroadcastss(vmm_scale, ptr[param + GET_OFF(scale)]);
+
+    // The embedding dimension is known at creation time, so that the
+    // blocks of the row are unrolled statically. The indices are read again
+    // for every block, they stay in L1.
+    const dim_t n_vecs = jep.emb_dim / simd_w;
+    for (dim_t vec = 0; vec < n_vecs; vec += jep.max_unroll) {
+        const int unroll = (int)nstl::min((dim_t)jep.max_unroll, n_vecs - vec);
+        compute_block(unroll, vec * simd_w);
+    }
+
+    postamble();
+}
+
+template <cpu_isa_t isa>
+status_t jit_uni_embedding_bag_t<isa>::execute(const exec_ctx_t &ctx) const {
+    auto indices = CTX_IN_MEM(const int32_t *, DNNL_ARG_SRC);
+    auto offsets = CTX_IN_MEM(const int32_t *, DNNL_ARG_OFFSETS);
+    auto table = CTX_IN_MEM(const char *, DNNL_ARG_WEIGHTS);
+    auto scale_shift = CTX_IN_MEM(const float *, DNNL_ARG_WEIGHTS_SCALE_SHIFT);
+    auto dst = CTX_OUT_MEM(float *, DNNL_ARG_DST);
+
+    const dim_t bags = pd()->num_bags();
+    const dim_t n_indices = pd()->num_indices();
+    const dim_t dim = pd()->emb_dim();
+    const bool is_mean = pd()->desc()->alg_kind == alg_kind::reduction_mean;
+
+    parallel(0, [&](const int ithr, const int nthr) {
+        dim_t start {0}, end {0};
+        pd()->balance_bags(offsets, nthr, ithr, start, end);
+
+        for (dim_t b = start; b < end; ++b) {
+            const dim_t i_beg = offsets[b];
+            const dim_t i_end = b + 1 < bags ? offsets[b + 1] : n_indices;
+
+            auto arg = jit_embedding_bag_call_s();
+            arg.table = table;
+            arg.scale_shift = scale_shift;
+            arg.indices = indices + i_beg;
+            arg.indices_end = indices + n_indices;
+            arg.dst = dst + b * dim;
+            arg.n_indices = i_end - i_beg;
+            arg.scale = is_mean && i_end > i_beg ? 1.f / (i_end - i_beg) : 1.f;
+            (*kernel_)(&arg);
+        }
+    });
+
+    return status::success;
+}
+
+template struct jit_uni_embedding_bag_kernel_t<avx2>;
+template struct jit_uni_embedding_bag_kernel_t<avx512_core>;
+template struct jit_uni_embedding_bag_t<avx2>;
+template struct jit_uni_embedding_bag_t<avx512_core>;
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
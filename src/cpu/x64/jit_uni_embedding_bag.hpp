@@ -0,0 +1,155 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_JIT_UNI_EMBEDDING_BAG_HPP
+#define CPU_X64_JIT_UNI_EMBEDDING_BAG_HPP
+
+#include <memory>
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+
+#include "cpu/cpu_embedding_bag_pd.hpp"
+#include "cpu/x64/cpu_isa_traits.hpp"
+#include "cpu/x64/jit_generator.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+struct jit_embedding_bag_conf_t {
+    data_type_t table_dt;
+    dim_t emb_dim;
+    bool with_scale_shift;
+    int max_unroll; /* number of vectors of a row accumulated at once */
+    int prefetch_distance; /* number of indices to look ahead */
+};
+
+struct jit_embedding_bag_call_s {
+    const void *table;
+    const float *scale_shift;
+    const int32_t *indices; /* first index of the bag */
+    const int32_t *indices_end; /* end of all the indices, for prefetching */
+    float *dst;
+    dim_t n_indices;
+    float scale;
+};
+
+template <cpu_isa_t isa>
+struct jit_uni_embedding_bag_kernel_t : public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_embedding_bag_kernel_t)
+
+    jit_uni_embedding_bag_kernel_t(const jit_embedding_bag_conf_t &ajep)
+        : jep(ajep) {}
+
+    static status_t init_conf(
+            jit_embedding_bag_conf_t &jep, const embedding_bag_pd_t *pd);
+
+    const jit_embedding_bag_conf_t jep;
+
+    static constexpr int simd_w = cpu_isa_traits<isa>::vlen / sizeof(float);
+
+private:
+    using Vmm = typename cpu_isa_traits<isa>::Vmm;
+    using reg64_t = const Xbyak::Reg64;
+
+    reg64_t param = abi_param1;
+
+    reg64_t reg_table = r8;
+    reg64_t reg_scale_shift = r9;
+    reg64_t reg_indices = r10;
+    reg64_t reg_indices_end = r11;
+    reg64_t reg_dst = r12;
+    reg64_t reg_n = r13;
+    reg64_t reg_ptr = r14;
+    reg64_t reg_cnt = r15;
+    reg64_t reg_row = rax;
+    reg64_t reg_pf_ptr = rbx;
+    reg64_t reg_pf_row = rdx;
+
+    // The first registers hold the bag scale, the current row scale and
+    // shift, the sum of the row shifts and a temporary, then come the
+    // accumulators of the row vectors.
+    enum { n_reserved_vregs = 5 };
+    Vmm vmm_scale = Vmm(0);
+    Vmm vmm_row_scale = Vmm(1);
+    Vmm vmm_row_shift = Vmm(2);
+    Vmm vmm_shift_sum = Vmm(3);
+    Vmm vmm_tmp = Vmm(4);
+    Vmm vmm_acc(int i_unroll) const { return Vmm(n_reserved_vregs + i_unroll); }
+
+    void accumulate_row(int unroll, dim_t row_off);
+    void prefetch_row(int unroll, dim_t row_off);
+    void compute_block(int unroll, dim_t dim_off);
+    void generate() override;
+};
+
+template <cpu_isa_t isa>
+struct jit_uni_embedding_bag_t : public primitive_t {
+    using kernel_t = jit_uni_embedding_bag_kernel_t<isa>;
+
+    struct pd_t : public cpu_embedding_bag_pd_t {
+        using cpu_embedding_bag_pd_t::cpu_embedding_bag_pd_t;
+
+        DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("jit:", isa, ""),
+                jit_uni_embedding_bag_t);
+
+        status_t init(engine_t *engine) {
+            using namespace data_type;
+            using namespace format_tag;
+
+            bool ok = mayiuse(isa)
+                    && utils::one_of(weights_md(0)->data_type, f32, bf16, s8,
+                            u8)
+                    && dst_md()->data_type == f32
+                    && set_default_params() == status::success
+                    && attr()->has_default_values()
+                    && memory_desc_matches_tag(*src_md(0), a)
+                    && memory_desc_matches_tag(*src_md(1), a)
+                    && memory_desc_matches_tag(*weights_md(0), ab)
+                    && memory_desc_matches_tag(*dst_md(), ab)
+                    && IMPLICATION(with_scale_shift(),
+                            memory_desc_matches_tag(*weights_md(1), ab))
+                    && emb_dim() % kernel_t::simd_w == 0;
+            if (!ok) return status::unimplemented;
+
+            return kernel_t::init_conf(jep_, this);
+        }
+
+        jit_embedding_bag_conf_t jep_;
+    };
+
+    jit_uni_embedding_bag_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override {
+        CHECK(safe_ptr_assign(kernel_, new kernel_t(pd()->jep_)));
+        return kernel_->create_kernel();
+    }
+
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+    std::unique_ptr<kernel_t> kernel_;
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -0,0 +1,155 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_JIT_UNI_GLOBAL_POOLING_HPP
+#define CPU_X64_JIT_UNI_GLOBAL_POOLING_HPP
+
+#include <memory>
+
+#include "common/c_types_map.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/primitive.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_pooling_pd.hpp"
+#include "cpu/x64/jit_uni_reduction.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+// Global pooling (the window covers the whole spatial domain, without
+// padding) computed as a reduction over the spatial dimensions. Unlike the
+// pooling implementations, which parallelize over the minibatch and the
+// channels only, the reduction splits the spatial domain between the threads
+// when there are few channels to work on, e.g. at minibatch 1.
+template <cpu_isa_t isa>
+struct jit_uni_global_pooling_fwd_t : public primitive_t {
+    struct pd_t : public cpu_pooling_fwd_pd_t {
+        using cpu_pooling_fwd_pd_t::cpu_pooling_fwd_pd_t;
+
+        pd_t(const pd_t &other)
+            : cpu_pooling_fwd_pd_t(other)
+            , reduction_pd_(other.reduction_pd_->clone()) {}
+
+        ~pd_t() = default;
+
+        DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("jit_global:", isa, ""),
+                jit_uni_global_pooling_fwd_t);
+
+        status_t init(engine_t *engine) {
+            using namespace alg_kind;
+
+            VDISPATCH(mayiuse(isa), isa);
+            VDISPATCH(is_fwd(), prop_kind);
+            // max pooling for training needs the workspace
+            const bool is_inference
+                    = desc()->prop_kind == prop_kind::forward_inference;
+            VDISPATCH(utils::one_of(desc()->alg_kind,
+                              pooling_avg_include_padding,
+                              pooling_avg_exclude_padding)
+                            || (desc()->alg_kind == pooling_max
+                                    && is_inference),
+                    alg_kind);
+            VDISPATCH(src_md()->data_type == dst_md()->data_type, data_type);
+            VDISPATCH(attr()->has_default_values(), attr);
+            VDISPATCH(!has_zero_dim_memory(), zero_dim);
+            VDISPATCH(is_global(), shape);
+            VDISPATCH(set_default_params() == status::success, format);
+
+            CHECK(init_reduction(engine));
+            init_scratchpad();
+            return status::success;
+        }
+
+    protected:
+        using reduction_pd_t = typename jit_uni_reduction_t<isa>::pd_t;
+        friend jit_uni_global_pooling_fwd_t;
+
+        std::unique_ptr<primitive_desc_t> reduction_pd_;
+
+    private:
+        bool is_global() const {
+            return KD() == ID() && KH() == IH() && KW() == IW()
+                    && utils::everyone_is(1, OD(), OH(), OW())
+                    && utils::everyone_is(0, padFront(), padBack(), padT(),
+                            padB(), padL(), padR())
+                    && !is_dilated();
+        }
+
+        // Without padding both averages are the same. The descriptor is
+        // initialized directly, as the reduction API accepts the mean of
+        // floating-point data only, while the jit reduction computes it for
+        // integers too.
+        status_t init_reduction(engine_t *engine) {
+            using namespace alg_kind;
+
+            auto rd = reduction_desc_t();
+            rd.primitive_kind = primitive_kind::reduction;
+            rd.alg_kind = desc()->alg_kind == pooling_max ? reduction_max
+                                                          : reduction_mean;
+            rd.src_desc = *src_md();
+            rd.dst_desc = *dst_md();
+            rd.p = 0.f;
+            rd.eps = 0.f;
+
+            primitive_attr_t reduction_attr;
+            reduction_attr.set_scratchpad_mode(scratchpad_mode::user);
+            primitive_desc_t *reduction_pd = nullptr;
+            CHECK(primitive_desc_t::create<reduction_pd_t>(&reduction_pd,
+                    (op_desc_t *)&rd, &reduction_attr, engine, nullptr));
+            reduction_pd_.reset(reduction_pd);
+            return status::success;
+        }
+
+        void init_scratchpad() {
+            auto scratchpad = scratchpad_registry().registrar();
+            scratchpad.book(memory_tracking::names::key_nested,
+                    reduction_pd_->scratchpad_registry());
+        }
+    };
+
+    jit_uni_global_pooling_fwd_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override {
+        return pd()->reduction_pd_->create_primitive(reduction_p_, engine);
+    }
+
+    status_t execute(const exec_ctx_t &ctx) const override {
+        // The reduction takes its source and destination by the same
+        // argument kinds as the pooling.
+        nested_scratchpad_t ns(
+                ctx, memory_tracking::names::key_nested, reduction_p_);
+        exec_ctx_t reduction_ctx(ctx);
+        reduction_ctx.set_scratchpad_grantor(ns.grantor());
+        return reduction_p_->execute(reduction_ctx);
+    }
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+    std::shared_ptr<primitive_t> reduction_p_;
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
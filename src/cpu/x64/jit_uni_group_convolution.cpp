@@ -0,0 +1,311 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/x64/jit_uni_group_convolution.hpp"
+
+#define GET_OFF(field) offsetof(jit_group_conv_call_s, field)
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+using namespace dnnl::impl::memory_tracking::names;
+using namespace dnnl::impl::utils;
+using namespace Xbyak;
+
+template <cpu_isa_t isa>
+jit_uni_group_conv_fwd_kernel_t<isa>::jit_uni_group_conv_fwd_kernel_t(
+        const jit_group_conv_conf_t &ajcp, const post_ops_t &post_ops,
+        int ur_w)
+    : jit_generator(nullptr, MAX_CODE_SIZE, true, isa)
+    , jcp(ajcp)
+    , ur_w_(ur_w) {
+    for (int i = 0; i < post_ops.len(); ++i)
+        eltwise_injectors_.emplace_back(
+                new jit_uni_eltwise_injector_f32<isa>(this,
+                        post_ops.entry_[i].eltwise, false, reg_injector_table));
+}
+
+template <cpu_isa_t isa>
+status_t jit_uni_group_conv_fwd_kernel_t<isa>::init_conf(
+        jit_group_conv_conf_t &jcp, const convolution_desc_t &cd,
+        const memory_desc_wrapper &src_d, const memory_desc_wrapper &weights_d,
+        const memory_desc_wrapper &dst_d) {
+    jcp = zero<decltype(jcp)>();
+
+    jcp.ngroups = weights_d.dims()[0];
+    jcp.cpg = src_d.dims()[1] / jcp.ngroups;
+    if (dst_d.dims()[1] / jcp.ngroups != jcp.cpg) return status::unimplemented;
+
+    jcp.mb = src_d.dims()[0];
+    jcp.ih = src_d.dims()[2];
+    jcp.iw = src_d.dims()[3];
+    jcp.oh = dst_d.dims()[2];
+    jcp.ow = dst_d.dims()[3];
+    jcp.kh = weights_d.dims()[3];
+    jcp.kw = weights_d.dims()[4];
+    jcp.stride_h = cd.strides[0];
+    jcp.stride_w = cd.strides[1];
+    jcp.t_pad = cd.padding[0][0];
+    jcp.l_pad = cd.padding[0][1];
+    jcp.dilate_h = cd.dilates[0];
+    jcp.dilate_w = cd.dilates[1];
+    jcp.with_bias = cd.bias_desc.format_kind != format_kind::undef;
+
+    // A vector holds whole groups only and the channels are not padded.
+    jcp.simd_w = cpu_isa_traits<isa>::vlen / sizeof(float);
+    if (!one_of(jcp.cpg, 2, 4, 8) || jcp.cpg > jcp.simd_w)
+        return status::unimplemented;
+    if ((jcp.ngroups * jcp.cpg) % jcp.simd_w != 0)
+        return status::unimplemented;
+    jcp.g_block = jcp.simd_w / jcp.cpg;
+    jcp.nb_g = jcp.ngroups / jcp.g_block;
+
+    // Three vector registers are taken by the kernel itself and the eltwise
+    // post-ops need up to five more once the accumulation is done.
+    jcp.ur_w = isa == avx512_common ? 16 : 8;
+
+    const int ext_kw = (jcp.kw - 1) * (jcp.dilate_w + 1) + 1;
+    const int last_iw = jcp.iw - ext_kw + jcp.l_pad;
+    jcp.ow_start = nstl::min(div_up(jcp.l_pad, jcp.stride_w), jcp.ow);
+    jcp.ow_end = last_iw < 0 ? 0 : last_iw / jcp.stride_w + 1;
+    jcp.ow_end = nstl::max(nstl::min(jcp.ow_end, jcp.ow), jcp.ow_start);
+    jcp.ur_w_tail = (jcp.ow_end - jcp.ow_start) % jcp.ur_w;
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+void jit_uni_group_conv_fwd_kernel_t<isa>::compute_kw() {
+    const int vlen = cpu_isa_traits<isa>::vlen;
+    const int ic = jcp.ngroups * jcp.cpg;
+    const int src_ur_stride = jcp.stride_w * ic * sizeof(float);
+
+    for (int icl = 0; icl < jcp.cpg; ++icl) {
+        uni_vmovups(vmm_perm, ptr[reg_table + icl * vlen]);
+        uni_vmovups(vmm_wei, ptr[aux_wei + icl * vlen]);
+        for (int i_ur = 0; i_ur < ur_w_; ++i_ur) {
+            // the lanes of every output channel of a group get the input
+            // channel icl of the same group
+            vpermps(vmm_src, vmm_perm, ptr[aux_src + i_ur * src_ur_stride]);
+            uni_vfmadd231ps(vmm_acc(i_ur), vmm_src, vmm_wei);
+        }
+    }
+}
+
+template <cpu_isa_t isa>
+void jit_uni_group_conv_fwd_kernel_t<isa>::generate() {
+    const int vlen = cpu_isa_traits<isa>::vlen;
+    const int ic = jcp.ngroups * jcp.cpg;
+    const int oc = ic;
+    const int kw_src_step = (jcp.dilate_w + 1) * ic * sizeof(float);
+    const int kh_src_step = (jcp.dilate_h + 1) * jcp.iw * ic * sizeof(float);
+    const int kw_wei_step = jcp.cpg * vlen;
+    const int kh_wei_step = jcp.kw * kw_wei_step;
+
+    preamble();
+
+    mov(reg_src, ptr[param + GET_OFF(src)]);
+    mov(reg_wei, ptr[param + GET_OFF(wei)]);
+    mov(reg_dst, ptr[param + GET_OFF(dst)]);
+    if (jcp.with_bias) mov(reg_bias, ptr[param + GET_OFF(bias)]);
+    mov(reg_kh, ptr[param + GET_OFF(kh_count)]);
+    mov(reg_kw_count, ptr[param + GET_OFF(kw_count)]);
+    mov(reg_table, l_table);
+
+    for (int i_ur = 0; i_ur < ur_w_; ++i_ur) {
+        if (jcp.with_bias)
+            uni_vmovups(vmm_acc(i_ur), ptr[reg_bias]);
+        else
+            uni_vpxor(vmm_acc(i_ur), vmm_acc(i_ur), vmm_acc(i_ur));
+    }
+
+    // Either count is zero when the whole kernel is in the padding.
+    Label kh_loop, kw_loop, skip;
+    test(reg_kh, reg_kh);
+    jz(skip, T_NEAR);
+    test(reg_kw_count, reg_kw_count);
+    jz(skip, T_NEAR);
+
+    L(kh_loop);
+    {
+        mov(aux_src, reg_src);
+        mov(aux_wei, reg_wei);
+        mov(reg_kw, reg_kw_count);
+        L(kw_loop);
+        {
+            compute_kw();
+            add(aux_src, kw_src_step);
+            add(aux_wei, kw_wei_step);
+            dec(reg_kw);
+            jnz(kw_loop, T_NEAR);
+        }
+        add(reg_src, kh_src_step);
+        add(reg_wei, kh_wei_step);
+        dec(reg_kh);
+        jnz(kh_loop, T_NEAR);
+    }
+    L(skip);
+
+    for (auto &inj : eltwise_injectors_) {
+        inj->load_table_addr();
+        inj->compute_vector_range(0, ur_w_);
+    }
+
+    for (int i_ur = 0; i_ur < ur_w_; ++i_ur)
+        uni_vmovups(ptr[reg_dst + i_ur * oc * sizeof(float)], vmm_acc(i_ur));
+
+    postamble();
+
+    // vpermps indices: lane `l` of vector `icl` selects the input channel
+    // icl of the group of `l`
+    align(64);
+    L(l_table);
+    for (int icl = 0; icl < jcp.cpg; ++icl)
+        for (int l = 0; l < jcp.simd_w; ++l)
+            dd((l / jcp.cpg) * jcp.cpg + icl);
+
+    for (auto &inj : eltwise_injectors_)
+        inj->prepare_table();
+}
+
+template <cpu_isa_t isa>
+void jit_uni_group_convolution_fwd_t<isa>::pd_t::init_scratchpad() {
+    // the weights packed as [nb_g][kh][kw][icl][simd_w], where the lane
+    // `g_blk * cpg + ocl` holds the weight of the group g_blk of the vector
+    // and of its output channel ocl
+    auto scratchpad = scratchpad_registry().registrar();
+    scratchpad.template book<float>(key_conv_group_wei,
+            (size_t)jcp_.nb_g * jcp_.kh * jcp_.kw * jcp_.cpg * jcp_.simd_w);
+}
+
+template <cpu_isa_t isa>
+status_t jit_uni_group_convolution_fwd_t<isa>::init(engine_t *engine) {
+    const auto &jcp = pd()->jcp_;
+    const auto &po = pd()->attr()->post_ops_;
+
+    CHECK(safe_ptr_assign(kernel_, new kernel_t(jcp, po, jcp.ur_w)));
+    CHECK(kernel_->create_kernel());
+    if (jcp.ur_w_tail > 0) {
+        CHECK(safe_ptr_assign(
+                kernel_tail_, new kernel_t(jcp, po, jcp.ur_w_tail)));
+        CHECK(kernel_tail_->create_kernel());
+    }
+    CHECK(safe_ptr_assign(kernel_border_, new kernel_t(jcp, po, 1)));
+    return kernel_border_->create_kernel();
+}
+
+template <cpu_isa_t isa>
+status_t jit_uni_group_convolution_fwd_t<isa>::execute(
+        const exec_ctx_t &ctx) const {
+    auto src = CTX_IN_MEM(const float *, DNNL_ARG_SRC);
+    auto weights = CTX_IN_MEM(const float *, DNNL_ARG_WEIGHTS);
+    auto bias = CTX_IN_MEM(const float *, DNNL_ARG_BIAS);
+    auto dst = CTX_OUT_MEM(float *, DNNL_ARG_DST);
+
+    const auto &jcp = pd()->jcp_;
+    const memory_desc_wrapper weights_d(pd()->weights_md(0));
+
+    const dim_t KH = jcp.kh, KW = jcp.kw, cpg = jcp.cpg, simd_w = jcp.simd_w;
+    const dim_t IC = jcp.ngroups * cpg, OC = IC;
+    const dim_t wei_g_stride = KH * KW * cpg * simd_w;
+
+    float *wei = ctx.get_scratchpad_grantor().template get<float>(
+            key_conv_group_wei);
+    parallel_nd(jcp.nb_g, KH, KW, [&](dim_t gb, dim_t kh, dim_t kw) {
+        float *w = wei + ((gb * KH + kh) * KW + kw) * cpg * simd_w;
+        for_(dim_t icl = 0; icl < cpg; ++icl)
+        for (dim_t l = 0; l < simd_w; ++l) {
+            const dim_t g = gb * jcp.g_block + l / cpg, ocl = l % cpg;
+            w[icl * simd_w + l] = weights[weights_d.off(g, ocl, icl, kh, kw)];
+        }
+    });
+
+    parallel_nd(jcp.mb, jcp.nb_g, jcp.oh, [&](dim_t n, dim_t gb, dim_t oh) {
+        const dim_t ih0 = oh * jcp.stride_h - jcp.t_pad;
+        const dim_t dh = jcp.dilate_h + 1;
+        const dim_t kh_start = ih0 < 0 ? div_up(-ih0, dh) : 0;
+        const dim_t kh_end = jcp.ih - ih0 > 0
+                ? nstl::min(KH, div_up(jcp.ih - ih0, dh))
+                : 0;
+        const dim_t kh_count = nstl::max(kh_end - kh_start, dim_t(0));
+        const dim_t ih = ih0 + kh_start * dh;
+
+        const float *src_row
+                = src + (n * jcp.ih + ih) * jcp.iw * IC + gb * simd_w;
+        const float *wei_g
+                = wei + gb * wei_g_stride + kh_start * KW * cpg * simd_w;
+        float *dst_row = dst + (n * jcp.oh + oh) * jcp.ow * OC + gb * simd_w;
+        const float *bias_g = bias ? bias + gb * simd_w : nullptr;
+
+        auto ker = [&](const kernel_t *k, dim_t ow, dim_t kw_start,
+                           dim_t kw_count) {
+            const dim_t iw = ow * jcp.stride_w - jcp.l_pad
+                    + kw_start * (jcp.dilate_w + 1);
+            jit_group_conv_call_s p;
+            p.src = src_row + iw * IC;
+            p.wei = wei_g + kw_start * cpg * simd_w;
+            p.bias = bias_g;
+            p.dst = dst_row + ow * OC;
+            p.kh_count = kh_count;
+            p.kw_count = kw_count;
+            (*k)(&p);
+        };
+
+        auto ker_border = [&](dim_t ow) {
+            const dim_t iw0 = ow * jcp.stride_w - jcp.l_pad;
+            const dim_t dw = jcp.dilate_w + 1;
+            const dim_t kw_start = iw0 < 0 ? div_up(-iw0, dw) : 0;
+            const dim_t kw_end = jcp.iw - iw0 > 0
+                    ? nstl::min(KW, div_up(jcp.iw - iw0, dw))
+                    : 0;
+            ker(kernel_border_.get(), ow, kw_start,
+                    nstl::max(kw_end - kw_start, dim_t(0)));
+        };
+
+        dim_t ow = 0;
+        for (; ow < jcp.ow_start; ++ow)
+            ker_border(ow);
+        for (; ow + jcp.ur_w <= jcp.ow_end; ow += jcp.ur_w)
+            ker(kernel_.get(), ow, 0, KW);
+        if (jcp.ur_w_tail > 0) {
+            ker(kernel_tail_.get(), ow, 0, KW);
+            ow += jcp.ur_w_tail;
+        }
+        for (; ow < jcp.ow; ++ow)
+            ker_border(ow);
+    });
+
+    return status::success;
+}
+
+template struct jit_uni_group_conv_fwd_kernel_t<avx512_common>;
+template struct jit_uni_group_conv_fwd_kernel_t<avx2>;
+template struct jit_uni_group_convolution_fwd_t<avx512_common>;
+template struct jit_uni_group_convolution_fwd_t<avx2>;
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
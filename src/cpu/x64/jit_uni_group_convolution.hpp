@@ -0,0 +1,189 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_JIT_UNI_GROUP_CONVOLUTION_HPP
+#define CPU_X64_JIT_UNI_GROUP_CONVOLUTION_HPP
+
+#include <memory>
+#include <vector>
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+#include "common/type_helpers.hpp"
+
+#include "cpu/cpu_convolution_pd.hpp"
+#include "cpu/x64/cpu_isa_traits.hpp"
+#include "cpu/x64/injectors/jit_uni_eltwise_injector.hpp"
+#include "cpu/x64/jit_generator.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+struct jit_group_conv_conf_t {
+    int mb, ngroups, cpg; // the channels per group, the same for ic and oc
+    int ih, iw, oh, ow;
+    int kh, kw;
+    int stride_h, stride_w;
+    int t_pad, l_pad;
+    int dilate_h, dilate_w;
+    int simd_w;
+    int g_block; // groups per vector: simd_w / cpg
+    int nb_g; // vectors of groups
+    bool with_bias;
+    int ur_w; // outputs per call of the main kernel
+    int ur_w_tail; // outputs per call of the tail kernel, 0 if there is none
+    int ow_start, ow_end; // the outputs that use every kw
+};
+
+struct jit_group_conv_call_s {
+    const float *src; // input of the first output at (kh_start, kw_start)
+    const float *wei; // packed weights of the vector at (kh_start, kw_start)
+    const float *bias;
+    float *dst;
+    dim_t kh_count;
+    dim_t kw_count;
+};
+
+// Computes `ur_w` consecutive outputs of a vector of `g_block` groups with
+// few channels each. A vector of the channels last source holds the inputs
+// of all the groups of the vector, so the input channel `icl` of every
+// group is broadcast to the lanes of its output channels with a single
+// permutation and accumulated with a single FMA, instead of padding every
+// group to a full vector.
+template <cpu_isa_t isa>
+struct jit_uni_group_conv_fwd_kernel_t : public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_group_conv_fwd_kernel_t)
+
+    jit_uni_group_conv_fwd_kernel_t(const jit_group_conv_conf_t &ajcp,
+            const post_ops_t &post_ops, int ur_w);
+
+    static status_t init_conf(jit_group_conv_conf_t &jcp,
+            const convolution_desc_t &cd, const memory_desc_wrapper &src_d,
+            const memory_desc_wrapper &weights_d,
+            const memory_desc_wrapper &dst_d);
+
+    const jit_group_conv_conf_t jcp;
+
+private:
+    using Vmm = typename cpu_isa_traits<isa>::Vmm;
+    using reg64_t = const Xbyak::Reg64;
+
+    static constexpr int n_vregs = cpu_isa_traits<isa>::n_vregs;
+
+    const int ur_w_;
+
+    reg64_t param = abi_param1;
+    reg64_t reg_src = r8;
+    reg64_t reg_wei = r9;
+    reg64_t reg_dst = r10;
+    reg64_t reg_bias = r11;
+    reg64_t reg_kh = r12;
+    reg64_t reg_kw = r13;
+    reg64_t aux_src = r14;
+    reg64_t aux_wei = r15;
+    reg64_t reg_kw_count = rax;
+    reg64_t reg_table = rbx;
+    reg64_t reg_injector_table = rdx;
+
+    // The accumulators take the first registers, so that the eltwise
+    // post-ops can use the other ones once the accumulation is done.
+    Vmm vmm_acc(int i_ur) const { return Vmm(i_ur); }
+    Vmm vmm_perm = Vmm(n_vregs - 1);
+    Vmm vmm_wei = Vmm(n_vregs - 2);
+    Vmm vmm_src = Vmm(n_vregs - 3);
+
+    Xbyak::Label l_table;
+    std::vector<std::unique_ptr<jit_uni_eltwise_injector_f32<isa>>>
+            eltwise_injectors_;
+
+    void compute_kw();
+    void generate() override;
+};
+
+template <cpu_isa_t isa>
+struct jit_uni_group_convolution_fwd_t : public primitive_t {
+    using kernel_t = jit_uni_group_conv_fwd_kernel_t<isa>;
+
+    struct pd_t : public cpu_convolution_fwd_pd_t {
+        using cpu_convolution_fwd_pd_t::cpu_convolution_fwd_pd_t;
+
+        DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("jit_group:", isa, ""),
+                jit_uni_group_convolution_fwd_t);
+
+        status_t init(engine_t *engine) {
+            using namespace data_type;
+            using namespace format_tag;
+            using smask_t = primitive_attr_t::skip_mask_t;
+
+            VDISPATCH(mayiuse(isa), isa);
+            VDISPATCH(is_fwd(), prop_kind);
+            VDISPATCH(set_default_alg_kind(alg_kind::convolution_direct),
+                    alg_kind);
+            VDISPATCH(expect_data_types(f32, f32, f32, f32, f32), data_type);
+            VDISPATCH(attr()->has_default_values(smask_t::post_ops, f32),
+                    attr);
+            VDISPATCH(post_ops_ok(), post_ops);
+            VDISPATCH(!has_zero_dim_memory(), zero_dim);
+            VDISPATCH(ndims() == 4 && with_groups(), shape);
+            VDISPATCH(set_default_formats_common(nhwc, goihw, nhwc), format);
+
+            const memory_desc_wrapper src_d(src_md()), dst_d(dst_md()),
+                    weights_d(weights_md());
+            VDISPATCH(src_d.matches_tag(nhwc) && dst_d.matches_tag(nhwc)
+                            && weights_d.matches_tag(goihw),
+                    format);
+
+            CHECK(kernel_t::init_conf(jcp_, *desc(), src_d, weights_d, dst_d));
+            init_scratchpad();
+            return status::success;
+        }
+
+        jit_group_conv_conf_t jcp_;
+
+    private:
+        bool post_ops_ok() const {
+            const auto &po = attr()->post_ops_;
+            for (int i = 0; i < po.len(); i++)
+                if (!po.entry_[i].is_eltwise()) return false;
+            return true;
+        }
+
+        void init_scratchpad();
+    };
+
+    jit_uni_group_convolution_fwd_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    // the main kernel, the kernel of the remaining outputs that use every
+    // kw, and the kernel of the outputs that read the padding
+    std::unique_ptr<kernel_t> kernel_, kernel_tail_, kernel_border_;
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
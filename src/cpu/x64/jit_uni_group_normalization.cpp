@@ -0,0 +1,395 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <math.h>
+
+#include "common/dnnl_thread.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/x64/jit_uni_group_normalization.hpp"
+
+#define GET_OFF(field) offsetof(jit_gnorm_call_s, field)
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+using namespace dnnl::impl::data_type;
+using namespace dnnl::impl::format_tag;
+using namespace dnnl::impl::memory_tracking::names;
+using namespace dnnl::impl::utils;
+using namespace Xbyak;
+
+template <cpu_isa_t isa>
+void jit_uni_gnorm_kernel_base_t<isa>::prepare_tail_mask() {
+    if (jgp.c_tail == 0) return;
+    if (isa == avx512_core) {
+        mov(reg_tmp.cvt32(), (1 << jgp.c_tail) - 1);
+        kmovw(k_tail_mask, reg_tmp.cvt32());
+    } else {
+        vmovups(vmm_tail_mask, ptr[rip + l_tail_mask]);
+    }
+}
+
+template <cpu_isa_t isa>
+void jit_uni_gnorm_kernel_base_t<isa>::emit_tail_mask_table() {
+    if (jgp.c_tail == 0 || isa == avx512_core) return;
+    align(64);
+    L(l_tail_mask);
+    for (int i = 0; i < simd_w; i++)
+        dd(i < jgp.c_tail ? 0xffffffff : 0);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_gnorm_kernel_base_t<isa>::load(
+        const Vmm &vmm, const Address &addr, bool tail) {
+    if (!tail)
+        uni_vmovups(vmm, addr);
+    else if (isa == avx512_core)
+        vmovups(vmm | k_tail_mask | T_z, addr);
+    else
+        vmaskmovps(vmm, vmm_tail_mask, addr);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_gnorm_kernel_base_t<isa>::store(
+        const Address &addr, const Vmm &vmm, bool tail) {
+    if (!tail)
+        uni_vmovups(addr, vmm);
+    else if (isa == avx512_core)
+        vmovups(addr | k_tail_mask, vmm);
+    else
+        vmaskmovps(addr, vmm_tail_mask, vmm);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_gnorm_stat_kernel_t<isa>::generate() {
+    const int row_size = (int)(this->jgp.C * sizeof(float));
+    const int nvecs = this->nvecs();
+    const int unroll = this->jgp.stat_unroll;
+
+    this->preamble();
+
+    this->mov(this->reg_src, this->ptr[this->param + GET_OFF(src)]);
+    this->mov(reg_sum, this->ptr[this->param + GET_OFF(sum)]);
+    this->mov(reg_sumsq, this->ptr[this->param + GET_OFF(sumsq)]);
+    this->mov(this->reg_len, this->ptr[this->param + GET_OFF(len)]);
+    this->prepare_tail_mask();
+
+    // The sums and the sums of squares are accumulated together, so the
+    // statistics take a single pass over the data.
+    for (int v0 = 0; v0 < nvecs; v0 += unroll) {
+        const int ur = nstl::min(unroll, nvecs - v0);
+        for (int u = 0; u < ur; u++) {
+            this->uni_vpxor(vmm_sum(u), vmm_sum(u), vmm_sum(u));
+            this->uni_vpxor(vmm_sumsq(u), vmm_sumsq(u), vmm_sumsq(u));
+        }
+
+        Label loop_label, exit_label;
+        this->mov(this->reg_src_ptr, this->reg_src);
+        this->mov(this->reg_cnt, this->reg_len);
+        this->test(this->reg_cnt, this->reg_cnt);
+        this->jz(exit_label, this->T_NEAR);
+        this->L(loop_label);
+        for (int u = 0; u < ur; u++) {
+            const int off = (v0 + u) * this->simd_w * sizeof(float);
+            this->load(vmm_src(u), this->ptr[this->reg_src_ptr + off],
+                    this->is_tail(v0 + u));
+            this->uni_vaddps(vmm_sum(u), vmm_sum(u), vmm_src(u));
+            this->uni_vfmadd231ps(vmm_sumsq(u), vmm_src(u), vmm_src(u));
+        }
+        this->add(this->reg_src_ptr, row_size);
+        this->dec(this->reg_cnt);
+        this->jnz(loop_label, this->T_NEAR);
+        this->L(exit_label);
+
+        // the sum arrays are padded to full vectors
+        for (int u = 0; u < ur; u++) {
+            const int off = (v0 + u) * this->simd_w * sizeof(float);
+            this->uni_vaddps(vmm_sum(u), vmm_sum(u), this->ptr[reg_sum + off]);
+            this->uni_vmovups(this->ptr[reg_sum + off], vmm_sum(u));
+            this->uni_vaddps(
+                    vmm_sumsq(u), vmm_sumsq(u), this->ptr[reg_sumsq + off]);
+            this->uni_vmovups(this->ptr[reg_sumsq + off], vmm_sumsq(u));
+        }
+    }
+
+    this->postamble();
+    this->emit_tail_mask_table();
+}
+
+template <cpu_isa_t isa>
+jit_uni_gnorm_data_kernel_t<isa>::jit_uni_gnorm_data_kernel_t(
+        const jit_gnorm_conf_t &ajgp, const post_ops_t &post_ops)
+    : jit_uni_gnorm_kernel_base_t<isa>(ajgp) {
+    if (this->jgp.with_eltwise)
+        eltwise_injector_.reset(new jit_uni_eltwise_injector_f32<isa>(this,
+                post_ops.entry_[0].eltwise, false, reg_injector_table,
+                Opmask(1), true, false, this->jgp.fast_math));
+}
+
+template <cpu_isa_t isa>
+void jit_uni_gnorm_data_kernel_t<isa>::generate() {
+    const int row_size = (int)(this->jgp.C * sizeof(float));
+    const int nvecs = this->nvecs();
+    const int unroll = this->jgp.data_unroll;
+
+    this->preamble();
+
+    if (eltwise_injector_) eltwise_injector_->load_table_addr();
+    this->mov(this->reg_src, this->ptr[this->param + GET_OFF(src)]);
+    this->mov(reg_dst, this->ptr[this->param + GET_OFF(dst)]);
+    this->mov(reg_scale, this->ptr[this->param + GET_OFF(scale)]);
+    this->mov(reg_shift, this->ptr[this->param + GET_OFF(shift)]);
+    this->mov(this->reg_len, this->ptr[this->param + GET_OFF(len)]);
+    this->prepare_tail_mask();
+
+    // The mean, the variance and gamma and beta are folded by the caller
+    // into a per channel scale and shift, so that a normalized value takes
+    // a single fma before the eltwise post-op.
+    for (int v0 = 0; v0 < nvecs; v0 += unroll) {
+        const int ur = nstl::min(unroll, nvecs - v0);
+        for (int u = 0; u < ur; u++) {
+            const int off = (v0 + u) * this->simd_w * sizeof(float);
+            this->uni_vmovups(vmm_scale(u), this->ptr[reg_scale + off]);
+            this->uni_vmovups(vmm_shift(u), this->ptr[reg_shift + off]);
+        }
+
+        Label loop_label, exit_label;
+        this->mov(this->reg_src_ptr, this->reg_src);
+        this->mov(reg_dst_ptr, reg_dst);
+        this->mov(this->reg_cnt, this->reg_len);
+        this->test(this->reg_cnt, this->reg_cnt);
+        this->jz(exit_label, this->T_NEAR);
+        this->L(loop_label);
+        for (int u = 0; u < ur; u++) {
+            const int off = (v0 + u) * this->simd_w * sizeof(float);
+            this->load(vmm_data(u), this->ptr[this->reg_src_ptr + off],
+                    this->is_tail(v0 + u));
+            this->uni_vfmadd213ps(vmm_data(u), vmm_scale(u), vmm_shift(u));
+        }
+        if (eltwise_injector_)
+            eltwise_injector_->compute_vector_range(
+                    vmm_data(0).getIdx(), vmm_data(ur).getIdx());
+        for (int u = 0; u < ur; u++) {
+            const int off = (v0 + u) * this->simd_w * sizeof(float);
+            this->store(this->ptr[reg_dst_ptr + off], vmm_data(u),
+                    this->is_tail(v0 + u));
+        }
+        this->add(this->reg_src_ptr, row_size);
+        this->add(reg_dst_ptr, row_size);
+        this->dec(this->reg_cnt);
+        this->jnz(loop_label, this->T_NEAR);
+        this->L(exit_label);
+    }
+
+    this->postamble();
+    if (eltwise_injector_) eltwise_injector_->prepare_table();
+    this->emit_tail_mask_table();
+}
+
+template <cpu_isa_t isa>
+status_t jit_uni_group_normalization_fwd_t<isa>::pd_t::init(
+        engine_t *engine) {
+    constexpr int simd_w = jit_uni_gnorm_kernel_base_t<isa>::simd_w;
+
+    const bool ok = mayiuse(isa) && is_fwd() && !has_zero_dim_memory()
+            && everyone_is(f32, src_md()->data_type, dst_md()->data_type,
+                    stat_md()->data_type)
+            && check_scale_shift_data_type() && attr_eltwise_ok()
+            && memory_desc_matches_one_of_tag(
+                    *src_md(), nc, nwc, nhwc, ndhwc)
+            && C() * sizeof(float) <= INT_MAX;
+    if (!ok) return status::unimplemented;
+
+    const int n_vregs = cpu_isa_traits<isa>::n_vregs;
+    const int max_unroll = 8;
+    const auto &po = attr()->post_ops_;
+
+    jgp_.C = C();
+    jgp_.c_tail = C() % simd_w;
+    // one vector register is kept for the avx2 tail mask
+    jgp_.stat_unroll = nstl::min(max_unroll, (n_vregs - 1) / 3);
+    jgp_.data_unroll = nstl::min(max_unroll,
+            (n_vregs - 1 - jit_uni_gnorm_data_kernel_t<isa>::n_injector_vregs)
+                    / 3);
+    jgp_.with_eltwise = po.len() == 1;
+    jgp_.fast_math = attr()->fpmath_mode_ != fpmath_mode::strict;
+
+    // The spatial dimension is split so that every thread gets a part even
+    // for a small batch, but the parts stay large enough to amortize a
+    // kernel call.
+    const dim_t SP = D() * H() * W();
+    const dim_t min_chunk_size = 16 * 1024;
+    const dim_t max_nchunks_by_size = nstl::max<dim_t>(
+            1, SP * C() * (dim_t)sizeof(float) / min_chunk_size);
+    sp_nchunks_ = nstl::max<dim_t>(1,
+            nstl::min(nstl::min(SP, max_nchunks_by_size),
+                    div_up((dim_t)dnnl_get_max_threads(), MB())));
+
+    init_scratchpad();
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+void jit_uni_group_normalization_fwd_t<isa>::pd_t::init_scratchpad() {
+    constexpr int simd_w = jit_uni_gnorm_kernel_base_t<isa>::simd_w;
+    const dim_t C_padded = rnd_up(C(), simd_w);
+
+    auto scratchpad = scratchpad_registry().registrar();
+    if (!stats_are_src())
+        scratchpad.template book<float>(
+                key_gnorm_reduction, MB() * sp_nchunks_ * 2 * C_padded);
+    scratchpad.template book<float>(key_gnorm_scale_shift, MB() * 2 * C_padded);
+}
+
+template <cpu_isa_t isa>
+status_t jit_uni_group_normalization_fwd_t<isa>::init(engine_t *engine) {
+    const auto &jgp = pd()->jgp_;
+    if (!pd()->stats_are_src()) {
+        CHECK(safe_ptr_assign(
+                stat_kernel_, new jit_uni_gnorm_stat_kernel_t<isa>(jgp)));
+        CHECK(stat_kernel_->create_kernel());
+    }
+    CHECK(safe_ptr_assign(data_kernel_,
+            new jit_uni_gnorm_data_kernel_t<isa>(
+                    jgp, pd()->attr()->post_ops_)));
+    return data_kernel_->create_kernel();
+}
+
+template <cpu_isa_t isa>
+status_t jit_uni_group_normalization_fwd_t<isa>::execute(
+        const exec_ctx_t &ctx) const {
+    constexpr int simd_w = jit_uni_gnorm_kernel_base_t<isa>::simd_w;
+
+    auto src = CTX_IN_MEM(const float *, DNNL_ARG_SRC);
+    auto dst = CTX_OUT_MEM(float *, DNNL_ARG_DST);
+    auto scaleshift = CTX_IN_MEM(const float *, DNNL_ARG_SCALE_SHIFT);
+
+    auto mean = pd()->stats_are_src()
+            ? const_cast<float *>(CTX_IN_MEM(const float *, DNNL_ARG_MEAN))
+            : CTX_OUT_MEM(float *, DNNL_ARG_MEAN);
+    auto variance = pd()->stats_are_src()
+            ? const_cast<float *>(CTX_IN_MEM(const float *, DNNL_ARG_VARIANCE))
+            : CTX_OUT_MEM(float *, DNNL_ARG_VARIANCE);
+
+    const auto scratchpad = ctx.get_scratchpad_grantor();
+    auto reduction = scratchpad.template get<float>(key_gnorm_reduction);
+    auto scale_shift = scratchpad.template get<float>(key_gnorm_scale_shift);
+
+    const memory_desc_wrapper data_d(pd()->src_md());
+    src += data_d.offset0();
+    dst += data_d.offset0();
+
+    const dim_t N = pd()->MB();
+    const dim_t C = pd()->C();
+    const dim_t G = pd()->G();
+    const dim_t Cg = pd()->group_size();
+    const dim_t SP = pd()->D() * pd()->H() * pd()->W();
+    const dim_t C_padded = rnd_up(C, simd_w);
+    const dim_t nchunks = pd()->sp_nchunks_;
+
+    const float eps = pd()->desc()->group_norm_epsilon;
+    const bool use_scaleshift = pd()->use_scaleshift();
+    const bool calculate_stats = !pd()->stats_are_src();
+    const bool save_stats = pd()->is_training();
+
+    if (calculate_stats) {
+        parallel_nd(N, nchunks, [&](dim_t n, dim_t k) {
+            dim_t sp_start {0}, sp_end {0};
+            balance211(SP, nchunks, k, sp_start, sp_end);
+            float *sum = reduction + (n * nchunks + k) * 2 * C_padded;
+            array_set(sum, 0, 2 * C_padded);
+
+            auto arg = jit_gnorm_call_s();
+            arg.src = src + (n * SP + sp_start) * C;
+            arg.sum = sum;
+            arg.sumsq = sum + C_padded;
+            arg.len = sp_end - sp_start;
+            (*stat_kernel_)(&arg);
+        });
+    }
+
+    parallel_nd(N, G, [&](dim_t n, dim_t g) {
+        const dim_t s_off = n * G + g;
+        const dim_t c_start = g * Cg;
+
+        float v_mean, v_variance;
+        if (calculate_stats) {
+            double sum = 0, sumsq = 0;
+            for (dim_t k = 0; k < nchunks; k++) {
+                const float *r = reduction + (n * nchunks + k) * 2 * C_padded;
+                for (dim_t c = c_start; c < c_start + Cg; c++) {
+                    sum += r[c];
+                    sumsq += r[C_padded + c];
+                }
+            }
+            const double group_nelems = (double)(Cg * SP);
+            const double m = sum / group_nelems;
+            v_mean = (float)m;
+            v_variance = (float)nstl::max(0., sumsq / group_nelems - m * m);
+            if (save_stats) {
+                mean[s_off] = v_mean;
+                variance[s_off] = v_variance;
+            }
+        } else {
+            v_mean = mean[s_off];
+            v_variance = variance[s_off];
+        }
+
+        const float inv_sqrtvar = 1.f / sqrtf(v_variance + eps);
+        float *scale = scale_shift + n * 2 * C_padded;
+        float *shift = scale + C_padded;
+        for (dim_t c = c_start; c < c_start + Cg; c++) {
+            const float gamma = use_scaleshift ? scaleshift[c] : 1.f;
+            const float beta = use_scaleshift ? scaleshift[C + c] : 0.f;
+            scale[c] = gamma * inv_sqrtvar;
+            shift[c] = beta - v_mean * scale[c];
+        }
+    });
+
+    parallel_nd(N, nchunks, [&](dim_t n, dim_t k) {
+        dim_t sp_start {0}, sp_end {0};
+        balance211(SP, nchunks, k, sp_start, sp_end);
+        const dim_t off = (n * SP + sp_start) * C;
+
+        auto arg = jit_gnorm_call_s();
+        arg.src = src + off;
+        arg.dst = dst + off;
+        arg.scale = scale_shift + n * 2 * C_padded;
+        arg.shift = arg.scale + C_padded;
+        arg.len = sp_end - sp_start;
+        (*data_kernel_)(&arg);
+    });
+
+    return status::success;
+}
+
+template struct jit_uni_gnorm_kernel_base_t<avx2>;
+template struct jit_uni_gnorm_kernel_base_t<avx512_core>;
+template struct jit_uni_gnorm_stat_kernel_t<avx2>;
+template struct jit_uni_gnorm_stat_kernel_t<avx512_core>;
+template struct jit_uni_gnorm_data_kernel_t<avx2>;
+template struct jit_uni_gnorm_data_kernel_t<avx512_core>;
+template struct jit_uni_group_normalization_fwd_t<avx2>;
+template struct jit_uni_group_normalization_fwd_t<avx512_core>;
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,187 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_JIT_UNI_GROUP_NORMALIZATION_HPP
+#define CPU_X64_JIT_UNI_GROUP_NORMALIZATION_HPP
+
+#include <memory>
+
+#include "common/c_types_map.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/primitive.hpp"
+
+#include "cpu/cpu_group_normalization_pd.hpp"
+#include "cpu/x64/cpu_isa_traits.hpp"
+#include "cpu/x64/injectors/jit_uni_eltwise_injector.hpp"
+#include "cpu/x64/jit_generator.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+struct jit_gnorm_conf_t {
+    dim_t C; /* number of channels, also the distance between two rows */
+    int c_tail; /* channels in the last partial vector of a row */
+    int stat_unroll; /* number of vectors of a row accumulated at once */
+    int data_unroll; /* number of vectors of a row normalized at once */
+    bool with_eltwise;
+    bool fast_math;
+};
+
+struct jit_gnorm_call_s {
+    const float *src;
+    float *dst;
+    float *sum; /* per channel sums, accumulated by the statistics kernel */
+    float *sumsq; /* per channel sums of squares */
+    const float *scale; /* per channel multiplier, used by the data kernel */
+    const float *shift; /* per channel addend, used by the data kernel */
+    dim_t len; /* number of rows, i.e. spatial points */
+};
+
+// Both kernels process `len` consecutive rows of `C` channels of a channels
+// last tensor. The channels are processed by blocks of vectors kept in
+// registers while the rows are walked, so that the per channel values are
+// loaded and stored once per call.
+template <cpu_isa_t isa>
+struct jit_uni_gnorm_kernel_base_t : public jit_generator {
+    jit_uni_gnorm_kernel_base_t(const jit_gnorm_conf_t &ajgp) : jgp(ajgp) {}
+
+    const jit_gnorm_conf_t jgp;
+
+    static constexpr int simd_w = cpu_isa_traits<isa>::vlen / sizeof(float);
+
+protected:
+    using Vmm = typename cpu_isa_traits<isa>::Vmm;
+    using reg64_t = const Xbyak::Reg64;
+
+    reg64_t param = abi_param1;
+    reg64_t reg_src = r8;
+    reg64_t reg_len = r12;
+    reg64_t reg_src_ptr = r13;
+    reg64_t reg_cnt = rdx;
+    reg64_t reg_tmp = rbx;
+
+    // The tail mask lives in the last vector register on avx2, away from
+    // the low registers taken by the eltwise injector.
+    Vmm vmm_tail_mask = Vmm(cpu_isa_traits<isa>::n_vregs - 1);
+    Xbyak::Opmask k_tail_mask = Xbyak::Opmask(2);
+    Xbyak::Label l_tail_mask;
+
+    int nvecs() const { return utils::div_up(jgp.C, simd_w); }
+    bool is_tail(int vec) const {
+        return jgp.c_tail != 0 && vec == nvecs() - 1;
+    }
+
+    void prepare_tail_mask();
+    void emit_tail_mask_table();
+    void load(const Vmm &vmm, const Xbyak::Address &addr, bool tail);
+    void store(const Xbyak::Address &addr, const Vmm &vmm, bool tail);
+};
+
+template <cpu_isa_t isa>
+struct jit_uni_gnorm_stat_kernel_t : public jit_uni_gnorm_kernel_base_t<isa> {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_gnorm_stat_kernel_t)
+
+    using jit_uni_gnorm_kernel_base_t<isa>::jit_uni_gnorm_kernel_base_t;
+
+private:
+    using base_t = jit_uni_gnorm_kernel_base_t<isa>;
+    using typename base_t::Vmm;
+    using typename base_t::reg64_t;
+
+    reg64_t reg_sum = Xbyak::util::r9;
+    reg64_t reg_sumsq = Xbyak::util::r10;
+
+    Vmm vmm_src(int u) const { return Vmm(3 * u); }
+    Vmm vmm_sum(int u) const { return Vmm(3 * u + 1); }
+    Vmm vmm_sumsq(int u) const { return Vmm(3 * u + 2); }
+
+    void generate() override;
+};
+
+template <cpu_isa_t isa>
+struct jit_uni_gnorm_data_kernel_t : public jit_uni_gnorm_kernel_base_t<isa> {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_gnorm_data_kernel_t)
+
+    jit_uni_gnorm_data_kernel_t(
+            const jit_gnorm_conf_t &ajgp, const post_ops_t &post_ops);
+
+    // The eltwise injector takes its auxiliary registers from the lowest
+    // indices, which are not used by the kernel otherwise.
+    enum { n_injector_vregs = 5 };
+
+private:
+    using base_t = jit_uni_gnorm_kernel_base_t<isa>;
+    using typename base_t::Vmm;
+    using typename base_t::reg64_t;
+
+    reg64_t reg_dst = Xbyak::util::r9;
+    reg64_t reg_scale = Xbyak::util::r10;
+    reg64_t reg_shift = Xbyak::util::r11;
+    reg64_t reg_dst_ptr = Xbyak::util::r14;
+    reg64_t reg_injector_table = Xbyak::util::rax;
+
+    Vmm vmm_data(int u) const { return Vmm(n_injector_vregs + u); }
+    Vmm vmm_scale(int u) const {
+        return Vmm(n_injector_vregs + this->jgp.data_unroll + u);
+    }
+    Vmm vmm_shift(int u) const {
+        return Vmm(n_injector_vregs + 2 * this->jgp.data_unroll + u);
+    }
+
+    std::unique_ptr<jit_uni_eltwise_injector_f32<isa>> eltwise_injector_;
+
+    void generate() override;
+};
+
+template <cpu_isa_t isa>
+struct jit_uni_group_normalization_fwd_t : public primitive_t {
+    struct pd_t : public cpu_group_normalization_fwd_pd_t {
+        using cpu_group_normalization_fwd_pd_t::
+                cpu_group_normalization_fwd_pd_t;
+
+        DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("jit:", isa, ""),
+                jit_uni_group_normalization_fwd_t);
+
+        status_t init(engine_t *engine);
+
+        jit_gnorm_conf_t jgp_;
+        dim_t sp_nchunks_; /* number of parts a spatial dimension is split to */
+
+    private:
+        void init_scratchpad();
+    };
+
+    jit_uni_group_normalization_fwd_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    std::unique_ptr<jit_uni_gnorm_stat_kernel_t<isa>> stat_kernel_;
+    std::unique_ptr<jit_uni_gnorm_data_kernel_t<isa>> data_kernel_;
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
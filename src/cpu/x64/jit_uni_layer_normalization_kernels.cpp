@@ -54,7 +54,7 @@ jit_transfer_t<f32>::jit_transfer_t(jit_generator &gen, const int simd_w)
 
 template <>
 struct jit_transfer_t<bf16> : jit_transfer_t<f32> {
-    jit_transfer_t(jit_generator &gen);
+    jit_transfer_t(jit_generator &gen, const int simd_w = 16);
 
     template <data_type_t load_data_type>
     void load(Zmm &zmm_src, Reg64 reg_src, int nelems, size_t offt_elems);
@@ -73,8 +73,8 @@ private:
     std::unique_ptr<bf16_emulation_t> bf16_emu_;
 };
 
-jit_transfer_t<bf16>::jit_transfer_t(jit_generator &gen)
-    : jit_transfer_t<f32>(gen, 16 /* simd_w_ */)
+jit_transfer_t<bf16>::jit_transfer_t(jit_generator &gen, const int simd_w)
+    : jit_transfer_t<f32>(gen, simd_w)
     , emulate_bf16_ {!mayiuse(avx512_core_bf16)} {
     if (emulate_bf16_) {
         this->bf16_emu_ = utils::make_unique<bf16_emulation_t>(&this->gen_,
@@ -161,7 +161,7 @@ void jit_transfer_t<bf16>::store<bf16>(
         assert(!"unsupported nelems");
 }
 
-template <data_type_t data_type>
+template <data_type_t data_type, cpu_isa_t isa>
 struct jit_statistics_kernel_t : statistics_kernel_t<data_type>,
                                  public jit_generator {
     DECLARE_CPU_JIT_AUX_FUNCTIONS(lnorm_utils::jit_statistics_kernel_t);
@@ -169,19 +169,21 @@ struct jit_statistics_kernel_t : statistics_kernel_t<data_type>,
     jit_statistics_kernel_t(const layer_normalization_pd_t *pd);
 
     using data_t = typename prec_traits<data_type>::type;
-    void operator()(const data_t *src, float *mean, float *var) const override;
+    void operator()(const data_t *src, const data_t *src_1, float *mean,
+            float *var) const override;
     status_t create_kernel() override { return jit_generator::create_kernel(); }
 
 private:
     jit_transfer_t<data_type> jit_transfer_;
     static constexpr int unroll_factor_ = 8;
-    static constexpr int simd_w = data_type == bf16 ? 16 : 8;
+    static constexpr int simd_w = cpu_isa_traits<isa>::vlen / sizeof(float);
     using statistics_kernel_t<data_type>::C_;
-    using Vmm = typename utils::conditional<data_type == bf16, Xbyak::Zmm,
-            Xbyak::Ymm>::type;
+    using statistics_kernel_t<data_type>::fuse_residual_add_;
+    using Vmm = typename cpu_isa_traits<isa>::Vmm;
 
     struct ker_args_t {
         const data_t *src;
+        const data_t *src_1;
         float *mean;
         float *var;
     };
@@ -190,43 +192,48 @@ private:
     template <typename F>
     void compute(F op);
 
+    void load_src(int nelems, size_t offt_elems);
     void reduce();
 
     Xbyak::Reg64 reg_param = abi_param1;
     Xbyak::Reg64 reg_src = rdx;
+    Xbyak::Reg64 reg_src_1 = r8;
     Xbyak::Reg64 reg_mean = rbx;
     Xbyak::Reg64 reg_var = rbp;
     Xbyak::Reg64 reg_tmp = rax;
 
     // vector registers 0 .. unroll_factor_ are reseved for unrolling
+    Vmm vmm_res = Vmm(13);
     Vmm vmm_src = Vmm(14);
     Vmm vmm_mean = Vmm(15);
 };
 
-template <data_type_t data_type>
-jit_statistics_kernel_t<data_type>::jit_statistics_kernel_t(
+template <data_type_t data_type, cpu_isa_t isa>
+jit_statistics_kernel_t<data_type, isa>::jit_statistics_kernel_t(
         const layer_normalization_pd_t *pd)
-    : statistics_kernel_t<data_type>(pd), jit_transfer_ {*this} {
-    assert(data_type == bf16 ? mayiuse(avx512_core) : mayiuse(avx2));
+    : statistics_kernel_t<data_type>(pd), jit_transfer_ {*this, simd_w} {
+    assert(mayiuse(isa));
 }
 
-template <data_type_t data_type>
-void jit_statistics_kernel_t<data_type>::operator()(
-        const data_t *src, float *mean, float *var) const {
+template <data_type_t data_type, cpu_isa_t isa>
+void jit_statistics_kernel_t<data_type, isa>::operator()(const data_t *src,
+        const data_t *src_1, float *mean, float *var) const {
     ker_args_t args;
     args.src = src;
+    args.src_1 = src_1;
     args.mean = mean;
     args.var = var;
     jit_generator::operator()(&args);
 }
 
-template <data_type_t data_type>
-void jit_statistics_kernel_t<data_type>::generate() {
+template <data_type_t data_type, cpu_isa_t isa>
+void jit_statistics_kernel_t<data_type, isa>::generate() {
     using namespace Xbyak;
 
     preamble();
 #define PARAM_OFF(x) offsetof(ker_args_t, x)
     mov(reg_src, ptr[reg_param + PARAM_OFF(src)]);
+    if (fuse_residual_add_) mov(reg_src_1, ptr[reg_param + PARAM_OFF(src_1)]);
     mov(reg_mean, ptr[reg_param + PARAM_OFF(mean)]);
     mov(reg_var, ptr[reg_param + PARAM_OFF(var)]);
 #undef PARAM_OFF
@@ -246,9 +253,9 @@ void jit_statistics_kernel_t<data_type>::generate() {
     postamble();
 }
 
-template <data_type_t data_type>
+template <data_type_t data_type, cpu_isa_t isa>
 template <typename F>
-void jit_statistics_kernel_t<data_type>::compute(F op) {
+void jit_statistics_kernel_t<data_type, isa>::compute(F op) {
     const int C_vecs = C_ / simd_w;
 
     uni_vpxor(Vmm(0), Vmm(0), Vmm(0));
@@ -262,8 +269,7 @@ void jit_statistics_kernel_t<data_type>::compute(F op) {
         // unrolled loop
         for (int i = 0; i < C_vecs / unroll; i++)
             for (int j = 0; j < unroll; j++) {
-                jit_transfer_.template load<data_type>(
-                        vmm_src, reg_src, simd_w, (i * unroll + j) * simd_w);
+                load_src(simd_w, (i * unroll + j) * simd_w);
                 op(Vmm(j));
             }
 
@@ -277,8 +283,7 @@ void jit_statistics_kernel_t<data_type>::compute(F op) {
 
         // unrolled loop remainder
         for (int i = utils::rnd_dn(C_vecs, unroll); i < C_vecs; i++) {
-            jit_transfer_.template load<data_type>(
-                    vmm_src, reg_src, simd_w, i * simd_w);
+            load_src(simd_w, i * simd_w);
             op(Vmm(0));
         }
 
@@ -288,7 +293,7 @@ void jit_statistics_kernel_t<data_type>::compute(F op) {
 
     // vector remainder
     for (int i = utils::rnd_dn(C_, simd_w); i < C_; i++) {
-        jit_transfer_.template load<data_type>(vmm_src, reg_src, 1, i);
+        load_src(1, i);
         op(Vmm(0));
     }
 
@@ -299,20 +304,25 @@ void jit_statistics_kernel_t<data_type>::compute(F op) {
     vdivss(Xmm(0), Xmm(0), xmm_tmp);
 };
 
-template <>
-void jit_statistics_kernel_t<bf16>::reduce() {
-    Ymm ymm_high = Ymm(1);
-    vextractf32x8(ymm_high, Zmm(0), 1);
-    vaddps(Ymm(0), ymm_high, Ymm(0));
-    vhaddps(Ymm(0), Ymm(0), Ymm(0));
-    vhaddps(Ymm(0), Ymm(0), Ymm(0));
-    Xmm xmm_high = Xmm(1);
-    vextractf128(xmm_high, Ymm(0), 1);
-    vaddps(Xmm(0), xmm_high, Xmm(0));
+template <data_type_t data_type, cpu_isa_t isa>
+void jit_statistics_kernel_t<data_type, isa>::load_src(
+        int nelems, size_t offt_elems) {
+    jit_transfer_.template load<data_type>(
+            vmm_src, reg_src, nelems, offt_elems);
+    if (fuse_residual_add_) {
+        jit_transfer_.template load<data_type>(
+                vmm_res, reg_src_1, nelems, offt_elems);
+        vaddps(vmm_src, vmm_src, vmm_res);
+    }
 }
 
-template <>
-void jit_statistics_kernel_t<f32>::reduce() {
+template <data_type_t data_type, cpu_isa_t isa>
+void jit_statistics_kernel_t<data_type, isa>::reduce() {
+    if (isa == avx512_core) {
+        Ymm ymm_high = Ymm(1);
+        vextractf32x8(ymm_high, Zmm(0), 1);
+        vaddps(Ymm(0), ymm_high, Ymm(0));
+    }
     Xmm xmm_high = Xmm(1);
     vextractf128(xmm_high, Ymm(0), 1);
     vaddps(Xmm(0), xmm_high, Xmm(0));
@@ -320,30 +330,33 @@ void jit_statistics_kernel_t<f32>::reduce() {
     vhaddps(Xmm(0), Xmm(0), Xmm(0));
 }
 
-template <data_type_t data_type>
+template <data_type_t data_type, cpu_isa_t isa>
 struct jit_data_kernel_t : data_kernel_t<data_type>, public jit_generator {
     DECLARE_CPU_JIT_AUX_FUNCTIONS(lnorm_utils::jit_data_kernel_t);
 
     jit_data_kernel_t(const layer_normalization_pd_t *pd);
 
     using data_t = typename prec_traits<data_type>::type;
-    void operator()(const data_t *src, data_t *dst, const float *ss,
-            const float *mean, const float *var) const override;
+    void operator()(const data_t *src, const data_t *src_1, data_t *dst,
+            data_t *dst_1, const float *ss, const float *mean,
+            const float *var) const override;
 
     status_t create_kernel() override { return jit_generator::create_kernel(); }
 
 private:
     jit_transfer_t<data_type> jit_transfer_;
-    static constexpr int simd_w = data_type == bf16 ? 16 : 8;
-    using Vmm = typename utils::conditional<data_type == bf16, Xbyak::Zmm,
-            Xbyak::Ymm>::type;
+    static constexpr int simd_w = cpu_isa_traits<isa>::vlen / sizeof(float);
+    using Vmm = typename cpu_isa_traits<isa>::Vmm;
     using data_kernel_t<data_type>::C_;
     using data_kernel_t<data_type>::eps_;
     using data_kernel_t<data_type>::use_scaleshift_;
+    using data_kernel_t<data_type>::fuse_residual_add_;
 
     struct ker_args_t {
         const data_t *src;
+        const data_t *src_1;
         data_t *dst;
+        data_t *dst_1;
         const float *ss;
         const float *mean;
         const float *inv_sqrtvar;
@@ -356,7 +369,10 @@ private:
     Xbyak::Reg64 reg_dst = rax;
     Xbyak::Reg64 reg_ss = r9;
     Xbyak::Reg64 reg_tmp = r8;
+    Xbyak::Reg64 reg_src_1 = r10;
+    Xbyak::Reg64 reg_dst_1 = r11;
 
+    Vmm vmm_res = Vmm(9);
     Vmm vmm_inv_sqrtvar = Vmm(10);
     Vmm vmm_data = Vmm(11);
     Vmm vmm_gamma = Vmm(12);
@@ -365,19 +381,22 @@ private:
     Vmm vmm_mean = Vmm(15);
 };
 
-template <data_type_t data_type>
-jit_data_kernel_t<data_type>::jit_data_kernel_t(
+template <data_type_t data_type, cpu_isa_t isa>
+jit_data_kernel_t<data_type, isa>::jit_data_kernel_t(
         const layer_normalization_pd_t *pd)
-    : data_kernel_t<data_type>(pd), jit_transfer_ {*this} {
-    assert(data_type == bf16 ? mayiuse(avx512_core) : mayiuse(avx2));
+    : data_kernel_t<data_type>(pd), jit_transfer_ {*this, simd_w} {
+    assert(mayiuse(isa));
 }
 
-template <data_type_t data_type>
-void jit_data_kernel_t<data_type>::operator()(const data_t *src, data_t *dst,
-        const float *ss, const float *mean, const float *var) const {
+template <data_type_t data_type, cpu_isa_t isa>
+void jit_data_kernel_t<data_type, isa>::operator()(const data_t *src,
+        const data_t *src_1, data_t *dst, data_t *dst_1, const float *ss,
+        const float *mean, const float *var) const {
     ker_args_t args;
     args.src = src;
+    args.src_1 = src_1;
     args.dst = dst;
+    args.dst_1 = dst_1;
     args.ss = ss;
     args.mean = mean;
 #ifdef __INTEL_COMPILER
@@ -392,13 +411,17 @@ void jit_data_kernel_t<data_type>::operator()(const data_t *src, data_t *dst,
     jit_generator::operator()(&args);
 }
 
-template <data_type_t data_type>
-void jit_data_kernel_t<data_type>::generate() {
+template <data_type_t data_type, cpu_isa_t isa>
+void jit_data_kernel_t<data_type, isa>::generate() {
     preamble();
 #define PARAM_OFF(x) offsetof(ker_args_t, x)
     mov(reg_src, ptr[reg_param + PARAM_OFF(src)]);
     mov(reg_dst, ptr[reg_param + PARAM_OFF(dst)]);
     mov(reg_ss, ptr[reg_param + PARAM_OFF(ss)]);
+    if (fuse_residual_add_) {
+        mov(reg_src_1, ptr[reg_param + PARAM_OFF(src_1)]);
+        mov(reg_dst_1, ptr[reg_param + PARAM_OFF(dst_1)]);
+    }
 
     Xmm xmm_tmp = Xmm(vmm_tmp.getIdx());
     mov(reg_tmp, ptr[reg_param + PARAM_OFF(mean)]);
@@ -411,7 +434,7 @@ void jit_data_kernel_t<data_type>::generate() {
 #undef PARAM_OFF
     const int C_vecs = C_ / simd_w;
 
-    auto op = [=](int nelems, size_t offt_elems) {
+    auto op = [=](int nelems, size_t offt_elems, bool store_sum) {
         if (use_scaleshift_) {
             jit_transfer_.template load<f32>(
                     vmm_gamma, reg_ss, nelems, offt_elems);
@@ -420,6 +443,17 @@ void jit_data_kernel_t<data_type>::generate() {
         }
         jit_transfer_.template load<data_type>(
                 vmm_data, reg_src, nelems, offt_elems);
+        if (fuse_residual_add_) {
+            jit_transfer_.template load<data_type>(
+                    vmm_res, reg_src_1, nelems, offt_elems);
+            vaddps(vmm_data, vmm_data, vmm_res);
+            // the store may convert its register in place, hence the copy
+            if (store_sum) {
+                uni_vmovups(vmm_res, vmm_data);
+                jit_transfer_.template store<data_type>(
+                        vmm_res, reg_dst_1, nelems, offt_elems);
+            }
+        }
         vsubps(vmm_data, vmm_data, vmm_mean);
         vmulps(vmm_data, vmm_data, vmm_inv_sqrtvar);
         if (use_scaleshift_) vfmadd213ps(vmm_data, vmm_gamma, vmm_beta);
@@ -427,16 +461,32 @@ void jit_data_kernel_t<data_type>::generate() {
                 vmm_data, reg_dst, nelems, offt_elems);
     };
 
-    for (int i = 0; i < C_vecs; i++)
-        op(simd_w, i * simd_w);
+    auto compute = [=](bool store_sum) {
+        for (int i = 0; i < C_vecs; i++)
+            op(simd_w, i * simd_w, store_sum);
 
-    for (int i = utils::rnd_dn(C_, simd_w); i < C_; i++)
-        op(1, i);
+        for (int i = utils::rnd_dn(C_, simd_w); i < C_; i++)
+            op(1, i, store_sum);
+    };
+
+    if (fuse_residual_add_) {
+        // the sum is written out only if the user asked for it
+        Label no_sum, done;
+        test(reg_dst_1, reg_dst_1);
+        jz(no_sum, T_NEAR);
+        compute(true);
+        jmp(done, T_NEAR);
+        L(no_sum);
+        compute(false);
+        L(done);
+    } else {
+        compute(false);
+    }
 
     postamble();
 }
 
-template <data_type_t data_type>
+template <data_type_t data_type, cpu_isa_t isa>
 struct jit_diff_ss_kernel_t : diff_ss_kernel_t<data_type>,
                               public jit_generator {
     DECLARE_CPU_JIT_AUX_FUNCTIONS(lnorm_utils::jit_diff_ss_kernel_t);
@@ -452,9 +502,8 @@ struct jit_diff_ss_kernel_t : diff_ss_kernel_t<data_type>,
 
 private:
     jit_transfer_t<data_type> jit_transfer_;
-    static constexpr int simd_w = data_type == bf16 ? 16 : 8;
-    using Vmm = typename utils::conditional<data_type == bf16, Xbyak::Zmm,
-            Xbyak::Ymm>::type;
+    static constexpr int simd_w = cpu_isa_traits<isa>::vlen / sizeof(float);
+    using Vmm = typename cpu_isa_traits<isa>::Vmm;
     using diff_ss_kernel_t<data_type>::C_;
     using diff_ss_kernel_t<data_type>::eps_;
 
@@ -486,15 +535,15 @@ private:
     Vmm vmm_mean = Vmm(15);
 };
 
-template <data_type_t data_type>
-jit_diff_ss_kernel_t<data_type>::jit_diff_ss_kernel_t(
+template <data_type_t data_type, cpu_isa_t isa>
+jit_diff_ss_kernel_t<data_type, isa>::jit_diff_ss_kernel_t(
         const layer_normalization_pd_t *pd)
-    : diff_ss_kernel_t<data_type>(pd), jit_transfer_ {*this} {
-    assert(data_type == bf16 ? mayiuse(avx512_core) : mayiuse(avx2));
+    : diff_ss_kernel_t<data_type>(pd), jit_transfer_ {*this, simd_w} {
+    assert(mayiuse(isa));
 }
 
-template <data_type_t data_type>
-void jit_diff_ss_kernel_t<data_type>::operator()(const data_t *src,
+template <data_type_t data_type, cpu_isa_t isa>
+void jit_diff_ss_kernel_t<data_type, isa>::operator()(const data_t *src,
         const data_t *diff_dst, float *diff_gamma, float *diff_beta,
         const float *mean, const float *var) const {
     ker_args_t args;
@@ -515,8 +564,8 @@ void jit_diff_ss_kernel_t<data_type>::operator()(const data_t *src,
     jit_generator::operator()(&args);
 }
 
-template <data_type_t data_type>
-void jit_diff_ss_kernel_t<data_type>::generate() {
+template <data_type_t data_type, cpu_isa_t isa>
+void jit_diff_ss_kernel_t<data_type, isa>::generate() {
     preamble();
 #define PARAM_OFF(x) offsetof(ker_args_t, x)
     mov(reg_src, ptr[reg_param + PARAM_OFF(src)]);
@@ -562,7 +611,7 @@ void jit_diff_ss_kernel_t<data_type>::generate() {
     postamble();
 }
 
-template <data_type_t data_type>
+template <data_type_t data_type, cpu_isa_t isa>
 struct jit_diff_data_kernel_t : diff_data_kernel_t<data_type>,
                                 public jit_generator {
     DECLARE_CPU_JIT_AUX_FUNCTIONS(lnorm_utils::jit_diff_data_kernel_t);
@@ -578,9 +627,8 @@ struct jit_diff_data_kernel_t : diff_data_kernel_t<data_type>,
 
 private:
     jit_transfer_t<data_type> jit_transfer_;
-    static constexpr int simd_w = data_type == bf16 ? 16 : 8;
-    using Vmm = typename utils::conditional<data_type == bf16, Xbyak::Zmm,
-            Xbyak::Ymm>::type;
+    static constexpr int simd_w = cpu_isa_traits<isa>::vlen / sizeof(float);
+    using Vmm = typename cpu_isa_traits<isa>::Vmm;
     using diff_data_kernel_t<data_type>::C_;
     using diff_data_kernel_t<data_type>::eps_;
     using diff_data_kernel_t<data_type>::calculate_diff_stats_;
@@ -619,15 +667,15 @@ private:
     Vmm vmm_mean = Vmm(15);
 };
 
-template <data_type_t data_type>
-jit_diff_data_kernel_t<data_type>::jit_diff_data_kernel_t(
+template <data_type_t data_type, cpu_isa_t isa>
+jit_diff_data_kernel_t<data_type, isa>::jit_diff_data_kernel_t(
         const layer_normalization_pd_t *pd)
-    : diff_data_kernel_t<data_type>(pd), jit_transfer_ {*this} {
-    assert(data_type == bf16 ? mayiuse(avx512_core) : mayiuse(avx2));
+    : diff_data_kernel_t<data_type>(pd), jit_transfer_ {*this, simd_w} {
+    assert(mayiuse(isa));
 }
 
-template <data_type_t data_type>
-void jit_diff_data_kernel_t<data_type>::operator()(const data_t *src,
+template <data_type_t data_type, cpu_isa_t isa>
+void jit_diff_data_kernel_t<data_type, isa>::operator()(const data_t *src,
         const data_t *diff_dst, data_t *diff_src, const float *ss,
         const float *mean, const float *var) const {
     ker_args_t args;
@@ -648,8 +696,8 @@ void jit_diff_data_kernel_t<data_type>::operator()(const data_t *src,
     jit_generator::operator()(&args);
 }
 
-template <data_type_t data_type>
-void jit_diff_data_kernel_t<data_type>::generate() {
+template <data_type_t data_type, cpu_isa_t isa>
+void jit_diff_data_kernel_t<data_type, isa>::generate() {
     preamble();
 #define PARAM_OFF(x) offsetof(ker_args_t, x)
     mov(reg_src, ptr[reg_param + PARAM_OFF(src)]);
@@ -742,79 +790,85 @@ void jit_diff_data_kernel_t<data_type>::generate() {
     postamble();
 }
 
-template <>
-void jit_diff_data_kernel_t<f32>::reduce(
-        jit_diff_data_kernel_t<f32>::Vmm ymm_vec) {
-    vextractf128(xmm_tmp, ymm_vec, 1);
-    Xmm xmm_vec = Xmm(ymm_vec.getIdx());
+template <data_type_t data_type, cpu_isa_t isa>
+void jit_diff_data_kernel_t<data_type, isa>::reduce(Vmm vmm_vec) {
+    if (isa == avx512_core) {
+        Ymm ymm_high = Ymm(xmm_tmp.getIdx());
+        Ymm ymm_vec = Ymm(vmm_vec.getIdx());
+        vextractf32x8(ymm_high, Zmm(vmm_vec.getIdx()), 1);
+        vaddps(ymm_vec, ymm_high, ymm_vec);
+    }
+    Xmm xmm_vec = Xmm(vmm_vec.getIdx());
+    vextractf128(xmm_tmp, Ymm(vmm_vec.getIdx()), 1);
     vaddps(xmm_vec, xmm_tmp, xmm_vec);
     vhaddps(xmm_vec, xmm_vec, xmm_vec);
     vhaddps(xmm_vec, xmm_vec, xmm_vec);
-};
-
-template <>
-void jit_diff_data_kernel_t<bf16>::reduce(
-        jit_diff_data_kernel_t<bf16>::Vmm zmm_vec) {
-    Xbyak::Ymm ymm_high = Ymm(xmm_tmp.getIdx());
-
-    vextractf32x8(ymm_high, zmm_vec, 1);
-    Ymm ymm_vec = Ymm(zmm_vec.getIdx());
-    vaddps(ymm_vec, ymm_high, ymm_vec);
-    vhaddps(ymm_vec, ymm_vec, ymm_vec);
-    vhaddps(ymm_vec, ymm_vec, ymm_vec);
-
-    Xmm xmm_high = Xmm(ymm_high.getIdx());
-    Xmm xmm_vec = Xmm(zmm_vec.getIdx());
-    vextractf128(xmm_high, ymm_vec, 1);
-    vaddps(xmm_vec, xmm_high, xmm_vec);
-};
+}
 
 template <>
 statistics_kernel_t<bf16> *statistics_kernel_create(
         const layer_normalization_pd_t *pd) {
-    return mayiuse(avx512_core) ? new jit_statistics_kernel_t<bf16>(pd)
-                                : nullptr;
+    if (mayiuse(avx512_core))
+        return new jit_statistics_kernel_t<bf16, avx512_core>(pd);
+    return nullptr;
 }
 
 template <>
 statistics_kernel_t<f32> *statistics_kernel_create(
         const layer_normalization_pd_t *pd) {
-    return mayiuse(avx2) ? new jit_statistics_kernel_t<f32>(pd) : nullptr;
+    if (mayiuse(avx512_core))
+        return new jit_statistics_kernel_t<f32, avx512_core>(pd);
+    if (mayiuse(avx2)) return new jit_statistics_kernel_t<f32, avx2>(pd);
+    return nullptr;
 }
 
 template <>
 data_kernel_t<bf16> *data_kernel_create(const layer_normalization_pd_t *pd) {
-    return mayiuse(avx512_core) ? new jit_data_kernel_t<bf16>(pd) : nullptr;
+    if (mayiuse(avx512_core))
+        return new jit_data_kernel_t<bf16, avx512_core>(pd);
+    return nullptr;
 }
 
 template <>
 data_kernel_t<f32> *data_kernel_create(const layer_normalization_pd_t *pd) {
-    return mayiuse(avx2) ? new jit_data_kernel_t<f32>(pd) : nullptr;
+    if (mayiuse(avx512_core))
+        return new jit_data_kernel_t<f32, avx512_core>(pd);
+    if (mayiuse(avx2)) return new jit_data_kernel_t<f32, avx2>(pd);
+    return nullptr;
 }
 
 template <>
 diff_ss_kernel_t<bf16> *diff_ss_kernel_create(
         const layer_normalization_pd_t *pd) {
-    return mayiuse(avx512_core) ? new jit_diff_ss_kernel_t<bf16>(pd) : nullptr;
+    if (mayiuse(avx512_core))
+        return new jit_diff_ss_kernel_t<bf16, avx512_core>(pd);
+    return nullptr;
 }
 
 template <>
 diff_ss_kernel_t<f32> *diff_ss_kernel_create(
         const layer_normalization_pd_t *pd) {
-    return mayiuse(avx2) ? new jit_diff_ss_kernel_t<f32>(pd) : nullptr;
+    if (mayiuse(avx512_core))
+        return new jit_diff_ss_kernel_t<f32, avx512_core>(pd);
+    if (mayiuse(avx2)) return new jit_diff_ss_kernel_t<f32, avx2>(pd);
+    return nullptr;
 }
 
 template <>
 diff_data_kernel_t<bf16> *diff_data_kernel_create(
         const layer_normalization_pd_t *pd) {
-    return mayiuse(avx512_core) ? new jit_diff_data_kernel_t<bf16>(pd)
-                                : nullptr;
+    if (mayiuse(avx512_core))
+        return new jit_diff_data_kernel_t<bf16, avx512_core>(pd);
+    return nullptr;
 }
 
 template <>
 diff_data_kernel_t<f32> *diff_data_kernel_create(
         const layer_normalization_pd_t *pd) {
-    return mayiuse(avx2) ? new jit_diff_data_kernel_t<f32>(pd) : nullptr;
+    if (mayiuse(avx512_core))
+        return new jit_diff_data_kernel_t<f32, avx512_core>(pd);
+    if (mayiuse(avx2)) return new jit_diff_data_kernel_t<f32, avx2>(pd);
+    return nullptr;
 }
 
 } // namespace lnorm_utils
@@ -297,6 +297,48 @@ status_t jit_uni_pool_kernel<isa>::init_conf(jit_pool_conf_t &jpp,
     return status::success;
 }
 
+template <cpu_isa_t isa>
+status_t jit_uni_pool_kernel<isa>::init_conf_argmax(jit_pool_conf_t &jpp,
+        memory_tracking::registrar_t &scratchpad,
+        const jit_pool_conf_t &bwd_jpp, data_type_t ind_dt, int nthreads) {
+    assert(bwd_jpp.is_backward && bwd_jpp.alg == pooling_max);
+    // The indices are written to and read from a row of the scratchpad,
+    // which the transposition of the plain layout does not support.
+    if (bwd_jpp.tag_kind == jit_memory_tag_kind_t::ncsp
+            || bwd_jpp.ndims == 5)
+        return status::unimplemented;
+
+    jpp = bwd_jpp;
+    jpp.is_training = true;
+    jpp.is_backward = false;
+    jpp.simple_alg = true;
+    jpp.ind_dt = ind_dt;
+
+    const bool is_avx512 = utils::one_of(isa, avx512_common, avx512_core);
+    jpp.ur = is_avx512 ? 9 : 3;
+    if (jpp.is_bf16) jpp.ur -= isa_has_bf16(jpp.isa) ? 1 : 4;
+    if (jpp.ur < jpp.ur_bc) return status::unimplemented;
+
+    const int right_pad = calculate_end_padding(
+            jpp.l_pad, jpp.ow, jpp.iw, jpp.stride_w, jpp.kw);
+    const int ur_w = nstl::min(jpp.ow, jpp.ur / jpp.ur_bc);
+    if (utils::div_up(jpp.l_pad, jpp.stride_w) > ur_w
+            || utils::div_up(right_pad, jpp.stride_w) > ur_w)
+        return status::unimplemented;
+
+    // A row of the destination and of the indices per thread. The channels
+    // of a row are strided as in the backward destination.
+    using namespace memory_tracking::names;
+    const size_t row_size = (size_t)jpp.ow
+            * (jpp.tag_kind == jit_memory_tag_kind_t::nspc ? jpp.c
+                                                           : jpp.c_block);
+    scratchpad.book(key_pool_dst_argmax, row_size * nthreads, jpp.dt_size);
+    scratchpad.book(key_pool_ind_argmax, row_size * nthreads,
+            types::data_type_size(ind_dt));
+
+    return status::success;
+}
+
 static int reg_ind(int shift, int bc, int j, int ur_bc, int ur_w) noexcept {
     return shift * ur_bc * ur_w + bc * ur_w + j;
 };
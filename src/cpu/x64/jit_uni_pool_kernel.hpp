@@ -49,6 +49,12 @@ struct jit_uni_pool_kernel : public jit_generator {
     static status_t init_conf(jit_pool_conf_t &jbp,
             memory_tracking::registrar_t &scratchpad, const pooling_pd_t *ppd,
             int nthreads);
+    // Configures the forward training kernel that recomputes the indices of
+    // one row of the outputs for max pooling backward without a workspace.
+    // It processes the same channel blocks per call as the backward kernel.
+    static status_t init_conf_argmax(jit_pool_conf_t &jpp,
+            memory_tracking::registrar_t &scratchpad,
+            const jit_pool_conf_t &bwd_jpp, data_type_t ind_dt, int nthreads);
 
 private:
     using Xmm = Xbyak::Xmm;
@@ -802,7 +802,11 @@ jit_uni_pooling_bwd_t<isa, d_type>::jit_uni_pooling_bwd_t(const pd_t *apd)
     : primitive_t(apd)
     , kernel_(utils::make_unique<jit_uni_pool_kernel<isa>>(
               pd()->jpp_, pd()->invariant_dst_md()))
-    , trans_ctx_(nullptr) {}
+    , trans_ctx_(nullptr) {
+    if (pd()->recompute_argmax())
+        argmax_kernel_ = utils::make_unique<jit_uni_pool_kernel<isa>>(
+                pd()->argmax_jpp_, pd()->invariant_dst_md());
+}
 
 template <cpu_isa_t isa, data_type_t d_type>
 jit_uni_pooling_bwd_t<isa, d_type>::~jit_uni_pooling_bwd_t() = default;
@@ -851,13 +855,14 @@ template <cpu_isa_t isa, data_type_t d_type>
 status_t jit_uni_pooling_bwd_t<isa, d_type>::init(engine_t *engine) {
     if (pd()->jpp_.tag_kind == jit_memory_tag_kind_t::ncsp)
         CHECK(init_ncsp_trans_ctx());
+    if (argmax_kernel_) CHECK(argmax_kernel_->create_kernel());
     return kernel_->create_kernel();
 }
 
 template <cpu_isa_t isa, data_type_t d_type>
 void jit_uni_pooling_bwd_t<isa, d_type>::execute_backward(
-        const data_t *diff_dst, const char *indices, data_t *diff_src,
-        const exec_ctx_t &ctx) const {
+        const data_t *diff_dst, const char *indices, const data_t *src,
+        data_t *diff_src, const exec_ctx_t &ctx) const {
 
     using namespace jit_uni_pooling_utils;
     using wsp_data_t = typename prec_traits<wsp_dt_>::type;
@@ -868,6 +873,22 @@ void jit_uni_pooling_bwd_t<isa, d_type>::execute_backward(
     const size_t ind_dt_size
             = indices ? types::data_type_size(indices_d.data_type()) : 0;
     const auto &jpp = pd()->jpp_;
+
+    // Without a workspace, a row of the indices is recomputed to the
+    // scratchpad of the thread right before the backward kernel reads it.
+    const bool recompute_argmax = pd()->recompute_argmax();
+    const auto &argmax_jpp = pd()->argmax_jpp_;
+    const bool is_nspc = jpp.tag_kind == jit_memory_tag_kind_t::nspc;
+    const size_t argmax_row_size
+            = (size_t)jpp.ow * (is_nspc ? jpp.c : jpp.c_block);
+    const size_t argmax_ind_dt_size
+            = recompute_argmax ? types::data_type_size(argmax_jpp.ind_dt) : 0;
+    const auto scratchpad = ctx.get_scratchpad_grantor();
+    auto argmax_dst = scratchpad.template get<data_t>(
+            memory_tracking::names::key_pool_dst_argmax);
+    auto argmax_ind = scratchpad.template get<char>(
+            memory_tracking::names::key_pool_ind_argmax);
+
     const auto transpose_facade
             = jit_uni_pooling_utils::bwd_pooling_transpose_facade_t<data_t,
                     wsp_data_t, d_type>(jpp, trans_ctx_.get(), diff_src_d,
@@ -934,6 +955,19 @@ void jit_uni_pooling_bwd_t<isa, d_type>::execute_backward(
 
         arg.ur_bc = ur_bc;
         arg.b_c = b_c;
+
+        if (recompute_argmax) {
+            const size_t row_off = ithr * argmax_row_size
+                    + (is_nspc ? b_c * jpp.c_block : 0);
+            auto argmax_arg = arg;
+            argmax_arg.src = &src[diff_src_d.blk_off(n, c_off, ih)];
+            argmax_arg.dst = &argmax_dst[row_off];
+            argmax_arg.indices = &argmax_ind[row_off * argmax_ind_dt_size];
+            argmax_arg.c_elem_off = jpp.c_block * b_c;
+            (*argmax_kernel_)(&argmax_arg);
+            arg.indices = argmax_arg.indices;
+        }
+
         (*kernel_)(&arg);
     };
 
@@ -948,6 +982,33 @@ void jit_uni_pooling_bwd_t<isa, d_type>::execute_backward(
             transpose_facade.execute_transpose_output(ithr, n, b_c);
     };
 
+    // When the windows do not overlap along h, every output row zeroes and
+    // accumulates its own set of diff_src rows, so the rows can be processed
+    // independently. This exposes more parallelism for small minibatches.
+    const bool rows_are_independent = jpp.kh <= jpp.stride_h
+            && !transpose_facade.should_transpose_src()
+            && !transpose_facade.should_transpose_dst();
+    if (rows_are_independent) {
+        const auto nb2_c = utils::div_up(jpp.nb_c, jpp.ur_bc);
+        // The thread index selects the scratchpad of the recomputed indices.
+        if (jpp.tag_kind == jit_memory_tag_kind_t::nspc) {
+            parallel_nd_ext(0, jpp.mb, jpp.oh, nb2_c,
+                    [&](int ithr, int, int n, int oh, int b2_c) {
+                        const auto b_c = b2_c * jpp.ur_bc;
+                        const auto ur_bc
+                                = nstl::min(jpp.ur_bc, jpp.nb_c - b_c);
+                        ker(ithr, n, b_c, oh, ur_bc);
+                    });
+        } else {
+            assert(jpp.ur_bc == 1);
+            parallel_nd_ext(0, jpp.mb, jpp.nb_c, jpp.oh,
+                    [&](int ithr, int, int n, int b_c, int oh) {
+                        ker(ithr, n, b_c, oh, 1);
+                    });
+        }
+        return;
+    }
+
     parallel(0, [&](int ithr, int nthr) {
         const auto nb2_c = utils::div_up(jpp.nb_c, jpp.ur_bc);
         const std::size_t work_amount
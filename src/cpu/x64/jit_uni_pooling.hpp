@@ -126,16 +126,28 @@ struct jit_uni_pooling_bwd_t : public primitive_t {
                     && attr()->has_default_values() && !is_dilated();
             if (!ok) return status::unimplemented;
 
-            if (desc()->alg_kind == alg_kind::pooling_max) {
+            // The indices are recomputed with the forward kernel, which
+            // reads the source with the offsets of diff_src.
+            if (recompute_argmax()) {
+                if (*src_md() != *diff_src_md()) return status::unimplemented;
+            } else if (desc()->alg_kind == alg_kind::pooling_max) {
                 init_default_ws();
                 if (!compare_ws(hint_fwd_pd_)) return status::unimplemented;
             }
             auto scratchpad = scratchpad_registry().registrar();
-            return jit_uni_pool_kernel<isa>::init_conf(
-                    jpp_, scratchpad, this, dnnl_get_max_threads());
+            CHECK(jit_uni_pool_kernel<isa>::init_conf(
+                    jpp_, scratchpad, this, dnnl_get_max_threads()));
+            if (recompute_argmax()) {
+                jpp_.ind_dt = indices_data_type();
+                CHECK(jit_uni_pool_kernel<isa>::init_conf_argmax(argmax_jpp_,
+                        scratchpad, jpp_, jpp_.ind_dt,
+                        dnnl_get_max_threads()));
+            }
+            return status::success;
         }
 
         jit_pool_conf_t jpp_;
+        jit_pool_conf_t argmax_jpp_;
     };
 
     explicit jit_uni_pooling_bwd_t(const pd_t *apd);
@@ -150,25 +162,28 @@ struct jit_uni_pooling_bwd_t : public primitive_t {
     status_t execute(const exec_ctx_t &ctx) const override {
         auto diff_dst = CTX_IN_MEM(const data_t *, DNNL_ARG_DIFF_DST);
         auto ws = CTX_IN_MEM(const char *, DNNL_ARG_WORKSPACE);
+        auto src = CTX_IN_MEM(const data_t *, DNNL_ARG_SRC);
         auto diff_src = CTX_OUT_MEM(data_t *, DNNL_ARG_DIFF_SRC);
 
         if (pd()->ndims() == 5)
             execute_backward_3d(diff_dst, ws, diff_src, ctx);
         else
-            execute_backward(diff_dst, ws, diff_src, ctx);
+            execute_backward(diff_dst, ws, src, diff_src, ctx);
 
         return status::success;
     }
 
 private:
     void execute_backward(const data_t *diff_dst, const char *indices,
-            data_t *diff_src, const exec_ctx_t &ctx) const;
+            const data_t *src, data_t *diff_src, const exec_ctx_t &ctx) const;
     void execute_backward_3d(const data_t *diff_dst, const char *indices,
             data_t *diff_src, const exec_ctx_t &ctx) const;
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
     status_t init_ncsp_trans_ctx();
 
     std::unique_ptr<jit_uni_pool_kernel<isa>> kernel_;
+    // the forward training kernel that recomputes the indices, if any
+    std::unique_ptr<jit_uni_pool_kernel<isa>> argmax_kernel_;
     std::unique_ptr<jit_uni_pooling_utils::trans_context_t> trans_ctx_;
     static constexpr data_type_t wsp_dt_ = data_type::f32;
 };
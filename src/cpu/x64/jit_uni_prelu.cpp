@@ -0,0 +1,665 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/nstl.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/x64/jit_generator.hpp"
+#include "cpu/x64/jit_uni_prelu.hpp"
+
+#define GET_OFF(field) offsetof(jit_prelu_args_t, field)
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+using namespace Xbyak;
+
+struct jit_prelu_args_t {
+    const float *src;
+    const float *weights;
+    float *dst; // diff_src for backward
+    const float *diff_dst;
+    float *diff_weights; // partial results unless the weights are full
+    size_t work_amount; // vector: rows, otherwise elements
+};
+
+struct jit_uni_prelu_kernel_t : public jit_generator {
+    jit_uni_prelu_kernel_t(const jit_prelu_conf_t &conf) : conf_(conf) {}
+
+    void operator()(jit_prelu_args_t *p) { jit_generator::operator()(p); }
+
+protected:
+    const jit_prelu_conf_t conf_;
+};
+
+namespace {
+
+template <cpu_isa_t isa>
+struct jit_uni_prelu_kernel_impl_t : public jit_uni_prelu_kernel_t {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_prelu_kernel_impl_t)
+
+    jit_uni_prelu_kernel_impl_t(const jit_prelu_conf_t &conf)
+        : jit_uni_prelu_kernel_t(conf) {}
+
+    void generate() override {
+        preamble();
+
+        mov(reg_src, ptr[abi_param1 + GET_OFF(src)]);
+        mov(reg_wei, ptr[abi_param1 + GET_OFF(weights)]);
+        mov(reg_dst, ptr[abi_param1 + GET_OFF(dst)]);
+        if (!conf_.is_fwd) {
+            mov(reg_diff_dst, ptr[abi_param1 + GET_OFF(diff_dst)]);
+            mov(reg_diff_wei, ptr[abi_param1 + GET_OFF(diff_weights)]);
+        }
+        mov(reg_work, ptr[abi_param1 + GET_OFF(work_amount)]);
+
+        uni_vxorps(vmm_zero, vmm_zero, vmm_zero);
+
+        switch (conf_.wei_kind) {
+            case jit_prelu_wei_kind_t::scalar: compute_scalar(); break;
+            case jit_prelu_wei_kind_t::vector:
+                if (can_preload())
+                    compute_rows_preloaded();
+                else
+                    compute_rows();
+                break;
+            case jit_prelu_wei_kind_t::full: compute_full(); break;
+        }
+
+        postamble();
+    }
+
+private:
+    using Vmm = typename cpu_isa_traits<isa>::Vmm;
+
+    static constexpr int simd_w = cpu_isa_traits<isa>::vlen / sizeof(float);
+    static constexpr int n_vregs = cpu_isa_traits<isa>::n_vregs;
+    static constexpr int ur = isa == avx512_core ? 4 : 2;
+    static constexpr int preload_base = 7;
+
+    Reg64 reg_src = r8;
+    Reg64 reg_wei = r9;
+    Reg64 reg_dst = r10;
+    Reg64 reg_diff_dst = r11;
+    Reg64 reg_diff_wei = r12;
+    Reg64 reg_work = r13;
+    Reg64 reg_cnt = r14;
+    Reg64 reg_wei_ptr = r15;
+    Reg64 reg_diff_wei_ptr = rax;
+
+    Opmask k_mask = Opmask(1);
+
+    // sse41 blendvps takes the mask in xmm0 implicitly
+    Vmm vmm_mask = Vmm(0);
+    Vmm vmm_zero = Vmm(1);
+    Vmm vmm_wei_bcast = Vmm(2);
+    Vmm vmm_src(int u) { return Vmm(3 + 4 * u); }
+    Vmm vmm_wei(int u) { return Vmm(4 + 4 * u); }
+    Vmm vmm_diff_dst(int u) { return Vmm(5 + 4 * u); }
+    Vmm vmm_tmp(int u) { return Vmm(6 + 4 * u); }
+    Vmm vmm_acc(int u) { return Vmm(3 + 4 * ur + u); }
+    // the preloaded rows only use the registers of the first unroll
+    Vmm vmm_wei_row(int v) { return Vmm(preload_base + v); }
+    Vmm vmm_acc_row(int v) { return Vmm(preload_base + row_nvecs() + v); }
+
+    int row_nvecs() const { return (int)(conf_.blk / simd_w); }
+
+    // The weights (and the diff_weights accumulators) of a row stay in
+    // registers for the whole kernel if the row is short enough
+    bool can_preload() const {
+        const int nregs = conf_.is_fwd ? row_nvecs() : 2 * row_nvecs();
+        return conf_.blk % simd_w == 0 && preload_base + nregs <= n_vregs;
+    }
+
+    void load(const Vmm &v, const Address &addr, bool scalar) {
+        if (scalar)
+            uni_vmovss(Xmm(v.getIdx()), addr);
+        else
+            uni_vmovups(v, addr);
+    }
+
+    void store(const Address &addr, const Vmm &v, bool scalar) {
+        if (scalar)
+            uni_vmovss(addr, Xmm(v.getIdx()));
+        else
+            uni_vmovups(addr, v);
+    }
+
+    // Forward: dst = src > 0 ? src : src * wei, the result is in vmm_src(u).
+    // Backward: diff_src = src > 0 ? diff_dst : diff_dst * wei, the result is
+    // in vmm_diff_dst(u), and the contribution to diff_weights
+    // src > 0 ? 0 : diff_dst * src is in vmm_tmp(u).
+    void compute(int u, const Vmm &wei) {
+        const Vmm s = vmm_src(u), dd = vmm_diff_dst(u), t = vmm_tmp(u);
+        if (isa == avx512_core) {
+            vcmpps(k_mask, s, vmm_zero, _cmp_le_os);
+            if (conf_.is_fwd) {
+                vmulps(s | k_mask, s, wei);
+            } else {
+                vmulps(t | k_mask | T_z, dd, s);
+                vmulps(dd | k_mask, dd, wei);
+            }
+            return;
+        }
+
+        uni_vcmpps(vmm_mask, s, vmm_zero, _cmp_le_os);
+        if (conf_.is_fwd) {
+            uni_vmovups(t, s);
+            uni_vmulps(t, t, wei);
+            uni_vblendvps(s, s, t, vmm_mask);
+        } else {
+            uni_vmovups(t, dd);
+            uni_vmulps(t, t, s);
+            uni_vandps(t, t, vmm_mask);
+            uni_vmovups(s, dd);
+            uni_vmulps(s, s, wei);
+            uni_vblendvps(dd, dd, s, vmm_mask);
+        }
+    }
+
+    // Processes nvecs vectors (or scalars) starting at the current pointers
+    // and moves the pointers past them
+    void step(int nvecs, bool scalar) {
+        const bool is_scalar_wei
+                = conf_.wei_kind == jit_prelu_wei_kind_t::scalar;
+        const int lanes = scalar ? 1 : simd_w;
+
+        for (int u = 0; u < nvecs; ++u) {
+            const size_t off = u * lanes * sizeof(float);
+            load(vmm_src(u), ptr[reg_src + off], scalar);
+            if (!conf_.is_fwd)
+                load(vmm_diff_dst(u), ptr[reg_diff_dst + off], scalar);
+            if (!is_scalar_wei)
+                load(vmm_wei(u), ptr[reg_wei_ptr + off], scalar);
+            compute(u, is_scalar_wei ? vmm_wei_bcast : vmm_wei(u));
+
+            if (conf_.is_fwd) {
+                store(ptr[reg_dst + off], vmm_src(u), scalar);
+                continue;
+            }
+            store(ptr[reg_dst + off], vmm_diff_dst(u), scalar);
+            switch (conf_.wei_kind) {
+                case jit_prelu_wei_kind_t::scalar:
+                    uni_vaddps(vmm_acc(u), vmm_acc(u), vmm_tmp(u));
+                    break;
+                case jit_prelu_wei_kind_t::vector:
+                    load(vmm_wei(u), ptr[reg_diff_wei_ptr + off], scalar);
+                    uni_vaddps(vmm_tmp(u), vmm_tmp(u), vmm_wei(u));
+                    store(ptr[reg_diff_wei_ptr + off], vmm_tmp(u), scalar);
+                    break;
+                case jit_prelu_wei_kind_t::full:
+                    store(ptr[reg_diff_wei_ptr + off], vmm_tmp(u), scalar);
+                    break;
+            }
+        }
+
+        const size_t shift = nvecs * lanes * sizeof(float);
+        add(reg_src, shift);
+        add(reg_dst, shift);
+        if (!conf_.is_fwd) add(reg_diff_dst, shift);
+        if (!is_scalar_wei) {
+            add(reg_wei_ptr, shift);
+            if (!conf_.is_fwd) add(reg_diff_wei_ptr, shift);
+        }
+        sub(reg_cnt, nvecs * lanes);
+    }
+
+    // Processes reg_cnt contiguous elements
+    void loop() {
+        Label l_ur_loop, l_ur_end, l_simd_loop, l_simd_end, l_tail_loop,
+                l_tail_end;
+
+        L(l_ur_loop);
+        cmp(reg_cnt, ur * simd_w);
+        jl(l_ur_end, T_NEAR);
+        step(ur, false);
+        jmp(l_ur_loop, T_NEAR);
+        L(l_ur_end);
+
+        L(l_simd_loop);
+        cmp(reg_cnt, simd_w);
+        jl(l_simd_end, T_NEAR);
+        step(1, false);
+        jmp(l_simd_loop, T_NEAR);
+        L(l_simd_end);
+
+        L(l_tail_loop);
+        cmp(reg_cnt, 0);
+        jle(l_tail_end, T_NEAR);
+        step(1, true);
+        jmp(l_tail_loop, T_NEAR);
+        L(l_tail_end);
+    }
+
+    void compute_scalar() {
+        uni_vbroadcastss(vmm_wei_bcast, ptr[reg_wei]);
+        if (!conf_.is_fwd)
+            for (int u = 0; u < ur; ++u)
+                uni_vxorps(vmm_acc(u), vmm_acc(u), vmm_acc(u));
+
+        mov(reg_cnt, reg_work);
+        loop();
+
+        if (conf_.is_fwd) return;
+
+        // diff_weights += sum of the lanes of the accumulators
+        const Vmm acc = vmm_acc(0), tmp = vmm_tmp(0);
+        for (int u = 1; u < ur; ++u)
+            uni_vaddps(acc, acc, vmm_acc(u));
+        if (isa == avx512_core) {
+            const Zmm z_acc(acc.getIdx()), z_tmp(tmp.getIdx());
+            vshuff32x4(z_tmp, z_acc, z_acc, 0x4E);
+            vaddps(z_acc, z_acc, z_tmp);
+            vshuff32x4(z_tmp, z_acc, z_acc, 0xB1);
+            vaddps(z_acc, z_acc, z_tmp);
+        } else if (isa == avx2) {
+            const Ymm y_acc(acc.getIdx()), y_tmp(tmp.getIdx());
+            vperm2f128(y_tmp, y_acc, y_acc, 0x1);
+            vaddps(y_acc, y_acc, y_tmp);
+        }
+        uni_vshufps(tmp, acc, acc, 0x4E);
+        uni_vaddps(acc, acc, tmp);
+        uni_vshufps(tmp, acc, acc, 0xB1);
+        uni_vaddps(acc, acc, tmp);
+
+        const Xmm x_acc(acc.getIdx());
+        if (isa == sse41)
+            addss(x_acc, ptr[reg_diff_wei]);
+        else
+            vaddss(x_acc, x_acc, ptr[reg_diff_wei]);
+        uni_vmovss(ptr[reg_diff_wei], x_acc);
+    }
+
+    void compute_full() {
+        mov(reg_wei_ptr, reg_wei);
+        if (!conf_.is_fwd) mov(reg_diff_wei_ptr, reg_diff_wei);
+        mov(reg_cnt, reg_work);
+        loop();
+    }
+
+    // Every row starts from the beginning of the weights
+    void compute_rows() {
+        Label l_row_loop, l_row_end;
+        L(l_row_loop);
+        cmp(reg_work, 0);
+        jle(l_row_end, T_NEAR);
+
+        mov(reg_wei_ptr, reg_wei);
+        if (!conf_.is_fwd) mov(reg_diff_wei_ptr, reg_diff_wei);
+        mov(reg_cnt, conf_.blk);
+        loop();
+
+        dec(reg_work);
+        jmp(l_row_loop, T_NEAR);
+        L(l_row_end);
+    }
+
+    void compute_rows_preloaded() {
+        const int nvecs = row_nvecs();
+        const size_t vlen = cpu_isa_traits<isa>::vlen;
+
+        for (int v = 0; v < nvecs; ++v) {
+            uni_vmovups(vmm_wei_row(v), ptr[reg_wei + v * vlen]);
+            if (!conf_.is_fwd)
+                uni_vxorps(vmm_acc_row(v), vmm_acc_row(v), vmm_acc_row(v));
+        }
+
+        Label l_row_loop, l_row_end;
+        L(l_row_loop);
+        cmp(reg_work, 0);
+        jle(l_row_end, T_NEAR);
+        for (int v = 0; v < nvecs; ++v) {
+            uni_vmovups(vmm_src(0), ptr[reg_src + v * vlen]);
+            if (!conf_.is_fwd)
+                uni_vmovups(vmm_diff_dst(0), ptr[reg_diff_dst + v * vlen]);
+            compute(0, vmm_wei_row(v));
+            if (conf_.is_fwd) {
+                uni_vmovups(ptr[reg_dst + v * vlen], vmm_src(0));
+            } else {
+                uni_vmovups(ptr[reg_dst + v * vlen], vmm_diff_dst(0));
+                uni_vaddps(vmm_acc_row(v), vmm_acc_row(v), vmm_tmp(0));
+            }
+        }
+        add(reg_src, nvecs * vlen);
+        add(reg_dst, nvecs * vlen);
+        if (!conf_.is_fwd) add(reg_diff_dst, nvecs * vlen);
+        dec(reg_work);
+        jmp(l_row_loop, T_NEAR);
+        L(l_row_end);
+
+        if (conf_.is_fwd) return;
+        for (int v = 0; v < nvecs; ++v) {
+            uni_vmovups(vmm_tmp(0), ptr[reg_diff_wei + v * vlen]);
+            uni_vaddps(vmm_tmp(0), vmm_tmp(0), vmm_acc_row(v));
+            uni_vmovups(ptr[reg_diff_wei + v * vlen], vmm_tmp(0));
+        }
+    }
+};
+
+// Checks that the weights of the channels are contiguous, so that the weight
+// of the channel c is at offset c
+bool is_wei_c_contiguous(const memory_desc_wrapper &wei_d) {
+    dims_t pos {0};
+    for (dim_t c = 0; c < wei_d.dims()[1]; ++c) {
+        pos[1] = c;
+        if (wei_d.off_v(pos) - wei_d.offset0() != c) return false;
+    }
+    return true;
+}
+
+// Calls f(data_off, wei_off, work_amount) for every piece of the data that
+// the thread ithr out of nthr processes with a single kernel call
+template <typename F>
+void for_each_piece(
+        const jit_prelu_conf_t &conf, int ithr, int nthr, const F &f) {
+    dim_t start {0}, end {0};
+    switch (conf.wei_kind) {
+        case jit_prelu_wei_kind_t::scalar:
+            if (conf.bcast != broadcasting_strategy_t::scalar) {
+                // every (n, c) row has its own weight
+                balance211(conf.N * conf.C, nthr, ithr, start, end);
+                for (dim_t r = start; r < end; ++r)
+                    f(r * conf.SP, r % conf.C, conf.SP);
+                return;
+            }
+            // fall through
+        case jit_prelu_wei_kind_t::full: {
+            const dim_t nb = utils::div_up(conf.nelems, conf.simd_w);
+            balance211(nb, nthr, ithr, start, end);
+            const dim_t e_start = start * conf.simd_w;
+            const dim_t e_end = nstl::min(conf.nelems, end * conf.simd_w);
+            const bool is_full = conf.wei_kind == jit_prelu_wei_kind_t::full;
+            if (e_start < e_end)
+                f(e_start, is_full ? e_start : 0, e_end - e_start);
+            return;
+        }
+        case jit_prelu_wei_kind_t::vector: {
+            // the rows of a single (n, cb) share the weights
+            balance211(conf.N * conf.CB * conf.SP, nthr, ithr, start, end);
+            while (start < end) {
+                const dim_t unit = start / conf.SP;
+                const dim_t cb = unit % conf.CB;
+                const dim_t r_end = nstl::min(end, (unit + 1) * conf.SP);
+                f(start * conf.blk, cb * conf.blk, r_end - start);
+                start = r_end;
+            }
+            return;
+        }
+    }
+}
+
+} // namespace
+
+status_t jit_prelu_init_conf(jit_prelu_conf_t &conf, bool is_fwd, int simd_w,
+        const memory_desc_wrapper &data_d,
+        const memory_desc_wrapper &weights_d,
+        const memory_desc_wrapper &diff_data_d,
+        const memory_desc_wrapper &diff_weights_d) {
+    using namespace format_tag;
+
+    // the data and the diff data are accessed with the same offsets
+    if (!(data_d.is_dense() && data_d.is_blocking_desc()
+                && diff_data_d == data_d && diff_weights_d == weights_d))
+        return status::unimplemented;
+
+    conf.is_fwd = is_fwd;
+    conf.bcast = get_rhs_arg_broadcasting_strategy(*weights_d.md_, data_d);
+    conf.nelems = data_d.nelems();
+    conf.N = data_d.dims()[0];
+    conf.C = data_d.dims()[1];
+    conf.CB = 1;
+    conf.SP = 1;
+    conf.blk = 1;
+    conf.simd_w = simd_w;
+    conf.nthr = dnnl_get_max_threads();
+
+    const dim_t cache_line = 64 / sizeof(float);
+    switch (conf.bcast) {
+        case broadcasting_strategy_t::scalar:
+            conf.wei_kind = jit_prelu_wei_kind_t::scalar;
+            conf.tbuf_stride = cache_line;
+            break;
+        case broadcasting_strategy_t::no_broadcast:
+            if (weights_d != data_d) return status::unimplemented;
+            conf.wei_kind = jit_prelu_wei_kind_t::full;
+            conf.tbuf_stride = 0;
+            break;
+        case broadcasting_strategy_t::per_oc:
+        case broadcasting_strategy_t::per_oc_spatial: {
+            if (!is_wei_c_contiguous(weights_d)) return status::unimplemented;
+
+            const auto &strides = data_d.blocking_desc().strides;
+            const dim_t SP = conf.nelems / (conf.N * conf.C);
+            if (data_d.is_plain() && strides[1] == 1) {
+                // channels are the innermost dimension: rows of C elements
+                conf.wei_kind = jit_prelu_wei_kind_t::vector;
+                conf.N = 1;
+                conf.SP = conf.nelems / conf.C;
+                conf.blk = conf.C;
+            } else if (data_d.is_plain() && strides[1] == SP
+                    && strides[0] == conf.C * SP) {
+                // spatial dimensions are the innermost: rows of SP elements
+                conf.wei_kind = jit_prelu_wei_kind_t::scalar;
+                conf.CB = conf.C;
+                conf.SP = SP;
+            } else {
+                const dim_t blk = data_d.matches_one_of_tag(
+                                          nCw16c, nChw16c, nCdhw16c)
+                        ? 16
+                        : data_d.matches_one_of_tag(nCw8c, nChw8c, nCdhw8c)
+                                ? 8
+                                : 0;
+                if (blk == 0 || conf.C % blk != 0 || blk % simd_w != 0)
+                    return status::unimplemented;
+                conf.wei_kind = jit_prelu_wei_kind_t::vector;
+                conf.CB = conf.C / blk;
+                conf.SP = SP;
+                conf.blk = blk;
+            }
+            conf.tbuf_stride = utils::rnd_up(conf.C, cache_line);
+            break;
+        }
+        default: return status::unimplemented;
+    }
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+status_t jit_uni_prelu_fwd_t<isa>::pd_t::init(engine_t *engine) {
+    using namespace data_type;
+
+    bool ok = mayiuse(isa) && is_fwd() && set_default_formats()
+            && utils::everyone_is(
+                    f32, src_md(0)->data_type, weights_md(0)->data_type)
+            && attr()->has_default_values() && !has_zero_dim_memory();
+    if (!ok) return status::unimplemented;
+
+    const memory_desc_wrapper data_d(src_md(0)), weights_d(weights_md(0));
+    return jit_prelu_init_conf(conf_, true,
+            cpu_isa_traits<isa>::vlen / sizeof(float), data_d, weights_d,
+            data_d, weights_d);
+}
+
+template <cpu_isa_t isa>
+jit_uni_prelu_fwd_t<isa>::jit_uni_prelu_fwd_t(const pd_t *apd)
+    : primitive_t(apd) {}
+
+template <cpu_isa_t isa>
+jit_uni_prelu_fwd_t<isa>::~jit_uni_prelu_fwd_t() = default;
+
+template <cpu_isa_t isa>
+status_t jit_uni_prelu_fwd_t<isa>::init(engine_t *engine) {
+    CHECK(safe_ptr_assign(
+            kernel_, new jit_uni_prelu_kernel_impl_t<isa>(pd()->conf_)));
+    return kernel_->create_kernel();
+}
+
+template <cpu_isa_t isa>
+status_t jit_uni_prelu_fwd_t<isa>::execute(const exec_ctx_t &ctx) const {
+    auto src = CTX_IN_MEM(const float *, DNNL_ARG_SRC);
+    auto weights = CTX_IN_MEM(const float *, DNNL_ARG_WEIGHTS);
+    auto dst = CTX_OUT_MEM(float *, DNNL_ARG_DST);
+
+    const memory_desc_wrapper data_d(pd()->src_md(0));
+    const memory_desc_wrapper weights_d(pd()->weights_md(0));
+    src += data_d.offset0();
+    dst += data_d.offset0();
+    weights += weights_d.offset0();
+
+    const auto &conf = pd()->conf_;
+    parallel(conf.nthr, [&](const int ithr, const int nthr) {
+        for_each_piece(conf, ithr, nthr,
+                [&](dim_t data_off, dim_t wei_off, dim_t work_amount) {
+                    jit_prelu_args_t args;
+                    args.src = src + data_off;
+                    args.weights = weights + wei_off;
+                    args.dst = dst + data_off;
+                    args.diff_dst = nullptr;
+                    args.diff_weights = nullptr;
+                    args.work_amount = work_amount;
+                    (*kernel_)(&args);
+                });
+    });
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+status_t jit_uni_prelu_bwd_t<isa>::pd_t::init(engine_t *engine) {
+    using namespace data_type;
+
+    bool ok = mayiuse(isa) && !is_fwd() && set_default_formats()
+            && utils::everyone_is(f32, src_md(0)->data_type,
+                    weights_md(0)->data_type, diff_src_md(0)->data_type,
+                    diff_weights_md(0)->data_type)
+            && attr()->has_default_values() && !has_zero_dim_memory();
+    if (!ok) return status::unimplemented;
+
+    CHECK(jit_prelu_init_conf(conf_, false,
+            cpu_isa_traits<isa>::vlen / sizeof(float),
+            memory_desc_wrapper(src_md(0)), memory_desc_wrapper(weights_md(0)),
+            memory_desc_wrapper(diff_src_md(0)),
+            memory_desc_wrapper(diff_weights_md(0))));
+    init_scratchpad();
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+void jit_uni_prelu_bwd_t<isa>::pd_t::init_scratchpad() {
+    using namespace memory_tracking::names;
+    if (conf_.tbuf_stride == 0) return;
+
+    // Every thread accumulates its own partial diff_weights, which are
+    // summed up once all the data is processed
+    auto scratchpad = scratchpad_registry().registrar();
+    scratchpad.template book<float>(
+            key_prelu_reduction, conf_.nthr * conf_.tbuf_stride);
+}
+
+template <cpu_isa_t isa>
+jit_uni_prelu_bwd_t<isa>::jit_uni_prelu_bwd_t(const pd_t *apd)
+    : primitive_t(apd) {}
+
+template <cpu_isa_t isa>
+jit_uni_prelu_bwd_t<isa>::~jit_uni_prelu_bwd_t() = default;
+
+template <cpu_isa_t isa>
+status_t jit_uni_prelu_bwd_t<isa>::init(engine_t *engine) {
+    CHECK(safe_ptr_assign(
+            kernel_, new jit_uni_prelu_kernel_impl_t<isa>(pd()->conf_)));
+    return kernel_->create_kernel();
+}
+
+template <cpu_isa_t isa>
+status_t jit_uni_prelu_bwd_t<isa>::execute(const exec_ctx_t &ctx) const {
+    using namespace memory_tracking::names;
+
+    auto src = CTX_IN_MEM(const float *, DNNL_ARG_SRC);
+    auto weights = CTX_IN_MEM(const float *, DNNL_ARG_WEIGHTS);
+    auto diff_dst = CTX_IN_MEM(const float *, DNNL_ARG_DIFF_DST);
+    auto diff_src = CTX_OUT_MEM(float *, DNNL_ARG_DIFF_SRC);
+    auto diff_weights = CTX_OUT_MEM(float *, DNNL_ARG_DIFF_WEIGHTS);
+
+    const memory_desc_wrapper data_d(pd()->src_md(0));
+    const memory_desc_wrapper weights_d(pd()->weights_md(0));
+    src += data_d.offset0();
+    diff_dst += data_d.offset0();
+    diff_src += data_d.offset0();
+    weights += weights_d.offset0();
+    diff_weights += weights_d.offset0();
+
+    const auto &conf = pd()->conf_;
+    const bool is_reduced = conf.tbuf_stride > 0;
+    float *tbuf = is_reduced ? ctx.get_scratchpad_grantor().template get<float>(
+                          key_prelu_reduction)
+                             : nullptr;
+
+    // The work is distributed between conf.nthr "virtual" threads so that
+    // every partial diff_weights buffer is initialized even if the actual
+    // number of threads is smaller
+    parallel(conf.nthr, [&](const int ithr, const int nthr) {
+        for (int vthr = ithr; vthr < conf.nthr; vthr += nthr) {
+            float *thr_diff_weights = diff_weights;
+            if (is_reduced) {
+                thr_diff_weights = tbuf + vthr * conf.tbuf_stride;
+                utils::array_set(thr_diff_weights, 0.f, conf.tbuf_stride);
+            }
+            for_each_piece(conf, vthr, conf.nthr,
+                    [&](dim_t data_off, dim_t wei_off, dim_t work_amount) {
+                        jit_prelu_args_t args;
+                        args.src = src + data_off;
+                        args.weights = weights + wei_off;
+                        args.dst = diff_src + data_off;
+                        args.diff_dst = diff_dst + data_off;
+                        args.diff_weights = thr_diff_weights + wei_off;
+                        args.work_amount = work_amount;
+                        (*kernel_)(&args);
+                    });
+        }
+    });
+
+    if (!is_reduced) return status::success;
+
+    const dim_t nwei
+            = conf.bcast == broadcasting_strategy_t::scalar ? 1 : conf.C;
+    parallel_nd(nwei, [&](dim_t c) {
+        float res = 0.f;
+        for (int t = 0; t < conf.nthr; ++t)
+            res += tbuf[t * conf.tbuf_stride + c];
+        diff_weights[c] = res;
+    });
+
+    return status::success;
+}
+
+template struct jit_uni_prelu_fwd_t<sse41>;
+template struct jit_uni_prelu_fwd_t<avx2>;
+template struct jit_uni_prelu_fwd_t<avx512_core>;
+template struct jit_uni_prelu_bwd_t<sse41>;
+template struct jit_uni_prelu_bwd_t<avx2>;
+template struct jit_uni_prelu_bwd_t<avx512_core>;
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,131 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_JIT_UNI_PRELU_HPP
+#define CPU_X64_JIT_UNI_PRELU_HPP
+
+#include <memory>
+
+#include "common/broadcast_strategy.hpp"
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_prelu_pd.hpp"
+
+#include "cpu/x64/cpu_isa_traits.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+// The way the weights are applied to a contiguous piece of the data:
+// - scalar: a single weight is broadcast to the whole piece. Used for the
+//   scalar broadcast and for per_oc_spatial (nchw), where every (n, c) row
+//   of the data shares the weight c.
+// - vector: the piece consists of rows of row_len elements and the same
+//   row_len weights are applied to every row. Used for per_oc with channels
+//   being the innermost dimension (nhwc, row_len = C) or blocked
+//   (nChw16c, row_len = 16).
+// - full: every element has its own weight (no_broadcast).
+enum class jit_prelu_wei_kind_t { scalar, vector, full };
+
+struct jit_prelu_conf_t {
+    bool is_fwd;
+    broadcasting_strategy_t bcast;
+    jit_prelu_wei_kind_t wei_kind;
+
+    dim_t nelems;
+    // per_oc only: the data is viewed as N x CB x SP x blk, with blk = 1 for
+    // nchw and CB = 1, blk = C (and N = N * SP, SP = 1) for nhwc
+    dim_t N, C, CB, SP, blk;
+
+    int simd_w;
+    int nthr;
+    dim_t tbuf_stride; // per thread partial diff_weights, in floats
+};
+
+struct jit_uni_prelu_kernel_t;
+
+status_t jit_prelu_init_conf(jit_prelu_conf_t &conf, bool is_fwd, int simd_w,
+        const memory_desc_wrapper &data_d,
+        const memory_desc_wrapper &weights_d,
+        const memory_desc_wrapper &diff_data_d,
+        const memory_desc_wrapper &diff_weights_d);
+
+template <cpu_isa_t isa>
+struct jit_uni_prelu_fwd_t : public primitive_t {
+    struct pd_t : public cpu_prelu_fwd_pd_t {
+        using cpu_prelu_fwd_pd_t::cpu_prelu_fwd_pd_t;
+
+        DECLARE_COMMON_PD_T(
+                JIT_IMPL_NAME_HELPER("jit:", isa, ""), jit_uni_prelu_fwd_t);
+
+        status_t init(engine_t *engine);
+
+        jit_prelu_conf_t conf_;
+    };
+
+    jit_uni_prelu_fwd_t(const pd_t *apd);
+    ~jit_uni_prelu_fwd_t();
+
+    status_t init(engine_t *engine) override;
+
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    std::unique_ptr<jit_uni_prelu_kernel_t> kernel_;
+};
+
+template <cpu_isa_t isa>
+struct jit_uni_prelu_bwd_t : public primitive_t {
+    struct pd_t : public cpu_prelu_bwd_pd_t {
+        using cpu_prelu_bwd_pd_t::cpu_prelu_bwd_pd_t;
+
+        DECLARE_COMMON_PD_T(
+                JIT_IMPL_NAME_HELPER("jit:", isa, ""), jit_uni_prelu_bwd_t);
+
+        status_t init(engine_t *engine);
+
+        jit_prelu_conf_t conf_;
+
+    private:
+        void init_scratchpad();
+    };
+
+    jit_uni_prelu_bwd_t(const pd_t *apd);
+    ~jit_uni_prelu_bwd_t();
+
+    status_t init(engine_t *engine) override;
+
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    std::unique_ptr<jit_uni_prelu_kernel_t> kernel_;
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -0,0 +1,845 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <float.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/nstl.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/platform.hpp"
+
+#include "cpu/x64/injectors/jit_uni_eltwise_injector.hpp"
+#include "cpu/x64/jit_avx512_core_bf16cvt.hpp"
+#include "cpu/x64/jit_generator.hpp"
+#include "cpu/x64/jit_uni_reduction.hpp"
+
+#define GET_OFF(field) offsetof(jit_reduction_args_t, field)
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+using namespace Xbyak;
+
+struct jit_reduction_args_t {
+    const void *src;
+    void *dst;
+    size_t reduce_len; // vertical: rows to reduce, horizontal: elements
+    size_t work_amount; // vertical: inner elements, horizontal: outputs
+};
+
+struct jit_uni_reduction_kernel_t : public jit_generator {
+    // src_stride is the distance in elements between the rows (vertical) or
+    // between the outputs (horizontal). When from_src is false the kernel
+    // combines partial results, so norm_lp powers are not applied.
+    jit_uni_reduction_kernel_t(const jit_reduction_conf_t &conf,
+            data_type_t src_dt, data_type_t dst_dt, bool is_horizontal,
+            bool from_src, bool finalize, dim_t src_stride)
+        : conf_(conf)
+        , src_dt_(src_dt)
+        , dst_dt_(dst_dt)
+        , is_horizontal_(is_horizontal)
+        , from_src_(from_src)
+        , finalize_(finalize)
+        , src_stride_(src_stride) {}
+
+    void operator()(jit_reduction_args_t *p) { jit_generator::operator()(p); }
+
+protected:
+    const jit_reduction_conf_t conf_;
+    const data_type_t src_dt_, dst_dt_;
+    const bool is_horizontal_;
+    const bool from_src_;
+    const bool finalize_;
+    const dim_t src_stride_;
+
+    bool is_norm() const {
+        using namespace alg_kind;
+        return utils::one_of(conf_.alg, reduction_norm_lp_max,
+                reduction_norm_lp_sum, reduction_norm_lp_power_p_max,
+                reduction_norm_lp_power_p_sum);
+    }
+    bool is_root() const {
+        using namespace alg_kind;
+        return utils::one_of(
+                conf_.alg, reduction_norm_lp_max, reduction_norm_lp_sum);
+    }
+    bool is_special_p() const { return conf_.p == 1.f || conf_.p == 2.f; }
+};
+
+namespace {
+
+template <cpu_isa_t isa>
+struct jit_uni_reduction_kernel_impl_t : public jit_uni_reduction_kernel_t {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_reduction_kernel_impl_t)
+
+    jit_uni_reduction_kernel_impl_t(const jit_reduction_conf_t &conf,
+            data_type_t src_dt, data_type_t dst_dt, bool is_horizontal,
+            bool from_src, bool finalize, dim_t src_stride)
+        : jit_uni_reduction_kernel_t(conf, src_dt, dst_dt, is_horizontal,
+                from_src, finalize, src_stride) {
+        // p = 1 and p = 2 are computed in place, any other p goes through
+        // the generic eltwise pow
+        if (from_src_ && is_norm() && !is_special_p())
+            pow_injector_.reset(new jit_uni_eltwise_injector_f32<isa>(this,
+                    alg_kind::eltwise_pow, 1.f, conf_.p, 1.f, true,
+                    reg_pow_table, Opmask(1)));
+        if (finalize_ && is_root() && !is_special_p())
+            root_injector_.reset(new jit_uni_eltwise_injector_f32<isa>(this,
+                    alg_kind::eltwise_pow, 1.f, 1.f / conf_.p, 1.f, true,
+                    reg_root_table, Opmask(1)));
+        if (dst_dt_ == data_type::bf16 && !mayiuse(avx512_core_bf16))
+            bf16_emu_.reset(new bf16_emulation_t(this, bf16_emu_reserv_1,
+                    bf16_emu_reserv_2, bf16_emu_reserv_3, reg_bf16_scratch,
+                    bf16_emu_reserv_4));
+    }
+
+    void generate() override {
+        preamble();
+
+        if (bf16_emu_) bf16_emu_->init_vcvtneps2bf16();
+
+        mov(reg_src, ptr[abi_param1 + GET_OFF(src)]);
+        mov(reg_dst, ptr[abi_param1 + GET_OFF(dst)]);
+        mov(reg_reduce_len, ptr[abi_param1 + GET_OFF(reduce_len)]);
+        mov(reg_work, ptr[abi_param1 + GET_OFF(work_amount)]);
+        mov(reg_stride, src_stride_ * src_dt_size());
+
+        mov(reg_table, l_table);
+        if (pow_injector_) pow_injector_->load_table_addr();
+        if (root_injector_) root_injector_->load_table_addr();
+
+        uni_vbroadcastss(vmm_init, ptr[reg_table + 0 * sizeof(float)]);
+        uni_vbroadcastss(vmm_eps, ptr[reg_table + 1 * sizeof(float)]);
+        uni_vbroadcastss(vmm_n, ptr[reg_table + 2 * sizeof(float)]);
+        uni_vbroadcastss(vmm_abs_mask, ptr[reg_table + 3 * sizeof(float)]);
+        uni_vbroadcastss(vmm_sat_lbound, ptr[reg_table + 4 * sizeof(float)]);
+        uni_vbroadcastss(vmm_sat_ubound, ptr[reg_table + 5 * sizeof(float)]);
+
+        if (is_horizontal_)
+            horizontal_reduction();
+        else
+            vertical_reduction();
+
+        postamble();
+
+        prepare_table();
+        if (pow_injector_) pow_injector_->prepare_table();
+        if (root_injector_) root_injector_->prepare_table();
+    }
+
+private:
+    using Vmm = typename cpu_isa_traits<isa>::Vmm;
+
+    static constexpr int simd_w = cpu_isa_traits<isa>::vlen / sizeof(float);
+    static constexpr int ur = 4;
+
+    Reg64 reg_src = r8;
+    Reg64 reg_dst = r9;
+    Reg64 reg_work = r10;
+    Reg64 reg_reduce_len = r11;
+    Reg64 reg_cnt = r12;
+    Reg64 reg_ptr = r13;
+    Reg64 reg_stride = r14;
+    Reg64 reg_table = r15;
+    Reg64 reg_tmp = rax;
+    Reg64 reg_pow_table = rbx;
+    Reg64 reg_root_table = rdx;
+    Reg64 reg_bf16_scratch = rsi;
+
+    // acc: [0, ur), src: [ur, 2 * ur)
+    Vmm vmm_acc(int i) { return Vmm(i); }
+    Vmm vmm_src(int i) { return Vmm(ur + i); }
+    Vmm vmm_init = Vmm(8);
+    Vmm vmm_eps = Vmm(9);
+    Vmm vmm_n = Vmm(10);
+    Vmm vmm_abs_mask = Vmm(11);
+    Vmm vmm_sat_lbound = Vmm(12);
+    Vmm vmm_sat_ubound = Vmm(13);
+    Vmm vmm_tmp = Vmm(14);
+
+    Zmm bf16_emu_reserv_1 = Zmm(28);
+    Zmm bf16_emu_reserv_2 = Zmm(29);
+    Zmm bf16_emu_reserv_3 = Zmm(30);
+    Zmm bf16_emu_reserv_4 = Zmm(31);
+
+    Label l_table;
+
+    std::unique_ptr<jit_uni_eltwise_injector_f32<isa>> pow_injector_;
+    std::unique_ptr<jit_uni_eltwise_injector_f32<isa>> root_injector_;
+    std::unique_ptr<bf16_emulation_t> bf16_emu_;
+
+    size_t src_dt_size() const { return types::data_type_size(src_dt_); }
+    size_t dst_dt_size() const { return types::data_type_size(dst_dt_); }
+
+    void movd_to_xmm(const Xmm &x, const Reg32 &r) {
+        if (isa == sse41)
+            movd(x, r);
+        else
+            vmovd(x, r);
+    }
+
+    void movd_from_xmm(const Reg32 &r, const Xmm &x) {
+        if (isa == sse41)
+            movd(r, x);
+        else
+            vmovd(r, x);
+    }
+
+    void load(const Vmm &v, const Reg64 &reg, size_t off, bool scalar) {
+        using namespace data_type;
+        const Xmm x(v.getIdx());
+        switch (src_dt_) {
+            case f32:
+                if (scalar)
+                    uni_vmovss(x, ptr[reg + off]);
+                else
+                    uni_vmovups(v, ptr[reg + off]);
+                break;
+            case bf16:
+                if (scalar) {
+                    movzx(reg_tmp.cvt32(), word[reg + off]);
+                    shl(reg_tmp.cvt32(), 16);
+                    movd_to_xmm(x, reg_tmp.cvt32());
+                } else {
+                    vpmovzxwd(v, ptr[reg + off]);
+                    vpslld(v, v, 16);
+                }
+                break;
+            case s8:
+            case u8:
+                if (scalar) {
+                    if (src_dt_ == s8)
+                        movsx(reg_tmp.cvt32(), byte[reg + off]);
+                    else
+                        movzx(reg_tmp.cvt32(), byte[reg + off]);
+                    movd_to_xmm(x, reg_tmp.cvt32());
+                } else if (src_dt_ == s8) {
+                    uni_vpmovsxbd(v, ptr[reg + off]);
+                } else {
+                    uni_vpmovzxbd(v, ptr[reg + off]);
+                }
+                uni_vcvtdq2ps(v, v);
+                break;
+            default: assert(!"unsupported data type");
+        }
+    }
+
+    void store(const Vmm &v, const Reg64 &reg, size_t off, bool scalar) {
+        using namespace data_type;
+        const Xmm x(v.getIdx());
+        const Ymm y(v.getIdx());
+        if (utils::one_of(dst_dt_, s32, s8, u8)) {
+            uni_vmaxps(v, v, vmm_sat_lbound);
+            uni_vminps(v, v, vmm_sat_ubound);
+            uni_vcvtps2dq(v, v);
+        }
+        switch (dst_dt_) {
+            case f32:
+            case s32:
+                if (scalar)
+                    uni_vmovss(ptr[reg + off], x);
+                else
+                    uni_vmovups(ptr[reg + off], v);
+                break;
+            case bf16:
+                if (bf16_emu_)
+                    bf16_emu_->vcvtneps2bf16(y, Zmm(v.getIdx()));
+                else
+                    vcvtneps2bf16(y, Zmm(v.getIdx()));
+                if (scalar) {
+                    movd_from_xmm(reg_tmp.cvt32(), x);
+                    mov(word[reg + off], reg_tmp.cvt16());
+                } else {
+                    vmovdqu16(ptr[reg + off], y);
+                }
+                break;
+            case s8:
+            case u8:
+                if (scalar) {
+                    movd_from_xmm(reg_tmp.cvt32(), x);
+                    mov(byte[reg + off], reg_tmp.cvt8());
+                } else if (isa == avx512_core) {
+                    // values are saturated already
+                    if (dst_dt_ == s8)
+                        vpmovsdb(ptr[reg + off], Zmm(v.getIdx()));
+                    else
+                        vpmovusdb(ptr[reg + off], Zmm(v.getIdx()));
+                } else if (isa == avx2) {
+                    const Xmm x_tmp(vmm_tmp.getIdx());
+                    vextracti128(x_tmp, y, 1);
+                    vpackssdw(x, x, x_tmp);
+                    if (dst_dt_ == s8)
+                        vpacksswb(x, x, x);
+                    else
+                        vpackuswb(x, x, x);
+                    vmovq(ptr[reg + off], x);
+                } else {
+                    packssdw(x, x);
+                    if (dst_dt_ == s8)
+                        packsswb(x, x);
+                    else
+                        packuswb(x, x);
+                    movd(ptr[reg + off], x);
+                }
+                break;
+            default: assert(!"unsupported data type");
+        }
+    }
+
+    // src = |src|^p for norm_lp algorithms
+    void apply_power(int idx_start, int idx_end) {
+        if (!(from_src_ && is_norm())) return;
+        for (int i = idx_start; i < idx_end; ++i)
+            uni_vandps(Vmm(i), Vmm(i), vmm_abs_mask);
+        if (conf_.p == 2.f) {
+            for (int i = idx_start; i < idx_end; ++i)
+                uni_vmulps(Vmm(i), Vmm(i), Vmm(i));
+        } else if (pow_injector_) {
+            pow_injector_->compute_vector_range(idx_start, idx_end);
+        }
+    }
+
+    void accumulate(const Vmm &acc, const Vmm &v) {
+        using namespace alg_kind;
+        switch (conf_.alg) {
+            case reduction_max: uni_vmaxps(acc, acc, v); break;
+            case reduction_min: uni_vminps(acc, acc, v); break;
+            case reduction_mul: uni_vmulps(acc, acc, v); break;
+            default: uni_vaddps(acc, acc, v); break;
+        }
+    }
+
+    void finalize(int idx_start, int idx_end) {
+        using namespace alg_kind;
+        if (!finalize_) return;
+        for (int i = idx_start; i < idx_end; ++i) {
+            const Vmm acc(i);
+            switch (conf_.alg) {
+                case reduction_mean: uni_vdivps(acc, acc, vmm_n); break;
+                case reduction_norm_lp_max:
+                case reduction_norm_lp_power_p_max:
+                    uni_vmaxps(acc, acc, vmm_eps);
+                    break;
+                case reduction_norm_lp_sum:
+                case reduction_norm_lp_power_p_sum:
+                    uni_vaddps(acc, acc, vmm_eps);
+                    break;
+                default: break;
+            }
+        }
+        if (!is_root()) return;
+        if (conf_.p == 2.f) {
+            for (int i = idx_start; i < idx_end; ++i)
+                uni_vsqrtps(Vmm(i), Vmm(i));
+        } else if (root_injector_) {
+            root_injector_->compute_vector_range(idx_start, idx_end);
+        }
+    }
+
+    // Reduces the lanes of acc, the result is broadcast to all of them
+    void reduce_lanes(const Vmm &acc) {
+        if (isa == avx512_core) {
+            const Zmm z_acc(acc.getIdx()), z_tmp(vmm_tmp.getIdx());
+            vshuff32x4(z_tmp, z_acc, z_acc, 0x4E);
+            accumulate(acc, vmm_tmp);
+            vshuff32x4(z_tmp, z_acc, z_acc, 0xB1);
+            accumulate(acc, vmm_tmp);
+        } else if (isa == avx2) {
+            vperm2f128(Ymm(vmm_tmp.getIdx()), Ymm(acc.getIdx()),
+                    Ymm(acc.getIdx()), 0x1);
+            accumulate(acc, vmm_tmp);
+        }
+        uni_vshufps(vmm_tmp, acc, acc, 0x4E);
+        accumulate(acc, vmm_tmp);
+        uni_vshufps(vmm_tmp, acc, acc, 0xB1);
+        accumulate(acc, vmm_tmp);
+    }
+
+    // Every iteration processes ur vectors (or ur scalars) of the inner
+    // dimension, walking reduce_len rows of the source
+    void vertical_reduction() {
+        auto step = [&](int nvecs, bool scalar) {
+            const int lanes = scalar ? 1 : simd_w;
+            for (int u = 0; u < nvecs; ++u)
+                uni_vmovups(vmm_acc(u), vmm_init);
+
+            Label l_reduce, l_reduce_end;
+            mov(reg_ptr, reg_src);
+            mov(reg_cnt, reg_reduce_len);
+            L(l_reduce);
+            {
+                cmp(reg_cnt, 0);
+                jle(l_reduce_end, T_NEAR);
+                for (int u = 0; u < nvecs; ++u)
+                    load(vmm_src(u), reg_ptr, u * lanes * src_dt_size(),
+                            scalar);
+                apply_power(ur, ur + nvecs);
+                for (int u = 0; u < nvecs; ++u)
+                    accumulate(vmm_acc(u), vmm_src(u));
+                add(reg_ptr, reg_stride);
+                dec(reg_cnt);
+                jmp(l_reduce, T_NEAR);
+            }
+            L(l_reduce_end);
+
+            finalize(0, nvecs);
+            for (int u = 0; u < nvecs; ++u)
+                store(vmm_acc(u), reg_dst, u * lanes * dst_dt_size(), scalar);
+
+            add(reg_src, nvecs * lanes * src_dt_size());
+            add(reg_dst, nvecs * lanes * dst_dt_size());
+            sub(reg_work, nvecs * lanes);
+        };
+
+        Label l_ur_loop, l_ur_end, l_simd_loop, l_simd_end, l_tail_loop,
+                l_tail_end;
+
+        L(l_ur_loop);
+        cmp(reg_work, ur * simd_w);
+        jl(l_ur_end, T_NEAR);
+        step(ur, false);
+        jmp(l_ur_loop, T_NEAR);
+        L(l_ur_end);
+
+        L(l_simd_loop);
+        cmp(reg_work, simd_w);
+        jl(l_simd_end, T_NEAR);
+        step(1, false);
+        jmp(l_simd_loop, T_NEAR);
+        L(l_simd_end);
+
+        L(l_tail_loop);
+        cmp(reg_work, 0);
+        jle(l_tail_end, T_NEAR);
+        step(1, true);
+        jmp(l_tail_loop, T_NEAR);
+        L(l_tail_end);
+    }
+
+    // Every iteration of the outer loop produces a single output from
+    // reduce_len contiguous source elements
+    void horizontal_reduction() {
+        Label l_out_loop, l_out_end;
+        Label l_ur_loop, l_ur_end, l_simd_loop, l_simd_end, l_tail_loop,
+                l_tail_end;
+
+        L(l_out_loop);
+        cmp(reg_work, 0);
+        jle(l_out_end, T_NEAR);
+
+        for (int u = 0; u < ur; ++u)
+            uni_vmovups(vmm_acc(u), vmm_init);
+        mov(reg_ptr, reg_src);
+        mov(reg_cnt, reg_reduce_len);
+
+        L(l_ur_loop);
+        {
+            cmp(reg_cnt, ur * simd_w);
+            jl(l_ur_end, T_NEAR);
+            for (int u = 0; u < ur; ++u)
+                load(vmm_src(u), reg_ptr, u * simd_w * src_dt_size(), false);
+            apply_power(ur, 2 * ur);
+            for (int u = 0; u < ur; ++u)
+                accumulate(vmm_acc(u), vmm_src(u));
+            add(reg_ptr, ur * simd_w * src_dt_size());
+            sub(reg_cnt, ur * simd_w);
+            jmp(l_ur_loop, T_NEAR);
+        }
+        L(l_ur_end);
+
+        L(l_simd_loop);
+        {
+            cmp(reg_cnt, simd_w);
+            jl(l_simd_end, T_NEAR);
+            load(vmm_src(0), reg_ptr, 0, false);
+            apply_power(ur, ur + 1);
+            accumulate(vmm_acc(0), vmm_src(0));
+            add(reg_ptr, simd_w * src_dt_size());
+            sub(reg_cnt, simd_w);
+            jmp(l_simd_loop, T_NEAR);
+        }
+        L(l_simd_end);
+
+        for (int u = 1; u < ur; ++u)
+            accumulate(vmm_acc(0), vmm_acc(u));
+        reduce_lanes(vmm_acc(0));
+
+        // Only the lowest lane is meaningful from now on
+        L(l_tail_loop);
+        {
+            cmp(reg_cnt, 0);
+            jle(l_tail_end, T_NEAR);
+            load(vmm_src(0), reg_ptr, 0, true);
+            apply_power(ur, ur + 1);
+            accumulate(vmm_acc(0), vmm_src(0));
+            add(reg_ptr, src_dt_size());
+            dec(reg_cnt);
+            jmp(l_tail_loop, T_NEAR);
+        }
+        L(l_tail_end);
+
+        finalize(0, 1);
+        store(vmm_acc(0), reg_dst, 0, true);
+
+        add(reg_src, reg_stride);
+        add(reg_dst, dst_dt_size());
+        dec(reg_work);
+        jmp(l_out_loop, T_NEAR);
+
+        L(l_out_end);
+    }
+
+    void prepare_table() {
+        using namespace alg_kind;
+        using namespace data_type;
+
+        float init = 0.f;
+        switch (conf_.alg) {
+            case reduction_max: init = -FLT_MAX; break;
+            case reduction_min: init = FLT_MAX; break;
+            case reduction_mul: init = 1.f; break;
+            default: break;
+        }
+
+        float sat_lbound = -FLT_MAX, sat_ubound = FLT_MAX;
+        switch (dst_dt_) {
+            case s32:
+                // the largest float below 2^31 still fits into int32
+                sat_lbound = (float)INT32_MIN;
+                sat_ubound = 2147483520.f;
+                break;
+            case s8:
+                sat_lbound = (float)INT8_MIN;
+                sat_ubound = (float)INT8_MAX;
+                break;
+            case u8:
+                sat_lbound = 0.f;
+                sat_ubound = (float)UINT8_MAX;
+                break;
+            default: break;
+        }
+
+        align(64);
+        L(l_table);
+        dd(float2int(init));
+        dd(float2int(conf_.eps));
+        dd(float2int((float)conf_.reduce));
+        dd(0x7fffffff);
+        dd(float2int(sat_lbound));
+        dd(float2int(sat_ubound));
+    }
+};
+
+} // namespace
+
+template <cpu_isa_t isa>
+status_t jit_uni_reduction_t<isa>::pd_t::init(engine_t *engine) {
+    using namespace data_type;
+
+    const data_type_t src_dt = src_md()->data_type;
+    const data_type_t dst_dt = dst_md()->data_type;
+
+    bool ok = mayiuse(isa) && utils::one_of(src_dt, f32, bf16, s8, u8)
+            && utils::one_of(dst_dt, f32, bf16, s8, u8, s32)
+            && IMPLICATION(utils::one_of(bf16, src_dt, dst_dt),
+                    isa == avx512_core)
+            && platform::has_data_type_support(src_dt)
+            && platform::has_data_type_support(dst_dt)
+            && set_default_params() == status::success
+            && attr()->has_default_values()
+            && !memory_desc_wrapper(src_md()).has_zero_dim();
+    if (!ok) return status::unimplemented;
+
+    CHECK(init_conf());
+    init_scratchpad();
+
+    return status::success;
+}
+
+namespace {
+struct phys_dim_t {
+    int d; // logical dimension
+    dim_t size, stride;
+    bool is_blk; // an inner block of the dimension
+};
+
+// Physical dimensions of a blocked memory descriptor, the outermost first:
+// the outer parts of the dimensions ordered by stride, then the inner
+// blocks. Dimensions of size 1 are skipped.
+std::vector<phys_dim_t> get_phys_dims(const memory_desc_wrapper &md) {
+    const auto &bd = md.blocking_desc();
+    const int ndims = md.ndims();
+
+    dims_t blks;
+    md.compute_blocks(blks);
+
+    std::vector<phys_dim_t> outer, res;
+    for (int d = 0; d < ndims; ++d)
+        outer.push_back({d, md.padded_dims()[d] / blks[d], bd.strides[d],
+                false});
+    std::stable_sort(outer.begin(), outer.end(),
+            [](const phys_dim_t &a, const phys_dim_t &b) {
+                return a.stride > b.stride;
+            });
+    for (const auto &pd : outer)
+        if (pd.size != 1) res.push_back(pd);
+
+    dim_t stride = 1;
+    std::vector<phys_dim_t> blocks;
+    for (int i = bd.inner_nblks - 1; i >= 0; --i) {
+        blocks.push_back({(int)bd.inner_idxs[i], bd.inner_blks[i], stride,
+                true});
+        stride *= bd.inner_blks[i];
+    }
+    for (auto it = blocks.rbegin(); it != blocks.rend(); ++it)
+        if (it->size != 1) res.push_back(*it);
+    return res;
+}
+} // namespace
+
+template <cpu_isa_t isa>
+status_t jit_uni_reduction_t<isa>::pd_t::init_conf() {
+    using namespace alg_kind;
+    const memory_desc_wrapper src_d(src_md());
+    const memory_desc_wrapper dst_d(dst_md());
+
+    if (!(src_d.is_blocking_desc() && dst_d.is_blocking_desc()
+                && src_d.is_dense(true) && dst_d.is_dense(true)))
+        return status::unimplemented;
+
+    // The padded area of the destination is computed from the zeros of the
+    // padded area of the source, which keeps it zero except for norms.
+    const bool has_padding = !src_d.is_dense() || !dst_d.is_dense();
+    if (has_padding
+            && utils::one_of(desc()->alg_kind, reduction_norm_lp_max,
+                    reduction_norm_lp_sum, reduction_norm_lp_power_p_max,
+                    reduction_norm_lp_power_p_sum))
+        return status::unimplemented;
+
+    const auto &src_dims = src_d.dims();
+    const auto &dst_dims = dst_d.dims();
+    const auto is_reduced = [&](int d) { return src_dims[d] != dst_dims[d]; };
+
+    const auto src_pdims = get_phys_dims(src_d);
+    const auto dst_pdims = get_phys_dims(dst_d);
+
+    dim_t outer = 1, reduce = 1, inner = 1;
+    enum { outer_part, reduce_part, inner_part } part = outer_part;
+    std::vector<phys_dim_t> idle_pdims;
+    for (const auto &pd : src_pdims) {
+        if (is_reduced(pd.d)) {
+            // the reduced dimensions must be adjacent in memory and may
+            // not be blocked
+            if (part == inner_part || pd.is_blk) return status::unimplemented;
+            part = reduce_part;
+            reduce *= pd.size;
+            continue;
+        }
+        idle_pdims.push_back(pd);
+        if (part == outer_part) {
+            outer *= pd.size;
+        } else {
+            part = inner_part;
+            inner *= pd.size;
+        }
+    }
+
+    // the destination must keep the order and the blocking of the idle
+    // dimensions, densely
+    if (dst_pdims.size() != idle_pdims.size()) return status::unimplemented;
+    dim_t expected_stride = 1;
+    for (int i = (int)dst_pdims.size() - 1; i >= 0; --i) {
+        const auto &dpd = dst_pdims[i], &spd = idle_pdims[i];
+        if (dpd.d != spd.d || dpd.size != spd.size
+                || dpd.is_blk != spd.is_blk || dpd.stride != expected_stride)
+            return status::unimplemented;
+        expected_stride *= dpd.size;
+    }
+
+    auto &conf = conf_;
+    conf.alg = desc()->alg_kind;
+    conf.p = desc()->p;
+    conf.eps = desc()->eps;
+    conf.src_dt = src_d.data_type();
+    conf.dst_dt = dst_d.data_type();
+    conf.outer = outer;
+    conf.reduce = reduce;
+    conf.inner = inner;
+    conf.is_horizontal = inner == 1;
+    conf.simd_w = cpu_isa_traits<isa>::vlen / sizeof(float);
+    conf.nunits = conf.is_horizontal
+            ? outer
+            : outer * utils::div_up(inner, conf.simd_w);
+
+    // Split the reduction between threads only when the idle part cannot
+    // occupy them and there is enough work for a thread in the reduce part
+    conf.nthr = dnnl_get_max_threads();
+    conf.nthr_r = 1;
+    const dim_t min_reduce_per_thr = conf.is_horizontal ? 1024 : 64;
+    if (conf.nunits < conf.nthr && reduce >= 2 * min_reduce_per_thr)
+        conf.nthr_r = (int)nstl::min<dim_t>(
+                conf.nthr / conf.nunits, reduce / min_reduce_per_thr);
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+void jit_uni_reduction_t<isa>::pd_t::init_scratchpad() {
+    using namespace memory_tracking::names;
+    if (conf_.nthr_r == 1) return;
+
+    auto scratchpad = scratchpad_registry().registrar();
+    scratchpad.template book<float>(
+            key_reducer_space, conf_.nthr_r * conf_.outer * conf_.inner);
+}
+
+template <cpu_isa_t isa>
+jit_uni_reduction_t<isa>::jit_uni_reduction_t(const pd_t *apd)
+    : primitive_t(apd) {}
+
+template <cpu_isa_t isa>
+jit_uni_reduction_t<isa>::~jit_uni_reduction_t() = default;
+
+template <cpu_isa_t isa>
+status_t jit_uni_reduction_t<isa>::init(engine_t *engine) {
+    using namespace data_type;
+    const auto &conf = pd()->conf_;
+    const bool is_split = conf.nthr_r > 1;
+    const dim_t src_stride = conf.is_horizontal ? conf.reduce : conf.inner;
+
+    CHECK(safe_ptr_assign(kernel_,
+            new jit_uni_reduction_kernel_impl_t<isa>(conf, conf.src_dt,
+                    is_split ? f32 : conf.dst_dt, conf.is_horizontal, true,
+                    !is_split, src_stride)));
+    CHECK(kernel_->create_kernel());
+
+    if (!is_split) return status::success;
+
+    CHECK(safe_ptr_assign(kernel_finalize_,
+            new jit_uni_reduction_kernel_impl_t<isa>(conf, f32, conf.dst_dt,
+                    false, false, true, conf.outer * conf.inner)));
+    return kernel_finalize_->create_kernel();
+}
+
+template <cpu_isa_t isa>
+status_t jit_uni_reduction_t<isa>::execute(const exec_ctx_t &ctx) const {
+    using namespace memory_tracking::names;
+
+    auto src = CTX_IN_MEM(const char *, DNNL_ARG_SRC);
+    auto dst = CTX_OUT_MEM(char *, DNNL_ARG_DST);
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+    src += src_d.offset0() * src_d.data_type_size();
+    dst += dst_d.offset0() * dst_d.data_type_size();
+
+    const auto &conf = pd()->conf_;
+    const size_t src_dt_size = src_d.data_type_size();
+    const size_t dst_dt_size = dst_d.data_type_size();
+    const dim_t nb_inner = utils::div_up(conf.inner, conf.simd_w);
+
+    const bool is_split = conf.nthr_r > 1;
+    const dim_t ws_stride = conf.outer * conf.inner;
+    float *ws = is_split
+            ? ctx.get_scratchpad_grantor().template get<float>(
+                    key_reducer_space)
+            : nullptr;
+
+    // The work is distributed between conf.nthr "virtual" threads so that
+    // every row of the partial results is written even if the actual
+    // number of threads is smaller
+    const int nthr_w = conf.nthr / conf.nthr_r;
+    auto reduce_part = [&](int vthr) {
+        const int ithr_r = vthr % conf.nthr_r;
+        const int ithr_w = vthr / conf.nthr_r;
+        if (ithr_w >= nthr_w) return;
+
+        dim_t r_start {0}, r_end {0}, start {0}, end {0};
+        balance211(conf.reduce, conf.nthr_r, ithr_r, r_start, r_end);
+        balance211(conf.nunits, nthr_w, ithr_w, start, end);
+
+        char *out = is_split ? (char *)(ws + ithr_r * ws_stride) : dst;
+        const size_t out_dt_size = is_split ? sizeof(float) : dst_dt_size;
+
+        jit_reduction_args_t args;
+        args.reduce_len = r_end - r_start;
+        if (conf.is_horizontal) {
+            if (start >= end) return;
+            args.src = src + (start * conf.reduce + r_start) * src_dt_size;
+            args.dst = out + start * out_dt_size;
+            args.work_amount = end - start;
+            (*kernel_)(&args);
+            return;
+        }
+
+        while (start < end) {
+            const dim_t o = start / nb_inner, ib = start % nb_inner;
+            const dim_t ib_end = nstl::min(nb_inner, ib + (end - start));
+            const dim_t i_start = ib * conf.simd_w;
+            const dim_t i_end = nstl::min(conf.inner, ib_end * conf.simd_w);
+            args.src = src
+                    + ((o * conf.reduce + r_start) * conf.inner + i_start)
+                            * src_dt_size;
+            args.dst = out + (o * conf.inner + i_start) * out_dt_size;
+            args.work_amount = i_end - i_start;
+            (*kernel_)(&args);
+            start += ib_end - ib;
+        }
+    };
+
+    parallel(conf.nthr, [&](const int ithr, const int nthr) {
+        for (int vthr = ithr; vthr < conf.nthr; vthr += nthr)
+            reduce_part(vthr);
+    });
+
+    if (!is_split) return status::success;
+
+    const dim_t nb = utils::div_up(ws_stride, conf.simd_w);
+    parallel(conf.nthr, [&](const int ithr, const int nthr) {
+        dim_t start {0}, end {0};
+        balance211(nb, nthr, ithr, start, end);
+        if (start >= end) return;
+
+        const dim_t e_start = start * conf.simd_w;
+        const dim_t e_end = nstl::min(ws_stride, end * conf.simd_w);
+        jit_reduction_args_t args;
+        args.src = ws + e_start;
+        args.dst = dst + e_start * dst_dt_size;
+        args.reduce_len = conf.nthr_r;
+        args.work_amount = e_end - e_start;
+        (*kernel_finalize_)(&args);
+    });
+
+    return status::success;
+}
+
+template struct jit_uni_reduction_t<sse41>;
+template struct jit_uni_reduction_t<avx2>;
+template struct jit_uni_reduction_t<avx512_core>;
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
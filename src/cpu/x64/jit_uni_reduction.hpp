@@ -0,0 +1,101 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_JIT_UNI_REDUCTION_HPP
+#define CPU_X64_JIT_UNI_REDUCTION_HPP
+
+#include <memory>
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_reduction_pd.hpp"
+
+#include "cpu/x64/cpu_isa_traits.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+// The problem is viewed as a 3D array outer x reduce x inner in the physical
+// order of the dimensions: the reduced dimensions must be adjacent in memory,
+// the destination keeps the order of the idle (outer and inner) dimensions.
+//
+// When there is an inner dimension the kernel vectorizes over it and walks
+// the reduce dimension with a stride ("vertical" reduction). Otherwise the
+// reduce dimension itself is contiguous and the kernel vectorizes over it
+// followed by a horizontal reduction of the vector register.
+//
+// If the idle part is too small to occupy all the threads, the reduce
+// dimension is split between nthr_r threads. Each of them stores
+// non-finalized partial results to the scratchpad, which are then combined
+// and finalized by a vertical reduction over nthr_r rows.
+struct jit_reduction_conf_t {
+    alg_kind_t alg;
+    float p, eps;
+    data_type_t src_dt, dst_dt;
+
+    dim_t outer, reduce, inner;
+    bool is_horizontal; // inner == 1
+
+    int simd_w;
+    dim_t nunits; // number of independent pieces of work
+    int nthr, nthr_r; // total number of threads, threads per reduction
+};
+
+struct jit_uni_reduction_kernel_t;
+
+template <cpu_isa_t isa>
+struct jit_uni_reduction_t : public primitive_t {
+    struct pd_t : public cpu_reduction_pd_t {
+        using cpu_reduction_pd_t::cpu_reduction_pd_t;
+
+        DECLARE_COMMON_PD_T(
+                JIT_IMPL_NAME_HELPER("jit:", isa, ""), jit_uni_reduction_t);
+
+        status_t init(engine_t *engine);
+
+        jit_reduction_conf_t conf_;
+
+    private:
+        status_t init_conf();
+        void init_scratchpad();
+    };
+
+    jit_uni_reduction_t(const pd_t *apd);
+    ~jit_uni_reduction_t();
+
+    status_t init(engine_t *engine) override;
+
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    std::unique_ptr<jit_uni_reduction_kernel_t> kernel_;
+    // combines partial results when the reduction is split between threads
+    std::unique_ptr<jit_uni_reduction_kernel_t> kernel_finalize_;
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
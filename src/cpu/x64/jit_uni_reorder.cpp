@@ -20,7 +20,9 @@
 #include "oneapi/dnnl/dnnl_debug.h"
 
 #include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
 #include "common/memory_desc_wrapper.hpp"
+#include "common/memory_tracking.hpp"
 #include "common/nstl.hpp"
 #include "common/primitive.hpp"
 #include "common/type_helpers.hpp"
@@ -28,6 +30,7 @@
 
 #include "cpu/cpu_primitive.hpp"
 #include "cpu/cpu_reorder_pd.hpp"
+#include "cpu/platform.hpp"
 #include "cpu/x64/jit_uni_reorder.hpp"
 
 #include "cpu/x64/jit_avx512_core_bf16cvt.hpp"
@@ -125,17 +128,24 @@ struct jit_uni_reorder_kernel_f32_t : public kernel_t, public jit_generator {
         using namespace data_type;
 
         bool ok = true && p.ndims > 0
-                && utils::one_of(p.itype, f32, bf16, s32, s8, u8)
-                && utils::one_of(p.otype, f32, bf16, s32, s8, u8)
+                && utils::one_of(p.itype, f32, bf16, f16, s32, s8, u8)
+                && utils::one_of(p.otype, f32, bf16, f16, s32, s8, u8)
                 && IMPLICATION(p.itype == bf16,
                         utils::one_of(p.otype, s8, u8, f32, bf16))
                 && IMPLICATION(p.otype == bf16,
                         utils::one_of(p.itype, s8, u8, f32, bf16))
+                && IMPLICATION(p.itype == f16, utils::one_of(p.otype, f32, f16))
+                && IMPLICATION(p.otype == f16, utils::one_of(p.itype, f32, f16))
                 && utils::everyone_is(0, p.ioff, p.ooff) /* do we need this? */
                 && utils::one_of(p.beta, 0.f, 1.f) /* anything else? */
                 && simple_impl_desc_init(p, nullptr) && mayiuse(sse41)
-                && IMPLICATION((p.itype == bf16 || p.otype == bf16),
-                        mayiuse(avx512_core));
+                // widening bf16 takes integer instructions only, but
+                // rounding to bf16 relies on the avx512 emulation
+                && IMPLICATION(p.itype == bf16, mayiuse(avx2))
+                && IMPLICATION(p.otype == bf16, mayiuse(avx512_core))
+                // f16 conversions rely on F16C, which comes with avx2
+                && IMPLICATION((p.itype == f16 || p.otype == f16),
+                        mayiuse(avx2));
         if (!ok) return false;
 
         const ptrdiff_t max_stride = (1LL << 31) - 1;
@@ -166,6 +176,10 @@ struct jit_uni_reorder_kernel_f32_t : public kernel_t, public jit_generator {
         assert(d < prb_.ndims);
         return (int)prb_.nodes[d].ss;
     }
+    int cs(int d) {
+        assert(d < prb_.ndims);
+        return (int)prb_.nodes[d].cs;
+    }
 
     Address i_addr(int i_off) {
         return ptr[reg_ptr_in + reg_off_in + i_off * itype_sz];
@@ -179,11 +193,21 @@ struct jit_uni_reorder_kernel_f32_t : public kernel_t, public jit_generator {
         return ptr[reg_ptr_scale + reg_off_scale + s_off * stype_sz];
     }
 
+    Address c_addr(int c_off) {
+        return ptr[reg_ptr_comp + reg_off_comp + c_off * ctype_sz];
+    }
+
+    bool compensation_needed() const {
+        return prb_.req_s8s8_comp || prb_.req_asymmetric_comp;
+    }
+
     void step(int off, int prev_i_off, int prev_o_off, int prev_s_off,
-            int &i_off, int &o_off, int &s_off, int step_size = 1) {
+            int prev_c_off, int &i_off, int &o_off, int &s_off, int &c_off,
+            int step_size = 1) {
         i_off = prev_i_off;
         o_off = prev_o_off;
         s_off = prev_s_off;
+        c_off = prev_c_off;
 
         if (off == 0) return;
 
@@ -197,12 +221,14 @@ struct jit_uni_reorder_kernel_f32_t : public kernel_t, public jit_generator {
             i_off += is(d);
             o_off += os(d);
             s_off += ss(d);
+            c_off += cs(d);
 
             if (off % n(d)) break;
 
             i_off += -n(d) * is(d);
             o_off += -n(d) * os(d);
             s_off += -n(d) * ss(d);
+            c_off += -n(d) * cs(d);
             off /= n(d);
 
             if (off == 0) break; /* FIXME: is it really required? */
@@ -212,8 +238,8 @@ struct jit_uni_reorder_kernel_f32_t : public kernel_t, public jit_generator {
     void step(int off, int prev_i_off, int prev_o_off, int &i_off, int &o_off,
             int step_size = 1) {
         int dummy = 0;
-        step(off, prev_i_off, prev_o_off, dummy, i_off, o_off, dummy,
-                step_size);
+        step(off, prev_i_off, prev_o_off, dummy, dummy, i_off, o_off, dummy,
+                dummy, step_size);
     }
 
     void tr8x8_avx2(int i_off, int o_off) {
@@ -309,11 +335,13 @@ struct jit_uni_reorder_kernel_f32_t : public kernel_t, public jit_generator {
             }
         };
 
-        auto store = [=](const Address &addr, const Ymm &ymm, int size) {
+        auto store = [=](int o_off, const Ymm &ymm, int size) {
             Xmm xmm = Xmm(ymm.getIdx());
+            const bool nt = use_nt_store(o_off, size);
+            const auto addr = o_addr(o_off);
             switch (size) {
-                case 32: vmovups(addr, ymm); break;
-                case 16: vmovups(addr, xmm); break;
+                case 32: nt ? vmovntps(addr, ymm) : vmovups(addr, ymm); break;
+                case 16: nt ? vmovntps(addr, xmm) : vmovups(addr, xmm); break;
                 case 8: vmovsd(addr, xmm); break;
                 default: assert(!"unreachable");
             }
@@ -367,7 +395,7 @@ struct jit_uni_reorder_kernel_f32_t : public kernel_t, public jit_generator {
         for (int i = 0; i < unroll; i++) {
             if (prb_.otype != f32)
                 cvt2odt(Ymm(i), prb_.otype, interim_f32 ? f32 : prb_.itype);
-            store(o_addr(o_off + i * os(1)), Ymm(i), unroll * otype_sz);
+            store(o_off + i * os(1), Ymm(i), unroll * otype_sz);
         }
     }
 
@@ -379,7 +407,8 @@ struct jit_uni_reorder_kernel_f32_t : public kernel_t, public jit_generator {
                         && utils::one_of(prb_.otype, u8, s8, s32, f32, bf16)))
                 && utils::everyone_is(8, n(0), n(1))
                 && utils::everyone_is(1, os(0), is(1))
-                && prb_.scale_type == scale_type_t::NONE && prb_.beta == 0.f;
+                && prb_.scale_type == scale_type_t::NONE && prb_.beta == 0.f
+                && !compensation_needed();
     }
 
     bool process_unroll_tr8x8(int len) {
@@ -408,7 +437,8 @@ struct jit_uni_reorder_kernel_f32_t : public kernel_t, public jit_generator {
                         || (prb_.itype == s32 && prb_.otype == f32)
                         || (prb_.itype == f32 && prb_.otype == s32))
                 && len % simd_w == 0 && n(0) % len == 0
-                && prb_.scale_type == scale_type_t::NONE && prb_.beta == 0.f;
+                && prb_.scale_type == scale_type_t::NONE && prb_.beta == 0.f
+                && !compensation_needed();
         if (!can_do) return false;
 
         for (int off = 0; off < len;) {
@@ -430,8 +460,13 @@ struct jit_uni_reorder_kernel_f32_t : public kernel_t, public jit_generator {
                 }
             }
 
-            for (int ur = 0; ur < unroll; ++ur)
-                uni_vmovups(o_addr(off + ur * simd_w), Vmm(ur));
+            for (int ur = 0; ur < unroll; ++ur) {
+                const int o_off = off + ur * simd_w;
+                if (use_nt_store(o_off, cpu_isa_traits<isa>::vlen))
+                    uni_vmovntps(o_addr(o_off), Vmm(ur));
+                else
+                    uni_vmovups(o_addr(o_off), Vmm(ur));
+            }
 
             off += unroll * simd_w;
         }
@@ -439,8 +474,39 @@ struct jit_uni_reorder_kernel_f32_t : public kernel_t, public jit_generator {
         return true;
     }
 
+    /** adds n s8 values from the low bytes of xmm to the compensation
+     * accumulators at c_off[0..n) */
+    void accumulate_comp(const Xmm &xmm, const int *c_off, int n) {
+        assert(utils::one_of(n, 1, 4));
+        pmovsxbd(xmm_comp_tmp, xmm);
+
+        bool bcast = true, load = true;
+        for (int r = 1; r < n; ++r) {
+            if (c_off[r] != c_off[0]) bcast = false;
+            if (c_off[r] != c_off[0] + r) load = false;
+        }
+
+        if (n == 1 || bcast) {
+            if (n > 1) {
+                phaddd(xmm_comp_tmp, xmm_comp_tmp);
+                phaddd(xmm_comp_tmp, xmm_comp_tmp);
+            }
+            movd(reg_tmp.cvt32(), xmm_comp_tmp);
+            add(c_addr(c_off[0]), reg_tmp.cvt32());
+        } else if (load) {
+            movdqu(xmm_comp_acc, c_addr(c_off[0]));
+            paddd(xmm_comp_acc, xmm_comp_tmp);
+            movdqu(c_addr(c_off[0]), xmm_comp_acc);
+        } else {
+            for (int r = 0; r < n; ++r) {
+                pextrd(reg_tmp.cvt32(), xmm_comp_tmp, r);
+                add(c_addr(c_off[r]), reg_tmp.cvt32());
+            }
+        }
+    }
+
     void process_unroll_generic_step(int reg_unroll, const int *i_off,
-            const int *o_off, const int *s_off) {
+            const int *o_off, const int *s_off, const int *c_off) {
         using namespace data_type;
 
         // TODO: Clean up the code by using "uni" instructions once
@@ -459,6 +525,7 @@ struct jit_uni_reorder_kernel_f32_t : public kernel_t, public jit_generator {
                         vpmovzxwd(dst, src);
                         vpslld(dst, dst, 0x10);
                         break;
+                    case f16: vcvtph2ps(dst, src); break;
                     case s32: vcvtdq2ps(dst, src); break;
                     case s8:
                         vpmovsxbd(dst, src);
@@ -505,6 +572,10 @@ struct jit_uni_reorder_kernel_f32_t : public kernel_t, public jit_generator {
                             }
                         }
                         break;
+                    case f16:
+                        // round to nearest even, as the reference does
+                        if (idt == f32) vcvtps2ph(xmm, xmm, 0x0);
+                        break;
                     case s32:
                         if (idt == f32)
                             vcvtps2dq(xmm, xmm);
@@ -584,9 +655,15 @@ struct jit_uni_reorder_kernel_f32_t : public kernel_t, public jit_generator {
             }
         };
 
-        auto store = [=](const Address &addr, const Xmm &xmm, int size) {
+        auto store = [=](int o_off, const Xmm &xmm, int size) {
+            const auto addr = o_addr(o_off);
             switch (size) {
-                case 16: movups(addr, xmm); break;
+                case 16:
+                    if (use_nt_store(o_off, size))
+                        movntps(addr, xmm);
+                    else
+                        movups(addr, xmm);
+                    break;
                 case 8: movsd(addr, xmm); break;
                 case 4: movss(addr, xmm); break;
                 case 2: pextrw(addr, xmm, 0x0); break;
@@ -668,6 +745,8 @@ struct jit_uni_reorder_kernel_f32_t : public kernel_t, public jit_generator {
                         else
                             pextrb(o_addr(o_off[ur + r]), Xmm(ur), r);
                     }
+                    if (compensation_needed())
+                        accumulate_comp(Xmm(ur), c_off + ur, load_step);
                 }
                 return;
             }
@@ -785,7 +864,7 @@ struct jit_uni_reorder_kernel_f32_t : public kernel_t, public jit_generator {
                             vmovss(xmm_tmp, o_addr(o_off[ur]));
                         } else if (utils::one_of(prb_.otype, s8, u8)) {
                             pinsrb(xmm_tmp, o_addr(o_off[ur]), 0x0);
-                        } else if (prb_.otype == bf16) {
+                        } else if (utils::one_of(prb_.otype, bf16, f16)) {
                             pinsrw(xmm_tmp, o_addr(o_off[ur]), 0x0);
                         } else {
                             assert(!"unsupported o_type");
@@ -812,7 +891,9 @@ struct jit_uni_reorder_kernel_f32_t : public kernel_t, public jit_generator {
         for (int ur = 0; ur < reg_unroll; ur += ur_step) {
             if (prb_.otype != f32)
                 cvt2odt(Xmm(ur), prb_.otype, interim_f32 ? f32 : prb_.itype);
-            store(o_addr(o_off[ur]), Xmm(ur), ur_step * otype_sz);
+            store(o_off[ur], Xmm(ur), ur_step * otype_sz);
+            if (compensation_needed())
+                accumulate_comp(Xmm(ur), c_off + ur, ur_step);
         }
     }
 
@@ -822,6 +903,7 @@ struct jit_uni_reorder_kernel_f32_t : public kernel_t, public jit_generator {
         int i_off[2 * blk] = {0};
         int o_off[2 * blk] = {0};
         int s_off[2 * blk] = {0};
+        int c_off[2 * blk] = {0};
 
         int curr = 0; // will switch between 0 and 1
 
@@ -833,11 +915,13 @@ struct jit_uni_reorder_kernel_f32_t : public kernel_t, public jit_generator {
                 const int ur_c = curr * blk + ur;
                 const int ur_p = (ur_c - 1 + 2 * blk) % (2 * blk); // prev ur
                 step(off + ur, i_off[ur_p], o_off[ur_p], s_off[ur_p],
-                        i_off[ur_c], o_off[ur_c], s_off[ur_c]);
+                        c_off[ur_p], i_off[ur_c], o_off[ur_c], s_off[ur_c],
+                        c_off[ur_c]);
             }
 
             process_unroll_generic_step(reg_unroll, i_off + curr * blk,
-                    o_off + curr * blk, s_off + curr * blk);
+                    o_off + curr * blk, s_off + curr * blk,
+                    c_off + curr * blk);
 
             curr = 1 - curr;
         }
@@ -849,11 +933,13 @@ struct jit_uni_reorder_kernel_f32_t : public kernel_t, public jit_generator {
     }
 
     void loop_end(Label &l, Reg64 reg_cnt, int len, int i_step, int o_step,
-            int s_step) {
+            int s_step, int c_step) {
         add(reg_off_in, i_step * itype_sz);
         add(reg_off_out, o_step * otype_sz);
         if (prb_.scale_type == scale_type_t::MANY)
             add(reg_off_scale, s_step * stype_sz);
+        if (compensation_needed())
+            add(reg_off_comp, c_step * ctype_sz);
         dec(reg_cnt);
         jnz(l);
 
@@ -861,6 +947,8 @@ struct jit_uni_reorder_kernel_f32_t : public kernel_t, public jit_generator {
         sub(reg_off_out, len * o_step * otype_sz);
         if (prb_.scale_type == scale_type_t::MANY)
             sub(reg_off_scale, len * s_step * stype_sz);
+        if (compensation_needed())
+            sub(reg_off_comp, len * c_step * ctype_sz);
     }
 
     bool simple_impl() {
@@ -876,6 +964,7 @@ struct jit_uni_reorder_kernel_f32_t : public kernel_t, public jit_generator {
         xor_(reg_off_out, reg_off_out);
         if (prb_.scale_type == scale_type_t::MANY)
             xor_(reg_off_scale, reg_off_scale);
+        if (compensation_needed()) xor_(reg_off_comp, reg_off_comp);
 
         Label l_loop[3];
         Reg64 reg_cnt[3] = {r15, r14, r13};
@@ -895,15 +984,15 @@ struct jit_uni_reorder_kernel_f32_t : public kernel_t, public jit_generator {
 
         if (n_jit_loops > 0)
             loop_end(l_loop[0], reg_cnt[0], n(nfu + 0) / ldu, is(nfu + 0) * ldu,
-                    os(nfu + 0) * ldu, ss(nfu + 0) * ldu);
+                    os(nfu + 0) * ldu, ss(nfu + 0) * ldu, cs(nfu + 0) * ldu);
 
         if (n_jit_loops > 1)
             loop_end(l_loop[1], reg_cnt[1], n(nfu + 1), is(nfu + 1),
-                    os(nfu + 1), ss(nfu + 1));
+                    os(nfu + 1), ss(nfu + 1), cs(nfu + 1));
 
         if (n_jit_loops > 2)
             loop_end(l_loop[2], reg_cnt[2], n(nfu + 2), is(nfu + 2),
-                    os(nfu + 2), ss(nfu + 2));
+                    os(nfu + 2), ss(nfu + 2), cs(nfu + 2));
 
         return true;
     }
@@ -913,11 +1002,32 @@ struct jit_uni_reorder_kernel_f32_t : public kernel_t, public jit_generator {
         assert(!"no implementation available");
     }
 
+    /** Non-temporal stores require the address to be aligned on the store
+     * size. The output pointer is aligned on nt_store_align and the offsets
+     * added by the jit loops are multiples of it (see nt_store_ok()), hence
+     * it is enough to check the offset within the unrolled part. */
+    bool use_nt_store(int o_off, int size) const {
+        return nt_store_ && size >= 16 && (o_off * otype_sz) % size == 0;
+    }
+
+    bool nt_store_ok() const {
+        simple_impl_desc_t d;
+        if (!desc_.nt_store || !simple_impl_desc_init(prb_, &d)) return false;
+        for (int dim = d.ndims_full_unroll; dim < prb_.ndims; ++dim) {
+            const ptrdiff_t step = prb_.nodes[dim].os
+                    * (dim == d.ndims_full_unroll ? d.len_last_dim_unroll : 1);
+            if ((step * otype_sz) % nt_store_align != 0) return false;
+        }
+        return true;
+    }
+
     jit_uni_reorder_kernel_f32_t(const desc_t &desc)
         : kernel_t(desc), bf16_emu_(nullptr) {
         itype_sz = data_type_size(prb_.itype);
         otype_sz = data_type_size(prb_.otype);
         stype_sz = sizeof(float);
+        ctype_sz = sizeof(int32_t);
+        nt_store_ = nt_store_ok();
         if (prb_.otype == data_type::bf16 && !mayiuse(avx512_core_bf16)) {
             bf16_emu_ = new bf16_emulation_t(this, bf16_emu_reserv_1,
                     bf16_emu_reserv_2, bf16_emu_reserv_3, bf16_emu_scratch,
@@ -941,6 +1051,7 @@ struct jit_uni_reorder_kernel_f32_t : public kernel_t, public jit_generator {
         } else if (prb_.scale_type == scale_type_t::MANY) {
             mov(reg_ptr_scale, PARAM(scale));
         }
+        if (compensation_needed()) mov(reg_ptr_comp, PARAM(comp));
         mov(reg_ptr_in, PARAM(in));
         mov(reg_ptr_out, PARAM(out));
 #undef PARAM
@@ -965,6 +1076,8 @@ struct jit_uni_reorder_kernel_f32_t : public kernel_t, public jit_generator {
         }
 
         impl();
+        // make the streaming stores globally visible before returning
+        if (nt_store_) sfence();
         postamble();
     }
     ~jit_uni_reorder_kernel_f32_t() override { delete bf16_emu_; }
@@ -973,6 +1086,8 @@ private:
     int itype_sz;
     int otype_sz;
     int stype_sz;
+    int ctype_sz;
+    bool nt_store_;
 
     Reg64 reg_ptr_in = rsi;
     Reg64 reg_ptr_out = rdx;
@@ -982,6 +1097,9 @@ private:
     Reg64 reg_off_out = r9;
     Reg64 reg_off_scale = r10;
 
+    Reg64 reg_ptr_comp = r11;
+    Reg64 reg_off_comp = r12;
+
     Reg64 reg_tmp = rax;
 
     Xmm xmm_scale = xmm15;
@@ -992,6 +1110,8 @@ private:
     Xmm xmm_tmp = xmm12;
     Xmm xmm_saturation_ubound = xmm12;
     Ymm ymm_saturation_ubound = ymm12;
+    Xmm xmm_comp_tmp = xmm10;
+    Xmm xmm_comp_acc = xmm11;
 
     /* bf16 support on SKX */
     bf16_emulation_t *bf16_emu_;
@@ -1476,6 +1596,31 @@ static void prb_thread_kernel_balance(
     }
 }
 
+/** decides whether the output should be written with non-temporal stores.
+ * That pays off for outputs which do not fit into the last level cache: such
+ * outputs are not reused from the cache anyway, while regular stores would
+ * evict the useful data and waste the bandwidth on reading the output lines
+ * for ownership. */
+static bool prb_use_nt_store(const tr::prb_t &prb, int ndims_ker, int nthr) {
+    // the output must be written only, in full vectors
+    const size_t otype_sz = data_type_size(prb.otype);
+    if (prb.beta != 0.f || otype_sz != 4) return false;
+
+    size_t sz_total = otype_sz;
+    for (int d = 0; d < prb.ndims; ++d)
+        sz_total *= prb.nodes[d].n;
+    const size_t llc_size = (size_t)platform::get_per_core_cache_size(3)
+            * nstl::max(nthr, (int)platform::get_num_cores());
+    if (sz_total < llc_size) return false;
+
+    // the pointers passed to the kernel by the driver must stay aligned
+    for (int d = ndims_ker; d < prb.ndims; ++d)
+        if ((prb.nodes[d].os * otype_sz) % tr::kernel_t::nt_store_align != 0)
+            return false;
+
+    return true;
+}
+
 struct jit_uni_reorder_t : public primitive_t {
     struct pd_t : public cpu_reorder_pd_t {
         using cpu_reorder_pd_t::cpu_reorder_pd_t;
@@ -1528,6 +1673,8 @@ struct jit_uni_reorder_t : public primitive_t {
             if (ndims_driver > jit_uni_reorder_t::ndims_driver_max)
                 return status::unimplemented;
 
+            ker_desc.nt_store = prb_use_nt_store(prb, ker_desc.prb.ndims, nthr);
+
             DEBUG({
                 printf("ker  : ");
                 prb_dump(ker_desc.prb);
@@ -1542,38 +1689,69 @@ struct jit_uni_reorder_t : public primitive_t {
             }
             _pd->prb_ = prb;
             _pd->ker_desc_ = ker_desc;
-            _pd->init_scratchpad_md();
             _pd->nthr_ = nthr;
+            _pd->init_scratchpad();
+            _pd->init_scratchpad_md();
             return safe_ptr_assign(*reorder_pd, _pd);
         }
 
+        bool with_comp() const {
+            return prb_.req_s8s8_comp || prb_.req_asymmetric_comp;
+        }
+
         tr::prb_t prb_;
         tr::kernel_t::desc_t ker_desc_;
         int nthr_;
+        dim_t comp_size_ = 0;
+
+    private:
+        void init_scratchpad() {
+            using namespace memory_tracking::names;
+            auto scratchpad = scratchpad_registry().registrar();
+
+            if (with_comp()) {
+                /* the masks are the same if both compensations are present,
+                 * see tr::prb_init() */
+                const memory_desc_wrapper od(dst_md());
+                const int mask = prb_.req_s8s8_comp
+                        ? od.extra().compensation_mask
+                        : od.extra().asymm_compensation_mask;
+                comp_size_ = 1;
+                for (int d = 0; d < od.ndims(); ++d)
+                    if (mask & (1 << d)) comp_size_ *= od.padded_dims()[d];
+                // every thread accumulates its own partial sums
+                scratchpad.book<int32_t>(key_reorder_space, nthr_ * comp_size_);
+            }
+
+            if (prb_.scale_adjust != 1.f)
+                scratchpad.book<float>(
+                        key_reorder_scales, attr()->output_scales_.count_);
+        }
     };
 
     jit_uni_reorder_t(const pd_t *apd) : primitive_t(apd) {}
 
-    void omp_driver_0d(
-            int off, const char *in, char *out, const float *scale) const {
-        tr::call_param_t c {in, out, scale};
-        (*kernel_)(&c);
+    void omp_driver_0d(int off, const char *in, char *out, const float *scale,
+            int32_t *comp, const tr::kernel_t *ker) const {
+        tr::call_param_t c {in, out, scale, comp};
+        (*ker)(&c);
     }
 
     void omp_driver_1d(int ithr, int nthr, int off, const char *in, char *out,
-            const float *scale) const {
+            const float *scale, int32_t *comp, const tr::kernel_t *ker) const {
         const tr::node_t *ns = pd()->prb_.nodes + off;
         for_nd(ithr, nthr, (ptrdiff_t)ns[0].n, [&](ptrdiff_t d0) {
             auto c = tr::call_param_t();
             c.in = in + d0 * ns[0].is * data_type_size(pd()->prb_.itype);
             c.out = out + d0 * ns[0].os * data_type_size(pd()->prb_.otype);
             c.scale = scale + d0 * ns[0].ss;
-            (*kernel_)(&c);
+            c.comp = comp + d0 * ns[0].cs;
+            (*ker)(&c);
         });
     }
 
     void omp_driver_2d(int ithr, int nthr, int off, const char *in, char *out,
-            const float *scale) const {
+            const float *scale, int32_t *comp, const tr::kernel_t *ker) const {
         const tr::node_t *ns = pd()->prb_.nodes + off;
         for_nd(ithr, nthr, (ptrdiff_t)ns[1].n, (ptrdiff_t)ns[0].n,
                 [&](ptrdiff_t d1, ptrdiff_t d0) {
@@ -1585,12 +1763,13 @@ struct jit_uni_reorder_t : public primitive_t {
                             + (d0 * ns[0].os + d1 * ns[1].os)
                                     * data_type_size(pd()->prb_.otype);
                     c.scale = scale + d0 * ns[0].ss + d1 * ns[1].ss;
-                    (*kernel_)(&c);
+                    c.comp = comp + d0 * ns[0].cs + d1 * ns[1].cs;
+                    (*ker)(&c);
                 });
     }
 
     void omp_driver_3d(int ithr, int nthr, int off, const char *in, char *out,
-            const float *scale) const {
+            const float *scale, int32_t *comp, const tr::kernel_t *ker) const {
         const tr::node_t *ns = pd()->prb_.nodes + off;
         for_nd(ithr, nthr, (ptrdiff_t)ns[2].n, (ptrdiff_t)ns[1].n,
                 (ptrdiff_t)ns[0].n,
@@ -1604,12 +1783,14 @@ struct jit_uni_reorder_t : public primitive_t {
                                     * data_type_size(pd()->prb_.otype);
                     c.scale = scale + d0 * ns[0].ss + d1 * ns[1].ss
                             + d2 * ns[2].ss;
-                    (*kernel_)(&c);
+                    c.comp = comp + d0 * ns[0].cs + d1 * ns[1].cs
+                            + d2 * ns[2].cs;
+                    (*ker)(&c);
                 });
     }
 
     void omp_driver_4d(int ithr, int nthr, int off, const char *in, char *out,
-            const float *scale) const {
+            const float *scale, int32_t *comp, const tr::kernel_t *ker) const {
         const tr::node_t *ns = pd()->prb_.nodes + off;
         for_nd(ithr, nthr, (ptrdiff_t)ns[3].n, (ptrdiff_t)ns[2].n,
                 (ptrdiff_t)ns[1].n, (ptrdiff_t)ns[0].n,
@@ -1625,11 +1806,14 @@ struct jit_uni_reorder_t : public primitive_t {
                                     * data_type_size(pd()->prb_.otype);
                     c.scale = scale + d0 * ns[0].ss + d1 * ns[1].ss
                             + d2 * ns[2].ss + d3 * ns[3].ss;
-                    (*kernel_)(&c);
+                    c.comp = comp + d0 * ns[0].cs + d1 * ns[1].cs
+                            + d2 * ns[2].cs + d3 * ns[3].cs;
+                    (*ker)(&c);
                 });
     }
 
-    void omp_driver(const char *in, char *out, const float *scale) const {
+    void omp_driver(const char *in, char *out, const float *scale,
+            int32_t *comp) const {
         in += pd()->prb_.ioff * data_type_size(pd()->prb_.itype);
         out += pd()->prb_.ooff * data_type_size(pd()->prb_.otype);
 
@@ -1646,40 +1830,87 @@ struct jit_uni_reorder_t : public primitive_t {
         int ndims_ker = pd()->ker_desc_.prb.ndims;
         assert(ndims - ndims_ker <= ndims_driver_max);
 
+        // the streaming stores kernel requires an aligned output
+        const bool use_nt_kernel = kernel_nt_
+                && (uintptr_t)out % tr::kernel_t::nt_store_align == 0;
+        const tr::kernel_t *ker
+                = use_nt_kernel ? kernel_nt_.get() : kernel_.get();
+
+        auto driver = [&](const int ithr, const int nthr) {
+            int32_t *thr_comp = comp ? comp + ithr * pd()->comp_size_ : nullptr;
+            switch (ndims - ndims_ker) {
+                case 1:
+                    omp_driver_1d(ithr, nthr, ndims_ker, in, out, scale,
+                            thr_comp, ker);
+                    break;
+                case 2:
+                    omp_driver_2d(ithr, nthr, ndims_ker, in, out, scale,
+                            thr_comp, ker);
+                    break;
+                case 3:
+                    omp_driver_3d(ithr, nthr, ndims_ker, in, out, scale,
+                            thr_comp, ker);
+                    break;
+                case 4:
+                    omp_driver_4d(ithr, nthr, ndims_ker, in, out, scale,
+                            thr_comp, ker);
+                    break;
+                default: assert(!"unimplemented");
+            }
+        };
+
         if (ndims - ndims_ker == 0) {
-            omp_driver_0d(ndims_ker, in, out, scale);
+            omp_driver_0d(ndims_ker, in, out, scale, comp, ker);
+        } else if (comp == nullptr && platform::has_hybrid_cores()) {
+            // Without per-thread compensation buffers the blocks are
+            // independent, so on hybrid parts they are scheduled dynamically
+            // to not make the fast cores wait for the slow ones
+            parallel_dynamic_ithr(pd()->nthr_, driver);
         } else {
-            parallel(pd()->nthr_, [&](const int ithr, const int nthr) {
-                switch (ndims - ndims_ker) {
-                    case 1:
-                        omp_driver_1d(ithr, nthr, ndims_ker, in, out, scale);
-                        break;
-                    case 2:
-                        omp_driver_2d(ithr, nthr, ndims_ker, in, out, scale);
-                        break;
-                    case 3:
-                        omp_driver_3d(ithr, nthr, ndims_ker, in, out, scale);
-                        break;
-                    case 4:
-                        omp_driver_4d(ithr, nthr, ndims_ker, in, out, scale);
-                        break;
-                    default: assert(!"unimplemented");
-                }
-            });
+            parallel(pd()->nthr_, driver);
         }
     }
 
     status_t init(engine_t *engine) override {
-        CHECK(safe_ptr_assign(kernel_, tr::kernel_t::create(pd()->ker_desc_)));
+        auto ker_desc = pd()->ker_desc_;
+        if (ker_desc.nt_store) {
+            CHECK(safe_ptr_assign(kernel_nt_, tr::kernel_t::create(ker_desc)));
+            CHECK(kernel_nt_->create_kernel());
+            ker_desc.nt_store = false;
+        }
+        CHECK(safe_ptr_assign(kernel_, tr::kernel_t::create(ker_desc)));
         return kernel_->create_kernel();
     }
 
     status_t execute(const exec_ctx_t &ctx) const override {
+        using namespace memory_tracking::names;
+
         auto in = CTX_IN_MEM(const char *, DNNL_ARG_FROM);
         auto out = CTX_OUT_MEM(char *, DNNL_ARG_TO);
         DEFINE_SCALES_BUFFER(scales);
 
-        omp_driver(in, out, scales);
+        const auto &prb = pd()->prb_;
+        const auto &scratchpad = ctx.get_scratchpad_grantor();
+
+        if (prb.scale_adjust != 1.f) {
+            const auto &oscales = pd()->attr()->output_scales_;
+            float *adj_scales = scratchpad.template get<float>(
+                    key_reorder_scales);
+            for (dim_t c = 0; c < oscales.count_; ++c)
+                adj_scales[c] = oscales.scales_[c] * prb.scale_adjust;
+            scales = adj_scales;
+        }
+
+        int32_t *comp = nullptr;
+        const dim_t comp_size = pd()->comp_size_;
+        if (pd()->with_comp()) {
+            comp = scratchpad.template get<int32_t>(key_reorder_space);
+            parallel_nd(pd()->nthr_ * comp_size, [&](dim_t i) { comp[i] = 0; });
+        }
+
+        omp_driver(in, out, scales, comp);
+
+        if (pd()->with_comp()) reduce_compensation(out, comp);
 
         return status::success;
     }
@@ -1688,7 +1919,32 @@ struct jit_uni_reorder_t : public primitive_t {
 
 private:
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    /* sums up the per thread accumulators and stores the compensation to
+     * the buffer that follows the output data */
+    void reduce_compensation(char *out, const int32_t *thr_comp) const {
+        const auto &prb = pd()->prb_;
+        const memory_desc_wrapper od(pd()->dst_md());
+        const dim_t comp_size = pd()->comp_size_;
+        const int nthr = pd()->nthr_;
+
+        int32_t *cp = reinterpret_cast<int32_t *>(
+                out + od.size() - od.additional_buffer_size());
+        int32_t *zp = prb.req_asymmetric_comp
+                ? cp + (prb.req_s8s8_comp ? comp_size : 0)
+                : nullptr;
+
+        parallel_nd(comp_size, [&](dim_t i) {
+            int32_t acc = 0;
+            for (int ithr = 0; ithr < nthr; ++ithr)
+                acc += thr_comp[ithr * comp_size + i];
+            if (prb.req_s8s8_comp) cp[i] = -128 * acc;
+            if (zp) zp[i] = -acc;
+        });
+    }
+
     std::unique_ptr<tr::kernel_t> kernel_;
+    std::unique_ptr<tr::kernel_t> kernel_nt_; // with non-temporal stores
 };
 
 struct jit_blk_reorder_t : public primitive_t {
@@ -1817,6 +2073,12 @@ status_t jit_uni_reorder_create(reorder_pd_t **reorder_pd, engine_t *engine,
         const primitive_attr_t *attr, engine_t *src_engine,
         const memory_desc_t *src_md, engine_t *dst_engine,
         const memory_desc_t *dst_md) {
+    // leave tiny reorders to the simple implementations, which do not need
+    // any code generation at creation time
+    if (is_small_reorder(src_md) && attr->has_default_values()
+            && dst_md->extra.flags == memory_extra_flags::none)
+        return status::unimplemented;
+
     auto ret = jit_blk_reorder_t::pd_t::create(
             reorder_pd, engine, attr, src_engine, src_md, dst_engine, dst_md);
     if (status::success != ret)
@@ -38,6 +38,7 @@ struct node_t {
     ptrdiff_t is; // input stride
     ptrdiff_t os; // output stride
     ptrdiff_t ss; // scale stride
+    ptrdiff_t cs; // compensation stride
 };
 
 enum class scale_type_t { NONE, COMMON, MANY };
@@ -51,6 +52,11 @@ struct prb_t {
     ptrdiff_t ooff;
     scale_type_t scale_type;
     float beta;
+    /* int8 weights preparation: the kernel accumulates the sums of the
+     * output values, the final compensation is computed by the driver */
+    bool req_s8s8_comp = false;
+    bool req_asymmetric_comp = false;
+    float scale_adjust = 1.f;
 };
 
 status_t prb_init(prb_t &prb, const memory_desc_t &imd,
@@ -81,14 +87,20 @@ struct call_param_t {
     const void *in;
     void *out;
     const float *scale;
+    int32_t *comp;
 };
 
 struct kernel_t {
     struct desc_t {
         int id;
         prb_t prb;
+        /** use non-temporal stores where the output alignment allows that,
+         * requires the output pointer to be aligned on nt_store_align */
+        bool nt_store = false;
     };
 
+    static constexpr int nt_store_align = 32;
+
     kernel_t(const desc_t &desc) : desc_(desc) {}
     virtual void operator()(const call_param_t *c) const = 0;
     virtual status_t create_kernel() = 0;
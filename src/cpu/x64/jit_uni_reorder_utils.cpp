@@ -49,7 +49,7 @@ status_t cvt_mem_desc_to_layout_desc(
         const memory_desc_t &md_, layout_desc_t &ld, const dims_t &blocks) {
     const auto md = memory_desc_wrapper(md_);
 
-    bool ok = true && md.is_blocking_desc() && md.extra().flags == 0;
+    bool ok = true && md.is_blocking_desc();
     if (!ok) return invalid_arguments;
 
     const auto &bd = md.blocking_desc();
@@ -110,6 +110,34 @@ status_t prb_init(prb_t &p, const memory_desc_t &imd, const memory_desc_t &omd,
             && check_post_ops(attr);
     if (!ok) return unimplemented;
 
+    /* only the compensation for int8 convolution weights is supported,
+     * the compensation buffer follows the data and is not processed by the
+     * layout descriptors below */
+    using namespace memory_extra_flags;
+    const auto &oextra = om_d.extra();
+    p.req_s8s8_comp = oextra.flags & compensation_conv_s8s8;
+    p.req_asymmetric_comp = oextra.flags & compensation_conv_asymmetric_src;
+    p.scale_adjust
+            = (oextra.flags & scale_adjust) ? oextra.scale_adjust : 1.f;
+    const bool with_comp = p.req_s8s8_comp || p.req_asymmetric_comp;
+    const int comp_mask = p.req_s8s8_comp ? oextra.compensation_mask
+                                          : oextra.asymm_compensation_mask;
+
+    ok = im_d.extra().flags == 0
+            && (oextra.flags
+                       & ~(compensation_conv_s8s8
+                               | compensation_conv_asymmetric_src
+                               | scale_adjust))
+                    == 0
+            && IMPLICATION(with_comp,
+                    om_d.data_type() == data_type::s8
+                            && attr->post_ops_.len() == 0)
+            && IMPLICATION(p.req_s8s8_comp && p.req_asymmetric_comp,
+                    oextra.compensation_mask == oextra.asymm_compensation_mask)
+            && IMPLICATION(p.scale_adjust != 1.f,
+                    attr->output_scales_.defined());
+    if (!ok) return unimplemented;
+
     dims_t iblocks, oblocks;
     im_d.compute_blocks(iblocks);
     om_d.compute_blocks(oblocks);
@@ -135,6 +163,9 @@ status_t prb_init(prb_t &p, const memory_desc_t &imd, const memory_desc_t &omd,
             ? scale_type_t::NONE
             : (attr->output_scales_.mask_ == 0 ? scale_type_t::COMMON
                                                : scale_type_t::MANY);
+    /* the adjustment is applied to the scales by the driver */
+    if (p.scale_adjust != 1.f && p.scale_type == scale_type_t::NONE)
+        p.scale_type = scale_type_t::COMMON;
 
     ptrdiff_t ss[max_ndims] = {0};
     if (p.scale_type == scale_type_t::MANY) {
@@ -149,6 +180,17 @@ status_t prb_init(prb_t &p, const memory_desc_t &imd, const memory_desc_t &omd,
         }
     }
 
+    ptrdiff_t cs[max_ndims] = {0};
+    if (with_comp) {
+        ptrdiff_t last_cs = 1;
+        for (int d = old.ndims - 1; d >= 0; --d) {
+            if (comp_mask & (1 << old.id[d])) {
+                cs[d] = last_cs;
+                last_cs *= old.dims[d];
+            }
+        }
+    }
+
     int ndims = 0;
 
     int i_pos = 0; /* state for input  -- current dimension */
@@ -166,6 +208,7 @@ status_t prb_init(prb_t &p, const memory_desc_t &imd, const memory_desc_t &omd,
             p.nodes[ndims].is = ild.strides[i_pos];
             p.nodes[ndims].os = old.strides[o_pos];
             p.nodes[ndims].ss = ss[o_pos];
+            p.nodes[ndims].cs = cs[o_pos];
             ++ndims;
             ++i_pos;
             ++o_pos;
@@ -176,6 +219,7 @@ status_t prb_init(prb_t &p, const memory_desc_t &imd, const memory_desc_t &omd,
             p.nodes[ndims].is = ild.strides[i_pos];
             p.nodes[ndims].os = old.strides[o_pos] * factor;
             p.nodes[ndims].ss = ss[o_pos] * factor;
+            p.nodes[ndims].cs = cs[o_pos] * factor;
             ++ndims;
             ++i_pos;
             old.dims[o_pos] = factor;
@@ -186,6 +230,7 @@ status_t prb_init(prb_t &p, const memory_desc_t &imd, const memory_desc_t &omd,
             p.nodes[ndims].is = ild.strides[i_pos] * factor;
             p.nodes[ndims].os = old.strides[o_pos];
             p.nodes[ndims].ss = ss[o_pos];
+            p.nodes[ndims].cs = cs[o_pos];
             ++ndims;
             ++o_pos;
             ild.dims[i_pos] = factor;
@@ -231,7 +276,9 @@ void prb_simplify(prb_t &p) {
                         && next_node.is == (ptrdiff_t)this_node.n * this_node.is
                         && next_node.os == (ptrdiff_t)this_node.n * this_node.os
                         && next_node.ss
-                                == (ptrdiff_t)this_node.n * this_node.ss);
+                                == (ptrdiff_t)this_node.n * this_node.ss
+                        && next_node.cs
+                                == (ptrdiff_t)this_node.n * this_node.cs);
         if (fold) {
             this_node.n *= next_node.n;
             for (int j = d + 2; j < p.ndims; ++j)
@@ -259,6 +306,7 @@ void prb_node_split(prb_t &p, int dim, size_t n1) {
     p.nodes[dim + 1].is = p.nodes[dim].is * n1;
     p.nodes[dim + 1].os = p.nodes[dim].os * n1;
     p.nodes[dim + 1].ss = p.nodes[dim].ss * n1;
+    p.nodes[dim + 1].cs = p.nodes[dim].cs * n1;
 
     p.nodes[dim].n = n1;
 }
@@ -296,8 +344,8 @@ void prb_dump(const prb_t &p) {
     printf("@@@ type:%s:%s ndims:%d ", dnnl_dt2str(p.itype),
             dnnl_dt2str(p.otype), p.ndims);
     for (int d = 0; d < p.ndims; ++d)
-        printf("[%zu:%td:%td:%td]", p.nodes[d].n, p.nodes[d].is, p.nodes[d].os,
-                p.nodes[d].ss);
+        printf("[%zu:%td:%td:%td:%td]", p.nodes[d].n, p.nodes[d].is,
+                p.nodes[d].os, p.nodes[d].ss, p.nodes[d].cs);
     printf(" off:%zu:%zu\n", p.ioff, p.ooff);
 }
 
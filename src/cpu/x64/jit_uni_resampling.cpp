@@ -43,13 +43,15 @@ status_t jit_uni_resampling_fwd_t<isa>::pd_t::init(engine_t *engine) {
     conf_.data_type = src_md()->data_type;
 
     const bool ok = mayiuse(isa) && is_fwd() && !has_zero_dim_memory()
-            && utils::one_of(conf_.data_type, f32, bf16)
+            && utils::one_of(conf_.data_type, f32, bf16, s8, u8)
             && IMPLICATION(conf_.data_type == bf16,
                     // extra check for isa is required because
                     // the avx512_common version may reject a
                     // problem because it is blocked by 8
                     // instead of 16.
                     is_superset(isa, avx512_common) && mayiuse(avx512_core))
+            && IMPLICATION(utils::one_of(conf_.data_type, s8, u8),
+                    isa != sse41 && mayiuse(avx2))
             && utils::everyone_is(
                     conf_.data_type, src_md()->data_type, dst_md()->data_type)
             && platform::has_data_type_support(conf_.data_type)
@@ -125,6 +127,12 @@ status_t jit_uni_resampling_fwd_t<isa>::pd_t::init(engine_t *engine) {
     } else
         return status::unimplemented;
 
+    // int8 data is not gathered, only the channel oriented formats are
+    // supported
+    if (utils::one_of(conf_.data_type, s8, u8)
+            && conf_.tag_kind == jit_memory_tag_kind_t::ncsp)
+        return status::unimplemented;
+
     conf_.el_size_of_indices = sizeof(unsigned);
 
     return status::success;
@@ -202,7 +202,18 @@ void jit_uni_resampling_kernel<sse41>::gather_data(const Reg64 &reg_src_addr,
 template <>
 void jit_uni_resampling_kernel<avx512_common>::store_data(const int data_idx,
         const Reg64 &reg_dst_addr, const int offset, const bool is_tail) {
-    if (conf_.data_type == data_type::bf16) {
+    if (utils::one_of(conf_.data_type, data_type::s8, data_type::u8)) {
+        // The interpolated values are convex combinations of the src values,
+        // so they are already within the range of the data type.
+        const Zmm to_store_data = Zmm(data_idx);
+        const auto addr = is_tail ? ptr[reg_dst_addr + offset] | k_tail_mask_
+                                  : ptr[reg_dst_addr + offset];
+        vcvtps2dq(to_store_data, to_store_data);
+        if (conf_.data_type == data_type::s8)
+            vpmovsdb(addr, to_store_data);
+        else
+            vpmovusdb(addr, to_store_data);
+    } else if (conf_.data_type == data_type::bf16) {
         const Ymm to_store_data = Ymm(data_idx);
 
         if (bf16_emulation_)
@@ -233,7 +244,20 @@ void jit_uni_resampling_kernel<avx512_common>::store_data(const int data_idx,
 template <>
 void jit_uni_resampling_kernel<avx>::store_data(const int data_idx,
         const Reg64 &reg_dst_addr, const int offset, const bool is_tail) {
-    if (is_tail) {
+    if (utils::one_of(conf_.data_type, data_type::s8, data_type::u8)) {
+        // int8 is enabled for avx2 only, the values are within the range of
+        // the data type as in the avx512 version.
+        const Ymm to_store_data = Ymm(data_idx);
+        vcvtps2dq(to_store_data, to_store_data);
+        vpackssdw(to_store_data, to_store_data, to_store_data);
+        vpermq(to_store_data, to_store_data, 0x08);
+        if (conf_.data_type == data_type::s8)
+            vpacksswb(to_store_data, to_store_data, to_store_data);
+        else
+            vpackuswb(to_store_data, to_store_data, to_store_data);
+        store_bytes(to_store_data, reg_dst_addr, offset,
+                is_tail ? conf_.tail : conf_.simd_w);
+    } else if (is_tail) {
         vmaskmovps(ptr[reg_dst_addr + offset], vmm_tail_mask_, Vmm(data_idx));
     } else {
         if (conf_.is_data_size_bigger_than_L3 && conf_.tail == 0
@@ -261,7 +285,16 @@ template <>
 void jit_uni_resampling_kernel<avx512_common>::load_data(
         const Reg64 &reg_src_addr, const int offset, const int data_idx,
         const bool is_tail) {
-    if (conf_.data_type == data_type::bf16) {
+    if (utils::one_of(conf_.data_type, data_type::s8, data_type::u8)) {
+        const Zmm loaded_data = is_tail
+                ? Zmm(data_idx) | k_tail_mask_ | Xbyak::util::T_z
+                : Zmm(data_idx);
+        if (conf_.data_type == data_type::s8)
+            vpmovsxbd(loaded_data, ptr[reg_src_addr + offset]);
+        else
+            vpmovzxbd(loaded_data, ptr[reg_src_addr + offset]);
+        vcvtdq2ps(Zmm(data_idx), Zmm(data_idx));
+    } else if (conf_.data_type == data_type::bf16) {
         const Zmm loaded_data = is_tail
                 ? Zmm(data_idx) | k_tail_mask_ | Xbyak::util::T_z
                 : Zmm(data_idx);
@@ -280,7 +313,11 @@ void jit_uni_resampling_kernel<avx512_common>::load_data(
 template <>
 void jit_uni_resampling_kernel<avx>::load_data(const Reg64 &reg_src_addr,
         const int offset, const int data_idx, const bool is_tail) {
-    if (is_tail) {
+    if (utils::one_of(conf_.data_type, data_type::s8, data_type::u8)) {
+        jit_generator::load_data(conf_.data_type, Ymm(data_idx), reg_src_addr,
+                offset, is_tail ? conf_.tail : conf_.simd_w);
+        vcvtdq2ps(Ymm(data_idx), Ymm(data_idx));
+    } else if (is_tail) {
         vmaskmovps(Vmm(data_idx), vmm_tail_mask_, ptr[reg_src_addr + offset]);
     } else {
         vmovups(Vmm(data_idx), ptr[reg_src_addr + offset]);
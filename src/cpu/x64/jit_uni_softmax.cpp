@@ -91,24 +91,42 @@ struct jit_softmax_base_t : public jit_generator {
     Vmm vsum = Vmm(isa == avx512_common ? 30 : 14);
     Vmm vmax = Vmm(isa == avx512_common ? 31 : 15);
     Vmm vsbr = vsum; // must be not equal to vmax
+    Xmm xoscale = Xmm(11);
+    Vmm voscale = Vmm(isa == avx512_common ? 21 : 11);
 
     bool is_bf16_ = false;
     bool is_softmax_ = pd_->is_softmax();
     bool is_logsoftmax_ = pd_->is_logsoftmax();
+    bool with_oscale_ = false;
 
     size_t data_type_size_ = 0;
     size_t simd_w_ = 0;
     size_t unroll_regs_ = 4;
 
+    // A plain axis that is not the innermost one is vectorized over the
+    // inner dimension instead: every step of the axis loop is a vector of
+    // simd_w_ independent problems, or inner_tail_ of them in the kernel of
+    // the last vector.
+    bool is_strided_axis_ = false;
+    size_t inner_tail_ = 0;
+
     size_t axis_simd_full_;
     size_t axis_simd_tail_;
+    size_t tail_lanes_; // lanes of the tail mask
     size_t n_loops_;
     size_t loop_tail_;
     size_t axis_stride_;
 
     void compute_predefined_variables() {
-        axis_simd_full_ = pd_->axis_size() / simd_w_;
-        axis_simd_tail_ = pd_->axis_size() % simd_w_;
+        if (is_strided_axis_) {
+            axis_simd_full_ = pd_->axis_size();
+            axis_simd_tail_ = 0;
+            tail_lanes_ = inner_tail_;
+        } else {
+            axis_simd_full_ = pd_->axis_size() / simd_w_;
+            axis_simd_tail_ = pd_->axis_size() % simd_w_;
+            tail_lanes_ = axis_simd_tail_;
+        }
         n_loops_ = axis_simd_full_ / unroll_regs_;
         loop_tail_ = axis_simd_full_ - n_loops_ * unroll_regs_;
         axis_stride_ = compute_axis_stride();
@@ -117,7 +135,8 @@ struct jit_softmax_base_t : public jit_generator {
     size_t compute_axis_stride() {
         const auto &bd = data_d_.blocking_desc();
 
-        if (bd.inner_nblks) return data_type_size_ * bd.strides[pd_->axis()];
+        if (bd.inner_nblks || is_strided_axis_)
+            return data_type_size_ * bd.strides[pd_->axis()];
         return is_bf16_ ? vlen / 2 : vlen;
     }
 
@@ -128,6 +147,12 @@ struct jit_softmax_base_t : public jit_generator {
         mov(reg_tmp, float2int(-FLT_MAX));
         uni_vmovq(xneg_flt_max, reg_tmp);
         uni_vbroadcastss(vneg_flt_max, xneg_flt_max);
+        if (with_oscale_) {
+            const float oscale = pd_->attr()->output_scales_.scales_[0];
+            mov(reg_tmp, float2int(oscale));
+            uni_vmovq(xoscale, reg_tmp);
+            uni_vbroadcastss(voscale, xoscale);
+        }
 
 #define PARAM_OFF(x) offsetof(call_params_t, x)
         mov(reg_spat_offt_count, ptr[reg_param + PARAM_OFF(spat_offt_count)]);
@@ -169,6 +194,7 @@ struct jit_softmax_base_t : public jit_generator {
     template <typename body_t>
     void axis_loop(body_t body) {
         Label main_loop, tail_loop, tail_axis;
+        const bool inner_tail = inner_tail_ != 0;
 
         // reverse_spat_offt to dispatch between labels
         mov(reg_reverse_spat_offt, reg_spat_offt_count);
@@ -179,7 +205,7 @@ struct jit_softmax_base_t : public jit_generator {
                 cmp(reg_reverse_spat_offt, unroll_regs_ * axis_stride_);
                 jl(tail_loop, T_NEAR);
 
-                body(unroll_regs_, false);
+                body(unroll_regs_, inner_tail);
                 sub(reg_reverse_spat_offt, unroll_regs_ * axis_stride_);
                 add(reg_spat_offt, unroll_regs_ * axis_stride_);
                 jmp(main_loop);
@@ -189,7 +215,7 @@ struct jit_softmax_base_t : public jit_generator {
         L(tail_loop);
         {
             if (loop_tail_) {
-                body(loop_tail_, false);
+                body(loop_tail_, inner_tail);
                 add(reg_spat_offt, loop_tail_ * axis_stride_);
             }
         }
@@ -200,6 +226,11 @@ struct jit_softmax_base_t : public jit_generator {
         }
     }
 
+    // there is nothing to reduce across the lanes of a strided axis
+    void horizontal_op(const Vmm &v, const Vmm &vtmp, op_t op) {
+        if (!is_strided_axis_) get_horizontal_op(v, vtmp, op);
+    }
+
     virtual void prepare_tail_mask() = 0;
     virtual void get_horizontal_op(const Vmm &v, const Vmm &vtmp, op_t op) = 0;
     virtual void accumulate_vmax() = 0;
@@ -224,10 +255,13 @@ struct jit_softmax_base_t : public jit_generator {
     // that are participated are not defined at the moment of base ctor
     // initialization.
     void generate() override {
+        const bool fast_math = pd_->is_fwd()
+                && pd_->attr()->fpmath_mode_ != fpmath_mode::strict;
         if (pd_->is_fwd() || is_logsoftmax_)
             exp_injector_.reset(new jit_uni_eltwise_injector_f32<isa>(this,
                     alg_kind::eltwise_exp, 0.0f, 0.0f, 1.0f, true,
-                    reg_exp_injector_table, injector_mask));
+                    reg_exp_injector_table, injector_mask, true, false,
+                    fast_math));
         if (pd_->is_fwd() && is_logsoftmax_) {
             log_injector_.reset(new jit_uni_eltwise_injector_f32<isa>(this,
                     alg_kind::eltwise_log, 0.0f, 0.0f, 1.0f, true,
@@ -239,7 +273,7 @@ struct jit_softmax_base_t : public jit_generator {
         initialization_hook();
         if (exp_injector_) exp_injector_->load_table_addr();
         if (log_injector_) log_injector_->load_table_addr();
-        if (axis_simd_tail_) prepare_tail_mask();
+        if (tail_lanes_) prepare_tail_mask();
         load_common_params();
         if (pd_->is_fwd())
             forward();
@@ -250,13 +284,18 @@ struct jit_softmax_base_t : public jit_generator {
         if (log_injector_) log_injector_->prepare_table();
     }
 
-    jit_softmax_base_t(const softmax_pd_t *pd)
+    jit_softmax_base_t(const softmax_pd_t *pd, size_t inner_tail)
         : jit_generator(nullptr, MAX_CODE_SIZE, true, isa)
         , pd_(pd)
-        , data_d_(pd_->dst_md()) {
+        , data_d_(pd_->dst_md())
+        , inner_tail_(inner_tail) {
+        is_strided_axis_ = data_d_.is_plain()
+                && data_d_.blocking_desc().strides[pd_->axis()] != 1;
         is_bf16_ = data_d_.data_type() == data_type::bf16;
         data_type_size_ = is_bf16_ ? sizeof(bfloat16_t) : sizeof(float);
         simd_w_ = vlen / sizeof(float); // bf16 works on ymms
+        with_oscale_ = pd_->is_fwd()
+                && !pd_->attr()->output_scales_.has_default_values();
     }
 };
 
@@ -301,7 +340,7 @@ struct jit_softmax_t<avx512_common> : public jit_softmax_base_t<avx512_common> {
     };
 
     void prepare_tail_mask() override {
-        const int mask_f32 = (1 << axis_simd_tail_) - 1;
+        const int mask_f32 = (1 << tail_lanes_) - 1;
         Reg32 regw_tmp = reg_tmp.cvt32();
         mov(regw_tmp, mask_f32);
         kmovw(tail_opmask, regw_tmp);
@@ -333,7 +372,7 @@ struct jit_softmax_t<avx512_common> : public jit_softmax_base_t<avx512_common> {
             }
         });
 
-        get_horizontal_op(vmax, vtmp = vsum, op_t::max);
+        horizontal_op(vmax, vtmp = vsum, op_t::max);
     }
 
     void accumulate_vsum() override {
@@ -356,8 +395,9 @@ struct jit_softmax_t<avx512_common> : public jit_softmax_base_t<avx512_common> {
             }
         });
 
-        get_horizontal_op(vsum, vtmp = vmax, op_t::sum);
+        horizontal_op(vsum, vtmp = vmax, op_t::sum);
         if (is_softmax_) uni_vdivps(vsum, vone, vsum, vtmp = vmax);
+        if (is_softmax_ && with_oscale_) uni_vmulps(vsum, vsum, voscale);
         if (is_logsoftmax_) log_injector_->compute_vector(vsum.getIdx());
     }
 
@@ -372,6 +412,8 @@ struct jit_softmax_t<avx512_common> : public jit_softmax_base_t<avx512_common> {
                 if (is_logsoftmax_) {
                     load(vreg_tmp_src, dst_ptr(axis_stride_ * i), tail);
                     uni_vsubps(vreg_tmp_src, vreg_tmp_src, vsum);
+                    if (with_oscale_)
+                        uni_vmulps(vreg_tmp_src, vreg_tmp_src, voscale);
                 }
                 store(dst_ptr(axis_stride_ * i), vreg_tmp_src, tail);
             }
@@ -395,7 +437,7 @@ struct jit_softmax_t<avx512_common> : public jit_softmax_base_t<avx512_common> {
             }
         });
 
-        get_horizontal_op(vsbr, vtmp = vmax, op_t::sum);
+        horizontal_op(vsbr, vtmp = vmax, op_t::sum);
     }
 
     void compute_diff_src() override {
@@ -422,7 +464,8 @@ struct jit_softmax_t<avx512_common> : public jit_softmax_base_t<avx512_common> {
         if (bf16_emu_) bf16_emu_->init_vcvtneps2bf16();
     }
 
-    jit_softmax_t(const softmax_pd_t *pd) : jit_softmax_base_t(pd) {
+    jit_softmax_t(const softmax_pd_t *pd, size_t inner_tail)
+        : jit_softmax_base_t(pd, inner_tail) {
         if (is_bf16_ && !mayiuse(avx512_core_bf16))
             bf16_emu_.reset(new bf16_emulation_t(this, bf16_emu_zmm_1,
                     bf16_emu_zmm_2, bf16_emu_zmm_3, bf16_emu_gpr,
@@ -442,7 +485,7 @@ struct jit_softmax_t<avx2> : public jit_softmax_base_t<avx2> {
         static const uint32_t mask_f32[14]
                 = {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
                         0xffffffff, 0xffffffff, 0, 0, 0, 0, 0, 0, 0};
-        mov(reg_tmp, reinterpret_cast<size_t>(&mask_f32[7 - axis_simd_tail_]));
+        mov(reg_tmp, reinterpret_cast<size_t>(&mask_f32[7 - tail_lanes_]));
         vmovups(tail_vmask, ptr[reg_tmp]);
     }
 
@@ -473,7 +516,7 @@ struct jit_softmax_t<avx2> : public jit_softmax_base_t<avx2> {
             }
         });
 
-        get_horizontal_op(vmax, vtmp = vsum, op_t::max);
+        horizontal_op(vmax, vtmp = vsum, op_t::max);
     }
 
     void accumulate_vsum() override {
@@ -510,8 +553,9 @@ struct jit_softmax_t<avx2> : public jit_softmax_base_t<avx2> {
             }
         });
 
-        get_horizontal_op(vsum, vtmp = vmax, op_t::sum);
+        horizontal_op(vsum, vtmp = vmax, op_t::sum);
         if (is_softmax_) uni_vdivps(vsum, vone, vsum, vtmp = vmax);
+        if (is_softmax_ && with_oscale_) uni_vmulps(vsum, vsum, voscale);
         if (is_logsoftmax_) log_injector_->compute_vector(vsum.getIdx());
     }
 
@@ -526,6 +570,8 @@ struct jit_softmax_t<avx2> : public jit_softmax_base_t<avx2> {
                     if (is_logsoftmax_) {
                         uni_vmovups(vreg_tmp_src, dst_ptr(axis_stride_ * i));
                         uni_vsubps(vreg_tmp_src, vreg_tmp_src, vsum);
+                        if (with_oscale_)
+                            uni_vmulps(vreg_tmp_src, vreg_tmp_src, voscale);
                     }
                     uni_vmovups(dst_ptr(axis_stride_ * i), vreg_tmp_src);
                 } else {
@@ -533,8 +579,11 @@ struct jit_softmax_t<avx2> : public jit_softmax_base_t<avx2> {
                             dst_ptr(axis_stride_ * i));
                     if (is_softmax_)
                         uni_vmulps(vreg_tmp_src, vreg_tmp_src, vsum);
-                    if (is_logsoftmax_)
+                    if (is_logsoftmax_) {
                         uni_vsubps(vreg_tmp_src, vreg_tmp_src, vsum);
+                        if (with_oscale_)
+                            uni_vmulps(vreg_tmp_src, vreg_tmp_src, voscale);
+                    }
                     uni_vmovups_tail(dst_ptr(axis_stride_ * i), tail_vmask,
                             vreg_tmp_src);
                 }
@@ -546,7 +595,8 @@ struct jit_softmax_t<avx2> : public jit_softmax_base_t<avx2> {
         return jit_generator::operator()(p);
     }
 
-    jit_softmax_t(const softmax_pd_t *pd) : jit_softmax_base_t(pd) {}
+    jit_softmax_t(const softmax_pd_t *pd, size_t inner_tail)
+        : jit_softmax_base_t(pd, inner_tail) {}
 };
 
 template <>
@@ -596,7 +646,7 @@ struct jit_softmax_t<sse41> : public jit_softmax_base_t<sse41> {
             }
         });
 
-        get_horizontal_op(vmax, vtmp = vsum, op_t::max);
+        horizontal_op(vmax, vtmp = vsum, op_t::max);
     }
 
     void accumulate_vsum() override {
@@ -638,8 +688,9 @@ struct jit_softmax_t<sse41> : public jit_softmax_base_t<sse41> {
             }
         });
 
-        get_horizontal_op(vsum, vtmp = vmax, op_t::sum);
+        horizontal_op(vsum, vtmp = vmax, op_t::sum);
         if (is_softmax_) uni_vdivps(vsum, vone, vsum, vtmp = vmax);
+        if (is_softmax_ && with_oscale_) uni_vmulps(vsum, vsum, voscale);
         if (is_logsoftmax_) log_injector_->compute_vector(vsum.getIdx());
     }
 
@@ -651,8 +702,11 @@ struct jit_softmax_t<sse41> : public jit_softmax_base_t<sse41> {
                     uni_vmovups(vreg_tmp_src, dst_ptr(axis_stride_ * i));
                     if (is_softmax_)
                         uni_vmulps(vreg_tmp_src, vreg_tmp_src, vsum);
-                    if (is_logsoftmax_)
+                    if (is_logsoftmax_) {
                         uni_vsubps(vreg_tmp_src, vreg_tmp_src, vsum);
+                        if (with_oscale_)
+                            uni_vmulps(vreg_tmp_src, vreg_tmp_src, voscale);
+                    }
                     uni_vmovups(dst_ptr(axis_stride_ * i), vreg_tmp_src);
                 } else {
                     for (size_t j = 0; j < axis_simd_tail_; j++) {
@@ -661,8 +715,12 @@ struct jit_softmax_t<sse41> : public jit_softmax_base_t<sse41> {
                                         + data_type_size_ * j));
                         if (is_softmax_)
                             uni_vmulps(vreg_tmp_src, vreg_tmp_src, vsum);
-                        if (is_logsoftmax_)
+                        if (is_logsoftmax_) {
                             uni_vsubps(vreg_tmp_src, vreg_tmp_src, vsum);
+                            if (with_oscale_)
+                                uni_vmulps(
+                                        vreg_tmp_src, vreg_tmp_src, voscale);
+                        }
                         uni_vmovss(
                                 dst_ptr(axis_stride_ * i + data_type_size_ * j),
                                 vreg_tmp_src);
@@ -676,7 +734,8 @@ struct jit_softmax_t<sse41> : public jit_softmax_base_t<sse41> {
         return jit_generator::operator()(p);
     }
 
-    jit_softmax_t(const softmax_pd_t *pd) : jit_softmax_base_t(pd) {}
+    jit_softmax_t(const softmax_pd_t *pd, size_t inner_tail)
+        : jit_softmax_base_t(pd, inner_tail) {}
 };
 
 } // namespace
@@ -714,11 +773,16 @@ status_t jit_uni_softmax_fwd_t<isa>::execute(const exec_ctx_t &ctx) const {
     const auto outer_stride = data_d.padded_dims()[axis] * inner_size;
     const auto outer_size = data_d.nelems(true) / outer_stride;
 
-    parallel_nd(outer_size, inner_size, [&](dim_t ou, dim_t in) {
+    const dim_t inner_block = softmax_driver_->inner_block();
+    const dim_t nb_inner = utils::div_up(inner_size, inner_block);
+
+    parallel_nd(outer_size, nb_inner, [&](dim_t ou, dim_t ib) {
+        const dim_t in = ib * inner_block;
         dim_t offset = (ou * outer_stride + in * inner_stride) * data_type_size;
         const char *src_ptr = src + offset;
         char *dst_ptr = dst + offset;
-        softmax_driver_->exec(src_ptr, dst_ptr, outer_stride);
+        softmax_driver_->exec(
+                src_ptr, dst_ptr, outer_stride, in + inner_block > inner_size);
     });
 
     return status::success;
@@ -758,13 +822,17 @@ status_t jit_uni_softmax_bwd_t<isa>::execute(const exec_ctx_t &ctx) const {
     const auto outer_stride = data_d.padded_dims()[axis] * inner_size;
     const auto outer_size = data_d.nelems(true) / outer_stride;
 
-    parallel_nd(outer_size, inner_size, [&](dim_t ou, dim_t in) {
+    const dim_t inner_block = softmax_driver_->inner_block();
+    const dim_t nb_inner = utils::div_up(inner_size, inner_block);
+
+    parallel_nd(outer_size, nb_inner, [&](dim_t ou, dim_t ib) {
+        const dim_t in = ib * inner_block;
         dim_t offset = (ou * outer_stride + in * inner_stride) * data_type_size;
         char *diff_src_ptr = diff_src + offset;
         const char *dst_ptr = dst + offset;
         const char *diff_dst_ptr = diff_dst + offset;
-        softmax_driver_->exec(
-                diff_src_ptr, dst_ptr, diff_dst_ptr, outer_stride);
+        softmax_driver_->exec(diff_src_ptr, dst_ptr, diff_dst_ptr,
+                outer_stride, in + inner_block > inner_size);
     });
 
     return status::success;
@@ -775,31 +843,56 @@ namespace softmax_impl {
 template <cpu_isa_t isa>
 struct driver_t : public c_compatible {
 
-    driver_t(const softmax_pd_t *pd) : pd_(pd), ker_(pd_) {}
+    driver_t(const softmax_pd_t *pd) : pd_(pd), ker_(pd_, 0) {
+        if (ker_.is_strided_axis_) {
+            const memory_desc_wrapper data_d(pd_->dst_md());
+            const dim_t inner_size
+                    = data_d.blocking_desc().strides[pd_->axis()];
+            inner_block_ = ker_.simd_w_;
+            const size_t inner_tail = inner_size % ker_.simd_w_;
+            if (inner_tail)
+                ker_tail_.reset(new jit_softmax_t<isa>(pd_, inner_tail));
+        }
+    }
 
-    void exec(const void *src, void *dst, const dim_t outer_stride) {
+    // Number of consecutive inner elements processed by a call: a vector
+    // for a strided axis, a single element (or block) otherwise.
+    dim_t inner_block() const { return inner_block_; }
+
+    void exec(const void *src, void *dst, const dim_t outer_stride,
+            bool inner_tail) {
         typename jit_softmax_t<isa>::call_params_t p;
         p.spat_offt_count = outer_stride * ker_.data_type_size_;
         p.src = src;
         p.dst = dst;
-        ker_(&p);
+        ker(inner_tail)(&p);
     }
 
     void exec(void *diff_src, const void *dst, const void *diff_dst,
-            const dim_t outer_stride) {
+            const dim_t outer_stride, bool inner_tail) {
         typename jit_softmax_t<isa>::call_params_t p;
         p.spat_offt_count = outer_stride * ker_.data_type_size_;
         p.src = diff_src;
         p.dst = dst;
         p.diff_dst = diff_dst;
-        ker_(&p);
+        ker(inner_tail)(&p);
     }
 
-    status_t create_kernel() { return ker_.create_kernel(); }
+    status_t create_kernel() {
+        CHECK(ker_.create_kernel());
+        if (ker_tail_) CHECK(ker_tail_->create_kernel());
+        return status::success;
+    }
 
 private:
     const softmax_pd_t *pd_;
     jit_softmax_t<isa> ker_;
+    std::unique_ptr<jit_softmax_t<isa>> ker_tail_;
+    dim_t inner_block_ = 1;
+
+    jit_softmax_t<isa> &ker(bool inner_tail) {
+        return inner_tail && ker_tail_ ? *ker_tail_ : ker_;
+    }
 };
 
 } // namespace softmax_impl
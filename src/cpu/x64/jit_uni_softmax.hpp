@@ -59,11 +59,16 @@ struct jit_uni_softmax_fwd_t : public primitive_t {
                 // It is fine to use float here as the kernel uses halfs of
                 // vector registers.
                 const auto blk_size = cpu_isa_traits<isa>::vlen / sizeof(float);
+                // 31 is a general limit, 2 is for unroll_regs_ = 4;
+                const size_t max_stride = (1LL << (31 - 2)) - 1;
                 if (src_d.is_plain())
-                    return bd.strides[axis()] == 1;
+                    // a non-innermost axis is vectorized over the inner
+                    // dimension, which needs masked tails
+                    return bd.strides[axis()] == 1
+                            || (isa != sse41
+                                    && sizeof(float) * bd.strides[axis()]
+                                            < max_stride);
                 else {
-                    // 31 is a general limit, 2 is for unroll_regs_ = 4;
-                    const size_t max_stride = (1LL << (31 - 2)) - 1;
                     const int last_blk = bd.inner_nblks - 1;
                     return true && bd.inner_blks[last_blk] == blk_size
                             && bd.inner_idxs[last_blk] == axis()
@@ -83,7 +88,9 @@ struct jit_uni_softmax_fwd_t : public primitive_t {
                             is_superset(isa, avx512_common)
                                     && mayiuse(avx512_core))
                     && is_dense() // not dense impl can be easily done
-                    && attr()->has_default_values();
+                    && attr()->has_default_values(
+                            primitive_attr_t::skip_mask_t::oscale)
+                    && attr_oscale_ok();
             if (!ok) return status::unimplemented;
 
             return status::success;
@@ -124,11 +131,16 @@ struct jit_uni_softmax_bwd_t : public primitive_t {
                 // It is fine to use float here as the kernel uses halfs of
                 // vector registers.
                 const auto blk_size = cpu_isa_traits<isa>::vlen / sizeof(float);
+                // 31 is a general limit, 2 is for unroll_regs_ = 4;
+                const size_t max_stride = (1LL << (31 - 2)) - 1;
                 if (dst_d.is_plain())
-                    return bd.strides[axis()] == 1;
+                    // a non-innermost axis is vectorized over the inner
+                    // dimension, which needs masked tails
+                    return bd.strides[axis()] == 1
+                            || (isa != sse41
+                                    && sizeof(float) * bd.strides[axis()]
+                                            < max_stride);
                 else {
-                    // 31 is a general limit, 2 is for unroll_regs_ = 4;
-                    const size_t max_stride = (1LL << (31 - 2)) - 1;
                     const int last_blk = bd.inner_nblks - 1;
                     return true && bd.inner_blks[last_blk] == blk_size
                             && bd.inner_idxs[last_blk] == axis()
@@ -0,0 +1,263 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/dnnl_thread.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/platform.hpp"
+
+#include "cpu/x64/jit_uni_sum.hpp"
+
+#define GET_OFF(field) offsetof(jit_uni_sum_call_s, field)
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+using namespace dnnl::impl::data_type;
+using namespace dnnl::impl::utils;
+using namespace Xbyak;
+
+template <cpu_isa_t isa>
+void jit_uni_sum_kernel_t<isa>::load_src(
+        const Vmm &vmm, int i_src, dim_t elem_off) {
+    const data_type_t dt = jsp.src_dt[i_src];
+    const auto addr
+            = ptr[reg_src[i_src] + elem_off * types::data_type_size(dt)];
+    switch (dt) {
+        case f32: uni_vmovups(vmm, addr); break;
+        case s8: uni_vpmovsxbd(vmm, addr); break;
+        case u8: uni_vpmovzxbd(vmm, addr); break;
+        default: assert(!"unsupported data type");
+    }
+    if (dt != f32) uni_vcvtdq2ps(vmm, vmm);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_sum_kernel_t<isa>::store_dst(const Vmm &vmm, dim_t elem_off) {
+    const dim_t off = elem_off * types::data_type_size(jsp.dst_dt);
+    if (jsp.dst_dt == f32) {
+        if (jsp.use_nt_store)
+            vmovntps(ptr[reg_dst + off], vmm);
+        else
+            uni_vmovups(ptr[reg_dst + off], vmm);
+        return;
+    }
+
+    saturate_f32(vmm, vmm_lbound, vmm_ubound, jsp.dst_dt);
+    uni_vcvtps2dq(vmm, vmm);
+    if (isa == avx512_core) {
+        // the values are already within the range of the dst data type
+        if (jsp.dst_dt == s8)
+            vpmovsdb(ptr[reg_dst + off], vmm);
+        else
+            vpmovusdb(ptr[reg_dst + off], vmm);
+    } else {
+        store_data(jsp.dst_dt, Ymm(vmm.getIdx()), reg_dst, off, simd_w);
+    }
+}
+
+template <cpu_isa_t isa>
+void jit_uni_sum_kernel_t<isa>::loop_iteration(int current_unroll) {
+    Label loop_label, exit_label;
+    const int num_compute_elements = simd_w * current_unroll;
+
+    L(loop_label);
+    cmp(reg_sz, num_compute_elements);
+    jl(exit_label, T_NEAR);
+    for (int u_idx = 0; u_idx < current_unroll; u_idx++) {
+        const Vmm vacc = vmm_acc(u_idx);
+        const Vmm vsrc = vmm_src(u_idx);
+        for (int s = 0; s < jsp.num_srcs; s++) {
+            load_src(vsrc, s, u_idx * simd_w);
+            if (s == 0)
+                uni_vmulps(vacc, vsrc, vmm_scale(s));
+            else
+                uni_vfmadd231ps(vacc, vsrc, vmm_scale(s));
+        }
+        store_dst(vacc, u_idx * simd_w);
+    }
+    sub(reg_sz, num_compute_elements);
+    for (int s = 0; s < jsp.num_srcs; s++)
+        add(reg_src[s],
+                num_compute_elements * types::data_type_size(jsp.src_dt[s]));
+    add(reg_dst, num_compute_elements * types::data_type_size(jsp.dst_dt));
+    jmp(loop_label, T_NEAR);
+
+    L(exit_label);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_sum_kernel_t<isa>::tail_iteration() {
+    Label loop_label, exit_label;
+    const Xmm xacc = Xmm(vmm_acc(0).getIdx());
+    const Xmm xsrc = Xmm(vmm_src(0).getIdx());
+
+    L(loop_label);
+    cmp(reg_sz, 0);
+    jle(exit_label, T_NEAR);
+    for (int s = 0; s < jsp.num_srcs; s++) {
+        const Xmm xscale = Xmm(vmm_scale(s).getIdx());
+        load_data(jsp.src_dt[s], xsrc, reg_src[s], 0, 1);
+        if (jsp.src_dt[s] != f32) vcvtdq2ps(xsrc, xsrc);
+        if (s == 0)
+            vmulss(xacc, xsrc, xscale);
+        else
+            vfmadd231ss(xacc, xsrc, xscale);
+    }
+    if (jsp.dst_dt != f32) {
+        saturate_f32(xacc, Xmm(vmm_lbound.getIdx()), Xmm(vmm_ubound.getIdx()),
+                jsp.dst_dt);
+        vcvtps2dq(xacc, xacc);
+    }
+    store_data(jsp.dst_dt, xacc, reg_dst, 0, 1);
+
+    sub(reg_sz, 1);
+    for (int s = 0; s < jsp.num_srcs; s++)
+        add(reg_src[s], types::data_type_size(jsp.src_dt[s]));
+    add(reg_dst, types::data_type_size(jsp.dst_dt));
+    jmp(loop_label, T_NEAR);
+
+    L(exit_label);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_sum_kernel_t<isa>::generate() {
+    preamble();
+
+    mov(reg_dst, ptr[param + GET_OFF(dst)]);
+    mov(reg_srcs, ptr[param + GET_OFF(srcs)]);
+    for (int s = 0; s < jsp.num_srcs; s++)
+        mov(reg_src[s], ptr[reg_srcs + sizeof(void *) * s]);
+    mov(reg_scales, ptr[param + GET_OFF(scales)]);
+    mov(reg_sz, ptr[param + GET_OFF(size)]);
+
+    for (int s = 0; s < jsp.num_srcs; s++)
+        uni_vbroadcastss(vmm_scale(s), ptr[reg_scales + sizeof(float) * s]);
+    init_saturate_f32(vmm_lbound, vmm_ubound, reg_tmp, f32, jsp.dst_dt);
+
+    if (jsp.loop_unroll > 1) loop_iteration(jsp.loop_unroll);
+    loop_iteration(1);
+    tail_iteration();
+
+    if (jsp.use_nt_store) sfence();
+    postamble();
+}
+
+template <cpu_isa_t isa>
+status_t jit_uni_sum_kernel_t<isa>::init_conf(jit_uni_sum_conf_t &jsp,
+        int num_srcs, const memory_desc_t *src_mds,
+        const memory_desc_t &dst_md) {
+    const memory_desc_wrapper o_d(&dst_md);
+
+    jsp.num_srcs = num_srcs;
+    for (int s = 0; s < num_srcs; s++)
+        jsp.src_dt[s] = src_mds[s].data_type;
+    jsp.dst_dt = o_d.data_type();
+
+    const int max_unroll = 8;
+    jsp.loop_unroll = 0;
+    while (jsp.loop_unroll < max_unroll
+            && num_vregs_required(jsp.loop_unroll + 1, num_srcs)
+                    <= cpu_isa_traits<isa>::n_vregs)
+        jsp.loop_unroll++;
+    if (jsp.loop_unroll == 0) return status::unimplemented;
+    jsp.size_blocking = simd_w * jsp.loop_unroll;
+
+    // Streaming the dst only pays off when it would evict the srcs anyway
+    const size_t llc_size = (size_t)platform::get_per_core_cache_size(3)
+            * dnnl_get_max_threads();
+    jsp.use_nt_store = jsp.dst_dt == f32 && o_d.size() > llc_size;
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+status_t jit_uni_sum_t<isa>::execute(const exec_ctx_t &ctx) const {
+    const auto &jsp = pd()->jsp_;
+    const memory_desc_wrapper o_d(pd()->dst_md());
+    const size_t dst_dt_size = types::data_type_size(o_d.data_type());
+    auto output = CTX_OUT_MEM(char *, DNNL_ARG_DST)
+            + o_d.blk_off(0) * dst_dt_size;
+    const int num_arrs = pd()->n_inputs();
+    const dim_t nelems = o_d.nelems(true);
+
+    const char *input_ptrs[jit_uni_sum_conf_t::max_num_arrs];
+    size_t src_dt_sizes[jit_uni_sum_conf_t::max_num_arrs];
+    size_t block_bytes_per_elem = dst_dt_size;
+    for (int a = 0; a < num_arrs; ++a) {
+        const memory_desc_wrapper i_d(pd()->src_md(a));
+        src_dt_sizes[a] = types::data_type_size(i_d.data_type());
+        input_ptrs[a] = CTX_IN_MEM(const char *, DNNL_ARG_MULTIPLE_SRC + a)
+                + i_d.blk_off(0) * src_dt_sizes[a];
+        block_bytes_per_elem += src_dt_sizes[a];
+    }
+    const float *scales = &pd()->scales()[0];
+
+    // Non-temporal stores require an aligned dst: the elements before the
+    // first aligned address go to the scalar tail of a separate call, so
+    // that every block processed in parallel starts aligned.
+    dim_t head = 0;
+    if (jsp.use_nt_store) {
+        const size_t vlen = cpu_isa_traits<isa>::vlen;
+        const size_t misalign = reinterpret_cast<size_t>(output) % vlen;
+        if (misalign != 0)
+            head = nstl::min(nelems, (dim_t)((vlen - misalign) / dst_dt_size));
+    }
+
+    const dim_t half_L1 = platform::get_per_core_cache_size(1) / 2;
+    const dim_t num_elems_in_block = rnd_up(
+            div_up(half_L1, (dim_t)block_bytes_per_elem), jsp.size_blocking);
+    const dim_t num_blocks = (nelems - head) / num_elems_in_block;
+    const dim_t tail = (nelems - head) % num_elems_in_block;
+
+    auto ker = [&](dim_t start_e, dim_t size) {
+        const char *local_input_ptrs[jit_uni_sum_conf_t::max_num_arrs];
+        for (int a = 0; a < num_arrs; ++a)
+            local_input_ptrs[a] = input_ptrs[a] + start_e * src_dt_sizes[a];
+        auto arg = jit_uni_sum_call_s();
+        arg.srcs = (const void **)local_input_ptrs;
+        arg.dst = (const void *)(output + start_e * dst_dt_size);
+        arg.scales = scales;
+        arg.size = size;
+        (*kernel_)(&arg);
+    };
+
+    parallel(0, [&](const int ithr, const int nthr) {
+        if (head != 0 && ithr == 0) ker(0, head);
+
+        dim_t start {0}, end {0};
+        balance211(num_blocks, nthr, ithr, start, end);
+        for (dim_t nb = start; nb < end; ++nb)
+            ker(head + nb * num_elems_in_block, num_elems_in_block);
+
+        if (tail != 0 && ithr == nthr - 1) ker(nelems - tail, tail);
+    });
+
+    return status::success;
+}
+
+template struct jit_uni_sum_kernel_t<avx2>;
+template struct jit_uni_sum_kernel_t<avx512_core>;
+template struct jit_uni_sum_t<avx2>;
+template struct jit_uni_sum_t<avx512_core>;
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,164 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_JIT_UNI_SUM_HPP
+#define CPU_X64_JIT_UNI_SUM_HPP
+
+#include <memory>
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+
+#include "cpu/cpu_sum_pd.hpp"
+#include "cpu/x64/cpu_isa_traits.hpp"
+#include "cpu/x64/jit_generator.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+struct jit_uni_sum_conf_t {
+    static constexpr int max_num_arrs = 8;
+
+    int num_srcs;
+    data_type_t src_dt[max_num_arrs];
+    data_type_t dst_dt;
+    int loop_unroll;
+    int size_blocking; /* number of elements processed by one iteration of
+                          the main unrolled loop */
+    bool use_nt_store; /* f32 dst that does not fit the caches is written
+                          with non-temporal stores */
+};
+
+struct jit_uni_sum_call_s {
+    const void **srcs;
+    const void *dst;
+    const float *scales;
+    dim_t size;
+};
+
+template <cpu_isa_t isa>
+struct jit_uni_sum_kernel_t : public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_sum_kernel_t)
+
+    jit_uni_sum_kernel_t(const jit_uni_sum_conf_t &ajsp) : jsp(ajsp) {}
+
+    static status_t init_conf(jit_uni_sum_conf_t &jsp, int num_srcs,
+            const memory_desc_t *src_mds, const memory_desc_t &dst_md);
+
+    const jit_uni_sum_conf_t jsp;
+
+private:
+    using Vmm = typename cpu_isa_traits<isa>::Vmm;
+    using reg64_t = const Xbyak::Reg64;
+
+    static constexpr int simd_w = cpu_isa_traits<isa>::vlen / sizeof(float);
+
+    reg64_t param = abi_param1;
+    reg64_t reg_srcs = abi_not_param1;
+    reg64_t reg_tmp = abi_not_param1;
+
+    reg64_t reg_dst = rax;
+    reg64_t reg_scales = rbx;
+    reg64_t reg_sz = rdx;
+
+    reg64_t reg_src[jit_uni_sum_conf_t::max_num_arrs]
+            = {r8, r9, r10, r11, r12, r13, r14, r15};
+
+    // Two registers are reserved for the int8 saturation bounds, then come
+    // the broadcasted scales and an accumulator and a load register per
+    // unroll iteration. The scalar tail uses the low registers only, so
+    // that it can be encoded with VEX on every isa.
+    enum { n_reserved_vregs = 2 };
+    static int num_vregs_required(int unroll, int num_srcs) {
+        return n_reserved_vregs + num_srcs + 2 * unroll;
+    }
+
+    Vmm vmm_ubound = Vmm(0);
+    Vmm vmm_lbound = Vmm(1);
+    Vmm vmm_scale(int i_src) const { return Vmm(n_reserved_vregs + i_src); }
+    Vmm vmm_acc(int i_unroll) const {
+        return Vmm(n_reserved_vregs + jsp.num_srcs + 2 * i_unroll);
+    }
+    Vmm vmm_src(int i_unroll) const {
+        return Vmm(n_reserved_vregs + jsp.num_srcs + 2 * i_unroll + 1);
+    }
+
+    void load_src(const Vmm &vmm, int i_src, dim_t elem_off);
+    void store_dst(const Vmm &vmm, dim_t elem_off);
+    void loop_iteration(int current_unroll);
+    void tail_iteration();
+    void generate() override;
+};
+
+template <cpu_isa_t isa>
+struct jit_uni_sum_t : public primitive_t {
+    using kernel_t = jit_uni_sum_kernel_t<isa>;
+
+    struct pd_t : public cpu_sum_pd_t {
+        using cpu_sum_pd_t::cpu_sum_pd_t;
+
+        DECLARE_SUM_PD_T(JIT_IMPL_NAME_HELPER("jit:", isa, ""), jit_uni_sum_t);
+
+        status_t init(engine_t *engine) {
+            using namespace data_type;
+
+            bool ok = mayiuse(isa)
+                    && cpu_sum_pd_t::init(engine) == status::success
+                    && n_inputs() <= jit_uni_sum_conf_t::max_num_arrs;
+            if (!ok) return status::unimplemented;
+
+            const memory_desc_wrapper o_d(dst_md());
+            ok = utils::one_of(o_d.data_type(), f32, s8, u8)
+                    && o_d.is_dense(true);
+            if (!ok) return status::unimplemented;
+
+            for (int i = 0; i < n_inputs(); ++i) {
+                const memory_desc_wrapper i_d(src_md(i));
+                ok = utils::one_of(i_d.data_type(), f32, s8, u8)
+                        && o_d.similar_to(i_d, true, false, 0)
+                        && i_d.is_dense(true);
+                if (!ok) return status::unimplemented;
+            }
+
+            return kernel_t::init_conf(
+                    jsp_, n_inputs(), src_mds_.data(), dst_md_);
+        }
+
+        jit_uni_sum_conf_t jsp_;
+    };
+
+    jit_uni_sum_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override {
+        CHECK(safe_ptr_assign(kernel_, new kernel_t(pd()->jsp_)));
+        return kernel_->create_kernel();
+    }
+
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+    std::unique_ptr<kernel_t> kernel_;
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -224,11 +224,14 @@ void _jit_uni_x8s8s32x_1x1_conv_kernel<isa, Vmm>::reduce_loop(
         int load_loop_blk, int ur, int substep, bool wraparound) {
 
     // use 0x10001 to represent 2 words of 0x1
-    // and avoid using uni_vpbroadcastb that is missing in jit generator
-    const auto xmm_one = Xmm(vmm_one.getIdx());
-    mov(reg_init_bcast, 0x10001);
-    uni_vmovq(xmm_one, reg_init_bcast);
-    uni_vpbroadcastd(vmm_one, xmm_one);
+    // and avoid using uni_vpbroadcastb that is missing in jit generator;
+    // vpdpbusd accumulates the dwords directly and does not need it
+    if (jcp.ver != ver_vnni) {
+        const auto xmm_one = Xmm(vmm_one.getIdx());
+        mov(reg_init_bcast, 0x10001);
+        uni_vmovq(xmm_one, reg_init_bcast);
+        uni_vpbroadcastd(vmm_one, xmm_one);
+    }
 
     auto vreg_load = [&](int i_load) {
         const int vmm_idx = ur * load_loop_blk + i_load;
@@ -96,7 +96,8 @@ jit_uni_x8s8s32x_convolution_fwd_t<isa, src_type, dst_type>::execute_forward_2d(
     int nb_groups = jcp.nb_ch;
     int work_amount = jcp.mb * nb_groups * oc_chunks * jcp.oh * jcp.nb_ow;
 
-    parallel(jcp.nthr, [&](const int ithr, const int nthr) {
+    const int nthr_exec = dnnl_get_exec_num_threads(jcp.nthr);
+    parallel(nthr_exec, [&](const int ithr, const int nthr) {
         int start {0}, end {0};
         balance211(work_amount, nthr, ithr, start, end);
 
@@ -270,7 +271,8 @@ jit_uni_x8s8s32x_convolution_fwd_t<isa, src_type, dst_type>::execute_forward_1d(
     int nb_groups = jcp.nb_ch / jcp.nb_ch_blocking;
     int group_block = jcp.ch_block;
     int work_amount = jcp.mb * nb_groups * oc_chunks * jcp.nb_ow;
-    parallel(jcp.nthr, [&](const int ithr, const int nthr) {
+    const int nthr_exec = dnnl_get_exec_num_threads(jcp.nthr);
+    parallel(nthr_exec, [&](const int ithr, const int nthr) {
         int start {0}, end {0};
         balance211(work_amount, nthr, ithr, start, end);
 
@@ -535,7 +537,8 @@ jit_uni_x8s8s32x_convolution_fwd_t<isa, src_type, dst_type>::execute_forward_3d(
     int work_amount
             = jcp.mb * nb_groups * oc_chunks * jcp.od * jcp.oh * jcp.nb_ow;
 
-    parallel(jcp.nthr, [&](const int ithr, const int nthr) {
+    const int nthr_exec = dnnl_get_exec_num_threads(jcp.nthr);
+    parallel(nthr_exec, [&](const int ithr, const int nthr) {
         int start {0}, end {0};
         balance211(work_amount, nthr, ithr, start, end);
 
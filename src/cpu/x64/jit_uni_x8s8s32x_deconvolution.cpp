@@ -899,10 +899,12 @@ template <cpu_isa_t isa, typename Vmm>
 void _jit_uni_x8s8s32x_deconv_fwd_kernel<isa, Vmm>::generate() {
     preamble();
 
-    auto vmm_one_128 = Xbyak::Xmm(vmm_one.getIdx());
-    mov(reg_scratch, 0x10001);
-    uni_vmovq(vmm_one_128, reg_scratch);
-    uni_vpbroadcastd(vmm_one, vmm_one_128);
+    if (jcp.ver != ver_vnni) {
+        auto vmm_one_128 = Xbyak::Xmm(vmm_one.getIdx());
+        mov(reg_scratch, 0x10001);
+        uni_vmovq(vmm_one_128, reg_scratch);
+        uni_vpbroadcastd(vmm_one, vmm_one_128);
+    }
 
     mov(reg_src, ptr[param1 + GET_OFF(src)]);
     mov(reg_filt, ptr[param1 + GET_OFF(filt)]);
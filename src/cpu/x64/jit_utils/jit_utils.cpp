@@ -14,9 +14,13 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <map>
 #include <mutex>
+#include <string>
 
+#include "common/primitive.hpp"
 #include "common/utils.hpp"
+#include "common/verbose.hpp"
 
 #ifndef DNNL_ENABLE_JIT_PROFILING
 #define DNNL_ENABLE_JIT_PROFILING 1
@@ -132,6 +136,67 @@ void register_jit_code(const void *code, size_t code_size,
 #endif
 }
 
+namespace {
+// Prints a kernel generation, or the totals of a kernel with `count`
+// instances at exit.
+void print_jit_code_stats(bool is_summary, const char *code_name,
+        size_t count, size_t code_size, double gen_time_ms) {
+    if (get_verbose_json()) {
+        std::string s = is_summary ? "{\"event\":\"jit_summary\""
+                                   : "{\"event\":\"jit_create\"";
+        verbose_json_append(s, "kernel", code_name);
+        verbose_printf("%s,\"count\":%zu,\"size\":%zu,\"time_ms\":%g}\n",
+                s.c_str(), count, code_size, gen_time_ms);
+    } else if (is_summary) {
+        verbose_printf(
+                "dnnl_verbose,jit,summary,%s,count:%zu,size:%zu,time:%g\n",
+                code_name, count, code_size, gen_time_ms);
+    } else {
+        verbose_printf("dnnl_verbose,jit,create,%s,size:%zu,time:%g\n",
+                code_name, code_size, gen_time_ms);
+    }
+}
+
+struct jit_code_stats_t {
+    size_t count = 0;
+    size_t code_size = 0;
+    double gen_time_ms = 0;
+};
+
+struct jit_code_stats_registry_t {
+    ~jit_code_stats_registry_t() {
+        for (const auto &e : stats)
+            print_jit_code_stats(true, e.first.c_str(), e.second.count,
+                    e.second.code_size, e.second.gen_time_ms);
+    }
+
+    std::map<std::string, jit_code_stats_t> stats;
+};
+} // namespace
+
+void record_jit_code_stats(
+        const char *code_name, size_t code_size, double gen_time_ms) {
+    jit_code_size_tracker_t::add(code_size);
+#if !defined(DISABLE_VERBOSE)
+    if (get_verbose() < 3) return;
+
+    static std::mutex m;
+    static jit_code_stats_registry_t registry;
+    std::lock_guard<std::mutex> guard(m);
+
+    print_jit_code_stats(false, code_name, 1, code_size, gen_time_ms);
+
+    auto &s = registry.stats[code_name];
+    s.count++;
+    s.code_size += code_size;
+    s.gen_time_ms += gen_time_ms;
+#else
+    UNUSED(code_name);
+    UNUSED(code_size);
+    UNUSED(gen_time_ms);
+#endif
+}
+
 } // namespace jit_utils
 } // namespace x64
 } // namespace cpu
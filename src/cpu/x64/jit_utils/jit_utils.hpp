@@ -28,6 +28,13 @@ namespace jit_utils {
 void register_jit_code(const void *code, size_t code_size,
         const char *code_name, const char *source_file_name);
 
+// Accounts the size of a JIT kernel to the primitive being created. Also
+// reports the size and the generation time of the kernel when verbose level 3
+// is set, and accumulates them per kernel name for the summary printed at
+// exit.
+void record_jit_code_stats(
+        const char *code_name, size_t code_size, double gen_time_ms);
+
 }
 } // namespace x64
 } // namespace cpu
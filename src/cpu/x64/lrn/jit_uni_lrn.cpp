@@ -235,6 +235,9 @@ status_t jit_uni_lrn_bwd_t<isa, d_type>::init(engine_t *engine) {
     if (one_of(dat_tag, nhwc, nChw8c, nChw16c) && ak == lrn_within_channel) {
         ker_ = utils::make_unique<jit_uni_lrn_bwd_kernel_t<isa, d_type>>(
                 within_config_t(H, W, C, ls, dat_tag), A, B);
+    } else if (dat_tag == nhwc) {
+        ker_ = utils::make_unique<jit_uni_lrn_bwd_kernel_t<isa, d_type>>(
+                nhwc_across_t(C), A, B);
     } else {
         int use_h_parallelism = 0; // XXX
         if (C / VECTOR_LENGTH == 1) {
@@ -289,6 +292,13 @@ void jit_uni_lrn_bwd_t<isa, d_type>::execute_backward(
                     &ws[offset + tensor_size], &diff_src[offset]};
             (*ker)(&args);
         });
+    } else if (dat_tag == nhwc) {
+        parallel_nd(N, H * W, [&](int n, int hw) {
+            const std::size_t offset = n * H * W * C + hw * C;
+            jit_args_bwd_t args {&src[offset], &diff_dst[offset], &ws[offset],
+                    nullptr, &diff_src[offset]};
+            (*ker)(&args);
+        });
     } else if (use_h_parallelism) {
         parallel_nd(N, C / VECTOR_LENGTH, H, [&](int n, int c8, int h) {
             const std::size_t offset = n * C * H * W
@@ -345,7 +355,8 @@ status_t jit_uni_lrn_bwd_t<isa, d_type>::pd_t::init(engine_t *engine) {
     if (!compare_ws(hint_fwd_pd_)) return unimplemented;
 
     const bool args_ok_across = true && desc()->alg_kind == lrn_across_channels
-            && desc()->local_size == 5 && utils::one_of(dat_tag_, nChw8c)
+            && desc()->local_size == 5
+            && utils::one_of(dat_tag_, nChw8c, nhwc)
             && everyone_is(data_type::f32, data_d.data_type())
             && isa != avx512_common;
 
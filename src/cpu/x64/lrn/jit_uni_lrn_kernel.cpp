@@ -1735,6 +1735,123 @@ void jit_uni_lrn_bwd_kernel_t<isa, d_type>::move_data_pointers(
     this->add(bwd_intermediate_res_, pixel_offset);
 }
 
+template <cpu_isa_t isa, data_type_t d_type>
+jit_uni_lrn_bwd_kernel_t<isa, d_type>::jit_uni_lrn_bwd_kernel_t(
+        const nhwc_across_t &J, float A, float B, void *code_ptr,
+        size_t code_size)
+    : Base(code_ptr, code_size)
+    , config_(lrn_config_t::nhwc_across)
+    , nhwc_across_(J)
+    , nalphabeta_(-2 * A * B)
+    , use_h_parallelizm_(0) {}
+
+template <cpu_isa_t isa, data_type_t d_type>
+void jit_uni_lrn_bwd_kernel_t<isa, d_type>::nhwc_across_body(
+        bool is_first, bool is_last) {
+    static const uint32_t mask[] = {0, 0, 0x80000000, 0x80000000, 0x80000000,
+            0x80000000, 0x80000000, 0x80000000, 0x80000000, 0, 0};
+
+    const Xbyak::Ymm &yzero = this->ymm1;
+    const Xbyak::Ymm &ymask = this->ymm2;
+    const Xbyak::Ymm &ysrc = this->ymm3;
+    const Xbyak::Ymm &yws = this->ymm4;
+    const Xbyak::Ymm &ydiffdst = this->ymm5;
+    const Xbyak::Ymm &ya = this->ymm6;
+    const Xbyak::Ymm &yt = this->ymm7;
+    const Xbyak::Ymm &ysum = this->ymm8;
+    const Xbyak::Ymm &ydiffsrc = this->ymm9;
+    const Xbyak::Ymm &ysrc0 = this->ymm10;
+
+    // ysum <- ysum + diff_dst * dst / ws for the channels shifted by `shift`,
+    // where dst = src / ws^0.75. The lanes outside of [0, C) are masked out.
+    auto add_shifted = [&](int shift, const uint32_t *shift_mask) {
+        const int off = shift * sizeof(float);
+        if (shift_mask) {
+            this->mov(this->imm_addr64_, reinterpret_cast<size_t>(shift_mask));
+            this->vmovups(ymask, this->ptr[this->imm_addr64_]);
+            this->vmaskmovps(ysrc, ymask, this->ptr[src_ + off]);
+            this->vmaskmovps(yws, ymask, this->ptr[scratch_ + off]);
+            this->vmaskmovps(ydiffdst, ymask, this->ptr[diffdst_ + off]);
+        } else {
+            this->vmovups(ysrc, this->ptr[src_ + off]);
+            this->vmovups(yws, this->ptr[scratch_ + off]);
+            this->vmovups(ydiffdst, this->ptr[diffdst_ + off]);
+        }
+        this->vmulps(ya, yws, yws);
+        this->vmulps(ya, ya, yws);
+        this->vsqrtps(ya, ya);
+        this->vsqrtps(ya, ya);
+        this->vmulps(ya, ya, yws); // ya = ws^1.75
+        this->vdivps(yt, ysrc, ya);
+        this->vmulps(yt, yt, ydiffdst);
+        // masked lanes are 0 / 0, replace them with zeros
+        if (shift_mask) this->vblendvps(yt, yzero, yt, ymask);
+        this->vaddps(ysum, ysum, yt);
+    };
+
+    this->vmovups(ysrc0, this->ptr[src_]);
+    this->vmovups(yws, this->ptr[scratch_]);
+    this->vmovups(ydiffdst, this->ptr[diffdst_]);
+    this->vmulps(ya, yws, yws);
+    this->vmulps(ya, ya, yws);
+    this->vsqrtps(ya, ya);
+    this->vsqrtps(ya, ya); // ya = ws^0.75
+    this->vdivps(ydiffsrc, ydiffdst, ya);
+    this->vdivps(ysum, ydiffsrc, yws);
+    this->vmulps(ysum, ysum, ysrc0);
+
+    add_shifted(-2, is_first ? &mask[0] : nullptr);
+    add_shifted(-1, is_first ? &mask[1] : nullptr);
+    add_shifted(+1, is_last ? &mask[2] : nullptr);
+    add_shifted(+2, is_last ? &mask[3] : nullptr);
+
+    this->vmulps(ysrc0, ysrc0, vnalphabeta_);
+    this->vfmadd231ps(ydiffsrc, ysum, ysrc0);
+    this->vmovups(this->ptr[diffsrc_], ydiffsrc);
+
+    this->add(src_, 32);
+    this->add(diffsrc_, 32);
+    this->add(diffdst_, 32);
+    this->add(scratch_, 32);
+}
+
+template <cpu_isa_t isa, data_type_t d_type>
+void jit_uni_lrn_bwd_kernel_t<isa, d_type>::generate(const nhwc_across_t &J) {
+    const Xbyak::Reg64 &c = this->r9;
+    const Xbyak::Ymm &yzero = this->ymm1;
+
+    this->preamble();
+
+#define GET_OFF(field) offsetof(jit_args_bwd_t, field)
+    this->mov(src_, this->ptr[this->param1 + GET_OFF(src)]);
+    this->mov(diffdst_, this->ptr[this->param1 + GET_OFF(diff_dst)]);
+    this->mov(scratch_, this->ptr[this->param1 + GET_OFF(scratch)]);
+    this->mov(diffsrc_, this->ptr[this->param1 + GET_OFF(diff_src)]);
+#undef GET_OFF
+
+    this->mov(this->imm_addr64_, float2int(this->nalphabeta_));
+    this->vmovq(xnalphabeta_, this->imm_addr64_);
+    this->vbroadcastss(vnalphabeta_, xnalphabeta_);
+    this->vxorps(yzero, yzero, yzero);
+
+    // C >= 16, so the first and the last blocks of channels are different
+    nhwc_across_body(true, false);
+
+    const int n_middle = J.C / 8 - 2;
+    if (n_middle > 0) {
+        Label lrn_loop;
+        this->mov(c, n_middle);
+        this->L(lrn_loop);
+        nhwc_across_body(false, false);
+        this->dec(c);
+        this->jnz(lrn_loop, this->T_NEAR);
+    }
+
+    nhwc_across_body(false, true);
+
+    this->postamble();
+}
+
 template class jit_uni_lrn_fwd_kernel_t<sse41, dnnl::impl::data_type::f32>;
 template class jit_uni_lrn_fwd_kernel_t<avx2, dnnl::impl::data_type::f32>;
 template class jit_uni_lrn_fwd_kernel_t<avx512_common,
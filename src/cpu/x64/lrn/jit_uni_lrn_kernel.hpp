@@ -222,6 +222,9 @@ public:
     jit_uni_lrn_bwd_kernel_t(const within_config_t &J, float A, float B,
             void *code_ptr = nullptr,
             size_t code_size = 4 * Xbyak::DEFAULT_MAX_CODE_SIZE);
+    jit_uni_lrn_bwd_kernel_t(const nhwc_across_t &J, float A, float B,
+            void *code_ptr = nullptr,
+            size_t code_size = 1 * Xbyak::DEFAULT_MAX_CODE_SIZE);
 
 private:
     using Base = jit_uni_lrn_kernel_t<jit_uni_lrn_bwd_kernel_t<isa, d_type>>;
@@ -234,11 +237,15 @@ private:
             case lrn_config_t::within_config:
                 generate(this->within_config_);
                 return;
+            case lrn_config_t::nhwc_across:
+                generate(this->nhwc_across_);
+                return;
             default: assert(!"Configuration not supported"); return;
         }
     }
     void generate(const nchw8c_across_t &config);
     void generate(const within_config_t &config);
+    void generate(const nhwc_across_t &config);
 
 public:
     using Base::VECTOR_LENGTH;
@@ -250,10 +257,12 @@ private:
     void within_body(int hoff, int Hoff, int woff, int Woff, int stride,
             prop_kind_t pk, int reg_block = 1, int single_pixel_offset = 0);
     void move_data_pointers(int pixel_count, prop_kind_t pk);
+    void nhwc_across_body(bool is_first, bool is_last);
 
     lrn_config_t config_;
     const nchw8c_across_t nchw8c_across_;
     const within_config_t within_config_;
+    const nhwc_across_t nhwc_across_;
     prop_kind_t pk_ = prop_kind::backward;
 
     float nalphabeta_;
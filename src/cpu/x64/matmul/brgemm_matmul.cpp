@@ -0,0 +1,562 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_primitive.hpp"
+
+#include "cpu/x64/amx_tile_configure.hpp"
+#include "cpu/x64/matmul/brgemm_matmul.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+namespace matmul {
+
+using namespace dnnl::impl::data_type;
+using namespace dnnl::impl::memory_tracking::names;
+using namespace dnnl::impl::status;
+using namespace dnnl::impl::utils;
+
+namespace {
+
+// Offset of the wei_b-th matrix B within the (non-broadcast) weights batch
+dim_t get_wei_batch_offset(const memory_desc_wrapper &weights_d,
+        const brgemm_matmul_conf_t &bgmmc, dim_t wei_b) {
+    const auto &dims = weights_d.dims();
+    const auto &strides = weights_d.blocking_desc().strides;
+    dim_t off = weights_d.offset0();
+    for (int d = bgmmc.batch_ndims - 1; d >= 0; d--) {
+        off += (wei_b % dims[d]) * strides[d];
+        wei_b /= dims[d];
+    }
+    return off;
+}
+
+// Copies plain matrix B into panels of N_blk columns, K_padded rows each,
+// with every b_vnni_granularity consecutive rows interleaved.
+template <typename data_t>
+void copy_B_panels(const brgemm_matmul_conf_t &bgmmc,
+        const memory_desc_wrapper &weights_d, const data_t *wei,
+        data_t *b_buffer) {
+    const int ndims = bgmmc.ndims;
+    const dim_t stride_K = weights_d.blocking_desc().strides[ndims - 2];
+    const dim_t stride_N = weights_d.blocking_desc().strides[ndims - 1];
+    const int vnni = bgmmc.b_vnni_granularity;
+    const dim_t panel_size = bgmmc.K_padded * bgmmc.N_blk;
+
+    parallel_nd(bgmmc.wei_batch, bgmmc.nb_N, [&](dim_t wb, dim_t nb) {
+        const data_t *src = wei + get_wei_batch_offset(weights_d, bgmmc, wb);
+        data_t *panel = b_buffer + (wb * bgmmc.nb_N + nb) * panel_size;
+        const dim_t n_start = nb * bgmmc.N_blk;
+        const dim_t n_work = nstl::min(bgmmc.N - n_start, bgmmc.N_blk);
+        for (dim_t k = 0; k < bgmmc.K_padded; k++) {
+            data_t *row = panel + (k / vnni) * bgmmc.N_blk * vnni + k % vnni;
+            for (dim_t n = 0; n < bgmmc.N_blk; n++) {
+                row[n * vnni] = (k < bgmmc.K && n < n_work)
+                        ? src[k * stride_K + (n_start + n) * stride_N]
+                        : (data_t)0;
+            }
+        }
+    });
+}
+
+status_t init_brg_desc(brgemm_t &brg, cpu_isa_t isa,
+        const brgemm_matmul_conf_t &bgmmc, const primitive_attr_t *attr,
+        bool do_initialization, int M_idx, bool is_N_tail, bool is_K_tail) {
+    const float alpha = 1.0;
+    const float beta = do_initialization ? 0.0 : 1.0;
+    const auto vM = get_brg_kernel_M(bgmmc, M_idx);
+    const auto vN = (is_N_tail) ? bgmmc.N_tail : bgmmc.N_blk;
+    const auto vK = (is_K_tail) ? bgmmc.K_tail : bgmmc.K_blk;
+
+    CHECK(brgemm_desc_init(&brg, isa, bgmmc.brg_type, bgmmc.src_dt,
+            bgmmc.wei_dt, false, false, brgemm_row_major, alpha, beta,
+            bgmmc.LDA, bgmmc.LDB, bgmmc.LDC, vM, vN, vK));
+
+    CHECK(brgemm_desc_add_postops(
+            &brg, attr, bgmmc.dst_dt, bgmmc.LDD, bgmmc.bia_dt));
+    // brgemm assumes 2D (IP-like) scales mask, use the matmul one instead
+    brg.is_oc_scale = bgmmc.is_oc_scale;
+    return status::success;
+}
+
+// Whether the kernel is used by the problem described by the (complete)
+// configuration. Allows to skip jitting unused kernels for runtime shapes.
+bool is_brg_kernel_used(const brgemm_matmul_conf_t &bgmmc,
+        bool do_initialization, int M_idx, bool is_N_tail, bool is_K_tail) {
+    if (M_idx == 0 && bgmmc.M < bgmmc.M_blk) return false;
+    if (M_idx > 0 && bgmmc.is_runtime_M
+            && !((bgmmc.M % bgmmc.M_blk) & get_brg_kernel_M(bgmmc, M_idx)))
+        return false;
+    if (!is_N_tail && bgmmc.N < bgmmc.N_blk) return false;
+    if (is_K_tail) return do_initialization == (bgmmc.nb_K == 0);
+    return do_initialization || bgmmc.nb_K > bgmmc.brgemm_batch_size;
+}
+
+} // namespace
+
+template <cpu_isa_t isa>
+status_t brgemm_matmul_t<isa>::pd_t::init(engine_t *engine) {
+    const auto src_dt = src_md_.data_type;
+    const bool is_int8 = one_of(src_dt, u8, s8);
+    // s8 weights with f32 or bf16 src carry their scales as output scales
+    const bool is_wei_decomp = !is_int8 && weights_md_.data_type == s8;
+
+    auto check_bias = [&]() -> bool {
+        if (!with_bias()) return true;
+        const auto bia_dt = weights_md(1)->data_type;
+        bool bia_dt_ok = bia_dt == f32;
+        if (is_int8) bia_dt_ok = one_of(bia_dt, f32, s32, s8, u8);
+        if (src_dt == bf16) bia_dt_ok = one_of(bia_dt, f32, bf16);
+        return bia_dt_ok && is_bias_batched_1xN();
+    };
+
+    auto check_attr = [&]() -> bool {
+        if (is_int8 || is_wei_decomp) {
+            return attr()->has_default_values(
+                    primitive_attr_t::skip_mask_t::oscale
+                    | primitive_attr_t::skip_mask_t::post_ops);
+        } else {
+            return attr()->has_default_values(
+                    primitive_attr_t::skip_mask_t::post_ops);
+        }
+    };
+
+    // runtime dimensions are checked by init_brgemm_matmul_conf()
+    bool ok = true && mayiuse(isa) && check_bias() && check_attr()
+            && !has_zero_dim_memory();
+    if (!ok) return status::unimplemented;
+
+    CHECK(brgemm_matmul_utils::init_brgemm_matmul_conf(isa, bgmmc_, *desc(),
+            src_md_, weights_md_, dst_md_, bias_md_, *attr()));
+
+    if (with_bias()) {
+        const memory_desc_wrapper bias_d(&bias_md_);
+        if (!bias_d.is_plain()
+                || bias_d.blocking_desc().strides[ndims() - 1] != 1)
+            return status::unimplemented;
+    }
+
+    // the kernels for runtime shapes are created at execution
+    for_(int i_init = 0; i_init < 2; i_init++)
+    for_(int i_M = 0; i_M < bgmmc_.num_M_kernels; i_M++)
+    for_(int i_N = 0; i_N < 2; i_N++)
+    for (int i_K = 0; i_K < 2; i_K++) {
+        if (bgmmc_.use_kernel_cache) break;
+        int idx = get_brg_kernel_idx(i_init, i_M, i_N, i_K);
+        if (idx < 0) continue;
+        CHECK(init_brg_desc(brg_descs_[idx], isa, bgmmc_, attr(), i_init, i_M,
+                i_N, i_K));
+    }
+
+    auto scratchpad = scratchpad_registry().registrar();
+    brgemm_matmul_utils::init_scratchpad(scratchpad, bgmmc_);
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_matmul_t<isa>::init(engine_t *engine) {
+    const bool is_amx = one_of(
+            isa, avx512_core_bf16_amx_int8, avx512_core_bf16_amx_bf16);
+    const auto &bgmmc = pd()->get_brgemm_matmul_conf();
+    if (bgmmc.use_kernel_cache) return status::success;
+
+    const brgemm_t *descs[max_num_brg_kernels_matmul] = {nullptr};
+    for_(int i_M = 0; i_M < bgmmc.num_M_kernels; i_M++)
+    for_(int i_N = 0; i_N < 2; i_N++)
+    for_(int i_K = 0; i_K < 2; i_K++)
+    for (int i_init = 0; i_init < 2; i_init++) {
+        int idx = pd()->get_brg_kernel_idx(i_init, i_M, i_N, i_K);
+        if (idx >= 0) descs[idx] = &pd()->get_brg_desc(idx);
+    }
+
+    brgemm_kernel_t *kers[max_num_brg_kernels_matmul];
+    CHECK(brgemm_kernels_create(max_num_brg_kernels_matmul, kers, descs));
+    for (int idx = 0; idx < max_num_brg_kernels_matmul; idx++) {
+        if (!descs[idx]) continue;
+        CHECK(safe_ptr_assign(brg_kernels_[idx], kers[idx]));
+        if (is_amx)
+            CHECK(brgemm_init_tiles(
+                    pd()->get_brg_desc(idx), &brg_kernel_palettes_[idx][0]));
+    }
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_matmul_t<isa>::get_kernels(const brgemm_matmul_conf_t &bgmmc,
+        kernel_set_t &kernels) const {
+    for (int idx = 0; idx < max_num_brg_kernels_matmul; idx++) {
+        kernels.ker[idx] = brg_kernels_[idx].get();
+        kernels.holder[idx].reset();
+    }
+    if (!bgmmc.use_kernel_cache) return status::success;
+
+    std::lock_guard<std::mutex> lock(rt_kernels_mutex_);
+    for_(int i_init = 0; i_init < 2; i_init++)
+    for_(int i_M = 0; i_M < bgmmc.num_M_kernels; i_M++)
+    for_(int i_N = 0; i_N < 2; i_N++)
+    for (int i_K = 0; i_K < 2; i_K++) {
+        int idx = get_brg_kernel_index(bgmmc, i_init, i_M, i_N, i_K);
+        if (idx < 0 || !is_brg_kernel_used(bgmmc, i_init, i_M, i_N, i_K))
+            continue;
+
+        brgemm_t brg;
+        CHECK(init_brg_desc(
+                brg, isa, bgmmc, pd()->attr(), i_init, i_M, i_N, i_K));
+        const rt_kernel_key_t key {brg.bcast_dim, brg.load_dim,
+                brg.reduce_dim, brg.LDA, brg.LDB, brg.LDC, brg.LDD,
+                brg.beta == 0.f};
+
+        auto it = rt_kernels_.find(key);
+        if (it == rt_kernels_.end()) {
+            // The primitive may serve an unbounded number of shapes, start
+            // over once the cache is full. The kernels in use stay alive
+            // through the shared pointers held by the running executions.
+            if (rt_kernels_.size() >= rt_kernels_capacity) rt_kernels_.clear();
+
+            brgemm_kernel_t *ker = nullptr;
+            CHECK(brgemm_kernel_create(&ker, brg));
+            it = rt_kernels_.emplace(key, std::shared_ptr<brgemm_kernel_t>(ker))
+                         .first;
+        }
+        kernels.holder[idx] = it->second;
+        kernels.ker[idx] = it->second.get();
+    }
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+void brgemm_matmul_t<isa>::prepare_B(const exec_ctx_t &ctx,
+        const char *&wei_base, int32_t *&compensation) const {
+    const auto &bgmmc = pd()->get_brgemm_matmul_conf();
+    const memory_desc_wrapper weights_d(pd()->weights_md(0));
+    const auto scratchpad = ctx.get_scratchpad_grantor();
+
+    auto weights = CTX_IN_MEM(const char *, DNNL_ARG_WEIGHTS);
+    wei_base = weights;
+    compensation = nullptr;
+
+    if (bgmmc.b_kind == brgemm_matmul_b_copy) {
+        char *b_buffer = scratchpad.template get<char>(
+                key_brgemm_primitive_buffer_b);
+        switch (bgmmc.wei_dt) {
+            case f32:
+                copy_B_panels<float>(bgmmc, weights_d,
+                        reinterpret_cast<const float *>(weights),
+                        reinterpret_cast<float *>(b_buffer));
+                break;
+            case bf16:
+                copy_B_panels<bfloat16_t>(bgmmc, weights_d,
+                        reinterpret_cast<const bfloat16_t *>(weights),
+                        reinterpret_cast<bfloat16_t *>(b_buffer));
+                break;
+            case s8:
+                copy_B_panels<int8_t>(bgmmc, weights_d,
+                        reinterpret_cast<const int8_t *>(weights),
+                        reinterpret_cast<int8_t *>(b_buffer));
+                break;
+            default: assert(!"unsupported weights data type");
+        }
+        wei_base = b_buffer;
+    }
+
+    if (!bgmmc.s8s8_compensation_required) return;
+
+    // s8s8 kernels shift src by 128, the compensation -128 * sum_k(B) is
+    // applied together with bias before scaling
+    compensation = scratchpad.template get<int32_t>(
+            key_brgemm_primitive_buffer_comp);
+    const int vnni = bgmmc.b_vnni_granularity;
+    const dim_t panel_size = bgmmc.K_padded * bgmmc.N_blk;
+    parallel_nd(bgmmc.wei_batch, bgmmc.nb_N, [&](dim_t wb, dim_t nb) {
+        const int8_t *panel = bgmmc.b_kind == brgemm_matmul_b_copy
+                ? reinterpret_cast<const int8_t *>(wei_base)
+                        + (wb * bgmmc.nb_N + nb) * panel_size
+                : reinterpret_cast<const int8_t *>(wei_base)
+                        + (bgmmc.ndims == 3 ? weights_d.blk_off(wb, 0, nb)
+                                            : weights_d.blk_off(0, nb));
+        int32_t *comp = compensation + (wb * bgmmc.nb_N + nb) * bgmmc.N_blk;
+        for (dim_t n = 0; n < bgmmc.N_blk; n++) {
+            int32_t acc = 0;
+            for (dim_t k = 0; k < bgmmc.K; k++)
+                acc += panel[(k / vnni) * bgmmc.N_blk * vnni + n * vnni
+                        + k % vnni];
+            comp[n] = -128 * acc;
+        }
+    });
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_matmul_t<isa>::execute_body(const exec_ctx_t &ctx) const {
+    auto src = CTX_IN_MEM(const char *, DNNL_ARG_SRC);
+    auto bias = CTX_IN_MEM(const char *, DNNL_ARG_BIAS);
+    auto dst = CTX_OUT_MEM(char *, DNNL_ARG_DST);
+
+    const auto src_d = ctx.memory_mdw(DNNL_ARG_SRC, pd()->src_md());
+    const auto weights_d
+            = ctx.memory_mdw(DNNL_ARG_WEIGHTS, pd()->weights_md(0));
+    const auto bias_d = ctx.memory_mdw(DNNL_ARG_BIAS, pd()->weights_md(1));
+    const auto dst_d = ctx.memory_mdw(DNNL_ARG_DST, pd()->dst_md());
+
+    // the blocking for runtime shapes is completed here, runtime values are
+    // only supported for 2D problems
+    brgemm_matmul_conf_t bgmmc = pd()->get_brgemm_matmul_conf();
+    if (bgmmc.is_runtime_M || bgmmc.use_kernel_cache) {
+        CHECK(brgemm_matmul_utils::init_blocking(bgmmc, dst_d.dims()[0],
+                dst_d.dims()[1], src_d.dims()[1],
+                src_d.blocking_desc().strides[0],
+                weights_d.blocking_desc().strides[0],
+                dst_d.blocking_desc().strides[0]));
+    }
+    if (bgmmc.M == 0 || bgmmc.N == 0) return status::success;
+    if (bgmmc.K == 0) return status::unimplemented;
+
+    kernel_set_t kernels;
+    CHECK(get_kernels(bgmmc, kernels));
+
+    const char *wei_base = nullptr;
+    int32_t *compensation = nullptr;
+    prepare_B(ctx, wei_base, compensation);
+
+    memory_tracking::grantor_t scratchpad = ctx.get_scratchpad_grantor();
+    const float *oscales = pd()->attr()->output_scales_.scales_;
+
+    const size_t src_dt_sz = types::data_type_size(bgmmc.src_dt);
+    const size_t wei_dt_sz = types::data_type_size(bgmmc.wei_dt);
+    const size_t dst_dt_sz = types::data_type_size(bgmmc.dst_dt);
+    const size_t acc_dt_sz = types::data_type_size(bgmmc.acc_dt);
+    const size_t bia_dt_sz
+            = bgmmc.with_bias ? types::data_type_size(bgmmc.bia_dt) : 0;
+
+    const void **addr_A_global = scratchpad.template get<const void *>(
+            key_brgemm_primitive_addr_a);
+    const void **addr_B_global = scratchpad.template get<const void *>(
+            key_brgemm_primitive_addr_b);
+    char *c_buffer_global = (bgmmc.use_buffer_c)
+            ? scratchpad.template get<char>(key_brgemm_primitive_buffer)
+            : nullptr;
+    const bool is_amx = one_of(
+            isa, avx512_core_bf16_amx_int8, avx512_core_bf16_amx_bf16);
+    char *wsp_tile_base = is_amx
+            ? scratchpad.template get<char>(key_conv_amx_tile_buffer)
+            : nullptr;
+
+    const bool are_post_ops_applicable = one_of(true, bgmmc.with_sum,
+            bgmmc.with_bias, bgmmc.with_scales, bgmmc.with_eltwise,
+            bgmmc.acc_dt != bgmmc.dst_dt, bgmmc.s8s8_compensation_required);
+
+    const auto &src_dims = src_d.dims();
+    const auto &wei_dims = weights_d.dims();
+    const auto &dst_dims = dst_d.dims();
+    const auto &src_strides = src_d.blocking_desc().strides;
+    const auto &wei_strides = weights_d.blocking_desc().strides;
+    const auto &dst_strides = dst_d.blocking_desc().strides;
+
+    const dim_t panel_size = bgmmc.K_padded * bgmmc.N_blk;
+
+    const auto ker = [&](const int ithr, dim_t b, dim_t mb, dim_t nb) {
+        const void **addr_A = addr_A_global + ithr * bgmmc.brgemm_batch_size;
+        const void **addr_B = addr_B_global + ithr * bgmmc.brgemm_batch_size;
+        char *c_buffer = (bgmmc.use_buffer_c) ? c_buffer_global
+                        + ithr * acc_dt_sz * bgmmc.LDC * bgmmc.M_blk
+                                              : nullptr;
+        char *wsp_tile = is_amx ? wsp_tile_base + ithr * 1024 : nullptr;
+
+        // decompose the dst batch index, broadcasting src and weights where
+        // their batch dimensions are equal to one
+        dim_t src_off = src_d.offset0(), wei_off = weights_d.offset0();
+        dim_t dst_off = dst_d.offset0(), wei_b = 0, wei_b_mult = 1;
+        dim_t bia_off = bgmmc.with_bias ? bias_d.offset0() : 0;
+        for (int d = bgmmc.batch_ndims - 1; d >= 0; d--) {
+            const dim_t idx = b % dst_dims[d];
+            b /= dst_dims[d];
+            if (src_dims[d] != 1) src_off += idx * src_strides[d];
+            if (bgmmc.with_bias && bias_d.dims()[d] != 1)
+                bia_off += idx * bias_d.blocking_desc().strides[d];
+            if (wei_dims[d] != 1) {
+                wei_off += idx * wei_strides[d];
+                wei_b += idx * wei_b_mult;
+            }
+            wei_b_mult *= wei_dims[d];
+            dst_off += idx * dst_strides[d];
+        }
+
+        const dim_t m = mb * bgmmc.M_blk;
+        const dim_t n = nb * bgmmc.N_blk;
+        const dim_t M_work = nstl::min(bgmmc.M - m, bgmmc.M_blk);
+        const bool is_N_tail = bgmmc.N - n < bgmmc.N_blk;
+
+        const char *ptr_B = nullptr;
+        switch (bgmmc.b_kind) {
+            case brgemm_matmul_b_plain:
+                ptr_B = wei_base + wei_dt_sz * (wei_off + n);
+                break;
+            case brgemm_matmul_b_blocked: {
+                const dim_t panel_off = bgmmc.ndims == 3
+                        ? weights_d.blk_off(wei_b, 0, nb)
+                        : weights_d.blk_off(0, nb);
+                ptr_B = wei_base + wei_dt_sz * panel_off;
+                break;
+            }
+            case brgemm_matmul_b_copy:
+                ptr_B = wei_base
+                        + wei_dt_sz * (wei_b * bgmmc.nb_N + nb) * panel_size;
+                break;
+            default: assert(!"unknown B layout");
+        }
+        // in the plain layout row k is at k * LDB, in the blocked one rows
+        // are packed by vnni granularity with N_blk == LDB columns each
+        const auto get_B_row = [&](dim_t k) {
+            return ptr_B + wei_dt_sz * k * bgmmc.LDB;
+        };
+
+        const char *bias_w = bgmmc.with_bias
+                ? bias + bia_dt_sz * (bia_off + n)
+                : nullptr;
+        const float *scales = &oscales[bgmmc.is_oc_scale * n];
+        int32_t *comp = bgmmc.s8s8_compensation_required
+                ? compensation + (wei_b * bgmmc.nb_N + nb) * bgmmc.N_blk
+                : nullptr;
+        void *scratch = is_amx ? (void *)wsp_tile : (void *)comp;
+
+        // computes the rows starting at m + m_off with the kernels of the
+        // given M kind
+        const auto compute_rows = [&](int M_idx, dim_t m_off) {
+            const char *ptr_A
+                    = src + src_dt_sz * (src_off + (m + m_off) * bgmmc.LDA);
+            char *ptr_D = dst
+                    + dst_dt_sz * (dst_off + (m + m_off) * bgmmc.LDD + n);
+            char *ptr_C = (bgmmc.use_buffer_c) ? c_buffer : ptr_D;
+
+            // the full K blocks are processed in chunks of at most
+            // brgemm_batch_size blocks, which is a single chunk unless K is
+            // defined at runtime only
+            for (dim_t kb0 = 0; kb0 < bgmmc.nb_K;
+                    kb0 += bgmmc.brgemm_batch_size) {
+                const int gemm_batch = (int)nstl::min(
+                        bgmmc.nb_K - kb0, (dim_t)bgmmc.brgemm_batch_size);
+                const bool is_last_chunk = kb0 + gemm_batch == bgmmc.nb_K;
+                int brg_ker_idx = get_brg_kernel_index(
+                        bgmmc, kb0 == 0, M_idx, is_N_tail, false);
+                auto brg_kernel = kernels.ker[brg_ker_idx];
+                if (is_amx)
+                    amx_tile_configure(&brg_kernel_palettes_[brg_ker_idx][0]);
+                for (int kb = 0; kb < gemm_batch; kb++) {
+                    const dim_t k = (kb0 + kb) * bgmmc.K_blk;
+                    addr_A[kb] = ptr_A + src_dt_sz * k;
+                    addr_B[kb] = get_B_row(k);
+                }
+
+                if (are_post_ops_applicable && is_last_chunk
+                        && bgmmc.K_tail == 0) {
+                    brgemm_kernel_execute_postops(brg_kernel, gemm_batch,
+                            addr_A, addr_B, (void *)ptr_C, (void *)ptr_D,
+                            bias_w, scales, scratch);
+                } else {
+                    brgemm_kernel_execute(brg_kernel, gemm_batch, addr_A,
+                            addr_B, (void *)ptr_C,
+                            is_amx ? (void *)wsp_tile : nullptr);
+                }
+            }
+
+            if (bgmmc.K_tail > 0) {
+                const dim_t k = bgmmc.nb_K * bgmmc.K_blk;
+                addr_A[0] = ptr_A + src_dt_sz * k;
+                addr_B[0] = get_B_row(k);
+
+                int brg_ker_idx = get_brg_kernel_index(
+                        bgmmc, bgmmc.nb_K == 0, M_idx, is_N_tail, true);
+                auto brg_kernel_k_tail = kernels.ker[brg_ker_idx];
+                if (is_amx)
+                    amx_tile_configure(&brg_kernel_palettes_[brg_ker_idx][0]);
+                if (are_post_ops_applicable) {
+                    brgemm_kernel_execute_postops(brg_kernel_k_tail, 1, addr_A,
+                            addr_B, (void *)ptr_C, (void *)ptr_D, bias_w,
+                            scales, scratch);
+                } else {
+                    brgemm_kernel_execute(brg_kernel_k_tail, 1, addr_A, addr_B,
+                            (void *)ptr_C, is_amx ? (void *)wsp_tile : nullptr);
+                }
+            }
+        };
+
+        if (M_work == bgmmc.M_blk) {
+            compute_rows(0, 0);
+        } else if (!bgmmc.is_runtime_M) {
+            compute_rows(1, 0);
+        } else {
+            // M_blk is a power of 2, cover the tail by the kernels of size
+            // M_blk / 2, M_blk / 4, ..., 1 that fit into it
+            dim_t m_off = 0;
+            for (int M_idx = 1; M_idx < bgmmc.num_M_kernels; M_idx++) {
+                const dim_t vM = get_brg_kernel_M(bgmmc, M_idx);
+                if (!(M_work & vM)) continue;
+                compute_rows(M_idx, m_off);
+                m_off += vM;
+            }
+        }
+    };
+
+    const dim_t work_amount = bgmmc.batch * bgmmc.nb_M * bgmmc.nb_N;
+
+    parallel(0, [&](const int ithr, const int nthr) {
+        if (ithr >= work_amount) return;
+
+        dim_t start {0}, end {0};
+        balance211(work_amount, nthr, ithr, start, end);
+
+        dim_t b {0}, mb {0}, nb {0};
+        if (bgmmc.batch_inner)
+            nd_iterator_init(
+                    start, mb, bgmmc.nb_M, b, bgmmc.batch, nb, bgmmc.nb_N);
+        else
+            nd_iterator_init(
+                    start, b, bgmmc.batch, mb, bgmmc.nb_M, nb, bgmmc.nb_N);
+        while (start < end) {
+            ker(ithr, b, mb, nb);
+            ++start;
+            if (bgmmc.batch_inner)
+                nd_iterator_step(
+                        mb, bgmmc.nb_M, b, bgmmc.batch, nb, bgmmc.nb_N);
+            else
+                nd_iterator_step(
+                        b, bgmmc.batch, mb, bgmmc.nb_M, nb, bgmmc.nb_N);
+        }
+    });
+
+    return status::success;
+}
+
+template struct brgemm_matmul_t<avx512_core_bf16_amx_int8>;
+template struct brgemm_matmul_t<avx512_core_bf16_amx_bf16>;
+template struct brgemm_matmul_t<avx512_core_vnni>;
+template struct brgemm_matmul_t<avx512_core_bf16>;
+template struct brgemm_matmul_t<avx512_core>;
+
+} // namespace matmul
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
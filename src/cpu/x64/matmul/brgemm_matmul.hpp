@@ -0,0 +1,164 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_MATMUL_BRGEMM_MATMUL_HPP
+#define CPU_X64_MATMUL_BRGEMM_MATMUL_HPP
+
+#include <assert.h>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/matmul/cpu_matmul_pd.hpp"
+
+#include "cpu/x64/brgemm/brgemm.hpp"
+#include "cpu/x64/cpu_isa_traits.hpp"
+#include "cpu/x64/matmul/brgemm_matmul_utils.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+namespace matmul {
+
+namespace {
+static const int max_num_M_kernels_matmul = 6;
+static const int max_num_brg_kernels_matmul
+        = 2 * max_num_M_kernels_matmul * 2 * 2;
+
+// Number of rows processed by the kernels of the given M kind
+inline dim_t get_brg_kernel_M(const brgemm_matmul_conf_t &bgmmc, int M_idx) {
+    if (M_idx == 0) return bgmmc.M_blk;
+    return bgmmc.is_runtime_M ? bgmmc.M_blk >> M_idx : bgmmc.M_tail;
+}
+
+inline int get_brg_kernel_index(const brgemm_matmul_conf_t &bgmmc,
+        bool do_initialization, int M_idx, bool is_N_tail, bool is_K_tail) {
+    auto vM = get_brg_kernel_M(bgmmc, M_idx);
+    auto vN = (is_N_tail) ? bgmmc.N_tail : bgmmc.N_blk;
+    auto vK = (is_K_tail) ? bgmmc.K_tail : bgmmc.K_blk;
+    if (vM == 0 || vN == 0 || vK == 0 || bgmmc.LDA < vK || bgmmc.LDB < vN
+            || bgmmc.LDC < vN)
+        return -1;
+
+    int idx = 4 * (max_num_M_kernels_matmul * (int)do_initialization + M_idx)
+            + 2 * (int)is_N_tail + (int)is_K_tail;
+
+    assert(idx < max_num_brg_kernels_matmul);
+    return idx;
+}
+
+} // namespace
+
+template <cpu_isa_t isa>
+struct brgemm_matmul_t : public primitive_t {
+    struct pd_t : public ::dnnl::impl::cpu::matmul::cpu_matmul_pd_t {
+        using ::dnnl::impl::cpu::matmul::cpu_matmul_pd_t::cpu_matmul_pd_t;
+
+        DECLARE_COMMON_PD_T(
+                JIT_IMPL_NAME_HELPER("brg:", isa, ""), brgemm_matmul_t);
+
+        status_t init(engine_t *engine);
+
+        int get_brg_kernel_idx(bool do_initialization, int M_idx,
+                bool is_N_tail, bool is_K_tail) const {
+            return get_brg_kernel_index(
+                    bgmmc_, do_initialization, M_idx, is_N_tail, is_K_tail);
+        }
+
+        const brgemm_t &get_brg_desc(int idx) const { return brg_descs_[idx]; }
+        const brgemm_matmul_conf_t &get_brgemm_matmul_conf() const {
+            return bgmmc_;
+        }
+
+    private:
+        brgemm_t brg_descs_[max_num_brg_kernels_matmul];
+        brgemm_matmul_conf_t bgmmc_;
+    };
+
+    brgemm_matmul_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+
+    status_t execute(const exec_ctx_t &ctx) const override {
+        return execute_body(ctx);
+    }
+
+private:
+    // Kernels used by a single execution. For runtime shapes the holders
+    // keep the cached kernels alive in case the cache is flushed meanwhile.
+    struct kernel_set_t {
+        const brgemm_kernel_t *ker[max_num_brg_kernels_matmul];
+        std::shared_ptr<brgemm_kernel_t> holder[max_num_brg_kernels_matmul];
+    };
+
+    // Runtime shape kernels are identified by the brgemm problem they solve,
+    // the rest of the descriptor is defined by the primitive descriptor.
+    struct rt_kernel_key_t {
+        int M, N, K, LDA, LDB, LDC, LDD;
+        bool do_initialization;
+
+        bool operator==(const rt_kernel_key_t &rhs) const {
+            return M == rhs.M && N == rhs.N && K == rhs.K && LDA == rhs.LDA
+                    && LDB == rhs.LDB && LDC == rhs.LDC && LDD == rhs.LDD
+                    && do_initialization == rhs.do_initialization;
+        }
+    };
+
+    struct rt_kernel_key_hash_t {
+        size_t operator()(const rt_kernel_key_t &k) const {
+            size_t seed = 0;
+            for (int v : {k.M, k.N, k.K, k.LDA, k.LDB, k.LDC, k.LDD})
+                seed = hash_combine(seed, v);
+            return hash_combine(seed, k.do_initialization);
+        }
+    };
+
+    static const size_t rt_kernels_capacity = 256;
+
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+    status_t execute_body(const exec_ctx_t &ctx) const;
+
+    // Fills the kernels required by the (runtime) configuration, jitting the
+    // missing ones when the shapes are not known at creation time.
+    status_t get_kernels(
+            const brgemm_matmul_conf_t &bgmmc, kernel_set_t &kernels) const;
+
+    // Copies (or, for blocked weights, only reads) matrix B into the blocked
+    // vnni layout expected by the kernels and computes the s8s8 compensation.
+    void prepare_B(const exec_ctx_t &ctx, const char *&wei_base,
+            int32_t *&compensation) const;
+
+    std::unique_ptr<brgemm_kernel_t> brg_kernels_[max_num_brg_kernels_matmul];
+    char brg_kernel_palettes_[max_num_brg_kernels_matmul][64];
+
+    mutable std::mutex rt_kernels_mutex_;
+    mutable std::unordered_map<rt_kernel_key_t,
+            std::shared_ptr<brgemm_kernel_t>, rt_kernel_key_hash_t>
+            rt_kernels_;
+};
+
+} // namespace matmul
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
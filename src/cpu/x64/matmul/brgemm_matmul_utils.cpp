@@ -0,0 +1,356 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/math_utils.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/nstl.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/x64/matmul/brgemm_matmul_utils.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+namespace matmul {
+
+using namespace dnnl::impl::status;
+using namespace dnnl::impl::format_tag;
+using namespace dnnl::impl::memory_tracking::names;
+using namespace dnnl::impl::utils;
+
+using namespace data_type;
+
+namespace brgemm_matmul_utils {
+
+namespace {
+
+// N dimension block of the blocked B layout and of the brgemm kernel
+const int wei_n_blk = 64;
+
+bool is_amx(cpu_isa_t isa) {
+    return one_of(isa, avx512_core_bf16_amx_int8, avx512_core_bf16_amx_bf16);
+}
+
+// The blocked layout depends on the computations rather than on the weights
+// data type: s8 weights converted to f32 or bf16 follow the f32 or the bf16
+// layouts.
+format_tag_t get_blocked_weights_tag(int ndims, int vnni_granularity) {
+    const bool is_3d = ndims == 3;
+    switch (vnni_granularity) {
+        case 1: return is_3d ? aCB16b64c : BA16a64b;
+        case 2: return is_3d ? aCB8b64c2b : BA8a64b2a;
+        case 4: return is_3d ? aCB4b64c4b : BA4a64b4a;
+        default: return format_tag::undef;
+    }
+}
+
+// Plain layout with the innermost dimension dense. Used for src and dst.
+bool is_plain_row_major(const memory_desc_wrapper &mdw) {
+    const int ndims = mdw.ndims();
+    return mdw.is_plain() && mdw.blocking_desc().strides[ndims - 1] == 1;
+}
+
+status_t init_plain_md(memory_desc_t &md) {
+    memory_desc_wrapper mdw(md);
+    if (mdw.format_any()) return memory_desc_init_by_strides(md, nullptr);
+    return is_plain_row_major(mdw) ? success : unimplemented;
+}
+
+// TODO: add support of post-ops with multiple binary and eltwise execution
+bool post_ops_ok(brgemm_matmul_conf_t &bgmmc, const primitive_attr_t &attr) {
+    using namespace primitive_kind;
+    const auto &p = attr.post_ops_;
+
+    auto is_eltwise = [&](int idx) { return p.entry_[idx].is_eltwise(); };
+
+    switch (p.len()) {
+        case 0: return true;
+        case 1: return is_eltwise(0) || p.contain(sum, 0);
+        case 2:
+            return (p.contain(sum, 0) && is_eltwise(1))
+                    || (one_of(bgmmc.src_dt, u8, s8) && p.contain(sum, 1)
+                            && is_eltwise(0));
+        default: return false;
+    }
+
+    return false;
+}
+
+} // namespace
+
+status_t init_blocking(brgemm_matmul_conf_t &bgmmc, dim_t M, dim_t N,
+        dim_t K, dim_t LDA, dim_t LDB, dim_t LDD) {
+    // Block sizes only depend on the values known at creation time, so that
+    // the kernels and the scratchpad stay valid for any runtime value.
+    const bool is_M_known = !is_runtime_value(M);
+    const bool is_N_known = !is_runtime_value(N);
+    const bool is_K_known = !is_runtime_value(K);
+    const bool are_lds_known = !is_runtime_value(LDA)
+            && !is_runtime_value(LDB) && !is_runtime_value(LDD);
+    bgmmc.M = M;
+    bgmmc.N = N;
+    bgmmc.K = K;
+
+    bgmmc.N_blk = bgmmc.b_kind == brgemm_matmul_b_plain && !bgmmc.is_runtime_N
+            ? nstl::min(N, (dim_t)wei_n_blk)
+            : wei_n_blk;
+    if (is_N_known) {
+        bgmmc.nb_N = div_up(N, bgmmc.N_blk);
+        bgmmc.N_tail = N % bgmmc.N_blk;
+    }
+
+    const dim_t max_M = 64, min_M = is_amx(bgmmc.isa) ? 16 : 6;
+    if (bgmmc.is_runtime_M) {
+        // a power of 2 so that any tail is a sum of the smaller kernels
+        bgmmc.M_blk = 32;
+        bgmmc.num_M_kernels = 1 + math::ilog2q(bgmmc.M_blk);
+        assert(bgmmc.num_M_kernels <= 6);
+    } else {
+        bgmmc.M_blk = 1;
+        for (dim_t m_ = max_M; m_ >= min_M; m_--) {
+            if (M % m_ == 0) {
+                bgmmc.M_blk = m_;
+                break;
+            }
+        }
+        if (bgmmc.M_blk == 1) bgmmc.M_blk = nstl::min(M, max_M);
+        bgmmc.num_M_kernels = 2;
+    }
+    if (is_M_known) {
+        bgmmc.nb_M = div_up(M, bgmmc.M_blk);
+        bgmmc.M_tail = M % bgmmc.M_blk;
+    }
+
+    // AMX kernels require the reduction block to match the tile depth, while
+    // avx512 kernels only need K blocks aligned to the vnni granularity.
+    // With a runtime K the reduction is split into chunks of at most
+    // brgemm_batch_size blocks to keep the scratchpad size fixed.
+    if (is_amx(bgmmc.isa)) {
+        bgmmc.K_blk = bgmmc.src_dt == bf16 ? 32 : 64;
+    } else if (bgmmc.is_runtime_K) {
+        bgmmc.K_blk = 64;
+    } else {
+        bgmmc.K_blk = K >= 64 ? 64 : rnd_up(K, bgmmc.b_vnni_granularity);
+    }
+    if (is_K_known) {
+        bgmmc.nb_K = K / bgmmc.K_blk;
+        bgmmc.K_tail = K % bgmmc.K_blk;
+        bgmmc.K_padded = rnd_up(K, 16);
+    }
+    bgmmc.brgemm_batch_size = bgmmc.is_runtime_K
+            ? 16
+            : (int)nstl::max(bgmmc.nb_K, (dim_t)1);
+
+    bgmmc.LDA = LDA;
+    bgmmc.LDB = bgmmc.b_kind == brgemm_matmul_b_plain ? LDB : bgmmc.N_blk;
+    bgmmc.LDD = LDD;
+    bgmmc.LDC = bgmmc.use_buffer_c ? bgmmc.N_blk : bgmmc.LDD;
+    if (!(is_M_known && is_N_known && is_K_known && are_lds_known))
+        return success;
+
+    // brgemm kernels keep leading dimensions in 32-bit registers
+    const dim_t max_ld = nstl::numeric_limits<int>::max();
+    if (M > 1 && bgmmc.LDA < K) return unimplemented;
+    if (nstl::max(bgmmc.LDA, bgmmc.LDB) > max_ld
+            || nstl::max(bgmmc.LDC, bgmmc.LDD) > max_ld)
+        return unimplemented;
+    // strides along M are not meaningful for a single row
+    if (M == 1) {
+        bgmmc.LDA = nstl::max(bgmmc.LDA, K);
+        bgmmc.LDD = nstl::max(bgmmc.LDD, N);
+        if (!bgmmc.use_buffer_c) bgmmc.LDC = bgmmc.LDD;
+    }
+    if (bgmmc.b_kind == brgemm_matmul_b_plain && K == 1)
+        bgmmc.LDB = nstl::max(bgmmc.LDB, N);
+    if (bgmmc.LDB < bgmmc.N_blk) return unimplemented;
+
+    return success;
+}
+
+status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
+        const matmul_desc_t &mmd, memory_desc_t &src_md,
+        memory_desc_t &weights_md, memory_desc_t &dst_md,
+        memory_desc_t &bias_md, const primitive_attr_t &attr) {
+    bgmmc = zero<decltype(bgmmc)>();
+
+    const memory_desc_wrapper src_d(&src_md);
+    const memory_desc_wrapper weights_d(&weights_md);
+    const memory_desc_wrapper dst_d(&dst_md);
+
+    bgmmc.isa = isa;
+    bgmmc.ndims = dst_d.ndims();
+    bgmmc.batch_ndims = bgmmc.ndims - 2;
+    bgmmc.M = dst_d.dims()[bgmmc.ndims - 2];
+    bgmmc.N = dst_d.dims()[bgmmc.ndims - 1];
+    bgmmc.K = src_d.dims()[bgmmc.ndims - 1];
+
+    // Runtime dimensions and strides are supported for 2D problems only,
+    // otherwise the batch strides would depend on the runtime values too.
+    // If only M is unknown, the weights can still be packed once (e.g. via
+    // format 'any') and reused for any number of rows. Runtime N and K
+    // require plain f32 weights, used without a copy. Unless only M is
+    // unknown, the kernels are created at execution time and cached by the
+    // primitive, see brgemm_matmul_t::get_kernels().
+    bgmmc.is_runtime_M = is_runtime_value(bgmmc.M);
+    bgmmc.is_runtime_N = is_runtime_value(bgmmc.N);
+    bgmmc.is_runtime_K = is_runtime_value(bgmmc.K);
+    const bool has_runtime_strides = src_d.has_runtime_strides()
+            || weights_d.has_runtime_strides() || dst_d.has_runtime_strides();
+    bgmmc.use_kernel_cache
+            = bgmmc.is_runtime_N || bgmmc.is_runtime_K || has_runtime_strides;
+    if (bgmmc.is_runtime_M || bgmmc.use_kernel_cache) {
+        const bool ok = bgmmc.ndims == 2 && !is_amx(isa)
+                && !src_d.format_any() && !dst_d.format_any()
+                && IMPLICATION(bgmmc.use_kernel_cache,
+                        everyone_is(f32, src_d.data_type(),
+                                weights_d.data_type(), dst_d.data_type())
+                                && !weights_d.format_any());
+        if (!ok) return unimplemented;
+    }
+
+    bgmmc.batch = array_product(dst_d.dims(), bgmmc.batch_ndims);
+    bgmmc.wei_batch = array_product(weights_d.dims(), bgmmc.batch_ndims);
+    bgmmc.batch_inner = bgmmc.batch > 1
+            && array_product(src_d.dims(), bgmmc.batch_ndims) == 1;
+
+    bgmmc.src_dt = src_d.data_type();
+    bgmmc.wei_dt = weights_d.data_type();
+    bgmmc.dst_dt = dst_d.data_type();
+    bgmmc.with_bias = mmd.bias_desc.ndims != 0;
+    bgmmc.bia_dt = bgmmc.with_bias ? mmd.bias_desc.data_type : data_type::undef;
+
+    const bool is_int8 = one_of(bgmmc.src_dt, u8, s8) && bgmmc.wei_dt == s8
+            && one_of(bgmmc.dst_dt, u8, s8, s32, f32)
+            && one_of(isa, avx512_core_vnni, avx512_core_bf16_amx_int8);
+    const bool is_bf16 = everyone_is(bf16, bgmmc.src_dt, bgmmc.wei_dt)
+            && one_of(bgmmc.dst_dt, bf16, f32)
+            && one_of(isa, avx512_core_bf16, avx512_core_bf16_amx_bf16);
+    const bool is_f32 = everyone_is(f32, bgmmc.src_dt, bgmmc.wei_dt,
+                                bgmmc.dst_dt)
+            && isa == avx512_core;
+    // Weights-only compression: the kernels convert s8 weights to the src
+    // data type on load, the weights scales are passed as output scales.
+    const bool is_wei_decomp = bgmmc.wei_dt == s8
+            && ((everyone_is(f32, bgmmc.src_dt, bgmmc.dst_dt)
+                        && isa == avx512_core)
+                    || (bgmmc.src_dt == bf16 && one_of(bgmmc.dst_dt, bf16, f32)
+                            && isa == avx512_core_bf16));
+    if (!(is_int8 || is_bf16 || is_f32 || is_wei_decomp)) return unimplemented;
+
+    bgmmc.acc_dt = is_int8 ? s32 : f32;
+    bgmmc.with_scales = is_int8 || is_wei_decomp;
+    bgmmc.s8s8_compensation_required = bgmmc.src_dt == s8 && !is_amx(isa);
+    bgmmc.b_vnni_granularity = is_int8 ? 4 : (bgmmc.src_dt == bf16 ? 2 : 1);
+
+    const auto &p = attr.post_ops_;
+    bgmmc.with_sum = p.find(primitive_kind::sum) != -1;
+    bgmmc.with_eltwise = p.find(primitive_kind::eltwise) != -1;
+    if (!post_ops_ok(bgmmc, attr)) return unimplemented;
+
+    if (bgmmc.with_scales) {
+        const auto &oscales = attr.output_scales_;
+        // only common and per-N scales are supported
+        const int oc_scale_mask = 1 << (bgmmc.ndims - 1);
+        if (!one_of(oscales.mask_, 0, oc_scale_mask) || !oscales.defined())
+            return unimplemented;
+        bgmmc.is_oc_scale = oscales.mask_ == oc_scale_mask;
+    }
+
+    CHECK(init_plain_md(src_md));
+    CHECK(init_plain_md(dst_md));
+    if (bgmmc.use_kernel_cache && !is_plain_row_major(weights_d))
+        return unimplemented;
+    if (bgmmc.with_bias && bias_md.format_kind == format_kind::any)
+        CHECK(memory_desc_init_by_strides(bias_md, nullptr));
+
+    const format_tag_t blocked_tag = (bgmmc.ndims <= 3)
+            ? get_blocked_weights_tag(bgmmc.ndims, bgmmc.b_vnni_granularity)
+            : format_tag::undef;
+    if (weights_d.format_any()) {
+        if (blocked_tag != format_tag::undef) {
+            CHECK(memory_desc_init_by_tag(weights_md, blocked_tag));
+        } else {
+            CHECK(memory_desc_init_by_strides(weights_md, nullptr));
+        }
+    }
+
+    const memory_desc_wrapper wei_d(&weights_md);
+    if (blocked_tag != format_tag::undef && wei_d.matches_tag(blocked_tag)) {
+        bgmmc.b_kind = brgemm_matmul_b_blocked;
+        bgmmc.wei_tag = blocked_tag;
+    } else if (bgmmc.b_vnni_granularity == 1 && is_plain_row_major(wei_d)) {
+        bgmmc.b_kind = brgemm_matmul_b_plain;
+    } else if (wei_d.is_plain()) {
+        bgmmc.b_kind = brgemm_matmul_b_copy;
+    } else {
+        return unimplemented;
+    }
+
+    bgmmc.use_buffer_c
+            = IMPLICATION(bgmmc.dst_dt == bgmmc.acc_dt, bgmmc.with_sum);
+
+    CHECK(init_blocking(bgmmc, bgmmc.M, bgmmc.N, bgmmc.K,
+            src_d.blocking_desc().strides[bgmmc.ndims - 2],
+            wei_d.blocking_desc().strides[bgmmc.ndims - 2],
+            dst_d.blocking_desc().strides[bgmmc.ndims - 2]));
+
+    bgmmc.brg_type = brgemm_addr;
+    bgmmc.nthr = dnnl_get_max_threads();
+
+    return success;
+}
+
+void init_scratchpad(memory_tracking::registrar_t &scratchpad,
+        const brgemm_matmul_conf_t &bgmmc) {
+    const size_t sc_size = sizeof(void *);
+    const size_t n_elems = (size_t)bgmmc.nthr * bgmmc.brgemm_batch_size;
+    if (bgmmc.brg_type == brgemm_addr) {
+        scratchpad.book(key_brgemm_primitive_addr_a, n_elems, sc_size, 64);
+        scratchpad.book(key_brgemm_primitive_addr_b, n_elems, sc_size, 64);
+    }
+
+    if (bgmmc.use_buffer_c)
+        scratchpad.book(key_brgemm_primitive_buffer,
+                (size_t)bgmmc.nthr * bgmmc.M_blk * bgmmc.LDC,
+                types::data_type_size(bgmmc.acc_dt));
+
+    if (bgmmc.b_kind == brgemm_matmul_b_copy)
+        scratchpad.book(key_brgemm_primitive_buffer_b,
+                (size_t)bgmmc.wei_batch * bgmmc.nb_N * bgmmc.K_padded
+                        * bgmmc.N_blk,
+                types::data_type_size(bgmmc.wei_dt));
+
+    if (bgmmc.s8s8_compensation_required)
+        scratchpad.book(key_brgemm_primitive_buffer_comp,
+                (size_t)bgmmc.wei_batch * bgmmc.nb_N * bgmmc.N_blk,
+                sizeof(int32_t));
+
+    if (is_amx(bgmmc.isa))
+        scratchpad.book(
+                key_conv_amx_tile_buffer, bgmmc.nthr * 1024, sizeof(char));
+}
+
+} // namespace brgemm_matmul_utils
+
+} // namespace matmul
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
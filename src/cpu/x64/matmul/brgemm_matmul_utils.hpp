@@ -0,0 +1,118 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_MATMUL_BRGEMM_MATMUL_UTILS_HPP
+#define CPU_X64_MATMUL_BRGEMM_MATMUL_UTILS_HPP
+
+#include "common/c_types_map.hpp"
+#include "common/memory_tracking.hpp"
+
+#include "cpu/matmul/cpu_matmul_pd.hpp"
+
+#include "cpu/x64/brgemm/brgemm_types.hpp"
+#include "cpu/x64/cpu_isa_traits.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+namespace matmul {
+
+// Layout of matrix B (weights) as seen by the brgemm kernels
+typedef enum {
+    // plain row-major B with the N dimension dense, used directly (f32
+    // computations only)
+    brgemm_matmul_b_plain = 1,
+    // user provided weights in one of the BA16a64b-like blocked formats
+    brgemm_matmul_b_blocked = 2,
+    // any other plain layout, copied to the blocked layout at execution
+    brgemm_matmul_b_copy = 3,
+} brgemm_matmul_b_kind_t;
+
+struct brgemm_matmul_conf_t {
+    int ndims, batch_ndims;
+    // M is DNNL_RUNTIME_DIM_VAL if is_runtime_M, the actual value is taken
+    // from the memory descriptors at execution
+    dim_t M, N, K, batch;
+    bool is_runtime_M, is_runtime_N, is_runtime_K;
+    // the kernels depend on values known at execution time only: runtime N,
+    // K or leading dimensions
+    bool use_kernel_cache;
+    // number of distinct B matrices, less than batch if weights are broadcast
+    dim_t wei_batch;
+    // src is broadcast over the batch, e.g. the common input of the Q, K and
+    // V projections batched over their weights: the batch is iterated inside
+    // the M blocks, so that a block of src is read once for all the outputs
+    bool batch_inner;
+
+    dim_t M_blk, N_blk, K_blk;
+    dim_t M_tail, N_tail, K_tail;
+    // number of kernel row counts: M_blk and M_tail for a known M, M_blk and
+    // M_blk / 2, M_blk / 4, ..., 1 for a runtime one (a tail is then covered
+    // by the binary decomposition of its size)
+    int num_M_kernels;
+    dim_t nb_M, nb_N, nb_K;
+    // K padded to the granularity of the blocked B layout
+    dim_t K_padded;
+    // max number of matrices passed to a single brgemm kernel call
+    int brgemm_batch_size;
+
+    dim_t LDA, LDB, LDC, LDD;
+
+    data_type_t src_dt, wei_dt, dst_dt, bia_dt, acc_dt;
+
+    bool with_bias, with_sum, with_eltwise, with_scales;
+    bool s8s8_compensation_required;
+    int is_oc_scale;
+
+    brgemm_matmul_b_kind_t b_kind;
+    // number of consecutive K elements packed together in the B layout
+    int b_vnni_granularity;
+    format_tag_t wei_tag;
+
+    bool use_buffer_c;
+
+    brgemm_batch_kind_t brg_type;
+    cpu_isa_t isa;
+    int nthr;
+};
+
+namespace brgemm_matmul_utils {
+
+status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
+        const matmul_desc_t &mmd, memory_desc_t &src_md,
+        memory_desc_t &weights_md, memory_desc_t &dst_md,
+        memory_desc_t &bias_md, const primitive_attr_t &attr);
+
+// Sets the problem sizes, leading dimensions and the blocking derived from
+// them. Runtime values only set the parts known at creation time, the
+// configuration is completed at execution by another call with the actual
+// values.
+status_t init_blocking(brgemm_matmul_conf_t &bgmmc, dim_t M, dim_t N,
+        dim_t K, dim_t LDA, dim_t LDB, dim_t LDD);
+
+void init_scratchpad(memory_tracking::registrar_t &scratchpad,
+        const brgemm_matmul_conf_t &bgmmc);
+
+} // namespace brgemm_matmul_utils
+
+} // namespace matmul
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
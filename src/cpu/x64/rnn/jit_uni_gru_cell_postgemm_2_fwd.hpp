@@ -85,6 +85,7 @@ protected:
         using namespace Xbyak;
         auto is_training
                 = pd_->desc()->prop_kind == prop_kind::forward_training;
+        const bool is_augru = pd_->cell_kind() == alg_kind::vanilla_augru;
 
         int mask = pd_->attr()->rnn_weights_qparams_.mask_;
         float *weights_scales = pd_->attr()->rnn_weights_qparams_.scales_;
@@ -97,6 +98,7 @@ protected:
         // Register map
         Reg64 loop_cnt(r10); // loop counter
         Reg64 table_reg(rbx); // table is used for data scale and shifts
+        Reg64 addr_attention_reg(r15); // AUGRU attention of the row
 
         // constant table map
         Address one_addr = ptr[table_reg];
@@ -118,9 +120,14 @@ protected:
         auto base_args = get_stack_params_address();
         mov(addr_states_t_l_copy_reg, ptr[base_args]);
         mov(addr_states_tm1_l_reg, ptr[base_args + 8]);
+        if (is_augru) mov(addr_attention_reg, ptr[base_args + 16]);
 #else
         auto addr_states_t_l_copy_reg = abi_param5;
         auto addr_states_tm1_l_reg = abi_param6;
+        if (is_augru) {
+            auto base_args = get_stack_params_address();
+            mov(addr_attention_reg, ptr[base_args]);
+        }
 #endif
 
         // helper lambda to address the gates and biases
@@ -183,6 +190,13 @@ protected:
 
                     // states_t_l = states_tm1_l * G0 + (1 - G0) * G2
                     uni_vmovups(G0(loop_ur_idx), sg_addr(0, loop_ur_idx));
+                    // AUGRU: G0 = (1 - attention) * G0
+                    if (is_augru) {
+                        uni_vbroadcastss(tmp1_vmm, ptr[addr_attention_reg]);
+                        uni_vmovups(tmp2_vmm, one_addr);
+                        uni_vsubps(tmp2_vmm, tmp2_vmm, tmp1_vmm);
+                        uni_vmulps(G0(loop_ur_idx), G0(loop_ur_idx), tmp2_vmm);
+                    }
                     uni_vmovups(tmp1_vmm, one_addr);
                     uni_vsubps(tmp1_vmm, tmp1_vmm, G0(loop_ur_idx));
                     to_float<src_data_t>(tmp2_vmm,
@@ -243,6 +257,12 @@ protected:
 
                 // states_t_l = states_tm1_l * G0 + (1 - G0) * G2
                 uni_vmovss(G0s, sg_addr(0, 0));
+                if (is_augru) {
+                    uni_vmovss(tmp1s_vmm, ptr[addr_attention_reg]);
+                    uni_vmovss(tmp2s_vmm, one_addr);
+                    uni_vsubss(tmp2s_vmm, tmp2s_vmm, tmp1s_vmm);
+                    uni_vmulss(G0s, G0s, tmp2s_vmm);
+                }
                 uni_vmovss(tmp1s_vmm, one_addr);
                 uni_vsubss(tmp1s_vmm, tmp1s_vmm, G0s);
                 to_float<src_data_t>(
@@ -73,8 +73,8 @@ protected:
     void generate() override {
         using namespace Xbyak;
 
-        auto is_training
-                = (pd_->desc()->prop_kind == prop_kind::forward_training);
+        // also set for the recomputation of the gates in backward
+        auto is_training = rnn_.is_training;
 
         int mask = pd_->attr()->rnn_weights_qparams_.mask_;
         float *weights_scales = pd_->attr()->rnn_weights_qparams_.scales_;
@@ -17,6 +17,8 @@
 #ifndef CPU_X64_RNN_JIT_UNI_LSTM_CELL_PROJECTION_POSTGEMM_FWD_HPP
 #define CPU_X64_RNN_JIT_UNI_LSTM_CELL_PROJECTION_POSTGEMM_FWD_HPP
 
+#include "common/math_utils.hpp"
+
 #include "cpu/x64/rnn/jit_uni_rnn_common_postgemm.hpp"
 
 namespace dnnl {
@@ -91,7 +93,19 @@ protected:
         // initialize registers with addresses and constants
         init_regs(weights_scales, vlen);
 
-        mov(loop_cnt, rnn_.dic * scratch_dt_size);
+        // The fused brgemm post-gemm processes a block of the output, of
+        // block_step bytes of the destination (param #10)
+        if (rnn_.is_brgemm && !rnn_.unfused_post_gemm) {
+            auto base_args = get_stack_params_address();
+#ifdef _WIN32
+            mov(loop_cnt, ptr[base_args + 40]);
+#else
+            mov(loop_cnt, ptr[base_args + 24]);
+#endif
+            const int scratch_to_dst = scratch_dt_size / hstate_dt_size;
+            if (scratch_to_dst > 1) shl(loop_cnt, math::ilog2q(scratch_to_dst));
+        } else
+            mov(loop_cnt, rnn_.dic * scratch_dt_size);
         cmp(loop_cnt, vlen);
         jl(vector_loop_end_label, Xbyak::CodeGenerator::T_NEAR);
 
@@ -112,6 +126,7 @@ protected:
             L(vector_loop_inc_regs);
             add(addr_scratch_reg, vlen);
             add(addr_states_t_l_reg, vlen_dst);
+            add(addr_wcomp_reg, vlen);
             inc_regs(mask, vlen);
 
             // increment loop counter
@@ -143,6 +158,7 @@ protected:
             L(rem_loop_inc_regs);
             add(addr_scratch_reg, scratch_dt_size);
             add(addr_states_t_l_reg, hstate_dt_size);
+            add(addr_wcomp_reg, qscale_dt_size);
             inc_regs(mask, qscale_dt_size);
 
             // increment loop counter
@@ -81,8 +81,8 @@ protected:
         // We skip vmm0 as it can be used by the injector for masks on sse4.1
         Vmm G(1), tmp1_vmm(5), tmp2_vmm(6);
 
-        auto is_training
-                = pd_->desc()->prop_kind == prop_kind::forward_training;
+        // also set for the recomputation of the gates in backward
+        auto is_training = rnn_.is_training;
 
         // We start code generations here
         preamble();
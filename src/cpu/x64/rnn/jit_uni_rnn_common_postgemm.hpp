@@ -75,10 +75,13 @@ struct jit_uni_rnn_postgemm : public jit_generator {
         return status::success;
     }
 
-    template <typename dst_layer_t, typename dst_iter_t, typename src_iter_t,
-            typename gemm_acc_t, typename gates_t, typename scratch_t>
+    // The direction is the one of the caller rather than the one of the
+    // primitive, as backward recomputes the gates with the forward kernels.
+    template <prop_kind_t aprop, typename dst_layer_t, typename dst_iter_t,
+            typename src_iter_t, typename gemm_acc_t, typename gates_t,
+            typename scratch_t>
     rnn_postgemm_sig(execute) {
-        if (pd_->desc()->prop_kind == prop_kind::backward)
+        if (aprop == prop_kind::backward)
             execute_bwd(rnn, cell_position, ws_gates_, scratch_gates_,
                     dst_layer_, dst_iter_c_, src_iter_, src_iter_c_,
                     diff_src_layer_, diff_src_iter_, diff_src_iter_c_,
@@ -180,6 +183,12 @@ struct jit_uni_rnn_postgemm : public jit_generator {
                 param7_ = nullptr;
                 param8_ = nullptr;
                 break;
+            case alg_kind::vanilla_augru:
+                // the attention of the iteration is passed as the c state
+                param6_ = &src_iter(m, 0);
+                param7_ = const_cast<float *>(src_iter_c_ + m);
+                param8_ = nullptr;
+                break;
             default:
                 param6_ = nullptr;
                 param7_ = nullptr;
@@ -320,11 +329,8 @@ protected:
 #else
                     mov(weights_scales_reg, ptr[base_args + 16]);
 #endif
-                } else {
-                    float *weights_scales
-                            = pd_->attr()->rnn_weights_qparams_.scales_;
+                } else
                     mov(weights_scales_reg, size_t(weights_scales));
-                }
 
                 zero_addr = ptr[qtable];
                 u8_saturation_addr = ptr[qtable + vlen];
@@ -486,8 +492,16 @@ protected:
                 uni_vmovss(tmp1, scales_ptr);
         }
         uni_vcvtdq2ps(s, s);
-        // Here we subtract a compensation if need be
-        if (comp) { uni_vsubps(s, s, ptr[*comp]); }
+        // Here we subtract a compensation if need be: the sum of the weights
+        // times the data shift
+        if (comp) {
+            if (packed)
+                uni_vmovups(tmp2, ptr[*comp]);
+            else
+                uni_vmovss(tmp2, ptr[*comp]);
+            uni_vmulps(tmp2, tmp2, dshift_off_addr);
+            uni_vsubps(s, s, tmp2);
+        }
         uni_vmulps(tmp1, tmp1, dscale_off_addr);
 #ifdef DNNL_ENABLE_FAST_RCP
         fast_recip(tmp1, tmp2, packed);
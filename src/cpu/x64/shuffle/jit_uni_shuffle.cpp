@@ -33,6 +33,7 @@ namespace x64 {
 using namespace Xbyak;
 using namespace format_tag;
 
+static constexpr int s8_size_bytes = sizeof(int8_t);
 static constexpr int bf16_size_bytes = sizeof(bfloat16_t);
 static constexpr int f32_size_bytes = sizeof(float);
 static constexpr int gp_regs = 4; // number of used gp regs
@@ -47,6 +48,10 @@ struct jit_shuffle_args_t {
 template <int data_type_size>
 struct reg_type_base_t {};
 
+template <>
+struct reg_type_base_t<s8_size_bytes> {
+    using reg_type_t = Reg8;
+};
 template <>
 struct reg_type_base_t<bf16_size_bytes> {
     using reg_type_t = Reg16;
@@ -197,6 +202,13 @@ void jit_uni_shuffle_kernel_t<bf16_size_bytes>::uni_pinsr(
     vpinsrw(ins_reg, ins_reg, ptr[src_reg + load_reg * data_size], xmm_off);
 }
 
+template <>
+void jit_uni_shuffle_kernel_t<s8_size_bytes>::uni_pinsr(
+        int reg_num, Reg64 load_reg, int data_size, int xmm_off) {
+    const auto ins_reg = Xmm(reg_num);
+    uni_vpinsrb(ins_reg, ins_reg, ptr[src_reg + load_reg * data_size], xmm_off);
+}
+
 template <int data_type_size>
 void jit_uni_shuffle_kernel_t<data_type_size>::store(
         dim_t dst_off, int reg_num) {
@@ -213,8 +225,17 @@ void jit_uni_shuffle_kernel_t<bf16_size_bytes>::store(
     vmovsd(ptr[dst_reg + get_reg<Reg64>(0)], src_xmm);
 }
 
+template <>
+void jit_uni_shuffle_kernel_t<s8_size_bytes>::store(
+        dim_t dst_off, int reg_num) {
+    const auto src_xmm = Xmm(reg_num);
+    mov(get_reg<Reg64>(0), dst_off);
+    uni_vmovss(ptr[dst_reg + get_reg<Reg64>(0)], src_xmm);
+}
+
 template struct jit_uni_shuffle_kernel_t<f32_size_bytes>;
 template struct jit_uni_shuffle_kernel_t<bf16_size_bytes>;
+template struct jit_uni_shuffle_kernel_t<s8_size_bytes>;
 
 #undef GET_OFF
 
@@ -307,6 +328,7 @@ status_t jit_uni_shuffle_t<data_type_size>::execute(
 
 template struct jit_uni_shuffle_t<f32_size_bytes>;
 template struct jit_uni_shuffle_t<bf16_size_bytes>;
+template struct jit_uni_shuffle_t<s8_size_bytes>;
 
 } // namespace x64
 } // namespace cpu
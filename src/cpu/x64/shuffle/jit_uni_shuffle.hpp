@@ -53,22 +53,29 @@ struct jit_uni_shuffle_t : public primitive_t {
 
             const data_type_t data_type = data_md()->data_type;
 
-            // Currently supporting only group=3 (FWD, BWD) for nChw16c, nCdhw16c formats
             const bool ok = mayiuse(isa)
                     && data_type_size == types::data_type_size(data_type)
                     && platform::has_data_type_support(data_type)
                     && attr()->has_default_values()
                     && C() > 3 // Disabling C <= 3 because it caused perf regression
-                    && group_size() == 3 && axis() == 1
+                    && axis() == 1
                     && IMPLICATION(!is_fwd(), set_default_formats_common());
 
             if (!ok) return status::unimplemented;
 
             const auto dat_tag_ = memory_desc_matches_one_of_tag(
-                    *data_md(), nChw16c, nCdhw16c);
+                    *data_md(), nChw16c, nCdhw16c, nwc, nhwc, ndhwc);
 
             if (dat_tag_ == format_tag::undef) return status::unimplemented;
 
+            // Blocked formats support only group=3 (FWD, BWD). In channels
+            // last the whole channel dimension is treated as a single block,
+            // so any group that evenly divides the channels is supported.
+            const bool is_nxc = utils::one_of(dat_tag_, nwc, nhwc, ndhwc);
+            const bool group_ok = is_nxc ? C() % group_size() == 0
+                                         : group_size() == 3;
+            if (!group_ok) return status::unimplemented;
+
             const memory_desc_wrapper data_d(data_md());
 
             blk_size_ = data_d.blocking_desc().strides[ndims() - 1];
@@ -94,6 +101,10 @@ struct jit_uni_shuffle_t : public primitive_t {
 
     status_t execute(const exec_ctx_t &ctx) const override;
 
+    size_t constant_memory_size() const override {
+        return pd()->C() * sizeof(dim_t);
+    }
+
 private:
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
     status_t precompute_offsets();
@@ -30,6 +30,7 @@
 #include "gpu/compute/dispatch.hpp"
 #include "gpu/compute/kernel.hpp"
 #include "gpu/compute/kernel_ctx.hpp"
+#include "gpu/compute/memory_pool.hpp"
 #include "gpu/jit/jit_generator_base.hpp"
 
 namespace dnnl {
@@ -134,6 +135,16 @@ public:
     // non-blocking query to check if service stream is already created
     bool is_service_stream_created() const { return (bool)service_stream_; }
 
+    // Returns the pool of buffers for the scratchpads, nullptr if disabled.
+    std::shared_ptr<memory_pool_t> memory_pool() {
+        std::call_once(memory_pool_init_, [&]() {
+            const size_t limit = memory_pool_t::get_limit();
+            if (limit > 0)
+                memory_pool_ = std::make_shared<memory_pool_t>(this, limit);
+        });
+        return memory_pool_;
+    }
+
 protected:
     virtual status_t init_device_info() = 0;
 
@@ -149,6 +160,10 @@ private:
     std::once_flag zero_pad_init_;
     std::unique_ptr<stream_t> service_stream_;
     std::mutex service_stream_mutex_;
+    // Scratchpads hold a reference so that the buffers released after the
+    // engine is destroyed do not go to a destroyed pool.
+    std::shared_ptr<memory_pool_t> memory_pool_;
+    std::once_flag memory_pool_init_;
 };
 
 } // namespace compute
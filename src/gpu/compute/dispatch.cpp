@@ -29,8 +29,8 @@ namespace gpu {
 namespace compute {
 
 // Compute optimal local work size for the given global work size.
-void get_optimal_lws(const size_t *gws, size_t *lws, size_t n) {
-    const size_t lws_max = 256;
+void get_optimal_lws(
+        const size_t *gws, size_t *lws, size_t n, size_t lws_max) {
     // Factors in descending order, prefer bigger sizes for local work size.
     const size_t optimal_lws_values[]
             = {256, 224, 192, 160, 128, 96, 64, 32, 16, 8, 7, 6, 5, 4, 3, 2, 1};
@@ -307,6 +307,42 @@ void dispatch_t::generate(bool generate_lws) {
     generate_called = true;
 }
 
+std::vector<nd_range_t> dispatch_t::lws_candidates() const {
+    assert(generate_called && "generate() must be called.");
+
+    std::vector<nd_range_t> candidates = {nd_range_};
+    const size_t *gws = nd_range_.global_range();
+    auto add_candidate = [&](const size_t *lws) {
+        nd_range_t r(gws, lws);
+        for (auto &c : candidates)
+            if (c.str() == r.str()) return;
+        candidates.push_back(r);
+    };
+
+    int vec_dim_idx = find_vectorized_dim();
+    if (vec_dim_idx != -1) {
+        // The work group spans whole sub-groups of the vectorized dimension
+        // only, so the candidates are its multiples that divide the blocks.
+        int gws_index = dims_[vec_dim_idx].gws_index;
+        size_t vec_size = dims_[vec_dim_idx].vector_size;
+        size_t nblocks = dims_[vec_dim_idx].size / dims_[vec_dim_idx].block;
+        for (size_t wg = vec_size; wg <= 256; wg *= 2) {
+            if (gws[gws_index] % wg || (nblocks / vec_size) % (wg / vec_size))
+                continue;
+            size_t lws[3] = {1, 1, 1};
+            lws[gws_index] = wg;
+            add_candidate(lws);
+        }
+    } else {
+        for (size_t lws_max : {32, 64, 128, 256}) {
+            size_t lws[3];
+            get_optimal_lws(gws, lws, 3, lws_max);
+            add_candidate(lws);
+        }
+    }
+    return candidates;
+}
+
 void dispatch_t::define_dim_with_md_hint(
         const std::string &name, int md_hint_index, dim_t size, dim_t block) {
     int nesting_level = min_nesting_level;
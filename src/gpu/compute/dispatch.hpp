@@ -19,6 +19,7 @@
 
 #include <cassert>
 #include <string>
+#include <vector>
 
 #include "common/c_types_map.hpp"
 #include "common/utils.hpp"
@@ -30,7 +31,8 @@ namespace impl {
 namespace gpu {
 namespace compute {
 
-void get_optimal_lws(const size_t *gws, size_t *lws, size_t n);
+void get_optimal_lws(
+        const size_t *gws, size_t *lws, size_t n, size_t lws_max = 256);
 
 class compute_engine_t;
 
@@ -72,6 +74,20 @@ public:
 
     void generate(bool generate_lws = true);
 
+    // Returns the ND-ranges with the same global work size and alternative
+    // local work sizes the kernel may be tuned over. The range chosen by
+    // generate() always goes first.
+    std::vector<nd_range_t> lws_candidates() const;
+
+    // Overrides the local work size chosen by generate(), the global work
+    // size must stay the same.
+    void set_nd_range(const nd_range_t &nd_range) {
+        assert(generate_called && "generate() must be called.");
+        assert(utils::array_cmp(nd_range.global_range(),
+                nd_range_.global_range(), nd_range_.ndims()));
+        nd_range_ = nd_range;
+    }
+
 private:
     // Dimension information necessary for mapping to global work IDs.
     struct dim_info_t {
@@ -0,0 +1,199 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+#include "gpu/compute/dispatch_tuner.hpp"
+
+#include "common/memory_storage.hpp"
+#include "common/persistent_cache.hpp"
+#include "common/stream.hpp"
+#include "common/utils.hpp"
+#include "common/verbose.hpp"
+#include "gpu/compute/compute_engine.hpp"
+#include "gpu/compute/compute_stream.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace gpu {
+namespace compute {
+
+namespace {
+
+// Number of timed executions of every candidate after a warm-up one.
+const int nruns = 5;
+
+std::mutex &results_mutex() {
+    static std::mutex m;
+    return m;
+}
+
+std::unordered_map<std::string, std::string> &results() {
+    static std::unordered_map<std::string, std::string> r;
+    return r;
+}
+
+// The key captures the device and the complete build options of the kernel
+// for the heuristic dispatch, which fully define the problem being tuned.
+std::string tuning_key(const compute_engine_t *engine, const char *kernel_name,
+        const kernel_ctx_t &kernel_ctx) {
+    const auto *dev_info = engine->device_info();
+    const auto &ver = dev_info->runtime_version();
+    return "dispatch_tuning:" + dev_info->name() + ":"
+            + std::to_string((int)dev_info->gpu_arch()) + ":"
+            + std::to_string(dev_info->eu_count()) + ":"
+            + std::to_string(ver.major) + "." + std::to_string(ver.minor) + "."
+            + std::to_string(ver.build) + ":" + kernel_name + ":"
+            + kernel_ctx.options();
+}
+
+bool lookup(const std::string &key, std::string &nd_range_str) {
+    {
+        std::lock_guard<std::mutex> guard(results_mutex());
+        auto it = results().find(key);
+        if (it != results().end()) {
+            nd_range_str = it->second;
+            return true;
+        }
+    }
+    std::vector<unsigned char> blob;
+    if (!persistent_cache::is_enabled()
+            || persistent_cache::load(key, blob) != status::success)
+        return false;
+    nd_range_str = std::string(blob.begin(), blob.end());
+    std::lock_guard<std::mutex> guard(results_mutex());
+    results()[key] = nd_range_str;
+    return true;
+}
+
+void remember(const std::string &key, const std::string &nd_range_str) {
+    {
+        std::lock_guard<std::mutex> guard(results_mutex());
+        results()[key] = nd_range_str;
+    }
+    if (persistent_cache::is_enabled())
+        persistent_cache::store(key,
+                std::vector<unsigned char>(
+                        nd_range_str.begin(), nd_range_str.end()));
+}
+
+} // namespace
+
+bool dispatch_tuner_t::is_enabled() {
+    static const bool enabled = getenv_int("DNNL_GPU_DISPATCH_TUNING", 0) > 0;
+    return enabled;
+}
+
+status_t dispatch_tuner_t::create_kernel(
+        engine_t *engine, dispatch_t &dispatch, kernel_t *kernel) {
+    auto *compute_engine = utils::downcast<compute_engine_t *>(engine);
+
+    kernel_ctx_t kernel_ctx;
+    CHECK(init_kernel_ctx_(kernel_ctx, dispatch));
+
+    std::vector<nd_range_t> candidates;
+    if (is_enabled() && !disabled_) candidates = dispatch.lws_candidates();
+    if (candidates.size() < 2)
+        return compute_engine->create_kernel(kernel, kernel_name_, kernel_ctx);
+
+    const std::string key
+            = tuning_key(compute_engine, kernel_name_, kernel_ctx);
+    std::string best;
+    if (!lookup(key, best)) {
+        stream_t *stream_ptr = nullptr;
+        CHECK(engine->create_stream(&stream_ptr, stream_flags::in_order));
+        std::unique_ptr<stream_t> stream(stream_ptr);
+        auto *compute_stream = utils::downcast<compute_stream_t *>(stream_ptr);
+
+        std::vector<std::unique_ptr<memory_storage_t>> buffers;
+        for (const auto &b : buffer_args_) {
+            memory_storage_t *mem_ptr = nullptr;
+            CHECK(engine->create_memory_storage(&mem_ptr, b.second));
+            buffers.emplace_back(mem_ptr);
+            CHECK(compute_stream->fill(*mem_ptr, 0, b.second));
+            arg_list_.set(b.first, *mem_ptr);
+        }
+
+        double best_time = 0;
+        kernel_t best_kernel;
+        for (const auto &c : candidates) {
+            dispatch_t d = dispatch;
+            d.set_nd_range(c);
+
+            kernel_ctx_t c_kernel_ctx;
+            kernel_t c_kernel, realized_kernel;
+            CHECK(init_kernel_ctx_(c_kernel_ctx, d));
+            CHECK(compute_engine->create_kernel(
+                    &c_kernel, kernel_name_, c_kernel_ctx));
+            CHECK(c_kernel.realize(&realized_kernel, engine));
+
+            // A candidate may exceed the work-group size limit of the
+            // compiled kernel, such candidates are skipped.
+            status_t status = compute_stream->parallel_for(
+                    c, realized_kernel, arg_list_);
+            if (status == status::success) status = stream->wait();
+            if (status != status::success) continue;
+
+            double start = get_msec();
+            for (int i = 0; i < nruns && status == status::success; i++)
+                status = compute_stream->parallel_for(
+                        c, realized_kernel, arg_list_);
+            if (status == status::success) status = stream->wait();
+            if (status != status::success) continue;
+            double time = (get_msec() - start) / nruns;
+
+            if (best.empty() || time < best_time) {
+                best = c.str();
+                best_time = time;
+                best_kernel = c_kernel;
+            }
+        }
+        if (best.empty())
+            return compute_engine->create_kernel(
+                    kernel, kernel_name_, kernel_ctx);
+
+        remember(key, best);
+        if (get_verbose() >= 2) {
+            printf("dnnl_verbose,tune,%s,%s,%g\n", kernel_name_, best.c_str(),
+                    best_time);
+            fflush(0);
+        }
+
+        for (const auto &c : candidates)
+            if (c.str() == best) dispatch.set_nd_range(c);
+        *kernel = best_kernel;
+        return status::success;
+    }
+
+    // The remembered range is not among the candidates when the candidate
+    // generation has changed, the heuristic dispatch is used then.
+    for (const auto &c : candidates) {
+        if (c.str() != best) continue;
+        dispatch.set_nd_range(c);
+        kernel_ctx = kernel_ctx_t();
+        CHECK(init_kernel_ctx_(kernel_ctx, dispatch));
+        break;
+    }
+    return compute_engine->create_kernel(kernel, kernel_name_, kernel_ctx);
+}
+
+} // namespace compute
+} // namespace gpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,88 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef GPU_COMPUTE_DISPATCH_TUNER_HPP
+#define GPU_COMPUTE_DISPATCH_TUNER_HPP
+
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "common/c_types_map.hpp"
+#include "gpu/compute/dispatch.hpp"
+#include "gpu/compute/kernel.hpp"
+#include "gpu/compute/kernel_arg_list.hpp"
+#include "gpu/compute/kernel_ctx.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace gpu {
+namespace compute {
+
+// Chooses the local work size of a dispatch_t-based kernel by measurement
+// instead of the heuristic of dispatch_t::generate(). The tuning is enabled
+// with the DNNL_GPU_DISPATCH_TUNING environment variable. Every candidate
+// from dispatch_t::lws_candidates() is compiled and executed on zeroed
+// scratch buffers and the fastest one is kept.
+//
+// The winner is remembered for the process lifetime and, when the persistent
+// cache is enabled, on disk, keyed by the device and the kernel build
+// options. So a kernel is tuned once and later creations, including those in
+// other processes, only build the chosen candidate.
+class dispatch_tuner_t {
+public:
+    using kernel_ctx_func_t
+            = std::function<status_t(kernel_ctx_t &, const dispatch_t &)>;
+
+    dispatch_tuner_t(
+            const char *kernel_name, const kernel_ctx_func_t &init_kernel_ctx)
+        : kernel_name_(kernel_name), init_kernel_ctx_(init_kernel_ctx) {}
+
+    static bool is_enabled();
+
+    // Arguments to execute the candidates with. Buffers are allocated only
+    // when the kernel is actually measured.
+    kernel_arg_list_t &arg_list() { return arg_list_; }
+    void set_buffer_arg(int index, size_t size) {
+        // The size is unknown for memory with an offset or runtime dims.
+        if (size == 0 || size == DNNL_RUNTIME_SIZE_VAL) disable();
+        buffer_args_.emplace_back(index, size);
+    }
+
+    // For the kernels whose arguments cannot be emulated with scratch
+    // buffers, e.g. with binary post-ops.
+    void disable() { disabled_ = true; }
+
+    // Creates the kernel for the best local work size and sets it to
+    // `dispatch`. Without tuning the kernel is created for `dispatch` as is.
+    status_t create_kernel(
+            engine_t *engine, dispatch_t &dispatch, kernel_t *kernel);
+
+private:
+    const char *kernel_name_;
+    kernel_ctx_func_t init_kernel_ctx_;
+    kernel_arg_list_t arg_list_;
+    std::vector<std::pair<int, size_t>> buffer_args_;
+    bool disabled_ = false;
+};
+
+} // namespace compute
+} // namespace gpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -20,6 +20,7 @@
 #include <memory>
 #include <utility>
 
+#include "common/cache_blob.hpp"
 #include "common/stream.hpp"
 #include "gpu/compute/kernel_arg_list.hpp"
 #include "gpu/compute/utils.hpp"
@@ -52,6 +53,8 @@ public:
 
     status_t realize(kernel_t *kernel, const engine_t *engine) const;
 
+    status_t get_cache_blob(cache_blob_t &cache_blob) const;
+
 private:
     std::shared_ptr<kernel_impl_t> impl_;
 };
@@ -69,6 +72,13 @@ public:
 
     virtual status_t realize(
             kernel_t *kernel, const engine_t *engine) const = 0;
+
+    // Adds the program binary of the kernel to the cache blob. Kernels that
+    // cannot be looked up in a cache blob, such as the ones generated by
+    // nGEN, are regenerated when the primitive is created from it.
+    virtual status_t get_cache_blob(cache_blob_t &cache_blob) const {
+        return status::success;
+    }
 };
 
 inline kernel_t::id_t kernel_t::id() const {
@@ -82,6 +92,9 @@ inline status_t kernel_t::realize(
         kernel_t *kernel, const engine_t *engine) const {
     return impl_->realize(kernel, engine);
 }
+inline status_t kernel_t::get_cache_blob(cache_blob_t &cache_blob) const {
+    return impl_->get_cache_blob(cache_blob);
+}
 
 } // namespace compute
 } // namespace gpu
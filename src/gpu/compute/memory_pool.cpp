@@ -0,0 +1,96 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "gpu/compute/memory_pool.hpp"
+
+#include "common/engine.hpp"
+#include "common/utils.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace gpu {
+namespace compute {
+
+constexpr int memory_pool_t::n_size_classes;
+constexpr size_t memory_pool_t::min_class_size;
+
+size_t memory_pool_t::get_limit() {
+    static const size_t limit = [] {
+        const int limit_mb = getenv_int("DNNL_GPU_MEMORY_POOL_LIMIT", 0);
+        return limit_mb > 0 ? (size_t)limit_mb * 1024 * 1024 : 0;
+    }();
+    return limit;
+}
+
+size_t memory_pool_t::get_class_size(int size_class) {
+    const size_t pow2 = min_class_size << (size_class / 4);
+    return pow2 + (pow2 / 4) * (size_class % 4);
+}
+
+int memory_pool_t::get_size_class(size_t size) {
+    int size_class = 0;
+    while (size_class < n_size_classes - 1 && get_class_size(size_class) < size)
+        size_class++;
+    return size_class;
+}
+
+memory_storage_t *memory_pool_t::acquire(size_t size, size_t &capacity) {
+    const int size_class = get_size_class(size);
+    capacity = nstl::max(size, get_class_size(size_class));
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        auto &free_list = free_lists_[size_class];
+        if (!free_list.empty() && get_class_size(size_class) >= size) {
+            memory_storage_t *storage = free_list.back().release();
+            free_list.pop_back();
+            cached_size_ -= capacity;
+            return storage;
+        }
+    }
+
+    memory_storage_t *storage = nullptr;
+    if (engine_->create_memory_storage(&storage, capacity) == status::success)
+        return storage;
+
+    // The cached buffers may be what prevents the allocation
+    clear();
+    if (engine_->create_memory_storage(&storage, capacity) == status::success)
+        return storage;
+    return nullptr;
+}
+
+void memory_pool_t::release(memory_storage_t *storage, size_t capacity) {
+    std::unique_ptr<memory_storage_t> s(storage);
+    const int size_class = get_size_class(capacity);
+    if (get_class_size(size_class) != capacity) return;
+
+    std::lock_guard<std::mutex> guard(mutex_);
+    if (cached_size_ + capacity > limit_) return;
+    free_lists_[size_class].push_back(std::move(s));
+    cached_size_ += capacity;
+}
+
+void memory_pool_t::clear() {
+    std::lock_guard<std::mutex> guard(mutex_);
+    for (auto &free_list : free_lists_)
+        free_list.clear();
+    cached_size_ = 0;
+}
+
+} // namespace compute
+} // namespace gpu
+} // namespace impl
+} // namespace dnnl
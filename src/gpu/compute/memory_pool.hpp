@@ -0,0 +1,80 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef GPU_COMPUTE_MEMORY_POOL_HPP
+#define GPU_COMPUTE_MEMORY_POOL_HPP
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "common/c_types_map.hpp"
+#include "common/memory_storage.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace gpu {
+namespace compute {
+
+// Pool of device buffers of an engine used for the library-managed
+// scratchpads. Released buffers are kept in free lists by size class and
+// handed out again to the next scratchpads of the same class, so creating
+// and destroying primitives in a steady state does not allocate device
+// memory. Rounding up to the size classes bounds the fragmentation.
+//
+// The pool is enabled by setting DNNL_GPU_MEMORY_POOL_LIMIT to the amount of
+// memory in MB the free lists may hold. Buffers released beyond the limit
+// are freed.
+class memory_pool_t {
+public:
+    memory_pool_t(engine_t *engine, size_t limit)
+        : engine_(engine), limit_(limit), free_lists_(n_size_classes) {}
+
+    // Returns the limit in bytes, 0 if the pool is disabled.
+    static size_t get_limit();
+
+    // Returns a buffer of at least `size` bytes and its actual size, or
+    // nullptr if the allocation fails.
+    memory_storage_t *acquire(size_t size, size_t &capacity);
+
+    // Takes a buffer obtained from acquire() back.
+    void release(memory_storage_t *storage, size_t capacity);
+
+private:
+    // 4 classes per power of two starting from 64 KB, which limits the
+    // memory overhead of rounding up to 25%.
+    static constexpr int n_size_classes = 4 * 40;
+    static constexpr size_t min_class_size = 64 * 1024;
+
+    static size_t get_class_size(int size_class);
+    static int get_size_class(size_t size);
+
+    void clear();
+
+    engine_t *engine_;
+    size_t limit_;
+    size_t cached_size_ = 0;
+
+    std::vector<std::vector<std::unique_ptr<memory_storage_t>>> free_lists_;
+    std::mutex mutex_;
+};
+
+} // namespace compute
+} // namespace gpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -22,6 +22,7 @@
 #include "gpu/ocl/gemm/gen9_gemm.hpp"
 #include "gpu/ocl/gemm/gen9_gemm_x8x8s32.hpp"
 #include "gpu/ocl/gemm/ref_gemm.hpp"
+#include "gpu/ocl/gemm_1x1_convolution.hpp"
 #include "gpu/ocl/gemm_inner_product.hpp"
 #include "gpu/ocl/gemm_matmul.hpp"
 #include "gpu/ocl/gemm_post_ops_inner_product.hpp"
@@ -31,7 +32,10 @@
 #include "gpu/ocl/gen9_binary.hpp"
 #include "gpu/ocl/gen9_convolution.hpp"
 #include "gpu/ocl/gen9_eltwise.hpp"
+#include "gpu/ocl/gen9_layer_normalization.hpp"
 #include "gpu/ocl/gen9_pooling.hpp"
+#include "gpu/ocl/gen9_reduction.hpp"
+#include "gpu/ocl/gen9_resampling.hpp"
 #include "gpu/ocl/gen9_softmax.hpp"
 #include "gpu/ocl/gen9_wino_convolution.hpp"
 #include "gpu/ocl/ref_batch_normalization.hpp"
@@ -39,11 +43,13 @@
 #include "gpu/ocl/ref_convolution.hpp"
 #include "gpu/ocl/ref_deconvolution.hpp"
 #include "gpu/ocl/ref_eltwise.hpp"
+#include "gpu/ocl/ref_group_normalization.hpp"
 #include "gpu/ocl/ref_inner_product.hpp"
 #include "gpu/ocl/ref_layer_normalization.hpp"
 #include "gpu/ocl/ref_lrn.hpp"
 #include "gpu/ocl/ref_matmul.hpp"
 #include "gpu/ocl/ref_pooling.hpp"
+#include "gpu/ocl/ref_prelu.hpp"
 #include "gpu/ocl/ref_reduction.hpp"
 #include "gpu/ocl/ref_resampling.hpp"
 #include "gpu/ocl/ref_shuffle.hpp"
@@ -76,6 +82,7 @@ const pd_create_f gpu_impl_list[] = {
         INSTANCE(ocl::gen12lp_x8s8s32x_1x1_convolution_fwd_t),
         INSTANCE(ocl::gen12lp_x8s8s32x_convolution_fwd_t),
         INSTANCE(ocl::gen12lp_x8s8s32x_convolution_bwd_data_t),
+        INSTANCE(ocl::gemm_1x1_convolution_fwd_t),
         INSTANCE(ocl::gen9_wino_convolution_fwd_t),
         INSTANCE(ocl::gen9_convolution_fwd_t),
         INSTANCE(ocl::gen9_convolution_bwd_data_t),
@@ -113,6 +120,7 @@ const pd_create_f gpu_impl_list[] = {
         // Softmax
         INSTANCE(ocl::gen9_softmax_fwd_t),
         INSTANCE(ocl::ref_softmax_fwd_t),
+        INSTANCE(ocl::gen9_softmax_bwd_t),
         INSTANCE(ocl::ref_softmax_bwd_t),
 
         // GEMM (internal)
@@ -130,9 +138,13 @@ const pd_create_f gpu_impl_list[] = {
         INSTANCE(ocl::ref_shuffle_t),
 
         // Layer Normalization
+        INSTANCE(ocl::gen9_layer_normalization_fwd_t),
         INSTANCE(ocl::ref_layer_normalization_fwd_t),
         INSTANCE(ocl::ref_layer_normalization_bwd_t),
 
+        // Group Normalization
+        INSTANCE(ocl::ref_group_normalization_fwd_t),
+
         // Binary
         INSTANCE(ocl::gen9_binary_t),
         INSTANCE(ocl::ref_binary_t),
@@ -142,12 +154,19 @@ const pd_create_f gpu_impl_list[] = {
         INSTANCE(ocl::ref_matmul_t),
 
         // Reduction
+        INSTANCE(ocl::gen9_reduction_t),
         INSTANCE(ocl::ref_reduction_t),
 
         // Resampling
+        INSTANCE(ocl::gen9_resampling_fwd_t),
+        INSTANCE(ocl::gen9_resampling_bwd_t),
         INSTANCE(ocl::ref_resampling_fwd_t),
         INSTANCE(ocl::ref_resampling_bwd_t),
 
+        // PReLU
+        INSTANCE(ocl::ref_prelu_fwd_t),
+        INSTANCE(ocl::ref_prelu_bwd_t),
+
         // Zero Pad
         INSTANCE(ocl::ref_zero_pad_t),
         nullptr,
@@ -20,6 +20,7 @@
 #include "common/primitive.hpp"
 #include "common/utils.hpp"
 #include "gpu/compute/compute.hpp"
+#include "gpu/compute/dispatch_tuner.hpp"
 #include "gpu/gemm/gpu_gemm_exec_types.hpp"
 #include "gpu/gpu_resource.hpp"
 
@@ -56,6 +57,14 @@ struct gpu_primitive_t : public primitive_t {
         return status::success;
     }
 
+    status_t get_cache_blob(cache_blob_t &cache_blob) const override {
+        for (const auto &rk : registered_kernels_)
+            if (rk) CHECK(rk.get_cache_blob(cache_blob));
+        for (auto const &np : nested_primitives())
+            if (np) CHECK(np->get_cache_blob(cache_blob));
+        return status::success;
+    }
+
     status_t create_kernel(engine_t *engine, compute::kernel_t *kernel,
             jit::jit_generator_base &jitter) {
 
@@ -88,6 +97,13 @@ struct gpu_primitive_t : public primitive_t {
         return status;
     }
 
+    status_t create_kernel(engine_t *engine, compute::kernel_t *kernel,
+            compute::dispatch_tuner_t &tuner, compute::dispatch_t &dispatch) {
+        CHECK(tuner.create_kernel(engine, dispatch, kernel));
+        register_kernels({*kernel});
+        return status::success;
+    }
+
 protected:
     virtual primitive_list_t nested_primitives() const { return {}; }
 
@@ -115,21 +115,25 @@ status_t gen_gemm_t::execute(const gemm_exec_ctx_t &ctx) const {
     auto *compute_stream
             = utils::downcast<compute::compute_stream_t *>(ctx.stream());
 
-    auto m = pd()->desc()->m();
-    auto n = pd()->desc()->n();
-    auto k = pd()->desc()->k();
-    auto batch = pd()->desc()->batch();
+    // Runtime dimensions and strides are only known from the execution
+    // descriptor, the kernel takes all of them as arguments.
+    const auto exec_d = ctx.desc() ? ctx.desc() : pd()->desc();
+
+    auto m = exec_d->m();
+    auto n = exec_d->n();
+    auto k = exec_d->k();
+    auto batch = exec_d->batch();
 
     bool transa = (pd()->desc()->transa() == dnnl_trans);
     bool transb = (pd()->desc()->transb() == dnnl_trans);
 
-    auto lda = pd()->desc()->lda();
-    auto ldb = pd()->desc()->ldb();
-    auto ldc = pd()->desc()->ldc();
+    auto lda = exec_d->lda();
+    auto ldb = exec_d->ldb();
+    auto ldc = exec_d->ldc();
 
-    auto stride_a = pd()->desc()->stride_a();
-    auto stride_b = pd()->desc()->stride_b();
-    auto stride_c = pd()->desc()->stride_c();
+    auto stride_a = exec_d->stride_a();
+    auto stride_b = exec_d->stride_b();
+    auto stride_c = exec_d->stride_c();
 
     auto alpha = pd()->alpha();
     auto beta = pd()->beta();
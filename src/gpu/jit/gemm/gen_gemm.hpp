@@ -51,8 +51,9 @@ struct gen_gemm_t : public gpu_gemm_t {
                     = utils::downcast<compute::compute_engine_t *>(engine);
 
             // LIMITATIONS:
-            // - runtime dims are not supported
+            // - runtime batch is not supported
             // - bias is not supported
+            // - the only supported eltwise post-op is relu for f32 and s32
             bool ok = true;
 
             auto attr_skip_mask = smask_t::oscale | smask_t::post_ops;
@@ -85,16 +86,15 @@ struct gen_gemm_t : public gpu_gemm_t {
                         && d->acc_type == d->c_type();
             }
 
-            ok = ok
-                    && !utils::one_of(DNNL_RUNTIME_DIM_VAL, d->m(), d->n(),
-                            d->k(), d->lda(), d->ldb(), d->ldc(), d->batch())
+            bool runtime_batch = false;
+            for (int i = 0; i < d->c_desc.ndims - 2; i++)
+                runtime_batch |= (d->c_desc.dims[i] == DNNL_RUNTIME_DIM_VAL);
+
+            ok = ok && !runtime_batch
                     && d->bias_type() == data_type::undef
                     && compute_engine->mayiuse_ngen_kernels()
                     && attr()->has_default_values(attr_skip_mask)
-                    && attr()->output_scales_.mask_ == 0
-                    && attr()->post_ops_.len() <= 1
-                    && IMPLICATION(attr()->post_ops_.len() == 1,
-                            attr()->post_ops_.find(sum) != -1);
+                    && attr()->output_scales_.mask_ == 0 && post_ops_ok();
 
             if (!ok) return status::unimplemented;
 
@@ -123,13 +123,51 @@ struct gen_gemm_t : public gpu_gemm_t {
             return !attr()->zero_points_.has_default_values(DNNL_ARG_DST);
         }
 
-        bool with_eltwise() const { return false; }
+        bool post_ops_ok() const {
+            using namespace primitive_kind;
+            const auto &p = attr()->post_ops_;
+            switch (p.len()) {
+                case 0: return true;
+                case 1: return p.contain(sum, 0) || eltwise_ok(0);
+                case 2: return p.contain(sum, 0) && eltwise_ok(1);
+                default: return false;
+            }
+        }
+
+        bool eltwise_ok(int idx) const {
+            const auto &e = attr()->post_ops_.entry_[idx];
+            return e.is_relu(false, false)
+                    && utils::one_of(desc()->c_type(), data_type::f32,
+                            data_type::s32);
+        }
+
+        bool with_eltwise() const {
+            return attr()->post_ops_.find(primitive_kind::eltwise) != -1;
+        }
 
-        float eltwise_alpha() const { return 1.0f; }
+        float eltwise_alpha() const {
+            const int eltwise_idx
+                    = attr()->post_ops_.find(primitive_kind::eltwise);
+            return with_eltwise()
+                    ? attr()->post_ops_.entry_[eltwise_idx].eltwise.alpha
+                    : 1.0f;
+        }
 
-        float eltwise_beta() const { return 0.0f; }
+        float eltwise_beta() const {
+            const int eltwise_idx
+                    = attr()->post_ops_.find(primitive_kind::eltwise);
+            return with_eltwise()
+                    ? attr()->post_ops_.entry_[eltwise_idx].eltwise.beta
+                    : 0.0f;
+        }
 
-        float eltwise_scale() const { return 1.0f; }
+        float eltwise_scale() const {
+            const int eltwise_idx
+                    = attr()->post_ops_.find(primitive_kind::eltwise);
+            return with_eltwise()
+                    ? attr()->post_ops_.entry_[eltwise_idx].eltwise.scale
+                    : 1.0f;
+        }
 
         float alpha() const { return attr()->output_scales_.scales_[0]; }
 
@@ -173,8 +211,8 @@ struct gen_gemm_t : public gpu_gemm_t {
         kernel_t kernel;
 
         auto status = kernel.init(pd()->arch_, batched, transa, transb,
-                pd()->with_c_offset(), a_type, b_type, c_type, unroll_m,
-                unroll_n);
+                pd()->with_c_offset(), pd()->with_eltwise(), a_type, b_type,
+                c_type, unroll_m, unroll_n);
         if (status != status::success) return status;
 
         create_kernel(engine, &nocopy_kernel_, kernel);
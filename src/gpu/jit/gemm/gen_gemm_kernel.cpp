@@ -517,6 +517,13 @@ void gen_gemm_nocopy_kernel_t::choose_unrolls(compute::gpu_arch_t arch,
 
     unroll_m = unroll_n = 1;
 
+    // Runtime dimensions are resolved only at execution, so pick the kernel
+    // meant for large problems, which is the one that handles any size best.
+    const dim_t runtime_dim_hint = 1 << 20;
+    if (m == DNNL_RUNTIME_DIM_VAL) m = runtime_dim_hint;
+    if (n == DNNL_RUNTIME_DIM_VAL) n = runtime_dim_hint;
+    if (k == DNNL_RUNTIME_DIM_VAL) k = runtime_dim_hint;
+
     using tables_t = decltype(gen9_f32_nocopy_tables);
     const tables_t *all_tables[3][2]
             = {{&gen9_f32_nocopy_tables, &gen12lp_f32_nocopy_tables},
@@ -82,8 +82,9 @@ private:
 
 struct gen_gemm_nocopy_kernel_t : public gen_gemm_kernel_t {
     status_t init(compute::gpu_arch_t arch, bool batch, bool trans_a,
-            bool trans_b, bool c_offset, data_type_t a_type, data_type_t b_type,
-            data_type_t c_type, int unroll_m, int unroll_n) {
+            bool trans_b, bool c_offset, bool eltwise_relu, data_type_t a_type,
+            data_type_t b_type, data_type_t c_type, int unroll_m,
+            int unroll_n) {
 
         problem_.Ta = convert_dnnl_to_kernel_type(a_type);
         problem_.Tb = convert_dnnl_to_kernel_type(b_type);
@@ -113,6 +114,7 @@ struct gen_gemm_nocopy_kernel_t : public gen_gemm_kernel_t {
             problem_.CO.padded = false;
             problem_.CO.alignment = problem_.C.alignment;
         }
+        problem_.postReLU = eltwise_relu;
 
         strategy_.unroll[LoopM] = unroll_m;
         strategy_.unroll[LoopN] = unroll_n;
@@ -5984,6 +5984,38 @@ bool gemm_kernel_generator_t<hw>::gemmApplyCOffsetDispatch(
     return ok;
 }
 
+// Apply ReLU to C on the final k block:
+//  C <- eltwise_scale * (C < 0 ? eltwise_alpha * C : C).
+// C is converted to the scalar type, which is f32 whenever this is enabled.
+template <ngen::HW hw>
+void gemm_kernel_generator_t<hw>::gemmApplyPostReLU(const GEMMProblem &problem,
+        const GEMMStrategy &strategy, GEMMState &state) {
+    Label labelReLUDone;
+
+    auto Ts = problem.Ts;
+
+    // Convert unconditionally so both paths agree on the accumulator type.
+    gemmConvertC(Ts, problem, strategy, state);
+
+    auto flag = state.raVFlag.alloc();
+
+    and_(1 | nz | flag, null.ud(), state.inputs.flags, FlagNonfinalKBlock);
+    jmpi(1 | flag, labelReLUDone);
+
+    status << "Applying ReLU post-op" << status_stream::endl;
+    map(Ts.real(), state.C_regs[0], state.C_regs[0], strategy,
+            [&](int esize, GRF acc, GRF _) {
+                cmp(esize | lt | flag, null.retype(acc.getType()), acc,
+                        cast(Ts.real(), 0.0));
+                mul(esize | flag, acc, acc, state.inputs.eltwiseAlpha);
+                mul(esize, acc, acc, state.inputs.eltwiseScale);
+            });
+
+    mark(labelReLUDone);
+
+    state.raVFlag.safeRelease(flag);
+}
+
 // Load A/B sums from packed input data. Sums are stored at the end of each panel.
 template <ngen::HW hw>
 bool gemm_kernel_generator_t<hw>::gemmLoadABOffset(const GEMMProblem &problem,
@@ -7943,8 +7975,10 @@ bool gemm_kernel_generator_t<hw>::gemmAccessC(COperation op,
 
     if ((op != COperation::UpdateStore) && strategy.C.atomic) stub();
 
-    if (op == COperation::UpdateStore && problem.cOffset == COffset::Post) {
-        // C postoffset is implemented by splitting the update and store steps.
+    if (op == COperation::UpdateStore
+            && (problem.cOffset == COffset::Post || problem.postReLU)) {
+        // C postoffset and post-ops are implemented by splitting the update
+        //  and store steps.
         bool ok = true;
 
         if (!(problem.alpha1() && problem.beta0()))
@@ -7953,12 +7987,15 @@ bool gemm_kernel_generator_t<hw>::gemmAccessC(COperation op,
                             COperation::Update, problem, strategy, state);
         auto storeProblem = problem;
         storeProblem.cOffset = COffset::None;
+        storeProblem.postReLU = false;
         storeProblem.alpha_real = 1;
         storeProblem.alpha_imag = 0;
         storeProblem.beta_real = 0;
         storeProblem.beta_imag = 0;
+        if (problem.postReLU) gemmApplyPostReLU(problem, strategy, state);
         gemmConvertC(problem.Tc, problem, strategy, state);
-        ok = ok && gemmApplyCOffsetDispatch(problem, strategy, state);
+        if (problem.cOffset == COffset::Post)
+            ok = ok && gemmApplyCOffsetDispatch(problem, strategy, state);
         ok = ok
                 && gemmAccessC(
                         COperation::UpdateStore, storeProblem, strategy, state);
@@ -8646,6 +8683,8 @@ void gemm_kernel_generator_t<hw>::gemmInitState(GEMMProblem &problem,
     state.inputs.diagB = interface.getArgumentIfExists("diag_B");
     state.inputs.diagC = interface.getArgumentIfExists("diag_C");
     state.inputs.flags = interface.getArgumentIfExists("flags");
+    state.inputs.eltwiseAlpha = interface.getArgumentIfExists("eltwise_alpha");
+    state.inputs.eltwiseScale = interface.getArgumentIfExists("eltwise_scale");
 
     if (state.inputs.lda.isInvalid()) state.inputs.lda = state.inputs.k;
     if (state.inputs.ldb.isInvalid()) state.inputs.ldb = state.inputs.k;
@@ -8766,6 +8805,11 @@ void gemm_kernel_generator_t<hw>::gemmInitState(GEMMProblem &problem,
 
     if (state.inputs.flags.isValid()) state.ra.claim(state.inputs.flags);
 
+    if (problem.postReLU) {
+        state.ra.claim(state.inputs.eltwiseAlpha);
+        state.ra.claim(state.inputs.eltwiseScale);
+    }
+
     if (problem.batchedS) {
         state.ra.claim(state.inputs.strideA);
         state.ra.claim(state.inputs.strideB);
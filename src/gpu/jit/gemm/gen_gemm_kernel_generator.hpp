@@ -526,6 +526,8 @@ struct GEMMProblem : public CommonProblem {
     bool batchedN = false; // Non-strided batch kernel
     ABOffset abOffset = ABOffset::None; // A/B offset mode.
     COffset cOffset = COffset::None; // C offset mode.
+    bool postReLU
+            = false; // Apply ReLU (with run-time slope and scale) to final C.
 
     bool beta0() const {
         return (beta_real == 0) && (!Tc.isComplex() || (beta_imag == 0));
@@ -647,6 +649,7 @@ struct GEMMState : public CommonState {
         ngen::Subregister localSizeM, localSizeN, localSizeK; // ud
         ngen::Subregister mapping; // q
         ngen::Subregister flags; // ud
+        ngen::Subregister eltwiseAlpha, eltwiseScale; // f
         ngen::Subregister diagA, diagB, diagC; // q
         uint8_t surfaceA, surfaceB; // BTS indices
         uint8_t surfaceC[2], surfaceCO; // BTS indices
@@ -1279,6 +1282,8 @@ protected:
             const GEMMStrategy &strategy, GEMMState &state);
     bool gemmApplyCOffsetDispatch(const GEMMProblem &problem,
             const GEMMStrategy &strategy, GEMMState &state);
+    void gemmApplyPostReLU(const GEMMProblem &problem,
+            const GEMMStrategy &strategy, GEMMState &state);
     void gemmAllocRegs(
             GEMMProblem &problem, GEMMStrategy &strategy, GEMMState &state);
     void gemmAllocAoBoRegs(
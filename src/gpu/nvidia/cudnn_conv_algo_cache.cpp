@@ -0,0 +1,99 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+* Copyright 2020 Codeplay Software Limited
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "gpu/nvidia/cudnn_conv_algo_cache.hpp"
+
+#include "common/persistent_cache.hpp"
+#include "common/utils.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace gpu {
+namespace nvidia {
+namespace conv_algo_cache {
+
+namespace {
+
+using entry_t = std::pair<int, cudnnMathType_t>;
+
+std::mutex &cache_mutex() {
+    static std::mutex m;
+    return m;
+}
+
+std::unordered_map<std::string, entry_t> &cache() {
+    static std::unordered_map<std::string, entry_t> c;
+    return c;
+}
+
+} // namespace
+
+bool heuristic_only() {
+    static const bool heuristic
+            = getenv_int("DNNL_CUDNN_CONV_ALGO_HEURISTIC", 0) > 0;
+    return heuristic;
+}
+
+bool lookup(const std::string &key, int &algo, cudnnMathType_t &math_type) {
+    {
+        std::lock_guard<std::mutex> guard(cache_mutex());
+        auto it = cache().find(key);
+        if (it != cache().end()) {
+            algo = it->second.first;
+            math_type = it->second.second;
+            return true;
+        }
+    }
+
+    std::vector<unsigned char> blob;
+    if (!persistent_cache::is_enabled()
+            || persistent_cache::load(key, blob) != status::success
+            || blob.size() != 2 * sizeof(int))
+        return false;
+    int values[2];
+    utils::array_copy((unsigned char *)values, blob.data(), blob.size());
+    algo = values[0];
+    math_type = static_cast<cudnnMathType_t>(values[1]);
+
+    std::lock_guard<std::mutex> guard(cache_mutex());
+    cache()[key] = entry_t(algo, math_type);
+    return true;
+}
+
+void store(const std::string &key, int algo, cudnnMathType_t math_type) {
+    {
+        std::lock_guard<std::mutex> guard(cache_mutex());
+        cache()[key] = entry_t(algo, math_type);
+    }
+    if (!persistent_cache::is_enabled()) return;
+
+    const int values[2] = {algo, static_cast<int>(math_type)};
+    const auto *bytes = reinterpret_cast<const unsigned char *>(values);
+    persistent_cache::store(
+            key, std::vector<unsigned char>(bytes, bytes + sizeof(values)));
+}
+
+} // namespace conv_algo_cache
+} // namespace nvidia
+} // namespace gpu
+} // namespace impl
+} // namespace dnnl
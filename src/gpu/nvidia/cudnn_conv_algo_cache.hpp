@@ -0,0 +1,55 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+* Copyright 2020 Codeplay Software Limited
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef GPU_NVIDIA_CUDNN_CONV_ALGO_CACHE_HPP
+#define GPU_NVIDIA_CUDNN_CONV_ALGO_CACHE_HPP
+
+#include <string>
+
+#include "cudnn.h"
+
+namespace dnnl {
+namespace impl {
+namespace gpu {
+namespace nvidia {
+
+// Process-wide cache of the convolution algorithms chosen for the cuDNN
+// descriptors. cudnnFind*Algorithm() benchmarks every algorithm on the device,
+// which dominates the primitive creation time, so it is done only once per
+// problem. When the persistent cache is enabled (DNNL_PERSISTENT_CACHE_DIR)
+// the choices also survive process restarts.
+//
+// The key must capture the device and everything the cuDNN descriptors are
+// built from, see cudnn_convolution_impl_base_t::algo_cache_key().
+namespace conv_algo_cache {
+
+// With DNNL_CUDNN_CONV_ALGO_HEURISTIC=1 the algorithms are chosen by the
+// cudnnGet*Algorithm_v7() heuristics instead of benchmarking: the primitive
+// creation is fast, but the chosen algorithm may be slower.
+bool heuristic_only();
+
+bool lookup(const std::string &key, int &algo, cudnnMathType_t &math_type);
+void store(const std::string &key, int algo, cudnnMathType_t math_type);
+
+} // namespace conv_algo_cache
+
+} // namespace nvidia
+} // namespace gpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
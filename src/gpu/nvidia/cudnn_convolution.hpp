@@ -89,8 +89,12 @@ struct cudnn_convolution_fwd_t : public primitive_t {
                 if (dst_md_.data_type == s8) { dst_md_temp_.data_type = f32; }
             }
 
-            impl_.reset(new cudnn_convolution_impl_fwd_t());
-            return impl_->init(engine, this, use_temp_dst_);
+            auto *impl = new cudnn_convolution_impl_fwd_t();
+            impl_.reset(impl);
+            CHECK(impl->init(engine, this, use_temp_dst_));
+            // The fused path writes the final result right to the dst
+            if (impl->fuses_bias_post_ops()) use_temp_dst_ = false;
+            return status::success;
         }
         bool with_scratchpad() const { return impl_->with_scratchpad(); }
         std::shared_ptr<cudnn_convolution_impl_base_t> impl_;
@@ -18,10 +18,14 @@
 #ifndef GPU_NVIDIA_CUDNN_CONVOLUTION_IMPL_HPP
 #define GPU_NVIDIA_CUDNN_CONVOLUTION_IMPL_HPP
 
+#include <sstream>
+#include <string>
+
 #include "cudnn.h"
 
 #include "common/c_types_map.hpp"
 #include "common/convolution_pd.hpp"
+#include "gpu/nvidia/cudnn_conv_algo_cache.hpp"
 #include "gpu/nvidia/cudnn_conv_filter_adjustment_base.hpp"
 #include "gpu/nvidia/cudnn_convolution_pd.hpp"
 #include "gpu/nvidia/sycl_cuda_engine.hpp"
@@ -102,6 +106,30 @@ public:
     virtual status_t init_zero_dims(convolution_pd_t *pd) {
         return status::success;
     }
+
+    // Identifies the problem in the process-wide algorithm cache: the device
+    // and everything the cuDNN descriptors are created from.
+    std::string algo_cache_key(engine_t *engine, const convolution_pd_t *pd,
+            const char *direction) const {
+        auto &sycl_engine = *utils::downcast<sycl_cuda_engine_t *>(engine);
+        std::ostringstream oss;
+        oss << "cudnn_conv_algo:" << sycl_engine.device_info()->name() << ":"
+            << cudnnGetVersion() << ":" << direction << ":"
+            << (conv_algo_cache::heuristic_only() ? "heuristic" : "find")
+            << ":" << (int)pd->desc()->alg_kind << ":"
+            << computation_data_type << ":" << group_count;
+        const int conv_ndims = ndims[x] - 2;
+        for (int i = 0; i < conv_ndims; i++)
+            oss << ":" << padding[i] << "," << filter_strides[i] << ","
+                << dilation[i];
+        const int ios[] = {x, weights, y};
+        for (int io : ios) {
+            oss << ":" << data_types[io] << "," << formats[io];
+            for (int i = 0; i < ndims[io]; i++)
+                oss << "," << dims[io][i] << "x" << strides[io][i];
+        }
+        return oss.str();
+    }
     void get_dims_and_strides(int io) {
         convert_dims(
                 dnnl_descs[io].dims, dims[io], dnnl_descs[io].ndims, ndims[io]);
@@ -370,6 +398,9 @@ protected:
     bool need_reorder = false;
     bool use_temp_dst = false;
     float sum_scale = 1.0f;
+    // bias, sum and eltwise are applied by the convolution call itself
+    bool fuse_bias_post_ops = false;
+    float fused_sum_scale = 0.0f;
 
 public:
     virtual ~cudnn_convolution_impl_fwd_t() {
@@ -414,10 +445,13 @@ public:
         CHECK(create_cudnn_descs(pd));
         CHECK(configure_alg_kind(engine, pd));
         CHECK(init_scratchpad(engine, pd));
+        if (fuse_bias_post_ops) use_temp_dst = false;
 
         return status::success;
     }
 
+    bool fuses_bias_post_ops() const { return fuse_bias_post_ops; }
+
     void execute_reorder(cudnnHandle_t handle, void *src, void *dst,
             bool flip_formats) const {
         const float alpha = 1.0f;
@@ -449,6 +483,15 @@ public:
             transform_filter(handle, weights, w_scratch);
             weights = w_scratch;
         }
+        if (fuse_bias_post_ops) {
+            // y = act(alpha * conv(x, w) + fused_sum_scale * y + bias)
+            CUDNN_EXECUTE_FUNC_V(cudnnConvolutionBiasActivationForward, handle,
+                    &alpha, descs[io::x], x, weights_desc, weights, conv_desc,
+                    fwd_alg_kind, scratchpad, scratchpad_size,
+                    &fused_sum_scale, descs[io::y], y, descs[io::bias], bias,
+                    activation_desc, descs[io::y], y);
+            return;
+        }
         if (computation_data_type == CUDNN_DATA_INT32 && bias) {
             CUDNN_EXECUTE_FUNC_V(cudnnConvolutionBiasActivationForward, handle,
                     &alpha, descs[io::x], x, weights_desc, weights, conv_desc,
@@ -527,12 +570,34 @@ public:
                 = utils::downcast<sycl_cuda_stream_t *>(service_stream);
         auto handle = cuda_stream->get_cudnn_handle();
 
-        CHECK(CUDNN_EXECUTE_FUNC_S(cudnnGetConvolutionForwardAlgorithmMaxCount,
-                handle, &requested_algo_count));
-        perf.resize(requested_algo_count);
-        CHECK(CUDNN_EXECUTE_FUNC_S(cudnnFindConvolutionForwardAlgorithm, handle,
-                descs[x], weights_desc, conv_desc, descs[y],
-                requested_algo_count, &returned_algo_count, perf.data()));
+        const std::string key = algo_cache_key(engine, pd, "fwd");
+        int cached_algo = 0;
+        cudnnMathType_t cached_math_type;
+        const bool cached = conv_algo_cache::lookup(
+                key, cached_algo, cached_math_type);
+        if (cached) {
+            perf.assign(1, cudnnConvolutionFwdAlgoPerf_t());
+            perf[0].algo = static_cast<cudnnConvolutionFwdAlgo_t>(cached_algo);
+            perf[0].status = CUDNN_STATUS_SUCCESS;
+            perf[0].mathType = cached_math_type;
+            returned_algo_count = 1;
+        } else {
+            CHECK(CUDNN_EXECUTE_FUNC_S(
+                    cudnnGetConvolutionForwardAlgorithmMaxCount, handle,
+                    &requested_algo_count));
+            perf.resize(requested_algo_count);
+            if (conv_algo_cache::heuristic_only())
+                CHECK(CUDNN_EXECUTE_FUNC_S(
+                        cudnnGetConvolutionForwardAlgorithm_v7, handle,
+                        descs[x], weights_desc, conv_desc, descs[y],
+                        requested_algo_count, &returned_algo_count,
+                        perf.data()));
+            else
+                CHECK(CUDNN_EXECUTE_FUNC_S(cudnnFindConvolutionForwardAlgorithm,
+                        handle, descs[x], weights_desc, conv_desc, descs[y],
+                        requested_algo_count, &returned_algo_count,
+                        perf.data()));
+        }
         for (size_t i = 0; i < returned_algo_count; i++) {
             if (perf[i].status == CUDNN_STATUS_SUCCESS) {
                 // cudnnFindConvolutionForwardAlgorithm can erroneously report
@@ -575,24 +640,67 @@ public:
                 fwd_alg_kind = perf[i].algo;
                 CHECK(CUDNN_EXECUTE_FUNC_S(cudnnSetConvolutionMathType,
                         conv_desc, perf[i].mathType));
+                if (!cached)
+                    conv_algo_cache::store(
+                            key, perf[i].algo, perf[i].mathType);
                 break;
             } else {
                 return status::unimplemented;
             }
         }
 
-        if (fwd_alg_kind == CUDNN_CONVOLUTION_FWD_ALGO_IMPLICIT_PRECOMP_GEMM) {
+        bool with_relu = false;
+        fuse_bias_post_ops = bias_post_ops_fusible(pd, with_relu);
+        if (fuse_bias_post_ops
+                || fwd_alg_kind
+                        == CUDNN_CONVOLUTION_FWD_ALGO_IMPLICIT_PRECOMP_GEMM) {
             CHECK(CUDNN_EXECUTE_FUNC_S(
                     cudnnCreateActivationDescriptor, &activation_desc));
             CHECK(CUDNN_EXECUTE_FUNC_S(cudnnSetActivationDescriptor,
                     activation_desc,
-                    cudnnActivationMode_t::CUDNN_ACTIVATION_IDENTITY,
+                    with_relu ? CUDNN_ACTIVATION_RELU
+                              : CUDNN_ACTIVATION_IDENTITY,
                     CUDNN_NOT_PROPAGATE_NAN, 1.0));
         }
 
         return status::success;
     }
 
+    // cudnnConvolutionBiasActivationForward computes the convolution, adds
+    // the bias and the scaled destination and applies the activation in a
+    // single pass over the destination. The activation can be either ReLU or
+    // identity, the latter being supported by the implicit precomputed GEMM
+    // algorithm only.
+    bool bias_post_ops_fusible(const convolution_pd_t *pd, bool &with_relu) {
+        with_relu = false;
+        if (!with_bias || do_scaling || need_reorder) return false;
+        if (computation_data_type == CUDNN_DATA_INT32) return false;
+        if (data_types[bias] != data_types[y]) return false;
+
+        // Sum, when present, goes first: this is checked by the pd
+        const auto &p = pd->attr()->post_ops_;
+        float sum = 0.0f;
+        for (int i = 0; i < p.len(); i++) {
+            const auto &e = p.entry_[i];
+            if (e.is_sum(false)) {
+                sum = e.sum.scale;
+            } else if (e.is_eltwise(true)
+                    && e.eltwise.alg == alg_kind::eltwise_relu
+                    && e.eltwise.alpha == 0.f) {
+                with_relu = true;
+            } else {
+                return false;
+            }
+        }
+        if (!with_relu
+                && fwd_alg_kind
+                        != CUDNN_CONVOLUTION_FWD_ALGO_IMPLICIT_PRECOMP_GEMM)
+            return false;
+
+        fused_sum_scale = sum;
+        return true;
+    }
+
     status_t create_and_set_eltwise_descriptor(const convolution_pd_t *pd) {
 
         CHECK(CUDNN_EXECUTE_FUNC_S(
@@ -653,13 +761,36 @@ protected:
                 = utils::downcast<sycl_cuda_stream_t *>(service_stream);
         auto handle = cuda_stream->get_cudnn_handle();
 
-        CHECK(CUDNN_EXECUTE_FUNC_S(
-                cudnnGetConvolutionBackwardDataAlgorithmMaxCount, handle,
-                &requested_algo_count));
-        perf.resize(requested_algo_count);
-        CHECK(CUDNN_EXECUTE_FUNC_S(cudnnFindConvolutionBackwardDataAlgorithm,
-                handle, weights_desc, descs[y], conv_desc, descs[x],
-                requested_algo_count, &returned_algo_count, perf.data()));
+        const std::string key = algo_cache_key(engine, pd, "bwd_d");
+        int cached_algo = 0;
+        cudnnMathType_t cached_math_type;
+        const bool cached = conv_algo_cache::lookup(
+                key, cached_algo, cached_math_type);
+        if (cached) {
+            perf.assign(1, cudnnConvolutionBwdDataAlgoPerf_t());
+            perf[0].algo
+                    = static_cast<cudnnConvolutionBwdDataAlgo_t>(cached_algo);
+            perf[0].status = CUDNN_STATUS_SUCCESS;
+            perf[0].mathType = cached_math_type;
+            returned_algo_count = 1;
+        } else {
+            CHECK(CUDNN_EXECUTE_FUNC_S(
+                    cudnnGetConvolutionBackwardDataAlgorithmMaxCount, handle,
+                    &requested_algo_count));
+            perf.resize(requested_algo_count);
+            if (conv_algo_cache::heuristic_only())
+                CHECK(CUDNN_EXECUTE_FUNC_S(
+                        cudnnGetConvolutionBackwardDataAlgorithm_v7, handle,
+                        weights_desc, descs[y], conv_desc, descs[x],
+                        requested_algo_count, &returned_algo_count,
+                        perf.data()));
+            else
+                CHECK(CUDNN_EXECUTE_FUNC_S(
+                        cudnnFindConvolutionBackwardDataAlgorithm, handle,
+                        weights_desc, descs[y], conv_desc, descs[x],
+                        requested_algo_count, &returned_algo_count,
+                        perf.data()));
+        }
         for (size_t i = 0; i < returned_algo_count; i++) {
             if (perf[i].status == CUDNN_STATUS_SUCCESS) {
                 switch (pd->desc()->alg_kind) {
@@ -693,6 +824,9 @@ protected:
                 bwd_algo = perf[i].algo;
                 CHECK(CUDNN_EXECUTE_FUNC_S(cudnnSetConvolutionMathType,
                         conv_desc, perf[i].mathType));
+                if (!cached)
+                    conv_algo_cache::store(
+                            key, perf[i].algo, perf[i].mathType);
                 break;
             } else {
                 return status::unimplemented;
@@ -794,13 +928,36 @@ public:
                 = utils::downcast<sycl_cuda_stream_t *>(service_stream);
         auto handle = cuda_stream->get_cudnn_handle();
 
-        CHECK(CUDNN_EXECUTE_FUNC_S(
-                cudnnGetConvolutionBackwardFilterAlgorithmMaxCount, handle,
-                &requested_algo_count));
-        perf.resize(requested_algo_count);
-        CHECK(CUDNN_EXECUTE_FUNC_S(cudnnFindConvolutionBackwardFilterAlgorithm,
-                handle, descs[x], descs[y], conv_desc, weights_desc,
-                requested_algo_count, &returned_algo_count, perf.data()));
+        const std::string key = algo_cache_key(engine, pd, "bwd_w");
+        int cached_algo = 0;
+        cudnnMathType_t cached_math_type;
+        const bool cached = conv_algo_cache::lookup(
+                key, cached_algo, cached_math_type);
+        if (cached) {
+            perf.assign(1, cudnnConvolutionBwdFilterAlgoPerf_t());
+            perf[0].algo
+                    = static_cast<cudnnConvolutionBwdFilterAlgo_t>(cached_algo);
+            perf[0].status = CUDNN_STATUS_SUCCESS;
+            perf[0].mathType = cached_math_type;
+            returned_algo_count = 1;
+        } else {
+            CHECK(CUDNN_EXECUTE_FUNC_S(
+                    cudnnGetConvolutionBackwardFilterAlgorithmMaxCount, handle,
+                    &requested_algo_count));
+            perf.resize(requested_algo_count);
+            if (conv_algo_cache::heuristic_only())
+                CHECK(CUDNN_EXECUTE_FUNC_S(
+                        cudnnGetConvolutionBackwardFilterAlgorithm_v7, handle,
+                        descs[x], descs[y], conv_desc, weights_desc,
+                        requested_algo_count, &returned_algo_count,
+                        perf.data()));
+            else
+                CHECK(CUDNN_EXECUTE_FUNC_S(
+                        cudnnFindConvolutionBackwardFilterAlgorithm, handle,
+                        descs[x], descs[y], conv_desc, weights_desc,
+                        requested_algo_count, &returned_algo_count,
+                        perf.data()));
+        }
         for (size_t i = 0; i < returned_algo_count; i++) {
             if (perf[i].status == CUDNN_STATUS_SUCCESS) {
                 switch (pd->desc()->alg_kind) {
@@ -836,6 +993,9 @@ public:
                 bwd_filter_algo = perf[i].algo;
                 CHECK(CUDNN_EXECUTE_FUNC_S(cudnnSetConvolutionMathType,
                         conv_desc, perf[i].mathType));
+                if (!cached)
+                    conv_algo_cache::store(
+                            key, perf[i].algo, perf[i].mathType);
                 break;
             } else {
                 return status::unimplemented;
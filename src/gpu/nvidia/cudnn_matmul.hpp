@@ -52,18 +52,30 @@ struct cudnn_matmul_t : public primitive_t {
             bool f16_case = utils::everyone_is(f16, src_dt, wei_dt, dst_dt);
             bool s8_case = utils::everyone_is(s8, src_dt, wei_dt)
                     && utils::one_of(dst_dt, s8, f32);
+            // cuBLAS takes bf16 since CUDA 11. The bias and eltwise are
+            // computed by cuDNN on the destination, hence f32 only.
+            bool bf16_case = CUDA_VERSION >= 11000
+                    && utils::everyone_is(bf16, src_dt, wei_dt)
+                    && utils::one_of(dst_dt, bf16, f32)
+                    && IMPLICATION(dst_dt == bf16,
+                            !with_bias()
+                                    && attr()->post_ops_.find(
+                                               primitive_kind::eltwise)
+                                            == -1);
 
             bool ok = attr()->has_default_values(
                               smask_t::oscale_runtime | smask_t::post_ops)
                     && attr_oscale_ok() && attr_post_ops_ok()
                     && set_default_formats()
-                    && (f32_case || f16_case || s8_case)
+                    && (f32_case || f16_case || s8_case || bf16_case)
                     && IMPLICATION(with_bias(),
                             (IMPLICATION(f32_case, utils::one_of(bia_dt, f32))
                                     && IMPLICATION(f16_case,
                                             utils::one_of(bia_dt, f16, f32))
                                     && IMPLICATION(s8_case,
-                                            utils::one_of(bia_dt, s8, f32))));
+                                            utils::one_of(bia_dt, s8, f32))
+                                    && IMPLICATION(bf16_case,
+                                            utils::one_of(bia_dt, f32))));
 
             if (!ok) return status::unimplemented;
             return status::success;
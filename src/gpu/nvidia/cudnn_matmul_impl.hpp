@@ -110,6 +110,8 @@ struct cudnn_matmul_impl_t {
         CHECK(get_cublas_data_type(pd->weights_md()->data_type, weights_type_));
 
         isbatched_ = pd->batched();
+        use_tf32_ = src_type_ == CUDA_R_32F && weights_type_ == CUDA_R_32F
+                && tf32_allowed();
 
         memory_desc_wrapper src_d = memory_desc_wrapper(pd->src_md());
         memory_desc_wrapper weights_d = memory_desc_wrapper(pd->weights_md());
@@ -298,6 +300,12 @@ struct cudnn_matmul_impl_t {
             temp_mem_desc_ = tensor_descs_[io::dst];
             gemm_beta = post_op_sum_;
         }
+#if CUDA_VERSION >= 11000
+        // The math mode is a state of the handle, which is shared
+        if (use_tf32_)
+            CUBLAS_EXECUTE_FUNC(cublasSetMathMode, cublas_handle,
+                    CUBLAS_TF32_TENSOR_OP_MATH);
+#endif
         if (isbatched_) {
             // Calls cublasGemmStridedBatchedEx()
             CUBLAS_EXECUTE_FUNC(cublasGemmStridedBatchedEx, cublas_handle,
@@ -312,6 +320,11 @@ struct cudnn_matmul_impl_t {
                     ldb_, &gemm_beta, scratch, dst_type_, ldc_, acc_type_,
                     gemm_algo_);
         }
+#if CUDA_VERSION >= 11000
+        if (use_tf32_)
+            CUBLAS_EXECUTE_FUNC(
+                    cublasSetMathMode, cublas_handle, CUBLAS_DEFAULT_MATH);
+#endif
         if (with_bias_) {
             // When bias is specified call cudnnAddTensor()
             float bias_beta = 1;
@@ -370,6 +383,11 @@ private:
             case dnnl_data_type_t::dnnl_s8:
                 blas_dt = CUDA_R_8I;
                 return status::success;
+#if CUDA_VERSION >= 11000
+            case dnnl_data_type_t::dnnl_bf16:
+                blas_dt = CUDA_R_16BF;
+                return status::success;
+#endif
             default: return status::unimplemented;
         }
         return status::unimplemented;
@@ -381,6 +399,7 @@ private:
     long long int stride_a_, stride_b_, stride_c_;
     bool isbatched_ = false, with_bias_ = false, bias_dt_mismatch_ = false;
     bool reorder_required_ = false, with_eltwise_ = false;
+    bool use_tf32_ = false;
     bool with_scratchpad_ = false, has_runtime_params_ = false;
     dnnl_data_type_t scratchpad_type_;
     cudaDataType_t src_type_, weights_type_, dst_type_;
@@ -0,0 +1,101 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+* Copyright 2020 Codeplay Software Limited
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "gpu/nvidia/cudnn_rnn.hpp"
+#include "gpu/nvidia/sycl_cuda_scoped_context.hpp"
+#include "gpu/nvidia/sycl_cuda_stream.hpp"
+#include "sycl/sycl_buffer_memory_storage.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace gpu {
+namespace nvidia {
+
+status_t cudnn_rnn_fwd_t::execute(const exec_ctx_t &ctx) const {
+    nvidia::sycl_cuda_stream_t *cuda_stream
+            = utils::downcast<nvidia::sycl_cuda_stream_t *>(ctx.stream());
+
+    const bool with_src_iter = pd()->with_src_iter();
+    const bool with_src_iter_c = pd()->with_src_iter_c();
+    const bool with_dst_iter = pd()->with_dst_iter();
+    const bool with_dst_iter_c = pd()->with_dst_iter_c();
+    const bool with_bias = pd()->with_bias();
+
+    return cuda_stream->interop_task([&](cl::sycl::handler &cgh) {
+        using read_acc_t
+                = cl::sycl::accessor<uint8_t, 1, cl::sycl::access::mode::read>;
+        using write_acc_t = cl::sycl::accessor<uint8_t, 1,
+                cl::sycl::access::mode::write>;
+        auto src_layer_acc = CTX_IN_ACCESSOR(DNNL_ARG_SRC_LAYER);
+        auto wei_layer_acc = CTX_IN_ACCESSOR(DNNL_ARG_WEIGHTS_LAYER);
+        auto wei_iter_acc = CTX_IN_ACCESSOR(DNNL_ARG_WEIGHTS_ITER);
+        auto dst_layer_acc = CTX_OUT_ACCESSOR(DNNL_ARG_DST_LAYER);
+        auto scratch_acc = CTX_SCRATCH_ACCESSOR(
+                memory_tracking::names::key_rnn_space);
+        std::shared_ptr<read_acc_t> src_iter_acc;
+        std::shared_ptr<read_acc_t> src_iter_c_acc;
+        std::shared_ptr<read_acc_t> bias_acc;
+        std::shared_ptr<write_acc_t> dst_iter_acc;
+        std::shared_ptr<write_acc_t> dst_iter_c_acc;
+        if (with_src_iter)
+            src_iter_acc = std::make_shared<read_acc_t>(
+                    CTX_IN_ACCESSOR(DNNL_ARG_SRC_ITER));
+        if (with_src_iter_c)
+            src_iter_c_acc = std::make_shared<read_acc_t>(
+                    CTX_IN_ACCESSOR(DNNL_ARG_SRC_ITER_C));
+        if (with_bias)
+            bias_acc = std::make_shared<read_acc_t>(
+                    CTX_IN_ACCESSOR(DNNL_ARG_BIAS));
+        if (with_dst_iter)
+            dst_iter_acc = std::make_shared<write_acc_t>(
+                    CTX_OUT_ACCESSOR(DNNL_ARG_DST_ITER));
+        if (with_dst_iter_c)
+            dst_iter_c_acc = std::make_shared<write_acc_t>(
+                    CTX_OUT_ACCESSOR(DNNL_ARG_DST_ITER_C));
+
+        cgh.interop_task([=](const cl::sycl::interop_handler &ih) {
+            auto &sycl_engine = *utils::downcast<sycl_cuda_engine_t *>(
+                    cuda_stream->engine());
+            auto sc = cuda_sycl_scoped_context_handler_t(sycl_engine);
+            auto handle = cuda_stream->get_cudnn_handle();
+
+            std::vector<void *> args(cudnn_rnn_fwd_impl_t::NUM_IO, nullptr);
+            using io = cudnn_rnn_fwd_impl_t::io;
+            args[io::src_layer] = sc.memory<void *>(ih, src_layer_acc);
+            args[io::weights_layer] = sc.memory<void *>(ih, wei_layer_acc);
+            args[io::weights_iter] = sc.memory<void *>(ih, wei_iter_acc);
+            args[io::dst_layer] = sc.memory<void *>(ih, dst_layer_acc);
+            args[io::scratch] = sc.memory<void *>(ih, scratch_acc);
+            if (with_src_iter)
+                args[io::src_iter] = sc.memory<void *>(ih, *src_iter_acc);
+            if (with_src_iter_c)
+                args[io::src_iter_c] = sc.memory<void *>(ih, *src_iter_c_acc);
+            if (with_bias) args[io::bias] = sc.memory<void *>(ih, *bias_acc);
+            if (with_dst_iter)
+                args[io::dst_iter] = sc.memory<void *>(ih, *dst_iter_acc);
+            if (with_dst_iter_c)
+                args[io::dst_iter_c] = sc.memory<void *>(ih, *dst_iter_c_acc);
+
+            pd()->rnn_impl_->execute(handle, args);
+        });
+    });
+}
+
+} // namespace nvidia
+} // namespace gpu
+} // namespace impl
+} // namespace dnnl
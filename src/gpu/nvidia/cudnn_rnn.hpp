@@ -0,0 +1,123 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+* Copyright 2020 Codeplay Software Limited
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef GPU_NVIDIA_CUDNN_RNN_HPP
+#define GPU_NVIDIA_CUDNN_RNN_HPP
+
+#include "cudnn.h"
+
+#include <CL/sycl.hpp>
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+#include "common/rnn_pd.hpp"
+#include "common/type_helpers.hpp"
+#include "gpu/nvidia/cudnn_rnn_impl.hpp"
+#include "gpu/nvidia/sycl_cuda_engine.hpp"
+#include "gpu/nvidia/sycl_cuda_utils.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace gpu {
+namespace nvidia {
+
+struct cudnn_rnn_fwd_t : public primitive_t {
+    struct pd_t : public rnn_fwd_pd_t {
+        using rnn_fwd_pd_t::rnn_fwd_pd_t;
+
+        DECLARE_COMMON_PD_T("cuda:cudnn:any", cudnn_rnn_fwd_t);
+
+        status_t init(engine_t *engine) {
+            using namespace data_type;
+            using namespace alg_kind;
+
+            const bool is_rnn = cell_kind() == vanilla_rnn;
+            // cuDNN applies the reset gate after the recurrent GEMM, which
+            // is the linear-before-reset flavor of GRU in oneDNN
+            bool ok = desc()->prop_kind == prop_kind::forward_inference
+                    && utils::one_of(
+                            cell_kind(), vanilla_rnn, vanilla_lstm, lbr_gru)
+                    && IMPLICATION(is_rnn,
+                            utils::one_of(activation_kind(), eltwise_relu,
+                                    eltwise_tanh)
+                                    && desc()->alpha == 0.f)
+                    && !is_lstm_peephole() && !is_lstm_projection()
+                    && !with_seq_lengths()
+                    && utils::everyone_is(f32, src_md(0)->data_type,
+                            weights_md(0)->data_type, weights_md(1)->data_type,
+                            dst_md(0)->data_type)
+                    && IMPLICATION(with_src_iter(), src_md(1)->data_type == f32)
+                    && IMPLICATION(with_dst_iter(), dst_md(1)->data_type == f32)
+                    && IMPLICATION(with_bias(), weights_md(2)->data_type == f32)
+                    && attr()->has_default_values() && !has_zero_dim_memory();
+            if (!ok) return status::unimplemented;
+
+            // oneDNN stacks the layers of each direction independently while
+            // cuDNN feeds the concatenated outputs of both directions to the
+            // next layer, so only a single bidirectional layer maps directly
+            const bool dir_ok = direction() == dnnl_unidirectional_left2right
+                    || (direction() == dnnl_bidirectional_concat && L() == 1);
+            const bool shape_ok = SIC() == DHC()
+                    && IMPLICATION(L() > 1, SLC() == DHC());
+            if (!dir_ok || !shape_ok) return status::unimplemented;
+
+            CHECK(set_default_formats());
+
+            rnn_impl_.reset(new cudnn_rnn_fwd_impl_t());
+            return rnn_impl_->init(engine, this);
+        }
+
+        std::shared_ptr<cudnn_rnn_fwd_impl_t> rnn_impl_;
+
+    private:
+        status_t set_default_formats() {
+            using namespace format_tag;
+            auto init_md = [](memory_desc_t &md, format_tag_t tag) {
+                if (types::is_zero_md(&md)) return status::success;
+                if (md.format_kind == format_kind::any)
+                    CHECK(memory_desc_init_by_tag(md, tag));
+                return memory_desc_wrapper(md).matches_tag(tag)
+                        ? status::success
+                        : status::unimplemented;
+            };
+            CHECK(init_md(src_layer_md_, tnc));
+            CHECK(init_md(dst_layer_md_, tnc));
+            CHECK(init_md(src_iter_md_, ldnc));
+            CHECK(init_md(src_iter_c_md_, ldnc));
+            CHECK(init_md(dst_iter_md_, ldnc));
+            CHECK(init_md(dst_iter_c_md_, ldnc));
+            CHECK(init_md(weights_layer_md_, ldigo));
+            CHECK(init_md(weights_iter_md_, ldigo));
+            CHECK(init_md(bias_md_, ldgo));
+            return status::success;
+        }
+    };
+
+    cudnn_rnn_fwd_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+};
+
+} // namespace nvidia
+} // namespace gpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
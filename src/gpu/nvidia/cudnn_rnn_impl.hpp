@@ -0,0 +1,283 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+* Copyright 2020 Codeplay Software Limited
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef GPU_NVIDIA_CUDNN_RNN_IMPL_HPP
+#define GPU_NVIDIA_CUDNN_RNN_IMPL_HPP
+
+#include <vector>
+
+#include "cudnn.h"
+
+#include "common/c_types_map.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/rnn_pd.hpp"
+#include "common/utils.hpp"
+#include "gpu/nvidia/sycl_cuda_engine.hpp"
+#include "gpu/nvidia/sycl_cuda_stream.hpp"
+#include "gpu/nvidia/sycl_cuda_utils.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace gpu {
+namespace nvidia {
+
+// Forward inference on top of the cuDNN v8 RNN API.
+//
+// cuDNN keeps all the weights and biases in a single opaque weight space,
+// with a row-major [hidden][input] matrix per gate. The oneDNN ldigo weights
+// and ldgo bias are converted into it on every execution, right before the
+// cudnnRNNForward() call. The weight space, the cuDNN temporary space and the
+// device copy of the sequence lengths share the same scratchpad buffer.
+struct cudnn_rnn_fwd_impl_t {
+    enum io {
+        src_layer = 0,
+        src_iter,
+        src_iter_c,
+        weights_layer,
+        weights_iter,
+        bias,
+        dst_layer,
+        dst_iter,
+        dst_iter_c,
+        scratch,
+        NUM_IO
+    };
+
+    ~cudnn_rnn_fwd_impl_t() {
+        if (rnn_desc_)
+            CUDNN_EXECUTE_FUNC_V(cudnnDestroyRNNDescriptor, rnn_desc_);
+        if (dropout_desc_)
+            CUDNN_EXECUTE_FUNC_V(cudnnDestroyDropoutDescriptor, dropout_desc_);
+        for (auto d : {x_desc_, y_desc_})
+            if (d) CUDNN_EXECUTE_FUNC_V(cudnnDestroyRNNDataDescriptor, d);
+        cudnnTensorDescriptor_t descs[] = {h_desc_, m_desc_, b_desc_,
+                wei_src_desc_[0], wei_src_desc_[1], wei_dst_desc_[0],
+                wei_dst_desc_[1]};
+        for (auto d : descs)
+            if (d) CUDNN_EXECUTE_FUNC_V(cudnnDestroyTensorDescriptor, d);
+    }
+
+    status_t init(engine_t *engine, rnn_fwd_pd_t *pd) {
+        T_ = (int)pd->T();
+        N_ = (int)pd->MB();
+        L_ = (int)pd->L();
+        D_ = (int)pd->D();
+        SLC_ = (int)pd->SLC();
+        DHC_ = (int)pd->DHC();
+        DLC_ = (int)pd->DLC();
+        G_ = (int)pd->G();
+        is_lbr_ = pd->is_lbr();
+        with_bias_ = pd->with_bias();
+
+        cudnnRNNMode_t cell_mode;
+        switch (pd->cell_kind()) {
+            case alg_kind::vanilla_rnn:
+                cell_mode = pd->activation_kind() == alg_kind::eltwise_relu
+                        ? CUDNN_RNN_RELU
+                        : CUDNN_RNN_TANH;
+                break;
+            case alg_kind::vanilla_lstm: cell_mode = CUDNN_LSTM; break;
+            case alg_kind::lbr_gru: cell_mode = CUDNN_GRU; break;
+            default: return status::unimplemented;
+        }
+        // The linear-before-reset GRU keeps a separate bias for the
+        // recurrent part of the candidate gate
+        const cudnnRNNBiasMode_t bias_mode = !with_bias_
+                ? CUDNN_RNN_NO_BIAS
+                : (is_lbr_ ? CUDNN_RNN_DOUBLE_BIAS : CUDNN_RNN_SINGLE_INP_BIAS);
+        const cudnnDirectionMode_t dir_mode
+                = D_ == 2 ? CUDNN_BIDIRECTIONAL : CUDNN_UNIDIRECTIONAL;
+
+        auto &sycl_engine = *utils::downcast<sycl_cuda_engine_t *>(engine);
+        stream_t *service_stream;
+        CHECK(sycl_engine.get_service_stream(service_stream));
+        auto cuda_stream
+                = utils::downcast<sycl_cuda_stream_t *>(service_stream);
+        auto handle = cuda_stream->get_cudnn_handle();
+
+        CHECK(CUDNN_EXECUTE_FUNC_S(
+                cudnnCreateDropoutDescriptor, &dropout_desc_));
+        CHECK(CUDNN_EXECUTE_FUNC_S(cudnnSetDropoutDescriptor, dropout_desc_,
+                handle, 0.f, nullptr, 0, 0));
+
+        const std::vector<int> seq_lengths(N_, T_);
+        CHECK(CUDNN_EXECUTE_FUNC_S(cudnnCreateRNNDataDescriptor, &x_desc_));
+        CHECK(CUDNN_EXECUTE_FUNC_S(cudnnSetRNNDataDescriptor, x_desc_,
+                CUDNN_DATA_FLOAT, CUDNN_RNN_DATA_LAYOUT_SEQ_MAJOR_UNPACKED, T_,
+                N_, SLC_, seq_lengths.data(), nullptr));
+        CHECK(CUDNN_EXECUTE_FUNC_S(cudnnCreateRNNDataDescriptor, &y_desc_));
+        CHECK(CUDNN_EXECUTE_FUNC_S(cudnnSetRNNDataDescriptor, y_desc_,
+                CUDNN_DATA_FLOAT, CUDNN_RNN_DATA_LAYOUT_SEQ_MAJOR_UNPACKED, T_,
+                N_, DLC_, seq_lengths.data(), nullptr));
+
+        int h_dims[3] = {L_ * D_, N_, DHC_};
+        int h_strides[3] = {N_ * DHC_, DHC_, 1};
+        CHECK(create_and_set_tensor_descriptor(
+                &h_desc_, CUDNN_DATA_FLOAT, 3, h_dims, h_strides));
+
+        // Persistent kernels keep the recurrent weights on chip for the
+        // whole sequence, which pays off for small batches only. Not all the
+        // shapes are supported, hence the fallback.
+        CHECK(CUDNN_EXECUTE_FUNC_S(cudnnCreateRNNDescriptor, &rnn_desc_));
+        const bool small_batch = N_ <= 32;
+        status_t status = status::unimplemented;
+        for (auto algo :
+                {CUDNN_RNN_ALGO_PERSIST_STATIC, CUDNN_RNN_ALGO_STANDARD}) {
+            if (algo == CUDNN_RNN_ALGO_PERSIST_STATIC && !small_batch)
+                continue;
+            status = CUDNN_EXECUTE_FUNC_S(cudnnSetRNNDescriptor_v8, rnn_desc_,
+                    algo, cell_mode, bias_mode, dir_mode, CUDNN_LINEAR_INPUT,
+                    CUDNN_DATA_FLOAT, CUDNN_DATA_FLOAT, CUDNN_DEFAULT_MATH,
+                    SLC_, DHC_, DHC_, L_, dropout_desc_, 0);
+            if (status != status::success) continue;
+            status = CUDNN_EXECUTE_FUNC_S(cudnnGetRNNTempSpaceSizes, handle,
+                    rnn_desc_, CUDNN_FWD_MODE_INFERENCE, x_desc_,
+                    &temp_space_size_, nullptr);
+            if (status == status::success) break;
+        }
+        CHECK(status);
+        CHECK(CUDNN_EXECUTE_FUNC_S(cudnnGetRNNWeightSpaceSize, handle,
+                rnn_desc_, &weight_space_size_));
+
+        // Descriptors of a single gate matrix: [DHC][input] strided in the
+        // ldigo weights and dense in the weight space
+        for (int is_iter = 0; is_iter < 2; is_iter++) {
+            const int ic = is_iter ? DHC_ : SLC_;
+            int dims[4] = {1, 1, DHC_, ic};
+            int src_strides[4] = {ic * G_ * DHC_, ic * G_ * DHC_, 1, G_ * DHC_};
+            int dst_strides[4] = {ic * DHC_, ic * DHC_, ic, 1};
+            CHECK(create_and_set_tensor_descriptor(&wei_src_desc_[is_iter],
+                    CUDNN_DATA_FLOAT, 4, dims, src_strides));
+            CHECK(create_and_set_tensor_descriptor(&wei_dst_desc_[is_iter],
+                    CUDNN_DATA_FLOAT, 4, dims, dst_strides));
+        }
+        CHECK(CUDNN_EXECUTE_FUNC_S(cudnnCreateTensorDescriptor, &m_desc_));
+        CHECK(CUDNN_EXECUTE_FUNC_S(cudnnCreateTensorDescriptor, &b_desc_));
+
+        const size_t align = 256;
+        temp_space_offset_ = utils::rnd_up(weight_space_size_, align);
+        seq_lengths_offset_
+                = temp_space_offset_ + utils::rnd_up(temp_space_size_, align);
+        const size_t scratch_size = seq_lengths_offset_ + N_ * sizeof(int);
+        pd->scratchpad_registry().registrar().book(
+                memory_tracking::names::key_rnn_space, scratch_size, 1, align);
+
+        return status::success;
+    }
+
+    void execute(cudnnHandle_t handle, const std::vector<void *> &args) const {
+        auto *scratch_ptr = static_cast<uint8_t *>(args[io::scratch]);
+        void *weight_space = scratch_ptr;
+        void *temp_space = scratch_ptr + temp_space_offset_;
+        int *dev_seq_lengths
+                = reinterpret_cast<int *>(scratch_ptr + seq_lengths_offset_);
+
+        cudaStream_t stream;
+        CUDNN_EXECUTE_FUNC(cudnnGetStream, handle, &stream);
+
+        CUDA_EXECUTE_FUNC(cuMemsetD32Async, (CUdeviceptr)dev_seq_lengths,
+                (unsigned)T_, N_, stream);
+        convert_weights(handle, stream, weight_space, args[io::weights_layer],
+                args[io::weights_iter], args[io::bias]);
+
+        CUDNN_EXECUTE_FUNC(cudnnRNNForward, handle, rnn_desc_,
+                CUDNN_FWD_MODE_INFERENCE, dev_seq_lengths, x_desc_,
+                args[io::src_layer], y_desc_, args[io::dst_layer], h_desc_,
+                args[io::src_iter], args[io::dst_iter], h_desc_,
+                args[io::src_iter_c], args[io::dst_iter_c], weight_space_size_,
+                weight_space, temp_space_size_, temp_space, 0, nullptr);
+    }
+
+private:
+    // cuDNN orders the GRU gates as reset, update, candidate while oneDNN
+    // uses update, reset, candidate. The LSTM gates match.
+    int dnnl_gate(int cudnn_gate) const {
+        if (G_ == 3 && cudnn_gate < 2) return 1 - cudnn_gate;
+        return cudnn_gate;
+    }
+
+    void convert_weights(cudnnHandle_t handle, cudaStream_t stream,
+            void *weight_space, const void *wei_layer, const void *wei_iter,
+            const void *bias_ptr) const {
+        const float one = 1.f, zero = 0.f;
+        const int bias_gates = G_ + is_lbr_;
+        const size_t bias_size = DHC_ * sizeof(float);
+
+        for (int pseudo_layer = 0; pseudo_layer < L_ * D_; pseudo_layer++) {
+            for (int lin_id = 0; lin_id < 2 * G_; lin_id++) {
+                const int is_iter = lin_id >= G_;
+                const int gate = dnnl_gate(lin_id % G_);
+                void *m_addr = nullptr;
+                void *b_addr = nullptr;
+                CUDNN_EXECUTE_FUNC(cudnnGetRNNWeightParams, handle, rnn_desc_,
+                        pseudo_layer, weight_space_size_, weight_space, lin_id,
+                        m_desc_, &m_addr, b_desc_, &b_addr);
+
+                const int ic = is_iter ? DHC_ : SLC_;
+                const float *wei = static_cast<const float *>(
+                                           is_iter ? wei_iter : wei_layer)
+                        + ((size_t)pseudo_layer * ic * G_ + gate) * DHC_;
+                CUDNN_EXECUTE_FUNC(cudnnTransformTensor, handle, &one,
+                        wei_src_desc_[is_iter], wei, &zero,
+                        wei_dst_desc_[is_iter], m_addr);
+
+                if (!b_addr) continue;
+                // With the double bias, only the candidate gate has a
+                // recurrent bias in oneDNN. It is stored after the G gates.
+                if (is_iter && gate != 2) {
+                    CUDA_EXECUTE_FUNC(cuMemsetD32Async, (CUdeviceptr)b_addr, 0,
+                            DHC_, stream);
+                    continue;
+                }
+                const int bias_gate = is_iter ? G_ : gate;
+                const float *b = static_cast<const float *>(bias_ptr)
+                        + ((size_t)pseudo_layer * bias_gates + bias_gate)
+                                * DHC_;
+                CUDA_EXECUTE_FUNC(cuMemcpyDtoDAsync, (CUdeviceptr)b_addr,
+                        (CUdeviceptr)b, bias_size, stream);
+            }
+        }
+    }
+
+    int T_, N_, L_, D_, SLC_, DHC_, DLC_, G_;
+    bool is_lbr_ = false;
+    bool with_bias_ = false;
+
+    cudnnRNNDescriptor_t rnn_desc_ = nullptr;
+    cudnnDropoutDescriptor_t dropout_desc_ = nullptr;
+    cudnnRNNDataDescriptor_t x_desc_ = nullptr;
+    cudnnRNNDataDescriptor_t y_desc_ = nullptr;
+    cudnnTensorDescriptor_t h_desc_ = nullptr;
+    // filled by cudnnGetRNNWeightParams()
+    cudnnTensorDescriptor_t m_desc_ = nullptr;
+    cudnnTensorDescriptor_t b_desc_ = nullptr;
+    // [0] for weights_layer, [1] for weights_iter
+    cudnnTensorDescriptor_t wei_src_desc_[2] = {};
+    cudnnTensorDescriptor_t wei_dst_desc_[2] = {};
+
+    size_t weight_space_size_ = 0;
+    size_t temp_space_size_ = 0;
+    size_t temp_space_offset_ = 0;
+    size_t seq_lengths_offset_ = 0;
+};
+
+} // namespace nvidia
+} // namespace gpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
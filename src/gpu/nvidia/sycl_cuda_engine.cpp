@@ -30,6 +30,7 @@
 #include "gpu/nvidia/cudnn_matmul.hpp"
 #include "gpu/nvidia/cudnn_pooling.hpp"
 #include "gpu/nvidia/cudnn_resampling.hpp"
+#include "gpu/nvidia/cudnn_rnn.hpp"
 #include "gpu/nvidia/cudnn_softmax.hpp"
 #include "gpu/nvidia/sycl_cuda_engine.hpp"
 #include "gpu/nvidia/sycl_cuda_scoped_context.hpp"
@@ -183,6 +184,9 @@ const dnnl::impl::engine_t::primitive_desc_create_f sycl_cuda_impl_list[] = {
         // Resampling
         INSTANCE(cudnn_resampling_fwd_t),
         INSTANCE(cudnn_resampling_bwd_t),
+
+        // RNN
+        INSTANCE(cudnn_rnn_fwd_t),
         nullptr,
 };
 // clang-format on
@@ -26,6 +26,7 @@
 #include "dnnl_sycl.hpp"
 
 #include "common/engine.hpp"
+#include "common/utils.hpp"
 #include "common/z_magic.hpp"
 
 namespace dnnl {
@@ -58,6 +59,17 @@ inline status_t check_device(dnnl::impl::engine_kind_t eng_kind) {
                     : status::invalid_arguments);
 }
 
+// TF32 tensor cores trade the f32 mantissa precision for throughput, so f32
+// computations use them only when DNNL_CUDA_ALLOW_TF32 is set.
+inline bool tf32_allowed() {
+#if CUDA_VERSION >= 11000
+    static const bool allowed = getenv_int("DNNL_CUDA_ALLOW_TF32", 0) != 0;
+    return allowed;
+#else
+    return false;
+#endif
+}
+
 static void convert_dnnl_dims_array(
         const dnnl_dim_t *dims, int *new_dims, int n_dims) {
     for (size_t i = 0; i < n_dims; i++) {
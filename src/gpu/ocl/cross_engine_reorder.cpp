@@ -17,6 +17,8 @@
 #include "gpu/ocl/cross_engine_reorder.hpp"
 
 #include "common/utils.hpp"
+#include "gpu/ocl/ocl_gpu_engine.hpp"
+#include "gpu/ocl/ocl_memory_storage.hpp"
 #include "gpu/ocl/ocl_stream.hpp"
 #include "gpu/ocl/ocl_utils.hpp"
 
@@ -25,16 +27,31 @@ namespace impl {
 namespace gpu {
 namespace ocl {
 
+namespace {
+// Integrated GPUs access the host memory directly, so wrapping it into an
+// OpenCL buffer does not copy the data.
+bool has_host_unified_memory(engine_t *engine) {
+    if (engine->runtime_kind() != runtime_kind::ocl) return false;
+    auto *ocl_engine = utils::downcast<ocl_gpu_engine_t *>(engine);
+    cl_bool unified = CL_FALSE;
+    cl_int err = clGetDeviceInfo(ocl_engine->device(),
+            CL_DEVICE_HOST_UNIFIED_MEMORY, sizeof(unified), &unified, nullptr);
+    return err == CL_SUCCESS && unified == CL_TRUE;
+}
+} // namespace
+
 void cross_engine_reorder_t::pd_t::init_scratchpad() {
     using namespace memory_tracking::names;
     if (!do_reorder_) return;
 
-    const memory_desc_wrapper wspace_md(
-            desc()->src_engine_kind == reorder_engine_kind_ ? dst_md()
-                                                            : src_md());
     auto scratchpad = scratchpad_registry().registrar();
-    scratchpad.book(memory_tracking::names::key_reorder_cross_space,
-            wspace_md.size(), 1, OCL_BUFFER_ALIGNMENT);
+    if (!use_zero_copy_) {
+        const memory_desc_wrapper wspace_md(
+                desc()->src_engine_kind == reorder_engine_kind_ ? dst_md()
+                                                                : src_md());
+        scratchpad.book(memory_tracking::names::key_reorder_cross_space,
+                wspace_md.size(), 1, OCL_BUFFER_ALIGNMENT);
+    }
     scratchpad.book(key_nested, reorder_pd_->scratchpad_registry().size(), 1,
             OCL_BUFFER_ALIGNMENT);
 }
@@ -55,6 +72,17 @@ status_t cross_engine_reorder_t::pd_t::init(
 
     engine_t *reorder_engine
             = src_engine->kind() == engine_kind::gpu ? src_engine : dst_engine;
+    engine_t *host_engine
+            = src_engine->kind() == engine_kind::gpu ? dst_engine : src_engine;
+
+    // The host side of the reorder must be plain host memory of a known
+    // size to be wrapped.
+    const memory_desc_wrapper host_mdw(
+            host_engine == src_engine ? src_md() : dst_md());
+    use_zero_copy_ = do_reorder_ && host_engine->kind() == engine_kind::cpu
+            && is_native_runtime(host_engine->runtime_kind())
+            && host_mdw.size() != 0 && !host_mdw.has_runtime_dims_or_strides()
+            && has_host_unified_memory(reorder_engine);
 
     auto r_impls = reorder_engine->get_reorder_implementation_list(
             src_md(), dst_md());
@@ -79,6 +107,8 @@ status_t cross_engine_reorder_t::pd_t::init(
 
 status_t cross_engine_reorder_t::execute(const exec_ctx_t &ctx) const {
     using namespace memory_tracking::names;
+    if (pd()->use_zero_copy_) return execute_zero_copy(ctx);
+
     auto *compute_stream
             = utils::downcast<compute::compute_stream_t *>(ctx.stream());
 
@@ -144,6 +174,58 @@ status_t cross_engine_reorder_t::execute(const exec_ctx_t &ctx) const {
     return status;
 }
 
+status_t cross_engine_reorder_t::execute_zero_copy(
+        const exec_ctx_t &ctx) const {
+    using namespace memory_tracking::names;
+    const bool is_host_src = pd()->desc()->src_engine_kind == engine_kind::cpu;
+    const memory_desc_t *host_md
+            = is_host_src ? pd()->src_md() : pd()->dst_md();
+    const size_t host_size = memory_desc_wrapper(host_md).size();
+    void *host_ptr = is_host_src ? CTX_IN_STORAGE(DNNL_ARG_FROM).data_handle()
+                                 : CTX_OUT_STORAGE(DNNL_ARG_TO).data_handle();
+
+    // The buffer is released after the execution, OpenCL keeps the memory
+    // object alive until the enqueued kernels using it complete.
+    auto *ocl_engine
+            = utils::downcast<ocl_gpu_engine_t *>(ctx.stream()->engine());
+    cl_int err;
+    ocl_wrapper_t<cl_mem> host_buffer(clCreateBuffer(ocl_engine->context(),
+            CL_MEM_USE_HOST_PTR
+                    | (is_host_src ? CL_MEM_READ_ONLY : CL_MEM_READ_WRITE),
+            host_size, host_ptr, &err));
+    OCL_CHECK(err);
+
+    memory_storage_t *host_storage_ptr = nullptr;
+    CHECK(ocl_engine->create_memory_storage(&host_storage_ptr,
+            memory_flags_t::use_runtime_ptr, host_size, host_buffer.get()));
+    std::unique_ptr<memory_storage_t> host_storage(host_storage_ptr);
+    const memory_storage_t &host_storage_ref = *host_storage;
+    std::unique_ptr<memory_t> host_mem;
+    CHECK(safe_ptr_assign(host_mem,
+            new memory_t(ocl_engine, host_md, std::move(host_storage),
+                    /* do_zero_pad = */ false)));
+
+    exec_args_t r_args;
+    r_args[DNNL_ARG_SRC] = memory_arg_t {is_host_src
+                    ? host_mem.get()
+                    : const_cast<memory_t *>(ctx.input(DNNL_ARG_FROM)),
+            true};
+    r_args[DNNL_ARG_DST] = memory_arg_t {
+            is_host_src ? ctx.output(DNNL_ARG_TO) : host_mem.get(), false};
+    exec_ctx_t r_ctx(ctx, std::move(r_args));
+
+    nested_scratchpad_t ns(ctx, key_nested, reorder_);
+    r_ctx.set_scratchpad_grantor(ns.grantor());
+    CHECK(reorder_->execute(r_ctx));
+    if (is_host_src) return status::success;
+
+    // Mapping is the synchronization point that makes the results visible
+    // in the host memory, it does not copy for the USE_HOST_PTR buffers.
+    void *mapped_ptr = nullptr;
+    CHECK(host_storage_ref.map_data(&mapped_ptr, ctx.stream(), host_size));
+    return host_storage_ref.unmap_data(mapped_ptr, ctx.stream());
+}
+
 } // namespace ocl
 } // namespace gpu
 } // namespace impl
@@ -39,6 +39,10 @@ namespace ocl {
 // For GPU -> CPU reorder, it includes 2 steps:
 // 1. GPU reorder
 // 2. GPU -> CPU copying
+//
+// On OpenCL devices sharing the memory with the host the copying is skipped:
+// the CPU memory is wrapped into a CL_MEM_USE_HOST_PTR buffer and the GPU
+// reorder accesses it directly.
 struct cross_engine_reorder_t : public gpu_primitive_t {
     struct pd_t : public reorder_pd_t {
         using reorder_pd_t::reorder_pd_t;
@@ -47,7 +51,8 @@ struct cross_engine_reorder_t : public gpu_primitive_t {
             : reorder_pd_t(rhs)
             , reorder_pd_(rhs.do_reorder_ ? rhs.reorder_pd_->clone() : nullptr)
             , reorder_engine_kind_(rhs.reorder_engine_kind_)
-            , do_reorder_(rhs.do_reorder_) {}
+            , do_reorder_(rhs.do_reorder_)
+            , use_zero_copy_(rhs.use_zero_copy_) {}
 
         DECLARE_COMMON_PD_T("ocl:cross_engine::any", cross_engine_reorder_t);
 
@@ -59,6 +64,7 @@ struct cross_engine_reorder_t : public gpu_primitive_t {
         std::unique_ptr<primitive_desc_t> reorder_pd_;
         engine_kind_t reorder_engine_kind_ = engine_kind::gpu;
         bool do_reorder_ = true;
+        bool use_zero_copy_ = false;
 
     private:
         void init_scratchpad();
@@ -80,6 +86,7 @@ protected:
     }
 
 private:
+    status_t execute_zero_copy(const exec_ctx_t &ctx) const;
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
     std::shared_ptr<primitive_t> reorder_;
 };
@@ -0,0 +1,123 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "gpu/ocl/gemm_1x1_convolution.hpp"
+
+#include "common/memory_desc_wrapper.hpp"
+#include "gpu/gemm/gpu_gemm_utils.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace gpu {
+namespace ocl {
+
+bool gemm_1x1_convolution_fwd_t::pd_t::shape_ok() const {
+    return !with_groups() && KD() == 1 && KH() == 1 && KW() == 1
+            && KSD() == 1 && KSH() == 1 && KSW() == 1 && padFront() == 0
+            && padBack() == 0 && padT() == 0 && padB() == 0 && padL() == 0
+            && padR() == 0;
+}
+
+bool gemm_1x1_convolution_fwd_t::pd_t::formats_ok() const {
+    using namespace format_tag;
+    const memory_desc_wrapper src_d(src_md()), wei_d(weights_md()),
+            dst_d(dst_md());
+    // The layouts are taken as set by the user only, so that this
+    // implementation does not change the formats chosen for `any`
+    if (src_d.format_any() || wei_d.format_any() || dst_d.format_any())
+        return false;
+
+    const int nd = ndims();
+    const auto act_tag = utils::pick(nd - 3, nwc, nhwc, ndhwc);
+    const auto wei_tag = utils::pick(nd - 3, oiw, oihw, oidhw);
+    return src_d.matches_tag(act_tag) && dst_d.matches_tag(act_tag)
+            && wei_d.matches_tag(wei_tag);
+}
+
+status_t gemm_1x1_convolution_fwd_t::pd_t::init(engine_t *engine) {
+    using namespace data_type;
+    using smask_t = primitive_attr_t::skip_mask_t;
+
+    assert(engine->kind() == engine_kind::gpu);
+
+    const auto src_dt = invariant_src_md()->data_type;
+    // Output scales and post-ops are validated by the nested GEMM
+    bool ok = is_fwd() && set_default_alg_kind(alg_kind::convolution_direct)
+            && desc()->alg_kind == alg_kind::convolution_direct
+            && !has_zero_dim_memory()
+            && utils::one_of(true, expect_data_types(f32, f32, f32, f32, f32),
+                    expect_data_types(f16, f16, f16, f16, f16),
+                    utils::one_of(src_dt, u8, s8)
+                            && expect_data_types(
+                                    src_dt, s8, data_type::undef, s32, s32))
+            && attr()->has_default_values(
+                    smask_t::oscale | smask_t::post_ops, dst_md()->data_type)
+            && shape_ok() && formats_ok();
+    if (!ok) return status::unimplemented;
+
+    const dim_t M = MB() * OD() * OH() * OW();
+    memory_desc_t a_md, b_md, c_md;
+    {
+        const dims_t dims = {M, IC()}, strides = {IC(), 1};
+        CHECK(dnnl_memory_desc_init_by_strides(
+                &a_md, 2, dims, src_md()->data_type, strides));
+    }
+    {
+        // [OC, IC] weights as the transposed [IC, OC] matrix
+        const dims_t dims = {IC(), OC()}, strides = {1, IC()};
+        CHECK(dnnl_memory_desc_init_by_strides(
+                &b_md, 2, dims, weights_md()->data_type, strides));
+    }
+    {
+        const dims_t dims = {M, OC()}, strides = {OC(), 1};
+        CHECK(dnnl_memory_desc_init_by_strides(
+                &c_md, 2, dims, dst_md()->data_type, strides));
+    }
+
+    // Reference GEMM is slower than the direct convolution kernels
+    if (create_gemm_pd(gemm_pd_, engine, &a_md, &b_md, &c_md, weights_md(1),
+                desc()->accum_data_type, attr(), /* skip_ref = */ true)
+            != status::success)
+        return status::unimplemented;
+
+    init_scratchpad();
+    return status::success;
+}
+
+status_t gemm_1x1_convolution_fwd_t::execute_forward(
+        const exec_ctx_t &ctx) const {
+    using namespace memory_tracking::names;
+    using namespace gemm_utils;
+
+    gemm_exec_args_t gemm_args;
+    gemm_args.a = &CTX_IN_STORAGE(DNNL_ARG_SRC);
+    gemm_args.b = &CTX_IN_STORAGE(DNNL_ARG_WEIGHTS);
+    gemm_args.c = &CTX_OUT_STORAGE(DNNL_ARG_DST);
+    gemm_args.bias = &CTX_IN_STORAGE(DNNL_ARG_BIAS);
+    gemm_args.output_scales = &CTX_IN_STORAGE(DNNL_ARG_ATTR_OUTPUT_SCALES);
+
+    gemm_exec_ctx_t gemm_ctx(ctx, gemm_args);
+
+    nested_scratchpad_t ns(ctx, key_nested, gemm_);
+    gemm_ctx.set_scratchpad_grantor(ns.grantor());
+
+    return gpu_gemm(gemm_)->execute(gemm_ctx);
+}
+
+} // namespace ocl
+} // namespace gpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,95 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef GPU_OCL_GEMM_1X1_CONVOLUTION_HPP
+#define GPU_OCL_GEMM_1X1_CONVOLUTION_HPP
+
+#include <assert.h>
+
+#include "common/c_types_map.hpp"
+#include "common/gemm_utils.hpp"
+#include "common/primitive.hpp"
+#include "common/primitive_iterator.hpp"
+#include "gpu/compute/compute.hpp"
+#include "gpu/gemm/gpu_gemm.hpp"
+#include "gpu/gpu_convolution_pd.hpp"
+#include "gpu/gpu_primitive.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace gpu {
+namespace ocl {
+
+// Forward 1x1 convolution with unit strides and no padding in the channels
+// last layouts, which is exactly a GEMM of the [MB * spatial, IC] source by
+// the transposed [OC, IC] weights. The nested GEMM dispatches to the nGEN
+// kernels on Gen9 and Gen12LP, so no OpenCL C is compiled for the
+// convolution itself.
+struct gemm_1x1_convolution_fwd_t : public gpu_primitive_t {
+    struct pd_t : public gpu_convolution_fwd_pd_t {
+        pd_t(const convolution_desc_t *adesc, const primitive_attr_t *attr,
+                const convolution_fwd_pd_t *hint_fwd_pd)
+            : gpu_convolution_fwd_pd_t(adesc, attr, hint_fwd_pd) {}
+        pd_t(const pd_t &rhs) : gpu_convolution_fwd_pd_t(rhs) {
+            gemm_pd_.reset(rhs.gemm_pd_->clone());
+        }
+        ~pd_t() = default;
+
+        DECLARE_COMMON_PD_T("ocl:gemm_1x1", gemm_1x1_convolution_fwd_t);
+
+        status_t init(engine_t *engine);
+
+        std::unique_ptr<primitive_desc_t> gemm_pd_;
+
+    private:
+        bool shape_ok() const;
+        bool formats_ok() const;
+
+        void init_scratchpad() {
+            auto scratchpad = scratchpad_registry().registrar();
+            scratchpad.book(memory_tracking::names::key_nested,
+                    gemm_pd_->scratchpad_registry());
+        }
+    };
+
+    gemm_1x1_convolution_fwd_t(const pd_t *apd) : gpu_primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override {
+        return pd()->gemm_pd_->create_primitive(gemm_, engine);
+    }
+
+    status_t execute(const exec_ctx_t &ctx) const override {
+        return execute_forward(ctx);
+    }
+
+protected:
+    primitive_list_t nested_primitives() const override {
+        return {gemm_.get()};
+    }
+
+private:
+    status_t execute_forward(const exec_ctx_t &ctx) const;
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    std::shared_ptr<primitive_t> gemm_;
+};
+
+} // namespace ocl
+} // namespace gpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -15,6 +15,7 @@
 *******************************************************************************/
 
 #include "gpu/ocl/ocl_math_utils.h"
+#include "gpu/ocl/ocl_post_ops.h"
 #include "gpu/ocl/ocl_types.h"
 
 #define BLOCK_READ_DST(data, idx) \
@@ -27,10 +28,26 @@
 #define BLOCK_READ_BIA(data, idx) \
     data = as_float4(intel_sub_group_block_read4((__global uint *)&bias[idx]));
 
+#define BLOCK_READ_SCALES(data, idx) \
+    data = as_float4(intel_sub_group_block_read4( \
+            (__global uint *)&scales_per_oc[idx]));
+
+#define BLOCK_READ_SUM16(ptr) \
+    intel_sub_group_block_read_uc16((__global uchar *)(ptr))
+
+#if SCALES_PER_OC
+#define SCALE scales
+#elif SCALES_COMMON
+#define SCALE scale
+#else
+#define SCALE 1
+#endif
+
 __attribute__((intel_reqd_sub_group_size(SUB_GROUP_SIZE)))
 __attribute__((reqd_work_group_size(LWS_0, LWS_1, LWS_2))) __kernel void
-conv_bwd_data_x8s8s32x(const __global uchar *src, const __global char *wei,
-        const __global float *bias, __global DATA_T *dst) {
+conv_bwd_data_x8s8s32x(__global uchar *src, const __global char *wei,
+        const __global float *bias, __global DATA_T *dst POST_OP_ARGS,
+        float scale, const __global float *scales_per_oc) {
 
     const int mb_blocks = 2;
 
@@ -133,56 +150,64 @@ conv_bwd_data_x8s8s32x(const __global uchar *src, const __global char *wei,
         dst += OC_BLOCK * MB_BLOCK * OD * OH * OW;
     }
 
-#if WITH_BIAS
-#define BIAS_SUM_RELU(RES, TMP, ACC, BIA, DST) \
-    TMP = (float)ACC + BIA; \
-    RES = TO_SRC(TMP);
-#else // WITH_BIAS
-#define BIAS_SUM_RELU(RES, TMP, ACC, BIA, DST) RES = TO_SRC((float)ACC);
-#endif // WITH_BIAS
-
-#define PACK(idx) \
-    BIAS_SUM_RELU(D00[0], T00, C00[idx], b0, S00[0]); \
-    BIAS_SUM_RELU(D00[1], T01, C01[idx], b1, S00[1]); \
-    BIAS_SUM_RELU(D00[2], T02, C02[idx], b2, S00[2]); \
-    BIAS_SUM_RELU(D00[3], T03, C03[idx], b3, S00[3]); \
-    T0[idx] = as_uint(D00); \
-    BIAS_SUM_RELU(D01[0], T10, C10[idx], b0, S01[0]); \
-    BIAS_SUM_RELU(D01[1], T11, C11[idx], b1, S01[1]); \
-    BIAS_SUM_RELU(D01[2], T12, C12[idx], b2, S01[2]); \
-    BIAS_SUM_RELU(D01[3], T13, C13[idx], b3, S01[3]); \
-    T1[idx] = as_uint(D01);
+#if SCALES_PER_OC
+    float4 scales;
+    BLOCK_READ_SCALES(scales, (group_ic + ic) * IC_BLOCK);
+#endif
 
 #if WITH_BIAS
     float4 bia;
     BLOCK_READ_BIA(bia, (group_ic + ic) * IC_BLOCK);
-    float b0 = bia[0];
-    float b1 = bia[1];
-    float b2 = bia[2];
-    float b3 = bia[3];
-#endif // WITH_BIAS
-
-    uchar4 D00, D01;
-    uint8 T0, T1;
-    float T00, T01, T02, T03;
-    float T10, T11, T12, T13;
-    PACK(0);
-    PACK(1);
-    PACK(2);
-    PACK(3);
-    PACK(4);
-    PACK(5);
-    PACK(6);
-    PACK(7);
-
-    intel_sub_group_block_write_uc16(
-            (__global uchar *)&src[0 * IC_BLOCK], as_uchar16(T0.s0123));
-    intel_sub_group_block_write_uc16(
-            (__global uchar *)&src[4 * IC_BLOCK], as_uchar16(T0.s4567));
+    bia *= SCALE;
+#define QUANTIZE_ADD_BIAS() tmp = fma(tmp, (float4)SCALE, bia);
+#else
+#define QUANTIZE_ADD_BIAS() tmp *= SCALE;
+#endif
+
+    uchar4 S0[8], S1[8];
+#if WITH_SUM
+    *(uchar16 *)(S0 + 0) = BLOCK_READ_SUM16(&src[0 * IC_BLOCK]);
+    *(uchar16 *)(S0 + 4) = BLOCK_READ_SUM16(&src[4 * IC_BLOCK]);
+#if MB > 8
+    *(uchar16 *)(S1 + 0) = BLOCK_READ_SUM16(&src[8 * IC_BLOCK]);
+    *(uchar16 *)(S1 + 4) = BLOCK_READ_SUM16(&src[12 * IC_BLOCK]);
+#endif // MB > 8
+#endif // WITH_SUM
+
+    const int ocl_local_id = get_sub_group_local_id();
+    float4 tmp;
+    SRC_DATA4_T src_pack[8];
+
+#define STORE_SRC(C0, C1, C2, C3, S, mb_stride) \
+    do { \
+        for (int n_i = 0; n_i < 8; n_i++) { \
+            tmp[0] = C0[n_i]; \
+            tmp[1] = C1[n_i]; \
+            tmp[2] = C2[n_i]; \
+            tmp[3] = C3[n_i]; \
+            QUANTIZE_ADD_BIAS(); \
+            const int po_mb = (group_mb * MB_BLOCK + mb * MB_BLOCK / mb_blocks \
+                                      + mb_stride + n_i) \
+                    % MB; \
+            const int po_ic = (group_ic + ic) * IC_BLOCK; \
+            float4 sni = convert_float4(SUM_TO_REF(AS_SUM_DATA4_T(S[n_i]))); \
+            APPLY_POST_OPS_TRY_BURST(tmp, float, sni, float, po_mb, 1, po_ic, \
+                    4 * SUB_GROUP_SIZE, ocl_local_id); \
+            src_pack[n_i][0] = TO_SRC(tmp[0]); \
+            src_pack[n_i][1] = TO_SRC(tmp[1]); \
+            src_pack[n_i][2] = TO_SRC(tmp[2]); \
+            src_pack[n_i][3] = TO_SRC(tmp[3]); \
+        } \
+        intel_sub_group_block_write_uc16( \
+                (__global uchar *)&src[mb_stride * IC_BLOCK], \
+                as_uchar16(*(SRC_DATA16_T *)src_pack)); \
+        intel_sub_group_block_write_uc16( \
+                (__global uchar *)&src[(mb_stride + 4) * IC_BLOCK], \
+                as_uchar16(*(SRC_DATA16_T *)(src_pack + 4))); \
+    } while (0)
+
+    STORE_SRC(C00, C01, C02, C03, S0, 0);
 #if MB > 8
-    intel_sub_group_block_write_uc16(
-            (__global uchar *)&src[8 * IC_BLOCK], as_uchar16(T1.s0123));
-    intel_sub_group_block_write_uc16(
-            (__global uchar *)&src[12 * IC_BLOCK], as_uchar16(T1.s4567));
+    STORE_SRC(C10, C11, C12, C13, S1, 8);
 #endif // MB > 8
 }
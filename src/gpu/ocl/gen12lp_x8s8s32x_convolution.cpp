@@ -628,6 +628,10 @@ status_t gen12lp_x8s8s32x_convolution_bwd_data_t::pd_t::init_conf() {
             || conf.dst_tag != dst_tag)
         return status::unimplemented;
 
+    // Per-channel scales are read in full blocks of IC_BLOCK channels.
+    if (conf.attr_info.with_per_oc_oscales && conf.ic % conf.ic_block != 0)
+        return status::unimplemented;
+
     return status;
 }
 
@@ -670,6 +674,7 @@ status_t gen12lp_x8s8s32x_convolution_bwd_data_t::pd_t::init_kernel_ctx(
     kernel_ctx.define_int("IC_NCHUNK", utils::div_up(conf.ic, conf.ic_block));
 
     kernel_ctx.define_int("WITH_BIAS", conf.with_bias);
+    def_attr_info(kernel_ctx, conf.attr_info);
 
     kernel_ctx.define_int("SUB_GROUP_SIZE", conf.sub_group_size);
     kernel_ctx.define_int("LWS_0", conf.lws_d[0]);
@@ -678,6 +683,11 @@ status_t gen12lp_x8s8s32x_convolution_bwd_data_t::pd_t::init_kernel_ctx(
 
     kernel_ctx.set_data_type(conf.dst_data_type);
     def_data_type(kernel_ctx, conf.src_data_type, "SRC");
+    def_data_type(kernel_ctx,
+            conf.attr_info.sum_data_type == dnnl_data_type_undef
+                    ? conf.src_data_type
+                    : conf.attr_info.sum_data_type,
+            "SUM");
     kernel_ctx.add_option("-Dcl_intel_subgroups_char");
 
     return status::success;
@@ -689,6 +699,7 @@ status_t gen12lp_x8s8s32x_convolution_bwd_data_t::execute_backward_data(
     auto &diff_dst = CTX_IN_STORAGE(DNNL_ARG_DIFF_DST);
     auto &weights = CTX_IN_STORAGE(DNNL_ARG_WEIGHTS);
     auto &bias = CTX_IN_STORAGE(DNNL_ARG_BIAS);
+    auto &oscales = CTX_IN_STORAGE(DNNL_ARG_ATTR_OUTPUT_SCALES);
     auto &diff_src = CTX_OUT_STORAGE(DNNL_ARG_DIFF_SRC);
 
     const auto &conf = pd()->conf;
@@ -699,9 +710,31 @@ status_t gen12lp_x8s8s32x_convolution_bwd_data_t::execute_backward_data(
     arg_list.set(2, bias);
     arg_list.set(3, diff_dst);
 
+    unsigned arg_idx = append_post_ops_to_arg_list(
+            ctx, arg_list, 4, conf.attr_info.all_post_ops);
+
+    if (conf.attr_info.common_oscales) {
+        float scales = pd()->attr()->output_scales_.scales_[0];
+        arg_list.set(arg_idx++, scales);
+    } else {
+        arg_list.set(arg_idx++, 1.0f);
+    }
+
+    if (conf.attr_info.with_per_oc_oscales) {
+        if (conf.attr_info.with_runtime_oscales)
+            arg_list.set(arg_idx++, oscales);
+        else
+            arg_list.set(arg_idx++, CTX_GPU_RES_STORAGE(SCALES_));
+    } else {
+        arg_list.set(arg_idx++, memory_storage_t::empty_storage());
+    }
+
     auto nd_range = compute::nd_range_t(conf.gws_d, conf.lws_d);
     status_t status = parallel_for(ctx, nd_range, kernel_, arg_list);
 
+    if (!post_ops_preserves_zeroes(ctx, conf.attr_info.all_post_ops)) {
+        ctx.memory(DNNL_ARG_DIFF_SRC)->zero_pad(ctx.stream());
+    }
     return status;
 }
 
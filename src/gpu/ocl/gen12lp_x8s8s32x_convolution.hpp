@@ -208,6 +208,11 @@ struct gen12lp_x8s8s32x_convolution_bwd_data_t : public gpu_primitive_t {
             auto *compute_engine
                     = utils::downcast<compute::compute_engine_t *>(engine);
 
+            const auto attr_skip_mask
+                    = primitive_attr_t::skip_mask_t::oscale_runtime
+                    | primitive_attr_t::skip_mask_t::post_ops
+                    | primitive_attr_t::skip_mask_t::sum_dt;
+
             bool ok = true
                     && utils::one_of(desc()->diff_src_desc.data_type, s8, u8)
                     && utils::one_of(desc()->diff_dst_desc.data_type, s8, u8)
@@ -217,13 +222,22 @@ struct gen12lp_x8s8s32x_convolution_bwd_data_t : public gpu_primitive_t {
                     && desc()->alg_kind == alg_kind::convolution_direct
                     && compute_engine->mayiuse(
                             compute::device_ext_t::intel_subgroups)
-                    && attr()->has_default_values();
+                    && attr()->has_default_values(
+                            attr_skip_mask, desc()->diff_src_desc.data_type)
+                    && post_ops_with_binary_ok(
+                            attr(), desc()->diff_src_desc.data_type)
+                    && IMPLICATION(!attr()->output_scales_.has_default_values(),
+                            utils::one_of(
+                                    attr()->output_scales_.mask_, 0, 1 << 1));
 
             if (!ok) return status::unimplemented;
 
             status_t status = init_conf();
             if (status != status::success) return status;
 
+            auto scales_status = init_scales_md();
+            if (scales_status != status::success) return scales_status;
+
             ok = set_default_formats_common(
                     conf.src_tag, conf.wei_tag, conf.dst_tag);
             return ok ? status::success : status::unimplemented;
@@ -232,9 +246,23 @@ struct gen12lp_x8s8s32x_convolution_bwd_data_t : public gpu_primitive_t {
         status_t init_conf();
         status_t init_kernel_ctx(compute::kernel_ctx_t &kernel_ctx) const;
 
+        bool support_bias() const override { return true; }
+
+        const memory_desc_t *scales_md() const { return &scales_md_; }
+
         conv_conf_t conf;
 
-        bool support_bias() const override { return true; }
+    private:
+        status_t init_scales_md() {
+            if (!conf.attr_info.with_per_oc_oscales) return status::success;
+
+            scales_md_.data_type = data_type::f32;
+            scales_md_.ndims = 1;
+            scales_md_.dims[0] = attr()->output_scales_.count_;
+            return memory_desc_init_by_tag(scales_md_, format_tag::x);
+        }
+
+        memory_desc_t scales_md_;
     };
 
     status_t init(engine_t *engine) override {
@@ -256,10 +284,35 @@ struct gen12lp_x8s8s32x_convolution_bwd_data_t : public gpu_primitive_t {
         return execute_backward_data(ctx);
     }
 
+protected:
+    status_t init_res_storage(
+            engine_t *engine, gpu_resource_t *r) const override {
+        if (!pd()->conf.attr_info.with_per_oc_oscales
+                || pd()->conf.attr_info.with_runtime_oscales)
+            return status::success;
+
+        memory_desc_wrapper scales_mdw(pd()->scales_md());
+        memory_storage_t *tmp_mem_storage_ptr;
+        CHECK(engine->create_memory_storage(
+                &tmp_mem_storage_ptr, scales_mdw.nelems() * sizeof(float)));
+
+        std::unique_ptr<memory_storage_t> tmp_mem_storage(tmp_mem_storage_ptr);
+        void *scales_ptr = nullptr;
+        CHECK(tmp_mem_storage->map_data(&scales_ptr, nullptr,
+                sizeof(float) * pd()->attr()->output_scales_.count_));
+        utils::array_copy((float *)scales_ptr,
+                pd()->attr()->output_scales_.scales_,
+                pd()->attr()->output_scales_.count_);
+        CHECK(tmp_mem_storage->unmap_data(scales_ptr, nullptr));
+        r->add_memory_storage(SCALES_, std::move(tmp_mem_storage));
+        return status::success;
+    }
+
 private:
     status_t execute_backward_data(const exec_ctx_t &ctx) const;
     const pd_t *pd() const { return (const pd_t *)gpu_primitive_t::pd().get(); }
     compute::kernel_t kernel_;
+    enum { SCALES_ = 0 };
 };
 
 } // namespace ocl
@@ -83,6 +83,7 @@ static status_t init_conf_common(bnorm_conf_t &conf, offsets_t &off,
     conf.fuse_norm_relu = pd->fuse_norm_relu();
     conf.calculate_stats = !pd->stats_is_src();
     conf.with_relu = pd->with_relu_post_op();
+    conf.attr_info = attr_info_t::create(pd->attr());
     conf.eps = bd.batch_norm_epsilon;
     conf.calculate_diff_stats = !pd->use_global_stats();
     conf.diff_scaleshift
@@ -214,6 +215,7 @@ static status_t init_kernel_ctx_common(compute::kernel_ctx_t &kernel_ctx,
         kernel_ctx.add_option("-Dcl_intel_subgroups_char");
 
     def_offsets(off.src_off, kernel_ctx, "SRC", conf.ndims);
+    def_attr_info(kernel_ctx, conf.attr_info);
 
     def_dispatch(kernel_ctx, conf.dispatch_calc_stat);
     def_dispatch(kernel_ctx, conf.dispatch_reduce_stat);
@@ -329,6 +331,7 @@ status_t gen9_batch_normalization_fwd_t::execute_forward(
     arg_list.set(4, scaleshift);
     arg_list.set(5, ws);
     arg_list.set(6, conf.eps);
+    append_post_ops_to_arg_list(ctx, arg_list, 7, conf.attr_info.all_post_ops);
 
     auto nd_range = conf.dispatch.nd_range();
 
@@ -55,8 +55,7 @@ struct gen9_batch_normalization_fwd_t : public gpu_primitive_t {
                     && IMPLICATION(utils::one_of(src_data_t, s8),
                             !is_training() && stats_is_src())
                     && attr()->has_default_values(attr_skip_mask)
-                    && IMPLICATION(!attr()->has_default_values(),
-                            attr()->post_ops_.len() == 1 && with_relu_post_op())
+                    && post_ops_ok()
                     && compute_engine->mayiuse(
                             compute::device_ext_t::intel_subgroups);
             if (!ok) return status::unimplemented;
@@ -70,6 +69,14 @@ struct gen9_batch_normalization_fwd_t : public gpu_primitive_t {
             return status::success;
         }
 
+        // A single eltwise post-op, applied to the normalized values before
+        // the conversion to the destination data type.
+        bool post_ops_ok() const {
+            const auto &po = attr()->post_ops_;
+            return IMPLICATION(po.len() > 0,
+                    po.len() == 1 && po.entry_[0].is_eltwise());
+        }
+
         status_t init_conf(engine_t *engine);
         status_t init_kernel_ctx(compute::kernel_ctx_t &kernel_ctx) const;
         void init_scratchpad();
@@ -16,6 +16,7 @@
 
 #define VECT_DT_N VECT_SIZE
 
+#include "gpu/ocl/ocl_post_ops.h"
 #include "gpu/ocl/ocl_types.h"
 
 #define HAS_STAT_SP_TAIL (STAT_SP_TAIL != STAT_SP_NBLOCKS)
@@ -243,7 +244,8 @@ __kernel void gen9_reduce_variance(
 KERNEL_ATTR
 __kernel void gen9_bnorm_fwd(__global DATA_T *src, __global float *mean,
         __global float *variance, __global DATA_T *dst,
-        __global float *scaleshift, __global int *ws, float eps) {
+        __global float *scaleshift, __global int *ws,
+        float eps POST_OP_ARGS) {
     const int n = GWS_GET_MB();
     const int c = GWS_GET_IC();
     const int sp = GWS_GET_SP() * VECT_SIZE;
@@ -316,6 +318,14 @@ __kernel void gen9_bnorm_fwd(__global DATA_T *src, __global float *mean,
 
 #if WITH_RELU
     blockD0 = max(blockD0, (VECT_FLOAT_T)0.0f);
+#elif WITH_POST_OP
+    for (int k = 0; k < 8; ++k) {
+        POST_OP_DATA_T res = blockD0[k];
+        POST_OP_DATA_T sum_src;
+        APPLY_POST_OPS_SERIAL(
+                res, POST_OP_DATA_T, sum_src, POST_OP_DATA_T, n, 1, c, 1);
+        blockD0[k] = res;
+    }
 #endif
 
 #if HAS_SP_TAIL
@@ -0,0 +1,110 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "gpu/ocl/ocl_types.h"
+
+#undef SRC_OFF
+#undef DST_OFF
+
+#define SRC_OFF(x0, x1, x2, x3, x4, x5) OFF_MD(SRC, x0, x1, x2, x3, x4, x5)
+#define DST_OFF(x0, x1, x2, x3, x4, x5) OFF_MD(DST, x0, x1, x2, x3, x4, x5)
+#define STAT_OFF(x0, x1, x2, x3, x4, x5) OFF_MD(STAT, x0, x1, x2, x3, x4, x5)
+
+// Lane `l` of the sub-group holds elements `l + SUB_GROUP_SIZE * i` of every
+// chunk of SUB_GROUP_SIZE * VECT_SIZE elements of the normalized axis.
+#if VECT_SIZE == 8
+#define VECT_FLOAT_T float8
+#define LOAD_DATA(ptr) \
+    CONVERT_FLOAT8_T( \
+            AS_DATA8_T(BLOCK_READ8((const __global BLOCK_DATA_T *)(ptr))))
+#define STORE_DATA(ptr, val) \
+    BLOCK_WRITE8((__global BLOCK_DATA_T *)(ptr), \
+            AS_BLOCK_DATA8_T(CONVERT_DATA8_T(val)))
+#define LOAD_FLOAT(ptr) \
+    as_float8(intel_sub_group_block_read8((const __global uint *)(ptr)))
+#define VECT_SUM(v) \
+    ((v).s0 + (v).s1 + (v).s2 + (v).s3 + (v).s4 + (v).s5 + (v).s6 + (v).s7)
+#else
+#define VECT_FLOAT_T float
+#define LOAD_DATA(ptr) \
+    CONVERT_FLOAT_T( \
+            AS_DATA_T(BLOCK_READ((const __global BLOCK_DATA_T *)(ptr))))
+#define STORE_DATA(ptr, val) \
+    BLOCK_WRITE((__global BLOCK_DATA_T *)(ptr), \
+            AS_BLOCK_DATA_T(CONVERT_DATA_T(val)))
+#define LOAD_FLOAT(ptr) \
+    as_float(intel_sub_group_block_read((const __global uint *)(ptr)))
+#define VECT_SUM(v) (v)
+#endif
+
+#define CHUNK_SIZE (SUB_GROUP_SIZE * VECT_SIZE)
+#define NUM_CHUNKS (C / CHUNK_SIZE)
+
+__attribute__((reqd_work_group_size(SUB_GROUP_SIZE, 1, 1)))
+__attribute__((intel_reqd_sub_group_size(SUB_GROUP_SIZE))) __kernel void
+gen9_lnorm_fwd(__global DATA_T *src, __global float *mean,
+        __global float *variance, __global DATA_T *dst,
+        __global float *scaleshift, float eps) {
+
+    // One sub-group normalizes one row.
+    int x[6] = {0};
+    x[0] = get_global_id(0) / SUB_GROUP_SIZE;
+    x[1] = get_global_id(1);
+    x[2] = get_global_id(2) / DIM3;
+    x[3] = get_global_id(2) % DIM3;
+
+    const int s_off = STAT_OFF(x[0], x[1], x[2], x[3], x[4], x[5]);
+    src += SRC_OFF(x[0], x[1], x[2], x[3], x[4], x[5]);
+    dst += DST_OFF(x[0], x[1], x[2], x[3], x[4], x[5]);
+
+#if CALCULATE_STATS
+    VECT_FLOAT_T v_sum = 0;
+    for (int k = 0; k < NUM_CHUNKS; ++k)
+        v_sum += LOAD_DATA(&src[k * CHUNK_SIZE]);
+    const float v_mean = sub_group_reduce_add(VECT_SUM(v_sum)) / C;
+
+    VECT_FLOAT_T v_sum_sq = 0;
+    for (int k = 0; k < NUM_CHUNKS; ++k) {
+        VECT_FLOAT_T m = LOAD_DATA(&src[k * CHUNK_SIZE]) - v_mean;
+        v_sum_sq += m * m;
+    }
+    const float v_variance = sub_group_reduce_add(VECT_SUM(v_sum_sq)) / C;
+#else
+    const float v_mean = mean[s_off];
+    const float v_variance = variance[s_off];
+#endif
+
+    const float inv_sqrt_variance = 1.0f / sqrt(v_variance + eps);
+    for (int k = 0; k < NUM_CHUNKS; ++k) {
+#if USE_SCALESHIFT
+        VECT_FLOAT_T sm = LOAD_FLOAT(&scaleshift[k * CHUNK_SIZE])
+                * inv_sqrt_variance;
+        VECT_FLOAT_T sv = LOAD_FLOAT(&scaleshift[C + k * CHUNK_SIZE]);
+#else
+        VECT_FLOAT_T sm = inv_sqrt_variance;
+        VECT_FLOAT_T sv = 0.0f;
+#endif
+        VECT_FLOAT_T v_src = LOAD_DATA(&src[k * CHUNK_SIZE]);
+        STORE_DATA(&dst[k * CHUNK_SIZE], sm * (v_src - v_mean) + sv);
+    }
+
+#if CALCULATE_STATS && SAVE_STATS
+    if (get_sub_group_local_id() == 0) {
+        mean[s_off] = v_mean;
+        variance[s_off] = v_variance;
+    }
+#endif
+}
@@ -0,0 +1,115 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "gpu/ocl/gen9_layer_normalization.hpp"
+
+#include "common/primitive_exec_types.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace gpu {
+namespace ocl {
+
+status_t gen9_layer_normalization_fwd_t::pd_t::init_conf(engine_t *engine) {
+    memory_desc_wrapper src_mdw(src_md());
+    memory_desc_wrapper stat_mdw(stat_md());
+    memory_desc_wrapper dst_mdw(dst_md());
+
+    conf.data_type = src_mdw.data_type();
+    conf.ndims = ndims();
+    conf.norm_axis = norm_axis();
+
+    conf.src_md_info = memory_desc_info_t::create(src_mdw);
+    conf.dst_md_info = memory_desc_info_t::create(dst_mdw);
+    conf.stat_md_info = memory_desc_info_t::create(stat_mdw);
+
+    conf.is_fwd = true;
+    conf.use_scaleshift = use_scaleshift();
+    conf.calculate_stats = !stats_are_src();
+    conf.save_stats = is_training();
+    conf.eps = desc()->layer_norm_epsilon;
+
+    vect_size = conf.norm_axis % (8 * sub_group_size) == 0 ? 8 : 1;
+
+    // The rows are spread over the dimensions preceding the normalized
+    // one, each row is handled by a work-group of a single sub-group.
+    dim_t row_dims[4];
+    for (int i = 0; i < 4; i++)
+        row_dims[i] = i < ndims() - 1 ? src_mdw.dims()[i] : 1;
+    gws[0] = row_dims[0] * sub_group_size;
+    gws[1] = row_dims[1];
+    gws[2] = row_dims[2] * row_dims[3];
+    lws[0] = sub_group_size;
+    lws[1] = lws[2] = 1;
+
+    return status::success;
+}
+
+status_t gen9_layer_normalization_fwd_t::pd_t::init_kernel_ctx(
+        compute::kernel_ctx_t &kernel_ctx) const {
+    kernel_ctx.set_data_type(conf.data_type);
+    kernel_ctx.add_option("-cl-std=CL2.0");
+
+    kernel_ctx.define_int("C", conf.norm_axis);
+    kernel_ctx.define_int("NDIMS", conf.ndims);
+    kernel_ctx.define_int("DIM3", conf.ndims > 4 ? src_md()->dims[3] : 1);
+    kernel_ctx.define_int("SUB_GROUP_SIZE", sub_group_size);
+    kernel_ctx.define_int("VECT_SIZE", vect_size);
+    kernel_ctx.define_int("USE_SCALESHIFT", conf.use_scaleshift);
+    kernel_ctx.define_int("CALCULATE_STATS", conf.calculate_stats);
+    kernel_ctx.define_int("SAVE_STATS", conf.save_stats);
+
+    def_memory_desc_info(kernel_ctx, conf.src_md_info, "SRC");
+    def_memory_desc_info(kernel_ctx, conf.dst_md_info, "DST");
+    def_memory_desc_info(kernel_ctx, conf.stat_md_info, "STAT");
+
+    return status::success;
+}
+
+status_t gen9_layer_normalization_fwd_t::execute_forward(
+        const exec_ctx_t &ctx) const {
+
+    auto &src = CTX_IN_STORAGE(DNNL_ARG_SRC);
+    auto &mean = pd()->stats_are_src() ? CTX_IN_STORAGE(DNNL_ARG_MEAN)
+                                       : CTX_OUT_STORAGE(DNNL_ARG_MEAN);
+
+    auto &variance = pd()->stats_are_src() ? CTX_IN_STORAGE(DNNL_ARG_VARIANCE)
+                                           : CTX_OUT_STORAGE(DNNL_ARG_VARIANCE);
+
+    auto &scaleshift = CTX_IN_STORAGE(DNNL_ARG_SCALE_SHIFT);
+    auto &dst = CTX_OUT_STORAGE(DNNL_ARG_DST);
+
+    const auto &conf = pd()->conf;
+
+    compute::kernel_arg_list_t arg_list;
+    arg_list.set(0, src);
+    arg_list.set(1, mean);
+    arg_list.set(2, variance);
+    arg_list.set(3, dst);
+    arg_list.set(4, scaleshift);
+    arg_list.set(5, conf.eps);
+
+    auto nd_range = compute::nd_range_t(pd()->gws, pd()->lws);
+
+    status_t status = parallel_for(ctx, nd_range, kernel_, arg_list);
+
+    return status;
+}
+
+} // namespace ocl
+} // namespace gpu
+} // namespace impl
+} // namespace dnnl
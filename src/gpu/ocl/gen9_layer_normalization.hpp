@@ -0,0 +1,132 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef GPU_OCL_GEN9_LAYER_NORMALIZATION_HPP
+#define GPU_OCL_GEN9_LAYER_NORMALIZATION_HPP
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+#include "gpu/compute/compute.hpp"
+#include "gpu/gpu_layer_normalization_pd.hpp"
+#include "gpu/gpu_primitive.hpp"
+#include "gpu/gpu_resource.hpp"
+#include "gpu/primitive_conf.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace gpu {
+namespace ocl {
+
+// Every row is normalized by a sub-group with block reads of the normalized
+// axis and sub-group reductions of the statistics. Requires the normalized
+// axis to be dense with a size divisible by the sub-group size.
+struct gen9_layer_normalization_fwd_t : public gpu_primitive_t {
+    struct pd_t : public gpu_layer_normalization_fwd_pd_t {
+        using gpu_layer_normalization_fwd_pd_t::
+                gpu_layer_normalization_fwd_pd_t;
+
+        DECLARE_COMMON_PD_T("ocl:gen9", gen9_layer_normalization_fwd_t);
+
+        status_t init(engine_t *engine) {
+            using namespace data_type;
+            auto *compute_engine
+                    = utils::downcast<compute::compute_engine_t *>(engine);
+
+            auto src_data_t = src_md()->data_type;
+            auto dst_data_t = dst_md()->data_type;
+
+            bool ok = is_fwd() && !fuse_residual_add()
+                    && (utils::everyone_is(f16, src_data_t, dst_data_t)
+                            || utils::everyone_is(bf16, src_data_t, dst_data_t)
+                            || utils::everyone_is(f32, src_data_t, dst_data_t))
+                    && stat_md()->data_type == f32
+                    && check_scale_shift_data_type()
+                    && attr()->has_default_values()
+                    && set_default_formats_common()
+                    && compute_engine->mayiuse(
+                            compute::device_ext_t::intel_subgroups)
+                    && IMPLICATION(utils::one_of(src_data_t, f16, bf16),
+                            compute_engine->mayiuse(compute::device_ext_t::
+                                            intel_subgroups_short))
+                    && IMPLICATION(src_data_t == f16,
+                            compute_engine->mayiuse(
+                                    compute::device_ext_t::khr_fp16))
+                    && !memory_desc_wrapper(src_md()).has_zero_dim()
+                    && norm_axis() % sub_group_size == 0
+                    && is_block_accessible(src_md())
+                    && is_block_accessible(dst_md());
+            if (!ok) return status::unimplemented;
+
+            return init_conf(engine);
+        }
+
+        status_t init_conf(engine_t *engine);
+        status_t init_kernel_ctx(compute::kernel_ctx_t &kernel_ctx) const;
+
+        static constexpr int sub_group_size = 16;
+
+        lnorm_conf_t conf;
+        int vect_size = 1;
+        size_t gws[3] = {};
+        size_t lws[3] = {};
+
+    private:
+        // Sub-group block accesses require the normalized axis to be dense
+        // and every row to be aligned.
+        bool is_block_accessible(const memory_desc_t *md) const {
+            const memory_desc_wrapper mdw(md);
+            if (!mdw.is_plain() || mdw.offset0() != 0) return false;
+            const auto &strides = mdw.blocking_desc().strides;
+            if (strides[ndims() - 1] != 1) return false;
+            for (int d = 0; d < ndims() - 1; d++)
+                if (strides[d] % sub_group_size != 0) return false;
+            return true;
+        }
+    };
+
+    gen9_layer_normalization_fwd_t(const pd_t *apd) : gpu_primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override {
+        compute::kernel_ctx_t kernel_ctx;
+
+        status_t status = pd()->init_kernel_ctx(kernel_ctx);
+        CHECK(status);
+
+        create_kernel(engine, &kernel_, "gen9_lnorm_fwd", kernel_ctx);
+        if (!kernel_) return status::runtime_error;
+
+        return status::success;
+    }
+
+    status_t execute(const exec_ctx_t &ctx) const override {
+        return execute_forward(ctx);
+    }
+
+private:
+    status_t execute_forward(const exec_ctx_t &ctx) const;
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    compute::kernel_t kernel_;
+};
+
+} // namespace ocl
+} // namespace gpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -0,0 +1,139 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#include "gpu/ocl/ocl_types.h"
+
+#if defined(IS_MAX)
+#define INIT_ACC -INFINITY
+#elif defined(IS_MIN)
+#define INIT_ACC INFINITY
+#elif defined(IS_MUL)
+#define INIT_ACC 1.0f
+#else
+#define INIT_ACC 0.0f
+#endif
+
+#if defined(IS_MAX)
+#define ACCUMULATE(x, y) fmax(x, y)
+#elif defined(IS_MIN)
+#define ACCUMULATE(x, y) fmin(x, y)
+#elif defined(IS_MEAN) || defined(IS_SUM)
+#define ACCUMULATE(x, y) (x + y)
+#elif defined(IS_MUL)
+#define ACCUMULATE(x, y) (x * y)
+#else
+#define ACCUMULATE(x, y) (x + pow(fabs(y), POWER))
+#endif
+
+// Combines two partial results of ACCUMULATE.
+#if defined(IS_MAX)
+#define COMBINE(x, y) fmax(x, y)
+#elif defined(IS_MIN)
+#define COMBINE(x, y) fmin(x, y)
+#elif defined(IS_MUL)
+#define COMBINE(x, y) (x * y)
+#else
+#define COMBINE(x, y) (x + y)
+#endif
+
+#if defined(IS_MEAN)
+#define FINALIZE(x) (x / DIV)
+#elif defined(IS_LP_MAX)
+#define FINALIZE(x) rootn(fmax(x, EPS), POWER)
+#elif defined(IS_LP_SUM)
+#define FINALIZE(x) rootn(x + EPS, POWER)
+#elif defined(IS_P_MAX)
+#define FINALIZE(x) fmax(x, EPS)
+#elif defined(IS_P_SUM)
+#define FINALIZE(x) (x + EPS)
+#else
+#define FINALIZE(x) (x)
+#endif
+
+#if !defined(SRC_OFF) && !defined(DST_OFF) && NDIMS == 1
+#define SRC_OFF(n, c, d, h, w) (n)
+#define DST_OFF(n, c, d, h, w) (n)
+#endif
+
+// Coordinates of the destination element `idx` of the dense destination
+// space.
+#define DST_COORDS(idx) \
+    const int w = (idx) % IW; \
+    const int h = ((idx) / IW) % IH; \
+    const int d = ((idx) / (IW * IH)) % ID; \
+    const int c = ((idx) / (IW * IH * ID)) % IC; \
+    const int n = (idx) / (IW * IH * ID * IC);
+
+// Every work-group reduces a chunk of the reduction space of one destination
+// element to a partial result: the work-items accumulate interleaved vectors
+// of the chunk, which are then combined by a tree reduction in local memory.
+__attribute__((reqd_work_group_size(LWS, 1, 1))) __kernel void
+gen9_reduce_initial(__global SRC_DATA_T *src, __global float *partials) {
+    const int dst_idx = get_global_id(1);
+    const int chunk = get_group_id(0);
+    const int lid = get_local_id(0);
+    DST_COORDS(dst_idx);
+
+    const int begin = chunk * CHUNK_SIZE;
+    const int end = min(begin + CHUNK_SIZE, REDUCTION_SIZE);
+
+    float acc = INIT_ACC;
+    for (int r = begin + lid * VECT_SIZE; r < end; r += LWS * VECT_SIZE) {
+        const int w_off = r % REDUCTION_IW;
+        const int h_off = (r / REDUCTION_IW) % REDUCTION_IH;
+        const int d_off = (r / (REDUCTION_IW * REDUCTION_IH)) % REDUCTION_ID;
+        const int c_off = (r / (REDUCTION_IW * REDUCTION_IH * REDUCTION_ID))
+                % REDUCTION_IC;
+        const int n_off = r
+                / (REDUCTION_IW * REDUCTION_IH * REDUCTION_ID * REDUCTION_IC);
+        const int off = SRC_OFF(
+                n + n_off, c + c_off, d + d_off, h + h_off, w + w_off);
+#if VECT_SIZE == 8
+        // The innermost reduced dimension is dense and divisible by the
+        // vector size, so a vector never crosses it.
+        const float8 v = CONVERT_FLOAT8_T(vload8(0, &src[off]));
+        for (int i = 0; i < VECT_SIZE; ++i)
+            acc = ACCUMULATE(acc, v[i]);
+#else
+        acc = ACCUMULATE(acc, CONVERT_FLOAT_T(src[off]));
+#endif
+    }
+
+    __local float local_acc[LWS];
+    local_acc[lid] = acc;
+    barrier(CLK_LOCAL_MEM_FENCE);
+    for (int s = LWS / 2; s > 0; s /= 2) {
+        if (lid < s)
+            local_acc[lid] = COMBINE(local_acc[lid], local_acc[lid + s]);
+        barrier(CLK_LOCAL_MEM_FENCE);
+    }
+
+    if (lid == 0) partials[chunk * DST_NELEMS + dst_idx] = local_acc[0];
+}
+
+__kernel void gen9_reduce_final(
+        __global float *partials, __global DST_DATA_T *dst) {
+    const int dst_idx = get_global_id(0);
+    DST_COORDS(dst_idx);
+
+    float acc = INIT_ACC;
+    for (int k = 0; k < NUM_CHUNKS; ++k)
+        acc = COMBINE(acc, partials[k * DST_NELEMS + dst_idx]);
+
+    acc = FINALIZE(acc);
+    dst[DST_OFF(n, c, d, h, w)] = TO_DST(acc);
+}
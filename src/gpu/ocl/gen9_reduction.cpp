@@ -0,0 +1,212 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#include <math.h>
+
+#include "common/primitive_exec_types.hpp"
+
+#include "gpu/ocl/gen9_reduction.hpp"
+#include "gpu/ocl/ocl_utils.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace gpu {
+namespace ocl {
+
+using namespace dnnl::impl::memory_tracking::names;
+
+status_t gen9_reduction_t::pd_t::init_conf(engine_t *engine) {
+    const reduction_pd_t *pd = this;
+
+    const memory_desc_wrapper src_mdw(pd->src_md());
+    const memory_desc_wrapper dst_mdw(pd->dst_md());
+
+    const int ndims = src_mdw.ndims();
+    const auto src_dims = src_mdw.md_->dims;
+    const auto dst_dims = dst_mdw.md_->dims;
+    const auto *compute_engine
+            = utils::downcast<compute::compute_engine_t *>(engine);
+
+    conf.alg = pd->desc()->alg_kind;
+    conf.src_md_info = memory_desc_info_t::create(src_mdw);
+    conf.dst_md_info = memory_desc_info_t::create(dst_mdw);
+    conf.dst_type = dst_mdw.data_type();
+    conf.src_type = src_mdw.data_type();
+    conf.ndims = ndims;
+    conf.power = pd->desc()->p;
+    conf.eps = pd->desc()->eps;
+    conf.div = 1;
+    conf.reduce_nelems = 1;
+    conf.dst_nelems = 1;
+
+    for (int d = 0; d < ndims; d++) {
+        conf.reduce_dims[d] = conf.dst_dims[d] = dim_t {1};
+        const bool is_reduction_dim = src_dims[d] != dst_dims[d];
+        conf.is_reduction_dim[d] = is_reduction_dim;
+
+        if (is_reduction_dim) {
+            conf.reduce_dims[d] = src_dims[d];
+            conf.div *= conf.reduce_dims[d];
+        } else {
+            conf.dst_dims[d] = src_dims[d];
+        }
+        conf.reduce_nelems *= conf.reduce_dims[d];
+        conf.dst_nelems *= conf.dst_dims[d];
+    }
+
+    // With enough destination elements the reference implementation
+    // occupies the device without extra passes.
+    conf.lws = 256;
+    const int eu_count = compute_engine->device_info()->eu_count();
+    if (conf.dst_nelems > 64 * eu_count || conf.reduce_nelems < 4 * conf.lws)
+        return status::unimplemented;
+
+    // Vector loads are used along the innermost reduced dimension when it
+    // is dense in memory.
+    const int last = ndims - 1;
+    const bool dense_inner = src_mdw.is_plain()
+            && src_mdw.blocking_desc().strides[last] == 1;
+    conf.vect_size = dense_inner && conf.is_reduction_dim[last]
+                    && conf.reduce_dims[last] % 8 == 0
+            ? 8
+            : 1;
+
+    // A couple of work-groups per EU.
+    const dim_t target_groups = 2 * eu_count;
+    const dim_t step = conf.lws * conf.vect_size;
+    dim_t nchunks = utils::div_up(target_groups, conf.dst_nelems);
+    const dim_t chunk_size = utils::rnd_up(
+            utils::div_up(conf.reduce_nelems, nchunks), step);
+    nchunks = utils::div_up(conf.reduce_nelems, chunk_size);
+    conf.chunk_size = (int)chunk_size;
+    conf.nchunks = (int)nchunks;
+
+    set_offsets(src_mdw, conf.off.src_off);
+    set_offsets(dst_mdw, conf.off.dst_off);
+
+    return status::success;
+}
+
+status_t gen9_reduction_t::pd_t::init_kernel_ctx(
+        compute::kernel_ctx_t &kernel_ctx) const {
+    using namespace alg_kind;
+
+    kernel_ctx.set_data_type(conf.src_type);
+
+    kernel_ctx.define_int("IN", conf.dst_dims[0]);
+    kernel_ctx.define_int("IC", conf.ndims >= 2 ? conf.dst_dims[1] : 1);
+    kernel_ctx.define_int(
+            "ID", conf.ndims >= 5 ? conf.dst_dims[conf.ndims - 3] : 1);
+    kernel_ctx.define_int(
+            "IH", conf.ndims >= 4 ? conf.dst_dims[conf.ndims - 2] : 1);
+    kernel_ctx.define_int(
+            "IW", conf.ndims >= 3 ? conf.dst_dims[conf.ndims - 1] : 1);
+
+    switch (conf.alg) {
+        case reduction_max: kernel_ctx.define_int("IS_MAX", 1); break;
+        case reduction_min: kernel_ctx.define_int("IS_MIN", 1); break;
+        case reduction_mean: kernel_ctx.define_int("IS_MEAN", 1); break;
+        case reduction_sum: kernel_ctx.define_int("IS_SUM", 1); break;
+        case reduction_mul: kernel_ctx.define_int("IS_MUL", 1); break;
+        case reduction_norm_lp_max:
+            kernel_ctx.define_int("IS_LP_MAX", 1);
+            break;
+        case reduction_norm_lp_sum:
+            kernel_ctx.define_int("IS_LP_SUM", 1);
+            break;
+        case reduction_norm_lp_power_p_max:
+            kernel_ctx.define_int("IS_P_MAX", 1);
+            break;
+        case reduction_norm_lp_power_p_sum:
+            kernel_ctx.define_int("IS_P_SUM", 1);
+            break;
+        default: return status::invalid_arguments;
+    }
+
+    def_offsets(conf.off.src_off, kernel_ctx, "SRC", conf.ndims);
+    def_offsets(conf.off.dst_off, kernel_ctx, "DST", conf.ndims);
+
+    kernel_ctx.define_int("REDUCTION_IN", conf.reduce_dims[0]);
+    kernel_ctx.define_int(
+            "REDUCTION_IC", conf.ndims >= 2 ? conf.reduce_dims[1] : 1);
+    kernel_ctx.define_int("REDUCTION_ID",
+            conf.ndims >= 5 ? conf.reduce_dims[conf.ndims - 3] : 1);
+    kernel_ctx.define_int("REDUCTION_IH",
+            conf.ndims >= 4 ? conf.reduce_dims[conf.ndims - 2] : 1);
+    kernel_ctx.define_int("REDUCTION_IW",
+            conf.ndims >= 3 ? conf.reduce_dims[conf.ndims - 1] : 1);
+    kernel_ctx.define_int("REDUCTION_SIZE", conf.reduce_nelems);
+    kernel_ctx.define_int("DST_NELEMS", conf.dst_nelems);
+
+    kernel_ctx.define_int("LWS", conf.lws);
+    kernel_ctx.define_int("VECT_SIZE", conf.vect_size);
+    kernel_ctx.define_int("CHUNK_SIZE", conf.chunk_size);
+    kernel_ctx.define_int("NUM_CHUNKS", conf.nchunks);
+
+    kernel_ctx.define_int("DIV", conf.div);
+    kernel_ctx.define_int("NDIMS", conf.ndims);
+    kernel_ctx.define_int("POWER", conf.power);
+    kernel_ctx.define_float("EPS", conf.eps);
+
+    def_memory_desc_info(kernel_ctx, conf.src_md_info, "SRC");
+    def_memory_desc_info(kernel_ctx, conf.dst_md_info, "DST");
+
+    return status::success;
+}
+
+void gen9_reduction_t::pd_t::init_scratchpad() {
+    auto scratchpad = scratchpad_registry().registrar();
+    scratchpad.book(key_reducer_space, conf.nchunks * conf.dst_nelems,
+            sizeof(float), OCL_BUFFER_ALIGNMENT);
+}
+
+status_t gen9_reduction_t::execute_gen9(const exec_ctx_t &ctx) const {
+    auto &src = CTX_IN_STORAGE(DNNL_ARG_SRC);
+    auto &dst = CTX_OUT_STORAGE(DNNL_ARG_DST);
+    std::unique_ptr<memory_storage_t> partials
+            = ctx.get_scratchpad_grantor().get_memory_storage(
+                    key_reducer_space);
+
+    const auto &conf = pd()->conf;
+
+    compute::kernel_arg_list_t initial_arg_list;
+    initial_arg_list.set(0, src);
+    initial_arg_list.set(1, *partials);
+
+    const size_t initial_gws[3]
+            = {(size_t)conf.nchunks * conf.lws, (size_t)conf.dst_nelems, 1};
+    const size_t initial_lws[3] = {(size_t)conf.lws, 1, 1};
+    auto initial_nd_range = compute::nd_range_t(initial_gws, initial_lws);
+
+    status_t status = parallel_for(
+            ctx, initial_nd_range, initial_kernel_, initial_arg_list);
+    CHECK(status);
+
+    compute::kernel_arg_list_t final_arg_list;
+    final_arg_list.set(0, *partials);
+    final_arg_list.set(1, dst);
+
+    const size_t final_gws[3] = {(size_t)conf.dst_nelems, 1, 1};
+    auto final_nd_range = compute::nd_range_t(final_gws);
+
+    return parallel_for(ctx, final_nd_range, final_kernel_, final_arg_list);
+}
+
+} // namespace ocl
+} // namespace gpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,102 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#ifndef GPU_OCL_GEN9_REDUCTION_HPP
+#define GPU_OCL_GEN9_REDUCTION_HPP
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+#include "gpu/compute/compute.hpp"
+#include "gpu/gpu_primitive.hpp"
+#include "gpu/gpu_reduction_pd.hpp"
+#include "gpu/gpu_resource.hpp"
+#include "gpu/primitive_conf.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace gpu {
+namespace ocl {
+
+// Two-phase reduction for the problems with too few destination elements to
+// occupy the device with one work-item per element (e.g. full reductions or
+// global pooling). The reduction space of every destination element is split
+// into chunks reduced by separate work-groups to partial results in the
+// scratchpad, which are then combined by the final kernel.
+struct gen9_reduction_t : public gpu_primitive_t {
+    struct pd_t : public gpu_reduction_pd_t {
+        using gpu_reduction_pd_t::gpu_reduction_pd_t;
+
+        DECLARE_COMMON_PD_T("ocl:gen9", gen9_reduction_t);
+
+        status_t init(engine_t *engine) {
+            bool ok = set_default_params() == status::success
+                    && attr()->has_default_values()
+                    && !memory_desc_wrapper(src_md()).has_zero_dim();
+            if (!ok) return status::unimplemented;
+
+            CHECK(init_conf(engine));
+            init_scratchpad();
+
+            return status::success;
+        }
+
+        status_t init_conf(engine_t *engine);
+        status_t init_kernel_ctx(compute::kernel_ctx_t &kernel_ctx) const;
+        void init_scratchpad();
+
+        reduction_conf_t conf;
+    };
+
+    gen9_reduction_t(const pd_t *apd) : gpu_primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override {
+        compute::kernel_ctx_t kernel_ctx;
+
+        status_t status = pd()->init_kernel_ctx(kernel_ctx);
+        CHECK(status);
+
+        std::vector<compute::kernel_t> kernels;
+        status = create_kernels(engine, &kernels,
+                {"gen9_reduce_initial", "gen9_reduce_final"}, kernel_ctx);
+        CHECK(status);
+
+        initial_kernel_ = kernels[0];
+        final_kernel_ = kernels[1];
+
+        return status::success;
+    }
+
+    status_t execute(const exec_ctx_t &ctx) const override {
+        return execute_gen9(ctx);
+    }
+
+private:
+    status_t execute_gen9(const exec_ctx_t &ctx) const;
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    compute::kernel_t initial_kernel_;
+    compute::kernel_t final_kernel_;
+};
+
+} // namespace ocl
+} // namespace gpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
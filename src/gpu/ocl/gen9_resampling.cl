@@ -0,0 +1,155 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#include "gpu/ocl/ocl_types.h"
+
+// Every sub-group processes SUB_GROUP_SIZE consecutive channels of one
+// spatial point, which are dense in memory, with sub-group block accesses.
+// The interpolation indices and weights are computed once per sub-group for
+// all its channels.
+#define LOAD(ptr) \
+    CONVERT_FLOAT_T(AS_DATA_T(BLOCK_READ((const __global BLOCK_DATA_T *)(ptr))))
+#define STORE(ptr, val) \
+    BLOCK_WRITE((__global BLOCK_DATA_T *)(ptr), \
+            AS_BLOCK_DATA_T(CONVERT_DATA_T(val)))
+
+#if IS_FWD == 1
+__attribute__((reqd_work_group_size(SUB_GROUP_SIZE, 1, 1)))
+__attribute__((intel_reqd_sub_group_size(SUB_GROUP_SIZE))) __kernel void
+gen9_resampling_fwd(__global const DATA_T *src, __global DATA_T *dst) {
+    const uint c = get_group_id(0) * SUB_GROUP_SIZE;
+    const uint sp = get_global_id(1);
+    const uint mb = get_global_id(2);
+    const uint ow = sp % OW;
+    const uint oh = (sp / OW) % OH;
+    const uint od = sp / (OW * OH);
+
+    const float id = (od + .5f) * ID / OD;
+    const float ih = (oh + .5f) * IH / OH;
+    const float iw = (ow + .5f) * IW / OW;
+#if NEAREST
+    BLOCK_WRITE((__global BLOCK_DATA_T *)&dst[DST_OFF(mb, c, od, oh, ow)],
+            BLOCK_READ((const __global BLOCK_DATA_T *)&src[SRC_OFF(
+                    mb, c, (uint)id, (uint)ih, (uint)iw)]));
+#else
+    const uint id0 = max((uint)floor(id - .5f), (uint)0);
+    const uint id1 = min((uint)ceil(id - .5f), (uint)ID - 1);
+    const uint ih0 = max((uint)floor(ih - .5f), (uint)0);
+    const uint ih1 = min((uint)ceil(ih - .5f), (uint)IH - 1);
+    const uint iw0 = max((uint)floor(iw - .5f), (uint)0);
+    const uint iw1 = min((uint)ceil(iw - .5f), (uint)IW - 1);
+    const float Wid = 1.0f - fabs(id - .5f - id0);
+    const float Wih = 1.0f - fabs(ih - .5f - ih0);
+    const float Wiw = 1.0f - fabs(iw - .5f - iw0);
+
+    const float d0 = (LOAD(&src[SRC_OFF(mb, c, id0, ih0, iw0)]) * Wih * Wiw)
+            + (LOAD(&src[SRC_OFF(mb, c, id0, ih1, iw0)]) * (1.f - Wih) * Wiw)
+            + (LOAD(&src[SRC_OFF(mb, c, id0, ih0, iw1)]) * Wih * (1.f - Wiw))
+            + (LOAD(&src[SRC_OFF(mb, c, id0, ih1, iw1)]) * (1.f - Wih)
+                    * (1.f - Wiw));
+    const float d1 = (LOAD(&src[SRC_OFF(mb, c, id1, ih0, iw0)]) * Wih * Wiw)
+            + (LOAD(&src[SRC_OFF(mb, c, id1, ih1, iw0)]) * (1.f - Wih) * Wiw)
+            + (LOAD(&src[SRC_OFF(mb, c, id1, ih0, iw1)]) * Wih * (1.f - Wiw))
+            + (LOAD(&src[SRC_OFF(mb, c, id1, ih1, iw1)]) * (1.f - Wih)
+                    * (1.f - Wiw));
+    STORE(&dst[DST_OFF(mb, c, od, oh, ow)], d0 * Wid + d1 * (1.f - Wid));
+#endif
+}
+#endif
+
+#if IS_BWD == 1
+float linear(uint x, int fo, int fi) {
+    return ((x + .5f) * fo / fi) - .5f;
+}
+
+// Every diff_src point gathers the diff_dst points it contributes to, so no
+// atomics are needed.
+__attribute__((reqd_work_group_size(SUB_GROUP_SIZE, 1, 1)))
+__attribute__((intel_reqd_sub_group_size(SUB_GROUP_SIZE))) __kernel void
+gen9_resampling_bwd(
+        __global DATA_T *diff_src, __global const DATA_T *diff_dst) {
+#define CEIL(x) max((uint)ceil(x), (uint)0)
+#define L(x, fo, fi) linear(x, fo, fi)
+#define LS(x, fo, fi) CEIL(L(x, fo, fi))
+#define RS(x, fo, fi) L(x - 1, fo, fi) < 0 ? 0 : (uint)(L(x - 1, fo, fi)) + 1
+#define LE(x, fo, fi, lim) min(CEIL(L(x + 1, fo, fi)), (uint)lim)
+#define RE(x, fo, fi, lim) \
+    min((L(x, fo, fi) < 0 ? 0 : (uint)(L(x, fo, fi)) + 1), (uint)lim)
+    const uint c = get_group_id(0) * SUB_GROUP_SIZE;
+    const uint sp = get_global_id(1);
+    const uint mb = get_global_id(2);
+    const uint iw = sp % IW;
+    const uint ih = (sp / IW) % IH;
+    const uint id = sp / (IW * IH);
+
+    float src_val = 0.0f;
+#if NEAREST
+    const uint od_start = CEIL(id * FD - .5f);
+    const uint oh_start = CEIL(ih * FH - .5f);
+    const uint ow_start = CEIL(iw * FW - .5f);
+    const uint od_end = CEIL((id + 1.f) * FD - .5f);
+    const uint oh_end = CEIL((ih + 1.f) * FH - .5f);
+    const uint ow_end = CEIL((iw + 1.f) * FW - .5f);
+    for_(uint i = od_start; i < od_end; i++)
+    for_(uint j = oh_start; j < oh_end; j++)
+    for (uint k = ow_start; k < ow_end; k++)
+        src_val += LOAD(&diff_dst[DST_OFF(mb, c, i, j, k)]);
+#else
+    const uint left_sd = id == 0 ? 0 : LS(id, OD, ID);
+    const uint left_sh = ih == 0 ? 0 : LS(ih, OH, IH);
+    const uint left_sw = iw == 0 ? 0 : LS(iw, OW, IW);
+    const uint right_sd = RS(id, OD, ID);
+    const uint right_sh = RS(ih, OH, IH);
+    const uint right_sw = RS(iw, OW, IW);
+    const uint left_ed = LE(id, OD, ID, OD);
+    const uint left_eh = LE(ih, OH, IH, OH);
+    const uint left_ew = LE(iw, OW, IW, OW);
+    const uint right_ed = id == (ID - 1) ? OD : RE(id, OD, ID, OD);
+    const uint right_eh = ih == (IH - 1) ? OH : RE(ih, OH, IH, OH);
+    const uint right_ew = iw == (IW - 1) ? OW : RE(iw, OW, IW, OW);
+    const uint od_start[2] = {left_sd, right_sd};
+    const uint oh_start[2] = {left_sh, right_sh};
+    const uint ow_start[2] = {left_sw, right_sw};
+    const uint od_end[2] = {left_ed, right_ed};
+    const uint oh_end[2] = {left_eh, right_eh};
+    const uint ow_end[2] = {left_ew, right_ew};
+    for_(int c1 = 0; c1 < 2; c1++)
+    for_(uint i = od_start[c1]; i < od_end[c1]; i++)
+    {
+        const float d = L(i, ID, OD);
+        const float Wid
+                = c1 == 0 ? 1.f - fabs(d - (int)d) : fabs(d - (int)d);
+        for_(int c2 = 0; c2 < 2; c2++)
+        for_(uint j = oh_start[c2]; j < oh_end[c2]; j++)
+        {
+            const float h = L(j, IH, OH);
+            const float Wih
+                    = c2 == 0 ? 1.f - fabs(h - (int)h) : fabs(h - (int)h);
+            for_(int c3 = 0; c3 < 2; c3++)
+            for (uint k = ow_start[c3]; k < ow_end[c3]; k++) {
+                const float w = L(k, IW, OW);
+                const float Wiw = c3 == 0 ? 1.f - fabs(w - (int)w)
+                                          : fabs(w - (int)w);
+                src_val += LOAD(&diff_dst[DST_OFF(mb, c, i, j, k)]) * Wid
+                        * Wih * Wiw;
+            }
+        }
+    }
+#endif
+    STORE(&diff_src[SRC_OFF(mb, c, id, ih, iw)], src_val);
+}
+#endif
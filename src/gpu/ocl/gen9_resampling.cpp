@@ -0,0 +1,195 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#include "gpu/ocl/gen9_resampling.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace gpu {
+namespace ocl {
+
+static const int sub_group_size = 16;
+
+// Checks that the channels are dense in blocks of sub_group_size and every
+// block is aligned as required by sub-group block accesses.
+static bool channels_are_block_accessible(const memory_desc_t *md) {
+    const memory_desc_wrapper mdw(md);
+    if (mdw.offset0() != 0) return false;
+
+    const auto &blk = mdw.blocking_desc();
+    if (blk.inner_nblks == 1)
+        return blk.inner_idxs[0] == 1 && blk.inner_blks[0] == sub_group_size;
+    if (blk.inner_nblks != 0 || blk.strides[1] != 1) return false;
+    for (int d = 0; d < mdw.ndims(); d++)
+        if (d != 1 && blk.strides[d] % sub_group_size != 0) return false;
+    return mdw.dims()[1] % sub_group_size == 0;
+}
+
+static bool engine_ok(compute::compute_engine_t *compute_engine,
+        data_type_t dt, bool is_fwd) {
+    using namespace data_type;
+    const bool dt_ok = is_fwd ? utils::one_of(dt, f32, f16, bf16)
+                              : utils::one_of(dt, f32, bf16);
+    return dt_ok
+            && compute_engine->mayiuse(compute::device_ext_t::intel_subgroups)
+            && IMPLICATION(utils::one_of(dt, f16, bf16),
+                    compute_engine->mayiuse(
+                            compute::device_ext_t::intel_subgroups_short))
+            && IMPLICATION(dt == f16,
+                    compute_engine->mayiuse(compute::device_ext_t::khr_fp16));
+}
+
+static status_t init_kernel_ctx_common(compute::kernel_ctx_t &kernel_ctx,
+        const resampling_pd_t *pd, const memory_desc_t *src_md,
+        const memory_desc_t *dst_md) {
+    using namespace alg_kind;
+
+    kernel_ctx.set_data_type(src_md->data_type);
+    kernel_ctx.define_int("IS_FWD", pd->is_fwd());
+    kernel_ctx.define_int("IS_BWD", !pd->is_fwd());
+
+    switch (pd->desc()->alg_kind) {
+        case resampling_nearest: kernel_ctx.define_int("NEAREST", 1); break;
+        case resampling_linear: kernel_ctx.define_int("LINEAR", 1); break;
+        default: return status::unimplemented;
+    }
+
+    const memory_desc_wrapper src_d(src_md);
+    const memory_desc_wrapper dst_d(dst_md);
+    const int ndims = dst_d.ndims();
+
+    kernel_ctx.define_int("NDIMS", ndims);
+    kernel_ctx.define_int("SUB_GROUP_SIZE", sub_group_size);
+    kernel_ctx.define_int("MB", pd->MB());
+    kernel_ctx.define_int("C", pd->C());
+    kernel_ctx.define_int("ID", pd->ID());
+    kernel_ctx.define_int("IH", pd->IH());
+    kernel_ctx.define_int("IW", pd->IW());
+    kernel_ctx.define_int("OD", pd->OD());
+    kernel_ctx.define_int("OH", pd->OH());
+    kernel_ctx.define_int("OW", pd->OW());
+    kernel_ctx.define_float("FD", pd->FD());
+    kernel_ctx.define_float("FH", pd->FH());
+    kernel_ctx.define_float("FW", pd->FW());
+
+    offsets_t off;
+    set_offsets(src_d, off.src_off);
+    set_offsets(dst_d, off.dst_off);
+    def_offsets(off.src_off, kernel_ctx, "SRC", ndims);
+    def_offsets(off.dst_off, kernel_ctx, "DST", ndims);
+
+    return status::success;
+}
+
+// One work-item per channel, padded to the sub-group size, and spatial point
+// of the iteration space.
+static void init_nd_range(size_t *gws, size_t *lws, const memory_desc_t *md,
+        dim_t MB, dim_t D, dim_t H, dim_t W) {
+    gws[0] = utils::rnd_up(md->dims[1], sub_group_size);
+    gws[1] = D * H * W;
+    gws[2] = MB;
+    lws[0] = sub_group_size;
+    lws[1] = lws[2] = 1;
+}
+
+status_t gen9_resampling_fwd_t::pd_t::init(engine_t *engine) {
+    assert(engine->kind() == engine_kind::gpu);
+    auto *compute_engine = utils::downcast<compute::compute_engine_t *>(engine);
+    bool ok = is_fwd() && src_md()->data_type == dst_md()->data_type
+            && set_default_params() == status::success
+            && attr()->has_default_values()
+            && engine_ok(compute_engine, src_md()->data_type, true)
+            && channels_are_block_accessible(src_md())
+            && channels_are_block_accessible(dst_md());
+    if (!ok) return status::unimplemented;
+
+    init_nd_range(gws, lws, dst_md(), MB(), OD(), OH(), OW());
+
+    return status::success;
+}
+
+status_t gen9_resampling_fwd_t::init(engine_t *engine) {
+    compute::kernel_ctx_t kernel_ctx;
+    CHECK(init_kernel_ctx_common(
+            kernel_ctx, pd(), pd()->src_md(), pd()->dst_md()));
+
+    create_kernel(engine, &kernel_, "gen9_resampling_fwd", kernel_ctx);
+    if (!kernel_) return status::runtime_error;
+
+    return status::success;
+}
+
+status_t gen9_resampling_fwd_t::execute_forward(const exec_ctx_t &ctx) const {
+    auto &src = CTX_IN_STORAGE(DNNL_ARG_SRC);
+    auto &dst = CTX_OUT_STORAGE(DNNL_ARG_DST);
+
+    compute::kernel_arg_list_t arg_list;
+    arg_list.set(0, src);
+    arg_list.set(1, dst);
+
+    auto nd_range = compute::nd_range_t(pd()->gws, pd()->lws);
+
+    status_t status = parallel_for(ctx, nd_range, kernel_, arg_list);
+    return status;
+}
+
+status_t gen9_resampling_bwd_t::pd_t::init(engine_t *engine) {
+    assert(engine->kind() == engine_kind::gpu);
+    auto *compute_engine = utils::downcast<compute::compute_engine_t *>(engine);
+    bool ok = !is_fwd()
+            && diff_src_md()->data_type == diff_dst_md()->data_type
+            && set_default_params() == status::success
+            && attr()->has_default_values()
+            && engine_ok(compute_engine, diff_src_md()->data_type, false)
+            && channels_are_block_accessible(diff_src_md())
+            && channels_are_block_accessible(diff_dst_md());
+    if (!ok) return status::unimplemented;
+
+    init_nd_range(gws, lws, diff_src_md(), MB(), ID(), IH(), IW());
+
+    return status::success;
+}
+
+status_t gen9_resampling_bwd_t::init(engine_t *engine) {
+    compute::kernel_ctx_t kernel_ctx;
+    CHECK(init_kernel_ctx_common(
+            kernel_ctx, pd(), pd()->diff_src_md(), pd()->diff_dst_md()));
+
+    create_kernel(engine, &kernel_, "gen9_resampling_bwd", kernel_ctx);
+    if (!kernel_) return status::runtime_error;
+
+    return status::success;
+}
+
+status_t gen9_resampling_bwd_t::execute_backward(const exec_ctx_t &ctx) const {
+    auto &diff_dst = CTX_IN_STORAGE(DNNL_ARG_DIFF_DST);
+    auto &diff_src = CTX_OUT_STORAGE(DNNL_ARG_DIFF_SRC);
+
+    compute::kernel_arg_list_t arg_list;
+    arg_list.set(0, diff_src);
+    arg_list.set(1, diff_dst);
+
+    auto nd_range = compute::nd_range_t(pd()->gws, pd()->lws);
+
+    status_t status = parallel_for(ctx, nd_range, kernel_, arg_list);
+    return status;
+}
+
+} // namespace ocl
+} // namespace gpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,104 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#ifndef GPU_OCL_GEN9_RESAMPLING_HPP
+#define GPU_OCL_GEN9_RESAMPLING_HPP
+
+#include "common/c_types_map.hpp"
+#include "common/nstl.hpp"
+#include "common/primitive.hpp"
+#include "common/type_helpers.hpp"
+#include "gpu/compute/compute.hpp"
+#include "gpu/gpu_primitive.hpp"
+#include "gpu/gpu_resampling_pd.hpp"
+#include "gpu/gpu_resource.hpp"
+#include "gpu/ocl/ocl_stream.hpp"
+#include "gpu/ocl/ocl_utils.hpp"
+#include "gpu/primitive_conf.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace gpu {
+namespace ocl {
+
+// Resampling for the layouts with channels dense in blocks of 16, i.e. nhwc
+// with C divisible by 16 and the 16c-blocked formats. Every sub-group handles
+// 16 channels of a spatial point with sub-group block accesses.
+struct gen9_resampling_fwd_t : public gpu_primitive_t {
+    struct pd_t : public gpu_resampling_fwd_pd_t {
+        pd_t(const resampling_desc_t *adesc, const primitive_attr_t *attr,
+                const resampling_fwd_pd_t *hint_fwd_pd)
+            : gpu_resampling_fwd_pd_t(adesc, attr, hint_fwd_pd) {}
+        virtual ~pd_t() {}
+
+        DECLARE_COMMON_PD_T("ocl:gen9", gen9_resampling_fwd_t);
+
+        status_t init(engine_t *engine);
+
+        size_t gws[3] = {};
+        size_t lws[3] = {};
+    };
+
+    gen9_resampling_fwd_t(const pd_t *apd) : gpu_primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+
+    status_t execute(const exec_ctx_t &ctx) const override {
+        return execute_forward(ctx);
+    }
+
+private:
+    status_t execute_forward(const exec_ctx_t &ctx) const;
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+    compute::kernel_t kernel_;
+};
+
+struct gen9_resampling_bwd_t : public gpu_primitive_t {
+    struct pd_t : public gpu_resampling_bwd_pd_t {
+        pd_t(const resampling_desc_t *adesc, const primitive_attr_t *attr,
+                const resampling_fwd_pd_t *hint_fwd_pd)
+            : gpu_resampling_bwd_pd_t(adesc, attr, hint_fwd_pd) {}
+        virtual ~pd_t() {}
+
+        DECLARE_COMMON_PD_T("ocl:gen9", gen9_resampling_bwd_t);
+
+        status_t init(engine_t *engine);
+
+        size_t gws[3] = {};
+        size_t lws[3] = {};
+    };
+
+    gen9_resampling_bwd_t(const pd_t *apd) : gpu_primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+
+    status_t execute(const exec_ctx_t &ctx) const override {
+        return execute_backward(ctx);
+    }
+
+private:
+    status_t execute_backward(const exec_ctx_t &ctx) const;
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+    compute::kernel_t kernel_;
+};
+
+} // namespace ocl
+} // namespace gpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
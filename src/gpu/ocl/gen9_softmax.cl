@@ -125,3 +125,57 @@ gen9_softmax_fwd(__global DATA_T *src, __global DATA_T *dst) {
 }
 
 #endif
+
+#if IS_BWD
+
+// The data is read twice instead of being kept in registers, which would
+// spill for large softmax axes.
+__attribute__((reqd_work_group_size(GROUP_SIZE, 1, 1)))
+__attribute__((intel_reqd_sub_group_size(SUB_GROUP_SIZE))) __kernel void
+gen9_softmax_bwd(__global DATA_T *dst, __global DATA_T *diff_src,
+        __global DATA_T *diff_dst) {
+
+    const int dim[] = {
+            (get_global_id(0) / GROUP_SIZE) % BLOCK_0,
+            get_global_id(1) % BLOCK_1,
+            get_global_id(2) % BLOCK_2,
+            (get_global_id(0) / GROUP_SIZE) / BLOCK_0,
+            get_global_id(1) / BLOCK_1,
+            get_global_id(2) / BLOCK_2,
+    };
+
+    size_t data_off = DATA_OFF(dim[0], dim[1], dim[2], dim[3], dim[4], 0);
+    dst += data_off;
+    diff_dst += data_off;
+    diff_src += data_off;
+
+    float sbr = 0.f;
+    for (int k = 0; k < NUM_BUF; ++k) {
+        const int off = k * VECT_SIZE * SUB_GROUP_SIZE;
+        float8 dd = LOAD_DATA_8x16(&diff_dst[off]);
+#if LOGSOFTMAX
+        for (int i = 0; i < VECT_SIZE; ++i)
+            sbr += dd[i];
+#else
+        float8 y = LOAD_DATA_8x16(&dst[off]);
+        for (int i = 0; i < VECT_SIZE; ++i)
+            sbr += dd[i] * y[i];
+#endif
+    }
+
+    sbr = sub_group_reduce_add(sbr);
+
+    for (int k = 0; k < NUM_BUF; ++k) {
+        const int off = k * VECT_SIZE * SUB_GROUP_SIZE;
+        float8 dd = LOAD_DATA_8x16(&diff_dst[off]);
+        float8 y = LOAD_DATA_8x16(&dst[off]);
+#if LOGSOFTMAX
+        float8 ds = dd - exp(y) * sbr;
+#else
+        float8 ds = y * (dd - sbr);
+#endif
+        STORE_DATA_8x16(&diff_src[off], ds);
+    }
+}
+
+#endif
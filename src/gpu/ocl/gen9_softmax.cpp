@@ -38,6 +38,25 @@ status_t gen9_softmax_fwd_t::execute_generic(const exec_ctx_t &ctx) const {
     return status;
 }
 
+status_t gen9_softmax_bwd_t::execute_generic(const exec_ctx_t &ctx) const {
+    if (memory_desc_wrapper(pd()->desc()->diff_desc).has_zero_dim())
+        return status::success;
+
+    auto &dst = CTX_IN_STORAGE(DNNL_ARG_DST);
+    auto &diff_dst = CTX_IN_STORAGE(DNNL_ARG_DIFF_DST);
+    auto &diff_src = CTX_OUT_STORAGE(DNNL_ARG_DIFF_SRC);
+
+    compute::kernel_arg_list_t arg_list;
+    arg_list.set(0, dst);
+    arg_list.set(1, diff_src);
+    arg_list.set(2, diff_dst);
+
+    auto nd_range = compute::nd_range_t(pd()->gws, pd()->lws);
+
+    status_t status = parallel_for(ctx, nd_range, kernel_, arg_list);
+    return status;
+}
+
 } // namespace ocl
 } // namespace gpu
 } // namespace impl
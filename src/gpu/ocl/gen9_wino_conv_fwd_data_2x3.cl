@@ -17,8 +17,12 @@
 #include "gpu/ocl/ocl_post_ops.h"
 #include "gpu/ocl/ocl_types.h"
 
+// The transformed tensors U, V and M are kept in f32, so that the bf16 data
+// is converted once, on the accesses to the user tensors.
+#define WINO_DATA_T float
+
 #define BLOCK_SIZE OC_BLOCK
-#define BLOCKED_DATA_T CONCAT2(DATA_T, BLOCK_SIZE)
+#define BLOCKED_DATA_T CONCAT2(WINO_DATA_T, BLOCK_SIZE)
 #define BLOCKED_READ(ptr) vload16(0, ptr)
 
 // Using for loop instead of vstore16 due incorrect results
@@ -30,10 +34,25 @@
         } \
     } while (0)
 
+#if DT_BF16
+#define BLOCKED_READ_DATA(ptr) \
+    (BLOCKED_DATA_T)(cvt_bf16_to_f32(vload8(0, ptr)), \
+            cvt_bf16_to_f32(vload8(1, ptr)))
+#define BLOCKED_WRITE_DATA(data, ptr) \
+    do { \
+        BLOCKED_DATA_T result = data; \
+        vstore8(cvt_f32_to_bf16(result.lo), 0, ptr); \
+        vstore8(cvt_f32_to_bf16(result.hi), 1, ptr); \
+    } while (0)
+#else
+#define BLOCKED_READ_DATA(ptr) BLOCKED_READ(ptr)
+#define BLOCKED_WRITE_DATA(data, ptr) BLOCKED_WRITE(data, ptr)
+#endif
+
 #define VECT_SIZE 4
-#define VECT_DATA_T CONCAT2(DATA_T, VECT_SIZE)
-#define AS_VECT_DATA_T AS_DATA4_T
-#define AS_VECT_BLOCK_DATA_T AS_BLOCK_DATA4_T
+#define VECT_DATA_T CONCAT2(WINO_DATA_T, VECT_SIZE)
+#define AS_VECT_DATA_T as_float4
+#define AS_VECT_BLOCK_DATA_T as_uint4
 
 #define OC_OUTER_BLOCK OC_BLOCK
 #define IC_OUTER_BLOCK IC_BLOCK
@@ -136,7 +155,7 @@ static inline int dst_off(int n, int c, int d, int h, int w) {
 }
 
 __kernel void gen9_wino_wei_transform_2x3(
-        __global DATA_T *U, const __global DATA_T *weights) {
+        __global WINO_DATA_T *U, const __global DATA_T *weights) {
     const uint weights_tile_width = WINO_M;
     const uint weights_tile_height = 1;
     const uint in_kw = get_global_id(0) * weights_tile_width;
@@ -154,11 +173,11 @@ __kernel void gen9_wino_wei_transform_2x3(
     bool is_valid = ic < IC || oc < OC;
 
     VECT_DATA_T tile;
-    tile.x = is_valid ? weights[in_idx] : 0;
+    tile.x = is_valid ? DATA_TO_REF(weights[in_idx]) : 0;
     in_idx += wei_off(0, 0, 0, 0, 0, 1);
-    tile.y = is_valid ? weights[in_idx] : 0;
+    tile.y = is_valid ? DATA_TO_REF(weights[in_idx]) : 0;
     in_idx += wei_off(0, 0, 0, 0, 0, 1);
-    tile.z = is_valid ? weights[in_idx] : 0;
+    tile.z = is_valid ? DATA_TO_REF(weights[in_idx]) : 0;
 
     uint out_idx = U_off(oc, ic, out_kh, out_kw);
 
@@ -172,7 +191,7 @@ __kernel void gen9_wino_wei_transform_2x3(
 }
 
 __kernel void gen9_wino_src_transform_2x3(
-        __global DATA_T *V, const __global DATA_T *src) {
+        __global WINO_DATA_T *V, const __global DATA_T *src) {
     const uint tile_id_x = get_global_id(0);
     const uint tile_id_y = get_global_id(1);
     const uint stride_x = WINO_M;
@@ -190,13 +209,13 @@ __kernel void gen9_wino_src_transform_2x3(
 
     BLOCKED_DATA_T d0, d1, d2, d3;
     int in_idx = src_off(n, ic, 0, ih, iw);
-    d0 = (h0 || w0) ? 0 : BLOCKED_READ(&src[in_idx]);
+    d0 = (h0 || w0) ? 0 : BLOCKED_READ_DATA(&src[in_idx]);
     in_idx += src_off(0, 0, 0, 0, 1);
-    d1 = (h0 || w1) ? 0 : BLOCKED_READ(&src[in_idx]);
+    d1 = (h0 || w1) ? 0 : BLOCKED_READ_DATA(&src[in_idx]);
     in_idx += src_off(0, 0, 0, 0, 1);
-    d2 = (h0 || w2) ? 0 : BLOCKED_READ(&src[in_idx]);
+    d2 = (h0 || w2) ? 0 : BLOCKED_READ_DATA(&src[in_idx]);
     in_idx += src_off(0, 0, 0, 0, 1);
-    d3 = (h0 || w3) ? 0 : BLOCKED_READ(&src[in_idx]);
+    d3 = (h0 || w3) ? 0 : BLOCKED_READ_DATA(&src[in_idx]);
 
     int out_idx = V_off(n, ic, ih, tile_id_x, 0);
     BLOCKED_WRITE(d0 - d2, &V[out_idx]);
@@ -209,7 +228,8 @@ __kernel void gen9_wino_src_transform_2x3(
 }
 
 __kernel void gen9_wino_dst_transform_2x3(__global DATA_T *dst,
-        const __global DATA_T *M, const __global DATA_T *bias POST_OP_ARGS) {
+        const __global WINO_DATA_T *M,
+        const __global BIA_DATA_T *bias POST_OP_ARGS) {
 
     const uint tile_id_x = get_global_id(0);
     const uint tile_id_y = get_global_id(1);
@@ -236,7 +256,7 @@ __kernel void gen9_wino_dst_transform_2x3(__global DATA_T *dst,
 
     if (WITH_BIAS || WITH_POST_OP) {
         const int c_size = WINO_M * OC_BLOCK;
-        DATA_T C[c_size];
+        WINO_DATA_T C[c_size];
         BLOCKED_WRITE(C1, &C[0]);
         BLOCKED_WRITE(C2, &C[OC_BLOCK]);
         if (WITH_BIAS) {
@@ -246,20 +266,20 @@ __kernel void gen9_wino_dst_transform_2x3(__global DATA_T *dst,
                     const int bc_off = oc + oc_outer;
                     C[c_off] += (OC_WO_PADDING % OC_BLOCK == 0
                                         || bc_off < OC_WO_PADDING)
-                            ? bias[bc_off]
-                            : DATA_ZERO;
+                            ? BIA_TO_REF(bias[bc_off])
+                            : 0;
                 }
             }
         }
 
-        DATA_T S[c_size];
+        WINO_DATA_T S[c_size];
         if (WITH_SUM) {
             BLOCKED_DATA_T S1, S2;
             int dst_idx = dst_off(n, oc, 0, oh, ow);
-            S1 = BLOCKED_READ(&dst[dst_idx]);
+            S1 = BLOCKED_READ_DATA(&dst[dst_idx]);
             if (OW % WINO_M == 0 || ow < OW - 1) {
                 dst_idx += dst_off(0, 0, 0, 0, 1);
-                S2 = BLOCKED_READ(&dst[dst_idx]);
+                S2 = BLOCKED_READ_DATA(&dst[dst_idx]);
             } else {
                 S2 = 0;
             }
@@ -267,11 +287,11 @@ __kernel void gen9_wino_dst_transform_2x3(__global DATA_T *dst,
             BLOCKED_WRITE(S2, &S[OC_BLOCK]);
         }
         for (int didx = 0; didx < c_size; ++didx) {
-            float accum = CONVERT_FLOAT_T(C[didx]);
-            float sum = CONVERT_FLOAT_T(S[didx]);
-            int po_oc = oc + c_size % OC_BLOCK;
-            APPLY_POST_OPS_SERIAL(C, DATA_T, S, DATA_T, n, 1, po_oc, 1);
-            C[didx] = TO_DATA_T(accum);
+            float accum = C[didx];
+            float sum = S[didx];
+            int po_oc = oc + didx % OC_BLOCK;
+            APPLY_POST_OPS_SERIAL(accum, float, sum, float, n, 1, po_oc, 1);
+            C[didx] = accum;
         }
 
         C1 = BLOCKED_READ(&C[0]);
@@ -279,16 +299,16 @@ __kernel void gen9_wino_dst_transform_2x3(__global DATA_T *dst,
     }
 
     int dst_idx = dst_off(n, oc, 0, oh, ow);
-    BLOCKED_WRITE(C1, &dst[dst_idx]);
+    BLOCKED_WRITE_DATA(C1, &dst[dst_idx]);
     if (OW % WINO_M == 0 || ow < OW - 1) {
         dst_idx += dst_off(0, 0, 0, 0, 1);
-        BLOCKED_WRITE(C2, &dst[dst_idx]);
+        BLOCKED_WRITE_DATA(C2, &dst[dst_idx]);
     }
 }
 
 __attribute__((reqd_work_group_size(8, 1, 1))) __kernel void
-gen9_wino_conv_fwd_2x3(__global DATA_T *M, const __global DATA_T *V,
-        const __global DATA_T *U_param) {
+gen9_wino_conv_fwd_2x3(__global WINO_DATA_T *M,
+        const __global WINO_DATA_T *V, const __global WINO_DATA_T *U_param) {
     const int VH_SIZE_VECT = V_off(0, 0, 1 - PH, 0, 0) / VECT_SIZE;
     const int MH_SIZE_VECT = M_off(0, 0, 1, 0, 0) / VECT_SIZE;
     const int U_IC_SIZE_VECT = U_off(0, 1, 0, 0) / VECT_SIZE;
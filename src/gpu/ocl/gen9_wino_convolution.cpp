@@ -220,23 +220,22 @@ status_t gen9_wino_convolution_fwd_t::pd_t::init_conf() {
 void gen9_wino_convolution_fwd_t::pd_t::init_scratchpad() {
     auto scratchpad = scratchpad_registry().registrar();
 
-    auto wei_data_t = this->desc()->weights_desc.data_type;
+    // The non-fused kernels keep the transformed tensors in f32
+    const size_t wino_dt_size = conf.is_fused
+            ? types::data_type_size(conf.src_data_type)
+            : sizeof(float);
+
     size_t U_sz = conf.tile_size * conf.kh * conf.wino_ic * conf.wino_oc;
-    scratchpad.book(key_wino_U, U_sz, types::data_type_size(wei_data_t),
-            OCL_BUFFER_ALIGNMENT);
+    scratchpad.book(key_wino_U, U_sz, wino_dt_size, OCL_BUFFER_ALIGNMENT);
 
     if (!conf.is_fused) {
-        auto dst_data_t = this->desc()->dst_desc.data_type;
         size_t M_sz = conf.tile_size * conf.mb * conf.wino_oc * conf.wino_oh
                 * conf.wino_ow;
-        scratchpad.book(key_wino_M, M_sz, types::data_type_size(dst_data_t),
-                OCL_BUFFER_ALIGNMENT);
+        scratchpad.book(key_wino_M, M_sz, wino_dt_size, OCL_BUFFER_ALIGNMENT);
 
-        auto src_data_t = this->desc()->src_desc.data_type;
         size_t V_sz = conf.tile_size * conf.mb * conf.wino_ic * conf.wino_ih
                 * conf.wino_iw;
-        scratchpad.book(key_wino_V, V_sz, types::data_type_size(src_data_t),
-                OCL_BUFFER_ALIGNMENT);
+        scratchpad.book(key_wino_V, V_sz, wino_dt_size, OCL_BUFFER_ALIGNMENT);
     }
 }
 
@@ -276,6 +275,7 @@ status_t gen9_wino_convolution_fwd_t::pd_t::init_kernel_ctx(
     kernel_ctx.define_int("IC_BLOCK", conf.ic_block);
 
     kernel_ctx.set_data_type(conf.src_data_type);
+    def_data_type(kernel_ctx, conf.bias_data_type, "BIA");
 
     kernel_ctx.define_int("VER_8OW16C", conf.ver == ver_8ow16c);
     kernel_ctx.define_int("VER_16MB16C", conf.ver == ver_16mb16c);
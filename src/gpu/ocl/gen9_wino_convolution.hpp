@@ -61,7 +61,12 @@ struct gen9_wino_convolution_fwd_t : public gpu_primitive_t {
                     && this->desc()->alg_kind == alg_kind::convolution_winograd
                     && utils::one_of(true,
                             expect_data_types(f32, f32, f32, f32, f32),
-                            expect_data_types(f16, f16, f16, f16, f16))
+                            expect_data_types(f16, f16, f16, f16, f16),
+                            expect_data_types(
+                                    bf16, bf16, data_type::undef, bf16, f32))
+                    && IMPLICATION(src_data_t == bf16 && with_bias(),
+                            utils::one_of(
+                                    desc()->bias_desc.data_type, bf16, f32))
                     && compute_engine->mayiuse(
                             compute::device_ext_t::intel_subgroups)
                     && IMPLICATION(src_data_t == f16,
@@ -221,6 +221,39 @@ float round_fwd(float s) {
     return rint(s);
 }
 
+float hardsigmoid_fwd(float s, float alpha, float beta) {
+    float v = alpha * s + beta;
+    return v <= 0.f ? 0.f : v >= 1.f ? 1.f : v;
+}
+float hardsigmoid_bwd(float dd, float s, float alpha, float beta) {
+    float v = alpha * s + beta;
+    return v <= 0.f ? 0.f : v >= 1.f ? 0.f : dd * alpha;
+}
+
+float hardswish_fwd(float s, float alpha, float beta) {
+    return s * hardsigmoid_fwd(s, alpha, beta);
+}
+float hardswish_bwd(float dd, float s, float alpha, float beta) {
+    float v = alpha * s + beta;
+    float w = v <= 0.f ? 0.f : v >= 1.f ? 1.f : 2.f * alpha * s + beta;
+    return dd * w;
+}
+
+float mish_fwd(float s) {
+    return s * tanh_fwd(soft_relu_fwd(s));
+}
+float mish_bwd(float dd, float s) {
+    const float tanh_sp = tanh_fwd(soft_relu_fwd(s));
+    return dd * (tanh_sp + s * (1.f - tanh_sp * tanh_sp) * logistic_fwd(s));
+}
+
+float selu_fwd(float s, float alpha, float beta) {
+    return beta * elu_fwd(s, alpha);
+}
+float selu_bwd(float dd, float s, float alpha, float beta) {
+    return beta * elu_bwd(dd, s, alpha);
+}
+
 float fwd_eltwise_common(
         int eltwise_alg, float x, float alpha_, float beta_, float scale_) {
     switch (eltwise_alg) {
@@ -244,6 +277,12 @@ float fwd_eltwise_common(
         case POW: return scale_ * pow_fwd(x, alpha_, beta_); break;
         case GELU_ERF: return scale_ * gelu_erf_fwd(x); break;
         case ROUND: return scale_ * round_fwd(x); break;
+        case HARDSWISH: return scale_ * hardswish_fwd(x, alpha_, beta_); break;
+        case HARDSIGMOID:
+            return scale_ * hardsigmoid_fwd(x, alpha_, beta_);
+            break;
+        case MISH: return scale_ * mish_fwd(x); break;
+        case SELU: return scale_ * selu_fwd(x, alpha_, beta_); break;
 
         case RELU_DST: return scale_ * relu_fwd(x, alpha_); break;
         case LOGISTIC_DST: return scale_ * logistic_fwd(x); break;
@@ -287,6 +326,10 @@ float bwd_eltwise(float x, float y, float alpha_, float beta_) {
         case CLIP_V2: return clip_v2_bwd(x, y, alpha_, beta_); break;
         case POW: return pow_bwd(x, y, alpha_, beta_); break;
         case GELU_ERF: return gelu_erf_bwd(x, y); break;
+        case HARDSWISH: return hardswish_bwd(x, y, alpha_, beta_); break;
+        case HARDSIGMOID: return hardsigmoid_bwd(x, y, alpha_, beta_); break;
+        case MISH: return mish_bwd(x, y); break;
+        case SELU: return selu_bwd(x, y, alpha_, beta_); break;
 
         case RELU_DST: return relu_bwd_use_dst(x, y, alpha_); break;
         case LOGISTIC_DST: return logistic_bwd_use_dst(x, y); break;
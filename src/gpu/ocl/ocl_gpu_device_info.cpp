@@ -79,6 +79,7 @@ status_t ocl_gpu_device_info_t::init_runtime_version(engine_t *engine) {
     err = clGetDeviceInfo(
             device, CL_DRIVER_VERSION, param_size, &driver_version[0], nullptr);
     OCL_CHECK(err);
+    driver_version_ = driver_version.c_str();
 
     if (runtime_version_.set_from_string(&driver_version[0])
             != status::success) {
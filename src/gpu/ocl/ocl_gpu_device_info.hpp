@@ -33,12 +33,19 @@ class ocl_gpu_device_info_t : public compute::device_info_t {
 public:
     std::string get_cl_ext_options() const;
 
+    // Full CL_DRIVER_VERSION string, unlike runtime_version() it is never
+    // truncated to the parsed numbers.
+    const std::string &driver_version() const { return driver_version_; }
+
 protected:
     status_t init_device_name(engine_t *engine);
     status_t init_arch(engine_t *engine);
     status_t init_runtime_version(engine_t *engine);
     status_t init_extensions(engine_t *engine);
     status_t init_attributes(engine_t *engine);
+
+private:
+    std::string driver_version_;
 };
 
 } // namespace ocl
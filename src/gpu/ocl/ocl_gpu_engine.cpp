@@ -18,6 +18,8 @@
 
 #include "gpu/ocl/ocl_gpu_engine.hpp"
 
+#include "common/cache_blob.hpp"
+#include "common/persistent_cache.hpp"
 #include "common/type_helpers.hpp"
 #include "common/utils.hpp"
 #include "gpu/compute/kernel_list.hpp"
@@ -138,25 +140,15 @@ static status_t get_program_binaries(
     return status::success;
 }
 
-status_t ocl_gpu_engine_t::create_kernels_from_ocl_source(
-        std::vector<compute::kernel_t> *kernels,
-        const std::vector<const char *> &kernel_names,
-        const char **code_strings,
-        const compute::kernel_ctx_t &kernel_ctx) const {
-    std::string options = kernel_ctx.options();
-
-    // XXX: Update options by adding macros for OpenCL extensions that are not
-    // handled properly by the OpenCL runtime
-    auto *dev_info
-            = utils::downcast<const ocl_gpu_device_info_t *>(device_info());
-    options += " " + dev_info->get_cl_ext_options();
-
+static status_t build_program_binary(const ocl_gpu_engine_t *engine,
+        const char **code_strings, const std::string &options,
+        std::vector<unsigned char> *binary) {
     cl_int err;
-    cl_program program = clCreateProgramWithSource(
-            context(), count_lines(code_strings), code_strings, nullptr, &err);
+    cl_program program = clCreateProgramWithSource(engine->context(),
+            count_lines(code_strings), code_strings, nullptr, &err);
     OCL_CHECK(err);
 
-    cl_device_id dev = device();
+    cl_device_id dev = engine->device();
     err = clBuildProgram(program, 1, &dev, options.c_str(), nullptr, nullptr);
     if (err != CL_SUCCESS) {
         // Return error if verbose is not enabled.
@@ -177,17 +169,58 @@ status_t ocl_gpu_engine_t::create_kernels_from_ocl_source(
         OCL_CHECK(err);
     }
 
+    status_t status = get_program_binaries(program, binary);
+    OCL_CHECK(clReleaseProgram(program));
+    return status;
+}
+
+status_t ocl_gpu_engine_t::create_kernels_from_ocl_source(
+        std::vector<compute::kernel_t> *kernels,
+        const std::vector<const char *> &kernel_names,
+        const char **code_strings,
+        const compute::kernel_ctx_t &kernel_ctx) const {
+    std::string options = kernel_ctx.options();
+
+    // XXX: Update options by adding macros for OpenCL extensions that are not
+    // handled properly by the OpenCL runtime
+    auto *dev_info
+            = utils::downcast<const ocl_gpu_device_info_t *>(device_info());
+    options += " " + dev_info->get_cl_ext_options();
+
+    // The program binary depends on the device, the driver, the build options
+    // and the source code, so all of them are a part of the key. Devices of
+    // one family may share the name, so the architecture and the EU count
+    // are added to tell them apart.
+    std::string cache_key = "ocl:" + std::string(dev_info->name().c_str())
+            + ":" + std::to_string((int)dev_info->gpu_arch()) + ":"
+            + std::to_string(dev_info->eu_count()) + ":"
+            + dev_info->driver_version() + ":" + options + ":";
+    for (const char **s = code_strings; *s; ++s)
+        cache_key += *s;
+    const uint64_t key_hash = cache_blob_t::hash_key(cache_key);
+
     std::vector<unsigned char> binary;
-    CHECK(get_program_binaries(program, &binary));
+    if (const cache_blob_t *cache_blob = active_cache_blob()) {
+        if (auto *b = cache_blob->find(key_hash)) binary = *b;
+    }
+    if (binary.empty() && persistent_cache::is_enabled()) {
+        if (persistent_cache::load(cache_key, binary) != status::success)
+            binary.clear();
+    }
+
+    if (binary.empty()) {
+        CHECK(build_program_binary(this, code_strings, options, &binary));
+        if (persistent_cache::is_enabled())
+            persistent_cache::store(cache_key, binary);
+    }
 
     *kernels = std::vector<compute::kernel_t>(kernel_names.size());
     for (size_t i = 0; i < kernel_names.size(); ++i) {
         (*kernels)[i] = compute::kernel_t(
-                new ocl_gpu_kernel_t(binary, kernel_names[i]));
+                new ocl_gpu_kernel_t(binary, kernel_names[i], key_hash));
         dump_kernel_binary(this, (*kernels)[i]);
     }
 
-    OCL_CHECK(clReleaseProgram(program));
     return status::success;
 }
 
@@ -14,6 +14,7 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
 #include <assert.h>
 #include <string>
 #include <CL/cl.h>
@@ -34,19 +35,32 @@ ocl_gpu_kernel_t::~ocl_gpu_kernel_t() {
     if (ocl_kernel_) OCL_CHECK_V(clReleaseKernel(ocl_kernel_));
 }
 
-status_t ocl_gpu_kernel_t::parallel_for(stream_t &stream,
-        const compute::nd_range_t &range,
-        const compute::kernel_arg_list_t &arg_list) const {
-    assert(state_ == state_t::kernel);
-
-    auto *ocl_stream = utils::downcast<ocl_stream_t *>(&stream);
-    cl_command_queue queue = ocl_stream->queue();
+namespace {
+// Returns true if the argument holds the value already, and records the value
+// otherwise
+template <typename state_t>
+bool is_arg_set(state_t *state, const void *value, size_t size) {
+    if (!state) return false;
+    auto *bytes = static_cast<const unsigned char *>(value);
+    if (state->is_set && state->value.size() == size
+            && std::equal(bytes, bytes + size, state->value.begin()))
+        return true;
+    state->value.assign(bytes, bytes + size);
+    state->is_set = true;
+    return false;
+}
+} // namespace
 
-    assert(ocl_kernel_ && "kernel is NULL");
+status_t ocl_gpu_kernel_t::set_kernel_args(cl_kernel kernel,
+        stream_t &stream, const compute::kernel_arg_list_t &arg_list,
+        std::vector<arg_state_t> *arg_states) {
+    if (arg_states && (int)arg_states->size() < arg_list.nargs())
+        arg_states->resize(arg_list.nargs());
 
     for (int i = 0; i < arg_list.nargs(); ++i) {
         auto &arg = arg_list.get(i);
-        cl_int set_err;
+        auto *state = arg_states ? &(*arg_states)[i] : nullptr;
+        cl_int set_err = CL_SUCCESS;
         if (arg.is_global()) {
             auto *mem_storage
                     = static_cast<const memory_storage_t *>(arg.value());
@@ -73,37 +87,89 @@ status_t ocl_gpu_kernel_t::parallel_for(stream_t &stream,
 
                 ocl_mem = ocl_mem_storage->mem_object();
             }
-            set_err = clSetKernelArg(ocl_kernel_, i, sizeof(cl_mem), &ocl_mem);
+            set_err = clSetKernelArg(kernel, i, sizeof(cl_mem), &ocl_mem);
+            if (state) state->is_set = false;
         } else if (arg.is_local()) {
-            set_err = clSetKernelArg(ocl_kernel_, i, arg.size(), arg.value());
+            const size_t size = arg.size();
+            if (!is_arg_set(state, &size, sizeof(size)))
+                set_err = clSetKernelArg(kernel, i, size, nullptr);
         } else if (arg.is_svm_pointer()) {
 #ifdef CL_VERSION_2_0
-            set_err = clSetKernelArgSVMPointer(ocl_kernel_, i, arg.value());
+            set_err = clSetKernelArgSVMPointer(kernel, i, arg.value());
+            if (state) state->is_set = false;
 #else
             return status::runtime_error; // SVM is not supported
 #endif // CL_VERSION_2_0
         } else {
-            compute::scalar_type_t real_arg_type;
-            CHECK(get_ocl_kernel_arg_type(&real_arg_type, ocl_kernel_, i));
+            // The type of the argument is queried once per kernel object
+            compute::scalar_type_t real_arg_type
+                    = state ? state->type : compute::scalar_type_t::undef;
+            if (real_arg_type == compute::scalar_type_t::undef) {
+                CHECK(get_ocl_kernel_arg_type(&real_arg_type, kernel, i));
+                if (state) state->type = real_arg_type;
+            }
             // Convert if types do not match.
             typename std::aligned_storage<sizeof(float), sizeof(float)>::type
                     tmp_storage;
             void *cast_storage = &tmp_storage;
             auto cvt_arg = compute::kernel_arg_t::cast(
                     real_arg_type, arg, cast_storage);
-            set_err = clSetKernelArg(
-                    ocl_kernel_, i, cvt_arg.size(), cvt_arg.value());
+            if (!is_arg_set(state, cvt_arg.value(), cvt_arg.size()))
+                set_err = clSetKernelArg(
+                        kernel, i, cvt_arg.size(), cvt_arg.value());
         }
         status_t status = convert_to_dnnl(set_err);
-        if (status != status::success) return status;
+        if (status != status::success) {
+            if (state) state->is_set = false;
+            return status;
+        }
     }
+    return status::success;
+}
+
+status_t ocl_gpu_kernel_t::parallel_for(stream_t &stream,
+        const compute::nd_range_t &range,
+        const compute::kernel_arg_list_t &arg_list) const {
+    assert(state_ == state_t::kernel);
+
+    auto *ocl_stream = utils::downcast<ocl_stream_t *>(&stream);
+    cl_command_queue queue = ocl_stream->queue();
+
+    assert(ocl_kernel_ && "kernel is NULL");
+
+    std::lock_guard<std::mutex> guard(mutex_);
+    CHECK(set_kernel_args(ocl_kernel_, stream, arg_list, &arg_states_));
 
     cl_uint ndims = static_cast<cl_uint>(range.ndims());
     if (range.is_zero()) { return status::success; }
-    cl_int err = clEnqueueNDRangeKernel(queue, ocl_kernel_, ndims, nullptr,
-            range.global_range(), range.local_range(), 0, nullptr, nullptr);
-    status_t status = convert_to_dnnl(err);
-    return status;
+
+    if (ocl_stream->is_capturing()) {
+        // The kernel object is shared by all the executions of the
+        // primitive, so the recorded launch gets its own one
+        cl_program program;
+        OCL_CHECK(clGetKernelInfo(ocl_kernel_, CL_KERNEL_PROGRAM,
+                sizeof(program), &program, nullptr));
+        size_t name_size;
+        OCL_CHECK(clGetKernelInfo(ocl_kernel_, CL_KERNEL_FUNCTION_NAME, 0,
+                nullptr, &name_size));
+        std::string name(name_size, '\0');
+        OCL_CHECK(clGetKernelInfo(ocl_kernel_, CL_KERNEL_FUNCTION_NAME,
+                name_size, &name[0], nullptr));
+        cl_int err;
+        auto captured_kernel
+                = make_ocl_wrapper(clCreateKernel(program, name.c_str(), &err));
+        OCL_CHECK(err);
+        CHECK(set_kernel_args(captured_kernel, stream, arg_list, nullptr));
+        ocl_stream->capture_kernel(captured_kernel, range);
+    }
+
+    return ocl_stream->enqueue(
+            [&](cl_uint n, const cl_event *wait_list, cl_event *event) {
+                return clEnqueueNDRangeKernel(queue, ocl_kernel_, ndims,
+                        nullptr, range.global_range(), range.local_range(), n,
+                        wait_list, event);
+            },
+            /* is_kernel = */ true);
 }
 
 status_t ocl_gpu_kernel_t::realize(
@@ -18,7 +18,9 @@
 #define GPU_OCL_OCL_GPU_KERNEL_HPP
 
 #include <assert.h>
+#include <mutex>
 #include <string>
+#include <vector>
 #include <CL/cl.h>
 
 #include "gpu/compute/compute.hpp"
@@ -32,11 +34,12 @@ namespace ocl {
 class ocl_gpu_kernel_t : public compute::kernel_impl_t {
 public:
     ocl_gpu_kernel_t(const std::vector<unsigned char> &binary,
-            const std::string &binary_name)
+            const std::string &binary_name, uint64_t binary_key_hash = 0)
         : state_(state_t::binary)
         , ocl_kernel_(nullptr)
         , binary_(binary)
-        , binary_name_(binary_name) {
+        , binary_name_(binary_name)
+        , binary_key_hash_(binary_key_hash) {
         MAYBE_UNUSED(state_);
     }
 
@@ -53,6 +56,12 @@ public:
     status_t realize(
             compute::kernel_t *kernel, const engine_t *engine) const override;
 
+    status_t get_cache_blob(cache_blob_t &cache_blob) const override {
+        if (state_ == state_t::binary && binary_key_hash_ != 0)
+            cache_blob.add(binary_key_hash_, binary_);
+        return status::success;
+    }
+
     const char *name() const {
         assert(state_ == state_t::binary);
         return binary_name_.c_str();
@@ -63,16 +72,40 @@ public:
         return binary_;
     }
 
+    // Hash of the key the binary was built with, 0 if it has no key
+    uint64_t binary_key_hash() const { return binary_key_hash_; }
+
     enum class state_t { binary, kernel };
 
 protected:
     ocl_gpu_kernel_t(cl_kernel ocl_kernel)
         : state_(state_t::kernel), ocl_kernel_(ocl_kernel) {}
 
+    // The arguments of an OpenCL kernel persist between the enqueues, so a
+    // scalar or a local argument is set again only when its value changes.
+    // The memory arguments are always set: a released buffer handle may be
+    // reused by a new buffer.
+    struct arg_state_t {
+        bool is_set = false;
+        compute::scalar_type_t type = compute::scalar_type_t::undef;
+        std::vector<unsigned char> value; // the local size for local args
+    };
+
+    // Skips the unchanged arguments when `arg_states` is not null
+    static status_t set_kernel_args(cl_kernel kernel, stream_t &stream,
+            const compute::kernel_arg_list_t &arg_list,
+            std::vector<arg_state_t> *arg_states);
+
     state_t state_;
     cl_kernel ocl_kernel_;
     std::vector<unsigned char> binary_;
     std::string binary_name_;
+    uint64_t binary_key_hash_ = 0;
+
+    // Guards the arguments of the kernel object, which is shared by all the
+    // executions of the primitive, until the kernel is enqueued
+    mutable std::mutex mutex_;
+    mutable std::vector<arg_state_t> arg_states_;
 };
 
 } // namespace ocl
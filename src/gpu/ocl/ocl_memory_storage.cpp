@@ -45,6 +45,9 @@ status_t get_map_queue(
         if (status != status::success) { return status::runtime_error; }
     }
     ocl_stream = utils::downcast<ocl_stream_t *>(stream);
+    // The blocking commands of an out-of-order queue do not wait for the
+    // previously enqueued ones
+    if (ocl_stream->is_out_of_order()) CHECK(ocl_stream->wait());
     queue = ocl_stream->queue();
     return status::success;
 }
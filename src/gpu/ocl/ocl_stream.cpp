@@ -14,10 +14,15 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <stdio.h>
 #include <CL/cl.h>
 
 #include "gpu/ocl/ocl_stream.hpp"
 
+#include "common/memory.hpp"
+#include "common/primitive.hpp"
+#include "common/primitive_desc.hpp"
+#include "common/verbose.hpp"
 #include "gpu/ocl/ocl_memory_storage.hpp"
 #include "gpu/ocl/ocl_utils.hpp"
 
@@ -26,6 +31,68 @@ namespace impl {
 namespace gpu {
 namespace ocl {
 
+namespace {
+struct event_times_t {
+    cl_ulong queued, start, end;
+};
+
+status_t get_event_times(cl_event event, event_times_t &times) {
+    OCL_CHECK(clGetEventProfilingInfo(event, CL_PROFILING_COMMAND_QUEUED,
+            sizeof(cl_ulong), &times.queued, nullptr));
+    OCL_CHECK(clGetEventProfilingInfo(event, CL_PROFILING_COMMAND_START,
+            sizeof(cl_ulong), &times.start, nullptr));
+    OCL_CHECK(clGetEventProfilingInfo(event, CL_PROFILING_COMMAND_END,
+            sizeof(cl_ulong), &times.end, nullptr));
+    return status::success;
+}
+
+// Returns the device time and the overhead of a primitive execution
+status_t get_exec_times(const std::vector<cl_event> &events,
+        uint64_t &device_ns, uint64_t &overhead_ns) {
+    device_ns = overhead_ns = 0;
+    if (events.empty()) return status::success;
+
+    OCL_CHECK(clWaitForEvents((cl_uint)events.size(), events.data()));
+    cl_ulong first_queued = 0, last_end = 0;
+    for (size_t i = 0; i < events.size(); i++) {
+        event_times_t t;
+        CHECK(get_event_times(events[i], t));
+        device_ns += t.end - t.start;
+        if (i == 0) first_queued = t.queued;
+        last_end = nstl::max(last_end, t.end);
+    }
+    overhead_ns = last_end - first_queued - device_ns;
+    return status::success;
+}
+
+// Sub-buffers are tracked as their parent buffers
+cl_mem get_root_mem(cl_mem mem) {
+    cl_mem parent = nullptr;
+    cl_int err = clGetMemObjectInfo(mem, CL_MEM_ASSOCIATED_MEMOBJECT,
+            sizeof(parent), &parent, nullptr);
+    return err == CL_SUCCESS && parent != nullptr ? parent : mem;
+}
+
+template <typename events_t>
+void append_events(events_t &to, const events_t &from) {
+    to.insert(to.end(), from.begin(), from.end());
+}
+
+// Drops the completed events so that the read lists of the memory objects
+// used by many primitives, e.g. weights, do not grow indefinitely
+template <typename events_t>
+void prune_completed_events(events_t &events) {
+    events_t pending;
+    for (auto &e : events) {
+        cl_int status = CL_QUEUED;
+        clGetEventInfo(e, CL_EVENT_COMMAND_EXECUTION_STATUS, sizeof(status),
+                &status, nullptr);
+        if (status != CL_COMPLETE) pending.push_back(e);
+    }
+    events = std::move(pending);
+}
+} // namespace
+
 status_t ocl_stream_t::init() {
     // Restore queue on successful exit, otherwise queue may be released
     // without retain
@@ -34,22 +101,32 @@ status_t ocl_stream_t::init() {
 
     assert(engine()->kind() == engine_kind::gpu);
 
-    // Out-of-order is not supported
-    bool args_ok = (flags() & stream_flags::out_of_order) == 0;
-    if (!args_ok) return status::unimplemented;
-
     ocl_gpu_engine_t *ocl_engine
             = utils::downcast<ocl_gpu_engine_t *>(engine());
 
     // Create queue if it is not set
     if (!queue) {
+        cl_command_queue_properties queue_props = 0;
+        if (is_profiling_enabled()) queue_props |= CL_QUEUE_PROFILING_ENABLE;
+        if (is_out_of_order()) {
+            cl_command_queue_properties dev_props;
+            OCL_CHECK(clGetDeviceInfo(ocl_engine->device(),
+                    CL_DEVICE_QUEUE_PROPERTIES, sizeof(dev_props), &dev_props,
+                    nullptr));
+            if (!(dev_props & CL_QUEUE_OUT_OF_ORDER_EXEC_MODE_ENABLE))
+                return status::unimplemented;
+            queue_props |= CL_QUEUE_OUT_OF_ORDER_EXEC_MODE_ENABLE;
+        }
+
         cl_int err;
 #ifdef CL_VERSION_2_0
+        cl_queue_properties props[]
+                = {CL_QUEUE_PROPERTIES, (cl_queue_properties)queue_props, 0};
         queue = clCreateCommandQueueWithProperties(
-                ocl_engine->context(), ocl_engine->device(), nullptr, &err);
+                ocl_engine->context(), ocl_engine->device(), props, &err);
 #else
-        queue = clCreateCommandQueue(
-                ocl_engine->context(), ocl_engine->device(), 0, &err);
+        queue = clCreateCommandQueue(ocl_engine->context(),
+                ocl_engine->device(), queue_props, &err);
 #endif
         OCL_CHECK(err);
     } else {
@@ -71,11 +148,226 @@ status_t ocl_stream_t::init() {
     return status::success;
 }
 
+status_t ocl_stream_t::enqueue_primitive(
+        const primitive_iface_t *primitive_iface, exec_ctx_t &ctx) {
+    if (!is_out_of_order())
+        return compute_stream_t::enqueue_primitive(primitive_iface, ctx);
+
+    // Memory objects of the arguments and whether they are written
+    std::vector<std::pair<cl_mem, bool>> mems;
+    for (const auto &arg : ctx.args()) {
+        const memory_t *mem = arg.second.mem;
+        if (mem == nullptr || mem->engine() != engine()) continue;
+        auto *storage = utils::downcast<const ocl_memory_storage_t *>(
+                mem->memory_storage());
+        if (storage->mem_object() == nullptr) continue;
+        mems.emplace_back(
+                get_root_mem(storage->mem_object()), !arg.second.is_const);
+    }
+    // Scratchpads may be shared by the primitives
+    const bool use_scratchpad
+            = primitive_iface->pd()->impl()->scratchpad_registry().size() > 0;
+
+    deps_.clear();
+    for (const auto &m : mems) {
+        auto it = mem_deps_.find(m.first);
+        if (it == mem_deps_.end()) continue;
+        append_events(deps_, it->second.write);
+        if (m.second) append_events(deps_, it->second.reads);
+    }
+    if (use_scratchpad) append_events(deps_, scratchpad_deps_);
+
+    status_t status = compute_stream_t::enqueue_primitive(primitive_iface, ctx);
+
+    // The dependencies now are the events of the last commands of the
+    // execution, or of its own dependencies if nothing was enqueued
+    for (const auto &m : mems) {
+        auto &md = mem_deps_[m.first];
+        if (m.second) {
+            md.write = deps_;
+            md.reads.clear();
+        } else {
+            prune_completed_events(md.reads);
+            append_events(md.reads, deps_);
+        }
+    }
+    if (use_scratchpad) scratchpad_deps_ = deps_;
+    return status;
+}
+
+status_t ocl_stream_t::enqueue(const enqueue_func_t &f, bool is_kernel) {
+    const bool profile = is_kernel && is_profiling_enabled();
+    const bool ooo = is_out_of_order();
+    const bool ooo_in_exec = ooo && in_exec_;
+
+    if (ooo && !ooo_in_exec)
+        OCL_CHECK(clEnqueueBarrierWithWaitList(queue_, 0, nullptr, nullptr));
+
+    std::vector<cl_event> wait_list;
+    if (ooo_in_exec)
+        for (const auto &e : deps_)
+            wait_list.push_back(e);
+
+    cl_event event = nullptr;
+    OCL_CHECK(f((cl_uint)wait_list.size(),
+            wait_list.empty() ? nullptr : wait_list.data(),
+            (profile || ooo_in_exec) ? &event : nullptr));
+
+    if (ooo_in_exec) deps_ = {ocl_wrapper_t<cl_event>(event, profile)};
+    if (profile) register_profiling_event(event);
+
+    if (ooo && !ooo_in_exec)
+        OCL_CHECK(clEnqueueBarrierWithWaitList(queue_, 0, nullptr, nullptr));
+    return status::success;
+}
+
+status_t ocl_stream_t::begin_capture() {
+    captured_commands_.clear();
+    recorded_commands_.clear();
+    capture_status_ = status::success;
+    is_capturing_ = true;
+    return status::success;
+}
+
+status_t ocl_stream_t::end_capture() {
+    if (!is_capturing_) return status::invalid_arguments;
+    is_capturing_ = false;
+    if (capture_status_ != status::success) {
+        captured_commands_.clear();
+        return capture_status_;
+    }
+    recorded_commands_ = std::move(captured_commands_);
+    captured_commands_.clear();
+    return status::success;
+}
+
+status_t ocl_stream_t::replay() {
+    if (is_capturing_) return status::invalid_arguments;
+    for (const auto &c : recorded_commands_) {
+        if (c.kernel) {
+            const auto &range = c.range;
+            CHECK(enqueue(
+                    [&](cl_uint n, const cl_event *wait_list, cl_event *event) {
+                        return clEnqueueNDRangeKernel(queue_, c.kernel,
+                                (cl_uint)range.ndims(), nullptr,
+                                range.global_range(), range.local_range(), n,
+                                wait_list, event);
+                    },
+                    /* is_kernel = */ true));
+        } else {
+            CHECK(enqueue([&](cl_uint n, const cl_event *wait_list,
+                                  cl_event *event) {
+                return clEnqueueFillBuffer(queue_, c.mem, &c.pattern,
+                        sizeof(uint8_t), c.offset, c.size, n, wait_list, event);
+            }));
+        }
+    }
+    return status::success;
+}
+
+void ocl_stream_t::capture_kernel(const ocl_wrapper_t<cl_kernel> &kernel,
+        const compute::nd_range_t &range) {
+    captured_command_t c;
+    c.kernel = kernel;
+    c.range = range;
+    captured_commands_.push_back(c);
+}
+
+void ocl_stream_t::capture_fill(
+        cl_mem mem, uint8_t pattern, size_t offset, size_t size) {
+    captured_command_t c;
+    c.mem = ocl_wrapper_t<cl_mem>(mem, /* retain = */ true);
+    c.pattern = pattern;
+    c.offset = offset;
+    c.size = size;
+    captured_commands_.push_back(c);
+}
+
+void ocl_stream_t::before_exec_hook() {
+    in_exec_ = true;
+    if (is_profiling_enabled()) profiling_events_.emplace_back();
+}
+
+void ocl_stream_t::after_exec_hook() {
+    in_exec_ = false;
+    if (!is_profiling_enabled()) return;
+    // The verbose mode waits for the primitive to complete before the hook
+    if (get_verbose() < 2) return;
+
+    for (cl_event event : profiling_events_.back()) {
+        char name[256] = {0};
+        event_times_t t;
+        cl_kernel kernel;
+        if (clGetEventInfo(event, CL_EVENT_KERNEL, sizeof(kernel), &kernel,
+                    nullptr)
+                        != CL_SUCCESS
+                || clGetKernelInfo(kernel, CL_KERNEL_FUNCTION_NAME,
+                           sizeof(name) - 1, name, nullptr)
+                        != CL_SUCCESS
+                || get_event_times(event, t) != status::success)
+            continue;
+        const double overhead_ms = (t.start - t.queued) * 1e-6;
+        const double device_ms = (t.end - t.start) * 1e-6;
+        if (get_verbose_json()) {
+            std::string s = "{\"event\":\"exec_kernel\"";
+            verbose_json_append(s, "kernel", name);
+            verbose_printf("%s,\"overhead_ms\":%g,\"time_ms\":%g}\n",
+                    s.c_str(), overhead_ms, device_ms);
+        } else {
+            verbose_printf("dnnl_verbose,exec:kernel,%s,%g,%g\n", name,
+                    overhead_ms, device_ms);
+        }
+    }
+}
+
+void ocl_stream_t::register_profiling_event(cl_event event) {
+    // Kernels enqueued outside of the primitive executions, e.g. zero
+    // padding, are accounted for separately
+    if (!in_exec_ || profiling_events_.empty())
+        profiling_events_.emplace_back();
+    profiling_events_.back().push_back(event);
+}
+
+void ocl_stream_t::release_profiling_events() {
+    for (auto &events : profiling_events_)
+        for (cl_event event : events)
+            clReleaseEvent(event);
+    profiling_events_.clear();
+}
+
+status_t ocl_stream_t::reset_profiling() {
+    CHECK(wait());
+    release_profiling_events();
+    return status::success;
+}
+
+status_t ocl_stream_t::get_profiling_data(profiling_data_kind_t data_kind,
+        int *num_entries, uint64_t *data) {
+    const int n = (int)profiling_events_.size();
+    if (data == nullptr) {
+        *num_entries = n;
+        return status::success;
+    }
+
+    const int n_copy = nstl::min(*num_entries, n);
+    for (int i = 0; i < n_copy; i++) {
+        uint64_t device_ns, overhead_ns;
+        CHECK(get_exec_times(profiling_events_[i], device_ns, overhead_ns));
+        data[i] = data_kind == profiling_data_kind::time ? device_ns
+                                                          : overhead_ns;
+    }
+    *num_entries = n;
+    return status::success;
+}
+
 status_t ocl_stream_t::copy(
         const memory_storage_t &src, const memory_storage_t &dst, size_t size) {
 
     if (size == 0) return status::success;
 
+    // The host memory and the mapping cannot be recorded
+    if (is_capturing_) capture_status_ = status::unimplemented;
+
     if (src.engine()->kind() == engine_kind::cpu
             && is_native_runtime(src.engine()->runtime_kind())) {
         assert(dst.engine()->kind() == engine_kind::gpu);
@@ -85,9 +377,11 @@ status_t ocl_stream_t::copy(
 
         auto &ocl_dst = *utils::downcast<const ocl_memory_storage_t *>(&dst);
         cl_mem ocl_mem = ocl_dst.mem_object();
-        cl_int err = clEnqueueWriteBuffer(queue(), ocl_mem, CL_TRUE, 0, size,
-                src_ptr, 0, nullptr, nullptr);
-        OCL_CHECK(err);
+        CHECK(enqueue([&](cl_uint n, const cl_event *wait_list,
+                              cl_event *event) {
+            return clEnqueueWriteBuffer(queue(), ocl_mem, CL_TRUE, 0, size,
+                    src_ptr, n, wait_list, event);
+        }));
     } else if (dst.engine()->kind() == engine_kind::cpu
             && is_native_runtime(dst.engine()->runtime_kind())) {
         assert(src.engine()->kind() == engine_kind::gpu);
@@ -97,9 +391,11 @@ status_t ocl_stream_t::copy(
 
         auto &ocl_src = *utils::downcast<const ocl_memory_storage_t *>(&src);
         cl_mem ocl_mem = ocl_src.mem_object();
-        cl_int err = clEnqueueReadBuffer(queue(), ocl_mem, CL_TRUE, 0, size,
-                dst_ptr, 0, nullptr, nullptr);
-        OCL_CHECK(err);
+        CHECK(enqueue([&](cl_uint n, const cl_event *wait_list,
+                              cl_event *event) {
+            return clEnqueueReadBuffer(queue(), ocl_mem, CL_TRUE, 0, size,
+                    dst_ptr, n, wait_list, event);
+        }));
     } else {
         wait();
 
@@ -122,10 +418,12 @@ status_t ocl_stream_t::copy(
 status_t ocl_stream_t::fill(
         const memory_storage_t &dst, uint8_t pattern, size_t size) {
     auto &ocl_dst = *utils::downcast<const ocl_memory_storage_t *>(&dst);
-    cl_int err = clEnqueueFillBuffer(queue(), ocl_dst.mem_object(), &pattern,
-            sizeof(uint8_t), dst.offset(), size, 0, nullptr, nullptr);
-    OCL_CHECK(err);
-    return status::success;
+    if (is_capturing_)
+        capture_fill(ocl_dst.mem_object(), pattern, dst.offset(), size);
+    return enqueue([&](cl_uint n, const cl_event *wait_list, cl_event *event) {
+        return clEnqueueFillBuffer(queue(), ocl_dst.mem_object(), &pattern,
+                sizeof(uint8_t), dst.offset(), size, n, wait_list, event);
+    });
 }
 
 } // namespace ocl
@@ -17,7 +17,10 @@
 #ifndef GPU_OCL_OCL_STREAM_HPP
 #define GPU_OCL_OCL_STREAM_HPP
 
+#include <functional>
 #include <memory>
+#include <unordered_map>
+#include <vector>
 
 #include "common/c_types_map.hpp"
 #include "common/utils.hpp"
@@ -64,19 +67,62 @@ struct ocl_stream_t : public compute::compute_stream_t {
 
     status_t wait() override {
         OCL_CHECK(clFinish(queue_));
+        // All the tracked commands are complete
+        deps_.clear();
+        mem_deps_.clear();
+        scratchpad_deps_.clear();
         return status::success;
     }
 
     cl_command_queue queue() const { return queue_; }
 
+    bool is_out_of_order() const {
+        return flags() & stream_flags::out_of_order;
+    }
+
+    status_t enqueue_primitive(const primitive_iface_t *primitive_iface,
+            exec_ctx_t &ctx) override;
+
+    // Enqueues an OpenCL command with `f(num_events, wait_list, event)`
+    // ordered after the commands it depends on. On out-of-order streams
+    // the commands of a primitive execution run one after another, after
+    // the previous executions accessing the same memory objects, while the
+    // commands outside of the executions are surrounded by barriers.
+    using enqueue_func_t
+            = std::function<cl_int(cl_uint, const cl_event *, cl_event *)>;
+    status_t enqueue(const enqueue_func_t &f, bool is_kernel = false);
+
+    status_t begin_capture() override;
+    status_t end_capture() override;
+    status_t replay() override;
+
+    // Recording of the commands enqueued between begin_capture() and
+    // end_capture(). The recorded kernels have their own copies of the
+    // kernel objects with the arguments of the captured launches.
+    bool is_capturing() const { return is_capturing_; }
+    void capture_kernel(const ocl_wrapper_t<cl_kernel> &kernel,
+            const compute::nd_range_t &range);
+    void capture_fill(cl_mem mem, uint8_t pattern, size_t offset, size_t size);
+
     status_t copy(const memory_storage_t &src, const memory_storage_t &dst,
             size_t size) override;
 
     status_t fill(
             const memory_storage_t &dst, uint8_t pattern, size_t size) override;
 
+    void before_exec_hook() override;
+    void after_exec_hook() override;
+
+    // Events of the kernels enqueued on a profiling stream, grouped by the
+    // primitive executions
+    void register_profiling_event(cl_event event);
+    status_t reset_profiling() override;
+    status_t get_profiling_data(profiling_data_kind_t data_kind,
+            int *num_entries, uint64_t *data) override;
+
     ~ocl_stream_t() {
         wait();
+        release_profiling_events();
         if (queue_) { clReleaseCommandQueue(queue_); }
     }
 
@@ -97,12 +143,45 @@ private:
         *flags |= (props & CL_QUEUE_OUT_OF_ORDER_EXEC_MODE_ENABLE)
                 ? stream_flags::out_of_order
                 : stream_flags::in_order;
+        if (props & CL_QUEUE_PROFILING_ENABLE)
+            *flags |= stream_flags::profiling;
 
         return status::success;
     }
 
+    void release_profiling_events();
+
 private:
+    using events_t = std::vector<ocl_wrapper_t<cl_event>>;
+
+    // Events of the last execution writing a memory object and of the
+    // executions reading it since then
+    struct mem_deps_t {
+        events_t write;
+        events_t reads;
+    };
+
+    // A kernel launch or, when the kernel is null, a buffer fill
+    struct captured_command_t {
+        ocl_wrapper_t<cl_kernel> kernel;
+        compute::nd_range_t range;
+        ocl_wrapper_t<cl_mem> mem;
+        uint8_t pattern;
+        size_t offset, size;
+    };
+
     cl_command_queue queue_;
+    std::vector<std::vector<cl_event>> profiling_events_;
+    bool in_exec_ = false;
+
+    events_t deps_;
+    std::unordered_map<cl_mem, mem_deps_t> mem_deps_;
+    events_t scratchpad_deps_;
+
+    bool is_capturing_ = false;
+    status_t capture_status_ = status::success;
+    std::vector<captured_command_t> captured_commands_;
+    std::vector<captured_command_t> recorded_commands_;
 };
 
 } // namespace ocl
@@ -101,8 +101,8 @@ status_t ref_binary_t::pd_t::init_conf(engine_t *engine) {
     return status::success;
 }
 
-status_t ref_binary_t::pd_t::init_kernel_ctx(
-        compute::kernel_ctx_t &kernel_ctx) const {
+status_t ref_binary_t::pd_t::init_kernel_ctx(compute::kernel_ctx_t &kernel_ctx,
+        const compute::dispatch_t &dispatch) const {
     kernel_ctx.set_data_type(conf.src0_data_type);
     kernel_ctx.set_data_type(conf.src1_data_type);
     kernel_ctx.set_data_type(conf.dst_data_type);
@@ -134,11 +134,26 @@ status_t ref_binary_t::pd_t::init_kernel_ctx(
 
     def_attr_info(kernel_ctx, conf.attr_info);
 
-    def_dispatch(kernel_ctx, conf.dispatch);
+    def_dispatch(kernel_ctx, dispatch);
 
     return status::success;
 }
 
+void ref_binary_t::pd_t::init_tuning_args(
+        compute::dispatch_tuner_t &tuner) const {
+    if (conf.with_binary_post_op) {
+        tuner.disable();
+        return;
+    }
+    tuner.set_buffer_arg(0, memory_desc_wrapper(src_md(0)).size());
+    tuner.set_buffer_arg(1, memory_desc_wrapper(src_md(1)).size());
+    tuner.set_buffer_arg(2, memory_desc_wrapper(dst_md()).size());
+    int arg_idx = append_post_ops_to_arg_list(
+            tuner.arg_list(), 3, conf.attr_info.all_post_ops);
+    tuner.arg_list().set(arg_idx++, conf.attr_info.src0_scale);
+    tuner.arg_list().set(arg_idx, conf.attr_info.src1_scale);
+}
+
 status_t ref_binary_t::execute_ref(const exec_ctx_t &ctx) const {
 
     auto &src0 = CTX_IN_STORAGE(DNNL_ARG_SRC_0);
@@ -161,7 +176,7 @@ status_t ref_binary_t::execute_ref(const exec_ctx_t &ctx) const {
     arg_list.set(arg_idx++, src0_scale);
     arg_list.set(arg_idx, src1_scale);
 
-    auto nd_range = conf.dispatch.nd_range();
+    auto nd_range = dispatch_.nd_range();
 
     status_t status = parallel_for(ctx, nd_range, kernel_, arg_list);
     return status;
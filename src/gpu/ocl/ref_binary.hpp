@@ -66,7 +66,12 @@ struct ref_binary_t : public gpu_primitive_t {
         }
 
         status_t init_conf(engine_t *engine);
-        status_t init_kernel_ctx(compute::kernel_ctx_t &kernel_ctx) const;
+        status_t init_kernel_ctx(compute::kernel_ctx_t &kernel_ctx) const {
+            return init_kernel_ctx(kernel_ctx, conf.dispatch);
+        }
+        status_t init_kernel_ctx(compute::kernel_ctx_t &kernel_ctx,
+                const compute::dispatch_t &dispatch) const;
+        void init_tuning_args(compute::dispatch_tuner_t &tuner) const;
 
         bool with_scales(int position) const {
             return !attr()->scales_.get(position).has_default_values();
@@ -132,12 +137,15 @@ struct ref_binary_t : public gpu_primitive_t {
     ref_binary_t(const pd_t *apd) : gpu_primitive_t(apd) {}
 
     status_t init(engine_t *engine) override {
-        compute::kernel_ctx_t kernel_ctx;
-
-        auto status = pd()->init_kernel_ctx(kernel_ctx);
-        if (status != status::success) return status;
-
-        create_kernel(engine, &kernel_, "ref_binary", kernel_ctx);
+        dispatch_ = pd()->conf.dispatch;
+        compute::dispatch_tuner_t tuner("ref_binary",
+                [&](compute::kernel_ctx_t &kernel_ctx,
+                        const compute::dispatch_t &dispatch) {
+                    return pd()->init_kernel_ctx(kernel_ctx, dispatch);
+                });
+        pd()->init_tuning_args(tuner);
+
+        create_kernel(engine, &kernel_, tuner, dispatch_);
         if (!kernel_) return status::runtime_error;
 
         return status::success;
@@ -151,6 +159,7 @@ private:
     status_t execute_ref(const exec_ctx_t &ctx) const;
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
     compute::kernel_t kernel_;
+    compute::dispatch_t dispatch_;
 };
 
 } // namespace ocl
@@ -116,7 +116,9 @@ struct ref_deconvolution_fwd_t : public gpu_primitive_t {
         status_t init(engine_t *engine) {
             using namespace format_tag;
 
-            const auto attr_skip_mask = primitive_attr_t::skip_mask_t::post_ops;
+            const auto attr_skip_mask
+                    = primitive_attr_t::skip_mask_t::oscale_runtime
+                    | primitive_attr_t::skip_mask_t::post_ops;
 
             bool ok = is_fwd()
                     && desc()->alg_kind == alg_kind::deconvolution_direct
@@ -188,6 +190,9 @@ struct ref_deconvolution_fwd_t : public gpu_primitive_t {
         conv_args[DNNL_ARG_DIFF_SRC] = args.at(DNNL_ARG_DST);
         if (pd()->with_bias())
             conv_args[DNNL_ARG_BIAS] = args.at(DNNL_ARG_BIAS);
+        if (!pd()->attr()->output_scales_.defined())
+            conv_args[DNNL_ARG_ATTR_OUTPUT_SCALES]
+                    = args.at(DNNL_ARG_ATTR_OUTPUT_SCALES);
 
         for (int idx = 0; idx < pd()->attr()->post_ops_.len(); ++idx) {
             if (pd()->attr()->post_ops_.entry_[idx].is_binary()) {
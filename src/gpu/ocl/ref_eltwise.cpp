@@ -65,7 +65,8 @@ static status_t init_conf_common(eltwise_conf_t &conf, offsets_t &off,
 }
 
 static status_t init_kernel_ctx_common(compute::kernel_ctx_t &kernel_ctx,
-        const eltwise_conf_t &conf, const offsets_t &off) {
+        const eltwise_conf_t &conf, const offsets_t &off,
+        const compute::dispatch_t &dispatch) {
     kernel_ctx.set_data_type(conf.data_type);
 
     def_eltwise_alg_kinds(kernel_ctx);
@@ -73,9 +74,9 @@ static status_t init_kernel_ctx_common(compute::kernel_ctx_t &kernel_ctx,
     kernel_ctx.define_int("WITH_ELTWISE", 1);
     kernel_ctx.define_int("ELTWISE_ALG", conf.alg);
     kernel_ctx.define_int("NDIMS", conf.ndims);
-    kernel_ctx.define_int("GWS0", conf.dispatch.nd_range().global_range()[0]);
-    kernel_ctx.define_int("GWS1", conf.dispatch.nd_range().global_range()[1]);
-    kernel_ctx.define_int("GWS2", conf.dispatch.nd_range().global_range()[2]);
+    kernel_ctx.define_int("GWS0", dispatch.nd_range().global_range()[0]);
+    kernel_ctx.define_int("GWS1", dispatch.nd_range().global_range()[1]);
+    kernel_ctx.define_int("GWS2", dispatch.nd_range().global_range()[2]);
     kernel_ctx.define_int("SUB_GROUP_SIZE", 32);
 
     bool with_binary_post_ops
@@ -93,7 +94,7 @@ static status_t init_kernel_ctx_common(compute::kernel_ctx_t &kernel_ctx,
     }
 
     def_attr_info(kernel_ctx, conf.attr_info);
-    def_dispatch(kernel_ctx, conf.dispatch);
+    def_dispatch(kernel_ctx, dispatch);
 
     return status::success;
 }
@@ -103,8 +104,23 @@ status_t ref_eltwise_fwd_t::pd_t::init_conf(engine_t *engine) {
 }
 
 status_t ref_eltwise_fwd_t::pd_t::init_kernel_ctx(
-        compute::kernel_ctx_t &kernel_ctx) const {
-    return init_kernel_ctx_common(kernel_ctx, conf, off);
+        compute::kernel_ctx_t &kernel_ctx,
+        const compute::dispatch_t &dispatch) const {
+    return init_kernel_ctx_common(kernel_ctx, conf, off, dispatch);
+}
+
+void ref_eltwise_fwd_t::pd_t::init_tuning_args(
+        compute::dispatch_tuner_t &tuner) const {
+    if (conf.attr_info.all_post_ops.find(primitive_kind::binary) != -1) {
+        tuner.disable();
+        return;
+    }
+    tuner.set_buffer_arg(0, memory_desc_wrapper(src_md()).size());
+    tuner.set_buffer_arg(1, memory_desc_wrapper(dst_md()).size());
+    tuner.arg_list().set(2, desc()->alpha);
+    tuner.arg_list().set(3, desc()->beta);
+    append_post_ops_to_arg_list(
+            tuner.arg_list(), 4, conf.attr_info.all_post_ops);
 }
 
 status_t ref_eltwise_fwd_t::execute_forward_dense(const exec_ctx_t &ctx) const {
@@ -125,7 +141,7 @@ status_t ref_eltwise_fwd_t::execute_forward_dense(const exec_ctx_t &ctx) const {
 
     append_post_ops_to_arg_list(ctx, arg_list, 4, conf.attr_info.all_post_ops);
 
-    auto nd_range = conf.dispatch.nd_range();
+    auto nd_range = dispatch_.nd_range();
     return parallel_for(ctx, nd_range, kernel_, arg_list);
 }
 
@@ -135,7 +151,7 @@ status_t ref_eltwise_bwd_t::pd_t::init_conf(engine_t *engine) {
 
 status_t ref_eltwise_bwd_t::pd_t::init_kernel_ctx(
         compute::kernel_ctx_t &kernel_ctx) const {
-    return init_kernel_ctx_common(kernel_ctx, conf, off);
+    return init_kernel_ctx_common(kernel_ctx, conf, off, conf.dispatch);
 }
 
 status_t ref_eltwise_bwd_t::execute_backward_dense(
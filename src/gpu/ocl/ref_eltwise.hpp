@@ -56,7 +56,9 @@ struct ref_eltwise_fwd_t : public gpu_primitive_t {
                             eltwise_logsigmoid, eltwise_exp, eltwise_gelu_tanh,
                             eltwise_swish, eltwise_log, eltwise_clip,
                             eltwise_clip_v2, eltwise_pow, eltwise_gelu_erf,
-                            eltwise_round, eltwise_relu_use_dst_for_bwd,
+                            eltwise_round, eltwise_hardswish,
+                            eltwise_hardsigmoid, eltwise_mish, eltwise_selu,
+                            eltwise_relu_use_dst_for_bwd,
                             eltwise_logistic_use_dst_for_bwd,
                             eltwise_tanh_use_dst_for_bwd,
                             eltwise_elu_use_dst_for_bwd,
@@ -78,7 +80,12 @@ struct ref_eltwise_fwd_t : public gpu_primitive_t {
         }
 
         status_t init_conf(engine_t *engine);
-        status_t init_kernel_ctx(compute::kernel_ctx_t &kernel_ctx) const;
+        status_t init_kernel_ctx(compute::kernel_ctx_t &kernel_ctx) const {
+            return init_kernel_ctx(kernel_ctx, conf.dispatch);
+        }
+        status_t init_kernel_ctx(compute::kernel_ctx_t &kernel_ctx,
+                const compute::dispatch_t &dispatch) const;
+        void init_tuning_args(compute::dispatch_tuner_t &tuner) const;
 
         eltwise_conf_t conf;
         offsets_t off;
@@ -87,12 +94,15 @@ struct ref_eltwise_fwd_t : public gpu_primitive_t {
     ref_eltwise_fwd_t(const pd_t *apd) : gpu_primitive_t(apd) {}
 
     status_t init(engine_t *engine) override {
-        compute::kernel_ctx_t kernel_ctx;
-
-        status_t status = pd()->init_kernel_ctx(kernel_ctx);
-        if (status != status::success) return status;
-
-        create_kernel(engine, &kernel_, "ref_eltwise_fwd", kernel_ctx);
+        dispatch_ = pd()->conf.dispatch;
+        compute::dispatch_tuner_t tuner("ref_eltwise_fwd",
+                [&](compute::kernel_ctx_t &kernel_ctx,
+                        const compute::dispatch_t &dispatch) {
+                    return pd()->init_kernel_ctx(kernel_ctx, dispatch);
+                });
+        pd()->init_tuning_args(tuner);
+
+        create_kernel(engine, &kernel_, tuner, dispatch_);
         if (!kernel_) return status::runtime_error;
 
         return status::success;
@@ -106,6 +116,7 @@ private:
     status_t execute_forward_dense(const exec_ctx_t &ctx) const;
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
     compute::kernel_t kernel_;
+    compute::dispatch_t dispatch_;
 };
 
 struct ref_eltwise_bwd_t : public gpu_primitive_t {
@@ -130,6 +141,8 @@ struct ref_eltwise_bwd_t : public gpu_primitive_t {
                             eltwise_logistic, eltwise_exp, eltwise_gelu_tanh,
                             eltwise_swish, eltwise_log, eltwise_clip,
                             eltwise_clip_v2, eltwise_pow, eltwise_gelu_erf,
+                            eltwise_hardswish, eltwise_hardsigmoid,
+                            eltwise_mish, eltwise_selu,
                             eltwise_relu_use_dst_for_bwd,
                             eltwise_logistic_use_dst_for_bwd,
                             eltwise_tanh_use_dst_for_bwd,
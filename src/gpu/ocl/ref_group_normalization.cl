@@ -0,0 +1,75 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "gpu/ocl/ocl_post_ops.h"
+#include "gpu/ocl/ocl_types.h"
+
+KERNEL_ATTR
+__kernel void ref_gnorm_fwd(__global DATA_T *src, __global float *mean,
+        __global float *variance, __global DATA_T *dst,
+        __global float *scaleshift, float eps POST_OP_ARGS) {
+    const int n = GWS_GET_MB();
+    const int g = GWS_GET_G();
+    const int s_off = n * G + g;
+    const int c_start = g * C_PER_GROUP;
+
+    float v_mean = CALCULATE_STATS ? 0 : mean[s_off];
+    float v_variance = CALCULATE_STATS ? 0 : variance[s_off];
+
+    if (CALCULATE_STATS) {
+        const float group_nelems = C_PER_GROUP * ID * IH * IW;
+        for (int c = c_start; c < c_start + C_PER_GROUP; ++c)
+            for (int d = 0; d < ID; ++d)
+                for (int h = 0; h < IH; ++h)
+                    for (int w = 0; w < IW; ++w)
+                        v_mean += DATA_TO_REF(src[SRC_OFF(n, c, d, h, w)]);
+        v_mean /= group_nelems;
+
+        for (int c = c_start; c < c_start + C_PER_GROUP; ++c)
+            for (int d = 0; d < ID; ++d)
+                for (int h = 0; h < IH; ++h)
+                    for (int w = 0; w < IW; ++w) {
+                        float m = DATA_TO_REF(src[SRC_OFF(n, c, d, h, w)])
+                                - v_mean;
+                        v_variance += m * m;
+                    }
+        v_variance /= group_nelems;
+    }
+
+    const float inv_sqrt_variance = 1.0f / sqrt(v_variance + eps);
+    for (int c = c_start; c < c_start + C_PER_GROUP; ++c) {
+        const float sm = (USE_SCALESHIFT ? scaleshift[c] : 1.0f)
+                * inv_sqrt_variance;
+        const float sv = USE_SCALESHIFT ? scaleshift[C_PER_GROUP * G + c] : 0;
+
+        for (int d = 0; d < ID; ++d)
+            for (int h = 0; h < IH; ++h)
+                for (int w = 0; w < IW; ++w) {
+                    const int off = SRC_OFF(n, c, d, h, w);
+                    POST_OP_DATA_T res
+                            = sm * (DATA_TO_REF(src[off]) - v_mean) + sv;
+                    POST_OP_DATA_T sum_src;
+                    APPLY_POST_OPS_SERIAL(res, POST_OP_DATA_T, sum_src,
+                            POST_OP_DATA_T, n, 1, c, 1);
+                    dst[off] = TO_DATA_T(res);
+                }
+    }
+
+    if (CALCULATE_STATS && SAVE_STATS) {
+        mean[s_off] = v_mean;
+        variance[s_off] = v_variance;
+    }
+}
@@ -0,0 +1,111 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "gpu/ocl/ref_group_normalization.hpp"
+
+#include "common/primitive_exec_types.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace gpu {
+namespace ocl {
+
+status_t ref_group_normalization_fwd_t::pd_t::init_conf(engine_t *engine) {
+    const memory_desc_wrapper src_mdw(src_md());
+
+    conf.data_type = src_mdw.data_type();
+    conf.ndims = ndims();
+    conf.mb = MB();
+    conf.c = C();
+    conf.g = G();
+    conf.id = D();
+    conf.ih = H();
+    conf.iw = W();
+
+    conf.use_scaleshift = use_scaleshift();
+    conf.calculate_stats = !stats_are_src();
+    conf.save_stats = is_training();
+    conf.eps = desc()->group_norm_epsilon;
+
+    set_offsets(src_mdw, off.src_off);
+
+    // A work item computes the statistics of a group of an image and
+    // normalizes it, so no reduction across work items is needed.
+    auto *compute_engine = utils::downcast<compute::compute_engine_t *>(engine);
+    conf.dispatch = compute_engine->create_dispatch();
+    conf.dispatch.define_dim("MB", conf.mb);
+    conf.dispatch.define_dim("G", conf.g);
+    conf.dispatch.generate();
+
+    conf.attr_info = attr_info_t::create(attr());
+
+    return status::success;
+}
+
+status_t ref_group_normalization_fwd_t::pd_t::init_kernel_ctx(
+        compute::kernel_ctx_t &kernel_ctx) const {
+    kernel_ctx.set_data_type(conf.data_type);
+
+    kernel_ctx.define_int("NDIMS", conf.ndims);
+    kernel_ctx.define_int("G", conf.g);
+    kernel_ctx.define_int("C_PER_GROUP", conf.c / conf.g);
+    kernel_ctx.define_int("ID", conf.id);
+    kernel_ctx.define_int("IH", conf.ih);
+    kernel_ctx.define_int("IW", conf.iw);
+    kernel_ctx.define_int("USE_SCALESHIFT", conf.use_scaleshift);
+    kernel_ctx.define_int("CALCULATE_STATS", conf.calculate_stats);
+    kernel_ctx.define_int("SAVE_STATS", conf.save_stats);
+
+    def_offsets(off.src_off, kernel_ctx, "SRC", conf.ndims);
+    def_attr_info(kernel_ctx, conf.attr_info);
+    def_dispatch(kernel_ctx, conf.dispatch);
+
+    return status::success;
+}
+
+status_t ref_group_normalization_fwd_t::execute_forward(
+        const exec_ctx_t &ctx) const {
+
+    auto &src = CTX_IN_STORAGE(DNNL_ARG_SRC);
+    auto &mean = pd()->stats_are_src() ? CTX_IN_STORAGE(DNNL_ARG_MEAN)
+                                       : CTX_OUT_STORAGE(DNNL_ARG_MEAN);
+
+    auto &variance = pd()->stats_are_src() ? CTX_IN_STORAGE(DNNL_ARG_VARIANCE)
+                                           : CTX_OUT_STORAGE(DNNL_ARG_VARIANCE);
+
+    auto &scaleshift = CTX_IN_STORAGE(DNNL_ARG_SCALE_SHIFT);
+    auto &dst = CTX_OUT_STORAGE(DNNL_ARG_DST);
+
+    const auto &conf = pd()->conf;
+
+    compute::kernel_arg_list_t arg_list;
+    arg_list.set(0, src);
+    arg_list.set(1, mean);
+    arg_list.set(2, variance);
+    arg_list.set(3, dst);
+    arg_list.set(4, scaleshift);
+    arg_list.set(5, conf.eps);
+    append_post_ops_to_arg_list(ctx, arg_list, 6, conf.attr_info.all_post_ops);
+
+    auto nd_range_kernel = conf.dispatch.nd_range();
+
+    return parallel_for(ctx, nd_range_kernel, kernel_, arg_list);
+}
+
+} // namespace ocl
+} // namespace gpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,97 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef GPU_OCL_REF_GROUP_NORMALIZATION_HPP
+#define GPU_OCL_REF_GROUP_NORMALIZATION_HPP
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+#include "gpu/compute/compute.hpp"
+#include "gpu/gpu_group_normalization_pd.hpp"
+#include "gpu/gpu_primitive.hpp"
+#include "gpu/gpu_resource.hpp"
+#include "gpu/primitive_conf.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace gpu {
+namespace ocl {
+
+struct ref_group_normalization_fwd_t : public gpu_primitive_t {
+    struct pd_t : public gpu_group_normalization_fwd_pd_t {
+        using gpu_group_normalization_fwd_pd_t::
+                gpu_group_normalization_fwd_pd_t;
+
+        DECLARE_COMMON_PD_T("ocl:ref:any", ref_group_normalization_fwd_t);
+
+        status_t init(engine_t *engine) {
+            using namespace data_type;
+
+            auto src_data_t = src_md()->data_type;
+            auto dst_data_t = dst_md()->data_type;
+
+            bool ok = is_fwd()
+                    && (utils::everyone_is(f16, src_data_t, dst_data_t)
+                            || utils::everyone_is(bf16, src_data_t, dst_data_t)
+                            || utils::everyone_is(f32, src_data_t, dst_data_t))
+                    && stat_md()->data_type == f32
+                    && check_scale_shift_data_type() && attr_eltwise_ok()
+                    && memory_desc_wrapper(src_md()).is_blocking_desc();
+            if (!ok) return status::unimplemented;
+
+            return init_conf(engine);
+        }
+
+        status_t init_conf(engine_t *engine);
+        status_t init_kernel_ctx(compute::kernel_ctx_t &kernel_ctx) const;
+
+        gnorm_conf_t conf;
+        offsets_t off;
+    };
+
+    ref_group_normalization_fwd_t(const pd_t *apd) : gpu_primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override {
+        compute::kernel_ctx_t kernel_ctx;
+
+        status_t status = pd()->init_kernel_ctx(kernel_ctx);
+        CHECK(status);
+
+        create_kernel(engine, &kernel_, "ref_gnorm_fwd", kernel_ctx);
+        if (!kernel_) return status::runtime_error;
+
+        return status::success;
+    }
+
+    status_t execute(const exec_ctx_t &ctx) const override {
+        return execute_forward(ctx);
+    }
+
+private:
+    status_t execute_forward(const exec_ctx_t &ctx) const;
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    compute::kernel_t kernel_;
+};
+
+} // namespace ocl
+} // namespace gpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
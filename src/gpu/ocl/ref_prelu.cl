@@ -0,0 +1,123 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "gpu/ocl/ocl_types.h"
+
+// The weights dims are either 1 or equal to the data ones, so the weights
+// index of a data element is the data index modulo the weights dims.
+#define WEI_OFF_BCAST(x0, x1, x2, x3, x4, x5) \
+    OFF_MD(WEI, (x0) % WEI_D0, (x1) % WEI_D1, (x2) % WEI_D2, (x3) % WEI_D3, \
+            (x4) % WEI_D4, (x5) % WEI_D5)
+
+#if IS_FWD
+KERNEL_ATTR
+__kernel void ref_prelu_fwd(const __global DATA_T *src,
+        const __global DATA_T *weights, __global DATA_T *dst) {
+    const int d0 = GWS_GET_D0();
+    const int d1 = GWS_GET_D1();
+    const int d2 = GWS_GET_D2();
+    const int d3 = GWS_GET_D3();
+    const int d4 = GWS_GET_D4();
+    const int d5 = GWS_GET_D5();
+
+    const float s = CONVERT_FLOAT_T(src[OFF_MD(SRC, d0, d1, d2, d3, d4, d5)]);
+    const float w
+            = CONVERT_FLOAT_T(weights[WEI_OFF_BCAST(d0, d1, d2, d3, d4, d5)]);
+    dst[OFF_MD(DST, d0, d1, d2, d3, d4, d5)] = TO_DATA_T(s > 0 ? s : s * w);
+}
+
+#else
+
+// One work-item per weights element and chunk of its reduction space.
+__kernel void ref_prelu_bwd(const __global DATA_T *src,
+        const __global DATA_T *weights, const __global DATA_T *diff_dst,
+        __global DATA_T *diff_src, __global DATA_T *diff_weights,
+        __global float *partials) {
+    const int wei_idx = get_global_id(0);
+    const int chunk = get_global_id(1);
+
+    int idx = wei_idx;
+    const int w5 = idx % WEI_D5;
+    idx /= WEI_D5;
+    const int w4 = idx % WEI_D4;
+    idx /= WEI_D4;
+    const int w3 = idx % WEI_D3;
+    idx /= WEI_D3;
+    const int w2 = idx % WEI_D2;
+    idx /= WEI_D2;
+    const int w1 = idx % WEI_D1;
+    const int w0 = idx / WEI_D1;
+
+    const int wei_off = OFF_MD(WEI, w0, w1, w2, w3, w4, w5);
+    const float w = CONVERT_FLOAT_T(weights[wei_off]);
+
+    // The weights index is 0 along the reduced dims, so the data index is
+    // the weights one plus the position in the reduction space.
+    const int r_start = chunk * CHUNK_SIZE;
+    const int r_end = min(r_start + CHUNK_SIZE, REDUCE_NELEMS);
+    float diff_w = 0.0f;
+    for (int r = r_start; r < r_end; r++) {
+        int t = r;
+        const int d5 = w5 + t % REDUCE_D5;
+        t /= REDUCE_D5;
+        const int d4 = w4 + t % REDUCE_D4;
+        t /= REDUCE_D4;
+        const int d3 = w3 + t % REDUCE_D3;
+        t /= REDUCE_D3;
+        const int d2 = w2 + t % REDUCE_D2;
+        t /= REDUCE_D2;
+        const int d1 = w1 + t % REDUCE_D1;
+        const int d0 = w0 + t / REDUCE_D1;
+
+        const int data_off = OFF_MD(DIFF_DATA, d0, d1, d2, d3, d4, d5);
+        const float s
+                = CONVERT_FLOAT_T(src[OFF_MD(SRC, d0, d1, d2, d3, d4, d5)]);
+        const float dd = CONVERT_FLOAT_T(diff_dst[data_off]);
+
+        diff_src[data_off] = TO_DATA_T(s > 0 ? dd : dd * w);
+        diff_w += s > 0 ? 0.0f : dd * s;
+    }
+
+#if NCHUNKS == 1
+    diff_weights[OFF_MD(DIFF_WEI, w0, w1, w2, w3, w4, w5)] = TO_DATA_T(diff_w);
+#else
+    partials[chunk * WEI_NELEMS + wei_idx] = diff_w;
+#endif
+}
+
+__kernel void ref_prelu_bwd_reduce(
+        const __global float *partials, __global DATA_T *diff_weights) {
+    const int wei_idx = get_global_id(0);
+
+    float diff_w = 0.0f;
+    for (int c = 0; c < NCHUNKS; c++)
+        diff_w += partials[c * WEI_NELEMS + wei_idx];
+
+    int idx = wei_idx;
+    const int w5 = idx % WEI_D5;
+    idx /= WEI_D5;
+    const int w4 = idx % WEI_D4;
+    idx /= WEI_D4;
+    const int w3 = idx % WEI_D3;
+    idx /= WEI_D3;
+    const int w2 = idx % WEI_D2;
+    idx /= WEI_D2;
+    const int w1 = idx % WEI_D1;
+    const int w0 = idx / WEI_D1;
+
+    diff_weights[OFF_MD(DIFF_WEI, w0, w1, w2, w3, w4, w5)] = TO_DATA_T(diff_w);
+}
+#endif
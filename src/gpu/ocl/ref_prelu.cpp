@@ -0,0 +1,189 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "gpu/ocl/ref_prelu.hpp"
+#include "gpu/ocl/ocl_utils.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace gpu {
+namespace ocl {
+
+using namespace dnnl::impl::memory_tracking::names;
+
+// Upper bound of the partial sums per weights element, so the combining
+// kernel stays short even for a single (scalar) weight.
+static constexpr int max_nchunks = 1024;
+static constexpr int min_chunk_size = 256;
+
+static status_t init_conf_common(prelu_conf_t &conf, const prelu_pd_t *pd) {
+    const memory_desc_wrapper data_d(pd->src_md(0));
+    const memory_desc_wrapper wei_d(pd->weights_md(0));
+
+    // Every weights dim is either broadcast or matches the data one.
+    const int ndims = data_d.ndims();
+    if (ndims > MAX_NDIMS || wei_d.ndims() != ndims)
+        return status::unimplemented;
+    for (int d = 0; d < ndims; ++d)
+        if (!utils::one_of(wei_d.dims()[d], 1, data_d.dims()[d]))
+            return status::unimplemented;
+
+    conf.is_forward = pd->is_fwd();
+    conf.ndims = ndims;
+    conf.src_md_info = memory_desc_info_t::create(data_d);
+    conf.wei_md_info = memory_desc_info_t::create(wei_d);
+
+    conf.reduce_nelems = 1;
+    for (int d = 0; d < MAX_NDIMS; ++d) {
+        const bool is_reduced = d < ndims && wei_d.dims()[d] == 1;
+        conf.reduce_dims[d] = is_reduced ? data_d.dims()[d] : 1;
+        conf.reduce_nelems *= conf.reduce_dims[d];
+    }
+    conf.wei_nelems = wei_d.nelems();
+    return status::success;
+}
+
+status_t ref_prelu_fwd_t::pd_t::init_conf(engine_t *engine) {
+    CHECK(init_conf_common(conf, this));
+
+    const memory_desc_wrapper dst_d(dst_md(0));
+    conf.dst_md_info = memory_desc_info_t::create(dst_d);
+
+    auto *compute_engine = utils::downcast<compute::compute_engine_t *>(engine);
+    conf.dispatch = compute_engine->create_dispatch(dst_d.md_);
+    for (int d = 0; d < MAX_NDIMS; ++d) {
+        conf.dispatch.define_dim(utils::format("D%d", d),
+                nstl::min(d, conf.ndims - 1),
+                d < conf.ndims ? dst_d.dims()[d] : 1);
+    }
+    conf.dispatch.generate();
+    return status::success;
+}
+
+status_t ref_prelu_fwd_t::pd_t::init_kernel_ctx(
+        compute::kernel_ctx_t &kernel_ctx) const {
+    kernel_ctx.set_data_type(conf.src_md_info.data_type);
+    kernel_ctx.define_int("IS_FWD", 1);
+    kernel_ctx.define_int("NDIMS", conf.ndims);
+
+    def_memory_desc_info(kernel_ctx, conf.src_md_info, "SRC");
+    def_memory_desc_info(kernel_ctx, conf.wei_md_info, "WEI");
+    def_memory_desc_info(kernel_ctx, conf.dst_md_info, "DST");
+
+    def_dispatch(kernel_ctx, conf.dispatch);
+    return status::success;
+}
+
+status_t ref_prelu_fwd_t::execute_forward(const exec_ctx_t &ctx) const {
+    if (pd()->has_zero_dim_memory()) return status::success;
+
+    auto &src = CTX_IN_STORAGE(DNNL_ARG_SRC);
+    auto &weights = CTX_IN_STORAGE(DNNL_ARG_WEIGHTS);
+    auto &dst = CTX_OUT_STORAGE(DNNL_ARG_DST);
+
+    compute::kernel_arg_list_t arg_list;
+    arg_list.set(0, src);
+    arg_list.set(1, weights);
+    arg_list.set(2, dst);
+
+    auto nd_range = pd()->conf.dispatch.nd_range();
+    return parallel_for(ctx, nd_range, kernel_, arg_list);
+}
+
+status_t ref_prelu_bwd_t::pd_t::init_conf(engine_t *engine) {
+    CHECK(init_conf_common(conf, this));
+
+    const memory_desc_wrapper diff_data_d(diff_src_md(0));
+    const memory_desc_wrapper diff_wei_d(diff_weights_md(0));
+    conf.diff_src_md_info = memory_desc_info_t::create(diff_data_d);
+    conf.diff_wei_md_info = memory_desc_info_t::create(diff_wei_d);
+
+    conf.chunk_size = (int)nstl::max((dim_t)min_chunk_size,
+            utils::div_up(conf.reduce_nelems, max_nchunks));
+    conf.nchunks = (int)utils::div_up(conf.reduce_nelems, conf.chunk_size);
+    return status::success;
+}
+
+status_t ref_prelu_bwd_t::pd_t::init_kernel_ctx(
+        compute::kernel_ctx_t &kernel_ctx) const {
+    kernel_ctx.set_data_type(conf.src_md_info.data_type);
+    kernel_ctx.define_int("IS_FWD", 0);
+    kernel_ctx.define_int("NDIMS", conf.ndims);
+    for (int d = 0; d < MAX_NDIMS; ++d)
+        kernel_ctx.define_int(
+                utils::format("REDUCE_D%d", d), conf.reduce_dims[d]);
+    kernel_ctx.define_int("REDUCE_NELEMS", conf.reduce_nelems);
+    kernel_ctx.define_int("WEI_NELEMS", conf.wei_nelems);
+    kernel_ctx.define_int("NCHUNKS", conf.nchunks);
+    kernel_ctx.define_int("CHUNK_SIZE", conf.chunk_size);
+
+    def_memory_desc_info(kernel_ctx, conf.src_md_info, "SRC");
+    def_memory_desc_info(kernel_ctx, conf.wei_md_info, "WEI");
+    def_memory_desc_info(kernel_ctx, conf.diff_src_md_info, "DIFF_DATA");
+    def_memory_desc_info(kernel_ctx, conf.diff_wei_md_info, "DIFF_WEI");
+    return status::success;
+}
+
+void ref_prelu_bwd_t::pd_t::init_scratchpad() {
+    if (conf.nchunks == 1) return;
+    auto scratchpad = scratchpad_registry().registrar();
+    scratchpad.book(key_prelu_reduction, conf.nchunks * conf.wei_nelems,
+            sizeof(float), OCL_BUFFER_ALIGNMENT);
+}
+
+status_t ref_prelu_bwd_t::execute_backward(const exec_ctx_t &ctx) const {
+    if (pd()->has_zero_dim_memory()) return status::success;
+
+    auto &src = CTX_IN_STORAGE(DNNL_ARG_SRC);
+    auto &weights = CTX_IN_STORAGE(DNNL_ARG_WEIGHTS);
+    auto &diff_dst = CTX_IN_STORAGE(DNNL_ARG_DIFF_DST);
+    auto &diff_src = CTX_OUT_STORAGE(DNNL_ARG_DIFF_SRC);
+    auto &diff_weights = CTX_OUT_STORAGE(DNNL_ARG_DIFF_WEIGHTS);
+
+    const auto &conf = pd()->conf;
+
+    std::unique_ptr<memory_storage_t> partials;
+    if (conf.nchunks > 1)
+        partials = ctx.get_scratchpad_grantor().get_memory_storage(
+                key_prelu_reduction);
+
+    compute::kernel_arg_list_t arg_list;
+    arg_list.set(0, src);
+    arg_list.set(1, weights);
+    arg_list.set(2, diff_dst);
+    arg_list.set(3, diff_src);
+    arg_list.set(4, diff_weights);
+    arg_list.set(5, partials ? *partials : memory_storage_t::empty_storage());
+
+    const size_t gws[3] = {(size_t)conf.wei_nelems, (size_t)conf.nchunks, 1};
+    status_t status
+            = parallel_for(ctx, compute::nd_range_t(gws), kernel_, arg_list);
+    CHECK(status);
+    if (conf.nchunks == 1) return status::success;
+
+    compute::kernel_arg_list_t reduce_arg_list;
+    reduce_arg_list.set(0, *partials);
+    reduce_arg_list.set(1, diff_weights);
+
+    const size_t reduce_gws[3] = {(size_t)conf.wei_nelems, 1, 1};
+    return parallel_for(ctx, compute::nd_range_t(reduce_gws), reduce_kernel_,
+            reduce_arg_list);
+}
+
+} // namespace ocl
+} // namespace gpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,163 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef GPU_OCL_REF_PRELU_HPP
+#define GPU_OCL_REF_PRELU_HPP
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+#include "gpu/compute/compute.hpp"
+#include "gpu/gpu_prelu_pd.hpp"
+#include "gpu/gpu_primitive.hpp"
+#include "gpu/gpu_resource.hpp"
+#include "gpu/primitive_conf.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace gpu {
+namespace ocl {
+
+struct ref_prelu_fwd_t : public gpu_primitive_t {
+    struct pd_t : public gpu_prelu_fwd_pd_t {
+        using gpu_prelu_fwd_pd_t::gpu_prelu_fwd_pd_t;
+
+        DECLARE_COMMON_PD_T("ocl:ref:any", ref_prelu_fwd_t);
+
+        status_t init(engine_t *engine) {
+            using namespace data_type;
+            auto *compute_engine
+                    = utils::downcast<compute::compute_engine_t *>(engine);
+
+            const data_type_t dt = src_md(0)->data_type;
+            bool ok = is_fwd() && set_default_formats()
+                    && utils::one_of(dt, f32, f16, bf16)
+                    && utils::everyone_is(
+                            dt, weights_md(0)->data_type, dst_md(0)->data_type)
+                    && attr()->has_default_values()
+                    && IMPLICATION(dt == f16,
+                            compute_engine->mayiuse(
+                                    compute::device_ext_t::khr_fp16));
+            if (!ok) return status::unimplemented;
+
+            return init_conf(engine);
+        }
+
+        status_t init_conf(engine_t *engine);
+        status_t init_kernel_ctx(compute::kernel_ctx_t &kernel_ctx) const;
+
+        prelu_conf_t conf;
+    };
+
+    ref_prelu_fwd_t(const pd_t *apd) : gpu_primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override {
+        compute::kernel_ctx_t kernel_ctx;
+
+        status_t status = pd()->init_kernel_ctx(kernel_ctx);
+        CHECK(status);
+
+        create_kernel(engine, &kernel_, "ref_prelu_fwd", kernel_ctx);
+        if (!kernel_) return status::runtime_error;
+
+        return status::success;
+    }
+
+    status_t execute(const exec_ctx_t &ctx) const override {
+        return execute_forward(ctx);
+    }
+
+private:
+    status_t execute_forward(const exec_ctx_t &ctx) const;
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+    compute::kernel_t kernel_;
+};
+
+// The weights gradient is a reduction over the dims the weights are
+// broadcast over. The reduction space of every weights element is split into
+// chunks, the first kernel computes diff_src and the partial sums of the
+// chunks, the second one combines them. With a single chunk the first kernel
+// writes diff_weights directly.
+struct ref_prelu_bwd_t : public gpu_primitive_t {
+    struct pd_t : public gpu_prelu_bwd_pd_t {
+        using gpu_prelu_bwd_pd_t::gpu_prelu_bwd_pd_t;
+
+        DECLARE_COMMON_PD_T("ocl:ref:any", ref_prelu_bwd_t);
+
+        status_t init(engine_t *engine) {
+            using namespace data_type;
+
+            const data_type_t dt = src_md(0)->data_type;
+            bool ok = !is_fwd() && set_default_formats()
+                    && utils::one_of(dt, f32, bf16)
+                    && utils::everyone_is(dt, weights_md(0)->data_type,
+                            diff_src_md(0)->data_type,
+                            diff_dst_md(0)->data_type,
+                            diff_weights_md(0)->data_type)
+                    && attr()->has_default_values();
+            if (!ok) return status::unimplemented;
+
+            CHECK(init_conf(engine));
+            init_scratchpad();
+
+            return status::success;
+        }
+
+        status_t init_conf(engine_t *engine);
+        status_t init_kernel_ctx(compute::kernel_ctx_t &kernel_ctx) const;
+        void init_scratchpad();
+
+        prelu_conf_t conf;
+    };
+
+    ref_prelu_bwd_t(const pd_t *apd) : gpu_primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override {
+        compute::kernel_ctx_t kernel_ctx;
+
+        status_t status = pd()->init_kernel_ctx(kernel_ctx);
+        CHECK(status);
+
+        std::vector<compute::kernel_t> kernels;
+        status = create_kernels(engine, &kernels,
+                {"ref_prelu_bwd", "ref_prelu_bwd_reduce"}, kernel_ctx);
+        CHECK(status);
+
+        kernel_ = kernels[0];
+        reduce_kernel_ = kernels[1];
+        if (!kernel_ || !reduce_kernel_) return status::runtime_error;
+
+        return status::success;
+    }
+
+    status_t execute(const exec_ctx_t &ctx) const override {
+        return execute_backward(ctx);
+    }
+
+private:
+    status_t execute_backward(const exec_ctx_t &ctx) const;
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+    compute::kernel_t kernel_;
+    compute::kernel_t reduce_kernel_;
+};
+
+} // namespace ocl
+} // namespace gpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -46,12 +46,18 @@ cell_execution_sig((_ref_rnn_common_t<aprop>::cell_execution)) {
                     cell_scratch_offset, gemm_layer_fwd);
         }
 
-        gemm_primitive(engine, ctx, wei_iter, cell_wei_iter_offset, workspace,
-                cell_ws_iter_offset, scratch_gates, cell_scratch_offset,
-                gemm_iter_fwd);
-
-        (this->*elemwise_func)(ctx, dir, lay, iter, rnn.dhc, rnn.mb, workspace,
-                scratch_gates, scratch_cell, scales, bias, tm_scales, PART);
+        if (rnn.use_fused_cell) {
+            fused_cell(ctx, dir, lay, iter, workspace, scratch_gates, wei_iter,
+                    cell_wei_iter_offset, bias, tm_scales);
+        } else {
+            gemm_primitive(engine, ctx, wei_iter, cell_wei_iter_offset,
+                    workspace, cell_ws_iter_offset, scratch_gates,
+                    cell_scratch_offset, gemm_iter_fwd);
+
+            (this->*elemwise_func)(ctx, dir, lay, iter, rnn.dhc, rnn.mb,
+                    workspace, scratch_gates, scratch_cell, scales, bias,
+                    tm_scales, PART);
+        }
 
     } else { // backward
         cl_ulong cell_diff_wei_iter_off, cell_diff_wei_lay_off,
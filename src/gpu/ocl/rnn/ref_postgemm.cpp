@@ -96,6 +96,42 @@ elemwise_sig((_ref_rnn_common_t<aprop>::lstm_elemwise_u8s8)) {
 template elemwise_sig(ref_rnn_fwd_t::lstm_elemwise_u8s8);
 template elemwise_sig(ref_rnn_bwd_t::lstm_elemwise_u8s8);
 
+template <prop_kind_t aprop>
+void _ref_rnn_common_t<aprop>::fused_cell(const exec_ctx_t &ctx, int dir,
+        int lay, int iter, const memory_storage_t &workspace,
+        const memory_storage_t &scratch_gates,
+        const memory_storage_t &wei_iter, size_t wei_iter_offset,
+        const memory_storage_t &bias,
+        const memory_storage_t *tm_scales) const {
+    const rnn_utils::conf_t &rnn = pd()->rnn_conf;
+    auto nd_range = compute::nd_range_t({rnn.dhc, rnn.mb});
+
+    compute::kernel_arg_list_t arg_list;
+    arg_list.set(0, dir);
+    arg_list.set(1, lay);
+    arg_list.set(2, iter);
+    arg_list.set(3, workspace);
+    arg_list.set(4, scratch_gates);
+    arg_list.set(5, wei_iter);
+    arg_list.set(6, (cl_ulong)wei_iter_offset);
+    arg_list.set(7, bias);
+    arg_list.set(8, pd()->desc()->alpha);
+    // for test mode
+    arg_list.set(9, tm_scales ? *tm_scales : memory_storage_t::empty_storage());
+    arg_list.set(10, rnn.tm_cscale);
+    parallel_for(ctx, nd_range, cell_fwd_kernel_, arg_list);
+}
+template void ref_rnn_fwd_t::fused_cell(const exec_ctx_t &ctx, int dir,
+        int lay, int iter, const memory_storage_t &workspace,
+        const memory_storage_t &scratch_gates,
+        const memory_storage_t &wei_iter, size_t wei_iter_offset,
+        const memory_storage_t &bias, const memory_storage_t *tm_scales) const;
+template void ref_rnn_bwd_t::fused_cell(const exec_ctx_t &ctx, int dir,
+        int lay, int iter, const memory_storage_t &workspace,
+        const memory_storage_t &scratch_gates,
+        const memory_storage_t &wei_iter, size_t wei_iter_offset,
+        const memory_storage_t &bias, const memory_storage_t *tm_scales) const;
+
 template <prop_kind_t aprop>
 elemwise_sig((_ref_rnn_common_t<aprop>::gru_lbr_elemwise)) {
     auto nd_range = compute::nd_range_t({dhc, batch});
@@ -760,6 +760,92 @@ __kernel void ref_rnn_elemwise_fwd(
 }
 #endif
 
+#if USE_FUSED_CELL
+// Forward cell for small batches: the iteration gemm is computed here on top
+// of the layer gemm result in scratch_gates, followed by the elementwise part.
+__kernel void ref_rnn_cell_fwd(int dir, int lay, int iter, __global char *ws,
+        __global char *scr_gates, __global char *wei_iter, OFFTYPE wei_iter_off,
+        __global AUX_DATA_T *bias_base, float alpha, __global float *tm_scales,
+        float tm_cscale) {
+
+    const int i = get_global_id(1); // batch
+    const int j = get_global_id(0); // dhc
+
+    const __global WEI_DATA_T *wei
+            = (const __global WEI_DATA_T *)(wei_iter + wei_iter_off);
+    const __global WS_STATE_DATA_T *h_states_tm1_l
+            = (__global WS_STATE_DATA_T *)(ws + WS_STATES_OFFSET)
+            + OFF_WS_STATE(lay + 1, dir, iter, 0, 0);
+    const __global AUX_DATA_T *bias = bias_base + BIAS_OFF(lay, dir, 0, 0);
+
+    __global AUX_DATA_T *ws_gates
+            = (__global AUX_DATA_T *)(ws + WS_GATES_OFFSET)
+            + OFF_WS_GATES(lay, dir, iter, 0, 0, 0);
+    const __global AUX_DATA_T *scratch_gates
+            = (__global AUX_DATA_T *)(scr_gates)
+            + OFF_SCRATCH_MEM(iter, 0, 0, 0);
+    __global WS_STATE_DATA_T *h_states_t_l
+            = (__global WS_STATE_DATA_T *)(ws + WS_STATES_OFFSET)
+            + OFF_WS_STATE(lay + 1, dir, iter + 1, 0, 0);
+
+    float g[N_GATES];
+    for (int gate = 0; gate < N_GATES; gate++)
+        g[gate] = (float)scratch_gates[CELL_SCRATCH_MEM(i, gate, j)]
+                + bias[OFF_KER_BIAS(gate, j)];
+
+    // Weights are ldigo, so the work-items of a row read consecutive
+    // elements and the state element is shared by all of them.
+    for (int k = 0; k < SIC; k++) {
+        const float h = TO_REF(h_states_tm1_l[CELL_WS_STATE(i, k)]);
+        const __global WEI_DATA_T *w = wei + k * WEI_ITER_LD + j;
+        for (int gate = 0; gate < N_GATES; gate++)
+            g[gate] += h * TO_REF(w[gate * DHC]);
+    }
+
+#if CELL_KIND == VANILLA_LSTM
+    const __global AUX_DATA_T *c_states_tm1_l
+            = (__global AUX_DATA_T *)(ws + WS_C_STATE_OFFSET)
+            + OFF_WS_STATE(lay + 1, dir, iter, 0, 0);
+    __global AUX_DATA_T *c_states_t_l
+            = (__global AUX_DATA_T *)(ws + WS_C_STATE_OFFSET)
+            + OFF_WS_STATE(lay + 1, dir, iter + 1, 0, 0);
+
+    float g_i = logistic_fwd_tm(g[0], tm_scales[0]);
+    float g_f = logistic_fwd_tm(g[1], tm_scales[1]);
+    float g_z = tanh_fwd_tm(g[2], tm_scales[2]);
+    float g_o = logistic_fwd_tm(g[3], tm_scales[3]);
+
+#if IS_TRAINING
+    ws_gates[CELL_WS_GATES(i, 0, j)] = g_i;
+    ws_gates[CELL_WS_GATES(i, 1, j)] = g_f;
+    ws_gates[CELL_WS_GATES(i, 2, j)] = g_z;
+    ws_gates[CELL_WS_GATES(i, 3, j)] = g_o;
+#endif
+
+    float Ct = g_f * c_states_tm1_l[CELL_WS_STATE(i, j)] + g_i * g_z;
+    float Ht = g_o * tanh_fwd_tm(Ct, tm_cscale);
+
+    h_states_t_l[CELL_WS_STATE(i, j)] = TO_INPUT(Ht);
+    c_states_t_l[CELL_WS_STATE(i, j)] = Ct;
+
+#elif CELL_KIND == VANILLA_RNN
+    float Ht = activation_fwd(g[0],
+#if IS_TESTMODE
+            tm_scales[0], 0);
+#else
+            alpha, 0);
+#endif
+
+#if IS_TRAINING
+    ws_gates[CELL_WS_GATES(i, 0, j)] = Ht;
+#endif
+    h_states_t_l[CELL_WS_STATE(i, j)] = TO_INPUT(Ht);
+#else
+#error "Unsupported cell kind for the fused cell"
+#endif
+}
+#endif
+
 __kernel void ref_rnn_elemwise_bwd(
         int dir, int lay, int iter, __global char *ws, __global char *scr_gates,
         __global AUX_DATA_T *bias_base, float alpha, __global float *tm_scales,
@@ -124,11 +124,13 @@ static status_t init_conf(rnn_conf_t &conf, const rnn_pd_t *rnn_pd,
     conf.copy_bias = rnn.copy_bias;
     conf.is_int8 = rnn.is_int8;
     conf.is_training = rnn.is_training;
+    conf.use_fused_cell = rnn.use_fused_cell;
 
     conf.states_ws_ld = rnn.states_ws_ld;
     conf.diff_states_ws_ld = rnn.diff_states_ws_ld;
     conf.gates_ws_ld = rnn.gates_ws_ld;
     conf.scratch_gates_ld = rnn.scratch_gates_ld;
+    conf.weights_iter_ld = rnn.weights_iter_ld;
 
     conf.src_layer_ndims = src_layer_d.ndims();
     conf.src_iter_ndims = src_iter_d.ndims();
@@ -298,6 +300,7 @@ static status_t init_kernel_ctx(compute::kernel_ctx_t &kernel_ctx,
     kernel_ctx.define_int("DIFF_STATES_WS_LD", conf.diff_states_ws_ld);
     kernel_ctx.define_int("GATES_WS_LD", conf.gates_ws_ld);
     kernel_ctx.define_int("SCRATCH_GATES_LD", conf.scratch_gates_ld);
+    kernel_ctx.define_int("WEI_ITER_LD", conf.weights_iter_ld);
 
     if (conf.src_dt == data_type::f16) {
         kernel_ctx.set_data_type(data_type::f16);
@@ -318,6 +321,7 @@ static status_t init_kernel_ctx(compute::kernel_ctx_t &kernel_ctx,
     kernel_ctx.define_int("COPY_BIAS", conf.copy_bias);
     kernel_ctx.define_int("WEI_QPARAM_MASK", conf.wei_qparam_mask);
     kernel_ctx.define_int("IS_TESTMODE", conf.is_testmode);
+    kernel_ctx.define_int("USE_FUSED_CELL", conf.use_fused_cell);
 
     kernel_ctx.define_int("DEBUGPRINT", DEBUGPRINT);
 
@@ -495,7 +499,8 @@ status_t _ref_rnn_common_t<aprop>::pd_t::init(engine_t *engine) {
             && weights_iter_dt == weights_layer_dt
             && everyone_is(weights_type, weights_iter_dt, weights_layer_dt)
             && this->set_default_params() == status::success
-            && this->with_bias()
+            && this->with_bias() && !this->with_seq_lengths()
+            && !this->with_recompute_gates()
             && IMPLICATION(
                     src_type == data_type::f16 || src_type == data_type::u8,
                     this->desc()->prop_kind == forward_inference)
@@ -768,6 +773,7 @@ status_t _ref_rnn_common_t<aprop>::init(engine_t *engine) {
                   "ref_rnn_ws_print"
 #endif
               };
+    if (pd()->conf.use_fused_cell) kernel_names.push_back("ref_rnn_cell_fwd");
 
     std::vector<compute::kernel_t> kernels;
     status = create_kernels(engine, &kernels, kernel_names, kernel_ctx);
@@ -785,6 +791,7 @@ status_t _ref_rnn_common_t<aprop>::init(engine_t *engine) {
 #if DEBUGPRINT
     ws_print_kernel_ = kernels[9];
 #endif
+    if (pd()->conf.use_fused_cell) cell_fwd_kernel_ = kernels.back();
 
     bool gemm_ok = true;
 
@@ -282,6 +282,12 @@ private:
     elemwise_sig(lstm_elemwise_u8s8);
     elemwise_sig(gru_lbr_elemwise);
     elemwise_sig(gru_elemwise);
+    void fused_cell(const exec_ctx_t &ctx, int dir, int lay, int iter,
+            const memory_storage_t &workspace,
+            const memory_storage_t &scratch_gates,
+            const memory_storage_t &wei_iter, size_t wei_iter_offset,
+            const memory_storage_t &bias,
+            const memory_storage_t *tm_scales) const;
 
     gemm_sig(gemm_primitive);
 
@@ -344,6 +350,7 @@ private:
     compute::kernel_t elemwise_fwd_kernel_;
     compute::kernel_t elemwise_bwd_kernel_;
     compute::kernel_t gates_reduction_kernel_;
+    compute::kernel_t cell_fwd_kernel_;
 
     // ptrs to GEMM primitives
     std::shared_ptr<primitive_t> gemm_layer_fwd_;
@@ -146,6 +146,12 @@ void rnn_utils::init_rnn_conf(conf_t &rnn, const rnn_desc_t &rd,
     rnn.merge_gemm_iter
             = dst_layer_is_trivial_stride && !(rnn.is_fwd || is_gru);
 
+    // For small batches the iteration gemm of a cell is too small to pay off
+    // its launch and the round trip of the gates through memory, so it is
+    // computed in the elementwise kernel instead.
+    rnn.use_fused_cell = rnn.is_fwd && !rnn.is_int8 && rnn.mb <= 8
+            && utils::one_of(rd.cell_kind, dnnl_vanilla_rnn, dnnl_vanilla_lstm);
+
     // Decide to copy bias
     rnn.copy_bias = rnn.is_int8;
 
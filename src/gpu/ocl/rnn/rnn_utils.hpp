@@ -154,6 +154,8 @@ struct conf_t {
 
     bool merge_gemm_iter, merge_gemm_layer, use_gemm, use_layer_packed_gemm,
             use_iter_packed_gemm;
+    // The iteration gemm is computed by the elementwise kernel of the cell
+    bool use_fused_cell;
 
     // Element size of each workspace part in bytes
     int ws_gates_elsz, ws_states_elsz, ws_grid_comp_elsz, ws_bias_elsz;
@@ -188,6 +188,18 @@ status_t simple_concat_t::execute_concat(const exec_ctx_t &ctx) const {
     const auto &conf = pd()->conf;
     auto &dst = CTX_OUT_STORAGE(DNNL_ARG_DST);
 
+    // Nothing to copy when every src is a sub-memory of the dst: the
+    // producers have already written the data in place.
+    if (pd()->srcs_are_images_) {
+        bool in_place = true;
+        for (int i = 0; i < pd()->n_inputs(); ++i) {
+            auto &src = CTX_IN_STORAGE(DNNL_ARG_MULTIPLE_SRC + i);
+            in_place = in_place && src.data_handle() == dst.data_handle()
+                    && src.offset() == dst.offset();
+        }
+        if (in_place) return status::success;
+    }
+
     compute::kernel_arg_list_t arg_list;
     arg_list.set(0, dst);
     for (int i = 0; i < pd()->n_inputs(); ++i) {
@@ -41,12 +41,20 @@ struct simple_concat_t : public gpu_primitive_t {
                     && set_default_params() == status::success;
             if (!ok) return status::unimplemented;
 
+            // The images are not required by the kernel, they are only
+            // used to detect the srcs that are already in place in the dst.
+            if (concat_pd_t::init() != status::success)
+                src_image_mds_.clear();
+            for (int i = 0; i < n_inputs(); ++i)
+                srcs_are_images_ = srcs_are_images_ && is_src_image(i);
+
             return init_conf();
         }
 
         status_t init_conf();
         status_t init_kernel_ctx(compute::kernel_ctx_t &kernel_ctx) const;
         concat_conf_t conf;
+        bool srcs_are_images_ = true;
     };
 
     simple_concat_t(const pd_t *apd) : gpu_primitive_t(apd) {}
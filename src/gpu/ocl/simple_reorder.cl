@@ -447,6 +447,65 @@ __kernel void simple_reorder(__global SRC_DATA_T *src, __global DST_DATA_T *dst,
         DST_BLOCK_WRITE(&dst[dst_off], dst_tmp);
     }
 
+#elif PADDED_16B
+    // Reorders between a plain format and the format blocked by 16 channels,
+    // e.g. nchw and nChw16c, when the channels are padded in the latter.
+    //
+    // Uses subgroup size 16, one work item per point of the last dimension.
+    // Each subgroup reads 16 channels of 16 points, shares and transposes
+    // them as the TRANSPOSE_16X16 kernel does, and writes 16 channels of 16
+    // points. The padded channels are not read from a blocked src and are
+    // written as zeros to a blocked dst.
+    int sgId = get_sub_group_local_id();
+
+    const int d0 = GWS_GET_D0();
+    const int d1 = GWS_GET_D1();
+    const int d2 = GWS_GET_D2();
+    const int d3 = GWS_GET_D3();
+    const int d4 = GWS_GET_D4();
+    const int d5 = GWS_GET_D5();
+
+    SRC_DATA_T src_buf[SUB_GROUP_SIZE];
+    SRC_DATA_T dst_buf[SUB_GROUP_SIZE];
+    SRC_DATA_T send_buf;
+
+    // The consecutive points of a channel block are 16 elements apart in the
+    // blocked format.
+    for (int i = 0; i < SUB_GROUP_SIZE; i++) {
+#if PLAIN_TO_BLOCK
+        src_buf[i] = 0;
+        if (d1 + i < SRC_D1) {
+            const int src_off = SRC_OFF(d0, d1 + i, d2, d3, d4, d5);
+            src_buf[i] = SRC_BLOCK_READ(&src[src_off]);
+        }
+#else
+        const int src_off = SRC_OFF(d0, d1, d2, d3, d4, d5) + 16 * i;
+        src_buf[i] = SRC_BLOCK_READ(&src[src_off]);
+#endif
+    }
+
+    dst_buf[sgId] = src_buf[sgId];
+    for (int i = 1; i < SUB_GROUP_SIZE; i++) {
+        send_buf = src_buf[(i + sgId) % 16];
+        dst_buf[(16 + sgId - i) % 16]
+                = intel_sub_group_shuffle(send_buf, (16 + sgId - i) % 16);
+    }
+
+    for (int i = 0; i < SUB_GROUP_SIZE; i++) {
+#if PLAIN_TO_BLOCK
+        const int dst_off = DST_OFF(d0, d1, d2, d3, d4, d5) + 16 * i;
+#else
+        if (d1 + i >= DST_D1) break;
+        const int dst_off = DST_OFF(d0, d1 + i, d2, d3, d4, d5);
+#endif
+        DST_DATA_T dst_tmp;
+#if WITH_SUM_AB
+        dst_tmp = DST_BLOCK_READ(&dst[dst_off]);
+#endif
+        REORDER(dst_tmp, dst_buf[i], alpha, beta);
+        DST_BLOCK_WRITE(&dst[dst_off], dst_tmp);
+    }
+
 #elif REORDER_NCHW
 
 #define BIGGER_THAN_16 (SRC_D1 >= 16)
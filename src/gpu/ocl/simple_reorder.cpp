@@ -254,6 +254,30 @@ status_t simple_reorder_t::pd_t::init_conf(engine_t *engine) {
                     dst_mdw.md_->format_desc.blocking, conf.ndims)
             && padded_dims[last] % 16 == 0;
 
+    auto *compute_engine = utils::downcast<compute::compute_engine_t *>(engine);
+
+    // Plain formats to and from the formats blocked by 16 channels with
+    // padded channels, e.g. nchw with 3 channels to nChw16c at the model
+    // input. The kernel writes the zero padding itself, so these reorders do
+    // not fall back to the reference kernel.
+    // 1 if src is plain and dst is blocked, 2 if src is blocked and dst is
+    // plain
+    conf.padded_16b = 0;
+    if (conf.has_padding && !conf.scale_quant && conf.ndims >= 3
+            && conf.ndims <= 5 && padded_dims[last] % 16 == 0
+            && IMPLICATION(type_s8_u8,
+                    compute_engine->mayiuse(
+                            compute::device_ext_t::intel_subgroups_char))) {
+        const auto plain_tag = utils::pick(conf.ndims - 3, ncw, nchw, ncdhw);
+        const auto blocked_tag
+                = utils::pick(conf.ndims - 3, nCw16c, nChw16c, nCdhw16c);
+        if (src_mdw.matches_tag(plain_tag) && dst_mdw.matches_tag(blocked_tag))
+            conf.padded_16b = 1;
+        else if (src_mdw.matches_tag(blocked_tag)
+                && dst_mdw.matches_tag(plain_tag))
+            conf.padded_16b = 2;
+    }
+
     dim_t blocks[MAX_NDIMS] = {1, 1, 1, 1, 1, 1};
     if (use_unroll_16a16b) {
         blocks[0] = 16;
@@ -302,17 +326,26 @@ status_t simple_reorder_t::pd_t::init_conf(engine_t *engine) {
         blocks[1] = nstl::min(padded_dims[1], dnnl_dim_t(16));
     }
 
+    if (conf.padded_16b) {
+        conf.use_ref_impl = false;
+        conf.sub_group_size = 16;
+        blocks[1] = 16;
+    }
+
     if (conf.unaligned_sizes) {
         conf.use_ref_impl = false;
         blocks[1] = padded_dims[1];
     }
-    auto *compute_engine = utils::downcast<compute::compute_engine_t *>(engine);
     conf.dispatch = compute_engine->create_dispatch(dst_mdw.md_);
     for (int i = 0; i < 6; ++i) {
         auto dim_str = utils::format("D%d", i);
         if (i < dst_mdw.ndims() && !conf.use_dense_vect) {
             dim_t block = conf.use_ref_impl ? ((i < 2) ? 1 : 0) : blocks[i];
-            conf.dispatch.define_dim(dim_str, i, padded_dims[i], block);
+            // the channels of a plain dst are walked by blocks of 16 too
+            const dim_t dim = conf.padded_16b && i == 1
+                    ? utils::rnd_up(padded_dims[i], 16)
+                    : padded_dims[i];
+            conf.dispatch.define_dim(dim_str, i, dim, block);
         } else if (i == 0) {
             // 1D indexing for dense_vect cases
             conf.dispatch.define_dim(dim_str, 0, conf.nelems, 16);
@@ -341,6 +374,9 @@ status_t simple_reorder_t::pd_t::init_conf(engine_t *engine) {
         conf.dispatch.vectorize_dim(dim_str, 16);
     } else if (conf.nchw) {
         conf.dispatch.vectorize_dim("D3", 16);
+    } else if (conf.padded_16b) {
+        auto dim_str = utils::format("D%d", last);
+        conf.dispatch.vectorize_dim(dim_str, 16);
     }
 
     conf.dispatch.generate();
@@ -349,7 +385,8 @@ status_t simple_reorder_t::pd_t::init_conf(engine_t *engine) {
 }
 
 status_t simple_reorder_t::pd_t::init_kernel_ctx(
-        compute::kernel_ctx_t &kernel_ctx) const {
+        compute::kernel_ctx_t &kernel_ctx,
+        const compute::dispatch_t &dispatch) const {
     using namespace format_tag;
 
     const memory_desc_wrapper src_mdw(src_md());
@@ -371,7 +408,7 @@ status_t simple_reorder_t::pd_t::init_kernel_ctx(
     }
     kernel_ctx.define_int("WITH_GROUP", conf.with_group);
 
-    def_dispatch(kernel_ctx, conf.dispatch);
+    def_dispatch(kernel_ctx, dispatch);
 
     // the 'unaligned_sizes' kernel uses the same implementation in .cl
     // the difference is in sizes of blocks[]
@@ -484,6 +521,14 @@ status_t simple_reorder_t::pd_t::init_kernel_ctx(
 
     if (conf.nchw) { kernel_ctx.define_int("REORDER_NCHW", 1); }
 
+    if (conf.padded_16b) {
+        kernel_ctx.define_int("PADDED_16B", 1);
+        if (conf.padded_16b == 1) kernel_ctx.define_int("PLAIN_TO_BLOCK", 1);
+        if (utils::one_of(src_mdw.data_type(), dnnl_s8, dnnl_u8)
+                || utils::one_of(dst_mdw.data_type(), dnnl_s8, dnnl_u8))
+            kernel_ctx.add_option("-Dcl_intel_subgroups_char");
+    }
+
     kernel_ctx.print_options();
     return status::success;
 }
@@ -496,6 +541,18 @@ void simple_reorder_t::pd_t::init_scratchpad() {
     }
 }
 
+void simple_reorder_t::pd_t::init_tuning_args(
+        compute::dispatch_tuner_t &tuner) const {
+    tuner.set_buffer_arg(0, memory_desc_wrapper(src_md()).size());
+    tuner.set_buffer_arg(1, memory_desc_wrapper(dst_md()).size());
+    tuner.arg_list().set(2, alpha());
+    tuner.arg_list().set(3, beta());
+    if (conf.scale_quant)
+        tuner.set_buffer_arg(4, sizeof(float) * attr()->output_scales_.count_);
+    else
+        tuner.arg_list().set(4, memory_storage_t::empty_storage());
+}
+
 status_t simple_reorder_t::execute(const exec_ctx_t &ctx) const {
 
     auto &src = CTX_IN_STORAGE(DNNL_ARG_FROM);
@@ -532,7 +589,7 @@ status_t simple_reorder_t::execute(const exec_ctx_t &ctx) const {
     arg_list.set(3, beta);
     arg_list.set(4, scales ? *scales : memory_storage_t::empty_storage());
 
-    auto nd_range = conf.dispatch.nd_range();
+    auto nd_range = dispatch_.nd_range();
 
     status = parallel_for(ctx, nd_range, kernel_, arg_list);
 
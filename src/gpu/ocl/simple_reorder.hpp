@@ -94,7 +94,12 @@ struct simple_reorder_t : public gpu_primitive_t {
 
         status_t init_conf(engine_t *engine);
         void init_scratchpad();
-        status_t init_kernel_ctx(compute::kernel_ctx_t &kernel_ctx) const;
+        status_t init_kernel_ctx(compute::kernel_ctx_t &kernel_ctx) const {
+            return init_kernel_ctx(kernel_ctx, conf.dispatch);
+        }
+        status_t init_kernel_ctx(compute::kernel_ctx_t &kernel_ctx,
+                const compute::dispatch_t &dispatch) const;
+        void init_tuning_args(compute::dispatch_tuner_t &tuner) const;
 
         reorder_conf_t conf;
     };
@@ -102,15 +107,18 @@ struct simple_reorder_t : public gpu_primitive_t {
     simple_reorder_t(const pd_t *apd) : gpu_primitive_t(apd) {}
 
     status_t init(engine_t *engine) override {
-        compute::kernel_ctx_t kernel_ctx;
-
-        auto status = pd()->init_kernel_ctx(kernel_ctx);
-        if (status != status::success) return status;
-
         const auto &conf = pd()->conf;
         if (conf.nelems == 0) return status::success;
 
-        create_kernel(engine, &kernel_, "simple_reorder", kernel_ctx);
+        dispatch_ = conf.dispatch;
+        compute::dispatch_tuner_t tuner("simple_reorder",
+                [&](compute::kernel_ctx_t &kernel_ctx,
+                        const compute::dispatch_t &dispatch) {
+                    return pd()->init_kernel_ctx(kernel_ctx, dispatch);
+                });
+        pd()->init_tuning_args(tuner);
+
+        create_kernel(engine, &kernel_, tuner, dispatch_);
         if (!kernel_) return status::runtime_error;
         return status::success;
     }
@@ -120,6 +128,7 @@ struct simple_reorder_t : public gpu_primitive_t {
 private:
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
     compute::kernel_t kernel_;
+    compute::dispatch_t dispatch_;
 };
 
 } // namespace ocl
@@ -39,8 +39,17 @@ void print_verbose_header() {
         auto s_name = dev_info ? dev_info->name() : "unknown";
         auto s_ver = dev_info ? dev_info->runtime_version().str() : "unknown";
 
-        printf("dnnl_verbose,info,gpu,engine,%d,name:%s,driver_version:%s\n",
-                (int)i, s_name.c_str(), s_ver.c_str());
+        if (get_verbose_json()) {
+            std::string s = "{\"event\":\"info\",\"engine\":\"gpu\"";
+            verbose_json_append(s, "name", s_name.c_str());
+            verbose_json_append(s, "driver_version", s_ver.c_str());
+            verbose_printf("%s,\"index\":%d}\n", s.c_str(), (int)i);
+        } else {
+            verbose_printf(
+                    "dnnl_verbose,info,gpu,engine,%d,name:%s,driver_version:"
+                    "%s\n",
+                    (int)i, s_name.c_str(), s_ver.c_str());
+        }
     }
 }
 
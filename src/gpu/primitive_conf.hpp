@@ -373,6 +373,7 @@ struct rnn_conf_t {
     bool is_int8;
     bool is_testmode;
     bool is_training;
+    bool use_fused_cell;
     data_type_t src_dt;
     data_type_t wei_dt;
     data_type_t bia_dt;
@@ -418,6 +419,7 @@ struct rnn_conf_t {
     int diff_dst_iter_c_ndims;
     int diff_bias_ndims;
     int states_ws_ld, gates_ws_ld, diff_states_ws_ld, scratch_gates_ld;
+    int weights_iter_ld;
 
     int wei_qparam_mask;
 
@@ -470,6 +472,8 @@ struct bnorm_conf_t {
     bool vectorize_calc_stats;
     bool skip_reduce_stat;
 
+    attr_info_t attr_info;
+
     compute::dispatch_t dispatch_calc_stat;
     compute::dispatch_t dispatch_reduce_stat;
     compute::dispatch_t dispatch;
@@ -496,6 +500,23 @@ struct lnorm_conf_t {
     compute::dispatch_t dispatch;
 };
 
+// Group Normalization
+struct gnorm_conf_t {
+    data_type_t data_type;
+
+    int ndims;
+    int mb, c, g;
+    int id, ih, iw;
+
+    bool use_scaleshift;
+    bool calculate_stats;
+    bool save_stats;
+    float eps;
+
+    compute::dispatch_t dispatch;
+    attr_info_t attr_info;
+};
+
 // Binary
 struct binary_conf_t {
     int ndims, nvect;
@@ -526,6 +547,25 @@ struct binary_conf_t {
     attr_info_t attr_info;
 };
 
+// PReLU
+struct prelu_conf_t {
+    bool is_forward;
+    int ndims;
+    // The weights dims broadcast over are reduced for the weights gradient,
+    // reduce_dims[d] is the size of dimension d if it is reduced, 1 otherwise.
+    int reduce_dims[MAX_NDIMS];
+    dim_t wei_nelems, reduce_nelems;
+    int nchunks, chunk_size;
+
+    memory_desc_info_t src_md_info;
+    memory_desc_info_t wei_md_info;
+    memory_desc_info_t dst_md_info;
+    memory_desc_info_t diff_src_md_info;
+    memory_desc_info_t diff_wei_md_info;
+
+    compute::dispatch_t dispatch;
+};
+
 // Reduction
 struct reduction_conf_t {
     int ndims, power, div;
@@ -537,6 +577,10 @@ struct reduction_conf_t {
     compute::dispatch_t dispatch;
     memory_desc_info_t src_md_info, dst_md_info;
     offsets_t off;
+
+    // Two-phase reduction.
+    dim_t reduce_nelems, dst_nelems;
+    int vect_size, lws, nchunks, chunk_size;
 };
 
 // Reorder
@@ -548,6 +592,7 @@ struct reorder_conf_t {
     bool plain_to_ABxx8ayb;
     bool plain_xFxE_to_abcdef;
     int transpose16x16; // 3-state logic
+    int padded_16b; // 3-state logic, the same as transpose16x16
     bool nchw;
     bool unaligned_sizes;
     int ndims;
@@ -864,6 +909,10 @@ inline void def_eltwise_alg_kinds(compute::kernel_ctx_t &kernel_ctx) {
     kernel_ctx.define_int("POW", alg_kind::eltwise_pow);
     kernel_ctx.define_int("GELU_ERF", alg_kind::eltwise_gelu_erf);
     kernel_ctx.define_int("ROUND", alg_kind::eltwise_round);
+    kernel_ctx.define_int("HARDSWISH", alg_kind::eltwise_hardswish);
+    kernel_ctx.define_int("HARDSIGMOID", alg_kind::eltwise_hardsigmoid);
+    kernel_ctx.define_int("MISH", alg_kind::eltwise_mish);
+    kernel_ctx.define_int("SELU", alg_kind::eltwise_selu);
 
     kernel_ctx.define_int("RELU_DST", alg_kind::eltwise_relu_use_dst_for_bwd);
     kernel_ctx.define_int(
@@ -999,14 +1048,13 @@ inline void def_post_ops_cfg(
     kernel_ctx.add_option(po_kernel_args);
 }
 
-inline int append_post_ops_to_arg_list(const exec_ctx_t &ctx,
+template <typename binary_arg_func_t>
+inline int append_post_ops_to_arg_list_common(
         compute::kernel_arg_list_t &arg_list, int post_op_idx,
-        const post_ops_t &all_post_ops) {
+        const post_ops_t &all_post_ops, const binary_arg_func_t &binary_arg) {
     auto set_arg_entry = [&](const post_ops_t::entry_t &e, int po_idx) {
         if (e.is_binary()) {
-            auto &binary_arg = CTX_IN_STORAGE(
-                    DNNL_ARG_ATTR_MULTIPLE_POST_OP(po_idx) | DNNL_ARG_SRC_1);
-            arg_list.set(post_op_idx++, binary_arg);
+            arg_list.set(post_op_idx++, binary_arg(po_idx));
         } else {
             arg_list.set(post_op_idx++, memory_storage_t::empty_storage());
         }
@@ -1038,6 +1086,26 @@ inline int append_post_ops_to_arg_list(const exec_ctx_t &ctx,
     return post_op_idx;
 }
 
+inline int append_post_ops_to_arg_list(const exec_ctx_t &ctx,
+        compute::kernel_arg_list_t &arg_list, int post_op_idx,
+        const post_ops_t &all_post_ops) {
+    return append_post_ops_to_arg_list_common(arg_list, post_op_idx,
+            all_post_ops, [&](int po_idx) -> const memory_storage_t & {
+                const int po_arg = DNNL_ARG_ATTR_MULTIPLE_POST_OP(po_idx);
+                return CTX_IN_STORAGE(po_arg | DNNL_ARG_SRC_1);
+            });
+}
+
+// Same as above without the binary post-op sources, e.g. for the kernel
+// executions when tuning the dispatch.
+inline int append_post_ops_to_arg_list(compute::kernel_arg_list_t &arg_list,
+        int post_op_idx, const post_ops_t &all_post_ops) {
+    return append_post_ops_to_arg_list_common(arg_list, post_op_idx,
+            all_post_ops, [](int) -> const memory_storage_t & {
+                return memory_storage_t::empty_storage();
+            });
+}
+
 inline bool post_ops_preserves_zeroes(
         const exec_ctx_t &ctx, const post_ops_t &all_post_ops) {
     bool preserve_zeroes = true;
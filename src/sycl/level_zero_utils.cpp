@@ -18,6 +18,7 @@
 
 #if defined(DNNL_WITH_LEVEL_ZERO)
 
+#include <stdint.h>
 #include <stdio.h>
 
 #if defined(__linux__)
@@ -42,6 +43,7 @@
 #include <CL/sycl/backend/level_zero.hpp>
 
 #include "common/c_types_map.hpp"
+#include "common/utils.hpp"
 #include "common/verbose.hpp"
 
 #include "sycl/sycl_gpu_engine.hpp"
@@ -60,7 +62,34 @@ device_uuid_t get_device_uuid(const cl::sycl::device &) {
 
 status_t sycl_create_kernel_with_level_zero(std::unique_ptr<cl::sycl::kernel> &,
         const sycl_gpu_engine_t *, const std::vector<unsigned char> &,
-        const std::string &) {
+        const std::string &, void **) {
+    return status::unimplemented;
+}
+
+status_t ze_destroy_kernel(void *) {
+    return status::unimplemented;
+}
+
+bool ze_immediate_list_enabled() {
+    return false;
+}
+
+status_t ze_immediate_list_t::create(std::unique_ptr<ze_immediate_list_t> &,
+        const cl::sycl::device &, const cl::sycl::context &) {
+    return status::unimplemented;
+}
+
+ze_immediate_list_t::~ze_immediate_list_t() = default;
+
+status_t ze_immediate_list_t::set_arg(void *, int, size_t, const void *) {
+    return status::unimplemented;
+}
+
+status_t ze_immediate_list_t::launch(void *, const size_t *, const size_t *) {
+    return status::unimplemented;
+}
+
+status_t ze_immediate_list_t::synchronize() {
     return status::unimplemented;
 }
 
@@ -142,6 +171,154 @@ status_t func_zeDeviceGetProperties(
     return status::success;
 }
 
+status_t func_zeKernelCreate(ze_module_handle_t hModule,
+        const ze_kernel_desc_t *desc, ze_kernel_handle_t *phKernel) {
+    static auto f = find_ze_symbol<decltype(&zeKernelCreate)>("zeKernelCreate");
+
+    if (!f) return status::runtime_error;
+    ZE_CHECK(f(hModule, desc, phKernel));
+    return status::success;
+}
+
+status_t func_zeKernelDestroy(ze_kernel_handle_t hKernel) {
+    static auto f
+            = find_ze_symbol<decltype(&zeKernelDestroy)>("zeKernelDestroy");
+
+    if (!f) return status::runtime_error;
+    ZE_CHECK(f(hKernel));
+    return status::success;
+}
+
+status_t func_zeKernelSetArgumentValue(ze_kernel_handle_t hKernel,
+        uint32_t argIndex, size_t argSize, const void *pArgValue) {
+    static auto f = find_ze_symbol<decltype(&zeKernelSetArgumentValue)>(
+            "zeKernelSetArgumentValue");
+
+    if (!f) return status::runtime_error;
+    ZE_CHECK(f(hKernel, argIndex, argSize, pArgValue));
+    return status::success;
+}
+
+status_t func_zeKernelSetGroupSize(ze_kernel_handle_t hKernel,
+        uint32_t groupSizeX, uint32_t groupSizeY, uint32_t groupSizeZ) {
+    static auto f = find_ze_symbol<decltype(&zeKernelSetGroupSize)>(
+            "zeKernelSetGroupSize");
+
+    if (!f) return status::runtime_error;
+    ZE_CHECK(f(hKernel, groupSizeX, groupSizeY, groupSizeZ));
+    return status::success;
+}
+
+status_t func_zeKernelSuggestGroupSize(ze_kernel_handle_t hKernel,
+        uint32_t globalSizeX, uint32_t globalSizeY, uint32_t globalSizeZ,
+        uint32_t *groupSizeX, uint32_t *groupSizeY, uint32_t *groupSizeZ) {
+    static auto f = find_ze_symbol<decltype(&zeKernelSuggestGroupSize)>(
+            "zeKernelSuggestGroupSize");
+
+    if (!f) return status::runtime_error;
+    ZE_CHECK(f(hKernel, globalSizeX, globalSizeY, globalSizeZ, groupSizeX,
+            groupSizeY, groupSizeZ));
+    return status::success;
+}
+
+status_t func_zeCommandListCreateImmediate(ze_context_handle_t hContext,
+        ze_device_handle_t hDevice, const ze_command_queue_desc_t *altdesc,
+        ze_command_list_handle_t *phCommandList) {
+    static auto f = find_ze_symbol<decltype(&zeCommandListCreateImmediate)>(
+            "zeCommandListCreateImmediate");
+
+    if (!f) return status::runtime_error;
+    ZE_CHECK(f(hContext, hDevice, altdesc, phCommandList));
+    return status::success;
+}
+
+status_t func_zeCommandListDestroy(ze_command_list_handle_t hCommandList) {
+    static auto f = find_ze_symbol<decltype(&zeCommandListDestroy)>(
+            "zeCommandListDestroy");
+
+    if (!f) return status::runtime_error;
+    ZE_CHECK(f(hCommandList));
+    return status::success;
+}
+
+status_t func_zeCommandListAppendLaunchKernel(
+        ze_command_list_handle_t hCommandList, ze_kernel_handle_t hKernel,
+        const ze_group_count_t *pLaunchFuncArgs,
+        ze_event_handle_t hSignalEvent) {
+    static auto f = find_ze_symbol<decltype(&zeCommandListAppendLaunchKernel)>(
+            "zeCommandListAppendLaunchKernel");
+
+    if (!f) return status::runtime_error;
+    ZE_CHECK(f(hCommandList, hKernel, pLaunchFuncArgs, hSignalEvent, 0,
+            nullptr));
+    return status::success;
+}
+
+status_t func_zeCommandListAppendBarrier(ze_command_list_handle_t hCommandList,
+        ze_event_handle_t hSignalEvent) {
+    static auto f = find_ze_symbol<decltype(&zeCommandListAppendBarrier)>(
+            "zeCommandListAppendBarrier");
+
+    if (!f) return status::runtime_error;
+    ZE_CHECK(f(hCommandList, hSignalEvent, 0, nullptr));
+    return status::success;
+}
+
+status_t func_zeEventPoolCreate(ze_context_handle_t hContext,
+        const ze_event_pool_desc_t *desc, ze_device_handle_t hDevice,
+        ze_event_pool_handle_t *phEventPool) {
+    static auto f
+            = find_ze_symbol<decltype(&zeEventPoolCreate)>("zeEventPoolCreate");
+
+    if (!f) return status::runtime_error;
+    ZE_CHECK(f(hContext, desc, 1, &hDevice, phEventPool));
+    return status::success;
+}
+
+status_t func_zeEventPoolDestroy(ze_event_pool_handle_t hEventPool) {
+    static auto f = find_ze_symbol<decltype(&zeEventPoolDestroy)>(
+            "zeEventPoolDestroy");
+
+    if (!f) return status::runtime_error;
+    ZE_CHECK(f(hEventPool));
+    return status::success;
+}
+
+status_t func_zeEventCreate(ze_event_pool_handle_t hEventPool,
+        const ze_event_desc_t *desc, ze_event_handle_t *phEvent) {
+    static auto f = find_ze_symbol<decltype(&zeEventCreate)>("zeEventCreate");
+
+    if (!f) return status::runtime_error;
+    ZE_CHECK(f(hEventPool, desc, phEvent));
+    return status::success;
+}
+
+status_t func_zeEventDestroy(ze_event_handle_t hEvent) {
+    static auto f = find_ze_symbol<decltype(&zeEventDestroy)>("zeEventDestroy");
+
+    if (!f) return status::runtime_error;
+    ZE_CHECK(f(hEvent));
+    return status::success;
+}
+
+status_t func_zeEventHostSynchronize(ze_event_handle_t hEvent) {
+    static auto f = find_ze_symbol<decltype(&zeEventHostSynchronize)>(
+            "zeEventHostSynchronize");
+
+    if (!f) return status::runtime_error;
+    ZE_CHECK(f(hEvent, UINT64_MAX));
+    return status::success;
+}
+
+status_t func_zeEventHostReset(ze_event_handle_t hEvent) {
+    static auto f
+            = find_ze_symbol<decltype(&zeEventHostReset)>("zeEventHostReset");
+
+    if (!f) return status::runtime_error;
+    ZE_CHECK(f(hEvent));
+    return status::success;
+}
+
 } // namespace
 
 // FIXME: Currently SYCL doesn't provide any API to get device UUID so
@@ -171,7 +348,7 @@ status_t sycl_create_kernel_with_level_zero(
         std::unique_ptr<cl::sycl::kernel> &sycl_kernel,
         const sycl_gpu_engine_t *sycl_engine,
         const std::vector<unsigned char> &binary,
-        const std::string &kernel_name) {
+        const std::string &kernel_name, void **ze_kernel) {
     auto desc = ze_module_desc_t();
     desc.stype = ZE_STRUCTURE_TYPE_MODULE_DESC;
     desc.format = ZE_MODULE_FORMAT_NATIVE;
@@ -193,6 +370,128 @@ status_t sycl_create_kernel_with_level_zero(
     sycl_kernel.reset(
             new cl::sycl::kernel(sycl_program.get_kernel(kernel_name)));
 
+    if (ze_kernel) {
+        // The module is owned by the SYCL program, which outlives the kernel
+        // as the SYCL kernel keeps a reference to it
+        auto kernel_desc = ze_kernel_desc_t();
+        kernel_desc.stype = ZE_STRUCTURE_TYPE_KERNEL_DESC;
+        kernel_desc.pKernelName = kernel_name.c_str();
+
+        ze_kernel_handle_t ze_kernel_handle;
+        CHECK(func_zeKernelCreate(ze_module, &kernel_desc, &ze_kernel_handle));
+        *ze_kernel = ze_kernel_handle;
+    }
+
+    return status::success;
+}
+
+status_t ze_destroy_kernel(void *ze_kernel) {
+    if (!ze_kernel) return status::success;
+    return func_zeKernelDestroy(static_cast<ze_kernel_handle_t>(ze_kernel));
+}
+
+bool ze_immediate_list_enabled() {
+    static const bool enabled
+            = getenv_int("DNNL_SYCL_LEVEL_ZERO_IMMEDIATE_LIST", 0) != 0;
+    return enabled;
+}
+
+status_t ze_immediate_list_t::create(std::unique_ptr<ze_immediate_list_t> &list,
+        const cl::sycl::device &dev, const cl::sycl::context &ctx) {
+    auto ze_device = dev.get_native<cl::sycl::backend::level_zero>();
+    auto ze_ctx = ctx.get_native<cl::sycl::backend::level_zero>();
+
+    std::unique_ptr<ze_immediate_list_t> l(new ze_immediate_list_t());
+
+    auto queue_desc = ze_command_queue_desc_t();
+    queue_desc.stype = ZE_STRUCTURE_TYPE_COMMAND_QUEUE_DESC;
+    queue_desc.ordinal = 0;
+    queue_desc.index = 0;
+    queue_desc.mode = ZE_COMMAND_QUEUE_MODE_ASYNCHRONOUS;
+    queue_desc.priority = ZE_COMMAND_QUEUE_PRIORITY_NORMAL;
+    ze_command_list_handle_t ze_list;
+    CHECK(func_zeCommandListCreateImmediate(
+            ze_ctx, ze_device, &queue_desc, &ze_list));
+    l->list_ = ze_list;
+
+    // A single host-visible event is enough to wait for the whole list as
+    // it is in-order
+    auto pool_desc = ze_event_pool_desc_t();
+    pool_desc.stype = ZE_STRUCTURE_TYPE_EVENT_POOL_DESC;
+    pool_desc.flags = ZE_EVENT_POOL_FLAG_HOST_VISIBLE;
+    pool_desc.count = 1;
+    ze_event_pool_handle_t ze_event_pool;
+    CHECK(func_zeEventPoolCreate(
+            ze_ctx, &pool_desc, ze_device, &ze_event_pool));
+    l->event_pool_ = ze_event_pool;
+
+    auto event_desc = ze_event_desc_t();
+    event_desc.stype = ZE_STRUCTURE_TYPE_EVENT_DESC;
+    event_desc.index = 0;
+    event_desc.signal = ZE_EVENT_SCOPE_FLAG_HOST;
+    event_desc.wait = ZE_EVENT_SCOPE_FLAG_HOST;
+    ze_event_handle_t ze_event;
+    CHECK(func_zeEventCreate(ze_event_pool, &event_desc, &ze_event));
+    l->event_ = ze_event;
+
+    list = std::move(l);
+    return status::success;
+}
+
+ze_immediate_list_t::~ze_immediate_list_t() {
+    if (list_) {
+        synchronize();
+        func_zeCommandListDestroy(static_cast<ze_command_list_handle_t>(list_));
+    }
+    if (event_) func_zeEventDestroy(static_cast<ze_event_handle_t>(event_));
+    if (event_pool_)
+        func_zeEventPoolDestroy(
+                static_cast<ze_event_pool_handle_t>(event_pool_));
+}
+
+status_t ze_immediate_list_t::set_arg(
+        void *ze_kernel, int index, size_t size, const void *value) {
+    return func_zeKernelSetArgumentValue(
+            static_cast<ze_kernel_handle_t>(ze_kernel), index, size, value);
+}
+
+status_t ze_immediate_list_t::launch(void *ze_kernel,
+        const size_t *global_range, const size_t *local_range) {
+    auto kernel = static_cast<ze_kernel_handle_t>(ze_kernel);
+
+    uint32_t gws[3], lws[3];
+    for (int i = 0; i < 3; i++)
+        gws[i] = (uint32_t)global_range[i];
+
+    if (local_range) {
+        for (int i = 0; i < 3; i++)
+            lws[i] = (uint32_t)local_range[i];
+    } else {
+        CHECK(func_zeKernelSuggestGroupSize(kernel, gws[0], gws[1], gws[2],
+                &lws[0], &lws[1], &lws[2]));
+    }
+    CHECK(func_zeKernelSetGroupSize(kernel, lws[0], lws[1], lws[2]));
+
+    ze_group_count_t group_count;
+    group_count.groupCountX = gws[0] / lws[0];
+    group_count.groupCountY = gws[1] / lws[1];
+    group_count.groupCountZ = gws[2] / lws[2];
+    CHECK(func_zeCommandListAppendLaunchKernel(
+            static_cast<ze_command_list_handle_t>(list_), kernel, &group_count,
+            nullptr));
+    has_pending_work_ = true;
+    return status::success;
+}
+
+status_t ze_immediate_list_t::synchronize() {
+    if (!has_pending_work_) return status::success;
+
+    auto ze_event = static_cast<ze_event_handle_t>(event_);
+    CHECK(func_zeCommandListAppendBarrier(
+            static_cast<ze_command_list_handle_t>(list_), ze_event));
+    CHECK(func_zeEventHostSynchronize(ze_event));
+    CHECK(func_zeEventHostReset(ze_event));
+    has_pending_work_ = false;
     return status::success;
 }
 
@@ -33,11 +33,48 @@ device_uuid_t get_device_uuid(const cl::sycl::device &dev);
 // including sycl_gpu_engine.hpp leads to circular dependencies, w/a for now.
 struct sycl_gpu_engine_t;
 
+// When ze_kernel is not null it also returns a Level Zero kernel created
+// from the same module. The kernel is to be destroyed with
+// ze_destroy_kernel().
 status_t sycl_create_kernel_with_level_zero(
         std::unique_ptr<cl::sycl::kernel> &sycl_kernel,
         const sycl_gpu_engine_t *sycl_engine,
         const std::vector<unsigned char> &binary,
-        const std::string &kernel_name);
+        const std::string &kernel_name, void **ze_kernel = nullptr);
+
+status_t ze_destroy_kernel(void *ze_kernel);
+
+// Returns true when GPU streams should submit kernels through Level Zero
+// immediate command lists, set via DNNL_SYCL_LEVEL_ZERO_IMMEDIATE_LIST.
+bool ze_immediate_list_enabled();
+
+// Level Zero immediate command list. Kernels appended to it are submitted to
+// the device right away, without going through the SYCL runtime scheduler.
+// The list is in-order, synchronize() waits for all the appended kernels.
+class ze_immediate_list_t {
+public:
+    static status_t create(std::unique_ptr<ze_immediate_list_t> &list,
+            const cl::sycl::device &dev, const cl::sycl::context &ctx);
+    ~ze_immediate_list_t();
+
+    // Not thread-safe: kernel arguments are a state of the kernel, the caller
+    // has to guard set_arg() and launch() calls for the same kernel.
+    static status_t set_arg(
+            void *ze_kernel, int index, size_t size, const void *value);
+    status_t launch(void *ze_kernel, const size_t *global_range,
+            const size_t *local_range);
+
+    status_t synchronize();
+    bool has_pending_work() const { return has_pending_work_; }
+
+private:
+    ze_immediate_list_t() = default;
+
+    void *list_ = nullptr;
+    void *event_pool_ = nullptr;
+    void *event_ = nullptr;
+    bool has_pending_work_ = false;
+};
 
 } // namespace sycl
 } // namespace impl
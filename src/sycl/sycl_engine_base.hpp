@@ -28,6 +28,7 @@
 #include "gpu/ocl/ocl_gpu_engine.hpp"
 #include "gpu/ocl/ocl_utils.hpp"
 #include "sycl/sycl_interop_gpu_kernel.hpp"
+#include "sycl/sycl_usm_pool.hpp"
 #include "sycl/sycl_utils.hpp"
 
 #include <CL/sycl.hpp>
@@ -52,6 +53,11 @@ public:
 
         CHECK(gpu::compute::compute_engine_t::init());
 
+#ifdef DNNL_SYCL_DPCPP
+        usm_pool_.reset(new sycl_usm_pool_t(device_, context_));
+        if (!usm_pool_) return status::out_of_memory;
+#endif
+
         return status::success;
     }
 
@@ -102,7 +108,8 @@ public:
             auto *k = utils::downcast<gpu::ocl::ocl_gpu_kernel_t *>(
                     ocl_kernels[i].impl());
             (*kernels)[i] = gpu::compute::kernel_t(
-                    new sycl_interop_gpu_kernel_t(k->binary(), k->name()));
+                    new sycl_interop_gpu_kernel_t(
+                            k->binary(), k->name(), k->binary_key_hash()));
         }
         return status::success;
     }
@@ -112,6 +119,11 @@ public:
 
     backend_t backend() const { return backend_; }
 
+#ifdef DNNL_SYCL_DPCPP
+    // The pool for the USM memory allocated by the library
+    sycl_usm_pool_t &usm_pool() const { return *usm_pool_; }
+#endif
+
     cl_device_id ocl_device() const {
         if (backend() != backend_t::opencl) {
             assert(!"not expected");
@@ -140,6 +152,10 @@ private:
 
     backend_t backend_;
 
+#ifdef DNNL_SYCL_DPCPP
+    std::unique_ptr<sycl_usm_pool_t> usm_pool_;
+#endif
+
     status_t create_ocl_engine(
             std::unique_ptr<gpu::ocl::ocl_gpu_engine_t> *ocl_engine) const {
         gpu::ocl::ocl_engine_factory_t f(engine_kind::gpu);
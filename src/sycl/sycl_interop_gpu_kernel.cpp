@@ -101,6 +101,7 @@ status_t sycl_interop_gpu_kernel_t::realize(
 
     std::unique_ptr<cl::sycl::kernel> sycl_kernel;
     std::vector<gpu::compute::scalar_type_t> arg_types;
+    void *ze_kernel = nullptr;
 
     if (sycl_engine->backend() == backend_t::opencl) {
         gpu::ocl::ocl_wrapper_t<cl_kernel> ocl_kernel;
@@ -138,8 +139,9 @@ status_t sycl_interop_gpu_kernel_t::realize(
                 ocl_engine->context(), binary_, binary_name_));
         CHECK(get_kernel_arg_types(arg_types, ocl_kernel));
 
-        CHECK(sycl_create_kernel_with_level_zero(
-                sycl_kernel, sycl_engine, binary_, binary_name_));
+        CHECK(sycl_create_kernel_with_level_zero(sycl_kernel, sycl_engine,
+                binary_, binary_name_,
+                ze_immediate_list_enabled() ? &ze_kernel : nullptr));
 #else
         assert(!"not expected");
         return status::invalid_arguments;
@@ -150,11 +152,77 @@ status_t sycl_interop_gpu_kernel_t::realize(
     }
 
     (*kernel) = gpu::compute::kernel_t(
-            new sycl_interop_gpu_kernel_t(*sycl_kernel, arg_types));
+            new sycl_interop_gpu_kernel_t(*sycl_kernel, arg_types, ze_kernel));
 
     return status::success;
 }
 
+sycl_interop_gpu_kernel_t::~sycl_interop_gpu_kernel_t() {
+#ifdef DNNL_WITH_LEVEL_ZERO
+    ze_destroy_kernel(ze_kernel_);
+#endif
+}
+
+status_t sycl_interop_gpu_kernel_t::parallel_for_immediate(stream_t &stream,
+        const gpu::compute::nd_range_t &range,
+        const gpu::compute::kernel_arg_list_t &arg_list) const {
+#ifdef DNNL_WITH_LEVEL_ZERO
+    auto *sycl_stream = utils::downcast<sycl::sycl_stream_t *>(&stream);
+    auto *ze_list = sycl_stream->ze_immediate_list();
+    if (!ze_kernel_ || !ze_list) return status::unimplemented;
+
+    // Buffers require accessors, hence the SYCL runtime
+    for (int i = 0; i < arg_list.nargs(); ++i) {
+        auto &arg = arg_list.get(i);
+        if (!arg.is_global()) continue;
+        auto *mem_storage = static_cast<const memory_storage_t *>(arg.value());
+        if (!*mem_storage) continue;
+        auto *sycl_mem_storage
+                = utils::downcast<const sycl_memory_storage_base_t *>(
+                        mem_storage);
+        if (sycl_mem_storage->memory_kind() != memory_kind::usm)
+            return status::unimplemented;
+    }
+
+    // The immediate command list cannot wait for SYCL events so wait for the
+    // work submitted through the SYCL runtime on the host
+    for (auto &e : sycl_stream->get_deps())
+        cl::sycl::event(e).wait_and_throw();
+    sycl_stream->set_deps({});
+
+    std::lock_guard<std::mutex> lock(ze_kernel_mutex_);
+    for (int i = 0; i < arg_list.nargs(); ++i) {
+        auto &arg = arg_list.get(i);
+        if (arg.is_global()) {
+            auto *mem_storage
+                    = static_cast<const memory_storage_t *>(arg.value());
+            void *ptr = nullptr;
+            if (*mem_storage)
+                ptr = utils::downcast<const sycl_usm_memory_storage_t *>(
+                        mem_storage)
+                              ->usm_ptr();
+            CHECK(ze_immediate_list_t::set_arg(
+                    ze_kernel_, i, sizeof(ptr), &ptr));
+        } else if (arg.is_local()) {
+            CHECK(ze_immediate_list_t::set_arg(
+                    ze_kernel_, i, arg.size(), nullptr));
+        } else {
+            typename std::aligned_storage<sizeof(float),
+                    sizeof(float)>::type tmp_storage;
+            void *cast_storage = &tmp_storage;
+            auto cvt_arg = gpu::compute::kernel_arg_t::cast(
+                    arg_types_[i], arg, cast_storage);
+            CHECK(ze_immediate_list_t::set_arg(
+                    ze_kernel_, i, cvt_arg.size(), cvt_arg.value()));
+        }
+    }
+    return ze_list->launch(
+            ze_kernel_, range.global_range(), range.local_range());
+#else
+    return status::unimplemented;
+#endif
+}
+
 status_t sycl_interop_gpu_kernel_t::parallel_for(stream_t &stream,
         const gpu::compute::nd_range_t &range,
         const gpu::compute::kernel_arg_list_t &arg_list) const {
@@ -162,6 +230,15 @@ status_t sycl_interop_gpu_kernel_t::parallel_for(stream_t &stream,
 
     if (range.is_zero()) return status::success;
     auto *sycl_stream = utils::downcast<sycl::sycl_stream_t *>(&stream);
+
+#ifdef DNNL_WITH_LEVEL_ZERO
+    if (sycl_stream->ze_immediate_list()) {
+        status_t status = parallel_for_immediate(stream, range, arg_list);
+        if (status != status::unimplemented) return status;
+        CHECK(sycl_stream->wait_ze_immediate_list());
+    }
+#endif
+
     auto &queue = sycl_stream->queue();
 
     auto event = queue.submit([&](cl::sycl::handler &cgh) {
@@ -18,6 +18,7 @@
 #define SYCL_SYCL_INTEROP_GPU_KERNEL_HPP
 
 #include <assert.h>
+#include <mutex>
 #include <string>
 #include <CL/sycl.hpp>
 
@@ -30,11 +31,16 @@ namespace sycl {
 class sycl_interop_gpu_kernel_t : public gpu::compute::kernel_impl_t {
 public:
     sycl_interop_gpu_kernel_t(const std::vector<unsigned char> &binary,
-            const std::string &binary_name)
-        : state_(state_t::binary), binary_(binary), binary_name_(binary_name) {
+            const std::string &binary_name, uint64_t binary_key_hash = 0)
+        : state_(state_t::binary)
+        , binary_(binary)
+        , binary_name_(binary_name)
+        , binary_key_hash_(binary_key_hash) {
         MAYBE_UNUSED(state_);
     }
 
+    ~sycl_interop_gpu_kernel_t() override;
+
     cl::sycl::kernel sycl_kernel() const {
         assert(state_ == state_t::kernel);
         return *sycl_kernel_;
@@ -47,6 +53,12 @@ public:
     status_t realize(gpu::compute::kernel_t *kernel,
             const engine_t *engine) const override;
 
+    status_t get_cache_blob(cache_blob_t &cache_blob) const override {
+        if (state_ == state_t::binary && binary_key_hash_ != 0)
+            cache_blob.add(binary_key_hash_, binary_);
+        return status::success;
+    }
+
     const char *name() const {
         assert(state_ == state_t::binary);
         return binary_name_.c_str();
@@ -61,17 +73,33 @@ public:
 
 protected:
     sycl_interop_gpu_kernel_t(const cl::sycl::kernel &sycl_kernel,
-            const std::vector<gpu::compute::scalar_type_t> &arg_types)
+            const std::vector<gpu::compute::scalar_type_t> &arg_types,
+            void *ze_kernel = nullptr)
         : state_(state_t::kernel)
         , sycl_kernel_(new cl::sycl::kernel(sycl_kernel))
-        , arg_types_(arg_types) {}
+        , arg_types_(arg_types)
+        , ze_kernel_(ze_kernel) {}
+
+    // Submits the kernel to the Level Zero immediate command list of the
+    // stream. Returns status::unimplemented when the arguments cannot be
+    // passed without the SYCL runtime.
+    status_t parallel_for_immediate(stream_t &stream,
+            const gpu::compute::nd_range_t &range,
+            const gpu::compute::kernel_arg_list_t &arg_list) const;
 
     state_t state_;
     std::unique_ptr<cl::sycl::kernel> sycl_kernel_;
     std::vector<unsigned char> binary_;
     std::string binary_name_;
+    uint64_t binary_key_hash_ = 0;
 
     std::vector<gpu::compute::scalar_type_t> arg_types_;
+
+    // Level Zero kernel for the immediate command list submission, created
+    // from the same module as sycl_kernel_
+    void *ze_kernel_ = nullptr;
+    // Arguments are a state of the Level Zero kernel
+    mutable std::mutex ze_kernel_mutex_;
 };
 
 } // namespace sycl
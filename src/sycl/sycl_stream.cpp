@@ -93,6 +93,18 @@ status_t sycl_stream_t::init() {
         if (!args_ok) return status::invalid_arguments;
     }
 
+#ifdef DNNL_WITH_LEVEL_ZERO
+    // The immediate command list is in-order, so it can back in-order
+    // streams only
+    auto &sycl_engine = *utils::downcast<sycl_engine_base_t *>(engine());
+    if (engine()->kind() == engine_kind::gpu
+            && sycl_engine.backend() == backend_t::level0
+            && (flags() & stream_flags::in_order)
+            && ze_immediate_list_enabled())
+        CHECK(ze_immediate_list_t::create(
+                ze_list_, sycl_engine.device(), sycl_engine.context()));
+#endif
+
     return status::success;
 }
 
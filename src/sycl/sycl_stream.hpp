@@ -24,6 +24,7 @@
 #include "common/utils.hpp"
 #include "gpu/compute/compute_stream.hpp"
 #include "gpu/ocl/ocl_utils.hpp"
+#include "sycl/level_zero_utils.hpp"
 #include "sycl/sycl_gpu_engine.hpp"
 #include "sycl/sycl_memory_storage.hpp"
 #include "sycl/sycl_stream_cpu_thunk.hpp"
@@ -73,12 +74,29 @@ struct sycl_stream_t : public gpu::compute::compute_stream_t {
     }
 
     status_t wait() override {
+        CHECK(wait_ze_immediate_list());
         queue_->wait_and_throw();
         return status::success;
     }
 
     cl::sycl::queue &queue() { return *queue_; }
 
+#ifdef DNNL_WITH_LEVEL_ZERO
+    // Not null when kernels are submitted through a Level Zero immediate
+    // command list (see DNNL_SYCL_LEVEL_ZERO_IMMEDIATE_LIST)
+    ze_immediate_list_t *ze_immediate_list() const { return ze_list_.get(); }
+#endif
+
+    // Waits for the kernels submitted to the immediate command list. Has to
+    // be called before submitting anything through the SYCL runtime as the
+    // latter does not know about the list.
+    status_t wait_ze_immediate_list() const {
+#ifdef DNNL_WITH_LEVEL_ZERO
+        if (ze_list_) return ze_list_->synchronize();
+#endif
+        return status::success;
+    }
+
     status_t enqueue_primitive(const primitive_iface_t *prim_iface,
             exec_ctx_t &exec_ctx) override {
         auto execute_func = [&]() {
@@ -86,6 +104,15 @@ struct sycl_stream_t : public gpu::compute::compute_stream_t {
             if (engine()->kind() == engine_kind::cpu) {
 
 #if DNNL_CPU_RUNTIME == DNNL_RUNTIME_SYCL
+                // Skip the host task and the thunk when the queue has
+                // nothing to wait for: for small problems submission
+                // overhead dominates the execution time.
+                if (can_execute_cpu_primitive_inline(
+                            this, exec_ctx, get_deps())) {
+                    status = prim_iface->execute(exec_ctx);
+                    set_deps({});
+                    return status;
+                }
                 auto event = queue_->submit([&](cl::sycl::handler &cgh) {
                     register_deps(cgh);
                     submit_cpu_primitive(this, prim_iface, exec_ctx, cgh);
@@ -114,6 +141,7 @@ struct sycl_stream_t : public gpu::compute::compute_stream_t {
             size_t size) override {
         if (size == 0) return status::success;
         // TODO: add src and dst sizes check
+        CHECK(wait_ze_immediate_list());
 
         auto *sycl_src
                 = utils::downcast<const sycl_memory_storage_base_t *>(&src);
@@ -190,6 +218,7 @@ struct sycl_stream_t : public gpu::compute::compute_stream_t {
         auto *sycl_dst
                 = utils::downcast<const sycl_memory_storage_base_t *>(&dst);
         bool usm = sycl_dst->memory_kind() == memory_kind::usm;
+        CHECK(wait_ze_immediate_list());
 
         cl::sycl::event out_event;
         std::vector<cl::sycl::event> in_deps = get_deps();
@@ -230,6 +259,9 @@ struct sycl_stream_t : public gpu::compute::compute_stream_t {
     void set_deps(const std::vector<cl::sycl::event> &deps) { deps_ = deps; }
     void add_dep(const cl::sycl::event &dep) { deps_.push_back(dep); }
     cl::sycl::event get_output_event() const {
+        // The events cannot track the immediate command list
+        wait_ze_immediate_list();
+
         // Fast path: if only one event, return it.
         if (deps_.size() == 1) return deps_[0];
 
@@ -286,6 +318,10 @@ protected:
     // execution context.
     std::vector<cl::sycl::event> deps_;
 
+#ifdef DNNL_WITH_LEVEL_ZERO
+    std::unique_ptr<ze_immediate_list_t> ze_list_;
+#endif
+
 private:
     status_t init();
 };
@@ -365,6 +365,38 @@ void submit_cpu_primitive(stream_t *stream, const primitive_iface_t *prim_iface,
     }
 }
 
+bool can_execute_cpu_primitive_inline(const stream_t *stream,
+        const exec_ctx_t &exec_ctx,
+        const std::vector<cl::sycl::event> &deps) {
+#ifdef DNNL_SYCL_DPCPP
+    if (!(stream->flags() & stream_flags::in_order)) return false;
+
+    // Buffers require accessors, hence a command group
+    for (auto &a : exec_ctx.args()) {
+        if (a.second.mem->engine()->runtime_kind() != runtime_kind::sycl)
+            continue;
+        auto *mem_storage = a.second.mem->memory_storage();
+        if (mem_storage->is_null()) continue;
+        auto mem_api_kind
+                = utils::downcast<const sycl_memory_storage_base_t *>(
+                        mem_storage)
+                          ->memory_kind();
+        if (mem_api_kind != memory_kind::usm) return false;
+    }
+
+    // Otherwise the primitive could overtake the work it depends on
+    using namespace cl::sycl::info;
+    for (auto &e : deps) {
+        if (e.get_info<event::command_execution_status>()
+                != event_command_status::complete)
+            return false;
+    }
+    return true;
+#else
+    return false;
+#endif
+}
+
 } // namespace sycl
 } // namespace impl
 } // namespace dnnl
@@ -30,6 +30,13 @@ namespace sycl {
 void submit_cpu_primitive(stream_t *stream, const primitive_iface_t *prim_iface,
         const exec_ctx_t &exec_ctx, cl::sycl::handler &cgh);
 
+// Returns true when the primitive may be executed right away on the host
+// instead of being submitted to the queue: the stream is in-order, all the
+// dependencies have completed and no argument is backed by a SYCL buffer.
+bool can_execute_cpu_primitive_inline(const stream_t *stream,
+        const exec_ctx_t &exec_ctx,
+        const std::vector<cl::sycl::event> &deps);
+
 } // namespace sycl
 } // namespace impl
 } // namespace dnnl
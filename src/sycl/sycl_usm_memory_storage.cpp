@@ -55,7 +55,7 @@ status_t sycl_usm_memory_storage_t::map_data(
     void *host_ptr = cl::sycl::malloc_host(size, sycl_queue.get_context());
     if (!host_ptr) return status::out_of_memory;
 
-    sycl_queue.wait_and_throw();
+    CHECK(stream->wait());
     sycl_queue.memcpy(host_ptr, usm_ptr, size).wait();
 
     *mapped_ptr = host_ptr;
@@ -114,15 +114,14 @@ public:
 protected:
     status_t init_allocate(size_t size) override {
         auto *sycl_engine = utils::downcast<sycl_engine_base_t *>(engine());
-        auto &sycl_dev = sycl_engine->device();
-        auto &sycl_ctx = sycl_engine->context();
+        auto &usm_pool = sycl_engine->usm_pool();
 
         usm_kind_ = cl::sycl::usm::alloc::shared;
-        void *usm_ptr_alloc = cl::sycl::malloc_shared(size, sycl_dev, sycl_ctx);
+        void *usm_ptr_alloc = usm_pool.allocate(size);
         if (!usm_ptr_alloc) return status::out_of_memory;
 
         usm_ptr_ = decltype(usm_ptr_)(usm_ptr_alloc,
-                [&](void *ptr) { cl::sycl::free(ptr, sycl_ctx); });
+                [&](void *ptr) { usm_pool.deallocate(ptr); });
         return status::success;
     }
 
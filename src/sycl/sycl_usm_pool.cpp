@@ -0,0 +1,87 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "sycl/sycl_usm_pool.hpp"
+
+#ifdef DNNL_SYCL_DPCPP
+
+#include <assert.h>
+
+namespace dnnl {
+namespace impl {
+namespace sycl {
+
+void *sycl_usm_pool_t::allocate(size_t size) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        // Reuse the smallest cached block that fits but do not waste more
+        // than a half of it
+        auto it = free_blocks_.lower_bound(size);
+        if (it != free_blocks_.end() && it->first / 2 <= size) {
+            void *ptr = it->second;
+            cached_size_ -= it->first;
+            used_blocks_.emplace(ptr, it->first);
+            free_blocks_.erase(it);
+            return ptr;
+        }
+    }
+
+    void *ptr = cl::sycl::malloc_shared(size, dev_, ctx_);
+    if (!ptr) {
+        // Retry after giving the cached memory back
+        release();
+        ptr = cl::sycl::malloc_shared(size, dev_, ctx_);
+        if (!ptr) return nullptr;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    used_blocks_.emplace(ptr, size);
+    return ptr;
+}
+
+void sycl_usm_pool_t::deallocate(void *ptr) {
+    if (!ptr) return;
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = used_blocks_.find(ptr);
+        assert(it != used_blocks_.end());
+        const size_t size = it->second;
+        used_blocks_.erase(it);
+
+        if (cached_size_ + size <= capacity_) {
+            free_blocks_.emplace(size, ptr);
+            cached_size_ += size;
+            return;
+        }
+    }
+
+    cl::sycl::free(ptr, ctx_);
+}
+
+void sycl_usm_pool_t::release() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto &b : free_blocks_)
+        cl::sycl::free(b.second, ctx_);
+    free_blocks_.clear();
+    cached_size_ = 0;
+}
+
+} // namespace sycl
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -0,0 +1,90 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef SYCL_USM_POOL_HPP
+#define SYCL_USM_POOL_HPP
+
+#include "oneapi/dnnl/dnnl_config.h"
+
+#ifdef DNNL_SYCL_DPCPP
+
+#include <map>
+#include <mutex>
+#include <unordered_map>
+#include <CL/sycl.hpp>
+
+#include "common/c_types_map.hpp"
+#include "common/nstl.hpp"
+#include "common/utils.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace sycl {
+
+// Caches the shared USM blocks allocated by the library. USM allocation is
+// expensive and serializing on some backends (Level Zero in particular), so
+// freed blocks are kept up to the pool capacity and handed out again for
+// requests of a similar size.
+//
+// The capacity can be set via DNNL_SYCL_USM_POOL_CAPACITY (in MB). Zero
+// disables the caching.
+struct sycl_usm_pool_t {
+    sycl_usm_pool_t(const cl::sycl::device &dev, const cl::sycl::context &ctx)
+        : dev_(dev), ctx_(ctx), cached_size_(0) {
+        capacity_ = (size_t)nstl::max(
+                            0, getenv_int("DNNL_SYCL_USM_POOL_CAPACITY", 256))
+                << 20;
+    }
+
+    ~sycl_usm_pool_t() { release(); }
+
+    void *allocate(size_t size);
+    void deallocate(void *ptr);
+
+    // Returns all the cached blocks to the runtime. The blocks in use are
+    // not affected.
+    void release();
+
+    size_t capacity() const { return capacity_; }
+    size_t cached_size() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return cached_size_;
+    }
+
+private:
+    cl::sycl::device dev_;
+    cl::sycl::context ctx_;
+
+    size_t capacity_;
+    size_t cached_size_;
+
+    // size -> cached block
+    std::multimap<size_t, void *> free_blocks_;
+    // block -> its size, for the blocks handed out by the pool
+    std::unordered_map<void *, size_t> used_blocks_;
+
+    mutable std::mutex mutex_;
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(sycl_usm_pool_t);
+};
+
+} // namespace sycl
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+#endif // SYCL_USM_POOL_HPP
@@ -40,10 +40,20 @@ void print_verbose_header(engine_kind_t kind) {
         auto s_name = dev_info ? dev_info->name() : "unknown";
         auto s_ver = dev_info ? dev_info->runtime_version().str() : "unknown";
 
-        printf("dnnl_verbose,info,%s,engine,%d,backend:%s,name:%s,driver_"
-               "version:%s\n",
-                s_engine_kind, (int)i, s_backend.c_str(), s_name.c_str(),
-                s_ver.c_str());
+        if (get_verbose_json()) {
+            std::string s = "{\"event\":\"info\"";
+            verbose_json_append(s, "engine", s_engine_kind);
+            verbose_json_append(s, "backend", s_backend.c_str());
+            verbose_json_append(s, "name", s_name.c_str());
+            verbose_json_append(s, "driver_version", s_ver.c_str());
+            verbose_printf("%s,\"index\":%d}\n", s.c_str(), (int)i);
+        } else {
+            verbose_printf(
+                    "dnnl_verbose,info,%s,engine,%d,backend:%s,name:%s,driver_"
+                    "version:%s\n",
+                    s_engine_kind, (int)i, s_backend.c_str(), s_name.c_str(),
+                    s_ver.c_str());
+        }
     }
 }
 
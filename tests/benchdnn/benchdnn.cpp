@@ -60,10 +60,85 @@ const char *driver_name = "";
 double max_ms_per_prb {3e3};
 int min_times_per_prb {5};
 int fix_times_per_prb {0};
+bool cold_cache {false};
+int num_streams {1};
+bool perf_counters {false};
+std::string baseline;
+double baseline_threshold {5.};
+std::string model_name;
+double model_weight {1.};
+std::vector<model_stat_t> benchdnn_model_stat;
 
 bool fast_ref_gpu {true};
 bool allow_enum_tags_only {true};
 
+static const struct {
+    const char *name;
+    bench_f bench;
+} drivers[] = {
+        {"--self", self::bench},
+        {"--conv", conv::bench},
+        {"--deconv", deconv::bench},
+        {"--ip", ip::bench},
+        {"--shuffle", shuffle::bench},
+        {"--reorder", reorder::bench},
+        {"--bnorm", bnorm::bench},
+        {"--lnorm", lnorm::bench},
+        {"--rnn", rnn::bench},
+        {"--softmax", softmax::bench},
+        {"--pool", pool::bench},
+        {"--prelu", prelu::bench},
+        {"--sum", sum::bench},
+        {"--eltwise", eltwise::bench},
+        {"--concat", concat::bench},
+        {"--lrn", lrn::bench},
+        {"--binary", binary::bench},
+        {"--matmul", matmul::bench},
+        {"--resampling", resampling::bench},
+        {"--reduction", reduction::bench},
+        {"--zeropad", zeropad::bench},
+};
+
+static bench_f str2driver(const char *str) {
+    for (const auto &d : drivers)
+        if (!strcmp(d.name, str)) return d.bench;
+    return nullptr;
+}
+
+// Runs the drivers of the command line in turn, every driver takes the options
+// up to the next driver. A batch file given outside of a driver may run several
+// drivers, e.g. a model file of inputs/model.
+static int bench_drivers(int argc, char **argv) {
+    using namespace parser;
+
+    while (argc > 0) {
+        if (parse_bench_settings(argv[0])) {
+            --argc, ++argv;
+            continue;
+        }
+
+        // Searches the batch files in inputs/model by default
+        driver_name = "model";
+        if (parse_batch(bench_drivers, argv[0])) {
+            --argc, ++argv;
+            continue;
+        }
+
+        bench_f bench = str2driver(argv[0]);
+        if (!bench) {
+            fprintf(stderr, "err: unknown driver `%s`\n", argv[0]);
+            return FAIL;
+        }
+
+        int n = 1;
+        while (n < argc && !str2driver(argv[n]))
+            ++n;
+        bench(n - 1, argv + 1);
+        argc -= n, argv += n;
+    }
+    return OK;
+}
+
 int main(int argc, char **argv) {
     using namespace parser;
 
@@ -80,51 +155,11 @@ int main(int argc, char **argv) {
     for (; argc > 0; --argc, ++argv)
         if (!parse_bench_settings(argv[0])) break;
 
-    if (!strcmp("--self", argv[0])) {
-        self::bench(--argc, ++argv);
-    } else if (!strcmp("--conv", argv[0])) {
-        conv::bench(--argc, ++argv);
-    } else if (!strcmp("--deconv", argv[0])) {
-        deconv::bench(--argc, ++argv);
-    } else if (!strcmp("--ip", argv[0])) {
-        ip::bench(--argc, ++argv);
-    } else if (!strcmp("--shuffle", argv[0])) {
-        shuffle::bench(--argc, ++argv);
-    } else if (!strcmp("--reorder", argv[0])) {
-        reorder::bench(--argc, ++argv);
-    } else if (!strcmp("--bnorm", argv[0])) {
-        bnorm::bench(--argc, ++argv);
-    } else if (!strcmp("--lnorm", argv[0])) {
-        lnorm::bench(--argc, ++argv);
-    } else if (!strcmp("--rnn", argv[0])) {
-        rnn::bench(--argc, ++argv);
-    } else if (!strcmp("--softmax", argv[0])) {
-        softmax::bench(--argc, ++argv);
-    } else if (!strcmp("--pool", argv[0])) {
-        pool::bench(--argc, ++argv);
-    } else if (!strcmp("--prelu", argv[0])) {
-        prelu::bench(--argc, ++argv);
-    } else if (!strcmp("--sum", argv[0])) {
-        sum::bench(--argc, ++argv);
-    } else if (!strcmp("--eltwise", argv[0])) {
-        eltwise::bench(--argc, ++argv);
-    } else if (!strcmp("--concat", argv[0])) {
-        concat::bench(--argc, ++argv);
-    } else if (!strcmp("--lrn", argv[0])) {
-        lrn::bench(--argc, ++argv);
-    } else if (!strcmp("--binary", argv[0])) {
-        binary::bench(--argc, ++argv);
-    } else if (!strcmp("--matmul", argv[0])) {
-        matmul::bench(--argc, ++argv);
-    } else if (!strcmp("--resampling", argv[0])) {
-        resampling::bench(--argc, ++argv);
-    } else if (!strcmp("--reduction", argv[0])) {
-        reduction::bench(--argc, ++argv);
-    } else if (!strcmp("--zeropad", argv[0])) {
-        zeropad::bench(--argc, ++argv);
-    } else {
-        fprintf(stderr, "err: unknown driver\n");
-    }
+    if (perf_counters && !hw_counters_init())
+        fprintf(stderr,
+                "warning: hardware performance counters are not available\n");
+
+    bench_drivers(argc, argv);
 
     printf("tests:%d passed:%d "
            "skipped:%d mistrusted:%d unimplemented:%d "
@@ -136,7 +171,19 @@ int main(int argc, char **argv) {
         printf("total perf: min(ms):%g avg(ms):%g\n",
                 benchdnn_stat.ms[benchdnn_timer_t::min],
                 benchdnn_stat.ms[benchdnn_timer_t::avg]);
+        // The throughput is the number of passes over the model per second
+        for (const auto &m : benchdnn_model_stat)
+            printf("model:%s problems:%d missed:%d min(ms):%g avg(ms):%g "
+                   "throughput(1/s):%g\n",
+                    m.name.c_str(), m.timed, m.missed,
+                    m.ms[benchdnn_timer_t::min], m.ms[benchdnn_timer_t::avg],
+                    m.ms[benchdnn_timer_t::avg] > 0
+                            ? 1e3 / m.ms[benchdnn_timer_t::avg]
+                            : 0.);
     }
+    if (!baseline.empty())
+        printf("regressed:%d (threshold:%g%%)\n", benchdnn_stat.regressed,
+                baseline_threshold);
 
-    return !!benchdnn_stat.failed;
+    return !!(benchdnn_stat.failed || benchdnn_stat.regressed);
 }
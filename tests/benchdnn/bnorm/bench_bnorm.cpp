@@ -34,10 +34,12 @@ void check_correctness(const settings_t &s) {
     for_(const auto &i_tag : s.tag)
     for_(const auto &i_flags : s.flags)
     for_(const auto &i_mb : s.mb)
+    for_(const auto &i_oscale : s.oscale)
     for_(const auto &i_post_ops : s.post_ops)
     for_(const auto &i_scratchpad_mode : s.scratchpad_mode)
     for (auto i_inplace : s.inplace) {
         attr_t attr;
+        attr.insert(i_oscale);
         attr.insert(i_post_ops);
         attr.insert(i_scratchpad_mode);
         handle_legacy_attr(attr, s.attr);
@@ -87,6 +89,7 @@ int bench(int argc, char **argv) {
                 || parse_single_value_option(s.debug_check_ws,
                         def.debug_check_ws, str2bool, argv[0], "debug-check-ws")
                 || parse_attr(s.attr, argv[0])
+                || parse_attr_oscale(s.oscale, argv[0])
                 || parse_attr_post_ops(s.post_ops, argv[0])
                 || parse_attr_scratchpad_mode(
                         s.scratchpad_mode, def.scratchpad_mode, argv[0])
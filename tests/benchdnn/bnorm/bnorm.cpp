@@ -426,7 +426,9 @@ int init_pd(dnnl_engine_t engine, const prb_t *prb, dnnl_primitive_desc_t &bpd,
                 WARN);
     }
 
-    auto dnnl_attr = create_dnnl_attr(prb->attr, attr_args_t());
+    attr_args_t attr_args;
+    attr_args.prepare_output_scales(prb->attr, &prb->attr.oscale.scale, 1);
+    auto dnnl_attr = create_dnnl_attr(prb->attr, attr_args);
 
     dnnl_status_t init_status
             = dnnl_primitive_desc_create(&bpd, &bd, dnnl_attr, engine, hint);
@@ -468,6 +470,15 @@ void check_known_skipped_case(const prb_t *prb, res_t *res) {
     check_known_skipped_case_common({prb->dt}, prb->dir, res);
     if (res->state == SKIPPED) return;
 
+    // Only a common output scale known at creation is supported on CPU
+    const auto &os = prb->attr.oscale;
+    if (!os.is_def()
+            && (engine_tgt_kind == dnnl_gpu || os.policy != policy_t::COMMON
+                    || os.runtime)) {
+        res->state = SKIPPED, res->reason = CASE_NOT_SUPPORTED;
+        return;
+    }
+
     if (is_nvidia_gpu()) {
         const bool bwd_ok
                 = !((prb->dir & FLAG_BWD) && (prb->flags & GLOB_STATS));
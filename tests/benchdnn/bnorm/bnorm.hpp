@@ -70,6 +70,7 @@ struct settings_t {
     std::vector<flags_t> flags {NONE};
     std::vector<int64_t> mb {0};
     std::vector<bool> inplace {false};
+    std::vector<attr_t::scale_t> oscale {attr_t::scale_t()};
     std::vector<attr_t::post_ops_t> post_ops {attr_t::post_ops_t()};
     std::vector<dnnl_scratchpad_mode_t> scratchpad_mode {
             dnnl_scratchpad_mode_library};
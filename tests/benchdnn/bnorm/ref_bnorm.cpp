@@ -50,6 +50,7 @@ void compute_ref_fwd(const prb_t *prb, const dnn_mem_t &src,
             float res = gamma * x_hat + beta;
             if (fuse_relu && res < 0) res = 0;
             if (need_ws) ws.set_elem(off, !!res);
+            if (!attr.oscale.is_def()) res *= attr.oscale.scale;
             maybe_post_ops(attr, res);
             dst.set_elem(off, res);
             if (prb->dir & FLAG_BWD) src_hat.set_elem(off, x_hat);
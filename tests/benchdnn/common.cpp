@@ -18,14 +18,23 @@
 #include <limits.h>
 #include <stdint.h>
 
+#include <algorithm>
+#include <cmath>
 #include <fstream>
 #include <functional>
+#include <map>
 #include <string>
 #include <utility>
 #include <vector>
 
 #include "dnnl.h"
 
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
 #include "common.hpp"
 
 // BENCHDNN_MEMORY_CHECK macro enables guarding mechanism for memory allocation:
@@ -92,6 +101,50 @@ unsigned long long ticks_now() {
 }
 #endif
 
+#ifdef __linux__
+static int hw_fds[hw_n_counters] = {-1, -1, -1, -1};
+
+bool hw_counters_init() {
+    const unsigned long long configs[hw_n_counters]
+            = {PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_REF_CPU_CYCLES,
+                    PERF_COUNT_HW_INSTRUCTIONS, PERF_COUNT_HW_CACHE_MISSES};
+    bool ok = true;
+    for (int i = 0; i < hw_n_counters; ++i) {
+        perf_event_attr attr;
+        memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.config = configs[i];
+        // The counters are inherited by the threads spawned afterwards, and
+        // reading them gives the sum over all the threads
+        attr.inherit = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        hw_fds[i] = (int)syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+        ok = ok && hw_fds[i] >= 0;
+    }
+    return ok;
+}
+
+void hw_counters_read(unsigned long long values[hw_n_counters]) {
+    for (int i = 0; i < hw_n_counters; ++i) {
+        uint64_t v = 0;
+        if (hw_fds[i] < 0 || ::read(hw_fds[i], &v, sizeof(v)) != sizeof(v))
+            v = 0;
+        values[i] = v;
+    }
+}
+#else
+bool hw_counters_init() {
+    return false;
+}
+
+void hw_counters_read(unsigned long long values[hw_n_counters]) {
+    for (int i = 0; i < hw_n_counters; ++i)
+        values[i] = 0;
+}
+#endif
+
 void benchdnn_timer_t::reset() {
     times_ = 0;
     for (int i = 0; i < n_modes; ++i)
@@ -100,6 +153,11 @@ void benchdnn_timer_t::reset() {
     for (int i = 0; i < n_modes; ++i)
         ms_[i] = 0;
     ms_start_ = 0;
+    ms_samples_.clear();
+    wall_ms_ = 0;
+    bytes_ = 0;
+    for (int i = 0; i < hw_n_counters; ++i)
+        hw_[i] = 0;
 
     start();
 }
@@ -134,9 +192,56 @@ void benchdnn_timer_t::stop(int add_times) {
     ticks_[benchdnn_timer_t::max]
             = times_ ? MAX2(ticks_[benchdnn_timer_t::max], d_ticks) : d_ticks;
 
+    ms_samples_.push_back(d_ms);
     times_ += add_times;
 }
 
+double benchdnn_timer_t::ms_percentile(double p) const {
+    if (ms_samples_.empty()) return 0; // nothing to report
+
+    // Nearest-rank method: the smallest sample that is greater than or equal
+    // to `p` percent of all samples.
+    std::vector<double> sorted(ms_samples_);
+    std::sort(sorted.begin(), sorted.end());
+    const size_t n = sorted.size();
+    const double rank = std::ceil(MAX2(0., MIN2(p, 100.)) / 100. * n);
+    const size_t idx = (size_t)MAX2(1., rank) - 1;
+    return sorted[MIN2(idx, n - 1)];
+}
+
+double benchdnn_timer_t::ms_stddev() const {
+    const size_t n = ms_samples_.size();
+    if (n < 2) return 0; // nothing to report
+
+    double mean = 0, var = 0;
+    for (double ms : ms_samples_)
+        mean += ms;
+    mean /= n;
+    for (double ms : ms_samples_)
+        var += (ms - mean) * (ms - mean);
+    return std::sqrt(var / (n - 1));
+}
+
+void benchdnn_timer_t::merge(const benchdnn_timer_t &other) {
+    if (other.times_ == 0) return;
+    if (times_ == 0) {
+        *this = other;
+        return;
+    }
+
+    ms_[avg] += other.ms_[avg];
+    ms_[min] = MIN2(ms_[min], other.ms_[min]);
+    ms_[max] = MAX2(ms_[max], other.ms_[max]);
+    ticks_[avg] += other.ticks_[avg];
+    ticks_[min] = MIN2(ticks_[min], other.ticks_[min]);
+    ticks_[max] = MAX2(ticks_[max], other.ticks_[max]);
+    ms_samples_.insert(ms_samples_.end(), other.ms_samples_.begin(),
+            other.ms_samples_.end());
+    for (int i = 0; i < hw_n_counters; ++i)
+        hw_[i] += other.hw_[i];
+    times_ += other.times_;
+}
+
 benchdnn_timer_t &benchdnn_timer_t::operator=(const benchdnn_timer_t &rhs) {
     if (this == &rhs) return *this;
     times_ = rhs.times_;
@@ -146,6 +251,11 @@ benchdnn_timer_t &benchdnn_timer_t::operator=(const benchdnn_timer_t &rhs) {
     for (int i = 0; i < n_modes; ++i)
         ms_[i] = rhs.ms_[i];
     ms_start_ = rhs.ms_start_;
+    ms_samples_ = rhs.ms_samples_;
+    wall_ms_ = rhs.wall_ms_;
+    bytes_ = rhs.bytes_;
+    for (int i = 0; i < hw_n_counters; ++i)
+        hw_[i] = rhs.hw_[i];
     return *this;
 }
 
@@ -178,6 +288,29 @@ const char *skip_reason2str(skip_reason_t skip_reason) {
     return "SKIP_UNKNOWN";
 }
 
+// The time of a model is the sum of the times of its problems, each weighted
+// by the number of times it occurs in a single pass over the model. A problem
+// that can't be timed makes the model time incomplete, hence it is counted.
+static void add_to_model(const res_t &res, bool timed) {
+    auto &ms = benchdnn_model_stat;
+    auto it = std::find_if(ms.begin(), ms.end(),
+            [](const model_stat_t &m) { return m.name == model_name; });
+    if (it == ms.end()) {
+        ms.push_back(model_stat_t {model_name, 0, 0, {0}});
+        it = ms.end() - 1;
+    }
+
+    if (!timed) {
+        it->missed++;
+        return;
+    }
+
+    using bt = benchdnn_timer_t;
+    it->timed++;
+    for (int mode = 0; mode < (int)bt::n_modes; ++mode)
+        it->ms[mode] += model_weight * res.timer.ms((bt::mode_t)mode);
+}
+
 void parse_result(
         res_t &res, bool &want_perf_report, int status, const char *pstr) {
     auto &bs = benchdnn_stat;
@@ -244,6 +377,98 @@ void parse_result(
         using bt = benchdnn_timer_t;
         for (int mode = 0; mode < (int)bt::n_modes; ++mode)
             bs.ms[mode] += res.timer.ms((bt::mode_t)mode);
+        if (!model_name.empty()) add_to_model(res, want_perf_report);
+    }
+}
+
+struct baseline_entry_t {
+    double ms; /** average time of a run */
+    double stddev_ms; /** standard deviation of a run, 0 if unknown */
+    int times; /** number of runs, 0 if unknown */
+};
+
+// Reads the baseline file once. Every line is `prb,ms[,stddev_ms[,times]]`,
+// which is the output of `--perf-template=%prb%,%0time%,%stdtime%,%times%`.
+// The numbers are parsed from the end of the line, so that the problem may
+// contain commas. Lines that do not match are ignored.
+static const std::map<std::string, baseline_entry_t> &get_baseline() {
+    static const std::map<std::string, baseline_entry_t> entries = []() {
+        std::map<std::string, baseline_entry_t> entries;
+        std::ifstream f(baseline);
+        if (!f.is_open()) {
+            fprintf(stderr, "ERROR: can't open baseline file `%s`\n",
+                    baseline.c_str());
+            exit(2);
+        }
+
+        std::string line;
+        while (std::getline(f, line)) {
+            double values[3] = {0, 0, 0};
+            int n_values = 0;
+            size_t end = line.size();
+            while (n_values < 3 && end > 0) {
+                const size_t comma = line.rfind(',', end - 1);
+                if (comma == std::string::npos) break;
+                const std::string s = line.substr(comma + 1, end - comma - 1);
+                char *s_end = nullptr;
+                const double v = strtod(s.c_str(), &s_end);
+                if (s.empty() || *s_end != '\0') break;
+                values[n_values++] = v;
+                end = comma;
+            }
+            if (n_values == 0 || end == 0) continue;
+
+            // The values were collected from the end of the line
+            baseline_entry_t e {values[n_values - 1], 0, 0};
+            if (n_values > 1) e.stddev_ms = values[n_values - 2];
+            if (n_values > 2) e.times = (int)values[0];
+            entries[line.substr(0, end)] = e;
+        }
+        BENCHDNN_PRINT(1, "baseline: %d problems read from `%s`\n",
+                (int)entries.size(), baseline.c_str());
+        return entries;
+    }();
+    return entries;
+}
+
+// A problem regresses when its average time exceeds the baseline one by more
+// than `baseline_threshold` percent and the difference is significant by the
+// Welch's t-test at about 95% confidence. Without the baseline deviation only
+// the current runs contribute to the variance.
+void check_baseline(const res_t *r, const char *prb_str) {
+    if (baseline.empty()) return;
+
+    const auto &entries = get_baseline();
+    const auto it = entries.find(prb_str);
+    if (it == entries.end()) {
+        BENCHDNN_PRINT(1, "baseline: no entry for `%s`\n", prb_str);
+        return;
+    }
+
+    const baseline_entry_t &base = it->second;
+    const auto &t = r->timer;
+    const double ms = t.ms(benchdnn_timer_t::avg);
+    if (!ms || !base.ms) return;
+
+    const double diff = ms - base.ms;
+    const double rel_diff = 100. * diff / base.ms;
+
+    double var = 0;
+    if (t.times() > 1) var += std::pow(t.ms_stddev(), 2) / t.times();
+    if (base.times > 1) var += std::pow(base.stddev_ms, 2) / base.times;
+    const double t_stat = var > 0 ? diff / std::sqrt(var) : INFINITY;
+    const double t_crit = 1.96;
+
+    auto &bs = benchdnn_stat;
+    if (rel_diff > baseline_threshold && t_stat > t_crit) {
+        bs.regressed++;
+        BENCHDNN_PRINT(0,
+                "%d:REGRESSED (base(ms):%g now(ms):%g diff:%+.1f%% "
+                "t:%.1f) __REPRO: %s\n",
+                bs.tests, base.ms, ms, rel_diff, t_stat, prb_str);
+    } else {
+        BENCHDNN_PRINT(1, "baseline: diff:%+.1f%% t:%.1f for `%s`\n",
+                rel_diff, t_stat, prb_str);
     }
 }
 
@@ -132,6 +132,27 @@ extern const char *driver_name;
 extern double max_ms_per_prb; /** maximum time spends per prb in ms */
 extern int min_times_per_prb; /** minimal amount of runs per prb */
 extern int fix_times_per_prb; /** if non-zero run prb that many times */
+extern bool cold_cache; /** if true flush caches before every run */
+extern int num_streams; /** number of concurrently executing instances */
+extern bool perf_counters; /** if true collect hw counters of the runs */
+extern std::string baseline; /** csv file with reference times of problems */
+extern double baseline_threshold; /** regression threshold in percent */
+extern std::string model_name; /** model the problems are accounted to */
+extern double model_weight; /** occurrences of a problem in the model */
+
+/* hardware performance counters (Linux perf_event only) */
+enum hw_counter_t {
+    hw_cycles = 0,
+    hw_ref_cycles,
+    hw_instructions,
+    hw_llc_misses,
+    hw_n_counters
+};
+
+/** opens the counters; must be called before the threads are spawned */
+bool hw_counters_init();
+/** reads the counters of all the threads of the process */
+void hw_counters_read(unsigned long long values[hw_n_counters]);
 
 extern bool fast_ref_gpu;
 extern bool allow_enum_tags_only;
@@ -164,11 +185,40 @@ struct benchdnn_timer_t {
         return ticks_[mode] / (mode == avg ? times() : 1);
     }
 
+    /** time of a single run at the `p`-th percentile, p in [0, 100] */
+    double ms_percentile(double p) const;
+
+    /** sample standard deviation of the time of a single run */
+    double ms_stddev() const;
+
+    /** wall time of all the runs, which is less than total_ms() when the
+     * runs of several concurrent streams were merged into the timer */
+    double wall_ms() const { return wall_ms_ > 0 ? wall_ms_ : total_ms(); }
+
+    /** adds the runs measured by another timer */
+    void merge(const benchdnn_timer_t &other);
+
+    /** adds hw counters deltas of a run */
+    void add_hw(const unsigned long long before[hw_n_counters],
+            const unsigned long long after[hw_n_counters]) {
+        for (int i = 0; i < hw_n_counters; ++i)
+            hw_[i] += after[i] - before[i];
+    }
+
+    /** hw counter value per run */
+    double hw(hw_counter_t c) const {
+        return times() ? (double)hw_[c] / times() : 0;
+    }
+
     benchdnn_timer_t &operator=(const benchdnn_timer_t &rhs);
 
     int times_;
     unsigned long long ticks_[n_modes], ticks_start_;
     double ms_[n_modes], ms_start_;
+    std::vector<double> ms_samples_; /** per-run time of every stamp */
+    double wall_ms_; /** set in the throughput mode only */
+    unsigned long long hw_[hw_n_counters]; /** hw counters of all the runs */
+    double bytes_; /** size of the memory read and written by a run */
 };
 
 /* global stats */
@@ -180,10 +230,20 @@ struct stat_t {
     int mistrusted;
     int unimplemented;
     int listed;
+    int regressed;
     double ms[benchdnn_timer_t::mode_t::n_modes];
 };
 extern stat_t benchdnn_stat;
 
+/* per model stats, in the order the models are met */
+struct model_stat_t {
+    std::string name;
+    int timed; /** problems of the model that were timed */
+    int missed; /** problems of the model that were not, e.g. unimplemented */
+    double ms[benchdnn_timer_t::mode_t::n_modes]; /** weighted sum */
+};
+extern std::vector<model_stat_t> benchdnn_model_stat;
+
 /* result structure */
 enum res_state_t {
     UNTESTED = 0,
@@ -212,11 +272,16 @@ struct res_t {
     benchdnn_timer_t timer;
     std::string impl_name;
     skip_reason_t reason;
+    double create_ms; /** primitive descriptor and primitive creation time */
+    double cache_hit_ms; /** primitive creation time from the cache */
 };
 
 void parse_result(
         res_t &res, bool &want_perf_report, int status, const char *pstr);
 
+/** compares the time of the problem with the `--baseline` one */
+void check_baseline(const res_t *r, const char *prb_str);
+
 /* misc */
 void init_fp_mode();
 
@@ -310,16 +310,20 @@ static po_table_entry_t kind_table[] = {
         {pk_t::EXP_DST, "exp_dst", dnnl_eltwise_exp_use_dst_for_bwd},
         {pk_t::GELU_ERF, "gelu_erf", dnnl_eltwise_gelu_erf},
         {pk_t::GELU_TANH, "gelu_tanh", dnnl_eltwise_gelu_tanh},
+        {pk_t::HARDSIGMOID, "hardsigmoid", dnnl_eltwise_hardsigmoid},
+        {pk_t::HARDSWISH, "hardswish", dnnl_eltwise_hardswish},
         {pk_t::LINEAR, "linear", dnnl_eltwise_linear},
         {pk_t::LOG, "log", dnnl_eltwise_log},
         {pk_t::LOGISTIC, "logistic", dnnl_eltwise_logistic},
         {pk_t::LOGISTIC_DST, "logistic_dst",
                 dnnl_eltwise_logistic_use_dst_for_bwd},
         {pk_t::LOGSIGMOID, "logsigmoid", dnnl_eltwise_logsigmoid},
+        {pk_t::MISH, "mish", dnnl_eltwise_mish},
         {pk_t::POW, "pow", dnnl_eltwise_pow},
         {pk_t::RELU, "relu", dnnl_eltwise_relu},
         {pk_t::RELU_DST, "relu_dst", dnnl_eltwise_relu_use_dst_for_bwd},
         {pk_t::ROUND, "round", dnnl_eltwise_round},
+        {pk_t::SELU, "selu", dnnl_eltwise_selu},
         {pk_t::SQRT, "sqrt", dnnl_eltwise_sqrt},
         {pk_t::SQRT_DST, "sqrt_dst", dnnl_eltwise_sqrt_use_dst_for_bwd},
         {pk_t::SQUARE, "square", dnnl_eltwise_square},
@@ -455,7 +459,8 @@ int attr_t::post_ops_t::from_str(const std::string &s) {
 bool attr_t::is_def() const {
     return oscale.is_def() && scales.is_def() && zero_points.is_def()
             && post_ops.is_def()
-            && scratchpad_mode == dnnl_scratchpad_mode_library;
+            && scratchpad_mode == dnnl_scratchpad_mode_library
+            && fpmath_mode == dnnl_fpmath_mode_strict;
 }
 
 int attr_t::post_ops_t::find(pk_t kind, int start, int stop) const {
@@ -651,6 +656,11 @@ std::ostream &operator<<(std::ostream &s, dnnl_scratchpad_mode_t sm) {
     return s;
 }
 
+std::ostream &operator<<(std::ostream &s, dnnl_fpmath_mode_t fm) {
+    s << fpmath_mode2str(fm);
+    return s;
+}
+
 std::ostream &operator<<(std::ostream &s, const attr_t &attr) {
     if (!attr.is_def()) {
         if (!attr.oscale.is_def()) s << "--attr-oscale=" << attr.oscale << " ";
@@ -661,6 +671,8 @@ std::ostream &operator<<(std::ostream &s, const attr_t &attr) {
             s << "--attr-post-ops=\"" << attr.post_ops << "\" ";
         if (attr.scratchpad_mode != dnnl_scratchpad_mode_library)
             s << "--attr-scratchpad=" << attr.scratchpad_mode << " ";
+        if (attr.fpmath_mode != dnnl_fpmath_mode_strict)
+            s << "--attr-fpmath=" << attr.fpmath_mode << " ";
     }
     return s;
 }
@@ -705,6 +717,18 @@ dnnl_scratchpad_mode_t str2scratchpad_mode(const char *str) {
     return dnnl_scratchpad_mode_library;
 }
 
+dnnl_fpmath_mode_t str2fpmath_mode(const char *str) {
+#define CASE(fpm) \
+    if (!strcasecmp(#fpm, str)) return dnnl_fpmath_mode_##fpm
+    CASE(strict);
+    CASE(bf16);
+    CASE(f16);
+    CASE(any);
+#undef CASE
+    assert(!"not expected");
+    return dnnl_fpmath_mode_strict;
+}
+
 void attr_args_t::prepare_output_scales(
         const attr_t &attr, const void *vals, int64_t count, int mask) {
     insert(DNNL_ARG_ATTR_OUTPUT_SCALES, vals, count, mask, attr.oscale.runtime);
@@ -854,6 +878,9 @@ dnnl_primitive_attr_t create_dnnl_attr(
     DNN_SAFE_V(dnnl_primitive_attr_set_scratchpad_mode(
             dnnl_attr, attr.scratchpad_mode));
 
+    DNN_SAFE_V(dnnl_primitive_attr_set_fpmath_mode(
+            dnnl_attr, attr.fpmath_mode));
+
     return dnnl_attr;
 }
 
@@ -1136,6 +1163,11 @@ float compute_eltwise_fwd(
         case pk_t::POW: return scale * pow_fwd(src, alpha, beta);
         case pk_t::GELU_ERF: return scale * gelu_erf_fwd(src);
         case pk_t::ROUND: return scale * round_fwd(src);
+        case pk_t::HARDSWISH: return scale * hardswish_fwd(src, alpha, beta);
+        case pk_t::HARDSIGMOID:
+            return scale * hardsigmoid_fwd(src, alpha, beta);
+        case pk_t::MISH: return scale * mish_fwd(src);
+        case pk_t::SELU: return scale * selu_fwd(src, alpha, beta);
         case pk_t::RELU_DST: return scale * relu_fwd(src, alpha);
         case pk_t::TANH_DST: return scale * tanh_fwd(src);
         case pk_t::ELU_DST: return scale * elu_fwd(src, alpha);
@@ -1173,6 +1205,11 @@ float compute_eltwise_bwd(
         case pk_t::CLIP_V2: return clip_v2_bwd(d_dst, src, alpha, beta);
         case pk_t::POW: return pow_bwd(d_dst, src, alpha, beta);
         case pk_t::GELU_ERF: return gelu_erf_bwd(d_dst, src);
+        case pk_t::HARDSWISH: return hardswish_bwd(d_dst, src, alpha, beta);
+        case pk_t::HARDSIGMOID:
+            return hardsigmoid_bwd(d_dst, src, alpha, beta);
+        case pk_t::MISH: return mish_bwd(d_dst, src);
+        case pk_t::SELU: return selu_bwd(d_dst, src, alpha, beta);
 
         case pk_t::RELU_DST: return relu_bwd_use_dst(d_dst, src, alpha);
         case pk_t::TANH_DST: return tanh_bwd_use_dst(d_dst, src);
@@ -207,15 +207,19 @@ struct attr_t {
             EXP_DST,
             GELU_ERF,
             GELU_TANH,
+            HARDSIGMOID,
+            HARDSWISH,
             LINEAR,
             LOG,
             LOGISTIC,
             LOGISTIC_DST,
             LOGSIGMOID,
+            MISH,
             POW,
             RELU,
             RELU_DST,
             ROUND,
+            SELU,
             SQRT,
             SQRT_DST,
             SQUARE,
@@ -306,19 +310,23 @@ struct attr_t {
         std::vector<entry_t> entry;
     };
 
-    attr_t() : scratchpad_mode(dnnl_scratchpad_mode_library) {}
+    attr_t()
+        : scratchpad_mode(dnnl_scratchpad_mode_library)
+        , fpmath_mode(dnnl_fpmath_mode_strict) {}
 
     void insert(const scale_t &s) { this->oscale = s; }
     void insert(const arg_scales_t &as) { this->scales = as; }
     void insert(const zero_points_t &zp) { this->zero_points = zp; }
     void insert(const post_ops_t &po) { this->post_ops = po; }
     void insert(dnnl_scratchpad_mode_t sm) { this->scratchpad_mode = sm; }
+    void insert(dnnl_fpmath_mode_t fpm) { this->fpmath_mode = fpm; }
 
     scale_t oscale;
     arg_scales_t scales;
     zero_points_t zero_points;
     post_ops_t post_ops;
     dnnl_scratchpad_mode_t scratchpad_mode;
+    dnnl_fpmath_mode_t fpmath_mode;
 
     bool is_def() const;
 };
@@ -335,6 +343,7 @@ std::ostream &operator<<(std::ostream &s, const attr_t::arg_scales_t &scales);
 std::ostream &operator<<(std::ostream &s, const attr_t::post_ops_t::kind_t &k);
 std::ostream &operator<<(std::ostream &s, const attr_t::post_ops_t &post_ops);
 std::ostream &operator<<(std::ostream &s, dnnl_scratchpad_mode_t sm);
+std::ostream &operator<<(std::ostream &s, dnnl_fpmath_mode_t fm);
 std::ostream &operator<<(std::ostream &s, const attr_t &attr);
 
 // A container for additional data and info, not available from user's input at
@@ -450,6 +459,7 @@ dnnl_primitive_attr_t create_dnnl_attr(
 
 dnnl_engine_kind_t str2engine_kind(const char *str);
 dnnl_scratchpad_mode_t str2scratchpad_mode(const char *str);
+dnnl_fpmath_mode_t str2fpmath_mode(const char *str);
 
 void maybe_oscale(const attr_t &attr, float &d, float *scales, int64_t oc);
 void maybe_zero_point(const attr_t &attr, float &d, const int32_t *zero_points,
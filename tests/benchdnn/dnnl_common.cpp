@@ -15,8 +15,15 @@
 *******************************************************************************/
 
 #include <assert.h>
+#include <memory>
+#include <thread>
+
 #include "oneapi/dnnl/dnnl.h"
 
+#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_THREADPOOL
+#include "oneapi/dnnl/dnnl_threadpool.h"
+#endif
+
 // For is_nvidia_gpu(...)
 #if DNNL_GPU_RUNTIME == DNNL_RUNTIME_DPCPP
 #include "oneapi/dnnl/dnnl_sycl.hpp"
@@ -26,6 +33,7 @@
 #include "dnnl_memory.hpp"
 
 #include "cpu/platform.hpp"
+#include "tests/test_thread.hpp"
 
 float round_to_nearest_representable(dnnl_data_type_t dt, float value) {
     switch (dt) {
@@ -112,13 +120,149 @@ inline bool should_stop(const benchdnn_timer_t &t) {
     return stop;
 }
 
+// Evicts the data of the previous run from all cache levels by touching a
+// buffer that is twice as big as the caches of all the cores combined. Every
+// thread touches its own part of the buffer so that private caches get
+// flushed as well.
+static void flush_cpu_caches() {
+    static const size_t flush_size = []() {
+        using namespace dnnl::impl::cpu::platform;
+        const size_t per_core = (size_t)get_per_core_cache_size(2)
+                + (size_t)get_per_core_cache_size(3);
+        const size_t min_size = (size_t)64 << 20;
+        return MAX2(2 * per_core * get_num_cores(), min_size);
+    }();
+    static std::vector<unsigned char> buf(flush_size);
+
+    const size_t line_size = 64;
+    dnnl::impl::parallel_nd((int64_t)(flush_size / line_size),
+            [&](int64_t i) { buf[i * line_size]++; });
+}
+
+// Peak f32 ops per cycle of a core: two FMA units doing a multiply and an
+// add on every lane of a vector register, or a multiply and an add unit on
+// the isa without FMA.
+static double get_flops_per_cycle() {
+    switch (dnnl_get_effective_cpu_isa()) {
+        case dnnl_cpu_isa_all: return 0;
+        case dnnl_cpu_isa_sse41: return 2 * 4;
+        case dnnl_cpu_isa_avx: return 2 * 8;
+        case dnnl_cpu_isa_avx2:
+        case dnnl_cpu_isa_avx2_vnni: return 2 * 2 * 8;
+        default: return 2 * 2 * 16;
+    }
+}
+
+// Returns the maximum core frequency in Hz reported by the OS, or 0.
+static double get_max_cpu_freq() {
+    double freq = 0;
+#ifdef __linux__
+    const char *sysfs_freq
+            = "/sys/devices/system/cpu/cpu0/cpufreq/cpuinfo_max_freq";
+    FILE *f = fopen(sysfs_freq, "r");
+    if (f) {
+        double khz = 0;
+        if (fscanf(f, "%lf", &khz) == 1) freq = khz * 1e3;
+        fclose(f);
+    }
+    if (freq > 0) return freq;
+
+    f = fopen("/proc/cpuinfo", "r");
+    if (f) {
+        char line[256];
+        double mhz = 0;
+        while (fgets(line, sizeof(line), f))
+            if (sscanf(line, "cpu MHz : %lf", &mhz) == 1) break;
+        freq = mhz * 1e6;
+        fclose(f);
+    }
+#endif
+    return freq;
+}
+
+double get_peak_flops() {
+    static const double peak = []() {
+        // Every thread is assumed to run on its own core
+        const double peak = dnnl_get_max_threads() * get_max_cpu_freq()
+                * get_flops_per_cycle();
+        BENCHDNN_PRINT(1, "roofline: peak compute %g GFLOPS\n", peak / 1e9);
+        return peak;
+    }();
+    return peak;
+}
+
+// Measures the memory bandwidth with the STREAM triad kernel on buffers that
+// are several times bigger than the caches. The best of several runs is
+// reported, the bytes written are counted once as in STREAM.
+double get_peak_bw() {
+    static const double peak = []() {
+        using namespace dnnl::impl::cpu::platform;
+        const size_t caches = ((size_t)get_per_core_cache_size(2)
+                                      + (size_t)get_per_core_cache_size(3))
+                * get_num_cores();
+        const size_t min_size = (size_t)64 << 20;
+        const size_t n = MAX2(4 * caches, min_size) / sizeof(float);
+        std::vector<float> a(n), b(n, 1.f), c(n, 2.f);
+
+        auto triad = [&]() {
+            dnnl::impl::parallel(0, [&](int ithr, int nthr) {
+                size_t start {0}, end {0};
+                dnnl::impl::balance211(n, nthr, ithr, start, end);
+                for (size_t i = start; i < end; ++i)
+                    a[i] = b[i] + 3.f * c[i];
+            });
+        };
+
+        triad(); // first touch by the threads doing the work
+        double best_ms = 0;
+        for (int i = 0; i < 5; ++i) {
+            benchdnn_timer_t t;
+            t.start();
+            triad();
+            t.stamp();
+            if (best_ms == 0 || t.ms() < best_ms) best_ms = t.ms();
+        }
+        const double peak
+                = best_ms ? 3 * n * sizeof(float) / (best_ms / 1e3) : 0;
+        BENCHDNN_PRINT(1, "roofline: peak bandwidth %g GB/s\n", peak / 1e9);
+        return peak;
+    }();
+    return peak;
+}
+
 inline int measure_perf_individual(benchdnn_timer_t &t, dnnl_stream_t stream,
-        perf_function_t &perf_func, std::vector<dnnl_exec_arg_t> &dnnl_args) {
+        perf_function_t &perf_func, std::vector<dnnl_exec_arg_t> &dnnl_args,
+        bool cold_cache, bool collect_hw) {
+    unsigned long long hw_before[hw_n_counters], hw_after[hw_n_counters];
+    // Flushing is not accounted in the measured time, but it has to be
+    // accounted in the time budget, otherwise small problems would take
+    // forever.
+    double flush_ms = 0;
     t.reset();
     while (true) {
+        if (cold_cache) {
+            benchdnn_timer_t flush_timer;
+            flush_cpu_caches();
+            flush_timer.stamp();
+            flush_ms += flush_timer.ms();
+            t.start();
+        }
+        if (collect_hw) {
+            // reading the counters is not accounted in the measured time
+            hw_counters_read(hw_before);
+            t.start();
+        }
         DNN_SAFE(perf_func(stream, dnnl_args), WARN);
         t.stamp();
+        if (collect_hw) {
+            hw_counters_read(hw_after);
+            t.add_hw(hw_before, hw_after);
+        }
         if (should_stop(t)) break;
+        if (cold_cache && !fix_times_per_prb
+                && t.total_ms() + flush_ms >= max_ms_per_prb
+                && t.times() >= min_times_per_prb)
+            break;
     }
     return OK;
 }
@@ -161,6 +305,69 @@ inline int measure_perf_aggregate(benchdnn_timer_t &t, dnnl_stream_t stream,
     return OK;
 }
 
+// Throughput mode: `num_streams` instances of the problem are executed
+// concurrently, each on its own stream and with its own share of the threads,
+// the way a multi-stream inference server runs them. The instances share the
+// primitive and the memory arguments, hence the outputs (and a scratchpad
+// passed as an argument) are overwritten concurrently; correctness is
+// validated before in a single stream. The runs of all the instances are
+// merged into `t` to report per-instance latency, and the wall time is
+// recorded to report the aggregate throughput. The cache flushing is not
+// supported as the instances would flush each other.
+inline int measure_perf_streams(benchdnn_timer_t &t, perf_function_t &perf_func,
+        std::vector<dnnl_exec_arg_t> &dnnl_args) {
+    const int nthr_per_stream = MAX2(1, dnnl_get_max_threads() / num_streams);
+
+    auto run_instance = [&](benchdnn_timer_t &ti) {
+        dnnl_stream_t stream;
+#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_THREADPOOL
+        std::unique_ptr<dnnl::threadpool_interop::threadpool_iface> tp(
+                dnnl::testing::create_threadpool(nthr_per_stream));
+        DNN_SAFE(dnnl_threadpool_interop_stream_create(
+                         &stream, get_test_engine(), tp.get()),
+                WARN);
+#else
+        DNN_SAFE(dnnl_stream_create(
+                         &stream, get_test_engine(), dnnl_stream_default_flags),
+                WARN);
+#endif
+        const int ret = measure_perf_individual(
+                ti, stream, perf_func, dnnl_args, false, false);
+        DNN_SAFE(dnnl_stream_destroy(stream), WARN);
+        return ret;
+    };
+
+    std::vector<benchdnn_timer_t> timers(num_streams);
+    std::vector<int> rets(num_streams, OK);
+    auto instance = [&](int i) {
+#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP
+        omp_set_num_threads(nthr_per_stream);
+        rets[i] = run_instance(timers[i]);
+#elif DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_TBB
+        tbb::task_arena arena(nthr_per_stream);
+        arena.execute([&]() { rets[i] = run_instance(timers[i]); });
+#else
+        rets[i] = run_instance(timers[i]);
+#endif
+    };
+
+    benchdnn_timer_t wall;
+    std::vector<std::thread> threads;
+    for (int i = 0; i < num_streams; i++)
+        threads.emplace_back(instance, i);
+    for (auto &thr : threads)
+        thr.join();
+    wall.stamp();
+
+    t.reset();
+    for (int i = 0; i < num_streams; i++) {
+        SAFE(rets[i], WARN);
+        t.merge(timers[i]);
+    }
+    t.wall_ms_ = wall.total_ms();
+    return OK;
+}
+
 int measure_perf(
         benchdnn_timer_t &t, perf_function_t &perf_func, args_t &args) {
     dnnl_engine_kind_t engine_kind;
@@ -172,13 +379,25 @@ int measure_perf(
         std::vector<dnnl_exec_arg_t> dnnl_args;
         execute_unmap_args(args, dnnl_args);
 
-        // For CPU: measure individual iterations
-        // For GPU: measure iterations in batches to hide driver overhead
-        if (engine_kind == dnnl_cpu)
-            ret = measure_perf_individual(t, stream, perf_func, dnnl_args);
+        // For CPU: measure individual iterations, in several concurrent
+        // streams in the throughput mode
+        // For GPU: measure iterations in batches to hide driver overhead,
+        // the cold cache and throughput modes are not supported
+        if (engine_kind == dnnl_cpu && num_streams > 1)
+            ret = measure_perf_streams(t, perf_func, dnnl_args);
+        else if (engine_kind == dnnl_cpu)
+            ret = measure_perf_individual(t, stream, perf_func, dnnl_args,
+                    cold_cache, perf_counters);
         else
             ret = measure_perf_aggregate(t, stream, perf_func, dnnl_args);
 
+        // The memory a run has to read and write at least, for the
+        // roofline efficiency
+        t.bytes_ = 0;
+        for (int i = 0; i < args.size(); ++i)
+            if (args.arg(i) != DNNL_ARG_SCRATCHPAD)
+                t.bytes_ += args.dnn_mem(i).size();
+
         if (ret == OK) execute_map_args(args);
     }
     return ret;
@@ -198,6 +417,49 @@ int measure_perf(benchdnn_timer_t &t, dnnl_primitive_t prim, args_t &args) {
     return measure_perf(t, perf_func, args);
 }
 
+// Measures the latency of getting a primitive from the primitive cache. Each
+// of `num_streams` threads creates the primitive from `pd` several times, so
+// that the contention on the cache is visible in the throughput mode.
+int measure_prim_cache_hit(res_t *r, const_dnnl_primitive_desc_t pd) {
+    const int n_creations = 10;
+
+    std::vector<benchdnn_timer_t> timers(num_streams);
+    std::vector<int> rets(num_streams, OK);
+    auto instance = [&](int i) {
+        auto &t = timers[i];
+        t.reset();
+        for (int n = 0; n < n_creations; n++) {
+            dnnl_primitive_t prim;
+            t.start();
+            if (dnnl_primitive_create(&prim, pd) != dnnl_success) {
+                rets[i] = FAIL;
+                return;
+            }
+            t.stamp();
+            dnnl_primitive_destroy(prim);
+        }
+    };
+
+    if (num_streams == 1) {
+        instance(0);
+    } else {
+        std::vector<std::thread> threads;
+        for (int i = 0; i < num_streams; i++)
+            threads.emplace_back(instance, i);
+        for (auto &thr : threads)
+            thr.join();
+    }
+
+    benchdnn_timer_t t;
+    t.reset();
+    for (int i = 0; i < num_streams; i++) {
+        SAFE(rets[i], WARN);
+        t.merge(timers[i]);
+    }
+    r->cache_hit_ms = t.ms(benchdnn_timer_t::avg);
+    return OK;
+}
+
 void maybe_prepare_runtime_scales(dnn_mem_t &scales_m, const attr_t &attr,
         int64_t scale_cnt, const float *scales) {
     if (!attr.oscale.runtime) return;
@@ -236,13 +498,18 @@ bool check_md_consistency_with_tag(
     return dnnl_memory_desc_equal(&md_new_tag, &md);
 }
 
-void check_known_skipped_case_common(
-        const std::vector<dnnl_data_type_t> &v_dt, dir_t dir, res_t *r) {
+void check_known_skipped_case_common(const std::vector<dnnl_data_type_t> &v_dt,
+        dir_t dir, res_t *r, bool has_cpu_f16_impl) {
     const bool has_bf16_support
             = (engine_tgt_kind == dnnl_cpu
                       && dnnl::impl::cpu::platform::has_data_type_support(
                               dnnl_bf16))
             || engine_tgt_kind == dnnl_gpu;
+    const bool has_f16_support
+            = (engine_tgt_kind == dnnl_cpu && has_cpu_f16_impl
+                      && dnnl::impl::cpu::platform::has_data_type_support(
+                              dnnl_f16))
+            || engine_tgt_kind == dnnl_gpu;
 
     for (const auto &i_dt : v_dt) {
         // bf16 is supported on AVX512-CORE+
@@ -250,8 +517,8 @@ void check_known_skipped_case_common(
             r->state = SKIPPED, r->reason = DATA_TYPE_NOT_SUPPORTED;
             break;
         }
-        // f16 is supported on GPU only
-        if (i_dt == dnnl_f16 && engine_tgt_kind != dnnl_gpu) {
+        // f16 is supported on GPU and, for some primitives, on AVX2+ CPUs
+        if (!has_f16_support && i_dt == dnnl_f16) {
             r->state = SKIPPED, r->reason = DATA_TYPE_NOT_SUPPORTED;
             break;
         }
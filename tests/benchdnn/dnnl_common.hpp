@@ -252,6 +252,8 @@ inline const engine_t &get_cpu_engine() {
     return instance;
 }
 
+int measure_prim_cache_hit(res_t *r, const_dnnl_primitive_desc_t pd);
+
 template <typename func_t, typename prb_t>
 int init_prim(dnnl_primitive_t *prim, const func_t &init_pd_func, prb_t *p,
         res_t *r, dir_t dir = FLAG_FWD,
@@ -262,6 +264,11 @@ int init_prim(dnnl_primitive_t *prim, const func_t &init_pd_func, prb_t *p,
 
     auto cleanup_pd = [&]() { dnnl_primitive_desc_destroy(pd); };
     auto cleanup_prim = [&]() { dnnl_primitive_destroy(return_prim); };
+    auto cleanup_all = [&]() {
+        cleanup_prim();
+        cleanup_pd();
+    };
+    benchdnn_timer_t create_timer;
 #ifndef DNNL_DISABLE_PRIMITIVE_CACHE
     // The idea is to create the requested primitive twice using
     // different engines.
@@ -275,23 +282,37 @@ int init_prim(dnnl_primitive_t *prim, const func_t &init_pd_func, prb_t *p,
     // a memory_storage_t (for scales, zero points or buffers), which depends
     // on a particular engine then it should fail at execution time.
 
-    // The first primitive creation using a temporary engine.
+    // The first primitive creation using a temporary engine. Its time is
+    // reported as the creation time, which includes the implementation
+    // selection and the kernels generation (unless the same problem was
+    // created before).
     engine_t engine(engine_tgt_kind);
+    create_timer.reset();
     status = init_pd_func(engine, p, pd, r, dir, hint);
     if (status != OK) return status;
     if (r->state == SKIPPED || r->state == UNIMPLEMENTED) return OK;
     DNN_SAFE_CLEAN(dnnl_primitive_create(&return_prim, pd), WARN, cleanup_pd);
+    create_timer.stamp();
+    r->create_ms = create_timer.total_ms();
     DNN_SAFE_CLEAN(dnnl_primitive_desc_destroy(pd), WARN, cleanup_prim);
     DNN_SAFE(dnnl_primitive_destroy(return_prim), WARN);
 
 #endif
     // The second (if the cache is enabled) primitive creation using
     // the global test engine.
+    create_timer.reset();
     status = init_pd_func(get_test_engine(), p, pd, r, dir, hint);
     if (status != OK) return status;
     if (r->state == SKIPPED || r->state == UNIMPLEMENTED) return OK;
     // This primitive is expected to come from the cache.
     DNN_SAFE_CLEAN(dnnl_primitive_create(&return_prim, pd), WARN, cleanup_pd);
+#ifndef DNNL_DISABLE_PRIMITIVE_CACHE
+    if (bench_mode & PERF)
+        SAFE_CLEAN(measure_prim_cache_hit(r, pd), WARN, cleanup_all);
+#else
+    create_timer.stamp();
+    r->create_ms = create_timer.total_ms();
+#endif
     DNN_SAFE_CLEAN(dnnl_primitive_desc_destroy(pd), WARN, cleanup_prim);
     (*prim) = return_prim;
     return OK;
@@ -306,6 +327,10 @@ typedef std::function<dnnl_status_t(
 int measure_perf(benchdnn_timer_t &t, perf_function_t &perf_func, args_t &args);
 int measure_perf(benchdnn_timer_t &t, dnnl_primitive_t prim, args_t &args);
 
+/* machine peaks for the roofline efficiency, computed on the first call */
+double get_peak_flops(); /** ops per second of all the threads */
+double get_peak_bw(); /** bytes per second of the memory */
+
 void maybe_prepare_runtime_scales(dnn_mem_t &scales_m, const attr_t &attr,
         int64_t scale_cnt, const float *scales);
 
@@ -317,8 +342,9 @@ void maybe_prepare_runtime_zero_points(
 bool check_md_consistency_with_tag(
         const dnnl_memory_desc_t &md, const std::string &tag);
 
-void check_known_skipped_case_common(
-        const std::vector<dnnl_data_type_t> &v_dt, dir_t dir, res_t *r);
+// `has_cpu_f16_impl` marks drivers whose primitives implement f16 on CPU.
+void check_known_skipped_case_common(const std::vector<dnnl_data_type_t> &v_dt,
+        dir_t dir, res_t *r, bool has_cpu_f16_impl = false);
 
 bool is_nvidia_gpu(const engine_t &engine = get_test_engine());
 bool is_nvidia_eltwise_ok(
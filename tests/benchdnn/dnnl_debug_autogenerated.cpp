@@ -311,6 +311,13 @@ dnnl_format_tag_t str2fmt_tag(const char *str) {
     CASE(abdEc32e);
     CASE(abdEC32e2c);
     CASE(abdEC32e4c);
+    CASE(BA16a64b);
+    CASE(BA8a64b2a);
+    CASE(BA4a64b4a);
+    CASE(aCB16b64c);
+    CASE(aCB8b64c2b);
+    CASE(aCB4b64c4b);
+    CASE(ABcde16b16a2b);
     CASE(x);
     CASE(nc);
     CASE(cn);
@@ -473,6 +480,7 @@ dnnl_format_tag_t str2fmt_tag(const char *str) {
     CASE(OIdhw4i32o4i);
     CASE(OIdhw4i64o4i);
     CASE(OIdhw16i16o4i);
+    CASE(OIdhw16i16o2i);
     CASE(OIdhw2i8o4i);
     CASE(OIdhw8o8i);
     CASE(OIdhw8o4i);
@@ -609,3 +617,7 @@ const char *engine_kind2str(dnnl_engine_kind_t kind) {
 const char *scratchpad_mode2str(dnnl_scratchpad_mode_t mode) {
     return dnnl_scratchpad_mode2str(mode);
 }
+
+const char *fpmath_mode2str(dnnl_fpmath_mode_t mode) {
+    return dnnl_fpmath_mode2str(mode);
+}
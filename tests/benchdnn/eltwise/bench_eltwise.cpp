@@ -37,6 +37,7 @@ void check_correctness(const settings_t &s) {
     for_(const auto &i_mb : s.mb)
     for_(const auto &i_post_ops : s.post_ops)
     for_(const auto &i_scratchpad_mode : s.scratchpad_mode)
+    for_(const auto &i_fpmath_mode : s.fpmath_mode)
     for (auto i_inplace : s.inplace) {
         bool ok = i_alg > alg_t::ELTWISE_START && i_alg < alg_t::ELTWISE_END;
         if (!ok) SAFE_V(FAIL);
@@ -52,6 +53,7 @@ void check_correctness(const settings_t &s) {
             case alg_t::LOGISTIC:
             case alg_t::LOGISTIC_DST:
             case alg_t::LOGSIGMOID:
+            case alg_t::MISH:
             case alg_t::SQRT:
             case alg_t::SQRT_DST:
             case alg_t::SQUARE:
@@ -84,6 +86,7 @@ void check_correctness(const settings_t &s) {
         attr_t attr;
         attr.insert(i_post_ops);
         attr.insert(i_scratchpad_mode);
+        attr.insert(i_fpmath_mode);
 
         const prb_t prb(s.dims, i_dir, i_dt, i_tag, i_alg, i_alpha, i_beta,
                 i_inplace, attr, i_mb);
@@ -129,6 +132,8 @@ int bench(int argc, char **argv) {
                 || parse_attr_post_ops(s.post_ops, argv[0])
                 || parse_attr_scratchpad_mode(
                         s.scratchpad_mode, def.scratchpad_mode, argv[0])
+                || parse_attr_fpmath_mode(
+                        s.fpmath_mode, def.fpmath_mode, argv[0])
                 || parse_perf_template(s.perf_template, s.perf_template_def,
                         s.perf_template_csv, argv[0])
                 || parse_reset(s, argv[0]);
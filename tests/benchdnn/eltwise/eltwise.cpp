@@ -121,6 +121,7 @@ static bool check_abs_err(const prb_t *prb, const float &s, const float &trh) {
     switch (prb->alg) {
         case alg_t::ELU:
         case alg_t::ELU_DST:
+        case alg_t::SELU:
             // catch catastrophic cancellation when (exp(s) - 1), s < 0 and
             // s is close to zero.
             return (prb->dir & FLAG_FWD) && std::signbit(s)
@@ -180,6 +181,14 @@ static bool check_abs_err(const prb_t *prb, const float &s, const float &trh) {
             // catastrohic cancellation.
             return (prb->dir & FLAG_BWD) && !std::signbit(s)
                     && (1.f / (1.f + expf(s))) <= comp_err;
+        case alg_t::MISH: {
+            // catch cancellation in the derivative around the minimum of
+            // mish at s ~ -1.19, where the derivative changes its sign.
+            const float tanh_sp = tanhf(log1pf(expf(s)));
+            const float ds = tanh_sp
+                    + s * (1.f - tanh_sp * tanh_sp) / (1.f + expf(-s));
+            return (prb->dir & FLAG_BWD) && fabsf(ds) <= comp_err;
+        }
         case alg_t::SWISH: {
             // catch cancellation happening when W(s) ~~ -1 in (1 + W(s))
             // formula part on backward.
@@ -199,6 +208,7 @@ float get_eltwise_threshold(dnnl_data_type_t dt, alg_t alg, bool is_fwd) {
     const bool alg_has_higher_tolerance = alg == alg_t::GELU_TANH
             || alg == alg_t::ELU || alg == alg_t::SWISH || alg == alg_t::TANH
             || alg == alg_t::SRELU || alg == alg_t::LOGSIGMOID
+            || alg == alg_t::MISH || alg == alg_t::SELU
             || alg == alg_t::LOG
             || ((alg == alg_t::ELU_DST || alg == alg_t::TANH_DST) && is_fwd);
     if (dt == dnnl_f32 && alg_has_higher_tolerance) trh = 4e-5;
@@ -212,8 +222,10 @@ static int compare(const prb_t *prb, const dnn_mem_t &mem_arg_fp,
 
     res->total = nelems;
 
-    const float trh
-            = get_eltwise_threshold(prb->dt, prb->alg, prb->dir & FLAG_FWD);
+    float trh = get_eltwise_threshold(prb->dt, prb->alg, prb->dir & FLAG_FWD);
+    // Shorter approximations are allowed in fast math mode.
+    if (prb->attr.fpmath_mode != dnnl_fpmath_mode_strict)
+        trh = MAX2(trh, 1e-3f);
 
     for (int64_t i = 0; i < nelems; i++) {
         const float dt = mem_dt.get_elem(i);
@@ -321,7 +333,7 @@ int fill_data(const prb_t *prb, data_kind_t kind, dnn_mem_t &mem_dt,
 }
 
 void check_known_skipped_case(const prb_t *prb, res_t *res) {
-    check_known_skipped_case_common({prb->dt}, prb->dir, res);
+    check_known_skipped_case_common({prb->dt}, prb->dir, res, true);
     if (res->state == SKIPPED) return;
 
     bool is_invalid = false;
@@ -132,6 +132,14 @@ bool parse_attr_scratchpad_mode(
             str2scratchpad_mode, str, option_name);
 }
 
+bool parse_attr_fpmath_mode(std::vector<dnnl_fpmath_mode_t> &fpmath_mode,
+        const std::vector<dnnl_fpmath_mode_t> &def_fpmath_mode,
+        const char *str,
+        const std::string &option_name /* = "attr-fpmath"*/) {
+    return parse_vector_option(fpmath_mode, def_fpmath_mode, str2fpmath_mode,
+            str, option_name);
+}
+
 bool parse_axis(std::vector<int> &axis, const std::vector<int> &def_axis,
         const char *str, const std::string &option_name /* = "axis"*/) {
     return parse_vector_option(axis, def_axis, atoi, str, option_name);
@@ -273,6 +281,57 @@ static bool parse_fix_times_per_prb(
     return false;
 }
 
+static bool parse_cold_cache(
+        const char *str, const std::string &option_name = "cold-cache") {
+    return parse_single_value_option(
+            cold_cache, false, str2bool, str, option_name);
+}
+
+static bool parse_num_streams(
+        const char *str, const std::string &option_name = "num-streams") {
+    if (parse_single_value_option(num_streams, 1, atoi, str, option_name))
+        return num_streams = MAX2(1, num_streams), true;
+    return false;
+}
+
+static bool parse_perf_counters(
+        const char *str, const std::string &option_name = "perf-counters") {
+    return parse_single_value_option(
+            perf_counters, false, str2bool, str, option_name);
+}
+
+static bool parse_baseline(
+        const char *str, const std::string &option_name = "baseline") {
+    const std::string pattern = get_pattern(option_name);
+    if (pattern.find(str, 0, pattern.size()) == eol) return false;
+    baseline = std::string(str + pattern.size());
+    return true;
+}
+
+static bool parse_baseline_threshold(const char *str,
+        const std::string &option_name = "baseline-threshold") {
+    if (parse_single_value_option(
+                baseline_threshold, 5., atof, str, option_name))
+        return baseline_threshold = MAX2(0., baseline_threshold), true;
+    return false;
+}
+
+static bool parse_model(
+        const char *str, const std::string &option_name = "model") {
+    const std::string pattern = get_pattern(option_name);
+    if (pattern.find(str, 0, pattern.size()) == eol) return false;
+    model_name = std::string(str + pattern.size());
+    model_weight = 1.;
+    return true;
+}
+
+static bool parse_model_weight(
+        const char *str, const std::string &option_name = "model-weight") {
+    if (parse_single_value_option(model_weight, 1., atof, str, option_name))
+        return model_weight = MAX2(0., model_weight), true;
+    return false;
+}
+
 static bool parse_verbose(
         const char *str, const std::string &option_name = "verbose") {
     const std::string pattern("-v"); // check short option first
@@ -328,7 +387,11 @@ bool parse_bench_settings(const char *str) {
             || parse_fix_times_per_prb(str) || parse_verbose(str)
             || parse_engine_kind(str) || parse_fast_ref_gpu(str)
             || parse_canonical(str) || parse_mem_check(str)
-            || parse_skip_impl(str) || parse_allow_enum_tags_only(str);
+            || parse_skip_impl(str) || parse_allow_enum_tags_only(str)
+            || parse_cold_cache(str) || parse_num_streams(str)
+            || parse_perf_counters(str) || parse_baseline(str)
+            || parse_baseline_threshold(str) || parse_model(str)
+            || parse_model_weight(str);
 }
 
 void catch_unknown_options(const char *str) {
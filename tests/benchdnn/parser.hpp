@@ -169,6 +169,10 @@ bool parse_attr_scratchpad_mode(
         const std::vector<dnnl_scratchpad_mode_t> &def_scratchpad_mode,
         const char *str, const std::string &option_name = "attr-scratchpad");
 
+bool parse_attr_fpmath_mode(std::vector<dnnl_fpmath_mode_t> &fpmath_mode,
+        const std::vector<dnnl_fpmath_mode_t> &def_fpmath_mode,
+        const char *str, const std::string &option_name = "attr-fpmath");
+
 bool parse_axis(std::vector<int> &axis, const std::vector<int> &def_axis,
         const char *str, const std::string &option_name = "axis");
 
@@ -17,6 +17,7 @@
 #ifndef PERF_REPORT_HPP
 #define PERF_REPORT_HPP
 
+#include <ctype.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -38,12 +39,19 @@ struct base_perf_report_t {
         const auto &t = r->timer;
         benchdnn_timer_t::mode_t mode = benchdnn_timer_t::min;
         (void)mode;
+        double percentile = -1; // negative means `mode` is used
         double unit = 1e0;
         char c = *option;
 
         if (c == '-' || c == '0' || c == '+') {
             mode = modifier2mode(c);
             c = *(++option);
+        } else if (c == 'p' && isdigit(option[1])) {
+            char *end = nullptr;
+            percentile = strtod(option + 1, &end);
+            percentile = MIN2(percentile, 100.);
+            option = end;
+            c = *option;
         }
 
         if (c == 'K' || c == 'M' || c == 'G') {
@@ -58,16 +66,69 @@ struct base_perf_report_t {
         return; \
     }
 
+        auto get_ms = [&]() -> double {
+            return percentile < 0 ? t.ms(mode) : t.ms_percentile(percentile);
+        };
+
+        // Clocks are not recorded per run, so percentiles are converted
+        // using the average frequency.
+        auto get_ticks = [&]() -> double {
+            if (percentile < 0) return t.ticks(mode);
+            const double avg_ms = t.ms(benchdnn_timer_t::avg);
+            if (!avg_ms) return 0;
+            return t.ticks(benchdnn_timer_t::avg) * get_ms() / avg_ms;
+        };
+
         auto get_flops = [&]() -> double {
-            if (!t.sec(mode)) return 0;
-            return ops() / t.sec(mode) / unit;
+            if (!get_ms()) return 0;
+            return ops() / (get_ms() / 1e3) / unit;
         };
 
         auto get_bw = [&]() -> double { return get_flops(); };
 
+        // Aggregate number of runs per second of all the streams
+        auto get_thrpt = [&]() -> double {
+            if (!t.wall_ms()) return 0;
+            return t.times() / (t.wall_ms() / 1e3) / unit;
+        };
+
         auto get_freq = [&]() -> double {
-            if (!t.sec(mode)) return 0;
-            return t.ticks(mode) / t.sec(mode) / unit;
+            if (!get_ms()) return 0;
+            return get_ticks() / (get_ms() / 1e3) / unit;
+        };
+
+        // Hardware counters averaged per run, see --perf-counters
+        auto get_ratio = [&](hw_counter_t num, hw_counter_t den) -> double {
+            if (!t.hw(den)) return 0;
+            return t.hw(num) / t.hw(den);
+        };
+
+        // Every LLC miss is accounted as a cache line read from memory
+        auto get_llc_bw = [&]() -> double {
+            const double avg_ms = t.ms(benchdnn_timer_t::avg);
+            if (!avg_ms) return 0;
+            return t.hw(hw_llc_misses) * 64 / (avg_ms / 1e3) / unit;
+        };
+
+        // Efficiency in percent against the machine peaks. The roofline
+        // limits the attainable ops by the memory bandwidth times the
+        // arithmetic intensity (ops per byte of the memory of a run).
+        auto get_eff = [&](double value, double peak) -> double {
+            return peak > 0 ? 100. * value / peak : 0;
+        };
+        auto get_roof = [&]() -> double {
+            const double peak_flops = get_peak_flops();
+            if (!t.bytes_) return peak_flops;
+            const double roof = ops() / t.bytes_ * get_peak_bw();
+            return peak_flops > 0 ? MIN2(peak_flops, roof) : roof;
+        };
+        auto get_ops_per_sec = [&]() -> double {
+            const double avg_ms = t.ms(benchdnn_timer_t::avg);
+            return avg_ms ? ops() / (avg_ms / 1e3) : 0;
+        };
+        auto get_bytes_per_sec = [&]() -> double {
+            const double avg_ms = t.ms(benchdnn_timer_t::avg);
+            return avg_ms ? t.bytes_ / (avg_ms / 1e3) : 0;
         };
 
         HANDLE("alg", dump_alg(s));
@@ -96,12 +157,27 @@ struct base_perf_report_t {
 
         HANDLE("bw", s << get_bw());
         HANDLE("flops", s << get_flops());
-        HANDLE("clocks", s << t.ticks(mode) / unit);
+        HANDLE("clocks", s << get_ticks() / unit);
         HANDLE("prb", s << prb_str);
         HANDLE("freq", s << get_freq());
         HANDLE("ops", s << ops() / unit);
-        HANDLE("time", s << t.ms(mode) / unit);
+        HANDLE("time", s << get_ms() / unit);
+        HANDLE("stdtime", s << t.ms_stddev() / unit);
+        HANDLE("times", s << t.times());
         HANDLE("impl", s << r->impl_name);
+        HANDLE("ctime", s << r->create_ms / unit);
+        HANDLE("chtime", s << r->cache_hit_ms / unit);
+        HANDLE("streams", s << num_streams);
+        HANDLE("thrpt", s << get_thrpt());
+        HANDLE("aflops", s << ops() * get_thrpt());
+        HANDLE("insts", s << t.hw(hw_instructions) / unit);
+        HANDLE("ipc", s << get_ratio(hw_instructions, hw_cycles));
+        HANDLE("llc_misses", s << t.hw(hw_llc_misses) / unit);
+        HANDLE("llc_bw", s << get_llc_bw());
+        HANDLE("fratio", s << get_ratio(hw_cycles, hw_ref_cycles));
+        HANDLE("flops_eff", s << get_eff(get_ops_per_sec(), get_peak_flops()));
+        HANDLE("bw_eff", s << get_eff(get_bytes_per_sec(), get_peak_bw()));
+        HANDLE("roof_eff", s << get_eff(get_ops_per_sec(), get_roof()));
 
 #undef HANDLE
 
@@ -125,6 +201,8 @@ struct base_perf_report_t {
 
         std::string str = ss.str();
         BENCHDNN_PRINT(0, "%s\n", str.c_str());
+
+        check_baseline(r, prb_str);
     };
 
     /* truly common types */
@@ -278,7 +278,7 @@ static int init_pd(dnnl_engine_t engine, const prb_t *prb,
 void check_known_skipped_case(const prb_t *prb, res_t *res) {
     const auto sdt = prb->conf_in->dt;
     const auto ddt = prb->conf_out->dt;
-    check_known_skipped_case_common({sdt, ddt}, FWD_D, res);
+    check_known_skipped_case_common({sdt, ddt}, FWD_D, res, true);
     if (res->state == SKIPPED) return;
 
     // zero points for dst do not support sum by design
@@ -310,6 +310,16 @@ void check_known_skipped_case(const prb_t *prb, res_t *res) {
         return;
     }
 
+    // f16 reorder on cpu supports only f16/f32 src_dt/dst_dt
+    if (engine_tgt_kind == dnnl_cpu
+            && (!IMPLICATION(sdt == dnnl_f16,
+                        ddt == dnnl_f32 || ddt == dnnl_f16)
+                    || !IMPLICATION(ddt == dnnl_f16,
+                            sdt == dnnl_f32 || sdt == dnnl_f16))) {
+        res->state = SKIPPED, res->reason = CASE_NOT_SUPPORTED;
+        return;
+    }
+
     if (engine_tgt_kind == dnnl_gpu) {
         // GPU does not support run-time dims and zero-points
         if (prb->runtime_dim_mask != 0 || !prb->attr.zero_points.is_def()
@@ -70,7 +70,11 @@ inline int compare_dat(const prb_t *prb, data_kind_t kind, dnn_mem_t &mem_dt,
 
         const float diff = fabsf(fp - dt);
         const float rel_diff = diff / (fabsf(fp) > FLT_MIN ? fabsf(fp) : 1);
-        const bool ok = (fabsf(fp) > eps ? rel_diff : diff) <= trh;
+        // For integer data types the interpolated value may be rounded to
+        // either of the neighbors when it is close to a half.
+        const bool ok = (fabsf(fp) > eps ? rel_diff : diff) <= trh
+                || (prb->alg == linear && is_integral_dt(prb->dt)
+                        && diff <= 1.f);
 
         res->errors += !ok;
 
@@ -116,7 +120,7 @@ int fill_dat(const prb_t *prb, data_kind_t kind, dnn_mem_t &mem_dt,
 
     dnnl::impl::parallel_nd(nelems, [&](int64_t i) {
         const float gen = ((97 * i) - 19 * kind + 101) % (range + 1);
-        const float value = (dt == dnnl_f32)
+        const float value = (dt == dnnl_f32 || is_integral_dt(dt))
                 ? (f_min + gen) * (1.0f + 4.0f / range)
                 : (f_min + gen) / range;
         mem_fp.set_elem(i, round_to_nearest_representable(dt, value));
@@ -38,24 +38,28 @@ void lbr_gru_fwd_postgemm_template(T1 func1, T2 func2, const prb_t &prb,
     for (int64_t i = 0; i < prb.mb; i++)
         for (int64_t j = 0; j < prb.n_gates() - 1; j++)
             for (int64_t k = 0; k < prb.dhc; k++) {
+                const float acc = gates(i, j, k) + cell_scratchpad(i, j, k);
                 gates(i, j, k) = func1(prb.linear_scales[j],
-                        gates(i, j, k) + cell_scratchpad(i, j, k) + bias(j, k));
+                        maybe_deq(prb, acc, j * prb.dhc + k) + bias(j, k));
             }
 
     for (int64_t i = 0; i < prb.mb; i++)
         for (int64_t k = 0; k < prb.dhc; k++) {
+            const int64_t oc = GRU_O * prb.dhc + k;
             gates(i, GRU_O, k) = func2(prb.linear_scales[GRU_O],
-                    gates(i, GRU_O, k)
+                    maybe_deq(prb, gates(i, GRU_O, k), oc)
                             + gates(i, GRU_R, k)
-                                    * (cell_scratchpad(i, GRU_O, k)
+                                    * (maybe_deq(prb,
+                                               cell_scratchpad(i, GRU_O, k), oc)
                                             + bias(LBR_GRU_U_PRIME, k))
                             + bias(GRU_O, k));
         }
 
     for (int64_t i = 0; i < prb.mb; i++)
         for (int64_t k = 0; k < prb.dhc; k++) {
-            dst_layer(i, k) = gates(i, GRU_U, k) * src_iter(i, k)
-                    + (1 - gates(i, GRU_U, k)) * gates(i, GRU_O, k);
+            dst_layer(i, k) = maybe_q(prb,
+                    gates(i, GRU_U, k) * maybe_deq(prb, src_iter(i, k))
+                            + (1 - gates(i, GRU_U, k)) * gates(i, GRU_O, k));
         }
 }
 
@@ -90,27 +90,33 @@ void prepare_bias(const prb_t &prb, float *bias_with_compensation_,
     AOC<const float> weights_iter(weights_iter_, prb.n_layer, prb.n_dir(),
             prb.sic, prb.n_gates(), prb.dhc);
 
-    AOC<const float> bias(
-            bias_, prb.n_layer, prb.n_dir(), prb.n_gates(), prb.dhc);
+    // LBR GRU has an extra bias for the iter part of the last gate, so the
+    // compensation of the last gate is split between the two last biases
+    const bool is_lbr = prb.alg == LBR_GRU;
+    const int64_t n_bias = prb.n_gates() + is_lbr;
+    AOC<const float> bias(bias_, prb.n_layer, prb.n_dir(), n_bias, prb.dhc);
     AOC<float> bias_with_compensation(bias_with_compensation_, prb.n_layer,
-            prb.n_dir(), prb.n_gates(), prb.dhc);
+            prb.n_dir(), n_bias, prb.dhc);
 
     for (int layer = 0; layer < prb.n_layer; ++layer)
         for (int dir = 0; dir < prb.n_dir(); ++dir)
-            for (int gate = 0; gate < prb.n_gates(); ++gate)
+            for (int b = 0; b < n_bias; ++b)
                 for (int dhc = 0; dhc < prb.dhc; ++dhc) {
+                    const int gate = MIN2(b, prb.n_gates() - 1);
+                    const bool with_iter = !is_lbr || b != GRU_O;
+                    const bool with_layer = !is_lbr || b != LBR_GRU_U_PRIME;
                     float weights_compensation = 0;
-                    for (int sic = 0; sic < prb.sic; ++sic)
+                    for (int sic = 0; with_iter && sic < prb.sic; ++sic)
                         weights_compensation
                                 += weights_iter(layer, dir, sic, gate, dhc);
-                    for (int slc = 0; slc < prb.slc; ++slc)
+                    for (int slc = 0; with_layer && slc < prb.slc; ++slc)
                         weights_compensation
                                 += weights_layer(layer, dir, slc, gate, dhc);
 
                     float scale = prb.data_scale
                             * prb.get_wei_scale(gate * prb.dhc + dhc);
-                    bias_with_compensation(layer, dir, gate, dhc)
-                            = bias(layer, dir, gate, dhc)
+                    bias_with_compensation(layer, dir, b, dhc)
+                            = bias(layer, dir, b, dhc)
                             - weights_compensation * prb.data_shift / scale;
                 }
 }
@@ -736,17 +736,10 @@ void check_known_skipped_case(const prb_t &prb, res_t *res) {
     }
 #endif
 
-    // int8 weights reorder does not support non trivial strides;
-    // only LSTM and GRU cell kinds support int8 so far;
-    if (prb.is_int8()) {
-        if (!prb.trivial_strides) {
-            res->state = SKIPPED, res->reason = CASE_NOT_SUPPORTED;
-            return;
-        }
-        if (prb.alg != VANILLA_LSTM && prb.alg != VANILLA_GRU) {
-            res->state = SKIPPED, res->reason = CASE_NOT_SUPPORTED;
-            return;
-        }
+    // int8 weights reorder does not support non trivial strides
+    if (prb.is_int8() && !prb.trivial_strides) {
+        res->state = SKIPPED, res->reason = CASE_NOT_SUPPORTED;
+        return;
     }
 
     // LSTM w/ projection is not supported for bf16
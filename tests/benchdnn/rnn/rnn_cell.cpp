@@ -50,9 +50,11 @@ void rnn_fwd_postgemm(const prb_t &prb, const float *bias_, float *gates_,
     for (int64_t i = 0; i < prb.mb; i++)
         for (int64_t j = 0; j < prb.n_gates(); j++)
             for (int64_t k = 0; k < prb.dhc; k++) {
-                const auto tmp = activation(prb, gates(i, j, k) + bias(j, k));
+                const auto tmp = activation(prb,
+                        maybe_deq(prb, gates(i, j, k), j * prb.dhc + k)
+                                + bias(j, k));
                 gates(i, j, k) = tmp;
-                dst_layer(i, j, k) = tmp;
+                dst_layer(i, j, k) = maybe_q(prb, tmp);
             }
 }
 
@@ -34,10 +34,14 @@ void check_correctness(const settings_t &s) {
     for_(const auto &i_alg : s.alg)
     for_(const auto &i_axis : s.axis)
     for_(const auto &i_mb : s.mb)
+    for_(const auto &i_oscale : s.oscale)
     for_(const auto &i_scratchpad_mode : s.scratchpad_mode)
+    for_(const auto &i_fpmath_mode : s.fpmath_mode)
     for (auto i_inplace : s.inplace) {
         attr_t attr;
+        attr.insert(i_oscale);
         attr.insert(i_scratchpad_mode);
+        attr.insert(i_fpmath_mode);
 
         const prb_t prb(s.dims, i_dir, i_dt, i_tag, i_alg, i_axis, i_inplace,
                 attr, i_mb);
@@ -77,8 +81,11 @@ int bench(int argc, char **argv) {
                 || parse_axis(s.axis, def.axis, argv[0])
                 || parse_inplace(s.inplace, def.inplace, argv[0])
                 || parse_mb(s.mb, def.mb, argv[0])
+                || parse_attr_oscale(s.oscale, argv[0])
                 || parse_attr_scratchpad_mode(
                         s.scratchpad_mode, def.scratchpad_mode, argv[0])
+                || parse_attr_fpmath_mode(
+                        s.fpmath_mode, def.fpmath_mode, argv[0])
                 || parse_perf_template(s.perf_template, s.perf_template_def,
                         s.perf_template_csv, argv[0])
                 || parse_reset(s, argv[0]);
@@ -27,6 +27,7 @@ void compute_ref_fwd(const prb_t *prb, const dnn_mem_t &src, dnn_mem_t &dst) {
     const float *src_ptr = (const float *)src;
     float *dst_ptr = (float *)dst;
     const auto alg = prb->alg;
+    const float oscale = prb->attr.oscale.scale;
 
     dnnl::impl::parallel_nd(
             outer_size, inner_size, [&](int64_t ou, int64_t in) {
@@ -63,6 +64,7 @@ void compute_ref_fwd(const prb_t *prb, const dnn_mem_t &src, dnn_mem_t &dst) {
                     } else if (alg == LOGSOFTMAX) {
                         dst_ptr[idx] -= space_denom;
                     }
+                    dst_ptr[idx] *= oscale;
                 }
             });
 }
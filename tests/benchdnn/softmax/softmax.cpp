@@ -70,7 +70,9 @@ static int init_pd(dnnl_engine_t engine, const prb_t *prb,
             SAFE_V(FAIL);
     }
 
-    auto dnnl_attr = create_dnnl_attr(prb->attr, attr_args_t());
+    attr_args_t attr_args;
+    attr_args.prepare_output_scales(prb->attr, &prb->attr.oscale.scale, 1);
+    auto dnnl_attr = create_dnnl_attr(prb->attr, attr_args);
 
     dnnl_status_t init_status
             = dnnl_primitive_desc_create(&spd, &sd, dnnl_attr, engine, nullptr);
@@ -101,7 +103,9 @@ static int compare(const prb_t *prb, const dnn_mem_t &fp_mem,
     const int f32_mant_digits = 24;
     const float trh_coeff_dt = (1 << (f32_mant_digits - digits_dt(prb->dt)));
     const float trh_coeff_log = prb->alg == LOGSOFTMAX ? 4 : 1;
-    const float trh = trh_coeff_dt * trh_coeff_log * 1e-6;
+    const float trh_coeff_fpmath
+            = prb->attr.fpmath_mode != dnnl_fpmath_mode_strict ? 1e3 : 1;
+    const float trh = trh_coeff_dt * trh_coeff_log * trh_coeff_fpmath * 1e-6;
 
     const auto nelems = dt_mem.nelems();
     if (nelems == 0) return res->state = PASSED, OK;
@@ -51,8 +51,10 @@ struct settings_t {
     std::vector<int> axis {1};
     std::vector<int64_t> mb {0};
     std::vector<bool> inplace {false};
+    std::vector<attr_t::scale_t> oscale {attr_t::scale_t()};
     std::vector<dnnl_scratchpad_mode_t> scratchpad_mode {
             dnnl_scratchpad_mode_library};
+    std::vector<dnnl_fpmath_mode_t> fpmath_mode {dnnl_fpmath_mode_strict};
 
     const char *perf_template_csv
             = "perf,%engine%,%impl%,%dir%,%dt%,%tag%,%alg%,%axis%,%DESC%,%-"
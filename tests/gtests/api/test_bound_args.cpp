@@ -0,0 +1,124 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+#include <algorithm>
+#include <vector>
+
+namespace dnnl {
+
+class bound_args_test_t : public ::testing::TestWithParam<dnnl_engine_kind_t> {
+protected:
+    void fill(const memory &mem, float base) {
+        auto ptr = map_memory<float>(mem);
+        for (memory::dim i = 0; i < n; ++i)
+            ptr[i] = (i % 2 ? base : -base) * (i + 1);
+    }
+
+    void check_relu(const memory &src, const memory &dst) {
+        auto src_ptr = map_memory<float>(src);
+        auto dst_ptr = map_memory<float>(dst);
+        for (memory::dim i = 0; i < n; ++i)
+            ASSERT_EQ(dst_ptr[i], std::max(src_ptr[i], 0.f))
+                    << "at position " << i;
+    }
+
+    const memory::dim n = 17;
+};
+
+HANDLE_EXCEPTIONS_FOR_TEST_P(bound_args_test_t, ExecuteAndSwapHandles) {
+    auto engine_kind = static_cast<engine::kind>(GetParam());
+    SKIP_IF(engine::get_count(engine_kind) == 0,
+            "Engine kind is not supported");
+
+    engine eng(engine_kind, 0);
+    stream strm(eng);
+
+    const memory::desc md({n}, memory::data_type::f32, memory::format_tag::a);
+    auto relu_pd = eltwise_forward::primitive_desc(
+            {prop_kind::forward_inference, algorithm::eltwise_relu, md, 0.f},
+            eng);
+    auto relu = eltwise_forward(relu_pd);
+
+    auto src = test::make_memory(md, eng);
+    auto dst = test::make_memory(md, eng);
+    bound_args args(relu, {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, dst}});
+
+    fill(src, 1.f);
+    relu.execute(strm, args);
+    strm.wait();
+    check_relu(src, dst);
+
+    // the bound memory objects follow the data handle changes
+    auto other_src = test::make_memory(md, eng);
+    auto other_dst = test::make_memory(md, eng);
+    fill(other_src, 2.f);
+    src.set_data_handle(other_src.get_data_handle());
+    dst.set_data_handle(other_dst.get_data_handle());
+    relu.execute(strm, args);
+    strm.wait();
+    check_relu(other_src, other_dst);
+}
+
+HANDLE_EXCEPTIONS_FOR_TEST_P(bound_args_test_t, WrongArguments) {
+    auto engine_kind = static_cast<engine::kind>(GetParam());
+    SKIP_IF(engine::get_count(engine_kind) == 0,
+            "Engine kind is not supported");
+
+    engine eng(engine_kind, 0);
+    stream strm(eng);
+
+    const memory::desc md({n}, memory::data_type::f32, memory::format_tag::a);
+    auto relu = eltwise_forward({{prop_kind::forward_inference,
+                                         algorithm::eltwise_relu, md, 0.f},
+            eng});
+    auto abs = eltwise_forward({{prop_kind::forward_inference,
+                                        algorithm::eltwise_abs, md, 0.f},
+            eng});
+
+    auto src = test::make_memory(md, eng);
+    auto dst = test::make_memory(md, eng);
+
+    // missing destination
+    EXPECT_ANY_THROW(bound_args(relu, {{DNNL_ARG_SRC, src}}));
+
+    // arguments bound to another primitive
+    bound_args args(relu, {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, dst}});
+    EXPECT_ANY_THROW(abs.execute(strm, args));
+}
+
+namespace {
+struct print_to_string_param_name_t {
+    template <class ParamType>
+    std::string operator()(
+            const ::testing::TestParamInfo<ParamType> &info) const {
+        return to_string(info.param);
+    }
+};
+
+auto all_engine_kinds = ::testing::Values(dnnl_cpu, dnnl_gpu);
+
+} // namespace
+
+INSTANTIATE_TEST_SUITE_P(AllEngineKinds, bound_args_test_t, all_engine_kinds,
+        print_to_string_param_name_t());
+
+} // namespace dnnl
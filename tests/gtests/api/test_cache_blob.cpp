@@ -0,0 +1,142 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+#include <cmath>
+#include <vector>
+
+namespace dnnl {
+
+class cache_blob_test_t : public ::testing::TestWithParam<dnnl_engine_kind_t> {
+protected:
+    void fill(const memory &mem) {
+        const auto n = mem.get_desc().get_size() / sizeof(float);
+        auto ptr = map_memory<float>(mem);
+        for (size_t i = 0; i < n; ++i)
+            ptr[i] = std::sin(0.1f * (float)i);
+    }
+
+    void check_equal(const memory &a, const memory &b) {
+        const auto n = a.get_desc().get_size() / sizeof(float);
+        auto a_ptr = map_memory<float>(a);
+        auto b_ptr = map_memory<float>(b);
+        for (size_t i = 0; i < n; ++i)
+            ASSERT_EQ(a_ptr[i], b_ptr[i]) << "at position " << i;
+    }
+};
+
+HANDLE_EXCEPTIONS_FOR_TEST_P(cache_blob_test_t, CreateFromCacheBlob) {
+    auto engine_kind = static_cast<engine::kind>(GetParam());
+    SKIP_IF(engine::get_count(engine_kind) == 0,
+            "Engine kind is not supported");
+
+    engine eng(engine_kind, 0);
+    stream strm(eng);
+
+    const memory::dim N = 2, IC = 8, OC = 16, H = 7, W = 7;
+    auto conv_pd = convolution_forward::primitive_desc(
+            {prop_kind::forward_inference, algorithm::convolution_direct,
+                    {{N, IC, H, W}, memory::data_type::f32,
+                            memory::format_tag::nchw},
+                    {{OC, IC, 3, 3}, memory::data_type::f32,
+                            memory::format_tag::oihw},
+                    {{N, OC, H, W}, memory::data_type::f32,
+                            memory::format_tag::nchw},
+                    {1, 1}, {1, 1}, {1, 1}},
+            eng);
+    auto conv = convolution_forward(conv_pd);
+
+    if (engine_kind != engine::kind::gpu) {
+        EXPECT_ANY_THROW(conv.get_cache_blob());
+        return;
+    }
+
+    const auto cache_blob = conv.get_cache_blob();
+    ASSERT_FALSE(cache_blob.empty());
+
+    // The primitive cache would return the same primitive otherwise
+    const int capacity = get_primitive_cache_capacity();
+    set_primitive_cache_capacity(0);
+    auto conv_from_blob = primitive(conv_pd, cache_blob);
+    set_primitive_cache_capacity(capacity);
+
+    auto src = test::make_memory(conv_pd.src_desc(), eng);
+    auto weights = test::make_memory(conv_pd.weights_desc(), eng);
+    auto dst = test::make_memory(conv_pd.dst_desc(), eng);
+    auto ref_dst = test::make_memory(conv_pd.dst_desc(), eng);
+    fill(src);
+    fill(weights);
+
+    conv.execute(strm,
+            {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, weights},
+                    {DNNL_ARG_DST, ref_dst}});
+    conv_from_blob.execute(strm,
+            {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, weights},
+                    {DNNL_ARG_DST, dst}});
+    strm.wait();
+    check_equal(dst, ref_dst);
+
+    // the blob of the re-created primitive holds the same binaries
+    EXPECT_EQ(conv_from_blob.get_cache_blob(), cache_blob);
+}
+
+HANDLE_EXCEPTIONS_FOR_TEST_P(cache_blob_test_t, InvalidCacheBlob) {
+    auto engine_kind = static_cast<engine::kind>(GetParam());
+    SKIP_IF(engine::get_count(engine_kind) == 0,
+            "Engine kind is not supported");
+    SKIP_IF(engine_kind != engine::kind::gpu,
+            "Cache blob is supported on GPU only");
+
+    engine eng(engine_kind, 0);
+
+    const memory::desc md({17}, memory::data_type::f32, memory::format_tag::a);
+    auto relu_pd = eltwise_forward::primitive_desc(
+            {prop_kind::forward_inference, algorithm::eltwise_relu, md, 0.f},
+            eng);
+    auto cache_blob = eltwise_forward(relu_pd).get_cache_blob();
+
+    EXPECT_ANY_THROW(primitive(relu_pd, std::vector<uint8_t>()));
+
+    auto truncated = cache_blob;
+    truncated.pop_back();
+    EXPECT_ANY_THROW(primitive(relu_pd, truncated));
+
+    auto corrupted = cache_blob;
+    corrupted[0] ^= 0xff;
+    EXPECT_ANY_THROW(primitive(relu_pd, corrupted));
+}
+
+namespace {
+struct print_to_string_param_name_t {
+    template <class ParamType>
+    std::string operator()(
+            const ::testing::TestParamInfo<ParamType> &info) const {
+        return to_string(info.param);
+    }
+};
+
+auto all_engine_kinds = ::testing::Values(dnnl_cpu, dnnl_gpu);
+
+} // namespace
+
+INSTANTIATE_TEST_SUITE_P(AllEngineKinds, cache_blob_test_t, all_engine_kinds,
+        print_to_string_param_name_t());
+
+} // namespace dnnl
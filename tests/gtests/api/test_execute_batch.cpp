@@ -0,0 +1,136 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+#include <cmath>
+#include <unordered_map>
+#include <vector>
+
+namespace dnnl {
+
+class execute_batch_test_t
+    : public ::testing::TestWithParam<dnnl_engine_kind_t> {
+protected:
+    void fill(const memory &mem, int item) {
+        const auto n = mem.get_desc().get_size() / sizeof(float);
+        auto ptr = map_memory<float>(mem);
+        for (size_t i = 0; i < n; ++i)
+            ptr[i] = std::sin(0.1f * (float)(i + 7 * item));
+    }
+
+    void check_equal(const memory &a, const memory &b) {
+        const auto n = a.get_desc().get_size() / sizeof(float);
+        auto a_ptr = map_memory<float>(a);
+        auto b_ptr = map_memory<float>(b);
+        for (size_t i = 0; i < n; ++i)
+            ASSERT_EQ(a_ptr[i], b_ptr[i]) << "at position " << i;
+    }
+
+    const int batch = 13;
+};
+
+HANDLE_EXCEPTIONS_FOR_TEST_P(execute_batch_test_t, MatchesSingleExecution) {
+    auto engine_kind = static_cast<engine::kind>(GetParam());
+    SKIP_IF(engine::get_count(engine_kind) == 0,
+            "Engine kind is not supported");
+
+    engine eng(engine_kind, 0);
+    stream strm(eng);
+
+    const memory::dim N = 1, IC = 8, OC = 16, H = 7, W = 7;
+    auto conv_pd = convolution_forward::primitive_desc(
+            {prop_kind::forward_inference, algorithm::convolution_direct,
+                    {{N, IC, H, W}, memory::data_type::f32,
+                            memory::format_tag::nchw},
+                    {{OC, IC, 3, 3}, memory::data_type::f32,
+                            memory::format_tag::oihw},
+                    {{N, OC, H, W}, memory::data_type::f32,
+                            memory::format_tag::nchw},
+                    {1, 1}, {1, 1}, {1, 1}},
+            eng);
+    auto conv = convolution_forward(conv_pd);
+
+    auto weights = test::make_memory(conv_pd.weights_desc(), eng);
+    fill(weights, -1);
+
+    std::vector<memory> src, dst, ref_dst;
+    std::vector<std::unordered_map<int, memory>> args;
+    for (int i = 0; i < batch; ++i) {
+        src.push_back(test::make_memory(conv_pd.src_desc(), eng));
+        dst.push_back(test::make_memory(conv_pd.dst_desc(), eng));
+        ref_dst.push_back(test::make_memory(conv_pd.dst_desc(), eng));
+        fill(src[i], i);
+        args.push_back({{DNNL_ARG_SRC, src[i]}, {DNNL_ARG_WEIGHTS, weights},
+                {DNNL_ARG_DST, dst[i]}});
+    }
+
+    conv.execute_batch(strm, args);
+    for (int i = 0; i < batch; ++i)
+        conv.execute(strm,
+                {{DNNL_ARG_SRC, src[i]}, {DNNL_ARG_WEIGHTS, weights},
+                        {DNNL_ARG_DST, ref_dst[i]}});
+    strm.wait();
+
+    for (int i = 0; i < batch; ++i)
+        check_equal(dst[i], ref_dst[i]);
+
+    // an empty batch is a no-op
+    conv.execute_batch(strm, {});
+}
+
+HANDLE_EXCEPTIONS_FOR_TEST_P(execute_batch_test_t, WrongArguments) {
+    auto engine_kind = static_cast<engine::kind>(GetParam());
+    SKIP_IF(engine::get_count(engine_kind) == 0,
+            "Engine kind is not supported");
+
+    engine eng(engine_kind, 0);
+    stream strm(eng);
+
+    const memory::desc md({17}, memory::data_type::f32, memory::format_tag::a);
+    auto relu = eltwise_forward({{prop_kind::forward_inference,
+                                         algorithm::eltwise_relu, md, 0.f},
+            eng});
+    auto src = test::make_memory(md, eng);
+    auto dst = test::make_memory(md, eng);
+
+    // the destination of the second item is missing
+    EXPECT_ANY_THROW(relu.execute_batch(strm,
+            {{{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, dst}},
+                    {{DNNL_ARG_SRC, src}}}));
+}
+
+namespace {
+struct print_to_string_param_name_t {
+    template <class ParamType>
+    std::string operator()(
+            const ::testing::TestParamInfo<ParamType> &info) const {
+        return to_string(info.param);
+    }
+};
+
+auto all_engine_kinds = ::testing::Values(dnnl_cpu, dnnl_gpu);
+
+} // namespace
+
+INSTANTIATE_TEST_SUITE_P(AllEngineKinds, execute_batch_test_t,
+        all_engine_kinds, print_to_string_param_name_t());
+
+} // namespace dnnl
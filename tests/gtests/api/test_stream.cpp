@@ -20,6 +20,11 @@
 #include "oneapi/dnnl/dnnl.h"
 
 #include <tuple>
+#include <vector>
+
+#if defined(__linux__)
+#include <sched.h>
+#endif
 
 namespace dnnl {
 
@@ -133,6 +138,97 @@ TEST(stream_test_c, GetStream) {
     DNNL_CHECK(dnnl_engine_destroy(engine));
 }
 
+TEST(stream_test_cpp, ForkJoin) {
+    SKIP_IF(engine::get_count(engine::kind::cpu) == 0, "Engines not found.");
+
+    engine eng(engine::kind::cpu, 0);
+    stream s(eng);
+
+    // Independent branches of different sizes, two of them executing the
+    // same primitive
+    const int nbranches = 5;
+    const memory::dim sizes[nbranches] = {1000, 17, 1000, 256, 3};
+    std::vector<eltwise_forward> prims;
+    std::vector<memory> srcs, dsts;
+    for (int b = 0; b < nbranches; b++) {
+        memory::desc md({sizes[b]}, memory::data_type::f32,
+                memory::format_tag::a);
+        prims.emplace_back(eltwise_forward::primitive_desc(
+                {prop_kind::forward_inference, algorithm::eltwise_linear, md,
+                        2.f, (float)b},
+                eng));
+        srcs.emplace_back(md, eng);
+        dsts.emplace_back(md, eng);
+        auto src = map_memory<float>(srcs[b]);
+        for (memory::dim i = 0; i < sizes[b]; i++)
+            src[i] = (float)i;
+    }
+
+    s.fork();
+    for (int b = 0; b < nbranches; b++) {
+        const int p = b == 2 ? 0 : b;
+        prims[p].execute(
+                s, {{DNNL_ARG_SRC, srcs[b]}, {DNNL_ARG_DST, dsts[b]}});
+    }
+    s.join();
+
+    for (int b = 0; b < nbranches; b++) {
+        const float shift = b == 2 ? 0.f : (float)b;
+        auto dst = map_memory<float>(dsts[b]);
+        for (memory::dim i = 0; i < sizes[b]; i++)
+            ASSERT_EQ(dst[i], 2.f * i + shift) << "branch " << b;
+    }
+
+    EXPECT_ANY_THROW(s.join());
+    s.fork();
+    EXPECT_ANY_THROW(s.fork());
+    s.join();
+}
+
+#if defined(__linux__) && DNNL_CPU_RUNTIME != DNNL_RUNTIME_THREADPOOL \
+        && DNNL_CPU_RUNTIME != DNNL_RUNTIME_SYCL
+TEST(stream_test_cpp, CpuAffinity) {
+    SKIP_IF(engine::get_count(engine::kind::cpu) == 0, "Engines not found.");
+
+    engine eng(engine::kind::cpu, 0);
+    stream s(eng);
+    EXPECT_ANY_THROW(s.set_cpu_affinity({-1}));
+
+    cpu_set_t initial_set;
+    ASSERT_EQ(sched_getaffinity(0, sizeof(initial_set), &initial_set), 0);
+    std::vector<int> cpus;
+    for (int cpu = 0; cpu < CPU_SETSIZE && cpus.size() < 2; cpu++)
+        if (CPU_ISSET(cpu, &initial_set)) cpus.push_back(cpu);
+    s.set_cpu_affinity(cpus);
+
+    const memory::dim n = 1000;
+    memory::desc md({n}, memory::data_type::f32, memory::format_tag::a);
+    auto relu = eltwise_forward({{prop_kind::forward_inference,
+                                         algorithm::eltwise_relu, md, 0.f},
+            eng});
+    memory src(md, eng), dst(md, eng);
+    {
+        auto ptr = map_memory<float>(src);
+        for (memory::dim i = 0; i < n; i++)
+            ptr[i] = (float)(i % 3) - 1.f;
+    }
+    relu.execute(s, {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, dst}});
+    s.wait();
+    {
+        auto ptr = map_memory<float>(dst);
+        for (memory::dim i = 0; i < n; i++)
+            ASSERT_EQ(ptr[i], (i % 3) == 2 ? 1.f : 0.f);
+    }
+
+    // the affinity of the submitting thread is restored
+    cpu_set_t set;
+    ASSERT_EQ(sched_getaffinity(0, sizeof(set), &set), 0);
+    ASSERT_TRUE(CPU_EQUAL(&set, &initial_set));
+
+    s.set_cpu_affinity({});
+}
+#endif
+
 namespace {
 struct PrintToStringParamName {
     template <class ParamType>
@@ -415,3 +415,13 @@ CPU_INST_TEST_CASE(Simple_Depthwise_Blocked16,
                 16, 16, 32, 16, 16, 18, 16, 3, 3, 2, 1, 2, 1),
         PARAMS(FMT_DATA_BLOCKED16, Goihw16g, FMT_BIAS, FMT_DATA_BLOCKED16, 1,
                 16, 16, 500, 500, 16, 698, 698, 3, 3, 100, 100, 1, 1));
+
+CPU_INST_TEST_CASE(Simple_Grouped_Small_Channels_nhwc,
+        PARAMS(nhwc, goihw, FMT_BIAS, nhwc, 2, 16, 32, 14, 14, 32, 14, 14, 3,
+                3, 1, 1, 1, 1),
+        PARAMS(nhwc, goihw, FMT_BIAS, nhwc, 2, 16, 64, 15, 15, 64, 8, 8, 3, 3,
+                1, 1, 2, 2),
+        PARAMS(nhwc, goihw, FMT_BIAS, nhwc, 1, 8, 64, 9, 37, 64, 9, 37, 3, 3,
+                1, 1, 1, 1),
+        PARAMS(nhwc, goihw, FMT_NO_BIAS, nhwc, 1, 32, 64, 7, 7, 64, 9, 9, 3,
+                3, 2, 2, 1, 1));
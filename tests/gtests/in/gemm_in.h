@@ -109,6 +109,19 @@ CPU_INST_TEST_CASE(TestGEMM_smalln,
         test_params {'n', 't', 8, 512, 2048, 1.0f, 1.0f, 2048, 2048, 512},
         test_params {'n', 't', 8, 2048, 512, 1.0f, 1.0f, 512, 512, 2048});
 
+INST_TEST_CASE(TestGEMM_small,
+        test_params {'n', 'n', 16, 12, 1, 1.0f, 0.0f, 16, 12, 16},
+        test_params {'n', 't', 17, 13, 32, 1.0f, 1.0f, 33, 34, 18},
+        test_params {'t', 'n', 32, 32, 5, 0.5f, 2.0f, 35, 32, 33},
+        test_params {'t', 't', 1, 24, 31, -1.0f, 0.0f, 31, 31, 24},
+        test_params {'n', 'n', 9, 25, 32, 2.0f, -1.0f, 32, 32, 27},
+        test_params {'n', 't', 7, 5, 8, 1.0f, 0.0f, 8, 8, 5},
+        test_params {'t', 'n', 31, 1, 17, 1.0f, 0.5f, 31, 17, 32},
+        make_test_params_with_offset(
+                {3, 2, 1}, 'n', 't', 20, 32, 7, 1.0f, 1.0f, 20, 32, 32),
+        make_test_params_with_offset(
+                {1, 7, 5}, 't', 't', 32, 14, 21, 1.5f, 0.0f, 32, 21, 32));
+
 #if defined(FP32) || defined(BF16BF16F32)
 INST_TEST_CASE(TestGEMM_packed,
         test_params {'t', 'n', 3, 2, 1, 1.0, 0.0, 2, 5, 8, {}, {false, true},
@@ -273,6 +286,17 @@ INST_TEST_CASE(TestGEMM_expected_failures,
         test_params {'n', 'd', 3, 2, 1, 1.0, 0.0, 3, 3, 3, {}, {false, true},
                 true, dnnl_invalid_arguments});
 
+INST_TEST_CASE(TestGEMM_small,
+        test_params {'n', 'n', 8, 7, 1, 1.0f, 0.0f, 3, 7, 8, fix_no_offsets},
+        test_params {'n', 't', 5, 8, 8, 1.0f, 1.0f, 9, 10, 8,
+                col_use_all_offsets},
+        test_params {'t', 'n', 8, 8, 3, 0.5f, 2.0f, 9, 8, 11,
+                row_use_all_offsets},
+        test_params {'t', 't', 1, 6, 7, -1.0f, 0.0f, 3, 7, 6,
+                fix_use_all_offsets},
+        test_params {'n', 'n', 3, 8, 8, 2.0f, -1.0f, 8, 8, 9, row_use_oc},
+        test_params {'t', 'n', 7, 1, 5, 1.0f, 0.5f, 7, 1, 2, col_use_oc});
+
 INST_TEST_CASE(TestGEMM_general_cases_fix_offset,
         test_params {'N', 'n', 30, 20, 10, 1.0, 0.0, 60, 50, 80, fix_use_oc},
         test_params {'n', 'T', 30, 20, 10, 1.0, 0.0, 60, 50, 80, fix_use_oc},
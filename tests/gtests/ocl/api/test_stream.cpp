@@ -231,4 +231,142 @@ TEST_F(ocl_stream_test_cpp, InteropIncompatibleQueueCpp) {
     TEST_OCL_CHECK(clReleaseCommandQueue(cpu_ocl_queue));
 }
 
+TEST_F(ocl_stream_test_cpp, ProfilingCpp) {
+    SKIP_IF(!find_ocl_device(CL_DEVICE_TYPE_GPU),
+            "OpenCL GPU devices not found.");
+
+    stream s(eng, stream::flags::in_order | stream::flags::profiling);
+    cl_command_queue_properties props;
+    TEST_OCL_CHECK(clGetCommandQueueInfo(ocl_interop::get_command_queue(s),
+            CL_QUEUE_PROPERTIES, sizeof(props), &props, nullptr));
+    ASSERT_TRUE(props & CL_QUEUE_PROFILING_ENABLE);
+
+    memory::desc md({16, 16}, memory::data_type::f32, memory::format_tag::ab);
+    auto relu_d = eltwise_forward::desc(prop_kind::forward_inference,
+            algorithm::eltwise_relu, md, 0.f, 0.f);
+    auto relu = eltwise_forward({relu_d, eng});
+    memory mem(md, eng);
+
+    const int n_execs = 3;
+    for (int i = 0; i < n_execs; i++)
+        relu.execute(s, {{DNNL_ARG_SRC, mem}, {DNNL_ARG_DST, mem}});
+    s.wait();
+
+    using kind = stream::profiling_data_kind;
+    auto times = s.get_profiling_data(kind::time);
+    auto overheads = s.get_profiling_data(kind::overhead_time);
+    ASSERT_EQ(times.size(), (size_t)n_execs);
+    ASSERT_EQ(overheads.size(), (size_t)n_execs);
+    for (auto t : times)
+        ASSERT_GT(t, 0u);
+
+    s.reset_profiling();
+    ASSERT_TRUE(s.get_profiling_data(kind::time).empty());
+}
+
+TEST_F(ocl_stream_test_cpp, OutOfOrderCpp) {
+    SKIP_IF(!find_ocl_device(CL_DEVICE_TYPE_GPU),
+            "OpenCL GPU devices not found.");
+
+    cl_command_queue_properties dev_props;
+    TEST_OCL_CHECK(clGetDeviceInfo(ocl_dev, CL_DEVICE_QUEUE_PROPERTIES,
+            sizeof(dev_props), &dev_props, nullptr));
+    SKIP_IF(!(dev_props & CL_QUEUE_OUT_OF_ORDER_EXEC_MODE_ENABLE),
+            "Out-of-order queues are not supported.");
+
+    stream s(eng, stream::flags::out_of_order);
+
+    const memory::dim n = 1024;
+    memory::desc md({n}, memory::data_type::f32, memory::format_tag::a);
+    auto make_eltwise = [&](algorithm alg, float alpha, float beta) {
+        auto d = eltwise_forward::desc(
+                prop_kind::forward_inference, alg, md, alpha, beta);
+        return eltwise_forward({d, eng});
+    };
+    auto relu = make_eltwise(algorithm::eltwise_relu, 0.f, 0.f);
+    auto linear = make_eltwise(algorithm::eltwise_linear, 2.f, 1.f);
+
+    // a -> relu -> b -> linear -> b depends on the previous primitive,
+    // c -> linear -> d is independent
+    memory a(md, eng), b(md, eng), c(md, eng), d(md, eng);
+    {
+        auto pa = map_memory<float>(a);
+        auto pc = map_memory<float>(c);
+        for (memory::dim i = 0; i < n; i++) {
+            pa[i] = (float)(i % 7) - 3.f;
+            pc[i] = (float)(i % 5);
+        }
+    }
+    relu.execute(s, {{DNNL_ARG_SRC, a}, {DNNL_ARG_DST, b}});
+    linear.execute(s, {{DNNL_ARG_SRC, c}, {DNNL_ARG_DST, d}});
+    linear.execute(s, {{DNNL_ARG_SRC, b}, {DNNL_ARG_DST, b}});
+    s.wait();
+
+    auto pb = map_memory<float>(b);
+    auto pd = map_memory<float>(d);
+    for (memory::dim i = 0; i < n; i++) {
+        const float a_val = (float)(i % 7) - 3.f;
+        ASSERT_EQ(pb[i], 2.f * (a_val > 0.f ? a_val : 0.f) + 1.f);
+        ASSERT_EQ(pd[i], 2.f * (float)(i % 5) + 1.f);
+    }
+}
+
+TEST_F(ocl_stream_test_cpp, CaptureReplayCpp) {
+    SKIP_IF(!find_ocl_device(CL_DEVICE_TYPE_GPU),
+            "OpenCL GPU devices not found.");
+
+    stream s(eng);
+
+    const memory::dim n = 256;
+    memory::desc md({n}, memory::data_type::f32, memory::format_tag::a);
+    auto relu_d = eltwise_forward::desc(prop_kind::forward_inference,
+            algorithm::eltwise_relu, md, 0.f, 0.f);
+    auto linear_d = eltwise_forward::desc(prop_kind::forward_inference,
+            algorithm::eltwise_linear, md, 2.f, 0.f);
+    auto relu = eltwise_forward({relu_d, eng});
+    auto linear = eltwise_forward({linear_d, eng});
+    memory src(md, eng), tmp(md, eng), dst(md, eng);
+
+    auto fill_src = [&](float shift) {
+        auto p = map_memory<float>(src);
+        for (memory::dim i = 0; i < n; i++)
+            p[i] = (float)i - shift;
+    };
+    auto check_dst = [&](float shift) {
+        auto p = map_memory<float>(dst);
+        for (memory::dim i = 0; i < n; i++) {
+            const float v = (float)i - shift;
+            ASSERT_EQ(p[i], 2.f * (v > 0.f ? v : 0.f));
+        }
+    };
+
+    fill_src(100.f);
+    s.begin_capture();
+    relu.execute(s, {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, tmp}});
+    linear.execute(s, {{DNNL_ARG_SRC, tmp}, {DNNL_ARG_DST, dst}});
+    s.end_capture();
+    s.wait();
+    check_dst(100.f);
+
+    // The replay picks up the new contents of the captured memory
+    for (float shift : {0.f, 50.f, 300.f}) {
+        fill_src(shift);
+        s.replay();
+        s.wait();
+        check_dst(shift);
+    }
+}
+
+TEST_F(ocl_stream_test_cpp, ProfilingUnsupportedCpp) {
+    SKIP_IF(engine::get_count(engine::kind::cpu) == 0, "CPU not found.");
+
+    // Only the OpenCL GPU streams collect profiling data
+    catch_expected_failures(
+            [&] {
+                stream s(engine(engine::kind::cpu, 0),
+                        stream::flags::profiling);
+            },
+            true, dnnl_unimplemented);
+}
+
 } // namespace dnnl
@@ -14,6 +14,7 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
 #include <vector>
 
 #include "dnnl_test_common.hpp"
@@ -291,4 +292,137 @@ CPU_INSTANTIATE_TEST_SUITE_P(Case, test_parallel_nd_t,
                 np_t {{4, 1, 4, 5, 2}}, np_t {{4, 3, 0, 3, 0, 1}},
                 np_t {{2, 1, 3, 1, 2, 1}}, np_t {{4, 1, 4, 3, 2, 2}}));
 
+class test_parallel_nd_dynamic_t : public test_nd_t {
+protected:
+    void emit_parallel_nd_dynamic() {
+        switch ((int)p.dims.size()) {
+            case 1:
+                impl::parallel_nd_dynamic(p.dims[0], [&](ptrdiff_t d0) {
+                    ASSERT_TRUE(0 <= d0 && d0 < p.dims[0]);
+                    data[d0] = d0;
+                });
+                break;
+            case 2:
+                impl::parallel_nd_dynamic(
+                        p.dims[0], p.dims[1], [&](ptrdiff_t d0, ptrdiff_t d1) {
+                            ASSERT_TRUE(0 <= d0 && d0 < p.dims[0]);
+                            ASSERT_TRUE(0 <= d1 && d1 < p.dims[1]);
+                            const ptrdiff_t idx = d0 * p.dims[1] + d1;
+                            data[idx] = idx;
+                        });
+                break;
+            case 3:
+                impl::parallel_nd_dynamic(p.dims[0], p.dims[1], p.dims[2],
+                        [&](ptrdiff_t d0, ptrdiff_t d1, ptrdiff_t d2) {
+                            ASSERT_TRUE(0 <= d0 && d0 < p.dims[0]);
+                            ASSERT_TRUE(0 <= d1 && d1 < p.dims[1]);
+                            ASSERT_TRUE(0 <= d2 && d2 < p.dims[2]);
+                            const ptrdiff_t idx
+                                    = (d0 * p.dims[1] + d1) * p.dims[2] + d2;
+                            data[idx] = idx;
+                        });
+                break;
+            case 4:
+                impl::parallel_nd_dynamic(p.dims[0], p.dims[1], p.dims[2],
+                        p.dims[3],
+                        [&](ptrdiff_t d0, ptrdiff_t d1, ptrdiff_t d2,
+                                ptrdiff_t d3) {
+                            ASSERT_TRUE(0 <= d0 && d0 < p.dims[0]);
+                            ASSERT_TRUE(0 <= d1 && d1 < p.dims[1]);
+                            ASSERT_TRUE(0 <= d2 && d2 < p.dims[2]);
+                            ASSERT_TRUE(0 <= d3 && d3 < p.dims[3]);
+                            const ptrdiff_t idx
+                                    = ((d0 * p.dims[1] + d1) * p.dims[2] + d2)
+                                            * p.dims[3]
+                                    + d3;
+                            data[idx] = idx;
+                        });
+                break;
+            case 5:
+                impl::parallel_nd_dynamic(p.dims[0], p.dims[1], p.dims[2],
+                        p.dims[3], p.dims[4],
+                        [&](ptrdiff_t d0, ptrdiff_t d1, ptrdiff_t d2,
+                                ptrdiff_t d3, ptrdiff_t d4) {
+                            ASSERT_TRUE(0 <= d0 && d0 < p.dims[0]);
+                            ASSERT_TRUE(0 <= d1 && d1 < p.dims[1]);
+                            ASSERT_TRUE(0 <= d2 && d2 < p.dims[2]);
+                            ASSERT_TRUE(0 <= d3 && d3 < p.dims[3]);
+                            ASSERT_TRUE(0 <= d4 && d4 < p.dims[4]);
+                            const ptrdiff_t idx
+                                    = (((d0 * p.dims[1] + d1) * p.dims[2] + d2)
+                                                      * p.dims[3]
+                                              + d3)
+                                            * p.dims[4]
+                                    + d4;
+                            data[idx] = idx;
+                        });
+                break;
+            case 6:
+                impl::parallel_nd_dynamic(p.dims[0], p.dims[1], p.dims[2],
+                        p.dims[3], p.dims[4], p.dims[5],
+                        [&](ptrdiff_t d0, ptrdiff_t d1, ptrdiff_t d2,
+                                ptrdiff_t d3, ptrdiff_t d4, ptrdiff_t d5) {
+                            ASSERT_TRUE(0 <= d0 && d0 < p.dims[0]);
+                            ASSERT_TRUE(0 <= d1 && d1 < p.dims[1]);
+                            ASSERT_TRUE(0 <= d2 && d2 < p.dims[2]);
+                            ASSERT_TRUE(0 <= d3 && d3 < p.dims[3]);
+                            ASSERT_TRUE(0 <= d4 && d4 < p.dims[4]);
+                            ASSERT_TRUE(0 <= d5 && d5 < p.dims[5]);
+                            const ptrdiff_t idx
+                                    = ((((d0 * p.dims[1] + d1) * p.dims[2] + d2)
+                                                       * p.dims[3]
+                                               + d3) * p.dims[4]
+                                              + d4)
+                                            * p.dims[5]
+                                    + d5;
+                            data[idx] = idx;
+                        });
+                break;
+            default: ASSERT_TRUE(false);
+        }
+    }
+};
+
+TEST_P(test_parallel_nd_dynamic_t, Test) {
+    emit_parallel_nd_dynamic();
+    CheckID();
+}
+
+CPU_INSTANTIATE_TEST_SUITE_P(Case, test_parallel_nd_dynamic_t,
+        ::testing::Values(np_t {{0}}, np_t {{1}}, np_t {{100}}, np_t {{0, 0}},
+                np_t {{1, 2}}, np_t {{10, 10}}, np_t {{0, 1, 0}},
+                np_t {{1, 2, 1}}, np_t {{4, 4, 10}}, np_t {{0, 3, 0, 1}},
+                np_t {{1, 1, 2, 1}}, np_t {{4, 4, 5, 2}},
+                np_t {{3, 0, 3, 0, 1}}, np_t {{2, 1, 1, 2, 1}},
+                np_t {{4, 1, 4, 5, 2}}, np_t {{4, 3, 0, 3, 0, 1}},
+                np_t {{2, 1, 3, 1, 2, 1}}, np_t {{4, 1, 4, 3, 2, 2}},
+                np_t {{1000, 7}}));
+
+class test_parallel_dynamic_ithr_t : public test_nd_t {};
+
+TEST_P(test_parallel_dynamic_ithr_t, Test) {
+    for (int nthr_req : {0, 1, 3}) {
+        std::fill(data.begin(), data.end(), -1);
+        impl::parallel_dynamic_ithr(nthr_req, [&](int ithr, int nthr) {
+            ptrdiff_t start {0}, end {0};
+            impl::balance211(size, nthr, ithr, start, end);
+            for (ptrdiff_t i = start; i < end; ++i)
+                data[i] = i;
+        });
+        CheckID();
+    }
+}
+
+CPU_INSTANTIATE_TEST_SUITE_P(Case, test_parallel_dynamic_ithr_t,
+        ::testing::Values(np_t {{0}}, np_t {{1}}, np_t {{7}}, np_t {{100}},
+                np_t {{1000, 7}}));
+
+TEST(test_exec_num_threads, Test) {
+    const int nthr_cur = dnnl_get_current_num_threads();
+    ASSERT_EQ(dnnl_get_exec_num_threads(0), nthr_cur);
+    ASSERT_EQ(dnnl_get_exec_num_threads(1), 1);
+    ASSERT_EQ(dnnl_get_exec_num_threads(nthr_cur), nthr_cur);
+    ASSERT_EQ(dnnl_get_exec_num_threads(nthr_cur + 1), nthr_cur);
+}
+
 } // namespace dnnl
@@ -0,0 +1,195 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+namespace dnnl {
+
+struct embedding_bag_test_params_t {
+    algorithm aalgorithm;
+    memory::data_type table_dt;
+    memory::dim rows;
+    memory::dim dim;
+    std::vector<int32_t> indices;
+    std::vector<int32_t> offsets;
+    bool expect_to_fail;
+    dnnl_status_t expected_status;
+};
+
+class embedding_bag_test_t
+    : public ::testing::TestWithParam<embedding_bag_test_params_t> {
+private:
+    embedding_bag_test_params_t p;
+
+protected:
+    void SetUp() override {
+        p = ::testing::TestWithParam<embedding_bag_test_params_t>::GetParam();
+
+        SKIP_IF(unsupported_data_type(p.table_dt),
+                "Engine does not support this data type.");
+        SKIP_IF(get_test_engine().get_kind() != engine::kind::cpu,
+                "Engine does not support this primitive.");
+
+        catch_expected_failures(
+                [=]() { Test(); }, p.expect_to_fail, p.expected_status);
+    }
+
+    void Test() {
+        using op_desc_t = embedding_bag_forward::desc;
+        using pd_t = embedding_bag_forward::primitive_desc;
+        using dt = memory::data_type;
+        using tag = memory::format_tag;
+        allows_attr_t aa {false}; // doesn't support anything
+
+        auto eng = get_test_engine();
+        auto strm = make_stream(eng);
+
+        const memory::dim n_indices = p.indices.size();
+        const memory::dim bags = p.offsets.size();
+        const bool is_quantized = p.table_dt == dt::u8;
+
+        auto indices_md = memory::desc({n_indices}, dt::s32, tag::a);
+        auto offsets_md = memory::desc({bags}, dt::s32, tag::a);
+        auto table_md = memory::desc({p.rows, p.dim}, p.table_dt, tag::ab);
+        auto ss_md = memory::desc({p.rows, 2}, dt::f32, tag::ab);
+        auto dst_md = memory::desc({bags, p.dim}, dt::f32, tag::any);
+
+        auto op_desc = op_desc_t();
+        if (is_quantized)
+            op_desc = op_desc_t(prop_kind::forward_inference, p.aalgorithm,
+                    indices_md, offsets_md, table_md, ss_md, dst_md);
+        else
+            op_desc = op_desc_t(prop_kind::forward_inference, p.aalgorithm,
+                    indices_md, offsets_md, table_md, dst_md);
+
+        auto pd = pd_t();
+        ASSERT_NO_THROW(pd = pd_t(op_desc, eng));
+        test_fwd_pd_constructors<op_desc_t, pd_t>(op_desc, pd, aa);
+
+        auto prim = embedding_bag_forward();
+        prim = embedding_bag_forward(pd);
+
+        ASSERT_TRUE(pd.query_md(query::exec_arg_md, DNNL_ARG_WEIGHTS)
+                == pd.table_desc());
+        ASSERT_TRUE(
+                pd.query_md(query::exec_arg_md, DNNL_ARG_DST) == pd.dst_desc());
+
+        auto mem_indices = test::make_memory(indices_md, eng);
+        auto mem_offsets = test::make_memory(offsets_md, eng);
+        auto mem_table = test::make_memory(pd.table_desc(), eng);
+        auto mem_ss = test::make_memory(ss_md, eng);
+        auto mem_dst = test::make_memory(pd.dst_desc(), eng);
+
+        {
+            auto ptr = map_memory<int32_t>(mem_indices);
+            for (memory::dim i = 0; i < n_indices; ++i)
+                ptr[i] = p.indices[i];
+        }
+        {
+            auto ptr = map_memory<int32_t>(mem_offsets);
+            for (memory::dim b = 0; b < bags; ++b)
+                ptr[b] = p.offsets[b];
+        }
+        // Small integer values keep the sums exact
+        auto table_value = [&](memory::dim r, memory::dim d) {
+            return (float)((r * 3 + d) % 7);
+        };
+        auto row_scale = [&](memory::dim r) { return 0.5f * (r % 3 + 1); };
+        auto row_shift = [&](memory::dim r) { return (float)(r % 2); };
+        if (is_quantized) {
+            auto ptr = map_memory<uint8_t>(mem_table);
+            auto ss = map_memory<float>(mem_ss);
+            for (memory::dim r = 0; r < p.rows; ++r) {
+                for (memory::dim d = 0; d < p.dim; ++d)
+                    ptr[r * p.dim + d] = (uint8_t)table_value(r, d);
+                ss[2 * r + 0] = row_scale(r);
+                ss[2 * r + 1] = row_shift(r);
+            }
+        } else {
+            auto ptr = map_memory<float>(mem_table);
+            for (memory::dim r = 0; r < p.rows; ++r)
+                for (memory::dim d = 0; d < p.dim; ++d)
+                    ptr[r * p.dim + d] = table_value(r, d);
+        }
+
+        std::unordered_map<int, memory> args = {{DNNL_ARG_SRC, mem_indices},
+                {DNNL_ARG_OFFSETS, mem_offsets}, {DNNL_ARG_WEIGHTS, mem_table},
+                {DNNL_ARG_DST, mem_dst}};
+        if (is_quantized) args.insert({DNNL_ARG_WEIGHTS_SCALE_SHIFT, mem_ss});
+        prim.execute(strm, args);
+        strm.wait();
+
+        auto dst = map_memory<float>(mem_dst);
+        for (memory::dim b = 0; b < bags; ++b) {
+            const memory::dim i_beg = p.offsets[b];
+            const memory::dim i_end
+                    = b + 1 < bags ? p.offsets[b + 1] : n_indices;
+            for (memory::dim d = 0; d < p.dim; ++d) {
+                float ref = 0;
+                for (memory::dim i = i_beg; i < i_end; ++i) {
+                    const memory::dim r = p.indices[i];
+                    ref += is_quantized
+                            ? row_scale(r) * table_value(r, d) + row_shift(r)
+                            : table_value(r, d);
+                }
+                if (p.aalgorithm == algorithm::reduction_mean && i_end > i_beg)
+                    ref /= (i_end - i_beg);
+                ASSERT_NEAR(dst[b * p.dim + d], ref, 1e-5f * (1 + ref));
+            }
+        }
+    }
+};
+
+using dt = memory::data_type;
+
+static auto expected_failures = []() {
+    return ::testing::Values(
+            // not supported alg_kind
+            embedding_bag_test_params_t {algorithm::reduction_max, dt::f32, 4,
+                    8, {0, 1}, {0}, true, dnnl_invalid_arguments},
+            // not supported table data type
+            embedding_bag_test_params_t {algorithm::reduction_sum, dt::s32, 4,
+                    8, {0, 1}, {0}, true, dnnl_invalid_arguments});
+};
+
+static auto simple_cases = []() {
+    return ::testing::Values(
+            // empty bags and a dimension that is not a vector multiple
+            embedding_bag_test_params_t {algorithm::reduction_sum, dt::f32, 10,
+                    7, {1, 3, 3, 9, 0, 2}, {0, 0, 2, 2, 5}},
+            embedding_bag_test_params_t {algorithm::reduction_sum, dt::f32, 50,
+                    64, {1, 3, 3, 9, 0, 2, 49, 17, 25, 25, 4},
+                    {0, 3, 3, 8}},
+            embedding_bag_test_params_t {algorithm::reduction_mean, dt::f32,
+                    50, 64, {1, 3, 3, 9, 0, 2, 49, 17, 25, 25, 4},
+                    {0, 1, 6, 6}},
+            embedding_bag_test_params_t {algorithm::reduction_sum, dt::u8, 50,
+                    48, {1, 3, 3, 9, 0, 2, 49, 17, 25, 25, 4},
+                    {0, 3, 3, 8}},
+            embedding_bag_test_params_t {algorithm::reduction_mean, dt::u8, 50,
+                    5, {1, 3, 3, 9, 0, 2, 49, 17, 25, 25, 4}, {0, 4}});
+};
+
+TEST_P(embedding_bag_test_t, TestsEmbeddingBag) {}
+INSTANTIATE_TEST_SUITE_P(
+        TestEmbeddingBagEF, embedding_bag_test_t, expected_failures());
+INSTANTIATE_TEST_SUITE_P(
+        TestEmbeddingBagSimple, embedding_bag_test_t, simple_cases());
+
+} // namespace dnnl
@@ -0,0 +1,271 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <type_traits>
+#include <vector>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+namespace dnnl {
+
+// Strides are in elements, a negative one means a tightly packed batch
+struct gemm_batch_params_t {
+    char transa, transb;
+    memory::dim batch, M, N, K;
+    float alpha, beta;
+    memory::dim lda, ldb, ldc;
+    memory::dim stride_a, stride_b, stride_c;
+    char offsetc;
+};
+
+template <typename a_dt, typename b_dt, typename c_dt>
+class gemm_batch_test_t
+    : public ::testing::TestWithParam<gemm_batch_params_t> {
+protected:
+    void SetUp() override {
+        SKIP_IF(get_test_engine_kind() == engine::kind::gpu,
+                "GPU GEMM not implemented.");
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_SYCL
+        SKIP_IF(get_test_engine_kind() == engine::kind::cpu,
+                "SYCL CPU GEMM not implemented.");
+#endif
+        p = GetParam();
+        const bool ta = is_trans(p.transa), tb = is_trans(p.transb);
+        const memory::dim a_rows = ta ? p.K : p.M, b_rows = tb ? p.N : p.K;
+        if (p.stride_a < 0) p.stride_a = a_rows * p.lda;
+        if (p.stride_b < 0) p.stride_b = b_rows * p.ldb;
+        if (p.stride_c < 0) p.stride_c = p.M * p.ldc;
+
+        a.resize(size(p.stride_a, a_rows * p.lda));
+        b.resize(size(p.stride_b, b_rows * p.ldb));
+        c.resize(size(p.stride_c, p.M * p.ldc));
+        for (size_t i = 0; i < a.size(); i++)
+            a[i] = (a_dt)((i * 7 + 1) % 11);
+        for (size_t i = 0; i < b.size(); i++)
+            b[i] = (b_dt)((i * 5 + 3) % 9) - (b_dt)4;
+        for (size_t i = 0; i < c.size(); i++)
+            c[i] = (c_dt)((i * 3 + 2) % 7);
+        co.resize(std::max(p.M, p.N));
+        for (size_t i = 0; i < co.size(); i++)
+            co[i] = (int32_t)(i % 5) - 2;
+    }
+
+    static bool is_trans(char t) { return t == 'T' || t == 't'; }
+
+    memory::dim size(memory::dim stride, memory::dim mat_size) const {
+        return (p.batch - 1) * stride + mat_size + 1;
+    }
+
+    // row-major reference computed in double
+    std::vector<c_dt> compute_ref(a_dt ao, b_dt bo) const {
+        const bool with_co = std::is_integral<c_dt>::value;
+        std::vector<c_dt> ref = c;
+        for (memory::dim i = 0; i < p.batch; i++) {
+            const a_dt *pa = a.data() + i * p.stride_a;
+            const b_dt *pb = b.data() + i * p.stride_b;
+            c_dt *pc = ref.data() + i * p.stride_c;
+            for_(memory::dim m = 0; m < p.M; m++)
+            for (memory::dim n = 0; n < p.N; n++) {
+                double acc = 0;
+                for (memory::dim k = 0; k < p.K; k++) {
+                    const double a_mk = is_trans(p.transa) ? pa[k * p.lda + m]
+                                                           : pa[m * p.lda + k];
+                    const double b_kn = is_trans(p.transb) ? pb[n * p.ldb + k]
+                                                           : pb[k * p.ldb + n];
+                    acc += (a_mk - ao) * (b_kn - bo);
+                }
+                double dst = p.alpha * acc
+                        + (p.beta == 0.f ? 0. : p.beta * pc[m * p.ldc + n]);
+                if (with_co && p.offsetc == 'F') dst += co[0];
+                if (with_co && p.offsetc == 'C') dst += co[m];
+                if (with_co && p.offsetc == 'R') dst += co[n];
+                pc[m * p.ldc + n] = (c_dt)dst;
+            }
+        }
+        return ref;
+    }
+
+    void check(const std::vector<c_dt> &ref) const {
+        // the padding must stay untouched
+        const float eps = 1e-5f * std::max(p.K, memory::dim(1));
+        for (size_t i = 0; i < ref.size(); i++)
+            ASSERT_NEAR(c[i], ref[i], eps);
+    }
+
+    template <typename T>
+    std::vector<T *> ptrs(std::vector<typename std::remove_const<T>::type> &v,
+            memory::dim stride, bool shuffle) const {
+        std::vector<T *> res;
+        for (memory::dim i = 0; i < p.batch; i++)
+            res.push_back(v.data() + i * stride);
+        // the problems of the batch can come in any order
+        if (shuffle) std::reverse(res.begin(), res.end());
+        return res;
+    }
+
+    gemm_batch_params_t p;
+    std::vector<a_dt> a;
+    std::vector<b_dt> b;
+    std::vector<c_dt> c;
+    std::vector<int32_t> co;
+};
+
+class sgemm_batch_test_t : public gemm_batch_test_t<float, float, float> {
+protected:
+    void Strided() {
+        const auto ref = compute_ref(0, 0);
+        ASSERT_EQ(sgemm_batch_strided(p.transa, p.transb, p.batch, p.M, p.N,
+                          p.K, p.alpha, a.data(), p.lda, p.stride_a, b.data(),
+                          p.ldb, p.stride_b, p.beta, c.data(), p.ldc,
+                          p.stride_c),
+                status::success);
+        check(ref);
+    }
+
+    void Pointers(bool shuffle) {
+        const auto ref = compute_ref(0, 0);
+        auto pa = ptrs<const float>(a, p.stride_a, shuffle);
+        auto pb = ptrs<const float>(b, p.stride_b, shuffle);
+        auto pc = ptrs<float>(c, p.stride_c, shuffle);
+        ASSERT_EQ(sgemm_batch(p.transa, p.transb, p.batch, p.M, p.N, p.K,
+                          p.alpha, pa.data(), p.lda, pb.data(), p.ldb, p.beta,
+                          pc.data(), p.ldc),
+                status::success);
+        check(ref);
+    }
+};
+
+class gemm_u8s8s32_batch_test_t
+    : public gemm_batch_test_t<uint8_t, int8_t, int32_t> {
+protected:
+    void Strided() {
+        const uint8_t ao = 1;
+        const int8_t bo = -2;
+        const auto ref = compute_ref(ao, bo);
+        ASSERT_EQ(gemm_u8s8s32_batch_strided(p.transa, p.transb, p.offsetc,
+                          p.batch, p.M, p.N, p.K, p.alpha, a.data(), p.lda,
+                          p.stride_a, ao, b.data(), p.ldb, p.stride_b, bo,
+                          p.beta, c.data(), p.ldc, p.stride_c, co.data()),
+                status::success);
+        check(ref);
+    }
+
+    void Pointers(bool shuffle) {
+        const auto ref = compute_ref(0, 0);
+        auto pa = ptrs<const uint8_t>(a, p.stride_a, shuffle);
+        auto pb = ptrs<const int8_t>(b, p.stride_b, shuffle);
+        auto pc = ptrs<int32_t>(c, p.stride_c, shuffle);
+        ASSERT_EQ(gemm_u8s8s32_batch(p.transa, p.transb, p.offsetc, p.batch,
+                          p.M, p.N, p.K, p.alpha, pa.data(), p.lda, 0,
+                          pb.data(), p.ldb, 0, p.beta, pc.data(), p.ldc,
+                          co.data()),
+                status::success);
+        check(ref);
+    }
+};
+
+TEST_P(sgemm_batch_test_t, TestsStrided) {
+    Strided();
+}
+TEST_P(sgemm_batch_test_t, TestsPointers) {
+    Pointers(false);
+}
+TEST_P(sgemm_batch_test_t, TestsShuffledPointers) {
+    Pointers(true);
+}
+
+TEST_P(gemm_u8s8s32_batch_test_t, TestsStrided) {
+    Strided();
+}
+TEST_P(gemm_u8s8s32_batch_test_t, TestsShuffledPointers) {
+    Pointers(true);
+}
+
+// {transa, transb, batch, M, N, K, alpha, beta, lda, ldb, ldc,
+//  stride_a, stride_b, stride_c, offsetc}
+INSTANTIATE_TEST_SUITE_P(TestSgemmBatch, sgemm_batch_test_t,
+        ::testing::Values(
+                // empty batches and problems
+                gemm_batch_params_t {'N', 'N', 0, 8, 8, 8, 1.f, 0.f, 8, 8, 8,
+                        -1, -1, -1, 'F'},
+                gemm_batch_params_t {'N', 'N', 3, 0, 8, 8, 1.f, 0.f, 8, 8, 8,
+                        -1, -1, -1, 'F'},
+                // independent matrices
+                gemm_batch_params_t {'N', 'N', 100, 7, 9, 5, 1.f, 0.f, 6, 11,
+                        10, -1, -1, -1, 'F'},
+                gemm_batch_params_t {'T', 'T', 13, 16, 3, 33, 0.5f, 2.f, 17,
+                        34, 4, -1, -1, -1, 'F'},
+                gemm_batch_params_t {'N', 'N', 2, 200, 300, 100, 1.f, 1.f, 100,
+                        300, 300, -1, -1, -1, 'F'},
+                // shared weights folded into M
+                gemm_batch_params_t {'N', 'N', 64, 12, 32, 48, 1.f, 0.f, 48,
+                        32, 32, -1, 0, -1, 'F'},
+                gemm_batch_params_t {'T', 'T', 10, 5, 16, 8, 2.f, 1.f, 50, 8,
+                        16, 5, 0, -1, 'F'},
+                // shared left matrix folded into N
+                gemm_batch_params_t {'N', 'N', 20, 16, 4, 16, 1.f, 0.5f, 80,
+                        80, 80, 0, 4, 4, 'F'},
+                gemm_batch_params_t {'N', 'T', 20, 16, 4, 16, 1.f, 0.f, 16, 16,
+                        80, 0, 64, 4, 'F'},
+                // shared weights with a layout that does not fold
+                gemm_batch_params_t {'N', 'N', 40, 9, 9, 9, 1.f, 0.f, 10, 9,
+                        12, 100, 0, 120, 'F'}));
+
+INSTANTIATE_TEST_SUITE_P(TestGemmU8S8S32Batch, gemm_u8s8s32_batch_test_t,
+        ::testing::Values(
+                gemm_batch_params_t {'N', 'N', 30, 7, 9, 5, 1.f, 0.f, 6, 11,
+                        10, -1, -1, -1, 'F'},
+                gemm_batch_params_t {'N', 'T', 30, 7, 9, 5, 1.f, 1.f, 6, 6, 10,
+                        -1, -1, -1, 'C'},
+                // shared weights: the batch folds into M with the 'R'
+                // offsets but not with the 'C' ones
+                gemm_batch_params_t {'N', 'N', 32, 8, 24, 40, 1.f, 0.f, 40,
+                        24, 24, -1, 0, -1, 'R'},
+                gemm_batch_params_t {'N', 'N', 32, 8, 24, 40, 1.f, 0.f, 40,
+                        24, 24, -1, 0, -1, 'C'},
+                gemm_batch_params_t {'T', 'N', 12, 16, 16, 64, 1.f, 0.f, 16,
+                        16, 16, -1, 0, -1, 'F'}));
+
+TEST(sgemm_batch_test_t, TestSgemmBatchInvalidArguments) {
+    SKIP_IF(get_test_engine_kind() == engine::kind::gpu,
+            "GPU GEMM not implemented.");
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_SYCL
+    SKIP_IF(get_test_engine_kind() == engine::kind::cpu,
+            "SYCL CPU GEMM not implemented.");
+#endif
+    std::vector<float> buf(64);
+    const float *ab[] = {buf.data(), buf.data()};
+    float *c[] = {buf.data() + 16, buf.data() + 32};
+
+    ASSERT_EQ(sgemm_batch_strided('N', 'N', -1, 4, 4, 4, 1.f, buf.data(), 4,
+                      0, buf.data(), 4, 0, 0.f, buf.data(), 4, 16),
+            status::invalid_arguments);
+    ASSERT_EQ(sgemm_batch_strided('N', 'N', 2, 4, 4, 4, 1.f, buf.data(), 2,
+                      0, buf.data(), 4, 0, 0.f, buf.data(), 4, 16),
+            status::invalid_arguments);
+    ASSERT_EQ(sgemm_batch('N', 'N', 2, 4, 4, 4, 1.f, nullptr, 4, ab, 4, 0.f,
+                      c, 4),
+            status::invalid_arguments);
+    ASSERT_EQ(sgemm_batch('N', 'X', 2, 4, 4, 4, 1.f, ab, 4, ab, 4, 0.f, c, 4),
+            status::invalid_arguments);
+}
+
+} // namespace dnnl
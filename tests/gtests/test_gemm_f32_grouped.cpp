@@ -0,0 +1,188 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+namespace dnnl {
+
+struct sgemm_grouped_problem_t {
+    char transa, transb;
+    memory::dim M, N, K;
+    float alpha, beta;
+};
+
+class sgemm_grouped_test_t
+    : public ::testing::TestWithParam<std::vector<sgemm_grouped_problem_t>> {
+protected:
+    void SetUp() override {
+        SKIP_IF(get_test_engine_kind() == engine::kind::gpu,
+                "GPU GEMM not implemented.");
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_SYCL
+        SKIP_IF(get_test_engine_kind() == engine::kind::cpu,
+                "SYCL CPU GEMM not implemented.");
+#endif
+        Test();
+    }
+
+    static bool is_trans(char t) { return t == 'T' || t == 't'; }
+
+    void Test() {
+        const auto &problems = GetParam();
+        const memory::dim ngroups = (memory::dim)problems.size();
+
+        std::vector<char> transa, transb;
+        std::vector<memory::dim> M, N, K, lda, ldb, ldc;
+        std::vector<float> alpha, beta;
+        std::vector<std::vector<float>> a_data, b_data, c_data, c_ref;
+        for (const auto &p : problems) {
+            transa.push_back(p.transa);
+            transb.push_back(p.transb);
+            M.push_back(p.M);
+            N.push_back(p.N);
+            K.push_back(p.K);
+            alpha.push_back(p.alpha);
+            beta.push_back(p.beta);
+
+            // row-major storage with some padding of the leading dimensions
+            const auto a_rows = is_trans(p.transa) ? p.K : p.M;
+            const auto a_cols = is_trans(p.transa) ? p.M : p.K;
+            const auto b_rows = is_trans(p.transb) ? p.N : p.K;
+            const auto b_cols = is_trans(p.transb) ? p.K : p.N;
+            lda.push_back(a_cols + 3);
+            ldb.push_back(b_cols + 1);
+            ldc.push_back(p.N + 2);
+
+            a_data.emplace_back(a_rows * lda.back() + 1);
+            b_data.emplace_back(b_rows * ldb.back() + 1);
+            c_data.emplace_back(p.M * ldc.back() + 1);
+            fill(a_data.back(), 1);
+            fill(b_data.back(), 2);
+            fill(c_data.back(), 3);
+            c_ref.push_back(c_data.back());
+        }
+
+        std::vector<const float *> A, B;
+        std::vector<float *> C;
+        for (memory::dim g = 0; g < ngroups; g++) {
+            A.push_back(a_data[g].data());
+            B.push_back(b_data[g].data());
+            C.push_back(c_data[g].data());
+            compute_ref(problems[g], a_data[g].data(), lda[g],
+                    b_data[g].data(), ldb[g], c_ref[g].data(), ldc[g]);
+        }
+
+        ASSERT_EQ(sgemm_grouped(ngroups, transa.data(), transb.data(),
+                          M.data(), N.data(), K.data(), alpha.data(),
+                          A.data(), lda.data(), B.data(), ldb.data(),
+                          beta.data(), C.data(), ldc.data()),
+                status::success);
+
+        for (memory::dim g = 0; g < ngroups; g++) {
+            // the padding must stay untouched
+            const float eps = 1e-5f * std::max(problems[g].K, memory::dim(1));
+            for (size_t i = 0; i < c_ref[g].size(); i++)
+                ASSERT_NEAR(c_data[g][i], c_ref[g][i], eps);
+        }
+    }
+
+    static void fill(std::vector<float> &v, int seed) {
+        for (size_t i = 0; i < v.size(); i++)
+            v[i] = (float)((i * 7 + seed * 13) % 11) / 8.f - 0.5f;
+    }
+
+    static void compute_ref(const sgemm_grouped_problem_t &p, const float *a,
+            memory::dim lda, const float *b, memory::dim ldb, float *c,
+            memory::dim ldc) {
+        for_(memory::dim m = 0; m < p.M; m++)
+        for (memory::dim n = 0; n < p.N; n++) {
+            float acc = 0.f;
+            for (memory::dim k = 0; k < p.K; k++) {
+                const float a_mk = is_trans(p.transa) ? a[k * lda + m]
+                                                      : a[m * lda + k];
+                const float b_kn = is_trans(p.transb) ? b[n * ldb + k]
+                                                      : b[k * ldb + n];
+                acc += a_mk * b_kn;
+            }
+            float &dst = c[m * ldc + n];
+            dst = p.alpha * acc + (p.beta == 0.f ? 0.f : p.beta * dst);
+        }
+    }
+};
+
+TEST_P(sgemm_grouped_test_t, TestsSgemmGrouped) {}
+
+INSTANTIATE_TEST_SUITE_P(TestSgemmGroupedEmpty, sgemm_grouped_test_t,
+        ::testing::Values(std::vector<sgemm_grouped_problem_t> {},
+                std::vector<sgemm_grouped_problem_t> {
+                        {'N', 'N', 0, 10, 10, 1.f, 0.f},
+                        {'N', 'N', 10, 0, 10, 1.f, 0.f}}));
+
+// attention-like ragged batches: the same head size with various lengths
+INSTANTIATE_TEST_SUITE_P(TestSgemmGroupedRagged, sgemm_grouped_test_t,
+        ::testing::Values(
+                std::vector<sgemm_grouped_problem_t> {
+                        {'N', 'T', 128, 128, 64, 0.125f, 0.f},
+                        {'N', 'T', 7, 7, 64, 0.125f, 0.f},
+                        {'N', 'T', 45, 45, 64, 0.125f, 0.f},
+                        {'N', 'T', 1, 1, 64, 0.125f, 0.f}},
+                std::vector<sgemm_grouped_problem_t> {
+                        {'N', 'N', 300, 64, 300, 1.f, 0.f},
+                        {'N', 'N', 17, 64, 17, 1.f, 0.f},
+                        {'N', 'N', 4, 64, 4, 1.f, 0.f}}));
+
+INSTANTIATE_TEST_SUITE_P(TestSgemmGroupedMixed, sgemm_grouped_test_t,
+        ::testing::Values(std::vector<sgemm_grouped_problem_t> {
+                {'N', 'N', 30, 20, 10, 1.f, 1.f},
+                {'T', 'N', 257, 33, 100, 2.f, 0.5f},
+                {'N', 'T', 5, 600, 3, 1.f, 0.f},
+                {'T', 'T', 64, 64, 1, -1.f, 2.f},
+                {'N', 'N', 16, 16, 0, 1.f, 3.f},
+                {'N', 'N', 1000, 1, 50, 0.5f, 0.f}}));
+
+TEST(sgemm_grouped_test_t, TestSgemmGroupedInvalidArguments) {
+    SKIP_IF(get_test_engine_kind() == engine::kind::gpu,
+            "GPU GEMM not implemented.");
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_SYCL
+    SKIP_IF(get_test_engine_kind() == engine::kind::cpu,
+            "SYCL CPU GEMM not implemented.");
+#endif
+    const char trans[] = {'N', 'P'};
+    const memory::dim dims[] = {4, 4}, small_ld[] = {2, 2};
+    const float alpha[] = {1.f, 1.f}, beta[] = {0.f, 0.f};
+    std::vector<float> buf(16);
+    const float *AB[] = {buf.data(), buf.data()};
+    float *C[] = {buf.data(), buf.data()};
+
+    ASSERT_EQ(sgemm_grouped(-1, trans, trans, dims, dims, dims, alpha, AB,
+                      dims, AB, dims, beta, C, dims),
+            status::invalid_arguments);
+    ASSERT_EQ(sgemm_grouped(1, trans, trans, dims, dims, dims, alpha, AB,
+                      small_ld, AB, dims, beta, C, dims),
+            status::invalid_arguments);
+    // packed matrices are not supported
+    ASSERT_EQ(sgemm_grouped(2, trans, trans, dims, dims, dims, alpha, AB,
+                      dims, AB, dims, beta, C, dims),
+            status::invalid_arguments);
+}
+
+} // namespace dnnl
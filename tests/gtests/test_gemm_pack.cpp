@@ -0,0 +1,228 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+namespace dnnl {
+
+struct gemm_pack_params_t {
+    char identifier;
+    char transa, transb;
+    memory::dim M, N, K;
+    float beta;
+    char offsetc;
+};
+
+// The matrices hold small integers, so that they are exact in every data
+// type and the packed results can be compared with the reference exactly.
+class gemm_pack_test_t : public ::testing::TestWithParam<gemm_pack_params_t> {
+protected:
+    void SetUp() override {
+        SKIP_IF(get_test_engine_kind() == engine::kind::gpu,
+                "GPU GEMM not implemented.");
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_SYCL
+        SKIP_IF(get_test_engine_kind() == engine::kind::cpu,
+                "SYCL CPU GEMM not implemented.");
+#endif
+        p = GetParam();
+        lda = is_trans(p.transa) ? p.M : p.K;
+        ldb = is_trans(p.transb) ? p.K : p.N;
+        ldc = p.N;
+        pack_a = p.identifier == 'A' || p.identifier == 'a';
+    }
+
+    static bool is_trans(char t) { return t == 'T' || t == 't'; }
+
+    template <typename T>
+    static std::vector<T> fill(memory::dim size, int mul, int add, int sub) {
+        std::vector<T> v(size);
+        for (memory::dim i = 0; i < size; i++)
+            v[i] = (T)((i * mul + add) % 7 - sub);
+        return v;
+    }
+
+    // f32 transpose flags of the compute call with a packed operand
+    char compute_transa() const { return pack_a ? 'P' : p.transa; }
+    char compute_transb() const { return pack_a ? p.transb : 'P'; }
+
+    template <typename T>
+    std::vector<T> packed(size_t size) const {
+        return std::vector<T>((size + sizeof(T) - 1) / sizeof(T));
+    }
+
+    // The packed matrix is reused by several computes with different
+    // non-packed matrices, as for the weights of an inference loop.
+    static constexpr int n_computes = 3;
+
+    gemm_pack_params_t p;
+    memory::dim lda, ldb, ldc;
+    bool pack_a;
+};
+
+TEST_P(gemm_pack_test_t, TestSgemmPack) {
+    size_t size = 0;
+    ASSERT_EQ(sgemm_pack_get_size(p.identifier, p.transa, p.transb, p.M, p.N,
+                      p.K, lda, ldb, &size),
+            status::success);
+
+    const auto a = fill<float>(p.M * p.K, 3, 1, 3);
+    const auto b = fill<float>(p.K * p.N, 5, 2, 3);
+    auto packed_buf = packed<float>(size);
+    ASSERT_EQ(sgemm_pack(p.identifier, p.transa, p.transb, p.M, p.N, p.K, lda,
+                      ldb, pack_a ? a.data() : b.data(), packed_buf.data()),
+            status::success);
+
+    for (int i = 0; i < n_computes; i++) {
+        auto other = fill<float>(pack_a ? p.K * p.N : p.M * p.K, 5, i, 3);
+        const float *pa = pack_a ? packed_buf.data() : other.data();
+        const float *pb = pack_a ? other.data() : packed_buf.data();
+        auto c = fill<float>(p.M * p.N, 1, i, 3);
+        auto ref = c;
+        ASSERT_EQ(sgemm(p.transa, p.transb, p.M, p.N, p.K, 1.f,
+                          pack_a ? a.data() : other.data(), lda,
+                          pack_a ? other.data() : b.data(), ldb, p.beta,
+                          ref.data(), ldc),
+                status::success);
+        ASSERT_EQ(sgemm_compute(compute_transa(), compute_transb(), p.M, p.N,
+                          p.K, pa, lda, pb, ldb, p.beta, c.data(), ldc),
+                status::success);
+        for (size_t j = 0; j < c.size(); j++)
+            ASSERT_EQ(c[j], ref[j]);
+    }
+}
+
+TEST_P(gemm_pack_test_t, TestGemmBf16bf16f32Pack) {
+    size_t size = 0;
+    const auto st = gemm_bf16bf16f32_pack_get_size(p.identifier, p.transa,
+            p.transb, p.M, p.N, p.K, lda, ldb, &size);
+    SKIP_IF(st == status::unimplemented, "bf16 packing is not supported.");
+    ASSERT_EQ(st, status::success);
+
+    // bf16 is the upper half of the f32 representation
+    auto to_bf16 = [](const std::vector<float> &v) {
+        std::vector<uint16_t> res(v.size());
+        for (size_t i = 0; i < v.size(); i++) {
+            uint32_t bits;
+            std::memcpy(&bits, &v[i], sizeof(bits));
+            res[i] = (uint16_t)(bits >> 16);
+        }
+        return res;
+    };
+
+    const auto a = fill<float>(p.M * p.K, 3, 1, 3);
+    const auto b = fill<float>(p.K * p.N, 5, 2, 3);
+    const auto a_bf16 = to_bf16(a), b_bf16 = to_bf16(b);
+    auto packed_buf = packed<uint16_t>(size);
+    ASSERT_EQ(gemm_bf16bf16f32_pack(p.identifier, p.transa, p.transb, p.M,
+                      p.N, p.K, lda, ldb,
+                      pack_a ? a_bf16.data() : b_bf16.data(),
+                      packed_buf.data()),
+            status::success);
+
+    for (int i = 0; i < n_computes; i++) {
+        const auto other = fill<float>(pack_a ? p.K * p.N : p.M * p.K, 5, i, 3);
+        const auto other_bf16 = to_bf16(other);
+        auto c = fill<float>(p.M * p.N, 1, i, 3);
+        auto ref = c;
+        ASSERT_EQ(sgemm(p.transa, p.transb, p.M, p.N, p.K, 1.f,
+                          pack_a ? a.data() : other.data(), lda,
+                          pack_a ? other.data() : b.data(), ldb, p.beta,
+                          ref.data(), ldc),
+                status::success);
+        ASSERT_EQ(gemm_bf16bf16f32_compute(compute_transa(), compute_transb(),
+                          p.M, p.N, p.K,
+                          pack_a ? packed_buf.data() : other_bf16.data(), lda,
+                          pack_a ? other_bf16.data() : packed_buf.data(), ldb,
+                          p.beta, c.data(), ldc),
+                status::success);
+        for (size_t j = 0; j < c.size(); j++)
+            ASSERT_EQ(c[j], ref[j]);
+    }
+}
+
+TEST_P(gemm_pack_test_t, TestGemmU8s8s32Pack) {
+    size_t size = 0;
+    ASSERT_EQ(gemm_u8s8s32_pack_get_size(p.identifier, p.transa, p.transb,
+                      p.M, p.N, p.K, lda, ldb, &size),
+            status::success);
+
+    const auto a = fill<uint8_t>(p.M * p.K, 3, 1, 0);
+    const auto b = fill<int8_t>(p.K * p.N, 5, 2, 3);
+    const auto co = fill<int32_t>(std::max(p.M, p.N), 1, 0, 3);
+    auto packed_buf = packed<int8_t>(size);
+    ASSERT_EQ(gemm_u8s8s32_pack(p.identifier, p.transa, p.transb, p.M, p.N,
+                      p.K, lda, ldb,
+                      pack_a ? (const void *)a.data() : (const void *)b.data(),
+                      packed_buf.data()),
+            status::success);
+
+    for (int i = 0; i < n_computes; i++) {
+        const auto other_a = fill<uint8_t>(p.M * p.K, 5, i, 0);
+        const auto other_b = fill<int8_t>(p.K * p.N, 5, i, 3);
+        const uint8_t *ref_a = pack_a ? a.data() : other_a.data();
+        const int8_t *ref_b = pack_a ? other_b.data() : b.data();
+        auto c = fill<int32_t>(p.M * p.N, 1, i, 3);
+        auto ref = c;
+        ASSERT_EQ(gemm_u8s8s32(p.transa, p.transb, p.offsetc, p.M, p.N, p.K,
+                          1.f, ref_a, lda, 0, ref_b, ldb, 0, p.beta,
+                          ref.data(), ldc, co.data()),
+                status::success);
+        ASSERT_EQ(gemm_u8s8s32_compute(compute_transa(), compute_transb(),
+                          p.offsetc, p.M, p.N, p.K,
+                          pack_a ? (const void *)packed_buf.data() : ref_a,
+                          lda,
+                          pack_a ? (const void *)ref_b : packed_buf.data(),
+                          ldb, p.beta, c.data(), ldc, co.data()),
+                status::success);
+        for (size_t j = 0; j < c.size(); j++)
+            ASSERT_EQ(c[j], ref[j]);
+    }
+}
+
+// {identifier, transa, transb, M, N, K, beta, offsetc}
+INSTANTIATE_TEST_SUITE_P(TestGemmPack, gemm_pack_test_t,
+        ::testing::Values(gemm_pack_params_t {'B', 'N', 'N', 1, 64, 32, 0.f,
+                                  'F'},
+                gemm_pack_params_t {'B', 'N', 'T', 16, 100, 70, 1.f, 'R'},
+                gemm_pack_params_t {'b', 'T', 'N', 35, 48, 129, 0.5f, 'C'},
+                gemm_pack_params_t {'A', 'N', 'N', 64, 3, 50, 0.f, 'C'},
+                gemm_pack_params_t {'a', 'T', 'T', 100, 20, 17, 2.f, 'F'},
+                gemm_pack_params_t {'B', 'N', 'N', 200, 300, 400, 1.f, 'R'}));
+
+TEST(gemm_pack_test_t, TestGemmPackInvalidArguments) {
+    SKIP_IF(get_test_engine_kind() == engine::kind::gpu,
+            "GPU GEMM not implemented.");
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_SYCL
+    SKIP_IF(get_test_engine_kind() == engine::kind::cpu,
+            "SYCL CPU GEMM not implemented.");
+#endif
+    size_t size = 0;
+    ASSERT_EQ(sgemm_pack_get_size('C', 'N', 'N', 4, 4, 4, 4, 4, &size),
+            status::invalid_arguments);
+    ASSERT_EQ(sgemm_pack_get_size('A', 'N', 'N', 4, 4, 4, 2, 4, &size),
+            status::invalid_arguments);
+    ASSERT_EQ(sgemm_pack_get_size('A', 'N', 'N', 4, 4, 4, 4, 4, nullptr),
+            status::invalid_arguments);
+}
+
+} // namespace dnnl
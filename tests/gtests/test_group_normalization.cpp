@@ -0,0 +1,250 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+namespace dnnl {
+
+struct group_normalization_test_params_t {
+    prop_kind aprop_kind;
+    memory::format_tag data_tag;
+    memory::dims dims; // N, C, H, W
+    memory::dim groups;
+    normalization_flags flags;
+    bool with_swish;
+    bool expect_to_fail;
+    dnnl_status_t expected_status;
+};
+
+class group_normalization_test_t
+    : public ::testing::TestWithParam<group_normalization_test_params_t> {
+private:
+    group_normalization_test_params_t p;
+
+protected:
+    void SetUp() override {
+        p = ::testing::TestWithParam<
+                group_normalization_test_params_t>::GetParam();
+
+        SKIP_IF(get_test_engine().get_kind() != engine::kind::cpu,
+                "Engine does not support this primitive.");
+
+        catch_expected_failures(
+                [=]() { Test(); }, p.expect_to_fail, p.expected_status);
+    }
+
+    void Test() {
+        using op_desc_t = group_normalization_forward::desc;
+        using pd_t = group_normalization_forward::primitive_desc;
+        using dt = memory::data_type;
+        allows_attr_t aa {false};
+        aa.po_eltwise = true;
+
+        auto eng = get_test_engine();
+        auto strm = make_stream(eng);
+
+        const memory::dim N = p.dims[0], C = p.dims[1], H = p.dims[2],
+                          W = p.dims[3];
+        const memory::dim G = p.groups, CG = C / G;
+        const float eps = 1e-3f;
+        const bool use_ss
+                = (bool)(p.flags & normalization_flags::use_scale_shift);
+        const bool use_global_stats
+                = (bool)(p.flags & normalization_flags::use_global_stats);
+        const bool save_stats = !use_global_stats
+                && p.aprop_kind == prop_kind::forward_training;
+
+        auto data_md = memory::desc(p.dims, dt::f32, p.data_tag);
+        auto op_desc = op_desc_t(p.aprop_kind, data_md, G, eps, p.flags);
+
+        primitive_attr attr;
+        if (p.with_swish) {
+            post_ops ops;
+            ops.append_eltwise(1.f, algorithm::eltwise_swish, 1.f, 0.f);
+            attr.set_post_ops(ops);
+        }
+
+        auto pd = pd_t();
+        ASSERT_NO_THROW(pd = pd_t(op_desc, attr, eng));
+        test_fwd_pd_constructors<op_desc_t, pd_t>(op_desc, pd, aa);
+
+        auto prim = group_normalization_forward();
+        prim = group_normalization_forward(pd);
+
+        ASSERT_TRUE(
+                pd.query_md(query::exec_arg_md, DNNL_ARG_SRC) == pd.src_desc());
+        ASSERT_TRUE(
+                pd.query_md(query::exec_arg_md, DNNL_ARG_DST) == pd.dst_desc());
+
+        auto mem_src = test::make_memory(pd.src_desc(), eng);
+        auto mem_dst = test::make_memory(pd.dst_desc(), eng);
+        auto mem_mean = test::make_memory(pd.mean_desc(), eng);
+        auto mem_var = test::make_memory(pd.variance_desc(), eng);
+        auto mem_ss = test::make_memory(pd.weights_desc(), eng);
+
+        // Offsets are computed from the tag rather than through the memory
+        // descriptor to keep the reference independent of the library
+        const bool is_nhwc = p.data_tag == memory::format_tag::nhwc;
+        auto off = [&](memory::dim n, memory::dim c, memory::dim h,
+                           memory::dim w) {
+            return is_nhwc ? ((n * H + h) * W + w) * C + c
+                           : ((n * C + c) * H + h) * W + w;
+        };
+        auto src_value = [&](memory::dim n, memory::dim c, memory::dim h,
+                                 memory::dim w) {
+            // A per group offset makes a one-pass variance imprecise enough
+            // to be noticed if cancellation is not handled
+            return 8.f + (float)((n * 7 + c * 5 + h * 3 + w) % 13) / 4.f;
+        };
+        auto scale_value = [&](memory::dim c) { return 0.5f + (c % 4) / 4.f; };
+        auto shift_value = [&](memory::dim c) { return (c % 3) / 2.f - 0.5f; };
+
+        {
+            auto src = map_memory<float>(mem_src);
+            for_(memory::dim n = 0; n < N; ++n)
+            for_(memory::dim c = 0; c < C; ++c)
+            for_(memory::dim h = 0; h < H; ++h)
+            for (memory::dim w = 0; w < W; ++w)
+                src[off(n, c, h, w)] = src_value(n, c, h, w);
+        }
+        if (use_ss) {
+            auto ss = map_memory<float>(mem_ss);
+            for (memory::dim c = 0; c < C; ++c) {
+                ss[c] = scale_value(c);
+                ss[C + c] = shift_value(c);
+            }
+        }
+
+        // Reference statistics, computed in two passes
+        std::vector<float> ref_mean(N * G), ref_var(N * G);
+        for_(memory::dim n = 0; n < N; ++n)
+        for (memory::dim g = 0; g < G; ++g) {
+            double sum = 0, sq = 0;
+            const double cnt = (double)CG * H * W;
+            for_(memory::dim c = g * CG; c < (g + 1) * CG; ++c)
+            for_(memory::dim h = 0; h < H; ++h)
+            for (memory::dim w = 0; w < W; ++w)
+                sum += src_value(n, c, h, w);
+            const double m = sum / cnt;
+            for_(memory::dim c = g * CG; c < (g + 1) * CG; ++c)
+            for_(memory::dim h = 0; h < H; ++h)
+            for (memory::dim w = 0; w < W; ++w) {
+                const double d = src_value(n, c, h, w) - m;
+                sq += d * d;
+            }
+            ref_mean[n * G + g] = (float)m;
+            ref_var[n * G + g] = (float)(sq / cnt);
+        }
+        if (use_global_stats) {
+            // Shift the provided statistics to make sure they are used
+            auto mean = map_memory<float>(mem_mean);
+            auto var = map_memory<float>(mem_var);
+            for (memory::dim i = 0; i < N * G; ++i) {
+                ref_mean[i] += 0.25f;
+                ref_var[i] *= 2.f;
+                mean[i] = ref_mean[i];
+                var[i] = ref_var[i];
+            }
+        }
+
+        std::unordered_map<int, memory> args = {
+                {DNNL_ARG_SRC, mem_src}, {DNNL_ARG_DST, mem_dst}};
+        if (use_global_stats || save_stats) {
+            args.insert({DNNL_ARG_MEAN, mem_mean});
+            args.insert({DNNL_ARG_VARIANCE, mem_var});
+        }
+        if (use_ss) args.insert({DNNL_ARG_SCALE_SHIFT, mem_ss});
+        prim.execute(strm, args);
+        strm.wait();
+
+        if (save_stats) {
+            auto mean = map_memory<float>(mem_mean);
+            auto var = map_memory<float>(mem_var);
+            for (memory::dim i = 0; i < N * G; ++i) {
+                ASSERT_NEAR(mean[i], ref_mean[i], 1e-5f * ref_mean[i]);
+                ASSERT_NEAR(var[i], ref_var[i], 1e-3f * ref_var[i]);
+            }
+        }
+
+        auto dst = map_memory<float>(mem_dst);
+        for_(memory::dim n = 0; n < N; ++n)
+        for_(memory::dim c = 0; c < C; ++c)
+        for_(memory::dim h = 0; h < H; ++h)
+        for (memory::dim w = 0; w < W; ++w) {
+            const memory::dim g = c / CG;
+            const float m = ref_mean[n * G + g];
+            const float v = ref_var[n * G + g];
+            float ref = (src_value(n, c, h, w) - m) / std::sqrt(v + eps);
+            if (use_ss) ref = scale_value(c) * ref + shift_value(c);
+            if (p.with_swish) ref = ref / (1.f + std::exp(-ref));
+            ASSERT_NEAR(dst[off(n, c, h, w)], ref, 1e-4f * (1 + std::abs(ref)));
+        }
+    }
+};
+
+using tag = memory::format_tag;
+using flags = normalization_flags;
+
+static auto expected_failures = []() {
+    return ::testing::Values(
+            // groups do not divide channels
+            group_normalization_test_params_t {prop_kind::forward_training,
+                    tag::nhwc, {2, 12, 3, 3}, 5, flags::none, false, true,
+                    dnnl_invalid_arguments},
+            // zero groups
+            group_normalization_test_params_t {prop_kind::forward_training,
+                    tag::nchw, {2, 12, 3, 3}, 0, flags::none, false, true,
+                    dnnl_invalid_arguments});
+};
+
+static auto simple_cases = []() {
+    return ::testing::Values(
+            group_normalization_test_params_t {prop_kind::forward_training,
+                    tag::nhwc, {2, 32, 5, 7}, 4, flags::none, false},
+            group_normalization_test_params_t {prop_kind::forward_training,
+                    tag::nhwc, {2, 64, 4, 4}, 8, flags::use_scale_shift,
+                    false},
+            // channels that are not a vector multiple
+            group_normalization_test_params_t {prop_kind::forward_inference,
+                    tag::nhwc, {3, 20, 3, 5}, 5, flags::use_scale_shift,
+                    false},
+            // fused SiLU
+            group_normalization_test_params_t {prop_kind::forward_inference,
+                    tag::nhwc, {2, 40, 6, 6}, 4, flags::use_scale_shift,
+                    true},
+            group_normalization_test_params_t {prop_kind::forward_inference,
+                    tag::nhwc, {2, 16, 3, 3}, 2,
+                    flags::use_global_stats | flags::use_scale_shift, true},
+            group_normalization_test_params_t {prop_kind::forward_training,
+                    tag::nchw, {2, 12, 5, 5}, 3, flags::use_scale_shift,
+                    true},
+            group_normalization_test_params_t {prop_kind::forward_inference,
+                    tag::nchw, {1, 6, 4, 4}, 6, flags::use_global_stats,
+                    false});
+};
+
+TEST_P(group_normalization_test_t, TestsGroupNormalization) {}
+INSTANTIATE_TEST_SUITE_P(TestGroupNormalizationEF, group_normalization_test_t,
+        expected_failures());
+INSTANTIATE_TEST_SUITE_P(TestGroupNormalizationSimple,
+        group_normalization_test_t, simple_cases());
+
+} // namespace dnnl
@@ -14,6 +14,8 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
+
 #include "dnnl_test_common.hpp"
 #include "gtest/gtest.h"
 
@@ -96,6 +98,46 @@ HANDLE_EXCEPTIONS_FOR_TEST_F(attr_test_t, TestScratchpadArg) {
     }
 }
 
+HANDLE_EXCEPTIONS_FOR_TEST_F(attr_test_t, TestStreamScratchpad) {
+    engine eng = get_test_engine();
+
+    const memory::dim N = 2, C = 16, W = 2;
+
+    dnnl::primitive_attr attr;
+    attr.set_scratchpad_mode(scratchpad_mode::user);
+
+    // Primitives of different shapes share the scratchpad attached to the
+    // stream
+    std::vector<softmax_forward::primitive_desc> pds;
+    memory::dim max_scratchpad_size = 0;
+    for (memory::dim c : {C, 2 * C}) {
+        memory::desc data_md(
+                {N, c, W}, memory::data_type::f32, memory::format_tag::nwc);
+        auto softmax_d = softmax_forward::desc(
+                prop_kind::forward_inference, data_md, 1);
+        pds.emplace_back(softmax_d, attr, eng);
+        max_scratchpad_size = std::max(max_scratchpad_size,
+                (memory::dim)pds.back().scratchpad_desc().get_size());
+    }
+
+    memory::desc scratchpad_md({std::max(max_scratchpad_size, (memory::dim)1)},
+            memory::data_type::u8, memory::format_tag::x);
+    auto scratchpad = test::make_memory(scratchpad_md, eng);
+
+    stream s(eng);
+    s.set_scratchpad(scratchpad);
+    for (const auto &pd : pds) {
+        auto src = test::make_memory(pd.src_desc(), eng);
+        auto dst = test::make_memory(pd.dst_desc(), eng);
+        fill_data<float>(src.get_desc().get_size() / sizeof(float), src);
+
+        softmax_forward softmax_p(pd);
+        softmax_p.execute(s, {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, dst}});
+    }
+    s.wait();
+    s.reset_scratchpad();
+}
+
 HANDLE_EXCEPTIONS_FOR_TEST_F(attr_test_t, TestIntOutputScales) {
     dnnl::primitive_attr attr;
 
@@ -403,6 +445,350 @@ HANDLE_EXCEPTIONS_FOR_TEST_F(attr_test_t, DepthwiseFusionPostop) {
     ASSERT_EQ(scales_in, scales_out);
 }
 
+HANDLE_EXCEPTIONS_FOR_TEST_F(attr_test_t, PoolingPostop) {
+    dnnl::primitive_attr attr;
+    dnnl::post_ops ops;
+    algorithm alg;
+
+    ops.append_eltwise(1.f, algorithm::eltwise_relu, 0.f, 0.f);
+    ops.append_pooling_k2s2(algorithm::pooling_max);
+    attr.set_post_ops(ops);
+
+    ASSERT_EQ(attr.get_post_ops().len(), 2);
+    ASSERT_EQ(attr.get_post_ops().kind(1), primitive::kind::pooling);
+    attr.get_post_ops().get_params_pooling_k2s2(1, alg);
+    ASSERT_EQ(alg, algorithm::pooling_max);
+
+    EXPECT_ANY_THROW(ops.append_pooling_k2s2(algorithm::eltwise_relu));
+    EXPECT_ANY_THROW(attr.get_post_ops().get_params_pooling_k2s2(0, alg));
+}
+
+HANDLE_EXCEPTIONS_FOR_TEST_F(attr_test_t, PoolingFusion) {
+    auto engine_kind = get_test_engine_kind();
+    SKIP_IF(engine_kind != engine::kind::cpu,
+            "Pooling fusion is only supported on CPU engine");
+
+    engine e {engine_kind, 0};
+    stream s {e};
+
+    const memory::dim N = 2, IC = 32, OC = 48, H = 10, W = 14;
+    memory::desc src_md({N, IC, H, W}, memory::data_type::u8,
+            memory::format_tag::nhwc);
+    memory::desc wei_md(
+            {OC, IC, 3, 3}, memory::data_type::s8, memory::format_tag::any);
+    memory::desc dst_md({N, OC, H, W}, memory::data_type::f32,
+            memory::format_tag::nhwc);
+    auto cd = convolution_forward::desc(prop_kind::forward_inference,
+            algorithm::convolution_direct, src_md, wei_md, dst_md, {1, 1},
+            {1, 1}, {1, 1});
+
+    for (auto alg : {algorithm::pooling_max,
+                 algorithm::pooling_avg_exclude_padding}) {
+        dnnl::primitive_attr attr;
+        dnnl::post_ops ops;
+        ops.append_pooling_k2s2(alg);
+        attr.set_post_ops(ops);
+
+        convolution_forward::primitive_desc fused_pd;
+        try {
+            fused_pd = convolution_forward::primitive_desc(cd, attr, e);
+        } catch (error &err) {
+            SKIP_IF(err.status == dnnl_unimplemented,
+                    "Pooling fusion is not supported on this platform");
+            throw;
+        }
+        ASSERT_EQ(fused_pd.dst_desc().dims(),
+                memory::dims({N, OC, H / 2, W / 2}));
+
+        auto conv_pd = convolution_forward::primitive_desc(cd, e);
+        auto pool_d = pooling_forward::desc(prop_kind::forward_inference, alg,
+                conv_pd.dst_desc(), fused_pd.dst_desc(), {2, 2}, {2, 2},
+                {0, 0}, {0, 0});
+        auto pool_pd = pooling_forward::primitive_desc(pool_d, e);
+
+        memory src(src_md, e), wei(conv_pd.weights_desc(), e);
+        fill_data<uint8_t>(src_md.get_size(), src);
+        fill_data<int8_t>(wei.get_desc().get_size(), wei, 1., true);
+
+        memory conv_dst(conv_pd.dst_desc(), e);
+        memory ref_dst(pool_pd.dst_desc(), e);
+        memory dst(fused_pd.dst_desc(), e);
+
+        convolution_forward(conv_pd).execute(s,
+                {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                        {DNNL_ARG_DST, conv_dst}});
+        pooling_forward(pool_pd).execute(
+                s, {{DNNL_ARG_SRC, conv_dst}, {DNNL_ARG_DST, ref_dst}});
+        convolution_forward(fused_pd).execute(s,
+                {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                        {DNNL_ARG_DST, dst}});
+        s.wait();
+
+        compare_data<float>(ref_dst, dst);
+    }
+}
+
+HANDLE_EXCEPTIONS_FOR_TEST_F(attr_test_t, TestSrcConcat) {
+    dnnl::primitive_attr attr;
+    std::vector<memory::dim> channels;
+
+    attr.get_src_concat(channels);
+    ASSERT_TRUE(channels.empty());
+
+    attr.set_src_concat({32, 16});
+    attr.get_src_concat(channels);
+    ASSERT_EQ(channels, std::vector<memory::dim>({32, 16}));
+
+    EXPECT_ANY_THROW(attr.set_src_concat({32, 0}));
+
+    attr.set_src_concat({});
+    attr.get_src_concat(channels);
+    ASSERT_TRUE(channels.empty());
+}
+
+HANDLE_EXCEPTIONS_FOR_TEST_F(attr_test_t, SrcConcatConvolution) {
+    auto engine_kind = get_test_engine_kind();
+    SKIP_IF(engine_kind != engine::kind::cpu,
+            "Source concat is only supported on CPU engine");
+
+    engine e {engine_kind, 0};
+    stream s {e};
+
+    const memory::dim N = 2, OC = 32, H = 7, W = 7;
+    const std::vector<memory::dim> channels {32, 16, 48};
+    const memory::dim IC = 32 + 16 + 48;
+    const auto tag = memory::format_tag::nChw16c;
+    const auto dt = memory::data_type::f32;
+
+    memory::desc src_md({N, IC, H, W}, dt, tag);
+    memory::desc wei_md({OC, IC, 1, 1}, dt, memory::format_tag::any);
+    memory::desc dst_md({N, OC, H, W}, dt, tag);
+    auto cd = convolution_forward::desc(prop_kind::forward_inference,
+            algorithm::convolution_direct, src_md, wei_md, dst_md, {1, 1},
+            {0, 0}, {0, 0});
+
+    dnnl::primitive_attr attr;
+    attr.set_src_concat(channels);
+    convolution_forward::primitive_desc concat_pd;
+    try {
+        concat_pd = convolution_forward::primitive_desc(cd, attr, e);
+    } catch (error &err) {
+        SKIP_IF(err.status == dnnl_unimplemented,
+                "Source concat is not supported on this platform");
+        throw;
+    }
+
+    // the sources, and their concatenation for the reference convolution
+    std::vector<memory::desc> part_mds;
+    std::unordered_map<int, memory> concat_args, conv_args;
+    for (size_t i = 0; i < channels.size(); ++i) {
+        const int arg = DNNL_ARG_MULTIPLE_SRC + (int)i;
+        part_mds.push_back(concat_pd.query_md(query::exec_arg_md, arg));
+        ASSERT_EQ(part_mds.back(),
+                memory::desc({N, channels[i], H, W}, dt, tag));
+        memory part(part_mds.back(), e);
+        fill_data<float>(part_mds.back().get_size() / sizeof(float), part);
+        concat_args.insert({arg, part});
+        conv_args.insert({arg, part});
+    }
+    memory src(src_md, e);
+    concat_args.insert({DNNL_ARG_DST, src});
+    concat(concat::primitive_desc(src_md, 1, part_mds, e))
+            .execute(s, concat_args);
+
+    auto conv_pd = convolution_forward::primitive_desc(cd, e);
+    memory user_wei({{OC, IC, 1, 1}, dt, memory::format_tag::oihw}, e);
+    fill_data<float>(OC * IC, user_wei);
+    memory ref_wei(conv_pd.weights_desc(), e);
+    memory wei(concat_pd.weights_desc(), e);
+    reorder(user_wei, ref_wei).execute(s, user_wei, ref_wei);
+    reorder(user_wei, wei).execute(s, user_wei, wei);
+    memory ref_dst(dst_md, e), dst(dst_md, e);
+
+    convolution_forward(conv_pd).execute(s,
+            {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, ref_wei},
+                    {DNNL_ARG_DST, ref_dst}});
+    conv_args.insert({DNNL_ARG_WEIGHTS, wei});
+    conv_args.insert({DNNL_ARG_DST, dst});
+    convolution_forward(concat_pd).execute(s, conv_args);
+    s.wait();
+
+    compare_data<float>(ref_dst, dst);
+}
+
+HANDLE_EXCEPTIONS_FOR_TEST_F(attr_test_t, TestDropout) {
+    dnnl::primitive_attr attr;
+    bool enabled = true, with_mask = true;
+
+    attr.get_dropout(enabled, with_mask);
+    ASSERT_FALSE(enabled);
+    ASSERT_FALSE(with_mask);
+
+    attr.set_dropout(true, true);
+    attr.get_dropout(enabled, with_mask);
+    ASSERT_TRUE(enabled);
+    ASSERT_TRUE(with_mask);
+
+    EXPECT_ANY_THROW(attr.set_dropout(false, true));
+
+    attr.set_dropout(false);
+    attr.get_dropout(enabled, with_mask);
+    ASSERT_FALSE(enabled);
+    ASSERT_FALSE(with_mask);
+}
+
+HANDLE_EXCEPTIONS_FOR_TEST_F(attr_test_t, DropoutEltwiseBinary) {
+    auto engine_kind = get_test_engine_kind();
+    SKIP_IF(engine_kind != engine::kind::cpu,
+            "Dropout is only supported on CPU engine");
+
+    engine e {engine_kind, 0};
+    stream s {e};
+
+    // an odd number of elements, so that the mask has a partial byte
+    const memory::dims dims {3, 37, 11, 13};
+    const memory::dim nelems = 3 * 37 * 11 * 13;
+    const auto dt = memory::data_type::f32;
+    const memory::desc md(dims, dt, memory::format_tag::nchw);
+    const float p = 0.3f, scale = 1.f / (1.f - p);
+
+    memory prob({{1}, dt, memory::format_tag::x}, e);
+    memory seed({{1}, memory::data_type::s32, memory::format_tag::x}, e);
+    auto set_params = [&](float p_val, int seed_val) {
+        map_memory<float>(prob)[0] = p_val;
+        map_memory<int>(seed)[0] = seed_val;
+    };
+
+    memory src(md, e), zero(md, e);
+    fill_data<float>(nelems, src);
+    {
+        auto z = map_memory<float>(zero);
+        for (memory::dim i = 0; i < nelems; ++i)
+            z[i] = 0.f;
+    }
+
+    dnnl::primitive_attr attr;
+    attr.set_dropout(true, true);
+    auto relu_pd = eltwise_forward::primitive_desc(
+            {prop_kind::forward_training, algorithm::eltwise_relu, md, 0.f},
+            attr, e);
+    const auto mask_md
+            = relu_pd.query_md(query::exec_arg_md, DNNL_ARG_ATTR_DROPOUT_MASK);
+    ASSERT_EQ(mask_md,
+            memory::desc({(nelems + 7) / 8}, memory::data_type::u8,
+                    memory::format_tag::x));
+
+    memory dst(md, e), mask(mask_md, e);
+    auto run_relu = [&](float p_val, int seed_val) {
+        set_params(p_val, seed_val);
+        eltwise_forward(relu_pd).execute(s,
+                {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, dst},
+                        {DNNL_ARG_ATTR_DROPOUT_PROBABILITY, prob},
+                        {DNNL_ARG_ATTR_DROPOUT_SEED, seed},
+                        {DNNL_ARG_ATTR_DROPOUT_MASK, mask}});
+        s.wait();
+    };
+
+    auto is_kept = [](const uint8_t *m, memory::dim i) {
+        return ((m[i / 8] >> (i % 8)) & 1) != 0;
+    };
+
+    // the kept elements are scaled and match the mask, and their share is
+    // close to 1 - p
+    run_relu(p, 42);
+    std::vector<uint8_t> mask_42;
+    {
+        auto s_ptr = map_memory<float>(src);
+        auto d_ptr = map_memory<float>(dst);
+        auto m_ptr = map_memory<uint8_t>(mask);
+        memory::dim n_kept = 0;
+        for (memory::dim i = 0; i < nelems; ++i) {
+            const bool kept = is_kept(m_ptr, i);
+            const float relu = s_ptr[i] > 0.f ? s_ptr[i] : 0.f;
+            ASSERT_NEAR(d_ptr[i], kept ? relu * scale : 0.f, 1e-6f);
+            n_kept += kept;
+        }
+        ASSERT_NEAR((float)n_kept / nelems, 1.f - p, 0.02f);
+        const uint8_t *m = m_ptr;
+        mask_42.assign(m, m + mask_md.get_size());
+    }
+
+    // the same seed gives the same mask, another one a different mask
+    run_relu(p, 42);
+    {
+        auto m_ptr = map_memory<uint8_t>(mask);
+        ASSERT_TRUE(std::equal(mask_42.begin(), mask_42.end(), &m_ptr[0]));
+    }
+    run_relu(p, 43);
+    {
+        auto m_ptr = map_memory<uint8_t>(mask);
+        ASSERT_FALSE(std::equal(mask_42.begin(), mask_42.end(), &m_ptr[0]));
+    }
+
+    // nothing is dropped with p = 0 and everything with p = 1
+    for (float p_val : {0.f, 1.f}) {
+        run_relu(p_val, 42);
+        auto m_ptr = map_memory<uint8_t>(mask);
+        for (memory::dim i = 0; i < nelems; ++i)
+            ASSERT_EQ(is_kept(m_ptr, i), p_val == 0.f);
+    }
+
+    // the binary primitive drops the same elements for the same seed
+    set_params(p, 42);
+    auto add_pd = binary::primitive_desc(
+            {algorithm::binary_add, md, md, md}, attr, e);
+    binary(add_pd).execute(s,
+            {{DNNL_ARG_SRC_0, src}, {DNNL_ARG_SRC_1, zero},
+                    {DNNL_ARG_DST, dst},
+                    {DNNL_ARG_ATTR_DROPOUT_PROBABILITY, prob},
+                    {DNNL_ARG_ATTR_DROPOUT_SEED, seed},
+                    {DNNL_ARG_ATTR_DROPOUT_MASK, mask}});
+    s.wait();
+    {
+        auto s_ptr = map_memory<float>(src);
+        auto d_ptr = map_memory<float>(dst);
+        auto m_ptr = map_memory<uint8_t>(mask);
+        ASSERT_TRUE(std::equal(mask_42.begin(), mask_42.end(), &m_ptr[0]));
+        for (memory::dim i = 0; i < nelems; ++i)
+            ASSERT_NEAR(d_ptr[i],
+                    is_kept(mask_42.data(), i) ? s_ptr[i] * scale : 0.f,
+                    1e-6f);
+    }
+
+    // the backward regenerates the mask from the seed
+    dnnl::primitive_attr bwd_attr;
+    bwd_attr.set_dropout(true);
+    auto relu_bwd_pd = eltwise_backward::primitive_desc(
+            {algorithm::eltwise_relu, md, md, 0.f}, bwd_attr, e, relu_pd);
+    memory diff_dst(md, e), diff_src(md, e);
+    fill_data<float>(nelems, diff_dst);
+    eltwise_backward(relu_bwd_pd)
+            .execute(s,
+                    {{DNNL_ARG_SRC, src}, {DNNL_ARG_DIFF_DST, diff_dst},
+                            {DNNL_ARG_DIFF_SRC, diff_src},
+                            {DNNL_ARG_ATTR_DROPOUT_PROBABILITY, prob},
+                            {DNNL_ARG_ATTR_DROPOUT_SEED, seed}});
+    s.wait();
+    {
+        auto s_ptr = map_memory<float>(src);
+        auto dd_ptr = map_memory<float>(diff_dst);
+        auto ds_ptr = map_memory<float>(diff_src);
+        for (memory::dim i = 0; i < nelems; ++i) {
+            const bool kept = is_kept(mask_42.data(), i);
+            ASSERT_NEAR(ds_ptr[i],
+                    kept && s_ptr[i] > 0.f ? dd_ptr[i] * scale : 0.f, 1e-6f);
+        }
+    }
+
+    // the mask is forward only, and other primitives reject the dropout
+    dnnl::primitive_attr mask_attr;
+    mask_attr.set_dropout(true, true);
+    EXPECT_ANY_THROW(eltwise_backward::primitive_desc(
+            {algorithm::eltwise_relu, md, md, 0.f}, mask_attr, e, relu_pd));
+    EXPECT_ANY_THROW(softmax_forward::primitive_desc(
+            {prop_kind::forward_training, md, 1}, attr, e));
+}
+
 HANDLE_EXCEPTIONS_FOR_TEST_F(attr_test_t, DepthwiseFusion) {
 
     auto engine_kind = get_test_engine_kind();
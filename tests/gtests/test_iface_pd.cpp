@@ -69,4 +69,16 @@ TEST_F(pd_test_t, ConvTestEmpty) {
     }
 }
 
+TEST_F(pd_test_t, ConvTestCostQueries) {
+    auto pd = convolution_forward::primitive_desc {
+            {prop_kind::forward_inference, algorithm::convolution_direct,
+                    dat_md, wht_md, dat_md, {1, 1}, {0, 0}, {0, 0}},
+            e};
+
+    // 2 * MB * OC * IC * OH * OW * KH * KW
+    ASSERT_EQ(pd.query_f64(query::flops_f64), 2.0 * 16 * 16 * 16 * 16 * 16);
+    ASSERT_EQ(pd.query_s64(query::bytes_moved_s64),
+            (memory::dim)(2 * dat_md.get_size() + wht_md.get_size()));
+}
+
 } // namespace dnnl
@@ -103,6 +103,89 @@ TEST(primitive_cache_test, TestCacheHit) {
     fill_primitive_cache(1);
     ASSERT_EQ(get_primitive_cache_size(), 1);
 }
+
+TEST(primitive_cache_test, TestStats) {
+    set_primitive_cache_capacity(0);
+    set_primitive_cache_capacity(2);
+    reset_primitive_cache_stats();
+
+    auto stats = get_primitive_cache_stats();
+    ASSERT_EQ(stats.hits, 0u);
+    ASSERT_EQ(stats.misses, 0u);
+    ASSERT_EQ(stats.evictions, 0u);
+
+    fill_primitive_cache(3);
+    fill_primitive_cache(1);
+    stats = get_primitive_cache_stats();
+    ASSERT_EQ(stats.misses, 4u);
+    ASSERT_EQ(stats.hits, 0u);
+    ASSERT_EQ(stats.evictions, 2u);
+
+    fill_primitive_cache(1);
+    stats = get_primitive_cache_stats();
+    ASSERT_EQ(stats.hits, 1u);
+    ASSERT_GT(stats.creation_time_ns, 0u);
+
+    reset_primitive_cache_stats();
+    stats = get_primitive_cache_stats();
+    ASSERT_EQ(stats.hits, 0u);
+    ASSERT_EQ(stats.misses, 0u);
+    ASSERT_EQ(stats.evictions, 0u);
+    ASSERT_EQ(stats.creation_time_ns, 0u);
+}
+
+TEST(primitive_cache_test, TestMemoryFootprint) {
+    using tag = memory::format_tag;
+    using dt = memory::data_type;
+
+    set_primitive_cache_capacity(0);
+    auto fp = get_primitive_cache_memory_footprint();
+    ASSERT_EQ(fp.total, 0u);
+
+    set_primitive_cache_capacity(8);
+    engine eng(get_test_engine_kind(), 0);
+    auto shuffle_d = shuffle_forward::desc(prop_kind::forward_inference,
+            {{2, 64, 4, 4}, dt::f32, tag::nchw}, 1, 4);
+    auto shuffle = shuffle_forward(
+            shuffle_forward::primitive_desc(shuffle_d, eng));
+
+    auto p_fp = shuffle.get_memory_footprint();
+    ASSERT_EQ(p_fp.total, p_fp.constant + p_fp.jit_code + p_fp.scratchpad);
+    // CPU shuffle implementations keep a table of the channel offsets
+    if (get_test_engine_kind() == engine::kind::cpu) {
+        ASSERT_GT(p_fp.constant, 0u);
+    }
+
+    fp = get_primitive_cache_memory_footprint();
+    ASSERT_EQ(fp.total, fp.constant + fp.jit_code);
+    ASSERT_GE(fp.constant, p_fp.constant);
+    ASSERT_EQ(fp.scratchpad, 0u);
+
+    set_primitive_cache_capacity(0);
+    fp = get_primitive_cache_memory_footprint();
+    ASSERT_EQ(fp.total, 0u);
+}
+
+TEST(primitive_cache_test, TestMemoryCapacity) {
+    ASSERT_EQ(get_primitive_cache_capacity_mb(), 0);
+    ASSERT_EQ(dnnl_set_primitive_cache_capacity_mb(-1),
+            dnnl_invalid_arguments);
+
+    set_primitive_cache_capacity(0);
+    set_primitive_cache_capacity(16);
+    set_primitive_cache_capacity_mb(1);
+    ASSERT_EQ(get_primitive_cache_capacity_mb(), 1);
+
+    fill_primitive_cache(8);
+    auto fp = get_primitive_cache_memory_footprint();
+    ASSERT_LE(fp.total, 1u << 20);
+    // The entries hold much less than the limit, so none is evicted
+    ASSERT_EQ(get_primitive_cache_size(), 8);
+
+    set_primitive_cache_capacity_mb(0);
+    ASSERT_EQ(get_primitive_cache_capacity_mb(), 0);
+    ASSERT_EQ(get_primitive_cache_size(), 8);
+}
 #endif
 
 } // namespace dnnl
@@ -0,0 +1,183 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+namespace dnnl {
+
+using dt = memory::data_type;
+using tag = memory::format_tag;
+
+class sparse_weights_test_t : public ::testing::Test {
+protected:
+    engine eng = get_test_engine();
+    stream strm = stream(eng);
+
+    // fills a dense matrix so that about a half of its blocks are zero
+    void fill_blocks(const memory &mem, const memory::dims &block_dims) {
+        const auto dims = mem.get_desc().dims();
+        auto ptr = map_memory<float>(mem);
+        for (memory::dim i0 = 0; i0 < dims[0]; ++i0) {
+            for (memory::dim i1 = 0; i1 < dims[1]; ++i1) {
+                const auto b0 = i0 / block_dims[0], b1 = i1 / block_dims[1];
+                const bool is_zero = (b0 * 7 + b1 * 3) % 2 == 0;
+                ptr[i0 * dims[1] + i1] = is_zero
+                        ? 0.f
+                        : (float)((i0 * 5 + i1 * 3) % 11 - 5);
+            }
+        }
+    }
+
+    void fill(const memory &mem) {
+        const auto nelems = mem.get_desc().get_size() / sizeof(float);
+        auto ptr = map_memory<float>(mem);
+        for (size_t i = 0; i < nelems; ++i)
+            ptr[i] = (float)((i * 13) % 7) - 3.f;
+    }
+
+    memory compress(memory &dense, const memory::dims &block_dims) {
+        const auto dims = dense.get_desc().dims();
+        const auto nnz_blocks = ((dims[0] + block_dims[0] - 1) / block_dims[0])
+                * ((dims[1] + block_dims[1] - 1) / block_dims[1]);
+        auto sparse_md = memory::desc::sparse_blocks(
+                dims, dt::f32, block_dims, nnz_blocks);
+        memory sparse(sparse_md, eng);
+        reorder(dense, sparse).execute(strm, dense, sparse);
+        strm.wait();
+        return sparse;
+    }
+
+    void compare(const memory &ref, const memory &got) {
+        const auto nelems = ref.get_desc().get_size() / sizeof(float);
+        auto ref_ptr = map_memory<float>(ref);
+        auto got_ptr = map_memory<float>(got);
+        for (size_t i = 0; i < nelems; ++i)
+            ASSERT_NEAR(ref_ptr[i], got_ptr[i], 1e-4f * std::abs(ref_ptr[i]))
+                    << "at index " << i;
+    }
+};
+
+TEST_F(sparse_weights_test_t, TestReorderRoundTrip) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "Sparse weights are supported on CPU only");
+    for (const auto &block_dims : {memory::dims {16, 1}, memory::dims {4, 4}}) {
+        memory::desc dense_md({37, 50}, dt::f32, tag::ab);
+        memory dense(dense_md, eng), dense_out(dense_md, eng);
+        fill_blocks(dense, block_dims);
+
+        auto sparse = compress(dense, block_dims);
+        reorder(sparse, dense_out).execute(strm, sparse, dense_out);
+        strm.wait();
+        compare(dense, dense_out);
+    }
+}
+
+TEST_F(sparse_weights_test_t, TestReorderCapacityOverflow) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "Sparse weights are supported on CPU only");
+    memory::desc dense_md({32, 32}, dt::f32, tag::ab);
+    memory dense(dense_md, eng);
+    fill(dense);
+
+    // every block is non-zero, but there is room for a single block only
+    auto sparse_md
+            = memory::desc::sparse_blocks({32, 32}, dt::f32, {16, 1}, 1);
+    memory sparse(sparse_md, eng);
+    EXPECT_ANY_THROW({
+        reorder(dense, sparse).execute(strm, dense, sparse);
+        strm.wait();
+    });
+}
+
+TEST_F(sparse_weights_test_t, TestInnerProduct) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "Sparse weights are supported on CPU only");
+    const memory::dim MB = 70, IC = 45, OC = 40;
+    for (const auto &block_dims : {memory::dims {16, 1}, memory::dims {4, 4}}) {
+        memory::desc src_md({MB, IC}, dt::f32, tag::nc);
+        memory::desc wei_md({OC, IC}, dt::f32, tag::oi);
+        memory::desc bia_md({OC}, dt::f32, tag::x);
+        memory::desc dst_md({MB, OC}, dt::f32, tag::nc);
+
+        memory src(src_md, eng), wei(wei_md, eng), bia(bia_md, eng);
+        memory dst_ref(dst_md, eng), dst(dst_md, eng);
+        fill(src);
+        fill(bia);
+        fill_blocks(wei, block_dims);
+        auto sparse_wei = compress(wei, block_dims);
+
+        post_ops ops;
+        ops.append_eltwise(1.f, algorithm::eltwise_relu, 0.f, 0.f);
+        primitive_attr attr;
+        attr.set_post_ops(ops);
+
+        auto ref_pd = inner_product_forward::primitive_desc(
+                {prop_kind::forward_inference, src_md, wei_md, bia_md,
+                        dst_md},
+                attr, eng);
+        inner_product_forward(ref_pd).execute(strm,
+                {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                        {DNNL_ARG_BIAS, bia}, {DNNL_ARG_DST, dst_ref}});
+
+        auto pd = inner_product_forward::primitive_desc(
+                {prop_kind::forward_inference, src_md,
+                        sparse_wei.get_desc(), bia_md, dst_md},
+                attr, eng);
+        ASSERT_TRUE(pd.weights_desc() == sparse_wei.get_desc());
+        inner_product_forward(pd).execute(strm,
+                {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, sparse_wei},
+                        {DNNL_ARG_BIAS, bia}, {DNNL_ARG_DST, dst}});
+        strm.wait();
+        compare(dst_ref, dst);
+    }
+}
+
+TEST_F(sparse_weights_test_t, TestMatMul) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "Sparse weights are supported on CPU only");
+    const memory::dim M = 19, K = 50, N = 33;
+    memory::dims block_dims {4, 4};
+    memory::desc src_md({M, K}, dt::f32, tag::ab);
+    memory::desc wei_md({K, N}, dt::f32, tag::ab);
+    memory::desc bia_md({1, N}, dt::f32, tag::ab);
+    memory::desc dst_md({M, N}, dt::f32, tag::ab);
+
+    memory src(src_md, eng), wei(wei_md, eng), bia(bia_md, eng);
+    memory dst_ref(dst_md, eng), dst(dst_md, eng);
+    fill(src);
+    fill(bia);
+    fill_blocks(wei, block_dims);
+    auto sparse_wei = compress(wei, block_dims);
+
+    auto ref_pd = matmul::primitive_desc(
+            {src_md, wei_md, bia_md, dst_md}, eng);
+    matmul(ref_pd).execute(strm,
+            {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                    {DNNL_ARG_BIAS, bia}, {DNNL_ARG_DST, dst_ref}});
+
+    auto pd = matmul::primitive_desc(
+            {src_md, sparse_wei.get_desc(), bia_md, dst_md}, eng);
+    matmul(pd).execute(strm,
+            {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, sparse_wei},
+                    {DNNL_ARG_BIAS, bia}, {DNNL_ARG_DST, dst}});
+    strm.wait();
+    compare(dst_ref, dst);
+}
+
+} // namespace dnnl
@@ -97,6 +97,10 @@ protected:
         Forward(inference, flags::use_global_stats);
         Forward(inference, flags::use_scale_shift);
 
+        ForwardResidual(training);
+        ForwardResidual(inference, flags::use_scale_shift);
+        ForwardResidual(inference, flags::use_global_stats);
+
         Backward(prop_kind::backward_data);
         Backward(prop_kind::backward_data, flags::use_global_stats);
         Backward(prop_kind::backward, flags::use_scale_shift);
@@ -153,6 +157,74 @@ protected:
                 p, src->get(), mean, variance, weights, dst->get(), flags, pk);
     }
 
+    // Checks the residual fusion against the normalization of the sum
+    // computed on the host. The sum is written to src in the end so that
+    // the regular forward check applies.
+    void ForwardResidual(prop_kind pk,
+            normalization_flags flags = normalization_flags::none) {
+        // the fusion is implemented on CPU only
+        if (get_test_engine_kind() != engine::kind::cpu) return;
+
+        flags = flags | normalization_flags::fuse_residual_add;
+        bool useScaleShift
+                = (bool)(flags & normalization_flags::use_scale_shift);
+        bool useGlobalStats
+                = (bool)(flags & normalization_flags::use_global_stats);
+        bool isTraining = pk == prop_kind::forward_training;
+
+        auto lnorm_fwd_d = layer_normalization_forward::desc(
+                pk, *data_d, *stat_d, p.epsilon, flags);
+        lnorm_fwd_pd
+                = layer_normalization_forward::primitive_desc(lnorm_fwd_d, eng);
+
+        ASSERT_TRUE(lnorm_fwd_pd.query_md(query::exec_arg_md, DNNL_ARG_SRC_1)
+                == lnorm_fwd_pd.src_desc());
+        ASSERT_TRUE(lnorm_fwd_pd.query_md(query::exec_arg_md, DNNL_ARG_DST_1)
+                == lnorm_fwd_pd.dst_desc());
+
+        auto src_1 = test::make_memory(*data_d, eng);
+        auto dst_1 = test::make_memory(*data_d, eng);
+        weights = test::make_memory(lnorm_fwd_pd.weights_desc(), eng);
+        if (isTraining || useGlobalStats) {
+            mean = test::make_memory(*stat_d, eng);
+            variance = test::make_memory(*stat_d, eng);
+        }
+
+        fill<float>(src->get());
+        fill<float>(src_1);
+        if (useScaleShift) fill<float>(weights);
+        if (useGlobalStats) {
+            fill<float>(mean);
+            fill<float>(variance);
+        }
+
+        std::unordered_map<int, memory> args = {{DNNL_ARG_SRC, src->get()},
+                {DNNL_ARG_SRC_1, src_1}, {DNNL_ARG_DST, dst->get()},
+                {DNNL_ARG_DST_1, dst_1}};
+        if (useScaleShift) args.insert({DNNL_ARG_SCALE_SHIFT, weights});
+        if (isTraining || useGlobalStats) {
+            args.insert({DNNL_ARG_MEAN, mean});
+            args.insert({DNNL_ARG_VARIANCE, variance});
+        }
+        layer_normalization_forward(lnorm_fwd_pd).execute(strm, args);
+        strm.wait();
+
+        {
+            const dnnl::impl::memory_desc_wrapper data_mdw(data_d->data);
+            auto src_data = map_memory<float>(src->get());
+            auto src_1_data = map_memory<const float>(src_1);
+            auto dst_1_data = map_memory<const float>(dst_1);
+            for (memory::dim i = 0; i < data_mdw.nelems(); ++i) {
+                const auto off = data_mdw.off_l(i);
+                src_data[off] += src_1_data[off];
+                ASSERT_EQ(dst_1_data[off], src_data[off]);
+            }
+        }
+
+        check_lnorm_fwd(
+                p, src->get(), mean, variance, weights, dst->get(), flags, pk);
+    }
+
     void Backward(prop_kind pk,
             normalization_flags flags = normalization_flags::none) {
         bwd_iface_test_stat_any(pk, flags);
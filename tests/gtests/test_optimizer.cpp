@@ -0,0 +1,241 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+#include <cmath>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+namespace dnnl {
+
+struct optimizer_test_params_t {
+    algorithm aalgorithm;
+    memory::dims dims;
+    memory::data_type diff_weights_dt;
+    memory::data_type dst_dt; // undef for no copy of the weights
+    float momentum;
+    float weight_decay;
+    float max_grad_norm;
+    bool expect_to_fail;
+    dnnl_status_t expected_status;
+};
+
+class optimizer_test_t
+    : public ::testing::TestWithParam<optimizer_test_params_t> {
+private:
+    optimizer_test_params_t p;
+
+protected:
+    void SetUp() override {
+        p = ::testing::TestWithParam<optimizer_test_params_t>::GetParam();
+
+        SKIP_IF(get_test_engine().get_kind() != engine::kind::cpu,
+                "Engine does not support this primitive.");
+        SKIP_IF(unsupported_data_type(p.diff_weights_dt),
+                "Engine does not support this data type.");
+        SKIP_IF(p.dst_dt != memory::data_type::undef
+                        && unsupported_data_type(p.dst_dt),
+                "Engine does not support this data type.");
+
+        catch_expected_failures(
+                [=]() { Test(); }, p.expect_to_fail, p.expected_status);
+    }
+
+    void Test() {
+        using op_desc_t = optimizer::desc;
+        using pd_t = optimizer::primitive_desc;
+        using dt = memory::data_type;
+        allows_attr_t aa {false}; // doesn't support anything
+
+        auto eng = get_test_engine();
+        auto strm = make_stream(eng);
+
+        const bool is_adam = p.aalgorithm == algorithm::optimizer_adam;
+        const bool with_dst = p.dst_dt != dt::undef;
+        const float beta2 = 0.999f, eps = 1e-6f;
+
+        const auto tag = memory::format_tag::a;
+        auto w_md = memory::desc(p.dims, dt::f32, tag);
+        auto dw_md = memory::desc(p.dims, p.diff_weights_dt, tag);
+        auto dst_md = with_dst ? memory::desc(p.dims, p.dst_dt, tag)
+                               : memory::desc();
+        auto op_desc = op_desc_t(p.aalgorithm, w_md, dw_md, dst_md,
+                p.momentum, beta2, eps, p.weight_decay, p.max_grad_norm);
+
+        auto pd = pd_t();
+        ASSERT_NO_THROW(pd = pd_t(op_desc, eng));
+        test_fwd_pd_constructors<op_desc_t, pd_t>(op_desc, pd, aa);
+
+        auto prim = optimizer(pd);
+
+        const bool with_m1 = is_adam || p.momentum != 0.f;
+        ASSERT_TRUE(pd.query_md(query::exec_arg_md, DNNL_ARG_WEIGHTS)
+                == pd.weights_desc());
+        ASSERT_EQ(pd.moment_1_desc() == pd.weights_desc(), with_m1);
+        ASSERT_EQ(pd.moment_2_desc() == pd.weights_desc(), is_adam);
+        ASSERT_EQ(pd.hyperparameters_desc().get_size(), 3 * sizeof(float));
+
+        const memory::dim n = p.dims[0];
+        auto mem_hp = test::make_memory(pd.hyperparameters_desc(), eng);
+        auto mem_w = test::make_memory(pd.weights_desc(), eng);
+        auto mem_dw = test::make_memory(pd.diff_weights_desc(), eng);
+        auto mem_m1 = test::make_memory(pd.weights_desc(), eng);
+        auto mem_m2 = test::make_memory(pd.weights_desc(), eng);
+        auto mem_dst = test::make_memory(pd.dst_desc(), eng);
+
+        // Values representable in bf16, so that the gradients are the same
+        // for both data types
+        auto grad_value = [&](memory::dim i, int step) {
+            return (float)((i * 7 + step * 3) % 17 - 8) / 4.f;
+        };
+
+        std::vector<double> w(n), m1(n, 0.), m2(n, 0.);
+        {
+            auto w_ptr = map_memory<float>(mem_w);
+            auto m1_ptr = map_memory<float>(mem_m1);
+            auto m2_ptr = map_memory<float>(mem_m2);
+            for (memory::dim i = 0; i < n; ++i) {
+                w[i] = 1.f + (float)(i % 11) / 8.f;
+                w_ptr[i] = (float)w[i];
+                m1_ptr[i] = m2_ptr[i] = 0.f;
+            }
+        }
+
+        std::unordered_map<int, memory> args = {
+                {DNNL_ARG_HYPERPARAMETERS, mem_hp},
+                {DNNL_ARG_WEIGHTS, mem_w}, {DNNL_ARG_DIFF_WEIGHTS, mem_dw}};
+        if (with_m1) args.insert({DNNL_ARG_MOMENT_1, mem_m1});
+        if (is_adam) args.insert({DNNL_ARG_MOMENT_2, mem_m2});
+        if (with_dst) args.insert({DNNL_ARG_DST, mem_dst});
+
+        for (int step = 1; step <= 3; ++step) {
+            // A different learning rate for every step checks that the
+            // runtime hyperparameters are used
+            const float lr = 0.1f / step, grad_scale = 0.5f;
+            {
+                auto hp = map_memory<float>(mem_hp);
+                hp[0] = lr;
+                hp[1] = (float)step;
+                hp[2] = grad_scale;
+            }
+            {
+                if (p.diff_weights_dt == dt::bf16) {
+                    auto dw = map_memory<bfloat16_t>(mem_dw);
+                    for (memory::dim i = 0; i < n; ++i)
+                        dw[i] = grad_value(i, step);
+                } else {
+                    auto dw = map_memory<float>(mem_dw);
+                    for (memory::dim i = 0; i < n; ++i)
+                        dw[i] = grad_value(i, step);
+                }
+            }
+            prim.execute(strm, args);
+            strm.wait();
+
+            double gs = grad_scale;
+            if (p.max_grad_norm > 0.f) {
+                double sq = 0.;
+                for (memory::dim i = 0; i < n; ++i)
+                    sq += grad_value(i, step) * grad_value(i, step);
+                const double norm = gs * std::sqrt(sq);
+                if (norm > p.max_grad_norm) gs *= p.max_grad_norm / norm;
+            }
+            for (memory::dim i = 0; i < n; ++i) {
+                double g = gs * grad_value(i, step);
+                if (is_adam) {
+                    m1[i] = p.momentum * m1[i] + (1. - p.momentum) * g;
+                    m2[i] = beta2 * m2[i] + (1. - beta2) * g * g;
+                    const double bc1 = 1. - std::pow(p.momentum, step);
+                    const double bc2 = 1. - std::pow(beta2, step);
+                    w[i] = (1. - lr * p.weight_decay) * w[i]
+                            - lr / bc1 * m1[i]
+                                    / (std::sqrt(m2[i] / bc2) + eps);
+                } else {
+                    g += p.weight_decay * w[i];
+                    if (with_m1) {
+                        m1[i] = p.momentum * m1[i] + g;
+                        g = m1[i];
+                    }
+                    w[i] -= lr * g;
+                }
+            }
+
+            auto w_ptr = map_memory<float>(mem_w);
+            for (memory::dim i = 0; i < n; ++i)
+                ASSERT_NEAR(w_ptr[i], w[i], 1e-5 * (1. + std::fabs(w[i])));
+            if (with_m1) {
+                auto m1_ptr = map_memory<float>(mem_m1);
+                for (memory::dim i = 0; i < n; ++i)
+                    ASSERT_NEAR(m1_ptr[i], m1[i],
+                            1e-5 * (1. + std::fabs(m1[i])));
+            }
+            if (p.dst_dt == dt::f32) {
+                auto dst = map_memory<float>(mem_dst);
+                for (memory::dim i = 0; i < n; ++i)
+                    ASSERT_EQ(dst[i], w_ptr[i]);
+            } else if (p.dst_dt == dt::bf16) {
+                auto dst = map_memory<bfloat16_t>(mem_dst);
+                for (memory::dim i = 0; i < n; ++i)
+                    ASSERT_EQ((float)dst[i], (float)bfloat16_t(w_ptr[i]));
+            }
+        }
+    }
+};
+
+using dt = memory::data_type;
+
+static auto expected_failures = []() {
+    return ::testing::Values(
+            // f32 master weights are required
+            optimizer_test_params_t {algorithm::optimizer_sgd, {16}, dt::bf16,
+                    dt::f32, 0.f, 0.f, 0.f, true, dnnl_invalid_arguments},
+            // beta1 must be less than 1
+            optimizer_test_params_t {algorithm::optimizer_adam, {16},
+                    dt::f32, dt::undef, 1.f, 0.f, 0.f, true,
+                    dnnl_invalid_arguments},
+            // the copy of the weights must be f32 or bf16
+            optimizer_test_params_t {algorithm::optimizer_sgd, {16},
+                    dt::f32, dt::s8, 0.f, 0.f, 0.f, true,
+                    dnnl_invalid_arguments});
+};
+
+static auto simple_cases = []() {
+    return ::testing::Values(
+            // plain SGD, no state
+            optimizer_test_params_t {algorithm::optimizer_sgd, {100}, dt::f32,
+                    dt::undef, 0.f, 0.f, 0.f},
+            // SGD with momentum, weight decay, and a bf16 copy
+            optimizer_test_params_t {algorithm::optimizer_sgd, {1000},
+                    dt::bf16, dt::bf16, 0.9f, 1e-2f, 0.f},
+            optimizer_test_params_t {algorithm::optimizer_adam, {37},
+                    dt::f32, dt::f32, 0.9f, 0.f, 0.f},
+            // AdamW with bf16 gradients and weights, sizes with a tail
+            optimizer_test_params_t {algorithm::optimizer_adam, {4099},
+                    dt::bf16, dt::bf16, 0.9f, 1e-2f, 0.f},
+            // clipping by the norm of the gradients
+            optimizer_test_params_t {algorithm::optimizer_adam, {513},
+                    dt::f32, dt::undef, 0.8f, 0.f, 1.f},
+            optimizer_test_params_t {algorithm::optimizer_sgd, {2050},
+                    dt::f32, dt::f32, 0.5f, 0.f, 2.f});
+};
+
+TEST_P(optimizer_test_t, TestsOptimizer) {}
+INSTANTIATE_TEST_SUITE_P(
+        TestOptimizerEF, optimizer_test_t, expected_failures());
+INSTANTIATE_TEST_SUITE_P(TestOptimizerSimple, optimizer_test_t, simple_cases());
+
+} // namespace dnnl
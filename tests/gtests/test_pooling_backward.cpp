@@ -260,6 +260,7 @@ class pooling_bwd_test_t
 private:
     std::shared_ptr<memory::desc> src_desc;
     std::shared_ptr<memory::desc> dst_desc;
+    memory src;
     memory workspace;
     union prim_desc_union {
         pooling_forward::primitive_desc pool_prim_desc;
@@ -334,6 +335,9 @@ protected:
 
         Forward();
         Backward();
+        if (p.aalgorithm == algorithm::pooling_max && is_not_dilated
+                && get_test_engine_kind() == engine::kind::cpu)
+            BackwardRecomputeArgmax();
     }
 
     template <typename prim_desc>
@@ -350,7 +354,7 @@ protected:
     }
 
     void Forward() {
-        auto src = test::make_memory(*src_desc, eng);
+        src = test::make_memory(*src_desc, eng);
         auto dst = test::make_memory(*dst_desc, eng);
 
         fill_data<data_t>(src.get_desc().get_size() / sizeof(data_t), src);
@@ -442,6 +446,45 @@ protected:
         check_zero_tail<data_t>(0, diff_src);
         check_pool_bwd<data_t>(p, diff_src, diff_dst, workspace);
     }
+
+    // Max pooling backward with a forward inference hint takes the source
+    // instead of the workspace. The positions of the maxima are the same, so
+    // the training workspace still serves as the reference.
+    void BackwardRecomputeArgmax() {
+        auto diff_src = test::make_memory(*src_desc, eng);
+        auto diff_dst = test::make_memory(*dst_desc, eng);
+
+        fill_data<data_t>(
+                diff_dst.get_desc().get_size() / sizeof(data_t), diff_dst);
+        fill_data<data_t>(
+                diff_src.get_desc().get_size() / sizeof(data_t), diff_src);
+        check_zero_tail<data_t>(1, diff_dst);
+        check_zero_tail<data_t>(1, diff_src);
+
+        auto pool_desc = pooling_forward::desc(prop_kind::forward_inference,
+                p.aalgorithm, *src_desc, *dst_desc, strides, ker, pad_l, pad_r);
+        auto pool_prim_desc = pooling_forward::primitive_desc(pool_desc, eng);
+
+        auto pool_bwd_desc = pooling_backward::desc(p.aalgorithm, *src_desc,
+                *dst_desc, strides, ker, pad_l, pad_r);
+        auto pool_bwd_prim_desc = pooling_backward::primitive_desc(
+                pool_bwd_desc, eng, pool_prim_desc);
+
+        ASSERT_TRUE(pool_bwd_prim_desc.workspace_desc() == memory::desc());
+        ASSERT_TRUE(pool_bwd_prim_desc.query_md(
+                            query::exec_arg_md, DNNL_ARG_SRC)
+                == pool_prim_desc.src_desc());
+
+        pooling_backward(pool_bwd_prim_desc)
+                .execute(strm,
+                        {{DNNL_ARG_DIFF_DST, diff_dst},
+                                {DNNL_ARG_DIFF_SRC, diff_src},
+                                {DNNL_ARG_SRC, src}});
+        strm.wait();
+
+        check_zero_tail<data_t>(0, diff_src);
+        check_pool_bwd<data_t>(p, diff_src, diff_dst, workspace);
+    }
 };
 
 using pooling_bwd_test_float = pooling_bwd_test_t<float>;
@@ -59,4 +59,32 @@ TEST(primitive_cache_mt_test, TestNestedCase) {
     });
 }
 
+TEST(primitive_cache_mt_test, TestBatchCreation) {
+    using tag = memory::format_tag;
+    using dt = memory::data_type;
+
+    engine eng(get_test_engine_kind(), 0);
+
+    // Every primitive descriptor appears twice to create the same primitive
+    // concurrently
+    int n_primitives = 12;
+    std::vector<primitive_desc> pds;
+    for (int np = 0; np < 2 * n_primitives; ++np) {
+        auto relu_d = eltwise_forward::desc(prop_kind::forward_inference,
+                algorithm::eltwise_relu,
+                {{np % n_primitives + 1, 1, 1, 1}, dt::f32, tag::nchw}, 0.f,
+                0.f);
+        pds.push_back(eltwise_forward::primitive_desc(relu_d, eng));
+    }
+
+    auto prims = primitive::create_batch(pds);
+    ASSERT_EQ(prims.size(), pds.size());
+    for (size_t i = 0; i < prims.size(); ++i) {
+        ASSERT_TRUE(prims[i]);
+        ASSERT_EQ(prims[i].get_kind(), primitive::kind::eltwise);
+    }
+
+    ASSERT_EQ(primitive::create_batch({}).size(), 0u);
+}
+
 } // namespace dnnl
@@ -0,0 +1,163 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+#include <vector>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+namespace dnnl {
+
+struct augru_params_t {
+    memory::dim l, t, mb, c;
+};
+
+// AUGRU is checked against a naive implementation of the cell:
+// u~ = (1 - a) * u and h = u~ * h_prev + (1 - u~) * o
+class rnn_augru_test_t : public ::testing::TestWithParam<augru_params_t> {
+protected:
+    void SetUp() override {
+        SKIP_IF(get_test_engine_kind() == engine::kind::gpu,
+                "GPU does not support AUGRU.");
+        p = GetParam();
+        Test();
+    }
+
+    void Test() {
+        auto eng = get_test_engine();
+        auto strm = make_stream(eng);
+        const memory::dim L = p.l, T = p.t, MB = p.mb, C = p.c, G = 3;
+
+        memory::desc src_layer_md({T, MB, C}, dt::f32, tag::tnc);
+        memory::desc states_md({L, 1, MB, C}, dt::f32, tag::ldnc);
+        memory::desc weights_md({L, 1, C, G, C}, dt::f32, tag::ldigo);
+        memory::desc bias_md({L, 1, G, C}, dt::f32, tag::ldgo);
+        memory::desc dst_layer_md({T, MB, C}, dt::f32, tag::tnc);
+
+        auto pd = augru_forward::primitive_desc(
+                augru_forward::desc(prop_kind::forward_inference,
+                        rnn_direction::unidirectional_left2right,
+                        src_layer_md, states_md, weights_md, weights_md,
+                        bias_md, dst_layer_md, states_md),
+                eng);
+        ASSERT_TRUE(pd.attention_desc()
+                == memory::desc({T, MB, 1}, dt::f32, tag::tnc));
+
+        auto src_layer = memory(src_layer_md, eng);
+        auto src_iter = memory(states_md, eng);
+        auto weights_layer = memory(weights_md, eng);
+        auto weights_iter = memory(weights_md, eng);
+        auto bias = memory(bias_md, eng);
+        auto attention = memory(pd.attention_desc(), eng);
+        auto dst_layer = memory(dst_layer_md, eng);
+        auto dst_iter = memory(states_md, eng);
+        fill_data<float>(T * MB * C, src_layer, 0.f, 1.f);
+        fill_data<float>(L * MB * C, src_iter, 0.f, 1.f);
+        fill_data<float>(L * C * G * C, weights_layer, 0.f, 0.5f / C);
+        fill_data<float>(L * C * G * C, weights_iter, 0.f, 0.5f / C);
+        fill_data<float>(L * G * C, bias, 0.f, 0.5f);
+        fill_data<float>(T * MB, attention, 0.5f, 0.5f);
+
+        augru_forward(pd).execute(strm,
+                {{DNNL_ARG_SRC_LAYER, src_layer}, {DNNL_ARG_SRC_ITER, src_iter},
+                        {DNNL_ARG_WEIGHTS_LAYER, weights_layer},
+                        {DNNL_ARG_WEIGHTS_ITER, weights_iter},
+                        {DNNL_ARG_BIAS, bias},
+                        {DNNL_ARG_AUGRU_ATTENTION, attention},
+                        {DNNL_ARG_DST_LAYER, dst_layer},
+                        {DNNL_ARG_DST_ITER, dst_iter}});
+        strm.wait();
+
+        auto x = map_memory<float>(src_layer);
+        auto h0 = map_memory<float>(src_iter);
+        auto wl = map_memory<float>(weights_layer);
+        auto wi = map_memory<float>(weights_iter);
+        auto b = map_memory<float>(bias);
+        auto a = map_memory<float>(attention);
+
+        auto sigmoid = [](float f) { return 1.f / (1.f + std::exp(-f)); };
+
+        // in and out hold the inputs and outputs of the current layer
+        std::vector<float> in(T * MB * C), out(T * MB * C);
+        for (memory::dim i = 0; i < T * MB * C; i++)
+            in[i] = x[i];
+        std::vector<float> h_last(L * MB * C);
+        for (memory::dim l = 0; l < L; l++) {
+            const float *wl_l = wl + l * C * G * C;
+            const float *wi_l = wi + l * C * G * C;
+            const float *b_l = b + l * G * C;
+            std::vector<float> h(h0 + l * MB * C, h0 + (l + 1) * MB * C);
+            for_(memory::dim t = 0; t < T; t++)
+            for (memory::dim n = 0; n < MB; n++) {
+                const float *xt = &in[(t * MB + n) * C];
+                const float *ht = &h[n * C];
+                std::vector<float> u(C), r(C), o(C), rh(C);
+                for (memory::dim j = 0; j < C; j++) {
+                    float su = b_l[0 * C + j], sr = b_l[1 * C + j];
+                    for (memory::dim i = 0; i < C; i++) {
+                        su += xt[i] * wl_l[(i * G + 0) * C + j]
+                                + ht[i] * wi_l[(i * G + 0) * C + j];
+                        sr += xt[i] * wl_l[(i * G + 1) * C + j]
+                                + ht[i] * wi_l[(i * G + 1) * C + j];
+                    }
+                    u[j] = sigmoid(su);
+                    r[j] = sigmoid(sr);
+                }
+                for (memory::dim i = 0; i < C; i++)
+                    rh[i] = r[i] * ht[i];
+                for (memory::dim j = 0; j < C; j++) {
+                    float so = b_l[2 * C + j];
+                    for (memory::dim i = 0; i < C; i++)
+                        so += xt[i] * wl_l[(i * G + 2) * C + j]
+                                + rh[i] * wi_l[(i * G + 2) * C + j];
+                    o[j] = std::tanh(so);
+                }
+                for (memory::dim j = 0; j < C; j++) {
+                    const float ua = (1.f - a[t * MB + n]) * u[j];
+                    out[(t * MB + n) * C + j] = ua * ht[j] + (1.f - ua) * o[j];
+                }
+                for (memory::dim j = 0; j < C; j++)
+                    h[n * C + j] = out[(t * MB + n) * C + j];
+            }
+            std::copy(h.begin(), h.end(), h_last.begin() + l * MB * C);
+            in.swap(out);
+        }
+
+        const float eps = 1e-4f;
+        auto got_layer = map_memory<float>(dst_layer);
+        for (memory::dim i = 0; i < T * MB * C; i++)
+            ASSERT_NEAR(got_layer[i], in[i], eps);
+        auto got_iter = map_memory<float>(dst_iter);
+        for (memory::dim i = 0; i < L * MB * C; i++)
+            ASSERT_NEAR(got_iter[i], h_last[i], eps);
+    }
+
+    using dt = memory::data_type;
+    using tag = memory::format_tag;
+    augru_params_t p;
+};
+
+TEST_P(rnn_augru_test_t, TestsAugru) {}
+
+INSTANTIATE_TEST_SUITE_P(TestRnnAugru, rnn_augru_test_t,
+        ::testing::Values(augru_params_t {1, 1, 1, 8},
+                augru_params_t {1, 5, 3, 16}, augru_params_t {2, 4, 2, 19},
+                augru_params_t {3, 6, 4, 32}));
+
+} // namespace dnnl
@@ -0,0 +1,207 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <unordered_map>
+#include <vector>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+namespace dnnl {
+
+struct recompute_gates_params_t {
+    algorithm cell_kind;
+    rnn_direction direction;
+    memory::dim l, t, mb, c;
+};
+
+// The gradients computed with the gates recomputed in backward are checked
+// against the ones computed with the gates kept in the workspace.
+class rnn_recompute_gates_test_t
+    : public ::testing::TestWithParam<recompute_gates_params_t> {
+protected:
+    void SetUp() override {
+        SKIP_IF(get_test_engine_kind() == engine::kind::gpu,
+                "GPU does not support gate recomputation.");
+        p = GetParam();
+        Test();
+    }
+
+    memory::dim n_gates() const { return is_lstm() ? 4 : 1; }
+    memory::dim n_dir() const {
+        return p.direction == rnn_direction::bidirectional_sum ? 2 : 1;
+    }
+    bool is_lstm() const { return p.cell_kind == algorithm::vanilla_lstm; }
+
+    struct result_t {
+        memory::dim ws_size;
+        std::unordered_map<int, std::vector<float>> diffs;
+    };
+
+    result_t run(rnn_flags flags) {
+        auto eng = get_test_engine();
+        auto strm = make_stream(eng);
+        const memory::dim L = p.l, T = p.t, MB = p.mb, C = p.c, G = n_gates(),
+                          D = n_dir();
+
+        memory::desc layer_md({T, MB, C}, dt::f32, tag::tnc);
+        memory::desc dst_layer_md({T, MB, C}, dt::f32, tag::tnc);
+        memory::desc states_md({L, D, MB, C}, dt::f32, tag::ldnc);
+        memory::desc weights_md({L, D, C, G, C}, dt::f32, tag::any);
+        memory::desc bias_md({L, D, G, C}, dt::f32, tag::ldgo);
+        memory::desc user_weights_md({L, D, C, G, C}, dt::f32, tag::ldigo);
+        const auto fwd = prop_kind::forward_training;
+        const auto bwd = prop_kind::backward;
+        const auto act = algorithm::eltwise_tanh;
+
+        rnn_primitive_desc_base fwd_pd, bwd_pd;
+        if (is_lstm()) {
+            auto lstm_fwd_pd = lstm_forward::primitive_desc(
+                    lstm_forward::desc(fwd, p.direction, layer_md, states_md,
+                            states_md, weights_md, weights_md, bias_md,
+                            dst_layer_md, states_md, states_md, flags),
+                    eng);
+            bwd_pd = lstm_backward::primitive_desc(
+                    lstm_backward::desc(bwd, p.direction, layer_md, states_md,
+                            states_md, weights_md, weights_md, bias_md,
+                            dst_layer_md, states_md, states_md, layer_md,
+                            states_md, states_md, weights_md, weights_md,
+                            bias_md, dst_layer_md, states_md, states_md,
+                            flags),
+                    eng, lstm_fwd_pd);
+            fwd_pd = lstm_fwd_pd;
+        } else {
+            auto rnn_fwd_pd = vanilla_rnn_forward::primitive_desc(
+                    vanilla_rnn_forward::desc(fwd, act, p.direction, layer_md,
+                            states_md, weights_md, weights_md, bias_md,
+                            dst_layer_md, states_md, flags),
+                    eng);
+            bwd_pd = vanilla_rnn_backward::primitive_desc(
+                    vanilla_rnn_backward::desc(bwd, act, p.direction,
+                            layer_md, states_md, weights_md, weights_md,
+                            bias_md, dst_layer_md, states_md, layer_md,
+                            states_md, weights_md, weights_md, bias_md,
+                            dst_layer_md, states_md, flags),
+                    eng, rnn_fwd_pd);
+            fwd_pd = rnn_fwd_pd;
+        }
+
+        // The user weights are reordered to the layouts of both passes
+        auto user_weights = memory(user_weights_md, eng);
+        fill_data<float>(L * D * C * G * C, user_weights, 0.f, 0.5f / C);
+        auto reordered = [&](const memory::desc &md) {
+            auto mem = memory(md, eng);
+            reorder(user_weights, mem).execute(strm, user_weights, mem);
+            return mem;
+        };
+        auto fwd_weights = reordered(fwd_pd.weights_layer_desc());
+        auto bwd_weights = reordered(bwd_pd.weights_layer_desc());
+
+        auto new_memory = [&](const memory::desc &md, float mean) {
+            auto mem = memory(md, eng);
+            const memory::dim n = md.get_size() / sizeof(float);
+            fill_data<float>(n, mem, mean, mean == 0.f ? 0.f : 1.f);
+            return mem;
+        };
+        auto src_layer = new_memory(layer_md, 1.f);
+        auto src_iter = new_memory(states_md, 1.f);
+        auto src_iter_c = new_memory(states_md, 1.f);
+        auto bias = new_memory(bias_md, 0.5f);
+        auto dst_layer = new_memory(dst_layer_md, 0.f);
+        auto dst_iter = new_memory(states_md, 0.f);
+        auto dst_iter_c = new_memory(states_md, 0.f);
+        auto workspace = memory(fwd_pd.workspace_desc(), eng);
+
+        std::unordered_map<int, memory> args = {{DNNL_ARG_SRC_LAYER, src_layer},
+                {DNNL_ARG_SRC_ITER, src_iter},
+                {DNNL_ARG_WEIGHTS_LAYER, fwd_weights},
+                {DNNL_ARG_WEIGHTS_ITER, fwd_weights}, {DNNL_ARG_BIAS, bias},
+                {DNNL_ARG_DST_LAYER, dst_layer}, {DNNL_ARG_DST_ITER, dst_iter},
+                {DNNL_ARG_WORKSPACE, workspace}};
+        if (is_lstm()) {
+            args.insert({DNNL_ARG_SRC_ITER_C, src_iter_c});
+            args.insert({DNNL_ARG_DST_ITER_C, dst_iter_c});
+        }
+        primitive(fwd_pd).execute(strm, args);
+
+        args[DNNL_ARG_WEIGHTS_LAYER] = bwd_weights;
+        args[DNNL_ARG_WEIGHTS_ITER] = bwd_weights;
+        args.insert({DNNL_ARG_DIFF_DST_LAYER, new_memory(dst_layer_md, 1.f)});
+        args.insert({DNNL_ARG_DIFF_DST_ITER, new_memory(states_md, 1.f)});
+        std::vector<int> diff_args = {DNNL_ARG_DIFF_SRC_LAYER,
+                DNNL_ARG_DIFF_SRC_ITER, DNNL_ARG_DIFF_WEIGHTS_LAYER,
+                DNNL_ARG_DIFF_WEIGHTS_ITER, DNNL_ARG_DIFF_BIAS};
+        if (is_lstm()) {
+            args.insert({DNNL_ARG_DIFF_DST_ITER_C, new_memory(states_md, 1.f)});
+            diff_args.push_back(DNNL_ARG_DIFF_SRC_ITER_C);
+        }
+        // the gradients of the weights are accumulated
+        for (int arg : diff_args)
+            args.insert({arg,
+                    new_memory(bwd_pd.query_md(query::exec_arg_md, arg), 0.f)});
+        primitive(bwd_pd).execute(strm, args);
+        strm.wait();
+
+        result_t r;
+        r.ws_size = (memory::dim)fwd_pd.workspace_desc().get_size();
+        for (int arg : diff_args) {
+            const auto &mem = args.at(arg);
+            const size_t n = mem.get_desc().get_size() / sizeof(float);
+            auto mapped = map_memory<float>(mem);
+            const float *ptr = mapped;
+            r.diffs[arg] = std::vector<float>(ptr, ptr + n);
+        }
+        return r;
+    }
+
+    void Test() {
+        const auto ref = run(rnn_flags::undef);
+        const auto got = run(rnn_flags::recompute_gates);
+
+        ASSERT_LT(got.ws_size, ref.ws_size);
+        const float eps = 1e-4f;
+        for (const auto &d : ref.diffs) {
+            const auto &g = got.diffs.at(d.first);
+            ASSERT_EQ(g.size(), d.second.size());
+            for (size_t i = 0; i < g.size(); i++)
+                ASSERT_NEAR(g[i], d.second[i],
+                        eps * std::max(1.f, std::abs(d.second[i])));
+        }
+    }
+
+    using dt = memory::data_type;
+    using tag = memory::format_tag;
+    recompute_gates_params_t p;
+};
+
+TEST_P(rnn_recompute_gates_test_t, TestsRecomputeGates) {}
+
+INSTANTIATE_TEST_SUITE_P(TestRnnRecomputeGates, rnn_recompute_gates_test_t,
+        ::testing::Values(
+                recompute_gates_params_t {algorithm::vanilla_lstm,
+                        rnn_direction::unidirectional_left2right, 1, 5, 4, 8},
+                recompute_gates_params_t {algorithm::vanilla_lstm,
+                        rnn_direction::bidirectional_sum, 2, 4, 3, 16},
+                recompute_gates_params_t {algorithm::vanilla_rnn,
+                        rnn_direction::unidirectional_right2left, 3, 6, 2, 8},
+                recompute_gates_params_t {algorithm::vanilla_rnn,
+                        rnn_direction::bidirectional_sum, 2, 3, 5, 8}));
+
+} // namespace dnnl
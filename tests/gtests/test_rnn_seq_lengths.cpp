@@ -0,0 +1,250 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <unordered_map>
+#include <vector>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+namespace dnnl {
+
+struct seq_lengths_params_t {
+    algorithm cell_kind;
+    memory::dim l, t, c;
+    std::vector<int32_t> lengths;
+    bool expect_to_fail;
+};
+
+// The batch with variable sequence lengths is checked against the same
+// primitive ran for every sequence separately with its own length.
+class rnn_seq_lengths_test_t
+    : public ::testing::TestWithParam<seq_lengths_params_t> {
+protected:
+    void SetUp() override {
+        SKIP_IF(get_test_engine_kind() == engine::kind::gpu,
+                "GPU does not support variable sequence lengths.");
+        p = GetParam();
+        Test();
+    }
+
+    memory::dim n_gates() const {
+        switch (p.cell_kind) {
+            case algorithm::vanilla_lstm: return 4;
+            case algorithm::vanilla_gru: return 3;
+            default: return 1;
+        }
+    }
+    bool is_lstm() const { return p.cell_kind == algorithm::vanilla_lstm; }
+
+    // Creates a forward inference primitive descriptor for T x MB
+    rnn_primitive_desc_base create_pd(
+            memory::dim T, memory::dim MB, rnn_flags flags) {
+        auto eng = get_test_engine();
+        const memory::dim L = p.l, C = p.c, G = n_gates();
+        memory::desc src_layer_md({T, MB, C}, dt::f32, tag::tnc);
+        memory::desc states_md({L, 1, MB, C}, dt::f32, tag::ldnc);
+        memory::desc weights_md({L, 1, C, G, C}, dt::f32, tag::ldigo);
+        memory::desc bias_md({L, 1, G, C}, dt::f32, tag::ldgo);
+        memory::desc dst_layer_md({T, MB, C}, dt::f32, tag::tnc);
+        const auto aprop = prop_kind::forward_inference;
+        const auto dir = rnn_direction::unidirectional_left2right;
+
+        switch (p.cell_kind) {
+            case algorithm::vanilla_lstm:
+                return lstm_forward::primitive_desc(
+                        lstm_forward::desc(aprop, dir, src_layer_md, states_md,
+                                states_md, weights_md, weights_md, {}, {},
+                                bias_md, dst_layer_md, states_md, states_md,
+                                flags),
+                        eng);
+            case algorithm::vanilla_gru:
+                return gru_forward::primitive_desc(
+                        gru_forward::desc(aprop, dir, src_layer_md, states_md,
+                                weights_md, weights_md, bias_md, dst_layer_md,
+                                states_md, flags),
+                        eng);
+            default:
+                return vanilla_rnn_forward::primitive_desc(
+                        vanilla_rnn_forward::desc(aprop,
+                                algorithm::eltwise_tanh, dir, src_layer_md,
+                                states_md, weights_md, weights_md, bias_md,
+                                dst_layer_md, states_md, flags),
+                        eng);
+        }
+    }
+
+    void Test() {
+        auto eng = get_test_engine();
+        auto strm = make_stream(eng);
+        const memory::dim L = p.l, T = p.t, C = p.c, G = n_gates();
+        const memory::dim MB = (memory::dim)p.lengths.size();
+
+        auto pd = create_pd(T, MB, rnn_flags::seq_lengths);
+        ASSERT_TRUE(pd.query_md(query::exec_arg_md, DNNL_ARG_SEQ_LENGTHS)
+                == memory::desc({MB}, dt::s32, tag::x));
+
+        auto weights = memory(pd.weights_layer_desc(), eng);
+        auto bias = memory(pd.bias_desc(), eng);
+        fill_data<float>(L * C * G * C, weights, 0.f, 0.5f / C);
+        fill_data<float>(L * G * C, bias, 0.f, 0.5f);
+
+        auto src_layer = memory(pd.src_layer_desc(), eng);
+        auto src_iter = memory(pd.src_iter_desc(), eng);
+        auto dst_layer = memory(pd.dst_layer_desc(), eng);
+        auto dst_iter = memory(pd.dst_iter_desc(), eng);
+        auto seq_lengths = memory({{MB}, dt::s32, tag::x}, eng);
+        fill_data<float>(T * MB * C, src_layer, 0.f, 1.f);
+        fill_data<float>(L * MB * C, src_iter, 0.f, 1.f);
+        fill_data<float>(T * MB * C, dst_layer, 1.f, 1.f);
+        {
+            auto ptr = map_memory<int32_t>(seq_lengths);
+            for (memory::dim b = 0; b < MB; b++)
+                ptr[b] = p.lengths[b];
+        }
+
+        std::unordered_map<int, memory> args
+                = {{DNNL_ARG_SRC_LAYER, src_layer},
+                        {DNNL_ARG_SRC_ITER, src_iter},
+                        {DNNL_ARG_WEIGHTS_LAYER, weights},
+                        {DNNL_ARG_WEIGHTS_ITER, weights},
+                        {DNNL_ARG_BIAS, bias}, {DNNL_ARG_DST_LAYER, dst_layer},
+                        {DNNL_ARG_DST_ITER, dst_iter},
+                        {DNNL_ARG_SEQ_LENGTHS, seq_lengths}};
+        memory src_iter_c, dst_iter_c;
+        if (is_lstm()) {
+            src_iter_c = memory(pd.src_iter_c_desc(), eng);
+            dst_iter_c = memory(pd.dst_iter_c_desc(), eng);
+            fill_data<float>(L * MB * C, src_iter_c, 0.f, 1.f);
+            args.insert({DNNL_ARG_SRC_ITER_C, src_iter_c});
+            args.insert({DNNL_ARG_DST_ITER_C, dst_iter_c});
+        }
+
+        if (p.expect_to_fail) {
+            EXPECT_ANY_THROW(primitive(pd).execute(strm, args));
+            return;
+        }
+        primitive(pd).execute(strm, args);
+        strm.wait();
+
+        for (memory::dim b = 0; b < MB; b++)
+            check_sequence(b, args);
+    }
+
+    // Runs the b-th sequence alone and compares it to the batched results
+    void check_sequence(
+            memory::dim b, const std::unordered_map<int, memory> &args) {
+        auto eng = get_test_engine();
+        auto strm = make_stream(eng);
+        const memory::dim L = p.l, T = p.t, C = p.c;
+        const memory::dim MB = (memory::dim)p.lengths.size();
+        const memory::dim len = p.lengths[b];
+
+        auto pd = create_pd(len, 1, rnn_flags::undef);
+        auto src_layer = memory(pd.src_layer_desc(), eng);
+        auto src_iter = memory(pd.src_iter_desc(), eng);
+        auto dst_layer = memory(pd.dst_layer_desc(), eng);
+        auto dst_iter = memory(pd.dst_iter_desc(), eng);
+        std::unordered_map<int, memory> ref_args
+                = {{DNNL_ARG_SRC_LAYER, src_layer},
+                        {DNNL_ARG_SRC_ITER, src_iter},
+                        {DNNL_ARG_WEIGHTS_LAYER,
+                                args.at(DNNL_ARG_WEIGHTS_LAYER)},
+                        {DNNL_ARG_WEIGHTS_ITER, args.at(DNNL_ARG_WEIGHTS_ITER)},
+                        {DNNL_ARG_BIAS, args.at(DNNL_ARG_BIAS)},
+                        {DNNL_ARG_DST_LAYER, dst_layer},
+                        {DNNL_ARG_DST_ITER, dst_iter}};
+        memory src_iter_c, dst_iter_c;
+        if (is_lstm()) {
+            src_iter_c = memory(pd.src_iter_c_desc(), eng);
+            dst_iter_c = memory(pd.dst_iter_c_desc(), eng);
+            ref_args.insert({DNNL_ARG_SRC_ITER_C, src_iter_c});
+            ref_args.insert({DNNL_ARG_DST_ITER_C, dst_iter_c});
+        }
+
+        // [T, MB, C] -> [len, 1, C] and [L, 1, MB, C] -> [L, 1, 1, C]
+        {
+            auto from = map_memory<float>(args.at(DNNL_ARG_SRC_LAYER));
+            auto to = map_memory<float>(src_layer);
+            for_(memory::dim t = 0; t < len; t++)
+            for (memory::dim c = 0; c < C; c++)
+                to[t * C + c] = from[(t * MB + b) * C + c];
+        }
+        for (int arg : {DNNL_ARG_SRC_ITER, DNNL_ARG_SRC_ITER_C}) {
+            if (ref_args.count(arg) == 0) continue;
+            auto from = map_memory<float>(args.at(arg));
+            auto to = map_memory<float>(ref_args.at(arg));
+            for_(memory::dim l = 0; l < L; l++)
+            for (memory::dim c = 0; c < C; c++)
+                to[l * C + c] = from[(l * MB + b) * C + c];
+        }
+
+        primitive(pd).execute(strm, ref_args);
+        strm.wait();
+
+        const float eps = 1e-5f;
+        {
+            auto got = map_memory<float>(args.at(DNNL_ARG_DST_LAYER));
+            auto ref = map_memory<float>(dst_layer);
+            for_(memory::dim t = 0; t < T; t++)
+            for (memory::dim c = 0; c < C; c++) {
+                const float r = t < len ? ref[t * C + c] : 0.f;
+                ASSERT_NEAR(got[(t * MB + b) * C + c], r, eps);
+            }
+        }
+        for (int arg : {DNNL_ARG_DST_ITER, DNNL_ARG_DST_ITER_C}) {
+            if (ref_args.count(arg) == 0) continue;
+            auto got = map_memory<float>(args.at(arg));
+            auto ref = map_memory<float>(ref_args.at(arg));
+            for_(memory::dim l = 0; l < L; l++)
+            for (memory::dim c = 0; c < C; c++)
+                ASSERT_NEAR(got[(l * MB + b) * C + c], ref[l * C + c], eps);
+        }
+    }
+
+    using dt = memory::data_type;
+    using tag = memory::format_tag;
+    seq_lengths_params_t p;
+};
+
+TEST_P(rnn_seq_lengths_test_t, TestsSeqLengths) {}
+
+INSTANTIATE_TEST_SUITE_P(TestRnnSeqLengths, rnn_seq_lengths_test_t,
+        ::testing::Values(
+                seq_lengths_params_t {algorithm::vanilla_lstm, 1, 5, 8,
+                        {5, 3, 3, 1}, false},
+                seq_lengths_params_t {
+                        algorithm::vanilla_lstm, 2, 7, 16, {7, 2}, false},
+                seq_lengths_params_t {
+                        algorithm::vanilla_gru, 2, 4, 8, {4, 4, 1}, false},
+                seq_lengths_params_t {
+                        algorithm::vanilla_rnn, 3, 6, 8, {5, 2, 1}, false}));
+
+INSTANTIATE_TEST_SUITE_P(TestRnnSeqLengthsInvalid, rnn_seq_lengths_test_t,
+        ::testing::Values(
+                // not sorted
+                seq_lengths_params_t {
+                        algorithm::vanilla_lstm, 1, 5, 8, {3, 5}, true},
+                // longer than T
+                seq_lengths_params_t {
+                        algorithm::vanilla_gru, 1, 5, 8, {6, 1}, true},
+                // empty sequence
+                seq_lengths_params_t {
+                        algorithm::vanilla_rnn, 1, 5, 8, {5, 0}, true}));
+
+} // namespace dnnl
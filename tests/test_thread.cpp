@@ -295,6 +295,10 @@ dnnl::threadpool_interop::threadpool_iface *get_threadpool() {
     return &tp;
 }
 
+dnnl::threadpool_interop::threadpool_iface *create_threadpool(int num_threads) {
+    return new dnnl::testing::threadpool(num_threads);
+}
+
 } // namespace testing
 
 // Implement a dummy threadpools_utils protocol here so that it is picked up
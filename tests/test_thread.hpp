@@ -51,6 +51,10 @@ namespace testing {
 
 dnnl::threadpool_interop::threadpool_iface *get_threadpool();
 
+// Creates a new threadpool with `num_threads` threads (the default number if
+// non-positive). The caller owns the returned object.
+dnnl::threadpool_interop::threadpool_iface *create_threadpool(int num_threads);
+
 // Sets the testing threadpool as active for the lifetime of the object.
 // Required for the tests that throw to work.
 struct scoped_tp_activation_t {